@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -77,9 +77,26 @@ typedef enum {
     OHOS_CAMERA_FORMAT_YCBCB_P010,
 } DCameraFormat;
 
+typedef enum {
+    DCAMERA_FRAME_INFO_FORMAT_JSON = 0,
+    DCAMERA_FRAME_INFO_FORMAT_BINARY = 1,
+} DCameraFrameInfoFormat;
+
+typedef enum {
+    DCAMERA_CONTROL_FORMAT_JSON = 0,
+    DCAMERA_CONTROL_FORMAT_BINARY = 1,
+} DCameraControlFormat;
+
+typedef enum {
+    DCAMERA_HDR_NONE = 0,
+    DCAMERA_HDR_HLG = 1,
+    DCAMERA_HDR_PQ = 2,
+} DCameraHdrType;
+
 const uint32_t DCAMERA_MAX_NUM = 1;
 const uint32_t DCAMERA_PRODUCER_ONE_MINUTE_MS = 1000;
 const uint32_t DCAMERA_PRODUCER_FPS_DEFAULT = 30;
+const int64_t DCAMERA_FRAME_LOG_INTERVAL_MS = 1000;
 const uint32_t DCAMERA_MAX_RECV_DATA_LEN = 104857600;
 const uint16_t DCAMERA_MAX_RECV_EXT_LEN = 65535;
 const uint32_t DISTRIBUTED_HARDWARE_CAMERA_SOURCE_SA_ID = 4803;
@@ -94,6 +111,7 @@ const std::string RECEIVER_SESSION_NAME_CONTROL = "_control_receiver";
 const std::string RECEIVER_SESSION_NAME_DATA_SNAPSHOT = "_dataSnapshot_receiver";
 const std::string RECEIVER_SESSION_NAME_DATA_CONTINUE = "_dataContinue_receiver";
 const std::string DCAMERA_PKG_NAME = "ohos.dhardware.dcamera";
+const std::string DCAMERA_SA_PROCESS_NAME = "dcamera";
 const std::string SNAP_SHOT_SESSION_FLAG = "dataSnapshot";
 const std::string CONTINUE_SESSION_FLAG = "dataContinue";
 const std::string TIME_STAMP_US = "timeStampUs";
@@ -108,6 +126,10 @@ const std::string DISTRIBUTED_HARDWARE_ID_KEY = "dhID";
 const std::string CAMERA_ID_PREFIX = "Camera_";
 const std::string CAMERA_PROTOCOL_VERSION_KEY = "ProtocolVer";
 const std::string CAMERA_PROTOCOL_VERSION_VALUE = "1.0";
+const std::string CAMERA_CONTROL_FORMAT_KEY = "ControlFormat";
+const std::string CAMERA_HDR10_KEY = "Hdr10";
+const std::string CAMERA_SESSION_MUX_KEY = "SessionMux";
+const std::string CAMERA_CAPTURE_GROUP_KEY = "CaptureGroup";
 const std::string CAMERA_POSITION_KEY = "Position";
 const std::string CAMERA_POSITION_BACK = "BACK";
 const std::string CAMERA_POSITION_FRONT = "FRONT";
@@ -143,6 +165,9 @@ const size_t HICOLLIE_SLEEP_TIME_US = 5 * 1000 * 1000;
 const int32_t DCAMERA_QOS_TYPE_MIN_BW = 40 * 1024 * 1024;
 const int32_t DCAMERA_QOS_TYPE_MAX_LATENCY = 4000;
 const int32_t DCAMERA_QOS_TYPE_MIN_LATENCY = 2000;
+// The control session carries small messages, snapshots are bulk transfers that tolerate a slower link setup.
+const int32_t DCAMERA_QOS_CTRL_MIN_BW = 4 * 1024 * 1024;
+const int32_t DCAMERA_QOS_JPEG_MAX_LATENCY = 10000;
 
 const int32_t CAMERA_META_DATA_ITEM_CAPACITY = 10;
 const int32_t CAMERA_META_DATA_DATA_CAPACITY = 100;
@@ -166,10 +191,13 @@ const std::string PRODUCER = "producer";
 const std::string REGISTER_SERVICE_NOTIFY = "regSvcNotify";
 const std::string SINK_START_EVENT = "sinkStartEvent";
 const std::string SOURCE_START_EVENT = "srcStartEvent";
+const std::string SOURCE_INPUT_EVENT = "srcInputEvent";
 const std::string DECODE_DATA_EVENT = "srcDecEvent";
 const std::string PIPELINE_SRC_EVENT = "srcPipeEvent";
 const std::string UNREGISTER_SERVICE_NOTIFY = "unregSvcNotify";
 const std::string LOOPER_SMOOTH = "looperSmooth";
+const std::string SOURCE_SYNC_THREAD = "srcSyncVideo";
+const std::string ENCODE_SYNC_THREAD = "sinkEncSync";
 const std::string DUMP_PATH = "/data/data/dcamera";
 const std::string DUMP_PHOTO_PATH = "/data/data/dcamera/photodump";
 const std::string TO_DISPLAY = "AfterDecodeToDisplay.yuv";
@@ -180,6 +208,7 @@ const std::string CAMERA_HICOLLIE = "CameraHicollie";
 const std::string SEPARATE_SINK_VERSION = "2.0";
 const std::string START_CAPTURE_SUCC = "operator start capture success";
 const std::string CAMERA_SERVICE_DIED = "camera service died";
+const std::string SINK_CAPTURE_DEGRADED = "sink capture degraded";
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif // OHOS_DISTRIBUTED_CAMERA_CONSTANTS_H
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,47 +16,97 @@
 #ifndef OHOS_DATA_BUFFER_H
 #define OHOS_DATA_BUFFER_H
 
+#include <atomic>
+#include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 #include "ifeedable_data.h"
 #include "dcamera_frame_info.h"
+#include "dcamera_imu_ring.h"
+#include "dcamera_memory_account.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 struct EisInfo {
-    int32_t frameId;
-    int64_t frameTimeStamp;
-    std::string initParams;
-    std::string imuData;
+    int32_t frameId = 0;
+    int64_t frameTimeStamp = 0;
+    /* Samples captured since the previous frame, only filled on the sink before sending. */
+    uint32_t exposureTime = 0;
+    std::vector<ImuSample> accData;
+    std::vector<ImuSample> gyroData;
 };
+enum class DataBufferKey : uint32_t {
+    VIDEO_FORMAT = 0,
+    WIDTH,
+    HEIGHT,
+    ALIGNED_WIDTH,
+    ALIGNED_HEIGHT,
+    FRAME_TYPE,
+    INDEX,
+    TIME_US,
+    TIME_STAMP_US,
+    START_ENCODE_TIME_US,
+    FINISH_ENCODE_TIME_US,
+    RECV_TIME_US,
+    ENCODER_PRESET,
+    KEY_COUNT,
+};
+
 class DataBuffer : public IFeedableData {
 public:
     explicit DataBuffer(size_t capacity);
+    static std::shared_ptr<DataBuffer> Acquire(size_t capacity);
+    /* Wrap memory owned elsewhere, releaser runs once the last reference is dropped. */
+    static std::shared_ptr<DataBuffer> Attach(uint8_t *data, size_t capacity,
+        const std::function<void(DataBuffer *)>& releaser);
 
     size_t Size() const;
     size_t Offset() const;
     size_t Capacity() const;
     uint8_t *Data() const;
     int32_t SetRange(size_t offset, size_t size);
+    /* Charges the buffer to a session until it is freed, only the first account a buffer gets counts. */
+    void Account(const std::shared_ptr<DCameraMemoryAccount>& account, DCameraMemoryOwner owner);
+    /* Hands a charged buffer on to its next holder, safe to call from every stream that shares the buffer. */
+    void SetOwner(DCameraMemoryOwner owner);
 
-    void SetInt32(const std::string name, int32_t value);
-    void SetInt64(const std::string name, int64_t value);
-    void SetString(const std::string name, std::string value);
+    void SetInt32(const std::string& name, int32_t value);
+    void SetInt64(const std::string& name, int64_t value);
+    void SetString(const std::string& name, std::string value);
     bool FindInt32(const std::string& name, int32_t& value);
     bool FindInt64(const std::string& name, int64_t& value);
     bool FindString(const std::string& name, std::string& value);
+    void SetInt32(DataBufferKey key, int32_t value);
+    void SetInt64(DataBufferKey key, int64_t value);
+    bool FindInt32(DataBufferKey key, int32_t& value) const;
+    bool FindInt64(DataBufferKey key, int64_t& value) const;
+    static bool GetKeyByName(const std::string& name, DataBufferKey& key);
     int64_t GetTimeStamp() override;
     virtual ~DataBuffer();
     DCameraFrameInfo frameInfo_;
     EisInfo eisInfo_;
 
 private:
+    DataBuffer(uint8_t *data, size_t capacity, size_t blockSize);
+
     size_t capacity_ = 0;
+    size_t blockSize_ = 0;
     size_t rangeOffset_ = 0;
     size_t rangeLength_ = 0;
     uint8_t *data_ = nullptr;
+    std::shared_ptr<DCameraMemoryAccount> account_ = nullptr;
+    std::atomic<DCameraMemoryOwner> owner_ { DCAMERA_MEMORY_CHANNEL };
+    size_t chargedBytes_ = 0;
+
+    constexpr static size_t ATTR_SLOT_NUM = static_cast<size_t>(DataBufferKey::KEY_COUNT);
+    int32_t int32Slots_[ATTR_SLOT_NUM] = { 0 };
+    int64_t int64Slots_[ATTR_SLOT_NUM] = { 0 };
+    uint32_t int32SlotMask_ = 0;
+    uint32_t int64SlotMask_ = 0;
 
     std::map<std::string, int32_t> int32Map_;
     std::map<std::string, int64_t> int64Map_;
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DATA_BUFFER_POOL_H
+#define OHOS_DATA_BUFFER_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Size-classed cache of raw frame blocks backing DataBuffer::Acquire. Blocks are not zero-filled,
+ * callers are expected to overwrite the whole range they use.
+ */
+class DataBufferPool {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DataBufferPool);
+
+public:
+    uint8_t *Acquire(size_t capacity, size_t &blockSize);
+    void Recycle(uint8_t *block, size_t blockSize);
+    void Clear();
+    size_t GetIdleBytes();
+    static size_t GetSizeClass(size_t capacity);
+
+private:
+    DataBufferPool() = default;
+    ~DataBufferPool();
+
+private:
+    constexpr static size_t MIN_BLOCK_SIZE = 4 * 1024;
+    constexpr static size_t SIZE_CLASS_STEPS = 4;
+    constexpr static size_t MAX_IDLE_BLOCKS_PER_CLASS = 8;
+    constexpr static size_t MAX_IDLE_BYTES = 128 * 1024 * 1024;
+
+    std::mutex poolLock_;
+    std::map<size_t, std::vector<uint8_t *>> idleBlocks_;
+    size_t idleBytes_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DATA_BUFFER_POOL_H
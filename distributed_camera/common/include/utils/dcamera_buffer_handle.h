@@ -16,12 +16,49 @@
 #ifndef OHOS_DCAMERA_BUFFER_HANDLE_H
 #define OHOS_DCAMERA_BUFFER_HANDLE_H
 
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <sys/types.h>
+
 #include "buffer_handle.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 void* DCameraMemoryMap(const BufferHandle *buffer);
 void DCameraMemoryUnmap(BufferHandle *buffer);
+
+/*
+ * Keeps HDI buffers mapped across AcquireBuffer/ShutterBuffer rounds. The fd is duplicated by every IPC
+ * round, so an entry is keyed by the driver buffer index and only reused while it still names the same file.
+ */
+class DCameraBufferMapCache {
+public:
+    DCameraBufferMapCache() = default;
+    ~DCameraBufferMapCache();
+
+    void* Map(int32_t index, const BufferHandle *buffer);
+    void Clear();
+    size_t GetMappedCount();
+
+private:
+    struct MappedBuffer {
+        dev_t dev;
+        ino_t ino;
+        size_t size;
+        void *virAddr;
+    };
+
+    static void Unmap(MappedBuffer& mapped);
+
+    constexpr static size_t MAX_MAPPED_BUFFERS = 32;
+    std::mutex cacheMutex_;
+    std::map<int32_t, MappedBuffer> mappedBuffers_;
+
+    DCameraBufferMapCache(const DCameraBufferMapCache &) = delete;
+    DCameraBufferMapCache &operator = (const DCameraBufferMapCache &) = delete;
+};
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif // OHOS_DCAMERA_BUFFER_HANDLE_H
\ No newline at end of file
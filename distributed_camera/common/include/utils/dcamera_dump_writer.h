@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_DUMP_WRITER_H
+#define OHOS_DCAMERA_DUMP_WRITER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Writes the hidumper frame dumps on a background thread. Write only copies the frame into a bounded queue, a
+ * full queue drops the frame and counts it, so the frame threads never wait for the file system. The writer
+ * opens a dump file on its first frame and keeps it open until the stream closes it, and stops appending to a
+ * file once it reaches DUMP_FILE_MAX_SIZE.
+ */
+class DCameraDumpWriter {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraDumpWriter);
+
+public:
+    // Returns false when the frame was dropped. A closing write is for one-off files such as photos.
+    bool Write(const std::string& dumpPath, const std::string& fileName, const uint8_t *buffer, size_t bufSize,
+        bool isClosing = false);
+    // Closes the file once the frames queued before are written.
+    void Close(const std::string& dumpPath, const std::string& fileName);
+    void CloseAll();
+    uint64_t GetDroppedCount();
+    size_t GetQueuedCount();
+
+    constexpr static size_t MAX_QUEUED_FRAMES = 16;
+    constexpr static size_t MAX_QUEUED_BYTES = 64 * 1024 * 1024;
+
+private:
+    DCameraDumpWriter() = default;
+    ~DCameraDumpWriter();
+
+    typedef enum {
+        DUMP_OP_WRITE = 0,
+        DUMP_OP_CLOSE,
+        DUMP_OP_CLOSE_ALL,
+    } DumpOp;
+
+    struct DumpTask {
+        DumpOp op = DUMP_OP_WRITE;
+        std::string dumpPath;
+        std::string fileName;
+        std::vector<uint8_t> data;
+        bool isClosing = false;
+    };
+
+    struct DumpFile {
+        FILE *file = nullptr;
+        int64_t size = 0;
+    };
+
+    void PostLocked(DumpTask&& task);
+    void WriteLoop();
+    void RunTask(DumpTask& task);
+    DumpFile *OpenFile(const std::string& dumpPath, const std::string& fileName);
+    void CloseFile(const std::string& key);
+
+    std::mutex queueMutex_;
+    std::condition_variable queueCond_;
+    std::deque<DumpTask> tasks_;
+    size_t queuedBytes_ = 0;
+    bool isStopping_ = false;
+    std::thread writeThread_;
+    std::atomic<uint64_t> droppedCount_ = 0;
+    // Only touched by the write thread.
+    std::map<std::string, DumpFile> files_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_DUMP_WRITER_H
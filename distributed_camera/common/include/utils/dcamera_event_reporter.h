@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_EVENT_REPORTER_H
+#define OHOS_DCAMERA_EVENT_REPORTER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+#include "dcamera_serial_queue.h"
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Writes the hisysevent and radar events off the calling thread. The caller captures the event fields by value,
+ * one serial queue on the background workers writes them in posting order, so the events of a device keep their
+ * order and open or capture never waits for hiview. A full queue drops the event and counts it.
+ */
+class DCameraEventReporter {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraEventReporter);
+
+public:
+    using Event = std::function<void()>;
+
+    // Returns false when the event was dropped.
+    bool Post(const Event& event);
+    uint64_t GetDroppedCount();
+    size_t GetPendingCount();
+
+    constexpr static size_t MAX_PENDING_EVENTS = 256;
+
+private:
+    DCameraEventReporter();
+    ~DCameraEventReporter() = default;
+
+    DCameraSerialQueue queue_;
+    std::atomic<uint64_t> droppedCount_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_EVENT_REPORTER_H
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_FRAME_DROP_STATISTICS_H
+#define OHOS_DCAMERA_FRAME_DROP_STATISTICS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+typedef enum {
+    // Source: the fps controller thinned the stream to the target rate.
+    DCAMERA_DROP_FPS_CONTROL = 0,
+    // Sink: the channel stayed busy and the encoder sync queue was trimmed down to its key frames.
+    DCAMERA_DROP_SEND_CONGESTION,
+    // Sink: delta frames skipped after a trim until the next key frame.
+    DCAMERA_DROP_WAIT_KEY_FRAME,
+    // Source: the decoder input queue was full, the codec does not keep up.
+    DCAMERA_DROP_DECODE_QUEUE_FULL,
+    // Both: a parallel pipeline stage was still full after the back pressure wait.
+    DCAMERA_DROP_STAGE_FULL,
+    // Source: the producer queue towards the driver was full.
+    DCAMERA_DROP_PRODUCER_QUEUE_FULL,
+    // Source: the frame was too late for the audio clock.
+    DCAMERA_DROP_SYNC_LATE,
+    // Source: frames still waiting in the smoother when the stream stopped.
+    DCAMERA_DROP_SMOOTHER_DISCARD,
+    // Both: the buffers of the session were over its memory budget.
+    DCAMERA_DROP_MEMORY_BUDGET,
+    DCAMERA_DROP_REASON_COUNT,
+} DCameraDropReason;
+
+// Dropped frames of one stream by reason. Counting only touches atomics, so the frame path never waits for a dump.
+class DCameraStreamDropCounter {
+public:
+    explicit DCameraStreamDropCounter(const std::string& streamKey);
+    void Add(DCameraDropReason reason, uint64_t count = 1);
+    uint64_t Get(DCameraDropReason reason) const;
+    uint64_t GetTotal() const;
+    const std::string& GetStreamKey() const;
+    void Reset();
+    void Dump(std::string& result) const;
+
+    static const char *GetReasonName(DCameraDropReason reason);
+
+private:
+    std::string streamKey_;
+    std::array<std::atomic<uint64_t>, DCAMERA_DROP_REASON_COUNT> counts_ {};
+};
+
+class DCameraFrameDropStatistics {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraFrameDropStatistics);
+
+public:
+    // The owner of a stream keeps the counter, the statistics only see it while somebody holds it.
+    std::shared_ptr<DCameraStreamDropCounter> Acquire(const std::string& streamKey);
+    // Reports what the session dropped through hisysevent and starts the counter over for the next session.
+    void ReportSession(const std::shared_ptr<DCameraStreamDropCounter>& counter);
+    void Dump(std::string& result);
+
+private:
+    DCameraFrameDropStatistics() = default;
+    ~DCameraFrameDropStatistics() = default;
+
+    std::mutex streamMutex_;
+    std::map<std::string, std::weak_ptr<DCameraStreamDropCounter>> streams_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_FRAME_DROP_STATISTICS_H
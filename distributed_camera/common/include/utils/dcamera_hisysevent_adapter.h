@@ -16,6 +16,7 @@
 #ifndef OHOS_DCAMERA_HISYSEVENT_ADAPTER_H
 #define OHOS_DCAMERA_HISYSEVENT_ADAPTER_H
 
+#include <cstdint>
 #include <string>
 
 namespace OHOS {
@@ -33,6 +34,7 @@ const std::string CLOSE_CAMERA_EVENT = "DCAMERA_CLOSE";
 const std::string START_CAPTURE_EVENT = "DCAMERA_CAPTURE";
 const std::string DCAMERA_CONFLICT_SEND_EVENT = "DCAMERA_CONFLICT_SEND";
 const std::string DCAMERA_CONFLICT_RECEIVE_EVENT = "DCAMERA_CONFLICT_RECEIVE";
+const std::string FRAME_DROP_EVENT = "DCAMERA_FRAME_DROP";
 enum DcameraHisyseventErrno : int32_t  {
     DCAMERA_SA_ERROR = 0,
     DCAMERA_HDF_ERROR = 1,
@@ -63,6 +65,8 @@ void ReportRegisterCameraEvent(const std::string& eventName, const std::string&
 void ReportCameraOperaterEvent(const std::string& eventName, const std::string& devId, const std::string& dhId,
     const std::string& errMsg);
 void ReportStartCaptureEvent(const std::string& eventName, EventCaptureInfo& capture, const std::string& errMsg);
+void ReportFrameDropEvent(const std::string& eventName, const std::string& streamKey, uint64_t total,
+    const std::string& detail);
 
 std::string CreateMsg(const char *format, ...);
 } // namespace DistributedHardware
@@ -16,6 +16,7 @@
 #ifndef OHOS_DCAMERA_HITRACE_ADAPTER_H
 #define OHOS_DCAMERA_HITRACE_ADAPTER_H
 
+#include <atomic>
 #include <cstdint>
 #include <string>
 
@@ -38,6 +39,20 @@ const std::string DCAMERA_OPEN_DATA_CONTINUE = "DCAMERA_OPEN_DATA_CONTINUE";
 const std::string DCAMERA_OPEN_DATA_SNAPSHOT = "DCAMERA_OPEN_DATA_SNAPSHOT";
 const std::string DCAMERA_CONTINUE_FIRST_FRAME = "DCAMERA_CONTINUE_FIRST_FRAME";
 const std::string DCAMERA_SNAPSHOT_FIRST_FRAME = "DCAMERA_SNAPSHOT_FIRST_FRAME";
+const std::string DCAMERA_FRAME_ENCODE = "DCAMERA_FRAME_ENCODE";
+const std::string DCAMERA_FRAME_ENCODE_OUTPUT = "DCAMERA_FRAME_ENCODE_OUTPUT";
+const std::string DCAMERA_FRAME_SEND_STREAM = "DCAMERA_FRAME_SEND_STREAM";
+const std::string DCAMERA_FRAME_DECODE = "DCAMERA_FRAME_DECODE";
+const std::string DCAMERA_FRAME_DECODE_FEED = "DCAMERA_FRAME_DECODE_FEED";
+const std::string DCAMERA_FRAME_DECODE_OUTPUT = "DCAMERA_FRAME_DECODE_OUTPUT";
+const std::string DCAMERA_FRAME_FPS_CONTROL = "DCAMERA_FRAME_FPS_CONTROL";
+const std::string DCAMERA_FRAME_ROTATE = "DCAMERA_FRAME_ROTATE";
+const std::string DCAMERA_FRAME_SCALE_CONVERT = "DCAMERA_FRAME_SCALE_CONVERT";
+const std::string DCAMERA_FRAME_EIS = "DCAMERA_FRAME_EIS";
+const std::string DCAMERA_FRAME_FEED_DRIVER = "DCAMERA_FRAME_FEED_DRIVER";
+const std::string DCAMERA_FRAME_ACQUIRE_BUFFER = "DCAMERA_FRAME_ACQUIRE_BUFFER";
+const std::string DCAMERA_FRAME_SHUTTER_BUFFER = "DCAMERA_FRAME_SHUTTER_BUFFER";
+constexpr int32_t DCAMERA_FRAME_TRACE_NO_INDEX = -1;
 enum DcameraTaskId {
     DCAMERA_OPEN_CHANNEL_TASKID = 0,
     DCAMERA_OPEN_DATA_CONTINUE_TASKID = 1,
@@ -48,6 +63,41 @@ enum DcameraTaskId {
 
 void DcameraStartAsyncTrace(const std::string& str, int32_t taskId);
 void DcameraFinishAsyncTrace(const std::string& str, int32_t taskId);
+
+/*
+ * Sync span over one frame in a hot path, named after the frame index so the sink and source traces line up.
+ * Only every Nth frame is traced, N comes from FRAME_TRACE_INTERVAL_PARA and is only read when a pipeline is
+ * created; with the parameter unset or the trace tag off a span costs a single branch on the cached interval.
+ * Frames that have no index yet, such as the encoder input, are sampled by the order they come in.
+ */
+class DCameraFrameTrace {
+public:
+    DCameraFrameTrace(const std::string& name, int32_t frameIndex)
+    {
+        if (frameTraceInterval_.load(std::memory_order_relaxed) != 0) {
+            Start(name, frameIndex);
+        }
+    }
+    ~DCameraFrameTrace()
+    {
+        if (isStarted_) {
+            Finish();
+        }
+    }
+    DCameraFrameTrace(const DCameraFrameTrace&) = delete;
+    DCameraFrameTrace& operator=(const DCameraFrameTrace&) = delete;
+
+    static void RefreshSampling();
+
+private:
+    void Start(const std::string& name, int32_t frameIndex);
+    void Finish();
+
+    constexpr static const char *FRAME_TRACE_INTERVAL_PARA = "sys.dcamera.trace.frame.interval";
+    static std::atomic<uint32_t> frameTraceInterval_;
+    static std::atomic<uint32_t> noIndexCount_;
+    bool isStarted_ = false;
+};
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif // OHOS_DCAMERA_HITRACE_ADAPTER_H
\ No newline at end of file
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_IMU_RING_H
+#define OHOS_DCAMERA_IMU_RING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr size_t IMU_AXIS_NUM = 3;
+constexpr int32_t IMU_X = 0;
+constexpr int32_t IMU_Y = 1;
+constexpr int32_t IMU_Z = 2;
+
+/* One accelerometer or gyroscope event, timeStamp is the sensor timestamp in nanoseconds. */
+struct ImuSample {
+    int64_t timeStamp = 0;
+    float data[IMU_AXIS_NUM] = { 0.0f, 0.0f, 0.0f };
+};
+
+/*
+ * Fixed size ring of timestamped IMU samples. One sensor callback thread pushes without locking, any number
+ * of readers copy samples out concurrently. Every slot carries a sequence number so a reader drops a slot
+ * the writer is overwriting instead of returning a torn sample. Samples are expected in timestamp order.
+ */
+class DCameraImuRing {
+public:
+    static constexpr size_t CAPACITY = 1024;
+
+    DCameraImuRing() = default;
+    ~DCameraImuRing() = default;
+
+    void Push(const ImuSample& sample);
+    size_t GetWindow(int64_t startTime, int64_t endTime, std::vector<ImuSample>& samples) const;
+    size_t ReadSince(uint64_t& cursor, std::vector<ImuSample>& samples) const;
+    uint64_t GetWriteIndex() const;
+    void Clear();
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> seq { 0 };
+        std::atomic<int64_t> timeStamp { 0 };
+        std::atomic<float> data[IMU_AXIS_NUM];
+    };
+
+    bool ReadSlot(uint64_t index, ImuSample& sample) const;
+    uint64_t GetOldestIndex(uint64_t writeIndex) const;
+
+    std::array<Slot, CAPACITY> slots_;
+    std::atomic<uint64_t> writeIndex_ { 0 };
+    std::atomic<uint64_t> readFloor_ { 0 };
+};
+
+/* IMU samples received from the remote sink, shared by the channel and the EIS node of the source pipeline. */
+class DCameraImuStore {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraImuStore);
+
+public:
+    DCameraImuRing& GetAccRing();
+    DCameraImuRing& GetGyroRing();
+    void PushSamples(const std::vector<ImuSample>& accData, const std::vector<ImuSample>& gyroData);
+    void SetExposureTime(uint32_t exposureTime);
+    uint32_t GetExposureTime();
+    void SetInitParam(const std::string& param);
+    std::string GetInitParam();
+    void Clear();
+
+private:
+    DCameraImuStore() = default;
+    ~DCameraImuStore() = default;
+
+    DCameraImuRing accRing_;
+    DCameraImuRing gyroRing_;
+    std::atomic<uint32_t> exposureTime_ { 0 };
+    std::mutex paramMutex_;
+    std::string initParam_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_IMU_RING_H
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_MEMORY_ACCOUNT_H
+#define OHOS_DCAMERA_MEMORY_ACCOUNT_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+// Who holds the memory of a frame buffer, a buffer moves to the producer and the smoother as it is handed on.
+typedef enum {
+    DCAMERA_MEMORY_CHANNEL = 0,
+    DCAMERA_MEMORY_ENCODER,
+    DCAMERA_MEMORY_DECODER,
+    DCAMERA_MEMORY_SCALER,
+    DCAMERA_MEMORY_EIS,
+    DCAMERA_MEMORY_PRODUCER,
+    DCAMERA_MEMORY_SMOOTHER,
+    DCAMERA_MEMORY_OWNER_COUNT,
+} DCameraMemoryOwner;
+
+/*
+ * Bytes the frame buffers of one capture session hold, live and at their peak, per owner and in total. A buffer
+ * is charged once it is tagged and uncharged when it is freed. With a budget set, the session drops frames while
+ * the live total is over it.
+ */
+class DCameraMemoryAccount {
+public:
+    DCameraMemoryAccount(const std::string& sessionKey, uint64_t budgetBytes);
+    void Charge(DCameraMemoryOwner owner, uint64_t bytes);
+    void Uncharge(DCameraMemoryOwner owner, uint64_t bytes);
+    void Move(DCameraMemoryOwner from, DCameraMemoryOwner to, uint64_t bytes);
+    uint64_t GetLiveBytes(DCameraMemoryOwner owner) const;
+    uint64_t GetPeakBytes(DCameraMemoryOwner owner) const;
+    uint64_t GetLiveTotal() const;
+    uint64_t GetPeakTotal() const;
+    uint64_t GetBudget() const;
+    bool IsOverBudget() const;
+    const std::string& GetSessionKey() const;
+    // Starts the peaks over from the live bytes, called when a session ends and the account is kept for the next.
+    void ResetPeak();
+    void Dump(std::string& result) const;
+
+    static const char *GetOwnerName(DCameraMemoryOwner owner);
+
+private:
+    static bool IsValidOwner(DCameraMemoryOwner owner);
+    static void UpdatePeak(std::atomic<uint64_t>& peak, uint64_t value);
+
+    std::string sessionKey_;
+    uint64_t budgetBytes_ = 0;
+    std::array<std::atomic<uint64_t>, DCAMERA_MEMORY_OWNER_COUNT> liveBytes_ {};
+    std::array<std::atomic<uint64_t>, DCAMERA_MEMORY_OWNER_COUNT> peakBytes_ {};
+    std::atomic<uint64_t> liveTotal_ {0};
+    std::atomic<uint64_t> peakTotal_ {0};
+};
+
+class DCameraMemoryStatistics {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraMemoryStatistics);
+
+public:
+    // The owner of a session keeps the account, the budget is read from MEMORY_BUDGET_PARA when it is created.
+    std::shared_ptr<DCameraMemoryAccount> Acquire(const std::string& sessionKey);
+    // Logs the peaks of the session that ended and starts them over.
+    void ReportSession(const std::shared_ptr<DCameraMemoryAccount>& account);
+    void Dump(std::string& result);
+
+private:
+    DCameraMemoryStatistics() = default;
+    ~DCameraMemoryStatistics() = default;
+
+    constexpr static const char *MEMORY_BUDGET_PARA = "sys.dcamera.session.memory.budget.mb";
+    constexpr static uint64_t BYTES_PER_MB = 1024 * 1024;
+
+    std::mutex sessionMutex_;
+    std::map<std::string, std::weak_ptr<DCameraMemoryAccount>> sessions_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_MEMORY_ACCOUNT_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -95,6 +95,15 @@ public:
     bool ReportDcameraClose(const std::string& func, CameraClose bizStage, BizState bizState, int32_t errCode);
     bool ReportDcameraCloseProgress(const std::string& func, CameraClose bizStage, int32_t errCode);
     bool ReportDcameraUnInit(const std::string& func, CameraUnInit bizStage, BizState bizState, int32_t errCode);
+
+private:
+    bool WriteDcameraInit(const std::string& func, CameraInit bizStage, BizState bizState, int32_t errCode);
+    bool WriteDcameraInitProgress(const std::string& func, CameraInit bizStage, int32_t errCode);
+    bool WriteDcameraOpen(const std::string& func, CameraOpen bizStage, BizState bizState, int32_t errCode);
+    bool WriteDcameraOpenProgress(const std::string& func, CameraOpen bizStage, int32_t errCode);
+    bool WriteDcameraClose(const std::string& func, CameraClose bizStage, BizState bizState, int32_t errCode);
+    bool WriteDcameraCloseProgress(const std::string& func, CameraClose bizStage, int32_t errCode);
+    bool WriteDcameraUnInit(const std::string& func, CameraUnInit bizStage, BizState bizState, int32_t errCode);
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_SERIAL_QUEUE_H
+#define OHOS_DCAMERA_SERIAL_QUEUE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "dcamera_thread_role.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Serial task queue of one object on the shared ffrt workers. Tasks of a queue run in posting order and never
+ * concurrently, queues of different objects run in parallel, so an open camera no longer holds a thread per
+ * object. A queue gives its worker back after MAX_TASKS_PER_TURN tasks and resubmits itself, a busy stream can
+ * not starve the others. Stopping drops the pending tasks and waits for the running one, unless it is called
+ * from a task of the same queue.
+ */
+class DCameraSerialQueue {
+public:
+    using Task = std::function<void()>;
+
+    DCameraSerialQueue(const std::string& name, DCameraThreadRole role);
+    ~DCameraSerialQueue();
+
+    bool PostTask(const Task& task);
+    void RemoveAllTasks();
+    void Stop();
+    size_t GetPendingCount();
+    const std::string& GetName() const;
+
+    constexpr static size_t MAX_TASKS_PER_TURN = 8;
+
+private:
+    struct State {
+        std::string name;
+        int32_t qos = 0;
+        std::mutex mutex;
+        std::condition_variable idleCond;
+        std::deque<Task> tasks;
+        bool isScheduled = false;
+        bool isStopped = false;
+        std::thread::id runningThread;
+    };
+
+    static void Submit(const std::shared_ptr<State>& state);
+    static void Drain(const std::shared_ptr<State>& state);
+
+    std::shared_ptr<State> state_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_SERIAL_QUEUE_H
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_SPSC_QUEUE_H
+#define OHOS_DCAMERA_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Bounded queue for exactly one producer thread and one consumer thread. Push and Pop only touch the two
+ * indexes, a blocked consumer is woken through an eventfd which the producer writes only while the consumer
+ * is actually waiting. Wakeup may be called from any thread to release the consumer, e.g. on stop.
+ */
+template <typename T>
+class DCameraSpscQueue {
+public:
+    explicit DCameraSpscQueue(size_t capacity) : slots_(capacity > 0 ? capacity : 1)
+    {
+        eventFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    }
+
+    ~DCameraSpscQueue()
+    {
+        if (eventFd_ >= 0) {
+            close(eventFd_);
+        }
+    }
+
+    DCameraSpscQueue(const DCameraSpscQueue&) = delete;
+    DCameraSpscQueue& operator=(const DCameraSpscQueue&) = delete;
+
+    // Producer side, fails without blocking when the queue is full.
+    bool Push(T item)
+    {
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) >= slots_.size()) {
+            return false;
+        }
+        slots_[tail % slots_.size()] = std::move(item);
+        tail_.store(tail + 1, std::memory_order_seq_cst);
+        if (waiting_.load(std::memory_order_seq_cst)) {
+            Signal();
+        }
+        return true;
+    }
+
+    // Consumer side, copies the oldest item without removing it.
+    bool Front(T& item) const
+    {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = slots_[head % slots_.size()];
+        return true;
+    }
+
+    // Consumer side.
+    bool Pop(T& item)
+    {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = std::move(slots_[head % slots_.size()]);
+        slots_[head % slots_.size()] = T();
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, returns true once an item is queued, false on Wakeup or timeout.
+    bool Wait(int32_t timeoutMs)
+    {
+        waiting_.store(true, std::memory_order_seq_cst);
+        if (!Empty()) {
+            waiting_.store(false, std::memory_order_relaxed);
+            return true;
+        }
+        Sleep(timeoutMs);
+        waiting_.store(false, std::memory_order_relaxed);
+        return !Empty();
+    }
+
+    // Consumer side, sleeps until Wakeup or timeout regardless of the queued items.
+    void WaitWakeup(int32_t timeoutMs)
+    {
+        Sleep(timeoutMs);
+    }
+
+    void Wakeup()
+    {
+        Signal();
+    }
+
+    // Only call while the producer is not pushing.
+    void Clear()
+    {
+        T item;
+        while (Pop(item)) {
+        }
+    }
+
+    bool Empty() const
+    {
+        return head_.load(std::memory_order_seq_cst) == tail_.load(std::memory_order_seq_cst);
+    }
+
+    size_t Size() const
+    {
+        uint64_t head = head_.load(std::memory_order_acquire);
+        return static_cast<size_t>(tail_.load(std::memory_order_acquire) - head);
+    }
+
+    size_t Capacity() const
+    {
+        return slots_.size();
+    }
+
+private:
+    void Signal()
+    {
+        uint64_t value = 1;
+        if (eventFd_ >= 0) {
+            (void)write(eventFd_, &value, sizeof(value));
+        }
+    }
+
+    void Sleep(int32_t timeoutMs)
+    {
+        // Without an eventfd poll still honours the timeout, the consumer then falls back to polling.
+        struct pollfd fds = { eventFd_, POLLIN, 0 };
+        if (poll(&fds, 1, timeoutMs) > 0) {
+            uint64_t value = 0;
+            (void)read(eventFd_, &value, sizeof(value));
+        }
+    }
+
+    std::vector<T> slots_;
+    alignas(64) std::atomic<uint64_t> head_ { 0 };
+    alignas(64) std::atomic<uint64_t> tail_ { 0 };
+    std::atomic<bool> waiting_ { false };
+    int32_t eventFd_ = -1;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_SPSC_QUEUE_H
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_STARTUP_PROFILER_H
+#define OHOS_DCAMERA_STARTUP_PROFILER_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * How long the phases of bringing the camera services up took and when they ran, relative to the first service
+ * start of the process. Only the first run of a phase is kept, so the pieces loaded on first use show up once,
+ * at the time they were first needed.
+ */
+class DCameraStartupProfiler {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraStartupProfiler);
+
+public:
+    void RecordPhase(const std::string& phase, int64_t startUs, int64_t finishUs);
+    void Dump(std::string& result);
+
+private:
+    DCameraStartupProfiler() = default;
+    ~DCameraStartupProfiler() = default;
+
+    struct PhaseInfo {
+        std::string name;
+        int64_t startUs;
+        int64_t durationUs;
+    };
+
+    constexpr static int64_t US_PER_MS = 1000;
+
+    std::mutex phaseMutex_;
+    int64_t firstStartUs_ = 0;
+    std::vector<PhaseInfo> phases_;
+};
+
+// Times the scope it lives in as one startup phase, under a sync HiTrace span of the same name.
+class DCameraStartupPhase {
+public:
+    explicit DCameraStartupPhase(const std::string& phase);
+    ~DCameraStartupPhase();
+    DCameraStartupPhase(const DCameraStartupPhase&) = delete;
+    DCameraStartupPhase& operator=(const DCameraStartupPhase&) = delete;
+
+private:
+    std::string phase_;
+    int64_t startUs_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_STARTUP_PROFILER_H
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_THREAD_ROLE_H
+#define OHOS_DCAMERA_THREAD_ROLE_H
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+typedef enum {
+    // Pipeline, codec and stage threads every frame passes through.
+    DCAMERA_THREAD_FRAME = 0,
+    // Producer, smoother and sync threads handing frames to the driver or the channel.
+    DCAMERA_THREAD_OUTPUT,
+    // Session setup and teardown tasks.
+    DCAMERA_THREAD_CONTROL,
+    // Housekeeping such as evicting idle codecs.
+    DCAMERA_THREAD_BACKGROUND,
+    DCAMERA_THREAD_ROLE_COUNT,
+} DCameraThreadRole;
+
+struct DCameraThreadPolicy {
+    // Empty keeps the inherited affinity.
+    std::vector<int32_t> cpus;
+    bool hasNice = false;
+    int32_t nice = 0;
+    int32_t ffrtQos = 0;
+};
+
+/*
+ * Placement of the service threads by role. Each role reads sys.dcamera.thread.<role>.cpus as a cpu list such
+ * as "4-7" or "0,2", sys.dcamera.thread.<role>.nice and, for roles run as ffrt tasks,
+ * sys.dcamera.thread.<role>.qos. Unset parameters keep the default scheduling, so frame path threads only move
+ * off the little cores on products that configure it. Parameters are read once per process.
+ *
+ * The IPC threads of a process are sized with sys.dcamera.thread.ipc.<process>, one pool serves every
+ * system ability the process hosts.
+ */
+class DCameraThreadRoleRegistry {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraThreadRoleRegistry);
+public:
+    // Names the calling thread and applies the affinity and nice value of its role.
+    void ApplyCurrentThread(DCameraThreadRole role, const std::string& name);
+    DCameraThreadPolicy GetPolicy(DCameraThreadRole role);
+    int32_t GetFfrtQos(DCameraThreadRole role);
+    // Unset keeps the IPC default, call it before the service is published.
+    static void ApplyIpcThreadNum(const std::string& process);
+
+    static const char *GetRoleName(DCameraThreadRole role);
+    static bool ParseCpuList(const std::string& text, std::vector<int32_t>& cpus);
+
+    constexpr static int32_t MIN_NICE = -20;
+    constexpr static int32_t MAX_NICE = 19;
+    constexpr static int32_t MAX_IPC_THREAD_NUM = 32;
+
+private:
+    DCameraThreadRoleRegistry() = default;
+    ~DCameraThreadRoleRegistry() = default;
+
+    void LoadLocked();
+    static bool IsValidRole(DCameraThreadRole role);
+    static int32_t GetDefaultFfrtQos(DCameraThreadRole role);
+
+    std::mutex mutex_;
+    bool isLoaded_ = false;
+    std::array<DCameraThreadPolicy, DCAMERA_THREAD_ROLE_COUNT> policies_ {};
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_THREAD_ROLE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -22,8 +22,10 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <functional>
 #include <queue>
+#include <set>
 #include "dhfwk_single_instance.h"
 #include "iaccess_listener.h"
 
@@ -44,6 +46,8 @@ std::string Base64Decode(const std::string& basicString);
 void DumpBufferToFile(const std::string& dumpPath, const std::string& fileName, uint8_t *buffer, size_t bufSize);
 bool IsBase64(unsigned char c);
 int32_t IsUnderDumpMaxSize(const std::string& dumpPath, const std::string& fileName);
+template <typename T>
+bool GetSysPara(const char *key, T &value);
 
 #ifdef DCAMERA_MMAP_RESERVE
 class ConverterHandle {
@@ -56,6 +60,7 @@ public:
 
     using DlHandle = void *;
 private:
+    std::mutex initMutex_;
     std::atomic<bool> isInited_ = false;
     DlHandle dlHandler_ = nullptr;
     OHOS::OpenSourceLibyuv::ImageConverter converter_ = {0};
@@ -119,6 +124,19 @@ private:
     std::mutex mtxLock_;
 };
 
+class DCameraHdrAbility {
+FWK_DECLARE_SINGLE_INSTANCE(DCameraHdrAbility);
+
+public:
+    void SetHdr10Supported(const std::string& devId, bool isSupported);
+    bool IsHdr10Supported(const std::string& devId);
+    // DCameraHdrType of a stream, HDR only for P010 with an HLG or PQ data space towards a Main10 capable sink.
+    int32_t GetHdrType(const std::string& devId, int32_t format, int32_t dataspace);
+private:
+    std::set<std::string> hdr10DevIds_;
+    std::mutex mtxLock_;
+};
+
 class DCameraAccessConfigManager {
 FWK_DECLARE_SINGLE_INSTANCE(DCameraAccessConfigManager);
 
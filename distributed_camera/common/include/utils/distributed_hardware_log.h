@@ -17,6 +17,8 @@
 #define OHOS_DCAMERA_SA_LOG_H
 
 #include "hilog/log.h"
+#include <atomic>
+#include <chrono>
 #include <inttypes.h>
 
 namespace OHOS {
@@ -41,6 +43,27 @@ namespace DistributedHardware {
 #define DHLOGE(fmt, ...) HILOG_ERROR(LOG_CORE, "[%{public}s][%{public}s][%{public}s:%{public}s]:" fmt, \
      DH_LOG_TAG, __FUNCTION__, DCAMERA_FILENAME, DCAMERA_STR_LINE, ##__VA_ARGS__)
 
+/* Per frame logging: every call site keeps its own counter, the arguments are only evaluated when it logs. */
+#define DHLOGI_EVERY_N(n, fmt, ...)                                                          \
+    do {                                                                                     \
+        static std::atomic<uint64_t> dhLogEveryNCount(0);                                    \
+        if (dhLogEveryNCount.fetch_add(1, std::memory_order_relaxed) % (n) == 0) {          \
+            DHLOGI(fmt, ##__VA_ARGS__);                                                      \
+        }                                                                                    \
+    } while (0)
+
+#define DHLOGI_RATELIMITED(intervalMs, fmt, ...)                                             \
+    do {                                                                                     \
+        static std::atomic<int64_t> dhLogLastMs(INT64_MIN);                                  \
+        int64_t dhLogNowMs = std::chrono::duration_cast<std::chrono::milliseconds>(          \
+            std::chrono::steady_clock::now().time_since_epoch()).count();                    \
+        int64_t dhLogLast = dhLogLastMs.load(std::memory_order_relaxed);                     \
+        if ((dhLogLast == INT64_MIN || dhLogNowMs - dhLogLast >= (intervalMs)) &&            \
+            dhLogLastMs.compare_exchange_strong(dhLogLast, dhLogNowMs, std::memory_order_relaxed)) { \
+            DHLOGI(fmt, ##__VA_ARGS__);                                                      \
+        }                                                                                    \
+    } while (0)
+
 #define CHECK_AND_RETURN_RET_LOG(cond, ret, fmt, ...)   \
     do {                                                \
         if ((cond)) {                                   \
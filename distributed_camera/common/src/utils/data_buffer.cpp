@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,6 +14,11 @@
  */
 
 #include "data_buffer.h"
+
+#include <string_view>
+#include <unordered_map>
+
+#include "data_buffer_pool.h"
 #include "distributed_camera_errno.h"
 #include "distributed_camera_constants.h"
 #include "distributed_hardware_log.h"
@@ -31,6 +36,52 @@ DataBuffer::DataBuffer(size_t capacity)
     }
 }
 
+DataBuffer::DataBuffer(uint8_t *data, size_t capacity, size_t blockSize)
+    : capacity_(capacity), blockSize_(blockSize), rangeLength_(capacity), data_(data)
+{
+}
+
+std::shared_ptr<DataBuffer> DataBuffer::Acquire(size_t capacity)
+{
+    if (capacity == 0 || capacity > DCAMERA_MAX_RECV_DATA_LEN) {
+        return std::make_shared<DataBuffer>(capacity);
+    }
+    size_t blockSize = 0;
+    uint8_t *block = DataBufferPool::GetInstance().Acquire(capacity, blockSize);
+    if (block == nullptr) {
+        return std::make_shared<DataBuffer>(capacity);
+    }
+    DataBuffer *buffer = new (std::nothrow) DataBuffer(block, capacity, blockSize);
+    if (buffer == nullptr) {
+        DataBufferPool::GetInstance().Recycle(block, blockSize);
+        return std::make_shared<DataBuffer>(capacity);
+    }
+    return std::shared_ptr<DataBuffer>(buffer, [](DataBuffer *pooled) {
+        DataBufferPool::GetInstance().Recycle(pooled->data_, pooled->blockSize_);
+        pooled->data_ = nullptr;
+        delete pooled;
+    });
+}
+
+std::shared_ptr<DataBuffer> DataBuffer::Attach(uint8_t *data, size_t capacity,
+    const std::function<void(DataBuffer *)>& releaser)
+{
+    if (data == nullptr || capacity == 0) {
+        return nullptr;
+    }
+    DataBuffer *buffer = new (std::nothrow) DataBuffer(data, capacity, 0);
+    if (buffer == nullptr) {
+        return nullptr;
+    }
+    return std::shared_ptr<DataBuffer>(buffer, [releaser](DataBuffer *attached) {
+        if (releaser != nullptr) {
+            releaser(attached);
+        }
+        attached->data_ = nullptr;
+        delete attached;
+    });
+}
+
 size_t DataBuffer::Capacity() const
 {
     return capacity_;
@@ -66,52 +117,177 @@ int32_t DataBuffer::SetRange(size_t offset, size_t size)
     return DCAMERA_OK;
 }
 
-void DataBuffer::SetInt32(const std::string name, int32_t value)
+void DataBuffer::Account(const std::shared_ptr<DCameraMemoryAccount>& account, DCameraMemoryOwner owner)
+{
+    if (account == nullptr || account_ != nullptr || data_ == nullptr) {
+        return;
+    }
+    // A pooled buffer holds its whole block.
+    chargedBytes_ = (blockSize_ != 0) ? blockSize_ : capacity_;
+    owner_.store(owner);
+    account_ = account;
+    account_->Charge(owner, chargedBytes_);
+}
+
+void DataBuffer::SetOwner(DCameraMemoryOwner owner)
+{
+    if (account_ == nullptr) {
+        return;
+    }
+    DCameraMemoryOwner previous = owner_.exchange(owner);
+    account_->Move(previous, owner, chargedBytes_);
+}
+
+namespace {
+const char *const DATA_BUFFER_KEY_NAMES[] = {
+    "Videoformat",
+    "width",
+    "height",
+    "alignedWidth",
+    "alignedHeight",
+    "frameType",
+    "index",
+    "timeUs",
+    "timeStampUs",
+    "startEncodeT",
+    "finishEncodeT",
+    "recvT",
+    "encoderPreset",
+};
+static_assert(sizeof(DATA_BUFFER_KEY_NAMES) / sizeof(DATA_BUFFER_KEY_NAMES[0]) ==
+    static_cast<size_t>(DataBufferKey::KEY_COUNT), "DataBufferKey names mismatch");
+
+// Built once from the names above, the views point at the string literals.
+const std::unordered_map<std::string_view, DataBufferKey> &GetDataBufferKeyMap()
 {
+    static const std::unordered_map<std::string_view, DataBufferKey> keyMap = []() {
+        std::unordered_map<std::string_view, DataBufferKey> keys;
+        for (size_t i = 0; i < static_cast<size_t>(DataBufferKey::KEY_COUNT); i++) {
+            keys.emplace(DATA_BUFFER_KEY_NAMES[i], static_cast<DataBufferKey>(i));
+        }
+        return keys;
+    }();
+    return keyMap;
+}
+}
+
+bool DataBuffer::GetKeyByName(const std::string& name, DataBufferKey& key)
+{
+    const std::unordered_map<std::string_view, DataBufferKey> &keyMap = GetDataBufferKeyMap();
+    auto iter = keyMap.find(std::string_view(name));
+    if (iter == keyMap.end()) {
+        return false;
+    }
+    key = iter->second;
+    return true;
+}
+
+void DataBuffer::SetInt32(DataBufferKey key, int32_t value)
+{
+    size_t slot = static_cast<size_t>(key);
+    if (slot >= ATTR_SLOT_NUM) {
+        return;
+    }
+    int32Slots_[slot] = value;
+    int32SlotMask_ |= (1U << slot);
+}
+
+void DataBuffer::SetInt64(DataBufferKey key, int64_t value)
+{
+    size_t slot = static_cast<size_t>(key);
+    if (slot >= ATTR_SLOT_NUM) {
+        return;
+    }
+    int64Slots_[slot] = value;
+    int64SlotMask_ |= (1U << slot);
+}
+
+bool DataBuffer::FindInt32(DataBufferKey key, int32_t& value) const
+{
+    size_t slot = static_cast<size_t>(key);
+    if (slot >= ATTR_SLOT_NUM || (int32SlotMask_ & (1U << slot)) == 0) {
+        value = 0;
+        return false;
+    }
+    value = int32Slots_[slot];
+    return true;
+}
+
+bool DataBuffer::FindInt64(DataBufferKey key, int64_t& value) const
+{
+    size_t slot = static_cast<size_t>(key);
+    if (slot >= ATTR_SLOT_NUM || (int64SlotMask_ & (1U << slot)) == 0) {
+        value = 0;
+        return false;
+    }
+    value = int64Slots_[slot];
+    return true;
+}
+
+void DataBuffer::SetInt32(const std::string& name, int32_t value)
+{
+    DataBufferKey key;
+    if (GetKeyByName(name, key)) {
+        SetInt32(key, value);
+        return;
+    }
     int32Map_[name] = value;
 }
 
-void DataBuffer::SetInt64(const std::string name, int64_t value)
+void DataBuffer::SetInt64(const std::string& name, int64_t value)
 {
+    DataBufferKey key;
+    if (GetKeyByName(name, key)) {
+        SetInt64(key, value);
+        return;
+    }
     int64Map_[name] = value;
 }
 
-void DataBuffer::SetString(const std::string name, std::string value)
+void DataBuffer::SetString(const std::string& name, std::string value)
 {
-    stringMap_[name] = value;
+    stringMap_[name] = std::move(value);
 }
 
 bool DataBuffer::FindInt32(const std::string& name, int32_t& value)
 {
-    if (int32Map_.count(name) != 0) {
-        value = int32Map_[name];
-        return true;
-    } else {
+    DataBufferKey key;
+    if (GetKeyByName(name, key)) {
+        return FindInt32(key, value);
+    }
+    auto iter = int32Map_.find(name);
+    if (iter == int32Map_.end()) {
         value = 0;
         return false;
     }
+    value = iter->second;
+    return true;
 }
 
 bool DataBuffer::FindInt64(const std::string& name, int64_t& value)
 {
-    if (int64Map_.count(name) != 0) {
-        value = int64Map_[name];
-        return true;
-    } else {
+    DataBufferKey key;
+    if (GetKeyByName(name, key)) {
+        return FindInt64(key, value);
+    }
+    auto iter = int64Map_.find(name);
+    if (iter == int64Map_.end()) {
         value = 0;
         return false;
     }
+    value = iter->second;
+    return true;
 }
 
 bool DataBuffer::FindString(const std::string& name, std::string& value)
 {
-    if (stringMap_.count(name) != 0) {
-        value = stringMap_[name];
-        return true;
-    } else {
+    auto iter = stringMap_.find(name);
+    if (iter == stringMap_.end()) {
         value = "";
         return false;
     }
+    value = iter->second;
+    return true;
 }
 
 int64_t DataBuffer::GetTimeStamp()
@@ -121,6 +297,10 @@ int64_t DataBuffer::GetTimeStamp()
 
 DataBuffer::~DataBuffer()
 {
+    if (account_ != nullptr) {
+        account_->Uncharge(owner_.load(), chargedBytes_);
+        account_ = nullptr;
+    }
     if (data_ != nullptr) {
         delete[] data_;
         data_ = nullptr;
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "data_buffer_pool.h"
+
+#include <new>
+
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DataBufferPool);
+
+DataBufferPool::~DataBufferPool()
+{
+    Clear();
+}
+
+size_t DataBufferPool::GetSizeClass(size_t capacity)
+{
+    if (capacity <= MIN_BLOCK_SIZE) {
+        return MIN_BLOCK_SIZE;
+    }
+    size_t highBit = MIN_BLOCK_SIZE;
+    while ((highBit << 1) != 0 && (highBit << 1) <= capacity) {
+        highBit <<= 1;
+    }
+    size_t step = highBit / SIZE_CLASS_STEPS;
+    return (capacity + step - 1) / step * step;
+}
+
+uint8_t *DataBufferPool::Acquire(size_t capacity, size_t &blockSize)
+{
+    blockSize = GetSizeClass(capacity);
+    {
+        std::lock_guard<std::mutex> lock(poolLock_);
+        auto iter = idleBlocks_.find(blockSize);
+        if (iter != idleBlocks_.end() && !iter->second.empty()) {
+            uint8_t *block = iter->second.back();
+            iter->second.pop_back();
+            idleBytes_ -= blockSize;
+            return block;
+        }
+    }
+    uint8_t *block = new (std::nothrow) uint8_t[blockSize];
+    if (block == nullptr) {
+        DHLOGE("DataBufferPool alloc block failed, blockSize: %{public}zu", blockSize);
+        blockSize = 0;
+    }
+    return block;
+}
+
+void DataBufferPool::Recycle(uint8_t *block, size_t blockSize)
+{
+    if (block == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(poolLock_);
+        std::vector<uint8_t *> &blocks = idleBlocks_[blockSize];
+        if (blocks.size() < MAX_IDLE_BLOCKS_PER_CLASS && idleBytes_ + blockSize <= MAX_IDLE_BYTES) {
+            blocks.push_back(block);
+            idleBytes_ += blockSize;
+            return;
+        }
+    }
+    delete[] block;
+}
+
+void DataBufferPool::Clear()
+{
+    std::map<size_t, std::vector<uint8_t *>> idleBlocks;
+    {
+        std::lock_guard<std::mutex> lock(poolLock_);
+        idleBlocks.swap(idleBlocks_);
+        idleBytes_ = 0;
+    }
+    for (auto &iter : idleBlocks) {
+        for (uint8_t *block : iter.second) {
+            delete[] block;
+        }
+    }
+}
+
+size_t DataBufferPool::GetIdleBytes()
+{
+    std::lock_guard<std::mutex> lock(poolLock_);
+    return idleBytes_;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
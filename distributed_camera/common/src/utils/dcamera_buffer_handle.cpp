@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <string>
 #include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "distributed_hardware_log.h"
 
@@ -53,5 +54,71 @@ void DCameraMemoryUnmap(BufferHandle *buffer)
     }
     buffer->virAddr = nullptr;
 }
+
+DCameraBufferMapCache::~DCameraBufferMapCache()
+{
+    Clear();
+}
+
+void* DCameraBufferMapCache::Map(int32_t index, const BufferHandle *buffer)
+{
+    if (buffer == nullptr || buffer->fd < 0 || buffer->size <= 0) {
+        DHLOGE("map cache invalid buffer handle");
+        return nullptr;
+    }
+    struct stat fileStat;
+    if (fstat(buffer->fd, &fileStat) != 0) {
+        DHLOGE("fstat failed errno %{public}s, fd : %{public}d", strerror(errno), buffer->fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(buffer->size);
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    auto iter = mappedBuffers_.find(index);
+    if (iter != mappedBuffers_.end()) {
+        MappedBuffer& mapped = iter->second;
+        if (mapped.dev == fileStat.st_dev && mapped.ino == fileStat.st_ino && mapped.size == size) {
+            return mapped.virAddr;
+        }
+        Unmap(mapped);
+        mappedBuffers_.erase(iter);
+    }
+    if (mappedBuffers_.size() >= MAX_MAPPED_BUFFERS) {
+        DHLOGI("map cache full, drop %{public}zu mapped buffers", mappedBuffers_.size());
+        for (auto& item : mappedBuffers_) {
+            Unmap(item.second);
+        }
+        mappedBuffers_.clear();
+    }
+    void* virAddr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, buffer->fd, 0);
+    if (virAddr == MAP_FAILED) {
+        DHLOGE("mmap failed errno %{public}s, fd : %{public}d", strerror(errno), buffer->fd);
+        return nullptr;
+    }
+    mappedBuffers_[index] = { fileStat.st_dev, fileStat.st_ino, size, virAddr };
+    return virAddr;
+}
+
+void DCameraBufferMapCache::Clear()
+{
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    for (auto& item : mappedBuffers_) {
+        Unmap(item.second);
+    }
+    mappedBuffers_.clear();
+}
+
+size_t DCameraBufferMapCache::GetMappedCount()
+{
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    return mappedBuffers_.size();
+}
+
+void DCameraBufferMapCache::Unmap(MappedBuffer& mapped)
+{
+    if (mapped.virAddr != nullptr && munmap(mapped.virAddr, mapped.size) != 0) {
+        DHLOGE("munmap failed err: %{public}s", strerror(errno));
+    }
+    mapped.virAddr = nullptr;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
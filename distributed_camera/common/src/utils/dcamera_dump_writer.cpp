@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_dump_writer.h"
+
+#include <cinttypes>
+#include <climits>
+#include <cstdlib>
+
+#include "dcamera_thread_role.h"
+#include "distributed_camera_constants.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraDumpWriter);
+
+namespace {
+const std::string DUMP_WRITE_THREAD = "DCameraDumpWrite";
+}
+
+DCameraDumpWriter::~DCameraDumpWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        isStopping_ = true;
+    }
+    queueCond_.notify_all();
+    if (writeThread_.joinable()) {
+        writeThread_.join();
+    }
+    for (auto& iter : files_) {
+        fclose(iter.second.file);
+    }
+    files_.clear();
+}
+
+bool DCameraDumpWriter::Write(const std::string& dumpPath, const std::string& fileName, const uint8_t *buffer,
+    size_t bufSize, bool isClosing)
+{
+    CHECK_AND_RETURN_RET_LOG(dumpPath.empty() || fileName.empty() || buffer == nullptr || bufSize == 0, false,
+        "%{public}s", "Dump write param is invalid.");
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (isStopping_ || tasks_.size() >= MAX_QUEUED_FRAMES || queuedBytes_ + bufSize > MAX_QUEUED_BYTES) {
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    DumpTask task;
+    task.dumpPath = dumpPath;
+    task.fileName = fileName;
+    task.data.assign(buffer, buffer + bufSize);
+    task.isClosing = isClosing;
+    queuedBytes_ += bufSize;
+    PostLocked(std::move(task));
+    return true;
+}
+
+void DCameraDumpWriter::Close(const std::string& dumpPath, const std::string& fileName)
+{
+    DumpTask task;
+    task.op = DUMP_OP_CLOSE;
+    task.dumpPath = dumpPath;
+    task.fileName = fileName;
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (writeThread_.joinable()) {
+        PostLocked(std::move(task));
+    }
+}
+
+void DCameraDumpWriter::CloseAll()
+{
+    DumpTask task;
+    task.op = DUMP_OP_CLOSE_ALL;
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (writeThread_.joinable()) {
+        PostLocked(std::move(task));
+    }
+}
+
+uint64_t DCameraDumpWriter::GetDroppedCount()
+{
+    return droppedCount_.load(std::memory_order_relaxed);
+}
+
+size_t DCameraDumpWriter::GetQueuedCount()
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    return tasks_.size();
+}
+
+void DCameraDumpWriter::PostLocked(DumpTask&& task)
+{
+    tasks_.push_back(std::move(task));
+    if (!writeThread_.joinable()) {
+        writeThread_ = std::thread([this]() { WriteLoop(); });
+    }
+    queueCond_.notify_one();
+}
+
+void DCameraDumpWriter::WriteLoop()
+{
+    DCameraThreadRoleRegistry::GetInstance().ApplyCurrentThread(DCAMERA_THREAD_BACKGROUND, DUMP_WRITE_THREAD);
+    std::unique_lock<std::mutex> lock(queueMutex_);
+    while (true) {
+        queueCond_.wait(lock, [this]() { return isStopping_ || !tasks_.empty(); });
+        if (isStopping_) {
+            tasks_.clear();
+            queuedBytes_ = 0;
+            return;
+        }
+        DumpTask task = std::move(tasks_.front());
+        tasks_.pop_front();
+        queuedBytes_ -= task.data.size();
+        lock.unlock();
+        RunTask(task);
+        lock.lock();
+    }
+}
+
+void DCameraDumpWriter::RunTask(DumpTask& task)
+{
+    if (task.op == DUMP_OP_CLOSE_ALL) {
+        for (auto& iter : files_) {
+            fclose(iter.second.file);
+        }
+        files_.clear();
+        return;
+    }
+    std::string key = task.dumpPath + "/" + task.fileName;
+    if (task.op == DUMP_OP_CLOSE) {
+        CloseFile(key);
+        return;
+    }
+    DumpFile *dumpFile = OpenFile(task.dumpPath, task.fileName);
+    if (dumpFile == nullptr) {
+        return;
+    }
+    int64_t frameSize = static_cast<int64_t>(task.data.size());
+    if (dumpFile->size + frameSize <= DUMP_FILE_MAX_SIZE) {
+        size_t written = fwrite(task.data.data(), 1, task.data.size(), dumpFile->file);
+        dumpFile->size += static_cast<int64_t>(written);
+        if (written != task.data.size()) {
+            DHLOGE("Write dump file %{public}s failed.", task.fileName.c_str());
+        }
+    }
+    if (task.isClosing) {
+        CloseFile(key);
+    }
+}
+
+DCameraDumpWriter::DumpFile *DCameraDumpWriter::OpenFile(const std::string& dumpPath, const std::string& fileName)
+{
+    std::string key = dumpPath + "/" + fileName;
+    auto iter = files_.find(key);
+    if (iter != files_.end()) {
+        return &iter->second;
+    }
+    char path[PATH_MAX + 1] = {0x00};
+    if (dumpPath.length() > PATH_MAX || realpath(dumpPath.c_str(), path) == nullptr) {
+        DHLOGE("The dump path is invalid.");
+        return nullptr;
+    }
+    CHECK_AND_RETURN_RET_LOG(path != DUMP_PATH && path != DUMP_PHOTO_PATH, nullptr, "The dump path is invalid.");
+    std::string file = std::string(path) + "/" + fileName;
+    FILE *fp = fopen(file.c_str(), "ab");
+    CHECK_AND_RETURN_RET_LOG(fp == nullptr, nullptr, "Open dump file %{public}s failed.", fileName.c_str());
+    DumpFile dumpFile;
+    dumpFile.file = fp;
+    if (fseek(fp, 0, SEEK_END) == 0) {
+        long offset = ftell(fp);
+        dumpFile.size = offset > 0 ? static_cast<int64_t>(offset) : 0;
+    }
+    DHLOGI("Open dump file %{public}s, size %{public}" PRId64, fileName.c_str(), dumpFile.size);
+    return &files_.emplace(key, dumpFile).first->second;
+}
+
+void DCameraDumpWriter::CloseFile(const std::string& key)
+{
+    auto iter = files_.find(key);
+    if (iter == files_.end()) {
+        return;
+    }
+    fclose(iter->second.file);
+    files_.erase(iter);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
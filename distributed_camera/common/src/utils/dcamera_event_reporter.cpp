@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_event_reporter.h"
+
+#include <cinttypes>
+
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraEventReporter);
+
+namespace {
+const std::string EVENT_REPORT_QUEUE = "DCameraEventReport";
+}
+
+DCameraEventReporter::DCameraEventReporter() : queue_(EVENT_REPORT_QUEUE, DCAMERA_THREAD_BACKGROUND)
+{
+}
+
+bool DCameraEventReporter::Post(const Event& event)
+{
+    CHECK_AND_RETURN_RET_LOG(event == nullptr, false, "%{public}s", "Report event is null.");
+    if (queue_.GetPendingCount() >= MAX_PENDING_EVENTS || !queue_.PostTask(event)) {
+        uint64_t dropped = droppedCount_.fetch_add(1, std::memory_order_relaxed) + 1;
+        DHLOGW("Report queue is full, %{public}" PRIu64 " events dropped.", dropped);
+        return false;
+    }
+    return true;
+}
+
+uint64_t DCameraEventReporter::GetDroppedCount()
+{
+    return droppedCount_.load(std::memory_order_relaxed);
+}
+
+size_t DCameraEventReporter::GetPendingCount()
+{
+    return queue_.GetPendingCount();
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_frame_drop_statistics.h"
+
+#include <cinttypes>
+
+#include "dcamera_hisysevent_adapter.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraFrameDropStatistics);
+
+namespace {
+const std::array<const char *, DCAMERA_DROP_REASON_COUNT> REASON_NAMES = {
+    "fpsControl", "sendCongestion", "waitKeyFrame", "decodeQueueFull", "stageFull", "producerQueueFull",
+    "syncLate", "smootherDiscard", "memoryBudget",
+};
+}
+
+DCameraStreamDropCounter::DCameraStreamDropCounter(const std::string& streamKey) : streamKey_(streamKey)
+{
+}
+
+void DCameraStreamDropCounter::Add(DCameraDropReason reason, uint64_t count)
+{
+    if (reason < 0 || reason >= DCAMERA_DROP_REASON_COUNT || count == 0) {
+        return;
+    }
+    counts_[reason].fetch_add(count, std::memory_order_relaxed);
+}
+
+uint64_t DCameraStreamDropCounter::Get(DCameraDropReason reason) const
+{
+    if (reason < 0 || reason >= DCAMERA_DROP_REASON_COUNT) {
+        return 0;
+    }
+    return counts_[reason].load(std::memory_order_relaxed);
+}
+
+uint64_t DCameraStreamDropCounter::GetTotal() const
+{
+    uint64_t total = 0;
+    for (const auto& count : counts_) {
+        total += count.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+const std::string& DCameraStreamDropCounter::GetStreamKey() const
+{
+    return streamKey_;
+}
+
+void DCameraStreamDropCounter::Reset()
+{
+    for (auto& count : counts_) {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
+
+void DCameraStreamDropCounter::Dump(std::string& result) const
+{
+    for (size_t i = 0; i < DCAMERA_DROP_REASON_COUNT; i++) {
+        uint64_t count = counts_[i].load(std::memory_order_relaxed);
+        if (count == 0) {
+            continue;
+        }
+        result.append(" ").append(REASON_NAMES[i]).append(":").append(std::to_string(count));
+    }
+}
+
+const char *DCameraStreamDropCounter::GetReasonName(DCameraDropReason reason)
+{
+    if (reason < 0 || reason >= DCAMERA_DROP_REASON_COUNT) {
+        return "unknown";
+    }
+    return REASON_NAMES[reason];
+}
+
+std::shared_ptr<DCameraStreamDropCounter> DCameraFrameDropStatistics::Acquire(const std::string& streamKey)
+{
+    std::lock_guard<std::mutex> lock(streamMutex_);
+    std::shared_ptr<DCameraStreamDropCounter> counter = streams_[streamKey].lock();
+    if (counter == nullptr) {
+        counter = std::make_shared<DCameraStreamDropCounter>(streamKey);
+        streams_[streamKey] = counter;
+    }
+    return counter;
+}
+
+void DCameraFrameDropStatistics::ReportSession(const std::shared_ptr<DCameraStreamDropCounter>& counter)
+{
+    CHECK_AND_RETURN_LOG(counter == nullptr, "%{public}s", "drop counter is null.");
+    uint64_t total = counter->GetTotal();
+    if (total != 0) {
+        std::string detail;
+        counter->Dump(detail);
+        DHLOGI("Stream %{public}s dropped %{public}" PRIu64 " frames,%{public}s", counter->GetStreamKey().c_str(),
+            total, detail.c_str());
+        ReportFrameDropEvent(FRAME_DROP_EVENT, counter->GetStreamKey(), total, detail);
+    }
+    counter->Reset();
+}
+
+void DCameraFrameDropStatistics::Dump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(streamMutex_);
+    for (auto iter = streams_.begin(); iter != streams_.end();) {
+        std::shared_ptr<DCameraStreamDropCounter> counter = iter->second.lock();
+        if (counter == nullptr) {
+            iter = streams_.erase(iter);
+            continue;
+        }
+        result.append("Stream: ").append(iter->first).append(" dropped ")
+              .append(std::to_string(counter->GetTotal()));
+        counter->Dump(result);
+        result.append("\n");
+        iter++;
+    }
+    if (streams_.empty()) {
+        result.append("No stream is running\n");
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include "dcamera_hidumper.h"
 
+#include "dcamera_dump_writer.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 
@@ -33,6 +34,7 @@ int32_t DcameraHidumper::StopDump()
 {
     DHLOGI("hidumper reset dumpflag");
     dumpFlag_ = false;
+    DCameraDumpWriter::GetInstance().CloseAll();
     return DCAMERA_OK;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,6 +19,7 @@
 #include "securec.h"
 
 #include "anonymous_string.h"
+#include "dcamera_event_reporter.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 
@@ -35,9 +36,8 @@ const std::string ENUM_STREAMTYPE_STRINGS[] = {
 const std::string ENUM_ENCODETYPE_STRINGS[] = {
     "ENCODE_TYPE_NULL", "ENCODE_TYPE_H264", "ENCODE_TYPE_H265", "ENCODE_TYPE_JPEG"
 };
-}
 
-void ReportDcamerInitFail(const std::string& eventName, int32_t errCode, const std::string& errMsg)
+void WriteDcamerInitFail(const std::string& eventName, int32_t errCode, const std::string& errMsg)
 {
     int32_t ret = HiSysEventWrite(HiSysEventNameSpace::Domain::DISTRIBUTED_CAMERA,
         eventName,
@@ -49,7 +49,7 @@ void ReportDcamerInitFail(const std::string& eventName, int32_t errCode, const s
     }
 }
 
-void ReportRegisterCameraFail(const std::string& eventName, const std::string& devId, const std::string& dhId,
+void WriteRegisterCameraFail(const std::string& eventName, const std::string& devId, const std::string& dhId,
     std::string version, const std::string& errMsg)
 {
     int32_t ret = HiSysEventWrite(HiSysEventNameSpace::Domain::DISTRIBUTED_CAMERA,
@@ -65,7 +65,7 @@ void ReportRegisterCameraFail(const std::string& eventName, const std::string& d
     }
 }
 
-void ReportDcamerOptFail(const std::string& eventName, int32_t errCode, const std::string& errMsg)
+void WriteDcamerOptFail(const std::string& eventName, int32_t errCode, const std::string& errMsg)
 {
     int32_t ret = HiSysEventWrite(HiSysEventNameSpace::Domain::DISTRIBUTED_CAMERA,
         eventName,
@@ -77,7 +77,7 @@ void ReportDcamerOptFail(const std::string& eventName, int32_t errCode, const st
     }
 }
 
-void ReportSaEvent(const std::string& eventName, int32_t saId, const std::string& errMsg)
+void WriteSaEvent(const std::string& eventName, int32_t saId, const std::string& errMsg)
 {
     int32_t ret = HiSysEventWrite(HiSysEventNameSpace::Domain::DISTRIBUTED_CAMERA,
         eventName,
@@ -89,7 +89,7 @@ void ReportSaEvent(const std::string& eventName, int32_t saId, const std::string
     }
 }
 
-void ReportRegisterCameraEvent(const std::string& eventName, const std::string& devId, const std::string& dhId,
+void WriteRegisterCameraEvent(const std::string& eventName, const std::string& devId, const std::string& dhId,
     std::string version, const std::string& errMsg)
 {
     int32_t ret = HiSysEventWrite(HiSysEventNameSpace::Domain::DISTRIBUTED_CAMERA,
@@ -104,7 +104,7 @@ void ReportRegisterCameraEvent(const std::string& eventName, const std::string&
     }
 }
 
-void ReportCameraOperaterEvent(const std::string& eventName, const std::string& devId, const std::string& dhId,
+void WriteCameraOperaterEvent(const std::string& eventName, const std::string& devId, const std::string& dhId,
     const std::string& errMsg)
 {
     int32_t ret = HiSysEventWrite(HiSysEventNameSpace::Domain::DISTRIBUTED_CAMERA,
@@ -118,7 +118,7 @@ void ReportCameraOperaterEvent(const std::string& eventName, const std::string&
     }
 }
 
-void ReportStartCaptureEvent(const std::string& eventName, EventCaptureInfo& capture, const std::string& errMsg)
+void WriteStartCaptureEvent(const std::string& eventName, const EventCaptureInfo& capture, const std::string& errMsg)
 {
     if (capture.encodeType_ < 0 || capture.encodeType_ >= ENUM_ENCODETYPE_LEN ||
         capture.type_ < 0 || capture.type_ >= ENUM_STREAMTYPE_LEN) {
@@ -140,6 +140,81 @@ void ReportStartCaptureEvent(const std::string& eventName, EventCaptureInfo& cap
     }
 }
 
+void WriteFrameDropEvent(const std::string& eventName, const std::string& streamKey, uint64_t total,
+    const std::string& detail)
+{
+    int32_t ret = HiSysEventWrite(HiSysEventNameSpace::Domain::DISTRIBUTED_CAMERA,
+        eventName,
+        HiSysEventNameSpace::EventType::STATISTIC,
+        "STREAM", streamKey,
+        "TOTAL", total,
+        "DETAIL", detail);
+    if (ret != DCAMERA_OK) {
+        DHLOGE("Write HiSysEvent error, ret:%{public}d, stream %{public}s.", ret, streamKey.c_str());
+    }
+}
+}
+
+void ReportDcamerInitFail(const std::string& eventName, int32_t errCode, const std::string& errMsg)
+{
+    DCameraEventReporter::GetInstance().Post([eventName, errCode, errMsg]() {
+        WriteDcamerInitFail(eventName, errCode, errMsg);
+    });
+}
+
+void ReportRegisterCameraFail(const std::string& eventName, const std::string& devId, const std::string& dhId,
+    std::string version, const std::string& errMsg)
+{
+    DCameraEventReporter::GetInstance().Post([eventName, devId, dhId, version, errMsg]() {
+        WriteRegisterCameraFail(eventName, devId, dhId, version, errMsg);
+    });
+}
+
+void ReportDcamerOptFail(const std::string& eventName, int32_t errCode, const std::string& errMsg)
+{
+    DCameraEventReporter::GetInstance().Post([eventName, errCode, errMsg]() {
+        WriteDcamerOptFail(eventName, errCode, errMsg);
+    });
+}
+
+void ReportSaEvent(const std::string& eventName, int32_t saId, const std::string& errMsg)
+{
+    DCameraEventReporter::GetInstance().Post([eventName, saId, errMsg]() {
+        WriteSaEvent(eventName, saId, errMsg);
+    });
+}
+
+void ReportRegisterCameraEvent(const std::string& eventName, const std::string& devId, const std::string& dhId,
+    std::string version, const std::string& errMsg)
+{
+    DCameraEventReporter::GetInstance().Post([eventName, devId, dhId, version, errMsg]() {
+        WriteRegisterCameraEvent(eventName, devId, dhId, version, errMsg);
+    });
+}
+
+void ReportCameraOperaterEvent(const std::string& eventName, const std::string& devId, const std::string& dhId,
+    const std::string& errMsg)
+{
+    DCameraEventReporter::GetInstance().Post([eventName, devId, dhId, errMsg]() {
+        WriteCameraOperaterEvent(eventName, devId, dhId, errMsg);
+    });
+}
+
+void ReportStartCaptureEvent(const std::string& eventName, EventCaptureInfo& capture, const std::string& errMsg)
+{
+    DCameraEventReporter::GetInstance().Post([eventName, capture, errMsg]() {
+        WriteStartCaptureEvent(eventName, capture, errMsg);
+    });
+}
+
+void ReportFrameDropEvent(const std::string& eventName, const std::string& streamKey, uint64_t total,
+    const std::string& detail)
+{
+    DCameraEventReporter::GetInstance().Post([eventName, streamKey, total, detail]() {
+        WriteFrameDropEvent(eventName, streamKey, total, detail);
+    });
+}
+
 std::string CreateMsg(const char *format, ...)
 {
     va_list args;
@@ -15,6 +15,9 @@
 
 #include "dcamera_hitrace_adapter.h"
 
+#include "dcamera_utils_tools.h"
+#include "distributed_hardware_log.h"
+
 namespace OHOS {
 namespace DistributedHardware {
 void DcameraStartAsyncTrace(const std::string& str, int32_t taskId)
@@ -26,5 +29,44 @@ void DcameraFinishAsyncTrace(const std::string& str, int32_t taskId)
 {
     FinishAsyncTrace(DCAMERA_HITRACE_LABEL, str, taskId);
 }
+
+std::atomic<uint32_t> DCameraFrameTrace::frameTraceInterval_ = 0;
+std::atomic<uint32_t> DCameraFrameTrace::noIndexCount_ = 0;
+
+void DCameraFrameTrace::RefreshSampling()
+{
+    uint32_t interval = 0;
+    if (!GetSysPara(FRAME_TRACE_INTERVAL_PARA, interval) || !IsTagEnabled(DCAMERA_HITRACE_LABEL)) {
+        interval = 0;
+    }
+    if (interval != frameTraceInterval_.exchange(interval, std::memory_order_relaxed)) {
+        DHLOGI("Frame trace interval changed to %{public}u.", interval);
+    }
+}
+
+void DCameraFrameTrace::Start(const std::string& name, int32_t frameIndex)
+{
+    uint32_t interval = frameTraceInterval_.load(std::memory_order_relaxed);
+    if (interval == 0) {
+        return;
+    }
+    if (frameIndex < 0) {
+        if (noIndexCount_.fetch_add(1, std::memory_order_relaxed) % interval != 0) {
+            return;
+        }
+        StartTrace(DCAMERA_HITRACE_LABEL, name);
+    } else {
+        if (static_cast<uint32_t>(frameIndex) % interval != 0) {
+            return;
+        }
+        StartTrace(DCAMERA_HITRACE_LABEL, name + "#" + std::to_string(frameIndex));
+    }
+    isStarted_ = true;
+}
+
+void DCameraFrameTrace::Finish()
+{
+    FinishTrace(DCAMERA_HITRACE_LABEL);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_imu_ring.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr uint64_t SEQ_STEP = 2;
+
+// Even sequence numbers mark a complete sample of the given index, odd ones a write in progress.
+uint64_t GetStableSeq(uint64_t index)
+{
+    return index * SEQ_STEP + SEQ_STEP;
+}
+}
+
+void DCameraImuRing::Push(const ImuSample& sample)
+{
+    uint64_t index = writeIndex_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[index % CAPACITY];
+    slot.seq.store(GetStableSeq(index) - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timeStamp.store(sample.timeStamp, std::memory_order_relaxed);
+    for (size_t i = 0; i < IMU_AXIS_NUM; i++) {
+        slot.data[i].store(sample.data[i], std::memory_order_relaxed);
+    }
+    slot.seq.store(GetStableSeq(index), std::memory_order_release);
+    writeIndex_.store(index + 1, std::memory_order_release);
+}
+
+bool DCameraImuRing::ReadSlot(uint64_t index, ImuSample& sample) const
+{
+    const Slot& slot = slots_[index % CAPACITY];
+    uint64_t seq = slot.seq.load(std::memory_order_acquire);
+    if (seq != GetStableSeq(index)) {
+        return false;
+    }
+    sample.timeStamp = slot.timeStamp.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < IMU_AXIS_NUM; i++) {
+        sample.data[i] = slot.data[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.seq.load(std::memory_order_relaxed) == seq;
+}
+
+uint64_t DCameraImuRing::GetOldestIndex(uint64_t writeIndex) const
+{
+    uint64_t oldest = writeIndex > CAPACITY ? writeIndex - CAPACITY : 0;
+    return std::max(oldest, readFloor_.load(std::memory_order_acquire));
+}
+
+size_t DCameraImuRing::GetWindow(int64_t startTime, int64_t endTime, std::vector<ImuSample>& samples) const
+{
+    samples.clear();
+    uint64_t writeIndex = writeIndex_.load(std::memory_order_acquire);
+    uint64_t oldest = GetOldestIndex(writeIndex);
+    ImuSample sample;
+    for (uint64_t index = writeIndex; index > oldest; index--) {
+        if (!ReadSlot(index - 1, sample)) {
+            // The writer has already lapped this slot, anything older is gone too.
+            break;
+        }
+        if (sample.timeStamp < startTime) {
+            break;
+        }
+        if (sample.timeStamp <= endTime) {
+            samples.push_back(sample);
+        }
+    }
+    std::reverse(samples.begin(), samples.end());
+    return samples.size();
+}
+
+size_t DCameraImuRing::ReadSince(uint64_t& cursor, std::vector<ImuSample>& samples) const
+{
+    samples.clear();
+    uint64_t writeIndex = writeIndex_.load(std::memory_order_acquire);
+    uint64_t index = std::max(cursor, GetOldestIndex(writeIndex));
+    samples.reserve(static_cast<size_t>(writeIndex - std::min(index, writeIndex)));
+    ImuSample sample;
+    for (; index < writeIndex; index++) {
+        if (ReadSlot(index, sample)) {
+            samples.push_back(sample);
+        }
+    }
+    cursor = writeIndex;
+    return samples.size();
+}
+
+uint64_t DCameraImuRing::GetWriteIndex() const
+{
+    return writeIndex_.load(std::memory_order_acquire);
+}
+
+void DCameraImuRing::Clear()
+{
+    readFloor_.store(writeIndex_.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraImuStore);
+
+DCameraImuRing& DCameraImuStore::GetAccRing()
+{
+    return accRing_;
+}
+
+DCameraImuRing& DCameraImuStore::GetGyroRing()
+{
+    return gyroRing_;
+}
+
+void DCameraImuStore::PushSamples(const std::vector<ImuSample>& accData, const std::vector<ImuSample>& gyroData)
+{
+    for (const auto& sample : accData) {
+        accRing_.Push(sample);
+    }
+    for (const auto& sample : gyroData) {
+        gyroRing_.Push(sample);
+    }
+}
+
+void DCameraImuStore::SetExposureTime(uint32_t exposureTime)
+{
+    exposureTime_.store(exposureTime);
+}
+
+uint32_t DCameraImuStore::GetExposureTime()
+{
+    return exposureTime_.load();
+}
+
+void DCameraImuStore::SetInitParam(const std::string& param)
+{
+    std::lock_guard<std::mutex> lock(paramMutex_);
+    initParam_ = param;
+}
+
+std::string DCameraImuStore::GetInitParam()
+{
+    std::lock_guard<std::mutex> lock(paramMutex_);
+    return initParam_;
+}
+
+void DCameraImuStore::Clear()
+{
+    accRing_.Clear();
+    gyroRing_.Clear();
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_memory_account.h"
+
+#include "dcamera_utils_tools.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraMemoryStatistics);
+
+namespace {
+const std::array<const char *, DCAMERA_MEMORY_OWNER_COUNT> OWNER_NAMES = {
+    "channel", "encoder", "decoder", "scaler", "eis", "producer", "smoother",
+};
+}
+
+DCameraMemoryAccount::DCameraMemoryAccount(const std::string& sessionKey, uint64_t budgetBytes)
+    : sessionKey_(sessionKey), budgetBytes_(budgetBytes)
+{
+}
+
+bool DCameraMemoryAccount::IsValidOwner(DCameraMemoryOwner owner)
+{
+    return owner >= 0 && owner < DCAMERA_MEMORY_OWNER_COUNT;
+}
+
+void DCameraMemoryAccount::UpdatePeak(std::atomic<uint64_t>& peak, uint64_t value)
+{
+    uint64_t current = peak.load(std::memory_order_relaxed);
+    while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void DCameraMemoryAccount::Charge(DCameraMemoryOwner owner, uint64_t bytes)
+{
+    if (!IsValidOwner(owner) || bytes == 0) {
+        return;
+    }
+    UpdatePeak(peakBytes_[owner], liveBytes_[owner].fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    UpdatePeak(peakTotal_, liveTotal_.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+void DCameraMemoryAccount::Uncharge(DCameraMemoryOwner owner, uint64_t bytes)
+{
+    if (!IsValidOwner(owner) || bytes == 0) {
+        return;
+    }
+    liveBytes_[owner].fetch_sub(bytes, std::memory_order_relaxed);
+    liveTotal_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void DCameraMemoryAccount::Move(DCameraMemoryOwner from, DCameraMemoryOwner to, uint64_t bytes)
+{
+    if (!IsValidOwner(from) || !IsValidOwner(to) || from == to || bytes == 0) {
+        return;
+    }
+    liveBytes_[from].fetch_sub(bytes, std::memory_order_relaxed);
+    UpdatePeak(peakBytes_[to], liveBytes_[to].fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+uint64_t DCameraMemoryAccount::GetLiveBytes(DCameraMemoryOwner owner) const
+{
+    return IsValidOwner(owner) ? liveBytes_[owner].load(std::memory_order_relaxed) : 0;
+}
+
+uint64_t DCameraMemoryAccount::GetPeakBytes(DCameraMemoryOwner owner) const
+{
+    return IsValidOwner(owner) ? peakBytes_[owner].load(std::memory_order_relaxed) : 0;
+}
+
+uint64_t DCameraMemoryAccount::GetLiveTotal() const
+{
+    return liveTotal_.load(std::memory_order_relaxed);
+}
+
+uint64_t DCameraMemoryAccount::GetPeakTotal() const
+{
+    return peakTotal_.load(std::memory_order_relaxed);
+}
+
+uint64_t DCameraMemoryAccount::GetBudget() const
+{
+    return budgetBytes_;
+}
+
+bool DCameraMemoryAccount::IsOverBudget() const
+{
+    return budgetBytes_ != 0 && liveTotal_.load(std::memory_order_relaxed) > budgetBytes_;
+}
+
+const std::string& DCameraMemoryAccount::GetSessionKey() const
+{
+    return sessionKey_;
+}
+
+void DCameraMemoryAccount::ResetPeak()
+{
+    for (size_t i = 0; i < DCAMERA_MEMORY_OWNER_COUNT; i++) {
+        peakBytes_[i].store(liveBytes_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    peakTotal_.store(liveTotal_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void DCameraMemoryAccount::Dump(std::string& result) const
+{
+    result.append("live ").append(std::to_string(GetLiveTotal()))
+        .append(" peak ").append(std::to_string(GetPeakTotal()))
+        .append(" budget ").append(std::to_string(budgetBytes_));
+    for (size_t i = 0; i < DCAMERA_MEMORY_OWNER_COUNT; i++) {
+        uint64_t peak = peakBytes_[i].load(std::memory_order_relaxed);
+        if (peak == 0) {
+            continue;
+        }
+        result.append(" ").append(OWNER_NAMES[i]).append(":")
+            .append(std::to_string(liveBytes_[i].load(std::memory_order_relaxed))).append("/")
+            .append(std::to_string(peak));
+    }
+}
+
+const char *DCameraMemoryAccount::GetOwnerName(DCameraMemoryOwner owner)
+{
+    return IsValidOwner(owner) ? OWNER_NAMES[owner] : "unknown";
+}
+
+std::shared_ptr<DCameraMemoryAccount> DCameraMemoryStatistics::Acquire(const std::string& sessionKey)
+{
+    std::lock_guard<std::mutex> lock(sessionMutex_);
+    std::shared_ptr<DCameraMemoryAccount> account = sessions_[sessionKey].lock();
+    if (account == nullptr) {
+        int32_t budgetMb = 0;
+        if (!GetSysPara(MEMORY_BUDGET_PARA, budgetMb) || budgetMb < 0) {
+            budgetMb = 0;
+        }
+        account = std::make_shared<DCameraMemoryAccount>(sessionKey, static_cast<uint64_t>(budgetMb) * BYTES_PER_MB);
+        sessions_[sessionKey] = account;
+    }
+    return account;
+}
+
+void DCameraMemoryStatistics::ReportSession(const std::shared_ptr<DCameraMemoryAccount>& account)
+{
+    CHECK_AND_RETURN_LOG(account == nullptr, "%{public}s", "memory account is null.");
+    std::string detail;
+    account->Dump(detail);
+    DHLOGI("Session %{public}s memory %{public}s", account->GetSessionKey().c_str(), detail.c_str());
+    account->ResetPeak();
+}
+
+void DCameraMemoryStatistics::Dump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(sessionMutex_);
+    for (auto iter = sessions_.begin(); iter != sessions_.end();) {
+        std::shared_ptr<DCameraMemoryAccount> account = iter->second.lock();
+        if (account == nullptr) {
+            iter = sessions_.erase(iter);
+            continue;
+        }
+        result.append("Session: ").append(iter->first).append(" ");
+        account->Dump(result);
+        result.append("\n");
+        iter++;
+    }
+    if (sessions_.empty()) {
+        result.append("No session is running\n");
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
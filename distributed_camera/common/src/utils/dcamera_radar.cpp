@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,6 +19,7 @@
 #include "securec.h"
 
 #include "anonymous_string.h"
+#include "dcamera_event_reporter.h"
 #include "dcamera_hisysevent_adapter.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
@@ -28,6 +29,56 @@ namespace DistributedHardware {
 FWK_IMPLEMENT_SINGLE_INSTANCE(DcameraRadar);
 
 bool DcameraRadar::ReportDcameraInit(const std::string& func, CameraInit bizStage, BizState bizState, int32_t errCode)
+{
+    return DCameraEventReporter::GetInstance().Post([this, func, bizStage, bizState, errCode]() {
+        WriteDcameraInit(func, bizStage, bizState, errCode);
+    });
+}
+
+bool DcameraRadar::ReportDcameraInitProgress(const std::string& func, CameraInit bizStage, int32_t errCode)
+{
+    return DCameraEventReporter::GetInstance().Post([this, func, bizStage, errCode]() {
+        WriteDcameraInitProgress(func, bizStage, errCode);
+    });
+}
+
+bool DcameraRadar::ReportDcameraOpen(const std::string& func, CameraOpen bizStage, BizState bizState, int32_t errCode)
+{
+    return DCameraEventReporter::GetInstance().Post([this, func, bizStage, bizState, errCode]() {
+        WriteDcameraOpen(func, bizStage, bizState, errCode);
+    });
+}
+
+bool DcameraRadar::ReportDcameraOpenProgress(const std::string& func, CameraOpen bizStage, int32_t errCode)
+{
+    return DCameraEventReporter::GetInstance().Post([this, func, bizStage, errCode]() {
+        WriteDcameraOpenProgress(func, bizStage, errCode);
+    });
+}
+
+bool DcameraRadar::ReportDcameraClose(const std::string& func, CameraClose bizStage, BizState bizState, int32_t errCode)
+{
+    return DCameraEventReporter::GetInstance().Post([this, func, bizStage, bizState, errCode]() {
+        WriteDcameraClose(func, bizStage, bizState, errCode);
+    });
+}
+
+bool DcameraRadar::ReportDcameraCloseProgress(const std::string& func, CameraClose bizStage, int32_t errCode)
+{
+    return DCameraEventReporter::GetInstance().Post([this, func, bizStage, errCode]() {
+        WriteDcameraCloseProgress(func, bizStage, errCode);
+    });
+}
+
+bool DcameraRadar::ReportDcameraUnInit(const std::string& func, CameraUnInit bizStage, BizState bizState,
+    int32_t errCode)
+{
+    return DCameraEventReporter::GetInstance().Post([this, func, bizStage, bizState, errCode]() {
+        WriteDcameraUnInit(func, bizStage, bizState, errCode);
+    });
+}
+
+bool DcameraRadar::WriteDcameraInit(const std::string& func, CameraInit bizStage, BizState bizState, int32_t errCode)
 {
     int32_t res = DCAMERA_OK;
     StageRes stageRes = (errCode == DCAMERA_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
@@ -62,7 +113,7 @@ bool DcameraRadar::ReportDcameraInit(const std::string& func, CameraInit bizStag
     return true;
 }
 
-bool DcameraRadar::ReportDcameraInitProgress(const std::string& func, CameraInit bizStage, int32_t errCode)
+bool DcameraRadar::WriteDcameraInitProgress(const std::string& func, CameraInit bizStage, int32_t errCode)
 {
     int32_t res = DCAMERA_OK;
     StageRes stageRes = (errCode == DCAMERA_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
@@ -95,7 +146,7 @@ bool DcameraRadar::ReportDcameraInitProgress(const std::string& func, CameraInit
     return true;
 }
 
-bool DcameraRadar::ReportDcameraOpen(const std::string& func, CameraOpen bizStage, BizState bizState, int32_t errCode)
+bool DcameraRadar::WriteDcameraOpen(const std::string& func, CameraOpen bizStage, BizState bizState, int32_t errCode)
 {
     int32_t res = DCAMERA_OK;
     StageRes stageRes = (errCode == DCAMERA_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
@@ -130,7 +181,7 @@ bool DcameraRadar::ReportDcameraOpen(const std::string& func, CameraOpen bizStag
     return true;
 }
 
-bool DcameraRadar::ReportDcameraOpenProgress(const std::string& func, CameraOpen bizStage, int32_t errCode)
+bool DcameraRadar::WriteDcameraOpenProgress(const std::string& func, CameraOpen bizStage, int32_t errCode)
 {
     int32_t res = DCAMERA_OK;
     StageRes stageRes = (errCode == DCAMERA_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
@@ -163,7 +214,7 @@ bool DcameraRadar::ReportDcameraOpenProgress(const std::string& func, CameraOpen
     return true;
 }
 
-bool DcameraRadar::ReportDcameraClose(const std::string& func, CameraClose bizStage, BizState bizState,
+bool DcameraRadar::WriteDcameraClose(const std::string& func, CameraClose bizStage, BizState bizState,
     int32_t errCode)
 {
     int32_t res = DCAMERA_OK;
@@ -199,7 +250,7 @@ bool DcameraRadar::ReportDcameraClose(const std::string& func, CameraClose bizSt
     return true;
 }
 
-bool DcameraRadar::ReportDcameraCloseProgress(const std::string& func, CameraClose bizStage, int32_t errCode)
+bool DcameraRadar::WriteDcameraCloseProgress(const std::string& func, CameraClose bizStage, int32_t errCode)
 {
     int32_t res = DCAMERA_OK;
     StageRes stageRes = (errCode == DCAMERA_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
@@ -232,7 +283,7 @@ bool DcameraRadar::ReportDcameraCloseProgress(const std::string& func, CameraClo
     return true;
 }
 
-bool DcameraRadar::ReportDcameraUnInit(const std::string& func, CameraUnInit bizStage, BizState bizState,
+bool DcameraRadar::WriteDcameraUnInit(const std::string& func, CameraUnInit bizStage, BizState bizState,
     int32_t errCode)
 {
     int32_t res = DCAMERA_OK;
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_serial_queue.h"
+
+#include "distributed_hardware_log.h"
+#include "ffrt_inner.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+DCameraSerialQueue::DCameraSerialQueue(const std::string& name, DCameraThreadRole role)
+    : state_(std::make_shared<State>())
+{
+    state_->name = name;
+    state_->qos = DCameraThreadRoleRegistry::GetInstance().GetFfrtQos(role);
+}
+
+DCameraSerialQueue::~DCameraSerialQueue()
+{
+    Stop();
+}
+
+bool DCameraSerialQueue::PostTask(const Task& task)
+{
+    CHECK_AND_RETURN_RET_LOG(task == nullptr, false, "%{public}s", "Serial queue task is null.");
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (state_->isStopped) {
+            DHLOGW("Serial queue %{public}s is stopped, task dropped.", state_->name.c_str());
+            return false;
+        }
+        state_->tasks.push_back(task);
+        if (state_->isScheduled) {
+            return true;
+        }
+        state_->isScheduled = true;
+    }
+    Submit(state_);
+    return true;
+}
+
+void DCameraSerialQueue::RemoveAllTasks()
+{
+    std::deque<Task> dropped;
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        dropped.swap(state_->tasks);
+    }
+}
+
+void DCameraSerialQueue::Stop()
+{
+    std::deque<Task> dropped;
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->isStopped = true;
+    dropped.swap(state_->tasks);
+    // A task stopping its own queue returns to the drain loop, which then ends.
+    if (state_->runningThread == std::this_thread::get_id()) {
+        return;
+    }
+    state_->idleCond.wait(lock, [this] { return !state_->isScheduled; });
+}
+
+size_t DCameraSerialQueue::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->tasks.size();
+}
+
+const std::string& DCameraSerialQueue::GetName() const
+{
+    return state_->name;
+}
+
+void DCameraSerialQueue::Submit(const std::shared_ptr<State>& state)
+{
+    ffrt::submit([state]() { Drain(state); }, {}, {},
+        ffrt::task_attr().name(state->name.c_str()).qos(state->qos));
+}
+
+void DCameraSerialQueue::Drain(const std::shared_ptr<State>& state)
+{
+    for (size_t i = 0; i <= MAX_TASKS_PER_TURN; i++) {
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->runningThread = std::thread::id();
+            if (state->tasks.empty() || state->isStopped) {
+                state->isScheduled = false;
+                state->idleCond.notify_all();
+                return;
+            }
+            if (i == MAX_TASKS_PER_TURN) {
+                break;
+            }
+            task = std::move(state->tasks.front());
+            state->tasks.pop_front();
+            state->runningThread = std::this_thread::get_id();
+        }
+        task();
+    }
+    // Still scheduled, the queue keeps its order and gives the worker to other queues for a turn.
+    Submit(state);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_startup_profiler.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "dcamera_hitrace_adapter.h"
+#include "dcamera_utils_tools.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraStartupProfiler);
+
+void DCameraStartupProfiler::RecordPhase(const std::string& phase, int64_t startUs, int64_t finishUs)
+{
+    std::lock_guard<std::mutex> lock(phaseMutex_);
+    auto iter = std::find_if(phases_.begin(), phases_.end(),
+        [&phase](const PhaseInfo& info) { return info.name == phase; });
+    if (iter != phases_.end()) {
+        return;
+    }
+    if (firstStartUs_ == 0 || startUs < firstStartUs_) {
+        firstStartUs_ = startUs;
+    }
+    phases_.push_back({ phase, startUs, finishUs - startUs });
+    DHLOGI("Startup phase %{public}s took %{public}" PRId64 " us.", phase.c_str(), finishUs - startUs);
+}
+
+void DCameraStartupProfiler::Dump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(phaseMutex_);
+    if (phases_.empty()) {
+        result.append("No startup phase is recorded\n");
+        return;
+    }
+    result.append("Startup phases:\n");
+    for (const auto& info : phases_) {
+        result.append("  ").append(info.name)
+            .append(": at +").append(std::to_string((info.startUs - firstStartUs_) / US_PER_MS))
+            .append(" ms took ").append(std::to_string(info.durationUs))
+            .append(" us\n");
+    }
+}
+
+DCameraStartupPhase::DCameraStartupPhase(const std::string& phase)
+    : phase_(phase), startUs_(GetNowTimeStampUs())
+{
+    StartTrace(DCAMERA_HITRACE_LABEL, phase_);
+}
+
+DCameraStartupPhase::~DCameraStartupPhase()
+{
+    FinishTrace(DCAMERA_HITRACE_LABEL);
+    DCameraStartupProfiler::GetInstance().RecordPhase(phase_, startUs_, GetNowTimeStampUs());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_thread_role.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <sched.h>
+#include <sstream>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "distributed_hardware_log.h"
+#include "ffrt_inner.h"
+#include "ipc_skeleton.h"
+#include "parameter.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraThreadRoleRegistry);
+
+namespace {
+const std::string THREAD_PARA_PREFIX = "sys.dcamera.thread.";
+const std::string CPUS_PARA_SUFFIX = ".cpus";
+const std::string NICE_PARA_SUFFIX = ".nice";
+const std::string QOS_PARA_SUFFIX = ".qos";
+const std::string IPC_PARA_PREFIX = "sys.dcamera.thread.ipc.";
+constexpr int32_t PARA_VALUE_LEN = 64;
+constexpr int32_t MAX_CPU_INDEX = CPU_SETSIZE - 1;
+
+const char *ROLE_NAMES[DCAMERA_THREAD_ROLE_COUNT] = {
+    "frame",
+    "output",
+    "control",
+    "background",
+};
+
+// Unlike GetSysPara, an unset parameter reads as missing instead of as "-1", which is a valid nice value.
+bool ReadThreadPara(const std::string& key, std::string& value)
+{
+    char paraValue[PARA_VALUE_LEN] = {0};
+    int32_t res = GetParameter(key.c_str(), "", paraValue, sizeof(paraValue));
+    if (res <= 0) {
+        return false;
+    }
+    value = paraValue;
+    return true;
+}
+
+bool ReadThreadPara(const std::string& key, int32_t& value)
+{
+    std::string text;
+    if (!ReadThreadPara(key, text)) {
+        return false;
+    }
+    std::istringstream stream(text);
+    int32_t parsed = 0;
+    if (!(stream >> parsed) || !stream.eof()) {
+        DHLOGE("Invalid thread parameter %{public}s value %{public}s.", key.c_str(), text.c_str());
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+bool ParseCpuIndex(const std::string& text, int32_t& index)
+{
+    if (text.empty() || !std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+        return false;
+    }
+    std::istringstream stream(text);
+    int64_t value = 0;
+    if (!(stream >> value) || value > MAX_CPU_INDEX) {
+        return false;
+    }
+    index = static_cast<int32_t>(value);
+    return true;
+}
+}
+
+void DCameraThreadRoleRegistry::ApplyCurrentThread(DCameraThreadRole role, const std::string& name)
+{
+    prctl(PR_SET_NAME, name.c_str());
+    if (!IsValidRole(role)) {
+        return;
+    }
+    DCameraThreadPolicy policy = GetPolicy(role);
+    if (!policy.cpus.empty()) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (int32_t cpu : policy.cpus) {
+            CPU_SET(cpu, &cpuSet);
+        }
+        if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+            DHLOGE("Set affinity of %{public}s thread %{public}s failed, errno %{public}d.", GetRoleName(role),
+                name.c_str(), errno);
+        }
+    }
+    if (policy.hasNice) {
+        id_t tid = static_cast<id_t>(syscall(SYS_gettid));
+        if (setpriority(PRIO_PROCESS, tid, policy.nice) != 0) {
+            DHLOGE("Set nice %{public}d of %{public}s thread %{public}s failed, errno %{public}d.", policy.nice,
+                GetRoleName(role), name.c_str(), errno);
+        }
+    }
+}
+
+DCameraThreadPolicy DCameraThreadRoleRegistry::GetPolicy(DCameraThreadRole role)
+{
+    if (!IsValidRole(role)) {
+        return DCameraThreadPolicy();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    LoadLocked();
+    return policies_[role];
+}
+
+int32_t DCameraThreadRoleRegistry::GetFfrtQos(DCameraThreadRole role)
+{
+    if (!IsValidRole(role)) {
+        return ffrt::qos_default;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    LoadLocked();
+    return policies_[role].ffrtQos;
+}
+
+void DCameraThreadRoleRegistry::ApplyIpcThreadNum(const std::string& process)
+{
+    int32_t threadNum = 0;
+    if (!ReadThreadPara(IPC_PARA_PREFIX + process, threadNum)) {
+        return;
+    }
+    if (threadNum <= 0 || threadNum > MAX_IPC_THREAD_NUM) {
+        DHLOGE("Invalid ipc thread num %{public}d of %{public}s.", threadNum, process.c_str());
+        return;
+    }
+    bool ret = IPCSkeleton::SetMaxWorkThreadNum(threadNum);
+    DHLOGI("Ipc threads of %{public}s set to %{public}d, ret %{public}d.", process.c_str(), threadNum, ret);
+}
+
+const char *DCameraThreadRoleRegistry::GetRoleName(DCameraThreadRole role)
+{
+    return IsValidRole(role) ? ROLE_NAMES[role] : "unknown";
+}
+
+bool DCameraThreadRoleRegistry::ParseCpuList(const std::string& text, std::vector<int32_t>& cpus)
+{
+    std::vector<int32_t> parsed;
+    std::istringstream stream(text);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        size_t dash = range.find('-');
+        int32_t first = 0;
+        int32_t last = 0;
+        if (!ParseCpuIndex(range.substr(0, dash), first)) {
+            return false;
+        }
+        last = first;
+        if (dash != std::string::npos && (!ParseCpuIndex(range.substr(dash + 1), last) || last < first)) {
+            return false;
+        }
+        for (int32_t cpu = first; cpu <= last; cpu++) {
+            parsed.push_back(cpu);
+        }
+    }
+    if (parsed.empty()) {
+        return false;
+    }
+    std::sort(parsed.begin(), parsed.end());
+    parsed.erase(std::unique(parsed.begin(), parsed.end()), parsed.end());
+    cpus.swap(parsed);
+    return true;
+}
+
+void DCameraThreadRoleRegistry::LoadLocked()
+{
+    if (isLoaded_) {
+        return;
+    }
+    isLoaded_ = true;
+    for (int32_t i = 0; i < DCAMERA_THREAD_ROLE_COUNT; i++) {
+        DCameraThreadRole role = static_cast<DCameraThreadRole>(i);
+        DCameraThreadPolicy& policy = policies_[i];
+        std::string prefix = THREAD_PARA_PREFIX + GetRoleName(role);
+        std::string cpus;
+        if (ReadThreadPara(prefix + CPUS_PARA_SUFFIX, cpus) && !ParseCpuList(cpus, policy.cpus)) {
+            DHLOGE("Invalid cpu list %{public}s of %{public}s threads.", cpus.c_str(), GetRoleName(role));
+        }
+        int32_t nice = 0;
+        if (ReadThreadPara(prefix + NICE_PARA_SUFFIX, nice)) {
+            policy.hasNice = true;
+            policy.nice = std::min(std::max(nice, MIN_NICE), MAX_NICE);
+        }
+        int32_t qos = GetDefaultFfrtQos(role);
+        if (ReadThreadPara(prefix + QOS_PARA_SUFFIX, qos) &&
+            (qos < ffrt::qos_background || qos > ffrt::qos_user_interactive)) {
+            DHLOGE("Invalid qos %{public}d of %{public}s threads.", qos, GetRoleName(role));
+            qos = GetDefaultFfrtQos(role);
+        }
+        policy.ffrtQos = qos;
+        DHLOGI("Thread role %{public}s: %{public}zu cpus, nice %{public}d set %{public}d, qos %{public}d.",
+            GetRoleName(role), policy.cpus.size(), policy.nice, policy.hasNice, policy.ffrtQos);
+    }
+}
+
+bool DCameraThreadRoleRegistry::IsValidRole(DCameraThreadRole role)
+{
+    return role >= DCAMERA_THREAD_FRAME && role < DCAMERA_THREAD_ROLE_COUNT;
+}
+
+int32_t DCameraThreadRoleRegistry::GetDefaultFfrtQos(DCameraThreadRole role)
+{
+    switch (role) {
+        case DCAMERA_THREAD_FRAME:
+        case DCAMERA_THREAD_OUTPUT:
+            return ffrt::qos_user_interactive;
+        case DCAMERA_THREAD_CONTROL:
+            return ffrt::qos_user_initiated;
+        default:
+            return ffrt::qos_utility;
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
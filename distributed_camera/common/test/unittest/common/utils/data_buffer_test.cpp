@@ -14,8 +14,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <vector>
 
 #include "data_buffer.h"
+#include "data_buffer_pool.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 
@@ -132,5 +134,123 @@ HWTEST_F(DataBufferTest, FindString_001, TestSize.Level1)
     ret = dataBuffer_->FindString(name, value);
     EXPECT_EQ(false, ret);
 }
+
+/**
+ * @tc.name: FindInt32_002
+ * @tc.desc: Verify the typed keys and the string names of known keys share one slot.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DataBufferTest, FindInt32_002, TestSize.Level1)
+{
+    ASSERT_NE(dataBuffer_, nullptr);
+    int32_t value = 0;
+    EXPECT_FALSE(dataBuffer_->FindInt32(DataBufferKey::WIDTH, value));
+    dataBuffer_->SetInt32("width", 1920);
+    EXPECT_TRUE(dataBuffer_->FindInt32(DataBufferKey::WIDTH, value));
+    EXPECT_EQ(1920, value);
+    dataBuffer_->SetInt32(DataBufferKey::HEIGHT, 1080);
+    EXPECT_TRUE(dataBuffer_->FindInt32("height", value));
+    EXPECT_EQ(1080, value);
+    int64_t value64 = 0;
+    EXPECT_FALSE(dataBuffer_->FindInt64(DataBufferKey::HEIGHT, value64));
+    dataBuffer_->SetInt64(DataBufferKey::RECV_TIME_US, 100);
+    EXPECT_TRUE(dataBuffer_->FindInt64("recvT", value64));
+    EXPECT_EQ(100, value64);
+    EXPECT_FALSE(dataBuffer_->FindInt32(DataBufferKey::KEY_COUNT, value));
+}
+
+/**
+ * @tc.name: GetKeyByName_001
+ * @tc.desc: Verify known names resolve to their key and other names resolve to none.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DataBufferTest, GetKeyByName_001, TestSize.Level1)
+{
+    DataBufferKey key = DataBufferKey::KEY_COUNT;
+    EXPECT_TRUE(DataBuffer::GetKeyByName("Videoformat", key));
+    EXPECT_EQ(DataBufferKey::VIDEO_FORMAT, key);
+    EXPECT_TRUE(DataBuffer::GetKeyByName("timeStampUs", key));
+    EXPECT_EQ(DataBufferKey::TIME_STAMP_US, key);
+    EXPECT_TRUE(DataBuffer::GetKeyByName("encoderPreset", key));
+    EXPECT_EQ(DataBufferKey::ENCODER_PRESET, key);
+    key = DataBufferKey::KEY_COUNT;
+    EXPECT_FALSE(DataBuffer::GetKeyByName("timeUsX", key));
+    EXPECT_FALSE(DataBuffer::GetKeyByName("time", key));
+    EXPECT_FALSE(DataBuffer::GetKeyByName("", key));
+    EXPECT_EQ(DataBufferKey::KEY_COUNT, key);
+}
+
+/**
+ * @tc.name: Acquire_001
+ * @tc.desc: Verify the Acquire function returns a buffer with the requested capacity.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DataBufferTest, Acquire_001, TestSize.Level1)
+{
+    size_t capacity = 1920 * 1080 * 3 / 2;
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(capacity);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_NE(buffer->Data(), nullptr);
+    EXPECT_EQ(capacity, buffer->Capacity());
+    EXPECT_EQ(capacity, buffer->Size());
+    EXPECT_EQ(DCAMERA_BAD_VALUE, buffer->SetRange(0, capacity + 1));
+
+    std::shared_ptr<DataBuffer> emptyBuffer = DataBuffer::Acquire(0);
+    ASSERT_NE(emptyBuffer, nullptr);
+    EXPECT_EQ(static_cast<size_t>(0), emptyBuffer->Capacity());
+}
+
+/**
+ * @tc.name: Acquire_002
+ * @tc.desc: Verify the released block is recycled by the next Acquire of the same size class.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DataBufferTest, Acquire_002, TestSize.Level1)
+{
+    DataBufferPool::GetInstance().Clear();
+    size_t capacity = 640 * 480 * 3 / 2;
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(capacity);
+    ASSERT_NE(buffer, nullptr);
+    uint8_t *block = buffer->Data();
+    buffer = nullptr;
+    EXPECT_EQ(DataBufferPool::GetSizeClass(capacity), DataBufferPool::GetInstance().GetIdleBytes());
+
+    buffer = DataBuffer::Acquire(capacity - 1);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(block, buffer->Data());
+    EXPECT_EQ(static_cast<size_t>(0), DataBufferPool::GetInstance().GetIdleBytes());
+    buffer = nullptr;
+    DataBufferPool::GetInstance().Clear();
+    EXPECT_EQ(static_cast<size_t>(0), DataBufferPool::GetInstance().GetIdleBytes());
+}
+
+/**
+ * @tc.name: Attach_001
+ * @tc.desc: Verify the attached memory is handed back to the releaser and not freed by DataBuffer.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DataBufferTest, Attach_001, TestSize.Level1)
+{
+    size_t capacity = 1024;
+    EXPECT_EQ(nullptr, DataBuffer::Attach(nullptr, capacity, nullptr));
+
+    std::vector<uint8_t> memory(capacity);
+    int32_t releaseCount = 0;
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Attach(memory.data(), capacity,
+        [&releaseCount, &memory](DataBuffer *attached) {
+            EXPECT_EQ(memory.data(), attached->Data());
+            releaseCount++;
+        });
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(memory.data(), buffer->Data());
+    EXPECT_EQ(capacity, buffer->Size());
+    buffer = nullptr;
+    EXPECT_EQ(1, releaseCount);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -14,6 +14,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <unistd.h>
 
 #include "dcamera_buffer_handle.h"
 #include "distributed_camera_errno.h"
@@ -106,5 +108,48 @@ HWTEST_F(DcameraBufferHandleTest, DCameraMemoryUnmap_002, TestSize.Level1)
     DCameraMemoryUnmap(handle);
     EXPECT_EQ(DCAMERA_OK, value);
 }
+
+/**
+ * @tc.name: DCameraBufferMapCache_001
+ * @tc.desc: Verify the map cache reuses the mapping of the same file and remaps a different one.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DcameraBufferHandleTest, DCameraBufferMapCache_001, TestSize.Level1)
+{
+    const int32_t size = 4096;
+    FILE *first = tmpfile();
+    FILE *second = tmpfile();
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_EQ(0, ftruncate(fileno(first), size));
+    ASSERT_EQ(0, ftruncate(fileno(second), size));
+
+    DCameraBufferMapCache cache;
+    BufferHandle handle = {};
+    EXPECT_EQ(nullptr, cache.Map(0, nullptr));
+    handle.fd = fileno(first);
+    handle.size = size;
+    void *virAddr = cache.Map(0, &handle);
+    ASSERT_NE(nullptr, virAddr);
+
+    int dupFd = dup(fileno(first));
+    handle.fd = dupFd;
+    EXPECT_EQ(virAddr, cache.Map(0, &handle));
+    EXPECT_EQ(static_cast<size_t>(1), cache.GetMappedCount());
+
+    handle.fd = fileno(second);
+    void *remapped = cache.Map(0, &handle);
+    EXPECT_NE(nullptr, remapped);
+    EXPECT_EQ(static_cast<size_t>(1), cache.GetMappedCount());
+    EXPECT_NE(nullptr, cache.Map(1, &handle));
+    EXPECT_EQ(static_cast<size_t>(2), cache.GetMappedCount());
+
+    cache.Clear();
+    EXPECT_EQ(static_cast<size_t>(0), cache.GetMappedCount());
+    close(dupFd);
+    fclose(first);
+    fclose(second);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
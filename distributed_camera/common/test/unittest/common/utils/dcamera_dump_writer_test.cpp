@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "dcamera_dump_writer.h"
+#include "distributed_camera_constants.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_DUMP_FILE = "DumpWriterTest.yuv";
+constexpr size_t TEST_FRAME_SIZE = 64;
+constexpr int32_t TEST_WAIT_ROUNDS = 100;
+constexpr int32_t TEST_WAIT_MS = 10;
+}
+
+class DCameraDumpWriterTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    static bool WaitDrained();
+};
+
+void DCameraDumpWriterTest::SetUpTestCase(void)
+{
+}
+
+void DCameraDumpWriterTest::TearDownTestCase(void)
+{
+}
+
+void DCameraDumpWriterTest::SetUp(void)
+{
+}
+
+void DCameraDumpWriterTest::TearDown(void)
+{
+    DCameraDumpWriter::GetInstance().CloseAll();
+    WaitDrained();
+}
+
+bool DCameraDumpWriterTest::WaitDrained()
+{
+    for (int32_t i = 0; i < TEST_WAIT_ROUNDS; i++) {
+        if (DCameraDumpWriter::GetInstance().GetQueuedCount() == 0) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(TEST_WAIT_MS));
+    }
+    return false;
+}
+
+/**
+ * @tc.name: dcamera_dump_writer_test_001
+ * @tc.desc: Verify invalid frames are refused and counted as dropped.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraDumpWriterTest, dcamera_dump_writer_test_001, TestSize.Level1)
+{
+    DCameraDumpWriter& writer = DCameraDumpWriter::GetInstance();
+    std::vector<uint8_t> frame(TEST_FRAME_SIZE, 0);
+    uint64_t dropped = writer.GetDroppedCount();
+    EXPECT_FALSE(writer.Write("", TEST_DUMP_FILE, frame.data(), frame.size()));
+    EXPECT_FALSE(writer.Write(DUMP_PATH, "", frame.data(), frame.size()));
+    EXPECT_FALSE(writer.Write(DUMP_PATH, TEST_DUMP_FILE, nullptr, frame.size()));
+    EXPECT_FALSE(writer.Write(DUMP_PATH, TEST_DUMP_FILE, frame.data(), 0));
+    EXPECT_EQ(dropped, writer.GetDroppedCount());
+}
+
+/**
+ * @tc.name: dcamera_dump_writer_test_002
+ * @tc.desc: Verify frames are queued at once and written in the background, missing dump paths included.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraDumpWriterTest, dcamera_dump_writer_test_002, TestSize.Level1)
+{
+    DCameraDumpWriter& writer = DCameraDumpWriter::GetInstance();
+    std::vector<uint8_t> frame(TEST_FRAME_SIZE, 1);
+    EXPECT_TRUE(writer.Write(DUMP_PATH, TEST_DUMP_FILE, frame.data(), frame.size()));
+    EXPECT_TRUE(writer.Write(DUMP_PATH, TEST_DUMP_FILE, frame.data(), frame.size()));
+    EXPECT_TRUE(writer.Write(DUMP_PHOTO_PATH, TEST_DUMP_FILE, frame.data(), frame.size(), true));
+    writer.Close(DUMP_PATH, TEST_DUMP_FILE);
+    EXPECT_TRUE(WaitDrained());
+    EXPECT_TRUE(writer.Write("/data/local/tmp", TEST_DUMP_FILE, frame.data(), frame.size()));
+    EXPECT_TRUE(WaitDrained());
+}
+
+/**
+ * @tc.name: dcamera_dump_writer_test_003
+ * @tc.desc: Verify a full queue drops the frame without waiting and counts it.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraDumpWriterTest, dcamera_dump_writer_test_003, TestSize.Level1)
+{
+    DCameraDumpWriter& writer = DCameraDumpWriter::GetInstance();
+    std::vector<uint8_t> frame(TEST_FRAME_SIZE, 2);
+    uint64_t dropped = writer.GetDroppedCount();
+    {
+        std::lock_guard<std::mutex> lock(writer.queueMutex_);
+        writer.queuedBytes_ += DCameraDumpWriter::MAX_QUEUED_BYTES;
+    }
+    EXPECT_FALSE(writer.Write(DUMP_PATH, TEST_DUMP_FILE, frame.data(), frame.size()));
+    EXPECT_EQ(dropped + 1, writer.GetDroppedCount());
+    {
+        std::lock_guard<std::mutex> lock(writer.queueMutex_);
+        writer.queuedBytes_ -= DCameraDumpWriter::MAX_QUEUED_BYTES;
+    }
+    EXPECT_TRUE(writer.Write(DUMP_PATH, TEST_DUMP_FILE, frame.data(), frame.size()));
+    EXPECT_TRUE(WaitDrained());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <vector>
+
+#include "dcamera_event_reporter.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t TEST_EVENT_COUNT = 40;
+constexpr int32_t TEST_WAIT_SECONDS = 2;
+}
+
+class DCameraEventReporterTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraEventReporterTest::SetUpTestCase(void)
+{
+}
+
+void DCameraEventReporterTest::TearDownTestCase(void)
+{
+}
+
+void DCameraEventReporterTest::SetUp(void)
+{
+}
+
+void DCameraEventReporterTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: dcamera_event_reporter_test_001
+ * @tc.desc: Verify events are written off the caller in posting order.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraEventReporterTest, dcamera_event_reporter_test_001, TestSize.Level1)
+{
+    DCameraEventReporter& reporter = DCameraEventReporter::GetInstance();
+    EXPECT_FALSE(reporter.Post(nullptr));
+
+    std::mutex orderMutex;
+    std::vector<int32_t> order;
+    std::promise<void> done;
+    for (int32_t i = 0; i < TEST_EVENT_COUNT; i++) {
+        EXPECT_TRUE(reporter.Post([i, &orderMutex, &order, &done]() {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(i);
+            if (i == TEST_EVENT_COUNT - 1) {
+                done.set_value();
+            }
+        }));
+    }
+    ASSERT_EQ(std::future_status::ready,
+        done.get_future().wait_for(std::chrono::seconds(TEST_WAIT_SECONDS)));
+    std::lock_guard<std::mutex> lock(orderMutex);
+    ASSERT_EQ(static_cast<size_t>(TEST_EVENT_COUNT), order.size());
+    for (int32_t i = 0; i < TEST_EVENT_COUNT; i++) {
+        EXPECT_EQ(i, order[i]);
+    }
+}
+
+/**
+ * @tc.name: dcamera_event_reporter_test_002
+ * @tc.desc: Verify a full queue drops the event at once and counts it.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraEventReporterTest, dcamera_event_reporter_test_002, TestSize.Level1)
+{
+    DCameraEventReporter& reporter = DCameraEventReporter::GetInstance();
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    EXPECT_TRUE(reporter.Post([&started, released]() {
+        started.set_value();
+        released.wait();
+    }));
+    ASSERT_EQ(std::future_status::ready,
+        started.get_future().wait_for(std::chrono::seconds(TEST_WAIT_SECONDS)));
+    for (size_t i = 0; i < DCameraEventReporter::MAX_PENDING_EVENTS; i++) {
+        EXPECT_TRUE(reporter.Post([]() {}));
+    }
+    uint64_t dropped = reporter.GetDroppedCount();
+    EXPECT_FALSE(reporter.Post([]() {}));
+    EXPECT_EQ(dropped + 1, reporter.GetDroppedCount());
+    release.set_value();
+
+    std::promise<void> done;
+    bool isPosted = false;
+    auto start = std::chrono::steady_clock::now();
+    while (!isPosted && std::chrono::steady_clock::now() - start < std::chrono::seconds(TEST_WAIT_SECONDS)) {
+        isPosted = reporter.Post([&done]() { done.set_value(); });
+    }
+    ASSERT_TRUE(isPosted);
+    EXPECT_EQ(std::future_status::ready, done.get_future().wait_for(std::chrono::seconds(TEST_WAIT_SECONDS)));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include "dcamera_frame_drop_statistics.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_STREAM_KEY = "source_test_stream";
+const uint64_t TEST_DROP_NUM = 5;
+}
+
+class DCameraFrameDropStatisticsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraFrameDropStatisticsTest::SetUpTestCase(void)
+{
+}
+
+void DCameraFrameDropStatisticsTest::TearDownTestCase(void)
+{
+}
+
+void DCameraFrameDropStatisticsTest::SetUp(void)
+{
+}
+
+void DCameraFrameDropStatisticsTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: dcamera_frame_drop_statistics_test_001
+ * @tc.desc: Verify drops are counted per reason and invalid reasons are ignored.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraFrameDropStatisticsTest, dcamera_frame_drop_statistics_test_001, TestSize.Level1)
+{
+    DCameraStreamDropCounter counter(TEST_STREAM_KEY);
+    counter.Add(DCAMERA_DROP_FPS_CONTROL);
+    counter.Add(DCAMERA_DROP_SYNC_LATE, TEST_DROP_NUM);
+    counter.Add(DCAMERA_DROP_REASON_COUNT, TEST_DROP_NUM);
+    EXPECT_EQ(1, counter.Get(DCAMERA_DROP_FPS_CONTROL));
+    EXPECT_EQ(TEST_DROP_NUM, counter.Get(DCAMERA_DROP_SYNC_LATE));
+    EXPECT_EQ(0, counter.Get(DCAMERA_DROP_REASON_COUNT));
+    EXPECT_EQ(TEST_DROP_NUM + 1, counter.GetTotal());
+
+    std::string result;
+    counter.Dump(result);
+    EXPECT_EQ(" fpsControl:1 syncLate:5", result);
+    EXPECT_STREQ("unknown", DCameraStreamDropCounter::GetReasonName(DCAMERA_DROP_REASON_COUNT));
+
+    counter.Reset();
+    EXPECT_EQ(0, counter.GetTotal());
+}
+
+/**
+ * @tc.name: dcamera_frame_drop_statistics_test_002
+ * @tc.desc: Verify a stream is dumped while its counter is held and a reported session starts over.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraFrameDropStatisticsTest, dcamera_frame_drop_statistics_test_002, TestSize.Level1)
+{
+    std::shared_ptr<DCameraStreamDropCounter> counter =
+        DCameraFrameDropStatistics::GetInstance().Acquire(TEST_STREAM_KEY);
+    ASSERT_NE(nullptr, counter);
+    EXPECT_EQ(counter, DCameraFrameDropStatistics::GetInstance().Acquire(TEST_STREAM_KEY));
+    counter->Add(DCAMERA_DROP_STAGE_FULL, TEST_DROP_NUM);
+
+    std::string result;
+    DCameraFrameDropStatistics::GetInstance().Dump(result);
+    EXPECT_NE(std::string::npos, result.find(TEST_STREAM_KEY + " dropped 5 stageFull:5"));
+
+    DCameraFrameDropStatistics::GetInstance().ReportSession(counter);
+    EXPECT_EQ(0, counter->GetTotal());
+
+    counter = nullptr;
+    result.clear();
+    DCameraFrameDropStatistics::GetInstance().Dump(result);
+    EXPECT_EQ(std::string::npos, result.find(TEST_STREAM_KEY));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
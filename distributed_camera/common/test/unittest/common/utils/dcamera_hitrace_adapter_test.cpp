@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dcamera_hitrace_adapter.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const uint32_t TEST_TRACE_INTERVAL = 4;
+const int32_t TEST_FRAME_COUNT = 16;
+}
+
+class DCameraHitraceAdapterTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraHitraceAdapterTest::SetUpTestCase(void)
+{
+}
+
+void DCameraHitraceAdapterTest::TearDownTestCase(void)
+{
+}
+
+void DCameraHitraceAdapterTest::SetUp(void)
+{
+}
+
+void DCameraHitraceAdapterTest::TearDown(void)
+{
+    DCameraFrameTrace::frameTraceInterval_.store(0);
+    DCameraFrameTrace::noIndexCount_.store(0);
+}
+
+/**
+ * @tc.name: dcamera_hitrace_adapter_test_001
+ * @tc.desc: Verify no frame span starts while the trace interval is off.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraHitraceAdapterTest, dcamera_hitrace_adapter_test_001, TestSize.Level1)
+{
+    DCameraFrameTrace::frameTraceInterval_.store(0);
+    for (int32_t index = 0; index < TEST_FRAME_COUNT; index++) {
+        DCameraFrameTrace frameTrace(DCAMERA_FRAME_DECODE, index);
+        EXPECT_FALSE(frameTrace.isStarted_);
+    }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_ENCODE, DCAMERA_FRAME_TRACE_NO_INDEX);
+    EXPECT_FALSE(frameTrace.isStarted_);
+    EXPECT_EQ(0, DCameraFrameTrace::noIndexCount_.load());
+}
+
+/**
+ * @tc.name: dcamera_hitrace_adapter_test_002
+ * @tc.desc: Verify only every Nth frame is traced, by index or by arrival when the frame has no index.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraHitraceAdapterTest, dcamera_hitrace_adapter_test_002, TestSize.Level1)
+{
+    DCameraFrameTrace::frameTraceInterval_.store(TEST_TRACE_INTERVAL);
+    int32_t indexedCount = 0;
+    int32_t noIndexCount = 0;
+    for (int32_t index = 0; index < TEST_FRAME_COUNT; index++) {
+        DCameraFrameTrace indexedTrace(DCAMERA_FRAME_DECODE, index);
+        EXPECT_EQ(index % static_cast<int32_t>(TEST_TRACE_INTERVAL) == 0, indexedTrace.isStarted_);
+        indexedCount += indexedTrace.isStarted_ ? 1 : 0;
+        DCameraFrameTrace noIndexTrace(DCAMERA_FRAME_ENCODE, DCAMERA_FRAME_TRACE_NO_INDEX);
+        noIndexCount += noIndexTrace.isStarted_ ? 1 : 0;
+    }
+    EXPECT_EQ(TEST_FRAME_COUNT / static_cast<int32_t>(TEST_TRACE_INTERVAL), indexedCount);
+    EXPECT_EQ(TEST_FRAME_COUNT / static_cast<int32_t>(TEST_TRACE_INTERVAL), noIndexCount);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
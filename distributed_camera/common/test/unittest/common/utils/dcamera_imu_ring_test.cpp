@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dcamera_imu_ring.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const int64_t TEST_INTERVAL_NS = 2500000;
+const size_t TEST_READ_ROUNDS = 2000;
+
+ImuSample MakeSample(uint64_t index)
+{
+    ImuSample sample;
+    sample.timeStamp = static_cast<int64_t>(index + 1) * TEST_INTERVAL_NS;
+    sample.data[IMU_X] = static_cast<float>(index);
+    sample.data[IMU_Y] = static_cast<float>(index) + 0.5f;
+    sample.data[IMU_Z] = -static_cast<float>(index);
+    return sample;
+}
+}
+
+class DCameraImuRingTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::unique_ptr<DCameraImuRing> ring_;
+};
+
+void DCameraImuRingTest::SetUpTestCase(void)
+{
+}
+
+void DCameraImuRingTest::TearDownTestCase(void)
+{
+}
+
+void DCameraImuRingTest::SetUp(void)
+{
+    ring_ = std::make_unique<DCameraImuRing>();
+}
+
+void DCameraImuRingTest::TearDown(void)
+{
+    ring_ = nullptr;
+}
+
+/**
+ * @tc.name: dcamera_imu_ring_test_001
+ * @tc.desc: Verify window queries by timestamp and incremental reads.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraImuRingTest, dcamera_imu_ring_test_001, TestSize.Level1)
+{
+    std::vector<ImuSample> samples;
+    EXPECT_EQ(0, ring_->GetWindow(0, INT64_MAX, samples));
+    const uint64_t count = 10;
+    for (uint64_t i = 0; i < count; i++) {
+        ring_->Push(MakeSample(i));
+    }
+    EXPECT_EQ(count, ring_->GetWriteIndex());
+
+    EXPECT_EQ(4, ring_->GetWindow(MakeSample(3).timeStamp, MakeSample(6).timeStamp, samples));
+    for (size_t i = 0; i < samples.size(); i++) {
+        EXPECT_EQ(MakeSample(i + 3).timeStamp, samples[i].timeStamp);
+        EXPECT_EQ(MakeSample(i + 3).data[IMU_Y], samples[i].data[IMU_Y]);
+    }
+    EXPECT_EQ(0, ring_->GetWindow(MakeSample(count).timeStamp, INT64_MAX, samples));
+
+    uint64_t cursor = 0;
+    EXPECT_EQ(count, ring_->ReadSince(cursor, samples));
+    EXPECT_EQ(count, cursor);
+    EXPECT_EQ(0, ring_->ReadSince(cursor, samples));
+    ring_->Push(MakeSample(count));
+    EXPECT_EQ(1, ring_->ReadSince(cursor, samples));
+    EXPECT_EQ(MakeSample(count).data[IMU_Z], samples[0].data[IMU_Z]);
+
+    ring_->Clear();
+    EXPECT_EQ(0, ring_->GetWindow(0, INT64_MAX, samples));
+    cursor = 0;
+    EXPECT_EQ(0, ring_->ReadSince(cursor, samples));
+}
+
+/**
+ * @tc.name: dcamera_imu_ring_test_002
+ * @tc.desc: Verify the ring keeps the newest CAPACITY samples once it wraps.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraImuRingTest, dcamera_imu_ring_test_002, TestSize.Level1)
+{
+    const uint64_t count = DCameraImuRing::CAPACITY + DCameraImuRing::CAPACITY / 2;
+    for (uint64_t i = 0; i < count; i++) {
+        ring_->Push(MakeSample(i));
+    }
+    std::vector<ImuSample> samples;
+    EXPECT_EQ(DCameraImuRing::CAPACITY, ring_->GetWindow(0, INT64_MAX, samples));
+    EXPECT_EQ(MakeSample(count - DCameraImuRing::CAPACITY).timeStamp, samples.front().timeStamp);
+    EXPECT_EQ(MakeSample(count - 1).timeStamp, samples.back().timeStamp);
+
+    uint64_t cursor = 1;
+    EXPECT_EQ(DCameraImuRing::CAPACITY, ring_->ReadSince(cursor, samples));
+    EXPECT_EQ(MakeSample(count - DCameraImuRing::CAPACITY).timeStamp, samples.front().timeStamp);
+}
+
+/**
+ * @tc.name: dcamera_imu_ring_test_003
+ * @tc.desc: Verify readers never see a torn sample while the writer laps the ring.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraImuRingTest, dcamera_imu_ring_test_003, TestSize.Level1)
+{
+    std::atomic<bool> isDone = false;
+    std::thread writer([this, &isDone]() {
+        for (uint64_t i = 0; !isDone.load(); i++) {
+            ring_->Push(MakeSample(i));
+        }
+    });
+    std::vector<ImuSample> samples;
+    uint64_t cursor = 0;
+    for (size_t round = 0; round < TEST_READ_ROUNDS; round++) {
+        ring_->ReadSince(cursor, samples);
+        int64_t lastTime = 0;
+        for (const auto& sample : samples) {
+            uint64_t index = static_cast<uint64_t>(sample.timeStamp / TEST_INTERVAL_NS) - 1;
+            ImuSample expect = MakeSample(index);
+            EXPECT_EQ(expect.data[IMU_X], sample.data[IMU_X]);
+            EXPECT_EQ(expect.data[IMU_Z], sample.data[IMU_Z]);
+            EXPECT_LT(lastTime, sample.timeStamp);
+            lastTime = sample.timeStamp;
+        }
+    }
+    isDone.store(true);
+    writer.join();
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include "data_buffer.h"
+#include "dcamera_memory_account.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_SESSION_KEY = "source_test_session";
+const uint64_t TEST_BUDGET = 1000;
+const uint64_t TEST_BYTES = 600;
+const size_t TEST_CAPACITY = 64;
+}
+
+class DCameraMemoryAccountTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraMemoryAccountTest::SetUpTestCase(void)
+{
+}
+
+void DCameraMemoryAccountTest::TearDownTestCase(void)
+{
+}
+
+void DCameraMemoryAccountTest::SetUp(void)
+{
+}
+
+void DCameraMemoryAccountTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: dcamera_memory_account_test_001
+ * @tc.desc: Verify live and peak bytes follow charges, moves and the budget.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraMemoryAccountTest, dcamera_memory_account_test_001, TestSize.Level1)
+{
+    DCameraMemoryAccount account(TEST_SESSION_KEY, TEST_BUDGET);
+    account.Charge(DCAMERA_MEMORY_DECODER, TEST_BYTES);
+    EXPECT_FALSE(account.IsOverBudget());
+    account.Charge(DCAMERA_MEMORY_SCALER, TEST_BYTES);
+    EXPECT_TRUE(account.IsOverBudget());
+    EXPECT_EQ(TEST_BYTES + TEST_BYTES, account.GetPeakTotal());
+
+    account.Move(DCAMERA_MEMORY_DECODER, DCAMERA_MEMORY_SMOOTHER, TEST_BYTES);
+    EXPECT_EQ(0, account.GetLiveBytes(DCAMERA_MEMORY_DECODER));
+    EXPECT_EQ(TEST_BYTES, account.GetPeakBytes(DCAMERA_MEMORY_DECODER));
+    EXPECT_EQ(TEST_BYTES, account.GetLiveBytes(DCAMERA_MEMORY_SMOOTHER));
+
+    account.Uncharge(DCAMERA_MEMORY_SCALER, TEST_BYTES);
+    EXPECT_FALSE(account.IsOverBudget());
+    EXPECT_EQ(TEST_BYTES, account.GetLiveTotal());
+    EXPECT_EQ(TEST_BYTES + TEST_BYTES, account.GetPeakTotal());
+
+    account.ResetPeak();
+    EXPECT_EQ(TEST_BYTES, account.GetPeakTotal());
+    EXPECT_EQ(0, account.GetPeakBytes(DCAMERA_MEMORY_SCALER));
+    EXPECT_STREQ("unknown", DCameraMemoryAccount::GetOwnerName(DCAMERA_MEMORY_OWNER_COUNT));
+}
+
+/**
+ * @tc.name: dcamera_memory_account_test_002
+ * @tc.desc: Verify a buffer is charged once, moves with its owner and is uncharged when freed.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraMemoryAccountTest, dcamera_memory_account_test_002, TestSize.Level1)
+{
+    std::shared_ptr<DCameraMemoryAccount> account = std::make_shared<DCameraMemoryAccount>(TEST_SESSION_KEY, 0);
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(TEST_CAPACITY);
+    buffer->Account(account, DCAMERA_MEMORY_DECODER);
+    uint64_t charged = account->GetLiveBytes(DCAMERA_MEMORY_DECODER);
+    EXPECT_GE(charged, TEST_CAPACITY);
+    buffer->Account(account, DCAMERA_MEMORY_CHANNEL);
+    EXPECT_EQ(charged, account->GetLiveTotal());
+
+    buffer->SetOwner(DCAMERA_MEMORY_SMOOTHER);
+    EXPECT_EQ(0, account->GetLiveBytes(DCAMERA_MEMORY_DECODER));
+    EXPECT_EQ(charged, account->GetLiveBytes(DCAMERA_MEMORY_SMOOTHER));
+    EXPECT_FALSE(account->IsOverBudget());
+
+    buffer = nullptr;
+    EXPECT_EQ(0, account->GetLiveTotal());
+    EXPECT_EQ(charged, account->GetPeakTotal());
+}
+
+/**
+ * @tc.name: dcamera_memory_account_test_003
+ * @tc.desc: Verify a session is dumped while its account is held.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraMemoryAccountTest, dcamera_memory_account_test_003, TestSize.Level1)
+{
+    std::shared_ptr<DCameraMemoryAccount> account = DCameraMemoryStatistics::GetInstance().Acquire(TEST_SESSION_KEY);
+    ASSERT_NE(nullptr, account);
+    EXPECT_EQ(account, DCameraMemoryStatistics::GetInstance().Acquire(TEST_SESSION_KEY));
+    account->Charge(DCAMERA_MEMORY_CHANNEL, TEST_BYTES);
+
+    std::string result;
+    DCameraMemoryStatistics::GetInstance().Dump(result);
+    EXPECT_NE(std::string::npos, result.find(TEST_SESSION_KEY + " live 600"));
+    EXPECT_NE(std::string::npos, result.find("channel:600/600"));
+    account->Uncharge(DCAMERA_MEMORY_CHANNEL, TEST_BYTES);
+    DCameraMemoryStatistics::GetInstance().ReportSession(account);
+    EXPECT_EQ(0, account->GetPeakTotal());
+
+    account = nullptr;
+    result.clear();
+    DCameraMemoryStatistics::GetInstance().Dump(result);
+    EXPECT_EQ(std::string::npos, result.find(TEST_SESSION_KEY));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
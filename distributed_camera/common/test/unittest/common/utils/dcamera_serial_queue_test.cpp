@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dcamera_serial_queue.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_QUEUE_NAME = "dcamQueueTest";
+constexpr int32_t TEST_TASK_COUNT = 50;
+}
+
+class DCameraSerialQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraSerialQueueTest::SetUpTestCase(void)
+{
+}
+
+void DCameraSerialQueueTest::TearDownTestCase(void)
+{
+}
+
+void DCameraSerialQueueTest::SetUp(void)
+{
+}
+
+void DCameraSerialQueueTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: dcamera_serial_queue_test_001
+ * @tc.desc: Verify tasks of one queue run one at a time in posting order across several worker turns.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSerialQueueTest, dcamera_serial_queue_test_001, TestSize.Level1)
+{
+    DCameraSerialQueue queue(TEST_QUEUE_NAME, DCAMERA_THREAD_FRAME);
+    EXPECT_EQ(TEST_QUEUE_NAME, queue.GetName());
+    EXPECT_FALSE(queue.PostTask(nullptr));
+
+    std::mutex orderMutex;
+    std::vector<int32_t> order;
+    std::atomic<int32_t> running = 0;
+    std::atomic<bool> isOverlapped = false;
+    for (int32_t i = 0; i < TEST_TASK_COUNT; i++) {
+        EXPECT_TRUE(queue.PostTask([i, &orderMutex, &order, &running, &isOverlapped]() {
+            if (running.fetch_add(1) != 0) {
+                isOverlapped = true;
+            }
+            {
+                std::lock_guard<std::mutex> lock(orderMutex);
+                order.push_back(i);
+            }
+            running.fetch_sub(1);
+        }));
+    }
+    std::promise<void> drained;
+    EXPECT_TRUE(queue.PostTask([&drained]() { drained.set_value(); }));
+    drained.get_future().wait();
+    queue.Stop();
+    EXPECT_FALSE(isOverlapped.load());
+    ASSERT_EQ(static_cast<size_t>(TEST_TASK_COUNT), order.size());
+    for (int32_t i = 0; i < TEST_TASK_COUNT; i++) {
+        EXPECT_EQ(i, order[i]);
+    }
+}
+
+/**
+ * @tc.name: dcamera_serial_queue_test_002
+ * @tc.desc: Verify removed tasks never run and a stopped queue refuses new tasks.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSerialQueueTest, dcamera_serial_queue_test_002, TestSize.Level1)
+{
+    DCameraSerialQueue queue(TEST_QUEUE_NAME, DCAMERA_THREAD_CONTROL);
+    std::mutex gateMutex;
+    std::unique_lock<std::mutex> gate(gateMutex);
+    std::atomic<int32_t> count = 0;
+    EXPECT_TRUE(queue.PostTask([&gateMutex, &count]() {
+        std::lock_guard<std::mutex> lock(gateMutex);
+        count++;
+    }));
+    EXPECT_TRUE(queue.PostTask([&count]() { count++; }));
+    EXPECT_TRUE(queue.PostTask([&count]() { count++; }));
+    queue.RemoveAllTasks();
+    EXPECT_EQ(0u, queue.GetPendingCount());
+    gate.unlock();
+
+    queue.Stop();
+    EXPECT_LE(count.load(), 1);
+    EXPECT_FALSE(queue.PostTask([&count]() { count++; }));
+    EXPECT_LE(count.load(), 1);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
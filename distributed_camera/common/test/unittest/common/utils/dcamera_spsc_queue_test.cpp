@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "dcamera_spsc_queue.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const size_t TEST_CAPACITY = 4;
+const uint32_t TEST_ITEM_NUM = 100000;
+const int32_t TEST_WAIT_MS = 10;
+const int32_t TEST_LONG_WAIT_MS = 5000;
+}
+
+class DCameraSpscQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraSpscQueueTest::SetUpTestCase(void)
+{
+}
+
+void DCameraSpscQueueTest::TearDownTestCase(void)
+{
+}
+
+void DCameraSpscQueueTest::SetUp(void)
+{
+}
+
+void DCameraSpscQueueTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: dcamera_spsc_queue_test_001
+ * @tc.desc: Verify items come out in order, a full queue rejects pushes and Front does not remove.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSpscQueueTest, dcamera_spsc_queue_test_001, TestSize.Level1)
+{
+    DCameraSpscQueue<std::shared_ptr<int32_t>> queue(TEST_CAPACITY);
+    EXPECT_EQ(TEST_CAPACITY, queue.Capacity());
+    std::shared_ptr<int32_t> item = nullptr;
+    EXPECT_FALSE(queue.Front(item));
+    EXPECT_FALSE(queue.Pop(item));
+    for (size_t i = 0; i < TEST_CAPACITY; i++) {
+        EXPECT_TRUE(queue.Push(std::make_shared<int32_t>(static_cast<int32_t>(i))));
+    }
+    EXPECT_FALSE(queue.Push(std::make_shared<int32_t>(-1)));
+    EXPECT_EQ(TEST_CAPACITY, queue.Size());
+    ASSERT_TRUE(queue.Front(item));
+    EXPECT_EQ(0, *item);
+    EXPECT_EQ(TEST_CAPACITY, queue.Size());
+    std::weak_ptr<int32_t> popped = item;
+    ASSERT_TRUE(queue.Pop(item));
+    EXPECT_EQ(0, *item);
+    item = nullptr;
+    // The slot gives up its reference once popped.
+    EXPECT_TRUE(popped.expired());
+    EXPECT_TRUE(queue.Push(std::make_shared<int32_t>(static_cast<int32_t>(TEST_CAPACITY))));
+    for (size_t i = 1; i <= TEST_CAPACITY; i++) {
+        ASSERT_TRUE(queue.Pop(item));
+        EXPECT_EQ(static_cast<int32_t>(i), *item);
+    }
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_TRUE(queue.Push(item));
+    queue.Clear();
+    EXPECT_TRUE(queue.Empty());
+}
+
+/**
+ * @tc.name: dcamera_spsc_queue_test_002
+ * @tc.desc: Verify Wait times out on an empty queue and returns early on Wakeup.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSpscQueueTest, dcamera_spsc_queue_test_002, TestSize.Level1)
+{
+    DCameraSpscQueue<int32_t> queue(TEST_CAPACITY);
+    EXPECT_FALSE(queue.Wait(TEST_WAIT_MS));
+    queue.Wakeup();
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.Wait(TEST_LONG_WAIT_MS));
+    queue.Wakeup();
+    queue.WaitWakeup(TEST_LONG_WAIT_MS);
+    auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    EXPECT_LT(cost.count(), TEST_LONG_WAIT_MS);
+    EXPECT_TRUE(queue.Push(1));
+    EXPECT_TRUE(queue.Wait(TEST_LONG_WAIT_MS));
+}
+
+/**
+ * @tc.name: dcamera_spsc_queue_test_003
+ * @tc.desc: Verify a producer and a consumer thread hand over every item in order.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSpscQueueTest, dcamera_spsc_queue_test_003, TestSize.Level1)
+{
+    DCameraSpscQueue<uint32_t> queue(TEST_CAPACITY);
+    std::thread producer([&queue]() {
+        for (uint32_t i = 0; i < TEST_ITEM_NUM;) {
+            if (queue.Push(i)) {
+                i++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    uint32_t expected = 0;
+    bool isOrdered = true;
+    while (expected < TEST_ITEM_NUM) {
+        uint32_t item = 0;
+        if (!queue.Pop(item)) {
+            queue.Wait(TEST_LONG_WAIT_MS);
+            continue;
+        }
+        isOrdered = isOrdered && (item == expected);
+        expected++;
+    }
+    producer.join();
+    EXPECT_TRUE(isOrdered);
+    EXPECT_TRUE(queue.Empty());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
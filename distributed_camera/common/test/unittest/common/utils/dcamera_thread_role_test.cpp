@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/prctl.h>
+#include <thread>
+#include <vector>
+
+#include "dcamera_thread_role.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_THREAD_NAME = "dcamRoleTest";
+constexpr size_t THREAD_NAME_LEN = 16;
+}
+
+class DCameraThreadRoleTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraThreadRoleTest::SetUpTestCase(void)
+{
+}
+
+void DCameraThreadRoleTest::TearDownTestCase(void)
+{
+}
+
+void DCameraThreadRoleTest::SetUp(void)
+{
+}
+
+void DCameraThreadRoleTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: dcamera_thread_role_test_001
+ * @tc.desc: Verify cpu lists with single cpus and ranges parse sorted and malformed lists are refused.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraThreadRoleTest, dcamera_thread_role_test_001, TestSize.Level1)
+{
+    std::vector<int32_t> cpus;
+    EXPECT_TRUE(DCameraThreadRoleRegistry::ParseCpuList("6,4-5,4", cpus));
+    EXPECT_EQ(std::vector<int32_t>({ 4, 5, 6 }), cpus);
+    EXPECT_TRUE(DCameraThreadRoleRegistry::ParseCpuList("0", cpus));
+    EXPECT_EQ(std::vector<int32_t>({ 0 }), cpus);
+
+    std::vector<int32_t> unchanged = cpus;
+    EXPECT_FALSE(DCameraThreadRoleRegistry::ParseCpuList("", cpus));
+    EXPECT_FALSE(DCameraThreadRoleRegistry::ParseCpuList("-1", cpus));
+    EXPECT_FALSE(DCameraThreadRoleRegistry::ParseCpuList("5-4", cpus));
+    EXPECT_FALSE(DCameraThreadRoleRegistry::ParseCpuList("1,a", cpus));
+    EXPECT_FALSE(DCameraThreadRoleRegistry::ParseCpuList("99999", cpus));
+    EXPECT_EQ(unchanged, cpus);
+}
+
+/**
+ * @tc.name: dcamera_thread_role_test_002
+ * @tc.desc: Verify a thread is named by its role registration and unknown roles keep the defaults.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraThreadRoleTest, dcamera_thread_role_test_002, TestSize.Level1)
+{
+    EXPECT_STREQ("frame", DCameraThreadRoleRegistry::GetRoleName(DCAMERA_THREAD_FRAME));
+    EXPECT_STREQ("unknown", DCameraThreadRoleRegistry::GetRoleName(DCAMERA_THREAD_ROLE_COUNT));
+    EXPECT_TRUE(DCameraThreadRoleRegistry::GetInstance().GetPolicy(DCAMERA_THREAD_ROLE_COUNT).cpus.empty());
+    EXPECT_GT(DCameraThreadRoleRegistry::GetInstance().GetFfrtQos(DCAMERA_THREAD_FRAME),
+        DCameraThreadRoleRegistry::GetInstance().GetFfrtQos(DCAMERA_THREAD_BACKGROUND));
+
+    std::string name;
+    std::thread worker([&name]() {
+        DCameraThreadRoleRegistry::GetInstance().ApplyCurrentThread(DCAMERA_THREAD_BACKGROUND, TEST_THREAD_NAME);
+        char buffer[THREAD_NAME_LEN + 1] = {0};
+        prctl(PR_GET_NAME, buffer);
+        name = buffer;
+    });
+    worker.join();
+    EXPECT_EQ(TEST_THREAD_NAME, name);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
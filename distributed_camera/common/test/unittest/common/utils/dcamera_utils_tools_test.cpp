@@ -15,9 +15,12 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 #include "accesstoken_kit.h"
 #include "anonymous_string.h"
@@ -32,6 +35,70 @@ using namespace testing::ext;
 
 namespace OHOS {
 namespace DistributedHardware {
+namespace {
+const std::string LEGACY_BASE64_CHARS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+const std::vector<size_t> BENCH_SIZES = { 4 * 1024, 64 * 1024, 1024 * 1024 };
+
+// The character at a time codec Base64Encode/Base64Decode replaced, kept as the benchmark baseline.
+std::string LegacyBase64Encode(const unsigned char *toEncode, size_t len)
+{
+    std::string ret;
+    uint32_t count = 0;
+    uint32_t bits = 0;
+    for (size_t i = 0; i < len; i++) {
+        bits = (bits << 8) | toEncode[i];
+        if (++count == 3) {
+            for (int32_t shift = 18; shift >= 0; shift -= 6) {
+                ret += LEGACY_BASE64_CHARS[(bits >> shift) & 0x3f];
+            }
+            count = 0;
+            bits = 0;
+        }
+    }
+    if (count > 0) {
+        bits <<= (3 - count) * 8;
+        for (uint32_t j = 0; j <= count; j++) {
+            ret += LEGACY_BASE64_CHARS[(bits >> (18 - 6 * j)) & 0x3f];
+        }
+        ret.append(3 - count, '=');
+    }
+    return ret;
+}
+
+std::string LegacyBase64Decode(const std::string &basicString)
+{
+    std::string ret;
+    uint32_t count = 0;
+    uint32_t bits = 0;
+    for (size_t i = 0; i < basicString.size() && basicString[i] != '='; i++) {
+        size_t value = LEGACY_BASE64_CHARS.find(basicString[i]);
+        if (value == std::string::npos) {
+            break;
+        }
+        bits = (bits << 6) | static_cast<uint32_t>(value);
+        if (++count == 4) {
+            for (int32_t shift = 16; shift >= 0; shift -= 8) {
+                ret += static_cast<char>((bits >> shift) & 0xff);
+            }
+            count = 0;
+            bits = 0;
+        }
+    }
+    if (count > 1) {
+        bits <<= (4 - count) * 6;
+        for (uint32_t j = 0; j < count - 1; j++) {
+            ret += static_cast<char>((bits >> (16 - 8 * j)) & 0xff);
+        }
+    }
+    return ret;
+}
+
+int64_t GetCostUs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
 class TestAccessListener : public IAccessListener {
     sptr<IRemoteObject> AsObject()
     {
@@ -184,6 +251,61 @@ HWTEST_F(DcameraUtilsToolsTest, Base64Encode_002, TestSize.Level1)
     EXPECT_EQ(DCAMERA_OK, ret);
 }
 
+/**
+ * @tc.name: Base64Encode_003
+ * @tc.desc: Verify Base64Encode and Base64Decode on the standard vectors and binary data.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DcameraUtilsToolsTest, Base64Encode_003, TestSize.Level1)
+{
+    const std::vector<std::pair<std::string, std::string>> vectors = {
+        { "f", "Zg==" }, { "fo", "Zm8=" }, { "foo", "Zm9v" }, { "foobar", "Zm9vYmFy" },
+    };
+    for (const auto &vec : vectors) {
+        EXPECT_EQ(vec.second, Base64Encode(reinterpret_cast<const unsigned char *>(vec.first.c_str()),
+            vec.first.size()));
+        EXPECT_EQ(vec.first, Base64Decode(vec.second));
+    }
+    std::string binary;
+    for (int32_t i = UINT8_MAX; i >= 0; i--) {
+        binary.push_back(static_cast<char>(i));
+    }
+    std::string encoded = Base64Encode(reinterpret_cast<const unsigned char *>(binary.c_str()), binary.size());
+    EXPECT_EQ(binary, Base64Decode(encoded));
+    EXPECT_EQ("foo", Base64Decode("Zm9v*Zm9v"));
+}
+
+/**
+ * @tc.name: Base64Encode_004
+ * @tc.desc: Benchmark Base64Encode and Base64Decode against the character at a time codec on 4 KB to 1 MB.
+ * @tc.type: PERF
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DcameraUtilsToolsTest, Base64Encode_004, TestSize.Level1)
+{
+    for (size_t size : BENCH_SIZES) {
+        std::string input(size, '\0');
+        for (size_t i = 0; i < size; i++) {
+            input[i] = static_cast<char>(i * 131 + (i >> 8));
+        }
+        const unsigned char *data = reinterpret_cast<const unsigned char *>(input.c_str());
+        auto start = std::chrono::steady_clock::now();
+        std::string legacyEncoded = LegacyBase64Encode(data, size);
+        std::string legacyDecoded = LegacyBase64Decode(legacyEncoded);
+        int64_t legacyCost = GetCostUs(start);
+        start = std::chrono::steady_clock::now();
+        std::string encoded = Base64Encode(data, size);
+        std::string decoded = Base64Decode(encoded);
+        int64_t cost = GetCostUs(start);
+        std::cout << "Base64 " << size << " bytes, legacy " << legacyCost << " us, table " << cost << " us"
+            << std::endl;
+        EXPECT_EQ(legacyEncoded, encoded);
+        EXPECT_EQ(input, legacyDecoded);
+        EXPECT_EQ(input, decoded);
+    }
+}
+
 /**
  * @tc.name: GetAnonyInt32_001
  * @tc.desc: Verify the GetAnonyInt32 function failed.
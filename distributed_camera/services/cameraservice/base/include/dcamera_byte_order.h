@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_BYTE_ORDER_H
+#define OHOS_DCAMERA_BYTE_ORDER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint32_t DCAMERA_BYTE_BITS = 8;
+constexpr uint8_t DCAMERA_BYTE_MASK = 0xFF;
+
+template<typename T>
+inline void PutBigEndian(uint8_t *ptr, T value)
+{
+    using U = typename std::make_unsigned<T>::type;
+    U raw = static_cast<U>(value);
+    for (size_t i = 0; i < sizeof(U); i++) {
+        ptr[sizeof(U) - 1 - i] = static_cast<uint8_t>(raw & DCAMERA_BYTE_MASK);
+        raw = static_cast<U>(raw >> DCAMERA_BYTE_BITS);
+    }
+}
+
+template<typename T>
+inline T GetBigEndian(const uint8_t *ptr)
+{
+    using U = typename std::make_unsigned<T>::type;
+    U raw = 0;
+    for (size_t i = 0; i < sizeof(U); i++) {
+        raw = static_cast<U>((raw << DCAMERA_BYTE_BITS) | ptr[i]);
+    }
+    return static_cast<T>(raw);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_BYTE_ORDER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -33,6 +33,8 @@ public:
     DCEncodeType encodeType_;
     DCStreamType streamType_;
     std::vector<std::shared_ptr<DCameraSettings>> captureSettings_;
+    // DCameraHdrType, peers without it always send and expect 8 bit streams.
+    int32_t hdrType_ = DCAMERA_HDR_NONE;
 };
 
 class DCameraCaptureInfoCmd {
@@ -50,9 +52,11 @@ public:
 public:
     int32_t Marshal(std::string& jsonStr);
     int32_t Unmarshal(const std::string& jsonStr);
+    // Reads an already parsed command, the caller keeps the ownership of rootValue.
+    int32_t Unmarshal(const cJSON *rootValue);
 
 private:
-    int32_t UmarshalValue(cJSON* rootValue);
+    int32_t UmarshalValue(const cJSON* rootValue);
     int32_t UmarshalSettings(cJSON* valueJson, std::shared_ptr<DCameraCaptureInfo>& captureInfo);
 };
 } // namespace DistributedHardware
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -40,6 +40,9 @@ class DCameraChannelInfo {
 public:
     std::string sourceDevId_;
     std::vector<DCameraChannelDetail> detail_;
+    int32_t frameInfoFormat_ = 0;
+    int32_t controlFormat_ = 0;
+    bool sessionMux_ = false;
 };
 
 class DCameraChannelInfoCmd {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,6 +19,8 @@
 #include <memory>
 #include <string>
 
+#include "cJSON.h"
+
 namespace OHOS {
 namespace DistributedHardware {
 class DCameraEvent {
@@ -38,6 +40,7 @@ public:
 public:
     int32_t Marshal(std::string& jsonStr);
     int32_t Unmarshal(const std::string& jsonStr);
+    int32_t Unmarshal(const cJSON *rootValue);
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,11 @@
 #ifndef OHOS_DCAMERA_METADATA_SETTING_H
 #define OHOS_DCAMERA_METADATA_SETTING_H
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cJSON.h"
 #include "v1_1/dcamera_types.h"
 
 namespace OHOS {
@@ -28,9 +33,27 @@ public:
     std::string command_;
     std::vector<std::shared_ptr<DCameraSettings>> value_;
 
+    /*
+     * Binary layout of the command, big-endian: magic(4) version(2) headerLen(2) followed by tag(2) len(4)
+     * value records. The type, dhId and command records carry the raw string, a setting record carries
+     * settingType(4) followed by the setting value. Records of an unknown tag are skipped.
+     */
+    static constexpr uint32_t BINARY_MAGIC = 0x44434D53;
+    static constexpr uint16_t BINARY_VERSION = 1;
+    static constexpr size_t BINARY_HEADER_LEN = 8;
+    static constexpr size_t BINARY_RECORD_HEADER_LEN = 6;
+    static constexpr uint16_t BINARY_TAG_TYPE = 1;
+    static constexpr uint16_t BINARY_TAG_DHID = 2;
+    static constexpr uint16_t BINARY_TAG_COMMAND = 3;
+    static constexpr uint16_t BINARY_TAG_SETTING = 4;
+
 public:
     int32_t Marshal(std::string& jsonStr);
     int32_t Unmarshal(const std::string& jsonStr);
+    int32_t Unmarshal(const cJSON *rootValue);
+    int32_t MarshalBinary(std::vector<uint8_t>& data);
+    int32_t UnmarshalBinary(const uint8_t *data, size_t length);
+    static bool IsBinary(const uint8_t *data, size_t length);
 };
 } // namespace DistributedHardware
 } // namespace OHOS
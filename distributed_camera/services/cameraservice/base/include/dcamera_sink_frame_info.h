@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,7 +16,12 @@
 #ifndef OHOS_DCAMERA_SINK_FRAME_INFO_H
 #define OHOS_DCAMERA_SINK_FRAME_INFO_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
+
+#include "dcamera_imu_ring.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -34,7 +39,12 @@ public:
     int64_t sendT_;
     std::string ver_;
     std::string rawTime_;
-    std::string imuInfo_;
+    int64_t rawTimeUs_ = 0;
+    uint32_t exposureTime_ = 0;
+    // Encoder tier of the sink in the high nibble and its throttle level in the low one, 0 when not reported.
+    uint8_t encoderPreset_ = 0;
+    std::vector<ImuSample> accData_;
+    std::vector<ImuSample> gyroData_;
 
 public:
     const std::string FRAME_INFO_TYPE = "type";
@@ -48,9 +58,37 @@ public:
     const std::string RAW_TIME = "rawTime";
     const std::string IMU_INFO = "imuInfo";
 
+    /*
+     * Fixed big-endian layout of the binary frame info, imuLen bytes of imu data follow the header:
+     * magic(4) version(2) headerLen(2) type(1) encoderPreset(1) reserved(2) index(4) pts(8) startEncodeT(8)
+     * finishEncodeT(8) sendT(8) rawTime(8) imuLen(4)
+     * Since version 2 the imu data is exposureTime(4) accCount(4) gyroCount(4) followed by the acc and then
+     * the gyro samples, each timeStamp(8) x(4) y(4) z(4) with the axes as IEEE 754 floats. Version 1 carried
+     * the imuInfo json text instead.
+     */
+    static constexpr uint32_t BINARY_MAGIC = 0x44434649;
+    static constexpr uint16_t BINARY_VERSION = 2;
+    static constexpr uint16_t BINARY_VERSION_JSON_IMU = 1;
+    static constexpr size_t BINARY_HEADER_LEN = 60;
+    static constexpr size_t BINARY_IMU_HEADER_LEN = 12;
+    static constexpr size_t BINARY_IMU_SAMPLE_LEN = 20;
+    static constexpr uint8_t ENCODER_PRESET_TIER_SHIFT = 4;
+    static constexpr uint8_t ENCODER_PRESET_LEVEL_MASK = 0x0F;
+
 public:
     void Marshal(std::string& jsonStr);
     int32_t Unmarshal(const std::string& jsonStr);
+    size_t GetBinarySize() const;
+    int32_t MarshalBinary(uint8_t *data, size_t capacity, size_t& length) const;
+    int32_t UnmarshalBinary(const uint8_t *data, size_t length);
+    static bool IsBinary(const uint8_t *data, size_t length);
+
+private:
+    size_t GetImuBinarySize() const;
+    void MarshalImuJson(std::string& jsonStr) const;
+    int32_t UnmarshalImuJson(const std::string& jsonStr);
+    void MarshalImuBinary(uint8_t *data) const;
+    int32_t UnmarshalImuBinary(const uint8_t *data, size_t length);
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -22,6 +22,7 @@
 #include "dcamera_info_cmd.h"
 #include "dcamera_index.h"
 #include "dcamera_open_info_cmd.h"
+#include "distributed_camera_errno.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -45,6 +46,11 @@ public:
     virtual int32_t ResumeDistributedHardware(const std::string &networkId) = 0;
     virtual int32_t StopDistributedHardware(const std::string &networkId) = 0;
     virtual void SetTokenId(uint64_t token) = 0;
+    /* Only the source end asks its peer for a key frame. */
+    virtual int32_t RequestKeyFrame()
+    {
+        return DCAMERA_BAD_OPERATE;
+    }
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -46,6 +46,7 @@ int32_t DCameraCaptureInfoCmd::Marshal(std::string& jsonStr)
         cJSON_AddBoolToObject(captureInfo, "IsCapture", capture->isCapture_);
         cJSON_AddNumberToObject(captureInfo, "EncodeType", capture->encodeType_);
         cJSON_AddNumberToObject(captureInfo, "StreamType", capture->streamType_);
+        cJSON_AddNumberToObject(captureInfo, "HdrType", capture->hdrType_);
         cJSON *captureSettings = cJSON_CreateArray();
         CHECK_NULL_FREE_RETURN(captureSettings, DCAMERA_BAD_VALUE, rootValue);
         cJSON_AddItemToObject(captureInfo, "CaptureSettings", captureSettings);
@@ -79,20 +80,25 @@ int32_t DCameraCaptureInfoCmd::Unmarshal(const std::string& jsonStr)
 {
     cJSON *rootValue = cJSON_Parse(jsonStr.c_str());
     CHECK_NULL_RETURN((rootValue == nullptr), DCAMERA_BAD_VALUE);
+    int32_t ret = Unmarshal(rootValue);
+    cJSON_Delete(rootValue);
+    return ret;
+}
 
+int32_t DCameraCaptureInfoCmd::Unmarshal(const cJSON *rootValue)
+{
     cJSON *type = cJSON_GetObjectItemCaseSensitive(rootValue, "Type");
-    CHECK_AND_FREE_RETURN_RET_LOG((type == nullptr || !cJSON_IsString(type) || (type->valuestring == nullptr)),
-        DCAMERA_BAD_VALUE, rootValue, "type parse fail.");
+    CHECK_AND_RETURN_RET_LOG((type == nullptr || !cJSON_IsString(type) || (type->valuestring == nullptr)),
+        DCAMERA_BAD_VALUE, "type parse fail.");
     type_ = type->valuestring;
 
     cJSON *dhId = cJSON_GetObjectItemCaseSensitive(rootValue, "dhId");
-    CHECK_AND_FREE_RETURN_RET_LOG((dhId == nullptr || !cJSON_IsString(dhId) || (dhId->valuestring == nullptr)),
-        DCAMERA_BAD_VALUE, rootValue, "dhId parse fail.");
+    CHECK_AND_RETURN_RET_LOG((dhId == nullptr || !cJSON_IsString(dhId) || (dhId->valuestring == nullptr)),
+        DCAMERA_BAD_VALUE, "dhId parse fail.");
     dhId_ = dhId->valuestring;
 
     cJSON *command = cJSON_GetObjectItemCaseSensitive(rootValue, "Command");
     if (command == nullptr || !cJSON_IsString(command) || (command->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     command_ = command->valuestring;
@@ -127,11 +133,10 @@ int32_t DCameraCaptureInfoCmd::Unmarshal(const std::string& jsonStr)
     if (eis != nullptr && cJSON_IsBool(eis) && cJSON_IsTrue(eis)) {
         eis_ = true;
     }
-    cJSON_Delete(rootValue);
     return ret;
 }
 
-int32_t DCameraCaptureInfoCmd::UmarshalValue(cJSON *rootValue)
+int32_t DCameraCaptureInfoCmd::UmarshalValue(const cJSON *rootValue)
 {
     cJSON *valueJson = cJSON_GetObjectItemCaseSensitive(rootValue, "Value");
     if (valueJson == nullptr || !cJSON_IsArray(valueJson)) {
@@ -168,6 +173,11 @@ int32_t DCameraCaptureInfoCmd::UmarshalValue(cJSON *rootValue)
         CHECK_NULL_RETURN((streamType == nullptr || !cJSON_IsNumber(streamType)), DCAMERA_BAD_VALUE);
         captureInfo->streamType_ = static_cast<DCStreamType>(streamType->valueint);
 
+        cJSON *hdrType = cJSON_GetObjectItemCaseSensitive(capInfo, "HdrType");
+        if (hdrType != nullptr && cJSON_IsNumber(hdrType)) {
+            captureInfo->hdrType_ = hdrType->valueint;
+        }
+
         cJSON *captureSettings = cJSON_GetObjectItemCaseSensitive(capInfo, "CaptureSettings");
         CHECK_NULL_RETURN((captureSettings == nullptr || !cJSON_IsArray(captureSettings)), DCAMERA_BAD_VALUE);
         int32_t ret = UmarshalSettings(captureSettings, captureInfo);
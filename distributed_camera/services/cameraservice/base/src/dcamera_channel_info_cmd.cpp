@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -39,6 +39,9 @@ int32_t DCameraChannelInfoCmd::Marshal(std::string& jsonStr)
         return DCAMERA_BAD_VALUE;
     }
     cJSON_AddStringToObject(channelInfo, "SourceDevId", value_->sourceDevId_.c_str());
+    cJSON_AddNumberToObject(channelInfo, "FrameInfoFormat", value_->frameInfoFormat_);
+    cJSON_AddNumberToObject(channelInfo, "ControlFormat", value_->controlFormat_);
+    cJSON_AddBoolToObject(channelInfo, "SessionMux", value_->sessionMux_);
     cJSON_AddItemToObject(rootValue, "Value", channelInfo);
 
     cJSON *details = cJSON_CreateArray();
@@ -105,6 +108,15 @@ int32_t DCameraChannelInfoCmd::Unmarshal(const std::string& jsonStr)
     }
     std::shared_ptr<DCameraChannelInfo> channelInfo = std::make_shared<DCameraChannelInfo>();
     channelInfo->sourceDevId_ = sourceDevId->valuestring;
+    cJSON *frameInfoFormat = cJSON_GetObjectItemCaseSensitive(valueJson, "FrameInfoFormat");
+    if (frameInfoFormat != nullptr && cJSON_IsNumber(frameInfoFormat)) {
+        channelInfo->frameInfoFormat_ = frameInfoFormat->valueint;
+    }
+    cJSON *controlFormat = cJSON_GetObjectItemCaseSensitive(valueJson, "ControlFormat");
+    if (controlFormat != nullptr && cJSON_IsNumber(controlFormat)) {
+        channelInfo->controlFormat_ = controlFormat->valueint;
+    }
+    channelInfo->sessionMux_ = cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(valueJson, "SessionMux"));
     cJSON *details = cJSON_GetObjectItemCaseSensitive(valueJson, "Detail");
     if (details == nullptr || !cJSON_IsArray(details) || cJSON_GetArraySize(details) == 0) {
         cJSON_Delete(rootValue);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -61,47 +61,47 @@ int32_t DCameraEventCmd::Unmarshal(const std::string& jsonStr)
     if (rootValue == nullptr) {
         return DCAMERA_BAD_VALUE;
     }
+    int32_t ret = Unmarshal(rootValue);
+    cJSON_Delete(rootValue);
+    return ret;
+}
+
+int32_t DCameraEventCmd::Unmarshal(const cJSON *rootValue)
+{
     cJSON *type = cJSON_GetObjectItemCaseSensitive(rootValue, "Type");
     cJSON *dhId = cJSON_GetObjectItemCaseSensitive(rootValue, "dhId");
     if (type == nullptr || !cJSON_IsString(type) || (type->valuestring == nullptr) ||
         dhId == nullptr || !cJSON_IsString(dhId) || (dhId->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     type_ = type->valuestring;
     dhId_ = dhId->valuestring;
     cJSON *command = cJSON_GetObjectItemCaseSensitive(rootValue, "Command");
     if (command == nullptr || !cJSON_IsString(command) || (command->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     command_ = command->valuestring;
     cJSON *valueJson = cJSON_GetObjectItemCaseSensitive(rootValue, "Value");
     if (valueJson == nullptr || !cJSON_IsObject(valueJson)) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     cJSON *eventType = cJSON_GetObjectItemCaseSensitive(valueJson, "EventType");
     if (eventType == nullptr || !cJSON_IsNumber(eventType)) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     std::shared_ptr<DCameraEvent> event = std::make_shared<DCameraEvent>();
     event->eventType_ = eventType->valueint;
     cJSON *eventResult = cJSON_GetObjectItemCaseSensitive(valueJson, "EventResult");
     if (eventResult == nullptr || !cJSON_IsNumber(eventResult)) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     event->eventResult_ = eventResult->valueint;
     cJSON *eventContent = cJSON_GetObjectItemCaseSensitive(valueJson, "EventContent");
     if (eventContent == nullptr || !cJSON_IsString(eventContent) || (eventContent->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     event->eventContent_ = eventContent->valuestring;
     value_ = event;
-    cJSON_Delete(rootValue);
     return DCAMERA_OK;
 }
 } // namespace DistributedHardware
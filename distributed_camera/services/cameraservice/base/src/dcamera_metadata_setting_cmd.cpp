@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,12 +16,42 @@
 #include "dcamera_metadata_setting_cmd.h"
 #include "cJSON.h"
 
+#include "dcamera_byte_order.h"
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 
 namespace OHOS {
 namespace DistributedHardware {
+namespace {
+constexpr size_t MAGIC_OFFSET = 0;
+constexpr size_t VERSION_OFFSET = 4;
+constexpr size_t HEADER_LEN_OFFSET = 6;
+constexpr size_t RECORD_LEN_OFFSET = 2;
+constexpr size_t SETTING_TYPE_LEN = 4;
+
+void PutRecord(std::vector<uint8_t>& data, uint16_t tag, const std::string& value)
+{
+    size_t offset = data.size();
+    data.resize(offset + DCameraMetadataSettingCmd::BINARY_RECORD_HEADER_LEN);
+    PutBigEndian<uint16_t>(data.data() + offset, tag);
+    PutBigEndian<uint32_t>(data.data() + offset + RECORD_LEN_OFFSET, static_cast<uint32_t>(value.size()));
+    data.insert(data.end(), value.begin(), value.end());
+}
+
+void PutSettingRecord(std::vector<uint8_t>& data, const DCameraSettings& setting)
+{
+    size_t offset = data.size();
+    data.resize(offset + DCameraMetadataSettingCmd::BINARY_RECORD_HEADER_LEN + SETTING_TYPE_LEN);
+    PutBigEndian<uint16_t>(data.data() + offset, DCameraMetadataSettingCmd::BINARY_TAG_SETTING);
+    PutBigEndian<uint32_t>(data.data() + offset + RECORD_LEN_OFFSET,
+        static_cast<uint32_t>(SETTING_TYPE_LEN + setting.value_.size()));
+    PutBigEndian<int32_t>(data.data() + offset + DCameraMetadataSettingCmd::BINARY_RECORD_HEADER_LEN,
+        static_cast<int32_t>(setting.type_));
+    data.insert(data.end(), setting.value_.begin(), setting.value_.end());
+}
+}
+
 int32_t DCameraMetadataSettingCmd::Marshal(std::string& jsonStr)
 {
     cJSON *rootValue = cJSON_CreateObject();
@@ -70,27 +100,30 @@ int32_t DCameraMetadataSettingCmd::Unmarshal(const std::string& jsonStr)
     if (rootValue == nullptr) {
         return DCAMERA_BAD_VALUE;
     }
+    int32_t ret = Unmarshal(rootValue);
+    cJSON_Delete(rootValue);
+    return ret;
+}
+
+int32_t DCameraMetadataSettingCmd::Unmarshal(const cJSON *rootValue)
+{
     cJSON *type = cJSON_GetObjectItemCaseSensitive(rootValue, "Type");
     if (type == nullptr || !cJSON_IsString(type) || (type->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     type_ = type->valuestring;
     cJSON *dhId = cJSON_GetObjectItemCaseSensitive(rootValue, "dhId");
     if (dhId == nullptr || !cJSON_IsString(dhId) || (dhId->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     dhId_ = dhId->valuestring;
     cJSON *command = cJSON_GetObjectItemCaseSensitive(rootValue, "Command");
     if (command == nullptr || !cJSON_IsString(command) || (command->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     command_ = command->valuestring;
     cJSON *settings = cJSON_GetObjectItemCaseSensitive(rootValue, "Value");
     if (settings == nullptr || !cJSON_IsArray(settings) || cJSON_GetArraySize(settings) == 0) {
-        cJSON_Delete(rootValue);
         return DCAMERA_BAD_VALUE;
     }
     cJSON *subSetting = nullptr;
@@ -98,11 +131,9 @@ int32_t DCameraMetadataSettingCmd::Unmarshal(const std::string& jsonStr)
         cJSON *settingType = cJSON_GetObjectItemCaseSensitive(subSetting, "SettingType");
         cJSON *settingValue = cJSON_GetObjectItemCaseSensitive(subSetting, "SettingValue");
         if (settingType == nullptr || !cJSON_IsNumber(settingType)) {
-            cJSON_Delete(rootValue);
             return DCAMERA_BAD_VALUE;
         }
         if (settingValue == nullptr || !cJSON_IsString(settingValue) || (settingValue->valuestring == nullptr)) {
-            cJSON_Delete(rootValue);
             return DCAMERA_BAD_VALUE;
         }
         std::shared_ptr<DCameraSettings> setting = std::make_shared<DCameraSettings>();
@@ -110,8 +141,76 @@ int32_t DCameraMetadataSettingCmd::Unmarshal(const std::string& jsonStr)
         setting->value_ = settingValue->valuestring;
         value_.push_back(setting);
     }
-    cJSON_Delete(rootValue);
     return DCAMERA_OK;
 }
+
+int32_t DCameraMetadataSettingCmd::MarshalBinary(std::vector<uint8_t>& data)
+{
+    data.assign(BINARY_HEADER_LEN, 0);
+    PutBigEndian<uint32_t>(data.data() + MAGIC_OFFSET, BINARY_MAGIC);
+    PutBigEndian<uint16_t>(data.data() + VERSION_OFFSET, BINARY_VERSION);
+    PutBigEndian<uint16_t>(data.data() + HEADER_LEN_OFFSET, static_cast<uint16_t>(BINARY_HEADER_LEN));
+    PutRecord(data, BINARY_TAG_TYPE, type_);
+    PutRecord(data, BINARY_TAG_DHID, dhId_);
+    PutRecord(data, BINARY_TAG_COMMAND, command_);
+    for (auto iter = value_.begin(); iter != value_.end(); iter++) {
+        if ((*iter) == nullptr) {
+            data.clear();
+            return DCAMERA_BAD_VALUE;
+        }
+        PutSettingRecord(data, *(*iter));
+    }
+    return DCAMERA_OK;
+}
+
+int32_t DCameraMetadataSettingCmd::UnmarshalBinary(const uint8_t *data, size_t length)
+{
+    CHECK_AND_RETURN_RET_LOG(!IsBinary(data, length), DCAMERA_BAD_VALUE, "metadata setting is not binary.");
+    size_t offset = GetBigEndian<uint16_t>(data + HEADER_LEN_OFFSET);
+    CHECK_AND_RETURN_RET_LOG(offset < BINARY_HEADER_LEN || offset > length, DCAMERA_BAD_VALUE,
+        "metadata setting headerLen %{public}zu error.", offset);
+    bool hasType = false;
+    bool hasDhId = false;
+    bool hasCommand = false;
+    while (offset < length) {
+        CHECK_AND_RETURN_RET_LOG(length - offset < BINARY_RECORD_HEADER_LEN, DCAMERA_BAD_VALUE,
+            "metadata setting record at %{public}zu truncated.", offset);
+        uint16_t tag = GetBigEndian<uint16_t>(data + offset);
+        size_t recordLen = GetBigEndian<uint32_t>(data + offset + RECORD_LEN_OFFSET);
+        offset += BINARY_RECORD_HEADER_LEN;
+        CHECK_AND_RETURN_RET_LOG(recordLen > length - offset, DCAMERA_BAD_VALUE,
+            "metadata setting record length %{public}zu error.", recordLen);
+        const char *value = reinterpret_cast<const char *>(data + offset);
+        if (tag == BINARY_TAG_TYPE) {
+            type_.assign(value, recordLen);
+            hasType = true;
+        } else if (tag == BINARY_TAG_DHID) {
+            dhId_.assign(value, recordLen);
+            hasDhId = true;
+        } else if (tag == BINARY_TAG_COMMAND) {
+            command_.assign(value, recordLen);
+            hasCommand = true;
+        } else if (tag == BINARY_TAG_SETTING) {
+            CHECK_AND_RETURN_RET_LOG(recordLen < SETTING_TYPE_LEN, DCAMERA_BAD_VALUE,
+                "metadata setting value length %{public}zu error.", recordLen);
+            std::shared_ptr<DCameraSettings> setting = std::make_shared<DCameraSettings>();
+            setting->type_ = static_cast<DCSettingsType>(GetBigEndian<int32_t>(data + offset));
+            setting->value_.assign(value + SETTING_TYPE_LEN, recordLen - SETTING_TYPE_LEN);
+            value_.push_back(setting);
+        }
+        offset += recordLen;
+    }
+    if (!hasType || !hasDhId || !hasCommand || value_.empty()) {
+        DHLOGE("metadata setting binary misses a field.");
+        return DCAMERA_BAD_VALUE;
+    }
+    return DCAMERA_OK;
+}
+
+bool DCameraMetadataSettingCmd::IsBinary(const uint8_t *data, size_t length)
+{
+    return data != nullptr && length >= BINARY_HEADER_LEN &&
+        GetBigEndian<uint32_t>(data + MAGIC_OFFSET) == BINARY_MAGIC;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
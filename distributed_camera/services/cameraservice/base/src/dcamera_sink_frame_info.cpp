@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,12 +14,122 @@
  */
 
 #include "dcamera_sink_frame_info.h"
+
+#include "dcamera_byte_order.h"
+#include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 #include "cJSON.h"
+#include "securec.h"
 
 namespace OHOS {
 namespace DistributedHardware {
+namespace {
+constexpr size_t MAGIC_OFFSET = 0;
+constexpr size_t VERSION_OFFSET = 4;
+constexpr size_t HEADER_LEN_OFFSET = 6;
+constexpr size_t TYPE_OFFSET = 8;
+constexpr size_t ENCODER_PRESET_OFFSET = 9;
+constexpr size_t INDEX_OFFSET = 12;
+constexpr size_t PTS_OFFSET = 16;
+constexpr size_t START_ENCODE_OFFSET = 24;
+constexpr size_t FINISH_ENCODE_OFFSET = 32;
+constexpr size_t SEND_OFFSET = 40;
+constexpr size_t RAW_TIME_OFFSET = 48;
+constexpr size_t IMU_LEN_OFFSET = 56;
+constexpr size_t IMU_EXPOSURE_OFFSET = 0;
+constexpr size_t IMU_ACC_COUNT_OFFSET = 4;
+constexpr size_t IMU_GYRO_COUNT_OFFSET = 8;
+constexpr size_t IMU_SAMPLE_AXIS_OFFSET = 8;
+constexpr size_t IMU_AXIS_LEN = 4;
+const char *IMU_EXPOSURE_TIME = "exposuretime";
+const char *IMU_ACC_DATA = "imuAccData";
+const char *IMU_GYRO_DATA = "imuGyroData";
+const char *IMU_TIMESTAMP = "timestamp";
+const char *IMU_AXIS_NAMES[IMU_AXIS_NUM] = { "x", "y", "z" };
+
+uint32_t FloatToBits(float value)
+{
+    uint32_t bits = 0;
+    static_assert(sizeof(bits) == sizeof(value), "float is not 32 bits");
+    (void)memcpy_s(&bits, sizeof(bits), &value, sizeof(value));
+    return bits;
+}
+
+float BitsToFloat(uint32_t bits)
+{
+    float value = 0.0f;
+    (void)memcpy_s(&value, sizeof(value), &bits, sizeof(bits));
+    return value;
+}
+
+cJSON *CreateImuArray(const std::vector<ImuSample>& samples)
+{
+    cJSON *array = cJSON_CreateArray();
+    if (array == nullptr) {
+        return nullptr;
+    }
+    for (const auto& sample : samples) {
+        cJSON *item = cJSON_CreateObject();
+        if (item == nullptr) {
+            continue;
+        }
+        cJSON_AddNumberToObject(item, IMU_TIMESTAMP, static_cast<double>(sample.timeStamp));
+        for (size_t i = 0; i < IMU_AXIS_NUM; i++) {
+            cJSON_AddNumberToObject(item, IMU_AXIS_NAMES[i], static_cast<double>(sample.data[i]));
+        }
+        cJSON_AddItemToArray(array, item);
+    }
+    return array;
+}
+
+void ParseImuArray(const cJSON *array, std::vector<ImuSample>& samples)
+{
+    samples.clear();
+    if (array == nullptr || !cJSON_IsArray(array)) {
+        return;
+    }
+    samples.reserve(static_cast<size_t>(cJSON_GetArraySize(array)));
+    const cJSON *item = nullptr;
+    cJSON_ArrayForEach(item, array) {
+        const cJSON *timeStamp = cJSON_GetObjectItemCaseSensitive(item, IMU_TIMESTAMP);
+        if (timeStamp == nullptr || !cJSON_IsNumber(timeStamp)) {
+            continue;
+        }
+        ImuSample sample;
+        sample.timeStamp = static_cast<int64_t>(timeStamp->valuedouble);
+        for (size_t i = 0; i < IMU_AXIS_NUM; i++) {
+            const cJSON *axis = cJSON_GetObjectItemCaseSensitive(item, IMU_AXIS_NAMES[i]);
+            sample.data[i] = (axis != nullptr && cJSON_IsNumber(axis)) ? static_cast<float>(axis->valuedouble) : 0.0f;
+        }
+        samples.push_back(sample);
+    }
+}
+
+void PutImuSamples(uint8_t *data, const std::vector<ImuSample>& samples)
+{
+    for (const auto& sample : samples) {
+        PutBigEndian<int64_t>(data, sample.timeStamp);
+        for (size_t i = 0; i < IMU_AXIS_NUM; i++) {
+            PutBigEndian<uint32_t>(data + IMU_SAMPLE_AXIS_OFFSET + i * IMU_AXIS_LEN, FloatToBits(sample.data[i]));
+        }
+        data += DCameraSinkFrameInfo::BINARY_IMU_SAMPLE_LEN;
+    }
+}
+
+void GetImuSamples(const uint8_t *data, size_t count, std::vector<ImuSample>& samples)
+{
+    samples.resize(count);
+    for (auto& sample : samples) {
+        sample.timeStamp = GetBigEndian<int64_t>(data);
+        for (size_t i = 0; i < IMU_AXIS_NUM; i++) {
+            sample.data[i] = BitsToFloat(GetBigEndian<uint32_t>(data + IMU_SAMPLE_AXIS_OFFSET + i * IMU_AXIS_LEN));
+        }
+        data += DCameraSinkFrameInfo::BINARY_IMU_SAMPLE_LEN;
+    }
+}
+}
+
 void DCameraSinkFrameInfo::Marshal(std::string& jsonStr)
 {
     cJSON *frameInfo = cJSON_CreateObject();
@@ -34,7 +144,9 @@ void DCameraSinkFrameInfo::Marshal(std::string& jsonStr)
     cJSON_AddNumberToObject(frameInfo, FRAME_INFO_SENDT.c_str(), sendT_);
     cJSON_AddStringToObject(frameInfo, FRAME_INFO_VERSION.c_str(), ver_.c_str());
     cJSON_AddStringToObject(frameInfo, RAW_TIME.c_str(), rawTime_.c_str());
-    cJSON_AddStringToObject(frameInfo, IMU_INFO.c_str(), imuInfo_.c_str());
+    std::string imuInfo;
+    MarshalImuJson(imuInfo);
+    cJSON_AddStringToObject(frameInfo, IMU_INFO.c_str(), imuInfo.c_str());
 
     char *data = cJSON_Print(frameInfo);
     if (data == nullptr) {
@@ -87,8 +199,8 @@ int32_t DCameraSinkFrameInfo::Unmarshal(const std::string& jsonStr)
     ver_ = std::string(ver->valuestring);
 
     cJSON *imu = cJSON_GetObjectItemCaseSensitive(rootValue, IMU_INFO.c_str());
-    if (imu != nullptr && cJSON_IsString(imu)) {
-        imuInfo_ = std::string(imu->valuestring);
+    if (imu != nullptr && cJSON_IsString(imu) && UnmarshalImuJson(std::string(imu->valuestring)) != DCAMERA_OK) {
+        DHLOGW("imuInfo parse fail, drop the imu data.");
     }
 
     cJSON *rawTime = cJSON_GetObjectItemCaseSensitive(rootValue, RAW_TIME.c_str());
@@ -104,5 +216,165 @@ int32_t DCameraSinkFrameInfo::Unmarshal(const std::string& jsonStr)
     cJSON_Delete(rootValue);
     return DCAMERA_OK;
 }
+
+void DCameraSinkFrameInfo::MarshalImuJson(std::string& jsonStr) const
+{
+    jsonStr.clear();
+    if (accData_.empty() && gyroData_.empty()) {
+        return;
+    }
+    cJSON *imuInfo = cJSON_CreateObject();
+    if (imuInfo == nullptr) {
+        return;
+    }
+    cJSON_AddNumberToObject(imuInfo, IMU_EXPOSURE_TIME, exposureTime_);
+    cJSON *accArray = CreateImuArray(accData_);
+    if (accArray != nullptr) {
+        cJSON_AddItemToObject(imuInfo, IMU_ACC_DATA, accArray);
+    }
+    cJSON *gyroArray = CreateImuArray(gyroData_);
+    if (gyroArray != nullptr) {
+        cJSON_AddItemToObject(imuInfo, IMU_GYRO_DATA, gyroArray);
+    }
+    char *data = cJSON_PrintUnformatted(imuInfo);
+    if (data != nullptr) {
+        jsonStr = std::string(data);
+        cJSON_free(data);
+    }
+    cJSON_Delete(imuInfo);
+}
+
+int32_t DCameraSinkFrameInfo::UnmarshalImuJson(const std::string& jsonStr)
+{
+    accData_.clear();
+    gyroData_.clear();
+    exposureTime_ = 0;
+    if (jsonStr.empty()) {
+        return DCAMERA_OK;
+    }
+    cJSON *imuInfo = cJSON_Parse(jsonStr.c_str());
+    CHECK_NULL_RETURN((imuInfo == nullptr), DCAMERA_BAD_VALUE);
+    cJSON *exposure = cJSON_GetObjectItemCaseSensitive(imuInfo, IMU_EXPOSURE_TIME);
+    if (exposure != nullptr && cJSON_IsNumber(exposure)) {
+        exposureTime_ = static_cast<uint32_t>(exposure->valuedouble);
+    }
+    ParseImuArray(cJSON_GetObjectItemCaseSensitive(imuInfo, IMU_ACC_DATA), accData_);
+    ParseImuArray(cJSON_GetObjectItemCaseSensitive(imuInfo, IMU_GYRO_DATA), gyroData_);
+    cJSON_Delete(imuInfo);
+    return DCAMERA_OK;
+}
+
+size_t DCameraSinkFrameInfo::GetImuBinarySize() const
+{
+    if (accData_.empty() && gyroData_.empty()) {
+        return 0;
+    }
+    return BINARY_IMU_HEADER_LEN + (accData_.size() + gyroData_.size()) * BINARY_IMU_SAMPLE_LEN;
+}
+
+void DCameraSinkFrameInfo::MarshalImuBinary(uint8_t *data) const
+{
+    PutBigEndian<uint32_t>(data + IMU_EXPOSURE_OFFSET, exposureTime_);
+    PutBigEndian<uint32_t>(data + IMU_ACC_COUNT_OFFSET, static_cast<uint32_t>(accData_.size()));
+    PutBigEndian<uint32_t>(data + IMU_GYRO_COUNT_OFFSET, static_cast<uint32_t>(gyroData_.size()));
+    data += BINARY_IMU_HEADER_LEN;
+    PutImuSamples(data, accData_);
+    PutImuSamples(data + accData_.size() * BINARY_IMU_SAMPLE_LEN, gyroData_);
+}
+
+int32_t DCameraSinkFrameInfo::UnmarshalImuBinary(const uint8_t *data, size_t length)
+{
+    accData_.clear();
+    gyroData_.clear();
+    exposureTime_ = 0;
+    if (length == 0) {
+        return DCAMERA_OK;
+    }
+    CHECK_AND_RETURN_RET_LOG(length < BINARY_IMU_HEADER_LEN, DCAMERA_BAD_VALUE,
+        "imu data length %{public}zu error.", length);
+    size_t accCount = GetBigEndian<uint32_t>(data + IMU_ACC_COUNT_OFFSET);
+    size_t gyroCount = GetBigEndian<uint32_t>(data + IMU_GYRO_COUNT_OFFSET);
+    size_t sampleLen = length - BINARY_IMU_HEADER_LEN;
+    if (accCount > sampleLen / BINARY_IMU_SAMPLE_LEN ||
+        gyroCount != sampleLen / BINARY_IMU_SAMPLE_LEN - accCount || sampleLen % BINARY_IMU_SAMPLE_LEN != 0) {
+        DHLOGE("imu data acc %{public}zu gyro %{public}zu length %{public}zu error.", accCount, gyroCount, length);
+        return DCAMERA_BAD_VALUE;
+    }
+    exposureTime_ = GetBigEndian<uint32_t>(data + IMU_EXPOSURE_OFFSET);
+    data += BINARY_IMU_HEADER_LEN;
+    GetImuSamples(data, accCount, accData_);
+    GetImuSamples(data + accCount * BINARY_IMU_SAMPLE_LEN, gyroCount, gyroData_);
+    return DCAMERA_OK;
+}
+
+size_t DCameraSinkFrameInfo::GetBinarySize() const
+{
+    return BINARY_HEADER_LEN + GetImuBinarySize();
+}
+
+int32_t DCameraSinkFrameInfo::MarshalBinary(uint8_t *data, size_t capacity, size_t& length) const
+{
+    size_t binarySize = GetBinarySize();
+    if (data == nullptr || capacity < binarySize || binarySize > DCAMERA_MAX_RECV_EXT_LEN) {
+        DHLOGE("frame info binary capacity %{public}zu is not enough for %{public}zu.", capacity, binarySize);
+        return DCAMERA_BAD_VALUE;
+    }
+    PutBigEndian<uint32_t>(data + MAGIC_OFFSET, BINARY_MAGIC);
+    PutBigEndian<uint16_t>(data + VERSION_OFFSET, BINARY_VERSION);
+    PutBigEndian<uint16_t>(data + HEADER_LEN_OFFSET, static_cast<uint16_t>(BINARY_HEADER_LEN));
+    PutBigEndian<int8_t>(data + TYPE_OFFSET, type_);
+    data[ENCODER_PRESET_OFFSET] = encoderPreset_;
+    data[TYPE_OFFSET + 2] = 0;
+    data[TYPE_OFFSET + 3] = 0;
+    PutBigEndian<int32_t>(data + INDEX_OFFSET, index_);
+    PutBigEndian<int64_t>(data + PTS_OFFSET, pts_);
+    PutBigEndian<int64_t>(data + START_ENCODE_OFFSET, startEncodeT_);
+    PutBigEndian<int64_t>(data + FINISH_ENCODE_OFFSET, finishEncodeT_);
+    PutBigEndian<int64_t>(data + SEND_OFFSET, sendT_);
+    PutBigEndian<int64_t>(data + RAW_TIME_OFFSET, rawTimeUs_);
+    PutBigEndian<uint32_t>(data + IMU_LEN_OFFSET, static_cast<uint32_t>(binarySize - BINARY_HEADER_LEN));
+    if (binarySize > BINARY_HEADER_LEN) {
+        MarshalImuBinary(data + BINARY_HEADER_LEN);
+    }
+    length = binarySize;
+    return DCAMERA_OK;
+}
+
+int32_t DCameraSinkFrameInfo::UnmarshalBinary(const uint8_t *data, size_t length)
+{
+    CHECK_AND_RETURN_RET_LOG(!IsBinary(data, length), DCAMERA_BAD_VALUE, "frame info is not binary.");
+    uint16_t version = GetBigEndian<uint16_t>(data + VERSION_OFFSET);
+    size_t headerLen = GetBigEndian<uint16_t>(data + HEADER_LEN_OFFSET);
+    if (version < BINARY_VERSION || headerLen < BINARY_HEADER_LEN || headerLen > length) {
+        DHLOGE("frame info binary version %{public}u headerLen %{public}zu length %{public}zu error.",
+            version, headerLen, length);
+        return DCAMERA_BAD_VALUE;
+    }
+    size_t imuLen = GetBigEndian<uint32_t>(data + IMU_LEN_OFFSET);
+    CHECK_AND_RETURN_RET_LOG(imuLen > length - headerLen, DCAMERA_BAD_VALUE,
+        "frame info imu length %{public}zu error.", imuLen);
+    type_ = GetBigEndian<int8_t>(data + TYPE_OFFSET);
+    encoderPreset_ = data[ENCODER_PRESET_OFFSET];
+    index_ = GetBigEndian<int32_t>(data + INDEX_OFFSET);
+    pts_ = GetBigEndian<int64_t>(data + PTS_OFFSET);
+    startEncodeT_ = GetBigEndian<int64_t>(data + START_ENCODE_OFFSET);
+    finishEncodeT_ = GetBigEndian<int64_t>(data + FINISH_ENCODE_OFFSET);
+    sendT_ = GetBigEndian<int64_t>(data + SEND_OFFSET);
+    rawTimeUs_ = GetBigEndian<int64_t>(data + RAW_TIME_OFFSET);
+    if (version == BINARY_VERSION_JSON_IMU) {
+        std::string imuInfo(reinterpret_cast<const char *>(data + headerLen), imuLen);
+        if (UnmarshalImuJson(imuInfo) != DCAMERA_OK) {
+            DHLOGW("imuInfo parse fail, drop the imu data.");
+        }
+        return DCAMERA_OK;
+    }
+    return UnmarshalImuBinary(data + headerLen, imuLen);
+}
+
+bool DCameraSinkFrameInfo::IsBinary(const uint8_t *data, size_t length)
+{
+    return data != nullptr && length >= BINARY_HEADER_LEN &&
+        GetBigEndian<uint32_t>(data + MAGIC_OFFSET) == BINARY_MAGIC;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -31,6 +31,17 @@ public:
     void TearDown();
 };
 
+static const std::string TEST_CAPTURE_INFO_CMD_JSON_WITHOUT_HDR = R"({
+    "Type": "OPERATION",
+    "dhId": "camera_0",
+    "Command": "CAPTURE",
+    "Value": [
+        {"Width": 1920, "Height": 1080, "Format": 6, "DataSpace": 1,
+        "IsCapture": true, "EncodeType": 2, "StreamType": 1,
+        "CaptureSettings": [{"SettingType": 1, "SettingValue": "TestSetting"}]}
+    ]
+})";
+
 static const std::string TEST_CAPTURE_INFO_CMD_JSON_LACK_TYPE = R"({
     "dhId": "camera_0",
     "Command": "CAPTURE",
@@ -531,5 +542,24 @@ HWTEST_F(DCameraCaptureInfoCmdlTest, Unmarshal_004, TestSize.Level1)
     EXPECT_EQ(DCAMERA_BAD_VALUE, ret);
 }
 
+HWTEST_F(DCameraCaptureInfoCmdlTest, Unmarshal_005, TestSize.Level1)
+{
+    DCameraCaptureInfoCmd cmd;
+    int32_t ret = cmd.Unmarshal(TEST_CAPTURE_INFO_CMD_JSON_WITHOUT_HDR);
+    EXPECT_EQ(DCAMERA_OK, ret);
+    ASSERT_EQ(1u, cmd.value_.size());
+    EXPECT_EQ(DCAMERA_HDR_NONE, cmd.value_[0]->hdrType_);
+
+    cmd.value_[0]->hdrType_ = DCAMERA_HDR_PQ;
+    std::string jsonStr;
+    ret = cmd.Marshal(jsonStr);
+    EXPECT_EQ(DCAMERA_OK, ret);
+    DCameraCaptureInfoCmd parsedCmd;
+    ret = parsedCmd.Unmarshal(jsonStr);
+    EXPECT_EQ(DCAMERA_OK, ret);
+    ASSERT_EQ(1u, parsedCmd.value_.size());
+    EXPECT_EQ(DCAMERA_HDR_PQ, parsedCmd.value_[0]->hdrType_);
+}
+
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,6 +17,7 @@
 #include <memory>
 
 #include "dcamera_channel_info_cmd.h"
+#include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 
 using namespace testing::ext;
@@ -31,6 +32,13 @@ public:
     void TearDown();
 };
 
+static const std::string TEST_CHANNEL_INFO_CMD_JSON_NO_FRAME_INFO_FORMAT = R"({
+    "Type": "OPERATION",
+    "dhId": "camrea_0",
+    "Command": "CHANNEL_NEG",
+    "Value": {"SourceDevId": "TestDevId", "Detail": [{"DataSessionFlag": "TestFlag", "StreamType": 1}]}
+})";
+
 static const std::string TEST_CHANNEL_INFO_CMD_JSON_LACK_TYPE = R"({
     "dhId": "camrea_0",
     "Command": "CHANNEL_NEG",
@@ -217,5 +225,51 @@ HWTEST_F(DCameraChannelInfoCmdlTest, Unmarshal_002, TestSize.Level1)
     ret = cmd.Unmarshal(TEST_CHANNEL_INFO_CMD_JSON_DETAIL_BODY_TYPE_EXCEPTION);
     EXPECT_EQ(DCAMERA_BAD_VALUE, ret);
 }
+
+/**
+ * @tc.name: Unmarshal_003.
+ * @tc.desc: Verify the frame info format survives marshal and defaults to json for old peers.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraChannelInfoCmdlTest, Unmarshal_003, TestSize.Level1)
+{
+    DCameraChannelInfoCmd oldCmd;
+    int32_t ret = oldCmd.Unmarshal(TEST_CHANNEL_INFO_CMD_JSON_NO_FRAME_INFO_FORMAT);
+    EXPECT_EQ(DCAMERA_OK, ret);
+    ASSERT_NE(nullptr, oldCmd.value_);
+    EXPECT_EQ(DCAMERA_FRAME_INFO_FORMAT_JSON, oldCmd.value_->frameInfoFormat_);
+    EXPECT_EQ(DCAMERA_CONTROL_FORMAT_JSON, oldCmd.value_->controlFormat_);
+    EXPECT_FALSE(oldCmd.value_->sessionMux_);
+
+    DCameraChannelInfoCmd cmd;
+    cmd.type_ = "OPERATION";
+    cmd.dhId_ = "camera_0";
+    cmd.command_ = "CHANNEL_NEG";
+    cmd.value_ = std::make_shared<DCameraChannelInfo>();
+    cmd.value_->sourceDevId_ = "TestDevId";
+    cmd.value_->detail_.push_back(DCameraChannelDetail("TestFlag", CONTINUOUS_FRAME));
+    cmd.value_->frameInfoFormat_ = DCAMERA_FRAME_INFO_FORMAT_BINARY;
+    cmd.value_->controlFormat_ = DCAMERA_CONTROL_FORMAT_BINARY;
+    cmd.value_->sessionMux_ = true;
+    std::string jsonStr;
+    ret = cmd.Marshal(jsonStr);
+    EXPECT_EQ(DCAMERA_OK, ret);
+
+    DCameraChannelInfoCmd parsed;
+    ret = parsed.Unmarshal(jsonStr);
+    EXPECT_EQ(DCAMERA_OK, ret);
+    ASSERT_NE(nullptr, parsed.value_);
+    EXPECT_EQ(DCAMERA_FRAME_INFO_FORMAT_BINARY, parsed.value_->frameInfoFormat_);
+    EXPECT_EQ(DCAMERA_CONTROL_FORMAT_BINARY, parsed.value_->controlFormat_);
+    EXPECT_TRUE(parsed.value_->sessionMux_);
+
+    cmd.value_->frameInfoFormat_ = DCAMERA_FRAME_INFO_FORMAT_JSON;
+    ret = cmd.Marshal(jsonStr);
+    EXPECT_EQ(DCAMERA_OK, ret);
+    ret = parsed.Unmarshal(jsonStr);
+    EXPECT_EQ(DCAMERA_OK, ret);
+    EXPECT_EQ(DCAMERA_FRAME_INFO_FORMAT_JSON, parsed.value_->frameInfoFormat_);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
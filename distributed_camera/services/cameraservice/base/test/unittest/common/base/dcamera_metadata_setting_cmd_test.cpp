@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <vector>
 
 #include "dcamera_metadata_setting_cmd.h"
 #include "distributed_camera_errno.h"
@@ -187,5 +188,102 @@ HWTEST_F(DCameraMetadataSettingCmdTest, Unmarshal_002, TestSize.Level1)
     ret = cmd.Unmarshal(TEST_METADATA_SETTING_CMD_JSON_VALUE_BODY_VALUE_EXCEPTION);
     EXPECT_EQ(DCAMERA_BAD_VALUE, ret);
 }
+
+/**
+ * @tc.name: Unmarshal_003.
+ * @tc.desc: Verify MetadataSettingCmd reads a tree parsed by the caller and leaves it to the caller.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraMetadataSettingCmdTest, Unmarshal_003, TestSize.Level1)
+{
+    DCameraMetadataSettingCmd cmd;
+    cmd.type_ = "MESSAGE";
+    cmd.dhId_ = "camera_0";
+    cmd.command_ = "UPDATE_METADATA";
+    std::shared_ptr<DCameraSettings> setting = std::make_shared<DCameraSettings>();
+    setting->type_ = UPDATE_METADATA;
+    setting->value_ = "TestSetting";
+    cmd.value_.push_back(setting);
+    std::string jsonStr;
+    EXPECT_EQ(DCAMERA_OK, cmd.Marshal(jsonStr));
+
+    std::vector<char> data(jsonStr.begin(), jsonStr.end());
+    cJSON *rootValue = cJSON_ParseWithLength(data.data(), data.size());
+    ASSERT_NE(nullptr, rootValue);
+    DCameraMetadataSettingCmd result;
+    EXPECT_EQ(DCAMERA_OK, result.Unmarshal(rootValue));
+    EXPECT_EQ(cmd.dhId_, result.dhId_);
+    ASSERT_EQ(1U, result.value_.size());
+    EXPECT_EQ(setting->value_, result.value_[0]->value_);
+
+    DCameraMetadataSettingCmd again;
+    EXPECT_EQ(DCAMERA_OK, again.Unmarshal(rootValue));
+    cJSON_Delete(rootValue);
+}
+/**
+ * @tc.name: UnmarshalBinary_001.
+ * @tc.desc: Verify MetadataSettingCmd binary round trip skips unknown records.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraMetadataSettingCmdTest, UnmarshalBinary_001, TestSize.Level1)
+{
+    DCameraMetadataSettingCmd cmd;
+    cmd.type_ = "MESSAGE";
+    cmd.dhId_ = "camera_0";
+    cmd.command_ = "UPDATE_METADATA";
+    std::shared_ptr<DCameraSettings> setting = std::make_shared<DCameraSettings>();
+    setting->type_ = UPDATE_METADATA;
+    setting->value_ = std::string("Test\0Setting", 12);
+    cmd.value_.push_back(setting);
+    std::vector<uint8_t> data;
+    EXPECT_EQ(DCAMERA_OK, cmd.MarshalBinary(data));
+    EXPECT_TRUE(DCameraMetadataSettingCmd::IsBinary(data.data(), data.size()));
+    // A record of a newer peer is appended, it has to be skipped.
+    std::vector<uint8_t> unknown = { 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02 };
+    data.insert(data.end(), unknown.begin(), unknown.end());
+
+    DCameraMetadataSettingCmd result;
+    EXPECT_EQ(DCAMERA_OK, result.UnmarshalBinary(data.data(), data.size()));
+    EXPECT_EQ(cmd.type_, result.type_);
+    EXPECT_EQ(cmd.dhId_, result.dhId_);
+    EXPECT_EQ(cmd.command_, result.command_);
+    ASSERT_EQ(1U, result.value_.size());
+    EXPECT_EQ(UPDATE_METADATA, result.value_[0]->type_);
+    EXPECT_EQ(setting->value_, result.value_[0]->value_);
+}
+
+/**
+ * @tc.name: UnmarshalBinary_002.
+ * @tc.desc: Verify MetadataSettingCmd refuses truncated binary and json text.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraMetadataSettingCmdTest, UnmarshalBinary_002, TestSize.Level1)
+{
+    DCameraMetadataSettingCmd cmd;
+    cmd.type_ = "MESSAGE";
+    cmd.dhId_ = "camera_0";
+    cmd.command_ = "METADATA_RESULT";
+    std::vector<uint8_t> data;
+    EXPECT_EQ(DCAMERA_OK, cmd.MarshalBinary(data));
+    DCameraMetadataSettingCmd noSetting;
+    EXPECT_EQ(DCAMERA_BAD_VALUE, noSetting.UnmarshalBinary(data.data(), data.size()));
+
+    std::shared_ptr<DCameraSettings> setting = std::make_shared<DCameraSettings>();
+    setting->type_ = METADATA_RESULT;
+    setting->value_ = "TestSetting";
+    cmd.value_.push_back(setting);
+    EXPECT_EQ(DCAMERA_OK, cmd.MarshalBinary(data));
+    DCameraMetadataSettingCmd truncated;
+    EXPECT_EQ(DCAMERA_BAD_VALUE, truncated.UnmarshalBinary(data.data(), data.size() - 1));
+
+    const std::string &jsonStr = TEST_METADATA_SETTING_CMD_JSON_LACK_TYPE;
+    EXPECT_FALSE(DCameraMetadataSettingCmd::IsBinary(reinterpret_cast<const uint8_t *>(jsonStr.c_str()),
+        jsonStr.length()));
+    cmd.value_.push_back(nullptr);
+    EXPECT_EQ(DCAMERA_BAD_VALUE, cmd.MarshalBinary(data));
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "cJSON.h"
+
+#include "dcamera_capture_info_cmd.h"
+#include "dcamera_channel_info_cmd.h"
+#include "dcamera_event_cmd.h"
+#include "dcamera_info_cmd.h"
+#include "dcamera_metadata_setting_cmd.h"
+#include "dcamera_open_info_cmd.h"
+#include "dcamera_sink_frame_info.h"
+
+using namespace testing::ext;
+
+namespace {
+std::atomic<bool> g_isCounting { false };
+std::atomic<size_t> g_allocBytes { 0 };
+
+void *CountedMalloc(size_t size)
+{
+    if (g_isCounting.load(std::memory_order_relaxed)) {
+        g_allocBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+    return malloc(size == 0 ? 1 : size);
+}
+}
+
+// Counts the allocations of the parsers, cJSON ones go through the hooks set in SetUpTestCase.
+void *operator new(size_t size)
+{
+    void *ptr = CountedMalloc(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+// A peer controls these payloads, the budgets are far above a sane parser and far below a blowup.
+constexpr int64_t PARSE_BUDGET_US = 500000;
+constexpr size_t ALLOC_BUDGET_FACTOR = 64;
+constexpr size_t ALLOC_BUDGET_FLOOR = 64 * 1024;
+constexpr size_t SMALL_COUNT = 1024;
+constexpr size_t LARGE_COUNT = 8 * SMALL_COUNT;
+// Linear cost grows 8 times from the small to the large input, a quadratic one 64 times.
+constexpr int64_t MAX_SCALE_RATIO = 24;
+constexpr int64_t SCALE_FLOOR_US = 2000;
+constexpr int32_t REPEAT_TIMES = 3;
+constexpr size_t NESTING_DEPTH = 900;
+constexpr size_t LONG_STRING_LEN = 1024 * 1024;
+
+using ParseFunc = std::function<void(const std::string&)>;
+
+struct ParseCost {
+    int64_t costUs = 0;
+    size_t allocBytes = 0;
+};
+
+const std::vector<std::pair<std::string, ParseFunc>> PARSERS = {
+    { "CaptureInfo", [](const std::string& input) { DCameraCaptureInfoCmd cmd; cmd.Unmarshal(input); } },
+    { "ChannelInfo", [](const std::string& input) { DCameraChannelInfoCmd cmd; cmd.Unmarshal(input); } },
+    { "Event", [](const std::string& input) { DCameraEventCmd cmd; cmd.Unmarshal(input); } },
+    { "Info", [](const std::string& input) { DCameraInfoCmd cmd; cmd.Unmarshal(input); } },
+    { "MetadataSetting", [](const std::string& input) { DCameraMetadataSettingCmd cmd; cmd.Unmarshal(input); } },
+    { "OpenInfo", [](const std::string& input) { DCameraOpenInfoCmd cmd; cmd.Unmarshal(input); } },
+    { "SinkFrameInfo", [](const std::string& input) { DCameraSinkFrameInfo info; info.Unmarshal(input); } },
+};
+}
+
+class DCameraParserCostTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    static ParseCost MeasureParse(const ParseFunc& parse, const std::string& input);
+    static void ExpectInBudget(const std::string& name, const std::string& input);
+    static std::string BuildCaptureInfo(size_t count);
+    static std::string BuildHeader(const std::string& value);
+};
+
+void DCameraParserCostTest::SetUpTestCase(void)
+{
+    cJSON_Hooks hooks = { CountedMalloc, free };
+    cJSON_InitHooks(&hooks);
+}
+
+void DCameraParserCostTest::TearDownTestCase(void)
+{
+    cJSON_InitHooks(nullptr);
+}
+
+void DCameraParserCostTest::SetUp(void)
+{
+}
+
+void DCameraParserCostTest::TearDown(void)
+{
+}
+
+ParseCost DCameraParserCostTest::MeasureParse(const ParseFunc& parse, const std::string& input)
+{
+    ParseCost best;
+    for (int32_t i = 0; i < REPEAT_TIMES; i++) {
+        g_allocBytes = 0;
+        g_isCounting = true;
+        auto start = std::chrono::steady_clock::now();
+        parse(input);
+        auto end = std::chrono::steady_clock::now();
+        g_isCounting = false;
+        int64_t costUs = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        if (i == 0 || costUs < best.costUs) {
+            best.costUs = costUs;
+        }
+        best.allocBytes = g_allocBytes.load();
+    }
+    return best;
+}
+
+void DCameraParserCostTest::ExpectInBudget(const std::string& name, const std::string& input)
+{
+    for (const auto& parser : PARSERS) {
+        ParseCost cost = MeasureParse(parser.second, input);
+        EXPECT_LE(cost.costUs, PARSE_BUDGET_US) << parser.first << " on " << name;
+        EXPECT_LE(cost.allocBytes, input.size() * ALLOC_BUDGET_FACTOR + ALLOC_BUDGET_FLOOR) <<
+            parser.first << " on " << name;
+    }
+}
+
+std::string DCameraParserCostTest::BuildCaptureInfo(size_t count)
+{
+    std::string value = "[";
+    for (size_t i = 0; i < count; i++) {
+        value += (i == 0 ? "" : ",");
+        value += R"({"Width":1920,"Height":1080,"Format":3,"DataSpace":8,"IsCapture":true,"EncodeType":1,)"
+            R"("StreamType":1,"CaptureSettings":[{"SettingType":1,"SettingValue":"dGVzdA=="}]})";
+    }
+    value += "]";
+    return BuildHeader(value);
+}
+
+std::string DCameraParserCostTest::BuildHeader(const std::string& value)
+{
+    return R"({"Type":"OPERATION","dhId":"camera_0","Command":"CAPTURE","Value":)" + value + "}";
+}
+
+/**
+ * @tc.name: dcamera_parser_cost_test_001
+ * @tc.desc: Verify the capture info parser cost grows linearly with the number of capture infos.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraParserCostTest, dcamera_parser_cost_test_001, TestSize.Level1)
+{
+    std::string smallInput = BuildCaptureInfo(SMALL_COUNT);
+    std::string largeInput = BuildCaptureInfo(LARGE_COUNT);
+    ParseFunc parse = [](const std::string& input) { DCameraCaptureInfoCmd cmd; cmd.Unmarshal(input); };
+    ParseCost smallCost = MeasureParse(parse, smallInput);
+    ParseCost largeCost = MeasureParse(parse, largeInput);
+    EXPECT_LE(largeCost.costUs, PARSE_BUDGET_US);
+    EXPECT_LE(largeCost.costUs, smallCost.costUs * MAX_SCALE_RATIO + SCALE_FLOOR_US);
+    EXPECT_LE(largeCost.allocBytes, largeInput.size() * ALLOC_BUDGET_FACTOR + ALLOC_BUDGET_FLOOR);
+}
+
+/**
+ * @tc.name: dcamera_parser_cost_test_002
+ * @tc.desc: Verify deep nesting and long strings stay within the time and allocation budgets.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraParserCostTest, dcamera_parser_cost_test_002, TestSize.Level1)
+{
+    std::string nested = std::string(NESTING_DEPTH, '[') + std::string(NESTING_DEPTH, ']');
+    ExpectInBudget("nested value", BuildHeader(nested));
+    ExpectInBudget("nested root", std::string(NESTING_DEPTH, '{') + std::string(NESTING_DEPTH, '}'));
+    std::string longString = "\"" + std::string(LONG_STRING_LEN, 'a') + "\"";
+    ExpectInBudget("long value", BuildHeader(longString));
+    ExpectInBudget("long dhId", R"({"Type":"OPERATION","dhId":)" + longString + "}");
+}
+
+/**
+ * @tc.name: dcamera_parser_cost_test_003
+ * @tc.desc: Verify wide arrays and repeated keys stay within the time and allocation budgets.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraParserCostTest, dcamera_parser_cost_test_003, TestSize.Level1)
+{
+    std::string numbers = "[";
+    std::string objects = "[";
+    std::string keys = "{";
+    for (size_t i = 0; i < LARGE_COUNT * REPEAT_TIMES; i++) {
+        numbers += (i == 0 ? "1" : ",1");
+        objects += (i == 0 ? "{}" : ",{}");
+        keys += (i == 0 ? "" : ",");
+        keys += R"("Type":"OPERATION")";
+    }
+    numbers += "]";
+    objects += "]";
+    keys += "}";
+    ExpectInBudget("wide numbers", BuildHeader(numbers));
+    ExpectInBudget("wide objects", BuildHeader(objects));
+    ExpectInBudget("repeated keys", keys);
+    std::string captureInfo = BuildCaptureInfo(SMALL_COUNT);
+    ExpectInBudget("truncated", captureInfo.substr(0, captureInfo.size() / 2));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
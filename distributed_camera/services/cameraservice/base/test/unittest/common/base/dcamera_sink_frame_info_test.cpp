@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <vector>
 
 #include "dcamera_sink_frame_info.h"
 #include "distributed_camera_errno.h"
@@ -204,5 +205,90 @@ HWTEST_F(DCameraSinkFrameInfoTest, dcamera_sink_frame_info_test_001, TestSize.Le
     ret = frame.Unmarshal(TEST_SINK_FRAME_INFO_JSON_IMU);
     EXPECT_EQ(DCAMERA_BAD_VALUE, ret);
 }
+
+/**
+ * @tc.name: dcamera_sink_frame_info_test_003
+ * @tc.desc: Verify binary frame info round trip and malformed input.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSinkFrameInfoTest, dcamera_sink_frame_info_test_003, TestSize.Level1)
+{
+    DCameraSinkFrameInfo frame;
+    frame.type_ = 1;
+    frame.index_ = 12;
+    frame.pts_ = 123456789;
+    frame.startEncodeT_ = -5;
+    frame.finishEncodeT_ = 1700000000000000;
+    frame.sendT_ = 1700000000000001;
+    frame.rawTimeUs_ = 123456789;
+    frame.exposureTime_ = 33;
+    frame.encoderPreset_ = 0x21;
+    frame.accData_.push_back({ 1000, { 0.5f, -1.25f, 9.8f } });
+    frame.gyroData_.push_back({ 1001, { 0.01f, -0.02f, 0.03f } });
+    frame.gyroData_.push_back({ 3501, { -0.04f, 0.05f, -0.06f } });
+    std::vector<uint8_t> data(frame.GetBinarySize());
+    size_t length = 0;
+    EXPECT_EQ(DCAMERA_BAD_VALUE, frame.MarshalBinary(data.data(), data.size() - 1, length));
+    EXPECT_EQ(DCAMERA_OK, frame.MarshalBinary(data.data(), data.size(), length));
+    EXPECT_EQ(data.size(), length);
+    EXPECT_TRUE(DCameraSinkFrameInfo::IsBinary(data.data(), length));
+
+    DCameraSinkFrameInfo parsed;
+    EXPECT_EQ(DCAMERA_OK, parsed.UnmarshalBinary(data.data(), length));
+    EXPECT_EQ(frame.type_, parsed.type_);
+    EXPECT_EQ(frame.index_, parsed.index_);
+    EXPECT_EQ(frame.pts_, parsed.pts_);
+    EXPECT_EQ(frame.startEncodeT_, parsed.startEncodeT_);
+    EXPECT_EQ(frame.finishEncodeT_, parsed.finishEncodeT_);
+    EXPECT_EQ(frame.sendT_, parsed.sendT_);
+    EXPECT_EQ(frame.rawTimeUs_, parsed.rawTimeUs_);
+    EXPECT_EQ(frame.exposureTime_, parsed.exposureTime_);
+    EXPECT_EQ(frame.encoderPreset_, parsed.encoderPreset_);
+    ASSERT_EQ(frame.accData_.size(), parsed.accData_.size());
+    ASSERT_EQ(frame.gyroData_.size(), parsed.gyroData_.size());
+    EXPECT_EQ(frame.accData_[0].timeStamp, parsed.accData_[0].timeStamp);
+    EXPECT_EQ(frame.accData_[0].data[IMU_Z], parsed.accData_[0].data[IMU_Z]);
+    EXPECT_EQ(frame.gyroData_[1].timeStamp, parsed.gyroData_[1].timeStamp);
+    EXPECT_EQ(frame.gyroData_[1].data[IMU_X], parsed.gyroData_[1].data[IMU_X]);
+
+    EXPECT_EQ(DCAMERA_BAD_VALUE, parsed.UnmarshalBinary(data.data(), length - 1));
+    std::string json = "{\"type\": 0}";
+    EXPECT_FALSE(DCameraSinkFrameInfo::IsBinary(reinterpret_cast<const uint8_t *>(json.data()), json.size()));
+}
+
+/**
+ * @tc.name: dcamera_sink_frame_info_test_004
+ * @tc.desc: Verify binary imu data without samples and with corrupted sample counts.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSinkFrameInfoTest, dcamera_sink_frame_info_test_004, TestSize.Level1)
+{
+    DCameraSinkFrameInfo frame;
+    EXPECT_EQ(DCameraSinkFrameInfo::BINARY_HEADER_LEN, frame.GetBinarySize());
+    frame.accData_.push_back({ 1000, { 1.0f, 2.0f, 3.0f } });
+    EXPECT_EQ(DCameraSinkFrameInfo::BINARY_HEADER_LEN + DCameraSinkFrameInfo::BINARY_IMU_HEADER_LEN +
+        DCameraSinkFrameInfo::BINARY_IMU_SAMPLE_LEN, frame.GetBinarySize());
+    std::vector<uint8_t> data(frame.GetBinarySize());
+    size_t length = 0;
+    EXPECT_EQ(DCAMERA_OK, frame.MarshalBinary(data.data(), data.size(), length));
+
+    DCameraSinkFrameInfo parsed;
+    const size_t gyroCountOffset = DCameraSinkFrameInfo::BINARY_HEADER_LEN + 11;
+    data[gyroCountOffset] = 1;
+    EXPECT_EQ(DCAMERA_BAD_VALUE, parsed.UnmarshalBinary(data.data(), length));
+    data[gyroCountOffset] = 0;
+    EXPECT_EQ(DCAMERA_OK, parsed.UnmarshalBinary(data.data(), length));
+    EXPECT_EQ(1, parsed.accData_.size());
+    EXPECT_TRUE(parsed.gyroData_.empty());
+
+    std::string imuInfo;
+    DCameraSinkFrameInfo empty;
+    empty.MarshalImuJson(imuInfo);
+    EXPECT_TRUE(imuInfo.empty());
+    EXPECT_EQ(DCAMERA_OK, parsed.UnmarshalImuJson(imuInfo));
+    EXPECT_TRUE(parsed.accData_.empty());
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
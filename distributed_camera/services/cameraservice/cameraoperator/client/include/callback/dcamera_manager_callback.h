@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,15 +16,25 @@
 #ifndef OHOS_DCAMERA_MANAGER_CALLBACK_H
 #define OHOS_DCAMERA_MANAGER_CALLBACK_H
 
+#include <functional>
+
 #include "camera_manager.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 class DCameraManagerCallback : public CameraStandard::CameraManagerCallback {
 public:
+    using StatusListener = std::function<void(const CameraStandard::CameraStatusInfo &)>;
+
+    DCameraManagerCallback() = default;
+    explicit DCameraManagerCallback(StatusListener listener) : statusListener_(std::move(listener)) {}
+
     void OnCameraStatusChanged(const CameraStandard::CameraStatusInfo &cameraStatusInfo) const override;
     void OnFlashlightStatusChanged(const std::string &cameraID,
                                    const CameraStandard::FlashStatus flashStatus) const override;
+
+private:
+    StatusListener statusListener_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
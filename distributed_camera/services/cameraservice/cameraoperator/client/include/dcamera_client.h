@@ -18,7 +18,7 @@
 
 #include "icamera_operator.h"
 
-#include <queue>
+#include <mutex>
 
 #include "camera_info.h"
 #include "camera_input.h"
@@ -46,6 +46,8 @@ public:
         sptr<Surface>& surface, int32_t sceneMode) override;
     int32_t PrepareCapture(std::vector<std::shared_ptr<DCameraCaptureInfo>>& captureInfos, int32_t sceneMode) override;
     int32_t CommitCapture(sptr<Surface>& surface) override;
+    int32_t PreOpenCapture(int32_t sceneMode) override;
+    int32_t ReleasePreOpened() override;
     int32_t StopCapture() override;
     int32_t SetStateCallback(std::shared_ptr<StateCallback>& callback) override;
     int32_t SetResultCallback(std::shared_ptr<ResultCallback>& callback) override;
@@ -60,7 +62,7 @@ private:
     int32_t CreatePreviewOutput(std::shared_ptr<DCameraCaptureInfo>& info);
     int32_t StartCaptureInner(std::shared_ptr<DCameraCaptureInfo>& info);
     int32_t StartPhotoOutput(std::shared_ptr<DCameraCaptureInfo>& info);
-    void FindCameraMetadata(const std::string& metadataStr);
+    void FindCameraMetadata(const std::shared_ptr<Camera::CameraMetadata>& cameraMetadata);
     void SetPhotoCaptureRotation(const std::shared_ptr<Camera::CameraMetadata>& cameraMetadata,
         std::shared_ptr<CameraStandard::PhotoCaptureSetting>& photoCaptureSetting);
     void SetPhotoCaptureQuality(const std::shared_ptr<Camera::CameraMetadata>& cameraMetadata,
@@ -71,18 +73,22 @@ private:
     void ReleaseCaptureSession();
     int32_t CameraServiceErrorType(const int32_t errorType);
     CameraStandard::CameraFormat ConvertToCameraFormat(int32_t format);
-    void UpdateSettingCache(const std::string& metadataStr);
+    void UpdateSettingCache(const std::shared_ptr<Camera::CameraMetadata>& cameraMetadata);
+    int32_t ApplyCameraSettings(const std::shared_ptr<Camera::CameraMetadata>& cameraMetadata);
     void GetFpsRanges();
     void ReleaseCameraInput();
+    void ReleasePreOpenedLocked();
 
 private:
-    constexpr static uint32_t DCAMERA_MAX_METADATA_SIZE = 20;
+    constexpr static size_t PENDING_ITEM_CAPACITY = 64;
+    constexpr static size_t PENDING_DATA_CAPACITY = 1024;
     constexpr static uint32_t DCAMERA_FPS_SIZE = 2;
     constexpr static int32_t DCAMERA_MAX_FPS = 30;
 
     bool isInit_;
     std::string cameraId_;
-    std::queue<std::string> cameraMetadatas_;
+    // Settings received before the camera input is open, merged per tag with the last writer winning.
+    std::shared_ptr<Camera::CameraMetadata> pendingMetadata_ = nullptr;
     sptr<IConsumerSurface> photoSurface_;
     sptr<Surface> previewSurface_;
     sptr<CameraStandard::CameraDevice> cameraInfo_;
@@ -96,7 +102,12 @@ private:
     std::shared_ptr<ResultCallback> resultCallback_;
     std::vector<std::shared_ptr<DCameraCaptureInfo>> captureInfosCache_;
     std::vector<int32_t> fpsRanges_ = {};
+    int32_t previewHdrType_ = DCAMERA_HDR_NONE;
     const char* videoOutputCallbackSdk = "camera_video";
+    // Guards the camera input and session against a pre-open running next to a capture.
+    std::mutex preOpenMutex_;
+    bool isPreOpened_ = false;
+    int32_t preOpenedSceneMode_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -68,6 +68,14 @@ public:
     {
         return DCAMERA_BAD_OPERATE;
     }
+    virtual int32_t PreOpenCapture(int32_t sceneMode)
+    {
+        return DCAMERA_BAD_OPERATE;
+    }
+    virtual int32_t ReleasePreOpened()
+    {
+        return DCAMERA_OK;
+    }
     virtual int32_t StopCapture() = 0;
     virtual int32_t SetStateCallback(std::shared_ptr<StateCallback>& callback) = 0;
     virtual int32_t SetResultCallback(std::shared_ptr<ResultCallback>& callback) = 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -24,6 +24,9 @@ namespace DistributedHardware {
 void DCameraManagerCallback::OnCameraStatusChanged(const CameraStandard::CameraStatusInfo &cameraStatusInfo) const
 {
     DHLOGI("enter, cameraStatus: %{public}d", cameraStatusInfo.cameraStatus);
+    if (statusListener_ != nullptr) {
+        statusListener_(cameraStatusInfo);
+    }
 }
 
 void DCameraManagerCallback::OnFlashlightStatusChanged(const std::string &cameraID,
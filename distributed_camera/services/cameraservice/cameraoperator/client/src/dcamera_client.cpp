@@ -108,17 +108,22 @@ int32_t DCameraClient::UpdateSettings(std::vector<std::shared_ptr<DCameraSetting
         switch (setting->type_) {
             case UPDATE_METADATA: {
                 DHLOGI("UpdateSettings %{public}s update metadata settings", GetAnonyString(cameraId_).c_str());
-                std::string dcSettingValue = setting->value_;
-                std::string metadataStr = Base64Decode(dcSettingValue);
-                FindCameraMetadata(metadataStr);
+                std::shared_ptr<Camera::CameraMetadata> cameraMetadata =
+                    Camera::MetadataUtils::DecodeFromString(Base64Decode(setting->value_));
+                if (cameraMetadata == nullptr || cameraMetadata->get() == nullptr) {
+                    DHLOGE("UpdateSettings %{public}s decode metadata settings failed",
+                        GetAnonyString(cameraId_).c_str());
+                    break;
+                }
+                FindCameraMetadata(cameraMetadata);
 
                 if (cameraInput_ == nullptr) {
                     DHLOGE("UpdateSettings %{public}s cameraInput is null", GetAnonyString(cameraId_).c_str());
-                    UpdateSettingCache(metadataStr);
-                    return DCAMERA_OK;
+                    UpdateSettingCache(cameraMetadata);
+                    break;
                 }
 
-                int32_t ret = ((sptr<CameraStandard::CameraInput> &)cameraInput_)->SetCameraSettings(metadataStr);
+                int32_t ret = ApplyCameraSettings(cameraMetadata);
                 if (ret != DCAMERA_OK) {
                     DHLOGE("UpdateSettings %{public}s update metadata settings failed, ret: %{public}d",
                         GetAnonyString(cameraId_).c_str(), ret);
@@ -136,19 +141,36 @@ int32_t DCameraClient::UpdateSettings(std::vector<std::shared_ptr<DCameraSetting
     return DCAMERA_OK;
 }
 
-void DCameraClient::UpdateSettingCache(const std::string& metadataStr)
+void DCameraClient::UpdateSettingCache(const std::shared_ptr<Camera::CameraMetadata>& cameraMetadata)
 {
-    if (cameraMetadatas_.size() == DCAMERA_MAX_METADATA_SIZE) {
-        DHLOGE("UpdateSettingCache %{public}s camera metadata oversize",
-            GetAnonyString(cameraId_).c_str());
-        cameraMetadatas_.pop();
+    if (pendingMetadata_ == nullptr) {
+        pendingMetadata_ = std::make_shared<Camera::CameraMetadata>(PENDING_ITEM_CAPACITY, PENDING_DATA_CAPACITY);
+    }
+    common_metadata_header_t *src = cameraMetadata->get();
+    uint32_t count = Camera::GetCameraMetadataItemCount(src);
+    for (uint32_t index = 0; index < count; index++) {
+        camera_metadata_item_t item;
+        if (Camera::GetCameraMetadataItem(src, index, &item) != CAM_META_SUCCESS) {
+            continue;
+        }
+        bool isMerged = Camera::IsCameraMetadataItemExist(pendingMetadata_->get(), item.item) ?
+            pendingMetadata_->updateEntry(item.item, item.data.u8, item.count) :
+            pendingMetadata_->addEntry(item.item, item.data.u8, item.count);
+        if (!isMerged) {
+            DHLOGE("UpdateSettingCache %{public}s merge metadata item %{public}u failed",
+                GetAnonyString(cameraId_).c_str(), item.item);
+        }
     }
-    cameraMetadatas_.push(metadataStr);
 }
 
-void DCameraClient::FindCameraMetadata(const std::string& metadataStr)
+int32_t DCameraClient::ApplyCameraSettings(const std::shared_ptr<Camera::CameraMetadata>& cameraMetadata)
+{
+    // The decoded settings go in as is, SetCameraSettings would decode the same string a second time.
+    return ((sptr<CameraStandard::CameraInput> &)cameraInput_)->UpdateSetting(cameraMetadata);
+}
+
+void DCameraClient::FindCameraMetadata(const std::shared_ptr<Camera::CameraMetadata>& cameraMetadata)
 {
-    std::shared_ptr<Camera::CameraMetadata> cameraMetadata = Camera::MetadataUtils::DecodeFromString(metadataStr);
     CHECK_AND_RETURN_LOG(cameraMetadata == nullptr, "FindCameraMetadata get cameraMetadata is null");
     camera_metadata_item_t focusItem;
     int32_t ret = Camera::FindCameraMetadataItem(cameraMetadata->get(), OHOS_CONTROL_FOCUS_MODE, &focusItem);
@@ -176,6 +198,13 @@ void DCameraClient::FindCameraMetadata(const std::string& metadataStr)
         DHLOGE("FindCameraMetadata %{public}s find stabilization mode failed, ret: %{public}d",
             GetAnonyString(cameraId_).c_str(), ret);
     }
+
+    // Zoom is applied by the sink camera itself, the frames are encoded at the zoomed field of view.
+    camera_metadata_item_t zoomItem;
+    ret = Camera::FindCameraMetadataItem(cameraMetadata->get(), OHOS_CONTROL_ZOOM_RATIO, &zoomItem);
+    if (ret == CAM_META_SUCCESS && zoomItem.count > 0) {
+        DHLOGI("FindCameraMetadata zoom ratio: %{public}f", zoomItem.data.f[0]);
+    }
 }
 
 void DCameraClient::ReleaseCameraInput()
@@ -216,8 +245,17 @@ int32_t DCameraClient::StartCapture(std::vector<std::shared_ptr<DCameraCaptureIn
 int32_t DCameraClient::PrepareCapture(std::vector<std::shared_ptr<DCameraCaptureInfo>>& captureInfos, int32_t sceneMode)
 {
     DHLOGI("PrepareCapture cameraId: %{public}s", GetAnonyString(cameraId_).c_str());
+    std::lock_guard<std::mutex> autoLock(preOpenMutex_);
+    if (isPreOpened_ && preOpenedSceneMode_ != sceneMode) {
+        DHLOGI("PrepareCapture %{public}s pre-opened for mode %{public}d, reconfigure for mode %{public}d",
+            GetAnonyString(cameraId_).c_str(), preOpenedSceneMode_, sceneMode);
+        ReleasePreOpenedLocked();
+    }
     int32_t ret = DCAMERA_OK;
-    if (photoOutput_ == nullptr && previewOutput_ == nullptr) {
+    if (isPreOpened_) {
+        DHLOGI("PrepareCapture %{public}s reuse pre-opened camera input", GetAnonyString(cameraId_).c_str());
+        isPreOpened_ = false;
+    } else if (photoOutput_ == nullptr && previewOutput_ == nullptr) {
         ret = ConfigCaptureSession(captureInfos, sceneMode);
     }
     captureInfosCache_ = captureInfos;
@@ -225,6 +263,44 @@ int32_t DCameraClient::PrepareCapture(std::vector<std::shared_ptr<DCameraCapture
     return CameraServiceErrorType(ret);
 }
 
+int32_t DCameraClient::PreOpenCapture(int32_t sceneMode)
+{
+    DHLOGI("PreOpenCapture cameraId: %{public}s, mode: %{public}d", GetAnonyString(cameraId_).c_str(), sceneMode);
+    std::lock_guard<std::mutex> autoLock(preOpenMutex_);
+    if (isPreOpened_ || cameraInput_ != nullptr || captureSession_ != nullptr) {
+        DHLOGI("PreOpenCapture %{public}s camera input already in use", GetAnonyString(cameraId_).c_str());
+        return DCAMERA_WRONG_STATE;
+    }
+    std::vector<std::shared_ptr<DCameraCaptureInfo>> captureInfos;
+    int32_t ret = ConfigCaptureSession(captureInfos, sceneMode);
+    if (ret != DCAMERA_OK) {
+        DHLOGE("PreOpenCapture %{public}s config capture session failed, ret: %{public}d",
+            GetAnonyString(cameraId_).c_str(), ret);
+        return ret;
+    }
+    isPreOpened_ = true;
+    preOpenedSceneMode_ = sceneMode;
+    return DCAMERA_OK;
+}
+
+int32_t DCameraClient::ReleasePreOpened()
+{
+    std::lock_guard<std::mutex> autoLock(preOpenMutex_);
+    ReleasePreOpenedLocked();
+    return DCAMERA_OK;
+}
+
+void DCameraClient::ReleasePreOpenedLocked()
+{
+    if (!isPreOpened_) {
+        return;
+    }
+    DHLOGI("ReleasePreOpened %{public}s release unused camera input", GetAnonyString(cameraId_).c_str());
+    ReleaseCaptureSession();
+    ReleaseCameraInput();
+    isPreOpened_ = false;
+}
+
 int32_t DCameraClient::CommitCapture(sptr<Surface>& surface)
 {
     DHLOGI("CommitCapture cameraId: %{public}s", GetAnonyString(cameraId_).c_str());
@@ -317,6 +393,8 @@ int32_t DCameraClient::CameraServiceErrorType(const int32_t errorType)
 int32_t DCameraClient::StopCapture()
 {
     DHLOGI("StopCapture cameraId: %{public}s", GetAnonyString(cameraId_).c_str());
+    std::lock_guard<std::mutex> autoLock(preOpenMutex_);
+    isPreOpened_ = false;
     fpsRanges_.clear();
     StopOutput();
 
@@ -454,19 +532,18 @@ int32_t DCameraClient::ConfigCaptureSession(std::vector<std::shared_ptr<DCameraC
     ((sptr<CameraStandard::CameraInput> &)cameraInput_)->SetErrorCallback(inputCallback);
     ((sptr<CameraStandard::CameraInput> &)cameraInput_)->SetResultCallback(resultCallback);
 
-    while (!cameraMetadatas_.empty()) {
-        std::string metadataStr = cameraMetadatas_.front();
-        FindCameraMetadata(metadataStr);
-        int32_t ret = ((sptr<CameraStandard::CameraInput> &)cameraInput_)->SetCameraSettings(metadataStr);
+    if (pendingMetadata_ != nullptr) {
+        std::shared_ptr<Camera::CameraMetadata> pendingMetadata = pendingMetadata_;
+        pendingMetadata_ = nullptr;
+        FindCameraMetadata(pendingMetadata);
+        int32_t ret = ApplyCameraSettings(pendingMetadata);
         if (ret != DCAMERA_OK) {
             DHLOGE("ConfigCaptureSession %{public}s set camera settings failed, ret: %{public}d",
                 GetAnonyString(cameraId_).c_str(), ret);
             // Clean up all allocated resources
             ReleaseCameraInput();
-            cameraMetadatas_.pop(); // Remove the processed metadata
             return ret;
         }
-        cameraMetadatas_.pop();
     }
 
     captureSession_ = cameraManager_->CreateCaptureSession(static_cast<CameraStandard::SceneMode>(sceneMode));
@@ -518,6 +595,16 @@ int32_t DCameraClient::ConfigCaptureSessionInner()
         }
     }
 
+    if (previewOutput_ != nullptr && previewHdrType_ != DCAMERA_HDR_NONE) {
+        CameraStandard::ColorSpace colorSpace = previewHdrType_ == DCAMERA_HDR_PQ ?
+            CameraStandard::ColorSpace::BT2020_PQ : CameraStandard::ColorSpace::BT2020_HLG;
+        int32_t colorRet = captureSession_->SetColorSpace(colorSpace);
+        if (colorRet != DCAMERA_OK) {
+            DHLOGE("ConfigCaptureSession %{public}s set hdr color space failed, ret: %{public}d",
+                GetAnonyString(cameraId_).c_str(), colorRet);
+        }
+    }
+
     ret = captureSession_->CommitConfig();
     if (ret != DCAMERA_OK) {
         DHLOGE("ConfigCaptureSession %{public}s commit captureSession failed, ret: %{public}d",
@@ -611,9 +698,18 @@ int32_t DCameraClient::CreatePreviewOutput(std::shared_ptr<DCameraCaptureInfo>&
 {
     CHECK_AND_RETURN_RET_LOG(info == nullptr, DCAMERA_BAD_VALUE, "CreatePreviewOutput info is null");
     DHLOGI("CreatePreviewOutput dhId: %{public}s, width: %{public}d, height: %{public}d, format: %{public}d, stream:"
-        " %{public}d, isCapture: %{public}d", GetAnonyString(cameraId_).c_str(), info->width_, info->height_,
-        info->format_, info->streamType_, info->isCapture_);
+        " %{public}d, isCapture: %{public}d, hdr: %{public}d", GetAnonyString(cameraId_).c_str(), info->width_,
+        info->height_, info->format_, info->streamType_, info->isCapture_, info->hdrType_);
     CameraStandard::CameraFormat previewFormat = ConvertToCameraFormat(info->format_);
+    // The sink only captures 10 bit when the source asked for HDR, otherwise P010 goes out as 8 bit NV21.
+    previewHdrType_ = DCAMERA_HDR_NONE;
+    if (previewFormat == CameraStandard::CameraFormat::CAMERA_FORMAT_YCBCR_P010) {
+        if (info->hdrType_ == DCAMERA_HDR_NONE || info->encodeType_ != ENCODE_TYPE_H265) {
+            previewFormat = CameraStandard::CameraFormat::CAMERA_FORMAT_YUV_420_SP;
+        } else {
+            previewHdrType_ = info->hdrType_;
+        }
+    }
     CameraStandard::Size previewSize = {info->width_, info->height_};
     CameraStandard::Profile previewProfile(previewFormat, previewSize);
     int32_t rv = cameraManager_->CreatePreviewOutput(
@@ -645,6 +741,9 @@ CameraStandard::CameraFormat DCameraClient::ConvertToCameraFormat(int32_t format
         case DCameraFormat::OHOS_CAMERA_FORMAT_JPEG:
             ret = CameraStandard::CameraFormat::CAMERA_FORMAT_JPEG;
             break;
+        case DCameraFormat::OHOS_CAMERA_FORMAT_YCBCB_P010:
+            ret = CameraStandard::CameraFormat::CAMERA_FORMAT_YCBCR_P010;
+            break;
         default:
             break;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -18,6 +18,7 @@
 #include <securec.h>
 
 #include "data_buffer.h"
+#include "dcamera_dump_writer.h"
 #include "dcamera_hidumper.h"
 #include "dcamera_utils_tools.h"
 #include "distributed_camera_errno.h"
@@ -69,8 +70,9 @@ void DCameraPhotoSurfaceListener::OnBufferAvailable()
         }
 #ifdef DUMP_DCAMERA_FILE
         std::string name = std::to_string(photoCount_++) + SINK_PHOTO;
-        if (DcameraHidumper::GetInstance().GetDumpFlag() && (IsUnderDumpMaxSize(DUMP_PHOTO_PATH, name) == DCAMERA_OK)) {
-            DumpBufferToFile(DUMP_PHOTO_PATH, name, dataBuffer->Data(), dataBuffer->Size());
+        if (DcameraHidumper::GetInstance().GetDumpFlag()) {
+            DCameraDumpWriter::GetInstance().Write(DUMP_PHOTO_PATH, name, dataBuffer->Data(), dataBuffer->Size(),
+                true);
         }
 #endif
         callback_->OnPhotoResult(dataBuffer);
@@ -608,6 +608,9 @@ HWTEST_F(DCameraClientTest, dcamera_client_test_011, TestSize.Level1)
 
     ret = client_->ConvertToCameraFormat(OHOS_CAMERA_FORMAT_JPEG);
     EXPECT_EQ(CameraStandard::CameraFormat::CAMERA_FORMAT_JPEG, ret);
+
+    ret = client_->ConvertToCameraFormat(OHOS_CAMERA_FORMAT_YCBCB_P010);
+    EXPECT_EQ(CameraStandard::CameraFormat::CAMERA_FORMAT_YCBCR_P010, ret);
 }
 
 /**
@@ -729,5 +732,67 @@ HWTEST_F(DCameraClientTest, dcamera_client_test_017, TestSize.Level1)
     std::shared_ptr<CaOnResultCallback> resultCallback = std::make_shared<CaOnResultCallback>(nullptr);
     EXPECT_NO_FATAL_FAILURE(resultCallback->OnResult(0, result));
 }
+
+/**
+ * @tc.name: dcamera_client_test_018
+ * @tc.desc: Verify PreOpenCapture ReleasePreOpened
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraClientTest, dcamera_client_test_018, TestSize.Level1)
+{
+    DHLOGI("DCameraClientTest dcamera_client_test_018: test PreOpenCapture");
+    ASSERT_NE(client_, nullptr);
+    int32_t sceneMode = 0;
+    int32_t ret = client_->PreOpenCapture(sceneMode);
+    EXPECT_EQ(DCAMERA_BAD_VALUE, ret);
+    EXPECT_FALSE(client_->isPreOpened_);
+
+    client_->isPreOpened_ = true;
+    ret = client_->PreOpenCapture(sceneMode);
+    EXPECT_EQ(DCAMERA_WRONG_STATE, ret);
+    ret = client_->ReleasePreOpened();
+    EXPECT_EQ(DCAMERA_OK, ret);
+    EXPECT_FALSE(client_->isPreOpened_);
+}
+
+/**
+ * @tc.name: dcamera_client_test_019
+ * @tc.desc: Verify settings received before the input opens are merged per tag with the last writer winning
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraClientTest, dcamera_client_test_019, TestSize.Level1)
+{
+    DHLOGI("DCameraClientTest dcamera_client_test_019: test pending settings merge");
+    ASSERT_NE(client_, nullptr);
+    auto makeSetting = [](float zoom, const uint8_t *focusMode) {
+        auto metaData = std::make_shared<Camera::CameraMetadata>(ENTRY_CAPACITY, DATA_CAPACITY);
+        metaData->addEntry(OHOS_CONTROL_ZOOM_RATIO, &zoom, 1);
+        if (focusMode != nullptr) {
+            metaData->addEntry(OHOS_CONTROL_FOCUS_MODE, focusMode, 1);
+        }
+        std::string metadataStr = Camera::MetadataUtils::EncodeToString(metaData);
+        auto setting = std::make_shared<DCameraSettings>();
+        setting->type_ = UPDATE_METADATA;
+        setting->value_ = Base64Encode(reinterpret_cast<const unsigned char *>(metadataStr.c_str()),
+            metadataStr.length());
+        return setting;
+    };
+    uint8_t afMode = OHOS_CAMERA_FOCUS_MODE_AUTO;
+    std::vector<std::shared_ptr<DCameraSettings>> settings = { makeSetting(1.0f, &afMode) };
+    EXPECT_EQ(DCAMERA_OK, client_->UpdateSettings(settings));
+    settings = { makeSetting(2.0f, nullptr) };
+    EXPECT_EQ(DCAMERA_OK, client_->UpdateSettings(settings));
+    ASSERT_NE(client_->pendingMetadata_, nullptr);
+
+    common_metadata_header_t *pending = client_->pendingMetadata_->get();
+    EXPECT_EQ(2u, Camera::GetCameraMetadataItemCount(pending));
+    camera_metadata_item_t item;
+    ASSERT_EQ(CAM_META_SUCCESS, Camera::FindCameraMetadataItem(pending, OHOS_CONTROL_ZOOM_RATIO, &item));
+    EXPECT_FLOAT_EQ(2.0f, item.data.f[0]);
+    ASSERT_EQ(CAM_META_SUCCESS, Camera::FindCameraMetadataItem(pending, OHOS_CONTROL_FOCUS_MODE, &item));
+    EXPECT_EQ(afMode, item.data.u8[0]);
+}
 } // namespace DistributedHardware
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -18,6 +18,7 @@
 
 #include "ihardware_handler.h"
 
+#include <mutex>
 #include <set>
 
 #include "camera_info.h"
@@ -44,6 +45,8 @@ public:
     void UnRegisterPluginListener() override;
 
     std::vector<std::string> GetCameras();
+    // Drops the cached query results, the next query asks the camera service again.
+    void InvalidateCache();
 
 private:
     DCameraHandler() = default;
@@ -54,6 +57,7 @@ private:
     int32_t CreateMetaDHItem(sptr<CameraStandard::CameraDevice>& info, DHItem& item);
     int32_t CreateDHItem(sptr<CameraStandard::CameraDevice>& info, DHItem& item);
     int32_t CreateAVCodecList(cJSON* root);
+    int32_t ProbeCodecAbility();
     std::string GetCameraPosition(CameraStandard::CameraPosition position);
     void ProcessProfile(const DCStreamType type, std::map<std::string, std::list<std::string>>& formatMap,
         std::map<std::string, std::list<std::string>>& fpsMap, std::vector<CameraStandard::Profile>& profileList,
@@ -68,6 +72,19 @@ private:
 
     sptr<CameraStandard::CameraManager> cameraManager_;
     std::shared_ptr<PluginListener> pluginListener_;
+
+    // Query results are cached until a camera status change, empty lists are not cached.
+    std::mutex cacheMutex_;
+    uint64_t cacheGeneration_ = 0;
+    std::vector<DHItem> metaItems_;
+    std::vector<DHItem> queryItems_;
+    std::vector<std::string> cameras_;
+
+    // The hardware encoders do not change at runtime, they are probed once.
+    std::mutex codecMutex_;
+    bool isCodecProbed_ = false;
+    std::vector<std::string> codecMimeTypes_;
+    bool isHdr10Supported_ = false;
 };
 
 #ifdef __cplusplus
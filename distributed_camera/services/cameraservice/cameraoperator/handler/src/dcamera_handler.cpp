@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include "dcamera_handler.h"
 
+#include <algorithm>
 #include <functional>
 
 #include "anonymous_string.h"
@@ -46,7 +47,8 @@ int32_t DCameraHandler::Initialize()
         DHLOGE("cameraManager getInstance failed");
         return DCAMERA_INIT_ERR;
     }
-    std::shared_ptr<DCameraManagerCallback> cameraMgrCallback = std::make_shared<DCameraManagerCallback>();
+    std::shared_ptr<DCameraManagerCallback> cameraMgrCallback = std::make_shared<DCameraManagerCallback>(
+        [](const CameraStandard::CameraStatusInfo &) { DCameraHandler::GetInstance().InvalidateCache(); });
     cameraManager_->SetCallback(cameraMgrCallback);
     DHLOGI("success");
     return DCAMERA_OK;
@@ -56,6 +58,15 @@ std::vector<DHItem> DCameraHandler::QueryMeta()
 {
     std::vector<DHItem> itemList;
     CHECK_AND_RETURN_RET_LOG(cameraManager_ == nullptr, itemList, "cameraManager is null.");
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> autoLock(cacheMutex_);
+        if (!metaItems_.empty()) {
+            DHLOGI("get %{public}zu meta items from cache", metaItems_.size());
+            return metaItems_;
+        }
+        generation = cacheGeneration_;
+    }
     std::vector<sptr<CameraStandard::CameraDevice>> cameraList = cameraManager_->GetSupportedCameras();
     uint64_t listSize = static_cast<uint64_t>(cameraList.size());
     DHLOGI("get %{public}" PRIu64" cameras", listSize);
@@ -81,6 +92,10 @@ std::vector<DHItem> DCameraHandler::QueryMeta()
     }
     listSize = static_cast<uint64_t>(itemList.size());
     DHLOGI("success, get %{public}" PRIu64" items", listSize);
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    if (generation == cacheGeneration_) {
+        metaItems_ = itemList;
+    }
     return itemList;
 }
 
@@ -88,6 +103,15 @@ std::vector<DHItem> DCameraHandler::Query()
 {
     std::vector<DHItem> itemList;
     CHECK_AND_RETURN_RET_LOG(cameraManager_ == nullptr, itemList, "cameraManager is null.");
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> autoLock(cacheMutex_);
+        if (!queryItems_.empty()) {
+            DHLOGI("get %{public}zu items from cache", queryItems_.size());
+            return queryItems_;
+        }
+        generation = cacheGeneration_;
+    }
     std::vector<sptr<CameraStandard::CameraDevice>> cameraList = cameraManager_->GetSupportedCameras();
     uint64_t listSize = static_cast<uint64_t>(cameraList.size());
     DHLOGI("get %{public}" PRIu64" cameras", listSize);
@@ -120,6 +144,10 @@ std::vector<DHItem> DCameraHandler::Query()
     }
     listSize = static_cast<uint64_t>(itemList.size());
     DHLOGI("success, get %{public}" PRIu64" items", listSize);
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    if (generation == cacheGeneration_) {
+        queryItems_ = itemList;
+    }
     return itemList;
 }
 
@@ -154,6 +182,16 @@ void DCameraHandler::UnRegisterPluginListener()
 std::vector<std::string> DCameraHandler::GetCameras()
 {
     std::vector<std::string> cameras;
+    CHECK_AND_RETURN_RET_LOG(cameraManager_ == nullptr, cameras, "cameraManager is null.");
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> autoLock(cacheMutex_);
+        if (!cameras_.empty()) {
+            DHLOGI("get %{public}zu cameras from cache", cameras_.size());
+            return cameras_;
+        }
+        generation = cacheGeneration_;
+    }
     std::vector<sptr<CameraStandard::CameraDevice>> cameraList = cameraManager_->GetSupportedCameras();
     uint64_t listSize = static_cast<uint64_t>(cameraList.size());
     DHLOGI("get %{public}" PRIu64" cameras", listSize);
@@ -178,25 +216,56 @@ std::vector<std::string> DCameraHandler::GetCameras()
     }
     listSize = static_cast<uint64_t>(cameras.size());
     DHLOGI("success, get %{public}" PRIu64" items", listSize);
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    if (generation == cacheGeneration_) {
+        cameras_ = cameras;
+    }
     return cameras;
 }
 
+void DCameraHandler::InvalidateCache()
+{
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    DHLOGI("camera status changed, drop cached query results");
+    cacheGeneration_++;
+    metaItems_.clear();
+    queryItems_.clear();
+    cameras_.clear();
+}
+
 int32_t DCameraHandler::CreateAVCodecList(cJSON *root)
 {
-    DHLOGI("Create avCodecList start");
-    std::shared_ptr<MediaAVCodec::AVCodecList> avCodecList = MediaAVCodec::AVCodecListFactory::CreateAVCodecList();
-    if (avCodecList == nullptr) {
-        DHLOGI("Create avCodecList failed");
+    std::lock_guard<std::mutex> autoLock(codecMutex_);
+    if (!isCodecProbed_ && ProbeCodecAbility() != DCAMERA_OK) {
         return DCAMERA_BAD_VALUE;
     }
-    const std::vector<std::string> encoderName = {std::string(MediaAVCodec::CodecMimeType::VIDEO_AVC),
-                                                  std::string(MediaAVCodec::CodecMimeType::VIDEO_HEVC)};
     cJSON *array = cJSON_CreateArray();
     if (array == nullptr) {
         DHLOGI("Create arrray failed");
         return DCAMERA_BAD_VALUE;
     }
     cJSON_AddItemToObject(root, CAMERA_CODEC_TYPE_KEY.c_str(), array);
+    for (auto &mimeType : codecMimeTypes_) {
+        cJSON_AddItemToArray(array, cJSON_CreateString(mimeType.c_str()));
+    }
+    if (isHdr10Supported_) {
+        cJSON_AddBoolToObject(root, CAMERA_HDR10_KEY.c_str(), true);
+    }
+    return DCAMERA_OK;
+}
+
+int32_t DCameraHandler::ProbeCodecAbility()
+{
+    DHLOGI("Create avCodecList start");
+    std::shared_ptr<MediaAVCodec::AVCodecList> avCodecList = MediaAVCodec::AVCodecListFactory::CreateAVCodecList();
+    if (avCodecList == nullptr) {
+        DHLOGI("Create avCodecList failed");
+        return DCAMERA_BAD_VALUE;
+    }
+    const std::vector<std::string> encoderName = {std::string(MediaAVCodec::CodecMimeType::VIDEO_AVC),
+                                                  std::string(MediaAVCodec::CodecMimeType::VIDEO_HEVC)};
+    codecMimeTypes_.clear();
+    isHdr10Supported_ = false;
     for (auto &coder : encoderName) {
         MediaAVCodec::CapabilityData *capData = avCodecList->GetCapability(coder, true,
             MediaAVCodec::AVCodecCategory::AVCODEC_HARDWARE);
@@ -205,9 +274,16 @@ int32_t DCameraHandler::CreateAVCodecList(cJSON *root)
             continue;
         }
         std::string mimeType = capData->mimeType;
-        cJSON_AddItemToArray(array, cJSON_CreateString(mimeType.c_str()));
+        codecMimeTypes_.push_back(mimeType);
         DHLOGI("codec name: %{public}s, mimeType: %{public}s", coder.c_str(), mimeType.c_str());
+        bool isMain10 = std::find(capData->profiles.begin(), capData->profiles.end(),
+            static_cast<int32_t>(MediaAVCodec::HEVCProfile::HEVC_PROFILE_MAIN_10)) != capData->profiles.end();
+        if (mimeType == std::string(MediaAVCodec::CodecMimeType::VIDEO_HEVC) && isMain10) {
+            DHLOGI("Have HEVC Main10 encode ability.");
+            isHdr10Supported_ = true;
+        }
     }
+    isCodecProbed_ = true;
     return DCAMERA_OK;
 }
 
@@ -247,6 +323,8 @@ int32_t DCameraHandler::CreateDHItem(sptr<CameraStandard::CameraDevice>& info, D
     cJSON_AddBoolToObject(root, "EIS", true);
 #endif
     cJSON_AddStringToObject(root, CAMERA_PROTOCOL_VERSION_KEY.c_str(), CAMERA_PROTOCOL_VERSION_VALUE.c_str());
+    cJSON_AddNumberToObject(root, CAMERA_CONTROL_FORMAT_KEY.c_str(), DCAMERA_CONTROL_FORMAT_BINARY);
+    cJSON_AddBoolToObject(root, CAMERA_SESSION_MUX_KEY.c_str(), true);
     cJSON_AddStringToObject(root, CAMERA_POSITION_KEY.c_str(), GetCameraPosition(info->GetPosition()).c_str());
     int32_t ret = CreateAVCodecList(root);
     CHECK_AND_FREE_RETURN_RET_LOG(ret != DCAMERA_OK, DCAMERA_BAD_VALUE, root, "CreateAVCodecList failed");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -257,5 +257,40 @@ HWTEST_F(DCameraHandlerTest, dcamera_handler_test_008, TestSize.Level1)
     ret = DCameraHandler::GetInstance().IsValid(type, size);
     EXPECT_EQ(ret, false);
 }
+
+/**
+ * @tc.name: dcamera_handler_test_009
+ * @tc.desc: Verify query results are served from the cache until it is invalidated
+ * @tc.type: FUNC
+ * @tc.require: AR000GK6MF
+ */
+HWTEST_F(DCameraHandlerTest, dcamera_handler_test_009, TestSize.Level1)
+{
+    SetTokenID();
+    DCameraHandler &handler = DCameraHandler::GetInstance();
+    EXPECT_EQ(handler.Initialize(), DCAMERA_OK);
+    handler.InvalidateCache();
+    std::vector<std::string> cameras = handler.GetCameras();
+    EXPECT_EQ(handler.cameras_, cameras);
+
+    std::vector<DHItem> items = handler.Query();
+    EXPECT_EQ(handler.queryItems_.size(), items.size());
+    std::vector<DHItem> cachedItems = handler.Query();
+    ASSERT_EQ(cachedItems.size(), items.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        EXPECT_EQ(cachedItems[i].dhId, items[i].dhId);
+        EXPECT_EQ(cachedItems[i].attrs, items[i].attrs);
+    }
+    if (!items.empty()) {
+        EXPECT_TRUE(handler.isCodecProbed_);
+    }
+
+    uint64_t generation = handler.cacheGeneration_;
+    handler.InvalidateCache();
+    EXPECT_EQ(handler.cacheGeneration_, generation + 1);
+    EXPECT_TRUE(handler.cameras_.empty());
+    EXPECT_TRUE(handler.queryItems_.empty());
+    EXPECT_TRUE(handler.metaItems_.empty());
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
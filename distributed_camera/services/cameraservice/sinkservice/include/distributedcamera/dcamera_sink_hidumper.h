@@ -34,6 +34,10 @@ enum class HidumpFlag {
     GET_VERSION_INFO,
     START_DUMP,
     STOP_DUMP,
+    GET_PIPELINE_STATS,
+    GET_FRAME_DROP_INFO,
+    GET_MEMORY_INFO,
+    GET_STARTUP_INFO,
 };
 
 struct CameraDumpInfo {
@@ -59,6 +63,10 @@ private:
     int32_t GetLocalCameraNumber(std::string& result);
     int32_t GetOpenedCameraInfo(std::string& result);
     int32_t GetVersionInfo(std::string& result);
+    int32_t GetPipelineStats(std::string& result);
+    int32_t GetFrameDropInfo(std::string& result);
+    int32_t GetMemoryInfo(std::string& result);
+    int32_t GetStartupInfo(std::string& result);
 
 private:
     CameraDumpInfo camDumpInfo_;
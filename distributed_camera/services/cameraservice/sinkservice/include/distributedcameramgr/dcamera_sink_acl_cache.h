@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_SINK_ACL_CACHE_H
+#define OHOS_DCAMERA_SINK_ACL_CACHE_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "device_manager_callback.h"
+#include "dhfwk_single_instance.h"
+#ifdef OS_ACCOUNT_ENABLE
+#include "os_account_subscriber.h"
+#endif
+
+namespace OHOS {
+namespace DistributedHardware {
+struct DCameraAclKey {
+    std::string srcNetworkId;
+    int32_t userId = -1;
+    uint64_t tokenId = 0;
+    std::string accountId;
+    uint64_t sinkTokenId = 0;
+
+    bool operator<(const DCameraAclKey &other) const
+    {
+        return std::tie(srcNetworkId, userId, tokenId, accountId, sinkTokenId) <
+            std::tie(other.srcNetworkId, other.userId, other.tokenId, other.accountId, other.sinkTokenId);
+    }
+};
+
+template <typename T>
+struct DCameraAclCacheEntry {
+    T value;
+    int64_t cachedMs = 0;
+};
+
+/*
+ * Granted ACL decisions, udids and device security levels of the sink. Checking them costs several IPCs per start
+ * capture, while they only change when the local account switches, a device goes offline or changes trust, or the
+ * device manager restarts. Each of those drops the whole cache and entries also age out after ENTRY_TTL_MS, which
+ * bounds changes no event is delivered for. Denials are never cached, a newly granted access is seen at once.
+ */
+class DCameraSinkAclCache {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraSinkAclCache);
+public:
+    // Values looked up before an invalidation are not cached, callers pass the generation read before the lookup.
+    uint64_t GetGeneration();
+    bool IsAclGranted(const DCameraAclKey &key);
+    void CacheAclGranted(const DCameraAclKey &key, uint64_t generation);
+    bool GetUdid(const std::string &networkId, std::string &udid);
+    void CacheUdid(const std::string &networkId, const std::string &udid, uint64_t generation);
+    bool GetSecurityLevel(const std::string &udid, int32_t &level);
+    void CacheSecurityLevel(const std::string &udid, int32_t level, uint64_t generation);
+    void Invalidate(const std::string &reason);
+    // The device manager must be initialized, registering again after it died is allowed.
+    void RegisterListeners();
+    void OnDeviceManagerDied();
+
+private:
+    DCameraSinkAclCache() = default;
+    ~DCameraSinkAclCache() = default;
+
+    class DeviceStateListener : public DeviceStateCallback {
+    public:
+        void OnDeviceOnline(const DmDeviceInfo &deviceInfo) override;
+        void OnDeviceOffline(const DmDeviceInfo &deviceInfo) override;
+        void OnDeviceChanged(const DmDeviceInfo &deviceInfo) override;
+        void OnDeviceReady(const DmDeviceInfo &deviceInfo) override;
+    };
+#ifdef OS_ACCOUNT_ENABLE
+    class AccountSwitchListener : public AccountSA::OsAccountSubscriber {
+    public:
+        explicit AccountSwitchListener(const AccountSA::OsAccountSubscribeInfo &subscribeInfo)
+            : AccountSA::OsAccountSubscriber(subscribeInfo) {}
+        void OnAccountsChanged(const int &id) override;
+    };
+#endif
+
+    template <typename K, typename V>
+    bool FindEntry(std::map<K, DCameraAclCacheEntry<V>> &cache, const K &key, V &value);
+    template <typename K, typename V>
+    void StoreEntry(std::map<K, DCameraAclCacheEntry<V>> &cache, const K &key, const V &value, uint64_t generation);
+
+    constexpr static int64_t ENTRY_TTL_MS = 60000;
+    constexpr static size_t MAX_ENTRIES = 64;
+
+    std::mutex cacheMutex_;
+    uint64_t generation_ = 0;
+    std::map<DCameraAclKey, DCameraAclCacheEntry<bool>> aclGrants_;
+    std::map<std::string, DCameraAclCacheEntry<std::string>> udids_;
+    std::map<std::string, DCameraAclCacheEntry<int32_t>> securityLevels_;
+
+    std::mutex listenerMutex_;
+    std::shared_ptr<DeviceStateListener> deviceStateListener_;
+#ifdef OS_ACCOUNT_ENABLE
+    std::shared_ptr<AccountSwitchListener> accountSwitchListener_;
+#endif
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_SINK_ACL_CACHE_H
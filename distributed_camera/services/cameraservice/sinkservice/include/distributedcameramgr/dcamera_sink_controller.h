@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -23,8 +23,10 @@
 #include "icamera_operator.h"
 #include "icamera_sink_access_control.h"
 #include "icamera_sink_output.h"
+#include "dcamera_sink_degradation_policy.h"
 #include <mutex>
 #include <atomic>
+#include <map>
 #include "device_manager.h"
 #include "device_manager_callback.h"
 #include "property_carrier.h"
@@ -79,6 +81,8 @@ public:
                 EVENT_START_BASE = 100,
                 EVENT_ENCODER_PREPARED,
                 EVENT_CAMERA_PREPARED,
+                EVENT_PRE_OPEN_TIMEOUT,
+                EVENT_DEGRADATION_CHECK,
             };
         private:
             std::weak_ptr<DCameraSinkController> sinkContrWPtr_;
@@ -88,6 +92,9 @@ private:
     int32_t StartCaptureInner(std::vector<std::shared_ptr<DCameraCaptureInfo>>& captureInfos);
     int32_t DCameraNotifyInner(int32_t type, int32_t result, std::string content);
     int32_t HandleReceivedData(std::shared_ptr<DataBuffer>& dataBuffer);
+    int32_t HandleReceivedCommand(const std::string &command, const cJSON *rootValue);
+    int32_t HandleReceivedBinary(std::shared_ptr<DataBuffer>& dataBuffer);
+    int32_t RequestKeyFrame();
     void PostAuthorization(std::vector<std::shared_ptr<DCameraCaptureInfo>>& captureInfos);
     bool CheckDeviceSecurityLevel(const std::string &srcDeviceId, const std::string &dstDeviceId);
     int32_t GetDeviceSecurityLevel(const std::string &udid);
@@ -107,6 +114,18 @@ private:
     };
     void HandleCaptureError(int32_t errorCode, const std::string& errorMsg);
     void CheckAndCommitCapture();
+    void TryPreOpenCapture(const std::string &networkId);
+    void ProcessPreOpenTimeout();
+    void RecordSceneMode(const std::string &networkId, int32_t sceneMode);
+    bool IsWarmPauseEnabled();
+    void StartDegradationCheck();
+    void StopDegradationCheck();
+    void ProcessDegradationCheck();
+    void ApplyDegradation(const DegradationStep& step);
+    int32_t UpdateFrameRate(int32_t fpsPercent);
+    static std::vector<int32_t> GetFpsRange(const std::vector<std::shared_ptr<DCameraCaptureInfo>>& captureInfos);
+    static int32_t GetThermalLevel();
+    static int32_t GetPowerMode();
 
     std::atomic<bool> isEncoderReady_ {false};
     std::atomic<bool> isCameraReady_ {false};
@@ -130,6 +149,7 @@ private:
     std::shared_ptr<ICameraSinkOutput> output_;
     sptr<IDCameraSinkCallback> sinkCallback_;
     std::atomic<bool> isPageStatus_ = false;
+    std::atomic<int32_t> controlFormat_ = 0;
     std::shared_ptr<DmInitCallback> initCallback_;
     bool isSensitive_ = false;
     bool isSameAccount_ = false;
@@ -155,6 +175,20 @@ private:
     std::mutex captureStateMutex_;
     std::condition_variable captureStateCv_;
     DcameraCaptureState captureState_ {CAPTURE_IDLE};
+
+    constexpr static const char *PRE_OPEN_PARA = "sys.dcamera.sink.pre.open";
+    constexpr static const char *WARM_PAUSE_PARA = "sys.dcamera.sink.warm.pause";
+    // A warm pause keeps the camera session running and only holds frames back, resume skips the session start.
+    std::atomic<bool> isWarmPaused_ {false};
+    constexpr static int64_t PRE_OPEN_TIMEOUT_MS = 3000;
+    constexpr static size_t MAX_SCENE_MODE_ENTRIES = 8;
+    // Scene mode of the last capture each source started, guarded by captureStateMutex_.
+    std::map<std::string, int32_t> lastSceneModes_;
+    DCameraSinkDegradationPolicy degradationPolicy_;
+    // Frame rate range the source asked for, the fps step scales it. Guarded by captureStateMutex_.
+    std::vector<int32_t> fpsRange_;
+    constexpr static uint32_t FPS_RANGE_SIZE = 2;
+    constexpr static int32_t PERCENT_BASE = 100;
 };
 
 class DeviceInitCallback : public DmInitCallback {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,11 +16,15 @@
 #ifndef OHOS_DCAMERA_SINK_DATA_PROCESS_H
 #define OHOS_DCAMERA_SINK_DATA_PROCESS_H
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <thread>
 
-#include "event_handler.h"
+#include "dcamera_node_stats.h"
+#include "dcamera_serial_queue.h"
+#include "dcamera_sink_frame_pacer.h"
 #include "icamera_channel.h"
 #include "icamera_sink_data_process.h"
 #include "idata_process_pipeline.h"
@@ -45,8 +49,13 @@ public:
 
     int32_t OnProcessedVideoBuffer(const std::shared_ptr<DataBuffer>& videoResult);
     void OnError(DataProcessErrorType errorType);
+    bool WaitSendCredit(int64_t timeoutMs);
 
     int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
+    void OnLinkCapacity(int64_t bandwidthBps) override;
+    void SetBitratePercent(int32_t percent) override;
+    void RequestKeyFrame() override;
+    void SetFramePaused(bool isPaused) override;
 
 private:
 #ifdef DCAMERA_OPEN_STABILE
@@ -62,21 +71,60 @@ private:
     int32_t FeedStreamInner(std::shared_ptr<DataBuffer>& dataBuffer);
     VideoCodecType GetPipelineCodecType(DCEncodeType encodeType);
     Videoformat GetPipelineFormat(int32_t format);
-    void StartEventHandler();
+    Videoformat GetCaptureFormat(const std::shared_ptr<DCameraCaptureInfo>& captureInfo);
+    struct SendFrame {
+        std::shared_ptr<DataBuffer> buffer;
+        bool isKeyFrame = true;
+        bool holdsCredit = false;
+        int64_t enqueueUs = 0;
+    };
+
     void SendDataAsync(const std::shared_ptr<DataBuffer>& buffer);
+    bool EnqueueSendFrame(const std::shared_ptr<DataBuffer>& buffer, bool holdsCredit,
+        const std::weak_ptr<IDataProcessPipeline>& weakPipeline, const std::shared_ptr<DCameraSinkFramePacer>& pacer);
+    void SendNextFrame(const std::weak_ptr<IDataProcessPipeline>& weakPipeline,
+        const std::shared_ptr<DCameraSinkFramePacer>& pacer);
+    void DropSendFrame(const SendFrame& frame, DCameraDropReason reason);
+    void ClearSendFrames();
+    static bool IsKeyFrame(const std::shared_ptr<DataBuffer>& buffer);
+    bool AcquireSendCredit();
+    void ReturnSendCredit();
+    void ResetSendCredits();
     int32_t GetMaxFrameRate(std::shared_ptr<DCameraCaptureInfo>& captureInfo);
+    static bool IsPacingEnabled();
 
     const uint32_t DCAMERA_FPS_SIZE = 2;
+    // One video frame on the wire and one queued behind it on the send thread.
+    constexpr static int32_t MAX_SEND_CREDITS = 2;
+    // Snapshots are never paced by credits, the oldest one gives way once this many wait for the channel.
+    constexpr static size_t MAX_SNAPSHOT_PENDING = 4;
+    // A delta frame that waited longer is stale, it and the deltas behind it are dropped until a key frame.
+    constexpr static int64_t MAX_SEND_QUEUE_AGE_US = 200000;
+    constexpr static int32_t FULL_BITRATE_PERCENT = 100;
+    constexpr static const char *PACING_ENABLE_PARA = "sys.dcamera.sink.pacing.enable";
 
     std::string dhId_;
     std::shared_ptr<DCameraCaptureInfo> captureInfo_;
     std::shared_ptr<ICameraChannel> channel_;
     std::shared_ptr<IDataProcessPipeline> pipeline_;
+    std::shared_ptr<DCameraStreamDropCounter> dropCounter_;
+    std::shared_ptr<DCameraMemoryAccount> memoryAccount_;
+    // Only touched by the send tasks, which run one at a time on eventQueue_.
+    std::shared_ptr<DCameraSinkFramePacer> framePacer_;
 
-    std::mutex eventMutex_;
-    std::thread eventThread_;
-    std::condition_variable eventCon_;
-    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
+    std::shared_ptr<DCameraSerialQueue> eventQueue_;
+    // Every send task pops the front frame, a frame dropped from the queue leaves its task without work.
+    std::mutex sendMutex_;
+    std::deque<SendFrame> sendFrames_;
+    bool isWaitKeyFrame_ = false;
+    const std::shared_ptr<DCameraNodeStats> sendStats_ = std::make_shared<DCameraNodeStats>();
+    std::mutex creditMutex_;
+    std::condition_variable creditCond_;
+    int32_t sendCredits_ = MAX_SEND_CREDITS;
+    // Kept here so a pipeline built after the report starts under the same cap.
+    std::atomic<int64_t> linkCapacityBps_ {0};
+    std::atomic<int32_t> bitratePercent_ {FULL_BITRATE_PERCENT};
+    std::atomic<bool> isFramePaused_ {false};
     FILE *dumpFile_ = nullptr;
 };
 } // namespace DistributedHardware
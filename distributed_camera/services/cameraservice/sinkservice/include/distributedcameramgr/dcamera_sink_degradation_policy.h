@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_SINK_DEGRADATION_POLICY_H
+#define OHOS_DCAMERA_SINK_DEGRADATION_POLICY_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace OHOS {
+namespace DistributedHardware {
+/* Each level keeps the steps of the levels below it. */
+enum class DegradationLevel : int32_t {
+    NONE = 0,
+    FPS = 1,
+    RESOLUTION = 2,
+    BITRATE = 3,
+};
+
+struct DegradationStep {
+    DegradationLevel level = DegradationLevel::NONE;
+    int32_t fpsPercent = 100;
+    // Share of the width and height the source should reconfigure the stream to, the sink cannot resize live.
+    int32_t resolutionPercent = 100;
+    int32_t bitratePercent = 100;
+};
+
+/*
+ * Degrades the sink capture under thermal or battery pressure. The pressure of the thermal level and of the power
+ * mode is the level the capture steps up to at once, a lower pressure has to hold for RECOVER_HOLD_US before the
+ * capture steps back one level, so a device hovering at a thermal boundary does not toggle the stream.
+ */
+class DCameraSinkDegradationPolicy {
+public:
+    static DegradationLevel GetThermalPressure(int32_t thermalLevel);
+    static DegradationLevel GetPowerModePressure(int32_t powerMode);
+    static DegradationStep GetStep(DegradationLevel level);
+    // Event content the source receives, "<prefix> level:<n> fps:<p> resolution:<p> bitrate:<p>" in percent.
+    static std::string MakeNotifyContent(const DegradationStep& step);
+
+    void Reset();
+    // Returns true when the level changed.
+    bool Evaluate(int32_t thermalLevel, int32_t powerMode, int64_t nowUs, DegradationLevel& level);
+    DegradationLevel GetLevel();
+
+    constexpr static int64_t POLL_INTERVAL_MS = 5000;
+    constexpr static int64_t RECOVER_HOLD_US = 30000000;
+
+private:
+    // Thermal levels and device modes of the power manager.
+    constexpr static int32_t THERMAL_LEVEL_WARM = 2;
+    constexpr static int32_t THERMAL_LEVEL_HOT = 3;
+    constexpr static int32_t THERMAL_LEVEL_OVERHEATED = 4;
+    constexpr static int32_t POWER_MODE_POWER_SAVE = 601;
+    constexpr static int32_t POWER_MODE_EXTREME_POWER_SAVE = 603;
+
+    std::mutex mutex_;
+    DegradationLevel level_ = DegradationLevel::NONE;
+    int64_t relievedSinceUs_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_SINK_DEGRADATION_POLICY_H
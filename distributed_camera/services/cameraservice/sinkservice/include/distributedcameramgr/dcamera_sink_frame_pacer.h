@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_SINK_FRAME_PACER_H
+#define OHOS_DCAMERA_SINK_FRAME_PACER_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Paces encoded frames onto the channel by their sensor timestamps. The first frame anchors the sensor clock to the
+ * local clock and every later frame is held until its sensor offset from the anchor has passed locally, so the
+ * jitter of the camera HAL and the encoder is taken out on the sink. A frame is held at most one frame interval.
+ * A late frame is sent at once, a frame too late, a sensor gap or a stepped back timestamp takes a new anchor.
+ */
+class DCameraSinkFramePacer {
+public:
+    explicit DCameraSinkFramePacer(int32_t fps);
+    ~DCameraSinkFramePacer() = default;
+
+    int64_t GetSendDelayUs(int64_t sensorTimeUs, int64_t nowUs);
+    void Reset();
+
+private:
+    void Anchor(int64_t sensorTimeUs, int64_t localTimeUs);
+
+    constexpr static int64_t US_PER_SECOND = 1000000;
+    constexpr static int64_t REANCHOR_INTERVALS = 3;
+
+    int64_t frameIntervalUs_ = 0;
+    bool isAnchored_ = false;
+    int64_t anchorSensorUs_ = 0;
+    int64_t anchorLocalUs_ = 0;
+    int64_t lastSensorUs_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_SINK_FRAME_PACER_H
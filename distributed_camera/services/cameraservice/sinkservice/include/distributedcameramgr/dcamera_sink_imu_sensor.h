@@ -16,27 +16,22 @@
 #ifndef DCAMERA_SINK_IMU_SENSOR_H
 #define DCAMERA_SINK_IMU_SENSOR_H
  
-#include <string>
 #include <mutex>
-#include <queue>
 
+#include "data_buffer.h"
+#include "dcamera_imu_ring.h"
 #include "dcamera_utils_tools.h"
 #include "dhfwk_single_instance.h"
  
 namespace OHOS {
 namespace DistributedHardware {
-struct SensorData {
-    int64_t timeStamp = -1;
-    double data[3];
-};
-
 class DCameraSinkImuSensor {
 FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraSinkImuSensor);
  
 public:
-    void SaveAccInfo(const SensorData data);
-    void SaveGyroInfo(const SensorData data);
-    std::string PackedImuData();
+    void SaveAccInfo(const ImuSample& data);
+    void SaveGyroInfo(const ImuSample& data);
+    void GetImuData(EisInfo& eisInfo);
     void SetSinkEis(bool eis);
     bool GetSinkEis();
  
@@ -44,9 +39,13 @@ private:
     DCameraSinkImuSensor() = default;
     ~DCameraSinkImuSensor();
 
-    std::mutex mutex_;
-    std::queue<SensorData> accInfoQueue;
-    std::queue<SensorData> gyroInfoQueue;
+    void ReadLatest(const DCameraImuRing& ring, uint64_t& cursor, std::vector<ImuSample>& samples);
+
+    DCameraImuRing accRing_;
+    DCameraImuRing gyroRing_;
+    std::mutex cursorMutex_;
+    uint64_t accCursor_ = 0;
+    uint64_t gyroCursor_ = 0;
     bool eis_ = false;
 };
 } // namespace DistributedHardware
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -46,8 +46,12 @@ public:
     void OnSessionState(DCStreamType type, int32_t state);
     void OnSessionError(DCStreamType type, int32_t eventType, int32_t eventReason, std::string detail);
     void OnDataReceived(DCStreamType type, std::vector<std::shared_ptr<DataBuffer>>& dataBuffers);
+    void OnLinkQuality(DCStreamType type, const DCameraLinkQuality& quality);
 
     int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
+    void RequestKeyFrame() override;
+    void SetFramePaused(bool isPaused) override;
+    void SetBitratePercent(int32_t percent) override;
 
 private:
     void InitInner(DCStreamType type);
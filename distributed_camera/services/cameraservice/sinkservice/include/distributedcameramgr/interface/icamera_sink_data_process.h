@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -36,6 +36,12 @@ public:
     virtual int32_t FeedStream(std::shared_ptr<DataBuffer>& dataBuffer) = 0;
     virtual void Init() = 0;
     virtual int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) = 0;
+    /* Bandwidth the link can carry in bit/s, 0 when softbus reports no limit. */
+    virtual void OnLinkCapacity(int64_t bandwidthBps) {}
+    /* Share in percent of the maximum encoder bitrate, 100 lifts the limit. */
+    virtual void SetBitratePercent(int32_t percent) {}
+    virtual void RequestKeyFrame() {}
+    virtual void SetFramePaused(bool isPaused) {}
 };
 } // namespace DistributedHardware
 } // namespace OHOS
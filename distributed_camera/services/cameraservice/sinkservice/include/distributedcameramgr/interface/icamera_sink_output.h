@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -38,6 +38,12 @@ public:
     virtual int32_t OpenChannel(std::shared_ptr<DCameraChannelInfo>& info) = 0;
     virtual int32_t CloseChannel() = 0;
     virtual int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) = 0;
+    /* The source lost frames of the continuous stream, the encoder answers with a key frame. */
+    virtual void RequestKeyFrame() {}
+    /* Warm pause, camera, encoder and channel stay up and only the continuous frames stop before the encoder. */
+    virtual void SetFramePaused(bool isPaused) {}
+    /* Degradation step of the continuous stream, in percent of the maximum encoder bitrate. */
+    virtual void SetBitratePercent(int32_t percent) {}
 };
 } // namespace DistributedHardware
 } // namespace OHOS
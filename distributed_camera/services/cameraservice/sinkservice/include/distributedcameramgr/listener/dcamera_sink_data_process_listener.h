@@ -29,6 +29,7 @@ public:
 
     int32_t OnProcessedVideoBuffer(const std::shared_ptr<DataBuffer>& videoResult) override;
     void OnError(DataProcessErrorType errorType) override;
+    bool WaitOutputWritable(int64_t timeoutMs) override;
 
 private:
     std::weak_ptr<DCameraSinkDataProcess> dataProcess_;
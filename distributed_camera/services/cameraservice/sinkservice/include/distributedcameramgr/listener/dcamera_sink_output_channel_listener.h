@@ -30,6 +30,7 @@ public:
     void OnSessionState(int32_t state, std::string networkId) override;
     void OnSessionError(int32_t eventType, int32_t eventReason, std::string detail) override;
     void OnDataReceived(std::vector<std::shared_ptr<DataBuffer>>& buffers) override;
+    void OnLinkQuality(const DCameraLinkQuality& quality) override;
 
 private:
     DCStreamType streamType_;
@@ -15,7 +15,11 @@
 
 #include "dcamera_sink_hidumper.h"
 
+#include "dcamera_frame_drop_statistics.h"
 #include "dcamera_hidumper.h"
+#include "dcamera_memory_account.h"
+#include "dcamera_node_stats.h"
+#include "dcamera_startup_profiler.h"
 #include "distributed_camera_errno.h"
 #include "distributed_camera_sink_service.h"
 #include "distributed_hardware_log.h"
@@ -31,6 +35,10 @@ const std::string ARGS_CAMERA_INFO = "--camNum";
 const std::string ARGS_START_DUMP = "--startdump";
 const std::string ARGS_STOP_DUMP = "--stopdump";
 const std::string ARGS_OPENED_INFO = "--opened";
+const std::string ARGS_PIPELINE_STATS = "--pipelineStats";
+const std::string ARGS_FRAME_DROP_INFO = "--frameDrop";
+const std::string ARGS_MEMORY_INFO = "--memory";
+const std::string ARGS_STARTUP_INFO = "--startup";
 
 const std::map<std::string, HidumpFlag> ARGS_MAP = {
     { ARGS_HELP, HidumpFlag::GET_HELP },
@@ -39,6 +47,10 @@ const std::map<std::string, HidumpFlag> ARGS_MAP = {
     { ARGS_VERSION_INFO, HidumpFlag::GET_VERSION_INFO },
     { ARGS_START_DUMP, HidumpFlag::START_DUMP },
     { ARGS_STOP_DUMP, HidumpFlag::STOP_DUMP },
+    { ARGS_PIPELINE_STATS, HidumpFlag::GET_PIPELINE_STATS },
+    { ARGS_FRAME_DROP_INFO, HidumpFlag::GET_FRAME_DROP_INFO },
+    { ARGS_MEMORY_INFO, HidumpFlag::GET_MEMORY_INFO },
+    { ARGS_STARTUP_INFO, HidumpFlag::GET_STARTUP_INFO },
 };
 }
 
@@ -114,6 +126,22 @@ int32_t DcameraSinkHidumper::ProcessDump(const std::string& args, std::string& r
             result.append("Send stop dump order ok\n");
             break;
         }
+        case HidumpFlag::GET_PIPELINE_STATS: {
+            ret = GetPipelineStats(result);
+            break;
+        }
+        case HidumpFlag::GET_FRAME_DROP_INFO: {
+            ret = GetFrameDropInfo(result);
+            break;
+        }
+        case HidumpFlag::GET_MEMORY_INFO: {
+            ret = GetMemoryInfo(result);
+            break;
+        }
+        case HidumpFlag::GET_STARTUP_INFO: {
+            ret = GetStartupInfo(result);
+            break;
+        }
         default: {
             ret = ShowIllegalInfomation(result);
             break;
@@ -151,6 +179,34 @@ int32_t DcameraSinkHidumper::GetVersionInfo(std::string& result)
     return DCAMERA_OK;
 }
 
+int32_t DcameraSinkHidumper::GetPipelineStats(std::string& result)
+{
+    DHLOGI("GetPipelineStats Dump.");
+    DCameraPipelineStatsRegistry::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
+int32_t DcameraSinkHidumper::GetFrameDropInfo(std::string& result)
+{
+    DHLOGI("GetFrameDropInfo Dump.");
+    DCameraFrameDropStatistics::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
+int32_t DcameraSinkHidumper::GetMemoryInfo(std::string& result)
+{
+    DHLOGI("GetMemoryInfo Dump.");
+    DCameraMemoryStatistics::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
+int32_t DcameraSinkHidumper::GetStartupInfo(std::string& result)
+{
+    DHLOGI("GetStartupInfo Dump.");
+    DCameraStartupProfiler::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
 void DcameraSinkHidumper::ShowHelp(std::string& result)
 {
     DHLOGI("ShowHelp Dump.");
@@ -167,7 +223,15 @@ void DcameraSinkHidumper::ShowHelp(std::string& result)
         .append("--startdump  ")
         .append(": dump camera data in /data/data/dcamera\n")
         .append("--stopdump   ")
-        .append(": stop dump camera data\n");
+        .append(": stop dump camera data\n")
+        .append("--pipelineStats ")
+        .append(": dump per node counters of the running pipelines\n")
+        .append("--frameDrop  ")
+        .append(": dump dropped frames by reason of the running streams\n")
+        .append("--memory     ")
+        .append(": dump live and peak buffer bytes of the running sessions\n")
+        .append("--startup    ")
+        .append(": dump how long the service start phases took\n");
 }
 
 int32_t DcameraSinkHidumper::ShowIllegalInfomation(std::string& result)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -28,8 +28,11 @@
 #include "dcamera_hisysevent_adapter.h"
 #include "dcamera_sink_service_ipc.h"
 #include "dcamera_softbus_adapter.h"
+#include "dcamera_startup_profiler.h"
+#include "dcamera_thread_role.h"
 #include "dcamera_utils_tools.h"
 #include "distributed_camera_allconnect_manager.h"
+#include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 #include "token_setproc.h"
@@ -54,20 +57,14 @@ void DistributedCameraSinkService::OnStart()
     CHECK_AND_RETURN_LOG(state_ == DCameraServiceState::DCAMERA_SRV_STATE_RUNNING,
         "sink service has already started.");
 
+    // The allconnect so is loaded when the first control session binds.
+    DCameraStartupPhase phase("SinkOnStart");
+    DCameraThreadRoleRegistry::ApplyIpcThreadNum(DCAMERA_SA_PROCESS_NAME);
     if (!Init()) {
         DHLOGE("DistributedCameraSinkService init failed");
         return;
     }
     state_ = DCameraServiceState::DCAMERA_SRV_STATE_RUNNING;
-    if (!DCameraAllConnectManager::IsInited()) {
-        DCameraAllConnectManager::GetInstance().InitDCameraAllConnectManager();
-        int32_t ret = DCameraAllConnectManager::GetInstance().RegisterLifecycleCallback();
-        if (ret != DCAMERA_OK) {
-            DHLOGE("DCamera allconnect sink init and register lifecycle callback failed");
-        } else {
-            DHLOGI("DCamera allconnect sink init and register lifecycle callback success");
-        }
-    }
     DHLOGI("DCameraServiceState OnStart service success.");
     // LCOV_EXCL_STOP
 }
@@ -78,6 +75,7 @@ bool DistributedCameraSinkService::Init()
     DHLOGI("DistributedCameraSinkService start init");
     DCameraSinkServiceIpc::GetInstance().Init();
     if (!registerToService_) {
+        DCameraStartupPhase phase("SinkPublish");
         bool ret = Publish(this);
         CHECK_AND_RETURN_RET_LOG(!ret, false, "Publish service failed");
         registerToService_ = true;
@@ -112,7 +110,11 @@ int32_t DistributedCameraSinkService::InitSink(const std::string& params,
 {
     DHLOGI("start");
     sinkVer_ = params;
-    int32_t ret = DCameraHandler::GetInstance().Initialize();
+    int32_t ret = DCAMERA_OK;
+    {
+        DCameraStartupPhase phase("SinkHandlerInit");
+        ret = DCameraHandler::GetInstance().Initialize();
+    }
     CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, ret, "handler initialize failed, ret: %{public}d", ret);
 
     std::vector<std::string> cameras = DCameraHandler::GetInstance().GetCameras();
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_sink_acl_cache.h"
+
+#include "anonymous_string.h"
+#include "dcamera_utils_tools.h"
+#include "device_manager.h"
+#include "distributed_camera_constants.h"
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+#ifdef OS_ACCOUNT_ENABLE
+#include "os_account_manager.h"
+#endif
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraSinkAclCache);
+
+uint64_t DCameraSinkAclCache::GetGeneration()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return generation_;
+}
+
+bool DCameraSinkAclCache::IsAclGranted(const DCameraAclKey &key)
+{
+    bool isGranted = false;
+    return FindEntry(aclGrants_, key, isGranted) && isGranted;
+}
+
+void DCameraSinkAclCache::CacheAclGranted(const DCameraAclKey &key, uint64_t generation)
+{
+    StoreEntry(aclGrants_, key, true, generation);
+}
+
+bool DCameraSinkAclCache::GetUdid(const std::string &networkId, std::string &udid)
+{
+    return FindEntry(udids_, networkId, udid);
+}
+
+void DCameraSinkAclCache::CacheUdid(const std::string &networkId, const std::string &udid, uint64_t generation)
+{
+    StoreEntry(udids_, networkId, udid, generation);
+}
+
+bool DCameraSinkAclCache::GetSecurityLevel(const std::string &udid, int32_t &level)
+{
+    return FindEntry(securityLevels_, udid, level);
+}
+
+void DCameraSinkAclCache::CacheSecurityLevel(const std::string &udid, int32_t level, uint64_t generation)
+{
+    StoreEntry(securityLevels_, udid, level, generation);
+}
+
+void DCameraSinkAclCache::Invalidate(const std::string &reason)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    generation_++;
+    if (aclGrants_.empty() && udids_.empty() && securityLevels_.empty()) {
+        return;
+    }
+    DHLOGI("Invalidate sink acl cache, reason: %{public}s", reason.c_str());
+    aclGrants_.clear();
+    udids_.clear();
+    securityLevels_.clear();
+}
+
+void DCameraSinkAclCache::RegisterListeners()
+{
+    std::lock_guard<std::mutex> lock(listenerMutex_);
+    if (deviceStateListener_ == nullptr) {
+        auto listener = std::make_shared<DeviceStateListener>();
+        int32_t ret = DeviceManager::GetInstance().RegisterDevStateCallback(DCAMERA_PKG_NAME, "", listener);
+        if (ret == DCAMERA_OK) {
+            deviceStateListener_ = listener;
+        } else {
+            DHLOGE("Register device state callback failed, ret: %{public}d", ret);
+        }
+    }
+#ifdef OS_ACCOUNT_ENABLE
+    if (accountSwitchListener_ == nullptr) {
+        AccountSA::OsAccountSubscribeInfo subscribeInfo(AccountSA::OS_ACCOUNT_SUBSCRIBE_TYPE::SWITCHED,
+            "dcamera_sink_acl_cache");
+        auto listener = std::make_shared<AccountSwitchListener>(subscribeInfo);
+        int32_t ret = AccountSA::OsAccountManager::SubscribeOsAccount(listener);
+        if (ret == DCAMERA_OK) {
+            accountSwitchListener_ = listener;
+        } else {
+            DHLOGE("Subscribe os account switch failed, ret: %{public}d", ret);
+        }
+    }
+#endif
+}
+
+void DCameraSinkAclCache::OnDeviceManagerDied()
+{
+    {
+        // The device state callback died with the device manager, the next check registers it again.
+        std::lock_guard<std::mutex> lock(listenerMutex_);
+        deviceStateListener_ = nullptr;
+    }
+    Invalidate("device manager died");
+}
+
+template <typename K, typename V>
+bool DCameraSinkAclCache::FindEntry(std::map<K, DCameraAclCacheEntry<V>> &cache, const K &key, V &value)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    auto iter = cache.find(key);
+    if (iter == cache.end()) {
+        return false;
+    }
+    if (GetNowTimeStampMs() - iter->second.cachedMs > ENTRY_TTL_MS) {
+        cache.erase(iter);
+        return false;
+    }
+    value = iter->second.value;
+    return true;
+}
+
+template <typename K, typename V>
+void DCameraSinkAclCache::StoreEntry(std::map<K, DCameraAclCacheEntry<V>> &cache, const K &key, const V &value,
+    uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (generation != generation_) {
+        return;
+    }
+    if (cache.size() >= MAX_ENTRIES && cache.find(key) == cache.end()) {
+        cache.clear();
+    }
+    cache[key] = { value, GetNowTimeStampMs() };
+}
+
+void DCameraSinkAclCache::DeviceStateListener::OnDeviceOnline(const DmDeviceInfo &deviceInfo)
+{
+    (void)deviceInfo;
+}
+
+void DCameraSinkAclCache::DeviceStateListener::OnDeviceOffline(const DmDeviceInfo &deviceInfo)
+{
+    DHLOGI("Device offline, networkId: %{public}s", GetAnonyString(deviceInfo.networkId).c_str());
+    DCameraSinkAclCache::GetInstance().Invalidate("device offline");
+}
+
+void DCameraSinkAclCache::DeviceStateListener::OnDeviceChanged(const DmDeviceInfo &deviceInfo)
+{
+    DHLOGI("Device changed, networkId: %{public}s", GetAnonyString(deviceInfo.networkId).c_str());
+    DCameraSinkAclCache::GetInstance().Invalidate("device changed");
+}
+
+void DCameraSinkAclCache::DeviceStateListener::OnDeviceReady(const DmDeviceInfo &deviceInfo)
+{
+    (void)deviceInfo;
+}
+
+#ifdef OS_ACCOUNT_ENABLE
+void DCameraSinkAclCache::AccountSwitchListener::OnAccountsChanged(const int &id)
+{
+    DHLOGI("Os account switched to %{public}d", id);
+    DCameraSinkAclCache::GetInstance().Invalidate("os account switched");
+}
+#endif
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include "dcamera_sink_controller.h"
 
+#include <algorithm>
 #include <securec.h>
 #include <thread>
 #include <chrono>
@@ -27,11 +28,13 @@
 #include "dcamera_utils_tools.h"
 
 #include "dcamera_sink_access_control.h"
+#include "dcamera_sink_acl_cache.h"
 #include "dcamera_sink_controller_channel_listener.h"
 #include "dcamera_sink_controller_state_callback.h"
 #include "dcamera_sink_imu_sensor.h"
 #include "dcamera_sink_output.h"
 #include "dcamera_sink_service_ipc.h"
+#include "dcamera_thread_role.h"
 
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
@@ -44,10 +47,17 @@
 #include "idistributed_camera_source.h"
 #include "ipc_skeleton.h"
 #include "dcamera_low_latency.h"
+#include "metadata_utils.h"
 #ifdef OS_ACCOUNT_ENABLE
 #include "ohos_account_kits.h"
 #include "os_account_manager.h"
 #endif
+#ifdef DCAMERA_THERMAL_ENABLE
+#include "thermal_mgr_client.h"
+#endif
+#ifdef DCAMERA_POWER_MODE_ENABLE
+#include "power_mgr_client.h"
+#endif
 #include <sys/prctl.h>
 
 namespace OHOS {
@@ -128,9 +138,14 @@ int32_t DCameraSinkController::StopCapture()
     }
     if (captureState_ == CAPTURE_IDLE) {
         DHLOGI("StopCapture called when state is already IDLE. dhId: %{public}s", GetAnonyString(dhId_).c_str());
+        if (operator_ != nullptr) {
+            operator_->ReleasePreOpened();
+        }
         return DCAMERA_OK;
     }
     captureState_ = CAPTURE_IDLE;
+    isWarmPaused_.store(false);
+    StopDegradationCheck();
     if (operator_ == nullptr) {
         return DCAMERA_BAD_VALUE;
     }
@@ -158,6 +173,9 @@ int32_t DCameraSinkController::StopCapture()
 int32_t DCameraSinkController::ChannelNeg(std::shared_ptr<DCameraChannelInfo>& info)
 {
     DHLOGI("ChannelNeg dhId: %{public}s", GetAnonyString(dhId_).c_str());
+    if (info != nullptr) {
+        controlFormat_.store(info->controlFormat_);
+    }
     int32_t ret = output_->OpenChannel(info);
     if (ret != DCAMERA_OK) {
         DHLOGE("channel negotiate failed, dhId: %{public}s, ret: %{public}d", GetAnonyString(dhId_).c_str(), ret);
@@ -290,8 +308,11 @@ int32_t DCameraSinkController::OpenChannel(std::shared_ptr<DCameraOpenInfo>& ope
 {
     DHLOGI("DCameraSinkController OpenChannel Start, dhId: %{public}s", GetAnonyString(dhId_).c_str());
     ManageSelectChannel::GetInstance().SetSinkConnect(false);
+    // A sink camera serves one source at a time, the encoder and channels of a session are never shared.
     if (sessionState_ != DCAMERA_CHANNEL_STATE_DISCONNECTED) {
-        DHLOGE("wrong state, dhId: %{public}s, sessionState: %{public}d", GetAnonyString(dhId_).c_str(), sessionState_);
+        DHLOGE("wrong state, dhId: %{public}s, sessionState: %{public}d, in use by: %{public}s, refused: %{public}s",
+            GetAnonyString(dhId_).c_str(), sessionState_, GetAnonyString(srcDevId_).c_str(),
+            GetAnonyString(openInfo->sourceDevId_).c_str());
         return DCAMERA_WRONG_STATE;
     }
     srcDevId_ = openInfo->sourceDevId_;
@@ -524,6 +545,12 @@ void DCameraSinkController::DCameraSinkContrEventHandler::ProcessEvent(const App
             sinkContr->CheckAndCommitCapture();
             break;
         }
+        case EVENT_PRE_OPEN_TIMEOUT:
+            sinkContr->ProcessPreOpenTimeout();
+            break;
+        case EVENT_DEGRADATION_CHECK:
+            sinkContr->ProcessDegradationCheck();
+            break;
         default:
             DHLOGE("event is undefined, id is %d", eventId);
             break;
@@ -595,11 +622,201 @@ void DCameraSinkController::CheckAndCommitCapture()
     }
     captureState_ = CAPTURE_RUNNING;
     captureStateCv_.notify_all();
+    RecordSceneMode(srcDevId_, sceneMode_);
+    fpsRange_ = GetFpsRange(captureInfosCache_);
     
     DCameraNotifyInner(DCAMERA_MESSAGE, DCAMERA_EVENT_CAMERA_SUCCESS, START_CAPTURE_SUCC);
+    StartDegradationCheck();
     DHLOGI("CheckAndCommitCapture successfully started capture.");
 }
 
+void DCameraSinkController::RecordSceneMode(const std::string &networkId, int32_t sceneMode)
+{
+    if (networkId.empty()) {
+        return;
+    }
+    if (lastSceneModes_.find(networkId) == lastSceneModes_.end() &&
+        lastSceneModes_.size() >= MAX_SCENE_MODE_ENTRIES) {
+        lastSceneModes_.erase(lastSceneModes_.begin());
+    }
+    lastSceneModes_[networkId] = sceneMode;
+}
+
+void DCameraSinkController::TryPreOpenCapture(const std::string &networkId)
+{
+    int32_t enable = 0;
+    if (!GetSysPara(PRE_OPEN_PARA, enable) || enable != 1) {
+        return;
+    }
+    CHECK_AND_RETURN_LOG(operator_ == nullptr || sinkCotrEventHandler_ == nullptr, "pre open capture not ready.");
+    int32_t sceneMode = 0;
+    {
+        // Only a source that already ran a capture here gets the camera opened ahead of its capture command.
+        std::lock_guard<std::mutex> lock(captureStateMutex_);
+        auto iter = lastSceneModes_.find(networkId);
+        if (iter == lastSceneModes_.end() || captureState_ != CAPTURE_IDLE) {
+            return;
+        }
+        sceneMode = iter->second;
+    }
+    DHLOGI("pre open capture dhId: %{public}s, mode: %{public}d", GetAnonyString(dhId_).c_str(), sceneMode);
+    std::weak_ptr<DCameraSinkController> weakSelf = shared_from_this();
+    int32_t qos = DCameraThreadRoleRegistry::GetInstance().GetFfrtQos(DCAMERA_THREAD_CONTROL);
+    ffrt::submit([weakSelf, sceneMode]() {
+        auto self = weakSelf.lock();
+        CHECK_AND_RETURN_LOG(self == nullptr, "pre open capture controller released.");
+        int32_t ret = self->operator_->PreOpenCapture(sceneMode);
+        if (ret != DCAMERA_OK) {
+            DHLOGI("pre open capture skipped, ret: %{public}d", ret);
+            return;
+        }
+        AppExecFwk::InnerEvent::Pointer event =
+            AppExecFwk::InnerEvent::Get(DCameraSinkContrEventHandler::EVENT_PRE_OPEN_TIMEOUT);
+        self->sinkCotrEventHandler_->SendEvent(event, PRE_OPEN_TIMEOUT_MS);
+        }, {}, ffrt::task_attr().name("DCamPreOpen").qos(qos));
+}
+
+void DCameraSinkController::ProcessPreOpenTimeout()
+{
+    std::lock_guard<std::mutex> lock(captureStateMutex_);
+    if (captureState_ != CAPTURE_IDLE || operator_ == nullptr) {
+        return;
+    }
+    DHLOGI("pre open capture unused, release camera dhId: %{public}s", GetAnonyString(dhId_).c_str());
+    operator_->ReleasePreOpened();
+}
+
+void DCameraSinkController::StartDegradationCheck()
+{
+    degradationPolicy_.Reset();
+    CHECK_AND_RETURN_LOG(sinkCotrEventHandler_ == nullptr, "sinkCotrEventHandler_ is null.");
+    sinkCotrEventHandler_->RemoveEvent(DCameraSinkContrEventHandler::EVENT_DEGRADATION_CHECK);
+    // A device that is already hot degrades from the first frames on.
+    sinkCotrEventHandler_->SendEvent(DCameraSinkContrEventHandler::EVENT_DEGRADATION_CHECK);
+}
+
+void DCameraSinkController::StopDegradationCheck()
+{
+    if (sinkCotrEventHandler_ != nullptr) {
+        sinkCotrEventHandler_->RemoveEvent(DCameraSinkContrEventHandler::EVENT_DEGRADATION_CHECK);
+    }
+    if (degradationPolicy_.GetLevel() == DegradationLevel::NONE) {
+        return;
+    }
+    degradationPolicy_.Reset();
+    // The camera frame rate goes back with the next capture settings, only the encoder keeps the cap.
+    if (output_ != nullptr) {
+        output_->SetBitratePercent(PERCENT_BASE);
+    }
+}
+
+void DCameraSinkController::ProcessDegradationCheck()
+{
+    {
+        std::lock_guard<std::mutex> lock(captureStateMutex_);
+        if (captureState_ != CAPTURE_RUNNING) {
+            return;
+        }
+    }
+    DegradationLevel level = DegradationLevel::NONE;
+    if (degradationPolicy_.Evaluate(GetThermalLevel(), GetPowerMode(), GetNowTimeStampUs(), level)) {
+        ApplyDegradation(DCameraSinkDegradationPolicy::GetStep(level));
+    }
+    sinkCotrEventHandler_->SendEvent(DCameraSinkContrEventHandler::EVENT_DEGRADATION_CHECK,
+        DCameraSinkDegradationPolicy::POLL_INTERVAL_MS);
+}
+
+void DCameraSinkController::ApplyDegradation(const DegradationStep& step)
+{
+    DHLOGI("ApplyDegradation dhId: %{public}s, level: %{public}d, fps: %{public}d, resolution: %{public}d, "
+        "bitrate: %{public}d", GetAnonyString(dhId_).c_str(), static_cast<int32_t>(step.level), step.fpsPercent,
+        step.resolutionPercent, step.bitratePercent);
+    int32_t ret = UpdateFrameRate(step.fpsPercent);
+    if (ret != DCAMERA_OK) {
+        DHLOGE("ApplyDegradation update frame rate failed, dhId: %{public}s, ret: %{public}d",
+            GetAnonyString(dhId_).c_str(), ret);
+    }
+    if (output_ != nullptr) {
+        output_->SetBitratePercent(step.bitratePercent);
+    }
+    // The stream size is fixed for the capture, the source reconfigures it when the HDI asks for a smaller one.
+    DCameraNotifyInner(DCAMERA_MESSAGE, DCAMERA_EVENT_CAMERA_SUCCESS,
+        DCameraSinkDegradationPolicy::MakeNotifyContent(step));
+}
+
+int32_t DCameraSinkController::UpdateFrameRate(int32_t fpsPercent)
+{
+    std::vector<int32_t> fpsRange;
+    {
+        std::lock_guard<std::mutex> lock(captureStateMutex_);
+        fpsRange = fpsRange_;
+    }
+    if (fpsRange.size() != FPS_RANGE_SIZE) {
+        int32_t defaultFps = static_cast<int32_t>(DCAMERA_PRODUCER_FPS_DEFAULT);
+        fpsRange = { defaultFps, defaultFps };
+    }
+    for (auto& fps : fpsRange) {
+        fps = std::max(fps * fpsPercent / PERCENT_BASE, 1);
+    }
+    std::shared_ptr<Camera::CameraMetadata> cameraMetadata =
+        std::make_shared<Camera::CameraMetadata>(CAMERA_META_DATA_ITEM_CAPACITY, CAMERA_META_DATA_DATA_CAPACITY);
+    if (!cameraMetadata->addEntry(OHOS_CONTROL_FPS_RANGES, fpsRange.data(), fpsRange.size())) {
+        DHLOGE("UpdateFrameRate add fps ranges failed");
+        return DCAMERA_BAD_VALUE;
+    }
+    std::string abilityString = Camera::MetadataUtils::EncodeToString(cameraMetadata);
+    std::shared_ptr<DCameraSettings> setting = std::make_shared<DCameraSettings>();
+    setting->type_ = UPDATE_METADATA;
+    setting->value_ = Base64Encode(reinterpret_cast<const unsigned char *>(abilityString.c_str()),
+        abilityString.length());
+    std::vector<std::shared_ptr<DCameraSettings>> settings { setting };
+    CHECK_AND_RETURN_RET_LOG(operator_ == nullptr, DCAMERA_BAD_VALUE, "operator_ is null.");
+    return operator_->UpdateSettings(settings);
+}
+
+std::vector<int32_t> DCameraSinkController::GetFpsRange(
+    const std::vector<std::shared_ptr<DCameraCaptureInfo>>& captureInfos)
+{
+    std::vector<int32_t> fpsRange;
+    for (const auto& captureInfo : captureInfos) {
+        if (captureInfo == nullptr || captureInfo->streamType_ != CONTINUOUS_FRAME) {
+            continue;
+        }
+        for (const auto& setting : captureInfo->captureSettings_) {
+            if (setting == nullptr || setting->type_ != UPDATE_METADATA) {
+                continue;
+            }
+            std::shared_ptr<Camera::CameraMetadata> cameraMetadata =
+                Camera::MetadataUtils::DecodeFromString(Base64Decode(setting->value_));
+            camera_metadata_item_t fpsItem;
+            if (cameraMetadata == nullptr || Camera::FindCameraMetadataItem(cameraMetadata->get(),
+                OHOS_CONTROL_FPS_RANGES, &fpsItem) != CAM_META_SUCCESS || fpsItem.count != FPS_RANGE_SIZE) {
+                continue;
+            }
+            fpsRange.assign(fpsItem.data.i32, fpsItem.data.i32 + fpsItem.count);
+        }
+    }
+    return fpsRange;
+}
+
+int32_t DCameraSinkController::GetThermalLevel()
+{
+#ifdef DCAMERA_THERMAL_ENABLE
+    return static_cast<int32_t>(PowerMgr::ThermalMgrClient::GetInstance().GetThermalLevel());
+#else
+    return 0;
+#endif
+}
+
+int32_t DCameraSinkController::GetPowerMode()
+{
+#ifdef DCAMERA_POWER_MODE_ENABLE
+    return static_cast<int32_t>(PowerMgr::PowerMgrClient::GetInstance().GetDeviceMode());
+#else
+    return 0;
+#endif
+}
+
 void DCameraSinkController::ProcessFrameTrigger(const AppExecFwk::InnerEvent::Pointer &event)
 {
     DHLOGD("Receive frame trigger event then start process data in sink controller.");
@@ -640,16 +857,26 @@ void DCameraSinkController::OnMetadataResult(std::vector<std::shared_ptr<DCamera
     cmd.dhId_ = dhId_;
     cmd.command_ = DCAMERA_PROTOCOL_CMD_METADATA_RESULT;
     cmd.value_.assign(settings.begin(), settings.end());
-    std::string jsonStr;
-    int32_t ret = cmd.Marshal(jsonStr);
-    if (ret != DCAMERA_OK) {
-        DHLOGE("Marshal metadata settings failed, dhId: %{public}s ret: %{public}d",
-            GetAnonyString(dhId_).c_str(), ret);
-        return;
+    std::shared_ptr<DataBuffer> buffer = nullptr;
+    int32_t ret = DCAMERA_OK;
+    if (controlFormat_.load() == DCAMERA_CONTROL_FORMAT_BINARY) {
+        std::vector<uint8_t> data;
+        ret = cmd.MarshalBinary(data);
+        CHECK_AND_RETURN_LOG(ret != DCAMERA_OK, "MarshalBinary metadata settings failed, ret: %{public}d", ret);
+        buffer = std::make_shared<DataBuffer>(data.size());
+        ret = memcpy_s(buffer->Data(), buffer->Capacity(), data.data(), data.size());
+    } else {
+        std::string jsonStr;
+        ret = cmd.Marshal(jsonStr);
+        if (ret != DCAMERA_OK) {
+            DHLOGE("Marshal metadata settings failed, dhId: %{public}s ret: %{public}d",
+                GetAnonyString(dhId_).c_str(), ret);
+            return;
+        }
+        buffer = std::make_shared<DataBuffer>(jsonStr.length() + 1);
+        ret = memcpy_s(buffer->Data(), buffer->Capacity(),
+            reinterpret_cast<uint8_t *>(const_cast<char *>(jsonStr.c_str())), jsonStr.length());
     }
-    std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(jsonStr.length() + 1);
-    ret = memcpy_s(buffer->Data(), buffer->Capacity(), reinterpret_cast<uint8_t *>(const_cast<char *>(jsonStr.c_str())),
-        jsonStr.length());
     if (ret != EOK) {
         DHLOGE("memcpy_s failed, dhId: %{public}s ret: %{public}d", GetAnonyString(dhId_).c_str(), ret);
         return;
@@ -679,10 +906,10 @@ void DCameraSinkController::OnSessionState(int32_t state, std::string networkId)
             if (sinkCallback_ != nullptr) {
                 sinkCallback_->OnHardwareStateChanged(sinkDevId, dhId_, DcameraBusinessState::RUNNING);
             }
-            if (!ManageSelectChannel::GetInstance().GetSinkConnect()) {
-                break;
+            if (ManageSelectChannel::GetInstance().GetSinkConnect()) {
+                srcDevId_ = networkId;
             }
-            srcDevId_ = networkId;
+            TryPreOpenCapture(srcDevId_);
             break;
         }
         case DCAMERA_CHANNEL_STATE_DISCONNECTED:
@@ -756,6 +983,7 @@ int32_t DCameraSinkController::StartCaptureInner(std::vector<std::shared_ptr<DCa
     cameraResult_ = DCAMERA_OK;
     preparedSurface_ = nullptr;
     captureInfosCache_ = captureInfos;
+    int32_t qos = DCameraThreadRoleRegistry::GetInstance().GetFfrtQos(DCAMERA_THREAD_CONTROL);
     ffrt::submit([this]() {
         DHLOGI("Output initialization task start.");
         int32_t ret = output_->StartCapture(captureInfosCache_);
@@ -772,7 +1000,7 @@ int32_t DCameraSinkController::StartCaptureInner(std::vector<std::shared_ptr<DCa
         AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(
             DCameraSinkContrEventHandler::EVENT_ENCODER_PREPARED, holder);
         sinkCotrEventHandler_->SendEvent(event);
-        }, {}, ffrt::task_attr().name("DCamSinkOutput").qos(ffrt::qos_user_initiated));
+        }, {}, ffrt::task_attr().name("DCamSinkOutput").qos(qos));
 
     ffrt::submit([this]() {
         DHLOGI("Operator preparation task start.");
@@ -780,7 +1008,7 @@ int32_t DCameraSinkController::StartCaptureInner(std::vector<std::shared_ptr<DCa
         AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(
             DCameraSinkContrEventHandler::EVENT_CAMERA_PREPARED, ret);
         sinkCotrEventHandler_->SendEvent(event);
-        }, {}, ffrt::task_attr().name("DCamOpPrepare").qos(ffrt::qos_user_initiated));
+        }, {}, ffrt::task_attr().name("DCamOpPrepare").qos(qos));
 
     DHLOGI("StartCaptureInner has dispatched parallel tasks.");
     return DCAMERA_OK;
@@ -799,8 +1027,11 @@ int32_t DCameraSinkController::HandleReceivedData(std::shared_ptr<DataBuffer>& d
 {
     DHLOGI("DCameraSinkController::HandleReceivedData dhId: %{public}s", GetAnonyString(dhId_).c_str());
     uint8_t *data = dataBuffer->Data();
-    std::string jsonStr(reinterpret_cast<const char *>(data), dataBuffer->Capacity());
-    cJSON *rootValue = cJSON_Parse(jsonStr.c_str());
+    if (DCameraMetadataSettingCmd::IsBinary(data, dataBuffer->Size())) {
+        return HandleReceivedBinary(dataBuffer);
+    }
+    // Parse the buffer in place once, the command objects read the same tree.
+    cJSON *rootValue = cJSON_ParseWithLength(reinterpret_cast<const char *>(data), dataBuffer->Size());
     if (rootValue == nullptr) {
         return DCAMERA_BAD_VALUE;
     }
@@ -811,10 +1042,16 @@ int32_t DCameraSinkController::HandleReceivedData(std::shared_ptr<DataBuffer>& d
         return DCAMERA_BAD_VALUE;
     }
     std::string command = std::string(comvalue->valuestring);
+    int32_t ret = HandleReceivedCommand(command, rootValue);
     cJSON_Delete(rootValue);
+    return ret;
+}
+
+int32_t DCameraSinkController::HandleReceivedCommand(const std::string &command, const cJSON *rootValue)
+{
     if ((!command.empty()) && (command.compare(DCAMERA_PROTOCOL_CMD_CAPTURE) == 0)) {
         DCameraCaptureInfoCmd captureInfoCmd;
-        int32_t ret = captureInfoCmd.Unmarshal(jsonStr);
+        int32_t ret = captureInfoCmd.Unmarshal(rootValue);
         if (ret != DCAMERA_OK) {
             DHLOGE("Capture Info Unmarshal failed, dhId: %{public}s ret: %{public}d",
                 GetAnonyString(dhId_).c_str(), ret);
@@ -834,7 +1071,7 @@ int32_t DCameraSinkController::HandleReceivedData(std::shared_ptr<DataBuffer>& d
         return StartCapture(captureInfoCmd.value_, sceneMode_, captureInfoCmd.eis_);
     } else if ((!command.empty()) && (command.compare(DCAMERA_PROTOCOL_CMD_UPDATE_METADATA) == 0)) {
         DCameraMetadataSettingCmd metadataSettingCmd;
-        int32_t ret = metadataSettingCmd.Unmarshal(jsonStr);
+        int32_t ret = metadataSettingCmd.Unmarshal(rootValue);
         if (ret != DCAMERA_OK) {
             DHLOGE("Metadata Setting Unmarshal failed, dhId: %{public}s ret: %{public}d",
                    GetAnonyString(dhId_).c_str(), ret);
@@ -843,16 +1080,50 @@ int32_t DCameraSinkController::HandleReceivedData(std::shared_ptr<DataBuffer>& d
         return UpdateSettings(metadataSettingCmd.value_);
     } else if ((!command.empty()) && (command.compare(DCAMERA_PROTOCOL_CMD_STOP_CAPTURE) == 0)) {
         return StopCapture();
+    } else if ((!command.empty()) && (command.compare(DCAMERA_PROTOCOL_CMD_REQUEST_KEY_FRAME) == 0)) {
+        return RequestKeyFrame();
     }
     return DCAMERA_BAD_VALUE;
 }
 
+int32_t DCameraSinkController::RequestKeyFrame()
+{
+    DHLOGI("RequestKeyFrame dhId: %{public}s", GetAnonyString(dhId_).c_str());
+    CHECK_AND_RETURN_RET_LOG(output_ == nullptr, DCAMERA_BAD_VALUE, "output_ is null.");
+    output_->RequestKeyFrame();
+    return DCAMERA_OK;
+}
+
+int32_t DCameraSinkController::HandleReceivedBinary(std::shared_ptr<DataBuffer>& dataBuffer)
+{
+    DCameraMetadataSettingCmd metadataSettingCmd;
+    int32_t ret = metadataSettingCmd.UnmarshalBinary(dataBuffer->Data(), dataBuffer->Size());
+    if (ret != DCAMERA_OK) {
+        DHLOGE("Metadata Setting UnmarshalBinary failed, dhId: %{public}s ret: %{public}d",
+            GetAnonyString(dhId_).c_str(), ret);
+        return ret;
+    }
+    if (metadataSettingCmd.command_ != DCAMERA_PROTOCOL_CMD_UPDATE_METADATA) {
+        DHLOGE("unexpected binary command %{public}s", metadataSettingCmd.command_.c_str());
+        return DCAMERA_BAD_VALUE;
+    }
+    return UpdateSettings(metadataSettingCmd.value_);
+}
+
 bool DCameraSinkController::CheckAclRight()
 {
     if (userId_ == -1) {
         DHLOGI("Acl check version compatibility processing.");
         return true;
     }
+    // Local user and account are left out of the key, switching them invalidates the cache.
+    DCameraAclKey aclKey = { srcDevId_, userId_, tokenId_, accountId_, sinkTokenId_ };
+    DCameraSinkAclCache &aclCache = DCameraSinkAclCache::GetInstance();
+    if (aclCache.IsAclGranted(aclKey)) {
+        DHLOGD("CheckAclRight hit cache, srcDevId: %{public}s", GetAnonyString(srcDevId_).c_str());
+        return true;
+    }
+    uint64_t generation = aclCache.GetGeneration();
     std::string sinkDevId;
     int32_t ret = GetLocalDeviceNetworkId(sinkDevId);
     CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, false, "GetLocalDeviceNetworkId failed, ret: %{public}d", ret);
@@ -876,6 +1147,7 @@ bool DCameraSinkController::CheckAclRight()
         DHLOGE("InitDeviceManager failed ret = %{public}d", ret);
         return false;
     }
+    aclCache.RegisterListeners();
     DmAccessCaller dmSrcCaller = {
         .accountId = accountId_,
         .pkgName = DCAMERA_PKG_NAME,
@@ -892,7 +1164,11 @@ bool DCameraSinkController::CheckAclRight()
     };
     DHLOGI("CheckAclRight srcDevId: %{public}s, accountId: %{public}s, sinkDevId: %{public}s",
         GetAnonyString(srcDevId_).c_str(), GetAnonyString(accountId).c_str(), GetAnonyString(sinkDevId).c_str());
-    return DeviceManager::GetInstance().CheckSinkAccessControl(dmSrcCaller, dmDstCallee);
+    bool isGranted = DeviceManager::GetInstance().CheckSinkAccessControl(dmSrcCaller, dmDstCallee);
+    if (isGranted) {
+        aclCache.CacheAclGranted(aclKey, generation);
+    }
+    return isGranted;
 }
 
 int32_t DCameraSinkController::PauseDistributedHardware(const std::string &networkId)
@@ -906,6 +1182,12 @@ int32_t DCameraSinkController::PauseDistributedHardware(const std::string &netwo
         DHLOGE("operator_ is nullptr.");
         return DCAMERA_BAD_VALUE;
     }
+    if (output_ != nullptr && IsWarmPauseEnabled()) {
+        output_->SetFramePaused(true);
+        isWarmPaused_.store(true);
+        DHLOGI("Warm pause distributed hardware dhId: %{public}s", GetAnonyString(dhId_).c_str());
+        return DCAMERA_OK;
+    }
     int32_t ret = operator_->PauseCapture();
     if (ret != DCAMERA_OK) {
         DHLOGE("Pause distributed hardware failed, dhId: %{public}s, ret: %{public}d",
@@ -925,14 +1207,30 @@ int32_t DCameraSinkController::ResumeDistributedHardware(const std::string &netw
         DHLOGE("operator_ is nullptr.");
         return DCAMERA_BAD_VALUE;
     }
-    int32_t ret = operator_->ResumeCapture();
+    int32_t ret = DCAMERA_OK;
+    if (isWarmPaused_.exchange(false) && output_ != nullptr) {
+        output_->SetFramePaused(false);
+    } else {
+        ret = operator_->ResumeCapture();
+    }
     if (ret != DCAMERA_OK) {
         DHLOGE("Resume distributed hardware failed, dhId: %{public}s, ret: %{public}d",
             GetAnonyString(dhId_).c_str(), ret);
+        return ret;
+    }
+    // The source decodes from the first frame after the gap, give it one that needs no reference.
+    if (output_ != nullptr) {
+        output_->RequestKeyFrame();
     }
     return ret;
 }
 
+bool DCameraSinkController::IsWarmPauseEnabled()
+{
+    int32_t enable = 0;
+    return GetSysPara(WARM_PAUSE_PARA, enable) && (enable == 1);
+}
+
 int32_t DCameraSinkController::StopDistributedHardware(const std::string &networkId)
 {
     DHLOGI("Stop distributed hardware dhId: %{public}s", GetAnonyString(dhId_).c_str());
@@ -975,6 +1273,12 @@ bool DCameraSinkController::CheckDeviceSecurityLevel(const std::string &srcDevic
 
 int32_t DCameraSinkController::GetDeviceSecurityLevel(const std::string &udid)
 {
+    int32_t level = 0;
+    DCameraSinkAclCache &aclCache = DCameraSinkAclCache::GetInstance();
+    if (aclCache.GetSecurityLevel(udid, level)) {
+        return level;
+    }
+    uint64_t generation = aclCache.GetGeneration();
     #ifdef DEVICE_SECURITY_LEVEL_ENABLE
     DeviceIdentify devIdentify;
     devIdentify.length = DEVICE_ID_MAX_LEN;
@@ -991,9 +1295,6 @@ int32_t DCameraSinkController::GetDeviceSecurityLevel(const std::string &udid)
         info = nullptr;
         return DEFAULT_DEVICE_SECURITY_LEVEL;
     }
-    #endif
-    int32_t level = 0;
-    #ifdef DEVICE_SECURITY_LEVEL_ENABLE
     ret = GetDeviceSecurityLevelValue(info, &level);
     DHLOGD("Get device security level, level is %{public}d", level);
     FreeDeviceSecurityInfo(info);
@@ -1003,6 +1304,7 @@ int32_t DCameraSinkController::GetDeviceSecurityLevel(const std::string &udid)
         return DEFAULT_DEVICE_SECURITY_LEVEL;
     }
     #endif
+    aclCache.CacheSecurityLevel(udid, level, generation);
     return level;
 }
 
@@ -1012,17 +1314,24 @@ std::string DCameraSinkController::GetUdidByNetworkId(const std::string &network
         DHLOGE("networkId is empty!");
         return "";
     }
+    std::string udid = "";
+    DCameraSinkAclCache &aclCache = DCameraSinkAclCache::GetInstance();
+    if (aclCache.GetUdid(networkId, udid)) {
+        return udid;
+    }
+    uint64_t generation = aclCache.GetGeneration();
     int32_t ret = DeviceManager::GetInstance().InitDeviceManager(DCAMERA_PKG_NAME, initCallback_);
     if (ret != DCAMERA_OK) {
         DHLOGE("InitDeviceManager failed ret = %{public}d", ret);
         return "";
     }
-    std::string udid = "";
+    aclCache.RegisterListeners();
     ret = DeviceManager::GetInstance().GetUdidByNetworkId(DCAMERA_PKG_NAME, networkId, udid);
-    if (ret != DCAMERA_OK) {
+    if (ret != DCAMERA_OK || udid.empty()) {
         DHLOGE("GetUdidByNetworkId failed ret = %{public}d", ret);
         return "";
     }
+    aclCache.CacheUdid(networkId, udid, generation);
     return udid;
 }
 
@@ -1034,6 +1343,7 @@ void DCameraSinkController::SetTokenId(uint64_t token)
 void DeviceInitCallback::OnRemoteDied()
 {
     DHLOGI("DeviceInitCallback OnRemoteDied");
+    DCameraSinkAclCache::GetInstance().OnDeviceManagerDied();
 }
 
 void DCameraSinkController::HandleCaptureError(int32_t errorCode, const std::string& errorMsg)
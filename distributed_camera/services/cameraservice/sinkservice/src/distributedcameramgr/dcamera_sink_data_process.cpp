@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,64 +15,53 @@
 
 #include "dcamera_sink_data_process.h"
 
+#include <cinttypes>
+
 #include "anonymous_string.h"
 #include "dcamera_channel_sink_impl.h"
+#include "dcamera_dump_writer.h"
+#include "dcamera_frame_drop_statistics.h"
+#include "dcamera_memory_account.h"
 #include "dcamera_pipeline_sink.h"
 #include "dcamera_sink_data_process_listener.h"
 #include "dcamera_sink_imu_sensor.h"
+#include "dcamera_startup_profiler.h"
 #include "dcamera_hidumper.h"
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 #include "metadata_utils.h"
-#include <sys/prctl.h>
+#include <algorithm>
 
 namespace OHOS {
 namespace DistributedHardware {
-constexpr int32_t IMU_X = 0;
-constexpr int32_t IMU_Y = 1;
-constexpr int32_t IMU_Z = 2;
 constexpr int64_t POSTURE_INTERVAL = 2500000; // 2.5ms
+// The encoder output carries the codec buffer flags, no flag at all marks a delta frame.
+constexpr int32_t DELTA_FRAME_FLAG = 0;
 
 DCameraSinkDataProcess::DCameraSinkDataProcess(const std::string& dhId, std::shared_ptr<ICameraChannel>& channel)
-    : dhId_(dhId), channel_(channel), eventHandler_(nullptr)
+    : dhId_(dhId), channel_(channel), eventQueue_(nullptr)
 {
     DHLOGI("DCameraSinkDataProcess Constructor dhId: %{public}s", GetAnonyString(dhId_).c_str());
+    std::string streamKey = "sink_" + GetAnonyString(dhId_);
+    dropCounter_ = DCameraFrameDropStatistics::GetInstance().Acquire(streamKey);
+    memoryAccount_ = DCameraMemoryStatistics::GetInstance().Acquire(streamKey);
 }
 
 DCameraSinkDataProcess::~DCameraSinkDataProcess()
 {
     DHLOGI("DCameraSinkDataProcess delete dhId: %{public}s", GetAnonyString(dhId_).c_str());
     DumpFileUtil::CloseDumpFile(&dumpFile_);
-    if ((eventHandler_ != nullptr) && (eventHandler_->GetEventRunner() != nullptr)) {
-        eventHandler_->GetEventRunner()->Stop();
-    }
-    if (eventThread_.joinable()) {
-        eventThread_.join();
+    if (eventQueue_ != nullptr) {
+        eventQueue_->Stop();
     }
-    eventHandler_ = nullptr;
+    eventQueue_ = nullptr;
 }
 
 void DCameraSinkDataProcess::Init()
 {
     DHLOGI("DCameraSinkDataProcess Init dhId: %{public}s", GetAnonyString(dhId_).c_str());
-    eventThread_ = std::thread([this]() { this->StartEventHandler(); });
-    std::unique_lock<std::mutex> lock(eventMutex_);
-    eventCon_.wait(lock, [this] {
-        return eventHandler_ != nullptr;
-    });
-}
-
-void DCameraSinkDataProcess::StartEventHandler()
-{
-    prctl(PR_SET_NAME, SINK_START_EVENT.c_str());
-    auto runner = AppExecFwk::EventRunner::Create(false);
-    {
-        std::lock_guard<std::mutex> lock(eventMutex_);
-        eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
-    }
-    eventCon_.notify_one();
-    runner->Run();
+    eventQueue_ = std::make_shared<DCameraSerialQueue>(SINK_START_EVENT, DCAMERA_THREAD_FRAME);
 }
 
 #ifdef DCAMERA_OPEN_STABILE
@@ -98,11 +87,11 @@ void DCameraSinkDataProcess::AccSensorCallback(SensorEvent* event)
         return;
     }
     float* data = reinterpret_cast<float*>(event->data);
-    SensorData accData;
+    ImuSample accData;
     accData.timeStamp = event->timestamp;
-    accData.data[IMU_X] = static_cast<double>(data[IMU_X]);
-    accData.data[IMU_Y] = static_cast<double>(data[IMU_Y]);
-    accData.data[IMU_Z] = static_cast<double>(data[IMU_Z]);
+    accData.data[IMU_X] = data[IMU_X];
+    accData.data[IMU_Y] = data[IMU_Y];
+    accData.data[IMU_Z] = data[IMU_Z];
     DCameraSinkImuSensor::GetInstance().SaveAccInfo(accData);
 }
  
@@ -128,11 +117,11 @@ void DCameraSinkDataProcess::GyroSensorCallback(SensorEvent* event)
         return;
     }
     float* data = reinterpret_cast<float*>(event->data);
-    SensorData gyroData;
+    ImuSample gyroData;
     gyroData.timeStamp = event->timestamp;
-    gyroData.data[IMU_X] = static_cast<double>(data[IMU_X]);
-    gyroData.data[IMU_Y] = static_cast<double>(data[IMU_Y]);
-    gyroData.data[IMU_Z] = static_cast<double>(data[IMU_Z]);
+    gyroData.data[IMU_X] = data[IMU_X];
+    gyroData.data[IMU_Y] = data[IMU_Y];
+    gyroData.data[IMU_Z] = data[IMU_Z];
     DCameraSinkImuSensor::GetInstance().SaveGyroInfo(gyroData);
 }
  
@@ -168,29 +157,42 @@ int32_t DCameraSinkDataProcess::StartCapture(std::shared_ptr<DCameraCaptureInfo>
     if (captureInfo->streamType_ == CONTINUOUS_FRAME) {
         DHLOGI("StartCapture %{public}s create data process pipeline", GetAnonyString(dhId_).c_str());
         pipeline_ = std::make_shared<DCameraPipelineSink>();
+        pipeline_->SetDropCounter(dropCounter_);
+        pipeline_->SetMemoryAccount(memoryAccount_);
+        sendStats_->Reset();
+        pipeline_->SetSendStats(sendStats_);
         auto dataProcess = std::shared_ptr<DCameraSinkDataProcess>(shared_from_this());
         std::shared_ptr<DataProcessListener> listener = std::make_shared<DCameraSinkDataProcessListener>(dataProcess);
         int32_t maxFps = GetMaxFrameRate(captureInfo);
+        Videoformat format = GetCaptureFormat(captureInfo);
         VideoConfigParams srcParams(VideoCodecType::NO_CODEC,
-                                    GetPipelineFormat(captureInfo->format_),
+                                    format,
                                     maxFps,
                                     captureInfo->width_,
                                     captureInfo->height_);
         VideoConfigParams destParams(GetPipelineCodecType(captureInfo->encodeType_),
-                                     GetPipelineFormat(captureInfo->format_),
+                                     format,
                                      maxFps,
                                      captureInfo->width_,
                                      captureInfo->height_);
+        if (format == Videoformat::P010) {
+            srcParams.SetHdrType(static_cast<VideoHdrType>(captureInfo->hdrType_));
+            destParams.SetHdrType(static_cast<VideoHdrType>(captureInfo->hdrType_));
+        }
         int32_t ret = pipeline_->CreateDataProcessPipeline(PipelineType::VIDEO, srcParams, destParams, listener);
         if (ret != DCAMERA_OK) {
             DHLOGE("create data process pipeline failed, dhId: %{public}s, ret: %{public}d",
                    GetAnonyString(dhId_).c_str(), ret);
             return ret;
         }
+        pipeline_->OnLinkCapacity(linkCapacityBps_.load());
+        pipeline_->SetBitratePercent(bitratePercent_.load());
+        framePacer_ = IsPacingEnabled() ? std::make_shared<DCameraSinkFramePacer>(maxFps) : nullptr;
     }
 #ifdef DCAMERA_OPEN_STABILE
         if (DCameraSinkImuSensor::GetInstance().GetSinkEis() == true) {
             DHLOGI("Register IMU callback");
+            DCameraStartupPhase phase("ImuSensorRegister");
             AccRegisterSensorListener();
             GyroRegisterSensorListener();
         }
@@ -205,14 +207,26 @@ int32_t DCameraSinkDataProcess::StopCapture()
 #ifdef DCAMERA_OPEN_STABILE
     UnRegisterSensorListener();
 #endif
+    // Wake an encoder waiting for the channel so it can see the pipeline going down.
+    ResetSendCredits();
     if (pipeline_ != nullptr) {
         pipeline_->DestroyDataProcessPipeline();
         pipeline_ = nullptr;
+        DCameraFrameDropStatistics::GetInstance().ReportSession(dropCounter_);
+        DCameraMemoryStatistics::GetInstance().ReportSession(memoryAccount_);
     }
-    if (eventHandler_ != nullptr) {
+    framePacer_ = nullptr;
+    if (eventQueue_ != nullptr) {
         DHLOGI("StopCapture dhId: %{public}s, remove all events", GetAnonyString(dhId_).c_str());
-        eventHandler_->RemoveAllEvents();
+        eventQueue_->RemoveAllTasks();
     }
+    ClearSendFrames();
+    // Credits held by removed send tasks never come back.
+    ResetSendCredits();
+    isFramePaused_.store(false);
+#ifdef DUMP_DCAMERA_FILE
+    DCameraDumpWriter::GetInstance().Close(DUMP_PATH, AFTER_ENCODE);
+#endif
     return DCAMERA_OK;
 }
 
@@ -222,6 +236,10 @@ int32_t DCameraSinkDataProcess::FeedStream(std::shared_ptr<DataBuffer>& dataBuff
     DHLOGD("FeedStream dhId: %{public}s, stream type: %{public}d", GetAnonyString(dhId_).c_str(), type);
     switch (type) {
         case CONTINUOUS_FRAME: {
+            if (isFramePaused_.load()) {
+                DHLOGD("FeedStream dhId: %{public}s paused, skip frame.", GetAnonyString(dhId_).c_str());
+                break;
+            }
             int32_t ret = FeedStreamInner(dataBuffer);
             if (ret != DCAMERA_OK) {
                 DHLOGE("FeedStream continuous frame failed, dhId: %{public}s, ret: %{public}d",
@@ -244,39 +262,196 @@ int32_t DCameraSinkDataProcess::FeedStream(std::shared_ptr<DataBuffer>& dataBuff
 
 void DCameraSinkDataProcess::SendDataAsync(const std::shared_ptr<DataBuffer>& buffer)
 {
-    auto sendFunc = [this, buffer]() mutable {
-        std::shared_ptr<DataBuffer> sendBuffer = buffer;
-        int32_t ret = channel_->SendData(sendBuffer);
-        uint64_t buffersSize = static_cast<uint64_t>(buffer->Size());
-        DHLOGD("SendData type: %{public}d output data ret: %{public}d, dhId: %{public}s, bufferSize: %{public}" PRIu64,
-            captureInfo_->streamType_, ret, GetAnonyString(dhId_).c_str(), buffersSize);
+    if (eventQueue_ == nullptr) {
+        DHLOGE("eventQueue_ is uninit");
+        return;
+    }
+    EnqueueSendFrame(buffer, false, std::weak_ptr<IDataProcessPipeline>(), nullptr);
+}
+
+bool DCameraSinkDataProcess::EnqueueSendFrame(const std::shared_ptr<DataBuffer>& buffer, bool holdsCredit,
+    const std::weak_ptr<IDataProcessPipeline>& weakPipeline, const std::shared_ptr<DCameraSinkFramePacer>& pacer)
+{
+    SendFrame frame = { buffer, IsKeyFrame(buffer), holdsCredit, GetNowTimeStampUs() };
+    SendFrame dropped;
+    bool hasDropped = false;
+    {
+        std::lock_guard<std::mutex> lock(sendMutex_);
+        if (!holdsCredit && sendFrames_.size() >= MAX_SNAPSHOT_PENDING) {
+            dropped = sendFrames_.front();
+            sendFrames_.pop_front();
+            hasDropped = true;
+        }
+        sendFrames_.push_back(frame);
+        sendStats_->SetQueueDepth(sendFrames_.size());
+    }
+    sendStats_->OnFramesIn(1);
+    if (hasDropped) {
+        DHLOGW("Send queue of dhId: %{public}s is full, drop the oldest frame.", GetAnonyString(dhId_).c_str());
+        DropSendFrame(dropped, DCAMERA_DROP_SEND_CONGESTION);
+    }
+    auto sendFunc = [this, weakPipeline, pacer]() {
+        SendNextFrame(weakPipeline, pacer);
     };
-    if (eventHandler_ != nullptr) {
-        eventHandler_->PostTask(sendFunc);
+    if (eventQueue_->PostTask(sendFunc)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    auto iter = std::find_if(sendFrames_.begin(), sendFrames_.end(),
+        [&buffer](const SendFrame& pending) { return pending.buffer == buffer; });
+    if (iter != sendFrames_.end()) {
+        sendFrames_.erase(iter);
     }
+    sendStats_->SetQueueDepth(sendFrames_.size());
+    return false;
+}
+
+void DCameraSinkDataProcess::SendNextFrame(const std::weak_ptr<IDataProcessPipeline>& weakPipeline,
+    const std::shared_ptr<DCameraSinkFramePacer>& pacer)
+{
+    SendFrame frame;
+    bool isStale = false;
+    bool needKeyFrame = false;
+    {
+        std::lock_guard<std::mutex> lock(sendMutex_);
+        if (sendFrames_.empty()) {
+            return;
+        }
+        frame = sendFrames_.front();
+        sendFrames_.pop_front();
+        sendStats_->SetQueueDepth(sendFrames_.size());
+        if (frame.isKeyFrame) {
+            isWaitKeyFrame_ = false;
+        } else if (!isWaitKeyFrame_ && GetNowTimeStampUs() - frame.enqueueUs > MAX_SEND_QUEUE_AGE_US) {
+            isWaitKeyFrame_ = true;
+            needKeyFrame = true;
+        }
+        isStale = isWaitKeyFrame_;
+    }
+    int64_t queueAgeUs = GetNowTimeStampUs() - frame.enqueueUs;
+    sendStats_->AddWaitTime(queueAgeUs);
+    std::shared_ptr<IDataProcessPipeline> pipeline = weakPipeline.lock();
+    if (isStale) {
+        DropSendFrame(frame, needKeyFrame ? DCAMERA_DROP_SEND_CONGESTION : DCAMERA_DROP_WAIT_KEY_FRAME);
+        if (needKeyFrame && pipeline != nullptr) {
+            DHLOGI("Stale frame waited %{public}" PRId64"us, dhId: %{public}s, request key frame.", queueAgeUs,
+                GetAnonyString(dhId_).c_str());
+            pipeline->RequestKeyFrame();
+        }
+        return;
+    }
+    int64_t sensorTimeUs = 0;
+    if (pacer != nullptr && frame.buffer->FindInt64(DataBufferKey::TIME_STAMP_US, sensorTimeUs)) {
+        int64_t delayUs = pacer->GetSendDelayUs(sensorTimeUs, GetNowTimeStampUs());
+        if (delayUs > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(delayUs));
+        }
+    }
+    int64_t sendStartUs = GetNowTimeStampUs();
+    int32_t ret = channel_->SendData(frame.buffer);
+    int64_t sendCostUs = GetNowTimeStampUs() - sendStartUs;
+    sendStats_->AddProcessTime(sendCostUs);
+    if (ret == DCAMERA_OK) {
+        sendStats_->OnFramesOut(1);
+    }
+    if (pipeline != nullptr) {
+        pipeline->OnChannelSendResult(frame.buffer->Size(), sendCostUs, ret);
+    }
+    if (frame.holdsCredit) {
+        ReturnSendCredit();
+    }
+    DHLOGD("SendData output data ret: %{public}d, dhId: %{public}s, bufferSize: %{public}zu, queued: %{public}"
+        PRId64"us, cost: %{public}" PRId64"us", ret, GetAnonyString(dhId_).c_str(), frame.buffer->Size(),
+        queueAgeUs, sendCostUs);
+}
+
+void DCameraSinkDataProcess::DropSendFrame(const SendFrame& frame, DCameraDropReason reason)
+{
+    sendStats_->OnFramesDropped(1);
+    if (dropCounter_ != nullptr) {
+        dropCounter_->Add(reason);
+    }
+    if (frame.holdsCredit) {
+        ReturnSendCredit();
+    }
+}
+
+void DCameraSinkDataProcess::ClearSendFrames()
+{
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    sendFrames_.clear();
+    isWaitKeyFrame_ = false;
+    sendStats_->SetQueueDepth(0);
+}
+
+bool DCameraSinkDataProcess::IsKeyFrame(const std::shared_ptr<DataBuffer>& buffer)
+{
+    int32_t frameType = DELTA_FRAME_FLAG;
+    return buffer == nullptr || !buffer->FindInt32(DataBufferKey::FRAME_TYPE, frameType) ||
+        frameType != DELTA_FRAME_FLAG;
 }
 
 int32_t DCameraSinkDataProcess::OnProcessedVideoBuffer(const std::shared_ptr<DataBuffer>& videoResult)
 {
+    // In surface mode the camera feeds the encoder directly, a paused stream is held back here instead.
+    if (isFramePaused_.load()) {
+        return DCAMERA_OK;
+    }
 #ifdef DUMP_DCAMERA_FILE
-    if (DcameraHidumper::GetInstance().GetDumpFlag() && (IsUnderDumpMaxSize(DUMP_PATH, AFTER_ENCODE) == DCAMERA_OK)) {
-        DumpBufferToFile(DUMP_PATH, AFTER_ENCODE, videoResult->Data(), videoResult->Size());
+    if (DcameraHidumper::GetInstance().GetDumpFlag()) {
+        DCameraDumpWriter::GetInstance().Write(DUMP_PATH, AFTER_ENCODE, videoResult->Data(), videoResult->Size());
     }
 #endif
     DumpFileUtil::WriteDumpFile(dumpFile_, static_cast<void *>(videoResult->Data()), videoResult->Size());
-    if (eventHandler_ == nullptr) {
-        DHLOGE("eventHandler_ is uninit");
+    if (eventQueue_ == nullptr) {
+        DHLOGE("eventQueue_ is uninit");
+        return DCAMERA_TRANS_BUSY;
+    }
+    if (!AcquireSendCredit()) {
         return DCAMERA_TRANS_BUSY;
     }
-    if (eventHandler_->IsIdle()) {
 #ifdef DCAMERA_OPEN_STABILE
-        videoResult->eisInfo_.imuData = DCameraSinkImuSensor::GetInstance().PackedImuData();
+    DCameraSinkImuSensor::GetInstance().GetImuData(videoResult->eisInfo_);
 #endif
-        SendDataAsync(videoResult);
-        return DCAMERA_OK;
-    } else {
+    if (!EnqueueSendFrame(videoResult, true, pipeline_, framePacer_)) {
+        ReturnSendCredit();
         return DCAMERA_TRANS_BUSY;
     }
+    return DCAMERA_OK;
+}
+
+bool DCameraSinkDataProcess::AcquireSendCredit()
+{
+    std::lock_guard<std::mutex> lock(creditMutex_);
+    if (sendCredits_ <= 0) {
+        return false;
+    }
+    sendCredits_--;
+    return true;
+}
+
+void DCameraSinkDataProcess::ReturnSendCredit()
+{
+    {
+        std::lock_guard<std::mutex> lock(creditMutex_);
+        sendCredits_ = std::min(sendCredits_ + 1, MAX_SEND_CREDITS);
+    }
+    creditCond_.notify_all();
+}
+
+void DCameraSinkDataProcess::ResetSendCredits()
+{
+    {
+        std::lock_guard<std::mutex> lock(creditMutex_);
+        sendCredits_ = MAX_SEND_CREDITS;
+    }
+    creditCond_.notify_all();
+}
+
+bool DCameraSinkDataProcess::WaitSendCredit(int64_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(creditMutex_);
+    return creditCond_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return sendCredits_ > 0; });
 }
 
 void DCameraSinkDataProcess::OnError(DataProcessErrorType errorType)
@@ -325,6 +500,9 @@ Videoformat DCameraSinkDataProcess::GetPipelineFormat(int32_t format)
         case OHOS_CAMERA_FORMAT_RGBA_8888:
             videoFormat = Videoformat::RGBA_8888;
             break;
+        case OHOS_CAMERA_FORMAT_YCBCB_P010:
+            videoFormat = Videoformat::P010;
+            break;
         default:
             videoFormat = Videoformat::NV21;
             break;
@@ -332,6 +510,17 @@ Videoformat DCameraSinkDataProcess::GetPipelineFormat(int32_t format)
     return videoFormat;
 }
 
+Videoformat DCameraSinkDataProcess::GetCaptureFormat(const std::shared_ptr<DCameraCaptureInfo>& captureInfo)
+{
+    Videoformat videoFormat = GetPipelineFormat(captureInfo->format_);
+    // Without HDR the source widens 8 bit frames to P010 itself, as older sources always do.
+    if (videoFormat == Videoformat::P010 && (captureInfo->hdrType_ == DCAMERA_HDR_NONE ||
+        captureInfo->encodeType_ != ENCODE_TYPE_H265)) {
+        return Videoformat::NV21;
+    }
+    return videoFormat;
+}
+
 int32_t DCameraSinkDataProcess::GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier)
 {
     if (pipeline_ == nullptr) {
@@ -341,6 +530,52 @@ int32_t DCameraSinkDataProcess::GetProperty(const std::string& propertyName, Pro
     return pipeline_->GetProperty(propertyName, propertyCarrier);
 }
 
+void DCameraSinkDataProcess::OnLinkCapacity(int64_t bandwidthBps)
+{
+    DHLOGI("OnLinkCapacity dhId: %{public}s, bandwidth: %{public}" PRId64, GetAnonyString(dhId_).c_str(),
+        bandwidthBps);
+    linkCapacityBps_.store(bandwidthBps);
+    std::shared_ptr<IDataProcessPipeline> pipeline = pipeline_;
+    if (pipeline == nullptr) {
+        return;
+    }
+    pipeline->OnLinkCapacity(bandwidthBps);
+}
+
+void DCameraSinkDataProcess::SetBitratePercent(int32_t percent)
+{
+    DHLOGI("SetBitratePercent dhId: %{public}s, percent: %{public}d", GetAnonyString(dhId_).c_str(), percent);
+    bitratePercent_.store(percent);
+    std::shared_ptr<IDataProcessPipeline> pipeline = pipeline_;
+    if (pipeline == nullptr) {
+        return;
+    }
+    pipeline->SetBitratePercent(percent);
+}
+
+void DCameraSinkDataProcess::RequestKeyFrame()
+{
+    std::shared_ptr<IDataProcessPipeline> pipeline = pipeline_;
+    if (pipeline == nullptr) {
+        DHLOGD("RequestKeyFrame: pipeline is nullptr.");
+        return;
+    }
+    pipeline->RequestKeyFrame();
+}
+
+void DCameraSinkDataProcess::SetFramePaused(bool isPaused)
+{
+    DHLOGI("SetFramePaused dhId: %{public}s, paused: %{public}d", GetAnonyString(dhId_).c_str(), isPaused);
+    isFramePaused_.store(isPaused);
+}
+
+bool DCameraSinkDataProcess::IsPacingEnabled()
+{
+    int32_t enable = 0;
+    // Paced unless switched off, an unset parameter reads back as -1.
+    return !GetSysPara(PACING_ENABLE_PARA, enable) || (enable != 0);
+}
+
 int32_t DCameraSinkDataProcess::GetMaxFrameRate(std::shared_ptr<DCameraCaptureInfo>& captureInfo)
 {
     int32_t maxFps = 0;
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_sink_degradation_policy.h"
+
+#include <algorithm>
+
+#include "distributed_camera_constants.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t FPS_STEP_PERCENT = 67;
+constexpr int32_t FPS_FLOOR_PERCENT = 50;
+constexpr int32_t RESOLUTION_STEP_PERCENT = 75;
+constexpr int32_t BITRATE_STEP_PERCENT = 60;
+}
+
+DegradationLevel DCameraSinkDegradationPolicy::GetThermalPressure(int32_t thermalLevel)
+{
+    if (thermalLevel >= THERMAL_LEVEL_OVERHEATED) {
+        return DegradationLevel::BITRATE;
+    }
+    if (thermalLevel == THERMAL_LEVEL_HOT) {
+        return DegradationLevel::RESOLUTION;
+    }
+    return thermalLevel == THERMAL_LEVEL_WARM ? DegradationLevel::FPS : DegradationLevel::NONE;
+}
+
+DegradationLevel DCameraSinkDegradationPolicy::GetPowerModePressure(int32_t powerMode)
+{
+    switch (powerMode) {
+        case POWER_MODE_POWER_SAVE:
+            return DegradationLevel::FPS;
+        case POWER_MODE_EXTREME_POWER_SAVE:
+            return DegradationLevel::RESOLUTION;
+        default:
+            return DegradationLevel::NONE;
+    }
+}
+
+DegradationStep DCameraSinkDegradationPolicy::GetStep(DegradationLevel level)
+{
+    DegradationStep step;
+    step.level = level;
+    switch (level) {
+        case DegradationLevel::BITRATE:
+            step.bitratePercent = BITRATE_STEP_PERCENT;
+            [[fallthrough]];
+        case DegradationLevel::RESOLUTION:
+            step.resolutionPercent = RESOLUTION_STEP_PERCENT;
+            step.fpsPercent = FPS_FLOOR_PERCENT;
+            break;
+        case DegradationLevel::FPS:
+            step.fpsPercent = FPS_STEP_PERCENT;
+            break;
+        default:
+            step.level = DegradationLevel::NONE;
+            break;
+    }
+    return step;
+}
+
+std::string DCameraSinkDegradationPolicy::MakeNotifyContent(const DegradationStep& step)
+{
+    return SINK_CAPTURE_DEGRADED + " level:" + std::to_string(static_cast<int32_t>(step.level)) +
+        " fps:" + std::to_string(step.fpsPercent) + " resolution:" + std::to_string(step.resolutionPercent) +
+        " bitrate:" + std::to_string(step.bitratePercent);
+}
+
+void DCameraSinkDegradationPolicy::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    level_ = DegradationLevel::NONE;
+    relievedSinceUs_ = 0;
+}
+
+DegradationLevel DCameraSinkDegradationPolicy::GetLevel()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return level_;
+}
+
+bool DCameraSinkDegradationPolicy::Evaluate(int32_t thermalLevel, int32_t powerMode, int64_t nowUs,
+    DegradationLevel& level)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    DegradationLevel pressure = std::max(GetThermalPressure(thermalLevel), GetPowerModePressure(powerMode));
+    DegradationLevel target = level_;
+    if (pressure > level_) {
+        target = pressure;
+        relievedSinceUs_ = 0;
+    } else if (pressure == level_) {
+        relievedSinceUs_ = 0;
+    } else if (relievedSinceUs_ == 0) {
+        relievedSinceUs_ = nowUs;
+    } else if (nowUs - relievedSinceUs_ >= RECOVER_HOLD_US) {
+        // One level per hold, the next step back waits for another full hold.
+        target = static_cast<DegradationLevel>(static_cast<int32_t>(level_) - 1);
+        relievedSinceUs_ = target > pressure ? nowUs : 0;
+    }
+    bool isChanged = target != level_;
+    level_ = target;
+    level = target;
+    return isChanged;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_sink_frame_pacer.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace DistributedHardware {
+DCameraSinkFramePacer::DCameraSinkFramePacer(int32_t fps)
+    : frameIntervalUs_(fps > 0 ? US_PER_SECOND / fps : 0)
+{
+}
+
+int64_t DCameraSinkFramePacer::GetSendDelayUs(int64_t sensorTimeUs, int64_t nowUs)
+{
+    if (frameIntervalUs_ <= 0 || sensorTimeUs <= 0) {
+        return 0;
+    }
+    int64_t maxDriftUs = REANCHOR_INTERVALS * frameIntervalUs_;
+    bool isDiscontinuous = !isAnchored_ || (sensorTimeUs <= lastSensorUs_) ||
+        (sensorTimeUs - lastSensorUs_ > maxDriftUs);
+    lastSensorUs_ = sensorTimeUs;
+    if (isDiscontinuous) {
+        Anchor(sensorTimeUs, nowUs);
+        return 0;
+    }
+    int64_t delayUs = anchorLocalUs_ + (sensorTimeUs - anchorSensorUs_) - nowUs;
+    if (delayUs < -maxDriftUs) {
+        // The channel or the encoder stalled longer than the pacer can make up, start over from this frame.
+        Anchor(sensorTimeUs, nowUs);
+        return 0;
+    }
+    if (delayUs > frameIntervalUs_) {
+        // The anchor frame itself came in late, move the anchor back so the hold stays bounded.
+        anchorLocalUs_ -= delayUs - frameIntervalUs_;
+        delayUs = frameIntervalUs_;
+    }
+    return std::max<int64_t>(delayUs, 0);
+}
+
+void DCameraSinkFramePacer::Reset()
+{
+    isAnchored_ = false;
+    anchorSensorUs_ = 0;
+    anchorLocalUs_ = 0;
+    lastSensorUs_ = 0;
+}
+
+void DCameraSinkFramePacer::Anchor(int64_t sensorTimeUs, int64_t localTimeUs)
+{
+    isAnchored_ = true;
+    anchorSensorUs_ = sensorTimeUs;
+    anchorLocalUs_ = localTimeUs;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -21,6 +21,7 @@
 #include "dcamera_sink_data_process.h"
 #include "dcamera_sink_output_channel_listener.h"
 #include "dcamera_sink_output_result_callback.h"
+#include "dcamera_softbus_adapter.h"
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
@@ -86,6 +87,10 @@ int32_t DCameraSinkOutput::OpenChannel(std::shared_ptr<DCameraChannelInfo>& info
     modeMaps.emplace(SNAPSHOT_FRAME, DCAMERA_SESSION_MODE_JPEG);
     std::vector<DCameraIndex> indexs;
     indexs.push_back(DCameraIndex(info->sourceDevId_, dhId_));
+    if (!info->sourceDevId_.empty()) {
+        DCameraSoftbusAdapter::GetInstance().SetPeerFrameInfoFormat(info->sourceDevId_,
+            static_cast<DCameraFrameInfoFormat>(info->frameInfoFormat_));
+    }
     for (auto iter = info->detail_.begin(); iter != info->detail_.end(); iter++) {
         if (sessionState_[iter->streamType_] != DCAMERA_CHANNEL_STATE_DISCONNECTED) {
             DHLOGE("wrong state, sessionState: %{public}d", sessionState_[iter->streamType_]);
@@ -95,6 +100,7 @@ int32_t DCameraSinkOutput::OpenChannel(std::shared_ptr<DCameraChannelInfo>& info
         if (iterCh == channels_.end()) {
             continue;
         }
+        iterCh->second->SetSessionMux(info->sessionMux_ && iter->streamType_ == SNAPSHOT_FRAME);
         auto output = std::shared_ptr<DCameraSinkOutput>(shared_from_this());
         std::shared_ptr<ICameraChannelListener> channelListener =
             std::make_shared<DCameraSinkOutputChannelListener>(iter->streamType_, output);
@@ -256,6 +262,47 @@ void DCameraSinkOutput::OnDataReceived(DCStreamType type, std::vector<std::share
 {
 }
 
+void DCameraSinkOutput::OnLinkQuality(DCStreamType type, const DCameraLinkQuality& quality)
+{
+    auto iter = dataProcesses_.find(type);
+    if (iter == dataProcesses_.end() || iter->second == nullptr) {
+        DHLOGD("OnLinkQuality: no data process, stream type: %{public}d", type);
+        return;
+    }
+    // Only a report that the bound QoS cannot be met caps the encoder, a satisfied one lifts the cap again.
+    iter->second->OnLinkCapacity(quality.isSatisfied ? 0 : quality.bandwidthBps);
+}
+
+void DCameraSinkOutput::RequestKeyFrame()
+{
+    auto iter = dataProcesses_.find(CONTINUOUS_FRAME);
+    if (iter == dataProcesses_.end() || iter->second == nullptr) {
+        DHLOGD("RequestKeyFrame: continuous frame is nullptr.");
+        return;
+    }
+    iter->second->RequestKeyFrame();
+}
+
+void DCameraSinkOutput::SetFramePaused(bool isPaused)
+{
+    auto iter = dataProcesses_.find(CONTINUOUS_FRAME);
+    if (iter == dataProcesses_.end() || iter->second == nullptr) {
+        DHLOGD("SetFramePaused: continuous frame is nullptr.");
+        return;
+    }
+    iter->second->SetFramePaused(isPaused);
+}
+
+void DCameraSinkOutput::SetBitratePercent(int32_t percent)
+{
+    auto iter = dataProcesses_.find(CONTINUOUS_FRAME);
+    if (iter == dataProcesses_.end() || iter->second == nullptr) {
+        DHLOGD("SetBitratePercent: continuous frame is nullptr.");
+        return;
+    }
+    iter->second->SetBitratePercent(percent);
+}
+
 int32_t DCameraSinkOutput::GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier)
 {
     if (dataProcesses_[CONTINUOUS_FRAME] == nullptr) {
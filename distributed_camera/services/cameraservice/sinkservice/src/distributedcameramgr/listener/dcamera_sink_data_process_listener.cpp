@@ -43,5 +43,15 @@ void DCameraSinkDataProcessListener::OnError(DataProcessErrorType errorType)
     }
     dataProcess->OnError(errorType);
 }
+
+bool DCameraSinkDataProcessListener::WaitOutputWritable(int64_t timeoutMs)
+{
+    std::shared_ptr<DCameraSinkDataProcess> dataProcess = dataProcess_.lock();
+    if (dataProcess == nullptr) {
+        DHLOGE("DCameraSinkDataProcessListener::WaitOutputWritable dataProcess is null");
+        return false;
+    }
+    return dataProcess->WaitSendCredit(timeoutMs);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -53,5 +53,15 @@ void DCameraSinkOutputChannelListener::OnDataReceived(std::vector<std::shared_pt
     }
     output->OnDataReceived(streamType_, buffers);
 }
+
+void DCameraSinkOutputChannelListener::OnLinkQuality(const DCameraLinkQuality& quality)
+{
+    std::shared_ptr<DCameraSinkOutput> output = output_.lock();
+    if (output == nullptr) {
+        DHLOGE("DCameraSinkOutputChannelListener::OnLinkQuality output is null");
+        return;
+    }
+    output->OnLinkQuality(streamType_, quality);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
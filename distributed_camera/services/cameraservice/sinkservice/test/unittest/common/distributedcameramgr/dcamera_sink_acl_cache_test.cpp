@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "dcamera_sink_acl_cache.h"
+#undef private
+#include "dcamera_utils_tools.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_NETWORK_ID = "bb536a637105409e904d4da83790a4a7";
+const std::string TEST_UDID = "1f9bbc7f1d0b4c3d8e1c7a3b2eaa0d5c";
+constexpr int32_t TEST_USER_ID = 100;
+constexpr uint64_t TEST_TOKEN_ID = 1;
+constexpr int32_t TEST_SECURITY_LEVEL = 4;
+}
+
+class DCameraSinkAclCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraSinkAclCacheTest::SetUpTestCase(void)
+{
+}
+
+void DCameraSinkAclCacheTest::TearDownTestCase(void)
+{
+}
+
+void DCameraSinkAclCacheTest::SetUp(void)
+{
+    DCameraSinkAclCache::GetInstance().Invalidate("test setup");
+}
+
+void DCameraSinkAclCacheTest::TearDown(void)
+{
+    DCameraSinkAclCache::GetInstance().Invalidate("test teardown");
+}
+
+/**
+ * @tc.name: dcamera_sink_acl_cache_test_001
+ * @tc.desc: Verify granted decisions are cached per key and dropped on invalidation.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSinkAclCacheTest, dcamera_sink_acl_cache_test_001, TestSize.Level1)
+{
+    DCameraSinkAclCache &cache = DCameraSinkAclCache::GetInstance();
+    DCameraAclKey key = { TEST_NETWORK_ID, TEST_USER_ID, TEST_TOKEN_ID, "account", TEST_TOKEN_ID };
+    EXPECT_FALSE(cache.IsAclGranted(key));
+    cache.CacheAclGranted(key, cache.GetGeneration());
+    EXPECT_TRUE(cache.IsAclGranted(key));
+
+    DCameraAclKey otherUser = key;
+    otherUser.userId = TEST_USER_ID + 1;
+    EXPECT_FALSE(cache.IsAclGranted(otherUser));
+
+    cache.CacheUdid(TEST_NETWORK_ID, TEST_UDID, cache.GetGeneration());
+    cache.CacheSecurityLevel(TEST_UDID, TEST_SECURITY_LEVEL, cache.GetGeneration());
+    std::string udid;
+    int32_t level = 0;
+    EXPECT_TRUE(cache.GetUdid(TEST_NETWORK_ID, udid));
+    EXPECT_EQ(TEST_UDID, udid);
+    EXPECT_TRUE(cache.GetSecurityLevel(TEST_UDID, level));
+    EXPECT_EQ(TEST_SECURITY_LEVEL, level);
+
+    cache.Invalidate("test");
+    EXPECT_FALSE(cache.IsAclGranted(key));
+    EXPECT_FALSE(cache.GetUdid(TEST_NETWORK_ID, udid));
+    EXPECT_FALSE(cache.GetSecurityLevel(TEST_UDID, level));
+}
+
+/**
+ * @tc.name: dcamera_sink_acl_cache_test_002
+ * @tc.desc: Verify a result looked up before an invalidation is not stored and expired entries are missed.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSinkAclCacheTest, dcamera_sink_acl_cache_test_002, TestSize.Level1)
+{
+    DCameraSinkAclCache &cache = DCameraSinkAclCache::GetInstance();
+    DCameraAclKey key = { TEST_NETWORK_ID, TEST_USER_ID, TEST_TOKEN_ID, "account", TEST_TOKEN_ID };
+    uint64_t generation = cache.GetGeneration();
+    cache.OnDeviceManagerDied();
+    cache.CacheAclGranted(key, generation);
+    EXPECT_FALSE(cache.IsAclGranted(key));
+
+    cache.CacheAclGranted(key, cache.GetGeneration());
+    cache.aclGrants_[key].cachedMs = GetNowTimeStampMs() - DCameraSinkAclCache::ENTRY_TTL_MS - 1;
+    EXPECT_FALSE(cache.IsAclGranted(key));
+    EXPECT_TRUE(cache.aclGrants_.empty());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,6 +19,7 @@
 #include <thread>
 
 #define private public
+#include "dcamera_sink_acl_cache.h"
 #include "dcamera_sink_controller.h"
 #include "dcamera_utils_tools.h"
 #undef private
@@ -38,6 +39,7 @@
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 #include "mock_device_manager.h"
+#include "metadata_utils.h"
 
 using namespace std;
 using namespace testing;
@@ -161,6 +163,7 @@ void DCameraSinkControllerTest::SetUp(void)
     g_channelStr = "";
     g_outputStr = "";
     g_operatorStr = "";
+    DCameraSinkAclCache::GetInstance().Invalidate("test setup");
 
     accessControl_ = std::make_shared<DCameraSinkAccessControl>();
     sptr<IDCameraSinkCallback> sinkCallback(new DCameraSinkCallback());
@@ -794,6 +797,23 @@ HWTEST_F(DCameraSinkControllerTest, dcamera_sink_controller_test_030, TestSize.L
     EXPECT_EQ(DCAMERA_BAD_VALUE, controller_->ResumeDistributedHardware(netId));
 }
 
+/**
+ * @tc.name: dcamera_sink_controller_test_warm_pause_001
+ * @tc.desc: Verify resuming a warm pause releases the frames without restarting the camera session.
+ * @tc.type: FUNC
+ * @tc.require: AR000GK6MV
+ */
+HWTEST_F(DCameraSinkControllerTest, dcamera_sink_controller_test_warm_pause_001, TestSize.Level1)
+{
+    std::string netId = "netId";
+    g_operatorStr = "test030";
+    controller_->isWarmPaused_.store(true);
+    EXPECT_EQ(DCAMERA_OK, controller_->ResumeDistributedHardware(netId));
+    EXPECT_FALSE(controller_->isWarmPaused_.load());
+    EXPECT_EQ(DCAMERA_BAD_VALUE, controller_->ResumeDistributedHardware(netId));
+    g_operatorStr = "";
+}
+
 /**
  * @tc.name: dcamera_sink_controller_test_031
  * @tc.desc: Verify StopDistributedHardware function.
@@ -1286,5 +1306,63 @@ HWTEST_F(DCameraSinkControllerTest, dcamera_sink_controller_test_start_capture_0
     EXPECT_EQ(DCAMERA_BAD_VALUE, ret);
 }
 #endif
+
+/**
+ * @tc.name: dcamera_sink_controller_test_pre_open_001
+ * @tc.desc: Verify the scene modes kept for pre-opening stay bounded.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSinkControllerTest, dcamera_sink_controller_test_pre_open_001, TestSize.Level1)
+{
+    int32_t sceneMode = 1;
+    controller_->RecordSceneMode(TEST_DEVICE_ID_EMPTY, sceneMode);
+    EXPECT_TRUE(controller_->lastSceneModes_.empty());
+    size_t maxEntries = DCameraSinkController::MAX_SCENE_MODE_ENTRIES;
+    for (size_t i = 0; i <= maxEntries; i++) {
+        controller_->RecordSceneMode("devId" + std::to_string(i), sceneMode);
+    }
+    EXPECT_EQ(maxEntries, controller_->lastSceneModes_.size());
+    controller_->RecordSceneMode("devId0", sceneMode + 1);
+    EXPECT_EQ(sceneMode + 1, controller_->lastSceneModes_["devId0"]);
+    EXPECT_NO_FATAL_FAILURE(controller_->TryPreOpenCapture("devId0"));
+    EXPECT_NO_FATAL_FAILURE(controller_->ProcessPreOpenTimeout());
+}
+
+/**
+ * @tc.name: dcamera_sink_controller_test_degradation_001
+ * @tc.desc: Verify the fps range of the capture settings is kept and a stopped capture is not degraded.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSinkControllerTest, dcamera_sink_controller_test_degradation_001, TestSize.Level1)
+{
+    std::vector<int32_t> fpsRange = { 15, 30 };
+    std::shared_ptr<Camera::CameraMetadata> cameraMetadata =
+        std::make_shared<Camera::CameraMetadata>(CAMERA_META_DATA_ITEM_CAPACITY, CAMERA_META_DATA_DATA_CAPACITY);
+    EXPECT_TRUE(cameraMetadata->addEntry(OHOS_CONTROL_FPS_RANGES, fpsRange.data(), fpsRange.size()));
+    std::string abilityString = Camera::MetadataUtils::EncodeToString(cameraMetadata);
+    std::shared_ptr<DCameraSettings> setting = std::make_shared<DCameraSettings>();
+    setting->type_ = UPDATE_METADATA;
+    setting->value_ = Base64Encode(reinterpret_cast<const unsigned char *>(abilityString.c_str()),
+        abilityString.length());
+    std::shared_ptr<DCameraCaptureInfo> captureInfo = std::make_shared<DCameraCaptureInfo>();
+    captureInfo->streamType_ = SNAPSHOT_FRAME;
+    captureInfo->captureSettings_.push_back(setting);
+    std::vector<std::shared_ptr<DCameraCaptureInfo>> captureInfos = { nullptr, captureInfo };
+    EXPECT_TRUE(DCameraSinkController::GetFpsRange(captureInfos).empty());
+    captureInfo->streamType_ = CONTINUOUS_FRAME;
+    EXPECT_EQ(fpsRange, DCameraSinkController::GetFpsRange(captureInfos));
+
+    controller_->fpsRange_ = fpsRange;
+    EXPECT_EQ(DCAMERA_OK, controller_->UpdateFrameRate(DCameraSinkDegradationPolicy::GetStep(
+        DegradationLevel::FPS).fpsPercent));
+    g_operatorStr = "test015";
+    EXPECT_EQ(DCAMERA_BAD_VALUE, controller_->UpdateFrameRate(DCameraSinkController::PERCENT_BASE));
+
+    controller_->captureState_ = DCameraSinkController::CAPTURE_IDLE;
+    controller_->ProcessDegradationCheck();
+    EXPECT_EQ(DegradationLevel::NONE, controller_->degradationPolicy_.GetLevel());
+}
 } // namespace DistributedHardware
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
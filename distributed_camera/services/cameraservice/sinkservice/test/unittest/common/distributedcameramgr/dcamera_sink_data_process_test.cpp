@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,8 +14,10 @@
  */
 
 #include <chrono>
+#include <condition_variable>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 #define private public
@@ -264,15 +266,19 @@ HWTEST_F(DCameraSinkDataProcessTest, dcamera_sink_data_process_test_010, TestSiz
  */
 HWTEST_F(DCameraSinkDataProcessTest, dcamera_sink_data_process_test_011, TestSize.Level1)
 {
-    SensorData accData = {123456789, {1.0f, 2.0f, 3.0f}};
-    SensorData gyroData = {123456790, {4.0f, 5.0f, 6.0f}};
-    DCameraSinkImuSensor::GetInstance().PackedImuData();
+    ImuSample accData = {123456789, {1.0f, 2.0f, 3.0f}};
+    ImuSample gyroData = {123456790, {4.0f, 5.0f, 6.0f}};
+    EisInfo eisInfo;
+    DCameraSinkImuSensor::GetInstance().GetImuData(eisInfo);
 
-    DCameraSinkImuSensor::GetInstance().accInfos.push_back(accData);
-    DCameraSinkImuSensor::GetInstance().PackedImuData();
+    DCameraSinkImuSensor::GetInstance().SaveAccInfo(accData);
+    DCameraSinkImuSensor::GetInstance().GetImuData(eisInfo);
+    EXPECT_EQ(1, eisInfo.accData.size());
 
-    DCameraSinkImuSensor::GetInstance().gyroInfos.push_back(gyroData);
-    DCameraSinkImuSensor::GetInstance().PackedImuData();
+    DCameraSinkImuSensor::GetInstance().SaveGyroInfo(gyroData);
+    DCameraSinkImuSensor::GetInstance().GetImuData(eisInfo);
+    EXPECT_TRUE(eisInfo.accData.empty());
+    EXPECT_EQ(1, eisInfo.gyroData.size());
 
     dataProcess_->AccRegisterSensorListener();
     dataProcess_->AccRegisterSensorListener();
@@ -290,6 +296,143 @@ HWTEST_F(DCameraSinkDataProcessTest, dcamera_sink_data_process_test_011, TestSiz
     delete[] event.data;
 }
 #endif
+
+/**
+ * @tc.name: dcamera_sink_data_process_test_012
+ * @tc.desc: Verify video sends are limited by credits and a returned credit wakes the waiter.
+ * @tc.type: FUNC
+ * @tc.require: AR000GK6N1
+ */
+HWTEST_F(DCameraSinkDataProcessTest, dcamera_sink_data_process_test_012, TestSize.Level1)
+{
+    for (int32_t i = 0; i < DCameraSinkDataProcess::MAX_SEND_CREDITS; i++) {
+        EXPECT_TRUE(dataProcess_->AcquireSendCredit());
+    }
+    EXPECT_FALSE(dataProcess_->AcquireSendCredit());
+    EXPECT_FALSE(dataProcess_->WaitSendCredit(1));
+
+    std::thread sender([this]() { dataProcess_->ReturnSendCredit(); });
+    EXPECT_TRUE(dataProcess_->WaitSendCredit(SLEEP_TIME_MS));
+    sender.join();
+    EXPECT_TRUE(dataProcess_->AcquireSendCredit());
+
+    dataProcess_->ResetSendCredits();
+    dataProcess_->ReturnSendCredit();
+    EXPECT_EQ(DCameraSinkDataProcess::MAX_SEND_CREDITS, dataProcess_->sendCredits_);
+}
+
+/**
+ * @tc.name: dcamera_sink_data_process_test_013
+ * @tc.desc: Verify a warm paused stream holds encoded frames back until it is resumed or stopped.
+ * @tc.type: FUNC
+ * @tc.require: AR000GK6N1
+ */
+HWTEST_F(DCameraSinkDataProcessTest, dcamera_sink_data_process_test_013, TestSize.Level1)
+{
+    dataProcess_->SetFramePaused(true);
+    EXPECT_EQ(DCAMERA_OK, dataProcess_->FeedStream(g_testDataBuffer));
+    EXPECT_EQ(DCAMERA_OK, dataProcess_->OnProcessedVideoBuffer(g_testDataBuffer));
+    EXPECT_EQ(DCameraSinkDataProcess::MAX_SEND_CREDITS, dataProcess_->sendCredits_);
+
+    dataProcess_->SetFramePaused(false);
+    EXPECT_FALSE(dataProcess_->isFramePaused_.load());
+    dataProcess_->SetFramePaused(true);
+    EXPECT_EQ(DCAMERA_OK, dataProcess_->StopCapture());
+    EXPECT_FALSE(dataProcess_->isFramePaused_.load());
+}
+
+/**
+ * @tc.name: dcamera_sink_data_process_test_014
+ * @tc.desc: Verify a stale delta frame is dropped with the deltas behind it until the next key frame.
+ * @tc.type: FUNC
+ * @tc.require: AR000GK6N1
+ */
+HWTEST_F(DCameraSinkDataProcessTest, dcamera_sink_data_process_test_014, TestSize.Level1)
+{
+    std::shared_ptr<DataBuffer> delta = std::make_shared<DataBuffer>(TEST_STRING.length());
+    delta->SetInt32(DataBufferKey::FRAME_TYPE, 0);
+    std::shared_ptr<DataBuffer> key = std::make_shared<DataBuffer>(TEST_STRING.length());
+    key->SetInt32(DataBufferKey::FRAME_TYPE, 1);
+    EXPECT_FALSE(DCameraSinkDataProcess::IsKeyFrame(delta));
+    EXPECT_TRUE(DCameraSinkDataProcess::IsKeyFrame(key));
+    EXPECT_TRUE(DCameraSinkDataProcess::IsKeyFrame(g_testDataBuffer));
+
+    int64_t nowUs = GetNowTimeStampUs();
+    EXPECT_TRUE(dataProcess_->AcquireSendCredit());
+    EXPECT_TRUE(dataProcess_->AcquireSendCredit());
+    dataProcess_->sendFrames_.push_back({ delta, false, true,
+        nowUs - DCameraSinkDataProcess::MAX_SEND_QUEUE_AGE_US - 1 });
+    dataProcess_->sendFrames_.push_back({ delta, false, true, nowUs });
+    dataProcess_->sendFrames_.push_back({ key, true, false, nowUs });
+    std::weak_ptr<IDataProcessPipeline> weakPipeline = dataProcess_->pipeline_;
+    dataProcess_->SendNextFrame(weakPipeline, nullptr);
+    EXPECT_TRUE(dataProcess_->isWaitKeyFrame_);
+    dataProcess_->SendNextFrame(weakPipeline, nullptr);
+    EXPECT_EQ(DCameraSinkDataProcess::MAX_SEND_CREDITS, dataProcess_->sendCredits_);
+    dataProcess_->SendNextFrame(weakPipeline, nullptr);
+    EXPECT_FALSE(dataProcess_->isWaitKeyFrame_);
+
+    DCameraNodeStatsInfo info;
+    dataProcess_->sendStats_->GetInfo(info);
+    EXPECT_EQ(2U, info.framesDropped);
+    EXPECT_EQ(1U, info.framesOut);
+    EXPECT_EQ(0U, info.queueDepth);
+}
+
+/**
+ * @tc.name: dcamera_sink_data_process_test_015
+ * @tc.desc: Verify the snapshot send queue is bounded and gives up its oldest frame.
+ * @tc.type: FUNC
+ * @tc.require: AR000GK6N1
+ */
+HWTEST_F(DCameraSinkDataProcessTest, dcamera_sink_data_process_test_015, TestSize.Level1)
+{
+    dataProcess_->captureInfo_ = g_testCaptureInfoSnapshot;
+    std::mutex blockMutex;
+    std::condition_variable blockCond;
+    bool isReleased = false;
+    dataProcess_->eventQueue_->PostTask([&]() {
+        std::unique_lock<std::mutex> lock(blockMutex);
+        blockCond.wait(lock, [&isReleased] { return isReleased; });
+    });
+    for (size_t i = 0; i <= DCameraSinkDataProcess::MAX_SNAPSHOT_PENDING; i++) {
+        EXPECT_EQ(DCAMERA_OK, dataProcess_->FeedStream(g_testDataBuffer));
+    }
+    {
+        std::lock_guard<std::mutex> lock(dataProcess_->sendMutex_);
+        EXPECT_EQ(DCameraSinkDataProcess::MAX_SNAPSHOT_PENDING, dataProcess_->sendFrames_.size());
+    }
+    DCameraNodeStatsInfo info;
+    dataProcess_->sendStats_->GetInfo(info);
+    EXPECT_EQ(1U, info.framesDropped);
+    {
+        std::lock_guard<std::mutex> lock(blockMutex);
+        isReleased = true;
+    }
+    blockCond.notify_all();
+    dataProcess_->eventQueue_->Stop();
+}
+
+/**
+ * @tc.name: dcamera_sink_data_process_test_016
+ * @tc.desc: Verify only an HDR H265 stream is captured as P010, other P010 streams fall back to 8 bit.
+ * @tc.type: FUNC
+ * @tc.require: AR000GK6MV
+ */
+HWTEST_F(DCameraSinkDataProcessTest, dcamera_sink_data_process_test_016, TestSize.Level1)
+{
+    std::shared_ptr<DCameraCaptureInfo> captureInfo = std::make_shared<DCameraCaptureInfo>();
+    captureInfo->format_ = OHOS_CAMERA_FORMAT_YCBCB_P010;
+    captureInfo->encodeType_ = ENCODE_TYPE_H265;
+    EXPECT_EQ(Videoformat::P010, dataProcess_->GetPipelineFormat(captureInfo->format_));
+    EXPECT_EQ(Videoformat::NV21, dataProcess_->GetCaptureFormat(captureInfo));
+
+    captureInfo->hdrType_ = DCAMERA_HDR_HLG;
+    EXPECT_EQ(Videoformat::P010, dataProcess_->GetCaptureFormat(captureInfo));
+
+    captureInfo->encodeType_ = ENCODE_TYPE_H264;
+    EXPECT_EQ(Videoformat::NV21, dataProcess_->GetCaptureFormat(captureInfo));
+}
 #endif
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dcamera_sink_degradation_policy.h"
+#include "distributed_camera_constants.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t TEST_THERMAL_NORMAL = 1;
+constexpr int32_t TEST_THERMAL_WARM = 2;
+constexpr int32_t TEST_THERMAL_HOT = 3;
+constexpr int32_t TEST_THERMAL_OVERHEATED = 4;
+constexpr int32_t TEST_POWER_NORMAL = 600;
+constexpr int32_t TEST_POWER_SAVE = 601;
+constexpr int32_t TEST_POWER_EXTREME_SAVE = 603;
+constexpr int64_t TEST_START_US = 1000000;
+constexpr int64_t TEST_POLL_US = 5000000;
+}
+
+class DCameraSinkDegradationPolicyTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    DCameraSinkDegradationPolicy policy_;
+};
+
+void DCameraSinkDegradationPolicyTest::SetUpTestCase(void)
+{
+}
+
+void DCameraSinkDegradationPolicyTest::TearDownTestCase(void)
+{
+}
+
+void DCameraSinkDegradationPolicyTest::SetUp(void)
+{
+    policy_.Reset();
+}
+
+void DCameraSinkDegradationPolicyTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: dcamera_sink_degradation_policy_test_001
+ * @tc.desc: Verify thermal levels and power modes map to the degradation levels and their steps.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSinkDegradationPolicyTest, dcamera_sink_degradation_policy_test_001, TestSize.Level1)
+{
+    EXPECT_EQ(DegradationLevel::NONE, DCameraSinkDegradationPolicy::GetThermalPressure(TEST_THERMAL_NORMAL));
+    EXPECT_EQ(DegradationLevel::FPS, DCameraSinkDegradationPolicy::GetThermalPressure(TEST_THERMAL_WARM));
+    EXPECT_EQ(DegradationLevel::RESOLUTION, DCameraSinkDegradationPolicy::GetThermalPressure(TEST_THERMAL_HOT));
+    EXPECT_EQ(DegradationLevel::BITRATE, DCameraSinkDegradationPolicy::GetThermalPressure(TEST_THERMAL_OVERHEATED));
+    EXPECT_EQ(DegradationLevel::NONE, DCameraSinkDegradationPolicy::GetPowerModePressure(TEST_POWER_NORMAL));
+    EXPECT_EQ(DegradationLevel::FPS, DCameraSinkDegradationPolicy::GetPowerModePressure(TEST_POWER_SAVE));
+    EXPECT_EQ(DegradationLevel::RESOLUTION,
+        DCameraSinkDegradationPolicy::GetPowerModePressure(TEST_POWER_EXTREME_SAVE));
+
+    DegradationStep none = DCameraSinkDegradationPolicy::GetStep(DegradationLevel::NONE);
+    DegradationStep fps = DCameraSinkDegradationPolicy::GetStep(DegradationLevel::FPS);
+    DegradationStep resolution = DCameraSinkDegradationPolicy::GetStep(DegradationLevel::RESOLUTION);
+    DegradationStep bitrate = DCameraSinkDegradationPolicy::GetStep(DegradationLevel::BITRATE);
+    EXPECT_EQ(100, none.fpsPercent);
+    EXPECT_LT(fps.fpsPercent, none.fpsPercent);
+    EXPECT_EQ(100, fps.resolutionPercent);
+    EXPECT_LE(resolution.fpsPercent, fps.fpsPercent);
+    EXPECT_LT(resolution.resolutionPercent, 100);
+    EXPECT_EQ(100, resolution.bitratePercent);
+    EXPECT_EQ(resolution.resolutionPercent, bitrate.resolutionPercent);
+    EXPECT_LT(bitrate.bitratePercent, 100);
+
+    std::string content = DCameraSinkDegradationPolicy::MakeNotifyContent(bitrate);
+    EXPECT_EQ(0, content.compare(0, SINK_CAPTURE_DEGRADED.size(), SINK_CAPTURE_DEGRADED));
+    EXPECT_NE(std::string::npos, content.find("level:3"));
+}
+
+/**
+ * @tc.name: dcamera_sink_degradation_policy_test_002
+ * @tc.desc: Verify the level follows the higher of both pressures at once.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSinkDegradationPolicyTest, dcamera_sink_degradation_policy_test_002, TestSize.Level1)
+{
+    DegradationLevel level = DegradationLevel::NONE;
+    EXPECT_FALSE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_NORMAL, TEST_START_US, level));
+    EXPECT_TRUE(policy_.Evaluate(TEST_THERMAL_WARM, TEST_POWER_EXTREME_SAVE, TEST_START_US + TEST_POLL_US, level));
+    EXPECT_EQ(DegradationLevel::RESOLUTION, level);
+    EXPECT_TRUE(policy_.Evaluate(TEST_THERMAL_OVERHEATED, TEST_POWER_NORMAL, TEST_START_US + TEST_POLL_US * 2,
+        level));
+    EXPECT_EQ(DegradationLevel::BITRATE, level);
+    EXPECT_EQ(DegradationLevel::BITRATE, policy_.GetLevel());
+    policy_.Reset();
+    EXPECT_EQ(DegradationLevel::NONE, policy_.GetLevel());
+}
+
+/**
+ * @tc.name: dcamera_sink_degradation_policy_test_003
+ * @tc.desc: Verify the level steps back one level per hold once the pressure eases.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSinkDegradationPolicyTest, dcamera_sink_degradation_policy_test_003, TestSize.Level1)
+{
+    DegradationLevel level = DegradationLevel::NONE;
+    int64_t nowUs = TEST_START_US;
+    EXPECT_TRUE(policy_.Evaluate(TEST_THERMAL_HOT, TEST_POWER_NORMAL, nowUs, level));
+    EXPECT_EQ(DegradationLevel::RESOLUTION, level);
+
+    nowUs += TEST_POLL_US;
+    EXPECT_FALSE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_NORMAL, nowUs, level));
+    // Touching the boundary again restarts the hold.
+    EXPECT_FALSE(policy_.Evaluate(TEST_THERMAL_HOT, TEST_POWER_NORMAL, nowUs + TEST_POLL_US, level));
+    nowUs += TEST_POLL_US * 2;
+    EXPECT_FALSE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_NORMAL, nowUs, level));
+    EXPECT_FALSE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_NORMAL,
+        nowUs + DCameraSinkDegradationPolicy::RECOVER_HOLD_US - 1, level));
+    nowUs += DCameraSinkDegradationPolicy::RECOVER_HOLD_US;
+    EXPECT_TRUE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_NORMAL, nowUs, level));
+    EXPECT_EQ(DegradationLevel::FPS, level);
+
+    EXPECT_FALSE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_NORMAL, nowUs + TEST_POLL_US, level));
+    nowUs += DCameraSinkDegradationPolicy::RECOVER_HOLD_US;
+    EXPECT_TRUE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_NORMAL, nowUs, level));
+    EXPECT_EQ(DegradationLevel::NONE, level);
+    EXPECT_FALSE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_NORMAL, nowUs + TEST_POLL_US, level));
+}
+
+/**
+ * @tc.name: dcamera_sink_degradation_policy_test_004
+ * @tc.desc: Verify a power save mode keeps its level however cool the device gets.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSinkDegradationPolicyTest, dcamera_sink_degradation_policy_test_004, TestSize.Level1)
+{
+    DegradationLevel level = DegradationLevel::NONE;
+    int64_t nowUs = TEST_START_US;
+    EXPECT_TRUE(policy_.Evaluate(TEST_THERMAL_HOT, TEST_POWER_SAVE, nowUs, level));
+    nowUs += TEST_POLL_US;
+    EXPECT_FALSE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_SAVE, nowUs, level));
+    nowUs += DCameraSinkDegradationPolicy::RECOVER_HOLD_US;
+    EXPECT_TRUE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_SAVE, nowUs, level));
+    EXPECT_EQ(DegradationLevel::FPS, level);
+    nowUs += DCameraSinkDegradationPolicy::RECOVER_HOLD_US * 2;
+    EXPECT_FALSE(policy_.Evaluate(TEST_THERMAL_NORMAL, TEST_POWER_SAVE, nowUs, level));
+    EXPECT_EQ(DegradationLevel::FPS, policy_.GetLevel());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
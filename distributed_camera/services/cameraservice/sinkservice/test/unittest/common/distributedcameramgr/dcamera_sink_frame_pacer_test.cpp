@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dcamera_sink_frame_pacer.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t TEST_FPS = 30;
+constexpr int64_t TEST_INTERVAL_US = 33333;
+constexpr int64_t TEST_SENSOR_US = 1000000;
+constexpr int64_t TEST_LOCAL_US = 5000000;
+}
+
+class DCameraSinkFramePacerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraSinkFramePacerTest::SetUpTestCase(void)
+{
+}
+
+void DCameraSinkFramePacerTest::TearDownTestCase(void)
+{
+}
+
+void DCameraSinkFramePacerTest::SetUp(void)
+{
+}
+
+void DCameraSinkFramePacerTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: dcamera_sink_frame_pacer_test_001
+ * @tc.desc: Verify an early frame is held to its sensor slot, a late one goes at once and a stall re-anchors.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSinkFramePacerTest, dcamera_sink_frame_pacer_test_001, TestSize.Level1)
+{
+    DCameraSinkFramePacer pacer(TEST_FPS);
+    EXPECT_EQ(0, pacer.GetSendDelayUs(TEST_SENSOR_US, TEST_LOCAL_US));
+    EXPECT_EQ(13333, pacer.GetSendDelayUs(TEST_SENSOR_US + TEST_INTERVAL_US, TEST_LOCAL_US + 20000));
+    EXPECT_EQ(0, pacer.GetSendDelayUs(TEST_SENSOR_US + 2 * TEST_INTERVAL_US, TEST_LOCAL_US + 70000));
+
+    EXPECT_EQ(0, pacer.GetSendDelayUs(TEST_SENSOR_US + 3 * TEST_INTERVAL_US, TEST_LOCAL_US + 250000));
+    EXPECT_EQ(23333, pacer.GetSendDelayUs(TEST_SENSOR_US + 4 * TEST_INTERVAL_US, TEST_LOCAL_US + 260000));
+}
+
+/**
+ * @tc.name: dcamera_sink_frame_pacer_test_002
+ * @tc.desc: Verify the hold is bounded by one interval and broken sensor timestamps are never held.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSinkFramePacerTest, dcamera_sink_frame_pacer_test_002, TestSize.Level1)
+{
+    DCameraSinkFramePacer pacer(TEST_FPS);
+    EXPECT_EQ(0, pacer.GetSendDelayUs(TEST_SENSOR_US, TEST_LOCAL_US));
+    EXPECT_EQ(TEST_INTERVAL_US, pacer.GetSendDelayUs(TEST_SENSOR_US + 2 * TEST_INTERVAL_US, TEST_LOCAL_US + 1000));
+    EXPECT_EQ(0, pacer.GetSendDelayUs(TEST_SENSOR_US + TEST_INTERVAL_US, TEST_LOCAL_US + 2000));
+    EXPECT_EQ(0, pacer.GetSendDelayUs(TEST_SENSOR_US + 10 * TEST_INTERVAL_US, TEST_LOCAL_US + 3000));
+    EXPECT_EQ(0, pacer.GetSendDelayUs(0, TEST_LOCAL_US + 4000));
+
+    pacer.Reset();
+    EXPECT_EQ(0, pacer.GetSendDelayUs(TEST_SENSOR_US + 11 * TEST_INTERVAL_US, TEST_LOCAL_US + 5000));
+
+    DCameraSinkFramePacer unpaced(0);
+    EXPECT_EQ(0, unpaced.GetSendDelayUs(TEST_SENSOR_US, TEST_LOCAL_US));
+    EXPECT_EQ(0, unpaced.GetSendDelayUs(TEST_SENSOR_US + 2 * TEST_INTERVAL_US, TEST_LOCAL_US));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -33,6 +33,14 @@ enum class HidumpFlag {
     GET_VERSION_INFO,
     START_DUMP,
     STOP_DUMP,
+    GET_LATENCY_INFO,
+    RESET_LATENCY_INFO,
+    GET_PIPELINE_STATS,
+    GET_FRAME_DROP_INFO,
+    GET_MEMORY_INFO,
+    GET_STARTUP_INFO,
+    GET_CAPTURE_GROUP_INFO,
+    GET_EVENT_STATS,
 };
 
 typedef enum {
@@ -66,6 +74,13 @@ private:
     int32_t GetRegisteredInfo(std::string& result);
     int32_t GetCurrentStateInfo(std::string& result);
     int32_t GetVersionInfo(std::string& result);
+    int32_t GetLatencyInfo(std::string& result);
+    int32_t GetPipelineStats(std::string& result);
+    int32_t GetFrameDropInfo(std::string& result);
+    int32_t GetMemoryInfo(std::string& result);
+    int32_t GetStartupInfo(std::string& result);
+    int32_t GetCaptureGroupInfo(std::string& result);
+    int32_t GetEventStats(std::string& result);
 
 private:
     CameraDumpInfo camDumpInfo_;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,11 +16,16 @@
 #ifndef OHOS_DCAMERA_SOURCE_DEV_H
 #define OHOS_DCAMERA_SOURCE_DEV_H
 
+#include <functional>
+#include <map>
+#include <mutex>
 #include <set>
 
 #include "dcamera_index.h"
+#include "dcamera_settings_coalescer.h"
 #include "dcamera_source_event.h"
 #include "dcamera_source_state_machine.h"
+#include "distributed_camera_constants.h"
 #include "event_handler.h"
 #include "icamera_controller.h"
 #include "icamera_state_listener.h"
@@ -41,7 +46,12 @@ enum DcameraBusinessState : int32_t {
 const uint32_t EVENT_SOURCE_DEV_PROCESS = 0;
 const uint32_t EVENT_HICOLLIE = 1;
 const uint32_t EVENT_PROCESS_HDF_NOTIFY = 2;
+const uint32_t EVENT_SETTINGS_WINDOW = 3;
 const uint32_t EVENT_DCAMERA_FORCE_SWITCH = 4;
+const uint32_t EVENT_REQUEST_KEY_FRAME = 5;
+const uint32_t EVENT_ALLCONNECT_APPLY_RESULT = 6;
+const uint32_t EVENT_HDI_CALL_RESULT = 7;
+const uint32_t EVENT_HDI_CALL_TIMEOUT = 8;
 class DCameraSourceDev : public std::enable_shared_from_this<DCameraSourceDev> {
 public:
     explicit DCameraSourceDev(std::string devId, std::string dhId, std::shared_ptr<ICameraStateListener>& stateLisener);
@@ -66,9 +76,12 @@ public:
 
     int32_t GetStateInfo();
     std::string GetVersion();
+    int32_t GetControlFormat();
+    bool IsSessionMux();
     int32_t OnChannelConnectedEvent();
     int32_t OnChannelDisconnectedEvent();
     int32_t PostHicollieEvent();
+    int32_t PostKeyFrameRequestEvent();
     void SetHicollieFlag(bool flag);
     bool GetHicollieFlag();
     int32_t GetFullCaps();
@@ -111,6 +124,26 @@ private:
     void DoProcessData(const AppExecFwk::InnerEvent::Pointer &event);
     void DoProcesHDFEvent(const AppExecFwk::InnerEvent::Pointer &event);
     void DoHicollieProcess();
+    void DoSettingsWindowProcess();
+    void DoKeyFrameRequestProcess();
+    int32_t ApplyAdvancedResource(const std::shared_ptr<DCameraOpenInfo>& openInfo);
+    void DoApplyResultProcess(const AppExecFwk::InnerEvent::Pointer &event);
+    int32_t OpenChannelWithResource(std::shared_ptr<DCameraOpenInfo>& openInfo);
+    int32_t PostSettingsEvent(const std::vector<std::shared_ptr<DCameraSettings>>& settings);
+    int32_t PostSettingsWindowEvent();
+    void PostSourceEvent(std::shared_ptr<DCameraSourceEvent>& eventParam);
+    bool IsSupersededByClose(DCAMERA_EVENT eventType, int64_t seq);
+    int32_t PostHdiCall(DCAMERA_EVENT eventType, std::shared_ptr<DCameraRegistParam>& param,
+        std::function<int32_t()> call);
+    void DoHdiResultProcess(const AppExecFwk::InnerEvent::Pointer &event);
+    int32_t FinishRegister(int32_t retHdi);
+    int32_t FinishUnRegister(int32_t retHdi);
+
+    struct HdiPendingCall {
+        DCAMERA_EVENT eventType;
+        std::shared_ptr<DCameraRegistParam> param;
+        int32_t state;
+    };
 
 private:
     std::string devId_;
@@ -119,6 +152,11 @@ private:
     std::set<DCameraIndex> actualDevInfo_;
     std::shared_ptr<ICameraStateListener> stateListener_;
     std::shared_ptr<DCameraSourceDevEventHandler> srcDevEventHandler_ = nullptr;
+    // Settings updates run here so they are not queued behind a slow open or stream configuration.
+    std::shared_ptr<DCameraSourceDevEventHandler> srcDevCtrlEventHandler_ = nullptr;
+    std::mutex postMutex_;
+    // Sequence of the last close posted, the operations queued before it are dropped unstarted.
+    std::atomic<int64_t> closeSeq_ = 0;
     std::shared_ptr<DCameraSourceStateMachine> stateMachine_;
     std::shared_ptr<ICameraController> controller_;
     std::shared_ptr<ICameraInput> input_;
@@ -127,6 +165,28 @@ private:
     int32_t sceneMode_ = 0;
     uint64_t tokenId_ = 0;
     bool eis_ = false;
+    // Set from the source attrs when the camera captures in lockstep with cameras of other sinks.
+    std::string captureGroupId_;
+    std::atomic<int32_t> controlFormat_ = DCAMERA_CONTROL_FORMAT_JSON;
+    std::atomic<bool> sessionMux_ = false;
+    // An open waiting for the collaboration service, a close bumps the generation so its result is dropped.
+    std::shared_ptr<DCameraOpenInfo> pendingOpenInfo_ = nullptr;
+    std::atomic<int64_t> openGeneration_ = 0;
+    // Enabling and disabling the HDF device run here, their results come back to the event thread as events.
+    std::shared_ptr<AppExecFwk::EventHandler> hdiEventHandler_ = nullptr;
+    std::map<int64_t, HdiPendingCall> pendingHdiCalls_;
+    std::atomic<int64_t> hdiGeneration_ = 0;
+    bool isHdiResultDeferred_ = false;
+    // Settings arriving while a window is open are coalesced and sent when it closes.
+    std::mutex settingsMutex_;
+    DCameraSettingsCoalescer settingsCoalescer_;
+    bool isSettingsWindowOpen_ = false;
+    int32_t settingsWindowMs_ = DEFAULT_SETTINGS_WINDOW_MS;
+
+    constexpr static const char *SETTINGS_WINDOW_PARA = "sys.dcamera.source.settings.window.ms";
+    constexpr static int32_t DEFAULT_SETTINGS_WINDOW_MS = 33;
+    constexpr static int32_t MAX_SETTINGS_WINDOW_MS = 200;
+    constexpr static int64_t HDI_CALL_TIMEOUT_MS = 5000;
 
     std::map<uint32_t, DCameraNotifyFunc> memberFuncMap_;
     std::map<uint32_t, DCameraEventResult> eventResultMap_;
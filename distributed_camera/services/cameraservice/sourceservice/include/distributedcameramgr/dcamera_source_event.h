@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,12 +16,15 @@
 #ifndef OHOS_DCAMERA_SOURCE_EVENT_H
 #define OHOS_DCAMERA_SOURCE_EVENT_H
 
+#include <memory>
 #include <variant>
 
+#include "cJSON.h"
 #include "v1_1/dcamera_types.h"
 
 #include "dcamera_event_cmd.h"
 #include "dcamera_index.h"
+#include "distributed_camera_constants.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -41,6 +44,22 @@ typedef enum {
     DCAMERA_EVENT_GET_FULLCAPS = 11,
 } DCAMERA_EVENT;
 
+/*
+ * Sink attrs parsed once at register. The tree is kept so the HDI ability document is built from it instead of
+ * parsing the attrs a second time; it is shared and must not be modified.
+ */
+class DCameraSinkAbility {
+public:
+    int32_t Unmarshal(const std::string& sinkAttrs);
+
+    bool eis_ = false;
+    int32_t controlFormat_ = DCAMERA_CONTROL_FORMAT_JSON;
+    bool hdr10_ = false;
+    // The sink carries the snapshot stream on the control socket when asked to.
+    bool sessionMux_ = false;
+    std::shared_ptr<cJSON> root_;
+};
+
 class DCameraRegistParam {
 public:
     DCameraRegistParam() = default;
@@ -53,6 +72,7 @@ public:
     std::string reqId_;
     std::string sinkParam_;
     std::string srcParam_;
+    std::shared_ptr<DCameraSinkAbility> sinkAbility_;
 };
 
 class DCameraSourceEvent {
@@ -111,6 +131,8 @@ public:
     int32_t GetStreamIds(std::vector<int>& streamIds);
     int32_t GetCameraEvent(std::shared_ptr<DCameraEvent>& camEvent);
     DCAMERA_EVENT GetEventType();
+    void SetPostTimeUs(int64_t postTimeUs);
+    int64_t GetPostTimeUs();
 
 private:
     using EventParam = std::variant<std::monostate,
@@ -124,6 +146,7 @@ private:
 private:
     DCAMERA_EVENT eventType_;
     EventParam eventParam_;
+    int64_t postTimeUs_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
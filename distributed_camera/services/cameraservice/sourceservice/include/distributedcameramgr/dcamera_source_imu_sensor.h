@@ -35,7 +35,6 @@ private:
     DCameraSrcImuSensor() = default;
     ~DCameraSrcImuSensor();
 
-    std::string param_;
     bool eis_ = false;
 };
 } // namespace DistributedHardware
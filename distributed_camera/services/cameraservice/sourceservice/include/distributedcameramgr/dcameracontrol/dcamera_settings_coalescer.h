@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_SETTINGS_COALESCER_H
+#define OHOS_DCAMERA_SETTINGS_COALESCER_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "camera_metadata_info.h"
+#include "v1_1/dcamera_types.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+using namespace OHOS::HDI::DistributedCamera::V1_1;
+
+/*
+ * Folds a burst of metadata updates into one. The entries of every merged UPDATE_METADATA setting are kept per
+ * tag with the last writer winning, so a zoom or exposure sweep only sends its newest values. Not thread safe,
+ * the owner serializes the calls.
+ */
+class DCameraSettingsCoalescer {
+public:
+    // False when a setting is not a metadata update that can be merged, the caller then sends them as is.
+    bool Merge(const std::vector<std::shared_ptr<DCameraSettings>>& settings);
+    // Hands out the merged update and starts over, empty when nothing is pending.
+    std::vector<std::shared_ptr<DCameraSettings>> Take();
+    bool IsEmpty() const;
+
+private:
+    bool MergeMetadata(const std::shared_ptr<Camera::CameraMetadata>& metadata);
+
+    constexpr static size_t PENDING_ITEM_CAPACITY = 64;
+    constexpr static size_t PENDING_DATA_CAPACITY = 1024;
+
+    std::shared_ptr<Camera::CameraMetadata> pending_ = nullptr;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_SETTINGS_COALESCER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,6 +19,7 @@
 #include "icamera_controller.h"
 
 #include "dcamera_index.h"
+#include "dcamera_metadata_setting_cmd.h"
 #include "icamera_channel_listener.h"
 #include "dcamera_source_dev.h"
 #include "dcamera_source_state_machine.h"
@@ -28,6 +29,7 @@
 #include "camera_service_proxy.h"
 
 #include "v1_1/id_camera_provider.h"
+#include "v1_2/id_camera_provider.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -52,6 +54,7 @@ public:
     int32_t ResumeDistributedHardware(const std::string &networkId) override;
     int32_t StopDistributedHardware(const std::string &networkId) override;
     void SetTokenId(uint64_t token) override;
+    int32_t RequestKeyFrame() override;
 
     void OnSessionState(int32_t state, std::string networkId);
     void OnSessionError(int32_t eventType, int32_t eventReason, std::string detail);
@@ -59,6 +62,10 @@ public:
 
 private:
     void HandleMetaDataResult(std::string& jsonStr);
+    void HandleMetaDataResult(const cJSON *rootValue);
+    void ReportMetaDataResult(DCameraMetadataSettingCmd& cmd);
+    void ReportMetaDataResults(const DHBase& dhBase, DCameraMetadataSettingCmd& cmd);
+    int32_t MarshalSettings(DCameraMetadataSettingCmd& cmd, std::shared_ptr<DataBuffer>& buffer);
     void PostChannelDisconnectedEvent();
     int32_t PublishEnableLatencyMsg(const std::string& devId);
     void HandleReceivedData(std::shared_ptr<DataBuffer> &dataBuffer);
@@ -93,6 +100,10 @@ private:
     std::weak_ptr<DCameraSourceDev> camDev_;
     int32_t channelState_;
     sptr<IDCameraProvider> camHdiProvider_;
+    // Null when the driver predates v1_2, events are then notified synchronously and every metadata result
+    // takes a call of its own.
+    sptr<OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider> camHdiProviderV1_2_;
+    uint32_t resultSequence_ = 0;
     sptr<IRemoteObject> remote_;
     sptr<CameraStandard::ICameraService> cameraServiceProxy_;
     std::shared_ptr<DCameraSourceController> controller_;
@@ -101,6 +112,7 @@ private:
     const std::string SESSION_FLAG = "control";
 
     static constexpr uint8_t CHANNEL_REL_SECONDS = 5;
+    static constexpr size_t SETTINGS_RESULTS_BATCH_SIZE = 64;
     const size_t DATABUFF_MAX_SIZE = 100 * 1024 * 1024;
     std::atomic<bool> isChannelConnected_ = false;
     std::mutex channelMtx_;
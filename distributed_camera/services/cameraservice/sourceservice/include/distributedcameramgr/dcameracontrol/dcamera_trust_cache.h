@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_TRUST_CACHE_H
+#define OHOS_DCAMERA_TRUST_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Warm open mode. Keeps the outcome of the trust checks a channel open runs against a sink device, so opening
+ * a recently used remote camera again skips the device manager round trips. Only granted ACL checks and found
+ * devices are kept, each for a bounded time and for a bounded number of sinks, and a device is dropped as soon
+ * as it is unregistered. Off unless sys.dcamera.source.warm.open is 1.
+ */
+class DCameraTrustCache {
+public:
+    static DCameraTrustCache &GetInstance();
+
+    bool IsEnabled();
+    bool GetAclGranted(const std::string &networkId, const std::string &aclKey);
+    void PutAclGranted(const std::string &networkId, const std::string &aclKey);
+    bool GetOsType(const std::string &networkId, bool &isInvalid);
+    void PutOsType(const std::string &networkId, bool isInvalid);
+    void Remove(const std::string &networkId);
+    void Clear();
+
+private:
+    DCameraTrustCache() = default;
+    ~DCameraTrustCache() = default;
+    DCameraTrustCache(const DCameraTrustCache &) = delete;
+    DCameraTrustCache &operator=(const DCameraTrustCache &) = delete;
+
+    struct TrustEntry {
+        std::string networkId;
+        std::string aclKey;
+        bool hasOsType = false;
+        bool isOsInvalid = false;
+        int64_t aclExpireMs = 0;
+        int64_t osTypeExpireMs = 0;
+    };
+
+    TrustEntry &GetOrAddEntry(const std::string &networkId);
+
+    constexpr static const char *WARM_OPEN_PARA = "sys.dcamera.source.warm.open";
+    constexpr static int64_t TRUST_TTL_MS = 30000;
+    constexpr static size_t MAX_TRUST_ENTRIES = 8;
+
+    std::mutex cacheMutex_;
+    // Most recently used sink first.
+    std::list<TrustEntry> entries_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_TRUST_CACHE_H
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_BUFFER_RING_H
+#define OHOS_DCAMERA_BUFFER_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+
+#include "v1_1/dcamera_types.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+using namespace OHOS::HDI::DistributedCamera::V1_1;
+
+/*
+ * Shared memory layout of the HDF buffer ring, it has to match DBufferRingLayout of the distributed camera
+ * driver, Init refuses a block whose magic, version or size differ.
+ */
+constexpr uint32_t DCAMERA_RING_MAGIC = 0x44435242;
+constexpr uint32_t DCAMERA_RING_VERSION = 2;
+constexpr uint32_t DCAMERA_RING_CAPACITY = 16;
+constexpr uint32_t DCAMERA_RING_CACHE_LINE = 64;
+
+struct DCameraRingEntry {
+    int32_t index;
+    int32_t size;
+    uint32_t seqNum;
+    uint32_t reserved;
+    int64_t captureTimeUs;
+};
+
+struct DCameraRingQueue {
+    alignas(DCAMERA_RING_CACHE_LINE) std::atomic<uint32_t> head;
+    alignas(DCAMERA_RING_CACHE_LINE) std::atomic<uint32_t> tail;
+    DCameraRingEntry entries[DCAMERA_RING_CAPACITY];
+};
+
+struct DCameraRingLayout {
+    uint32_t magic;
+    uint32_t version;
+    DCameraRingQueue freeQueue;
+    DCameraRingQueue filledQueue;
+};
+
+/*
+ * Source end of the buffer ring of one stream. Buffers come out of the free queue already acquired by the
+ * driver, a buffer is mapped the first time its sequence number shows up and the mapping is reused after that.
+ * Filled buffers go back through the filled queue and a write to the event fd, or through the provider when
+ * the filled queue is full. A mapping is only dropped while none of its buffers is out.
+ */
+class DCameraBufferRing {
+public:
+    using GetBufferFunc = std::function<int32_t(int32_t index, DCameraBuffer& buffer)>;
+    using ShutterBufferFunc = std::function<int32_t(const DCameraBuffer& buffer)>;
+
+    DCameraBufferRing(int32_t streamId, const GetBufferFunc& getBufferFunc,
+        const ShutterBufferFunc& shutterBufferFunc = nullptr);
+    ~DCameraBufferRing();
+
+    int32_t Init(int32_t ringFd, int32_t eventFd);
+    void Release();
+    uint8_t *AcquireBuffer(size_t capacity, DCameraBuffer& buffer);
+    int32_t ShutterBuffer(const DCameraBuffer& buffer, int64_t captureTimeUs = 0);
+
+private:
+    struct MappedBuffer {
+        void *virAddr;
+        size_t size;
+        // buffers of this mapping handed out and not shuttered yet
+        uint32_t refCount;
+    };
+
+    bool PopFree(DCameraRingEntry& entry);
+    bool PushFilled(const DCameraBuffer& buffer, int64_t captureTimeUs);
+    uint8_t *MapBuffer(const DCameraRingEntry& entry);
+    void UnrefMapping(int32_t index);
+    void EvictIdleLocked();
+    void UnmapAll();
+
+    constexpr static size_t MAX_MAPPED_BUFFERS = 32;
+
+    int32_t streamId_;
+    GetBufferFunc getBufferFunc_;
+    ShutterBufferFunc shutterBufferFunc_;
+    int32_t ringFd_ = -1;
+    int32_t eventFd_ = -1;
+    DCameraRingLayout *layout_ = nullptr;
+    // Serializes the filled queue, several threads hand buffers back.
+    std::mutex filledMutex_;
+    std::mutex mappedMutex_;
+    std::map<uint32_t, MappedBuffer> mappedBuffers_;
+    // sequence number of the mapping of each buffer out, <index, seqNum>
+    std::map<int32_t, uint32_t> outBufferSeqNums_;
+
+    DCameraBufferRing(const DCameraBufferRing &) = delete;
+    DCameraBufferRing &operator = (const DCameraBufferRing &) = delete;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_BUFFER_RING_H
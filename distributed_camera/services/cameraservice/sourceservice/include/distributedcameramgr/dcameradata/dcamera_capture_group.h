@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_CAPTURE_GROUP_H
+#define OHOS_DCAMERA_CAPTURE_GROUP_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+struct DCameraCaptureGroupStats {
+    // Frames released once every live member had a frame within the tolerance.
+    uint64_t aligned = 0;
+    // Frames released because a slower member did not catch up within the latency budget.
+    uint64_t expired = 0;
+};
+
+/*
+ * Continuous streams of cameras on several sinks that capture one scene. Capture times are on the source clock,
+ * each member offers its oldest frame and holds it until no live member lags behind it, so the frames of one
+ * instant reach the driver together. A member that stops delivering no longer holds the others back.
+ */
+class DCameraCaptureGroup {
+public:
+    explicit DCameraCaptureGroup(const std::string& groupId) : groupId_(groupId) {}
+    ~DCameraCaptureGroup() = default;
+
+    // A new member holds the others back until its first frame or the budget, so captures start in lockstep.
+    void Join(const std::string& memberKey, int64_t nowUs);
+    void Leave(const std::string& memberKey);
+    size_t GetMemberCount();
+    // Returns how long to hold the frame for the slower members, 0 releases it now.
+    int64_t Align(const std::string& memberKey, int64_t captureTimeUs, int64_t nowUs);
+    DCameraCaptureGroupStats GetStats();
+    void Dump(std::string& result);
+
+    constexpr static int64_t ALIGN_TOLERANCE_US = 8000;
+    constexpr static int64_t LATENCY_BUDGET_US = 100000;
+    constexpr static int64_t POLL_INTERVAL_US = 2000;
+
+private:
+    struct Member {
+        int64_t captureTimeUs = 0;
+        // When the frame at captureTimeUs was first offered.
+        int64_t offerUs = 0;
+    };
+
+    std::string groupId_;
+    std::mutex memberMutex_;
+    std::map<std::string, Member> members_;
+    DCameraCaptureGroupStats stats_;
+};
+
+class DCameraCaptureGroupManager {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraCaptureGroupManager);
+
+public:
+    void Bind(const std::string& groupId, const std::string& devId, const std::string& dhId);
+    void Unbind(const std::string& devId, const std::string& dhId);
+    // The group of the camera, nullptr when it captures on its own.
+    std::shared_ptr<DCameraCaptureGroup> Find(const std::string& devId, const std::string& dhId);
+    void Dump(std::string& result);
+
+private:
+    DCameraCaptureGroupManager() = default;
+    ~DCameraCaptureGroupManager() = default;
+    static std::string GetCameraKey(const std::string& devId, const std::string& dhId);
+
+    std::mutex groupMutex_;
+    std::map<std::string, std::shared_ptr<DCameraCaptureGroup>> groups_;
+    std::map<std::string, std::string> cameraGroups_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_CAPTURE_GROUP_H
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_FRAME_PACER_H
+#define OHOS_DCAMERA_FRAME_PACER_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedHardware {
+struct DCameraFramePacerStats {
+    uint64_t released = 0;
+    uint64_t early = 0;
+    uint64_t late = 0;
+    uint64_t dropped = 0;
+};
+
+/*
+ * Release schedule of one continuous stream while no audio clock leads it. Frames are due on a timeline anchored
+ * to the pts of the first one, so 24, 25, 50 or 60 fps and variable frame intervals all keep their own spacing.
+ * The interval learnt from the pts deltas, or the negotiated frame rate before there is one, only fills in where
+ * the pts jumps. Everything but SetFrameRate and GetStats belongs to the sync thread.
+ */
+class DCameraFramePacer {
+public:
+    void SetFrameRate(int32_t fps);
+    int64_t GetFrameIntervalUs() const;
+    // Returns how long to hold the frame before it is due, 0 releases it now.
+    int64_t Schedule(int64_t ptsUs, int64_t nowUs);
+    // Lets a later free run continue from a frame released on another clock.
+    void Rebase(int64_t ptsUs, int64_t nowUs);
+    void OnReleased(int64_t ptsUs);
+    void OnEarly(int64_t ptsUs);
+    void OnLate();
+    void OnDropped();
+    void Reset();
+    DCameraFramePacerStats GetStats() const;
+
+    constexpr static int64_t EARLY_TOLERANCE_US = 1000;
+    constexpr static int64_t MAX_HOLD_US = 100000;
+    // A pts step beyond this is a discontinuity rather than a slow frame.
+    constexpr static int64_t MAX_PTS_GAP_US = 500000;
+    constexpr static int64_t INTERVAL_SMOOTH_SHIFT = 3;
+
+private:
+    std::atomic<int64_t> nominalIntervalUs_ {0};
+    std::atomic<int64_t> measuredIntervalUs_ {0};
+    bool isAnchored_ = false;
+    // Wall time minus pts of the timeline, a frame is due at ptsUs + offsetUs_.
+    int64_t offsetUs_ = 0;
+    int64_t lastPtsUs_ = 0;
+    int64_t lastDueUs_ = 0;
+    int64_t earlyPtsUs_ = -1;
+    std::atomic<uint64_t> released_ {0};
+    std::atomic<uint64_t> early_ {0};
+    std::atomic<uint64_t> late_ {0};
+    std::atomic<uint64_t> dropped_ {0};
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_FRAME_PACER_H
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_LATENCY_STATISTICS_H
+#define OHOS_DCAMERA_LATENCY_STATISTICS_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "dcamera_frame_info.h"
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Log-linear latency histogram in microseconds. Values below 32 get a bucket each, above that every power of two
+ * is split into 16 buckets, which keeps percentiles within about 6% of the true value. Recording only touches
+ * atomics, so the frame path never waits for a dump.
+ */
+class DCameraLatencyHistogram {
+public:
+    void Record(int64_t valueUs);
+    void Reset();
+    uint64_t GetCount() const;
+    int64_t GetMax() const;
+    // Upper bound of the bucket holding the given percentile, 0 when nothing was recorded.
+    int64_t GetPercentile(uint32_t percentile) const;
+
+    static size_t BucketIndex(uint64_t valueUs);
+    static uint64_t BucketUpperBound(size_t index);
+
+    constexpr static uint32_t LINEAR_BITS = 5;
+    constexpr static uint32_t SUB_BUCKET_BITS = 4;
+    constexpr static uint64_t LINEAR_COUNT = 1ULL << LINEAR_BITS;
+    constexpr static uint64_t SUB_BUCKET_COUNT = 1ULL << SUB_BUCKET_BITS;
+    // Anything from about 71 minutes up shares the last bucket.
+    constexpr static uint32_t MAX_VALUE_BITS = 32;
+    constexpr static size_t BUCKET_COUNT =
+        LINEAR_COUNT + (MAX_VALUE_BITS - LINEAR_BITS) * SUB_BUCKET_COUNT;
+
+private:
+    std::array<std::atomic<uint32_t>, BUCKET_COUNT> buckets_ {};
+    std::atomic<uint64_t> count_ {0};
+    std::atomic<int64_t> max_ {0};
+};
+
+typedef enum {
+    DCAMERA_LATENCY_ENCODE = 0,
+    DCAMERA_LATENCY_TRANS,
+    DCAMERA_LATENCY_DECODE,
+    DCAMERA_LATENCY_DECODE_TO_SCALE,
+    DCAMERA_LATENCY_SCALE,
+    DCAMERA_LATENCY_RECV_TO_FEED,
+    DCAMERA_LATENCY_SMOOTH,
+    DCAMERA_LATENCY_GLASS_TO_GLASS,
+    DCAMERA_LATENCY_STAGE_COUNT,
+} DCameraLatencyStage;
+
+// Stage histograms of one source stream, fed with the time points of every frame the smoother releases.
+class DCameraStreamLatency {
+public:
+    void Record(const DCameraFrameInfo& frameInfo);
+    void Reset();
+    void Dump(std::string& result) const;
+
+private:
+    void RecordStage(DCameraLatencyStage stage, int64_t startUs, int64_t finishUs);
+
+    std::array<DCameraLatencyHistogram, DCAMERA_LATENCY_STAGE_COUNT> stages_;
+};
+
+class DCameraLatencyStatistics {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraLatencyStatistics);
+
+public:
+    // Streams reuse their histograms across captures until the next reset.
+    std::shared_ptr<DCameraStreamLatency> Acquire(const std::string& streamKey);
+    void Dump(std::string& result);
+    // Clears all counters and forgets the streams nobody records into any more.
+    void Reset();
+
+private:
+    DCameraLatencyStatistics() = default;
+    ~DCameraLatencyStatistics() = default;
+
+    std::mutex streamMutex_;
+    std::map<std::string, std::shared_ptr<DCameraStreamLatency>> streams_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_LATENCY_STATISTICS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -42,9 +42,12 @@ public:
     void GetAllStreamIds(std::vector<int32_t>& streamIds) override;
     int32_t UpdateProducerWorkMode(std::vector<int32_t>& streamIds, const WorkModeParam& param) override;
     int32_t UpdateSettings(const std::vector<std::shared_ptr<DCameraSettings>>& settings) override;
+    std::shared_ptr<DataBuffer> AcquireRecvBuffer(size_t capacity) override;
 
 private:
     void DestroyPipeline();
+    void UpdateDecodeSource();
+    static int32_t GetCaptureFrameRate(const std::shared_ptr<DCCaptureInfo>& captureInfo);
 
 private:
     std::mutex streamMutex_;
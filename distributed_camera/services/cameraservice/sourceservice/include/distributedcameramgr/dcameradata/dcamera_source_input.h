@@ -16,11 +16,14 @@
 #ifndef OHOS_DCAMERA_SOURCE_INPUT_H
 #define OHOS_DCAMERA_SOURCE_INPUT_H
 
+#include <future>
+
 #include "icamera_channel.h"
 #include "icamera_channel_listener.h"
 #include "icamera_input.h"
 #include "icamera_source_data_process.h"
 
+#include "dcamera_serial_queue.h"
 #include "dcamera_source_dev.h"
 #include "distributed_camera_errno.h"
 
@@ -48,13 +51,15 @@ public:
     void OnSessionState(DCStreamType streamType, int32_t state);
     void OnSessionError(DCStreamType streamType, int32_t eventType, int32_t eventReason, std::string detail);
     void OnDataReceived(DCStreamType streamType, std::vector<std::shared_ptr<DataBuffer>>& buffers);
+    std::shared_ptr<DataBuffer> AcquireRecvBuffer(DCStreamType streamType, size_t capacity);
 
 private:
     void FinshFrameAsyncTrace(DCStreamType streamType);
     void PostChannelDisconnectedEvent();
+    void CheckFrameLoss(const std::shared_ptr<DataBuffer>& buffer);
     int32_t EstablishContinuousFrameSession(std::vector<DCameraIndex>& indexs);
     int32_t EstablishSnapshotFrameSession(std::vector<DCameraIndex>& indexs);
-    int32_t WaitForOpenChannelCompletion(bool needWait);
+    int32_t WaitForOpenChannelCompletion(std::future<int32_t>& continuousResult, int32_t snapshotRet);
 
 private:
     std::map<DCStreamType, std::shared_ptr<ICameraChannel>> channels_;
@@ -68,18 +73,17 @@ private:
     bool isInit = false;
 
     static constexpr uint8_t CHANNEL_REL_SECONDS = 5;
+    // The sink needs a while to get the key frame out, a burst of loss asks for it once.
+    static constexpr int64_t KEY_FRAME_REQUEST_INTERVAL_US = 500000;
+    int32_t lastFrameIndex_ = -1;
+    int64_t lastKeyFrameRequestUs_ = 0;
     std::atomic<bool> isChannelConnected_ = false;
     std::mutex channelMtx_;
     std::condition_variable channelCond_;
 
     static constexpr std::chrono::seconds TIMEOUT_3_SEC = std::chrono::seconds(3);
-    std::atomic<bool> isOpenChannelFinished_ = false;
-    std::mutex isOpenChannelMtx_;
-    std::condition_variable isOpenChannelCond_;
-    std::atomic<int32_t> continuousFrameResult_ = DCAMERA_OK;
-    std::atomic<int32_t> snapshotFrameResult_ = DCAMERA_OK;
-    std::shared_ptr<AppExecFwk::EventRunner> runner_ = AppExecFwk::EventRunner::Create(true);
-    std::shared_ptr<AppExecFwk::EventHandler> handler_ = std::make_shared<AppExecFwk::EventHandler>(runner_);
+    std::shared_ptr<DCameraSerialQueue> channelQueue_ =
+        std::make_shared<DCameraSerialQueue>(SOURCE_INPUT_EVENT, DCAMERA_THREAD_CONTROL);
 };
 } // namespace DistributedHardware
 } // namespace OHOS
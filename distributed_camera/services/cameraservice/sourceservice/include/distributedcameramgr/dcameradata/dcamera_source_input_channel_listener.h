@@ -32,6 +32,7 @@ public:
     void OnSessionState(int32_t state, std::string networkId) override;
     void OnSessionError(int32_t eventType, int32_t eventReason, std::string detail) override;
     void OnDataReceived(std::vector<std::shared_ptr<DataBuffer>>& buffers) override;
+    std::shared_ptr<DataBuffer> AcquireRecvBuffer(size_t capacity) override;
 
 private:
     std::weak_ptr<DCameraSourceInput> input_;
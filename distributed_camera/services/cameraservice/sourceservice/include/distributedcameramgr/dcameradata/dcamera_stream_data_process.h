@@ -24,17 +24,22 @@
 #include "idata_process_pipeline.h"
 #include "image_common_type.h"
 #include "v1_1/dcamera_types.h"
+#include "v1_2/id_camera_provider.h"
 
 #include "dcamera_stream_data_process_producer.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 using namespace OHOS::HDI::DistributedCamera::V1_1;
+using OHOS::HDI::DistributedCamera::V1_2::DCameraStreamBuffer;
+class DCameraPipelineSource;
+
 class DCameraStreamDataProcess : public std::enable_shared_from_this<DCameraStreamDataProcess> {
 public:
     DCameraStreamDataProcess(std::string devId, std::string dhId, DCStreamType streamType);
     ~DCameraStreamDataProcess();
     void FeedStream(std::shared_ptr<DataBuffer>& buffer);
+    std::shared_ptr<DataBuffer> AcquireRecvBuffer(size_t capacity);
     void ConfigStreams(std::shared_ptr<DCameraStreamConfig>& dstConfig, std::set<int32_t>& streamIds);
     void ReleaseStreams(std::set<int32_t>& streamIds);
     void StartCapture(std::shared_ptr<DCameraStreamConfig>& srcConfig, std::set<int32_t>& streamIds);
@@ -43,18 +48,28 @@ public:
     int32_t GetProducerSize();
 
     void OnProcessedVideoBuffer(const std::shared_ptr<DataBuffer>& videoResult);
+    std::shared_ptr<DataBuffer> AcquireOutputBuffer(size_t capacity);
     void OnError(const DataProcessErrorType errorType);
+    void OnDecoderStepDown();
     void DestroyPipeline();
     int32_t UpdateProducerWorkMode(std::vector<int32_t>& streamIds, const WorkModeParam& param);
     int32_t UpdateSettings(const std::vector<std::shared_ptr<DCameraSettings>>& settings);
+    void SetDecodeSource(const std::shared_ptr<DCameraStreamDataProcess>& decodeSource);
+    std::shared_ptr<DCameraPipelineSource> GetDecodePipeline();
 
 private:
     void FeedStreamToSnapShot(const std::shared_ptr<DataBuffer>& buffer);
     void FeedStreamToContinue(const std::shared_ptr<DataBuffer>& buffer);
+    void FeedStreamToDriverBuffers(const std::shared_ptr<DataBuffer>& videoResult, std::set<int32_t>& fedStreamIds);
+    std::shared_ptr<DataBuffer> AcquireSnapshotBuffer(size_t capacity);
     void CreatePipeline();
+    int32_t UpdatePipeline(const VideoConfigParams& srcParams, const VideoConfigParams& dstParams);
+    void ReleasePipeline();
     VideoCodecType GetPipelineCodecType(DCEncodeType encodeType);
     Videoformat GetPipelineFormat(int32_t format);
 
+    const size_t DCAMERA_BATCH_MIN_STREAMS = 2;
+
 private:
     std::string devId_;
     std::string dhId_;
@@ -66,9 +81,19 @@ private:
     std::set<int32_t> streamIds_;
     std::shared_ptr<DCameraStreamConfig> srcConfig_;
     std::shared_ptr<DCameraStreamConfig> dstConfig_;
-    std::shared_ptr<IDataProcessPipeline> pipeline_;
+    std::shared_ptr<DCameraPipelineSource> pipeline_;
+    // What pipeline_ was last built or updated for, a capture with another size switches it over.
+    VideoConfigParams pipelineSrcParams_;
+    VideoConfigParams pipelineDstParams_;
+    // Another stream of the same bitstream that decodes for this one, the pipeline then only scales its frames.
+    std::weak_ptr<DCameraStreamDataProcess> decodeSource_;
+    std::shared_ptr<DCameraPipelineSource> branchOwner_;
     std::shared_ptr<DataProcessListener> listener_;
     std::map<uint32_t, std::shared_ptr<DCameraStreamDataProcessProducer>> producers_;
+    std::shared_ptr<DCameraStreamDropCounter> dropCounter_;
+    std::shared_ptr<DCameraMemoryAccount> memoryAccount_;
+    // Null when the driver predates v1_2, every producer then acquires its own buffer.
+    sptr<OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider> batchHdiProvider_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
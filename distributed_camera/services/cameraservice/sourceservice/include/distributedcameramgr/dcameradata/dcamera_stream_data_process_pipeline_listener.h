@@ -31,6 +31,8 @@ public:
 
     int32_t OnProcessedVideoBuffer(const std::shared_ptr<DataBuffer>& videoResult) override;
     void OnError(DataProcessErrorType errorType) override;
+    std::shared_ptr<DataBuffer> AcquireOutputBuffer(size_t capacity) override;
+    void OnDecoderStepDown() override;
 
 private:
     std::weak_ptr<DCameraStreamDataProcess> process_;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,18 +16,27 @@
 #ifndef OHOS_ICAMERA_SOURCE_DATA_PROCESS_PRODUCER_H
 #define OHOS_ICAMERA_SOURCE_DATA_PROCESS_PRODUCER_H
 
-#include <condition_variable>
 #include <mutex>
 #include <queue>
 #include <deque>
+#include <map>
 #include <thread>
 #include <atomic>
 #include <chrono>
 #include <ashmem.h>
 
 #include "data_buffer.h"
-#include "event_handler.h"
+#include "dcamera_buffer_handle.h"
+#include "dcamera_buffer_ring.h"
+#include "dcamera_capture_group.h"
+#include "dcamera_frame_drop_statistics.h"
+#include "dcamera_frame_pacer.h"
+#include "dcamera_latency_statistics.h"
+#include "dcamera_memory_account.h"
+#include "dcamera_spsc_queue.h"
+#include "dcamera_serial_queue.h"
 #include "v1_1/id_camera_provider.h"
+#include "v1_2/id_camera_provider.h"
 #include "dcamera_feeding_smoother.h"
 #include "idistributed_camera_source.h"
 
@@ -59,59 +68,111 @@ public:
     void Start();
     void Stop();
     void FeedStream(const std::shared_ptr<DataBuffer>& buffer);
+    std::shared_ptr<DataBuffer> AcquireDriverBuffer(size_t capacity);
+    bool IsDriverBufferEnabled();
+    bool HasBufferRing();
+    std::shared_ptr<DataBuffer> AttachDriverBuffer(const DCameraBuffer& sharedMemory, size_t capacity);
     virtual void OnSmoothFinished(const std::shared_ptr<IFeedableData>& data) override;
     void UpdateProducerWorkMode(const WorkModeParam& param);
+    // Called before Start, the producer reports the frames it drops to the counter of its stream.
+    void SetDropCounter(const std::shared_ptr<DCameraStreamDropCounter>& dropCounter);
+    // Called before Start, continuous frames are dropped on arrival while the session is over its memory budget.
+    void SetMemoryAccount(const std::shared_ptr<DCameraMemoryAccount>& memoryAccount);
+    // The negotiated frame rate, only used for pacing until the stream's own pts spacing is known.
+    void SetFrameRate(int32_t fps);
 
 private:
-    void StartEvent();
     void LooperSnapShot();
     int32_t FeedStreamToDriver(const DHBase& dhBase, const std::shared_ptr<DataBuffer>& buffer);
     int32_t CheckSharedMemory(const DCameraBuffer& sharedMemory, const std::shared_ptr<DataBuffer>& buffer);
+    bool TakeDriverBuffer(const DataBuffer *buffer, DCameraBuffer& sharedMemory);
+    void ReturnDriverBuffer(const DataBuffer *buffer);
+    void ReturnAllDriverBuffers();
+    std::shared_ptr<DataBuffer> AttachBuffer(uint8_t *virAddr, size_t capacity, const DCameraBuffer& sharedMemory,
+        const std::shared_ptr<DCameraBufferRing>& ring);
+    void OpenBufferRing();
+    std::shared_ptr<DCameraBufferRing> GetBufferRing();
+    int32_t FeedStreamToRing(const std::shared_ptr<DataBuffer>& buffer);
+    int32_t ReturnToDriver(const DHBase& dhBase, const DCameraBuffer& sharedMemory, int64_t captureTimeUs = 0);
+    int32_t ShutterToDriver(const DHBase& dhBase, const DCameraBuffer& sharedMemory, int64_t captureTimeUs);
+    static int64_t GetCaptureTimeUs(const DCameraFrameInfo& frameInfo);
     void WritePtsAndAddBuffer(const std::shared_ptr<DataBuffer>& buffer);
+    void PushSyncBuffer(const std::shared_ptr<DataBuffer>& buffer);
     void SyncVideoThread();
     bool WaitForVideoFrame(std::shared_ptr<DataBuffer>& buffer);
-    int32_t SyncVideoFrame(uint64_t videoPtsUs);
+    int32_t ScheduleVideoFrame(const std::shared_ptr<DataBuffer>& buffer, int64_t& waitUs);
+    int32_t SyncVideoFrame(uint64_t videoPts, int64_t& waitUs);
+    int32_t ReadAudioClock(int64_t& audioPtsUs, int64_t& audioUpdateUs, float& audioSpeed);
+    SyncSharedData *LockSyncSharedData();
+    void UnlockSyncSharedData(SyncSharedData *sharedData);
+    void WriteVideoClock(uint64_t videoPts);
+    void WaitSyncSchedule(int64_t waitUs);
     void UpdateVideoClock(uint64_t videoPtsUs);
+    void CountDroppedFrames(DCameraDropReason reason, uint64_t count);
+    void UpdateSinkEncoderPreset(uint8_t encoderPreset);
 
     const uint32_t DCAMERA_PRODUCER_MAX_BUFFER_SIZE = 30;
-    const uint32_t DCAMERA_PRODUCER_RETRY_SLEEP_MS = 500;
+    const int32_t DCAMERA_PRODUCER_RETRY_MIN_MS = 10;
+    const int32_t DCAMERA_PRODUCER_RETRY_MAX_MS = 500;
+    const int32_t DCAMERA_PRODUCER_RETRY_FACTOR = 2;
+    const int32_t DCAMERA_PRODUCER_WAIT_MS = 100;
     const uint32_t DCAMERA_MAX_SYNC_BUFFER_SIZE = 10;
-    const uint32_t DCAMERA_SYNC_WATERMARK = 1;
-    const uint32_t DCAMERA_SYNC_TIME_INTERVAL = 33;
-    const uint32_t DCAMERA_NS_TO_MS = 1000000;
+    const int32_t DCAMERA_SYNC_DROP = -1;
+    const int32_t DCAMERA_SYNC_HOLD = 0;
+    const int32_t DCAMERA_SYNC_RELEASE = 1;
+    const int64_t DCAMERA_SYNC_LATE_US = 5000;
+    const int64_t DCAMERA_SYNC_EARLY_US = 1000;
+    const int64_t DCAMERA_SYNC_MAX_HOLD_US = 100000;
+    const int64_t DCAMERA_SYNC_STALE_CLOCK_US = 1000000;
+    // The sync lock word holds 1 while free, the layout and values are shared with the audio side.
+    const int DCAMERA_SYNC_UNLOCKED = 1;
+    const int DCAMERA_SYNC_LOCKED = 0;
+    const int32_t DCAMERA_SYNC_LOCK_SPINS = 64;
+    const int64_t DCAMERA_SYNC_LOCK_SLEEP_US = 100;
+    const int64_t DCAMERA_SYNC_LOCK_TIMEOUT_US = 5000;
+    const uint32_t DCAMERA_NS_TO_US = 1000;
     const uint32_t DCAMERA_US_TO_MS = 1000;
-    const uint32_t DCAMERA_TIME_DIFF_MAX = 5;
-    const int32_t DCAMERA_TIME_DIFF_MIN = -100;
 
 private:
     std::string devId_;
     std::string dhId_;
 
-    std::thread eventThread_;
     std::thread producerThread_;
-    std::condition_variable eventCon_;
-    std::condition_variable producerCon_;
-    std::mutex bufferMutex_;
     std::mutex eventMutex_;
-    std::deque<std::shared_ptr<DataBuffer>> buffers_;
-    DCameraProducerState state_;
+    // Fed by the pipeline callback thread and drained by the snapshot looper only.
+    DCameraSpscQueue<std::shared_ptr<DataBuffer>> buffers_ { DCAMERA_PRODUCER_MAX_BUFFER_SIZE };
+    std::atomic<DCameraProducerState> state_;
     uint32_t interval_;
     uint32_t photoCount_;
     int32_t streamId_;
     DCStreamType streamType_;
-    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
+    std::shared_ptr<DCameraSerialQueue> eventQueue_;
 
     sptr<IDCameraProvider> camHdiProvider_;
+    // Set when the driver takes capture times, which only ShutterBuffers carries.
+    sptr<OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider> camHdiProviderV1_2_;
+    DCameraBufferMapCache bufferMapCache_;
+    std::mutex driverBufferMutex_;
+    std::map<const DataBuffer *, DCameraBuffer> driverBuffers_;
+    std::shared_ptr<DCameraBufferRing> bufferRing_ = nullptr;
     std::unique_ptr<IFeedingSmoother> smoother_ = nullptr;
     std::shared_ptr<FeedingSmootherListener> smootherListener_ = nullptr;
+    std::shared_ptr<DCameraStreamLatency> latency_ = nullptr;
+    std::shared_ptr<DCameraStreamDropCounter> dropCounter_ = nullptr;
+    std::shared_ptr<DCameraMemoryAccount> memoryAccount_ = nullptr;
+    // Last encoder preset the sink reported in the frame info, only touched by the pipeline callback thread.
+    uint8_t sinkEncoderPreset_ = 0;
 
     std::thread syncThread_;
     std::atomic<bool> syncRunning_;
-    std::deque<std::shared_ptr<DataBuffer>> syncBufferQueue_;
-    std::mutex syncBufferMutex_;
-    std::condition_variable syncBufferCond_;
-    std::atomic<bool> isFirstFrame_;
-    std::chrono::steady_clock::time_point startTime_;
+    // Fed by the smoother thread and drained by the sync thread only.
+    DCameraSpscQueue<std::shared_ptr<DataBuffer>> syncBufferQueue_ { DCAMERA_MAX_SYNC_BUFFER_SIZE };
+    // An early frame the sync thread holds back for the next schedule, only touched by the sync thread.
+    std::shared_ptr<DataBuffer> pendingSyncBuffer_ = nullptr;
+    DCameraFramePacer framePacer_;
+    // Set from Start to Stop while the camera captures in a group, its frames then go through the sync thread.
+    std::shared_ptr<DCameraCaptureGroup> captureGroup_ = nullptr;
+    std::string groupMemberKey_;
     WorkModeParam workModeParam_; // Audio-video synchronization fwk transfer structure
     std::mutex workModeParamMtx_;
     sptr<Ashmem> syncMem_ = nullptr; // Shared memory
@@ -36,6 +36,7 @@ public:
     virtual void InitTimeStatistician();
     virtual int32_t NotifySmoothFinished(const std::shared_ptr<IFeedableData>& data);
     virtual void SetClockTime(const int64_t clockTime);
+    virtual void UpdateTargetBufferTime();
 
 public:
     void PushData(const std::shared_ptr<IFeedableData>& data);
@@ -44,6 +45,8 @@ public:
     void RegisterListener(const std::shared_ptr<FeedingSmootherListener>& listener);
     void UnregisterListener();
     void SetBufferTime(const int32_t time);
+    void SetTargetBufferTime(const int64_t time);
+    void SetSmoothBypassState(const bool state);
     void SetAverIntervalDiffThre(const uint32_t thre);
     void SetDynamicBalanceThre(const uint8_t thre);
     void SetFeedOnceDiffThre(const uint32_t thre);
@@ -56,19 +59,34 @@ public:
     void SetWaitClockFactor(const float factor);
     void SetTrackClockFactor(const float factor);
     int64_t GetBufferTime();
+    int64_t GetTargetBufferTime();
+    bool GetSmoothBypassState();
     int64_t GetClockTime();
+    // Frames the smoother still held when it was stopped, summed over all stops.
+    uint64_t GetDiscardedCount();
 
 private:
     void AdjustSleepTime(const int64_t interval);
+    void AdjustBufferTime(const int64_t interval);
     bool CheckIsBaselineInit();
     bool CheckIsTimeInit();
     bool CheckIsProcessInDynamicBalance();
     bool CheckIsProcessInDynamicBalanceOnce();
     void LooperSmooth();
+    void InitSmoothTimer();
+    void ReleaseSmoothTimer();
+    void SetSmoothThreadPriority();
+    bool WaitUntil(const int64_t deadlineNs);
+    int64_t GetMonotonicTimeNs();
     void RecordTime(const int64_t enterTime, const int64_t timeStamp);
     void SmoothFeeding(const std::shared_ptr<IFeedableData>& data);
     void SyncClock(const int64_t timeStamp, const int64_t timeStampInterval, const int64_t clock);
 
+    constexpr static int64_t NS_PER_SECOND = 1000000000;
+    constexpr static int64_t NS_PER_US = 1000;
+    constexpr static const char *RT_POLICY_PARA = "sys.dcamera.smoother.rt.policy";
+    constexpr static const char *RT_PRIORITY_PARA = "sys.dcamera.smoother.rt.priority";
+
 protected:
     std::queue<std::shared_ptr<IFeedableData>> dataQueue_;
     std::shared_ptr<TimeStatistician> statistician_ = nullptr;
@@ -85,6 +103,8 @@ private:
     std::atomic<bool> isInDynamicBalance_ = true;
     std::atomic<bool> isBaselineInit_ = false;
     std::atomic<bool> isTimeInit_ = false;
+    std::atomic<bool> isSmoothBypass_ = false;
+    std::atomic<uint64_t> discardedCount_ = 0;
 
     float adjustSleepFactor_ = 0.1;
     float waitClockFactor_ = 0.1;
@@ -94,6 +114,7 @@ private:
     uint32_t averIntervalDiffThre_ = 0;
     uint32_t feedOnceDiffThre_ = 0;
     int64_t bufferTime_ = 0;
+    int64_t targetBufferTime_ = 0;
     int64_t lastEnterTime_ = 0;
     int64_t lastTimeStamp_ = 0;
     int64_t leaveTime_ = 0;
@@ -102,6 +123,8 @@ private:
     int64_t clockBaseline_ = 0;
     int64_t delta_ = 0;
     int64_t sleep_ = 0;
+    int32_t timerFd_ = -1;
+    int32_t wakeupFd_ = -1;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -27,12 +27,27 @@ public:
     virtual void InitBaseline(const int64_t timeStampBaseline, const int64_t clockBaseline) override;
     virtual void InitTimeStatistician() override;
     virtual int32_t NotifySmoothFinished(const std::shared_ptr<IFeedableData>& data) override;
+    virtual void UpdateTargetBufferTime() override;
 
 private:
+    void InitJitterBufferPolicy();
+
     constexpr static uint8_t DYNAMIC_BALANCE_THRE = 3;
     constexpr static int32_t SMOOTH_BUFFER_TIME_US = 20000;
     constexpr static uint32_t AVER_INTERVAL_DIFF_THRE_US = 2000;
     constexpr static uint32_t FEED_ONCE_DIFF_THRE_US = 10000;
+    constexpr static int32_t DEFAULT_JITTER_PERCENTILE = 95;
+    constexpr static int32_t MAX_JITTER_PERCENTILE = 100;
+    constexpr static int64_t JITTER_MARGIN_US = 2000;
+    constexpr static int64_t MIN_BUFFER_TIME_US = 5000;
+    constexpr static int64_t MAX_BUFFER_TIME_US = 200000;
+    constexpr static int64_t LOW_LATENCY_ENTER_JITTER_US = 3000;
+    constexpr static int64_t LOW_LATENCY_EXIT_JITTER_US = 6000;
+    constexpr static const char *JITTER_PERCENTILE_PARA = "sys.dcamera.smoother.jitter.percentile";
+    constexpr static const char *LOW_LATENCY_PARA = "sys.dcamera.smoother.lowlatency.enable";
+    // Zero keeps the fixed SMOOTH_BUFFER_TIME_US.
+    uint32_t jitterPercentile_ = DEFAULT_JITTER_PERCENTILE;
+    bool isLowLatency_ = false;
     std::shared_ptr<DCameraTimeStatistician> dCameraStatistician_ = nullptr;
 };
 } // namespace DistributedHardware
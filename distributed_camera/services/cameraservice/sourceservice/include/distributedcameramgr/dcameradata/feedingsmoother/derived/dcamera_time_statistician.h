@@ -16,6 +16,9 @@
 #ifndef OHOS_DCAMERA_TIME_STATISTICIAN_H
 #define OHOS_DCAMERA_TIME_STATISTICIAN_H
 
+#include <array>
+#include <mutex>
+
 #include "ifeedable_data.h"
 #include "time_statistician.h"
 #include "data_buffer.h"
@@ -44,8 +47,14 @@ public:
     void SetRecvTime(const int64_t recvTime);
     void SetFrameIndex(const int32_t index);
     int64_t CalAverValue(int64_t& value, int64_t& valueSum);
+    void CalJitter(const int64_t arriveTime, const int64_t timeStamp);
+    int64_t GetJitterDelay(const uint32_t percentile);
 
 private:
+    constexpr static size_t JITTER_WINDOW_SIZE = 128;
+    constexpr static size_t JITTER_MIN_SAMPLES = 16;
+    constexpr static uint32_t PERCENT = 100;
+
     int32_t frameIndex_ = -1;
     int64_t averEncodeTime_ = 0;
     int64_t encodeTimeSum_ = 0;
@@ -66,6 +75,13 @@ private:
     int64_t averWholeTime_ = 0;
     int64_t wholeTimeSum_ = 0;
     int64_t recvTime_ = 0;
+
+    // Arrival minus capture time of the latest frames, the spread above the minimum is the jitter to absorb.
+    std::mutex jitterMutex_;
+    std::array<int64_t, JITTER_WINDOW_SIZE> transitTimes_ {};
+    size_t transitIndex_ = 0;
+    size_t transitCount_ = 0;
+    int64_t lastJitterTimeStamp_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
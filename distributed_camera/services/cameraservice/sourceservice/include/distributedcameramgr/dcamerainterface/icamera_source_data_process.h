@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -39,6 +39,8 @@ public:
     int32_t dataspace_;
     DCEncodeType encodeType_;
     DCStreamType type_;
+    // Upper bound of the requested fps range, 0 when the capture settings carry none.
+    int32_t frameRate_ = 0;
 
     bool operator == (const DCameraStreamConfig& others) const
     {
@@ -66,6 +68,10 @@ public:
     virtual void GetAllStreamIds(std::vector<int32_t>& streamIds) = 0;
     virtual int32_t UpdateProducerWorkMode(std::vector<int32_t>& streamIds, const WorkModeParam& param) = 0;
     virtual int32_t UpdateSettings(const std::vector<std::shared_ptr<DCameraSettings>>& settings) = 0;
+    virtual std::shared_ptr<DataBuffer> AcquireRecvBuffer(size_t capacity)
+    {
+        return DataBuffer::Acquire(capacity);
+    }
 };
 } // namespace DistributedHardware
 } // namespace OHOS
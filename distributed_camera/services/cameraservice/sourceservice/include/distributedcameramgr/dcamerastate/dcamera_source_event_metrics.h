@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_SOURCE_EVENT_METRICS_H
+#define OHOS_DCAMERA_SOURCE_EVENT_METRICS_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "dcamera_source_event.h"
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+struct DCameraSourceEventStats {
+    uint64_t count = 0;
+    // Events that waited in the queue longer than the deadline of their type.
+    uint64_t overDeadline = 0;
+    // Events dropped unstarted because a close posted after them made them pointless.
+    uint64_t superseded = 0;
+    int64_t totalWaitUs = 0;
+    int64_t maxWaitUs = 0;
+    int64_t maxRunUs = 0;
+};
+
+/*
+ * Queue wait and run time of the events of all source devices, per event type. The deadlines bound the wait from
+ * post to start and follow how visible the operation is to the app: close and stop capture are the tightest,
+ * notifications and registration the loosest.
+ */
+class DCameraSourceEventMetrics {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraSourceEventMetrics);
+
+public:
+    // Returns false when the event started after the deadline of its type.
+    bool OnEventStarted(DCAMERA_EVENT eventType, int64_t waitUs);
+    void OnEventFinished(DCAMERA_EVENT eventType, int64_t runUs);
+    void OnEventSuperseded(DCAMERA_EVENT eventType);
+    DCameraSourceEventStats GetStats(DCAMERA_EVENT eventType);
+    void Reset();
+    void Dump(std::string& result);
+    static int64_t GetDeadlineUs(DCAMERA_EVENT eventType);
+
+    constexpr static int64_t STOP_DEADLINE_US = 50000;
+    constexpr static int64_t SETTINGS_DEADLINE_US = 100000;
+    constexpr static int64_t START_DEADLINE_US = 200000;
+    constexpr static int64_t NOTIFY_DEADLINE_US = 500000;
+    constexpr static int64_t REGIST_DEADLINE_US = 1000000;
+
+private:
+    DCameraSourceEventMetrics() = default;
+    ~DCameraSourceEventMetrics() = default;
+
+    std::mutex statsMutex_;
+    std::map<DCAMERA_EVENT, DCameraSourceEventStats> stats_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_SOURCE_EVENT_METRICS_H
@@ -15,6 +15,9 @@
 
 #ifndef OHOS_DCAMERA_SOURCE_STATE_MACHINE_H
 #define OHOS_DCAMERA_SOURCE_STATE_MACHINE_H
+#include <condition_variable>
+#include <mutex>
+
 #include "dcamera_source_event.h"
 #include "dcamera_source_state.h"
 
@@ -29,9 +32,27 @@ public:
     void UpdateState(DCameraStateType stateType);
     int32_t GetCameraState();
 
+    /*
+     * Events run on two lanes. Control events never change the state and may run beside the lifecycle event in
+     * progress, but they must not overtake a lifecycle event posted before them. Every lifecycle event takes a
+     * sequence number when it is posted, a control event carries the last one and waits until it has started.
+     */
+    static bool IsControlEvent(DCAMERA_EVENT eventType);
+    int64_t OnLifecycleEventPosted();
+    int64_t GetLastLifecycleEvent();
+    void OnLifecycleEventStarted(int64_t seq);
+    bool WaitLifecycleEventStarted(int64_t seq);
+
 private:
+    constexpr static int32_t LIFECYCLE_WAIT_TIMEOUT_MS = 3000;
+
+    std::mutex stateMutex_;
     std::shared_ptr<DCameraSourceState> currentState_;
     std::weak_ptr<DCameraSourceDev> camDev_;
+    std::mutex laneMutex_;
+    std::condition_variable laneCond_;
+    int64_t postedSeq_ = 0;
+    int64_t startedSeq_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
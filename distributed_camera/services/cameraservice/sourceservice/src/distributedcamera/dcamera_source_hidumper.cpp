@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,7 +15,14 @@
 
 #include "dcamera_source_hidumper.h"
 
+#include "dcamera_capture_group.h"
+#include "dcamera_frame_drop_statistics.h"
 #include "dcamera_hidumper.h"
+#include "dcamera_memory_account.h"
+#include "dcamera_source_event_metrics.h"
+#include "dcamera_latency_statistics.h"
+#include "dcamera_node_stats.h"
+#include "dcamera_startup_profiler.h"
 #include "distributed_camera_errno.h"
 #include "distributed_camera_source_service.h"
 #include "distributed_hardware_log.h"
@@ -31,6 +38,14 @@ const std::string ARGS_REGISTERED_INFO = "--registered";
 const std::string ARGS_CURRENTSTATE_INFO = "--curState";
 const std::string ARGS_START_DUMP = "--startdump";
 const std::string ARGS_STOP_DUMP = "--stopdump";
+const std::string ARGS_LATENCY_INFO = "--latency";
+const std::string ARGS_RESET_LATENCY = "--resetLatency";
+const std::string ARGS_PIPELINE_STATS = "--pipelineStats";
+const std::string ARGS_FRAME_DROP_INFO = "--frameDrop";
+const std::string ARGS_MEMORY_INFO = "--memory";
+const std::string ARGS_STARTUP_INFO = "--startup";
+const std::string ARGS_CAPTURE_GROUP_INFO = "--captureGroup";
+const std::string ARGS_EVENT_STATS = "--eventStats";
 const std::string STATE_INT = "Init";
 const std::string STATE_REGISTERED = "Registered";
 const std::string STATE_OPENED = "Opened";
@@ -44,6 +59,14 @@ const std::map<std::string, HidumpFlag> ARGS_MAP = {
     { ARGS_VERSION_INFO, HidumpFlag::GET_VERSION_INFO },
     { ARGS_START_DUMP, HidumpFlag::START_DUMP },
     { ARGS_STOP_DUMP, HidumpFlag::STOP_DUMP },
+    { ARGS_LATENCY_INFO, HidumpFlag::GET_LATENCY_INFO },
+    { ARGS_RESET_LATENCY, HidumpFlag::RESET_LATENCY_INFO },
+    { ARGS_PIPELINE_STATS, HidumpFlag::GET_PIPELINE_STATS },
+    { ARGS_FRAME_DROP_INFO, HidumpFlag::GET_FRAME_DROP_INFO },
+    { ARGS_MEMORY_INFO, HidumpFlag::GET_MEMORY_INFO },
+    { ARGS_STARTUP_INFO, HidumpFlag::GET_STARTUP_INFO },
+    { ARGS_CAPTURE_GROUP_INFO, HidumpFlag::GET_CAPTURE_GROUP_INFO },
+    { ARGS_EVENT_STATS, HidumpFlag::GET_EVENT_STATS },
 };
 
 const std::map<int32_t, std::string> STATE_MAP = {
@@ -126,6 +149,40 @@ int32_t DcameraSourceHidumper::ProcessDump(const std::string& args, std::string&
             result.append("Send stop dump order ok\n");
             break;
         }
+        case HidumpFlag::GET_LATENCY_INFO: {
+            ret = GetLatencyInfo(result);
+            break;
+        }
+        case HidumpFlag::RESET_LATENCY_INFO: {
+            DCameraLatencyStatistics::GetInstance().Reset();
+            result.append("Reset latency statistics ok\n");
+            ret = DCAMERA_OK;
+            break;
+        }
+        case HidumpFlag::GET_PIPELINE_STATS: {
+            ret = GetPipelineStats(result);
+            break;
+        }
+        case HidumpFlag::GET_FRAME_DROP_INFO: {
+            ret = GetFrameDropInfo(result);
+            break;
+        }
+        case HidumpFlag::GET_MEMORY_INFO: {
+            ret = GetMemoryInfo(result);
+            break;
+        }
+        case HidumpFlag::GET_STARTUP_INFO: {
+            ret = GetStartupInfo(result);
+            break;
+        }
+        case HidumpFlag::GET_CAPTURE_GROUP_INFO: {
+            ret = GetCaptureGroupInfo(result);
+            break;
+        }
+        case HidumpFlag::GET_EVENT_STATS: {
+            ret = GetEventStats(result);
+            break;
+        }
         default: {
             ret = ShowIllegalInfomation(result);
             break;
@@ -175,6 +232,55 @@ int32_t DcameraSourceHidumper::GetVersionInfo(std::string& result)
     return DCAMERA_OK;
 }
 
+int32_t DcameraSourceHidumper::GetLatencyInfo(std::string& result)
+{
+    DHLOGI("GetLatencyInfo Dump.");
+    DCameraLatencyStatistics::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
+int32_t DcameraSourceHidumper::GetPipelineStats(std::string& result)
+{
+    DHLOGI("GetPipelineStats Dump.");
+    DCameraPipelineStatsRegistry::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
+int32_t DcameraSourceHidumper::GetFrameDropInfo(std::string& result)
+{
+    DHLOGI("GetFrameDropInfo Dump.");
+    DCameraFrameDropStatistics::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
+int32_t DcameraSourceHidumper::GetMemoryInfo(std::string& result)
+{
+    DHLOGI("GetMemoryInfo Dump.");
+    DCameraMemoryStatistics::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
+int32_t DcameraSourceHidumper::GetStartupInfo(std::string& result)
+{
+    DHLOGI("GetStartupInfo Dump.");
+    DCameraStartupProfiler::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
+int32_t DcameraSourceHidumper::GetCaptureGroupInfo(std::string& result)
+{
+    DHLOGI("GetCaptureGroupInfo Dump.");
+    DCameraCaptureGroupManager::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
+int32_t DcameraSourceHidumper::GetEventStats(std::string& result)
+{
+    DHLOGI("GetEventStats Dump.");
+    DCameraSourceEventMetrics::GetInstance().Dump(result);
+    return DCAMERA_OK;
+}
+
 void DcameraSourceHidumper::ShowHelp(std::string& result)
 {
     DHLOGI("ShowHelp Dump.");
@@ -191,7 +297,23 @@ void DcameraSourceHidumper::ShowHelp(std::string& result)
         .append("--startdump  ")
         .append(": dump camera data in /data/data/dcamera\n")
         .append("--stopdump   ")
-        .append(": stop dump camera data\n");
+        .append(": stop dump camera data\n")
+        .append("--latency    ")
+        .append(": dump per stream frame latency percentiles\n")
+        .append("--resetLatency ")
+        .append(": reset frame latency statistics\n")
+        .append("--pipelineStats ")
+        .append(": dump per node counters of the running pipelines\n")
+        .append("--frameDrop  ")
+        .append(": dump dropped frames by reason of the running streams\n")
+        .append("--memory     ")
+        .append(": dump live and peak buffer bytes of the running sessions\n")
+        .append("--startup    ")
+        .append(": dump how long the service start phases took\n")
+        .append("--captureGroup ")
+        .append(": dump members and aligned frames of the capture groups\n")
+        .append("--eventStats ")
+        .append(": dump queue wait and deadline misses per source event type\n");
 }
 
 int32_t DcameraSourceHidumper::ShowIllegalInfomation(std::string& result)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -31,8 +31,12 @@
 #include "dcamera_radar.h"
 #include "dcamera_service_state_listener.h"
 #include "dcamera_source_service_ipc.h"
+#include "dcamera_startup_profiler.h"
+#include "dcamera_thread_role.h"
+#include "dcamera_trust_cache.h"
 #include "dcamera_utils_tools.h"
 #include "distributed_camera_allconnect_manager.h"
+#include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 #include "dcamera_handler.h"
@@ -59,22 +63,13 @@ void DistributedCameraSourceService::OnStart()
         return;
     }
 
+    // The libyuv converter and the allconnect so are loaded on the first capture that needs them.
+    DCameraStartupPhase phase("SourceOnStart");
+    DCameraThreadRoleRegistry::ApplyIpcThreadNum(DCAMERA_SA_PROCESS_NAME);
     if (!Init()) {
         DHLOGE("DistributedCameraSourceService init failed");
         return;
     }
-#ifdef DCAMERA_MMAP_RESERVE
-    ConverterHandle::GetInstance().InitConverter();
-#endif
-    if (!DCameraAllConnectManager::IsInited()) {
-        DCameraAllConnectManager::GetInstance().InitDCameraAllConnectManager();
-        int32_t ret = DCameraAllConnectManager::GetInstance().RegisterLifecycleCallback();
-        if (ret != DCAMERA_OK) {
-            DHLOGE("DCamera allconnect source init and RegisterLifecycle failed");
-        } else {
-            DHLOGI("DCamera allconnect source init and RegisterLifecycle success");
-        }
-    }
 
     state_ = DCameraServiceState::DCAMERA_SRV_STATE_RUNNING;
     DHLOGI("start service success.");
@@ -87,6 +82,7 @@ bool DistributedCameraSourceService::Init()
     DHLOGI("DistributedCameraSourceService start init");
     DCameraSourceServiceIpc::GetInstance().Init();
     if (!registerToService_) {
+        DCameraStartupPhase phase("SourcePublish");
         bool ret = Publish(this);
         if (!ret) {
             DHLOGE("DistributedCameraSourceService Publish service failed");
@@ -142,7 +138,11 @@ int32_t DistributedCameraSourceService::InitSource(const std::string& params,
     const sptr<IDCameraSourceCallback>& callback)
 {
     DHLOGI("DistributedCameraSourceService InitSource param: %{public}s", params.c_str());
-    int32_t ret = LoadDCameraHDF();
+    int32_t ret = DCAMERA_OK;
+    {
+        DCameraStartupPhase phase("SourceLoadHDF");
+        ret = LoadDCameraHDF();
+    }
     DcameraRadar::GetInstance().ReportDcameraInit("LoadDCameraHDF", CameraInit::LOAD_HDF_DRIVER,
         BizState::BIZ_STATE_END, ret);
     if (ret != DCAMERA_OK) {
@@ -293,6 +293,7 @@ int32_t DistributedCameraSourceService::UnregisterDistributedHardware(const std:
 {
     DHLOGI("UnregisterDistributedHardware devId: %{public}s, dhId: %{public}s",
         GetAnonyString(devId).c_str(), GetAnonyString(dhId).c_str());
+    DCameraTrustCache::GetInstance().Remove(devId);
     DCameraIndex camIndex(devId, dhId);
     std::shared_ptr<DCameraSourceDev> camDev = GetCamDevByIndex(camIndex);
     if (camDev == nullptr) {
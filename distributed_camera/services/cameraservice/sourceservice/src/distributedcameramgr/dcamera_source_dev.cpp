@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,7 +15,11 @@
 
 #include "dcamera_source_dev.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 #include "anonymous_string.h"
+#include "dcamera_capture_group.h"
 #include "dcamera_hisysevent_adapter.h"
 #include "dcamera_hitrace_adapter.h"
 #include "dcamera_radar.h"
@@ -27,6 +31,7 @@
 #include "dcamera_info_cmd.h"
 #include "dcamera_provider_callback_impl.h"
 #include "dcamera_source_controller.h"
+#include "dcamera_source_event_metrics.h"
 #include "dcamera_source_imu_sensor.h"
 #include "dcamera_source_input.h"
 #include "dcamera_utils_tools.h"
@@ -62,7 +67,9 @@ DCameraSourceDev::~DCameraSourceDev()
 {
     DHLOGI("DCameraSourceDev Delete devId %{public}s dhId %{public}s", GetAnonyString(devId_).c_str(),
         GetAnonyString(dhId_).c_str());
+    hdiEventHandler_ = nullptr;
     srcDevEventHandler_ = nullptr;
+    srcDevCtrlEventHandler_ = nullptr;
     hdiCallback_ = nullptr;
     input_ = nullptr;
     controller_ = nullptr;
@@ -82,11 +89,19 @@ int32_t DCameraSourceDev::InitDCameraSourceDev()
     std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create(true);
     srcDevEventHandler_ = std::make_shared<DCameraSourceDev::DCameraSourceDevEventHandler>(
         runner, shared_from_this());
+    std::shared_ptr<AppExecFwk::EventRunner> ctrlRunner = AppExecFwk::EventRunner::Create(true);
+    srcDevCtrlEventHandler_ = std::make_shared<DCameraSourceDev::DCameraSourceDevEventHandler>(
+        ctrlRunner, shared_from_this());
+    hdiEventHandler_ = std::make_shared<AppExecFwk::EventHandler>(AppExecFwk::EventRunner::Create(true));
     auto cameraSourceDev = std::shared_ptr<DCameraSourceDev>(shared_from_this());
     stateMachine_ = std::make_shared<DCameraSourceStateMachine>(cameraSourceDev);
     stateMachine_->UpdateState(DCAMERA_STATE_INIT);
     controller_ = std::make_shared<DCameraSourceController>(devId_, dhId_, stateMachine_, cameraSourceDev);
     input_ = std::make_shared<DCameraSourceInput>(devId_, dhId_, cameraSourceDev);
+    int32_t windowMs = DEFAULT_SETTINGS_WINDOW_MS;
+    if (GetSysPara(SETTINGS_WINDOW_PARA, windowMs)) {
+        settingsWindowMs_ = std::min(std::max(windowMs, 0), MAX_SETTINGS_WINDOW_MS);
+    }
     hdiCallback_ = sptr<DCameraProviderCallbackImpl>(
         new (std::nothrow) DCameraProviderCallbackImpl(devId_, dhId_, cameraSourceDev));
     if (hdiCallback_ == nullptr) {
@@ -107,28 +122,26 @@ int32_t DCameraSourceDev::RegisterDistributedHardware(const std::string& devId,
     DCameraIndex index(devId, dhId);
     actualDevInfo_.insert(index);
 
-    cJSON* root = cJSON_Parse(param.sinkAttrs.c_str());
-    if (root == nullptr) {
+    std::shared_ptr<DCameraSinkAbility> sinkAbility = std::make_shared<DCameraSinkAbility>();
+    if (sinkAbility->Unmarshal(param.sinkAttrs) != DCAMERA_OK) {
         return DCAMERA_BAD_VALUE;
     }
-    if (cJSON_HasObjectItem(root, "EIS")) {
-        cJSON* item = cJSON_GetObjectItemCaseSensitive(root, "EIS");
-        if (cJSON_IsTrue(item)) {
-            eis_ = true;
-            DCameraSrcImuSensor::GetInstance().SetSrcEis(eis_);
-        }
+    if (sinkAbility->eis_) {
+        eis_ = true;
+        DCameraSrcImuSensor::GetInstance().SetSrcEis(eis_);
     }
     DHLOGI("EIS ability value, eis_ is = %{public}d", eis_);
-    cJSON_Delete(root);
+    controlFormat_.store(sinkAbility->controlFormat_);
+    sessionMux_.store(sinkAbility->sessionMux_);
+    DCameraHdrAbility::GetInstance().SetHdr10Supported(devId, sinkAbility->hdr10_);
 
     std::shared_ptr<DCameraRegistParam> regParam = std::make_shared<DCameraRegistParam>(devId, dhId, reqId,
         param.sinkAttrs, param.sourceAttrs);
+    regParam->sinkAbility_ = sinkAbility;
     DCameraSourceEvent event(DCAMERA_EVENT_REGIST, regParam);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     return DCAMERA_OK;
 }
 
@@ -144,9 +157,7 @@ int32_t DCameraSourceDev::UnRegisterDistributedHardware(const std::string devId,
     DCameraSourceEvent event(DCAMERA_EVENT_UNREGIST, regParam);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     return DCAMERA_OK;
 }
 
@@ -173,9 +184,7 @@ int32_t DCameraSourceDev::DCameraNotify(std::string& eventStr)
     DCameraSourceEvent event(DCAMERA_EVENT_NOFIFY, cmd.value_);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     return DCAMERA_OK;
 }
 
@@ -186,9 +195,7 @@ int32_t DCameraSourceDev::OpenSession(DCameraIndex& camIndex)
     DCameraSourceEvent event(DCAMERA_EVENT_OPEN, camIndex);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     return DCAMERA_OK;
 }
 
@@ -199,9 +206,7 @@ int32_t DCameraSourceDev::CloseSession(DCameraIndex& camIndex)
     DCameraSourceEvent event(DCAMERA_EVENT_CLOSE, camIndex);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     return DCAMERA_OK;
 }
 
@@ -212,9 +217,7 @@ int32_t DCameraSourceDev::ConfigCameraStreams(const std::vector<std::shared_ptr<
     DCameraSourceEvent event(DCAMERA_EVENT_CONFIG_STREAMS, streamInfos);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     CHECK_AND_RETURN_RET_LOG(stateListener_ == nullptr, DCAMERA_BAD_VALUE, "stateListener_ is nullptr.");
     stateListener_->OnHardwareStateChanged(devId_, dhId_, DcameraBusinessState::RUNNING);
     return DCAMERA_OK;
@@ -227,9 +230,7 @@ int32_t DCameraSourceDev::ReleaseCameraStreams(const std::vector<int>& streamIds
     DCameraSourceEvent event(DCAMERA_EVENT_RELEASE_STREAMS, streamIds);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     return DCAMERA_OK;
 }
 
@@ -240,9 +241,7 @@ int32_t DCameraSourceDev::StartCameraCapture(const std::vector<std::shared_ptr<D
     DCameraSourceEvent event(DCAMERA_EVENT_START_CAPTURE, captureInfos);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     return DCAMERA_OK;
 }
 
@@ -253,9 +252,7 @@ int32_t DCameraSourceDev::StopCameraCapture(const std::vector<int>& streamIds)
     DCameraSourceEvent event(DCAMERA_EVENT_STOP_CAPTURE, streamIds);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     return DCAMERA_OK;
 }
 
@@ -263,15 +260,56 @@ int32_t DCameraSourceDev::UpdateCameraSettings(const std::vector<std::shared_ptr
 {
     DHLOGI("DCameraSourceDev PostTask UpdateCameraSettings devId %{public}s dhId %{public}s",
         GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+    CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
+    std::lock_guard<std::mutex> lock(settingsMutex_);
+    if (isSettingsWindowOpen_) {
+        if (settingsCoalescer_.Merge(settings)) {
+            return DCAMERA_OK;
+        }
+        // Keep the order, whatever was merged so far goes out before the settings that could not be merged.
+        std::vector<std::shared_ptr<DCameraSettings>> pending = settingsCoalescer_.Take();
+        if (!pending.empty()) {
+            PostSettingsEvent(pending);
+        }
+    } else if (settingsWindowMs_ > 0 && PostSettingsWindowEvent() == DCAMERA_OK) {
+        isSettingsWindowOpen_ = true;
+    }
+    return PostSettingsEvent(settings);
+}
+
+int32_t DCameraSourceDev::PostSettingsEvent(const std::vector<std::shared_ptr<DCameraSettings>>& settings)
+{
     DCameraSourceEvent event(DCAMERA_EVENT_UPDATE_SETTINGS, settings);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
-    CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
+    return DCAMERA_OK;
+}
+
+int32_t DCameraSourceDev::PostSettingsWindowEvent()
+{
+    AppExecFwk::InnerEvent::Pointer msgEvent = AppExecFwk::InnerEvent::Get(EVENT_SETTINGS_WINDOW);
+    if (srcDevCtrlEventHandler_ == nullptr ||
+        !srcDevCtrlEventHandler_->SendEvent(msgEvent, settingsWindowMs_, AppExecFwk::EventQueue::Priority::IMMEDIATE)) {
+        DHLOGE("post settings window event failed, devId: %{public}s", GetAnonyString(devId_).c_str());
+        return DCAMERA_BAD_OPERATE;
+    }
     return DCAMERA_OK;
 }
 
+void DCameraSourceDev::DoSettingsWindowProcess()
+{
+    std::lock_guard<std::mutex> lock(settingsMutex_);
+    std::vector<std::shared_ptr<DCameraSettings>> pending = settingsCoalescer_.Take();
+    // The window stays open while updates keep coming, an idle window closes so the next update goes out at once.
+    if (pending.empty() || PostSettingsWindowEvent() != DCAMERA_OK) {
+        isSettingsWindowOpen_ = false;
+    }
+    if (!pending.empty()) {
+        DHLOGD("send coalesced settings, devId: %{public}s", GetAnonyString(devId_).c_str());
+        PostSettingsEvent(pending);
+    }
+}
+
 int32_t DCameraSourceDev::ProcessHDFEvent(const DCameraHDFEvent& event)
 {
     DHLOGI("DCameraSourceDev ProcessHDFEvent devId %{public}s dhId %{public}s event_type %{public}d",
@@ -310,14 +348,91 @@ void DCameraSourceDev::DoProcessData(const AppExecFwk::InnerEvent::Pointer &even
     std::shared_ptr<DCameraSourceEvent> eventParam = event->GetSharedObject<DCameraSourceEvent>();
     CHECK_AND_RETURN_LOG(eventParam == nullptr, "eventParam is nullptr.");
     CHECK_AND_RETURN_LOG(stateMachine_ == nullptr, "stateMachine_ is nullptr.");
+    DCAMERA_EVENT eventType = eventParam->GetEventType();
+    if (DCameraSourceStateMachine::IsControlEvent(eventType)) {
+        stateMachine_->WaitLifecycleEventStarted(event->GetParam());
+    } else {
+        stateMachine_->OnLifecycleEventStarted(event->GetParam());
+    }
+    if (IsSupersededByClose(eventType, event->GetParam())) {
+        DHLOGI("event %{public}d superseded by a later close, devId: %{public}s dhId: %{public}s", eventType,
+            GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+        DCameraSourceEventMetrics::GetInstance().OnEventSuperseded(eventType);
+        return;
+    }
+    int64_t startUs = GetNowTimeStampUs();
+    int64_t waitUs = startUs - eventParam->GetPostTimeUs();
+    if (!DCameraSourceEventMetrics::GetInstance().OnEventStarted(eventType, waitUs)) {
+        DHLOGW("event %{public}d waited %{public}" PRId64 "us, over its %{public}" PRId64 "us deadline, devId: "
+            "%{public}s dhId: %{public}s", eventType, waitUs, DCameraSourceEventMetrics::GetDeadlineUs(eventType),
+            GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+    }
+    // The registered state closes idempotently, so an open still applying for resources is dropped here.
+    if (eventParam->GetEventType() == DCAMERA_EVENT_CLOSE) {
+        openGeneration_++;
+        pendingOpenInfo_ = nullptr;
+    }
     int32_t ret = stateMachine_->Execute((*eventParam).GetEventType(), (*eventParam));
+    DCameraSourceEventMetrics::GetInstance().OnEventFinished(eventType, GetNowTimeStampUs() - startUs);
     if (ret != DCAMERA_OK) {
         DHLOGE("DCameraSourceDev Execute failed, ret: %{public}d, devId: %{public}s dhId: %{public}s", ret,
             GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
     }
+    // A call left running on the HDI thread reports the result in DoHdiResultProcess.
+    bool isHdiResultDeferred = isHdiResultDeferred_;
+    isHdiResultDeferred_ = false;
+    if (isHdiResultDeferred && ret == DCAMERA_OK) {
+        return;
+    }
+    if (isHdiResultDeferred) {
+        pendingHdiCalls_.erase(hdiGeneration_.load());
+    }
     NotifyResult((*eventParam).GetEventType(), (*eventParam), ret);
 }
 
+bool DCameraSourceDev::IsSupersededByClose(DCAMERA_EVENT eventType, int64_t seq)
+{
+    switch (eventType) {
+        case DCAMERA_EVENT_OPEN:
+        case DCAMERA_EVENT_CONFIG_STREAMS:
+        case DCAMERA_EVENT_RELEASE_STREAMS:
+        case DCAMERA_EVENT_START_CAPTURE:
+        case DCAMERA_EVENT_STOP_CAPTURE:
+        case DCAMERA_EVENT_UPDATE_SETTINGS:
+            // A control event carries the last lifecycle event before it, so it was posted before the close too.
+            return seq < closeSeq_.load();
+        default:
+            return false;
+    }
+}
+
+void DCameraSourceDev::PostSourceEvent(std::shared_ptr<DCameraSourceEvent>& eventParam)
+{
+    eventParam->SetPostTimeUs(GetNowTimeStampUs());
+    if (eventParam->GetEventType() == DCAMERA_EVENT_CLOSE) {
+        // Settings still held by the window would only reach a closed camera.
+        std::lock_guard<std::mutex> lock(settingsMutex_);
+        settingsCoalescer_.Take();
+    }
+    // Control events only wait for the lifecycle events posted before them, not for the ones running after.
+    if (DCameraSourceStateMachine::IsControlEvent(eventParam->GetEventType()) && srcDevCtrlEventHandler_ != nullptr) {
+        int64_t seq = (stateMachine_ == nullptr) ? 0 : stateMachine_->GetLastLifecycleEvent();
+        AppExecFwk::InnerEvent::Pointer msgEvent =
+            AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, seq);
+        srcDevCtrlEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+        return;
+    }
+    // Sequence numbers have to reach the lifecycle queue in the order they are taken.
+    std::lock_guard<std::mutex> lock(postMutex_);
+    int64_t seq = (stateMachine_ == nullptr) ? 0 : stateMachine_->OnLifecycleEventPosted();
+    if (eventParam->GetEventType() == DCAMERA_EVENT_CLOSE) {
+        closeSeq_ = seq;
+    }
+    AppExecFwk::InnerEvent::Pointer msgEvent =
+        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, seq);
+    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+}
+
 void DCameraSourceDev::DoProcesHDFEvent(const AppExecFwk::InnerEvent::Pointer &event)
 {
     std::shared_ptr<DCameraSourceEvent> eventParam = event->GetSharedObject<DCameraSourceEvent>();
@@ -356,6 +471,19 @@ void DCameraSourceDev::DCameraSourceDevEventHandler::ProcessEvent(const AppExecF
         case EVENT_PROCESS_HDF_NOTIFY:
             srcDevPtr->DoProcesHDFEvent(event);
             break;
+        case EVENT_SETTINGS_WINDOW:
+            srcDevPtr->DoSettingsWindowProcess();
+            break;
+        case EVENT_REQUEST_KEY_FRAME:
+            srcDevPtr->DoKeyFrameRequestProcess();
+            break;
+        case EVENT_ALLCONNECT_APPLY_RESULT:
+            srcDevPtr->DoApplyResultProcess(event);
+            break;
+        case EVENT_HDI_CALL_RESULT:
+        case EVENT_HDI_CALL_TIMEOUT:
+            srcDevPtr->DoHdiResultProcess(event);
+            break;
         default:
             DHLOGE("event is undefined, id is %d", eventId);
             break;
@@ -402,7 +530,18 @@ int32_t DCameraSourceDev::Register(std::shared_ptr<DCameraRegistParam>& param)
     if (ret != DCAMERA_OK) {
         DHLOGE("Parsing param failed.");
     }
-    int32_t retHdi = camHdiProvider->EnableDCameraDevice(dhBase, ability, hdiCallback_);
+    sptr<IDCameraProviderCallback> hdiCallback = hdiCallback_;
+    std::function<int32_t()> enableCall = [camHdiProvider, dhBase, ability, hdiCallback]() {
+        return camHdiProvider->EnableDCameraDevice(dhBase, ability, hdiCallback);
+    };
+    if (PostHdiCall(DCAMERA_EVENT_REGIST, param, enableCall) == DCAMERA_OK) {
+        return DCAMERA_OK;
+    }
+    return FinishRegister(enableCall());
+}
+
+int32_t DCameraSourceDev::FinishRegister(int32_t retHdi)
+{
     DHLOGI("DCameraSourceDev Execute Register register hal, ret: %{public}d, devId: %{public}s dhId: %{public}s",
         retHdi, GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
     if (retHdi != SUCCESS) {
@@ -410,6 +549,9 @@ int32_t DCameraSourceDev::Register(std::shared_ptr<DCameraRegistParam>& param)
         input_->UnInit();
         return DCAMERA_REGIST_HAL_FAILED;
     }
+    if (!captureGroupId_.empty()) {
+        DCameraCaptureGroupManager::GetInstance().Bind(captureGroupId_, devId_, dhId_);
+    }
     if (version_ >= SEPARATE_SINK_VERSION) {
         ManageSelectChannel::GetInstance().SetSrcConnect(true);
     }
@@ -418,28 +560,33 @@ int32_t DCameraSourceDev::Register(std::shared_ptr<DCameraRegistParam>& param)
 
 int32_t DCameraSourceDev::ParseEnableParam(std::shared_ptr<DCameraRegistParam>& param, std::string& ability)
 {
-    cJSON *sinkRootValue = cJSON_Parse(param->sinkParam_.c_str());
-    if (sinkRootValue == nullptr) {
-        DHLOGE("Input sink ablity info is not json object.");
-        return DCAMERA_INIT_ERR;
+    std::shared_ptr<DCameraSinkAbility> sinkAbility = param->sinkAbility_;
+    if (sinkAbility == nullptr || sinkAbility->root_ == nullptr) {
+        sinkAbility = std::make_shared<DCameraSinkAbility>();
+        if (sinkAbility->Unmarshal(param->sinkParam_) != DCAMERA_OK) {
+            DHLOGE("Input sink ablity info is not json object.");
+            return DCAMERA_INIT_ERR;
+        }
     }
 
     cJSON *srcRootValue = cJSON_Parse(param->srcParam_.c_str());
     if (srcRootValue == nullptr) {
         DHLOGE("Input source ablity info is not json object.");
-        cJSON_Delete(sinkRootValue);
         return DCAMERA_INIT_ERR;
     }
+    cJSON *captureGroup = cJSON_GetObjectItemCaseSensitive(srcRootValue, CAMERA_CAPTURE_GROUP_KEY.c_str());
+    captureGroupId_ = (cJSON_IsString(captureGroup) && captureGroup->valuestring != nullptr) ?
+        captureGroup->valuestring : "";
 
     cJSON *abilityRootValue = cJSON_CreateObject();
     if (abilityRootValue == nullptr) {
-        cJSON_Delete(sinkRootValue);
         cJSON_Delete(srcRootValue);
         return DCAMERA_BAD_VALUE;
     }
-    cJSON_AddItemToObject(abilityRootValue, "SinkAbility", sinkRootValue);
+    // The sink tree stays owned by the ability, only a reference goes into the document.
+    cJSON_AddItemReferenceToObject(abilityRootValue, "SinkAbility", sinkAbility->root_.get());
     cJSON_AddItemToObject(abilityRootValue, "SourceCodec", srcRootValue);
-    char *jsonstr = cJSON_Print(abilityRootValue);
+    char *jsonstr = cJSON_PrintUnformatted(abilityRootValue);
     if (jsonstr == nullptr) {
         cJSON_Delete(abilityRootValue);
         return DCAMERA_BAD_VALUE;
@@ -455,6 +602,7 @@ int32_t DCameraSourceDev::UnRegister(std::shared_ptr<DCameraRegistParam>& param)
     DCAMERA_SYNC_TRACE(DCAMERA_UNREGISTER_CAMERA);
     DHLOGI("DCameraSourceDev Execute UnRegister devId: %{public}s dhId: %{public}s", GetAnonyString(devId_).c_str(),
         GetAnonyString(dhId_).c_str());
+    DCameraCaptureGroupManager::GetInstance().Unbind(devId_, dhId_);
     ReportRegisterCameraEvent(UNREGIST_CAMERA_EVENT, GetAnonyString(devId_), GetAnonyString(dhId_),
         version_, "execute unregister event.");
     int32_t ret = controller_->UnInit();
@@ -479,7 +627,17 @@ int32_t DCameraSourceDev::UnRegister(std::shared_ptr<DCameraRegistParam>& param)
     DHBase dhBase;
     dhBase.deviceId_ = param->devId_;
     dhBase.dhId_ = param->dhId_;
-    int32_t retHdi = camHdiProvider->DisableDCameraDevice(dhBase);
+    std::function<int32_t()> disableCall = [camHdiProvider, dhBase]() {
+        return camHdiProvider->DisableDCameraDevice(dhBase);
+    };
+    if (PostHdiCall(DCAMERA_EVENT_UNREGIST, param, disableCall) == DCAMERA_OK) {
+        return DCAMERA_OK;
+    }
+    return FinishUnRegister(disableCall());
+}
+
+int32_t DCameraSourceDev::FinishUnRegister(int32_t retHdi)
+{
     DHLOGI("DCameraSourceDev Execute UnRegister unregister hal, ret: %{public}d, devId: %{public}s dhId: %{public}s",
         retHdi, GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
     if (retHdi != SUCCESS) {
@@ -489,6 +647,85 @@ int32_t DCameraSourceDev::UnRegister(std::shared_ptr<DCameraRegistParam>& param)
     return DCAMERA_OK;
 }
 
+int32_t DCameraSourceDev::PostHdiCall(DCAMERA_EVENT eventType, std::shared_ptr<DCameraRegistParam>& param,
+    std::function<int32_t()> call)
+{
+    if (hdiEventHandler_ == nullptr || srcDevEventHandler_ == nullptr || stateMachine_ == nullptr) {
+        return DCAMERA_BAD_OPERATE;
+    }
+    int64_t generation = ++hdiGeneration_;
+    pendingHdiCalls_[generation] = { eventType, param, stateMachine_->GetCameraState() };
+    std::weak_ptr<DCameraSourceDev> weakDev = shared_from_this();
+    // The HDI thread runs the calls in the order they are posted, a disable never overtakes its enable.
+    bool isPosted = hdiEventHandler_->PostTask([weakDev, generation, call]() {
+        int32_t retHdi = call();
+        auto dev = weakDev.lock();
+        if (dev == nullptr || dev->srcDevEventHandler_ == nullptr) {
+            return;
+        }
+        AppExecFwk::InnerEvent::Pointer msgEvent = AppExecFwk::InnerEvent::Get(EVENT_HDI_CALL_RESULT,
+            std::make_shared<int32_t>(retHdi), generation);
+        dev->srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    });
+    if (!isPosted) {
+        DHLOGE("DCameraSourceDev post hdi call %{public}d failed, devId: %{public}s dhId: %{public}s", eventType,
+            GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+        pendingHdiCalls_.erase(generation);
+        return DCAMERA_BAD_OPERATE;
+    }
+    AppExecFwk::InnerEvent::Pointer timeoutEvent = AppExecFwk::InnerEvent::Get(EVENT_HDI_CALL_TIMEOUT, generation);
+    srcDevEventHandler_->SendEvent(timeoutEvent, HDI_CALL_TIMEOUT_MS, AppExecFwk::EventQueue::Priority::HIGH);
+    isHdiResultDeferred_ = true;
+    return DCAMERA_OK;
+}
+
+void DCameraSourceDev::DoHdiResultProcess(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    int64_t generation = event->GetParam();
+    auto iter = pendingHdiCalls_.find(generation);
+    if (iter == pendingHdiCalls_.end()) {
+        return;
+    }
+    HdiPendingCall call = iter->second;
+    pendingHdiCalls_.erase(iter);
+    int32_t retHdi = FAILED;
+    if (event->GetInnerEventId() == EVENT_HDI_CALL_RESULT) {
+        srcDevEventHandler_->RemoveEvent(EVENT_HDI_CALL_TIMEOUT, generation);
+        std::shared_ptr<int32_t> result = event->GetSharedObject<int32_t>();
+        retHdi = (result == nullptr) ? FAILED : *result;
+    } else {
+        DHLOGE("DCameraSourceDev hdi call %{public}d timed out, devId: %{public}s dhId: %{public}s",
+            call.eventType, GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+    }
+    int32_t ret = DCAMERA_OK;
+    if (call.eventType == DCAMERA_EVENT_UNREGIST) {
+        ret = FinishUnRegister(retHdi);
+    } else if (generation != hdiGeneration_.load()) {
+        // A later call took over the device, only the result is left to report.
+        ret = (retHdi == SUCCESS) ? DCAMERA_OK : DCAMERA_REGIST_HAL_FAILED;
+    } else {
+        ret = FinishRegister(retHdi);
+        if (ret != DCAMERA_OK && stateMachine_ != nullptr) {
+            stateMachine_->UpdateState(static_cast<DCameraStateType>(call.state));
+        }
+        if (event->GetInnerEventId() == EVENT_HDI_CALL_TIMEOUT && call.param != nullptr &&
+            hdiEventHandler_ != nullptr) {
+            // The enable may still go through, the disable queued behind it keeps the HDF service in step.
+            DHBase dhBase;
+            dhBase.deviceId_ = call.param->devId_;
+            dhBase.dhId_ = call.param->dhId_;
+            hdiEventHandler_->PostTask([dhBase]() {
+                sptr<IDCameraProvider> camHdiProvider = IDCameraProvider::Get(HDF_DCAMERA_EXT_SERVICE);
+                if (camHdiProvider != nullptr) {
+                    camHdiProvider->DisableDCameraDevice(dhBase);
+                }
+            });
+        }
+    }
+    DCameraSourceEvent sourceEvent(call.eventType, call.param);
+    NotifyRegisterResult(call.eventType, sourceEvent, ret);
+}
+
 int32_t DCameraSourceDev::OpenCamera()
 {
     DHLOGI("DCameraSourceDev Execute OpenCamera devId %{public}s dhId %{public}s", GetAnonyString(devId_).c_str(),
@@ -505,14 +742,68 @@ int32_t DCameraSourceDev::OpenCamera()
         return ret;
     }
 
+    if (DCameraAllConnectManager::InitOnFirstUse() &&
+        !DCameraAllConnectManager::GetInstance().IsAdvancedResourceGranted(devId_)) {
+        return ApplyAdvancedResource(openInfo);
+    }
+    return OpenChannelWithResource(openInfo);
+}
+
+int32_t DCameraSourceDev::ApplyAdvancedResource(const std::shared_ptr<DCameraOpenInfo>& openInfo)
+{
+    int64_t generation = ++openGeneration_;
+    pendingOpenInfo_ = openInfo;
+    std::weak_ptr<DCameraSourceDev> weakDev = shared_from_this();
+    auto resourceReq = DCameraAllConnectManager::GetInstance().BuildResourceRequest();
+    // The open goes on in DoApplyResultProcess, the event thread is not held while the peer is asked.
+    int32_t ret = DCameraAllConnectManager::GetInstance().ApplyAdvancedResourceAsync(devId_, resourceReq,
+        [weakDev, generation](int32_t result) {
+            auto dev = weakDev.lock();
+            if (dev == nullptr || dev->srcDevEventHandler_ == nullptr) {
+                return;
+            }
+            AppExecFwk::InnerEvent::Pointer msgEvent = AppExecFwk::InnerEvent::Get(EVENT_ALLCONNECT_APPLY_RESULT,
+                std::make_shared<int32_t>(result), generation);
+            dev->srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+        });
+    if (ret != DCAMERA_OK) {
+        DHLOGE("DCamera allconnect apply advanced resource failed, ret: %{public}d, devId: %{public}s",
+            ret, GetAnonyString(devId_).c_str());
+        pendingOpenInfo_ = nullptr;
+    }
+    return ret;
+}
+
+void DCameraSourceDev::DoApplyResultProcess(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    std::shared_ptr<int32_t> result = event->GetSharedObject<int32_t>();
+    CHECK_AND_RETURN_LOG(result == nullptr, "apply result is nullptr.");
+    std::shared_ptr<DCameraOpenInfo> openInfo = pendingOpenInfo_;
+    if (event->GetParam() != openGeneration_.load() || openInfo == nullptr ||
+        stateMachine_ == nullptr || stateMachine_->GetCameraState() != DCAMERA_STATE_REGIST) {
+        DHLOGI("DCamera allconnect apply result %{public}d of a closed open, devId: %{public}s", *result,
+            GetAnonyString(devId_).c_str());
+        return;
+    }
+    pendingOpenInfo_ = nullptr;
+    int32_t ret = *result;
+    if (ret == DCAMERA_OK) {
+        ret = OpenChannelWithResource(openInfo);
+    } else {
+        DHLOGE("DCamera allconnect apply advanced resource failed, ret: %{public}d, devId: %{public}s",
+            ret, GetAnonyString(devId_).c_str());
+    }
+    if (ret != DCAMERA_OK) {
+        DCameraIndex camIndex(devId_, dhId_);
+        DCameraSourceEvent openEvent(DCAMERA_EVENT_OPEN, camIndex);
+        NotifyHalResult(DCAMERA_EVENT_OPEN, openEvent, ret);
+    }
+}
+
+int32_t DCameraSourceDev::OpenChannelWithResource(std::shared_ptr<DCameraOpenInfo>& openInfo)
+{
+    int32_t ret = DCAMERA_OK;
     if (DCameraAllConnectManager::IsInited()) {
-        auto resourceReq = DCameraAllConnectManager::GetInstance().BuildResourceRequest();
-        ret = DCameraAllConnectManager::GetInstance().ApplyAdvancedResource(devId_, resourceReq.get());
-        if (ret != DCAMERA_OK) {
-            DHLOGE("DCamera allconnect apply advanced resource failed, ret: %{public}d, devId: %{public}s",
-                ret, GetAnonyString(devId_).c_str());
-            return ret;
-        }
         ret = DCameraAllConnectManager::GetInstance().PublishServiceState(devId_, dhId_, SCM_PREPARE);
         if (ret != DCAMERA_OK) {
             DHLOGE("DCamera allconnect publish scm prepare failed, ret: %{public}d, devId: %{public}s",
@@ -593,6 +884,9 @@ int32_t DCameraSourceDev::ConfigStreams(std::vector<std::shared_ptr<DCStreamInfo
     DCameraChannelDetail snapShotChInfo(SNAP_SHOT_SESSION_FLAG, SNAPSHOT_FRAME);
     chanInfo->detail_.push_back(continueChInfo);
     chanInfo->detail_.push_back(snapShotChInfo);
+    chanInfo->frameInfoFormat_ = DCAMERA_FRAME_INFO_FORMAT_BINARY;
+    chanInfo->controlFormat_ = DCAMERA_CONTROL_FORMAT_BINARY;
+    chanInfo->sessionMux_ = sessionMux_.load();
 
     ret = controller_->ChannelNeg(chanInfo);
     if (ret != DCAMERA_OK) {
@@ -667,10 +961,16 @@ int32_t DCameraSourceDev::StartCapture(std::vector<std::shared_ptr<DCCaptureInfo
         capture->isCapture_ = (*iter)->isCapture_;
         capture->encodeType_ = (*iter)->encodeType_;
         capture->streamType_ = (*iter)->type_;
+        capture->hdrType_ = DCAMERA_HDR_NONE;
+        if (capture->encodeType_ == ENCODE_TYPE_H265) {
+            capture->hdrType_ = DCameraHdrAbility::GetInstance().GetHdrType(devId_, capture->format_,
+                capture->dataspace_);
+        }
         DHLOGI("StartCapture devId %{public}s dhId %{public}s settings size: %{public}zu w: %{public}d h: %{public}d "
-            "fmt: %{public}d isC: %{public}d enc: %{public}d streamT: %{public}d", GetAnonyString(devId_).c_str(),
-            GetAnonyString(dhId_).c_str(), (*iter)->captureSettings_.size(), capture->width_, capture->height_,
-            capture->format_, capture->isCapture_ ? 1 : 0, capture->encodeType_, capture->streamType_);
+            "fmt: %{public}d isC: %{public}d enc: %{public}d streamT: %{public}d hdr: %{public}d",
+            GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), (*iter)->captureSettings_.size(),
+            capture->width_, capture->height_, capture->format_, capture->isCapture_ ? 1 : 0, capture->encodeType_,
+            capture->streamType_, capture->hdrType_);
         for (auto settingIter = (*iter)->captureSettings_.begin(); settingIter != (*iter)->captureSettings_.end();
             settingIter++) {
             std::shared_ptr<DCameraSettings> setting = std::make_shared<DCameraSettings>();
@@ -858,6 +1158,16 @@ std::string DCameraSourceDev::GetVersion()
     return version_;
 }
 
+int32_t DCameraSourceDev::GetControlFormat()
+{
+    return controlFormat_.load();
+}
+
+bool DCameraSourceDev::IsSessionMux()
+{
+    return sessionMux_.load();
+}
+
 int32_t DCameraSourceDev::OnChannelConnectedEvent()
 {
     std::shared_ptr<DCameraEvent> camEvent = std::make_shared<DCameraEvent>();
@@ -866,9 +1176,7 @@ int32_t DCameraSourceDev::OnChannelConnectedEvent()
     DCameraSourceEvent event(DCAMERA_EVENT_NOFIFY, camEvent);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     return DCAMERA_OK;
 }
 
@@ -879,16 +1187,13 @@ int32_t DCameraSourceDev::OnChannelDisconnectedEvent()
     DCameraSourceEvent event(DCAMERA_EVENT_CLOSE, camIndex);
     std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(event);
     CHECK_AND_RETURN_RET_LOG(srcDevEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "srcDevEventHandler_ is nullptr.");
-    AppExecFwk::InnerEvent::Pointer msgEvent =
-        AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     std::shared_ptr<DCameraEvent> camEvent = std::make_shared<DCameraEvent>();
     camEvent->eventType_ = DCAMERA_MESSAGE;
     camEvent->eventResult_ = DCAMERA_EVENT_CHANNEL_DISCONNECTED;
     DCameraSourceEvent eventNotify(DCAMERA_EVENT_NOFIFY, camEvent);
     eventParam = std::make_shared<DCameraSourceEvent>(eventNotify);
-    msgEvent = AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam, 0);
-    srcDevEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    PostSourceEvent(eventParam);
     return DCAMERA_OK;
 }
 
@@ -900,6 +1205,28 @@ int32_t DCameraSourceDev::PostHicollieEvent()
     return DCAMERA_OK;
 }
 
+int32_t DCameraSourceDev::PostKeyFrameRequestEvent()
+{
+    // Goes out on the control handler so a slow stream reconfiguration does not hold it back.
+    CHECK_AND_RETURN_RET_LOG(srcDevCtrlEventHandler_ == nullptr, DCAMERA_BAD_VALUE,
+        "srcDevCtrlEventHandler_ is nullptr.");
+    AppExecFwk::InnerEvent::Pointer msgEvent = AppExecFwk::InnerEvent::Get(EVENT_REQUEST_KEY_FRAME);
+    if (!srcDevCtrlEventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE)) {
+        DHLOGE("post key frame request event failed, devId: %{public}s", GetAnonyString(devId_).c_str());
+        return DCAMERA_BAD_OPERATE;
+    }
+    return DCAMERA_OK;
+}
+
+void DCameraSourceDev::DoKeyFrameRequestProcess()
+{
+    CHECK_AND_RETURN_LOG(controller_ == nullptr, "controller_ is nullptr.");
+    int32_t ret = controller_->RequestKeyFrame();
+    if (ret != DCAMERA_OK) {
+        DHLOGE("request key frame failed, devId: %{public}s ret: %{public}d", GetAnonyString(devId_).c_str(), ret);
+    }
+}
+
 void DCameraSourceDev::SetHicollieFlag(bool flag)
 {
     hicollieFlag_.store(flag);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -20,6 +20,25 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+int32_t DCameraSinkAbility::Unmarshal(const std::string& sinkAttrs)
+{
+    cJSON *rootValue = cJSON_Parse(sinkAttrs.c_str());
+    if (rootValue == nullptr || !cJSON_IsObject(rootValue)) {
+        DHLOGE("DCameraSinkAbility sink attrs is not json object.");
+        cJSON_Delete(rootValue);
+        return DCAMERA_BAD_VALUE;
+    }
+    root_ = std::shared_ptr<cJSON>(rootValue, [](cJSON *item) { cJSON_Delete(item); });
+    eis_ = cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(rootValue, "EIS"));
+    cJSON *controlFormat = cJSON_GetObjectItemCaseSensitive(rootValue, CAMERA_CONTROL_FORMAT_KEY.c_str());
+    if (controlFormat != nullptr && cJSON_IsNumber(controlFormat)) {
+        controlFormat_ = controlFormat->valueint;
+    }
+    hdr10_ = cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(rootValue, CAMERA_HDR10_KEY.c_str()));
+    sessionMux_ = cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(rootValue, CAMERA_SESSION_MUX_KEY.c_str()));
+    return DCAMERA_OK;
+}
+
 int32_t DCameraSourceEvent::GetDCameraIndex(DCameraIndex& index)
 {
     auto indexPtr = std::get_if<DCameraIndex>(&eventParam_);
@@ -102,5 +121,15 @@ DCAMERA_EVENT DCameraSourceEvent::GetEventType()
 {
     return eventType_;
 }
+
+void DCameraSourceEvent::SetPostTimeUs(int64_t postTimeUs)
+{
+    postTimeUs_ = postTimeUs;
+}
+
+int64_t DCameraSourceEvent::GetPostTimeUs()
+{
+    return postTimeUs_;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
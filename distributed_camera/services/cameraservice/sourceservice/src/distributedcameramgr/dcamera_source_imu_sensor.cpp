@@ -14,6 +14,7 @@
  */
 
 #include "dcamera_source_imu_sensor.h"
+#include "dcamera_imu_ring.h"
 #include "distributed_hardware_log.h"
 
 namespace OHOS {
@@ -25,12 +26,12 @@ DCameraSrcImuSensor::~DCameraSrcImuSensor()
 
 void DCameraSrcImuSensor::SetInitParam(const std::string& param)
 {
-    param_ = param;
+    DCameraImuStore::GetInstance().SetInitParam(param);
 }
  
 std::string DCameraSrcImuSensor::GetInitParam()
 {
-    return param_;
+    return DCameraImuStore::GetInstance().GetInitParam();
 }
 
 void DCameraSrcImuSensor::SetSrcEis(bool eis)
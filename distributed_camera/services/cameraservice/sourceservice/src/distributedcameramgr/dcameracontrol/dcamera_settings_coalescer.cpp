@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_settings_coalescer.h"
+
+#include "dcamera_utils_tools.h"
+#include "distributed_hardware_log.h"
+#include "metadata_utils.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+bool DCameraSettingsCoalescer::Merge(const std::vector<std::shared_ptr<DCameraSettings>>& settings)
+{
+    if (settings.empty()) {
+        return false;
+    }
+    std::vector<std::shared_ptr<Camera::CameraMetadata>> metadatas;
+    for (const auto& setting : settings) {
+        if (setting == nullptr || setting->type_ != UPDATE_METADATA) {
+            return false;
+        }
+        std::shared_ptr<Camera::CameraMetadata> metadata =
+            Camera::MetadataUtils::DecodeFromString(Base64Decode(setting->value_));
+        if (metadata == nullptr || metadata->get() == nullptr) {
+            DHLOGE("decode metadata setting failed, send it as is.");
+            return false;
+        }
+        metadatas.push_back(metadata);
+    }
+    // A failed merge may leave part of the batch in the pending update, that is harmless as the caller sends
+    // the whole batch as is right after the pending update.
+    for (const auto& metadata : metadatas) {
+        if (!MergeMetadata(metadata)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DCameraSettingsCoalescer::MergeMetadata(const std::shared_ptr<Camera::CameraMetadata>& metadata)
+{
+    if (pending_ == nullptr) {
+        pending_ = std::make_shared<Camera::CameraMetadata>(PENDING_ITEM_CAPACITY, PENDING_DATA_CAPACITY);
+    }
+    common_metadata_header_t *src = metadata->get();
+    uint32_t count = Camera::GetCameraMetadataItemCount(src);
+    for (uint32_t index = 0; index < count; index++) {
+        camera_metadata_item_t item;
+        if (Camera::GetCameraMetadataItem(src, index, &item) != CAM_META_SUCCESS) {
+            return false;
+        }
+        bool isMerged = Camera::IsCameraMetadataItemExist(pending_->get(), item.item) ?
+            pending_->updateEntry(item.item, item.data.u8, item.count) :
+            pending_->addEntry(item.item, item.data.u8, item.count);
+        if (!isMerged) {
+            DHLOGE("merge metadata item %{public}u failed.", item.item);
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::shared_ptr<DCameraSettings>> DCameraSettingsCoalescer::Take()
+{
+    std::vector<std::shared_ptr<DCameraSettings>> settings;
+    if (pending_ == nullptr) {
+        return settings;
+    }
+    std::string metadataStr = Camera::MetadataUtils::EncodeToString(pending_);
+    pending_ = nullptr;
+    std::shared_ptr<DCameraSettings> setting = std::make_shared<DCameraSettings>();
+    setting->type_ = UPDATE_METADATA;
+    setting->value_ = Base64Encode(reinterpret_cast<const unsigned char *>(metadataStr.c_str()),
+        metadataStr.length());
+    settings.push_back(setting);
+    return settings;
+}
+
+bool DCameraSettingsCoalescer::IsEmpty() const
+{
+    return pending_ == nullptr;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,7 @@
 #include "dcamera_source_controller.h"
 
 #include <securec.h>
+#include <algorithm>
 #include <cstdlib>
 #include "iservice_registry.h"
 #include "iservmgr_hdi.h"
@@ -31,6 +32,7 @@
 #include "dcamera_softbus_latency.h"
 #include "dcamera_source_controller_channel_listener.h"
 #include "dcamera_source_service_ipc.h"
+#include "dcamera_trust_cache.h"
 #include "dcamera_utils_tools.h"
 #include "dcamera_hisysevent_adapter.h"
 
@@ -65,6 +67,7 @@ DCameraSourceController::~DCameraSourceController()
         UnInit();
     }
     camHdiProvider_ = nullptr;
+    camHdiProviderV1_2_ = nullptr;
 }
 
 int32_t DCameraSourceController::StartCapture(std::vector<std::shared_ptr<DCameraCaptureInfo>>& captureInfos,
@@ -221,6 +224,10 @@ int32_t DCameraSourceController::DCameraNotify(std::shared_ptr<DCameraEvent>& ev
         DcameraRadar::GetInstance().ReportDcameraOpen("StartCapture", CameraOpen::START_CAPTURE,
             BizState::BIZ_STATE_END, DCAMERA_OK);
     }
+    if (events->eventContent_.compare(0, SINK_CAPTURE_DEGRADED.size(), SINK_CAPTURE_DEGRADED) == 0) {
+        DHLOGI("DCameraNotify devId: %{public}s dhId: %{public}s %{public}s", GetAnonyString(devId_).c_str(),
+            GetAnonyString(dhId_).c_str(), events->eventContent_.c_str());
+    }
 
     if (events->eventResult_ == DCAMERA_EVENT_CAMERA_ERROR) {
         DcameraFinishAsyncTrace(DCAMERA_CONTINUE_FIRST_FRAME, DCAMERA_CONTINUE_FIRST_FRAME_TASKID);
@@ -246,7 +253,9 @@ int32_t DCameraSourceController::DCameraNotify(std::shared_ptr<DCameraEvent>& ev
     hdiEvent.type_ = events->eventType_;
     hdiEvent.result_ = events->eventResult_;
     hdiEvent.content_ = events->eventContent_;
-    int32_t retHdi = camHdiProvider_->Notify(dhBase, hdiEvent);
+    // One-way when the driver has it, the event thread does not wait for the HDF service to handle the event.
+    int32_t retHdi = camHdiProviderV1_2_ != nullptr ? camHdiProviderV1_2_->NotifyAsync(dhBase, hdiEvent) :
+        camHdiProvider_->Notify(dhBase, hdiEvent);
     DHLOGI("Nofify hal, ret: %{public}d, devId: %{public}s dhId: %{public}s, type: %{public}d, result: %{public}d, "
         "content: %{public}s", retHdi, GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(),
         events->eventType_, events->eventResult_, events->eventContent_.c_str());
@@ -272,21 +281,13 @@ int32_t DCameraSourceController::UpdateSettings(std::vector<std::shared_ptr<DCam
     cmd.dhId_ = dhId;
     cmd.command_ = DCAMERA_PROTOCOL_CMD_UPDATE_METADATA;
     cmd.value_.assign(settings.begin(), settings.end());
-    std::string jsonStr;
-    int32_t ret = cmd.Marshal(jsonStr);
+    std::shared_ptr<DataBuffer> buffer = nullptr;
+    int32_t ret = MarshalSettings(cmd, buffer);
     if (ret != DCAMERA_OK) {
         DHLOGE("Marshal failed %{public}d, devId: %{public}s, dhId: %{public}s", ret,
             GetAnonyString(devId).c_str(), GetAnonyString(dhId).c_str());
         return ret;
     }
-    std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(jsonStr.length() + 1);
-    ret = memcpy_s(buffer->Data(), buffer->Capacity(), reinterpret_cast<uint8_t *>(const_cast<char *>(jsonStr.c_str())),
-        jsonStr.length());
-    if (ret != EOK) {
-        DHLOGE("memcpy_s failed %{public}d, devId: %{public}s, dhId: %{public}s", ret,
-            GetAnonyString(devId).c_str(), GetAnonyString(dhId).c_str());
-        return ret;
-    }
     CHECK_AND_RETURN_RET_LOG(channel_ == nullptr, DCAMERA_BAD_VALUE, "channel_ is null.");
     ret = channel_->SendData(buffer);
     if (ret != DCAMERA_OK) {
@@ -299,6 +300,38 @@ int32_t DCameraSourceController::UpdateSettings(std::vector<std::shared_ptr<DCam
     return DCAMERA_OK;
 }
 
+int32_t DCameraSourceController::RequestKeyFrame()
+{
+    if (indexs_.empty() || indexs_.size() > DCAMERA_MAX_NUM) {
+        DHLOGE("RequestKeyFrame not support operate %{public}zu camera", indexs_.size());
+        return DCAMERA_BAD_OPERATE;
+    }
+    std::string dhId = indexs_.begin()->dhId_;
+    cJSON *rootValue = cJSON_CreateObject();
+    CHECK_AND_RETURN_RET_LOG(rootValue == nullptr, DCAMERA_BAD_VALUE, "RequestKeyFrame create json failed.");
+    cJSON_AddStringToObject(rootValue, "Type", DCAMERA_PROTOCOL_TYPE_MESSAGE.c_str());
+    cJSON_AddStringToObject(rootValue, "dhId", dhId.c_str());
+    cJSON_AddStringToObject(rootValue, "Command", DCAMERA_PROTOCOL_CMD_REQUEST_KEY_FRAME.c_str());
+    char *data = cJSON_PrintUnformatted(rootValue);
+    cJSON_Delete(rootValue);
+    CHECK_AND_RETURN_RET_LOG(data == nullptr, DCAMERA_BAD_VALUE, "RequestKeyFrame print json failed.");
+    std::string jsonStr = std::string(data);
+    cJSON_free(data);
+    std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(jsonStr.length() + 1);
+    int32_t ret = memcpy_s(buffer->Data(), buffer->Capacity(),
+        reinterpret_cast<uint8_t *>(const_cast<char *>(jsonStr.c_str())), jsonStr.length());
+    CHECK_AND_RETURN_RET_LOG(ret != EOK, DCAMERA_MEMORY_OPT_ERROR, "RequestKeyFrame memcpy_s failed ret: %{public}d",
+        ret);
+    CHECK_AND_RETURN_RET_LOG(channel_ == nullptr, DCAMERA_BAD_VALUE, "channel_ is null.");
+    ret = channel_->SendData(buffer);
+    if (ret != DCAMERA_OK) {
+        DHLOGE("RequestKeyFrame SendData failed %{public}d, dhId: %{public}s", ret, GetAnonyString(dhId).c_str());
+        return ret;
+    }
+    DHLOGI("RequestKeyFrame dhId: %{public}s success", GetAnonyString(dhId).c_str());
+    return DCAMERA_OK;
+}
+
 int32_t DCameraSourceController::GetCameraInfo(std::shared_ptr<DCameraInfo>& camInfo)
 {
     if (!ManageSelectChannel::GetInstance().GetSrcConnect()) {
@@ -402,6 +435,10 @@ int32_t DCameraSourceController::ParseValueFromCjson(std::string args, std::stri
 
 int32_t DCameraSourceController::CheckOsType(const std::string &networkId, bool &isInvalid)
 {
+    bool isWarmOpen = DCameraTrustCache::GetInstance().IsEnabled();
+    if (isWarmOpen && DCameraTrustCache::GetInstance().GetOsType(networkId, isInvalid)) {
+        return DCAMERA_OK;
+    }
     std::vector<DistributedHardware::DmDeviceInfo> dmDeviceInfoList;
     int32_t errCode = DeviceManager::GetInstance().GetTrustedDeviceList(DCAMERA_PKG_NAME, "", dmDeviceInfoList);
     CHECK_AND_RETURN_RET_LOG(errCode != DCAMERA_OK, DCAMERA_BAD_VALUE,
@@ -413,6 +450,9 @@ int32_t DCameraSourceController::CheckOsType(const std::string &networkId, bool
                 isInvalid = true;
             }
             DHLOGI("remote found, osType: %{public}d, isInvalid: %{public}d", osType, isInvalid);
+            if (isWarmOpen) {
+                DCameraTrustCache::GetInstance().PutOsType(networkId, isInvalid);
+            }
             return DCAMERA_OK;
         }
     }
@@ -443,9 +483,19 @@ bool DCameraSourceController::CheckAclRight()
     };
     DHLOGI("CheckAclRight dmSrcCaller networkId: %{public}s, accountId: %{public}s, devId: %{public}s",
         GetAnonyString(srcDevId_).c_str(), GetAnonyString(accountId_).c_str(), GetAnonyString(devId_).c_str());
+    bool isWarmOpen = DCameraTrustCache::GetInstance().IsEnabled();
+    std::string aclKey = srcDevId_ + "#" + accountId_ + "#" + std::to_string(userId_) + "#" +
+        std::to_string(tokenId_);
+    if (isWarmOpen && DCameraTrustCache::GetInstance().GetAclGranted(devId_, aclKey)) {
+        return true;
+    }
     if (DeviceManager::GetInstance().CheckSrcAccessControl(dmSrcCaller, dmDstCallee)) {
+        if (isWarmOpen) {
+            DCameraTrustCache::GetInstance().PutAclGranted(devId_, aclKey);
+        }
         return true;
     }
+    DCameraTrustCache::GetInstance().Remove(devId_);
     return false;
 }
 
@@ -520,6 +570,7 @@ int32_t DCameraSourceController::Init(std::vector<DCameraIndex>& indexs)
         DHLOGE("camHdiProvider_ is null.");
         return DCAMERA_INIT_ERR;
     }
+    camHdiProviderV1_2_ = OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider::CastFrom(camHdiProvider_);
     remote_ = OHOS::HDI::hdi_objcast<IDCameraProvider>(camHdiProvider_);
     if (remote_ != nullptr) {
         remote_->AddDeathRecipient(cameraHdiRecipient_);
@@ -581,6 +632,29 @@ void DCameraSourceController::OnSessionState(int32_t state, std::string networkI
     }
 }
 
+int32_t DCameraSourceController::MarshalSettings(DCameraMetadataSettingCmd& cmd,
+    std::shared_ptr<DataBuffer>& buffer)
+{
+    std::shared_ptr<DCameraSourceDev> camDev = camDev_.lock();
+    if (camDev != nullptr && camDev->GetControlFormat() == DCAMERA_CONTROL_FORMAT_BINARY) {
+        std::vector<uint8_t> data;
+        int32_t ret = cmd.MarshalBinary(data);
+        CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, ret, "MarshalBinary failed %{public}d", ret);
+        buffer = std::make_shared<DataBuffer>(data.size());
+        ret = memcpy_s(buffer->Data(), buffer->Capacity(), data.data(), data.size());
+        CHECK_AND_RETURN_RET_LOG(ret != EOK, ret, "memcpy_s failed %{public}d", ret);
+        return DCAMERA_OK;
+    }
+    std::string jsonStr;
+    int32_t ret = cmd.Marshal(jsonStr);
+    CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, ret, "Marshal failed %{public}d", ret);
+    buffer = std::make_shared<DataBuffer>(jsonStr.length() + 1);
+    ret = memcpy_s(buffer->Data(), buffer->Capacity(), reinterpret_cast<uint8_t *>(const_cast<char *>(jsonStr.c_str())),
+        jsonStr.length());
+    CHECK_AND_RETURN_RET_LOG(ret != EOK, ret, "memcpy_s failed %{public}d", ret);
+    return DCAMERA_OK;
+}
+
 void DCameraSourceController::OnSessionError(int32_t eventType, int32_t eventReason, std::string detail)
 {
     DHLOGI("DCameraSourceController OnSessionError devId: %{public}s, dhId: %{public}s, eventType: %{public}d, "
@@ -605,8 +679,18 @@ void DCameraSourceController::HandleReceivedData(std::shared_ptr<DataBuffer>& da
     CHECK_AND_RETURN_LOG(dataBuffer == nullptr, "dataBuffer is nullptr");
     DHLOGI("DCameraSourceController::HandleReceivedData dhId: %{public}s", GetAnonyString(dhId_).c_str());
     uint8_t *data = dataBuffer->Data();
-    std::string jsonStr(reinterpret_cast<const char *>(data), dataBuffer->Capacity());
-    cJSON *rootValue = cJSON_Parse(jsonStr.c_str());
+    if (DCameraMetadataSettingCmd::IsBinary(data, dataBuffer->Size())) {
+        DCameraMetadataSettingCmd cmd;
+        int32_t ret = cmd.UnmarshalBinary(data, dataBuffer->Size());
+        if (ret != DCAMERA_OK || cmd.command_ != DCAMERA_PROTOCOL_CMD_METADATA_RESULT) {
+            DHLOGE("DCameraSourceController UnmarshalBinary failed, ret: %{public}d, dhId: %{public}s", ret,
+                GetAnonyString(dhId_).c_str());
+            return;
+        }
+        ReportMetaDataResult(cmd);
+        return;
+    }
+    cJSON *rootValue = cJSON_ParseWithLength(reinterpret_cast<const char *>(data), dataBuffer->Size());
     if (rootValue == nullptr) {
         return;
     }
@@ -617,38 +701,59 @@ void DCameraSourceController::HandleReceivedData(std::shared_ptr<DataBuffer>& da
         return;
     }
     std::string command = std::string(comvalue->valuestring);
-    cJSON_Delete(rootValue);
     if ((!command.empty()) && (command.compare(DCAMERA_PROTOCOL_CMD_METADATA_RESULT) == 0)) {
-        HandleMetaDataResult(jsonStr);
+        HandleMetaDataResult(rootValue);
     } else if ((!command.empty()) && (command.compare(DCAMERA_PROTOCOL_CMD_STATE_NOTIFY) == 0)) {
         DCameraEventCmd cmd;
-        int32_t ret = cmd.Unmarshal(jsonStr);
+        int32_t ret = cmd.Unmarshal(rootValue);
         if (ret != DCAMERA_OK) {
             DHLOGE("DCameraSourceController Unmarshal failed, ret: %{public}d, devId: %{public}s, "
                 "dhId: %{public}s", ret, GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
-            return;
+        } else {
+            DCameraNotify(cmd.value_);
         }
-        DCameraNotify(cmd.value_);
     }
+    cJSON_Delete(rootValue);
 }
 
 void DCameraSourceController::HandleMetaDataResult(std::string& jsonStr)
 {
-    if (camHdiProvider_ == nullptr) {
-        DHLOGI("DCameraSourceController HandleMetaDataResult camHdiProvider is null, devId: %{public}s, "
-            "dhId: %{public}s", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+    cJSON *rootValue = cJSON_Parse(jsonStr.c_str());
+    if (rootValue == nullptr) {
+        DHLOGE("DCameraSourceController HandleMetaDataResult parse failed, dhId: %{public}s",
+            GetAnonyString(dhId_).c_str());
         return;
     }
+    HandleMetaDataResult(rootValue);
+    cJSON_Delete(rootValue);
+}
+
+void DCameraSourceController::HandleMetaDataResult(const cJSON *rootValue)
+{
     DCameraMetadataSettingCmd cmd;
-    int32_t ret = cmd.Unmarshal(jsonStr);
+    int32_t ret = cmd.Unmarshal(rootValue);
     if (ret != DCAMERA_OK) {
         DHLOGI("DCameraSourceController HandleMetaDataResult failed, ret: %{public}d, devId: %{public}s, "
             "dhId: %{public}s", ret, GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
         return;
     }
+    ReportMetaDataResult(cmd);
+}
+
+void DCameraSourceController::ReportMetaDataResult(DCameraMetadataSettingCmd& cmd)
+{
+    if (camHdiProvider_ == nullptr) {
+        DHLOGI("DCameraSourceController ReportMetaDataResult camHdiProvider is null, devId: %{public}s, "
+            "dhId: %{public}s", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+        return;
+    }
     DHBase dhBase;
     dhBase.deviceId_ = devId_;
     dhBase.dhId_ = dhId_;
+    if (camHdiProviderV1_2_ != nullptr) {
+        ReportMetaDataResults(dhBase, cmd);
+        return;
+    }
     for (auto iter = cmd.value_.begin(); iter != cmd.value_.end(); iter++) {
         DCameraSettings setting;
         setting.type_ = (*iter)->type_;
@@ -659,6 +764,30 @@ void DCameraSourceController::HandleMetaDataResult(std::string& jsonStr)
     }
 }
 
+void DCameraSourceController::ReportMetaDataResults(const DHBase& dhBase, DCameraMetadataSettingCmd& cmd)
+{
+    std::vector<OHOS::HDI::DistributedCamera::V1_2::DCameraSettingsResult> results;
+    results.reserve(std::min(cmd.value_.size(), SETTINGS_RESULTS_BATCH_SIZE));
+    for (size_t i = 0; i < cmd.value_.size(); i++) {
+        const std::shared_ptr<DCameraSettings> &setting = cmd.value_[i];
+        std::string value = setting == nullptr ? "" : Base64Decode(setting->value_);
+        if (!value.empty()) {
+            OHOS::HDI::DistributedCamera::V1_2::DCameraSettingsResult result;
+            result.sequence_ = ++resultSequence_;
+            result.type_ = setting->type_;
+            result.value_.assign(value.begin(), value.end());
+            results.push_back(std::move(result));
+        }
+        if (results.empty() || (results.size() < SETTINGS_RESULTS_BATCH_SIZE && i + 1 < cmd.value_.size())) {
+            continue;
+        }
+        int32_t retHdi = camHdiProviderV1_2_->OnSettingsResults(dhBase, results);
+        DHLOGD("OnSettingsResults hal, ret: %{public}d, size: %{public}zu, devId: %{public}s dhId: %{public}s",
+            retHdi, results.size(), GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+        results.clear();
+    }
+}
+
 int32_t DCameraSourceController::PublishEnableLatencyMsg(const std::string& devId)
 {
     DHLOGI("DCameraSourceController PublishEnableLatencyMsg Start,devId: %{public}s", GetAnonyString(devId_).c_str());
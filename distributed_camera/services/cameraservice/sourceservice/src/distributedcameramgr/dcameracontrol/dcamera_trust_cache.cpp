@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_trust_cache.h"
+
+#include "anonymous_string.h"
+#include "dcamera_utils_tools.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+DCameraTrustCache &DCameraTrustCache::GetInstance()
+{
+    static DCameraTrustCache instance;
+    return instance;
+}
+
+bool DCameraTrustCache::IsEnabled()
+{
+    int32_t enable = 0;
+    return GetSysPara(WARM_OPEN_PARA, enable) && (enable == 1);
+}
+
+bool DCameraTrustCache::GetAclGranted(const std::string &networkId, const std::string &aclKey)
+{
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    int64_t now = GetNowTimeStampMs();
+    for (auto &entry : entries_) {
+        if (entry.networkId != networkId) {
+            continue;
+        }
+        // The key carries the caller account and token, another caller has to pass its own check.
+        bool isGranted = entry.aclKey == aclKey && now < entry.aclExpireMs;
+        DHLOGI("warm acl lookup, devId: %{public}s, granted: %{public}d", GetAnonyString(networkId).c_str(),
+            isGranted);
+        return isGranted;
+    }
+    return false;
+}
+
+void DCameraTrustCache::PutAclGranted(const std::string &networkId, const std::string &aclKey)
+{
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    TrustEntry &entry = GetOrAddEntry(networkId);
+    entry.aclKey = aclKey;
+    entry.aclExpireMs = GetNowTimeStampMs() + TRUST_TTL_MS;
+}
+
+bool DCameraTrustCache::GetOsType(const std::string &networkId, bool &isInvalid)
+{
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    int64_t now = GetNowTimeStampMs();
+    for (auto &entry : entries_) {
+        if (entry.networkId == networkId) {
+            if (!entry.hasOsType || now >= entry.osTypeExpireMs) {
+                return false;
+            }
+            isInvalid = entry.isOsInvalid;
+            return true;
+        }
+    }
+    return false;
+}
+
+void DCameraTrustCache::PutOsType(const std::string &networkId, bool isInvalid)
+{
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    TrustEntry &entry = GetOrAddEntry(networkId);
+    entry.hasOsType = true;
+    entry.isOsInvalid = isInvalid;
+    entry.osTypeExpireMs = GetNowTimeStampMs() + TRUST_TTL_MS;
+}
+
+void DCameraTrustCache::Remove(const std::string &networkId)
+{
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    entries_.remove_if([&networkId](const TrustEntry &entry) { return entry.networkId == networkId; });
+}
+
+void DCameraTrustCache::Clear()
+{
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    entries_.clear();
+}
+
+DCameraTrustCache::TrustEntry &DCameraTrustCache::GetOrAddEntry(const std::string &networkId)
+{
+    for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+        if (iter->networkId == networkId) {
+            entries_.splice(entries_.begin(), entries_, iter);
+            return entries_.front();
+        }
+    }
+    TrustEntry entry;
+    entry.networkId = networkId;
+    entries_.push_front(entry);
+    if (entries_.size() > MAX_TRUST_ENTRIES) {
+        entries_.pop_back();
+    }
+    return entries_.front();
+}
+} // namespace DistributedHardware
+} // namespace OHOS
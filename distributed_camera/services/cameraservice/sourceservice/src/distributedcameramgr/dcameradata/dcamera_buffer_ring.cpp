@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_buffer_ring.h"
+
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "ashmem.h"
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+DCameraBufferRing::DCameraBufferRing(int32_t streamId, const GetBufferFunc& getBufferFunc,
+    const ShutterBufferFunc& shutterBufferFunc)
+    : streamId_(streamId), getBufferFunc_(getBufferFunc), shutterBufferFunc_(shutterBufferFunc)
+{
+}
+
+DCameraBufferRing::~DCameraBufferRing()
+{
+    Release();
+}
+
+int32_t DCameraBufferRing::Init(int32_t ringFd, int32_t eventFd)
+{
+    // The ring owns both fds from here on, also when they turn out to be unusable.
+    ringFd_ = ringFd;
+    eventFd_ = eventFd;
+    if (ringFd_ < 0 || eventFd_ < 0 || AshmemGetSize(ringFd_) < static_cast<int>(sizeof(DCameraRingLayout))) {
+        DHLOGE("buffer ring fd invalid, streamId: %{public}d", streamId_);
+        Release();
+        return DCAMERA_BAD_VALUE;
+    }
+    void *addr = mmap(nullptr, sizeof(DCameraRingLayout), PROT_READ | PROT_WRITE, MAP_SHARED, ringFd_, 0);
+    if (addr == MAP_FAILED) {
+        DHLOGE("buffer ring mmap failed errno %{public}s, streamId: %{public}d", strerror(errno), streamId_);
+        Release();
+        return DCAMERA_MEMORY_OPT_ERROR;
+    }
+    layout_ = static_cast<DCameraRingLayout *>(addr);
+    if (layout_->magic != DCAMERA_RING_MAGIC || layout_->version != DCAMERA_RING_VERSION) {
+        DHLOGE("buffer ring layout mismatch, streamId: %{public}d version: %{public}u", streamId_, layout_->version);
+        Release();
+        return DCAMERA_BAD_VALUE;
+    }
+    DHLOGI("buffer ring init success, streamId: %{public}d", streamId_);
+    return DCAMERA_OK;
+}
+
+void DCameraBufferRing::Release()
+{
+    UnmapAll();
+    if (layout_ != nullptr) {
+        munmap(layout_, sizeof(DCameraRingLayout));
+        layout_ = nullptr;
+    }
+    if (eventFd_ >= 0) {
+        close(eventFd_);
+        eventFd_ = -1;
+    }
+    if (ringFd_ >= 0) {
+        close(ringFd_);
+        ringFd_ = -1;
+    }
+}
+
+uint8_t *DCameraBufferRing::AcquireBuffer(size_t capacity, DCameraBuffer& buffer)
+{
+    DCameraRingEntry entry;
+    if (layout_ == nullptr || !PopFree(entry)) {
+        return nullptr;
+    }
+    buffer.index_ = entry.index;
+    buffer.size_ = entry.size;
+    buffer.bufferHandle_ = nullptr;
+    uint8_t *virAddr = nullptr;
+    if (entry.size >= 0 && capacity <= static_cast<size_t>(entry.size)) {
+        virAddr = MapBuffer(entry);
+    }
+    if (virAddr == nullptr) {
+        DHLOGD("ring buffer unusable, streamId: %{public}d index: %{public}d", streamId_, entry.index);
+        buffer.size_ = 0;
+        ShutterBuffer(buffer);
+        return nullptr;
+    }
+    return virAddr;
+}
+
+int32_t DCameraBufferRing::ShutterBuffer(const DCameraBuffer& buffer, int64_t captureTimeUs)
+{
+    if (layout_ == nullptr) {
+        return DCAMERA_BAD_OPERATE;
+    }
+    UnrefMapping(buffer.index_);
+    if (!PushFilled(buffer, captureTimeUs)) {
+        // The slot stays acquired by the driver until it comes back, so it must not be dropped here.
+        DHLOGE("buffer ring filled queue full, return through provider, streamId: %{public}d", streamId_);
+        return (shutterBufferFunc_ == nullptr) ? DCAMERA_BAD_OPERATE : shutterBufferFunc_(buffer);
+    }
+    uint64_t value = 1;
+    if (write(eventFd_, &value, sizeof(value)) < 0) {
+        DHLOGE("buffer ring signal failed errno %{public}s, streamId: %{public}d", strerror(errno), streamId_);
+    }
+    return DCAMERA_OK;
+}
+
+bool DCameraBufferRing::PushFilled(const DCameraBuffer& buffer, int64_t captureTimeUs)
+{
+    std::lock_guard<std::mutex> autoLock(filledMutex_);
+    DCameraRingQueue& queue = layout_->filledQueue;
+    uint32_t tail = queue.tail.load(std::memory_order_relaxed);
+    if (tail - queue.head.load(std::memory_order_acquire) >= DCAMERA_RING_CAPACITY) {
+        return false;
+    }
+    DCameraRingEntry& entry = queue.entries[tail % DCAMERA_RING_CAPACITY];
+    entry.index = buffer.index_;
+    entry.size = buffer.size_;
+    entry.seqNum = 0;
+    entry.reserved = 0;
+    entry.captureTimeUs = captureTimeUs;
+    queue.tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool DCameraBufferRing::PopFree(DCameraRingEntry& entry)
+{
+    // The driver reclaims from this queue when a capture stops, the slot is read before the head is claimed.
+    DCameraRingQueue& queue = layout_->freeQueue;
+    uint32_t head = queue.head.load(std::memory_order_acquire);
+    while (true) {
+        uint32_t tail = queue.tail.load(std::memory_order_acquire);
+        if (head == tail || tail - head > DCAMERA_RING_CAPACITY) {
+            return false;
+        }
+        entry = queue.entries[head % DCAMERA_RING_CAPACITY];
+        if (queue.head.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel)) {
+            return true;
+        }
+    }
+}
+
+uint8_t *DCameraBufferRing::MapBuffer(const DCameraRingEntry& entry)
+{
+    // Without a sequence number a mapping cannot be matched again, such buffers take the call per frame path.
+    if (entry.seqNum == 0) {
+        return nullptr;
+    }
+    {
+        std::lock_guard<std::mutex> autoLock(mappedMutex_);
+        auto iter = mappedBuffers_.find(entry.seqNum);
+        if (iter != mappedBuffers_.end()) {
+            iter->second.refCount++;
+            outBufferSeqNums_[entry.index] = entry.seqNum;
+            return static_cast<uint8_t *>(iter->second.virAddr);
+        }
+    }
+    DCameraBuffer buffer;
+    if (getBufferFunc_ == nullptr || getBufferFunc_(entry.index, buffer) != DCAMERA_OK ||
+        buffer.bufferHandle_ == nullptr || buffer.bufferHandle_->GetBufferHandle() == nullptr) {
+        DHLOGE("get ring buffer handle failed, streamId: %{public}d index: %{public}d", streamId_, entry.index);
+        return nullptr;
+    }
+    BufferHandle *handle = buffer.bufferHandle_->GetBufferHandle();
+    if (handle->fd < 0 || handle->size < entry.size) {
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(handle->size);
+    void *virAddr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, handle->fd, 0);
+    if (virAddr == MAP_FAILED) {
+        DHLOGE("ring buffer mmap failed errno %{public}s, streamId: %{public}d", strerror(errno), streamId_);
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> autoLock(mappedMutex_);
+    auto iter = mappedBuffers_.find(entry.seqNum);
+    if (iter != mappedBuffers_.end()) {
+        munmap(virAddr, size);
+        virAddr = iter->second.virAddr;
+        iter->second.refCount++;
+    } else {
+        if (mappedBuffers_.size() >= MAX_MAPPED_BUFFERS) {
+            EvictIdleLocked();
+        }
+        if (mappedBuffers_.size() >= MAX_MAPPED_BUFFERS) {
+            DHLOGE("ring map cache full of buffers in flight, streamId: %{public}d", streamId_);
+            munmap(virAddr, size);
+            return nullptr;
+        }
+        mappedBuffers_[entry.seqNum] = { virAddr, size, 1 };
+    }
+    outBufferSeqNums_[entry.index] = entry.seqNum;
+    return static_cast<uint8_t *>(virAddr);
+}
+
+void DCameraBufferRing::UnrefMapping(int32_t index)
+{
+    std::lock_guard<std::mutex> autoLock(mappedMutex_);
+    auto seqIter = outBufferSeqNums_.find(index);
+    if (seqIter == outBufferSeqNums_.end()) {
+        return;
+    }
+    auto iter = mappedBuffers_.find(seqIter->second);
+    if (iter != mappedBuffers_.end() && iter->second.refCount > 0) {
+        iter->second.refCount--;
+    }
+    outBufferSeqNums_.erase(seqIter);
+}
+
+void DCameraBufferRing::EvictIdleLocked()
+{
+    size_t count = mappedBuffers_.size();
+    for (auto iter = mappedBuffers_.begin(); iter != mappedBuffers_.end();) {
+        if (iter->second.refCount > 0) {
+            ++iter;
+            continue;
+        }
+        munmap(iter->second.virAddr, iter->second.size);
+        iter = mappedBuffers_.erase(iter);
+    }
+    DHLOGI("ring map cache full, drop %{public}zu idle mapped buffers", count - mappedBuffers_.size());
+}
+
+void DCameraBufferRing::UnmapAll()
+{
+    std::lock_guard<std::mutex> autoLock(mappedMutex_);
+    for (auto& item : mappedBuffers_) {
+        if (munmap(item.second.virAddr, item.second.size) != 0) {
+            DHLOGE("ring buffer munmap failed err: %{public}s", strerror(errno));
+        }
+    }
+    mappedBuffers_.clear();
+    outBufferSeqNums_.clear();
+}
+} // namespace DistributedHardware
+} // namespace OHOS
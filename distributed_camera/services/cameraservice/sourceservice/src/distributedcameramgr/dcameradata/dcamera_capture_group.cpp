@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_capture_group.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "anonymous_string.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraCaptureGroupManager);
+
+void DCameraCaptureGroup::Join(const std::string& memberKey, int64_t nowUs)
+{
+    std::lock_guard<std::mutex> lock(memberMutex_);
+    Member& member = members_[memberKey];
+    member.captureTimeUs = 0;
+    member.offerUs = nowUs;
+}
+
+void DCameraCaptureGroup::Leave(const std::string& memberKey)
+{
+    std::lock_guard<std::mutex> lock(memberMutex_);
+    members_.erase(memberKey);
+    DHLOGI("capture group %{public}s member left, members: %{public}zu aligned: %{public}" PRIu64 " expired: "
+        "%{public}" PRIu64, groupId_.c_str(), members_.size(), stats_.aligned, stats_.expired);
+}
+
+size_t DCameraCaptureGroup::GetMemberCount()
+{
+    std::lock_guard<std::mutex> lock(memberMutex_);
+    return members_.size();
+}
+
+int64_t DCameraCaptureGroup::Align(const std::string& memberKey, int64_t captureTimeUs, int64_t nowUs)
+{
+    std::lock_guard<std::mutex> lock(memberMutex_);
+    auto selfIter = members_.find(memberKey);
+    if (selfIter == members_.end()) {
+        return 0;
+    }
+    Member& self = selfIter->second;
+    if (captureTimeUs != self.captureTimeUs) {
+        self.captureTimeUs = captureTimeUs;
+        self.offerUs = nowUs;
+    }
+    bool isAhead = false;
+    for (auto iter = members_.begin(); iter != members_.end() && !isAhead; iter++) {
+        if (iter == selfIter || nowUs - iter->second.offerUs > LATENCY_BUDGET_US) {
+            continue;
+        }
+        isAhead = iter->second.captureTimeUs < captureTimeUs - ALIGN_TOLERANCE_US;
+    }
+    if (!isAhead) {
+        stats_.aligned++;
+        return 0;
+    }
+    int64_t heldUs = nowUs - self.offerUs;
+    if (heldUs >= LATENCY_BUDGET_US) {
+        stats_.expired++;
+        return 0;
+    }
+    return std::min(POLL_INTERVAL_US, LATENCY_BUDGET_US - heldUs);
+}
+
+DCameraCaptureGroupStats DCameraCaptureGroup::GetStats()
+{
+    std::lock_guard<std::mutex> lock(memberMutex_);
+    return stats_;
+}
+
+void DCameraCaptureGroup::Dump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(memberMutex_);
+    result.append("Group: ").append(groupId_)
+        .append(" members: ").append(std::to_string(members_.size()))
+        .append(" aligned: ").append(std::to_string(stats_.aligned))
+        .append(" expired: ").append(std::to_string(stats_.expired))
+        .append("\n");
+}
+
+void DCameraCaptureGroupManager::Bind(const std::string& groupId, const std::string& devId,
+    const std::string& dhId)
+{
+    Unbind(devId, dhId);
+    std::lock_guard<std::mutex> lock(groupMutex_);
+    std::shared_ptr<DCameraCaptureGroup>& group = groups_[groupId];
+    if (group == nullptr) {
+        group = std::make_shared<DCameraCaptureGroup>(groupId);
+    }
+    cameraGroups_[GetCameraKey(devId, dhId)] = groupId;
+    DHLOGI("bind devId %{public}s dhId %{public}s to capture group %{public}s", GetAnonyString(devId).c_str(),
+        GetAnonyString(dhId).c_str(), groupId.c_str());
+}
+
+void DCameraCaptureGroupManager::Unbind(const std::string& devId, const std::string& dhId)
+{
+    std::lock_guard<std::mutex> lock(groupMutex_);
+    auto cameraIter = cameraGroups_.find(GetCameraKey(devId, dhId));
+    if (cameraIter == cameraGroups_.end()) {
+        return;
+    }
+    std::string groupId = cameraIter->second;
+    cameraGroups_.erase(cameraIter);
+    bool isBound = std::any_of(cameraGroups_.begin(), cameraGroups_.end(),
+        [&groupId](const auto& camera) { return camera.second == groupId; });
+    if (!isBound) {
+        // Running members keep their own reference until they stop.
+        groups_.erase(groupId);
+    }
+}
+
+std::shared_ptr<DCameraCaptureGroup> DCameraCaptureGroupManager::Find(const std::string& devId,
+    const std::string& dhId)
+{
+    std::lock_guard<std::mutex> lock(groupMutex_);
+    auto cameraIter = cameraGroups_.find(GetCameraKey(devId, dhId));
+    if (cameraIter == cameraGroups_.end()) {
+        return nullptr;
+    }
+    auto groupIter = groups_.find(cameraIter->second);
+    return (groupIter == groups_.end()) ? nullptr : groupIter->second;
+}
+
+void DCameraCaptureGroupManager::Dump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(groupMutex_);
+    if (groups_.empty()) {
+        result.append("No capture group bound\n");
+        return;
+    }
+    for (const auto& group : groups_) {
+        group.second->Dump(result);
+    }
+}
+
+std::string DCameraCaptureGroupManager::GetCameraKey(const std::string& devId, const std::string& dhId)
+{
+    return devId + "#" + dhId;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
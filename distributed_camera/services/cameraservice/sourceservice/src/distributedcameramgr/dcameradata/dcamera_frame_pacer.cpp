@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_frame_pacer.h"
+
+#include <algorithm>
+
+#include "distributed_camera_constants.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int64_t US_PER_SECOND = 1000000;
+}
+
+void DCameraFramePacer::SetFrameRate(int32_t fps)
+{
+    nominalIntervalUs_.store(fps > 0 ? US_PER_SECOND / fps : 0);
+}
+
+int64_t DCameraFramePacer::GetFrameIntervalUs() const
+{
+    int64_t measuredUs = measuredIntervalUs_.load();
+    if (measuredUs > 0) {
+        return measuredUs;
+    }
+    int64_t nominalUs = nominalIntervalUs_.load();
+    return nominalUs > 0 ? nominalUs : US_PER_SECOND / DCAMERA_PRODUCER_FPS_DEFAULT;
+}
+
+int64_t DCameraFramePacer::Schedule(int64_t ptsUs, int64_t nowUs)
+{
+    if (!isAnchored_) {
+        Rebase(ptsUs, nowUs);
+        return 0;
+    }
+    int64_t intervalUs = GetFrameIntervalUs();
+    int64_t deltaUs = ptsUs - lastPtsUs_;
+    if (released_.load() > 0 && (deltaUs <= 0 || deltaUs > MAX_PTS_GAP_US)) {
+        // The pts restarted or jumped, the frame follows the last one by one interval instead.
+        offsetUs_ = lastDueUs_ + intervalUs - ptsUs;
+    }
+    int64_t dueUs = ptsUs + offsetUs_;
+    if (nowUs - dueUs > intervalUs) {
+        // More than a frame behind, restart the timeline here rather than rushing the backlog out.
+        late_++;
+        Rebase(ptsUs, nowUs);
+        return 0;
+    }
+    int64_t waitUs = dueUs - nowUs;
+    if (waitUs > EARLY_TOLERANCE_US) {
+        OnEarly(ptsUs);
+        return std::min(waitUs, MAX_HOLD_US);
+    }
+    return 0;
+}
+
+void DCameraFramePacer::Rebase(int64_t ptsUs, int64_t nowUs)
+{
+    isAnchored_ = true;
+    offsetUs_ = nowUs - ptsUs;
+}
+
+void DCameraFramePacer::OnReleased(int64_t ptsUs)
+{
+    int64_t deltaUs = ptsUs - lastPtsUs_;
+    if (released_.load() > 0 && deltaUs > 0 && deltaUs <= MAX_PTS_GAP_US) {
+        int64_t measuredUs = measuredIntervalUs_.load();
+        measuredUs = (measuredUs == 0) ? deltaUs : measuredUs + ((deltaUs - measuredUs) >> INTERVAL_SMOOTH_SHIFT);
+        measuredIntervalUs_.store(measuredUs);
+    }
+    lastPtsUs_ = ptsUs;
+    lastDueUs_ = ptsUs + offsetUs_;
+    released_++;
+}
+
+void DCameraFramePacer::OnEarly(int64_t ptsUs)
+{
+    // A held frame is scheduled again after every wait, count it once.
+    if (ptsUs != earlyPtsUs_) {
+        earlyPtsUs_ = ptsUs;
+        early_++;
+    }
+}
+
+void DCameraFramePacer::OnLate()
+{
+    late_++;
+}
+
+void DCameraFramePacer::OnDropped()
+{
+    dropped_++;
+}
+
+void DCameraFramePacer::Reset()
+{
+    measuredIntervalUs_.store(0);
+    isAnchored_ = false;
+    offsetUs_ = 0;
+    lastPtsUs_ = 0;
+    lastDueUs_ = 0;
+    earlyPtsUs_ = -1;
+    released_.store(0);
+    early_.store(0);
+    late_.store(0);
+    dropped_.store(0);
+}
+
+DCameraFramePacerStats DCameraFramePacer::GetStats() const
+{
+    DCameraFramePacerStats stats;
+    stats.released = released_.load();
+    stats.early = early_.load();
+    stats.late = late_.load();
+    stats.dropped = dropped_.load();
+    return stats;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
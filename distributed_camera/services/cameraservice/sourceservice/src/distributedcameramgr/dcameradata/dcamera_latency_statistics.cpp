@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_latency_statistics.h"
+
+#include <algorithm>
+
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraLatencyStatistics);
+
+namespace {
+constexpr uint32_t PERCENT = 100;
+constexpr uint32_t PERCENTILE_P50 = 50;
+constexpr uint32_t PERCENTILE_P90 = 90;
+constexpr uint32_t PERCENTILE_P99 = 99;
+constexpr uint32_t UINT64_TOP_BIT = 63;
+constexpr size_t STAGE_NAME_TAB_WIDTH = 8;
+
+const std::array<std::string, DCAMERA_LATENCY_STAGE_COUNT> STAGE_NAMES = {
+    "encode", "trans", "decode", "decode2Scale", "scale", "recv2Feed", "smooth", "glass2Glass",
+};
+}
+
+void DCameraLatencyHistogram::Record(int64_t valueUs)
+{
+    // Sink and source clocks are only corrected down to the sync error, a slightly negative delta is zero.
+    uint64_t value = static_cast<uint64_t>(std::max<int64_t>(valueUs, 0));
+    buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    int64_t max = max_.load(std::memory_order_relaxed);
+    while (static_cast<int64_t>(value) > max &&
+        !max_.compare_exchange_weak(max, static_cast<int64_t>(value), std::memory_order_relaxed)) {
+    }
+}
+
+void DCameraLatencyHistogram::Reset()
+{
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t DCameraLatencyHistogram::GetCount() const
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+int64_t DCameraLatencyHistogram::GetMax() const
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+int64_t DCameraLatencyHistogram::GetPercentile(uint32_t percentile) const
+{
+    // The buckets are summed again instead of trusting count_, frames recorded meanwhile may be in either.
+    std::array<uint32_t, BUCKET_COUNT> counts;
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    uint64_t rank = (total * std::min(percentile, PERCENT) + PERCENT - 1) / PERCENT;
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return std::min(static_cast<int64_t>(BucketUpperBound(i)), GetMax());
+        }
+    }
+    return GetMax();
+}
+
+size_t DCameraLatencyHistogram::BucketIndex(uint64_t valueUs)
+{
+    if (valueUs < LINEAR_COUNT) {
+        return static_cast<size_t>(valueUs);
+    }
+    uint32_t msb = static_cast<uint32_t>(UINT64_TOP_BIT - __builtin_clzll(valueUs));
+    if (msb >= MAX_VALUE_BITS) {
+        return BUCKET_COUNT - 1;
+    }
+    uint32_t shift = msb - SUB_BUCKET_BITS;
+    uint64_t subBucket = (valueUs >> shift) - SUB_BUCKET_COUNT;
+    return static_cast<size_t>(LINEAR_COUNT + (shift - 1) * SUB_BUCKET_COUNT + subBucket);
+}
+
+uint64_t DCameraLatencyHistogram::BucketUpperBound(size_t index)
+{
+    if (index < LINEAR_COUNT) {
+        return index;
+    }
+    uint64_t offset = index - LINEAR_COUNT;
+    uint64_t shift = offset / SUB_BUCKET_COUNT + 1;
+    uint64_t top = offset % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+    return ((top + 1) << shift) - 1;
+}
+
+void DCameraStreamLatency::Record(const DCameraFrameInfo& frameInfo)
+{
+    const DCameraFrameProcessTimePoint& point = frameInfo.timePonit;
+    // The sink stamps with its own clock, offset is what the time sync measured between both ends.
+    int64_t offset = static_cast<int64_t>(frameInfo.offset);
+    RecordStage(DCAMERA_LATENCY_ENCODE, point.startEncode, point.finishEncode);
+    RecordStage(DCAMERA_LATENCY_TRANS, point.send, (point.recv == 0) ? 0 : point.recv + offset);
+    RecordStage(DCAMERA_LATENCY_DECODE, point.startDecode, point.finishDecode);
+    RecordStage(DCAMERA_LATENCY_DECODE_TO_SCALE, point.finishDecode, point.startScale);
+    RecordStage(DCAMERA_LATENCY_SCALE, point.startScale, point.finishScale);
+    RecordStage(DCAMERA_LATENCY_RECV_TO_FEED, point.recv, point.startSmooth);
+    RecordStage(DCAMERA_LATENCY_SMOOTH, point.startSmooth, point.finishSmooth);
+    RecordStage(DCAMERA_LATENCY_GLASS_TO_GLASS, point.startEncode,
+        (point.finishSmooth == 0) ? 0 : point.finishSmooth + offset);
+}
+
+void DCameraStreamLatency::RecordStage(DCameraLatencyStage stage, int64_t startUs, int64_t finishUs)
+{
+    // A node that did not run leaves its time points at zero, such frames say nothing about the stage.
+    if (startUs == 0 || finishUs == 0) {
+        return;
+    }
+    stages_[stage].Record(finishUs - startUs);
+}
+
+void DCameraStreamLatency::Reset()
+{
+    for (auto& stage : stages_) {
+        stage.Reset();
+    }
+}
+
+void DCameraStreamLatency::Dump(std::string& result) const
+{
+    result.append("Stage\t\tCount\tP50(us)\tP90(us)\tP99(us)\tMax(us)\n");
+    for (size_t i = 0; i < DCAMERA_LATENCY_STAGE_COUNT; i++) {
+        const DCameraLatencyHistogram& stage = stages_[i];
+        result.append(STAGE_NAMES[i])
+              .append(STAGE_NAMES[i].size() < STAGE_NAME_TAB_WIDTH ? "\t\t" : "\t")
+              .append(std::to_string(stage.GetCount()))
+              .append("\t")
+              .append(std::to_string(stage.GetPercentile(PERCENTILE_P50)))
+              .append("\t")
+              .append(std::to_string(stage.GetPercentile(PERCENTILE_P90)))
+              .append("\t")
+              .append(std::to_string(stage.GetPercentile(PERCENTILE_P99)))
+              .append("\t")
+              .append(std::to_string(stage.GetMax()))
+              .append("\n");
+    }
+}
+
+std::shared_ptr<DCameraStreamLatency> DCameraLatencyStatistics::Acquire(const std::string& streamKey)
+{
+    std::lock_guard<std::mutex> lock(streamMutex_);
+    std::shared_ptr<DCameraStreamLatency>& latency = streams_[streamKey];
+    if (latency == nullptr) {
+        latency = std::make_shared<DCameraStreamLatency>();
+    }
+    return latency;
+}
+
+void DCameraLatencyStatistics::Dump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(streamMutex_);
+    if (streams_.empty()) {
+        result.append("No stream latency recorded\n");
+        return;
+    }
+    for (const auto& stream : streams_) {
+        result.append("Stream: ").append(stream.first).append("\n");
+        stream.second->Dump(result);
+    }
+}
+
+void DCameraLatencyStatistics::Reset()
+{
+    std::lock_guard<std::mutex> lock(streamMutex_);
+    for (auto iter = streams_.begin(); iter != streams_.end();) {
+        if (iter->second.use_count() == 1) {
+            iter = streams_.erase(iter);
+            continue;
+        }
+        iter->second->Reset();
+        iter++;
+    }
+    DHLOGI("Reset stream latency, %{public}zu streams kept", streams_.size());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,9 +17,11 @@
 
 #include "anonymous_string.h"
 #include "dcamera_hitrace_adapter.h"
+#include "dcamera_utils_tools.h"
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
+#include "metadata_utils.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -66,6 +68,16 @@ int32_t DCameraSourceDataProcess::FeedStream(std::vector<std::shared_ptr<DataBuf
     return DCAMERA_OK;
 }
 
+std::shared_ptr<DataBuffer> DCameraSourceDataProcess::AcquireRecvBuffer(size_t capacity)
+{
+    std::unique_lock<std::mutex> autoLock(streamMutex_, std::try_to_lock);
+    // A frame fanned out to several pipelines can not live in one decoder's input memory.
+    if (!autoLock.owns_lock() || streamProcess_.size() != 1 || streamProcess_[0] == nullptr) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return streamProcess_[0]->AcquireRecvBuffer(capacity);
+}
+
 int32_t DCameraSourceDataProcess::ConfigStreams(std::vector<std::shared_ptr<DCStreamInfo>>& streamInfos)
 {
     uint64_t infoSize = static_cast<uint64_t>(streamInfos.size());
@@ -111,8 +123,13 @@ int32_t DCameraSourceDataProcess::ConfigStreams(std::vector<std::shared_ptr<DCSt
             iter->first.dataspace_, iter->first.encodeType_, iter->first.type_);
         streamProcess->ConfigStreams(streamConfig, iter->second);
 
+        std::lock_guard<std::mutex> autoLock(streamMutex_);
         streamProcess_.push_back(streamProcess);
     }
+    {
+        std::lock_guard<std::mutex> autoLock(streamMutex_);
+        UpdateDecodeSource();
+    }
 
     return DCAMERA_OK;
 }
@@ -134,6 +151,7 @@ int32_t DCameraSourceDataProcess::ReleaseStreams(std::vector<int32_t>& streamIds
             iter++;
         }
     }
+    UpdateDecodeSource();
 
     std::string strStreams;
     for (auto iterSet = streamIdSet.begin(); iterSet != streamIdSet.end(); iterSet++) {
@@ -161,6 +179,7 @@ int32_t DCameraSourceDataProcess::StartCapture(std::shared_ptr<DCCaptureInfo>& c
     std::shared_ptr<DCameraStreamConfig> streamConfig =
         std::make_shared<DCameraStreamConfig>(captureInfo->width_, captureInfo->height_, captureInfo->format_,
         captureInfo->dataspace_, captureInfo->encodeType_, captureInfo->type_);
+    streamConfig->frameRate_ = GetCaptureFrameRate(captureInfo);
     std::set<int32_t> streamIds(captureInfo->streamIds_.begin(), captureInfo->streamIds_.end());
     for (auto iterSet = streamIds.begin(); iterSet != streamIds.end(); iterSet++) {
         DHLOGI("DCameraSourceDataProcess StartCapture devId %{public}s dhId %{public}s StartCapture id: %{public}d",
@@ -190,6 +209,40 @@ int32_t DCameraSourceDataProcess::StopCapture(std::vector<int32_t>& streamIds)
     return DCAMERA_OK;
 }
 
+int32_t DCameraSourceDataProcess::GetCaptureFrameRate(const std::shared_ptr<DCCaptureInfo>& captureInfo)
+{
+    int32_t frameRate = 0;
+    for (const auto& setting : captureInfo->captureSettings_) {
+        if (setting.type_ != UPDATE_METADATA) {
+            continue;
+        }
+        std::shared_ptr<Camera::CameraMetadata> metadata =
+            Camera::MetadataUtils::DecodeFromString(Base64Decode(setting.value_));
+        if (metadata == nullptr) {
+            continue;
+        }
+        camera_metadata_item_t item;
+        int32_t ret = Camera::FindCameraMetadataItem(metadata->get(), OHOS_CONTROL_FPS_RANGES, &item);
+        // The range is {min, max}, the later setting wins.
+        if (ret == CAM_META_SUCCESS && item.count > 1) {
+            frameRate = item.data.i32[1];
+        }
+    }
+    return frameRate;
+}
+
+void DCameraSourceDataProcess::UpdateDecodeSource()
+{
+    // Every continuous stream gets the same bitstream, the first one decodes it and the others scale its frames.
+    if (streamType_ != CONTINUOUS_FRAME || streamProcess_.empty()) {
+        return;
+    }
+    std::shared_ptr<DCameraStreamDataProcess> decodeSource = streamProcess_.front();
+    for (auto iter = streamProcess_.begin(); iter != streamProcess_.end(); iter++) {
+        (*iter)->SetDecodeSource((*iter == decodeSource) ? nullptr : decodeSource);
+    }
+}
+
 void DCameraSourceDataProcess::DestroyPipeline()
 {
     DHLOGI("DCameraSourceDataProcess DestroyPipeline devId %{public}s dhId %{public}s streamType: %{public}d",
@@ -235,6 +288,7 @@ int32_t DCameraSourceDataProcess::UpdateProducerWorkMode(std::vector<int32_t>& s
 int32_t DCameraSourceDataProcess::UpdateSettings(const std::vector<std::shared_ptr<DCameraSettings>>& settings)
 {
     DHLOGI("DCameraSourceDataProcess UpdateSettings");
+    std::lock_guard<std::mutex> autoLock(streamMutex_);
     for (auto iter = streamProcess_.begin(); iter !=  streamProcess_.end(); iter++) {
         (*iter)->UpdateSettings(settings);
     }
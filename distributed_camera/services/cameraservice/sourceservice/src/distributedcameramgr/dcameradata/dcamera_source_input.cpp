@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -22,6 +22,7 @@
 #include "dcamera_source_input.h"
 #include "dcamera_source_input_channel_listener.h"
 #include "dcamera_softbus_latency.h"
+#include "dcamera_utils_tools.h"
 #include "distributed_camera_constants.h"
 #include "distributed_hardware_log.h"
 
@@ -190,31 +191,26 @@ int32_t DCameraSourceInput::StopCapture(std::vector<int>& streamIds, bool& isAll
     return DCAMERA_OK;
 }
 
-int32_t DCameraSourceInput::WaitForOpenChannelCompletion(bool needWait)
+int32_t DCameraSourceInput::WaitForOpenChannelCompletion(std::future<int32_t>& continuousResult,
+    int32_t snapshotRet)
 {
-    DHLOGI("openChannel needWait: %{public}s", needWait ? "true" : "false");
-    if (needWait) {
-        std::unique_lock<std::mutex> lock(isOpenChannelMtx_);
-        bool timeOut = !isOpenChannelCond_.wait_for(lock, TIMEOUT_3_SEC, [this] {
-            return isOpenChannelFinished_.load();
-        });
-        if (timeOut) {
-            DHLOGE("openChannel timed out after 3 seconds.");
-            continuousFrameResult_.store(DCAMERA_BAD_VALUE);
+    int32_t continuousRet = DCAMERA_OK;
+    if (continuousResult.valid()) {
+        if (continuousResult.wait_for(TIMEOUT_3_SEC) == std::future_status::ready) {
+            continuousRet = continuousResult.get();
+        } else {
+            DHLOGE("openChannel continuous frame timed out after 3 seconds.");
+            continuousRet = DCAMERA_BAD_VALUE;
         }
     }
-    DHLOGI("DCameraSourceInput OpenChannel finish devId %{public}s dhId %{public}s continue "
-        "state: %{public}d, snapshot state: %{public}d", GetAnonyString(devId_).c_str(),
-        GetAnonyString(dhId_).c_str(), channelState_[CONTINUOUS_FRAME], channelState_[SNAPSHOT_FRAME]);
-    const int32_t contRet = continuousFrameResult_.load();
-    if (contRet != DCAMERA_OK) {
-        return contRet;
+    DHLOGI("DCameraSourceInput OpenChannel finish devId %{public}s dhId %{public}s continue ret: %{public}d, "
+        "state: %{public}d, snapshot ret: %{public}d, state: %{public}d", GetAnonyString(devId_).c_str(),
+        GetAnonyString(dhId_).c_str(), continuousRet, channelState_[CONTINUOUS_FRAME], snapshotRet,
+        channelState_[SNAPSHOT_FRAME]);
+    if (continuousRet != DCAMERA_OK) {
+        return continuousRet;
     }
-    const int32_t snapRet = snapshotFrameResult_.load();
-    if (snapRet != DCAMERA_OK) {
-        return snapRet;
-    }
-    return DCAMERA_OK;
+    return snapshotRet;
 }
 
 int32_t DCameraSourceInput::OpenChannel(std::vector<DCameraIndex>& indexs)
@@ -222,45 +218,42 @@ int32_t DCameraSourceInput::OpenChannel(std::vector<DCameraIndex>& indexs)
     DHLOGI("DCameraSourceInput OpenChannel devId %{public}s dhId %{public}s continue state: %{public}d, snapshot "
         "state: %{public}d", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(),
         channelState_[CONTINUOUS_FRAME], channelState_[SNAPSHOT_FRAME]);
-    bool needWait = false;
-    isOpenChannelFinished_.store(false);
     const bool continuousNeeded = (channelState_[CONTINUOUS_FRAME] == DCAMERA_CHANNEL_STATE_DISCONNECTED);
     const bool snapshotNeeded = (channelState_[SNAPSHOT_FRAME] == DCAMERA_CHANNEL_STATE_DISCONNECTED);
-    continuousFrameResult_.store(DCAMERA_OK);
-    snapshotFrameResult_.store(DCAMERA_OK);
+    std::future<int32_t> continuousResult;
     if (continuousNeeded) {
-        needWait = true;
+        CHECK_AND_RETURN_RET_LOG(channelQueue_ == nullptr, DCAMERA_BAD_VALUE,
+            "DCameraSourceInput OpenChannel channel queue is nullptr");
         DHLOGI("openChannel starting continuous frame session establishment");
-        auto task = [&]() {
+        // The task owns its copy of the indexes and its promise, it may still run after a timed out wait returned.
+        auto promise = std::make_shared<std::promise<int32_t>>();
+        continuousResult = promise->get_future();
+        auto task = [this, indexs, promise]() mutable {
             DHLOGI("openChannel continuous frame task started");
             int32_t ret = EstablishContinuousFrameSession(indexs);
-            continuousFrameResult_.store(ret);
             if (ret != DCAMERA_OK) {
                 DHLOGE("esdablish continuous frame failed ret: %{public}d, devId: %{public}s, dhId: %{public}s", ret,
                     GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
             }
-            {
-                std::unique_lock<std::mutex> lock(isOpenChannelMtx_);
-                isOpenChannelFinished_.store(true);
-            }
-            isOpenChannelCond_.notify_one();
+            promise->set_value(ret);
             DHLOGI("openChannel continuous frame task completed");
         };
-        CHECK_AND_RETURN_RET_LOG(handler_ == nullptr, DCAMERA_BAD_VALUE,
-            "DCameraSourceInput OpenChannel handler is nullptr");
-        handler_->PostTask(task, "DCameraSourceInput:OpenChannel", 0, AppExecFwk::EventQueue::Priority::HIGH);
+        if (!channelQueue_->PostTask(task)) {
+            DHLOGE("openChannel post continuous frame task failed, establish it inline");
+            task();
+        }
     }
+    int32_t snapshotRet = DCAMERA_OK;
     if (snapshotNeeded) {
         DHLOGI("openChannel starting snapshot frame session establishment");
-        int32_t ret = EstablishSnapshotFrameSession(indexs);
-        snapshotFrameResult_.store(ret);
-        if (ret != DCAMERA_OK) {
+        snapshotRet = EstablishSnapshotFrameSession(indexs);
+        if (snapshotRet != DCAMERA_OK) {
             DHLOGE("esdablish snapshot frame failed ret: %{public}d,"
-                "devId: %{public}s, dhId: %{public}s", ret, GetAnonyString(devId_).c_str(),
+                "devId: %{public}s, dhId: %{public}s", snapshotRet, GetAnonyString(devId_).c_str(),
                 GetAnonyString(dhId_).c_str());
         }
     }
-    return WaitForOpenChannelCompletion(needWait);
+    return WaitForOpenChannelCompletion(continuousResult, snapshotRet);
 }
 
 int32_t DCameraSourceInput::CloseChannel()
@@ -404,6 +397,9 @@ void DCameraSourceInput::OnDataReceived(DCStreamType streamType, std::vector<std
     CHECK_AND_RETURN_LOG(buffers[0] == nullptr, "the first buffer is nullptr.");
     CHECK_AND_RETURN_LOG(dataProcess_[streamType] == nullptr, "dataProcess_ is nullptr.");
     buffers[0]->frameInfo_.offset = DCameraSoftbusLatency::GetInstance().GetTimeSyncInfo(devId_);
+    if (streamType == CONTINUOUS_FRAME) {
+        CheckFrameLoss(buffers[0]);
+    }
     int32_t ret = dataProcess_[streamType]->FeedStream(buffers);
     if (ret != DCAMERA_OK) {
         DHLOGE("OnDataReceived FeedStream %{public}d stream failed ret: %{public}d, devId: %{public}s, "
@@ -411,6 +407,15 @@ void DCameraSourceInput::OnDataReceived(DCStreamType streamType, std::vector<std
     }
 }
 
+std::shared_ptr<DataBuffer> DCameraSourceInput::AcquireRecvBuffer(DCStreamType streamType, size_t capacity)
+{
+    auto iter = dataProcess_.find(streamType);
+    if (iter == dataProcess_.end() || iter->second == nullptr) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return iter->second->AcquireRecvBuffer(capacity);
+}
+
 int32_t DCameraSourceInput::ReleaseAllStreams()
 {
     DHLOGI("ReleaseAllStreams devId %{public}s dhId %{public}s", GetAnonyString(devId_).c_str(),
@@ -477,6 +482,27 @@ void DCameraSourceInput::PostChannelDisconnectedEvent()
     camDev->OnChannelDisconnectedEvent();
 }
 
+void DCameraSourceInput::CheckFrameLoss(const std::shared_ptr<DataBuffer>& buffer)
+{
+    int32_t index = buffer->frameInfo_.index;
+    int32_t lastIndex = lastFrameIndex_;
+    lastFrameIndex_ = index;
+    // A smaller index means the sink restarted its encoder, which opens with a key frame anyway.
+    if (lastIndex < 0 || index <= lastIndex + 1) {
+        return;
+    }
+    int64_t nowUs = GetNowTimeStampUs();
+    if (nowUs - lastKeyFrameRequestUs_ < KEY_FRAME_REQUEST_INTERVAL_US) {
+        return;
+    }
+    lastKeyFrameRequestUs_ = nowUs;
+    DHLOGI("continuous frames %{public}d to %{public}d lost, request a key frame, devId: %{public}s", lastIndex + 1,
+        index - 1, GetAnonyString(devId_).c_str());
+    std::shared_ptr<DCameraSourceDev> camDev = camDev_.lock();
+    CHECK_AND_RETURN_LOG(camDev == nullptr, "CheckFrameLoss camDev is nullptr");
+    camDev->PostKeyFrameRequestEvent();
+}
+
 int32_t DCameraSourceInput::EstablishContinuousFrameSession(std::vector<DCameraIndex>& indexs)
 {
     DcameraStartAsyncTrace(DCAMERA_OPEN_DATA_CONTINUE, DCAMERA_OPEN_DATA_CONTINUE_TASKID);
@@ -497,6 +523,8 @@ int32_t DCameraSourceInput::EstablishContinuousFrameSession(std::vector<DCameraI
 int32_t DCameraSourceInput::EstablishSnapshotFrameSession(std::vector<DCameraIndex>& indexs)
 {
     DcameraStartAsyncTrace(DCAMERA_OPEN_DATA_SNAPSHOT, DCAMERA_OPEN_DATA_SNAPSHOT_TASKID);
+    std::shared_ptr<DCameraSourceDev> camDev = camDev_.lock();
+    channels_[SNAPSHOT_FRAME]->SetSessionMux(camDev != nullptr && camDev->IsSessionMux());
     int32_t ret = channels_[SNAPSHOT_FRAME]->CreateSession(indexs, SNAP_SHOT_SESSION_FLAG, DCAMERA_SESSION_MODE_JPEG,
         listeners_[SNAPSHOT_FRAME]);
     if (ret != DCAMERA_OK) {
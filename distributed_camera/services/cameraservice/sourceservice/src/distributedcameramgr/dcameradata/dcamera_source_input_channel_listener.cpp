@@ -64,5 +64,14 @@ void DCameraSourceInputChannelListener::OnDataReceived(std::vector<std::shared_p
 
     input->OnDataReceived(streamType_, buffers);
 }
+
+std::shared_ptr<DataBuffer> DCameraSourceInputChannelListener::AcquireRecvBuffer(size_t capacity)
+{
+    std::shared_ptr<DCameraSourceInput> input = input_.lock();
+    if (input == nullptr) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return input->AcquireRecvBuffer(streamType_, capacity);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
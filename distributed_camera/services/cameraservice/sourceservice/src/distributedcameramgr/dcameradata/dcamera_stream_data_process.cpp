@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,11 +15,15 @@
 
 #include "dcamera_stream_data_process.h"
 
+#include <securec.h>
+
 #include "anonymous_string.h"
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 #include "dcamera_utils_tools.h"
+#include "dcamera_frame_drop_statistics.h"
+#include "dcamera_memory_account.h"
 #include "metadata_utils.h"
 #include "dcamera_source_imu_sensor.h"
 
@@ -29,12 +33,16 @@
 namespace OHOS {
 namespace DistributedHardware {
 DCameraStreamDataProcess::DCameraStreamDataProcess(std::string devId, std::string dhId, DCStreamType streamType)
-    : devId_(devId), dhId_(dhId), streamType_(streamType)
+    : devId_(devId), dhId_(dhId), streamType_(streamType), batchHdiProvider_(nullptr)
 {
     DHLOGI("DCameraStreamDataProcess Constructor devId %{public}s dhId %{public}s", GetAnonyString(devId_).c_str(),
         GetAnonyString(dhId_).c_str());
     pipeline_ = nullptr;
     listener_ = nullptr;
+    std::string streamKey = "source_" + GetAnonyString(devId_) + "_" + GetAnonyString(dhId_) + "_" +
+        std::to_string(streamType_);
+    dropCounter_ = DCameraFrameDropStatistics::GetInstance().Acquire(streamKey);
+    memoryAccount_ = DCameraMemoryStatistics::GetInstance().Acquire(streamKey);
 }
 
 DCameraStreamDataProcess::~DCameraStreamDataProcess()
@@ -56,6 +64,9 @@ void DCameraStreamDataProcess::FeedStream(std::shared_ptr<DataBuffer>& buffer)
             "%{public}" PRIu64, GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamId,
             streamType_, buffersSize);
     }
+    if (buffer != nullptr) {
+        buffer->Account(memoryAccount_, DCAMERA_MEMORY_CHANNEL);
+    }
     switch (streamType_) {
         case SNAPSHOT_FRAME: {
             FeedStreamToSnapShot(buffer);
@@ -70,6 +81,18 @@ void DCameraStreamDataProcess::FeedStream(std::shared_ptr<DataBuffer>& buffer)
     }
 }
 
+std::shared_ptr<DataBuffer> DCameraStreamDataProcess::AcquireRecvBuffer(size_t capacity)
+{
+    if (streamType_ == SNAPSHOT_FRAME) {
+        return AcquireSnapshotBuffer(capacity);
+    }
+    std::unique_lock<std::mutex> autoLock(pipelineMutex_, std::try_to_lock);
+    if (!autoLock.owns_lock() || streamType_ != CONTINUOUS_FRAME || pipeline_ == nullptr) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return pipeline_->AcquireInputBuffer(capacity);
+}
+
 void DCameraStreamDataProcess::ConfigStreams(std::shared_ptr<DCameraStreamConfig>& dstConfig,
     std::set<int32_t>& streamIds)
 {
@@ -123,6 +146,9 @@ void DCameraStreamDataProcess::StartCapture(std::shared_ptr<DCameraStreamConfig>
     }
     {
         std::lock_guard<std::mutex> autoLock(producerMutex_);
+        if (streamType_ == CONTINUOUS_FRAME && batchHdiProvider_ == nullptr) {
+            batchHdiProvider_ = OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider::Get(HDF_DCAMERA_EXT_SERVICE);
+        }
         for (auto iter = streamIds_.begin(); iter != streamIds_.end(); iter++) {
             uint32_t streamId = *iter;
             DHLOGI("StartCapture streamId: %{public}d", streamId);
@@ -134,12 +160,16 @@ void DCameraStreamDataProcess::StartCapture(std::shared_ptr<DCameraStreamConfig>
                 "%{public}d", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamType_, streamId);
             auto producerIter = producers_.find(streamId);
             if (producerIter != producers_.end()) {
+                producerIter->second->SetFrameRate(srcConfig->frameRate_);
                 continue;
             }
             DHLOGI("StartCapture CreateProducer devId %{public}s dhId %{public}s streamType: %{public}d streamId: "
                 "%{public}d", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamType_, streamId);
             producers_[streamId] =
                 std::make_shared<DCameraStreamDataProcessProducer>(devId_, dhId_, streamId, streamType_);
+            producers_[streamId]->SetDropCounter(dropCounter_);
+            producers_[streamId]->SetMemoryAccount(memoryAccount_);
+            producers_[streamId]->SetFrameRate(srcConfig->frameRate_);
             producers_[streamId]->Start();
         }
     }
@@ -173,6 +203,11 @@ void DCameraStreamDataProcess::StopCapture(std::set<int32_t>& streamIds)
             producerIter->second->Stop();
             producerIter = producers_.erase(producerIter);
         }
+        if (producers_.empty()) {
+            batchHdiProvider_ = nullptr;
+            DCameraFrameDropStatistics::GetInstance().ReportSession(dropCounter_);
+            DCameraMemoryStatistics::GetInstance().ReportSession(memoryAccount_);
+        }
     }
 }
 
@@ -206,11 +241,13 @@ void DCameraStreamDataProcess::FeedStreamToContinue(const std::shared_ptr<DataBu
 {
     CHECK_AND_RETURN_LOG(buffer == nullptr, "buffer is nullptr.");
     uint64_t buffersSize = static_cast<uint64_t>(buffer->Size());
-    DHLOGI("DCameraStreamDataProcess FeedStreamToContinue devId %{public}s dhId %{public}s streamType %{public}d "
-        "streamSize: %{public}" PRIu64, GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(),
-        streamType_, buffersSize);
-    buffer->eisInfo_.initParams = DCameraSrcImuSensor::GetInstance().GetInitParam();
+    DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "DCameraStreamDataProcess FeedStreamToContinue devId %{public}s "
+        "dhId %{public}s streamType %{public}d streamSize: %{public}" PRIu64, GetAnonyString(devId_).c_str(),
+        GetAnonyString(dhId_).c_str(), streamType_, buffersSize);
     std::lock_guard<std::mutex> autoLock(pipelineMutex_);
+    if (branchOwner_ != nullptr) {
+        return;
+    }
     std::vector<std::shared_ptr<DataBuffer>> buffers;
     buffers.push_back(buffer);
     if (pipeline_ == nullptr) {
@@ -229,36 +266,129 @@ void DCameraStreamDataProcess::OnProcessedVideoBuffer(const std::shared_ptr<Data
 {
     CHECK_AND_LOG(videoResult == nullptr, "videoResult is nullptr.");
     uint64_t resultSize = static_cast<uint64_t>(videoResult->Size());
-    DHLOGI("DCameraStreamDataProcess OnProcessedVideoBuffer devId %{public}s dhId %{public}s streamType: %{public}d "
-        "streamSize: %{public}" PRIu64, GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(),
-        streamType_, resultSize);
+    DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "DCameraStreamDataProcess OnProcessedVideoBuffer devId "
+        "%{public}s dhId %{public}s streamType: %{public}d streamSize: %{public}" PRIu64,
+        GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamType_, resultSize);
     std::lock_guard<std::mutex> autoLock(producerMutex_);
+    std::set<int32_t> fedStreamIds;
+    FeedStreamToDriverBuffers(videoResult, fedStreamIds);
     for (auto iter = producers_.begin(); iter != producers_.end(); iter++) {
-        iter->second->FeedStream(videoResult);
+        if (fedStreamIds.find(iter->first) == fedStreamIds.end()) {
+            iter->second->FeedStream(videoResult);
+        }
     }
 }
 
+void DCameraStreamDataProcess::FeedStreamToDriverBuffers(const std::shared_ptr<DataBuffer>& videoResult,
+    std::set<int32_t>& fedStreamIds)
+{
+    if (streamType_ != CONTINUOUS_FRAME || batchHdiProvider_ == nullptr) {
+        return;
+    }
+    std::vector<int32_t> streamIds;
+    for (auto iter = producers_.begin(); iter != producers_.end(); iter++) {
+        // Producers with a buffer ring take their buffers from it without a call.
+        if (iter->second != nullptr && iter->second->IsDriverBufferEnabled() && !iter->second->HasBufferRing()) {
+            streamIds.push_back(static_cast<int32_t>(iter->first));
+        }
+    }
+    // A single stream decodes straight into its driver buffer through AcquireOutputBuffer.
+    if (streamIds.size() < DCAMERA_BATCH_MIN_STREAMS) {
+        return;
+    }
+    DHBase dhBase;
+    dhBase.deviceId_ = devId_;
+    dhBase.dhId_ = dhId_;
+    std::vector<DCameraStreamBuffer> streamBuffers;
+    int32_t ret = batchHdiProvider_->AcquireBuffers(dhBase, streamIds, streamBuffers);
+    if (ret != SUCCESS) {
+        DHLOGD("AcquireBuffers no driver buffer, devId %{public}s dhId %{public}s ret: %{public}d",
+            GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), ret);
+        return;
+    }
+    std::vector<DCameraStreamBuffer> unusedBuffers;
+    for (auto& streamBuffer : streamBuffers) {
+        auto producerIter = producers_.find(streamBuffer.streamId_);
+        std::shared_ptr<DataBuffer> buffer = nullptr;
+        if (producerIter != producers_.end() && fedStreamIds.find(streamBuffer.streamId_) == fedStreamIds.end()) {
+            buffer = producerIter->second->AttachDriverBuffer(streamBuffer.buffer_, videoResult->Size());
+        }
+        if (buffer == nullptr) {
+            streamBuffer.buffer_.size_ = 0;
+            streamBuffer.captureTimeUs_ = 0;
+            unusedBuffers.push_back(streamBuffer);
+            continue;
+        }
+        // An attached buffer that is dropped here goes back to the driver through its releaser.
+        if (memcpy_s(buffer->Data(), buffer->Capacity(), videoResult->Data(), videoResult->Size()) != EOK) {
+            DHLOGE("copy frame to driver buffer failed, streamId: %{public}d", streamBuffer.streamId_);
+            continue;
+        }
+        buffer->frameInfo_ = videoResult->frameInfo_;
+        buffer->eisInfo_ = videoResult->eisInfo_;
+        producerIter->second->FeedStream(buffer);
+        fedStreamIds.insert(streamBuffer.streamId_);
+    }
+    if (!unusedBuffers.empty()) {
+        batchHdiProvider_->ShutterBuffers(dhBase, unusedBuffers);
+    }
+}
+
+std::shared_ptr<DataBuffer> DCameraStreamDataProcess::AcquireOutputBuffer(size_t capacity)
+{
+    std::lock_guard<std::mutex> autoLock(producerMutex_);
+    // Only a single consumer can own the frame memory.
+    if (streamType_ != CONTINUOUS_FRAME || producers_.size() != 1 || producers_.begin()->second == nullptr) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return producers_.begin()->second->AcquireDriverBuffer(capacity);
+}
+
+std::shared_ptr<DataBuffer> DCameraStreamDataProcess::AcquireSnapshotBuffer(size_t capacity)
+{
+    std::lock_guard<std::mutex> autoLock(producerMutex_);
+    // The photo is reassembled in the driver buffer, the looper then only has to shutter it.
+    if (producers_.size() != 1 || producers_.begin()->second == nullptr) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return producers_.begin()->second->AcquireDriverBuffer(capacity);
+}
+
 void DCameraStreamDataProcess::OnError(const DataProcessErrorType errorType)
 {
     DHLOGE("DCameraStreamDataProcess OnError pipeline errorType: %{public}d", errorType);
 }
 
+void DCameraStreamDataProcess::OnDecoderStepDown()
+{
+    // No control command asks the sink for a smaller stream yet, the next session is arbitrated again.
+    DHLOGW("DCameraStreamDataProcess decoder asked to step down devId %{public}s dhId %{public}s",
+        GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+}
+
 void DCameraStreamDataProcess::CreatePipeline()
 {
     DHLOGI("DCameraStreamDataProcess CreatePipeline devId %{public}s dhId %{public}s",
         GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
     std::lock_guard<std::mutex> autoLock(pipelineMutex_);
-    if (pipeline_ != nullptr) {
-        DHLOGI("DCameraStreamDataProcess CreatePipeline already exist, devId %{public}s dhId %{public}s",
-            GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
-        return;
-    }
+    CHECK_AND_RETURN_LOG(srcConfig_ == nullptr || dstConfig_ == nullptr, "stream config is nullptr.");
     bool eis = DCameraSrcImuSensor::GetInstance().GetSrcEis();
-    pipeline_ = std::make_shared<DCameraPipelineSource>();
-    auto process = std::shared_ptr<DCameraStreamDataProcess>(shared_from_this());
-    listener_ = std::make_shared<DCameraStreamDataProcessPipelineListener>(process);
     VideoConfigParams srcParams(GetPipelineCodecType(srcConfig_->encodeType_), GetPipelineFormat(srcConfig_->format_),
         DCAMERA_PRODUCER_FPS_DEFAULT, srcConfig_->width_, srcConfig_->height_, eis);
+    srcParams.SetHdrType(static_cast<VideoHdrType>(
+        DCameraHdrAbility::GetInstance().GetHdrType(devId_, srcConfig_->format_, srcConfig_->dataspace_)));
+    std::shared_ptr<DCameraStreamDataProcess> decodeSource = decodeSource_.lock();
+    std::shared_ptr<DCameraPipelineSource> decodePipeline =
+        (decodeSource == nullptr || decodeSource.get() == this) ? nullptr : decodeSource->GetDecodePipeline();
+    VideoConfigParams decodedConfig;
+    // Decoded P010 frames only pass through to their own stream, the scale node takes 8 bit input.
+    if (decodePipeline != nullptr && decodePipeline->GetDecodedConfig(decodedConfig) == DCAMERA_OK &&
+        decodedConfig.GetVideoformat() != Videoformat::P010) {
+        srcParams = VideoConfigParams(VideoCodecType::NO_CODEC, decodedConfig.GetVideoformat(),
+            DCAMERA_PRODUCER_FPS_DEFAULT, decodedConfig.GetWidth(), decodedConfig.GetHeight(), eis);
+    } else {
+        decodePipeline = nullptr;
+    }
     VideoConfigParams dstParams(GetPipelineCodecType(dstConfig_->encodeType_), GetPipelineFormat(dstConfig_->format_),
         DCAMERA_PRODUCER_FPS_DEFAULT, dstConfig_->width_, dstConfig_->height_);
     bool isSystemSwitch = DCameraSystemSwitchInfo::GetInstance().GetSystemSwitchFlag(devId_);
@@ -266,11 +396,58 @@ void DCameraStreamDataProcess::CreatePipeline()
         int32_t rotation = DCameraSystemSwitchInfo::GetInstance().GetSystemSwitchRotation(devId_);
         dstParams.SetSystemSwitchFlagAndRotation(isSystemSwitch, rotation);
     }
+    if (pipeline_ != nullptr) {
+        if (UpdatePipeline(srcParams, dstParams) == DCAMERA_OK) {
+            return;
+        }
+        ReleasePipeline();
+    }
+
+    pipeline_ = std::make_shared<DCameraPipelineSource>();
+    pipeline_->SetDropCounter(dropCounter_);
+    pipeline_->SetMemoryAccount(memoryAccount_);
+    auto process = std::shared_ptr<DCameraStreamDataProcess>(shared_from_this());
+    listener_ = std::make_shared<DCameraStreamDataProcessPipelineListener>(process);
     int32_t ret = pipeline_->CreateDataProcessPipeline(PipelineType::VIDEO, srcParams, dstParams, listener_);
     if (ret != DCAMERA_OK) {
         DHLOGE("DCameraStreamDataProcess CreateDataProcessPipeline type: %{public}d failed, ret: %{public}d",
             PipelineType::VIDEO, ret);
+        return;
+    }
+    pipelineSrcParams_ = srcParams;
+    pipelineDstParams_ = dstParams;
+    if (decodePipeline != nullptr) {
+        DHLOGI("DCameraStreamDataProcess CreatePipeline share decoder, devId %{public}s dhId %{public}s",
+            GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+        decodePipeline->AddBranch(pipeline_);
+        branchOwner_ = decodePipeline;
+    }
+}
+
+int32_t DCameraStreamDataProcess::UpdatePipeline(const VideoConfigParams& srcParams,
+    const VideoConfigParams& dstParams)
+{
+    if (srcParams.GetWidth() == pipelineSrcParams_.GetWidth() &&
+        srcParams.GetHeight() == pipelineSrcParams_.GetHeight() &&
+        dstParams.GetWidth() == pipelineDstParams_.GetWidth() &&
+        dstParams.GetHeight() == pipelineDstParams_.GetHeight()) {
+        DHLOGI("DCameraStreamDataProcess CreatePipeline already exist, devId %{public}s dhId %{public}s",
+            GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+        return DCAMERA_OK;
     }
+    // Keeping the decoder saves the codec restart, the pipeline refuses whenever it would need other nodes.
+    int32_t ret = pipeline_->UpdateConfig(srcParams, dstParams);
+    if (ret != DCAMERA_OK) {
+        DHLOGI("DCameraStreamDataProcess UpdatePipeline ret %{public}d, rebuild it, devId %{public}s dhId "
+            "%{public}s", ret, GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+        return ret;
+    }
+    DHLOGI("DCameraStreamDataProcess UpdatePipeline source %{public}dx%{public}d target %{public}dx%{public}d, "
+        "devId %{public}s dhId %{public}s", srcParams.GetWidth(), srcParams.GetHeight(), dstParams.GetWidth(),
+        dstParams.GetHeight(), GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
+    pipelineSrcParams_ = srcParams;
+    pipelineDstParams_ = dstParams;
+    return DCAMERA_OK;
 }
 
 void DCameraStreamDataProcess::DestroyPipeline()
@@ -278,13 +455,46 @@ void DCameraStreamDataProcess::DestroyPipeline()
     DHLOGI("DCameraStreamDataProcess DestroyPipeline devId %{public}s dhId %{public}s",
         GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str());
     std::lock_guard<std::mutex> autoLock(pipelineMutex_);
+    ReleasePipeline();
+}
+
+void DCameraStreamDataProcess::ReleasePipeline()
+{
     if (pipeline_ == nullptr) {
         return;
     }
+    if (branchOwner_ != nullptr) {
+        branchOwner_->RemoveBranch(pipeline_);
+        branchOwner_ = nullptr;
+    }
     pipeline_->DestroyDataProcessPipeline();
     pipeline_ = nullptr;
 }
 
+void DCameraStreamDataProcess::SetDecodeSource(const std::shared_ptr<DCameraStreamDataProcess>& decodeSource)
+{
+    if (decodeSource_.lock() == decodeSource) {
+        return;
+    }
+    decodeSource_ = decodeSource;
+    bool isRunning = false;
+    {
+        std::lock_guard<std::mutex> autoLock(pipelineMutex_);
+        isRunning = (pipeline_ != nullptr);
+    }
+    // A running pipeline is rebuilt so it decodes itself or hangs off the new decoder.
+    if (isRunning && srcConfig_ != nullptr && dstConfig_ != nullptr) {
+        DestroyPipeline();
+        CreatePipeline();
+    }
+}
+
+std::shared_ptr<DCameraPipelineSource> DCameraStreamDataProcess::GetDecodePipeline()
+{
+    std::lock_guard<std::mutex> autoLock(pipelineMutex_);
+    return (branchOwner_ == nullptr) ? pipeline_ : nullptr;
+}
+
 VideoCodecType DCameraStreamDataProcess::GetPipelineCodecType(DCEncodeType encodeType)
 {
     VideoCodecType codecType;
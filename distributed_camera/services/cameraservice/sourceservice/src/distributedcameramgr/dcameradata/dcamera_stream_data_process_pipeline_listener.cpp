@@ -52,5 +52,24 @@ void DCameraStreamDataProcessPipelineListener::OnError(DataProcessErrorType erro
     }
     process->OnError(errorType);
 }
+
+std::shared_ptr<DataBuffer> DCameraStreamDataProcessPipelineListener::AcquireOutputBuffer(size_t capacity)
+{
+    std::shared_ptr<DCameraStreamDataProcess> process = process_.lock();
+    if (process == nullptr) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return process->AcquireOutputBuffer(capacity);
+}
+
+void DCameraStreamDataProcessPipelineListener::OnDecoderStepDown()
+{
+    std::shared_ptr<DCameraStreamDataProcess> process = process_.lock();
+    if (process == nullptr) {
+        DHLOGE("DCameraStreamDataProcessPipelineListener OnDecoderStepDown not found process");
+        return;
+    }
+    process->OnDecoderStepDown();
+}
 } // namespace DistributedHardware
 } // namespace OHOS
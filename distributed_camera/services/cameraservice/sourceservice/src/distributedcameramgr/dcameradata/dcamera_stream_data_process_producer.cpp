@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,24 +15,26 @@
 
 #include "dcamera_stream_data_process_producer.h"
 
+#include <algorithm>
 #include <chrono>
 #include <securec.h>
 
 #include "anonymous_string.h"
-#include "dcamera_buffer_handle.h"
+#include "dcamera_dump_writer.h"
 #include "dcamera_hidumper.h"
+#include "dcamera_hitrace_adapter.h"
+#include "dcamera_thread_role.h"
 #include "dcamera_utils_tools.h"
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
-#include <sys/prctl.h>
 #include "dcamera_frame_info.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 DCameraStreamDataProcessProducer::DCameraStreamDataProcessProducer(std::string devId, std::string dhId,
     int32_t streamId, DCStreamType streamType)
-    : devId_(devId), dhId_(dhId), streamId_(streamId), streamType_(streamType), eventHandler_(nullptr),
+    : devId_(devId), dhId_(dhId), streamId_(streamId), streamType_(streamType), eventQueue_(nullptr),
     camHdiProvider_(nullptr), workModeParam_(-1, 0, 0, false)
 {
     DHLOGI("DCameraStreamDataProcessProducer Constructor devId %{public}s dhId %{public}s streamType: %{public}d "
@@ -41,14 +43,13 @@ DCameraStreamDataProcessProducer::DCameraStreamDataProcessProducer(std::string d
     interval_ = DCAMERA_PRODUCER_ONE_MINUTE_MS / DCAMERA_PRODUCER_FPS_DEFAULT;
     photoCount_ = COUNT_INIT_NUM;
     syncRunning_.store(false);
-    isFirstFrame_.store(true);
 }
 
 DCameraStreamDataProcessProducer::~DCameraStreamDataProcessProducer()
 {
     DHLOGI("DCameraStreamDataProcessProducer Destructor devId %{public}s dhId %{public}s state: %{public}d streamType"
-        ": %{public}d streamId: %{public}d", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), state_,
-        streamType_, streamId_);
+        ": %{public}d streamId: %{public}d", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(),
+        state_.load(), streamType_, streamId_);
     if (state_ == DCAMERA_PRODUCER_STATE_START) {
         Stop();
     }
@@ -61,15 +62,22 @@ void DCameraStreamDataProcessProducer::Start()
     camHdiProvider_ = IDCameraProvider::Get(HDF_DCAMERA_EXT_SERVICE);
     if (camHdiProvider_ == nullptr) {
         DHLOGE("camHdiProvider_ is null.");
+    } else {
+        camHdiProviderV1_2_ = OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider::CastFrom(camHdiProvider_);
+        OpenBufferRing();
     }
     state_ = DCAMERA_PRODUCER_STATE_START;
     if (streamType_ == CONTINUOUS_FRAME) {
-        eventThread_ = std::thread([this]() { this->StartEvent(); });
         {
-            std::unique_lock<std::mutex> lock(eventMutex_);
-            eventCon_.wait(lock, [this] {
-                return eventHandler_ != nullptr;
-            });
+            std::lock_guard<std::mutex> lock(eventMutex_);
+            eventQueue_ = std::make_shared<DCameraSerialQueue>(SOURCE_START_EVENT, DCAMERA_THREAD_OUTPUT);
+        }
+        latency_ = DCameraLatencyStatistics::GetInstance().Acquire(GetAnonyString(devId_) + "_" +
+            GetAnonyString(dhId_) + "_" + std::to_string(streamId_));
+        captureGroup_ = DCameraCaptureGroupManager::GetInstance().Find(devId_, dhId_);
+        if (captureGroup_ != nullptr) {
+            groupMemberKey_ = devId_ + "#" + dhId_ + "#" + std::to_string(streamId_);
+            captureGroup_->Join(groupMemberKey_, GetNowTimeStampUs());
         }
         smoother_ = std::make_unique<DCameraFeedingSmoother>();
         smootherListener_ = std::make_shared<FeedingSmootherListener>(shared_from_this());
@@ -77,6 +85,7 @@ void DCameraStreamDataProcessProducer::Start()
         smoother_->StartSmooth();
 
         // Start the audio and video synchronization thread
+        framePacer_.Reset();
         syncRunning_.store(true);
         syncThread_ = std::thread([this]() { this->SyncVideoThread(); });
     } else {
@@ -88,26 +97,21 @@ void DCameraStreamDataProcessProducer::Stop()
 {
     DHLOGI("DCameraStreamDataProcessProducer Stop devId: %{public}s dhId: %{public}s streamType: %{public}d "
         "streamId: %{public}d state: %{public}d", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(),
-        streamType_, streamId_, state_);
-    {
-        std::lock_guard<std::mutex> lock(bufferMutex_);
-        state_ = DCAMERA_PRODUCER_STATE_STOP;
-    }
+        streamType_, streamId_, state_.load());
+    state_ = DCAMERA_PRODUCER_STATE_STOP;
     if (streamType_ == CONTINUOUS_FRAME) {
         if (smoother_ != nullptr) {
             smoother_->StopSmooth();
+            CountDroppedFrames(DCAMERA_DROP_SMOOTHER_DISCARD, smoother_->GetDiscardedCount());
             smoother_ = nullptr;
         }
         smootherListener_ = nullptr;
         {
             std::lock_guard<std::mutex> lock(eventMutex_);
-            if ((eventHandler_ != nullptr) && (eventHandler_->GetEventRunner() != nullptr)) {
-                eventHandler_->GetEventRunner()->Stop();
-            }
-            if (eventThread_.joinable()) {
-                eventThread_.join();
+            if (eventQueue_ != nullptr) {
+                eventQueue_->Stop();
             }
-            eventHandler_ = nullptr;
+            eventQueue_ = nullptr;
         }
         // Stop the audio and video synchronization thread
         if (syncMem_ != nullptr) {
@@ -116,109 +120,131 @@ void DCameraStreamDataProcessProducer::Stop()
             syncMem_ = nullptr;
         }
         syncRunning_.store(false);
-        syncBufferCond_.notify_all();
+        syncBufferQueue_.Wakeup();
         if (syncThread_.joinable()) {
             syncThread_.join();
         }
+        syncBufferQueue_.Clear();
+        pendingSyncBuffer_ = nullptr;
+#ifdef DUMP_DCAMERA_FILE
+        DCameraDumpWriter::GetInstance().Close(DUMP_PATH, TO_DISPLAY);
+#endif
+        DCameraFramePacerStats pacerStats = framePacer_.GetStats();
+        DHLOGI("Sync pacing streamId: %{public}d released: %{public}" PRIu64 " early: %{public}" PRIu64 " late: "
+            "%{public}" PRIu64 " dropped: %{public}" PRIu64 " interval: %{public}" PRId64 "us", streamId_,
+            pacerStats.released, pacerStats.early, pacerStats.late, pacerStats.dropped,
+            framePacer_.GetFrameIntervalUs());
+        if (captureGroup_ != nullptr) {
+            captureGroup_->Leave(groupMemberKey_);
+            captureGroup_ = nullptr;
+        }
     } else {
-        producerCon_.notify_one();
-        producerThread_.join();
+        buffers_.Wakeup();
+        if (producerThread_.joinable()) {
+            producerThread_.join();
+        }
+    }
+    ReturnAllDriverBuffers();
+    {
+        // Buffers still attached to the ring memory keep it mapped until they are dropped.
+        std::lock_guard<std::mutex> lock(driverBufferMutex_);
+        bufferRing_ = nullptr;
     }
     camHdiProvider_ = nullptr;
+    camHdiProviderV1_2_ = nullptr;
+    bufferMapCache_.Clear();
     DHLOGI("DCameraStreamDataProcessProducer Stop end devId: %{public}s dhId: %{public}s streamType: %{public}d "
         "streamId: %{public}d state: %{public}d", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(),
-        streamType_, streamId_, state_);
+        streamType_, streamId_, state_.load());
 }
 
 void DCameraStreamDataProcessProducer::FeedStream(const std::shared_ptr<DataBuffer>& buffer)
 {
     CHECK_AND_RETURN_LOG(buffer == nullptr, "buffer is nullptr.");
     buffer->frameInfo_.timePonit.startSmooth = GetNowTimeStampUs();
-    {
-        std::lock_guard<std::mutex> lock(bufferMutex_);
-        uint64_t buffersSize = static_cast<uint64_t>(buffer->Size());
-        DHLOGD("DCameraStreamDataProcessProducer FeedStream devId %{public}s dhId %{public}s streamId: %{public}d "
-            "streamType: %{public}d streamSize: %{public}" PRIu64, GetAnonyString(devId_).c_str(),
-            GetAnonyString(dhId_).c_str(), streamId_, streamType_, buffersSize);
-        if (buffers_.size() >= DCAMERA_PRODUCER_MAX_BUFFER_SIZE) {
-            buffersSize = static_cast<uint64_t>(buffer->Size());
-            DHLOGD("DCameraStreamDataProcessProducer FeedStream OverSize devId %{public}s dhId %{public}s streamType: "
-                "%{public}d streamSize: %{public}" PRIu64, GetAnonyString(devId_).c_str(),
+    uint64_t buffersSize = static_cast<uint64_t>(buffer->Size());
+    DHLOGD("DCameraStreamDataProcessProducer FeedStream devId %{public}s dhId %{public}s streamId: %{public}d "
+        "streamType: %{public}d streamSize: %{public}" PRIu64, GetAnonyString(devId_).c_str(),
+        GetAnonyString(dhId_).c_str(), streamId_, streamType_, buffersSize);
+    // Only the looper pops, so a full queue keeps the queued snapshots and drops the new one.
+    if (streamType_ == SNAPSHOT_FRAME) {
+        buffer->SetOwner(DCAMERA_MEMORY_PRODUCER);
+        if (!buffers_.Push(buffer)) {
+            DHLOGD("DCameraStreamDataProcessProducer FeedStream OverSize devId %{public}s dhId %{public}s "
+                "streamType: %{public}d streamSize: %{public}" PRIu64, GetAnonyString(devId_).c_str(),
                 GetAnonyString(dhId_).c_str(), streamType_, buffersSize);
-            buffers_.pop_front();
-        }
-        if (streamType_ == SNAPSHOT_FRAME) {
-            buffers_.push_back(buffer);
-            producerCon_.notify_one();
+            CountDroppedFrames(DCAMERA_DROP_PRODUCER_QUEUE_FULL, 1);
         }
     }
     CHECK_AND_RETURN_LOG(smoother_ == nullptr, "smoother_ is null.");
     if (streamType_ == CONTINUOUS_FRAME) {
+        UpdateSinkEncoderPreset(buffer->frameInfo_.encoderPreset);
+        // Decoded frames reference nothing, so dropping one here costs the stream only that frame.
+        if (memoryAccount_ != nullptr && memoryAccount_->IsOverBudget()) {
+            CountDroppedFrames(DCAMERA_DROP_MEMORY_BUDGET, 1);
+            return;
+        }
+        buffer->SetOwner(DCAMERA_MEMORY_SMOOTHER);
         smoother_->PushData(buffer);
     }
 }
 
-void DCameraStreamDataProcessProducer::StartEvent()
+void DCameraStreamDataProcessProducer::UpdateSinkEncoderPreset(uint8_t encoderPreset)
 {
-    prctl(PR_SET_NAME, SOURCE_START_EVENT.c_str());
-    auto runner = AppExecFwk::EventRunner::Create(false);
-    {
-        std::lock_guard<std::mutex> lock(eventMutex_);
-        eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    if (encoderPreset == sinkEncoderPreset_) {
+        return;
     }
-    eventCon_.notify_one();
-    runner->Run();
+    sinkEncoderPreset_ = encoderPreset;
+    DHLOGI("Sink encoder of devId %{public}s dhId %{public}s streamId %{public}d now runs tier %{public}u at "
+        "throttle level %{public}u.", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamId_,
+        static_cast<uint32_t>(encoderPreset >> DCameraSinkFrameInfo::ENCODER_PRESET_TIER_SHIFT),
+        static_cast<uint32_t>(encoderPreset & DCameraSinkFrameInfo::ENCODER_PRESET_LEVEL_MASK));
 }
 
 void DCameraStreamDataProcessProducer::LooperSnapShot()
 {
     std::string name = PRODUCER + std::to_string(streamType_);
-    prctl(PR_SET_NAME, name.c_str());
+    DCameraThreadRoleRegistry::GetInstance().ApplyCurrentThread(DCAMERA_THREAD_OUTPUT, name);
     DHBase dhBase;
     dhBase.deviceId_ = devId_;
     dhBase.dhId_ = dhId_;
+    int32_t retryMs = DCAMERA_PRODUCER_RETRY_MIN_MS;
     while (state_ == DCAMERA_PRODUCER_STATE_START) {
         std::shared_ptr<DataBuffer> buffer = nullptr;
-        {
-            std::unique_lock<std::mutex> lock(bufferMutex_);
-            producerCon_.wait(lock, [this] {
-                return (!buffers_.empty() || state_ == DCAMERA_PRODUCER_STATE_STOP);
-            });
-            if (state_ == DCAMERA_PRODUCER_STATE_STOP) {
-                continue;
-            }
-            if (!buffers_.empty()) {
-                DHLOGI("LooperSnapShot producer get buffer devId: %{public}s dhId: %{public}s streamType: %{public}d "
-                    "streamId: %{public}d state: %{public}d",
-                    GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamType_, streamId_, state_);
-                buffer = buffers_.front();
-            }
+        if (!buffers_.Front(buffer)) {
+            buffers_.Wait(DCAMERA_PRODUCER_WAIT_MS);
+            continue;
         }
         if (buffer == nullptr) {
             DHLOGI("LooperSnapShot producer get buffer failed devId: %{public}s dhId: %{public}s streamType:"
-                " %{public}d streamId: %{public}d state: %{public}d",
-                GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamType_, streamId_, state_);
+                " %{public}d streamId: %{public}d state: %{public}d", GetAnonyString(devId_).c_str(),
+                GetAnonyString(dhId_).c_str(), streamType_, streamId_, state_.load());
+            buffers_.Pop(buffer);
             continue;
         }
+        DHLOGI("LooperSnapShot producer get buffer devId: %{public}s dhId: %{public}s streamType: %{public}d "
+            "streamId: %{public}d state: %{public}d", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(),
+            streamType_, streamId_, state_.load());
 #ifdef DUMP_DCAMERA_FILE
     std::string name =
         "SourceCapture_streamId(" + std::to_string(streamId_) + ")_" + std::to_string(photoCount_++) + ".jpg";
-    if (DcameraHidumper::GetInstance().GetDumpFlag() && (IsUnderDumpMaxSize(DUMP_PHOTO_PATH, name) == DCAMERA_OK)) {
-        DumpBufferToFile(DUMP_PHOTO_PATH, name, buffer->Data(), buffer->Size());
+    if (DcameraHidumper::GetInstance().GetDumpFlag()) {
+        DCameraDumpWriter::GetInstance().Write(DUMP_PHOTO_PATH, name, buffer->Data(), buffer->Size(), true);
     }
 #endif
         int32_t ret = FeedStreamToDriver(dhBase, buffer);
         if (ret != DCAMERA_OK) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(DCAMERA_PRODUCER_RETRY_SLEEP_MS));
+            // The driver has no free buffer yet, back off but let Stop cut the wait short.
+            buffers_.WaitWakeup(retryMs);
+            retryMs = std::min(retryMs * DCAMERA_PRODUCER_RETRY_FACTOR, DCAMERA_PRODUCER_RETRY_MAX_MS);
             continue;
         }
-        {
-            std::lock_guard<std::mutex> lock(bufferMutex_);
-            buffers_.pop_front();
-        }
+        retryMs = DCAMERA_PRODUCER_RETRY_MIN_MS;
+        buffers_.Pop(buffer);
     }
     DHLOGI("LooperSnapShot producer end devId: %s dhId: %s streamType: %{public}d streamId: %{public}d state: "
-        "%{public}d", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamType_, streamId_, state_);
+        "%{public}d", GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamType_, streamId_,
+        state_.load());
 }
 
 int32_t DCameraStreamDataProcessProducer::FeedStreamToDriver(const DHBase& dhBase,
@@ -228,8 +254,29 @@ int32_t DCameraStreamDataProcessProducer::FeedStreamToDriver(const DHBase& dhBas
         DHLOGI("camHdiProvider is nullptr");
         return DCAMERA_BAD_VALUE;
     }
+    int32_t frameIndex = buffer->frameInfo_.index;
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_FEED_DRIVER, frameIndex);
+    int64_t captureTimeUs = GetCaptureTimeUs(buffer->frameInfo_);
     DCameraBuffer sharedMemory;
-    int32_t ret = camHdiProvider_->AcquireBuffer(dhBase, streamId_, sharedMemory);
+    if (TakeDriverBuffer(buffer.get(), sharedMemory)) {
+        // The frame was produced in place, only hand the buffer back to the driver.
+        sharedMemory.size_ = static_cast<int32_t>(buffer->Size());
+        int32_t ret = ReturnToDriver(dhBase, sharedMemory, captureTimeUs);
+        if (ret != SUCCESS) {
+            DHLOGE("ShutterBuffer devId: %{public}s dhId: %{public}s streamId: %{public}d ret: %{public}d",
+                GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamId_, ret);
+            return DCAMERA_BAD_OPERATE;
+        }
+        return DCAMERA_OK;
+    }
+    if (FeedStreamToRing(buffer) == DCAMERA_OK) {
+        return DCAMERA_OK;
+    }
+    int32_t ret = DCAMERA_OK;
+    {
+        DCameraFrameTrace acquireTrace(DCAMERA_FRAME_ACQUIRE_BUFFER, frameIndex);
+        ret = camHdiProvider_->AcquireBuffer(dhBase, streamId_, sharedMemory);
+    }
     if (ret != SUCCESS) {
         DHLOGE("AcquireBuffer devId: %{public}s dhId: %{public}s streamId: %{public}d ret: %{public}d",
             GetAnonyString(devId_).c_str(), GetAnonyString(dhId_).c_str(), streamId_, ret);
@@ -243,7 +290,7 @@ int32_t DCameraStreamDataProcessProducer::FeedStreamToDriver(const DHBase& dhBas
             break;
         }
         sharedMemory.bufferHandle_->GetBufferHandle()->virAddr =
-            DCameraMemoryMap(sharedMemory.bufferHandle_->GetBufferHandle());
+            bufferMapCache_.Map(sharedMemory.index_, sharedMemory.bufferHandle_->GetBufferHandle());
         if (sharedMemory.bufferHandle_->GetBufferHandle()->virAddr == nullptr) {
             DHLOGE("mmap failed devId: %{public}s dhId: %{public}s", GetAnonyString(devId_).c_str(),
                 GetAnonyString(dhId_).c_str());
@@ -259,9 +306,13 @@ int32_t DCameraStreamDataProcessProducer::FeedStreamToDriver(const DHBase& dhBas
         }
         sharedMemory.size_ = buffer->Size();
     } while (0);
-    ret = camHdiProvider_->ShutterBuffer(dhBase, streamId_, sharedMemory);
-    if (sharedMemory.bufferHandle_ != nullptr) {
-        DCameraMemoryUnmap(sharedMemory.bufferHandle_->GetBufferHandle());
+    {
+        DCameraFrameTrace shutterTrace(DCAMERA_FRAME_SHUTTER_BUFFER, frameIndex);
+        ret = ShutterToDriver(dhBase, sharedMemory, captureTimeUs);
+    }
+    if (sharedMemory.bufferHandle_ != nullptr && sharedMemory.bufferHandle_->GetBufferHandle() != nullptr) {
+        // The mapping stays in bufferMapCache_ until the producer stops.
+        sharedMemory.bufferHandle_->GetBufferHandle()->virAddr = nullptr;
     }
     if (ret != SUCCESS) {
         DHLOGE("ShutterBuffer devId: %{public}s dhId: %{public}s streamId: %{public}d ret: %{public}d",
@@ -291,35 +342,265 @@ int32_t DCameraStreamDataProcessProducer::CheckSharedMemory(const DCameraBuffer&
     return DCAMERA_OK;
 }
 
+std::shared_ptr<DataBuffer> DCameraStreamDataProcessProducer::AcquireDriverBuffer(size_t capacity)
+{
+    if (!IsDriverBufferEnabled()) {
+        return DataBuffer::Acquire(capacity);
+    }
+    DCameraBuffer sharedMemory;
+    std::shared_ptr<DCameraBufferRing> ring = GetBufferRing();
+    if (ring != nullptr) {
+        uint8_t *virAddr = ring->AcquireBuffer(capacity, sharedMemory);
+        std::shared_ptr<DataBuffer> buffer = (virAddr == nullptr) ? nullptr :
+            AttachBuffer(virAddr, capacity, sharedMemory, ring);
+        if (buffer != nullptr) {
+            return buffer;
+        }
+        if (virAddr != nullptr) {
+            sharedMemory.size_ = 0;
+            ring->ShutterBuffer(sharedMemory);
+        }
+    }
+    DHBase dhBase;
+    dhBase.deviceId_ = devId_;
+    dhBase.dhId_ = dhId_;
+    int32_t ret = camHdiProvider_->AcquireBuffer(dhBase, streamId_, sharedMemory);
+    if (ret != SUCCESS) {
+        DHLOGD("AcquireDriverBuffer no driver buffer, streamId: %{public}d ret: %{public}d", streamId_, ret);
+        return DataBuffer::Acquire(capacity);
+    }
+    std::shared_ptr<DataBuffer> buffer = AttachDriverBuffer(sharedMemory, capacity);
+    if (buffer == nullptr) {
+        camHdiProvider_->ShutterBuffer(dhBase, streamId_, sharedMemory);
+        return DataBuffer::Acquire(capacity);
+    }
+    return buffer;
+}
+
+bool DCameraStreamDataProcessProducer::IsDriverBufferEnabled()
+{
+    if (state_ != DCAMERA_PRODUCER_STATE_START || camHdiProvider_ == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(workModeParamMtx_);
+    return !workModeParam_.isAVsync;
+}
+
+bool DCameraStreamDataProcessProducer::HasBufferRing()
+{
+    return GetBufferRing() != nullptr;
+}
+
+std::shared_ptr<DataBuffer> DCameraStreamDataProcessProducer::AttachDriverBuffer(const DCameraBuffer& sharedMemory,
+    size_t capacity)
+{
+    uint8_t *virAddr = nullptr;
+    if (sharedMemory.bufferHandle_ != nullptr && sharedMemory.bufferHandle_->GetBufferHandle() != nullptr &&
+        sharedMemory.size_ >= 0 && capacity <= static_cast<size_t>(sharedMemory.size_)) {
+        virAddr = static_cast<uint8_t *>(bufferMapCache_.Map(sharedMemory.index_,
+            sharedMemory.bufferHandle_->GetBufferHandle()));
+    }
+    return (virAddr == nullptr) ? nullptr : AttachBuffer(virAddr, capacity, sharedMemory, nullptr);
+}
+
+std::shared_ptr<DataBuffer> DCameraStreamDataProcessProducer::AttachBuffer(uint8_t *virAddr, size_t capacity,
+    const DCameraBuffer& sharedMemory, const std::shared_ptr<DCameraBufferRing>& ring)
+{
+    std::weak_ptr<DCameraStreamDataProcessProducer> weakProducer = shared_from_this();
+    // Holding the ring keeps its mappings alive for as long as the frame is in flight.
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Attach(virAddr, capacity,
+        [weakProducer, ring](DataBuffer *attached) {
+            std::shared_ptr<DCameraStreamDataProcessProducer> producer = weakProducer.lock();
+            if (producer != nullptr) {
+                producer->ReturnDriverBuffer(attached);
+            }
+        });
+    if (buffer == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(driverBufferMutex_);
+    driverBuffers_[buffer.get()] = sharedMemory;
+    return buffer;
+}
+
+bool DCameraStreamDataProcessProducer::TakeDriverBuffer(const DataBuffer *buffer, DCameraBuffer& sharedMemory)
+{
+    std::lock_guard<std::mutex> lock(driverBufferMutex_);
+    auto iter = driverBuffers_.find(buffer);
+    if (iter == driverBuffers_.end()) {
+        return false;
+    }
+    sharedMemory = iter->second;
+    driverBuffers_.erase(iter);
+    return true;
+}
+
+void DCameraStreamDataProcessProducer::ReturnDriverBuffer(const DataBuffer *buffer)
+{
+    DCameraBuffer sharedMemory;
+    if (!TakeDriverBuffer(buffer, sharedMemory) || camHdiProvider_ == nullptr) {
+        return;
+    }
+    DHLOGD("Return unused driver buffer, streamId: %{public}d index: %{public}d", streamId_, sharedMemory.index_);
+    DHBase dhBase;
+    dhBase.deviceId_ = devId_;
+    dhBase.dhId_ = dhId_;
+    sharedMemory.size_ = 0;
+    ReturnToDriver(dhBase, sharedMemory);
+}
+
+void DCameraStreamDataProcessProducer::ReturnAllDriverBuffers()
+{
+    std::map<const DataBuffer *, DCameraBuffer> driverBuffers;
+    {
+        std::lock_guard<std::mutex> lock(driverBufferMutex_);
+        driverBuffers.swap(driverBuffers_);
+    }
+    if (camHdiProvider_ == nullptr) {
+        return;
+    }
+    DHBase dhBase;
+    dhBase.deviceId_ = devId_;
+    dhBase.dhId_ = dhId_;
+    for (auto& iter : driverBuffers) {
+        iter.second.size_ = 0;
+        ReturnToDriver(dhBase, iter.second);
+    }
+}
+
+void DCameraStreamDataProcessProducer::OpenBufferRing()
+{
+    sptr<OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider> provider =
+        OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider::CastFrom(camHdiProvider_);
+    if (provider == nullptr) {
+        return;
+    }
+    DHBase dhBase;
+    dhBase.deviceId_ = devId_;
+    dhBase.dhId_ = dhId_;
+    int ringFd = -1;
+    int eventFd = -1;
+    int32_t ret = provider->OpenBufferRing(dhBase, streamId_, ringFd, eventFd);
+    if (ret != SUCCESS) {
+        DHLOGI("buffer ring unavailable, streamId: %{public}d ret: %{public}d", streamId_, ret);
+        return;
+    }
+    int32_t streamId = streamId_;
+    auto getBufferFunc = [provider, dhBase, streamId](int32_t index, DCameraBuffer& buffer) {
+        return provider->GetRingBuffer(dhBase, streamId, index, buffer) == SUCCESS ? DCAMERA_OK : DCAMERA_BAD_OPERATE;
+    };
+    auto shutterBufferFunc = [provider, dhBase, streamId](const DCameraBuffer& buffer) {
+        return provider->ShutterBuffer(dhBase, streamId, buffer) == SUCCESS ? DCAMERA_OK : DCAMERA_BAD_OPERATE;
+    };
+    std::shared_ptr<DCameraBufferRing> ring = std::make_shared<DCameraBufferRing>(streamId_, getBufferFunc,
+        shutterBufferFunc);
+    if (ring->Init(ringFd, eventFd) != DCAMERA_OK) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(driverBufferMutex_);
+    bufferRing_ = ring;
+}
+
+std::shared_ptr<DCameraBufferRing> DCameraStreamDataProcessProducer::GetBufferRing()
+{
+    std::lock_guard<std::mutex> lock(driverBufferMutex_);
+    return bufferRing_;
+}
+
+int32_t DCameraStreamDataProcessProducer::FeedStreamToRing(const std::shared_ptr<DataBuffer>& buffer)
+{
+    std::shared_ptr<DCameraBufferRing> ring = GetBufferRing();
+    if (ring == nullptr) {
+        return DCAMERA_BAD_OPERATE;
+    }
+    DCameraBuffer sharedMemory;
+    uint8_t *virAddr = ring->AcquireBuffer(buffer->Size(), sharedMemory);
+    if (virAddr == nullptr) {
+        return DCAMERA_BAD_OPERATE;
+    }
+    int32_t ret = memcpy_s(virAddr, sharedMemory.size_, buffer->Data(), buffer->Size());
+    if (ret != EOK) {
+        DHLOGE("memcpy_s to ring buffer failed, streamId: %{public}d bufSize: %{public}zu", streamId_,
+            buffer->Size());
+    }
+    sharedMemory.size_ = (ret == EOK) ? static_cast<int32_t>(buffer->Size()) : 0;
+    return ring->ShutterBuffer(sharedMemory, GetCaptureTimeUs(buffer->frameInfo_));
+}
+
+int32_t DCameraStreamDataProcessProducer::ReturnToDriver(const DHBase& dhBase, const DCameraBuffer& sharedMemory,
+    int64_t captureTimeUs)
+{
+    // Buffers taken from the ring carry no handle and go back the same way.
+    if (sharedMemory.bufferHandle_ == nullptr) {
+        std::shared_ptr<DCameraBufferRing> ring = GetBufferRing();
+        if (ring == nullptr) {
+            DHLOGE("ring closed before buffer returned, streamId: %{public}d index: %{public}d", streamId_,
+                sharedMemory.index_);
+            return DCamRetCode::FAILED;
+        }
+        return ring->ShutterBuffer(sharedMemory, captureTimeUs) == DCAMERA_OK ? SUCCESS : DCamRetCode::FAILED;
+    }
+    return ShutterToDriver(dhBase, sharedMemory, captureTimeUs);
+}
+
+int32_t DCameraStreamDataProcessProducer::ShutterToDriver(const DHBase& dhBase, const DCameraBuffer& sharedMemory,
+    int64_t captureTimeUs)
+{
+    if (captureTimeUs <= 0 || camHdiProviderV1_2_ == nullptr) {
+        return camHdiProvider_->ShutterBuffer(dhBase, streamId_, sharedMemory);
+    }
+    std::vector<OHOS::HDI::DistributedCamera::V1_2::DCameraStreamBuffer> buffers(1);
+    buffers[0].streamId_ = streamId_;
+    buffers[0].buffer_ = sharedMemory;
+    buffers[0].captureTimeUs_ = captureTimeUs;
+    return camHdiProviderV1_2_->ShutterBuffers(dhBase, buffers);
+}
+
+int64_t DCameraStreamDataProcessProducer::GetCaptureTimeUs(const DCameraFrameInfo& frameInfo)
+{
+    // The sink stamps frames with its wall clock, the time sync offset says how far it runs ahead of ours.
+    if (frameInfo.rawTime <= 0) {
+        return 0;
+    }
+    return frameInfo.rawTime - static_cast<int64_t>(frameInfo.offset);
+}
+
 void DCameraStreamDataProcessProducer::OnSmoothFinished(const std::shared_ptr<IFeedableData>& data)
 {
     std::shared_ptr<DataBuffer> buffer = std::reinterpret_pointer_cast<DataBuffer>(data);
     CHECK_AND_RETURN_LOG(buffer == nullptr, "buffer is nullptr.");
+    buffer->SetOwner(DCAMERA_MEMORY_PRODUCER);
+    if (latency_ != nullptr) {
+        latency_->Record(buffer->frameInfo_);
+    }
     DHBase dhBase;
     dhBase.deviceId_ = devId_;
     dhBase.dhId_ = dhId_;
 #ifdef DUMP_DCAMERA_FILE
-    if (DcameraHidumper::GetInstance().GetDumpFlag() &&
-        (IsUnderDumpMaxSize(DUMP_PATH, TO_DISPLAY) == DCAMERA_OK)) {
-        DumpBufferToFile(DUMP_PATH, TO_DISPLAY, buffer->Data(), buffer->Size());
+    if (DcameraHidumper::GetInstance().GetDumpFlag()) {
+        DCameraDumpWriter::GetInstance().Write(DUMP_PATH, TO_DISPLAY, buffer->Data(), buffer->Size());
     }
 #endif
     {
         // Check if audio-video synchronization is enabled
         std::lock_guard<std::mutex> lock(workModeParamMtx_);
-        DHLOGI("OnSmoothFinished rawTime: %{public}" PRIu64 ", isAVsync: %{public}d",
-            buffer->frameInfo_.rawTime, workModeParam_.isAVsync);
+        DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "OnSmoothFinished rawTime: %{public}" PRIu64
+            ", isAVsync: %{public}d", buffer->frameInfo_.rawTime, workModeParam_.isAVsync);
         if (workModeParam_.isAVsync) {
             WritePtsAndAddBuffer(buffer);
             return;
         }
     }
+    if (captureGroup_ != nullptr) {
+        PushSyncBuffer(buffer);
+        return;
+    }
     auto feedFunc = [this, dhBase, buffer]() {
         FeedStreamToDriver(dhBase, buffer);
     };
     std::lock_guard<std::mutex> lock(eventMutex_);
-    if (eventHandler_ != nullptr) {
-        eventHandler_->PostTask(feedFunc);
+    if (eventQueue_ != nullptr) {
+        eventQueue_->PostTask(feedFunc);
     }
 }
 
@@ -333,164 +614,200 @@ void DCameraStreamDataProcessProducer::WritePtsAndAddBuffer(const std::shared_pt
         ret = syncMem_->MapReadAndWriteAshmem();
         CHECK_AND_RETURN_LOG(!ret, "SyncVideoFrame: MapReadAndWriteAshmem failed");
     }
-    auto syncData = syncMem_->ReadFromAshmem(workModeParam_.sharedMemLen, 0);
-    SyncSharedData *readSyncSharedData = reinterpret_cast<SyncSharedData *>(const_cast<void *>(syncData));
-    CHECK_AND_RETURN_LOG(readSyncSharedData == nullptr, "read SyncData failed");
-    // get voliate lock
-    while (!readSyncSharedData->lock) {
-        DHLOGI("readSyncSharedData->lock is false");
-        syncData = syncMem_->ReadFromAshmem(workModeParam_.sharedMemLen, 0);
-        readSyncSharedData = reinterpret_cast<SyncSharedData *>(const_cast<void *>(syncData));
-    }
-
-    readSyncSharedData->lock = 0;
-    ret = syncMem_->WriteToAshmem(static_cast<void *>(readSyncSharedData), sizeof(SyncSharedData), 0);
-    CHECK_AND_RETURN_LOG(!ret, "write sync data failed!");
-    readSyncSharedData->video_current_pts = static_cast<uint64_t>(buffer->frameInfo_.rawTime);
-    readSyncSharedData->video_update_clock = static_cast<uint64_t>(GetNowTimeStampUs());
-    readSyncSharedData->reset = false;
-    readSyncSharedData->lock = 1;
-    ret = syncMem_->WriteToAshmem(static_cast<void *>(readSyncSharedData), sizeof(SyncSharedData), 0);
-    CHECK_AND_RETURN_LOG(!ret, "write sync data failed!");
-    std::lock_guard<std::mutex> lock(syncBufferMutex_);
-    if (syncBufferQueue_.size() >= DCAMERA_MAX_SYNC_BUFFER_SIZE) {
-        DHLOGI("Sync buffer full, drop oldest frame, streamId: %{public}d", streamId_);
-        syncBufferQueue_.pop_front();
-    }
-    syncBufferQueue_.push_back(buffer);
-    syncBufferCond_.notify_one(); // Notify the synchronization thread to process
-    return;
+    WriteVideoClock(static_cast<uint64_t>(buffer->frameInfo_.rawTime));
+    PushSyncBuffer(buffer);
+}
+
+void DCameraStreamDataProcessProducer::PushSyncBuffer(const std::shared_ptr<DataBuffer>& buffer)
+{
+    // Only the sync thread pops, so a full queue drops the new frame. Queued frames that are late get skipped.
+    if (!syncBufferQueue_.Push(buffer)) {
+        DHLOGI("Sync buffer full, drop frame, streamId: %{public}d", streamId_);
+        CountDroppedFrames(DCAMERA_DROP_PRODUCER_QUEUE_FULL, 1);
+    }
 }
 
 void DCameraStreamDataProcessProducer::SyncVideoThread()
 {
     DHLOGI("SyncVideoThread started for streamId: %{public}d", streamId_);
-    const std::chrono::milliseconds FRAME_INTERVAL(DCAMERA_SYNC_TIME_INTERVAL); // 33ms per frame
-    std::chrono::steady_clock::time_point nextScheduleTime;
-
+    DCameraThreadRoleRegistry::GetInstance().ApplyCurrentThread(DCAMERA_THREAD_OUTPUT, SOURCE_SYNC_THREAD);
+    DHBase dhBase;
+    dhBase.deviceId_ = devId_;
+    dhBase.dhId_ = dhId_;
     while (syncRunning_.load()) {
         std::shared_ptr<DataBuffer> buffer = nullptr;
-
-        // Wait for video frames in the sync queue
-        bool shouldBreak = WaitForVideoFrame(buffer);
-        if (shouldBreak) {
+        if (WaitForVideoFrame(buffer)) {
             break;
         }
-
         if (buffer == nullptr) {
             continue;
         }
-
-        // Record the start time when the first frame is sent
-        if (isFirstFrame_.load()) {
-            nextScheduleTime = std::chrono::steady_clock::now();
-            isFirstFrame_.store(false);
-            DHLOGI("First frame timestamp recorded, streamId: %{public}d", streamId_);
-        }
-
-        // Synchronization frame judgment
-        uint64_t videoPtsUs = static_cast<uint64_t>(buffer->frameInfo_.rawTime);
-        int32_t syncResult = SyncVideoFrame(videoPtsUs);
-        if (syncResult == 1) {
-            // Synchronization successful, sending video frame
-            DHBase dhBase;
-            dhBase.deviceId_ = devId_;
-            dhBase.dhId_ = dhId_;
-
-            int32_t ret = FeedStreamToDriver(dhBase, buffer);
-            if (ret != DCAMERA_OK) {
-                DHLOGE("FeedStreamToDriver failed, ret: %{public}d, streamId: %{public}d", ret, streamId_);
-            } else {
-                // FeedStreamToDriver success video_update_clock
-                UpdateVideoClock(videoPtsUs);
-            }
-            nextScheduleTime += FRAME_INTERVAL; // Perform timed scheduling after successful transmission
-            std::this_thread::sleep_until(nextScheduleTime);
-        } else if (syncResult == 0) {
-            {
-                std::lock_guard<std::mutex> lock(syncBufferMutex_);
-                syncBufferQueue_.push_front(buffer);
-            }
-
-            // Perform timed scheduling after successful transmission
-            nextScheduleTime += FRAME_INTERVAL;
-            std::this_thread::sleep_until(nextScheduleTime);
-        } else {
+        uint64_t videoPts = static_cast<uint64_t>(buffer->frameInfo_.rawTime);
+        int64_t waitUs = 0;
+        int32_t syncResult = ScheduleVideoFrame(buffer, waitUs);
+        if (syncResult == DCAMERA_SYNC_HOLD) {
+            // Too early for its clock, release it once the clock reaches its pts.
+            pendingSyncBuffer_ = buffer;
+            WaitSyncSchedule(waitUs);
+            continue;
+        }
+        if (syncResult != DCAMERA_SYNC_RELEASE) {
             // Video frame is too late, discard directly and process next frame immediately
+            CountDroppedFrames(DCAMERA_DROP_SYNC_LATE, 1);
+            framePacer_.OnDropped();
             continue;
         }
+        int32_t ret = FeedStreamToDriver(dhBase, buffer);
+        if (ret != DCAMERA_OK) {
+            DHLOGE("FeedStreamToDriver failed, ret: %{public}d, streamId: %{public}d", ret, streamId_);
+        } else {
+            UpdateVideoClock(videoPts);
+        }
+        framePacer_.OnReleased(static_cast<int64_t>(videoPts / DCAMERA_NS_TO_US));
     }
 
     DHLOGI("SyncVideoThread exited for streamId: %{public}d", streamId_);
 }
 
+void DCameraStreamDataProcessProducer::WaitSyncSchedule(int64_t waitUs)
+{
+    if (waitUs <= 0 || !syncRunning_.load()) {
+        return;
+    }
+    // Round up so a frame is never released ahead of the clock, Stop cuts the wait short.
+    int64_t waitMs = (waitUs + DCAMERA_US_TO_MS - 1) / DCAMERA_US_TO_MS;
+    syncBufferQueue_.WaitWakeup(static_cast<int32_t>(waitMs));
+}
+
 bool DCameraStreamDataProcessProducer::WaitForVideoFrame(std::shared_ptr<DataBuffer>& buffer)
 {
-    std::unique_lock<std::mutex> lock(syncBufferMutex_);
-    syncBufferCond_.wait(lock, [this] {
-        return !syncBufferQueue_.empty() || !syncRunning_.load();
-    });
+    if (pendingSyncBuffer_ != nullptr) {
+        buffer = pendingSyncBuffer_;
+        pendingSyncBuffer_ = nullptr;
+        return !syncRunning_.load();
+    }
+    while (syncRunning_.load() && !syncBufferQueue_.Pop(buffer)) {
+        syncBufferQueue_.Wait(DCAMERA_PRODUCER_WAIT_MS);
+    }
+    return !syncRunning_.load();
+}
+
+int32_t DCameraStreamDataProcessProducer::ReadAudioClock(int64_t& audioPtsUs, int64_t& audioUpdateUs,
+    float& audioSpeed)
+{
+    CHECK_AND_RETURN_RET_LOG(syncMem_ == nullptr, DCAMERA_BAD_VALUE, "ReadAudioClock: syncMem_ is nullptr.");
+    SyncSharedData *sharedData = LockSyncSharedData();
+    CHECK_AND_RETURN_RET_LOG(sharedData == nullptr, DCAMERA_BAD_VALUE, "ReadAudioClock: lock sync data failed.");
+    audioPtsUs = static_cast<int64_t>(sharedData->audio_current_pts);
+    audioUpdateUs = static_cast<int64_t>(sharedData->audio_update_clock);
+    audioSpeed = sharedData->audio_speed;
+    UnlockSyncSharedData(sharedData);
+    return DCAMERA_OK;
+}
 
-    if (!syncRunning_.load()) {
-        return true; // exit
+DCameraStreamDataProcessProducer::SyncSharedData *DCameraStreamDataProcessProducer::LockSyncSharedData()
+{
+    // The mapping is shared with the audio side, the fields are read and written in place.
+    const void *syncData = syncMem_->ReadFromAshmem(sizeof(SyncSharedData), 0);
+    SyncSharedData *sharedData = reinterpret_cast<SyncSharedData *>(const_cast<void *>(syncData));
+    CHECK_AND_RETURN_RET_LOG(sharedData == nullptr, nullptr, "read SyncData failed");
+    int *lockWord = const_cast<int *>(&sharedData->lock);
+    int64_t deadlineUs = GetNowTimeStampUs() + DCAMERA_SYNC_LOCK_TIMEOUT_US;
+    int32_t spins = 0;
+    while (true) {
+        int expected = DCAMERA_SYNC_UNLOCKED;
+        if (__atomic_compare_exchange_n(lockWord, &expected, DCAMERA_SYNC_LOCKED, false, __ATOMIC_ACQUIRE,
+            __ATOMIC_RELAXED)) {
+            return sharedData;
+        }
+        if (++spins < DCAMERA_SYNC_LOCK_SPINS) {
+            std::this_thread::yield();
+            continue;
+        }
+        // A peer that died holding the word must not stall the sync thread.
+        if (GetNowTimeStampUs() >= deadlineUs) {
+            DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "sync data lock timeout, streamId: %{public}d",
+                streamId_);
+            return nullptr;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(DCAMERA_SYNC_LOCK_SLEEP_US));
     }
+}
+
+void DCameraStreamDataProcessProducer::UnlockSyncSharedData(SyncSharedData *sharedData)
+{
+    __atomic_store_n(const_cast<int *>(&sharedData->lock), DCAMERA_SYNC_UNLOCKED, __ATOMIC_RELEASE);
+}
+
+void DCameraStreamDataProcessProducer::WriteVideoClock(uint64_t videoPts)
+{
+    SyncSharedData *sharedData = LockSyncSharedData();
+    CHECK_AND_RETURN_LOG(sharedData == nullptr, "WriteVideoClock: lock sync data failed.");
+    sharedData->video_current_pts = videoPts;
+    sharedData->video_update_clock = static_cast<uint64_t>(GetNowTimeStampUs());
+    sharedData->reset = false;
+    UnlockSyncSharedData(sharedData);
+}
 
-    if (!syncBufferQueue_.empty() && syncBufferQueue_.size() >= DCAMERA_SYNC_WATERMARK) {
-        buffer = syncBufferQueue_.front();
-        syncBufferQueue_.pop_front();
+int32_t DCameraStreamDataProcessProducer::ScheduleVideoFrame(const std::shared_ptr<DataBuffer>& buffer,
+    int64_t& waitUs)
+{
+    if (captureGroup_ != nullptr) {
+        waitUs = captureGroup_->Align(groupMemberKey_, GetCaptureTimeUs(buffer->frameInfo_), GetNowTimeStampUs());
+        if (waitUs > 0) {
+            return DCAMERA_SYNC_HOLD;
+        }
+        std::lock_guard<std::mutex> lock(workModeParamMtx_);
+        if (!workModeParam_.isAVsync) {
+            return DCAMERA_SYNC_RELEASE;
+        }
     }
-    
-    return false; // don't exit
+    return SyncVideoFrame(static_cast<uint64_t>(buffer->frameInfo_.rawTime), waitUs);
 }
 
-int32_t DCameraStreamDataProcessProducer::SyncVideoFrame(uint64_t videoPtsUs)
+int32_t DCameraStreamDataProcessProducer::SyncVideoFrame(uint64_t videoPts, int64_t& waitUs)
 {
-    int64_t videoPts = static_cast<int64_t>(videoPtsUs / DCAMERA_NS_TO_MS); // us -> ms
-    int64_t audioPts = 0; // get audio timestamp from shared memory
-    int64_t audioUpdatePts = 0; // audio update time
-    float audioSpeed = 1.0f; // audio playback speed factor
-    bool ret = false;
-    CHECK_AND_RETURN_RET_LOG(syncMem_ == nullptr, DCAMERA_BAD_VALUE, "SyncVideoFrame: syncMem_ is nullptr.");
-    auto syncData = syncMem_->ReadFromAshmem(workModeParam_.sharedMemLen, 0);
-    SyncSharedData *readSyncSharedData = reinterpret_cast<SyncSharedData *>(const_cast<void *>(syncData));
-    CHECK_AND_RETURN_RET_LOG(readSyncSharedData == nullptr, DCAMERA_BAD_VALUE, "read SyncData failed");
-    // get voliate lock
-    while (!readSyncSharedData->lock) {
-        DHLOGI("readSyncSharedData->lock is false");
-        syncData = syncMem_->ReadFromAshmem(workModeParam_.sharedMemLen, 0);
-        readSyncSharedData = reinterpret_cast<SyncSharedData *>(const_cast<void *>(syncData));
-    }
-    readSyncSharedData->lock = 0;
-    ret = syncMem_->WriteToAshmem(static_cast<void *>(readSyncSharedData), sizeof(SyncSharedData), 0);
-    CHECK_AND_RETURN_RET_LOG(!ret, DCAMERA_BAD_VALUE, "write sync data failed!");
-    audioPts = static_cast<int64_t>(readSyncSharedData->audio_current_pts / DCAMERA_US_TO_MS); // us -> ms
-    audioUpdatePts = static_cast<int64_t>(readSyncSharedData->audio_update_clock / DCAMERA_US_TO_MS); // us -> ms
-    audioSpeed = readSyncSharedData->audio_speed;
-    readSyncSharedData->lock = 1;
-    ret = syncMem_->WriteToAshmem(static_cast<void *>(readSyncSharedData), sizeof(SyncSharedData), 0);
-    CHECK_AND_RETURN_RET_LOG(!ret, DCAMERA_BAD_VALUE, "write sync data failed!");
-
-    int64_t currentTime = static_cast<int64_t>(GetNowTimeStampMs());
-    int64_t estimatedPts = static_cast<int64_t>(audioPts + (currentTime - audioUpdatePts) * audioSpeed);
-
-    int64_t diff = static_cast<int64_t>(estimatedPts - videoPts); // calculate audio-video time difference
-    DHLOGD("SyncCheck: videoPts=%{public}" PRIu64 ", estimatedPts=%{public}" PRIu64 ", diff=%{public}" PRId64 "ms",
-           videoPts, estimatedPts, diff);
-
-    if (diff > DCAMERA_TIME_DIFF_MAX) {
-        int32_t queueSize = static_cast<int32_t>(syncBufferQueue_.size());
-        DHLOGI("SyncVideoFrame::late (diff=%{public}" PRId64 "ms, videoPts=%{public}" PRId64
-            "ms, queueSize:%{public}d), skip this frame.", diff, videoPts, queueSize);
+    waitUs = 0;
+    int64_t audioPtsUs = 0;
+    int64_t audioUpdateUs = 0;
+    float audioSpeed = 1.0f;
+    int32_t ret = ReadAudioClock(audioPtsUs, audioUpdateUs, audioSpeed);
+    CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, DCAMERA_BAD_VALUE, "SyncVideoFrame: read audio clock failed.");
+
+    int64_t nowUs = GetNowTimeStampUs();
+    int64_t videoPtsUs = static_cast<int64_t>(videoPts / DCAMERA_NS_TO_US);
+    if (audioUpdateUs <= 0 || nowUs - audioUpdateUs > DCAMERA_SYNC_STALE_CLOCK_US) {
+        // Audio is not rendering, there is no master clock to follow so the video runs at its own pace.
+        waitUs = framePacer_.Schedule(videoPtsUs, nowUs);
+        return (waitUs > 0) ? DCAMERA_SYNC_HOLD : DCAMERA_SYNC_RELEASE;
+    }
+    if (audioSpeed <= 0.0f) {
+        waitUs = DCAMERA_SYNC_MAX_HOLD_US;
+        return DCAMERA_SYNC_HOLD;
+    }
+    framePacer_.Rebase(videoPtsUs, nowUs);
+    int64_t estimatedPtsUs = audioPtsUs + static_cast<int64_t>((nowUs - audioUpdateUs) * audioSpeed);
+    int64_t diffUs = estimatedPtsUs - videoPtsUs; // calculate audio-video time difference
+    DHLOGD("SyncCheck: videoPts=%{public}" PRId64 "us, estimatedPts=%{public}" PRId64 "us, diff=%{public}" PRId64
+        "us", videoPtsUs, estimatedPtsUs, diffUs);
+
+    if (diffUs > DCAMERA_SYNC_LATE_US) {
+        int32_t queueSize = static_cast<int32_t>(syncBufferQueue_.Size());
+        DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "SyncVideoFrame::late (diff=%{public}" PRId64
+            "us, videoPts=%{public}" PRId64 "us, queueSize:%{public}d), skip this frame.", diffUs, videoPtsUs,
+            queueSize);
+        framePacer_.OnLate();
         // Drop if there is still data in the queue, play the last frame directly
-        return (queueSize > 0) ? -1 : 1;
-    } else if (diff < DCAMERA_TIME_DIFF_MIN) {
-        DHLOGI("SyncVideoFrame::early (diff=%{public}" PRId64 "ms, videoPts=%{public}" PRId64 "ms),"
-            " wait for next scheduling.", diff, videoPts);
-        return 0;
-    } else {
-        DHLOGD("SyncVideoFrame::Video frame in sync range, will be sent. diff=%{public}" PRId64 "ms", diff);
-        return 1;
+        return (queueSize > 0) ? DCAMERA_SYNC_DROP : DCAMERA_SYNC_RELEASE;
     }
+    if (diffUs < -DCAMERA_SYNC_EARLY_US) {
+        // Audio time advances audioSpeed times faster than the wall clock.
+        waitUs = std::min(static_cast<int64_t>(-diffUs / audioSpeed), DCAMERA_SYNC_MAX_HOLD_US);
+        framePacer_.OnEarly(videoPtsUs);
+        DHLOGD("SyncVideoFrame::early (diff=%{public}" PRId64 "us), hold %{public}" PRId64 "us.", diffUs, waitUs);
+        return DCAMERA_SYNC_HOLD;
+    }
+    return DCAMERA_SYNC_RELEASE;
 }
 
 void DCameraStreamDataProcessProducer::UpdateVideoClock(uint64_t videoPtsUs)
@@ -503,24 +820,7 @@ void DCameraStreamDataProcessProducer::UpdateVideoClock(uint64_t videoPtsUs)
     }
 
     CHECK_AND_RETURN_LOG(syncMem_ == nullptr, "UpdateVideoClock: syncMem_ is nullptr.");
-
-    auto syncData = syncMem_->ReadFromAshmem(workModeParam_.sharedMemLen, 0);
-    SyncSharedData *readSyncSharedData = reinterpret_cast<SyncSharedData *>(const_cast<void *>(syncData));
-    CHECK_AND_RETURN_LOG(readSyncSharedData == nullptr, "read SyncData failed");
-    while (!readSyncSharedData->lock) {
-        syncData = syncMem_->ReadFromAshmem(workModeParam_.sharedMemLen, 0);
-        readSyncSharedData = reinterpret_cast<SyncSharedData *>(const_cast<void *>(syncData));
-    }
-    readSyncSharedData->lock = 0;
-    bool ret = syncMem_->WriteToAshmem(static_cast<void *>(readSyncSharedData), sizeof(SyncSharedData), 0);
-    CHECK_AND_RETURN_LOG(!ret, "write sync data failed!");
-    readSyncSharedData->video_current_pts = videoPtsUs;
-    readSyncSharedData->video_update_clock = static_cast<uint64_t>(GetNowTimeStampUs());
-    readSyncSharedData->reset = false;
-    readSyncSharedData->lock = 1;
-    ret = syncMem_->WriteToAshmem(static_cast<void *>(readSyncSharedData), sizeof(SyncSharedData), 0);
-    CHECK_AND_RETURN_LOG(!ret, "write sync data failed!");
-    DHLOGD("Video update clock updated to: %" PRIu64 " us", readSyncSharedData->video_update_clock);
+    WriteVideoClock(videoPtsUs);
 }
 
 void DCameraStreamDataProcessProducer::UpdateProducerWorkMode(const WorkModeParam& param)
@@ -540,5 +840,27 @@ void DCameraStreamDataProcessProducer::UpdateProducerWorkMode(const WorkModePara
     }
     DHLOGI("update producer workmode success");
 }
+
+void DCameraStreamDataProcessProducer::SetDropCounter(const std::shared_ptr<DCameraStreamDropCounter>& dropCounter)
+{
+    dropCounter_ = dropCounter;
+}
+
+void DCameraStreamDataProcessProducer::SetMemoryAccount(const std::shared_ptr<DCameraMemoryAccount>& memoryAccount)
+{
+    memoryAccount_ = memoryAccount;
+}
+
+void DCameraStreamDataProcessProducer::SetFrameRate(int32_t fps)
+{
+    framePacer_.SetFrameRate(fps);
+}
+
+void DCameraStreamDataProcessProducer::CountDroppedFrames(DCameraDropReason reason, uint64_t count)
+{
+    if (dropCounter_ != nullptr && count > 0) {
+        dropCounter_->Add(reason, count);
+    }
+}
 } // namespace DistributedHardware
 } // namespace OHOS
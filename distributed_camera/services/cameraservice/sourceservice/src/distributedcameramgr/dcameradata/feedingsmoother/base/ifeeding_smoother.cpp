@@ -14,8 +14,17 @@
  */
 #include "ifeeding_smoother.h"
 #include "distributed_camera_constants.h"
-#include <sys/prctl.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <cerrno>
+#include <ctime>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "dcamera_thread_role.h"
 #include "dcamera_utils_tools.h"
+#include <algorithm>
 #include <cstdlib>
 #include "distributed_hardware_log.h"
 #include "smoother_constants.h"
@@ -60,6 +69,7 @@ int32_t IFeedingSmoother::StartSmooth()
     }
     InitTimeStatistician();
     PrepareSmooth();
+    InitSmoothTimer();
     smoothThread_ = std::thread([this]() { this->LooperSmooth(); });
     return SMOOTH_SUCCESS;
 }
@@ -67,7 +77,8 @@ int32_t IFeedingSmoother::StartSmooth()
 void IFeedingSmoother::LooperSmooth()
 {
     DHLOGI("Smoother start.");
-    prctl(PR_SET_NAME, LOOPER_SMOOTH.c_str());
+    DCameraThreadRoleRegistry::GetInstance().ApplyCurrentThread(DCAMERA_THREAD_OUTPUT, LOOPER_SMOOTH);
+    SetSmoothThreadPriority();
     while (state_ == SMOOTH_START) {
         std::shared_ptr<IFeedableData> data = nullptr;
         {
@@ -97,6 +108,7 @@ void IFeedingSmoother::SmoothFeeding(const std::shared_ptr<IFeedableData>& data)
 {
     CHECK_AND_RETURN_LOG(data == nullptr, "data is nullptr");
     int64_t enterTime = GetNowTimeStampUs();
+    int64_t enterClockNs = GetMonotonicTimeNs();
     SetClockTime(enterTime);
     int64_t timeStamp = data->GetTimeStamp();
     if (timeStamp == 0) {
@@ -107,10 +119,20 @@ void IFeedingSmoother::SmoothFeeding(const std::shared_ptr<IFeedableData>& data)
         return;
     }
 
+    UpdateTargetBufferTime();
+    if (isSmoothBypass_.load()) {
+        // Frames go out as they arrive, pacing restarts from a fresh baseline once smoothing resumes.
+        isBaselineInit_.store(false);
+        delta_ = 0;
+        sleep_ = 0;
+        RecordTime(enterTime, timeStamp);
+        return;
+    }
     if (!CheckIsBaselineInit()) {
         InitBaseline(timeStamp, clockTime_);
     }
     int64_t interval = timeStamp - lastTimeStamp_;
+    AdjustBufferTime(interval);
     int64_t elapse = enterTime - leaveTime_;
     int64_t render = enterTime - lastEnterTime_;
     int64_t delta = render - sleep_ - elapse;
@@ -119,15 +141,9 @@ void IFeedingSmoother::SmoothFeeding(const std::shared_ptr<IFeedableData>& data)
     sleep_ = interval - elapse;
     AdjustSleepTime(interval);
     SyncClock(timeStamp, interval, clock);
-    {
-        std::unique_lock<std::mutex> lock(sleepMutex_);
-        sleepCon_.wait_for(lock, std::chrono::microseconds(sleep_), [this] {
-            return (this->state_ == SMOOTH_STOP);
-        });
-        if (state_ == SMOOTH_STOP) {
-            DHLOGD("Notify to interrupt sleep.");
-            return;
-        }
+    if (!WaitUntil(enterClockNs + sleep_ * NS_PER_US)) {
+        DHLOGD("Notify to interrupt sleep.");
+        return;
     }
     RecordTime(enterTime, timeStamp);
 }
@@ -205,6 +221,21 @@ void IFeedingSmoother::AdjustSleepTime(const int64_t interval)
     }
 }
 
+void IFeedingSmoother::AdjustBufferTime(const int64_t interval)
+{
+    // Move towards the target a little per frame, a jump would show as a stall or a burst.
+    int64_t step = static_cast<int64_t>(interval * adjustSleepFactor_);
+    int64_t diff = targetBufferTime_ - bufferTime_;
+    if (diff == 0 || step <= 0) {
+        return;
+    }
+    diff = std::min(std::max(diff, -step), step);
+    bufferTime_ += diff;
+    clockBaseline_ += diff;
+    DHLOGD("Adjust buffer time to %{public}" PRId64" us, target %{public}" PRId64" us.", bufferTime_,
+        targetBufferTime_);
+}
+
 void IFeedingSmoother::SyncClock(const int64_t timeStamp, const int64_t interval, const int64_t clock)
 {
     const int64_t waitThre = interval * waitClockFactor_;
@@ -221,6 +252,89 @@ void IFeedingSmoother::SyncClock(const int64_t timeStamp, const int64_t interval
     DHLOGD("Offset is %{public}" PRId64" us, sleep is %{public}" PRId64" us after syncing clock.", offset, sleep_);
 }
 
+bool IFeedingSmoother::WaitUntil(const int64_t deadlineNs)
+{
+    if (timerFd_ < 0 || wakeupFd_ < 0) {
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        int64_t waitNs = std::max<int64_t>(deadlineNs - GetMonotonicTimeNs(), 0);
+        sleepCon_.wait_for(lock, std::chrono::nanoseconds(waitNs), [this] {
+            return (this->state_ == SMOOTH_STOP);
+        });
+        return state_ != SMOOTH_STOP;
+    }
+    if (deadlineNs <= GetMonotonicTimeNs()) {
+        return state_ != SMOOTH_STOP;
+    }
+    // An absolute deadline on the monotonic clock does not accumulate the wakeup latency of each relative wait.
+    struct itimerspec spec = {};
+    spec.it_value.tv_sec = static_cast<time_t>(deadlineNs / NS_PER_SECOND);
+    spec.it_value.tv_nsec = static_cast<long>(deadlineNs % NS_PER_SECOND);
+    if (timerfd_settime(timerFd_, TFD_TIMER_ABSTIME, &spec, nullptr) != 0) {
+        DHLOGE("Set smooth timer failed, errno %{public}d.", errno);
+        return state_ != SMOOTH_STOP;
+    }
+    struct pollfd fds[] = { { timerFd_, POLLIN, 0 }, { wakeupFd_, POLLIN, 0 } };
+    int32_t ret = 0;
+    do {
+        ret = poll(fds, sizeof(fds) / sizeof(fds[0]), -1);
+    } while (ret < 0 && errno == EINTR);
+    if (fds[0].revents & POLLIN) {
+        uint64_t expirations = 0;
+        (void)read(timerFd_, &expirations, sizeof(expirations));
+    }
+    return state_ != SMOOTH_STOP;
+}
+
+int64_t IFeedingSmoother::GetMonotonicTimeNs()
+{
+    struct timespec now = {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<int64_t>(now.tv_sec) * NS_PER_SECOND + now.tv_nsec;
+}
+
+void IFeedingSmoother::InitSmoothTimer()
+{
+    ReleaseSmoothTimer();
+    timerFd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    wakeupFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (timerFd_ < 0 || wakeupFd_ < 0) {
+        DHLOGE("Create smooth timer failed, errno %{public}d, fall back to condition wait.", errno);
+        ReleaseSmoothTimer();
+    }
+}
+
+void IFeedingSmoother::ReleaseSmoothTimer()
+{
+    if (timerFd_ >= 0) {
+        close(timerFd_);
+        timerFd_ = -1;
+    }
+    if (wakeupFd_ >= 0) {
+        close(wakeupFd_);
+        wakeupFd_ = -1;
+    }
+}
+
+void IFeedingSmoother::SetSmoothThreadPriority()
+{
+    int32_t policy = SCHED_OTHER;
+    if (!GetSysPara(RT_POLICY_PARA, policy) || (policy != SCHED_FIFO && policy != SCHED_RR)) {
+        return;
+    }
+    int32_t priority = sched_get_priority_min(policy);
+    GetSysPara(RT_PRIORITY_PARA, priority);
+    struct sched_param param = {};
+    param.sched_priority = std::min(std::max(priority, sched_get_priority_min(policy)),
+        sched_get_priority_max(policy));
+    int32_t ret = pthread_setschedparam(pthread_self(), policy, &param);
+    if (ret != 0) {
+        DHLOGE("Set smooth thread policy %{public}d priority %{public}d failed, ret %{public}d.", policy,
+            param.sched_priority, ret);
+        return;
+    }
+    DHLOGI("Smooth thread runs with policy %{public}d priority %{public}d.", policy, param.sched_priority);
+}
+
 void IFeedingSmoother::RecordTime(const int64_t enterTime, const int64_t timeStamp)
 {
     lastEnterTime_ = enterTime;
@@ -241,12 +355,18 @@ int32_t IFeedingSmoother::StopSmooth()
     }
     smoothCon_.notify_one();
     sleepCon_.notify_one();
+    if (wakeupFd_ >= 0) {
+        uint64_t value = 1;
+        (void)write(wakeupFd_, &value, sizeof(value));
+    }
     if (smoothThread_.joinable()) {
         smoothThread_.join();
     }
+    ReleaseSmoothTimer();
     statistician_ = nullptr;
     UnregisterListener();
 
+    discardedCount_.fetch_add(dataQueue_.size());
     std::queue<std::shared_ptr<IFeedableData>>().swap(dataQueue_);
     DHLOGD("Stop smooth success.");
     return SMOOTH_SUCCESS;
@@ -273,6 +393,21 @@ void IFeedingSmoother::UnregisterListener()
 void IFeedingSmoother::SetBufferTime(const int32_t time)
 {
     bufferTime_ = time;
+    targetBufferTime_ = time;
+}
+
+void IFeedingSmoother::SetTargetBufferTime(const int64_t time)
+{
+    targetBufferTime_ = time;
+}
+
+void IFeedingSmoother::SetSmoothBypassState(const bool state)
+{
+    isSmoothBypass_.store(state);
+}
+
+void IFeedingSmoother::UpdateTargetBufferTime()
+{
 }
 
 void IFeedingSmoother::SetDynamicBalanceThre(const uint8_t thre)
@@ -310,6 +445,21 @@ int64_t IFeedingSmoother::GetBufferTime()
     return bufferTime_;
 }
 
+int64_t IFeedingSmoother::GetTargetBufferTime()
+{
+    return targetBufferTime_;
+}
+
+bool IFeedingSmoother::GetSmoothBypassState()
+{
+    return isSmoothBypass_.load();
+}
+
+uint64_t IFeedingSmoother::GetDiscardedCount()
+{
+    return discardedCount_.load();
+}
+
 int64_t IFeedingSmoother::GetClockTime()
 {
     return clockTime_;
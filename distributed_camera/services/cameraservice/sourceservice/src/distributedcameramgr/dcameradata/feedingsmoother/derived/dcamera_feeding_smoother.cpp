@@ -14,6 +14,7 @@
  */
 #include "dcamera_feeding_smoother.h"
 #include "distributed_hardware_log.h"
+#include <algorithm>
 #include <memory>
 #include "data_buffer.h"
 #include "dcamera_utils_tools.h"
@@ -28,6 +29,37 @@ void DCameraFeedingSmoother::PrepareSmooth()
     SetDynamicBalanceThre(DYNAMIC_BALANCE_THRE);
     SetAverIntervalDiffThre(AVER_INTERVAL_DIFF_THRE_US);
     SetFeedOnceDiffThre(FEED_ONCE_DIFF_THRE_US);
+    SetSmoothBypassState(false);
+    InitJitterBufferPolicy();
+}
+
+void DCameraFeedingSmoother::InitJitterBufferPolicy()
+{
+    int32_t percentile = DEFAULT_JITTER_PERCENTILE;
+    if (!GetSysPara(JITTER_PERCENTILE_PARA, percentile) || percentile < 0 || percentile > MAX_JITTER_PERCENTILE) {
+        percentile = DEFAULT_JITTER_PERCENTILE;
+    }
+    jitterPercentile_ = static_cast<uint32_t>(percentile);
+    int32_t lowLatency = 0;
+    isLowLatency_ = GetSysPara(LOW_LATENCY_PARA, lowLatency) && (lowLatency == 1);
+    DHLOGI("Jitter buffer percentile %{public}u, low latency %{public}d.", jitterPercentile_, isLowLatency_);
+}
+
+void DCameraFeedingSmoother::UpdateTargetBufferTime()
+{
+    if (dCameraStatistician_ == nullptr || jitterPercentile_ == 0) {
+        return;
+    }
+    int64_t jitter = dCameraStatistician_->GetJitterDelay(jitterPercentile_);
+    if (jitter < 0) {
+        return;
+    }
+    if (isLowLatency_) {
+        // Separate enter and exit levels keep a link hovering at the threshold from toggling every frame.
+        int64_t threshold = GetSmoothBypassState() ? LOW_LATENCY_EXIT_JITTER_US : LOW_LATENCY_ENTER_JITTER_US;
+        SetSmoothBypassState(jitter < threshold);
+    }
+    SetTargetBufferTime(std::min(std::max(jitter + JITTER_MARGIN_US, MIN_BUFFER_TIME_US), MAX_BUFFER_TIME_US));
 }
 
 void DCameraFeedingSmoother::InitBaseline(const int64_t timeStampBaseline, const int64_t clockBaseline)
@@ -15,7 +15,9 @@
 #include "dcamera_time_statistician.h"
 #include "distributed_hardware_log.h"
 #include "distributed_camera_constants.h"
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -23,6 +25,7 @@ void DCameraTimeStatistician::CalProcessTime(const std::shared_ptr<IFeedableData
 {
     CHECK_AND_RETURN_LOG(data == nullptr, "data is nullptr");
     TimeStatistician::CalProcessTime(data);
+    CalJitter(feedTime_, timeStamp_);
     std::shared_ptr<DataBuffer> dataBuffer = std::reinterpret_pointer_cast<DataBuffer>(data);
     DCameraFrameInfo frameInfo = dataBuffer->frameInfo_;
     int64_t encode = frameInfo.timePonit.finishEncode - frameInfo.timePonit.startEncode;
@@ -64,6 +67,36 @@ void DCameraTimeStatistician::CalWholeProcessTime(const std::shared_ptr<DataBuff
         PRId64, smooth, sink, source, whole, self, averSmoothTime_, averSourceTime_, averWholeTime_);
 }
 
+void DCameraTimeStatistician::CalJitter(const int64_t arriveTime, const int64_t timeStamp)
+{
+    std::lock_guard<std::mutex> lock(jitterMutex_);
+    if (timeStamp <= lastJitterTimeStamp_) {
+        // The sender restarted its clock, the old transit times no longer compare.
+        transitIndex_ = 0;
+        transitCount_ = 0;
+    }
+    lastJitterTimeStamp_ = timeStamp;
+    transitTimes_[transitIndex_] = arriveTime - timeStamp;
+    transitIndex_ = (transitIndex_ + 1) % JITTER_WINDOW_SIZE;
+    transitCount_ = std::min(transitCount_ + 1, JITTER_WINDOW_SIZE);
+}
+
+int64_t DCameraTimeStatistician::GetJitterDelay(const uint32_t percentile)
+{
+    std::vector<int64_t> transits;
+    {
+        std::lock_guard<std::mutex> lock(jitterMutex_);
+        if (transitCount_ < JITTER_MIN_SAMPLES) {
+            return -1;
+        }
+        transits.assign(transitTimes_.begin(), transitTimes_.begin() + transitCount_);
+    }
+    int64_t minTransit = *std::min_element(transits.begin(), transits.end());
+    size_t rank = (transits.size() - 1) * std::min(percentile, PERCENT) / PERCENT;
+    std::nth_element(transits.begin(), transits.begin() + rank, transits.end());
+    return transits[rank] - minTransit;
+}
+
 void DCameraTimeStatistician::SetFrameIndex(const int32_t index)
 {
     frameIndex_ = index;
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_source_event_metrics.h"
+
+#include <algorithm>
+
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraSourceEventMetrics);
+
+int64_t DCameraSourceEventMetrics::GetDeadlineUs(DCAMERA_EVENT eventType)
+{
+    switch (eventType) {
+        case DCAMERA_EVENT_CLOSE:
+        case DCAMERA_EVENT_STOP_CAPTURE:
+            return STOP_DEADLINE_US;
+        case DCAMERA_EVENT_UPDATE_SETTINGS:
+            return SETTINGS_DEADLINE_US;
+        case DCAMERA_EVENT_OPEN:
+        case DCAMERA_EVENT_CONFIG_STREAMS:
+        case DCAMERA_EVENT_RELEASE_STREAMS:
+        case DCAMERA_EVENT_START_CAPTURE:
+            return START_DEADLINE_US;
+        case DCAMERA_EVENT_NOFIFY:
+            return NOTIFY_DEADLINE_US;
+        default:
+            return REGIST_DEADLINE_US;
+    }
+}
+
+bool DCameraSourceEventMetrics::OnEventStarted(DCAMERA_EVENT eventType, int64_t waitUs)
+{
+    waitUs = std::max<int64_t>(waitUs, 0);
+    bool isInTime = waitUs <= GetDeadlineUs(eventType);
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    DCameraSourceEventStats& stats = stats_[eventType];
+    stats.count++;
+    stats.totalWaitUs += waitUs;
+    stats.maxWaitUs = std::max(stats.maxWaitUs, waitUs);
+    if (!isInTime) {
+        stats.overDeadline++;
+    }
+    return isInTime;
+}
+
+void DCameraSourceEventMetrics::OnEventFinished(DCAMERA_EVENT eventType, int64_t runUs)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    DCameraSourceEventStats& stats = stats_[eventType];
+    stats.maxRunUs = std::max(stats.maxRunUs, runUs);
+}
+
+void DCameraSourceEventMetrics::OnEventSuperseded(DCAMERA_EVENT eventType)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    stats_[eventType].superseded++;
+}
+
+DCameraSourceEventStats DCameraSourceEventMetrics::GetStats(DCAMERA_EVENT eventType)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    auto iter = stats_.find(eventType);
+    return iter == stats_.end() ? DCameraSourceEventStats() : iter->second;
+}
+
+void DCameraSourceEventMetrics::Reset()
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    stats_.clear();
+}
+
+void DCameraSourceEventMetrics::Dump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    if (stats_.empty()) {
+        result.append("No source event handled\n");
+        return;
+    }
+    for (const auto& iter : stats_) {
+        const DCameraSourceEventStats& stats = iter.second;
+        int64_t avgWaitUs = stats.count == 0 ? 0 : stats.totalWaitUs / static_cast<int64_t>(stats.count);
+        result.append("Event: ").append(std::to_string(iter.first))
+            .append(" count: ").append(std::to_string(stats.count))
+            .append(" deadline: ").append(std::to_string(GetDeadlineUs(iter.first))).append("us")
+            .append(" over deadline: ").append(std::to_string(stats.overDeadline))
+            .append(" superseded: ").append(std::to_string(stats.superseded))
+            .append(" avg wait: ").append(std::to_string(avgWaitUs)).append("us")
+            .append(" max wait: ").append(std::to_string(stats.maxWaitUs)).append("us")
+            .append(" max run: ").append(std::to_string(stats.maxRunUs)).append("us")
+            .append("\n");
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "dcamera_source_state_machine.h"
 
+#include <cinttypes>
 #include <memory>
 
 #include "dcamera_source_state_factory.h"
@@ -35,15 +36,19 @@ DCameraSourceStateMachine::~DCameraSourceStateMachine()
 
 int32_t DCameraSourceStateMachine::Execute(DCAMERA_EVENT eventType, DCameraSourceEvent& event)
 {
-    CHECK_AND_RETURN_RET_LOG(currentState_ == nullptr, DCAMERA_BAD_VALUE,
+    std::shared_ptr<DCameraSourceState> tempState = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        tempState = currentState_;
+    }
+    CHECK_AND_RETURN_RET_LOG(tempState == nullptr, DCAMERA_BAD_VALUE,
         "DCameraSourceStateMachine currentState_ is nullptr, please check the state machine initialization");
-    DHLOGI("In state %{public}d execute event %{public}d", currentState_->GetStateType(), eventType);
+    DHLOGI("In state %{public}d execute event %{public}d", tempState->GetStateType(), eventType);
     std::shared_ptr<DCameraSourceDev> camDev = camDev_.lock();
     if (camDev == nullptr) {
         DHLOGE("DCameraSourceStateMachine execute failed, camDev is nullptr");
         return DCAMERA_BAD_VALUE;
     }
-    auto tempState = currentState_;
     int32_t ret = tempState->Execute(camDev, event.GetEventType(), event);
     if (ret != DCAMERA_OK) {
         DHLOGE("DCameraSourceStateMachine currentState_: %{public}d execute event: %{public}d failed",
@@ -54,6 +59,7 @@ int32_t DCameraSourceStateMachine::Execute(DCAMERA_EVENT eventType, DCameraSourc
 
 void DCameraSourceStateMachine::UpdateState(DCameraStateType stateType)
 {
+    std::lock_guard<std::mutex> lock(stateMutex_);
     if (currentState_ != nullptr && stateType != DCAMERA_STATE_INIT) {
         DHLOGI("DCameraSourceStateMachine update state from %{public}d to %{public}d",
             currentState_->GetStateType(), stateType);
@@ -66,10 +72,53 @@ void DCameraSourceStateMachine::UpdateState(DCameraStateType stateType)
 
 int32_t DCameraSourceStateMachine::GetCameraState()
 {
+    std::lock_guard<std::mutex> lock(stateMutex_);
     CHECK_AND_RETURN_RET_LOG(currentState_ == nullptr, DCAMERA_BAD_VALUE,
         "DCameraSourceStateMachine currentState_ is nullptr");
     DHLOGI("GetCameraState In state %{public}d", currentState_->GetStateType());
     return currentState_->GetStateType();
 }
+
+bool DCameraSourceStateMachine::IsControlEvent(DCAMERA_EVENT eventType)
+{
+    // Stop capture changes the state and has to stay behind the captures it stops, it is a lifecycle event.
+    return eventType == DCAMERA_EVENT_UPDATE_SETTINGS;
+}
+
+int64_t DCameraSourceStateMachine::OnLifecycleEventPosted()
+{
+    std::lock_guard<std::mutex> lock(laneMutex_);
+    return ++postedSeq_;
+}
+
+int64_t DCameraSourceStateMachine::GetLastLifecycleEvent()
+{
+    std::lock_guard<std::mutex> lock(laneMutex_);
+    return postedSeq_;
+}
+
+void DCameraSourceStateMachine::OnLifecycleEventStarted(int64_t seq)
+{
+    {
+        std::lock_guard<std::mutex> lock(laneMutex_);
+        if (seq <= startedSeq_) {
+            return;
+        }
+        startedSeq_ = seq;
+    }
+    laneCond_.notify_all();
+}
+
+bool DCameraSourceStateMachine::WaitLifecycleEventStarted(int64_t seq)
+{
+    std::unique_lock<std::mutex> lock(laneMutex_);
+    bool isStarted = laneCond_.wait_for(lock, std::chrono::milliseconds(LIFECYCLE_WAIT_TIMEOUT_MS),
+        [this, seq]() { return startedSeq_ >= seq; });
+    if (!isStarted) {
+        DHLOGW("lifecycle event %{public}" PRId64 " not started in time, started: %{public}" PRId64, seq,
+            startedSeq_);
+    }
+    return isStarted;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
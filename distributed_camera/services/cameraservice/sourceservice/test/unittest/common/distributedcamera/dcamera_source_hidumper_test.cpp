@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,7 +15,9 @@
 
 #include <gtest/gtest.h>
 
+#include "dcamera_source_event_metrics.h"
 #include "dcamera_source_hidumper.h"
+#include "dcamera_startup_profiler.h"
 #include "distributed_hardware_log.h"
 
 using namespace testing::ext;
@@ -185,5 +187,142 @@ HWTEST_F(DcameraSourceHidumperTest, dcamera_source_hidumper_test_008, TestSize.L
     bool ret = DcameraSourceHidumper::GetInstance().Dump(args, result);
     EXPECT_EQ(true, ret);
 }
+/**
+ * @tc.name: dcamera_source_hidumper_test_009
+ * @tc.desc: Verify the latency dump and reset commands.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DcameraSourceHidumperTest, dcamera_source_hidumper_test_009, TestSize.Level1)
+{
+    DHLOGI("DcameraSourceHidumperTest::dcamera_source_hidumper_test_009");
+    std::vector<std::string> args;
+    args.push_back("--latency");
+    std::string result;
+    bool ret = DcameraSourceHidumper::GetInstance().Dump(args, result);
+    EXPECT_EQ(true, ret);
+    EXPECT_FALSE(result.empty());
+
+    args.clear();
+    args.push_back("--resetLatency");
+    ret = DcameraSourceHidumper::GetInstance().Dump(args, result);
+    EXPECT_EQ(true, ret);
+    EXPECT_EQ("Reset latency statistics ok\n", result);
+}
+
+/**
+ * @tc.name: dcamera_source_hidumper_test_010
+ * @tc.desc: Verify the pipeline stats dump command.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DcameraSourceHidumperTest, dcamera_source_hidumper_test_010, TestSize.Level1)
+{
+    DHLOGI("DcameraSourceHidumperTest::dcamera_source_hidumper_test_010");
+    std::vector<std::string> args;
+    args.push_back("--pipelineStats");
+    std::string result;
+    bool ret = DcameraSourceHidumper::GetInstance().Dump(args, result);
+    EXPECT_EQ(true, ret);
+    EXPECT_FALSE(result.empty());
+}
+
+/**
+ * @tc.name: dcamera_source_hidumper_test_011
+ * @tc.desc: Verify the frame drop dump command.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DcameraSourceHidumperTest, dcamera_source_hidumper_test_011, TestSize.Level1)
+{
+    DHLOGI("DcameraSourceHidumperTest::dcamera_source_hidumper_test_011");
+    std::vector<std::string> args;
+    args.push_back("--frameDrop");
+    std::string result;
+    bool ret = DcameraSourceHidumper::GetInstance().Dump(args, result);
+    EXPECT_EQ(true, ret);
+    EXPECT_FALSE(result.empty());
+}
+
+/**
+ * @tc.name: dcamera_source_hidumper_test_012
+ * @tc.desc: Verify the memory dump command.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DcameraSourceHidumperTest, dcamera_source_hidumper_test_012, TestSize.Level1)
+{
+    DHLOGI("DcameraSourceHidumperTest::dcamera_source_hidumper_test_012");
+    std::vector<std::string> args;
+    args.push_back("--memory");
+    std::string result;
+    bool ret = DcameraSourceHidumper::GetInstance().Dump(args, result);
+    EXPECT_EQ(true, ret);
+    EXPECT_FALSE(result.empty());
+}
+
+/**
+ * @tc.name: dcamera_source_hidumper_test_013
+ * @tc.desc: Verify the startup dump command lists a recorded phase once.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DcameraSourceHidumperTest, dcamera_source_hidumper_test_013, TestSize.Level1)
+{
+    DHLOGI("DcameraSourceHidumperTest::dcamera_source_hidumper_test_013");
+    const std::string phase = "HidumperTestPhase";
+    {
+        DCameraStartupPhase startupPhase(phase);
+    }
+    {
+        DCameraStartupPhase startupPhase(phase);
+    }
+    std::vector<std::string> args;
+    args.push_back("--startup");
+    std::string result;
+    bool ret = DcameraSourceHidumper::GetInstance().Dump(args, result);
+    EXPECT_EQ(true, ret);
+    size_t pos = result.find(phase);
+    ASSERT_NE(std::string::npos, pos);
+    EXPECT_EQ(std::string::npos, result.find(phase, pos + phase.size()));
+}
+
+/**
+ * @tc.name: dcamera_source_hidumper_test_014
+ * @tc.desc: Verify the capture group dump command reports when no group is bound.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DcameraSourceHidumperTest, dcamera_source_hidumper_test_014, TestSize.Level1)
+{
+    DHLOGI("DcameraSourceHidumperTest::dcamera_source_hidumper_test_014");
+    std::vector<std::string> args;
+    args.push_back("--captureGroup");
+    std::string result;
+    bool ret = DcameraSourceHidumper::GetInstance().Dump(args, result);
+    EXPECT_EQ(true, ret);
+    EXPECT_NE(std::string::npos, result.find("No capture group bound"));
+}
+
+/**
+ * @tc.name: dcamera_source_hidumper_test_015
+ * @tc.desc: Verify the event stats dump command lists the deadline of a handled event type.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DcameraSourceHidumperTest, dcamera_source_hidumper_test_015, TestSize.Level1)
+{
+    DHLOGI("DcameraSourceHidumperTest::dcamera_source_hidumper_test_015");
+    DCameraSourceEventMetrics::GetInstance().Reset();
+    DCameraSourceEventMetrics::GetInstance().OnEventStarted(DCAMERA_EVENT_CLOSE, 0);
+    std::vector<std::string> args;
+    args.push_back("--eventStats");
+    std::string result;
+    bool ret = DcameraSourceHidumper::GetInstance().Dump(args, result);
+    EXPECT_EQ(true, ret);
+    std::string deadline = std::to_string(DCameraSourceEventMetrics::STOP_DEADLINE_US) + "us";
+    EXPECT_NE(std::string::npos, result.find("deadline: " + deadline));
+    DCameraSourceEventMetrics::GetInstance().Reset();
+}
 } // namespace DistributedHardware
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <new>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "ashmem.h"
+#define private public
+#include "dcamera_buffer_ring.h"
+#undef private
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const int32_t TEST_STREAM_ID = 1;
+const int32_t TEST_BUFFER_INDEX = 2;
+const int32_t TEST_BUFFER_SIZE = 1024;
+const int32_t TEST_FILLED_SIZE = 512;
+const int64_t TEST_CAPTURE_TIME_US = 123456;
+const uint32_t TEST_SEQ_NUM = 7;
+const size_t TEST_PAGE_SIZE = 4096;
+}
+
+class DCameraBufferRingTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    // Plays the driver end, which creates the ring memory and the event fd.
+    bool CreateDriverRing(uint32_t version);
+
+    int32_t ringFd_ = -1;
+    int32_t eventFd_ = -1;
+    DCameraRingLayout *layout_ = nullptr;
+    int32_t getBufferCount_ = 0;
+    std::shared_ptr<DCameraBufferRing> ring_ = nullptr;
+};
+
+void DCameraBufferRingTest::SetUpTestCase(void)
+{
+    DHLOGI("DCameraBufferRingTest SetUpTestCase");
+}
+
+void DCameraBufferRingTest::TearDownTestCase(void)
+{
+    DHLOGI("DCameraBufferRingTest TearDownTestCase");
+}
+
+void DCameraBufferRingTest::SetUp(void)
+{
+    getBufferCount_ = 0;
+    ring_ = std::make_shared<DCameraBufferRing>(TEST_STREAM_ID, [this](int32_t index, DCameraBuffer& buffer) {
+        getBufferCount_++;
+        return DCAMERA_BAD_OPERATE;
+    });
+}
+
+void DCameraBufferRingTest::TearDown(void)
+{
+    ring_ = nullptr;
+    if (layout_ != nullptr) {
+        munmap(layout_, sizeof(DCameraRingLayout));
+        layout_ = nullptr;
+    }
+}
+
+bool DCameraBufferRingTest::CreateDriverRing(uint32_t version)
+{
+    ringFd_ = AshmemCreate("dcamera_ring_test", sizeof(DCameraRingLayout));
+    eventFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (ringFd_ < 0 || eventFd_ < 0) {
+        return false;
+    }
+    void *addr = mmap(nullptr, sizeof(DCameraRingLayout), PROT_READ | PROT_WRITE, MAP_SHARED, ringFd_, 0);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+    layout_ = new (addr) DCameraRingLayout();
+    layout_->magic = DCAMERA_RING_MAGIC;
+    layout_->version = version;
+    return true;
+}
+
+/**
+ * @tc.name: dcamera_buffer_ring_test_001
+ * @tc.desc: Verify Init refuses invalid fds, a too small ashmem ring and a ring of another layout version.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraBufferRingTest, dcamera_buffer_ring_test_001, TestSize.Level1)
+{
+    DHLOGI("dcamera_buffer_ring_test_001");
+    EXPECT_NE(DCAMERA_OK, ring_->Init(-1, -1));
+    int32_t smallFd = AshmemCreate("dcamera_ring_small", sizeof(DCameraRingLayout) / 2);
+    ASSERT_GE(smallFd, 0);
+    ASSERT_LT(AshmemGetSize(smallFd), static_cast<int>(sizeof(DCameraRingLayout)));
+    EXPECT_EQ(DCAMERA_BAD_VALUE, ring_->Init(smallFd, eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)));
+    EXPECT_EQ(-1, ring_->ringFd_);
+    ASSERT_TRUE(CreateDriverRing(DCAMERA_RING_VERSION + 1));
+    EXPECT_NE(DCAMERA_OK, ring_->Init(ringFd_, eventFd_));
+    EXPECT_EQ(nullptr, ring_->layout_);
+    EXPECT_EQ(-1, ring_->ringFd_);
+    DCameraBuffer buffer;
+    EXPECT_EQ(nullptr, ring_->AcquireBuffer(TEST_BUFFER_SIZE, buffer));
+    EXPECT_NE(DCAMERA_OK, ring_->ShutterBuffer(buffer));
+}
+
+/**
+ * @tc.name: dcamera_buffer_ring_test_002
+ * @tc.desc: Verify filled buffers are queued with a wakeup and an unusable free buffer goes straight back.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraBufferRingTest, dcamera_buffer_ring_test_002, TestSize.Level1)
+{
+    DHLOGI("dcamera_buffer_ring_test_002");
+    ASSERT_TRUE(CreateDriverRing(DCAMERA_RING_VERSION));
+    int32_t eventFd = dup(eventFd_);
+    ASSERT_EQ(DCAMERA_OK, ring_->Init(ringFd_, eventFd_));
+    DCameraBuffer buffer;
+    EXPECT_EQ(nullptr, ring_->AcquireBuffer(TEST_BUFFER_SIZE, buffer));
+
+    buffer.index_ = TEST_BUFFER_INDEX;
+    buffer.size_ = TEST_FILLED_SIZE;
+    EXPECT_EQ(DCAMERA_OK, ring_->ShutterBuffer(buffer, TEST_CAPTURE_TIME_US));
+    EXPECT_EQ(1U, layout_->filledQueue.tail.load());
+    EXPECT_EQ(TEST_BUFFER_INDEX, layout_->filledQueue.entries[0].index);
+    EXPECT_EQ(TEST_FILLED_SIZE, layout_->filledQueue.entries[0].size);
+    EXPECT_EQ(TEST_CAPTURE_TIME_US, layout_->filledQueue.entries[0].captureTimeUs);
+    uint64_t value = 0;
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(value)), read(eventFd, &value, sizeof(value)));
+
+    // A buffer without a sequence number cannot be mapped once, it is handed back unused.
+    layout_->freeQueue.entries[0] = { TEST_BUFFER_INDEX, TEST_BUFFER_SIZE, 0, 0 };
+    layout_->freeQueue.tail.store(1);
+    EXPECT_EQ(nullptr, ring_->AcquireBuffer(TEST_BUFFER_SIZE, buffer));
+    EXPECT_EQ(0, getBufferCount_);
+    EXPECT_EQ(1U, layout_->freeQueue.head.load());
+    EXPECT_EQ(2U, layout_->filledQueue.tail.load());
+    EXPECT_EQ(0, layout_->filledQueue.entries[1].size);
+
+    // A handle the driver refuses to hand out also sends the buffer back.
+    layout_->freeQueue.entries[1] = { TEST_BUFFER_INDEX, TEST_BUFFER_SIZE, 1, 0 };
+    layout_->freeQueue.tail.store(2);
+    EXPECT_EQ(nullptr, ring_->AcquireBuffer(TEST_BUFFER_SIZE, buffer));
+    EXPECT_EQ(1, getBufferCount_);
+    EXPECT_EQ(3U, layout_->filledQueue.tail.load());
+    close(eventFd);
+}
+
+/**
+ * @tc.name: dcamera_buffer_ring_test_003
+ * @tc.desc: Verify a buffer goes back through the provider when the filled queue is full.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraBufferRingTest, dcamera_buffer_ring_test_003, TestSize.Level1)
+{
+    DHLOGI("dcamera_buffer_ring_test_003");
+    int32_t shutterIndex = -1;
+    ring_ = std::make_shared<DCameraBufferRing>(TEST_STREAM_ID, nullptr, [&shutterIndex](const DCameraBuffer& buffer) {
+        shutterIndex = buffer.index_;
+        return DCAMERA_OK;
+    });
+    ASSERT_TRUE(CreateDriverRing(DCAMERA_RING_VERSION));
+    ASSERT_EQ(DCAMERA_OK, ring_->Init(ringFd_, eventFd_));
+    layout_->filledQueue.tail.store(DCAMERA_RING_CAPACITY);
+    DCameraBuffer buffer;
+    buffer.index_ = TEST_BUFFER_INDEX;
+    buffer.size_ = TEST_FILLED_SIZE;
+    EXPECT_EQ(DCAMERA_OK, ring_->ShutterBuffer(buffer, TEST_CAPTURE_TIME_US));
+    EXPECT_EQ(TEST_BUFFER_INDEX, shutterIndex);
+    EXPECT_EQ(DCAMERA_RING_CAPACITY, layout_->filledQueue.tail.load());
+}
+
+/**
+ * @tc.name: dcamera_buffer_ring_test_004
+ * @tc.desc: Verify a full map cache only drops the mappings with no buffer out.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraBufferRingTest, dcamera_buffer_ring_test_004, TestSize.Level1)
+{
+    DHLOGI("dcamera_buffer_ring_test_004");
+    ASSERT_TRUE(CreateDriverRing(DCAMERA_RING_VERSION));
+    ASSERT_EQ(DCAMERA_OK, ring_->Init(ringFd_, eventFd_));
+    for (uint32_t seqNum = 1; seqNum <= DCameraBufferRing::MAX_MAPPED_BUFFERS; seqNum++) {
+        void *addr = mmap(nullptr, TEST_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ASSERT_NE(MAP_FAILED, addr);
+        ring_->mappedBuffers_[seqNum] = { addr, TEST_PAGE_SIZE, seqNum == TEST_SEQ_NUM ? 1U : 0U };
+    }
+    ring_->outBufferSeqNums_[TEST_BUFFER_INDEX] = TEST_SEQ_NUM;
+    {
+        std::lock_guard<std::mutex> autoLock(ring_->mappedMutex_);
+        ring_->EvictIdleLocked();
+    }
+    ASSERT_EQ(1U, ring_->mappedBuffers_.size());
+    EXPECT_EQ(1U, ring_->mappedBuffers_[TEST_SEQ_NUM].refCount);
+
+    DCameraBuffer buffer;
+    buffer.index_ = TEST_BUFFER_INDEX;
+    buffer.size_ = TEST_FILLED_SIZE;
+    EXPECT_EQ(DCAMERA_OK, ring_->ShutterBuffer(buffer));
+    EXPECT_EQ(0U, ring_->mappedBuffers_[TEST_SEQ_NUM].refCount);
+    EXPECT_TRUE(ring_->outBufferSeqNums_.empty());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "dcamera_capture_group.h"
+#undef private
+#include "distributed_hardware_log.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_GROUP_ID = "stereo";
+const std::string TEST_MEMBER_LEFT = "left";
+const std::string TEST_MEMBER_RIGHT = "right";
+const std::string TEST_DEV_ID = "test_dev";
+const std::string TEST_DH_ID_0 = "camera_0";
+const std::string TEST_DH_ID_1 = "camera_1";
+const int64_t TEST_NOW_US = 10000000;
+const int64_t TEST_CAPTURE_US = 5000000;
+const int64_t TEST_FRAME_US = 33333;
+}
+
+class DCameraCaptureGroupTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<DCameraCaptureGroup> group_ = nullptr;
+};
+
+void DCameraCaptureGroupTest::SetUpTestCase(void)
+{
+    DHLOGI("DCameraCaptureGroupTest SetUpTestCase");
+}
+
+void DCameraCaptureGroupTest::TearDownTestCase(void)
+{
+    DHLOGI("DCameraCaptureGroupTest TearDownTestCase");
+}
+
+void DCameraCaptureGroupTest::SetUp(void)
+{
+    group_ = std::make_shared<DCameraCaptureGroup>(TEST_GROUP_ID);
+    group_->Join(TEST_MEMBER_LEFT, TEST_NOW_US);
+    group_->Join(TEST_MEMBER_RIGHT, TEST_NOW_US);
+}
+
+void DCameraCaptureGroupTest::TearDown(void)
+{
+    DCameraCaptureGroupManager::GetInstance().Unbind(TEST_DEV_ID, TEST_DH_ID_0);
+    DCameraCaptureGroupManager::GetInstance().Unbind(TEST_DEV_ID, TEST_DH_ID_1);
+    group_ = nullptr;
+}
+
+/**
+ * @tc.name: dcamera_capture_group_test_001
+ * @tc.desc: Verify a frame is held until the slower member delivers the same instant.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraCaptureGroupTest, dcamera_capture_group_test_001, TestSize.Level1)
+{
+    DHLOGI("dcamera_capture_group_test_001");
+    EXPECT_EQ(DCameraCaptureGroup::POLL_INTERVAL_US, group_->Align(TEST_MEMBER_LEFT, TEST_CAPTURE_US, TEST_NOW_US));
+    int64_t nowUs = TEST_NOW_US + DCameraCaptureGroup::POLL_INTERVAL_US;
+    int64_t rightCaptureUs = TEST_CAPTURE_US - DCameraCaptureGroup::ALIGN_TOLERANCE_US / 2;
+    EXPECT_EQ(0, group_->Align(TEST_MEMBER_RIGHT, rightCaptureUs, nowUs));
+    EXPECT_EQ(0, group_->Align(TEST_MEMBER_LEFT, TEST_CAPTURE_US, nowUs));
+    EXPECT_EQ(DCameraCaptureGroup::POLL_INTERVAL_US,
+        group_->Align(TEST_MEMBER_RIGHT, rightCaptureUs + TEST_FRAME_US, nowUs));
+    DCameraCaptureGroupStats stats = group_->GetStats();
+    EXPECT_EQ(2U, stats.aligned);
+    EXPECT_EQ(0U, stats.expired);
+}
+
+/**
+ * @tc.name: dcamera_capture_group_test_002
+ * @tc.desc: Verify a member that falls behind holds the others no longer than the latency budget.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraCaptureGroupTest, dcamera_capture_group_test_002, TestSize.Level1)
+{
+    DHLOGI("dcamera_capture_group_test_002");
+    int64_t nowUs = TEST_NOW_US + DCameraCaptureGroup::POLL_INTERVAL_US;
+    group_->Align(TEST_MEMBER_RIGHT, TEST_CAPTURE_US - TEST_FRAME_US, nowUs);
+    EXPECT_GT(group_->Align(TEST_MEMBER_LEFT, TEST_CAPTURE_US, nowUs), 0);
+    int64_t nearBudgetUs = nowUs + DCameraCaptureGroup::LATENCY_BUDGET_US - 1;
+    EXPECT_EQ(1, group_->Align(TEST_MEMBER_LEFT, TEST_CAPTURE_US, nearBudgetUs));
+    EXPECT_EQ(0, group_->Align(TEST_MEMBER_LEFT, TEST_CAPTURE_US, nowUs + DCameraCaptureGroup::LATENCY_BUDGET_US));
+    EXPECT_EQ(1U, group_->GetStats().expired);
+
+    // A stalled member is left out of the next frame.
+    int64_t laterUs = nowUs + DCameraCaptureGroup::LATENCY_BUDGET_US + 1;
+    EXPECT_EQ(0, group_->Align(TEST_MEMBER_LEFT, TEST_CAPTURE_US + TEST_FRAME_US, laterUs));
+    group_->Leave(TEST_MEMBER_RIGHT);
+    EXPECT_EQ(1U, group_->GetMemberCount());
+    EXPECT_EQ(0, group_->Align(TEST_MEMBER_RIGHT, TEST_CAPTURE_US, laterUs));
+}
+
+/**
+ * @tc.name: dcamera_capture_group_test_003
+ * @tc.desc: Verify the first frames of a group wait for every member to start.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraCaptureGroupTest, dcamera_capture_group_test_003, TestSize.Level1)
+{
+    DHLOGI("dcamera_capture_group_test_003");
+    EXPECT_GT(group_->Align(TEST_MEMBER_LEFT, TEST_CAPTURE_US, TEST_NOW_US + 1), 0);
+    group_->Leave(TEST_MEMBER_RIGHT);
+    EXPECT_EQ(0, group_->Align(TEST_MEMBER_LEFT, TEST_CAPTURE_US, TEST_NOW_US + 1));
+}
+
+/**
+ * @tc.name: dcamera_capture_group_test_004
+ * @tc.desc: Verify cameras bound to one group share it until the last one is unbound.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraCaptureGroupTest, dcamera_capture_group_test_004, TestSize.Level1)
+{
+    DHLOGI("dcamera_capture_group_test_004");
+    DCameraCaptureGroupManager& manager = DCameraCaptureGroupManager::GetInstance();
+    EXPECT_EQ(nullptr, manager.Find(TEST_DEV_ID, TEST_DH_ID_0));
+    manager.Bind(TEST_GROUP_ID, TEST_DEV_ID, TEST_DH_ID_0);
+    manager.Bind(TEST_GROUP_ID, TEST_DEV_ID, TEST_DH_ID_1);
+    std::shared_ptr<DCameraCaptureGroup> group = manager.Find(TEST_DEV_ID, TEST_DH_ID_0);
+    ASSERT_NE(nullptr, group);
+    EXPECT_EQ(group, manager.Find(TEST_DEV_ID, TEST_DH_ID_1));
+    std::string result;
+    manager.Dump(result);
+    EXPECT_NE(std::string::npos, result.find(TEST_GROUP_ID));
+
+    manager.Unbind(TEST_DEV_ID, TEST_DH_ID_0);
+    EXPECT_EQ(nullptr, manager.Find(TEST_DEV_ID, TEST_DH_ID_0));
+    EXPECT_EQ(group, manager.Find(TEST_DEV_ID, TEST_DH_ID_1));
+    manager.Unbind(TEST_DEV_ID, TEST_DH_ID_1);
+    EXPECT_TRUE(manager.groups_.empty());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <unistd.h>
 #define private public
 #include "dcamera_feeding_smoother.h"
 #undef private
@@ -287,5 +288,107 @@ HWTEST_F(DCameraFeedingSmotherTest, dcamera_feeding_smoother_test_008, TestSize.
     ret = smoother->StopSmooth();
     EXPECT_EQ(SMOOTH_SUCCESS, ret);
 }
+
+/**
+ * @tc.name: dcamera_feeding_smoother_test_009
+ * @tc.desc: Verify the jitter delay is the chosen percentile of the transit spread.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraFeedingSmotherTest, dcamera_feeding_smoother_test_009, TestSize.Level1)
+{
+    DHLOGI("dcamera_feeding_smoother_test_009");
+    const int64_t transit = 30000;
+    const int64_t spike = 15000;
+    const int32_t spikeEvery = 10;
+    const int32_t frameNum = 100;
+    const uint32_t percentileHigh = 95;
+    const uint32_t percentileMedian = 50;
+    std::shared_ptr<DCameraTimeStatistician> statistician = std::make_shared<DCameraTimeStatistician>();
+    EXPECT_EQ(-1, statistician->GetJitterDelay(percentileHigh));
+    for (int32_t i = 1; i <= frameNum; i++) {
+        int64_t timeStamp = i * FRAME_INTERVAL;
+        int64_t delay = (i % spikeEvery == 0) ? spike : 0;
+        statistician->CalJitter(timeStamp + transit + delay, timeStamp);
+    }
+    EXPECT_EQ(spike, statistician->GetJitterDelay(percentileHigh));
+    EXPECT_EQ(0, statistician->GetJitterDelay(percentileMedian));
+
+    statistician->CalJitter(FRAME_INTERVAL + transit, FRAME_INTERVAL);
+    EXPECT_EQ(-1, statistician->GetJitterDelay(percentileHigh));
+}
+
+/**
+ * @tc.name: dcamera_feeding_smoother_test_010
+ * @tc.desc: Verify the buffer time follows the jitter target step by step and low jitter bypasses smoothing.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraFeedingSmotherTest, dcamera_feeding_smoother_test_010, TestSize.Level1)
+{
+    DHLOGI("dcamera_feeding_smoother_test_010");
+    const int32_t frameNum = 20;
+    std::unique_ptr<DCameraFeedingSmoother> smoother = std::make_unique<DCameraFeedingSmoother>();
+    smoother->InitTimeStatistician();
+    smoother->PrepareSmooth();
+    int64_t bufferTime = smoother->GetBufferTime();
+    smoother->SetTargetBufferTime(bufferTime + FRAME_INTERVAL);
+    smoother->AdjustBufferTime(FRAME_INTERVAL);
+    EXPECT_GT(smoother->GetBufferTime(), bufferTime);
+    EXPECT_LT(smoother->GetBufferTime(), bufferTime + FRAME_INTERVAL);
+    for (int32_t i = 0; i < frameNum; i++) {
+        smoother->AdjustBufferTime(FRAME_INTERVAL);
+    }
+    EXPECT_EQ(bufferTime + FRAME_INTERVAL, smoother->GetBufferTime());
+
+    for (int32_t i = 1; i <= frameNum; i++) {
+        smoother->dCameraStatistician_->CalJitter(i * FRAME_INTERVAL + FRAME_INTERVAL, i * FRAME_INTERVAL);
+    }
+    smoother->jitterPercentile_ = DCameraFeedingSmoother::DEFAULT_JITTER_PERCENTILE;
+    smoother->isLowLatency_ = true;
+    smoother->UpdateTargetBufferTime();
+    EXPECT_TRUE(smoother->GetSmoothBypassState());
+    EXPECT_EQ(DCameraFeedingSmoother::MIN_BUFFER_TIME_US, smoother->GetTargetBufferTime());
+    smoother->isLowLatency_ = false;
+    smoother->SetSmoothBypassState(false);
+    smoother->UpdateTargetBufferTime();
+    EXPECT_FALSE(smoother->GetSmoothBypassState());
+}
+/**
+ * @tc.name: dcamera_feeding_smoother_test_011
+ * @tc.desc: Verify the smoother waits for the absolute deadline and a stop interrupts the wait.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraFeedingSmotherTest, dcamera_feeding_smoother_test_011, TestSize.Level1)
+{
+    DHLOGI("dcamera_feeding_smoother_test_011");
+    const int64_t waitNs = 10000000;
+    const int64_t longWaitNs = 5000000000;
+    std::unique_ptr<DCameraFeedingSmoother> smoother = std::make_unique<DCameraFeedingSmoother>();
+    smoother->InitSmoothTimer();
+    EXPECT_GE(smoother->timerFd_, 0);
+    EXPECT_GE(smoother->wakeupFd_, 0);
+    smoother->state_ = SMOOTH_START;
+    int64_t start = smoother->GetMonotonicTimeNs();
+    EXPECT_TRUE(smoother->WaitUntil(start + waitNs));
+    EXPECT_GE(smoother->GetMonotonicTimeNs(), start + waitNs);
+    EXPECT_TRUE(smoother->WaitUntil(start));
+
+    smoother->state_ = SMOOTH_STOP;
+    uint64_t value = 1;
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(value)), write(smoother->wakeupFd_, &value, sizeof(value)));
+    start = smoother->GetMonotonicTimeNs();
+    EXPECT_FALSE(smoother->WaitUntil(start + longWaitNs));
+    EXPECT_LT(smoother->GetMonotonicTimeNs(), start + longWaitNs);
+
+    smoother->ReleaseSmoothTimer();
+    EXPECT_EQ(-1, smoother->timerFd_);
+    smoother->state_ = SMOOTH_START;
+    start = smoother->GetMonotonicTimeNs();
+    EXPECT_TRUE(smoother->WaitUntil(start + waitNs));
+    EXPECT_GE(smoother->GetMonotonicTimeNs(), start + waitNs);
+    smoother->state_ = SMOOTH_STOP;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
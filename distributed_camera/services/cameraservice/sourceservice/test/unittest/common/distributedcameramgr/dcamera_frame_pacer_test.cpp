@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "dcamera_frame_pacer.h"
+#undef private
+#include "distributed_hardware_log.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const int64_t TEST_WALL_BASE_US = 5000000;
+const int64_t TEST_PTS_BASE_US = 1000000;
+const int64_t TEST_24FPS_INTERVAL_US = 41667;
+const int64_t TEST_30FPS_INTERVAL_US = 33333;
+const int64_t TEST_60FPS_INTERVAL_US = 16666;
+const int32_t TEST_FPS_60 = 60;
+const int32_t TEST_FRAME_COUNT = 16;
+}
+
+class DCameraFramePacerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    DCameraFramePacer pacer_;
+};
+
+void DCameraFramePacerTest::SetUpTestCase(void)
+{
+    DHLOGI("DCameraFramePacerTest SetUpTestCase");
+}
+
+void DCameraFramePacerTest::TearDownTestCase(void)
+{
+    DHLOGI("DCameraFramePacerTest TearDownTestCase");
+}
+
+void DCameraFramePacerTest::SetUp(void)
+{
+    pacer_.Reset();
+}
+
+void DCameraFramePacerTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: dcamera_frame_pacer_test_001
+ * @tc.desc: Verify the interval falls back to the negotiated and then the default frame rate.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraFramePacerTest, dcamera_frame_pacer_test_001, TestSize.Level1)
+{
+    DHLOGI("dcamera_frame_pacer_test_001");
+    EXPECT_EQ(TEST_30FPS_INTERVAL_US, pacer_.GetFrameIntervalUs());
+    pacer_.SetFrameRate(TEST_FPS_60);
+    EXPECT_EQ(TEST_60FPS_INTERVAL_US, pacer_.GetFrameIntervalUs());
+    pacer_.SetFrameRate(0);
+    EXPECT_EQ(TEST_30FPS_INTERVAL_US, pacer_.GetFrameIntervalUs());
+}
+
+/**
+ * @tc.name: dcamera_frame_pacer_test_002
+ * @tc.desc: Verify a 24fps stream negotiated as 60fps is released on its own pts spacing.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraFramePacerTest, dcamera_frame_pacer_test_002, TestSize.Level1)
+{
+    DHLOGI("dcamera_frame_pacer_test_002");
+    pacer_.SetFrameRate(TEST_FPS_60);
+    int64_t nowUs = TEST_WALL_BASE_US;
+    for (int32_t i = 0; i < TEST_FRAME_COUNT; i++) {
+        int64_t ptsUs = TEST_PTS_BASE_US + i * TEST_24FPS_INTERVAL_US;
+        int64_t waitUs = pacer_.Schedule(ptsUs, nowUs);
+        if (i > 0) {
+            EXPECT_EQ(TEST_24FPS_INTERVAL_US, waitUs);
+            // A held frame is scheduled again once the wait is over.
+            EXPECT_EQ(waitUs, pacer_.Schedule(ptsUs, nowUs));
+            nowUs += waitUs;
+        }
+        EXPECT_EQ(0, pacer_.Schedule(ptsUs, nowUs));
+        pacer_.OnReleased(ptsUs);
+    }
+    DCameraFramePacerStats stats = pacer_.GetStats();
+    EXPECT_EQ(static_cast<uint64_t>(TEST_FRAME_COUNT), stats.released);
+    EXPECT_EQ(static_cast<uint64_t>(TEST_FRAME_COUNT - 1), stats.early);
+    EXPECT_EQ(0U, stats.late);
+    EXPECT_EQ(TEST_24FPS_INTERVAL_US, pacer_.GetFrameIntervalUs());
+}
+
+/**
+ * @tc.name: dcamera_frame_pacer_test_003
+ * @tc.desc: Verify a frame more than one interval late restarts the timeline instead of bursting the backlog.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraFramePacerTest, dcamera_frame_pacer_test_003, TestSize.Level1)
+{
+    DHLOGI("dcamera_frame_pacer_test_003");
+    EXPECT_EQ(0, pacer_.Schedule(TEST_PTS_BASE_US, TEST_WALL_BASE_US));
+    pacer_.OnReleased(TEST_PTS_BASE_US);
+    int64_t lateNowUs = TEST_WALL_BASE_US + DCameraFramePacer::MAX_HOLD_US;
+    int64_t ptsUs = TEST_PTS_BASE_US + TEST_30FPS_INTERVAL_US;
+    EXPECT_EQ(0, pacer_.Schedule(ptsUs, lateNowUs));
+    pacer_.OnReleased(ptsUs);
+    EXPECT_EQ(1U, pacer_.GetStats().late);
+    EXPECT_EQ(TEST_30FPS_INTERVAL_US, pacer_.Schedule(ptsUs + TEST_30FPS_INTERVAL_US, lateNowUs));
+}
+
+/**
+ * @tc.name: dcamera_frame_pacer_test_004
+ * @tc.desc: Verify a pts that steps back or jumps ahead keeps one frame interval to the last release.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraFramePacerTest, dcamera_frame_pacer_test_004, TestSize.Level1)
+{
+    DHLOGI("dcamera_frame_pacer_test_004");
+    EXPECT_EQ(0, pacer_.Schedule(TEST_PTS_BASE_US, TEST_WALL_BASE_US));
+    pacer_.OnReleased(TEST_PTS_BASE_US);
+    EXPECT_EQ(TEST_30FPS_INTERVAL_US, pacer_.Schedule(0, TEST_WALL_BASE_US));
+    int64_t jumpPtsUs = TEST_PTS_BASE_US + DCameraFramePacer::MAX_PTS_GAP_US + 1;
+    EXPECT_EQ(TEST_30FPS_INTERVAL_US, pacer_.Schedule(jumpPtsUs, TEST_WALL_BASE_US));
+    pacer_.OnReleased(jumpPtsUs);
+    EXPECT_EQ(TEST_30FPS_INTERVAL_US, pacer_.GetFrameIntervalUs());
+}
+
+/**
+ * @tc.name: dcamera_frame_pacer_test_005
+ * @tc.desc: Verify a free run continues from the last frame released on the audio clock.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraFramePacerTest, dcamera_frame_pacer_test_005, TestSize.Level1)
+{
+    DHLOGI("dcamera_frame_pacer_test_005");
+    pacer_.Rebase(TEST_PTS_BASE_US, TEST_WALL_BASE_US);
+    pacer_.OnReleased(TEST_PTS_BASE_US);
+    pacer_.OnLate();
+    pacer_.OnDropped();
+    EXPECT_EQ(TEST_30FPS_INTERVAL_US, pacer_.Schedule(TEST_PTS_BASE_US + TEST_30FPS_INTERVAL_US, TEST_WALL_BASE_US));
+    DCameraFramePacerStats stats = pacer_.GetStats();
+    EXPECT_EQ(1U, stats.released);
+    EXPECT_EQ(1U, stats.early);
+    EXPECT_EQ(1U, stats.late);
+    EXPECT_EQ(1U, stats.dropped);
+    pacer_.Reset();
+    EXPECT_EQ(0U, pacer_.GetStats().released);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "dcamera_latency_statistics.h"
+#undef private
+#include "distributed_hardware_log.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_STREAM_KEY = "dev_camera_1";
+const int32_t TEST_SAMPLE_COUNT = 1000;
+const int64_t TEST_TIME_BASE = 1000000;
+const int64_t TEST_ENCODE_US = 8000;
+const int64_t TEST_TRANS_US = 20000;
+const int32_t TEST_CLOCK_OFFSET = 5000;
+}
+
+class DCameraLatencyStatisticsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraLatencyStatisticsTest::SetUpTestCase(void)
+{
+    DHLOGI("DCameraLatencyStatisticsTest SetUpTestCase");
+}
+
+void DCameraLatencyStatisticsTest::TearDownTestCase(void)
+{
+    DHLOGI("DCameraLatencyStatisticsTest TearDownTestCase");
+}
+
+void DCameraLatencyStatisticsTest::SetUp(void)
+{
+}
+
+void DCameraLatencyStatisticsTest::TearDown(void)
+{
+    DCameraLatencyStatistics::GetInstance().Reset();
+}
+
+/**
+ * @tc.name: dcamera_latency_statistics_test_001
+ * @tc.desc: Verify the buckets are contiguous and every value falls into the bucket that bounds it.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraLatencyStatisticsTest, dcamera_latency_statistics_test_001, TestSize.Level1)
+{
+    DHLOGI("dcamera_latency_statistics_test_001");
+    EXPECT_EQ(0U, DCameraLatencyHistogram::BucketIndex(0));
+    uint64_t lower = 0;
+    for (size_t i = 0; i + 1 < DCameraLatencyHistogram::BUCKET_COUNT; i++) {
+        uint64_t upper = DCameraLatencyHistogram::BucketUpperBound(i);
+        EXPECT_EQ(i, DCameraLatencyHistogram::BucketIndex(lower));
+        EXPECT_EQ(i, DCameraLatencyHistogram::BucketIndex(upper));
+        lower = upper + 1;
+    }
+    EXPECT_EQ(DCameraLatencyHistogram::BUCKET_COUNT - 1, DCameraLatencyHistogram::BucketIndex(UINT64_MAX));
+}
+
+/**
+ * @tc.name: dcamera_latency_statistics_test_002
+ * @tc.desc: Verify percentiles stay within a bucket of the recorded values and reset clears them.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraLatencyStatisticsTest, dcamera_latency_statistics_test_002, TestSize.Level1)
+{
+    DHLOGI("dcamera_latency_statistics_test_002");
+    DCameraLatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.GetPercentile(50));
+    for (int32_t i = 1; i <= TEST_SAMPLE_COUNT; i++) {
+        histogram.Record(i);
+    }
+    histogram.Record(-1);
+    EXPECT_EQ(static_cast<uint64_t>(TEST_SAMPLE_COUNT + 1), histogram.GetCount());
+    EXPECT_EQ(TEST_SAMPLE_COUNT, histogram.GetMax());
+    int64_t p50 = histogram.GetPercentile(50);
+    EXPECT_GE(p50, TEST_SAMPLE_COUNT / 2);
+    EXPECT_LE(p50, TEST_SAMPLE_COUNT / 2 + TEST_SAMPLE_COUNT / 16);
+    int64_t p99 = histogram.GetPercentile(99);
+    EXPECT_GE(p99, TEST_SAMPLE_COUNT * 99 / 100);
+    EXPECT_LE(p99, TEST_SAMPLE_COUNT);
+    EXPECT_EQ(TEST_SAMPLE_COUNT, histogram.GetPercentile(100));
+
+    histogram.Reset();
+    EXPECT_EQ(0U, histogram.GetCount());
+    EXPECT_EQ(0, histogram.GetMax());
+    EXPECT_EQ(0, histogram.GetPercentile(99));
+}
+
+/**
+ * @tc.name: dcamera_latency_statistics_test_003
+ * @tc.desc: Verify stages without time points are skipped and sink stamps are moved by the clock offset.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraLatencyStatisticsTest, dcamera_latency_statistics_test_003, TestSize.Level1)
+{
+    DHLOGI("dcamera_latency_statistics_test_003");
+    std::shared_ptr<DCameraStreamLatency> latency = DCameraLatencyStatistics::GetInstance().Acquire(TEST_STREAM_KEY);
+    ASSERT_NE(nullptr, latency);
+    EXPECT_EQ(latency, DCameraLatencyStatistics::GetInstance().Acquire(TEST_STREAM_KEY));
+
+    DCameraFrameInfo frameInfo;
+    frameInfo.offset = TEST_CLOCK_OFFSET;
+    frameInfo.timePonit.startEncode = TEST_TIME_BASE;
+    frameInfo.timePonit.finishEncode = TEST_TIME_BASE + TEST_ENCODE_US;
+    frameInfo.timePonit.send = frameInfo.timePonit.finishEncode;
+    frameInfo.timePonit.recv = frameInfo.timePonit.send + TEST_TRANS_US - TEST_CLOCK_OFFSET;
+    latency->Record(frameInfo);
+    const DCameraLatencyHistogram& encode = latency->stages_[DCAMERA_LATENCY_ENCODE];
+    const DCameraLatencyHistogram& trans = latency->stages_[DCAMERA_LATENCY_TRANS];
+    EXPECT_EQ(1U, encode.GetCount());
+    EXPECT_EQ(TEST_ENCODE_US, encode.GetMax());
+    EXPECT_EQ(1U, trans.GetCount());
+    EXPECT_EQ(TEST_TRANS_US, trans.GetMax());
+    EXPECT_EQ(0U, latency->stages_[DCAMERA_LATENCY_DECODE].GetCount());
+    EXPECT_EQ(0U, latency->stages_[DCAMERA_LATENCY_GLASS_TO_GLASS].GetCount());
+
+    std::string result;
+    DCameraLatencyStatistics::GetInstance().Dump(result);
+    EXPECT_NE(std::string::npos, result.find(TEST_STREAM_KEY));
+    EXPECT_NE(std::string::npos, result.find("glass2Glass"));
+
+    // A stream still recording keeps its entry on reset, only the counters go.
+    DCameraLatencyStatistics::GetInstance().Reset();
+    EXPECT_EQ(0U, encode.GetCount());
+    EXPECT_EQ(1U, DCameraLatencyStatistics::GetInstance().streams_.size());
+    latency = nullptr;
+    DCameraLatencyStatistics::GetInstance().Reset();
+    EXPECT_TRUE(DCameraLatencyStatistics::GetInstance().streams_.empty());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dcamera_settings_coalescer.h"
+#include "dcamera_utils_tools.h"
+#include "distributed_hardware_log.h"
+#include "metadata_utils.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const float TEST_FIRST_ZOOM = 1.5f;
+const float TEST_LAST_ZOOM = 3.0f;
+const uint8_t TEST_FOCUS_MODE = 1;
+
+std::shared_ptr<DCameraSettings> CreateZoomSetting(float zoom, bool withFocus)
+{
+    auto metadata = std::make_shared<Camera::CameraMetadata>(10, 100);
+    metadata->addEntry(OHOS_CONTROL_ZOOM_RATIO, &zoom, 1);
+    if (withFocus) {
+        metadata->addEntry(OHOS_CONTROL_FOCUS_MODE, &TEST_FOCUS_MODE, 1);
+    }
+    std::string metadataStr = Camera::MetadataUtils::EncodeToString(metadata);
+    std::shared_ptr<DCameraSettings> setting = std::make_shared<DCameraSettings>();
+    setting->type_ = UPDATE_METADATA;
+    setting->value_ = Base64Encode(reinterpret_cast<const unsigned char *>(metadataStr.c_str()),
+        metadataStr.length());
+    return setting;
+}
+}
+
+class DCameraSettingsCoalescerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    DCameraSettingsCoalescer coalescer_;
+};
+
+void DCameraSettingsCoalescerTest::SetUpTestCase(void)
+{
+    DHLOGI("DCameraSettingsCoalescerTest SetUpTestCase");
+}
+
+void DCameraSettingsCoalescerTest::TearDownTestCase(void)
+{
+    DHLOGI("DCameraSettingsCoalescerTest TearDownTestCase");
+}
+
+void DCameraSettingsCoalescerTest::SetUp(void)
+{
+    coalescer_.Take();
+}
+
+void DCameraSettingsCoalescerTest::TearDown(void)
+{
+    coalescer_.Take();
+}
+
+/**
+ * @tc.name: dcamera_settings_coalescer_test_001
+ * @tc.desc: Verify a burst of metadata updates folds into one update holding the newest value of each tag.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSettingsCoalescerTest, dcamera_settings_coalescer_test_001, TestSize.Level1)
+{
+    EXPECT_TRUE(coalescer_.IsEmpty());
+    EXPECT_TRUE(coalescer_.Take().empty());
+    std::vector<std::shared_ptr<DCameraSettings>> first = { CreateZoomSetting(TEST_FIRST_ZOOM, true) };
+    std::vector<std::shared_ptr<DCameraSettings>> last = { CreateZoomSetting(TEST_LAST_ZOOM, false) };
+    EXPECT_TRUE(coalescer_.Merge(first));
+    EXPECT_TRUE(coalescer_.Merge(last));
+    EXPECT_FALSE(coalescer_.IsEmpty());
+
+    std::vector<std::shared_ptr<DCameraSettings>> merged = coalescer_.Take();
+    EXPECT_TRUE(coalescer_.IsEmpty());
+    ASSERT_EQ(1U, merged.size());
+    EXPECT_EQ(UPDATE_METADATA, merged[0]->type_);
+    std::shared_ptr<Camera::CameraMetadata> metadata =
+        Camera::MetadataUtils::DecodeFromString(Base64Decode(merged[0]->value_));
+    ASSERT_NE(nullptr, metadata);
+    EXPECT_EQ(2U, Camera::GetCameraMetadataItemCount(metadata->get()));
+    camera_metadata_item_t item;
+    ASSERT_EQ(CAM_META_SUCCESS, Camera::FindCameraMetadataItem(metadata->get(), OHOS_CONTROL_ZOOM_RATIO, &item));
+    EXPECT_FLOAT_EQ(TEST_LAST_ZOOM, item.data.f[0]);
+    ASSERT_EQ(CAM_META_SUCCESS, Camera::FindCameraMetadataItem(metadata->get(), OHOS_CONTROL_FOCUS_MODE, &item));
+    EXPECT_EQ(TEST_FOCUS_MODE, item.data.u8[0]);
+}
+
+/**
+ * @tc.name: dcamera_settings_coalescer_test_002
+ * @tc.desc: Verify settings that are not metadata updates are refused and leave nothing pending.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSettingsCoalescerTest, dcamera_settings_coalescer_test_002, TestSize.Level1)
+{
+    std::vector<std::shared_ptr<DCameraSettings>> settings;
+    EXPECT_FALSE(coalescer_.Merge(settings));
+    std::shared_ptr<DCameraSettings> enable = std::make_shared<DCameraSettings>();
+    enable->type_ = ENABLE_METADATA;
+    settings.push_back(enable);
+    EXPECT_FALSE(coalescer_.Merge(settings));
+
+    std::shared_ptr<DCameraSettings> broken = std::make_shared<DCameraSettings>();
+    broken->type_ = UPDATE_METADATA;
+    broken->value_ = "broken";
+    settings = { CreateZoomSetting(TEST_FIRST_ZOOM, false), broken };
+    EXPECT_FALSE(coalescer_.Merge(settings));
+    EXPECT_TRUE(coalescer_.IsEmpty());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -20,6 +20,7 @@
 #undef private
 
 #include "accesstoken_kit.h"
+#include "dcamera_source_event_metrics.h"
 #include "dcamera_source_state.h"
 #include "dcamera_utils_tools.h"
 #include "distributed_camera_errno.h"
@@ -58,6 +59,7 @@ const std::string TEST_SRC_ATTRS = "";
 const int32_t TEST_WIDTH = 1920;
 const int32_t TEST_HEIGTH = 1080;
 const int32_t TEST_SLEEP_SEC = 200000;
+const int64_t TEST_CLOSE_SEQ = 5;
 std::string TEST_EVENT_CMD_JSON = R"({
     "Type": "MESSAGE",
     "dhId": "camrea_0",
@@ -796,5 +798,118 @@ HWTEST_F(DCameraSourceDevTest, processHDFEvent_001, TestSize.Level1) {
     int32_t rotate = DCameraSystemSwitchInfo::GetInstance().GetSystemSwitchRotation(TEST_DEVICE_ID);
     EXPECT_EQ(rotate, 90);
 }
+
+/**
+ * @tc.name: ParseEnableParam_001
+ * @tc.desc: Verify the sink ability parsed at register builds a compact HDI ability document.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSourceDevTest, ParseEnableParam_001, TestSize.Level1)
+{
+    std::shared_ptr<DCameraSinkAbility> sinkAbility = std::make_shared<DCameraSinkAbility>();
+    EXPECT_EQ(DCAMERA_BAD_VALUE, sinkAbility->Unmarshal(TEST_VER));
+    std::string sinkAttrs = R"({"EIS": true, "ControlFormat": 1, "Hdr10": true})";
+    ASSERT_EQ(DCAMERA_OK, sinkAbility->Unmarshal(sinkAttrs));
+    EXPECT_TRUE(sinkAbility->eis_);
+    EXPECT_EQ(DCAMERA_CONTROL_FORMAT_BINARY, sinkAbility->controlFormat_);
+    EXPECT_TRUE(sinkAbility->hdr10_);
+    EXPECT_FALSE(sinkAbility->sessionMux_);
+    std::shared_ptr<DCameraSinkAbility> muxAbility = std::make_shared<DCameraSinkAbility>();
+    ASSERT_EQ(DCAMERA_OK, muxAbility->Unmarshal(R"({"SessionMux": true})"));
+    EXPECT_TRUE(muxAbility->sessionMux_);
+
+    std::shared_ptr<DCameraRegistParam> param = std::make_shared<DCameraRegistParam>(TEST_DEVICE_ID,
+        TEST_CAMERA_DH_ID_0, TEST_REQID, TEST_SINK_ATTRS, R"({"CodecType": []})");
+    param->sinkAbility_ = sinkAbility;
+    std::string ability;
+    ASSERT_EQ(DCAMERA_OK, camDev_->ParseEnableParam(param, ability));
+    EXPECT_EQ(R"({"SinkAbility":{"EIS":true,"ControlFormat":1,"Hdr10":true},"SourceCodec":{"CodecType":[]}})",
+        ability);
+    EXPECT_NE(sinkAbility->root_, nullptr);
+    EXPECT_EQ(DCAMERA_OK, camDev_->ParseEnableParam(param, ability));
+
+    param->sinkAbility_ = nullptr;
+    EXPECT_EQ(DCAMERA_INIT_ERR, camDev_->ParseEnableParam(param, ability));
+}
+
+/**
+ * @tc.name: ParseEnableParam_002
+ * @tc.desc: Verify the capture group of the source attrs is taken and cleared again without it.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSourceDevTest, ParseEnableParam_002, TestSize.Level1)
+{
+    std::shared_ptr<DCameraRegistParam> param = std::make_shared<DCameraRegistParam>(TEST_DEVICE_ID,
+        TEST_CAMERA_DH_ID_0, TEST_REQID, R"({"EIS": false})", R"({"CaptureGroup": "stereo"})");
+    std::string ability;
+    ASSERT_EQ(DCAMERA_OK, camDev_->ParseEnableParam(param, ability));
+    EXPECT_EQ("stereo", camDev_->captureGroupId_);
+    param->srcParam_ = R"({"CodecType": []})";
+    ASSERT_EQ(DCAMERA_OK, camDev_->ParseEnableParam(param, ability));
+    EXPECT_TRUE(camDev_->captureGroupId_.empty());
+}
+
+/**
+ * @tc.name: PostHdiCall_001
+ * @tc.desc: Verify an HDI call completes on the event thread and a failed enable restores the state.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSourceDevTest, PostHdiCall_001, TestSize.Level1)
+{
+    ASSERT_EQ(DCAMERA_OK, camDev_->InitDCameraSourceDev());
+    camDev_->controller_ = std::make_shared<MockDCameraSourceController>();
+    std::shared_ptr<DCameraRegistParam> param = std::make_shared<DCameraRegistParam>(TEST_DEVICE_ID,
+        TEST_CAMERA_DH_ID_0, TEST_REQID, TEST_SINK_ATTRS, TEST_SRC_ATTRS);
+    EXPECT_EQ(DCAMERA_OK, camDev_->PostHdiCall(DCAMERA_EVENT_REGIST, param, []() { return FAILED; }));
+    EXPECT_TRUE(camDev_->isHdiResultDeferred_);
+    camDev_->isHdiResultDeferred_ = false;
+    camDev_->stateMachine_->UpdateState(DCAMERA_STATE_REGIST);
+    usleep(TEST_SLEEP_SEC);
+    EXPECT_TRUE(camDev_->pendingHdiCalls_.empty());
+    EXPECT_EQ(DCAMERA_STATE_INIT, camDev_->GetStateInfo());
+
+    EXPECT_EQ(DCAMERA_OK, camDev_->PostHdiCall(DCAMERA_EVENT_UNREGIST, param, []() { return SUCCESS; }));
+    camDev_->isHdiResultDeferred_ = false;
+    usleep(TEST_SLEEP_SEC);
+    EXPECT_TRUE(camDev_->pendingHdiCalls_.empty());
+
+    AppExecFwk::InnerEvent::Pointer timeoutEvent = AppExecFwk::InnerEvent::Get(EVENT_HDI_CALL_TIMEOUT,
+        camDev_->hdiGeneration_.load());
+    camDev_->DoHdiResultProcess(timeoutEvent);
+    EXPECT_EQ(DCAMERA_STATE_INIT, camDev_->GetStateInfo());
+}
+
+/**
+ * @tc.name: SupersededByClose_001
+ * @tc.desc: Verify a close drops the operations queued before it and keeps the ones posted after it.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSourceDevTest, SupersededByClose_001, TestSize.Level1)
+{
+    ASSERT_EQ(DCAMERA_OK, camDev_->InitDCameraSourceDev());
+    camDev_->closeSeq_ = TEST_CLOSE_SEQ;
+    EXPECT_TRUE(camDev_->IsSupersededByClose(DCAMERA_EVENT_START_CAPTURE, TEST_CLOSE_SEQ - 1));
+    EXPECT_TRUE(camDev_->IsSupersededByClose(DCAMERA_EVENT_UPDATE_SETTINGS, TEST_CLOSE_SEQ - 1));
+    EXPECT_FALSE(camDev_->IsSupersededByClose(DCAMERA_EVENT_UPDATE_SETTINGS, TEST_CLOSE_SEQ));
+    EXPECT_FALSE(camDev_->IsSupersededByClose(DCAMERA_EVENT_OPEN, TEST_CLOSE_SEQ + 1));
+    EXPECT_FALSE(camDev_->IsSupersededByClose(DCAMERA_EVENT_CLOSE, TEST_CLOSE_SEQ));
+    EXPECT_FALSE(camDev_->IsSupersededByClose(DCAMERA_EVENT_UNREGIST, TEST_CLOSE_SEQ - 1));
+
+    DCameraSourceEventMetrics::GetInstance().Reset();
+    DCameraIndex index(TEST_DEVICE_ID, TEST_CAMERA_DH_ID_0);
+    std::shared_ptr<DCameraSourceEvent> eventParam = std::make_shared<DCameraSourceEvent>(DCAMERA_EVENT_OPEN, index);
+    AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(EVENT_SOURCE_DEV_PROCESS, eventParam,
+        TEST_CLOSE_SEQ - 1);
+    camDev_->DoProcessData(event);
+    DCameraSourceEventStats stats = DCameraSourceEventMetrics::GetInstance().GetStats(DCAMERA_EVENT_OPEN);
+    EXPECT_EQ(1U, stats.superseded);
+    EXPECT_EQ(0U, stats.count);
+    EXPECT_EQ(DCAMERA_STATE_INIT, camDev_->GetStateInfo());
+    DCameraSourceEventMetrics::GetInstance().Reset();
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -512,5 +512,35 @@ HWTEST_F(DCameraSourceInputTest, dcamera_source_input_test_016, TestSize.Level1)
     EXPECT_EQ(rc, DCAMERA_OK);
 }
 
+/**
+ * @tc.name: dcamera_source_input_test_017
+ * @tc.desc: Verify a gap in the continuous frame index asks for a key frame once per interval.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraSourceInputTest, dcamera_source_input_test_017, TestSize.Level1)
+{
+    std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(1);
+    const std::vector<int32_t> inOrder = { 0, 1, 2 };
+    for (int32_t index : inOrder) {
+        buffer->frameInfo_.index = index;
+        testInput_->CheckFrameLoss(buffer);
+    }
+    EXPECT_EQ(0, testInput_->lastKeyFrameRequestUs_);
+
+    buffer->frameInfo_.index = 5;
+    testInput_->CheckFrameLoss(buffer);
+    int64_t requestUs = testInput_->lastKeyFrameRequestUs_;
+    EXPECT_NE(0, requestUs);
+
+    buffer->frameInfo_.index = 9;
+    testInput_->CheckFrameLoss(buffer);
+    EXPECT_EQ(requestUs, testInput_->lastKeyFrameRequestUs_);
+
+    buffer->frameInfo_.index = 0;
+    testInput_->CheckFrameLoss(buffer);
+    EXPECT_EQ(0, testInput_->lastFrameIndex_);
+}
+
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <thread>
 #define private public
 #include "dcamera_source_state.h"
 #undef private
@@ -759,5 +760,33 @@ HWTEST_F(DCameraSourceStateMachineTest, dcamera_source_state_machine_test_020, T
     int32_t ret = stateMachine_ ->Execute(DCAMERA_EVENT_CLOSE, event1);
     EXPECT_EQ(DCAMERA_BAD_VALUE, ret);
 }
+
+/**
+ * @tc.name: dcamera_source_state_machine_test_021
+ * @tc.desc: Verify control events wait for the lifecycle events posted before them.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraSourceStateMachineTest, dcamera_source_state_machine_test_021, TestSize.Level1)
+{
+    EXPECT_TRUE(DCameraSourceStateMachine::IsControlEvent(DCAMERA_EVENT_UPDATE_SETTINGS));
+    EXPECT_FALSE(DCameraSourceStateMachine::IsControlEvent(DCAMERA_EVENT_STOP_CAPTURE));
+    EXPECT_FALSE(DCameraSourceStateMachine::IsControlEvent(DCAMERA_EVENT_OPEN));
+
+    EXPECT_TRUE(stateMachine_->WaitLifecycleEventStarted(stateMachine_->GetLastLifecycleEvent()));
+    int64_t first = stateMachine_->OnLifecycleEventPosted();
+    int64_t second = stateMachine_->OnLifecycleEventPosted();
+    EXPECT_EQ(first + 1, second);
+    EXPECT_EQ(second, stateMachine_->GetLastLifecycleEvent());
+
+    std::thread lifecycle([this, first, second]() {
+        stateMachine_->OnLifecycleEventStarted(first);
+        stateMachine_->OnLifecycleEventStarted(second);
+    });
+    EXPECT_TRUE(stateMachine_->WaitLifecycleEventStarted(second));
+    lifecycle.join();
+    stateMachine_->OnLifecycleEventStarted(first);
+    EXPECT_TRUE(stateMachine_->WaitLifecycleEventStarted(first));
+}
 } // namespace DistributedHardware
 } // namespace OHOS
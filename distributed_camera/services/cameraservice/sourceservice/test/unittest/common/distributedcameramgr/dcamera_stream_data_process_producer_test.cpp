@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -22,6 +22,7 @@
 #undef private
 #include "anonymous_string.h"
 #include "dcamera_buffer_handle.h"
+#include "dcamera_utils_tools.h"
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
@@ -345,10 +346,7 @@ HWTEST_F(DCameraStreamDataProcessProducerTest, FeedStream_002, TestSize.Level1)
     auto buffer = std::make_shared<DataBuffer>(100);
     buffer->frameInfo_.rawTime = 1000000;
     producer_->FeedStream(buffer);
-    {
-        std::lock_guard<std::mutex> lock(producer_->bufferMutex_);
-        EXPECT_FALSE(producer_->buffers_.empty());
-    }
+    EXPECT_FALSE(producer_->buffers_.Empty());
     producer_->Stop();
 }
 
@@ -371,10 +369,7 @@ HWTEST_F(DCameraStreamDataProcessProducerTest, FeedStream_003, TestSize.Level1)
         producer_->FeedStream(buffer);
     }
 
-    {
-        std::lock_guard<std::mutex> lock(producer_->bufferMutex_);
-        EXPECT_EQ(producer_->buffers_.size(), producer_->DCAMERA_PRODUCER_MAX_BUFFER_SIZE);
-    }
+    EXPECT_EQ(producer_->buffers_.Size(), producer_->DCAMERA_PRODUCER_MAX_BUFFER_SIZE);
     producer_->Stop();
 }
 
@@ -420,10 +415,7 @@ HWTEST_F(DCameraStreamDataProcessProducerTest, OnSmoothFinished_002, TestSize.Le
     auto feedableData = std::static_pointer_cast<IFeedableData>(buffer);
     producer_->OnSmoothFinished(feedableData);
 
-    {
-        std::lock_guard<std::mutex> lock(producer_->syncBufferMutex_);
-        EXPECT_TRUE(producer_->syncBufferQueue_.empty());
-    }
+    EXPECT_TRUE(producer_->syncBufferQueue_.Empty());
     producer_->Stop();
 }
 
@@ -448,10 +440,7 @@ HWTEST_F(DCameraStreamDataProcessProducerTest, OnSmoothFinished_003, TestSize.Le
         producer_->OnSmoothFinished(feedableData);
     }
 
-    {
-        std::lock_guard<std::mutex> lock(producer_->syncBufferMutex_);
-        EXPECT_EQ(producer_->syncBufferQueue_.size(), 0);
-    }
+    EXPECT_EQ(producer_->syncBufferQueue_.Size(), 0);
     producer_->Stop();
 }
 
@@ -473,7 +462,8 @@ HWTEST_F(DCameraStreamDataProcessProducerTest, UpdateProducerWorkMode_001, TestS
 
     producer_->UpdateProducerWorkMode(param);
     uint64_t videoPtsUs = 1000000;
-    int32_t result = producer_->SyncVideoFrame(videoPtsUs);
+    int64_t waitUs = 0;
+    int32_t result = producer_->SyncVideoFrame(videoPtsUs, waitUs);
     EXPECT_TRUE(result == DCAMERA_BAD_VALUE || result == -1 || result == 0 || result == 1);
 }
 
@@ -488,7 +478,8 @@ HWTEST_F(DCameraStreamDataProcessProducerTest, SyncVideoFrame_001, TestSize.Leve
     DHLOGI("DCameraStreamDataProcessProducerTest SyncVideoFrame_001");
     ASSERT_NE(producer_, nullptr);
     uint64_t videoPtsUs = 1000000; // 1s in us
-    int32_t result = producer_->SyncVideoFrame(videoPtsUs);
+    int64_t waitUs = 0;
+    int32_t result = producer_->SyncVideoFrame(videoPtsUs, waitUs);
     EXPECT_TRUE(result == DCAMERA_BAD_VALUE || result == -1 || result == 0 || result == 1);
 }
 
@@ -513,10 +504,11 @@ HWTEST_F(DCameraStreamDataProcessProducerTest, SyncVideoFrame_002, TestSize.Leve
     uint64_t videoPtsUs1 = 1000000;   // 1 second
     uint64_t videoPtsUs2 = 50000000;  // 50 seconds
     uint64_t videoPtsUs3 = 100000;    // 0.1 seconds
+    int64_t waitUs = 0;
 
-    int32_t result1 = producer_->SyncVideoFrame(videoPtsUs1);
-    int32_t result2 = producer_->SyncVideoFrame(videoPtsUs2);
-    int32_t result3 = producer_->SyncVideoFrame(videoPtsUs3);
+    int32_t result1 = producer_->SyncVideoFrame(videoPtsUs1, waitUs);
+    int32_t result2 = producer_->SyncVideoFrame(videoPtsUs2, waitUs);
+    int32_t result3 = producer_->SyncVideoFrame(videoPtsUs3, waitUs);
 
     EXPECT_TRUE(result1 == DCAMERA_BAD_VALUE || result1 == -1 || result1 == 0 || result1 == 1);
     EXPECT_TRUE(result2 == DCAMERA_BAD_VALUE || result2 == -1 || result2 == 0 || result2 == 1);
@@ -542,7 +534,8 @@ HWTEST_F(DCameraStreamDataProcessProducerTest, SyncVideoFrame_003, TestSize.Leve
     producer_->UpdateProducerWorkMode(param);
 
     uint64_t videoPtsUs = 1000000;
-    int32_t result = producer_->SyncVideoFrame(videoPtsUs);
+    int64_t waitUs = 0;
+    int32_t result = producer_->SyncVideoFrame(videoPtsUs, waitUs);
 
     EXPECT_TRUE(result == DCAMERA_BAD_VALUE || result == -1 || result == 0 || result == 1);
 }
@@ -761,5 +754,167 @@ HWTEST_F(DCameraStreamDataProcessProducerTest, dcamera_stream_data_process_produ
     producer->UpdateProducerWorkMode(param);
     EXPECT_EQ(false, producer->workModeParam_.isAVsync);
 }
+
+/**
+ * @tc.name: dcamera_stream_data_process_producer_test_008
+ * @tc.desc: Verify AcquireDriverBuffer falls back to a heap buffer without a driver.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraStreamDataProcessProducerTest, dcamera_stream_data_process_producer_test_008, TestSize.Level1)
+{
+    DHLOGI("dcamera_stream_data_process_producer_test_008");
+    size_t capacity = 64;
+    std::shared_ptr<DCameraStreamDataProcessProducer> producer =
+        std::make_shared<DCameraStreamDataProcessProducer>(TEST_DEVICE_ID, TEST_CAMERA_DH_ID_0, STREAM_ID_2,
+        DCStreamType::CONTINUOUS_FRAME);
+    std::shared_ptr<DataBuffer> buffer = producer->AcquireDriverBuffer(capacity);
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(capacity, buffer->Size());
+    EXPECT_TRUE(producer->driverBuffers_.empty());
+    DCameraBuffer sharedMemory;
+    EXPECT_FALSE(producer->TakeDriverBuffer(buffer.get(), sharedMemory));
+}
+
+/**
+ * @tc.name: dcamera_stream_data_process_producer_test_009
+ * @tc.desc: Verify the sync thread resends a held back frame before taking the next queued one.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraStreamDataProcessProducerTest, dcamera_stream_data_process_producer_test_009, TestSize.Level1)
+{
+    DHLOGI("dcamera_stream_data_process_producer_test_009");
+    size_t capacity = 1;
+    std::shared_ptr<DCameraStreamDataProcessProducer> producer =
+        std::make_shared<DCameraStreamDataProcessProducer>(TEST_DEVICE_ID, TEST_CAMERA_DH_ID_0, STREAM_ID_2,
+        DCStreamType::CONTINUOUS_FRAME);
+    std::shared_ptr<DataBuffer> early = std::make_shared<DataBuffer>(capacity);
+    std::shared_ptr<DataBuffer> next = std::make_shared<DataBuffer>(capacity);
+    producer->syncRunning_.store(true);
+    producer->pendingSyncBuffer_ = early;
+    EXPECT_TRUE(producer->syncBufferQueue_.Push(next));
+    std::shared_ptr<DataBuffer> buffer = nullptr;
+    EXPECT_FALSE(producer->WaitForVideoFrame(buffer));
+    EXPECT_EQ(early, buffer);
+    EXPECT_FALSE(producer->WaitForVideoFrame(buffer));
+    EXPECT_EQ(next, buffer);
+    producer->syncRunning_.store(false);
+    EXPECT_TRUE(producer->WaitForVideoFrame(buffer));
+}
+
+/**
+ * @tc.name: dcamera_stream_data_process_producer_test_010
+ * @tc.desc: Verify frames are held, released or dropped against the audio clock in the sync memory.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraStreamDataProcessProducerTest, dcamera_stream_data_process_producer_test_010, TestSize.Level1)
+{
+    DHLOGI("dcamera_stream_data_process_producer_test_010");
+    const int64_t audioPtsUs = 10000000;
+    const uint64_t nsPerUs = 1000;
+    uint32_t memLen = sizeof(DCameraStreamDataProcessProducer::SyncSharedData);
+    auto syncSharedMem = OHOS::Ashmem::CreateAshmem("testSyncMemory", memLen);
+    ASSERT_NE(nullptr, syncSharedMem);
+    ASSERT_TRUE(syncSharedMem->MapReadAndWriteAshmem());
+    DCameraStreamDataProcessProducer::SyncSharedData syncData = {};
+    syncData.lock = 1;
+    syncData.audio_current_pts = audioPtsUs;
+    syncData.audio_update_clock = static_cast<uint64_t>(GetNowTimeStampUs());
+    syncData.audio_speed = 1.0f;
+    ASSERT_TRUE(syncSharedMem->WriteToAshmem(&syncData, memLen, 0));
+    producer_->syncMem_ = syncSharedMem;
+    producer_->workModeParam_.sharedMemLen = static_cast<int32_t>(memLen);
+
+    int64_t waitUs = 0;
+    uint64_t earlyPts = static_cast<uint64_t>(audioPtsUs + producer_->DCAMERA_SYNC_MAX_HOLD_US / 2) * nsPerUs;
+    EXPECT_EQ(producer_->DCAMERA_SYNC_HOLD, producer_->SyncVideoFrame(earlyPts, waitUs));
+    EXPECT_GT(waitUs, 0);
+    EXPECT_LE(waitUs, producer_->DCAMERA_SYNC_MAX_HOLD_US / 2);
+    uint64_t farPts = static_cast<uint64_t>(audioPtsUs + producer_->DCAMERA_SYNC_STALE_CLOCK_US) * nsPerUs;
+    EXPECT_EQ(producer_->DCAMERA_SYNC_HOLD, producer_->SyncVideoFrame(farPts, waitUs));
+    EXPECT_EQ(producer_->DCAMERA_SYNC_MAX_HOLD_US, waitUs);
+
+    uint64_t latePts = static_cast<uint64_t>(audioPtsUs - producer_->DCAMERA_SYNC_MAX_HOLD_US) * nsPerUs;
+    EXPECT_EQ(producer_->DCAMERA_SYNC_RELEASE, producer_->SyncVideoFrame(latePts, waitUs));
+    EXPECT_EQ(0, waitUs);
+    EXPECT_TRUE(producer_->syncBufferQueue_.Push(std::make_shared<DataBuffer>(1)));
+    EXPECT_EQ(producer_->DCAMERA_SYNC_DROP, producer_->SyncVideoFrame(latePts, waitUs));
+    producer_->syncBufferQueue_.Clear();
+    EXPECT_EQ(2U, producer_->framePacer_.GetStats().late);
+
+    // Without an audio clock the frame is paced by its pts distance to the last one checked against the clock.
+    syncData.audio_update_clock = 0;
+    ASSERT_TRUE(syncSharedMem->WriteToAshmem(&syncData, memLen, 0));
+    EXPECT_EQ(producer_->DCAMERA_SYNC_HOLD, producer_->SyncVideoFrame(earlyPts, waitUs));
+    EXPECT_EQ(DCameraFramePacer::MAX_HOLD_US, waitUs);
+    producer_->syncMem_ = nullptr;
+    syncSharedMem->UnmapAshmem();
+    syncSharedMem->CloseAshmem();
+}
+
+/**
+ * @tc.name: dcamera_stream_data_process_producer_test_011
+ * @tc.desc: Verify a stopped producer takes no batch buffer and an unusable one is not attached.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraStreamDataProcessProducerTest, dcamera_stream_data_process_producer_test_011, TestSize.Level1)
+{
+    DHLOGI("dcamera_stream_data_process_producer_test_011");
+    size_t capacity = 64;
+    std::shared_ptr<DCameraStreamDataProcessProducer> producer =
+        std::make_shared<DCameraStreamDataProcessProducer>(TEST_DEVICE_ID, TEST_CAMERA_DH_ID_0, STREAM_ID_2,
+        DCStreamType::CONTINUOUS_FRAME);
+    EXPECT_FALSE(producer->IsDriverBufferEnabled());
+    DCameraBuffer sharedMemory;
+    sharedMemory.index_ = 0;
+    sharedMemory.size_ = static_cast<int32_t>(capacity);
+    sharedMemory.bufferHandle_ = nullptr;
+    EXPECT_EQ(nullptr, producer->AttachDriverBuffer(sharedMemory, capacity));
+    EXPECT_TRUE(producer->driverBuffers_.empty());
+}
+
+/**
+ * @tc.name: dcamera_stream_data_process_producer_test_012
+ * @tc.desc: Verify the sync memory is updated in place and a lock the peer never frees times out.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraStreamDataProcessProducerTest, dcamera_stream_data_process_producer_test_012, TestSize.Level1)
+{
+    DHLOGI("dcamera_stream_data_process_producer_test_012");
+    const uint64_t videoPts = 20000000;
+    uint32_t memLen = sizeof(DCameraStreamDataProcessProducer::SyncSharedData);
+    auto syncSharedMem = OHOS::Ashmem::CreateAshmem("testSyncLockMemory", memLen);
+    ASSERT_NE(nullptr, syncSharedMem);
+    ASSERT_TRUE(syncSharedMem->MapReadAndWriteAshmem());
+    DCameraStreamDataProcessProducer::SyncSharedData syncData = {};
+    syncData.lock = producer_->DCAMERA_SYNC_UNLOCKED;
+    syncData.reset = true;
+    ASSERT_TRUE(syncSharedMem->WriteToAshmem(&syncData, memLen, 0));
+    producer_->syncMem_ = syncSharedMem;
+
+    producer_->WriteVideoClock(videoPts);
+    auto sharedData = reinterpret_cast<const DCameraStreamDataProcessProducer::SyncSharedData *>(
+        syncSharedMem->ReadFromAshmem(memLen, 0));
+    ASSERT_NE(nullptr, sharedData);
+    EXPECT_EQ(videoPts, sharedData->video_current_pts);
+    EXPECT_FALSE(sharedData->reset);
+    EXPECT_EQ(producer_->DCAMERA_SYNC_UNLOCKED, sharedData->lock);
+
+    syncData.lock = producer_->DCAMERA_SYNC_LOCKED;
+    ASSERT_TRUE(syncSharedMem->WriteToAshmem(&syncData, memLen, 0));
+    int64_t audioPtsUs = 0;
+    int64_t audioUpdateUs = 0;
+    float audioSpeed = 0.0f;
+    int64_t startUs = GetNowTimeStampUs();
+    EXPECT_EQ(DCAMERA_BAD_VALUE, producer_->ReadAudioClock(audioPtsUs, audioUpdateUs, audioSpeed));
+    EXPECT_GE(GetNowTimeStampUs() - startUs, producer_->DCAMERA_SYNC_LOCK_TIMEOUT_US);
+    producer_->syncMem_ = nullptr;
+    syncSharedMem->UnmapAshmem();
+    syncSharedMem->CloseAshmem();
+}
 } // namespace DistributedHardware
 } // namespace OHOS
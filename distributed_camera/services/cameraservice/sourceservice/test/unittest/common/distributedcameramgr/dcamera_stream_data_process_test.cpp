@@ -363,5 +363,36 @@ HWTEST_F(DCameraStreamDataProcessTest, dcamera_stream_data_process_test_011, Tes
     ret = streamProcess->UpdateSettings(settingVectors);
     EXPECT_EQ(DCAMERA_OK, ret);
 }
+
+/**
+ * @tc.name: dcamera_stream_data_process_test_012
+ * @tc.desc: Verify a snapshot stream hands out reassembly buffers of the full photo size.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraStreamDataProcessTest, dcamera_stream_data_process_test_012, TestSize.Level1)
+{
+    DHLOGI("DCameraStreamDataProcessTest::dcamera_stream_data_process_test_012");
+    std::shared_ptr<DCameraStreamDataProcess> streamProcess =
+        std::make_shared<DCameraStreamDataProcess>(TEST_DEVICE_ID, TEST_CAMERA_DH_ID_0, DCStreamType::SNAPSHOT_FRAME);
+    size_t capacity = TEST_WIDTH * TEST_HEIGTH;
+    std::shared_ptr<DataBuffer> buffer = streamProcess->AcquireRecvBuffer(capacity);
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(capacity, buffer->Size());
+
+    std::shared_ptr<DCameraStreamConfig> srcConfig =
+        std::make_shared<DCameraStreamConfig>(TEST_WIDTH, TEST_HEIGTH, TEST_FORMAT, TEST_DATASPACE,
+        DCEncodeType::ENCODE_TYPE_JPEG, DCStreamType::SNAPSHOT_FRAME);
+    std::set<int32_t> streamIds;
+    streamIds.insert(1);
+    streamProcess->ConfigStreams(srcConfig, streamIds);
+    streamProcess->StartCapture(srcConfig, streamIds);
+    EXPECT_EQ(1, streamProcess->GetProducerSize());
+    buffer = streamProcess->AcquireRecvBuffer(capacity);
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(capacity, buffer->Size());
+    buffer = nullptr;
+    streamProcess->StopCapture(streamIds);
+}
 }
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "dcamera_trust_cache.h"
+#undef private
+#include "distributed_hardware_log.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_DEVICE_ID = "bb536a637105409e904d4da83790a4a7";
+const std::string TEST_OTHER_DEVICE_ID = "bb536a637105409e904d4da83790a4a8";
+const std::string TEST_ACL_KEY = "srcDevId#account#100#1";
+const std::string TEST_OTHER_ACL_KEY = "srcDevId#account#101#1";
+}
+
+class DCameraTrustCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraTrustCacheTest::SetUpTestCase(void)
+{
+    DHLOGI("DCameraTrustCacheTest SetUpTestCase");
+}
+
+void DCameraTrustCacheTest::TearDownTestCase(void)
+{
+    DHLOGI("DCameraTrustCacheTest TearDownTestCase");
+}
+
+void DCameraTrustCacheTest::SetUp(void)
+{
+    DCameraTrustCache::GetInstance().Clear();
+}
+
+void DCameraTrustCacheTest::TearDown(void)
+{
+    DCameraTrustCache::GetInstance().Clear();
+}
+
+/**
+ * @tc.name: dcamera_trust_cache_test_001
+ * @tc.desc: Verify a granted acl is only reused by the same caller and until it expires.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraTrustCacheTest, dcamera_trust_cache_test_001, TestSize.Level1)
+{
+    DCameraTrustCache &cache = DCameraTrustCache::GetInstance();
+    EXPECT_FALSE(cache.GetAclGranted(TEST_DEVICE_ID, TEST_ACL_KEY));
+    cache.PutAclGranted(TEST_DEVICE_ID, TEST_ACL_KEY);
+    EXPECT_TRUE(cache.GetAclGranted(TEST_DEVICE_ID, TEST_ACL_KEY));
+    EXPECT_FALSE(cache.GetAclGranted(TEST_DEVICE_ID, TEST_OTHER_ACL_KEY));
+    EXPECT_FALSE(cache.GetAclGranted(TEST_OTHER_DEVICE_ID, TEST_ACL_KEY));
+
+    cache.entries_.front().aclExpireMs = 0;
+    EXPECT_FALSE(cache.GetAclGranted(TEST_DEVICE_ID, TEST_ACL_KEY));
+}
+
+/**
+ * @tc.name: dcamera_trust_cache_test_002
+ * @tc.desc: Verify os type results are dropped on remove and the cache stays bounded.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraTrustCacheTest, dcamera_trust_cache_test_002, TestSize.Level1)
+{
+    DCameraTrustCache &cache = DCameraTrustCache::GetInstance();
+    bool isInvalid = false;
+    EXPECT_FALSE(cache.GetOsType(TEST_DEVICE_ID, isInvalid));
+    cache.PutOsType(TEST_DEVICE_ID, true);
+    EXPECT_TRUE(cache.GetOsType(TEST_DEVICE_ID, isInvalid));
+    EXPECT_TRUE(isInvalid);
+    cache.PutAclGranted(TEST_DEVICE_ID, TEST_ACL_KEY);
+    EXPECT_EQ(cache.entries_.size(), 1U);
+
+    cache.Remove(TEST_DEVICE_ID);
+    EXPECT_FALSE(cache.GetOsType(TEST_DEVICE_ID, isInvalid));
+    EXPECT_FALSE(cache.GetAclGranted(TEST_DEVICE_ID, TEST_ACL_KEY));
+
+    size_t maxEntries = DCameraTrustCache::MAX_TRUST_ENTRIES;
+    for (size_t i = 0; i <= maxEntries; i++) {
+        cache.PutOsType(TEST_DEVICE_ID + std::to_string(i), false);
+    }
+    EXPECT_EQ(cache.entries_.size(), maxEntries);
+    EXPECT_FALSE(cache.GetOsType(TEST_DEVICE_ID + "0", isInvalid));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2024 Huawei Device Co., Ltd.
+* Copyright (c) 2024-2026 Huawei Device Co., Ltd.
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
 * You may obtain a copy of the License at
@@ -16,10 +16,13 @@
 #ifndef DISTRIBUTEDCAMERA_ALL_CONNECT_MANAGER_H
 #define DISTRIBUTEDCAMERA_ALL_CONNECT_MANAGER_H
 
+#include <deque>
+#include <functional>
 #include <memory>
 #include <map>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "dcamera_block_obj.h"
 #include "dcamera_collaboration_manager_capi.h"
@@ -27,6 +30,8 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+using ApplyResultCallback = std::function<void(int32_t result)>;
+
 class DCameraAllConnectManager {
 public:
     static DCameraAllConnectManager &GetInstance();
@@ -36,6 +41,11 @@ public:
                                 DCameraCollaborationBussinessStatus state);
     int32_t ApplyAdvancedResource(const std::string &peerNetworkId,
                                   DCameraCollaborationResourceRequestInfoSets *resourceRequest);
+    // The callback runs once the collaboration service answers, on its thread, so it must not block. A peer that
+    // already holds the resource or has an application pending does not apply again.
+    int32_t ApplyAdvancedResourceAsync(const std::string &peerNetworkId,
+        std::shared_ptr<DCameraCollaborationResourceRequestInfoSets> resourceRequest, ApplyResultCallback callback);
+    bool IsAdvancedResourceGranted(const std::string &peerNetworkId);
     std::shared_ptr<DCameraCollaborationResourceRequestInfoSets> BuildResourceRequest();
 
     static void SetSourceNetworkId(const std::string &networkId, int32_t socket);
@@ -48,11 +58,33 @@ public:
     int32_t RegisterLifecycleCallback();
     int32_t UnRegisterLifecycleCallback();
     static bool IsInited();
+    // Loads the allconnect so and registers the lifecycle callback on the first session that needs them.
+    static bool InitOnFirstUse();
 private:
     DCameraAllConnectManager();
     ~DCameraAllConnectManager() = default;
     int32_t GetAllConnectSoLoad();
 
+    enum class ApplyState : uint8_t {
+        PENDING,
+        GRANTED,
+    };
+    struct PeerApply {
+        ApplyState state = ApplyState::PENDING;
+        // 0 until the application goes out to the collaboration service.
+        uint64_t applyId = 0;
+        int64_t applyStartMs = 0;
+        std::shared_ptr<DCameraCollaborationResourceRequestInfoSets> request;
+        std::vector<ApplyResultCallback> callbacks;
+    };
+    // Called with applyLock_ held.
+    bool TakeExpiredApply(std::vector<ApplyResultCallback> &expired);
+    void StartNextApply();
+    bool CompleteApply(uint64_t applyId, int32_t result);
+    void AbortQueuedApply(const std::string &peerNetworkId);
+    void ReleaseAdvancedResource(const std::string &peerNetworkId);
+    void ClearApplies();
+
     static int32_t OnStop(const char *peerNetworkId);
     static int32_t ApplyResult(int32_t errorcode, int32_t result, const char *reason);
 
@@ -71,7 +103,11 @@ private:
     std::shared_ptr<DCameraCollaboration_HardwareRequestInfo> localHardwareList_;
     std::shared_ptr<DCameraCollaborationCommunicationRequestInfo> communicationRequest_;
 
-    static std::shared_ptr<DCameraBlockObject<bool>> applyResultBlock_;
+    std::mutex applyLock_;
+    std::map<std::string, PeerApply> peerApplies_;
+    // applyResult does not name the peer, so only the application at the front is out at a time.
+    std::deque<std::string> applyQueue_;
+    uint64_t applySeq_ = 0;
     static constexpr uint32_t BLOCK_INTERVAL_ALLCONNECT = 60 * 1000;
     static inline const std::string SERVICE_NAME {"DistributedCamera"};
 
@@ -83,6 +119,8 @@ private:
 
     static bool bInited_;
     static std::mutex bInitedLock_;
+    static std::mutex firstUseLock_;
+    static bool bFirstUseTried_;
 };
 
 } // namespace DistributedHardware
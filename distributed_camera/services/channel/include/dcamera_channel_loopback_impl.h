@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_CHANNEL_LOOPBACK_IMPL_H
+#define OHOS_DCAMERA_CHANNEL_LOOPBACK_IMPL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "icamera_channel.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/* Link an end applies to what it sends, a property left at 0 is switched off. */
+typedef struct {
+    int32_t latencyMs;
+    int32_t jitterMs;
+    int64_t bandwidthBps;
+    uint32_t lossPermille;
+    uint32_t seed;
+} DCameraLoopbackConfig;
+
+/*
+ * In process stand in for the softbus channels. A pair of ends hands every buffer one end sends to the listener
+ * of the other once the link delay is over, in the order it was sent. Video frames carry their frame info the way
+ * the softbus stream ext does and only they are lost, control and jpeg data are as reliable as softbus bytes.
+ * The deliver thread holds the end it sends for, a listener may release that end from a delivery.
+ */
+class DCameraChannelLoopbackImpl : public ICameraChannel,
+    public std::enable_shared_from_this<DCameraChannelLoopbackImpl> {
+public:
+    explicit DCameraChannelLoopbackImpl(const DCameraLoopbackConfig& config);
+    ~DCameraChannelLoopbackImpl() override;
+
+    static int32_t CreatePair(const DCameraLoopbackConfig& config,
+        std::shared_ptr<DCameraChannelLoopbackImpl>& sinkEnd, std::shared_ptr<DCameraChannelLoopbackImpl>& sourceEnd);
+    int32_t CloseSession() override;
+    int32_t CreateSession(std::vector<DCameraIndex>& camIndexs, std::string sessionFlag, DCameraSessionMode sessionMode,
+        std::shared_ptr<ICameraChannelListener>& listener) override;
+    int32_t ReleaseSession() override;
+    int32_t SendData(std::shared_ptr<DataBuffer>& buffer) override;
+    uint64_t GetLostCount() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+    struct PendingData {
+        Clock::time_point deliverTime;
+        std::shared_ptr<DataBuffer> payload;
+        std::vector<uint8_t> ext;
+    };
+
+    static bool IsValidConfig(const DCameraLoopbackConfig& config);
+    int32_t PackStreamExt(std::shared_ptr<DataBuffer>& buffer, std::vector<uint8_t>& ext);
+    Clock::time_point ScheduleDelivery(size_t size);
+    bool IsLost();
+    void StartDeliver();
+    void StopDeliver();
+    void DeliverThread();
+    void Deliver(PendingData& data);
+    std::shared_ptr<ICameraChannelListener> GetListener();
+    void OnOpened();
+    void OnClosed();
+
+    constexpr static int32_t US_PER_MS = 1000;
+    constexpr static int64_t US_PER_SECOND = 1000000;
+    constexpr static int64_t BITS_PER_BYTE = 8;
+    constexpr static uint32_t PERMILLE = 1000;
+
+    DCameraLoopbackConfig config_;
+    std::weak_ptr<DCameraChannelLoopbackImpl> peer_;
+    std::mutex stateMutex_;
+    std::shared_ptr<ICameraChannelListener> listener_;
+    std::vector<DCameraIndex> camIndexs_;
+    DCameraSessionMode mode_ = DCAMERA_SESSION_MODE_CTRL;
+    std::atomic<bool> isOpened_ = false;
+
+    std::mutex queueMutex_;
+    std::condition_variable queueCond_;
+    std::deque<PendingData> pending_;
+    std::thread deliverThread_;
+    bool isRunning_ = false;
+    std::mt19937 random_;
+    Clock::time_point linkFreeTime_;
+    Clock::time_point lastDeliverTime_;
+    std::atomic<uint64_t> lostCount_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_CHANNEL_LOOPBACK_IMPL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -31,13 +31,19 @@ public:
         std::shared_ptr<ICameraChannelListener>& listener) override;
     int32_t ReleaseSession() override;
     int32_t SendData(std::shared_ptr<DataBuffer>& buffer) override;
+    void SetSessionMux(bool isMux) override;
 
 private:
+    int32_t AttachCtrlSession(std::vector<DCameraIndex>& camIndexs, DCameraSessionMode sessionMode,
+        std::shared_ptr<ICameraChannelListener>& listener);
+
     std::shared_ptr<ICameraChannelListener> listener_;
     std::vector<DCameraIndex> camIndexs_;
     std::vector<std::shared_ptr<DCameraSoftbusSession>> softbusSessions_;
     std::string mySessionName_;
     DCameraSessionMode mode_ = DCAMERA_SESSION_MODE_CTRL;
+    bool isMux_ = false;
+    bool isMuxAttached_ = false;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
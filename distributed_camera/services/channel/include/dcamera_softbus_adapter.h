@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -24,9 +24,11 @@
 #include <thread>
 #include <condition_variable>
 
+#include "dcamera_sink_frame_info.h"
 #include "dcamera_softbus_session.h"
 #include "icamera_channel.h"
 #include "dhfwk_single_instance.h"
+#include "distributed_camera_constants.h"
 #include "socket.h"
 #include "trans_type.h"
 #include "device_manager.h"
@@ -61,6 +63,7 @@ public:
     void SourceOnMessage(int32_t socket, const void *data, uint32_t dataLen);
     void SourceOnStream(int32_t socket, const StreamData *data, const StreamData *ext,
         const StreamFrameInfo *param);
+    void SourceOnQos(int32_t socket, QoSEvent eventId, const QosTV *qos, uint32_t qosCount);
 
     int32_t SinkOnBind(int32_t socket, PeerSocketInfo info);
     void SinkOnShutDown(int32_t socket, ShutdownReason reason);
@@ -68,9 +71,19 @@ public:
     void SinkOnMessage(int32_t socket, const void *data, uint32_t dataLen);
     void SinkOnStream(int32_t socket, const StreamData *data, const StreamData *ext,
         const StreamFrameInfo *param);
+    void SinkOnQos(int32_t socket, QoSEvent eventId, const QosTV *qos, uint32_t qosCount);
 
+    // Frame info of an encoded frame as the stream ext carries it, the eis samples move out of the buffer.
+    void MakeSinkFrameInfo(std::shared_ptr<DataBuffer>& buffer, DCameraSinkFrameInfo& sinkFrameInfo);
     int32_t HandleSourceStreamExt(std::shared_ptr<DataBuffer>& buffer, const StreamData *ext);
+    void SetPeerFrameInfoFormat(const std::string& peerDevId, DCameraFrameInfoFormat format);
     void RecordSourceSocketSession(int32_t socket, std::shared_ptr<DCameraSoftbusSession> session);
+    // Control sessions a snapshot channel may share, an empty peer matches any source on the sink.
+    void RecordCtrlSession(const std::string& dhId, const std::string& peerDevId,
+        std::shared_ptr<DCameraSoftbusSession> session);
+    void EraseCtrlSession(const std::string& dhId, const std::string& peerDevId,
+        std::shared_ptr<DCameraSoftbusSession> session);
+    std::shared_ptr<DCameraSoftbusSession> GetCtrlSession(const std::string& dhId, const std::string& peerDevId);
 
     void CloseSessionWithNetWorkId(const std::string &networkId);
     void ProcessAuthorizationResult(const std::string &requestId, bool granted);
@@ -96,6 +109,7 @@ private:
     int32_t HandleConflictSession(int32_t socket, std::shared_ptr<DCameraSoftbusSession> session,
         const std::string& networkId);
     void ExecuteConflictCleanupAsync(int32_t socket, std::shared_ptr<DCameraSoftbusSession> session);
+    DCameraFrameInfoFormat GetSinkFrameInfoFormat(int32_t socket);
 private:
     std::mutex optLock_;
     const std::string PKG_NAME = "ohos.dhardware.dcamera";
@@ -127,6 +141,10 @@ private:
     std::map<int32_t, std::shared_ptr<DCameraSoftbusSession>> sinkSocketSessionMap_;
     std::mutex sourceSocketLock_;
     std::map<int32_t, std::shared_ptr<DCameraSoftbusSession>> sourceSocketSessionMap_;
+    std::mutex frameInfoFormatLock_;
+    std::map<std::string, DCameraFrameInfoFormat> peerFrameInfoFormatMap_;
+    std::mutex ctrlSessionLock_;
+    std::map<std::pair<std::string, std::string>, std::shared_ptr<DCameraSoftbusSession>> ctrlSessionMap_;
 
     // Authorization mechanism members
     std::mutex authRequestMutex_;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,6 +17,10 @@
 #define OHOS_DCAMERA_SOFTBUS_SESSION_H
 
 #include "event_handler.h"
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <string>
 
 #include "icamera_channel.h"
@@ -40,6 +44,9 @@ public:
     int32_t OnSessionOpened(int32_t socket, std::string networkId);
     int32_t OnSessionClose(int32_t sessionId);
     int32_t OnDataReceived(std::shared_ptr<DataBuffer>& buffer);
+    int32_t OnBytesReceived(const void *data, uint32_t dataLen);
+    std::shared_ptr<DataBuffer> AcquireRecvBuffer(size_t capacity);
+    void OnLinkQuality(const DCameraLinkQuality& quality);
     int32_t SendData(DCameraSessionMode mode, std::shared_ptr<DataBuffer>& buffer);
     std::string GetPeerDevId();
     std::string GetPeerSessionName();
@@ -52,6 +59,10 @@ public:
     void ReleaseSession();
     void SetConflict(bool isConflict);
     int32_t NotifyError(int32_t eventType, int32_t eventReason, const std::string& detail);
+    // Carries another stream of the camera on this socket, its packets are told apart by the header data type.
+    int32_t AttachMuxStream(DCameraSessionMode mode, std::shared_ptr<ICameraChannelListener> listener);
+    void DetachMuxStream(DCameraSessionMode mode);
+    bool IsMuxed();
 
 private:
     struct SessionDataHeader {
@@ -71,15 +82,23 @@ private:
     void PackRecvData(std::shared_ptr<DataBuffer>& buffer);
     void AssembleNoFrag(std::shared_ptr<DataBuffer>& buffer, SessionDataHeader& headerPara);
     void AssembleFrag(std::shared_ptr<DataBuffer>& buffer, SessionDataHeader& headerPara);
+    std::shared_ptr<DataBuffer> AssembleFragPayload(const uint8_t *payload, size_t payloadLen,
+        SessionDataHeader& headerPara);
     int32_t CheckUnPackBuffer(SessionDataHeader& headerPara);
-    void GetFragDataLen(uint8_t *ptrPacket, SessionDataHeader& headerPara);
-    int32_t UnPackSendData(std::shared_ptr<DataBuffer>& buffer, DCameraSendFuc memberFunc);
+    bool IsValidFragHeader(const SessionDataHeader& headerPara, size_t packetLen);
+    void GetFragDataLen(const uint8_t *ptrPacket, SessionDataHeader& headerPara);
+    int32_t UnPackSendData(std::shared_ptr<DataBuffer>& buffer, DCameraSendFuc memberFunc, DCameraSessionMode mode);
+    int32_t SendPacket(std::shared_ptr<DataBuffer>& buffer, DCameraSessionMode mode);
     void MakeFragDataHeader(const SessionDataHeader& headPara, uint8_t *header, uint32_t len);
-    void PostData(std::shared_ptr<DataBuffer>& buffer);
+    void PostData(std::shared_ptr<DataBuffer>& buffer, uint32_t dataType);
+    std::shared_ptr<ICameraChannelListener> GetListener(uint32_t dataType);
+    std::shared_ptr<DataBuffer> AcquireRecvBuffer(size_t capacity, uint32_t dataType);
+    void NotifyMuxState(int32_t state);
     uint16_t U16Get(const uint8_t *ptr);
     uint32_t U32Get(const uint8_t *ptr);
     void ResetAssembleFrag();
-    void SetHeadParaDataLen(SessionDataHeader& headPara, const uint32_t totalLen, const uint32_t offset);
+    void SetHeadParaDataLen(SessionDataHeader& headPara, const uint32_t totalLen, const uint32_t offset,
+        const uint32_t packetMaxLen);
 
     enum {
         FRAG_NULL = 0,
@@ -93,6 +112,8 @@ private:
     static const uint32_t BINARY_DATA_MAX_LEN = 4 * 1024 * 1024;
     static const uint32_t BINARY_DATA_PACKET_MAX_LEN = 4 * 1024 * 1024;
     static const uint32_t BINARY_DATA_PACKET_RESERVED_BUFFER = 512;
+    // A control message waits behind one snapshot fragment at most on a shared socket.
+    static const uint32_t MUX_DATA_PACKET_MAX_LEN = 256 * 1024;
     static const uint16_t PROTOCOL_VERSION = 1;
     static const uint16_t HEADER_UINT8_NUM = 1;
     static const uint16_t HEADER_UINT16_NUM = 2;
@@ -106,6 +127,7 @@ private:
     static const uint32_t BINARY_HEADER_SUBSEQ_OFFSET = 15;
     static const uint32_t BINARY_HEADER_DATALEN_OFFSET = 17;
 
+    std::mutex assembleMutex_;
     std::shared_ptr<DataBuffer> packBuffer_;
     bool isWaiting_;
     uint32_t nowSeq_;
@@ -126,6 +148,13 @@ private:
     std::map<DCameraSessionMode, DCameraSendFuc> sendFuncMap_;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
     bool isConflict_ = false;
+
+    std::mutex muxLock_;
+    std::map<uint32_t, std::shared_ptr<ICameraChannelListener>> muxListeners_;
+    std::atomic<bool> isMuxed_ = false;
+    std::mutex muxSendLock_;
+    std::condition_variable muxSendCond_;
+    std::atomic<int32_t> pendingCtrlSends_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -37,6 +37,8 @@ public:
         DCameraSessionMode sessionMode, std::shared_ptr<ICameraChannelListener>& listener) = 0;
     virtual int32_t ReleaseSession();
     virtual int32_t SendData(std::shared_ptr<DataBuffer>& buffer) = 0;
+    // A muxed bytes channel rides on the control session of the camera instead of a socket of its own.
+    virtual void SetSessionMux(bool isMux) {}
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -30,6 +30,14 @@ typedef enum {
     DCAMERA_CHANNEL_STATE_CONNECTED = 2,
 } DCameraChannelState;
 
+/* Link state softbus reports for a session, a field is 0 when the report does not carry it. */
+typedef struct {
+    bool isSatisfied;
+    int64_t bandwidthBps;
+    int32_t maxLatencyMs;
+    int32_t minLatencyMs;
+} DCameraLinkQuality;
+
 class ICameraChannelListener {
 public:
     virtual ~ICameraChannelListener() = default;
@@ -37,6 +45,13 @@ public:
     virtual void OnSessionState(int32_t state, std::string networkId) = 0;
     virtual void OnSessionError(int32_t eventType, int32_t eventReason, std::string detail) = 0;
     virtual void OnDataReceived(std::vector<std::shared_ptr<DataBuffer>>& buffers) = 0;
+    /* Receive buffer for the next stream frame, consumers may hand out their own input memory. */
+    virtual std::shared_ptr<DataBuffer> AcquireRecvBuffer(size_t capacity)
+    {
+        return DataBuffer::Acquire(capacity);
+    }
+    /* Softbus judged the link against the QoS the session was bound with. */
+    virtual void OnLinkQuality(const DCameraLinkQuality& quality) {}
 };
 } // namespace DistributedHardware
 } // namespace OHOS
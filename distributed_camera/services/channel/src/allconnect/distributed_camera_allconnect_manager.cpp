@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+* Copyright (c) 2024-2026 Huawei Device Co., Ltd.
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
 * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include "distributed_camera_allconnect_manager.h"
 #include "anonymous_string.h"
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <dlfcn.h>
@@ -22,6 +23,8 @@
 
 #include "dcamera_protocol.h"
 #include "dcamera_softbus_adapter.h"
+#include "dcamera_startup_profiler.h"
+#include "dcamera_utils_tools.h"
 #include "distributed_hardware_log.h"
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
@@ -34,7 +37,6 @@ constexpr const char *ALL_CONNECT_SO_PATH = "/system/lib64/";
 constexpr const char *ALL_CONNECT_SO_PATH = "/system/lib/";
 #endif
 constexpr const char *ALL_CONNECT_SO_NAME = "libcfwk_allconnect_client.z.so";
-std::shared_ptr<DCameraBlockObject<bool>> DCameraAllConnectManager::applyResultBlock_;
 DCameraAllConnectManager::DCameraAllConnectManager()
 {
     allConnectCallback_.onStop = &DCameraAllConnectManager::OnStop;
@@ -53,6 +55,8 @@ std::mutex DCameraAllConnectManager::netwkIdSinkSessionIdMapLock_;
 std::map<std::string, int> DCameraAllConnectManager::netwkIdSinkSessionIdMap_;
 bool DCameraAllConnectManager::bInited_ = false;
 std::mutex DCameraAllConnectManager::bInitedLock_;
+std::mutex DCameraAllConnectManager::firstUseLock_;
+bool DCameraAllConnectManager::bFirstUseTried_ = false;
 
 int32_t DCameraAllConnectManager::InitDCameraAllConnectManager()
 {
@@ -73,12 +77,16 @@ int32_t DCameraAllConnectManager::InitDCameraAllConnectManager()
 int32_t DCameraAllConnectManager::UnInitDCameraAllConnectManager()
 {
     DHLOGI("DCamera allconnect UnInitDCameraAllConnectManager begin");
+    // Same order as InitOnFirstUse takes them, a service started again loads the so on its first session.
+    std::lock_guard<std::mutex> firstUseLock(firstUseLock_);
+    bFirstUseTried_ = false;
     std::lock_guard<std::mutex> lock(bInitedLock_);
     if (dllHandle_ != nullptr) {
         dlclose(dllHandle_);
     }
     dllHandle_ = nullptr;
     bInited_ = false;
+    ClearApplies();
     return DistributedCameraErrno::DCAMERA_OK;
 }
 
@@ -88,6 +96,27 @@ bool DCameraAllConnectManager::IsInited()
     return bInited_;
 }
 
+bool DCameraAllConnectManager::InitOnFirstUse()
+{
+    std::lock_guard<std::mutex> lock(firstUseLock_);
+    // A device without the so fails the same way every time, so a failed load is not retried.
+    if (bFirstUseTried_) {
+        return IsInited();
+    }
+    bFirstUseTried_ = true;
+    DCameraStartupPhase phase("AllConnectLoad");
+    if (GetInstance().InitDCameraAllConnectManager() != DistributedCameraErrno::DCAMERA_OK) {
+        return false;
+    }
+    int32_t ret = GetInstance().RegisterLifecycleCallback();
+    if (ret != DistributedCameraErrno::DCAMERA_OK) {
+        DHLOGE("DCamera allconnect init and RegisterLifecycle failed");
+    } else {
+        DHLOGI("DCamera allconnect init and RegisterLifecycle success");
+    }
+    return true;
+}
+
 int32_t DCameraAllConnectManager::PublishServiceState(const std::string &peerNetworkId,
     const std::string &dhId, DCameraCollaborationBussinessStatus state)
 {
@@ -129,34 +158,212 @@ int32_t DCameraAllConnectManager::ApplyAdvancedResource(const std::string &peerN
     DCameraCollaborationResourceRequestInfoSets *resourceRequest)
 {
     DHLOGI("DCamera allconnect ApplyAdvancedResource begin");
-    std::lock_guard<std::mutex> lock(allConnectLock_);
-    if (dllHandle_ == nullptr) {
+    auto resultBlock = std::make_shared<DCameraBlockObject<int32_t>>(BLOCK_INTERVAL_ALLCONNECT,
+        DistributedCameraErrno::DCAMERA_ERR_APPLY_RESULT);
+    // The request stays the caller's, it is no longer used once this call returns.
+    std::shared_ptr<DCameraCollaborationResourceRequestInfoSets> request(
+        std::shared_ptr<DCameraCollaborationResourceRequestInfoSets>(), resourceRequest);
+    ApplyAdvancedResourceAsync(peerNetworkId, request, [resultBlock](int32_t result) {
+        resultBlock->SetValue(result);
+    });
+    int32_t ret = resultBlock->GetValue();
+    if (ret != DistributedCameraErrno::DCAMERA_OK) {
+        DHLOGE("DCamera allconnect applyResult is reject");
+        AbortQueuedApply(peerNetworkId);
+    }
+    return ret;
+}
+
+int32_t DCameraAllConnectManager::ApplyAdvancedResourceAsync(const std::string &peerNetworkId,
+    std::shared_ptr<DCameraCollaborationResourceRequestInfoSets> resourceRequest, ApplyResultCallback callback)
+{
+    CHECK_AND_RETURN_RET_LOG(callback == nullptr, DistributedCameraErrno::DCAMERA_BAD_VALUE,
+        "DCamera allconnect ApplyAdvancedResourceAsync callback is nullptr");
+    bool isSupported = true;
+    {
+        std::lock_guard<std::mutex> lock(allConnectLock_);
+        isSupported = dllHandle_ != nullptr;
+    }
+    if (!isSupported) {
         DHLOGE("DCamera allconnect dllHandle_ is nullptr, all connect not support.");
+        callback(DistributedCameraErrno::DCAMERA_OK);
         return DistributedCameraErrno::DCAMERA_OK;
     }
-    if (allConnect_.dCameraCollaborationApplyAdvancedResource == nullptr) {
-        DHLOGE("DCamera allconnect PublishServiceState is nullptr, all connect function not load.");
-        return DistributedCameraErrno::DCAMERA_ERR_DLOPEN;
+    bool isGranted = false;
+    bool needStart = false;
+    std::vector<ApplyResultCallback> expired;
+    {
+        std::lock_guard<std::mutex> lock(applyLock_);
+        needStart = TakeExpiredApply(expired) && !applyQueue_.empty();
+        auto iter = peerApplies_.find(peerNetworkId);
+        if (iter == peerApplies_.end()) {
+            PeerApply &apply = peerApplies_[peerNetworkId];
+            apply.request = resourceRequest;
+            apply.callbacks.push_back(callback);
+            applyQueue_.push_back(peerNetworkId);
+            needStart = needStart || applyQueue_.size() == 1;
+        } else if (iter->second.state == ApplyState::GRANTED) {
+            isGranted = true;
+        } else {
+            DHLOGI("DCamera allconnect apply already pending, peerNetworkId: %{public}s",
+                GetAnonyString(peerNetworkId).c_str());
+            iter->second.callbacks.push_back(callback);
+        }
     }
-
-    if (applyResultBlock_ == nullptr) {
-        applyResultBlock_ = std::make_shared<DCameraBlockObject<bool>>(BLOCK_INTERVAL_ALLCONNECT, false);
+    for (auto &expiredCallback : expired) {
+        expiredCallback(DistributedCameraErrno::DCAMERA_ERR_APPLY_RESULT);
+    }
+    if (isGranted) {
+        DHLOGI("DCamera allconnect resource already granted, peerNetworkId: %{public}s",
+            GetAnonyString(peerNetworkId).c_str());
+        callback(DistributedCameraErrno::DCAMERA_OK);
+        return DistributedCameraErrno::DCAMERA_OK;
+    }
+    if (needStart) {
+        StartNextApply();
     }
+    return DistributedCameraErrno::DCAMERA_OK;
+}
 
-    int32_t ret = allConnect_.dCameraCollaborationApplyAdvancedResource(peerNetworkId.c_str(),
-        SERVICE_NAME.c_str(),
-        resourceRequest,
-        &allConnectCallback_);
-    if (ret != DistributedCameraErrno::DCAMERA_OK) {
+bool DCameraAllConnectManager::TakeExpiredApply(std::vector<ApplyResultCallback> &expired)
+{
+    // A result that never came must not hold back the peers queued behind it.
+    if (applyQueue_.empty()) {
+        return false;
+    }
+    auto front = peerApplies_.find(applyQueue_.front());
+    if (front == peerApplies_.end() || front->second.applyId == 0 ||
+        GetNowTimeStampMs() - front->second.applyStartMs <= BLOCK_INTERVAL_ALLCONNECT) {
+        return false;
+    }
+    DHLOGE("DCamera allconnect apply result timeout, peerNetworkId: %{public}s",
+        GetAnonyString(front->first).c_str());
+    expired.swap(front->second.callbacks);
+    peerApplies_.erase(front);
+    applyQueue_.pop_front();
+    return true;
+}
+
+bool DCameraAllConnectManager::IsAdvancedResourceGranted(const std::string &peerNetworkId)
+{
+    std::lock_guard<std::mutex> lock(applyLock_);
+    auto iter = peerApplies_.find(peerNetworkId);
+    return iter != peerApplies_.end() && iter->second.state == ApplyState::GRANTED;
+}
+
+void DCameraAllConnectManager::StartNextApply()
+{
+    while (true) {
+        std::string peerNetworkId;
+        std::shared_ptr<DCameraCollaborationResourceRequestInfoSets> request;
+        uint64_t applyId = 0;
+        {
+            std::lock_guard<std::mutex> lock(applyLock_);
+            if (applyQueue_.empty()) {
+                return;
+            }
+            peerNetworkId = applyQueue_.front();
+            PeerApply &apply = peerApplies_[peerNetworkId];
+            if (apply.applyId != 0) {
+                return;
+            }
+            apply.applyId = ++applySeq_;
+            apply.applyStartMs = GetNowTimeStampMs();
+            applyId = apply.applyId;
+            request = apply.request;
+        }
+        decltype(allConnect_.dCameraCollaborationApplyAdvancedResource) applyFunc = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(allConnectLock_);
+            applyFunc = allConnect_.dCameraCollaborationApplyAdvancedResource;
+        }
+        if (applyFunc == nullptr) {
+            DHLOGE("DCamera allconnect ApplyAdvancedResource is nullptr, all connect function not load.");
+            CompleteApply(applyId, DistributedCameraErrno::DCAMERA_ERR_DLOPEN);
+            continue;
+        }
+        // The result may be delivered before the call returns, so no lock is held across it.
+        int32_t ret = applyFunc(peerNetworkId.c_str(), SERVICE_NAME.c_str(), request.get(), &allConnectCallback_);
+        if (ret == DistributedCameraErrno::DCAMERA_OK) {
+            return;
+        }
         DHLOGE("DCamera allconnect ApplyAdvancedResource fail, ret %{public}d", ret);
-        return DistributedCameraErrno::DCAMERA_ERR_APPLY_RESULT;
+        CompleteApply(applyId, DistributedCameraErrno::DCAMERA_ERR_APPLY_RESULT);
     }
-    auto success = applyResultBlock_->GetValue();
-    if (!success) {
-        DHLOGE("DCamera allconnect applyResult is reject");
-        return DistributedCameraErrno::DCAMERA_ERR_APPLY_RESULT;
+}
+
+bool DCameraAllConnectManager::CompleteApply(uint64_t applyId, int32_t result)
+{
+    std::vector<ApplyResultCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(applyLock_);
+        if (applyQueue_.empty()) {
+            return false;
+        }
+        auto iter = peerApplies_.find(applyQueue_.front());
+        if (iter == peerApplies_.end() || iter->second.applyId == 0 ||
+            (applyId != 0 && iter->second.applyId != applyId)) {
+            return false;
+        }
+        callbacks.swap(iter->second.callbacks);
+        applyQueue_.pop_front();
+        if (result == DistributedCameraErrno::DCAMERA_OK) {
+            iter->second.state = ApplyState::GRANTED;
+            iter->second.request = nullptr;
+        } else {
+            peerApplies_.erase(iter);
+        }
+    }
+    for (auto &callback : callbacks) {
+        callback(result);
+    }
+    return true;
+}
+
+void DCameraAllConnectManager::AbortQueuedApply(const std::string &peerNetworkId)
+{
+    std::vector<ApplyResultCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(applyLock_);
+        auto iter = peerApplies_.find(peerNetworkId);
+        if (iter == peerApplies_.end() || iter->second.state != ApplyState::PENDING || iter->second.applyId != 0) {
+            return;
+        }
+        callbacks.swap(iter->second.callbacks);
+        peerApplies_.erase(iter);
+        auto queueIter = std::find(applyQueue_.begin(), applyQueue_.end(), peerNetworkId);
+        if (queueIter != applyQueue_.end()) {
+            applyQueue_.erase(queueIter);
+        }
+    }
+    for (auto &callback : callbacks) {
+        callback(DistributedCameraErrno::DCAMERA_ERR_APPLY_RESULT);
+    }
+}
+
+void DCameraAllConnectManager::ReleaseAdvancedResource(const std::string &peerNetworkId)
+{
+    std::lock_guard<std::mutex> lock(applyLock_);
+    auto iter = peerApplies_.find(peerNetworkId);
+    if (iter != peerApplies_.end() && iter->second.state == ApplyState::GRANTED) {
+        peerApplies_.erase(iter);
+    }
+}
+
+void DCameraAllConnectManager::ClearApplies()
+{
+    std::vector<ApplyResultCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(applyLock_);
+        for (auto &apply : peerApplies_) {
+            callbacks.insert(callbacks.end(), apply.second.callbacks.begin(), apply.second.callbacks.end());
+        }
+        peerApplies_.clear();
+        applyQueue_.clear();
+    }
+    for (auto &callback : callbacks) {
+        callback(DistributedCameraErrno::DCAMERA_ERR_ALLCONNECT);
     }
-    return DistributedCameraErrno::DCAMERA_OK;
 }
 
 int32_t DCameraAllConnectManager::GetAllConnectSoLoad()
@@ -243,22 +450,26 @@ int32_t DCameraAllConnectManager::UnRegisterLifecycleCallback()
 
 int32_t DCameraAllConnectManager::ApplyResult(int32_t errorcode, int32_t result, const char *reason)
 {
-    CHECK_AND_RETURN_RET_LOG(applyResultBlock_ == nullptr, DistributedCameraErrno::DCAMERA_ERR_APPLY_RESULT,
-        "DCamera allconnect ApplyResult applyResultBlock_ is nullptr");
     DHLOGI("DCamera allconnect ApplyResult begin");
+    int32_t ret = DistributedCameraErrno::DCAMERA_OK;
     if (result != PASS) {
         DHLOGE("DCamera allconnect Apply Result is Reject, errorcode is %{public}d, reason is %{public}s",
             errorcode, reason);
-        applyResultBlock_->SetValue(false);
+        ret = DistributedCameraErrno::DCAMERA_ERR_APPLY_RESULT;
+    }
+    if (!GetInstance().CompleteApply(0, ret)) {
+        DHLOGE("DCamera allconnect ApplyResult without pending application");
         return DistributedCameraErrno::DCAMERA_ERR_APPLY_RESULT;
     }
-    applyResultBlock_->SetValue(true);
-    return DistributedCameraErrno::DCAMERA_OK;
+    GetInstance().StartNextApply();
+    return ret;
 }
 
 int32_t DCameraAllConnectManager::OnStop(const char *peerNetworkId)
 {
     DHLOGI("DCamera allconnect OnStop begin peerNetworkId:%{public}s", GetAnonyString(peerNetworkId).c_str());
+    // The collaboration is over, the next open of this peer applies again.
+    GetInstance().ReleaseAdvancedResource(peerNetworkId);
     DCameraSoftbusAdapter::GetInstance().CloseSessionWithNetWorkId(peerNetworkId);
 
     return DistributedCameraErrno::DCAMERA_OK;
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_channel_loopback_impl.h"
+
+#include <algorithm>
+#include <securec.h>
+#include <sys/prctl.h>
+
+#include "dcamera_sink_frame_info.h"
+#include "dcamera_softbus_adapter.h"
+#include "dcamera_utils_tools.h"
+#include "distributed_camera_constants.h"
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string LOOPBACK_DELIVER_THREAD = "DCamLoopback";
+}
+
+DCameraChannelLoopbackImpl::DCameraChannelLoopbackImpl(const DCameraLoopbackConfig& config)
+    : config_(config), random_(config.seed)
+{
+}
+
+DCameraChannelLoopbackImpl::~DCameraChannelLoopbackImpl()
+{
+    StopDeliver();
+}
+
+int32_t DCameraChannelLoopbackImpl::CreatePair(const DCameraLoopbackConfig& config,
+    std::shared_ptr<DCameraChannelLoopbackImpl>& sinkEnd, std::shared_ptr<DCameraChannelLoopbackImpl>& sourceEnd)
+{
+    if (!IsValidConfig(config)) {
+        DHLOGE("loopback config invalid, latency: %{public}d jitter: %{public}d loss: %{public}u",
+            config.latencyMs, config.jitterMs, config.lossPermille);
+        return DCAMERA_BAD_VALUE;
+    }
+    sinkEnd = std::make_shared<DCameraChannelLoopbackImpl>(config);
+    // Both directions see the same link, only their losses are drawn apart.
+    DCameraLoopbackConfig sourceConfig = config;
+    sourceConfig.seed = config.seed + 1;
+    sourceEnd = std::make_shared<DCameraChannelLoopbackImpl>(sourceConfig);
+    sinkEnd->peer_ = sourceEnd;
+    sourceEnd->peer_ = sinkEnd;
+    return DCAMERA_OK;
+}
+
+bool DCameraChannelLoopbackImpl::IsValidConfig(const DCameraLoopbackConfig& config)
+{
+    return config.latencyMs >= 0 && config.jitterMs >= 0 && config.bandwidthBps >= 0 && config.lossPermille <= PERMILLE;
+}
+
+int32_t DCameraChannelLoopbackImpl::CloseSession()
+{
+    DHLOGI("DCameraChannelLoopbackImpl CloseSession mode: %{public}d", mode_);
+    OnClosed();
+    std::shared_ptr<DCameraChannelLoopbackImpl> peer = peer_.lock();
+    if (peer != nullptr) {
+        peer->OnClosed();
+    }
+    return DCAMERA_OK;
+}
+
+int32_t DCameraChannelLoopbackImpl::CreateSession(std::vector<DCameraIndex>& camIndexs, std::string sessionFlag,
+    DCameraSessionMode sessionMode, std::shared_ptr<ICameraChannelListener>& listener)
+{
+    if (camIndexs.empty() || camIndexs.size() > DCAMERA_MAX_NUM || listener == nullptr) {
+        return DCAMERA_BAD_VALUE;
+    }
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        camIndexs_.assign(camIndexs.begin(), camIndexs.end());
+        mode_ = sessionMode;
+        listener_ = listener;
+    }
+    StartDeliver();
+    DHLOGI("DCameraChannelLoopbackImpl CreateSession flag: %{public}s mode: %{public}d", sessionFlag.c_str(),
+        sessionMode);
+    // The link comes up once both ends listen, whichever end is created last opens it for both.
+    std::shared_ptr<DCameraChannelLoopbackImpl> peer = peer_.lock();
+    if (peer != nullptr && peer->GetListener() != nullptr) {
+        OnOpened();
+        peer->OnOpened();
+    }
+    return DCAMERA_OK;
+}
+
+int32_t DCameraChannelLoopbackImpl::ReleaseSession()
+{
+    DHLOGI("DCameraChannelLoopbackImpl ReleaseSession mode: %{public}d", mode_);
+    CloseSession();
+    StopDeliver();
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    listener_ = nullptr;
+    return DCAMERA_OK;
+}
+
+int32_t DCameraChannelLoopbackImpl::SendData(std::shared_ptr<DataBuffer>& buffer)
+{
+    CHECK_AND_RETURN_RET_LOG(buffer == nullptr, DCAMERA_BAD_VALUE, "Data buffer is null");
+    if (!isOpened_.load()) {
+        DHLOGE("DCameraChannelLoopbackImpl SendData failed, session not opened");
+        return DCAMERA_BAD_OPERATE;
+    }
+    // Softbus copies the data out before it returns, the sender may reuse the buffer right away.
+    PendingData data;
+    data.payload = DataBuffer::Acquire(buffer->Size());
+    int32_t ret = memcpy_s(data.payload->Data(), data.payload->Size(), buffer->Data(), buffer->Size());
+    CHECK_AND_RETURN_RET_LOG(ret != EOK, DCAMERA_MEMORY_OPT_ERROR, "Copy loopback data failed.");
+    if (mode_ == DCAMERA_SESSION_MODE_VIDEO) {
+        ret = PackStreamExt(buffer, data.ext);
+        CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, ret, "Pack loopback stream ext failed.");
+    }
+
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (mode_ == DCAMERA_SESSION_MODE_VIDEO && IsLost()) {
+        lostCount_++;
+        return DCAMERA_OK;
+    }
+    data.deliverTime = ScheduleDelivery(buffer->Size());
+    pending_.push_back(std::move(data));
+    queueCond_.notify_one();
+    return DCAMERA_OK;
+}
+
+uint64_t DCameraChannelLoopbackImpl::GetLostCount() const
+{
+    return lostCount_.load();
+}
+
+int32_t DCameraChannelLoopbackImpl::PackStreamExt(std::shared_ptr<DataBuffer>& buffer, std::vector<uint8_t>& ext)
+{
+    DCameraSinkFrameInfo sinkFrameInfo;
+    DCameraSoftbusAdapter::GetInstance().MakeSinkFrameInfo(buffer, sinkFrameInfo);
+    ext.resize(sinkFrameInfo.GetBinarySize());
+    size_t extLen = 0;
+    int32_t ret = sinkFrameInfo.MarshalBinary(ext.data(), ext.size(), extLen);
+    ext.resize(extLen);
+    return ret;
+}
+
+DCameraChannelLoopbackImpl::Clock::time_point DCameraChannelLoopbackImpl::ScheduleDelivery(size_t size)
+{
+    // A capped link sends one buffer after the other, a buffer only starts once the one before it is out.
+    Clock::time_point now = Clock::now();
+    Clock::time_point sendTime = std::max(now, linkFreeTime_);
+    int64_t transmitUs = 0;
+    if (config_.bandwidthBps > 0) {
+        transmitUs = static_cast<int64_t>(size) * BITS_PER_BYTE * US_PER_SECOND / config_.bandwidthBps;
+    }
+    linkFreeTime_ = sendTime + std::chrono::microseconds(transmitUs);
+    int64_t delayUs = static_cast<int64_t>(config_.latencyMs) * US_PER_MS;
+    if (config_.jitterMs > 0) {
+        int64_t jitterUs = static_cast<int64_t>(config_.jitterMs) * US_PER_MS;
+        delayUs += std::uniform_int_distribution<int64_t>(-jitterUs, jitterUs)(random_);
+    }
+    // Jitter spreads the arrivals but never reorders them, one socket delivers in sequence.
+    Clock::time_point deliverTime = linkFreeTime_ + std::chrono::microseconds(std::max<int64_t>(delayUs, 0));
+    lastDeliverTime_ = std::max(deliverTime, lastDeliverTime_);
+    return lastDeliverTime_;
+}
+
+bool DCameraChannelLoopbackImpl::IsLost()
+{
+    if (config_.lossPermille == 0) {
+        return false;
+    }
+    return std::uniform_int_distribution<uint32_t>(0, PERMILLE - 1)(random_) < config_.lossPermille;
+}
+
+void DCameraChannelLoopbackImpl::StartDeliver()
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (isRunning_) {
+        return;
+    }
+    isRunning_ = true;
+    std::shared_ptr<DCameraChannelLoopbackImpl> self = shared_from_this();
+    deliverThread_ = std::thread([self]() { self->DeliverThread(); });
+}
+
+void DCameraChannelLoopbackImpl::StopDeliver()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        isRunning_ = false;
+        pending_.clear();
+        queueCond_.notify_all();
+    }
+    if (!deliverThread_.joinable()) {
+        return;
+    }
+    // A listener may release the channel from a delivery, the thread then ends on its own and drops the channel.
+    if (deliverThread_.get_id() == std::this_thread::get_id()) {
+        deliverThread_.detach();
+        return;
+    }
+    deliverThread_.join();
+}
+
+void DCameraChannelLoopbackImpl::DeliverThread()
+{
+    prctl(PR_SET_NAME, LOOPBACK_DELIVER_THREAD.c_str());
+    while (true) {
+        PendingData data;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueCond_.wait(lock, [this]() { return !isRunning_ || !pending_.empty(); });
+            if (!isRunning_) {
+                return;
+            }
+            Clock::time_point deliverTime = pending_.front().deliverTime;
+            if (queueCond_.wait_until(lock, deliverTime, [this]() { return !isRunning_; })) {
+                return;
+            }
+            data = std::move(pending_.front());
+            pending_.pop_front();
+        }
+        Deliver(data);
+    }
+}
+
+void DCameraChannelLoopbackImpl::Deliver(PendingData& data)
+{
+    std::shared_ptr<DCameraChannelLoopbackImpl> peer = peer_.lock();
+    std::shared_ptr<ICameraChannelListener> listener = (peer == nullptr) ? nullptr : peer->GetListener();
+    if (listener == nullptr || !peer->isOpened_.load()) {
+        return;
+    }
+    // The receiving end takes the data into memory its consumer hands out, as the softbus session does.
+    size_t size = data.payload->Size();
+    std::shared_ptr<DataBuffer> buffer = listener->AcquireRecvBuffer(size);
+    if (buffer == nullptr || buffer->Size() != size) {
+        buffer = DataBuffer::Acquire(size);
+    }
+    int32_t ret = memcpy_s(buffer->Data(), buffer->Size(), data.payload->Data(), size);
+    CHECK_AND_RETURN_LOG(ret != EOK, "Copy loopback received data failed.");
+    if (!data.ext.empty()) {
+        buffer->SetInt64(DataBufferKey::RECV_TIME_US, GetNowTimeStampUs());
+        StreamData ext = { reinterpret_cast<char *>(data.ext.data()), static_cast<int>(data.ext.size()) };
+        ret = DCameraSoftbusAdapter::GetInstance().HandleSourceStreamExt(buffer, &ext);
+        if (ret != DCAMERA_OK) {
+            DHLOGE("Handle loopback stream ext failed, ret is: %{public}d", ret);
+        }
+    }
+    std::vector<std::shared_ptr<DataBuffer>> buffers;
+    buffers.push_back(buffer);
+    listener->OnDataReceived(buffers);
+}
+
+std::shared_ptr<ICameraChannelListener> DCameraChannelLoopbackImpl::GetListener()
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    return listener_;
+}
+
+void DCameraChannelLoopbackImpl::OnOpened()
+{
+    std::shared_ptr<ICameraChannelListener> listener = GetListener();
+    if (listener == nullptr || isOpened_.exchange(true)) {
+        return;
+    }
+    std::string peerDevId;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        peerDevId = camIndexs_.empty() ? "" : camIndexs_[0].devId_;
+    }
+    listener->OnSessionState(DCAMERA_CHANNEL_STATE_CONNECTED, peerDevId);
+}
+
+void DCameraChannelLoopbackImpl::OnClosed()
+{
+    std::shared_ptr<ICameraChannelListener> listener = GetListener();
+    if (!isOpened_.exchange(false) || listener == nullptr) {
+        return;
+    }
+    listener->OnSessionState(DCAMERA_CHANNEL_STATE_DISCONNECTED, "");
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -41,6 +41,10 @@ int32_t DCameraChannelSinkImpl::CloseSession()
         DHLOGE("DCameraChannelSinkImpl CloseSession %{public}s failed", GetAnonyString(mySessionName_).c_str());
         return DCAMERA_BAD_OPERATE;
     }
+    if (isMuxAttached_) {
+        softbusSession_->DetachMuxStream(mode_);
+        return DCAMERA_OK;
+    }
     int32_t ret = softbusSession_->CloseSession();
     if (ret != DCAMERA_OK) {
         DHLOGE("DCameraChannelSinkImpl CloseSession %{public}s ret: %{public}d",
@@ -73,6 +77,9 @@ int32_t DCameraChannelSinkImpl::CreateSession(std::vector<DCameraIndex>& camInde
     std::string peerDevId = camIndexs[0].devId_;
     std::string dhId = camIndexs[0].dhId_;
     std::string peerSessionName = SESSION_HEAD + sessionFlag;
+    if (isMux_ && sessionMode == DCAMERA_SESSION_MODE_JPEG) {
+        return AttachCtrlSession(camIndexs, sessionMode, listener);
+    }
     DHLOGI("DCameraChannelSinkImpl CreateSession Listen Start, devId: %{public}s", GetAnonyString(myDevId).c_str());
     // sink_server_listen
     softbusSession_ = std::make_shared<DCameraSoftbusSession>(dhId, myDevId, mySessionName_, peerDevId,
@@ -83,6 +90,9 @@ int32_t DCameraChannelSinkImpl::CreateSession(std::vector<DCameraIndex>& camInde
         return ret;
     }
     DCameraSoftbusAdapter::GetInstance().sinkSessions_[mySessionName_] = softbusSession_;
+    if (sessionMode == DCAMERA_SESSION_MODE_CTRL) {
+        DCameraSoftbusAdapter::GetInstance().RecordCtrlSession(dhId, "", softbusSession_);
+    }
     DHLOGI("DCameraChannelSinkImpl CreateSession Listen End, devId: %{public}s", GetAnonyString(myDevId).c_str());
     return DCAMERA_OK;
 }
@@ -93,6 +103,15 @@ int32_t DCameraChannelSinkImpl::ReleaseSession()
     if (softbusSession_ == nullptr) {
         return DCAMERA_OK;
     }
+    if (isMuxAttached_) {
+        softbusSession_->DetachMuxStream(mode_);
+        softbusSession_ = nullptr;
+        isMuxAttached_ = false;
+        return DCAMERA_OK;
+    }
+    if (mode_ == DCAMERA_SESSION_MODE_CTRL) {
+        DCameraSoftbusAdapter::GetInstance().EraseCtrlSession(softbusSession_->GetMyDhId(), "", softbusSession_);
+    }
     softbusSession_->ReleaseSession();
     DCameraSoftbusAdapter::GetInstance().sinkSessions_.erase(softbusSession_->GetMySessionName());
     softbusSession_ = nullptr;
@@ -112,5 +131,33 @@ int32_t DCameraChannelSinkImpl::SendData(std::shared_ptr<DataBuffer>& buffer)
     }
     return ret;
 }
+
+void DCameraChannelSinkImpl::SetSessionMux(bool isMux)
+{
+    isMux_ = isMux;
+}
+
+int32_t DCameraChannelSinkImpl::AttachCtrlSession(std::vector<DCameraIndex>& camIndexs,
+    DCameraSessionMode sessionMode, std::shared_ptr<ICameraChannelListener>& listener)
+{
+    // The sink serves one source per camera, its control session is found by the camera alone.
+    std::shared_ptr<DCameraSoftbusSession> ctrlSession =
+        DCameraSoftbusAdapter::GetInstance().GetCtrlSession(camIndexs[0].dhId_, "");
+    if (ctrlSession == nullptr) {
+        DHLOGE("DCameraChannelSinkImpl no control session to mux %{public}s on",
+            GetAnonyString(mySessionName_).c_str());
+        return DCAMERA_NOT_FOUND;
+    }
+    int32_t ret = ctrlSession->AttachMuxStream(sessionMode, listener);
+    if (ret != DCAMERA_OK) {
+        DHLOGE("DCameraChannelSinkImpl mux %{public}s failed, ret: %{public}d",
+            GetAnonyString(mySessionName_).c_str(), ret);
+        return ret;
+    }
+    softbusSession_ = ctrlSession;
+    isMuxAttached_ = true;
+    DHLOGI("DCameraChannelSinkImpl %{public}s muxed on the control session", GetAnonyString(mySessionName_).c_str());
+    return DCAMERA_OK;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
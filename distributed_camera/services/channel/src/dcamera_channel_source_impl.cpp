@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -45,6 +45,10 @@ int32_t DCameraChannelSourceImpl::CloseSession()
         if ((*iter) == nullptr) {
             continue;
         }
+        if (isMuxAttached_) {
+            (*iter)->DetachMuxStream(mode_);
+            continue;
+        }
         int32_t retOpen = (*iter)->CloseSession();
         if (retOpen != DCAMERA_OK) {
             DHLOGE("DCameraChannelSourceImpl CloseSession %{public}s failed, ret: %{public}d",
@@ -78,6 +82,9 @@ int32_t DCameraChannelSourceImpl::CreateSession(std::vector<DCameraIndex>& camIn
     mode_ = sessionMode;
     DHLOGI("DCameraChannelSourceImpl CreateSession Start, name: %{public}s devId: %{public}s",
         GetAnonyString(mySessionName_).c_str(), GetAnonyString(myDevId).c_str());
+    if (isMux_ && sessionMode == DCAMERA_SESSION_MODE_JPEG) {
+        return AttachCtrlSession(camIndexs_, sessionMode, listener);
+    }
     for (auto iter = camIndexs_.begin(); iter != camIndexs_.end(); iter++) {
         std::string peerDevId = (*iter).devId_;
         std::string dhId = (*iter).dhId_;
@@ -91,6 +98,9 @@ int32_t DCameraChannelSourceImpl::CreateSession(std::vector<DCameraIndex>& camIn
             return DCAMERA_BAD_VALUE;
         }
         DCameraSoftbusAdapter::GetInstance().RecordSourceSocketSession(socketId, softbusSess);
+        if (sessionMode == DCAMERA_SESSION_MODE_CTRL) {
+            DCameraSoftbusAdapter::GetInstance().RecordCtrlSession(dhId, peerDevId, softbusSess);
+        }
         softbusSessions_.push_back(softbusSess);
     }
     DHLOGI("DCameraChannelSourceImpl CreateSession End");
@@ -104,9 +114,18 @@ int32_t DCameraChannelSourceImpl::ReleaseSession()
         if ((*iter) == nullptr) {
             continue;
         }
+        if (isMuxAttached_) {
+            (*iter)->DetachMuxStream(mode_);
+            continue;
+        }
+        if (mode_ == DCAMERA_SESSION_MODE_CTRL) {
+            DCameraSoftbusAdapter::GetInstance().EraseCtrlSession((*iter)->GetMyDhId(), (*iter)->GetPeerDevId(),
+                *iter);
+        }
         (*iter)->ReleaseSession();
     }
     std::vector<std::shared_ptr<DCameraSoftbusSession>>().swap(softbusSessions_);
+    isMuxAttached_ = false;
     return DCAMERA_OK;
 }
 
@@ -130,5 +149,37 @@ int32_t DCameraChannelSourceImpl::SendData(std::shared_ptr<DataBuffer>& buffer)
     }
     return ret;
 }
+
+void DCameraChannelSourceImpl::SetSessionMux(bool isMux)
+{
+    isMux_ = isMux;
+}
+
+int32_t DCameraChannelSourceImpl::AttachCtrlSession(std::vector<DCameraIndex>& camIndexs,
+    DCameraSessionMode sessionMode, std::shared_ptr<ICameraChannelListener>& listener)
+{
+    for (auto iter = camIndexs.begin(); iter != camIndexs.end(); iter++) {
+        std::shared_ptr<DCameraSoftbusSession> ctrlSession =
+            DCameraSoftbusAdapter::GetInstance().GetCtrlSession((*iter).dhId_, (*iter).devId_);
+        if (ctrlSession == nullptr) {
+            DHLOGE("DCameraChannelSourceImpl no control session to mux %{public}s on",
+                GetAnonyString(mySessionName_).c_str());
+            ReleaseSession();
+            return DCAMERA_NOT_FOUND;
+        }
+        int32_t ret = ctrlSession->AttachMuxStream(sessionMode, listener);
+        if (ret != DCAMERA_OK) {
+            DHLOGE("DCameraChannelSourceImpl mux %{public}s failed, ret: %{public}d",
+                GetAnonyString(mySessionName_).c_str(), ret);
+            ReleaseSession();
+            return ret;
+        }
+        softbusSessions_.push_back(ctrlSession);
+        isMuxAttached_ = true;
+    }
+    DHLOGI("DCameraChannelSourceImpl %{public}s muxed on the control session",
+        GetAnonyString(mySessionName_).c_str());
+    return DCAMERA_OK;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,7 +15,10 @@
 
 #include "anonymous_string.h"
 #include "dcamera_hisysevent_adapter.h"
+#include "dcamera_hitrace_adapter.h"
+#include "dcamera_imu_ring.h"
 #include "dcamera_sink_frame_info.h"
+#include "dcamera_thread_role.h"
 #include "dcamera_softbus_adapter.h"
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
@@ -31,6 +34,7 @@
 #include "dcamera_protocol.h"
 #include "cJSON.h"
 #include "dcamera_utils_tools.h"
+#include <algorithm>
 #include <random>
 #include <sstream>
 #include <iomanip>
@@ -49,7 +53,50 @@ static QosTV g_qosInfo[] = {
     { .qos = QOS_TYPE_MAX_LATENCY, .value = DCAMERA_QOS_TYPE_MAX_LATENCY },
     { .qos = QOS_TYPE_MIN_LATENCY, .value = DCAMERA_QOS_TYPE_MIN_LATENCY}
 };
+static QosTV g_ctrlQosInfo[] = {
+    { .qos = QOS_TYPE_MIN_BW, .value = DCAMERA_QOS_CTRL_MIN_BW },
+    { .qos = QOS_TYPE_MAX_LATENCY, .value = DCAMERA_QOS_TYPE_MAX_LATENCY },
+    { .qos = QOS_TYPE_MIN_LATENCY, .value = DCAMERA_QOS_TYPE_MIN_LATENCY}
+};
+static QosTV g_jpegQosInfo[] = {
+    { .qos = QOS_TYPE_MIN_BW, .value = DCAMERA_QOS_TYPE_MIN_BW },
+    { .qos = QOS_TYPE_MAX_LATENCY, .value = DCAMERA_QOS_JPEG_MAX_LATENCY },
+    { .qos = QOS_TYPE_MIN_LATENCY, .value = DCAMERA_QOS_TYPE_MIN_LATENCY}
+};
 static uint32_t g_QosTV_Param_Index = static_cast<uint32_t>(sizeof(g_qosInfo) / sizeof(QosTV));
+
+static QosTV *GetSessionQosInfo(DCameraSessionMode sessionMode)
+{
+    switch (sessionMode) {
+        case DCAMERA_SESSION_MODE_CTRL:
+            return g_ctrlQosInfo;
+        case DCAMERA_SESSION_MODE_JPEG:
+            return g_jpegQosInfo;
+        default:
+            return g_qosInfo;
+    }
+}
+
+static DCameraLinkQuality ParseLinkQuality(QoSEvent eventId, const QosTV *qos, uint32_t qosCount)
+{
+    DCameraLinkQuality quality = { eventId == QOS_SATISFIED, 0, 0, 0 };
+    for (uint32_t idx = 0; qos != nullptr && idx < qosCount; idx++) {
+        switch (qos[idx].qos) {
+            case QOS_TYPE_MIN_BW:
+                quality.bandwidthBps = std::max<int64_t>(qos[idx].value, 0);
+                break;
+            case QOS_TYPE_MAX_LATENCY:
+                quality.maxLatencyMs = qos[idx].value;
+                break;
+            case QOS_TYPE_MIN_LATENCY:
+                quality.minLatencyMs = qos[idx].value;
+                break;
+            default:
+                break;
+        }
+    }
+    return quality;
+}
 #ifdef DCAMERA_WAKEUP
 static TransWakeUpOnParam g_wakeUpParam = {
     .mode = PERIODIC_WAKE_UP_MODE,
@@ -102,6 +149,12 @@ static void DCameraSourceOnStream(int32_t socket, const StreamData *data, const
     return;
 }
 
+static void DCameraSourceOnQos(int32_t socket, QoSEvent eventId, const QosTV *qos, uint32_t qosCount)
+{
+    DCameraSoftbusAdapter::GetInstance().SourceOnQos(socket, eventId, qos, qosCount);
+    return;
+}
+
 // sink
 static void DCameraSinkOnBind(int32_t socket, PeerSocketInfo info)
 {
@@ -133,6 +186,12 @@ static void DCameraSinkOnStream(int32_t socket, const StreamData *data, const St
     DCameraSoftbusAdapter::GetInstance().SinkOnStream(socket, data, ext, param);
     return;
 }
+
+static void DCameraSinkOnQos(int32_t socket, QoSEvent eventId, const QosTV *qos, uint32_t qosCount)
+{
+    DCameraSoftbusAdapter::GetInstance().SinkOnQos(socket, eventId, qos, qosCount);
+    return;
+}
 // LCOV_EXCL_STOP
 DCameraSoftbusAdapter::DCameraSoftbusAdapter()
 {
@@ -146,6 +205,7 @@ DCameraSoftbusAdapter::DCameraSoftbusAdapter()
     sourceListener.OnBytes = DCameraSourceOnBytes;
     sourceListener.OnMessage = DCameraSourceOnMessage;
     sourceListener.OnStream = DCameraSourceOnStream;
+    sourceListener.OnQos = DCameraSourceOnQos;
     sessListeners_[DCAMERA_CHANNLE_ROLE_SOURCE] = sourceListener;
 
     ISocketListener sinkListener;
@@ -154,6 +214,7 @@ DCameraSoftbusAdapter::DCameraSoftbusAdapter()
     sinkListener.OnBytes = DCameraSinkOnBytes;
     sinkListener.OnMessage = DCameraSinkOnMessage;
     sinkListener.OnStream = DCameraSinkOnStream;
+    sinkListener.OnQos = DCameraSinkOnQos;
     sessListeners_[DCAMERA_CHANNLE_ROLE_SINK] = sinkListener;
 }
 
@@ -209,7 +270,7 @@ int32_t DCameraSoftbusAdapter::CreatSoftBusSinkSocketServer(std::string mySessio
         }
         mySocketSet_.insert(socketId);
     }
-    int32_t ret = Listen(socketId, g_qosInfo, g_QosTV_Param_Index, &sessListeners_[role]);
+    int32_t ret = Listen(socketId, GetSessionQosInfo(sessionMode), g_QosTV_Param_Index, &sessListeners_[role]);
     if (ret != DCAMERA_OK) {
         DHLOGE("create socket server error, ret: %{public}d", ret);
         Shutdown(socketId);
@@ -263,7 +324,7 @@ int32_t DCameraSoftbusAdapter::CreateSoftBusSourceSocketClient(std::string myDhI
         DHLOGE("create socket client error, socket is invalid");
         return DCAMERA_BAD_VALUE;
     }
-    int ret = Bind(socketId, g_qosInfo, g_QosTV_Param_Index, &sessListeners_[role]);
+    int ret = Bind(socketId, GetSessionQosInfo(sessionMode), g_QosTV_Param_Index, &sessListeners_[role]);
     if (ret != DCAMERA_OK) {
         DHLOGE("create socket client error");
         Shutdown(socketId);
@@ -321,55 +382,95 @@ int32_t DCameraSoftbusAdapter::SendSofbusBytes(int32_t socket, std::shared_ptr<D
     return SendBytes(socket, buffer->Data(), buffer->Size());
 }
 
-int32_t DCameraSoftbusAdapter::SendSofbusStream(int32_t socket, std::shared_ptr<DataBuffer>& buffer)
+void DCameraSoftbusAdapter::MakeSinkFrameInfo(std::shared_ptr<DataBuffer>& buffer,
+    DCameraSinkFrameInfo& sinkFrameInfo)
 {
-    CHECK_AND_RETURN_RET_LOG(buffer == nullptr, DCAMERA_BAD_VALUE, "Data buffer is null");
-    StreamData streamData = { reinterpret_cast<char *>(buffer->Data()), buffer->Size() };
     int64_t timeStamp;
-    if (!buffer->FindInt64(TIME_STAMP_US, timeStamp)) {
+    if (!buffer->FindInt64(DataBufferKey::TIME_STAMP_US, timeStamp)) {
         DHLOGD("SendSofbusStream find %{public}s failed.", TIME_STAMP_US.c_str());
     }
     int32_t frameType;
-    if (!buffer->FindInt32(FRAME_TYPE, frameType)) {
+    if (!buffer->FindInt32(DataBufferKey::FRAME_TYPE, frameType)) {
         DHLOGD("SendSofbusStream find %{public}s failed.", FRAME_TYPE.c_str());
     }
     int32_t index;
-    if (!buffer->FindInt32(INDEX, index)) {
+    if (!buffer->FindInt32(DataBufferKey::INDEX, index)) {
         DHLOGD("SendSofbusStream find %{public}s failed.", INDEX.c_str());
     }
     int64_t startEncodeT;
-    if (!buffer->FindInt64(START_ENCODE_TIME_US, startEncodeT)) {
+    if (!buffer->FindInt64(DataBufferKey::START_ENCODE_TIME_US, startEncodeT)) {
         DHLOGD("SendSofbusStream find %{public}s failed.", START_ENCODE_TIME_US.c_str());
     }
     int64_t finishEncodeT;
-    if (!buffer->FindInt64(FINISH_ENCODE_TIME_US, finishEncodeT)) {
+    if (!buffer->FindInt64(DataBufferKey::FINISH_ENCODE_TIME_US, finishEncodeT)) {
         DHLOGD("SendSofbusStream find %{public}s failed.", FINISH_ENCODE_TIME_US.c_str());
     }
-    std::string jsonStr = "";
-    DCameraSinkFrameInfo sinkFrameInfo;
     sinkFrameInfo.pts_ = timeStamp;
     sinkFrameInfo.type_ = frameType;
     sinkFrameInfo.index_ = index;
     sinkFrameInfo.startEncodeT_ = startEncodeT;
     sinkFrameInfo.finishEncodeT_ = finishEncodeT;
     sinkFrameInfo.sendT_ = GetNowTimeStampUs();
-    sinkFrameInfo.rawTime_ = std::to_string(timeStamp);
+    sinkFrameInfo.rawTimeUs_ = timeStamp;
+    int32_t encoderPreset = 0;
+    if (buffer->FindInt32(DataBufferKey::ENCODER_PRESET, encoderPreset)) {
+        sinkFrameInfo.encoderPreset_ = static_cast<uint8_t>(encoderPreset);
+    }
 #ifdef DCAMERA_OPEN_STABILE
-    sinkFrameInfo.imuInfo_ = buffer->eisInfo_.imuData;
+    sinkFrameInfo.exposureTime_ = buffer->eisInfo_.exposureTime;
+    sinkFrameInfo.accData_.swap(buffer->eisInfo_.accData);
+    sinkFrameInfo.gyroData_.swap(buffer->eisInfo_.gyroData);
 #endif
-    sinkFrameInfo.Marshal(jsonStr);
-    DHLOGI("send videoPts=%{public}s to softbus,frameType:%{public}d", sinkFrameInfo.rawTime_.c_str(), frameType);
-    StreamData ext = { const_cast<char *>(jsonStr.c_str()), jsonStr.length() };
+}
+
+int32_t DCameraSoftbusAdapter::SendSofbusStream(int32_t socket, std::shared_ptr<DataBuffer>& buffer)
+{
+    CHECK_AND_RETURN_RET_LOG(buffer == nullptr, DCAMERA_BAD_VALUE, "Data buffer is null");
+    StreamData streamData = { reinterpret_cast<char *>(buffer->Data()), buffer->Size() };
+    DCameraSinkFrameInfo sinkFrameInfo;
+    MakeSinkFrameInfo(buffer, sinkFrameInfo);
+    int64_t timeStamp = sinkFrameInfo.pts_;
+    // The frame info only keeps the low byte of the codec flags, the softbus frame type is judged on all of them.
+    int32_t frameType = 0;
+    buffer->FindInt32(DataBufferKey::FRAME_TYPE, frameType);
+    int32_t index = sinkFrameInfo.index_;
+    std::string jsonStr = "";
+    uint8_t binaryExt[DCameraSinkFrameInfo::BINARY_HEADER_LEN] = { 0 };
+    std::vector<uint8_t> binaryExtWithImu;
+    StreamData ext = { nullptr, 0 };
+    if (GetSinkFrameInfoFormat(socket) == DCAMERA_FRAME_INFO_FORMAT_BINARY) {
+        uint8_t *extData = binaryExt;
+        size_t extCapacity = sizeof(binaryExt);
+        if (sinkFrameInfo.GetBinarySize() > extCapacity) {
+            binaryExtWithImu.resize(sinkFrameInfo.GetBinarySize());
+            extData = binaryExtWithImu.data();
+            extCapacity = binaryExtWithImu.size();
+        }
+        size_t extLen = 0;
+        int32_t ret = sinkFrameInfo.MarshalBinary(extData, extCapacity, extLen);
+        CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, ret, "marshal binary frame info failed, ret %{public}d", ret);
+        ext = { reinterpret_cast<char *>(extData), static_cast<int>(extLen) };
+    } else {
+        sinkFrameInfo.rawTime_ = std::to_string(timeStamp);
+        sinkFrameInfo.Marshal(jsonStr);
+        ext = { const_cast<char *>(jsonStr.c_str()), static_cast<int>(jsonStr.length()) };
+    }
+    DHLOGI_EVERY_N(DCAMERA_PRODUCER_FPS_DEFAULT, "send videoPts=%{public}" PRId64 " to softbus,frameType:%{public}d",
+        timeStamp, frameType);
     StreamFrameInfo param = { 0 };
     param.frameType = (frameType == AVCODEC_BUFFER_FLAG_NONE) ? SOFTBUS_VIDEO_P_FRAME : SOFTBUS_VIDEO_I_FRAME;
     param.seqNum = index;
-    int32_t ret = SendStream(socket, &streamData, &ext, &param);
+    int32_t ret = SOFTBUS_OK;
+    {
+        DCameraFrameTrace frameTrace(DCAMERA_FRAME_SEND_STREAM, index);
+        ret = SendStream(socket, &streamData, &ext, &param);
+    }
     if (ret != SOFTBUS_OK) {
         DHLOGD("SendSofbusStream failed, ret is %{public}d", ret);
         return DCAMERA_BAD_VALUE;
     }
-    DHLOGI("send videoPts=%{public}s success,frameType:%{public}d,seqNum:%{public}d",
-        sinkFrameInfo.rawTime_.c_str(), frameType, index);
+    DHLOGI_EVERY_N(DCAMERA_PRODUCER_FPS_DEFAULT, "send videoPts=%{public}" PRId64
+        " success,frameType:%{public}d,seqNum:%{public}d", timeStamp, frameType, index);
     return DCAMERA_OK;
 }
 
@@ -445,13 +546,11 @@ void DCameraSoftbusAdapter::SourceOnBytes(int32_t socket, const void *data, uint
         return;
     }
 
-    std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(dataLen);
-    ret = memcpy_s(buffer->Data(), buffer->Capacity(), data, dataLen);
-    if (ret != EOK) {
-        DHLOGE("source callback send bytes memcpy_s failed ret: %{public}d", ret);
+    ret = session->OnBytesReceived(data, dataLen);
+    if (ret != DCAMERA_OK) {
+        DHLOGE("source callback send bytes handle failed ret: %{public}d", ret);
         return;
     }
-    session->OnDataReceived(buffer);
     DHLOGI("source callback send bytes end, socket: %{public}d", socket);
     return;
 }
@@ -484,8 +583,8 @@ void DCameraSoftbusAdapter::SourceOnStream(int32_t socket, const StreamData *dat
         return;
     }
 
-    std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(data->bufLen);
-    buffer->SetInt64(RECV_TIME_US, recvT);
+    std::shared_ptr<DataBuffer> buffer = session->AcquireRecvBuffer(data->bufLen);
+    buffer->SetInt64(DataBufferKey::RECV_TIME_US, recvT);
     ret = memcpy_s(buffer->Data(), buffer->Capacity(), reinterpret_cast<uint8_t *>(data->buf), data->bufLen);
     if (ret != EOK) {
         DHLOGE("SourceOnStream memcpy_s failed ret: %{public}d", ret);
@@ -498,6 +597,18 @@ void DCameraSoftbusAdapter::SourceOnStream(int32_t socket, const StreamData *dat
     session->OnDataReceived(buffer);
 }
 
+void DCameraSoftbusAdapter::SourceOnQos(int32_t socket, QoSEvent eventId, const QosTV *qos, uint32_t qosCount)
+{
+    DHLOGI("source on qos, socket: %{public}d event: %{public}d count: %{public}u", socket, eventId, qosCount);
+    std::shared_ptr<DCameraSoftbusSession> session = nullptr;
+    int32_t ret = DCameraSoftbusSourceGetSession(socket, session);
+    if (ret != DCAMERA_OK || session == nullptr) {
+        DHLOGE("SourceOnQos not find socket %{public}d", socket);
+        return;
+    }
+    session->OnLinkQuality(ParseLinkQuality(eventId, qos, qosCount));
+}
+
 int32_t DCameraSoftbusAdapter::HandleSourceStreamExt(std::shared_ptr<DataBuffer>& buffer, const StreamData *ext)
 {
     if (ext == nullptr) {
@@ -510,16 +621,23 @@ int32_t DCameraSoftbusAdapter::HandleSourceStreamExt(std::shared_ptr<DataBuffer>
         return DCAMERA_BAD_VALUE;
     }
 
-    std::string jsonStr(reinterpret_cast<const char*>(ext->buf), ext->bufLen);
     DCameraSinkFrameInfo sinkFrameInfo;
-    int32_t ret = sinkFrameInfo.Unmarshal(jsonStr);
+    const uint8_t *extData = reinterpret_cast<const uint8_t *>(ext->buf);
+    bool isBinary = DCameraSinkFrameInfo::IsBinary(extData, static_cast<size_t>(extLen));
+    int32_t ret = DCAMERA_OK;
+    if (isBinary) {
+        ret = sinkFrameInfo.UnmarshalBinary(extData, static_cast<size_t>(extLen));
+    } else {
+        std::string jsonStr(reinterpret_cast<const char*>(ext->buf), ext->bufLen);
+        ret = sinkFrameInfo.Unmarshal(jsonStr);
+    }
     if (ret != DCAMERA_OK) {
         DHLOGE("Unmarshal sinkFrameInfo failed.");
         return DCAMERA_BAD_VALUE;
     }
     int64_t recvT;
     CHECK_AND_RETURN_RET_LOG(buffer == nullptr, DCAMERA_BAD_VALUE, "Data buffer is null");
-    if (!buffer->FindInt64(RECV_TIME_US, recvT)) {
+    if (!buffer->FindInt64(DataBufferKey::RECV_TIME_US, recvT)) {
         DHLOGD("HandleSourceStreamExt find %{public}s failed.", RECV_TIME_US.c_str());
     }
     DCameraFrameInfo frameInfo;
@@ -527,7 +645,10 @@ int32_t DCameraSoftbusAdapter::HandleSourceStreamExt(std::shared_ptr<DataBuffer>
     frameInfo.pts = sinkFrameInfo.pts_;
     frameInfo.index = sinkFrameInfo.index_;
     frameInfo.ver = sinkFrameInfo.ver_;
-    if (sinkFrameInfo.rawTime_.empty()) {
+    frameInfo.encoderPreset = sinkFrameInfo.encoderPreset_;
+    if (isBinary) {
+        frameInfo.rawTime = sinkFrameInfo.rawTimeUs_;
+    } else if (sinkFrameInfo.rawTime_.empty()) {
         frameInfo.rawTime = 0;
     } else {
         char *endptr = nullptr;
@@ -540,13 +661,16 @@ int32_t DCameraSoftbusAdapter::HandleSourceStreamExt(std::shared_ptr<DataBuffer>
             frameInfo.rawTime = raw_time_val;
         }
     }
-    DHLOGI("get videoPts=%{public}" PRId64 " from softbus", frameInfo.rawTime);
+    DHLOGI_EVERY_N(DCAMERA_PRODUCER_FPS_DEFAULT, "get videoPts=%{public}" PRId64 " from softbus", frameInfo.rawTime);
     frameInfo.timePonit.startEncode = sinkFrameInfo.startEncodeT_;
     frameInfo.timePonit.finishEncode = sinkFrameInfo.finishEncodeT_;
     frameInfo.timePonit.send = sinkFrameInfo.sendT_;
     frameInfo.timePonit.recv = recvT;
     buffer->frameInfo_ = frameInfo;
-    buffer->eisInfo_.imuData = sinkFrameInfo.imuInfo_;
+    if (!sinkFrameInfo.accData_.empty() || !sinkFrameInfo.gyroData_.empty()) {
+        DCameraImuStore::GetInstance().SetExposureTime(sinkFrameInfo.exposureTime_);
+        DCameraImuStore::GetInstance().PushSamples(sinkFrameInfo.accData_, sinkFrameInfo.gyroData_);
+    }
     return DCAMERA_OK;
 }
 
@@ -656,7 +780,8 @@ int32_t DCameraSoftbusAdapter::SinkOnBind(int32_t socket, PeerSocketInfo info)
     if (ret != DCAMERA_OK) {
         DHLOGE("sink bind socket error, not find socket %{public}d", socket);
     }
-    if (session->GetPeerSessionName().find("_control") != std::string::npos && DCameraAllConnectManager::IsInited()) {
+    if (session->GetPeerSessionName().find("_control") != std::string::npos &&
+        DCameraAllConnectManager::InitOnFirstUse()) {
         ret = DCameraAllConnectManager::GetInstance().PublishServiceState(info.networkId,
             session->GetMyDhId(), SCM_CONNECTED);
         if (ret != DCAMERA_OK) {
@@ -723,7 +848,7 @@ void DCameraSoftbusAdapter::ExecuteConflictCleanupAsync(int32_t socket,
     std::shared_ptr<DCameraSoftbusSession> session)
 {
     DHLOGI("Submitting async cleanup task for socket: %{public}d", socket);
-    
+    int32_t qos = DCameraThreadRoleRegistry::GetInstance().GetFfrtQos(DCAMERA_THREAD_CONTROL);
     ffrt::submit([this, socket, session]() {
         DHLOGI("Async cleanup: sending error notification for socket: %{public}d", socket);
         prctl(PR_SET_NAME, "DCamConflictCleanup");
@@ -739,7 +864,7 @@ void DCameraSoftbusAdapter::ExecuteConflictCleanupAsync(int32_t socket,
             std::lock_guard<std::mutex> autoLock(trustSessionIdLock_);
             session->SetSessionId(trustSessionId_.controlSessionId_);
         }
-        }, {}, {}, ffrt::task_attr().name("DCamConflictCleanup").qos(ffrt::qos_user_initiated));
+        }, {}, {}, ffrt::task_attr().name("DCamConflictCleanup").qos(qos));
 }
 
 int32_t DCameraSoftbusAdapter::ParseValueFromCjson(std::string args, std::string key)
@@ -844,13 +969,11 @@ void DCameraSoftbusAdapter::SinkOnBytes(int32_t socket, const void *data, uint32
         DHLOGE("sink on bytes error, can not find session %{public}d", socket);
         return;
     }
-    std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(dataLen);
-    ret = memcpy_s(buffer->Data(), buffer->Capacity(), data, dataLen);
-    if (ret != EOK) {
-        DHLOGE("sink on bytes memcpy_s failed ret: %{public}d", ret);
+    ret = session->OnBytesReceived(data, dataLen);
+    if (ret != DCAMERA_OK) {
+        DHLOGE("sink on bytes handle failed ret: %{public}d", ret);
         return;
     }
-    session->OnDataReceived(buffer);
     DHLOGI("sink on bytes end, socket: %{public}d", socket);
     return;
 }
@@ -879,7 +1002,7 @@ void DCameraSoftbusAdapter::SinkOnStream(int32_t socket, const StreamData *data,
         return;
     }
 
-    std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(data->bufLen);
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(data->bufLen);
     ret = memcpy_s(buffer->Data(), buffer->Capacity(), reinterpret_cast<uint8_t *>(data->buf), data->bufLen);
     if (ret != EOK) {
         DHLOGE("SinkOnStream error, memcpy_s failed ret: %{public}d", ret);
@@ -889,6 +1012,18 @@ void DCameraSoftbusAdapter::SinkOnStream(int32_t socket, const StreamData *data,
     return;
 }
 
+void DCameraSoftbusAdapter::SinkOnQos(int32_t socket, QoSEvent eventId, const QosTV *qos, uint32_t qosCount)
+{
+    DHLOGI("sink on qos, socket: %{public}d event: %{public}d count: %{public}u", socket, eventId, qosCount);
+    std::shared_ptr<DCameraSoftbusSession> session = nullptr;
+    int32_t ret = DCameraSoftbusSinkGetSession(socket, session);
+    if (ret != DCAMERA_OK || session == nullptr) {
+        DHLOGE("SinkOnQos error, can not find socket %{public}d", socket);
+        return;
+    }
+    session->OnLinkQuality(ParseLinkQuality(eventId, qos, qosCount));
+}
+
 // LCOV_EXCL_START
 int32_t DCameraSoftbusAdapter::GetLocalNetworkId(std::string& myDevId)
 {
@@ -902,6 +1037,61 @@ int32_t DCameraSoftbusAdapter::GetLocalNetworkId(std::string& myDevId)
     myDevId = std::string(basicInfo.networkId);
     return DCAMERA_OK;
 }
+void DCameraSoftbusAdapter::SetPeerFrameInfoFormat(const std::string& peerDevId, DCameraFrameInfoFormat format)
+{
+    DHLOGI("peer %{public}s frame info format %{public}d", GetAnonyString(peerDevId).c_str(), format);
+    std::lock_guard<std::mutex> autoLock(frameInfoFormatLock_);
+    peerFrameInfoFormatMap_[peerDevId] = format;
+}
+
+void DCameraSoftbusAdapter::RecordCtrlSession(const std::string& dhId, const std::string& peerDevId,
+    std::shared_ptr<DCameraSoftbusSession> session)
+{
+    CHECK_AND_RETURN_LOG(session == nullptr, "RecordCtrlSession error, session is null");
+    std::lock_guard<std::mutex> autoLock(ctrlSessionLock_);
+    ctrlSessionMap_[std::make_pair(dhId, peerDevId)] = session;
+}
+
+void DCameraSoftbusAdapter::EraseCtrlSession(const std::string& dhId, const std::string& peerDevId,
+    std::shared_ptr<DCameraSoftbusSession> session)
+{
+    std::lock_guard<std::mutex> autoLock(ctrlSessionLock_);
+    auto iter = ctrlSessionMap_.find(std::make_pair(dhId, peerDevId));
+    if (iter != ctrlSessionMap_.end() && iter->second == session) {
+        ctrlSessionMap_.erase(iter);
+    }
+}
+
+std::shared_ptr<DCameraSoftbusSession> DCameraSoftbusAdapter::GetCtrlSession(const std::string& dhId,
+    const std::string& peerDevId)
+{
+    std::lock_guard<std::mutex> autoLock(ctrlSessionLock_);
+    auto iter = ctrlSessionMap_.find(std::make_pair(dhId, peerDevId));
+    if (iter == ctrlSessionMap_.end()) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+DCameraFrameInfoFormat DCameraSoftbusAdapter::GetSinkFrameInfoFormat(int32_t socket)
+{
+    std::string peerDevId;
+    {
+        std::lock_guard<std::mutex> autoLock(sinkSocketLock_);
+        auto iter = sinkSocketSessionMap_.find(socket);
+        if (iter == sinkSocketSessionMap_.end() || iter->second == nullptr) {
+            return DCAMERA_FRAME_INFO_FORMAT_JSON;
+        }
+        peerDevId = iter->second->GetPeerDevId();
+    }
+    std::lock_guard<std::mutex> autoLock(frameInfoFormatLock_);
+    auto iter = peerFrameInfoFormatMap_.find(peerDevId);
+    if (iter == peerFrameInfoFormatMap_.end()) {
+        return DCAMERA_FRAME_INFO_FORMAT_JSON;
+    }
+    return iter->second;
+}
+
 void DCameraSoftbusAdapter::CloseSessionWithNetWorkId(const std::string &networkId)
 {
     DHLOGI("DCamera allconnect CloseSessionWithNetworkId begin");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include "dcamera_softbus_session.h"
 
+#include <cinttypes>
 #include <securec.h>
 
 #include "anonymous_string.h"
@@ -96,6 +97,7 @@ int32_t DCameraSoftbusSession::OnSessionOpened(int32_t socket, std::string netwo
         return DCAMERA_OK;
     }
     listener_->OnSessionState(DCAMERA_CHANNEL_STATE_CONNECTED, networkId);
+    NotifyMuxState(DCAMERA_CHANNEL_STATE_CONNECTED);
     DHLOGI("open current session end, socket: %{public}d", socket);
     return DCAMERA_OK;
 }
@@ -112,6 +114,7 @@ int32_t DCameraSoftbusSession::OnSessionClose(int32_t sessionId)
         return DCAMERA_OK;
     }
     listener_->OnSessionState(DCAMERA_CHANNEL_STATE_DISCONNECTED, "");
+    NotifyMuxState(DCAMERA_CHANNEL_STATE_DISCONNECTED);
     return DCAMERA_OK;
 }
 
@@ -126,10 +129,72 @@ int32_t DCameraSoftbusSession::OnDataReceived(std::shared_ptr<DataBuffer>& buffe
     return DCAMERA_OK;
 }
 
+int32_t DCameraSoftbusSession::OnBytesReceived(const void *data, uint32_t dataLen)
+{
+    CHECK_AND_RETURN_RET_LOG(data == nullptr || dataLen == 0, DCAMERA_BAD_VALUE, "Received bytes are empty.");
+    const uint8_t *ptrPacket = static_cast<const uint8_t *>(data);
+    SessionDataHeader headerPara = {};
+    if (mode_ != DCAMERA_SESSION_MODE_VIDEO && dataLen >= BINARY_HEADER_FRAG_LEN) {
+        GetFragDataLen(ptrPacket, headerPara);
+    }
+    if (mode_ == DCAMERA_SESSION_MODE_VIDEO || dataLen < BINARY_HEADER_FRAG_LEN ||
+        headerPara.fragFlag == FRAG_START_END) {
+        std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(dataLen);
+        int32_t ret = memcpy_s(buffer->Data(), buffer->Size(), data, dataLen);
+        CHECK_AND_RETURN_RET_LOG(ret != EOK, DCAMERA_MEMORY_OPT_ERROR, "Copy received bytes failed.");
+        return OnDataReceived(buffer);
+    }
+    if (!IsValidFragHeader(headerPara, dataLen)) {
+        return DCAMERA_BAD_VALUE;
+    }
+
+    // Fragments are copied from the softbus memory straight into the reassembly buffer.
+    std::shared_ptr<DataBuffer> packBuffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(assembleMutex_);
+        packBuffer = AssembleFragPayload(ptrPacket + BINARY_HEADER_FRAG_LEN, dataLen - BINARY_HEADER_FRAG_LEN,
+            headerPara);
+    }
+    if (packBuffer != nullptr && eventHandler_ != nullptr) {
+        uint32_t dataType = headerPara.dataType;
+        eventHandler_->PostTask([this, packBuffer, dataType]() mutable {
+            PostData(packBuffer, dataType);
+        });
+    }
+    return DCAMERA_OK;
+}
+
+std::shared_ptr<DataBuffer> DCameraSoftbusSession::AcquireRecvBuffer(size_t capacity)
+{
+    return AcquireRecvBuffer(capacity, mode_);
+}
+
+std::shared_ptr<DataBuffer> DCameraSoftbusSession::AcquireRecvBuffer(size_t capacity, uint32_t dataType)
+{
+    std::shared_ptr<ICameraChannelListener> listener = GetListener(dataType);
+    if (listener == nullptr) {
+        return DataBuffer::Acquire(capacity);
+    }
+    std::shared_ptr<DataBuffer> buffer = listener->AcquireRecvBuffer(capacity);
+    if (buffer == nullptr || buffer->Size() != capacity) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return buffer;
+}
+
+void DCameraSoftbusSession::OnLinkQuality(const DCameraLinkQuality& quality)
+{
+    DHLOGI("session link quality, sessionName: %{public}s satisfied: %{public}d bandwidth: %{public}" PRId64
+        " latency: %{public}d-%{public}d", GetAnonyString(mySessionName_).c_str(), quality.isSatisfied,
+        quality.bandwidthBps, quality.minLatencyMs, quality.maxLatencyMs);
+    CHECK_AND_RETURN_LOG(listener_ == nullptr, "listener_ is null.");
+    listener_->OnLinkQuality(quality);
+}
+
 void DCameraSoftbusSession::DealRecvData(std::shared_ptr<DataBuffer>& buffer)
 {
     if (mode_ == DCAMERA_SESSION_MODE_VIDEO) {
-        PostData(buffer);
+        PostData(buffer, mode_);
         return;
     }
     PackRecvData(buffer);
@@ -152,12 +217,7 @@ void DCameraSoftbusSession::PackRecvData(std::shared_ptr<DataBuffer>& buffer)
     uint8_t *ptrPacket = buffer->Data();
     SessionDataHeader headerPara;
     GetFragDataLen(ptrPacket, headerPara);
-    if (buffer->Size() != (headerPara.dataLen + BINARY_HEADER_FRAG_LEN) || headerPara.dataLen > headerPara.totalLen ||
-        headerPara.dataLen > BINARY_DATA_MAX_LEN || headerPara.totalLen > BINARY_DATA_MAX_TOTAL_LEN) {
-        bufferSize = static_cast<uint64_t>(buffer->Size());
-        DHLOGE("pack recv data failed, size: %{public}" PRIu64", dataLen: %{public}d, totalLen: %{public}d sess: "
-            "%{public}s peerSess: %{public}s", bufferSize, headerPara.dataLen, headerPara.totalLen,
-            GetAnonyString(mySessionName_).c_str(), GetAnonyString(peerSessionName_).c_str());
+    if (!IsValidFragHeader(headerPara, buffer->Size())) {
         return;
     }
     bufferSize = static_cast<uint64_t>(buffer->Size());
@@ -173,6 +233,20 @@ void DCameraSoftbusSession::PackRecvData(std::shared_ptr<DataBuffer>& buffer)
         "%{public}" PRId64" end", bufferSize, headerPara.dataLen, headerPara.totalLen, GetNowTimeStampUs());
 }
 
+bool DCameraSoftbusSession::IsValidFragHeader(const SessionDataHeader& headerPara, size_t packetLen)
+{
+    if (packetLen != (static_cast<size_t>(headerPara.dataLen) + BINARY_HEADER_FRAG_LEN) ||
+        headerPara.dataLen > headerPara.totalLen || headerPara.dataLen > BINARY_DATA_MAX_LEN ||
+        headerPara.totalLen > BINARY_DATA_MAX_TOTAL_LEN) {
+        uint64_t bufferSize = static_cast<uint64_t>(packetLen);
+        DHLOGE("pack recv data failed, size: %{public}" PRIu64", dataLen: %{public}d, totalLen: %{public}d sess: "
+            "%{public}s peerSess: %{public}s", bufferSize, headerPara.dataLen, headerPara.totalLen,
+            GetAnonyString(mySessionName_).c_str(), GetAnonyString(peerSessionName_).c_str());
+        return false;
+    }
+    return true;
+}
+
 void DCameraSoftbusSession::AssembleNoFrag(std::shared_ptr<DataBuffer>& buffer, SessionDataHeader& headerPara)
 {
     if (headerPara.dataLen != headerPara.totalLen) {
@@ -186,15 +260,14 @@ void DCameraSoftbusSession::AssembleNoFrag(std::shared_ptr<DataBuffer>& buffer,
         DHLOGE("Data buffer is null");
         return;
     }
-    std::shared_ptr<DataBuffer> postData = std::make_shared<DataBuffer>(headerPara.dataLen);
-    int32_t ret = memcpy_s(postData->Data(), postData->Size(), buffer->Data() + BINARY_HEADER_FRAG_LEN,
-        buffer->Size() - BINARY_HEADER_FRAG_LEN);
-    if (ret != EOK) {
+    // Single packet messages are posted in place, only the header is cut off.
+    int32_t ret = buffer->SetRange(buffer->Offset() + BINARY_HEADER_FRAG_LEN, headerPara.dataLen);
+    if (ret != DCAMERA_OK) {
         DHLOGE("DCameraSoftbusSession PackRecvData failed, ret: %{public}d, sess: %{public}s peerSess: %{public}s",
             ret, GetAnonyString(mySessionName_).c_str(), GetAnonyString(peerSessionName_).c_str());
         return;
     }
-    PostData(postData);
+    PostData(buffer, headerPara.dataType);
 }
 
 void DCameraSoftbusSession::AssembleFrag(std::shared_ptr<DataBuffer>& buffer, SessionDataHeader& headerPara)
@@ -203,20 +276,34 @@ void DCameraSoftbusSession::AssembleFrag(std::shared_ptr<DataBuffer>& buffer, Se
         DHLOGE("Data buffer is null");
         return;
     }
+    std::shared_ptr<DataBuffer> packBuffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(assembleMutex_);
+        packBuffer = AssembleFragPayload(buffer->Data() + BINARY_HEADER_FRAG_LEN,
+            buffer->Size() - BINARY_HEADER_FRAG_LEN, headerPara);
+    }
+    if (packBuffer != nullptr) {
+        PostData(packBuffer, headerPara.dataType);
+    }
+}
+
+std::shared_ptr<DataBuffer> DCameraSoftbusSession::AssembleFragPayload(const uint8_t *payload, size_t payloadLen,
+    SessionDataHeader& headerPara)
+{
     if (headerPara.fragFlag == FRAG_START) {
         isWaiting_ = true;
         nowSeq_ = headerPara.seqNum;
         nowSubSeq_ = headerPara.subSeq;
         offset_ = 0;
         totalLen_ = headerPara.totalLen;
-        packBuffer_ = std::make_shared<DataBuffer>(headerPara.totalLen);
-        int32_t ret = memcpy_s(packBuffer_->Data(), packBuffer_->Size(), buffer->Data() + BINARY_HEADER_FRAG_LEN,
-            buffer->Size() - BINARY_HEADER_FRAG_LEN);
+        // A snapshot consumer may hand out driver memory, so every fragment lands in the final buffer.
+        packBuffer_ = AcquireRecvBuffer(headerPara.totalLen, headerPara.dataType);
+        int32_t ret = memcpy_s(packBuffer_->Data(), packBuffer_->Size(), payload, payloadLen);
         if (ret != EOK) {
             DHLOGE("DCameraSoftbusSession AssembleFrag failed, ret: %{public}d, sess: %{public}s peerSess: %{public}s",
                 ret, GetAnonyString(mySessionName_).c_str(), GetAnonyString(peerSessionName_).c_str());
             ResetAssembleFrag();
-            return;
+            return nullptr;
         }
         offset_ += headerPara.dataLen;
     }
@@ -225,25 +312,26 @@ void DCameraSoftbusSession::AssembleFrag(std::shared_ptr<DataBuffer>& buffer, Se
         int32_t ret = CheckUnPackBuffer(headerPara);
         if (ret != DCAMERA_OK) {
             ResetAssembleFrag();
-            return;
+            return nullptr;
         }
 
         nowSubSeq_ = headerPara.subSeq;
-        ret = memcpy_s(packBuffer_->Data() + offset_, packBuffer_->Size() - offset_,
-            buffer->Data() + BINARY_HEADER_FRAG_LEN, buffer->Size() - BINARY_HEADER_FRAG_LEN);
+        ret = memcpy_s(packBuffer_->Data() + offset_, packBuffer_->Size() - offset_, payload, payloadLen);
         if (ret != EOK) {
             DHLOGE("DCameraSoftbusSession AssembleFrag failed, memcpy_s ret: %{public}d, sess: %{public}s peerSess: "
                 "%{public}s", ret, GetAnonyString(mySessionName_).c_str(), GetAnonyString(peerSessionName_).c_str());
             ResetAssembleFrag();
-            return;
+            return nullptr;
         }
         offset_ += headerPara.dataLen;
     }
 
+    std::shared_ptr<DataBuffer> packBuffer = nullptr;
     if (headerPara.fragFlag == FRAG_END) {
-        PostData(packBuffer_);
+        packBuffer = packBuffer_;
         ResetAssembleFrag();
     }
+    return packBuffer;
 }
 
 int32_t DCameraSoftbusSession::CheckUnPackBuffer(SessionDataHeader& headerPara)
@@ -288,15 +376,78 @@ void DCameraSoftbusSession::ResetAssembleFrag()
     packBuffer_ = nullptr;
 }
 
-void DCameraSoftbusSession::PostData(std::shared_ptr<DataBuffer>& buffer)
+void DCameraSoftbusSession::PostData(std::shared_ptr<DataBuffer>& buffer, uint32_t dataType)
 {
     std::vector<std::shared_ptr<DataBuffer>> buffers;
     buffers.push_back(buffer);
-    CHECK_AND_RETURN_LOG(listener_ == nullptr, "listener_ is null.");
-    listener_->OnDataReceived(buffers);
+    std::shared_ptr<ICameraChannelListener> listener = GetListener(dataType);
+    CHECK_AND_RETURN_LOG(listener == nullptr, "no listener for data type %{public}u.", dataType);
+    listener->OnDataReceived(buffers);
+}
+
+std::shared_ptr<ICameraChannelListener> DCameraSoftbusSession::GetListener(uint32_t dataType)
+{
+    // An unmuxed peer may fill the data type as it likes, everything goes to the session listener then.
+    if (!isMuxed_.load() || dataType == static_cast<uint32_t>(mode_)) {
+        return listener_;
+    }
+    std::lock_guard<std::mutex> lock(muxLock_);
+    auto iter = muxListeners_.find(dataType);
+    if (iter == muxListeners_.end()) {
+        return nullptr;
+    }
+    return iter->second;
 }
 
-void DCameraSoftbusSession::GetFragDataLen(uint8_t *ptrPacket, SessionDataHeader& headerPara)
+int32_t DCameraSoftbusSession::AttachMuxStream(DCameraSessionMode mode,
+    std::shared_ptr<ICameraChannelListener> listener)
+{
+    CHECK_AND_RETURN_RET_LOG(listener == nullptr, DCAMERA_BAD_VALUE, "mux listener is null.");
+    // The video stream needs a stream socket of its own, only bytes streams share one.
+    if (mode == mode_ || mode == DCAMERA_SESSION_MODE_VIDEO || mode_ == DCAMERA_SESSION_MODE_VIDEO) {
+        DHLOGE("can not mux mode %{public}d on a mode %{public}d session", mode, mode_);
+        return DCAMERA_BAD_VALUE;
+    }
+    {
+        std::lock_guard<std::mutex> lock(muxLock_);
+        muxListeners_[static_cast<uint32_t>(mode)] = listener;
+        isMuxed_.store(true);
+    }
+    DHLOGI("attach mux mode %{public}d to session %{public}s", mode, GetAnonyString(mySessionName_).c_str());
+    if (state_ == DCAMERA_SOFTBUS_STATE_OPENED && !isConflict_) {
+        listener->OnSessionState(DCAMERA_CHANNEL_STATE_CONNECTED, peerDevId_);
+    }
+    return DCAMERA_OK;
+}
+
+void DCameraSoftbusSession::DetachMuxStream(DCameraSessionMode mode)
+{
+    std::lock_guard<std::mutex> lock(muxLock_);
+    muxListeners_.erase(static_cast<uint32_t>(mode));
+    isMuxed_.store(!muxListeners_.empty());
+    DHLOGI("detach mux mode %{public}d from session %{public}s", mode, GetAnonyString(mySessionName_).c_str());
+}
+
+bool DCameraSoftbusSession::IsMuxed()
+{
+    return isMuxed_.load();
+}
+
+void DCameraSoftbusSession::NotifyMuxState(int32_t state)
+{
+    std::vector<std::shared_ptr<ICameraChannelListener>> listeners;
+    {
+        std::lock_guard<std::mutex> lock(muxLock_);
+        for (auto &item : muxListeners_) {
+            listeners.push_back(item.second);
+        }
+    }
+    for (auto &listener : listeners) {
+        listener->OnSessionState(state, peerDevId_);
+    }
+}
+
+void DCameraSoftbusSession::GetFragDataLen(const uint8_t *ptrPacket, SessionDataHeader& headerPara)
 {
     headerPara.version = U16Get(ptrPacket);
     headerPara.fragFlag = ptrPacket[BINARY_HEADER_FRAG_OFFSET];
@@ -329,9 +480,9 @@ int32_t DCameraSoftbusSession::SendData(DCameraSessionMode mode, std::shared_ptr
             return SendStream(buffer);
         case DCAMERA_SESSION_MODE_CTRL:
         case DCAMERA_SESSION_MODE_JPEG:
-            return UnPackSendData(buffer, memberFunc);
+            return UnPackSendData(buffer, memberFunc, mode);
         default:
-            return UnPackSendData(buffer, memberFunc);
+            return UnPackSendData(buffer, memberFunc, mode);
     }
     return DCAMERA_NOT_FOUND;
 }
@@ -365,17 +516,20 @@ void DCameraSoftbusSession::ReleaseSession()
     DCameraSoftbusAdapter::GetInstance().CloseSoftbusSession(sessionId_);
 }
 
-int32_t DCameraSoftbusSession::UnPackSendData(std::shared_ptr<DataBuffer>& buffer, DCameraSendFuc memberFunc)
+int32_t DCameraSoftbusSession::UnPackSendData(std::shared_ptr<DataBuffer>& buffer, DCameraSendFuc memberFunc,
+    DCameraSessionMode mode)
 {
     CHECK_AND_RETURN_RET_LOG(buffer == nullptr, DCAMERA_BAD_VALUE, "Data buffer is null");
     uint16_t subSeq = 0;
     uint32_t seq = 0;
     uint32_t totalLen = buffer->Size();
-    SessionDataHeader headPara = { PROTOCOL_VERSION, FRAG_START, mode_, seq, totalLen, subSeq };
-    if (buffer->Size() <= BINARY_DATA_PACKET_MAX_LEN) {
+    SessionDataHeader headPara = { PROTOCOL_VERSION, FRAG_START, mode, seq, totalLen, subSeq };
+    uint32_t packetMaxLen = (isMuxed_.load() && mode != DCAMERA_SESSION_MODE_CTRL) ? MUX_DATA_PACKET_MAX_LEN :
+        BINARY_DATA_PACKET_MAX_LEN;
+    if (buffer->Size() <= packetMaxLen) {
         headPara.fragFlag = FRAG_START_END;
         headPara.dataLen = buffer->Size();
-        std::shared_ptr<DataBuffer> unpackData = std::make_shared<DataBuffer>(buffer->Size() + BINARY_HEADER_FRAG_LEN);
+        std::shared_ptr<DataBuffer> unpackData = DataBuffer::Acquire(buffer->Size() + BINARY_HEADER_FRAG_LEN);
         MakeFragDataHeader(headPara, unpackData->Data(), BINARY_HEADER_FRAG_LEN);
         int32_t ret = memcpy_s(unpackData->Data() + BINARY_HEADER_FRAG_LEN, unpackData->Size() - BINARY_HEADER_FRAG_LEN,
             buffer->Data(), buffer->Size());
@@ -384,16 +538,17 @@ int32_t DCameraSoftbusSession::UnPackSendData(std::shared_ptr<DataBuffer>& buffe
                 ret, GetAnonyString(mySessionName_).c_str(), GetAnonyString(peerSessionName_).c_str());
             return ret;
         }
-        return SendBytes(unpackData);
+        return SendPacket(unpackData, mode);
     }
     uint32_t offset = 0;
+    // One packet buffer is gathered into for every fragment, softbus copies it out before SendBytes returns.
+    std::shared_ptr<DataBuffer> unpackData = DataBuffer::Acquire(packetMaxLen + BINARY_HEADER_FRAG_LEN);
     while (totalLen > offset) {
-        SetHeadParaDataLen(headPara, totalLen, offset);
+        SetHeadParaDataLen(headPara, totalLen, offset, packetMaxLen);
         uint64_t bufferSize = static_cast<uint64_t>(buffer->Size());
         DHLOGD("DCameraSoftbusSession UnPackSendData, size: %" PRIu64", dataLen: %{public}d, totalLen: %{public}d, "
             "nowTime: %{public}" PRId64" start:", bufferSize, headPara.dataLen, headPara.totalLen, GetNowTimeStampUs());
-        std::shared_ptr<DataBuffer> unpackData =
-            std::make_shared<DataBuffer>(headPara.dataLen + BINARY_HEADER_FRAG_LEN);
+        unpackData->SetRange(0, headPara.dataLen + BINARY_HEADER_FRAG_LEN);
         MakeFragDataHeader(headPara, unpackData->Data(), BINARY_HEADER_FRAG_LEN);
         int ret = memcpy_s(unpackData->Data() + BINARY_HEADER_FRAG_LEN, unpackData->Size() - BINARY_HEADER_FRAG_LEN,
             buffer->Data() + offset, headPara.dataLen);
@@ -402,7 +557,7 @@ int32_t DCameraSoftbusSession::UnPackSendData(std::shared_ptr<DataBuffer>& buffe
                 "%{public}s", ret, GetAnonyString(mySessionName_).c_str(), GetAnonyString(peerSessionName_).c_str());
             return ret;
         }
-        ret = SendBytes(unpackData);
+        ret = SendPacket(unpackData, mode);
         if (ret != DCAMERA_OK) {
             DHLOGE("DCameraSoftbusSession sendData failed, ret: %{public}d, sess: %{public}s peerSess: %{public}s",
                 ret, GetAnonyString(mySessionName_).c_str(), GetAnonyString(peerSessionName_).c_str());
@@ -418,11 +573,11 @@ int32_t DCameraSoftbusSession::UnPackSendData(std::shared_ptr<DataBuffer>& buffe
 }
 
 void DCameraSoftbusSession::SetHeadParaDataLen(SessionDataHeader& headPara, const uint32_t totalLen,
-    const uint32_t offset)
+    const uint32_t offset, const uint32_t packetMaxLen)
 {
     if (totalLen >= offset) {
-        if (totalLen - offset > BINARY_DATA_PACKET_MAX_LEN) {
-            headPara.dataLen = BINARY_DATA_PACKET_MAX_LEN - BINARY_DATA_PACKET_RESERVED_BUFFER;
+        if (totalLen - offset > packetMaxLen) {
+            headPara.dataLen = packetMaxLen - BINARY_DATA_PACKET_RESERVED_BUFFER;
         } else {
             headPara.fragFlag = FRAG_END;
             headPara.dataLen = totalLen - offset;
@@ -462,6 +617,28 @@ void DCameraSoftbusSession::MakeFragDataHeader(const SessionDataHeader& headPara
     header[i++] = (headPara.dataLen & UINT32_SHIFT_MASK_0);
 }
 
+int32_t DCameraSoftbusSession::SendPacket(std::shared_ptr<DataBuffer>& buffer, DCameraSessionMode mode)
+{
+    if (!isMuxed_.load()) {
+        return SendBytes(buffer);
+    }
+    // Control messages jump the queue of a shared socket, a snapshot only goes on between its fragments.
+    if (mode == DCAMERA_SESSION_MODE_CTRL) {
+        pendingCtrlSends_++;
+        int32_t ret = DCAMERA_OK;
+        {
+            std::lock_guard<std::mutex> lock(muxSendLock_);
+            ret = SendBytes(buffer);
+            pendingCtrlSends_--;
+        }
+        muxSendCond_.notify_all();
+        return ret;
+    }
+    std::unique_lock<std::mutex> lock(muxSendLock_);
+    muxSendCond_.wait(lock, [this]() { return pendingCtrlSends_.load() == 0; });
+    return SendBytes(buffer);
+}
+
 int32_t DCameraSoftbusSession::SendBytes(std::shared_ptr<DataBuffer>& buffer)
 {
     if (state_ != DCAMERA_SOFTBUS_STATE_OPENED) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -18,6 +18,7 @@
 
 #include "dcamera_collaboration_mock.h"
 #include "dcamera_allconnect_manager_test.h"
+#include "dcamera_utils_tools.h"
 #include "dlfcn_mock.h"
 
 using namespace testing;
@@ -111,6 +112,53 @@ HWTEST_F(DCameraAllConnectManagerTest, ApplyAdvancedResource_002, testing::ext::
     EXPECT_EQ(ret, DistributedCameraErrno::DCAMERA_ERR_APPLY_RESULT);
 }
 
+HWTEST_F(DCameraAllConnectManagerTest, ApplyAdvancedResource_003, testing::ext::TestSize.Level1)
+{
+    auto &manager = DCameraAllConnectManager::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(manager.applyLock_);
+        manager.peerApplies_[PEER_NETWORK_ID].state = DCameraAllConnectManager::ApplyState::GRANTED;
+    }
+    EXPECT_TRUE(manager.IsAdvancedResourceGranted(PEER_NETWORK_ID));
+    int32_t result = DistributedCameraErrno::DCAMERA_BAD_VALUE;
+    auto ret = manager.ApplyAdvancedResourceAsync(PEER_NETWORK_ID, nullptr,
+        [&result](int32_t applyResult) { result = applyResult; });
+    EXPECT_EQ(ret, DistributedCameraErrno::DCAMERA_OK);
+    EXPECT_EQ(result, DistributedCameraErrno::DCAMERA_OK);
+
+    DCameraAllConnectManager::OnStop(PEER_NETWORK_ID.c_str());
+    EXPECT_FALSE(manager.IsAdvancedResourceGranted(PEER_NETWORK_ID));
+}
+
+HWTEST_F(DCameraAllConnectManagerTest, ApplyAdvancedResource_004, testing::ext::TestSize.Level1)
+{
+    auto &manager = DCameraAllConnectManager::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(manager.applyLock_);
+        auto &apply = manager.peerApplies_[PEER_NETWORK_ID];
+        apply.applyId = ++manager.applySeq_;
+        apply.applyStartMs = GetNowTimeStampMs();
+        manager.applyQueue_.push_back(PEER_NETWORK_ID);
+    }
+    int32_t resultCount = 0;
+    auto callback = [&resultCount](int32_t applyResult) {
+        if (applyResult == DistributedCameraErrno::DCAMERA_OK) {
+            resultCount++;
+        }
+    };
+    manager.ApplyAdvancedResourceAsync(PEER_NETWORK_ID, nullptr, callback);
+    manager.ApplyAdvancedResourceAsync(PEER_NETWORK_ID, nullptr, callback);
+    EXPECT_EQ(resultCount, 0);
+    EXPECT_FALSE(manager.IsAdvancedResourceGranted(PEER_NETWORK_ID));
+
+    auto ret = DCameraAllConnectManager::ApplyResult(DistributedCameraErrno::DCAMERA_OK, PASS, "success");
+    EXPECT_EQ(ret, DistributedCameraErrno::DCAMERA_OK);
+    EXPECT_EQ(resultCount, 2);
+    EXPECT_TRUE(manager.IsAdvancedResourceGranted(PEER_NETWORK_ID));
+    manager.ReleaseAdvancedResource(PEER_NETWORK_ID);
+    EXPECT_FALSE(manager.IsAdvancedResourceGranted(PEER_NETWORK_ID));
+}
+
 HWTEST_F(DCameraAllConnectManagerTest, RegisterLifecycleCallback_001, testing::ext::TestSize.Level1)
 {
     auto ret = DCameraAllConnectManager::GetInstance().RegisterLifecycleCallback();
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+
+#define private public
+#include "dcamera_channel_loopback_impl.h"
+#undef private
+#include "dcamera_utils_tools.h"
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_DEVICE_ID = "bb536a637105409e904d4da83790a4a7";
+const std::string TEST_CAMERA_DH_ID_0 = "camera_0";
+const std::string TEST_SESSION_FLAG = "dataContinue";
+const size_t TEST_DATA_SIZE = 1024;
+const int32_t TEST_FRAME_INDEX = 7;
+const int32_t TEST_LATENCY_MS = 20;
+const uint32_t TEST_LOSS_ALL = 1000;
+const int32_t TEST_FRAME_COUNT = 10;
+const std::chrono::milliseconds TEST_WAIT_TIME(1000);
+}
+
+class DCameraLoopbackTestListener : public ICameraChannelListener {
+public:
+    void OnSessionState(int32_t state, std::string networkId) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        state_ = state;
+        cond_.notify_all();
+    }
+
+    void OnSessionError(int32_t eventType, int32_t eventReason, std::string detail) override {}
+
+    void OnDataReceived(std::vector<std::shared_ptr<DataBuffer>>& buffers) override
+    {
+        if (onReceived_ != nullptr) {
+            onReceived_();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        received_.insert(received_.end(), buffers.begin(), buffers.end());
+        recvTimeUs_ = GetNowTimeStampUs();
+        cond_.notify_all();
+    }
+
+    bool WaitReceived(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cond_.wait_for(lock, TEST_WAIT_TIME, [this, count]() { return received_.size() >= count; });
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    int32_t state_ = DCAMERA_CHANNEL_STATE_DISCONNECTED;
+    std::vector<std::shared_ptr<DataBuffer>> received_;
+    int64_t recvTimeUs_ = 0;
+    std::function<void()> onReceived_;
+};
+
+class DCameraChannelLoopbackImplTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    int32_t OpenPair(const DCameraLoopbackConfig& config, DCameraSessionMode mode);
+
+    std::shared_ptr<DCameraChannelLoopbackImpl> sinkEnd_;
+    std::shared_ptr<DCameraChannelLoopbackImpl> sourceEnd_;
+    std::shared_ptr<DCameraLoopbackTestListener> sinkListener_;
+    std::shared_ptr<DCameraLoopbackTestListener> sourceListener_;
+};
+
+void DCameraChannelLoopbackImplTest::SetUpTestCase(void)
+{
+}
+
+void DCameraChannelLoopbackImplTest::TearDownTestCase(void)
+{
+}
+
+void DCameraChannelLoopbackImplTest::SetUp(void)
+{
+    sinkListener_ = std::make_shared<DCameraLoopbackTestListener>();
+    sourceListener_ = std::make_shared<DCameraLoopbackTestListener>();
+}
+
+void DCameraChannelLoopbackImplTest::TearDown(void)
+{
+    if (sinkEnd_ != nullptr) {
+        sinkEnd_->ReleaseSession();
+    }
+    if (sourceEnd_ != nullptr) {
+        sourceEnd_->ReleaseSession();
+    }
+    sinkEnd_ = nullptr;
+    sourceEnd_ = nullptr;
+}
+
+int32_t DCameraChannelLoopbackImplTest::OpenPair(const DCameraLoopbackConfig& config, DCameraSessionMode mode)
+{
+    int32_t ret = DCameraChannelLoopbackImpl::CreatePair(config, sinkEnd_, sourceEnd_);
+    if (ret != DCAMERA_OK) {
+        return ret;
+    }
+    std::vector<DCameraIndex> camIndexs;
+    camIndexs.push_back(DCameraIndex(TEST_DEVICE_ID, TEST_CAMERA_DH_ID_0));
+    std::shared_ptr<ICameraChannelListener> sinkListener = sinkListener_;
+    std::shared_ptr<ICameraChannelListener> sourceListener = sourceListener_;
+    ret = sinkEnd_->CreateSession(camIndexs, TEST_SESSION_FLAG, mode, sinkListener);
+    if (ret != DCAMERA_OK) {
+        return ret;
+    }
+    return sourceEnd_->CreateSession(camIndexs, TEST_SESSION_FLAG, mode, sourceListener);
+}
+
+/**
+ * @tc.name: dcamera_channel_loopback_impl_test_001
+ * @tc.desc: Verify an invalid link is refused and nothing is sent before both ends listen.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraChannelLoopbackImplTest, dcamera_channel_loopback_impl_test_001, TestSize.Level1)
+{
+    DHLOGI("dcamera_channel_loopback_impl_test_001");
+    DCameraLoopbackConfig config = { -1, 0, 0, 0, 0 };
+    EXPECT_EQ(DCAMERA_BAD_VALUE, DCameraChannelLoopbackImpl::CreatePair(config, sinkEnd_, sourceEnd_));
+    config = { 0, 0, 0, TEST_LOSS_ALL + 1, 0 };
+    EXPECT_EQ(DCAMERA_BAD_VALUE, DCameraChannelLoopbackImpl::CreatePair(config, sinkEnd_, sourceEnd_));
+
+    config = { 0, 0, 0, 0, 0 };
+    ASSERT_EQ(DCAMERA_OK, DCameraChannelLoopbackImpl::CreatePair(config, sinkEnd_, sourceEnd_));
+    std::vector<DCameraIndex> camIndexs;
+    camIndexs.push_back(DCameraIndex(TEST_DEVICE_ID, TEST_CAMERA_DH_ID_0));
+    std::shared_ptr<ICameraChannelListener> listener = sinkListener_;
+    EXPECT_EQ(DCAMERA_OK, sinkEnd_->CreateSession(camIndexs, TEST_SESSION_FLAG, DCAMERA_SESSION_MODE_CTRL,
+        listener));
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(TEST_DATA_SIZE);
+    EXPECT_EQ(DCAMERA_BAD_OPERATE, sinkEnd_->SendData(buffer));
+    EXPECT_EQ(DCAMERA_CHANNEL_STATE_DISCONNECTED, sinkListener_->state_);
+}
+
+/**
+ * @tc.name: dcamera_channel_loopback_impl_test_002
+ * @tc.desc: Verify control data reaches the other end as a copy and closing one end closes both.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraChannelLoopbackImplTest, dcamera_channel_loopback_impl_test_002, TestSize.Level1)
+{
+    DHLOGI("dcamera_channel_loopback_impl_test_002");
+    DCameraLoopbackConfig config = { 0, 0, 0, 0, 0 };
+    ASSERT_EQ(DCAMERA_OK, OpenPair(config, DCAMERA_SESSION_MODE_CTRL));
+    EXPECT_EQ(DCAMERA_CHANNEL_STATE_CONNECTED, sinkListener_->state_);
+    EXPECT_EQ(DCAMERA_CHANNEL_STATE_CONNECTED, sourceListener_->state_);
+
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(TEST_DATA_SIZE);
+    buffer->Data()[0] = TEST_FRAME_INDEX;
+    EXPECT_EQ(DCAMERA_OK, sourceEnd_->SendData(buffer));
+    buffer->Data()[0] = 0;
+    ASSERT_TRUE(sinkListener_->WaitReceived(1));
+    EXPECT_EQ(TEST_DATA_SIZE, sinkListener_->received_[0]->Size());
+    EXPECT_EQ(TEST_FRAME_INDEX, sinkListener_->received_[0]->Data()[0]);
+    EXPECT_TRUE(sourceListener_->received_.empty());
+
+    EXPECT_EQ(DCAMERA_OK, sinkEnd_->CloseSession());
+    EXPECT_EQ(DCAMERA_CHANNEL_STATE_DISCONNECTED, sinkListener_->state_);
+    EXPECT_EQ(DCAMERA_CHANNEL_STATE_DISCONNECTED, sourceListener_->state_);
+    EXPECT_EQ(DCAMERA_BAD_OPERATE, sourceEnd_->SendData(buffer));
+}
+
+/**
+ * @tc.name: dcamera_channel_loopback_impl_test_003
+ * @tc.desc: Verify video frames arrive after the link latency with their frame info.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraChannelLoopbackImplTest, dcamera_channel_loopback_impl_test_003, TestSize.Level1)
+{
+    DHLOGI("dcamera_channel_loopback_impl_test_003");
+    DCameraLoopbackConfig config = { TEST_LATENCY_MS, 0, 0, 0, 0 };
+    ASSERT_EQ(DCAMERA_OK, OpenPair(config, DCAMERA_SESSION_MODE_VIDEO));
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(TEST_DATA_SIZE);
+    buffer->SetInt32(DataBufferKey::INDEX, TEST_FRAME_INDEX);
+    buffer->SetInt32(DataBufferKey::FRAME_TYPE, 0);
+    buffer->SetInt64(DataBufferKey::TIME_STAMP_US, GetNowTimeStampUs());
+    buffer->SetInt64(DataBufferKey::START_ENCODE_TIME_US, GetNowTimeStampUs());
+    buffer->SetInt64(DataBufferKey::FINISH_ENCODE_TIME_US, GetNowTimeStampUs());
+    int64_t sendTimeUs = GetNowTimeStampUs();
+    EXPECT_EQ(DCAMERA_OK, sinkEnd_->SendData(buffer));
+    ASSERT_TRUE(sourceListener_->WaitReceived(1));
+    EXPECT_GE(sourceListener_->recvTimeUs_ - sendTimeUs, TEST_LATENCY_MS * DCameraChannelLoopbackImpl::US_PER_MS);
+    const DCameraFrameInfo& frameInfo = sourceListener_->received_[0]->frameInfo_;
+    EXPECT_EQ(TEST_FRAME_INDEX, frameInfo.index);
+    EXPECT_GE(frameInfo.timePonit.recv, frameInfo.timePonit.send);
+}
+
+/**
+ * @tc.name: dcamera_channel_loopback_impl_test_004
+ * @tc.desc: Verify lost video frames are counted and never delivered.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraChannelLoopbackImplTest, dcamera_channel_loopback_impl_test_004, TestSize.Level1)
+{
+    DHLOGI("dcamera_channel_loopback_impl_test_004");
+    DCameraLoopbackConfig config = { 0, 0, 0, TEST_LOSS_ALL, 0 };
+    ASSERT_EQ(DCAMERA_OK, OpenPair(config, DCAMERA_SESSION_MODE_VIDEO));
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(TEST_DATA_SIZE);
+    for (int32_t i = 0; i < TEST_FRAME_COUNT; i++) {
+        EXPECT_EQ(DCAMERA_OK, sinkEnd_->SendData(buffer));
+    }
+    EXPECT_EQ(static_cast<uint64_t>(TEST_FRAME_COUNT), sinkEnd_->GetLostCount());
+    EXPECT_TRUE(sourceEnd_->pending_.empty());
+    EXPECT_TRUE(sinkEnd_->pending_.empty());
+}
+
+/**
+ * @tc.name: dcamera_channel_loopback_impl_test_005
+ * @tc.desc: Verify an end released and dropped from its own delivery outlives the deliver thread.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraChannelLoopbackImplTest, dcamera_channel_loopback_impl_test_005, TestSize.Level1)
+{
+    DHLOGI("dcamera_channel_loopback_impl_test_005");
+    DCameraLoopbackConfig config = { 0, 0, 0, 0, 0 };
+    ASSERT_EQ(DCAMERA_OK, OpenPair(config, DCAMERA_SESSION_MODE_CTRL));
+    std::shared_ptr<DCameraChannelLoopbackImpl> sourceEnd = sourceEnd_;
+    std::weak_ptr<DCameraChannelLoopbackImpl> weakSource = sourceEnd_;
+    sinkListener_->onReceived_ = [&sourceEnd]() {
+        sourceEnd->ReleaseSession();
+        sourceEnd = nullptr;
+    };
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(TEST_DATA_SIZE);
+    EXPECT_EQ(DCAMERA_OK, sourceEnd_->SendData(buffer));
+    sourceEnd_ = nullptr;
+    ASSERT_TRUE(sinkListener_->WaitReceived(1));
+    for (int32_t i = 0; i < TEST_FRAME_COUNT && !weakSource.expired(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(TEST_LATENCY_MS));
+    }
+    EXPECT_TRUE(weakSource.expired());
+    EXPECT_EQ(DCAMERA_CHANNEL_STATE_DISCONNECTED, sinkListener_->state_);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -47,6 +47,20 @@ public:
     std::shared_ptr<ICameraOperator> operator_;
 };
 
+class DCameraRecvBufferListener : public ICameraChannelListener {
+public:
+    void OnSessionState(int32_t state, std::string networkId) override {}
+    void OnSessionError(int32_t eventType, int32_t eventReason, std::string detail) override {}
+    void OnDataReceived(std::vector<std::shared_ptr<DataBuffer>>& buffers) override {}
+    std::shared_ptr<DataBuffer> AcquireRecvBuffer(size_t capacity) override
+    {
+        recvBuffer_ = DataBuffer::Acquire(capacity);
+        return recvBuffer_;
+    }
+
+    std::shared_ptr<DataBuffer> recvBuffer_ = nullptr;
+};
+
 namespace {
 const std::string TEST_MYDEVICE_ID = "bb536a637105409e904d4da83790a4a7";
 const std::string TEST_PEERDEVICE_ID = "bb536a637105409e904d4da83790a4a9";
@@ -330,10 +344,12 @@ HWTEST_F(DCameraSoftbusSessionTest, dcamera_softbus_session_test_011, TestSize.L
     size_t capacity = size;
     std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(capacity);
     buffer->SetRange(offset, size);
-    int32_t ret = softbusSession_->UnPackSendData(buffer, softbusSession_->sendFuncMap_[DCAMERA_SESSION_MODE_VIDEO]);
+    int32_t ret = softbusSession_->UnPackSendData(buffer, softbusSession_->sendFuncMap_[DCAMERA_SESSION_MODE_VIDEO],
+        DCAMERA_SESSION_MODE_VIDEO);
     size = DCameraSoftbusSession::BINARY_DATA_PACKET_MAX_LEN + 1;
     buffer->SetRange(offset, size);
-    ret = softbusSession_->UnPackSendData(buffer, softbusSession_->sendFuncMap_[DCAMERA_SESSION_MODE_VIDEO]);
+    ret = softbusSession_->UnPackSendData(buffer, softbusSession_->sendFuncMap_[DCAMERA_SESSION_MODE_VIDEO],
+        DCAMERA_SESSION_MODE_VIDEO);
     EXPECT_EQ(DCAMERA_WRONG_STATE, ret);
 }
 
@@ -660,5 +676,134 @@ HWTEST_F(DCameraSoftbusSessionTest, dcamera_softbus_session_test_029, TestSize.L
     EXPECT_EQ(DCAMERA_OK, ret);
 }
 
+/**
+ * @tc.name: dcamera_softbus_session_test_030
+ * @tc.desc: Verify the OnBytesReceived function reassembles fragments in place.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DCameraSoftbusSessionTest, dcamera_softbus_session_test_030, TestSize.Level1)
+{
+    EXPECT_NE(nullptr, softbusSession_);
+    softbusSession_->mode_ = DCAMERA_SESSION_MODE_CTRL;
+    const uint32_t fragLen = 4;
+    const uint32_t headerLen = DCameraSoftbusSession::BINARY_HEADER_FRAG_LEN;
+    std::vector<uint8_t> packet(headerLen + fragLen, 0);
+    DCameraSoftbusSession::SessionDataHeader headerPara = { DCameraSoftbusSession::PROTOCOL_VERSION,
+        DCameraSoftbusSession::FRAG_START, DCAMERA_SESSION_MODE_CTRL, 1, fragLen * 2, 0, fragLen };
+    softbusSession_->MakeFragDataHeader(headerPara, packet.data(), headerLen);
+    int32_t ret = softbusSession_->OnBytesReceived(packet.data(), packet.size());
+    EXPECT_EQ(DCAMERA_OK, ret);
+    EXPECT_TRUE(softbusSession_->isWaiting_);
+    EXPECT_EQ(fragLen, softbusSession_->offset_);
+
+    headerPara.fragFlag = DCameraSoftbusSession::FRAG_END;
+    headerPara.subSeq = 1;
+    softbusSession_->MakeFragDataHeader(headerPara, packet.data(), headerLen);
+    ret = softbusSession_->OnBytesReceived(packet.data(), packet.size());
+    EXPECT_EQ(DCAMERA_OK, ret);
+    EXPECT_FALSE(softbusSession_->isWaiting_);
+    EXPECT_EQ(nullptr, softbusSession_->packBuffer_);
+
+    ret = softbusSession_->OnBytesReceived(nullptr, 0);
+    EXPECT_EQ(DCAMERA_BAD_VALUE, ret);
+}
+
+/**
+ * @tc.name: dcamera_softbus_session_test_031
+ * @tc.desc: Verify fragments are reassembled into the buffer the listener hands out.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DCameraSoftbusSessionTest, dcamera_softbus_session_test_031, TestSize.Level1)
+{
+    std::shared_ptr<DCameraRecvBufferListener> listener = std::make_shared<DCameraRecvBufferListener>();
+    std::shared_ptr<DCameraSoftbusSession> session = std::make_shared<DCameraSoftbusSession>("dhId",
+        TEST_MYDEVICE_ID, "testmysession", TEST_PEERDEVICE_ID, "testpeersession", listener,
+        DCAMERA_SESSION_MODE_JPEG);
+    const uint32_t fragLen = 4;
+    const uint32_t headerLen = DCameraSoftbusSession::BINARY_HEADER_FRAG_LEN;
+    std::vector<uint8_t> packet(headerLen + fragLen, 1);
+    DCameraSoftbusSession::SessionDataHeader headerPara = { DCameraSoftbusSession::PROTOCOL_VERSION,
+        DCameraSoftbusSession::FRAG_START, DCAMERA_SESSION_MODE_JPEG, 1, fragLen * 2, 0, fragLen };
+    session->MakeFragDataHeader(headerPara, packet.data(), headerLen);
+    EXPECT_EQ(DCAMERA_OK, session->OnBytesReceived(packet.data(), packet.size()));
+    ASSERT_NE(nullptr, listener->recvBuffer_);
+    EXPECT_EQ(listener->recvBuffer_, session->packBuffer_);
+    EXPECT_EQ(fragLen * 2, listener->recvBuffer_->Size());
+    EXPECT_EQ(1, listener->recvBuffer_->Data()[0]);
+    session->ResetAssembleFrag();
+    EXPECT_EQ(nullptr, session->packBuffer_);
+}
+
+/**
+ * @tc.name: dcamera_softbus_session_test_032
+ * @tc.desc: Verify snapshot fragments on a muxed control session go to the snapshot listener.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DCameraSoftbusSessionTest, dcamera_softbus_session_test_032, TestSize.Level1)
+{
+    std::shared_ptr<DCameraRecvBufferListener> ctrlListener = std::make_shared<DCameraRecvBufferListener>();
+    std::shared_ptr<DCameraRecvBufferListener> snapListener = std::make_shared<DCameraRecvBufferListener>();
+    std::shared_ptr<DCameraSoftbusSession> session = std::make_shared<DCameraSoftbusSession>("dhId",
+        TEST_MYDEVICE_ID, "testmysession", TEST_PEERDEVICE_ID, "testpeersession", ctrlListener,
+        DCAMERA_SESSION_MODE_CTRL);
+    EXPECT_FALSE(session->IsMuxed());
+    EXPECT_EQ(DCAMERA_OK, session->AttachMuxStream(DCAMERA_SESSION_MODE_JPEG, snapListener));
+    EXPECT_TRUE(session->IsMuxed());
+    EXPECT_EQ(ctrlListener, session->GetListener(DCAMERA_SESSION_MODE_CTRL));
+    EXPECT_EQ(snapListener, session->GetListener(DCAMERA_SESSION_MODE_JPEG));
+    EXPECT_EQ(nullptr, session->GetListener(DCAMERA_SESSION_MODE_VIDEO));
+
+    const uint32_t fragLen = 4;
+    const uint32_t headerLen = DCameraSoftbusSession::BINARY_HEADER_FRAG_LEN;
+    std::vector<uint8_t> packet(headerLen + fragLen, 1);
+    DCameraSoftbusSession::SessionDataHeader headerPara = { DCameraSoftbusSession::PROTOCOL_VERSION,
+        DCameraSoftbusSession::FRAG_START, DCAMERA_SESSION_MODE_JPEG, 1, fragLen * 2, 0, fragLen };
+    session->MakeFragDataHeader(headerPara, packet.data(), headerLen);
+    EXPECT_EQ(DCAMERA_OK, session->OnBytesReceived(packet.data(), packet.size()));
+    EXPECT_EQ(nullptr, ctrlListener->recvBuffer_);
+    ASSERT_NE(nullptr, snapListener->recvBuffer_);
+    EXPECT_EQ(snapListener->recvBuffer_, session->packBuffer_);
+    session->ResetAssembleFrag();
+
+    session->DetachMuxStream(DCAMERA_SESSION_MODE_JPEG);
+    EXPECT_FALSE(session->IsMuxed());
+    EXPECT_EQ(ctrlListener, session->GetListener(DCAMERA_SESSION_MODE_JPEG));
+}
+
+/**
+ * @tc.name: dcamera_softbus_session_test_033
+ * @tc.desc: Verify only bytes streams are muxed and a muxed snapshot is cut into small fragments.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DCameraSoftbusSessionTest, dcamera_softbus_session_test_033, TestSize.Level1)
+{
+    std::shared_ptr<DCameraRecvBufferListener> listener = std::make_shared<DCameraRecvBufferListener>();
+    EXPECT_EQ(DCAMERA_BAD_VALUE, softbusSession_->AttachMuxStream(DCAMERA_SESSION_MODE_JPEG, listener));
+    std::shared_ptr<DCameraSoftbusSession> session = std::make_shared<DCameraSoftbusSession>("dhId",
+        TEST_MYDEVICE_ID, "testmysession", TEST_PEERDEVICE_ID, "testpeersession", listener,
+        DCAMERA_SESSION_MODE_CTRL);
+    EXPECT_EQ(DCAMERA_BAD_VALUE, session->AttachMuxStream(DCAMERA_SESSION_MODE_VIDEO, listener));
+    EXPECT_EQ(DCAMERA_BAD_VALUE, session->AttachMuxStream(DCAMERA_SESSION_MODE_CTRL, listener));
+    EXPECT_EQ(DCAMERA_BAD_VALUE, session->AttachMuxStream(DCAMERA_SESSION_MODE_JPEG, nullptr));
+    EXPECT_FALSE(session->IsMuxed());
+
+    DCameraSoftbusSession::SessionDataHeader headerPara = {};
+    const uint32_t totalLen = DCameraSoftbusSession::MUX_DATA_PACKET_MAX_LEN * 2;
+    session->SetHeadParaDataLen(headerPara, totalLen, 0, DCameraSoftbusSession::MUX_DATA_PACKET_MAX_LEN);
+    EXPECT_EQ(DCameraSoftbusSession::MUX_DATA_PACKET_MAX_LEN -
+        DCameraSoftbusSession::BINARY_DATA_PACKET_RESERVED_BUFFER, headerPara.dataLen);
+    session->SetHeadParaDataLen(headerPara, totalLen, totalLen - 1, DCameraSoftbusSession::MUX_DATA_PACKET_MAX_LEN);
+    EXPECT_EQ(1, headerPara.dataLen);
+    EXPECT_EQ(DCameraSoftbusSession::FRAG_END, headerPara.fragFlag);
+
+    EXPECT_EQ(DCAMERA_OK, session->AttachMuxStream(DCAMERA_SESSION_MODE_JPEG, listener));
+    std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(totalLen);
+    EXPECT_EQ(DCAMERA_WRONG_STATE, session->SendData(DCAMERA_SESSION_MODE_JPEG, buffer));
+    EXPECT_EQ(0, session->pendingCtrlSends_.load());
+}
+}
 }
-}
\ No newline at end of file
@@ -32,6 +32,18 @@ public:
     virtual ~DataProcessListener() = default;
     virtual int32_t OnProcessedVideoBuffer(const std::shared_ptr<DataBuffer>& videoResult) = 0;
     virtual void OnError(DataProcessErrorType errorType) = 0;
+    /* Output buffer for a processed frame, the consumer may hand out its own driver memory. */
+    virtual std::shared_ptr<DataBuffer> AcquireOutputBuffer(size_t capacity)
+    {
+        return DataBuffer::Acquire(capacity);
+    }
+    /* Wait until a consumer that answered DCAMERA_TRANS_BUSY can take the next frame, false on timeout. */
+    virtual bool WaitOutputWritable(int64_t timeoutMs)
+    {
+        return true;
+    }
+    /* The hardware decoder of this stream is wanted by a higher priority stream, decoding keeps running. */
+    virtual void OnDecoderStepDown() {}
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -20,6 +20,8 @@
 #include <vector>
 
 #include "data_buffer.h"
+#include "dcamera_frame_drop_statistics.h"
+#include "dcamera_memory_account.h"
 #include "image_common_type.h"
 #include "distributed_camera_errno.h"
 #include "data_process_listener.h"
@@ -37,8 +39,31 @@ public:
         const VideoConfigParams& targetConfig, const std::shared_ptr<DataProcessListener>& listener) = 0;
     virtual int32_t ProcessData(std::vector<std::shared_ptr<DataBuffer>>& dataBuffers) = 0;
     virtual void DestroyDataProcessPipeline() = 0;
+    /* Switches a running pipeline to a new resolution in place, any error leaves the rebuild to the caller. */
+    virtual int32_t UpdateConfig(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig)
+    {
+        return DCAMERA_BAD_OPERATE;
+    }
     virtual int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) = 0;
     virtual int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) = 0;
+    virtual std::shared_ptr<DataBuffer> AcquireInputBuffer(size_t capacity)
+    {
+        return DataBuffer::Acquire(capacity);
+    }
+    /* Channel feedback for one processed frame handed to the consumer, drives the encoder bitrate. */
+    virtual void OnChannelSendResult(size_t frameSize, int64_t sendCostUs, int32_t result) {}
+    /* Bandwidth in bit/s the channel reports the link can carry, 0 lifts the cap. */
+    virtual void OnLinkCapacity(int64_t bandwidthBps) {}
+    /* Share in percent of the maximum bitrate the encoder may use, 100 lifts the limit. */
+    virtual void SetBitratePercent(int32_t percent) {}
+    /* The receiver lost frames and asks for a key frame instead of waiting for the next GOP. */
+    virtual void RequestKeyFrame() {}
+    /* Counter of the owning stream the nodes report dropped frames to, takes effect on the next create. */
+    virtual void SetDropCounter(const std::shared_ptr<DCameraStreamDropCounter>& dropCounter) {}
+    /* Account of the owning session the nodes charge their buffers to, takes effect on the next create. */
+    virtual void SetMemoryAccount(const std::shared_ptr<DCameraMemoryAccount>& memoryAccount) {}
+    /* Counters of the owner sending the output to the channel, dumped after the nodes of the pipeline. */
+    virtual void SetSendStats(const std::shared_ptr<DCameraNodeStats>& sendStats) {}
 };
 } // namespace DistributedHardware
 } // namespace OHOS
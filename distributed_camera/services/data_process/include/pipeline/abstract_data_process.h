@@ -23,6 +23,9 @@
 #include "image_common_type.h"
 #include "distributed_camera_errno.h"
 #include "camera_metadata_info.h"
+#include "dcamera_frame_drop_statistics.h"
+#include "dcamera_memory_account.h"
+#include "dcamera_node_stats.h"
 #include "property_carrier.h"
 
 namespace OHOS {
@@ -37,14 +40,45 @@ public:
         VideoConfigParams& processedConfig) = 0;
     virtual int32_t ProcessData(std::vector<std::shared_ptr<DataBuffer>>& inputBuffers) = 0;
     virtual void ReleaseProcessNode() = 0;
+    /*
+     * Takes a new resolution without a release, called on the pipeline event thread after InitNode. A node that
+     * keeps no state worth reusing refuses and the pipeline is rebuilt instead.
+     */
+    virtual int32_t UpdateConfig(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig,
+        VideoConfigParams& processedConfig)
+    {
+        return DCAMERA_BAD_OPERATE;
+    }
     virtual int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) = 0;
     virtual int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) = 0;
+    virtual std::shared_ptr<DataBuffer> AcquireInputBuffer(size_t capacity)
+    {
+        return DataBuffer::Acquire(capacity);
+    }
+    virtual std::string GetNodeName() const
+    {
+        return "Node";
+    }
+    DCameraNodeStats& GetNodeStats();
+    // Appends the counters of this node to a PIPELINE_STATS query.
+    void CarryNodeStats(PropertyCarrier& propertyCarrier);
+    // Set by the pipeline before it starts the node, the node reports every frame it drops to it.
+    void SetDropCounter(const std::shared_ptr<DCameraStreamDropCounter>& dropCounter);
+    void CountDroppedFrames(DCameraDropReason reason, size_t count);
+    // Set by the pipeline before it starts the node, the buffers the node allocates are charged to it.
+    void SetMemoryAccount(const std::shared_ptr<DCameraMemoryAccount>& memoryAccount);
+    bool IsOverMemoryBudget() const;
 
 public:
     std::shared_ptr<AbstractDataProcess> nextDataProcess_ = nullptr;
 
 protected:
-    size_t nodeRank_;
+    size_t nodeRank_ = 0;
+    DCameraNodeStats stats_;
+    std::shared_ptr<DCameraStreamDropCounter> dropCounter_ = nullptr;
+    std::shared_ptr<DCameraMemoryAccount> memoryAccount_ = nullptr;
+
+    void OnBufferAllocated(const std::shared_ptr<DataBuffer>& buffer, DCameraMemoryOwner owner);
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -20,11 +20,13 @@
 #include <vector>
 
 #include "data_buffer.h"
+#include "dcamera_codec_capability.h"
 #include "image_common_type.h"
 #include "distributed_camera_errno.h"
 #include "idata_process_pipeline.h"
 #include "abstract_data_process.h"
 #include "data_process_listener.h"
+#include "dcamera_bitrate_controller.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -41,6 +43,15 @@ public:
 
     void OnError(DataProcessErrorType errorType);
     int32_t OnProcessedVideoBuffer(const std::shared_ptr<DataBuffer>& videoResult);
+    bool WaitOutputWritable(int64_t timeoutMs);
+    void OnChannelSendResult(size_t frameSize, int64_t sendCostUs, int32_t result) override;
+    void OnLinkCapacity(int64_t bandwidthBps) override;
+    void SetBitratePercent(int32_t percent) override;
+    void RequestKeyFrame() override;
+    void SetDropCounter(const std::shared_ptr<DCameraStreamDropCounter>& dropCounter) override;
+    void SetMemoryAccount(const std::shared_ptr<DCameraMemoryAccount>& memoryAccount) override;
+    void SetSendStats(const std::shared_ptr<DCameraNodeStats>& sendStats) override;
+    std::shared_ptr<DCameraBitrateController> GetBitrateController() const;
 
     int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
 
@@ -52,6 +63,8 @@ private:
 
 private:
     const static std::string PIPELINE_OWNER;
+    const static std::string PIPELINE_STAGE_NAME;
+    const static std::string SEND_STATS_NAME;
     constexpr static int32_t MIN_FRAME_RATE = 0;
     constexpr static int32_t MAX_FRAME_RATE = 30;
     constexpr static int32_t MIN_VIDEO_WIDTH = 320;
@@ -63,8 +76,14 @@ private:
     std::shared_ptr<AbstractDataProcess> pipelineHead_ = nullptr;
 
     std::atomic<bool> isProcess_ = false;
+    VideoCapabilityBounds bounds_ { MAX_VIDEO_WIDTH, MAX_VIDEO_HEIGHT, MAX_FRAME_RATE };
     PipelineType piplineType_ = PipelineType::VIDEO;
     std::vector<std::shared_ptr<AbstractDataProcess>> pipNodeRanks_;
+    std::shared_ptr<DCameraStreamDropCounter> dropCounter_ = nullptr;
+    std::shared_ptr<DCameraMemoryAccount> memoryAccount_ = nullptr;
+    std::shared_ptr<DCameraNodeStats> sendStats_ = nullptr;
+    // Shared with the encoder node and never reset, the send thread may report after the pipeline is destroyed.
+    const std::shared_ptr<DCameraBitrateController> bitrateController_ = std::make_shared<DCameraBitrateController>();
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -18,12 +18,14 @@
 
 #include <memory>
 #include <vector>
-#include "event_handler.h"
 
 #include "data_buffer.h"
+#include "dcamera_codec_capability.h"
+#include "dcamera_frame_capture.h"
 #include "image_common_type.h"
 #include "distributed_camera_errno.h"
 #include "dcamera_pipeline_event.h"
+#include "dcamera_serial_queue.h"
 #include "idata_process_pipeline.h"
 #include "abstract_data_process.h"
 #include "data_process_listener.h"
@@ -40,41 +42,74 @@ public:
         const VideoConfigParams& targetConfig, const std::shared_ptr<DataProcessListener>& listener) override;
     int32_t ProcessData(std::vector<std::shared_ptr<DataBuffer>>& dataBuffers) override;
     void DestroyDataProcessPipeline() override;
+    int32_t UpdateConfig(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig) override;
 
     void OnError(DataProcessErrorType errorType);
     void OnProcessedVideoBuffer(const std::shared_ptr<DataBuffer>& videoResult);
+    std::shared_ptr<DataBuffer> AcquireOutputBuffer(size_t capacity);
+    void OnDecoderStepDown();
+    void OnDecodedVideoBuffer(const std::shared_ptr<DataBuffer>& decodedBuffer);
+
+    /*
+     * A branch is a pipeline whose source is the decoded frame of this one, it only scales and converts. Streams
+     * that differ in their target config share one decoder that way.
+     */
+    int32_t GetDecodedConfig(VideoConfigParams& decodedConfig);
+    void AddBranch(const std::shared_ptr<DCameraPipelineSource>& branch);
+    void RemoveBranch(const std::shared_ptr<DCameraPipelineSource>& branch);
 
     int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
 
     int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) override;
 
+    std::shared_ptr<DataBuffer> AcquireInputBuffer(size_t capacity) override;
+    void SetDropCounter(const std::shared_ptr<DCameraStreamDropCounter>& dropCounter) override;
+    void SetMemoryAccount(const std::shared_ptr<DCameraMemoryAccount>& memoryAccount) override;
+
 private:
     bool IsInRange(const VideoConfigParams& curConfig);
     void InitDCameraPipEvent();
     int32_t InitDCameraPipNodes(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig);
-    void StartEventHandler();
+    void OpenFrameCapture(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig);
+    bool IsSameTopology(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig);
+    int32_t UpdateDCameraPipNodes(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig);
+    bool IsDirectOutput(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig,
+        const VideoConfigParams& decodedConfig);
 
 private:
     const static std::string PIPELINE_OWNER;
+    const static std::string PIPELINE_STAGE_NAME;
     constexpr static int32_t MIN_FRAME_RATE = 0;
     constexpr static int32_t MAX_FRAME_RATE = 30;
     constexpr static int32_t MIN_VIDEO_WIDTH = 320;
     constexpr static int32_t MIN_VIDEO_HEIGHT = 240;
     constexpr static int32_t MAX_VIDEO_WIDTH = 4160;
     constexpr static int32_t MAX_VIDEO_HEIGHT = 3120;
+    constexpr static const char *FRAME_CAPTURE_PARA = "sys.dcamera.pipeline.capture.enable";
+    constexpr static int32_t UPDATE_CONFIG_TIMEOUT_MS = 1000;
 
     std::mutex listenerMutex_;
     std::shared_ptr<DataProcessListener> processListener_ = nullptr;
     std::shared_ptr<AbstractDataProcess> pipelineHead_ = nullptr;
 
     bool isProcess_ = false;
+    bool isDirectOutput_ = false;
+    // The decoder wrote the consumer layout instead of I420, branches cannot take its frames.
+    bool isTargetLayoutDecoded_ = false;
+    VideoCapabilityBounds bounds_ { MAX_VIDEO_WIDTH, MAX_VIDEO_HEIGHT, MAX_FRAME_RATE };
     PipelineType piplineType_ = PipelineType::VIDEO;
     std::vector<std::shared_ptr<AbstractDataProcess>> pipNodeRanks_;
+    VideoConfigParams sourceConfig_;
+    VideoConfigParams targetConfig_;
+    std::shared_ptr<DCameraStreamDropCounter> dropCounter_ = nullptr;
+    std::shared_ptr<DCameraMemoryAccount> memoryAccount_ = nullptr;
+    VideoConfigParams decodedConfig_;
+    std::mutex branchMutex_;
+    std::vector<std::weak_ptr<DCameraPipelineSource>> branches_;
+    DCameraFrameCaptureWriter captureWriter_;
 
     std::mutex eventMutex_;
-    std::thread eventThread_;
-    std::condition_variable eventCon_;
-    std::shared_ptr<AppExecFwk::EventHandler> pipeEventHandler_ = nullptr;
+    std::shared_ptr<DCameraSerialQueue> pipeEventQueue_ = nullptr;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_PIPELINE_STAGE_H
+#define OHOS_DCAMERA_PIPELINE_STAGE_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "abstract_data_process.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Runs a pipeline node on its own worker. The upstream node hands frames over through a bounded single
+ * producer single consumer ring, so the node works on frame N while the upstream node produces frame N + 1.
+ * A full ring is reported upstream as DCAMERA_DEVICE_BUSY and the frame is dropped. The worker holds the stage,
+ * so a node callback releasing the pipeline does not free it under the worker.
+ */
+class DCameraPipelineStage : public AbstractDataProcess, public std::enable_shared_from_this<DCameraPipelineStage> {
+public:
+    DCameraPipelineStage(const std::shared_ptr<AbstractDataProcess>& node, const std::string& name,
+        size_t capacity = DEFAULT_QUEUE_CAPACITY);
+    ~DCameraPipelineStage() override;
+
+    static bool IsParallelEnabled();
+    int32_t Start();
+    size_t GetPendingCount();
+
+    int32_t InitNode(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig,
+        VideoConfigParams& processedConfig) override;
+    int32_t ProcessData(std::vector<std::shared_ptr<DataBuffer>>& inputBuffers) override;
+    void ReleaseProcessNode() override;
+    int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
+    int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) override;
+    std::shared_ptr<DataBuffer> AcquireInputBuffer(size_t capacity) override;
+
+private:
+    void Stop();
+    void RunStage();
+
+private:
+    constexpr static size_t DEFAULT_QUEUE_CAPACITY = 2;
+    constexpr static int32_t BACK_PRESSURE_WAIT_MS = 10;
+    constexpr static const char *PARALLEL_ENABLE_PARA = "sys.dcamera.pipeline.parallel.enable";
+
+    std::shared_ptr<AbstractDataProcess> node_;
+    std::string name_;
+
+    std::mutex queueMutex_;
+    std::condition_variable notEmptyCon_;
+    std::condition_variable notFullCon_;
+    std::vector<std::vector<std::shared_ptr<DataBuffer>>> slots_;
+    size_t head_ = 0;
+    size_t pendingCount_ = 0;
+    bool isRunning_ = false;
+    std::thread worker_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_PIPELINE_STAGE_H
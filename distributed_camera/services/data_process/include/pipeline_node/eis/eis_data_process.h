@@ -17,10 +17,14 @@
 #define OHOS_EIS_DATA_PROCESS_H
  
 #include "abstract_data_process.h"
+#include "dcamera_imu_ring.h"
 #include "dcamera_pipeline_source.h"
+#include "eis_stabilizer.h"
 #include "image_common_type.h"
+#include <deque>
 #include <mutex>
 #include <queue>
+#include <vector>
  
 namespace OHOS {
 namespace DistributedHardware {
@@ -38,17 +42,46 @@ public:
     void ReleaseProcessNode() override;
     int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
     int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) override;
+    std::string GetNodeName() const override
+    {
+        return "EIS";
+    }
  
+    /* The node before EIS scales to the target plus a stabilization margin, EIS crops it back. */
+    static VideoConfigParams GetMarginConfig(const VideoConfigParams& targetConfig);
+    static size_t GetLookAheadFrames();
+    static bool IsCroppable(Videoformat format);
+
 private:
+    void LoadImuWindow(const std::shared_ptr<DataBuffer>& buffer);
+    std::shared_ptr<DataBuffer> CropFrame(const std::shared_ptr<DataBuffer>& buffer, const EisCropOffset& offset);
     int32_t EISDone(std::vector<std::shared_ptr<DataBuffer>>& outputBuffers);
  
 private:
+    constexpr static int64_t US_TO_NS = 1000;
+    constexpr static int32_t DEFAULT_LOOK_AHEAD_FRAMES = 2;
+    constexpr static int32_t MAX_LOOK_AHEAD_FRAMES = 15;
+    constexpr static double DEFAULT_HFOV_DEGREE = 80.0;
+    constexpr static double HALF_CIRCLE_DEGREE = 180.0;
+    constexpr static double HALF = 0.5;
+    constexpr static int32_t MARGIN_PERCENT = 10;
+    constexpr static int32_t PERCENT = 100;
+    constexpr static int32_t YUV_BYTES_PER_PIXEL = 3;
+    constexpr static int32_t Y2UV_RATIO = 2;
+    constexpr static const char *LOOK_AHEAD_PARA = "sys.dcamera.eis.lookahead";
+
     VideoConfigParams sourceConfig_;
     VideoConfigParams targetConfig_;
     VideoConfigParams processedConfig_;
     std::weak_ptr<DCameraPipelineSource> callbackPipelineSource_;
     
     std::atomic<bool> isEISProcess_ = false;
+    std::mutex eisMutex_;
+    int64_t lastFrameTimeNs_ = 0;
+    std::vector<ImuSample> gyroWindow_;
+    bool isStabilizing_ = false;
+    EISStabilizer stabilizer_;
+    std::deque<std::shared_ptr<DataBuffer>> pendingFrames_;
 };
  
 } // namespace DistributedHardware
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_EIS_STABILIZER_H
+#define OHOS_EIS_STABILIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "dcamera_imu_ring.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+struct EisCropOffset {
+    int32_t x = 0;
+    int32_t y = 0;
+};
+
+/*
+ * Camera path estimation for the EIS node. Gyro rates are integrated into a per-frame yaw and pitch, the
+ * path is smoothed over the frames already sent and lookAhead frames not sent yet, and the difference
+ * between the smoothed and the real path is turned into a crop offset inside the margin. Roll is not
+ * compensated, doing so would need a per-pixel warp instead of a crop.
+ */
+class EISStabilizer {
+public:
+    EISStabilizer() = default;
+    ~EISStabilizer() = default;
+
+    void Init(int32_t marginX, int32_t marginY, double focalLength, size_t lookAhead);
+    void AddFrame(const std::vector<ImuSample>& gyroData);
+    bool GetReadyOffset(EisCropOffset& offset);
+    size_t GetPendingCount() const;
+    void Reset();
+
+private:
+    struct Orientation {
+        double yaw = 0.0;
+        double pitch = 0.0;
+    };
+
+    Orientation GetSmoothed() const;
+    static int32_t ClampOffset(double shift, int32_t margin);
+
+    constexpr static size_t HISTORY_FRAMES = 15;
+    constexpr static double NS_PER_SECOND = 1000000000.0;
+    constexpr static int64_t MAX_SAMPLE_GAP_NS = 100000000;
+
+    int32_t marginX_ = 0;
+    int32_t marginY_ = 0;
+    double focalLength_ = 0.0;
+    size_t lookAhead_ = 0;
+    Orientation current_;
+    int64_t lastSampleTime_ = 0;
+    std::deque<Orientation> history_;
+    std::deque<Orientation> pending_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_EIS_STABILIZER_H
@@ -15,6 +15,7 @@
 #ifndef OHOS_FPS_CONTROLLER_PROCESS_H
 #define OHOS_FPS_CONTROLLER_PROCESS_H
 
+#include <array>
 #include <cstdint>
 #include <vector>
 
@@ -38,11 +39,17 @@ public:
 
     int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
     int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) override;
+    std::string GetNodeName() const override
+    {
+        return "FpsController";
+    }
 
 private:
     void UpdateFPSControllerInfo(int64_t nowMs);
     void UpdateFrameRateCorrectionFactor(int64_t nowMs);
     void UpdateIncomingFrameTimes(int64_t nowMs);
+    void ClearIncomingFrameTimes();
+    void EvictExpiredFrameTimes(int64_t nowMs);
     float CalculateFrameRate(int64_t nowMs);
     bool IsDropFrame(float incomingFps);
     bool ReduceFrameRateByUniformStrategy(int32_t incomingFps);
@@ -76,7 +83,10 @@ private:
     float frameRateCorrectionFactor_ = 0.0;
     /* modify the frame rate controller argument */
     int32_t frameRateOvershootMdf_ = 0;
-    int64_t incomingFrameTimesMs_[INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE] = { 0 };
+    /* Ring of the incoming frame times, the next one goes to the head and the oldest leaves first. */
+    std::array<int64_t, INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE> incomingFrameTimesMs_ {};
+    size_t frameTimesHead_ = 0;
+    size_t frameTimesCount_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
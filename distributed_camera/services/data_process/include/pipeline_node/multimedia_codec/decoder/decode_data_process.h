@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <map>
 #include <queue>
 #include <deque>
 #include <thread>
@@ -26,7 +27,6 @@
 #include "avcodec_common.h"
 #include "avcodec_video_decoder.h"
 #include "buffer/avsharedmemory.h"
-#include "event_handler.h"
 #include "meta/format.h"
 #include "ibuffer_consumer_listener.h"
 #include "iconsumer_surface.h"
@@ -36,8 +36,10 @@
 
 #include "abstract_data_process.h"
 #include "data_buffer.h"
+#include "dcamera_codec_capability.h"
 #include "dcamera_codec_event.h"
 #include "dcamera_pipeline_source.h"
+#include "dcamera_serial_queue.h"
 #include "distributed_camera_errno.h"
 #include "image_common_type.h"
 #include "dcamera_utils_tools.h"
@@ -48,28 +50,19 @@ namespace DistributedHardware {
 class DCameraPipelineSource;
 class DecodeVideoCallback;
 
-typedef struct {
-    int32_t width;
-    int32_t height;
-    uint8_t* dataY;
-    int32_t strideY;
-    uint8_t* dataU;
-    int32_t strideU;
-    uint8_t* dataV;
-    int32_t strideV;
-} ImageDataInfo;
-
 class DecodeDataProcess : public AbstractDataProcess, public std::enable_shared_from_this<DecodeDataProcess> {
 public:
-    DecodeDataProcess(const std::shared_ptr<AppExecFwk::EventHandler>& pipeEventHandler,
+    DecodeDataProcess(const std::shared_ptr<DCameraSerialQueue>& pipeEventQueue,
         const std::weak_ptr<DCameraPipelineSource>& callbackPipSource)
-        : pipeSrcEventHandler_(pipeEventHandler), callbackPipelineSource_(callbackPipSource) {}
+        : pipeSrcEventQueue_(pipeEventQueue), callbackPipelineSource_(callbackPipSource) {}
     ~DecodeDataProcess() override;
 
     int32_t InitNode(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig,
         VideoConfigParams& processedConfig) override;
     int32_t ProcessData(std::vector<std::shared_ptr<DataBuffer>>& inputBuffers) override;
     void ReleaseProcessNode() override;
+    int32_t UpdateConfig(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig,
+        VideoConfigParams& processedConfig) override;
 
     void OnError();
     void OnInputBufferAvailable(uint32_t index, std::shared_ptr<Media::AVSharedMemory> buffer);
@@ -85,14 +78,29 @@ public:
     int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
 
     int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) override;
+    std::string GetNodeName() const override
+    {
+        return "Decode";
+    }
+
+    std::shared_ptr<DataBuffer> AcquireInputBuffer(size_t capacity) override;
 
 private:
+    struct InputSlot {
+        uint32_t index;
+        std::shared_ptr<Media::AVSharedMemory> memory;
+    };
+
     bool IsInDecoderRange(const VideoConfigParams& curConfig);
     bool IsConvertible(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig);
     void InitCodecEvent();
     int32_t InitDecoder();
-    int32_t ConfigureVideoDecoder();
+    int32_t ConfigureVideoDecoder(bool isForceSoftware);
+    std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> CreateVideoDecoder(bool isForceSoftware);
+    std::string GetArbiterKey() const;
+    void OnDecoderStepDown();
     int32_t InitDecoderMetadataFormat();
+    Videoformat SelectOutputFormat();
     int32_t SetDecoderOutputSurface();
     int32_t StartVideoDecoder();
     int32_t StopVideoDecoder();
@@ -100,27 +108,25 @@ private:
     void ReleaseDecoderSurface();
     void ReleaseCodecEvent();
     void BeforeDecodeDump(uint8_t *buffer, size_t bufSize);
+    std::string GetAfterDecodeDumpName() const;
+    void CloseFrameDumps();
     int32_t FeedDecoderInputBuffer();
+    void PostFeedDecoderInputBuffer();
     int64_t GetDecoderTimeStamp();
     void IncreaseWaitDecodeCnt();
     void ReduceWaitDecodeCnt();
     void CopyDecodedImage(const sptr<SurfaceBuffer>& surBuf, int32_t alignedWidth, int32_t alignedHeight);
     bool IsCorrectSurfaceBuffer(const sptr<SurfaceBuffer>& surBuf, int32_t alignedWidth, int32_t alignedHeight);
+    int32_t GetBytesPerSample() const;
     void PostOutputDataBuffers(std::shared_ptr<DataBuffer>& outputBuffer);
     int32_t DecodeDone(std::vector<std::shared_ptr<DataBuffer>>& outputBuffers);
-    void StartEventHandler();
-    bool UniversalRotateCropAndPadNv12ToI420(ImageDataInfo srcInfo, ImageDataInfo dstInfo, int angleDegrees);
-    bool ConvertToI420BySystemSwitch(uint8_t *srcDataY, uint8_t *srcDataUV, int32_t alignedWidth,
-        int32_t alignedHeight, std::shared_ptr<DataBuffer> bufferOutput);
     bool ConvertToI420(uint8_t *srcDataY, uint8_t *srcDataUV, int32_t alignedWidth,
         int32_t alignedHeight, std::shared_ptr<DataBuffer> bufferOutput);
-    bool NV12ToI420RotateBySystemSwitch(ImageDataInfo dataInfo, std::vector<uint8_t> rotatedBuffer,
-        int srcWidth, int srcHeight, OpenSourceLibyuv::RotationMode mode);
-    bool I420CopyBySystemSwitch(ImageDataInfo srcInfo, ImageDataInfo dstInfo,
-        int srcWidth, int srcHeight, int32_t normalizedAngle);
-    bool CheckParameters(ImageDataInfo srcInfo, ImageDataInfo dstInfo);
-    OpenSourceLibyuv::RotationMode ParseAngle(int angleDegrees);
-    bool FreeYUVBuffer(uint8_t*& dataY, uint8_t*& dataU, uint8_t*& dataV);
+    void CopySemiPlanar(uint8_t *srcDataY, uint8_t *srcDataUV, int32_t alignedWidth,
+        std::shared_ptr<DataBuffer> bufferOutput);
+    bool CopyP010(uint8_t *srcDataY, uint8_t *srcDataUV, int32_t alignedWidth,
+        std::shared_ptr<DataBuffer> bufferOutput);
+    int32_t CalMaxInputSize(const int32_t defaultSize, const int32_t bytesPerPixel, const int32_t pixelDivisor);
 
 private:
     constexpr static int32_t VIDEO_DECODER_QUEUE_MAX = 1000;
@@ -134,22 +140,23 @@ private:
     constexpr static int32_t MAX_VIDEO_WIDTH = 4160;
     constexpr static int32_t MAX_VIDEO_HEIGHT = 3120;
     constexpr static int32_t FIRST_FRAME_INPUT_NUM = 2;
+    constexpr static size_t MIN_RESERVED_INPUT_SLOTS = 1;
     constexpr static int32_t RGB32_MEMORY_COEFFICIENT = 4;
     constexpr static int32_t YUV_BYTES_PER_PIXEL = 3;
     constexpr static int32_t Y2UV_RATIO = 2;
+    constexpr static int32_t P010_BYTES_PER_SAMPLE = 2;
     constexpr static int32_t BUFFER_MAX_SIZE = 50 * 1024 * 1024;
     constexpr static int32_t ALIGNED_WIDTH_MAX_SIZE = 10000;
     constexpr static uint32_t MEMORY_RATIO_UV = 1;
-    constexpr static uint32_t OFFSET_X_0 = 0;
-    constexpr static uint32_t OFFSET_Y_0 = 0;
-    constexpr static uint32_t BLACK_COLOR_PEXEL = 0;
-    constexpr static uint32_t WHITE_COLOR_PEXEL = 128;
-    std::shared_ptr<AppExecFwk::EventHandler> pipeSrcEventHandler_;
+    constexpr static int32_t INPUT_SIZE_MARGIN = 2;
+    std::shared_ptr<DCameraSerialQueue> pipeSrcEventQueue_;
     std::weak_ptr<DCameraPipelineSource> callbackPipelineSource_;
     std::mutex mtxDecoderLock_;
     std::mutex mtxDecoderState_;
     std::mutex mtxHoldCount_;
     std::mutex mtxDequeLock_;
+    // Held by the output copy, a resolution switch waits for the frame being copied.
+    std::mutex mtxOutputConfig_;
     VideoConfigParams sourceConfig_;
     VideoConfigParams targetConfig_;
     VideoConfigParams processedConfig_;
@@ -160,8 +167,15 @@ private:
     sptr<IBufferConsumerListener> decodeSurfaceListener_ = nullptr;
 
     std::atomic<bool> isDecoderProcess_ = false;
+    // Software decoders are granted by the arbiter when the hardware is busy and never go back to the pool.
+    bool isSoftwareDecoder_ = false;
+    std::string arbiterKey_;
     int32_t waitDecoderOutputCount_ = 0;
+    // Set under mtxHoldCount_ when feeding ran out of decoder input slots, the next free slot resumes it.
+    bool isInputStarved_ = false;
     int32_t alignedHeight_ = 0;
+    int32_t maxInputSize_ = MAX_YUV420_BUFFER_SIZE;
+    VideoCapabilityBounds bounds_ { MAX_VIDEO_WIDTH, MAX_VIDEO_HEIGHT, static_cast<int32_t>(MAX_FRAME_RATE) };
     int64_t lastFeedDecoderInputBufferTimeUs_ = 0;
     int64_t outputTimeStampUs_ = 0;
     std::string processType_;
@@ -171,18 +185,20 @@ private:
     std::queue<std::shared_ptr<DataBuffer>> inputBuffersQueue_;
     std::queue<std::shared_ptr<Media::AVSharedMemory>> availableInputBufferQueue_;
     std::queue<uint32_t> availableInputIndexsQueue_;
+    std::map<const DataBuffer *, InputSlot> boundInputSlots_;
     std::queue<EisInfo> eisInfoQueue_;
     std::deque<DCameraFrameInfo> frameInfoDeque_;
     FILE *dumpDecBeforeFile_ = nullptr;
     FILE *dumpDecAfterFile_ = nullptr;
-    int32_t rotate_ = 0;
 
     std::mutex eventMutex_;
-    std::thread eventThread_;
-    std::condition_variable eventCon_;
-    std::shared_ptr<AppExecFwk::EventHandler> decEventHandler_ = nullptr;
+    std::shared_ptr<DCameraSerialQueue> decEventQueue_ = nullptr;
     int32_t ProcessSingleInputBuffer();
     int32_t GetAvailableDecoderBuffer(uint32_t& index, std::shared_ptr<Media::AVSharedMemory>& sharedMemoryInput);
+    bool GetBoundInputSlot(const DataBuffer *buffer, uint32_t& index,
+        std::shared_ptr<Media::AVSharedMemory>& sharedMemoryInput);
+    void ConsumeBoundInputSlot(const DataBuffer *buffer);
+    void RecycleBoundInputSlot(const DataBuffer *buffer);
     int32_t QueueBufferToDecoder(std::shared_ptr<DataBuffer>& buffer, uint32_t index,
         std::shared_ptr<Media::AVSharedMemory>& sharedMemoryInput);
 };
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_BITRATE_CONTROLLER_H
+#define OHOS_DCAMERA_BITRATE_CONTROLLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace OHOS {
+namespace DistributedHardware {
+struct BitrateDecision {
+    int64_t bitrate = 0;
+    bool needKeyFrame = false;
+};
+
+/*
+ * Closed loop bitrate control for the sink encoder. The send thread reports how long each frame took on the
+ * channel, the encoder thread reports busy answers and dropped frames, and once per window the controller
+ * backs off towards the measured link rate on congestion or probes upwards after a few quiet windows.
+ * A link capacity reported by the channel, a load ceiling set by the encoder preset and the share of the maximum
+ * the sink degradation policy allows cap every decision until they are cleared again, and a key frame the receiver
+ * asks for is handed to the encoder on its next output.
+ */
+class DCameraBitrateController {
+public:
+    DCameraBitrateController() = default;
+    ~DCameraBitrateController() = default;
+
+    void Init(int64_t minBitrate, int64_t maxBitrate, int64_t startBitrate, int32_t frameRate);
+    void OnFrameSent(size_t frameSize, int64_t sendCostUs, bool isSuccess);
+    void OnSendBusy();
+    void OnFramesDropped(uint32_t count);
+    void SetLinkCapacity(int64_t bandwidthBps);
+    void SetLoadCeiling(int64_t bitrate);
+    void SetBitratePercent(int32_t percent);
+    void RequestKeyFrame();
+    bool TakeKeyFrameRequest();
+    bool Evaluate(int64_t nowUs, BitrateDecision& decision);
+    int64_t GetBitrate();
+
+private:
+    void ResetWindow(int64_t nowUs);
+    int64_t GetCongestedBitrate() const;
+    int64_t GetCeilingBitrate() const;
+
+    constexpr static int64_t WINDOW_US = 1000000;
+    constexpr static int64_t US_PER_SECOND = 1000000;
+    constexpr static int64_t BITS_PER_BYTE = 8;
+    constexpr static int32_t PERCENT_BASE = 100;
+    constexpr static uint32_t INCREASE_HOLD_WINDOWS = 2;
+    constexpr static int64_t INCREASE_STEPS = 10;
+    constexpr static uint32_t BUSY_FRAME_RATIO = 4;
+    constexpr static double DECREASE_FACTOR = 0.85;
+    constexpr static double LINK_UTILIZATION = 0.8;
+    constexpr static double CONGESTED_COST_RATIO = 0.8;
+    constexpr static double IDLE_COST_RATIO = 0.5;
+
+    std::mutex mutex_;
+    int64_t minBitrate_ = 0;
+    int64_t maxBitrate_ = 0;
+    int64_t bitrate_ = 0;
+    int64_t frameIntervalUs_ = 0;
+    int64_t windowStartUs_ = 0;
+    uint64_t sentBytes_ = 0;
+    uint32_t sentFrames_ = 0;
+    int64_t sendCostUs_ = 0;
+    uint32_t failCount_ = 0;
+    uint32_t busyCount_ = 0;
+    uint32_t dropCount_ = 0;
+    uint32_t stableWindows_ = 0;
+    int64_t linkCapacity_ = 0;
+    int64_t loadCeiling_ = 0;
+    int32_t bitratePercent_ = PERCENT_BASE;
+    bool isKeyFrameRequested_ = false;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_BITRATE_CONTROLLER_H
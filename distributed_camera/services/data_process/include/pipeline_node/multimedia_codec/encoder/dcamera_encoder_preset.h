@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_ENCODER_PRESET_H
+#define OHOS_DCAMERA_ENCODER_PRESET_H
+
+#include <cstdint>
+#include <mutex>
+
+#include "dcamera_codec_capability.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+enum class EncoderTier : uint8_t {
+    UNKNOWN = 0,
+    LOW = 1,
+    MID = 2,
+    HIGH = 3,
+};
+
+enum class EncoderRateControl : uint8_t {
+    VBR = 0,
+    CBR = 1,
+};
+
+/*
+ * Encoder settings of one sink tier. No tier uses B frames, the source shows every frame as soon as it is
+ * decoded and reordering would add a frame interval of latency.
+ */
+struct EncoderPreset {
+    EncoderTier tier = EncoderTier::MID;
+    EncoderRateControl rateControl = EncoderRateControl::VBR;
+    // AVC high instead of baseline, HEVC keeps main or main 10 on every tier.
+    bool isHighProfile = false;
+    int32_t idrIntervalMs = 0;
+    // Share of the bitrate table entry the encoder starts from and may reach.
+    int32_t bitratePercent = 0;
+};
+
+/*
+ * Picks the encoder preset of this sink from the bounds of its hardware encoder, a codec without hardware
+ * bounds is encoded in software and gets the low tier. At runtime the preset is throttled:
+ * the level rises when encoded frames fall behind their capture time or the device heats up, and falls one
+ * step after a few calm windows. Each level lowers the bitrate ceiling of the encoder.
+ */
+class DCameraEncoderPreset {
+public:
+    static EncoderTier ClassifyTier(const VideoCapabilityBounds& bounds);
+    static EncoderPreset GetPreset(EncoderTier tier);
+    static int32_t GetThrottlePercent(int32_t level);
+    // Tier in the high nibble and throttle level in the low one, as carried in the frame info.
+    static uint8_t MakePresetCode(EncoderTier tier, int32_t level);
+
+    void Init(int32_t frameRate);
+    void OnFrameEncoded(int64_t encodeLatencyUs);
+    void SetThermalLevel(int32_t thermalLevel);
+    // Returns true once per window when the throttle level changed.
+    bool Evaluate(int64_t nowUs, int32_t& level);
+    int32_t GetThrottleLevel();
+
+    constexpr static int32_t MAX_THROTTLE_LEVEL = 3;
+    constexpr static int64_t WINDOW_US = 2000000;
+
+private:
+    int32_t GetThermalThrottleLevel() const;
+    void ResetWindow(int64_t nowUs);
+
+    constexpr static int64_t US_PER_SECOND = 1000000;
+    constexpr static int64_t HIGH_TIER_PIXEL_RATE = 3840LL * 2160 * 60;
+    constexpr static int64_t LOW_TIER_PIXEL_RATE = 1920LL * 1080 * 30;
+    constexpr static int32_t LOW_TIER_IDR_INTERVAL_MS = 4000;
+    constexpr static int32_t IDR_INTERVAL_MS = 2000;
+    constexpr static int32_t LOW_TIER_BITRATE_PERCENT = 75;
+    constexpr static int32_t MID_TIER_BITRATE_PERCENT = 100;
+    constexpr static int32_t HIGH_TIER_BITRATE_PERCENT = 125;
+    // Thermal levels of the power manager, warm and hot map to one and two steps, anything above to the most.
+    constexpr static int32_t THERMAL_LEVEL_WARM = 2;
+    constexpr static int32_t THERMAL_LEVEL_HOT = 3;
+    constexpr static int32_t THERMAL_LEVEL_OVERHEATED = 4;
+    constexpr static int32_t LATENCY_OVERLOAD_INTERVALS = 3;
+    constexpr static int32_t LATENCY_CALM_INTERVALS = 2;
+    constexpr static uint32_t CALM_HOLD_WINDOWS = 3;
+
+    std::mutex mutex_;
+    int64_t frameIntervalUs_ = 0;
+    int64_t windowStartUs_ = 0;
+    int64_t latencySumUs_ = 0;
+    uint32_t encodedFrames_ = 0;
+    int32_t thermalLevel_ = 0;
+    int32_t level_ = 0;
+    uint32_t calmWindows_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_ENCODER_PRESET_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -30,12 +30,15 @@
 
 #include "abstract_data_process.h"
 #include "data_buffer.h"
+#include "dcamera_codec_capability.h"
+#include "dcamera_encoder_preset.h"
 #include "dcamera_pipeline_sink.h"
 #include "distributed_camera_errno.h"
 #include "image_common_type.h"
 #include "distributed_camera_constants.h"
 
 #include "v1_0/display_composer_type.h"
+#include "v1_1/display_composer_type.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -65,6 +68,10 @@ public:
     int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
 
     int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) override;
+    std::string GetNodeName() const override
+    {
+        return "Encode";
+    }
 
 private:
     bool IsInEncoderRange(const VideoConfigParams& curConfig);
@@ -72,6 +79,10 @@ private:
     int32_t InitEncoder();
     int32_t ConfigureVideoEncoder();
     int32_t InitEncoderMetadataFormat();
+    bool IsMain10Supported();
+    bool IsHighProfileSupported();
+    void InitEncoderPreset();
+    void InitEncoderColorFormat();
     int32_t InitEncoderBitrateFormat();
     int32_t StartVideoEncoder();
     int32_t StopVideoEncoder();
@@ -84,17 +95,35 @@ private:
     int32_t GetEncoderOutputBuffer(uint32_t index, MediaAVCodec::AVCodecBufferInfo info,
         MediaAVCodec::AVCodecBufferFlag flag, std::shared_ptr<Media::AVSharedMemory>& buffer);
     int32_t EncodeDone(std::vector<std::shared_ptr<DataBuffer>>& outputBuffers);
-    int32_t AdjustBitrateBasedOnNetworkConditions(bool isUp);
+    int32_t SetEncoderBitrate(int64_t bitrate);
+    int32_t RequestKeyFrame();
+    void ApplyBitrateDecision();
+    void ApplyEncoderThrottle();
+    static int32_t GetThermalLevel();
     void SyncEncodeBufferThread();
+    void WaitEncodeOutputWritable(int64_t timeoutMs);
     bool IsKeyFrame(const std::shared_ptr<DataBuffer>& inputBuffer);
+    static bool IsLossResilientEnabled();
+    void InitLossResilientFormat();
     int64_t RoundBitrates(int64_t tempBitrate);
-    int32_t OnProcessedEncodeVideoBuffer(std::shared_ptr<DataBuffer>& encodeBuffer, bool isKeyFrame);
-    void SyncVideoFrameSuccess(bool isKeyFrame);
+    int32_t OnProcessedEncodeVideoBuffer(std::shared_ptr<DataBuffer>& encodeBuffer);
     void SyncVideoFrameFailure(std::shared_ptr<DataBuffer>& encodeBuffer);
+    // Keeps only the key frames of the sync queue and skips the following delta frames, caller holds the lock.
+    size_t DropQueuedDeltaFrames();
     int32_t CreateSyncEncodeBufferThread();
+    int64_t CalMaxInputSize(const int64_t defaultSize, const int32_t bytesPerPixel, const int32_t pixelDivisor);
 
 private:
     constexpr static int32_t ENCODER_STRIDE_ALIGNMENT = 8;
+    constexpr static int32_t YUV_BYTES_PER_PIXEL = 3;
+    constexpr static int32_t Y2UV_RATIO = 2;
+    constexpr static int32_t RGB32_BYTES_PER_PIXEL = 4;
+    constexpr static int32_t P010_BYTES_PER_SAMPLE = 2;
+    // ISO/IEC 23091-2 code points of the BT.2020 colour description.
+    constexpr static int32_t COLOR_PRIMARY_BT2020 = 9;
+    constexpr static int32_t TRANSFER_CHARACTERISTIC_PQ = 16;
+    constexpr static int32_t TRANSFER_CHARACTERISTIC_HLG = 18;
+    constexpr static int32_t MATRIX_COEFFICIENT_BT2020_NCL = 9;
     constexpr static int64_t NORM_YUV420_BUFFER_SIZE = 1920 * 1080 * 3 / 2;
     constexpr static int32_t NORM_RGB32_BUFFER_SIZE = 1920 * 1080 * 4;
     constexpr static int32_t MIN_FRAME_RATE = 0;
@@ -104,6 +133,14 @@ private:
     constexpr static int32_t MAX_VIDEO_WIDTH = 1920;
     constexpr static int32_t MAX_VIDEO_HEIGHT = 1080;
     constexpr static int32_t IDR_FRAME_INTERVAL_MS = 2000;
+    // The source asks for a key frame on loss, periodic IDRs are only a last resort then.
+    constexpr static int32_t RESILIENT_IDR_FRAME_INTERVAL_MS = 10000;
+    constexpr static int32_t RESILIENT_LTR_FRAME_COUNT = 2;
+    constexpr static const char *LTR_FRAME_COUNT_KEY = "video_encoder_ltr_frame_count";
+    constexpr static const char *LOSS_RESILIENT_PARA = "sys.dcamera.encoder.resilient.enable";
+    // Forces the encoder tier, 1 low, 2 mid and 3 high, for sinks the capability query misjudges.
+    constexpr static const char *ENCODER_TIER_PARA = "sys.dcamera.encoder.tier";
+    constexpr static int64_t PERCENT_BASE = 100;
     constexpr static int32_t FIRST_FRAME_OUTPUT_NUM = 2;
     const int32_t DATABUFF_MAX_SIZE = 100 * 1024 * 1024;
 
@@ -127,17 +164,14 @@ private:
     constexpr static int64_t BITRATE_3400000 = 3400000;
     constexpr static int64_t BITRATE_5000000 = 5000000;
     constexpr static int64_t BITRATE_6000000 = 6000000;
-    constexpr static int64_t DEFAULT_VIDEO_DYNAMIC_BITRATE = 500000;
-    constexpr static float MINIMUM_UNIT_OF_BITRATE = 0.75;
     constexpr static float RETRY_TIME_INTERVAL_FACTOR = 0.3;
     constexpr static int32_t MINIMUM_BITRATE_FACTOR = 3;
     const static std::map<std::int64_t, int64_t> ENCODER_BITRATE_TABLE;
+    constexpr static const char *REQUEST_I_FRAME_KEY = "req_i_frame";
     constexpr static uint64_t S2NS = 1000000000;
     constexpr static uint32_t US2NS = 1000;
     const uint32_t DCAMERA_SYNC_TIME_CONSTANTS_MS = 1000;
-    const uint32_t BITRATE_INCREASE_STANDARD = 5;
     const int32_t SYNCQUEUE_DIVIDE_TWO = 2;
-    const int32_t SYNCQUEUE_DIVIDE_FOUR = 4;
     constexpr static std::chrono::seconds TIMEOUT_3_SEC = std::chrono::seconds(3);
 
     std::weak_ptr<DCameraPipelineSink> callbackPipelineSink_;
@@ -151,8 +185,6 @@ private:
     sptr<Surface> encodeProducerSurface_ = nullptr;
 
     std::atomic<bool> isEncoderProcess_ = false;
-    std::atomic<bool> isMinBitrate_ = false;
-    std::atomic<bool> isMaxBitrate_ = false;
     std::atomic<bool> isSkipState_ = false;
     std::atomic<int32_t> lastKeyFrameIndex_ = 0;
     std::atomic<int32_t> curKeyFrameIndex_ = 0;
@@ -172,12 +204,17 @@ private:
     std::string surfaceStr_ = "surface";
     int32_t index_ = FRAME_HEAD;
     int32_t maxFrameRate_ = DCAMERA_PRODUCER_FPS_DEFAULT;
-    uint32_t syncKeyFrameSuccNum_ = 0;
+    int64_t maxInputSize_ = NORM_YUV420_BUFFER_SIZE;
+    VideoCapabilityBounds bounds_ { MAX_VIDEO_WIDTH, MAX_VIDEO_HEIGHT, static_cast<int32_t>(MAX_FRAME_RATE) };
     int64_t currentBitrate_ = BITRATE_3400000;
     int64_t maxBitrate_ = BITRATE_3400000;
     int64_t minBitrate_ = BITRATE_3400000;
-    int64_t dynamicBitrateStep_ = 0;
+    std::shared_ptr<DCameraBitrateController> bitrateController_ = nullptr;
     std::mutex bitrateMutex_;
+    EncoderPreset preset_;
+    DCameraEncoderPreset presetGovernor_;
+    std::atomic<uint8_t> presetCode_ = 0;
+    int64_t lastThermalQueryUs_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
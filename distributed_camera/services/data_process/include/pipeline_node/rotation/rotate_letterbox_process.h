@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROTATE_LETTERBOX_PROCESS_H
+#define OHOS_ROTATE_LETTERBOX_PROCESS_H
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "abstract_data_process.h"
+#include "dcamera_pipeline_source.h"
+#include "image_common_type.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Rotates system switch I420 frames in place. 90 and 270 degrees keep the frame size, so the centered square
+ * of the image is rotated and letterboxed with black bars. The square is staged in scratch memory reserved
+ * once per stream instead of per frame.
+ */
+class RotateLetterboxProcess : public AbstractDataProcess {
+public:
+    explicit RotateLetterboxProcess(const std::weak_ptr<DCameraPipelineSource>& callbackPipeSource)
+        : callbackPipelineSource_(callbackPipeSource) {}
+    ~RotateLetterboxProcess() override;
+
+    int32_t InitNode(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig,
+        VideoConfigParams& processedConfig) override;
+    int32_t ProcessData(std::vector<std::shared_ptr<DataBuffer>>& inputBuffers) override;
+    void ReleaseProcessNode() override;
+    int32_t UpdateConfig(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig,
+        VideoConfigParams& processedConfig) override;
+    int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
+    int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) override;
+    std::string GetNodeName() const override
+    {
+        return "RotateLetterbox";
+    }
+
+    struct LetterboxRegion {
+        int32_t srcX;
+        int32_t srcY;
+        int32_t dstX;
+        int32_t dstY;
+        int32_t size;
+    };
+
+    // The scale node rotates in its own pass when it can, these give it the same geometry as this node.
+    static int32_t GetImageRotation(const VideoConfigParams& targetConfig);
+    static LetterboxRegion GetLetterboxRegion(int32_t width, int32_t height, int32_t angle);
+
+    constexpr static uint8_t BLACK_COLOR_PEXEL = 0;
+    constexpr static uint8_t WHITE_COLOR_PEXEL = 128;
+
+private:
+    int32_t RotateImage(const std::shared_ptr<DataBuffer>& imgBuf, int32_t angle);
+    int32_t RotatePlane180(uint8_t *plane, int32_t width, int32_t height);
+    int32_t RotatePlaneLetterbox(uint8_t *plane, int32_t width, int32_t height, const LetterboxRegion& region,
+        int32_t angle, uint8_t fillValue);
+    bool ReserveScratch(int32_t width, int32_t height);
+    int32_t RotateDone(std::vector<std::shared_ptr<DataBuffer>>& outputBuffers);
+    static int32_t NormalizeAngle(int32_t angle);
+
+private:
+    constexpr static int32_t ROTATION_0 = 0;
+    constexpr static int32_t ROTATION_90 = 90;
+    constexpr static int32_t ROTATION_180 = 180;
+    constexpr static int32_t ROTATION_270 = 270;
+    constexpr static int32_t ROTATION_360 = 360;
+    constexpr static int32_t Y2UV_RATIO = 2;
+
+    VideoConfigParams sourceConfig_;
+    VideoConfigParams targetConfig_;
+    VideoConfigParams processedConfig_;
+    std::weak_ptr<DCameraPipelineSource> callbackPipelineSource_;
+
+    std::atomic<bool> isRotateProcess_ = false;
+    std::atomic<int32_t> rotate_ = 0;
+    std::mutex scratchMutex_;
+    std::vector<uint8_t> scratch_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_ROTATE_LETTERBOX_PROCESS_H
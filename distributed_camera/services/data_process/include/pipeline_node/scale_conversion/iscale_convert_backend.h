@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ISCALE_CONVERT_BACKEND_H
+#define OHOS_ISCALE_CONVERT_BACKEND_H
+
+#include <memory>
+
+#include "image_common_type.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Offload target of ScaleConvertProcess. Init tells whether the backend handles the configured conversion,
+ * the node keeps its own CPU path for everything a backend refuses.
+ */
+class IScaleConvertBackend {
+public:
+    virtual ~IScaleConvertBackend() = default;
+
+    virtual int32_t Init(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig) = 0;
+    virtual int32_t Convert(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo) = 0;
+    virtual void Release() = 0;
+};
+
+// Probes the hardware backends for the conversion, nullptr keeps the node on its CPU path.
+std::unique_ptr<IScaleConvertBackend> CreateScaleConvertBackend(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig);
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_ISCALE_CONVERT_BACKEND_H
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_SCALE_CONVERT_BLIT_BACKEND_H
+#define OHOS_SCALE_CONVERT_BLIT_BACKEND_H
+
+#include <mutex>
+
+#include "iscale_convert_backend.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+extern "C" {
+// Image handed to the vendor blit library, format carries the Videoformat value and data is null while probing.
+typedef struct {
+    int32_t format;
+    int32_t width;
+    int32_t height;
+    int32_t stride;
+    int32_t sliceHeight;
+    uint8_t *data;
+    size_t size;
+} DCameraBlitImage;
+
+typedef void *(*DCameraBlitCreateFunc)(const DCameraBlitImage *src, const DCameraBlitImage *dst);
+typedef int32_t (*DCameraBlitConvertFunc)(void *context, const DCameraBlitImage *src, DCameraBlitImage *dst);
+typedef void (*DCameraBlitDestroyFunc)(void *context);
+}
+
+/*
+ * Resize and colour conversion on the 2D engine or GPU of the device, reached through an optional vendor library.
+ * Init fails when the library is missing or its create call refuses the formats and sizes, the caller then stays
+ * on the CPU path.
+ */
+class ScaleConvertBlitBackend : public IScaleConvertBackend {
+public:
+    ScaleConvertBlitBackend() = default;
+    ~ScaleConvertBlitBackend() override;
+
+    int32_t Init(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig) override;
+    int32_t Convert(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo) override;
+    void Release() override;
+
+private:
+    bool LoadLibrary();
+    static DCameraBlitImage ToBlitImage(const ImageUnitInfo& imgInfo);
+
+    constexpr static const char *BLIT_LIB_PATH = "libdcamera_blit_ext.z.so";
+    constexpr static const char *BLIT_CREATE_FUNC = "DCameraBlitCreate";
+    constexpr static const char *BLIT_CONVERT_FUNC = "DCameraBlitConvert";
+    constexpr static const char *BLIT_DESTROY_FUNC = "DCameraBlitDestroy";
+
+    std::mutex blitMutex_;
+    void *dlHandler_ = nullptr;
+    void *context_ = nullptr;
+    DCameraBlitCreateFunc createFunc_ = nullptr;
+    DCameraBlitConvertFunc convertFunc_ = nullptr;
+    DCameraBlitDestroyFunc destroyFunc_ = nullptr;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_SCALE_CONVERT_BLIT_BACKEND_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -33,9 +33,12 @@ extern "C" {
 #include <libavformat/avformat.h>
 #include <mutex>
 #include <securec.h>
+#include <vector>
 
 #include "dcamera_pipeline_source.h"
 #include "image_common_type.h"
+#include "iscale_convert_backend.h"
+#include "yuv_color_kernels.h"
 #include "dcamera_utils_tools.h"
 
 namespace OHOS {
@@ -50,10 +53,20 @@ public:
         VideoConfigParams& processedConfig) override;
     int32_t ProcessData(std::vector<std::shared_ptr<DataBuffer>>& inputBuffers) override;
     void ReleaseProcessNode() override;
+    int32_t UpdateConfig(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig,
+        VideoConfigParams& processedConfig) override;
 
     int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override;
 
     int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) override;
+    std::string GetNodeName() const override
+    {
+        return "ScaleConvert";
+    }
+#ifndef DCAMERA_SUPPORT_FFMPEG
+    // Whether this node rotates, crops and scales a system switch stream in one pass, without the rotate node.
+    static bool IsFusedRotateSupported(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig);
+#endif
 
 private:
     bool IsConvertible(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig);
@@ -64,20 +77,49 @@ private:
     int32_t ScaleConvert(ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo);
     void Crop(ImageUnitInfo& sourceConfig, ImageUnitInfo& targetConfig);
     void CropConvert(ImageUnitInfo& sourceConfig, ImageUnitInfo& targetConfig, int crop_width,
-        int crop_height, uint8_t* dstY, uint8_t* dstU, uint8_t* dstV, std::shared_ptr<DataBuffer> cropBuf);
+        int crop_height, std::shared_ptr<DataBuffer> cropBuf);
 #ifdef DCAMERA_SUPPORT_FFMPEG
     int32_t CopyYUV420SrcData(const ImageUnitInfo& srcImgInfo);
     int32_t CopyNV12SrcData(const ImageUnitInfo& srcImgInfo);
     int32_t CopyNV21SrcData(const ImageUnitInfo& srcImgInfo);
+    bool ConvertDirect(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo);
 #else
+    int32_t ConvertFrame(const std::shared_ptr<DataBuffer>& inputBuffer,
+        std::vector<std::shared_ptr<DataBuffer>>& outputBuffers);
     int32_t ConvertResolution(ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo,
         std::shared_ptr<DataBuffer>& dstBuf);
     int32_t ConvertFormatToNV21(ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo,
         std::shared_ptr<DataBuffer>& dstBuf);
     int32_t ConvertFormatToRGBA(ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo,
         std::shared_ptr<DataBuffer>& dstBuf);
-    int32_t ConvertFormatToP010(ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo);
+    int32_t ConvertFormatToP010(ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo,
+        std::shared_ptr<DataBuffer>& dstBuf);
     void CalculateBuffSize(size_t& dstBuffSize);
+
+    struct RemapAxes {
+        std::vector<int32_t> colMap;
+        std::vector<int32_t> rowMap;
+        bool isTransposed = false;
+    };
+    // One axis of the rotate letterbox, crop and nearest scale chain, from output samples back to source ones.
+    struct AxisMapping {
+        int32_t crop;
+        int32_t cropSize;
+        int32_t paste;
+        int32_t start;
+        int32_t size;
+        int32_t limit;
+        bool isReversed;
+    };
+    int32_t FusedRotateScale(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo);
+    void BuildFusedAxes(int32_t width, int32_t height);
+    void BuildRemapAxes(int32_t width, int32_t height, int32_t ratio, RemapAxes& axes);
+    static void BuildAxisMap(const AxisMapping& mapping, int32_t dstSize, std::vector<int32_t>& map);
+    static int32_t ScaleIndex(int32_t index, int32_t srcSize, int32_t dstSize);
+    static bool GetCropSize(int32_t srcWidth, int32_t srcHeight, int32_t dstWidth, int32_t dstHeight,
+        int32_t& cropWidth, int32_t& cropHeight);
+    static void GetChromaPlanes(uint8_t *chroma, Videoformat format, int32_t width, int32_t height,
+        uint8_t *planes[], int32_t& stride, int32_t& pixelStride);
 #endif
     AVPixelFormat GetAVPixelFormat(Videoformat colorFormat);
     int32_t ConvertDone(std::vector<std::shared_ptr<DataBuffer>>& outputBuffers);
@@ -91,7 +133,13 @@ private:
     constexpr static int32_t YUV_BYTES_PER_PIXEL = 3;
     constexpr static int32_t Y2UV_RATIO = 2;
     constexpr static int32_t RGB32_MEMORY_COEFFICIENT = 4;
+    constexpr static int32_t P010_BYTES_PER_SAMPLE = 2;
     constexpr static uint32_t MEMORY_RATIO_UV = 1;
+    constexpr static int32_t FIXED_POINT_SHIFT = 16;
+    constexpr static int32_t ROTATION_0 = 0;
+    constexpr static int32_t ROTATION_90 = 90;
+    constexpr static int32_t ROTATION_180 = 180;
+    constexpr static int32_t ROTATION_270 = 270;
 
 #ifdef DCAMERA_SUPPORT_FFMPEG
     uint8_t *srcData_[DATA_LEN] = { nullptr };
@@ -101,6 +149,9 @@ private:
     int32_t dstBuffSize_ = 0;
 #endif
     SwsContext *swsContext_ = nullptr;
+    // Picked at init from the source colour space.
+    const YuvToRgbTable *rgbTable_ = nullptr;
+    std::unique_ptr<IScaleConvertBackend> backend_;
     std::mutex scaleMutex_;
     VideoConfigParams sourceConfig_;
     VideoConfigParams targetConfig_;
@@ -108,6 +159,15 @@ private:
     std::weak_ptr<DCameraPipelineSource> callbackPipelineSource_;
     std::atomic<bool> isScaleConvert_ = false;
     FILE *dumpFile_ = nullptr;
+#ifndef DCAMERA_SUPPORT_FFMPEG
+    bool isFusedRotate_ = false;
+    int32_t fusedAngle_ = ROTATION_0;
+    // The maps follow the frame size, the output size only changes through UpdateConfig.
+    int32_t fusedWidth_ = 0;
+    int32_t fusedHeight_ = 0;
+    RemapAxes fusedLumaAxes_;
+    RemapAxes fusedChromaAxes_;
+#endif
 };
 } // namespace DistributedHardware
 } // namespace OHOS
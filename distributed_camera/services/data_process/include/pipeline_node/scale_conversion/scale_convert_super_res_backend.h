@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_SCALE_CONVERT_SUPER_RES_BACKEND_H
+#define OHOS_SCALE_CONVERT_SUPER_RES_BACKEND_H
+
+#include <mutex>
+
+#include "scale_convert_blit_backend.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+extern "C" {
+typedef void *(*DCameraSuperResCreateFunc)(const DCameraBlitImage *src, const DCameraBlitImage *dst);
+typedef int32_t (*DCameraSuperResProcessFunc)(void *context, const DCameraBlitImage *src, DCameraBlitImage *dst);
+typedef void (*DCameraSuperResDestroyFunc)(void *context);
+}
+
+/*
+ * Upscales decoded frames with the super resolution engine of the device (NPU or GPU), reached through an
+ * optional vendor library. Each frame has to fit the latency budget: once the average cost of a window is over
+ * it, or the engine fails a frame, the frame goes to the fallback backend and then to the CPU path of
+ * ScaleConvertProcess. An engine over budget stays off until the node is configured again.
+ */
+class ScaleConvertSuperResBackend : public IScaleConvertBackend {
+public:
+    ScaleConvertSuperResBackend() = default;
+    ~ScaleConvertSuperResBackend() override;
+
+    static bool IsUpscale(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig);
+
+    int32_t Init(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig) override;
+    int32_t Convert(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo) override;
+    void Release() override;
+    // Takes the frames the engine does not, nullptr leaves them to the CPU path.
+    void SetFallback(std::unique_ptr<IScaleConvertBackend> fallback);
+
+private:
+    bool LoadLibrary();
+    int32_t Upscale(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo);
+    // Returns false once the window average is over the budget.
+    bool OnFrameCost(int64_t costUs);
+    static int64_t GetBudgetUs(const VideoConfigParams& sourceConfig);
+    static DCameraBlitImage ToImage(const ImageUnitInfo& imgInfo);
+
+    constexpr static const char *SUPER_RES_LIB_PATH = "libdcamera_super_res_ext.z.so";
+    constexpr static const char *SUPER_RES_CREATE_FUNC = "DCameraSuperResCreate";
+    constexpr static const char *SUPER_RES_PROCESS_FUNC = "DCameraSuperResProcess";
+    constexpr static const char *SUPER_RES_DESTROY_FUNC = "DCameraSuperResDestroy";
+    constexpr static const char *SUPER_RES_BUDGET_PARA = "sys.dcamera.source.superres.budget.us";
+    constexpr static int64_t US_PER_SECOND = 1000000;
+    constexpr static int32_t DEFAULT_FRAME_RATE = 30;
+    // Without a configured budget the engine may take half a frame interval, the rest is left to the consumer.
+    constexpr static int64_t BUDGET_FRAME_DIVISOR = 2;
+    constexpr static uint32_t BUDGET_WINDOW_FRAMES = 30;
+
+    std::mutex superResMutex_;
+    void *dlHandler_ = nullptr;
+    void *context_ = nullptr;
+    DCameraSuperResCreateFunc createFunc_ = nullptr;
+    DCameraSuperResProcessFunc processFunc_ = nullptr;
+    DCameraSuperResDestroyFunc destroyFunc_ = nullptr;
+    std::unique_ptr<IScaleConvertBackend> fallback_;
+    bool isOverBudget_ = false;
+    int64_t budgetUs_ = 0;
+    int64_t windowCostUs_ = 0;
+    uint32_t windowFrames_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_SCALE_CONVERT_SUPER_RES_BACKEND_H
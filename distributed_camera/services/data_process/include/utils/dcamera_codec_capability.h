@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_CODEC_CAPABILITY_H
+#define OHOS_DCAMERA_CODEC_CAPABILITY_H
+
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "dhfwk_single_instance.h"
+#include "image_common_type.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+struct VideoCapabilityBounds {
+    int32_t maxWidth = 0;
+    int32_t maxHeight = 0;
+    int32_t maxFrameRate = 0;
+    // Long term reference frames the encoder can keep, 0 when it has no such feature.
+    int32_t maxLtrFrameCount = 0;
+    // VideoPixelFormat values the codec reads or writes, empty when it could not be queried.
+    std::vector<int32_t> pixelFormats;
+    // Profile values of the codec mime, empty when it could not be queried.
+    std::vector<int32_t> profiles;
+};
+
+/*
+ * Upper bounds of the local hardware codecs, queried once per codec and direction. The pipelines validate
+ * the negotiated configs against these instead of fixed 30 fps limits, the defaults remain the floor and are
+ * used alone when the codec cannot be queried or the stream is not encoded.
+ */
+class DCameraCodecCapability {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraCodecCapability);
+public:
+    VideoCapabilityBounds GetBounds(const VideoCodecType codecType, const bool isEncoder,
+        const VideoCapabilityBounds& defaults);
+    static bool IsInBounds(const VideoConfigParams& config, const VideoCapabilityBounds& bounds,
+        const int32_t minWidth, const int32_t minHeight, const int32_t minFrameRate);
+
+    constexpr static int32_t MAX_WIDTH_LIMIT = 8192;
+    constexpr static int32_t MAX_HEIGHT_LIMIT = 8192;
+    constexpr static int32_t MAX_FRAME_RATE_LIMIT = 240;
+    constexpr static const char *MAX_LTR_FRAME_COUNT_KEY = "feature_property_video_encoder_max_ltr_frame_count";
+
+private:
+    DCameraCodecCapability() = default;
+    ~DCameraCodecCapability() = default;
+    bool QueryBounds(const VideoCodecType codecType, const bool isEncoder, VideoCapabilityBounds& bounds);
+
+    std::mutex mutex_;
+    std::map<std::pair<VideoCodecType, bool>, VideoCapabilityBounds> boundsCache_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_CODEC_CAPABILITY_H
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_CODEC_POOL_H
+#define OHOS_DCAMERA_CODEC_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "avcodec_video_decoder.h"
+#include "avcodec_video_encoder.h"
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Video codecs this process keeps after a capture session stops, so the next session with the same mime type
+ * and resolution class skips creating one. A returned codec is reset to the initialized state, the borrower
+ * sets its own callback and format again. Parked codecs are released once idle for the timeout read from
+ * IDLE_TIMEOUT_PARA, a timeout of 0 turns the pool off.
+ */
+class DCameraCodecPool {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraCodecPool);
+public:
+    std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> AcquireDecoder(const std::string& mime,
+        const int32_t width, const int32_t height);
+    void ReturnDecoder(const std::string& mime, const int32_t width, const int32_t height,
+        std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder>& decoder);
+    std::shared_ptr<MediaAVCodec::AVCodecVideoEncoder> AcquireEncoder(const std::string& mime,
+        const int32_t width, const int32_t height);
+    void ReturnEncoder(const std::string& mime, const int32_t width, const int32_t height,
+        std::shared_ptr<MediaAVCodec::AVCodecVideoEncoder>& encoder);
+    void ReleaseIdleCodecs();
+    size_t GetIdleCount();
+    static int32_t GetResolutionClass(const int32_t width, const int32_t height);
+
+    constexpr static const char *IDLE_TIMEOUT_PARA = "sys.dcamera.codec.pool.idle.ms";
+    constexpr static int32_t DEFAULT_IDLE_TIMEOUT_MS = 5000;
+    constexpr static size_t MAX_IDLE_PER_KEY = 1;
+    constexpr static size_t MAX_IDLE_CODECS = 4;
+
+private:
+    DCameraCodecPool() = default;
+    ~DCameraCodecPool();
+
+    // Mime type and resolution class.
+    using PoolKey = std::pair<std::string, int32_t>;
+    template <typename T>
+    struct IdleCodec {
+        std::shared_ptr<T> codec;
+        int64_t idleSinceMs = 0;
+    };
+    template <typename T>
+    using IdleMap = std::map<PoolKey, std::vector<IdleCodec<T>>>;
+
+    template <typename T>
+    std::shared_ptr<T> Take(IdleMap<T>& idleMap, const PoolKey& key);
+    template <typename T>
+    bool Park(IdleMap<T>& idleMap, const PoolKey& key, const std::shared_ptr<T>& codec, const int32_t timeoutMs);
+    template <typename T>
+    void CollectExpired(IdleMap<T>& idleMap, const int64_t nowMs, std::vector<std::shared_ptr<T>>& expired);
+    template <typename T>
+    int64_t NextExpiryMs(const IdleMap<T>& idleMap, const int64_t earliestMs);
+    static int32_t GetIdleTimeoutMs();
+    void StartEvictLocked();
+    void EvictLoop();
+
+    std::mutex mutex_;
+    std::condition_variable evictCond_;
+    std::thread evictThread_;
+    bool isEvicting_ = false;
+    bool isStopping_ = false;
+    int32_t idleTimeoutMs_ = DEFAULT_IDLE_TIMEOUT_MS;
+    size_t idleCount_ = 0;
+    IdleMap<MediaAVCodec::AVCodecVideoDecoder> idleDecoders_;
+    IdleMap<MediaAVCodec::AVCodecVideoEncoder> idleEncoders_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_CODEC_POOL_H
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_DECODER_ARBITER_H
+#define OHOS_DCAMERA_DECODER_ARBITER_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "avcodec_video_decoder.h"
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+// Lower values win the hardware decoders.
+enum class DCameraDecodePriority : int32_t {
+    FOREGROUND = 0,
+    BACKGROUND = 1,
+};
+
+enum class DCameraDecoderGrant : int32_t {
+    HARDWARE = 0,
+    SOFTWARE = 1,
+};
+
+/*
+ * Hardware decoder instances of this process and their load in pixels per second. A stream that does not fit
+ * is granted a software decoder instead of failing, and lower priority streams holding hardware are asked once
+ * to step down, so the next session of the waiting stream fits again. Streams are keyed by their stream key,
+ * a priority set for a key applies to its current and later decoders.
+ */
+class DCameraDecoderArbiter {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraDecoderArbiter);
+public:
+    using StepDownCallback = std::function<void()>;
+
+    DCameraDecoderGrant Acquire(const std::string& streamKey, int64_t load, const StepDownCallback& stepDown);
+    // The granted hardware decoder could not be created, the stream decodes in software.
+    void OnHardwareUnavailable(const std::string& streamKey);
+    void Release(const std::string& streamKey);
+    void SetStreamPriority(const std::string& streamKey, DCameraDecodePriority priority);
+    size_t GetHardwareCount();
+    static int64_t GetLoad(int32_t width, int32_t height, int32_t frameRate);
+    static std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> CreateSoftwareDecoder(const std::string& mime);
+
+    constexpr static const char *MAX_HW_DECODERS_PARA = "sys.dcamera.decoder.hw.max";
+    constexpr static const char *MAX_HW_LOAD_PARA = "sys.dcamera.decoder.hw.load.mpps";
+    constexpr static int32_t DEFAULT_MAX_HW_DECODERS = 4;
+    // Four 1080p streams at 30 fps, in megapixels per second.
+    constexpr static int32_t DEFAULT_MAX_HW_LOAD_MPPS = 249;
+    constexpr static size_t MAX_PRIORITY_ENTRIES = 32;
+
+private:
+    DCameraDecoderArbiter() = default;
+    ~DCameraDecoderArbiter() = default;
+
+    struct DecoderEntry {
+        DCameraDecodePriority priority = DCameraDecodePriority::FOREGROUND;
+        int64_t load = 0;
+        bool isHardware = false;
+        bool isStepDownRequested = false;
+        StepDownCallback stepDown;
+    };
+
+    DCameraDecodePriority GetPriorityLocked(const std::string& streamKey);
+    static int32_t GetMaxHardwareDecoders();
+    static int64_t GetMaxHardwareLoad();
+
+    std::mutex mutex_;
+    std::map<std::string, DecoderEntry> decoders_;
+    std::map<std::string, DCameraDecodePriority> priorities_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_DECODER_ARBITER_H
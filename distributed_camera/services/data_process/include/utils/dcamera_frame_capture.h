@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_FRAME_CAPTURE_H
+#define OHOS_DCAMERA_FRAME_CAPTURE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "data_buffer.h"
+#include "idata_process_pipeline.h"
+#include "image_common_type.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * A capture file is one DCameraCaptureFileHeader and then one DCameraCaptureFrameHeader per frame, each followed
+ * by the encoded frame as the source pipeline received it. Fields are in host byte order, a capture is replayed on
+ * a device of the same architecture.
+ */
+struct DCameraCaptureFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    int32_t sourceCodec;
+    int32_t sourceFormat;
+    int32_t sourceFrameRate;
+    int32_t sourceWidth;
+    int32_t sourceHeight;
+    int32_t targetCodec;
+    int32_t targetFormat;
+    int32_t targetFrameRate;
+    int32_t targetWidth;
+    int32_t targetHeight;
+    int32_t targetRotation;
+    uint8_t sourceEis;
+    uint8_t targetSystemSwitch;
+    uint8_t reserved[2];
+};
+
+constexpr size_t DCAMERA_CAPTURE_TIME_POINT_NUM = 10;
+
+struct DCameraCaptureFrameHeader {
+    uint32_t magic;
+    uint32_t size;
+    // When the frame reached the source pipeline, replay paces the frames by it.
+    int64_t recordTimeUs;
+    int64_t pts;
+    int64_t rawTime;
+    // DCameraFrameProcessTimePoint in declaration order.
+    int64_t timePoints[DCAMERA_CAPTURE_TIME_POINT_NUM];
+    int32_t index;
+    int32_t offset;
+    int32_t type;
+    int32_t reserved;
+};
+
+// Records the frames fed to a source pipeline, every call is safe against the others.
+class DCameraFrameCaptureWriter {
+public:
+    ~DCameraFrameCaptureWriter();
+    int32_t Open(const std::string& path, const VideoConfigParams& sourceConfig,
+        const VideoConfigParams& targetConfig);
+    int32_t Write(const std::shared_ptr<DataBuffer>& buffer);
+    void Close();
+    bool IsOpened();
+
+private:
+    std::mutex fileMutex_;
+    FILE *file_ = nullptr;
+};
+
+class DCameraFrameCaptureReader {
+public:
+    ~DCameraFrameCaptureReader();
+    int32_t Open(const std::string& path);
+    // Returns DCAMERA_NOT_FOUND once every frame was read.
+    int32_t ReadFrame(std::shared_ptr<DataBuffer>& buffer, int64_t& recordTimeUs);
+    void Close();
+    const VideoConfigParams& GetSourceConfig() const;
+    const VideoConfigParams& GetTargetConfig() const;
+
+private:
+    FILE *file_ = nullptr;
+    VideoConfigParams sourceConfig_;
+    VideoConfigParams targetConfig_;
+};
+
+/*
+ * Feeds a capture back into a pipeline created from its configs. A speed of 1 keeps the recorded gaps between
+ * frames, 2 halves them and 0 feeds the frames back to back.
+ */
+class DCameraFrameReplayer {
+public:
+    static int32_t Replay(DCameraFrameCaptureReader& reader, const std::shared_ptr<IDataProcessPipeline>& pipeline,
+        double speed, uint32_t& fedCount);
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_FRAME_CAPTURE_H
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_NODE_STATS_H
+#define OHOS_DCAMERA_NODE_STATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+class IDataProcessPipeline;
+
+// Snapshot of the counters of one pipeline node, times are totals in microseconds.
+struct DCameraNodeStatsInfo {
+    std::string nodeName;
+    size_t nodeRank = 0;
+    uint64_t framesIn = 0;
+    uint64_t framesOut = 0;
+    uint64_t framesDropped = 0;
+    uint64_t queueDepth = 0;
+    uint64_t availableSlots = 0;
+    uint64_t waitTimeUs = 0;
+    uint64_t processTimeUs = 0;
+    uint64_t bytesAllocated = 0;
+};
+
+/*
+ * Counters and gauges a node updates on its frame path. Every update is a single relaxed atomic, readers get a
+ * snapshot that may mix frames but never blocks the node.
+ */
+class DCameraNodeStats {
+public:
+    void OnFramesIn(size_t count)
+    {
+        framesIn_.fetch_add(count, std::memory_order_relaxed);
+    }
+    void OnFramesOut(size_t count)
+    {
+        framesOut_.fetch_add(count, std::memory_order_relaxed);
+    }
+    void OnFramesDropped(size_t count)
+    {
+        framesDropped_.fetch_add(count, std::memory_order_relaxed);
+    }
+    void SetQueueDepth(size_t depth)
+    {
+        queueDepth_.store(depth, std::memory_order_relaxed);
+    }
+    void SetAvailableSlots(size_t slots)
+    {
+        availableSlots_.store(slots, std::memory_order_relaxed);
+    }
+    void AddWaitTime(int64_t timeUs)
+    {
+        if (timeUs > 0) {
+            waitTimeUs_.fetch_add(static_cast<uint64_t>(timeUs), std::memory_order_relaxed);
+        }
+    }
+    void AddProcessTime(int64_t timeUs)
+    {
+        if (timeUs > 0) {
+            processTimeUs_.fetch_add(static_cast<uint64_t>(timeUs), std::memory_order_relaxed);
+        }
+    }
+    void AddBytesAllocated(size_t bytes)
+    {
+        bytesAllocated_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+    void GetInfo(DCameraNodeStatsInfo& info) const;
+    void Reset();
+
+private:
+    std::atomic<uint64_t> framesIn_ {0};
+    std::atomic<uint64_t> framesOut_ {0};
+    std::atomic<uint64_t> framesDropped_ {0};
+    std::atomic<uint64_t> queueDepth_ {0};
+    std::atomic<uint64_t> availableSlots_ {0};
+    std::atomic<uint64_t> waitTimeUs_ {0};
+    std::atomic<uint64_t> processTimeUs_ {0};
+    std::atomic<uint64_t> bytesAllocated_ {0};
+};
+
+// Counts the frames handed to one ProcessData call and adds the time spent in it to the node.
+class DCameraNodeStatsScope {
+public:
+    DCameraNodeStatsScope(DCameraNodeStats& stats, size_t frameCount);
+    ~DCameraNodeStatsScope();
+    DCameraNodeStatsScope(const DCameraNodeStatsScope&) = delete;
+    DCameraNodeStatsScope& operator=(const DCameraNodeStatsScope&) = delete;
+
+private:
+    DCameraNodeStats& stats_;
+    int64_t startUs_;
+};
+
+void DumpNodeStats(const std::vector<DCameraNodeStatsInfo>& nodeStats, std::string& result);
+
+/*
+ * Pipelines of this process that can be dumped. A pipeline registers once its nodes are linked and unregisters
+ * before it tears them down, a dump holds the registry lock while it reads so the nodes stay alive meanwhile.
+ */
+class DCameraPipelineStatsRegistry {
+FWK_DECLARE_SINGLE_INSTANCE_BASE(DCameraPipelineStatsRegistry);
+
+public:
+    void Register(const std::string& name, const std::shared_ptr<IDataProcessPipeline>& pipeline);
+    void Unregister(const IDataProcessPipeline *pipeline);
+    void Dump(std::string& result);
+
+private:
+    DCameraPipelineStatsRegistry() = default;
+    ~DCameraPipelineStatsRegistry() = default;
+
+    struct PipelineEntry {
+        std::string name;
+        std::weak_ptr<IDataProcessPipeline> pipeline;
+    };
+
+    std::mutex pipelineMutex_;
+    std::map<const IDataProcessPipeline *, PipelineEntry> pipelines_;
+    uint32_t nextId_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_NODE_STATS_H
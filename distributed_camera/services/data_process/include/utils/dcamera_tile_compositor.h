@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_TILE_COMPOSITOR_H
+#define OHOS_DCAMERA_TILE_COMPOSITOR_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "data_buffer.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+// Window of the canvas one remote camera is drawn into, all values even.
+struct DCameraTilePlacement {
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t width = 0;
+    int32_t height = 0;
+};
+
+/*
+ * Tiles the decoded streams of several remote cameras into one NV12/NV21 canvas for a single HDI stream.
+ * Each tile pipeline is created with its placement size as target, so submitted frames are copied and
+ * never scaled here. Composing runs on one frame clock: every tick stamps the canvas with the tick time,
+ * redraws only the tiles that got a frame since the last tick and blanks tiles that stayed silent for
+ * STALE_TILE_US. The canvas is reused, the caller consumes it before the next Compose.
+ */
+class DCameraTileCompositor {
+public:
+    int32_t Init(int32_t canvasWidth, int32_t canvasHeight, int32_t frameRate);
+    int32_t SetTile(const std::string& tileId, const DCameraTilePlacement& placement);
+    int32_t RemoveTile(const std::string& tileId);
+    int32_t SubmitFrame(const std::string& tileId, const std::shared_ptr<DataBuffer>& frame, int32_t width,
+        int32_t height);
+    int32_t Compose(int64_t nowUs, std::shared_ptr<DataBuffer>& canvas);
+    int64_t GetNextTickUs();
+    static DCameraTilePlacement GetGridPlacement(int32_t index, int32_t count, int32_t canvasWidth,
+        int32_t canvasHeight);
+
+    constexpr static int32_t MAX_TILE_COUNT = 9;
+    constexpr static int64_t STALE_TILE_US = 1000000;
+
+private:
+    struct TileState {
+        DCameraTilePlacement placement;
+        std::shared_ptr<DataBuffer> pending;
+        int64_t lastFrameUs = 0;
+        bool isBlank = false;
+    };
+
+    bool IsInCanvas(const DCameraTilePlacement& placement) const;
+    void DrawTile(const DCameraTilePlacement& placement, const uint8_t *frame);
+    void FillTile(const DCameraTilePlacement& placement);
+
+    constexpr static int64_t US_PER_SECOND = 1000000;
+    constexpr static uint8_t BLACK_LUMA = 16;
+    constexpr static uint8_t BLACK_CHROMA = 128;
+
+    std::mutex mutex_;
+    int32_t canvasWidth_ = 0;
+    int32_t canvasHeight_ = 0;
+    int64_t frameIntervalUs_ = 0;
+    int64_t nextTickUs_ = 0;
+    std::shared_ptr<DataBuffer> canvas_;
+    std::map<std::string, TileState> tiles_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_TILE_COMPOSITOR_H
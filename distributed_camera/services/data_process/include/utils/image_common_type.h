@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -42,6 +42,20 @@ enum class Videoformat : int32_t {
     P010 = 4,
 };
 
+enum class VideoColorSpace : int32_t {
+    BT601_LIMITED = 0,
+    BT601_FULL = 1,
+    BT709_LIMITED = 2,
+    BT709_FULL = 3,
+};
+
+// BT.2020 transfer of a P010 stream, the values match DCameraHdrType.
+enum class VideoHdrType : int32_t {
+    NONE = 0,
+    HLG = 1,
+    PQ = 2,
+};
+
 class VideoConfigParams {
 public:
     VideoConfigParams() : videoCodec_(VideoCodecType::NO_CODEC), pixelFormat_(Videoformat::YUVI420),
@@ -67,6 +81,8 @@ public:
     void SetFrameRate(int32_t frameRate);
     void SetWidthAndHeight(int32_t width, int32_t height);
     void SetSystemSwitchFlagAndRotation(bool flag, int32_t rotation);
+    void SetColorSpace(VideoColorSpace colorSpace);
+    void SetHdrType(VideoHdrType hdrType);
     VideoCodecType GetVideoCodecType() const;
     Videoformat GetVideoformat() const;
     int32_t GetFrameRate() const;
@@ -75,6 +91,8 @@ public:
     bool GetIsSystemSwitch() const;
     int32_t GetRotation() const;
     bool GetEis() const;
+    VideoColorSpace GetColorSpace() const;
+    VideoHdrType GetHdrType() const;
 
 private:
     VideoCodecType videoCodec_;
@@ -85,6 +103,8 @@ private:
     bool isSystemSwitch_ = false;
     int32_t rotation_ = 0;
     bool eis_ = false;
+    VideoColorSpace colorSpace_ = VideoColorSpace::BT601_LIMITED;
+    VideoHdrType hdrType_ = VideoHdrType::NONE;
 };
 
 struct ImageUnitInfo {
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_IMAGE_PLANE_KERNELS_H
+#define OHOS_IMAGE_PLANE_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Plane level copy, (de)interleave and rotate kernels shared by the pipeline nodes. The row kernels are
+ * picked once at runtime (NEON, AVX2, SSE2 or scalar). Widths and heights are in samples of the plane.
+ */
+class ImagePlaneKernels {
+public:
+    static void CopyPlane(const uint8_t *src, int32_t srcStride, uint8_t *dst, int32_t dstStride, int32_t width,
+        int32_t height);
+    static void SplitUVPlane(const uint8_t *srcUV, int32_t srcStrideUV, uint8_t *dstU, int32_t dstStrideU,
+        uint8_t *dstV, int32_t dstStrideV, int32_t width, int32_t height);
+    static void MergeUVPlane(const uint8_t *srcU, int32_t srcStrideU, const uint8_t *srcV, int32_t srcStrideV,
+        uint8_t *dstUV, int32_t dstStrideUV, int32_t width, int32_t height);
+    static void SwapPlanes(uint8_t *planeA, uint8_t *planeB, size_t size);
+    static int32_t RotatePlane(const uint8_t *src, int32_t srcStride, uint8_t *dst, int32_t dstStride, int32_t width,
+        int32_t height, int32_t degrees);
+    static int32_t NV12ToI420(const uint8_t *srcY, int32_t srcStrideY, const uint8_t *srcUV, int32_t srcStrideUV,
+        uint8_t *dstY, int32_t dstStrideY, uint8_t *dstU, int32_t dstStrideU, uint8_t *dstV, int32_t dstStrideV,
+        int32_t width, int32_t height);
+    /* Copy a window of a tightly packed YUV 4:2:0 image, I420 or (isSemiPlanar) NV12/NV21. */
+    static int32_t CropYUV420(const uint8_t *src, int32_t srcWidth, int32_t srcHeight, uint8_t *dst,
+        int32_t dstWidth, int32_t dstHeight, int32_t offsetX, int32_t offsetY, bool isSemiPlanar);
+    /*
+     * Nearest sample remap through separable maps: dst(x, y) takes src(colMap[x], rowMap[y]), transposed it takes
+     * the source row colMap[x] and column rowMap[y]. A negative map entry writes fillValue. The pixel strides step
+     * over interleaved chroma, so one call reads or writes either the U or the V samples of an NV12 plane.
+     */
+    static int32_t RemapPlane(const uint8_t *src, int32_t srcStride, int32_t srcPixelStride, uint8_t *dst,
+        int32_t dstStride, int32_t dstPixelStride, const int32_t *colMap, int32_t width, const int32_t *rowMap,
+        int32_t height, bool isTransposed, uint8_t fillValue);
+    static const char *GetIsaName();
+
+private:
+    static void TransposePlane(const uint8_t *src, int32_t srcStride, uint8_t *dst, int32_t dstStride,
+        int32_t width, int32_t height, bool clockwise);
+
+    constexpr static int32_t ROTATION_0 = 0;
+    constexpr static int32_t ROTATION_90 = 90;
+    constexpr static int32_t ROTATION_180 = 180;
+    constexpr static int32_t ROTATION_270 = 270;
+    constexpr static int32_t TRANSPOSE_TILE = 8;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_IMAGE_PLANE_KERNELS_H
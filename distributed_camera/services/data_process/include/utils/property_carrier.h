@@ -16,6 +16,9 @@
 #ifndef OHOS_PROPERTY_CARRIER_H
 #define OHOS_PROPERTY_CARRIER_H
 
+#include <vector>
+
+#include "dcamera_node_stats.h"
 #include "distributed_hardware_log.h"
 #include "distributed_camera_errno.h"
 #include "surface.h"
@@ -23,13 +26,16 @@
 namespace OHOS {
 namespace DistributedHardware {
 static const std::string SURFACE = "surface";
+static const std::string PIPELINE_STATS = "pipelineStats";
 class PropertyCarrier {
 public:
     ~PropertyCarrier();
 
     int32_t CarrySurfaceProperty(sptr<Surface>& surface);
+    void CarryNodeStats(const DCameraNodeStatsInfo& info);
 public:
     sptr<Surface> surface_;
+    std::vector<DCameraNodeStatsInfo> nodeStats_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_YUV_COLOR_KERNELS_H
+#define OHOS_YUV_COLOR_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "image_common_type.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr size_t YUV_TABLE_SIZE = 256;
+
+/*
+ * 16.16 fixed point contribution of every 8-bit sample to the RGB channels of one colour space. The luma entry
+ * carries the rounding, a channel is the sum of its entries shifted down and clamped.
+ */
+struct YuvToRgbTable {
+    int32_t y[YUV_TABLE_SIZE];
+    int32_t rv[YUV_TABLE_SIZE];
+    int32_t gu[YUV_TABLE_SIZE];
+    int32_t gv[YUV_TABLE_SIZE];
+    int32_t bu[YUV_TABLE_SIZE];
+};
+
+/*
+ * Dedicated kernels for the fixed set of colour conversions of the pipeline: I420 and NV12/NV21 to RGBA_8888
+ * (R, G, B, A in memory), I420 to P010 (little endian, ten bits in the high bits) and the chroma order swap of
+ * NV12 <-> NV21 and of P010. The tables
+ * are built once per colour space, a node picks its table at init. Strides are in bytes, sizes in luma pixels.
+ */
+class YuvColorKernels {
+public:
+    static const YuvToRgbTable &GetYuvToRgbTable(VideoColorSpace colorSpace);
+    static int32_t I420ToRGBA(const uint8_t *srcY, int32_t srcStrideY, const uint8_t *srcU, int32_t srcStrideU,
+        const uint8_t *srcV, int32_t srcStrideV, uint8_t *dstRGBA, int32_t dstStrideRGBA, int32_t width,
+        int32_t height, const YuvToRgbTable &table);
+    static int32_t NV12ToRGBA(const uint8_t *srcY, int32_t srcStrideY, const uint8_t *srcUV, int32_t srcStrideUV,
+        uint8_t *dstRGBA, int32_t dstStrideRGBA, int32_t width, int32_t height, const YuvToRgbTable &table,
+        bool isVUOrder);
+    static int32_t I420ToP010(const uint8_t *srcY, int32_t srcStrideY, const uint8_t *srcU, int32_t srcStrideU,
+        const uint8_t *srcV, int32_t srcStrideV, uint8_t *dstY, int32_t dstStrideY, uint8_t *dstUV,
+        int32_t dstStrideUV, int32_t width, int32_t height);
+    static int32_t SwapUVOrder(const uint8_t *srcUV, int32_t srcStrideUV, uint8_t *dstUV, int32_t dstStrideUV,
+        int32_t width, int32_t height);
+    static int32_t SwapP010UVOrder(const uint8_t *srcUV, int32_t srcStrideUV, uint8_t *dstUV, int32_t dstStrideUV,
+        int32_t width, int32_t height);
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_YUV_COLOR_KERNELS_H
@@ -33,5 +33,51 @@ void AbstractDataProcess::SetNodeRank(size_t curNodeRank)
 {
     nodeRank_ = curNodeRank;
 }
+
+DCameraNodeStats& AbstractDataProcess::GetNodeStats()
+{
+    return stats_;
+}
+
+void AbstractDataProcess::CarryNodeStats(PropertyCarrier& propertyCarrier)
+{
+    DCameraNodeStatsInfo info;
+    stats_.GetInfo(info);
+    info.nodeName = GetNodeName();
+    info.nodeRank = nodeRank_;
+    propertyCarrier.CarryNodeStats(info);
+}
+
+void AbstractDataProcess::SetDropCounter(const std::shared_ptr<DCameraStreamDropCounter>& dropCounter)
+{
+    dropCounter_ = dropCounter;
+}
+
+void AbstractDataProcess::CountDroppedFrames(DCameraDropReason reason, size_t count)
+{
+    stats_.OnFramesDropped(count);
+    if (dropCounter_ != nullptr) {
+        dropCounter_->Add(reason, count);
+    }
+}
+
+void AbstractDataProcess::SetMemoryAccount(const std::shared_ptr<DCameraMemoryAccount>& memoryAccount)
+{
+    memoryAccount_ = memoryAccount;
+}
+
+bool AbstractDataProcess::IsOverMemoryBudget() const
+{
+    return memoryAccount_ != nullptr && memoryAccount_->IsOverBudget();
+}
+
+void AbstractDataProcess::OnBufferAllocated(const std::shared_ptr<DataBuffer>& buffer, DCameraMemoryOwner owner)
+{
+    if (buffer == nullptr) {
+        return;
+    }
+    stats_.AddBytesAllocated(buffer->Size());
+    buffer->Account(memoryAccount_, owner);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,8 @@
 #include "dcamera_pipeline_sink.h"
 
 #include "dcamera_hitrace_adapter.h"
+#include "dcamera_node_stats.h"
+#include "dcamera_pipeline_stage.h"
 #include "distributed_hardware_log.h"
 
 #include "encode_data_process.h"
@@ -23,6 +25,8 @@
 namespace OHOS {
 namespace DistributedHardware {
 const std::string DCameraPipelineSink::PIPELINE_OWNER = "Sink";
+const std::string DCameraPipelineSink::PIPELINE_STAGE_NAME = "dcamsinkstage";
+const std::string DCameraPipelineSink::SEND_STATS_NAME = "ChannelSend";
 
 DCameraPipelineSink::~DCameraPipelineSink()
 {
@@ -37,9 +41,12 @@ int32_t DCameraPipelineSink::CreateDataProcessPipeline(PipelineType piplineType,
     const std::shared_ptr<DataProcessListener>& listener)
 {
     DCAMERA_SYNC_TRACE(DCAMERA_SINK_CREATE_PIPELINE);
+    DCameraFrameTrace::RefreshSampling();
     DHLOGD("Create sink data process pipeline.");
     switch (piplineType) {
         case PipelineType::VIDEO:
+            bounds_ = DCameraCodecCapability::GetInstance().GetBounds(targetConfig.GetVideoCodecType(), true,
+                { MAX_VIDEO_WIDTH, MAX_VIDEO_HEIGHT, MAX_FRAME_RATE });
             if (!(IsInRange(sourceConfig) && IsInRange(targetConfig))) {
                 DHLOGE("Source config or target config of sink pipeline are invalid.");
                 return DCAMERA_BAD_VALUE;
@@ -66,15 +73,13 @@ int32_t DCameraPipelineSink::CreateDataProcessPipeline(PipelineType piplineType,
     piplineType_ = piplineType;
     processListener_ = listener;
     isProcess_.store(true);
+    DCameraPipelineStatsRegistry::GetInstance().Register("sink", shared_from_this());
     return DCAMERA_OK;
 }
 
 bool DCameraPipelineSink::IsInRange(const VideoConfigParams& curConfig)
 {
-    bool isWidthValid = (curConfig.GetWidth() >= MIN_VIDEO_WIDTH && curConfig.GetWidth() <= MAX_VIDEO_WIDTH);
-    bool isHeightValid = (curConfig.GetHeight() >= MIN_VIDEO_HEIGHT && curConfig.GetHeight() <= MAX_VIDEO_HEIGHT);
-    bool isFrameRateValid = (curConfig.GetFrameRate() >= MIN_FRAME_RATE && curConfig.GetFrameRate() <= MAX_FRAME_RATE);
-    return isWidthValid && isHeightValid && isFrameRateValid;
+    return DCameraCodecCapability::IsInBounds(curConfig, bounds_, MIN_VIDEO_WIDTH, MIN_VIDEO_HEIGHT, MIN_FRAME_RATE);
 }
 
 int32_t DCameraPipelineSink::InitDCameraPipNodes(const VideoConfigParams& sourceConfig,
@@ -93,10 +98,13 @@ int32_t DCameraPipelineSink::InitDCameraPipNodes(const VideoConfigParams& source
         return DCAMERA_BAD_VALUE;
     }
 
+    bool isParallel = DCameraPipelineStage::IsParallelEnabled();
     VideoConfigParams curNodeSourceCfg = sourceConfig;
     for (size_t i = 0; i < pipNodeRanks_.size(); i++) {
         CHECK_AND_RETURN_RET_LOG((pipNodeRanks_[i] == nullptr), DCAMERA_BAD_VALUE, "Node is null.");
         pipNodeRanks_[i]->SetNodeRank(i);
+        pipNodeRanks_[i]->SetDropCounter(dropCounter_);
+        pipNodeRanks_[i]->SetMemoryAccount(memoryAccount_);
 
         VideoConfigParams curNodeProcessedCfg;
         int32_t err = pipNodeRanks_[i]->InitNode(curNodeSourceCfg, targetConfig, curNodeProcessedCfg);
@@ -110,7 +118,15 @@ int32_t DCameraPipelineSink::InitDCameraPipNodes(const VideoConfigParams& source
             continue;
         }
 
-        err = pipNodeRanks_[i - 1]->SetNextNode(pipNodeRanks_[i]);
+        std::shared_ptr<AbstractDataProcess> nextNode = pipNodeRanks_[i];
+        if (isParallel) {
+            auto stage = std::make_shared<DCameraPipelineStage>(pipNodeRanks_[i],
+                PIPELINE_STAGE_NAME + std::to_string(i));
+            CHECK_AND_RETURN_RET_LOG(stage->Start() != DCAMERA_OK, DCAMERA_INIT_ERR,
+                "Start pipeline stage of Node [%{public}zu] failed.", i);
+            nextNode = stage;
+        }
+        err = pipNodeRanks_[i - 1]->SetNextNode(nextNode);
         if (err != DCAMERA_OK) {
             DHLOGE("Set the next node of Node [%{public}zu] failed in sink pipeline.", i - 1);
             return DCAMERA_INIT_ERR;
@@ -152,6 +168,7 @@ void DCameraPipelineSink::DestroyDataProcessPipeline()
 {
     DCAMERA_SYNC_TRACE(DCAMERA_SINK_DESTORY_PIPELINE);
     DHLOGD("Destroy sink data process pipeline start.");
+    DCameraPipelineStatsRegistry::GetInstance().Unregister(this);
     isProcess_.store(false);
     if (pipelineHead_ != nullptr) {
         pipelineHead_->ReleaseProcessNode();
@@ -185,20 +202,86 @@ int32_t DCameraPipelineSink::OnProcessedVideoBuffer(const std::shared_ptr<DataBu
     return processListener_->OnProcessedVideoBuffer(videoResult);
 }
 
+bool DCameraPipelineSink::WaitOutputWritable(int64_t timeoutMs)
+{
+    if (processListener_ == nullptr) {
+        DHLOGE("The process listener of sink pipeline is empty.");
+        return false;
+    }
+    return processListener_->WaitOutputWritable(timeoutMs);
+}
+
+void DCameraPipelineSink::OnChannelSendResult(size_t frameSize, int64_t sendCostUs, int32_t result)
+{
+    bitrateController_->OnFrameSent(frameSize, sendCostUs, result == DCAMERA_OK);
+}
+
+void DCameraPipelineSink::OnLinkCapacity(int64_t bandwidthBps)
+{
+    bitrateController_->SetLinkCapacity(bandwidthBps);
+}
+
+void DCameraPipelineSink::SetBitratePercent(int32_t percent)
+{
+    bitrateController_->SetBitratePercent(percent);
+}
+
+void DCameraPipelineSink::RequestKeyFrame()
+{
+    bitrateController_->RequestKeyFrame();
+}
+
+std::shared_ptr<DCameraBitrateController> DCameraPipelineSink::GetBitrateController() const
+{
+    return bitrateController_;
+}
+
+void DCameraPipelineSink::SetDropCounter(const std::shared_ptr<DCameraStreamDropCounter>& dropCounter)
+{
+    dropCounter_ = dropCounter;
+}
+
+void DCameraPipelineSink::SetMemoryAccount(const std::shared_ptr<DCameraMemoryAccount>& memoryAccount)
+{
+    memoryAccount_ = memoryAccount;
+}
+
+void DCameraPipelineSink::SetSendStats(const std::shared_ptr<DCameraNodeStats>& sendStats)
+{
+    sendStats_ = sendStats;
+}
+
 int32_t DCameraPipelineSink::GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier)
 {
+    if (propertyName == PIPELINE_STATS) {
+        for (auto& cur : pipNodeRanks_) {
+            if (cur != nullptr) {
+                cur->CarryNodeStats(propertyCarrier);
+            }
+        }
+        if (sendStats_ != nullptr) {
+            DCameraNodeStatsInfo info;
+            sendStats_->GetInfo(info);
+            info.nodeName = SEND_STATS_NAME;
+            info.nodeRank = pipNodeRanks_.size();
+            propertyCarrier.CarryNodeStats(info);
+        }
+        return DCAMERA_OK;
+    }
     if (pipelineHead_ == nullptr) {
         DHLOGD("DCameraPipelineSink::GetProperty: pipelineHead is nullptr.");
         return DCAMERA_BAD_VALUE;
     }
-    std::shared_ptr<AbstractDataProcess> cur = pipelineHead_;
-    while (cur) {
+    // Nodes behind a pipeline stage are not reachable through nextDataProcess_, walk the ranks instead.
+    for (auto& cur : pipNodeRanks_) {
+        if (cur == nullptr) {
+            continue;
+        }
         int32_t ret = cur->GetProperty(propertyName, propertyCarrier);
         if (ret != DCAMERA_OK) {
             DHLOGD("DCameraPipelineSink::GetProperty: get dataProcess property fail.");
             return DCAMERA_BAD_VALUE;
         }
-        cur = cur->nextDataProcess_;
     }
     return DCAMERA_OK;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,17 +16,22 @@
 #include "dcamera_pipeline_source.h"
 
 #include "dcamera_hitrace_adapter.h"
+#include "dcamera_utils_tools.h"
+#include "dcamera_node_stats.h"
+#include "dcamera_pipeline_stage.h"
 #include "distributed_hardware_log.h"
 #include "distributed_camera_constants.h"
 #include "decode_data_process.h"
 #include "eis_data_process.h"
 #include "fps_controller_process.h"
+#include "rotate_letterbox_process.h"
 #include "scale_convert_process.h"
-#include <sys/prctl.h>
+#include <future>
 
 namespace OHOS {
 namespace DistributedHardware {
 const std::string DCameraPipelineSource::PIPELINE_OWNER = "Source";
+const std::string DCameraPipelineSource::PIPELINE_STAGE_NAME = "dcamsrcstage";
 
 DCameraPipelineSource::~DCameraPipelineSource()
 {
@@ -41,9 +46,12 @@ int32_t DCameraPipelineSource::CreateDataProcessPipeline(PipelineType piplineTyp
     const std::shared_ptr<DataProcessListener>& listener)
 {
     DCAMERA_SYNC_TRACE(DCAMERA_SOURCE_CREATE_PIPELINE);
+    DCameraFrameTrace::RefreshSampling();
     DHLOGD("Create source data process pipeline.");
     switch (piplineType) {
         case PipelineType::VIDEO:
+            bounds_ = DCameraCodecCapability::GetInstance().GetBounds(sourceConfig.GetVideoCodecType(), false,
+                { MAX_VIDEO_WIDTH, MAX_VIDEO_HEIGHT, MAX_FRAME_RATE });
             if (!(IsInRange(sourceConfig) && IsInRange(targetConfig))) {
                 DHLOGE("Source config or target config of source pipeline are invalid.");
                 return DCAMERA_BAD_VALUE;
@@ -70,46 +78,43 @@ int32_t DCameraPipelineSource::CreateDataProcessPipeline(PipelineType piplineTyp
         return err;
     }
     piplineType_ = piplineType;
+    sourceConfig_ = sourceConfig;
+    targetConfig_ = targetConfig;
     {
         std::unique_lock<std::mutex> lock(listenerMutex_);
         processListener_ = listener;
     }
     isProcess_ = true;
+    OpenFrameCapture(sourceConfig, targetConfig);
+    DCameraPipelineStatsRegistry::GetInstance().Register("source", shared_from_this());
     return DCAMERA_OK;
 }
 
-bool DCameraPipelineSource::IsInRange(const VideoConfigParams& curConfig)
+void DCameraPipelineSource::OpenFrameCapture(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig)
 {
-    bool isWidthValid = (curConfig.GetWidth() >= MIN_VIDEO_WIDTH && curConfig.GetWidth() <= MAX_VIDEO_WIDTH);
-    bool isHeightValid = (curConfig.GetHeight() >= MIN_VIDEO_HEIGHT && curConfig.GetHeight() <= MAX_VIDEO_HEIGHT);
-    bool isFrameRateValid = (curConfig.GetFrameRate() >= MIN_FRAME_RATE && curConfig.GetFrameRate() <= MAX_FRAME_RATE);
-    return isWidthValid && isHeightValid && isFrameRateValid;
+    int32_t enable = 0;
+    // A branch gets decoded frames, only a pipeline that decodes has a bitstream worth replaying.
+    if (!GetSysPara(FRAME_CAPTURE_PARA, enable) || enable != 1 ||
+        sourceConfig.GetVideoCodecType() == VideoCodecType::NO_CODEC) {
+        return;
+    }
+    std::string path = DUMP_SERVICE_DIR + "dump_capture_dcamsource_" + std::to_string(GetNowTimeStampUs()) +
+        ".dcap";
+    int32_t ret = captureWriter_.Open(path, sourceConfig, targetConfig);
+    CHECK_AND_LOG(ret != DCAMERA_OK, "Open frame capture failed, ret %{public}d.", ret);
 }
 
-void DCameraPipelineSource::InitDCameraPipEvent()
+bool DCameraPipelineSource::IsInRange(const VideoConfigParams& curConfig)
 {
-    DHLOGD("Init source DCamera pipeline event to asynchronously process data.");
-    eventThread_ = std::thread([this]() { this->StartEventHandler(); });
-    std::unique_lock<std::mutex> lock(eventMutex_);
-    eventCon_.wait(lock, [this] {
-        return pipeEventHandler_ != nullptr;
-    });
+    return DCameraCodecCapability::IsInBounds(curConfig, bounds_, MIN_VIDEO_WIDTH, MIN_VIDEO_HEIGHT, MIN_FRAME_RATE);
 }
 
-void DCameraPipelineSource::StartEventHandler()
+void DCameraPipelineSource::InitDCameraPipEvent()
 {
-    prctl(PR_SET_NAME, PIPELINE_SRC_EVENT.c_str());
-    auto runner = AppExecFwk::EventRunner::Create(false);
-    if (runner == nullptr) {
-        DHLOGE("Creat runner failed.");
-        return;
-    }
-    {
-        std::lock_guard<std::mutex> lock(eventMutex_);
-        pipeEventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
-    }
-    eventCon_.notify_one();
-    runner->Run();
+    DHLOGD("Init source DCamera pipeline event to asynchronously process data.");
+    std::lock_guard<std::mutex> lock(eventMutex_);
+    pipeEventQueue_ = std::make_shared<DCameraSerialQueue>(PIPELINE_SRC_EVENT, DCAMERA_THREAD_FRAME);
 }
 
 int32_t DCameraPipelineSource::InitDCameraPipNodes(const VideoConfigParams& sourceConfig,
@@ -120,14 +125,23 @@ int32_t DCameraPipelineSource::InitDCameraPipNodes(const VideoConfigParams& sour
         DHLOGE("JPEG data process is not supported.");
         return DCAMERA_NOT_FOUND;
     }
-    if (pipeEventHandler_ == nullptr) {
+    if (pipeEventQueue_ == nullptr) {
         DHLOGE("eventBusSource is nullptr.");
         return DCAMERA_BAD_VALUE;
     }
 
-    pipNodeRanks_.push_back(std::make_shared<DecodeDataProcess>(pipeEventHandler_, shared_from_this()));
+    pipNodeRanks_.push_back(std::make_shared<DecodeDataProcess>(pipeEventQueue_, shared_from_this()));
+#ifndef DCAMERA_SUPPORT_FFMPEG
+    if (targetConfig.GetIsSystemSwitch() &&
+        !ScaleConvertProcess::IsFusedRotateSupported(sourceConfig, targetConfig)) {
+        pipNodeRanks_.push_back(std::make_shared<RotateLetterboxProcess>(shared_from_this()));
+    }
+#endif
+    size_t scaleRank = pipNodeRanks_.size();
     pipNodeRanks_.push_back(std::make_shared<ScaleConvertProcess>(shared_from_this()));
+    VideoConfigParams scaleTargetCfg = targetConfig;
     if (sourceConfig.GetEis()) {
+        scaleTargetCfg = EISDataProcess::GetMarginConfig(targetConfig);
         pipNodeRanks_.push_back(std::make_shared<EISDataProcess>(shared_from_this()));
     }
     if (pipNodeRanks_.size() == 0) {
@@ -136,17 +150,21 @@ int32_t DCameraPipelineSource::InitDCameraPipNodes(const VideoConfigParams& sour
         return DCAMERA_BAD_VALUE;
     }
 
+    bool isParallel = DCameraPipelineStage::IsParallelEnabled();
     VideoConfigParams curNodeSourceCfg = sourceConfig;
     for (size_t i = 0; i < pipNodeRanks_.size(); i++) {
         CHECK_AND_RETURN_RET_LOG((pipNodeRanks_[i] == nullptr), DCAMERA_BAD_VALUE, "Node is null.");
         pipNodeRanks_[i]->SetNodeRank(i);
+        pipNodeRanks_[i]->SetDropCounter(dropCounter_);
+        pipNodeRanks_[i]->SetMemoryAccount(memoryAccount_);
         DHLOGI("DCameraPipelineSource::InitDCameraPipNodes Node %{public}zu Source Config: width %{public}d height "
             "%{public}d format %{public}d codecType %{public}d frameRate %{public}d", i, curNodeSourceCfg.GetWidth(),
             curNodeSourceCfg.GetHeight(), curNodeSourceCfg.GetVideoformat(), curNodeSourceCfg.GetVideoCodecType(),
             curNodeSourceCfg.GetFrameRate());
 
         VideoConfigParams curNodeProcessedCfg;
-        int32_t err = pipNodeRanks_[i]->InitNode(curNodeSourceCfg, targetConfig, curNodeProcessedCfg);
+        int32_t err = pipNodeRanks_[i]->InitNode(curNodeSourceCfg, (i == scaleRank) ? scaleTargetCfg : targetConfig,
+            curNodeProcessedCfg);
         if (err != DCAMERA_OK) {
             DHLOGE("Init source DCamera pipeline Node [%{public}zu] failed.", i);
             return DCAMERA_INIT_ERR;
@@ -154,10 +172,24 @@ int32_t DCameraPipelineSource::InitDCameraPipNodes(const VideoConfigParams& sour
         curNodeSourceCfg = curNodeProcessedCfg;
 
         if (i == 0) {
+            decodedConfig_ = curNodeProcessedCfg;
+            isDirectOutput_ = IsDirectOutput(sourceConfig, targetConfig, curNodeProcessedCfg);
+#ifndef DCAMERA_SUPPORT_FFMPEG
+            isTargetLayoutDecoded_ = (sourceConfig.GetVideoCodecType() != VideoCodecType::NO_CODEC) &&
+                (curNodeProcessedCfg.GetVideoformat() != Videoformat::YUVI420);
+#endif
             continue;
         }
 
-        err = pipNodeRanks_[i - 1]->SetNextNode(pipNodeRanks_[i]);
+        std::shared_ptr<AbstractDataProcess> nextNode = pipNodeRanks_[i];
+        if (isParallel) {
+            auto stage = std::make_shared<DCameraPipelineStage>(pipNodeRanks_[i],
+                PIPELINE_STAGE_NAME + std::to_string(i));
+            CHECK_AND_RETURN_RET_LOG(stage->Start() != DCAMERA_OK, DCAMERA_INIT_ERR,
+                "Start pipeline stage of Node [%{public}zu] failed.", i);
+            nextNode = stage;
+        }
+        err = pipNodeRanks_[i - 1]->SetNextNode(nextNode);
         if (err != DCAMERA_OK) {
             DHLOGE("Set the next node of Node [%{public}zu] failed in source pipeline.", i - 1);
             return DCAMERA_INIT_ERR;
@@ -170,6 +202,107 @@ int32_t DCameraPipelineSource::InitDCameraPipNodes(const VideoConfigParams& sour
     return DCAMERA_OK;
 }
 
+bool DCameraPipelineSource::IsDirectOutput(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig, const VideoConfigParams& decodedConfig)
+{
+    // Decoded frames already match the target, the decoder can write into the consumer memory.
+    return !sourceConfig.GetEis() && !targetConfig.GetIsSystemSwitch() &&
+        (decodedConfig.GetWidth() == targetConfig.GetWidth()) &&
+        (decodedConfig.GetHeight() == targetConfig.GetHeight()) &&
+        (decodedConfig.GetVideoformat() == targetConfig.GetVideoformat());
+}
+
+int32_t DCameraPipelineSource::UpdateConfig(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig)
+{
+    DHLOGI("Update source pipeline config, source %{public}dx%{public}d target %{public}dx%{public}d.",
+        sourceConfig.GetWidth(), sourceConfig.GetHeight(), targetConfig.GetWidth(), targetConfig.GetHeight());
+    if (!isProcess_ || pipelineHead_ == nullptr) {
+        DHLOGE("The source pipeline is not running, update config failed.");
+        return DCAMERA_WRONG_STATE;
+    }
+    if (!IsSameTopology(sourceConfig, targetConfig)) {
+        return DCAMERA_BAD_OPERATE;
+    }
+    if (!(IsInRange(sourceConfig) && IsInRange(targetConfig))) {
+        DHLOGE("Source config or target config of source pipeline are invalid.");
+        return DCAMERA_BAD_VALUE;
+    }
+
+    // Queued behind the frames already handed in, those still decode with the config they were sent for.
+    auto result = std::make_shared<std::promise<int32_t>>();
+    std::future<int32_t> future = result->get_future();
+    auto updateFunc = [this, sourceConfig, targetConfig, result]() {
+        result->set_value(UpdateDCameraPipNodes(sourceConfig, targetConfig));
+    };
+    {
+        std::unique_lock<std::mutex> lock(eventMutex_);
+        CHECK_AND_RETURN_RET_LOG(pipeEventQueue_ == nullptr, DCAMERA_BAD_VALUE, "pipeEventQueue_ is nullptr.");
+        pipeEventQueue_->PostTask(updateFunc);
+    }
+    if (future.wait_for(std::chrono::milliseconds(UPDATE_CONFIG_TIMEOUT_MS)) != std::future_status::ready) {
+        DHLOGE("Update source pipeline config timeout.");
+        return DCAMERA_BAD_OPERATE;
+    }
+    int32_t ret = future.get();
+    if (ret != DCAMERA_OK) {
+        DHLOGE("Update source pipeline nodes failed, ret %{public}d.", ret);
+        return ret;
+    }
+    sourceConfig_ = sourceConfig;
+    targetConfig_ = targetConfig;
+    // A recording holds one source config, frames of another size would not replay.
+    captureWriter_.Close();
+    return DCAMERA_OK;
+}
+
+bool DCameraPipelineSource::IsSameTopology(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig)
+{
+    if (sourceConfig.GetVideoCodecType() != sourceConfig_.GetVideoCodecType() ||
+        sourceConfig.GetVideoformat() != sourceConfig_.GetVideoformat() ||
+        targetConfig.GetVideoCodecType() != targetConfig_.GetVideoCodecType() ||
+        targetConfig.GetVideoformat() != targetConfig_.GetVideoformat() ||
+        targetConfig.GetIsSystemSwitch() != targetConfig_.GetIsSystemSwitch()) {
+        DHLOGI("The new config needs other nodes, the source pipeline is rebuilt.");
+        return false;
+    }
+    // The stabilizer restarts its look ahead on a new size anyway, and stages run nodes off the pipeline thread.
+    if (sourceConfig.GetEis() || sourceConfig_.GetEis() || DCameraPipelineStage::IsParallelEnabled()) {
+        DHLOGI("EIS or parallel stages are on, the source pipeline is rebuilt.");
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(branchMutex_);
+    if (!branches_.empty()) {
+        DHLOGI("Branches take the decoded config, the source pipeline is rebuilt.");
+        return false;
+    }
+    return true;
+}
+
+int32_t DCameraPipelineSource::UpdateDCameraPipNodes(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig)
+{
+    // A node left half updated fails the call, the caller then rebuilds the whole pipeline.
+    VideoConfigParams curNodeSourceCfg = sourceConfig;
+    for (size_t i = 0; i < pipNodeRanks_.size(); i++) {
+        CHECK_AND_RETURN_RET_LOG((pipNodeRanks_[i] == nullptr), DCAMERA_BAD_VALUE, "Node is null.");
+        VideoConfigParams curNodeProcessedCfg;
+        int32_t err = pipNodeRanks_[i]->UpdateConfig(curNodeSourceCfg, targetConfig, curNodeProcessedCfg);
+        if (err != DCAMERA_OK) {
+            DHLOGE("Update source DCamera pipeline Node [%{public}zu] failed, ret %{public}d.", i, err);
+            return err;
+        }
+        curNodeSourceCfg = curNodeProcessedCfg;
+        if (i == 0) {
+            decodedConfig_ = curNodeProcessedCfg;
+            std::unique_lock<std::mutex> lock(listenerMutex_);
+            isDirectOutput_ = IsDirectOutput(sourceConfig, targetConfig, curNodeProcessedCfg);
+        }
+    }
+    return DCAMERA_OK;
+}
+
 int32_t DCameraPipelineSource::ProcessData(std::vector<std::shared_ptr<DataBuffer>>& dataBuffers)
 {
     DHLOGD("Process data buffers in source pipeline.");
@@ -190,6 +323,11 @@ int32_t DCameraPipelineSource::ProcessData(std::vector<std::shared_ptr<DataBuffe
         return DCAMERA_DISABLE_PROCESS;
     }
 
+    if (captureWriter_.IsOpened()) {
+        for (auto& buffer : dataBuffers) {
+            captureWriter_.Write(buffer);
+        }
+    }
     DHLOGI("Send asynchronous event to process data in source pipeline.");
     std::shared_ptr<PipelineConfig> pipConfigSource = std::make_shared<PipelineConfig>(piplineType_,
         PIPELINE_OWNER, dataBuffers);
@@ -204,32 +342,46 @@ int32_t DCameraPipelineSource::ProcessData(std::vector<std::shared_ptr<DataBuffe
         DHLOGD("excute ProcessData ret %{public}d.", ret);
     };
     std::unique_lock<std::mutex> lock(eventMutex_);
-    CHECK_AND_RETURN_RET_LOG(pipeEventHandler_ == nullptr, DCAMERA_BAD_VALUE, "pipeEventHandler_ is nullptr.");
-    pipeEventHandler_->PostTask(sendFunc);
+    CHECK_AND_RETURN_RET_LOG(pipeEventQueue_ == nullptr, DCAMERA_BAD_VALUE, "pipeEventQueue_ is nullptr.");
+    pipeEventQueue_->PostTask(sendFunc);
     return DCAMERA_OK;
 }
 
+std::shared_ptr<DataBuffer> DCameraPipelineSource::AcquireInputBuffer(size_t capacity)
+{
+    std::shared_ptr<AbstractDataProcess> pipelineHead = pipelineHead_;
+    if (!isProcess_ || pipelineHead == nullptr || piplineType_ != PipelineType::VIDEO) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return pipelineHead->AcquireInputBuffer(capacity);
+}
+
 void DCameraPipelineSource::DestroyDataProcessPipeline()
 {
     DCAMERA_SYNC_TRACE(DCAMERA_SOURCE_DESTORY_PIPELINE);
     DHLOGD("Destroy source data process pipeline start.");
+    DCameraPipelineStatsRegistry::GetInstance().Unregister(this);
     isProcess_ = false;
+    captureWriter_.Close();
     if (pipelineHead_ != nullptr) {
         pipelineHead_->ReleaseProcessNode();
         pipelineHead_ = nullptr;
     }
     {
         std::unique_lock<std::mutex> lock(eventMutex_);
-        if ((pipeEventHandler_ != nullptr) && (pipeEventHandler_->GetEventRunner() != nullptr)) {
-            pipeEventHandler_->GetEventRunner()->Stop();
-            eventThread_.join();
+        if (pipeEventQueue_ != nullptr) {
+            pipeEventQueue_->Stop();
         }
-        pipeEventHandler_ = nullptr;
+        pipeEventQueue_ = nullptr;
     }
     {
         std::unique_lock<std::mutex> lock(listenerMutex_);
         processListener_ = nullptr;
     }
+    {
+        std::lock_guard<std::mutex> lock(branchMutex_);
+        branches_.clear();
+    }
     pipNodeRanks_.clear();
     piplineType_ = PipelineType::VIDEO;
     DHLOGD("Destroy source data process pipeline end.");
@@ -258,8 +410,104 @@ void DCameraPipelineSource::OnProcessedVideoBuffer(const std::shared_ptr<DataBuf
     processListener_->OnProcessedVideoBuffer(videoResult);
 }
 
+std::shared_ptr<DataBuffer> DCameraPipelineSource::AcquireOutputBuffer(size_t capacity)
+{
+    {
+        // Branches still read the decoded frame after the consumer handed its memory back.
+        std::lock_guard<std::mutex> lock(branchMutex_);
+        if (!branches_.empty()) {
+            return DataBuffer::Acquire(capacity);
+        }
+    }
+    std::unique_lock<std::mutex> lock(listenerMutex_);
+    if (!isDirectOutput_ || processListener_ == nullptr) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return processListener_->AcquireOutputBuffer(capacity);
+}
+
+void DCameraPipelineSource::OnDecoderStepDown()
+{
+    std::lock_guard<std::mutex> lock(listenerMutex_);
+    CHECK_AND_RETURN_LOG(processListener_ == nullptr, "%{public}s", "Pipeline listener is null.");
+    processListener_->OnDecoderStepDown();
+}
+
+void DCameraPipelineSource::OnDecodedVideoBuffer(const std::shared_ptr<DataBuffer>& decodedBuffer)
+{
+    std::vector<std::shared_ptr<DCameraPipelineSource>> branches;
+    {
+        std::lock_guard<std::mutex> lock(branchMutex_);
+        for (auto& item : branches_) {
+            std::shared_ptr<DCameraPipelineSource> branch = item.lock();
+            if (branch != nullptr) {
+                branches.push_back(branch);
+            }
+        }
+    }
+    // The nodes only read their input, every branch gets the same decoded buffer.
+    for (auto& branch : branches) {
+        std::vector<std::shared_ptr<DataBuffer>> buffers = { decodedBuffer };
+        int32_t ret = branch->ProcessData(buffers);
+        if (ret != DCAMERA_OK) {
+            DHLOGD("Branch pipeline process decoded buffer failed, ret %{public}d.", ret);
+        }
+    }
+}
+
+int32_t DCameraPipelineSource::GetDecodedConfig(VideoConfigParams& decodedConfig)
+{
+    if (!isProcess_ || pipelineHead_ == nullptr) {
+        return DCAMERA_BAD_OPERATE;
+    }
+    if (isTargetLayoutDecoded_) {
+        return DCAMERA_BAD_TYPE;
+    }
+    decodedConfig = decodedConfig_;
+    return DCAMERA_OK;
+}
+
+void DCameraPipelineSource::AddBranch(const std::shared_ptr<DCameraPipelineSource>& branch)
+{
+    CHECK_AND_RETURN_LOG(branch == nullptr || branch.get() == this, "Branch pipeline is invalid.");
+    std::lock_guard<std::mutex> lock(branchMutex_);
+    branches_.push_back(branch);
+    DHLOGI("Add branch pipeline, branch size %{public}zu.", branches_.size());
+}
+
+void DCameraPipelineSource::RemoveBranch(const std::shared_ptr<DCameraPipelineSource>& branch)
+{
+    std::lock_guard<std::mutex> lock(branchMutex_);
+    for (auto iter = branches_.begin(); iter != branches_.end();) {
+        std::shared_ptr<DCameraPipelineSource> item = iter->lock();
+        if (item == nullptr || item == branch) {
+            iter = branches_.erase(iter);
+        } else {
+            iter++;
+        }
+    }
+}
+
+void DCameraPipelineSource::SetDropCounter(const std::shared_ptr<DCameraStreamDropCounter>& dropCounter)
+{
+    dropCounter_ = dropCounter;
+}
+
+void DCameraPipelineSource::SetMemoryAccount(const std::shared_ptr<DCameraMemoryAccount>& memoryAccount)
+{
+    memoryAccount_ = memoryAccount;
+}
+
 int32_t DCameraPipelineSource::GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier)
 {
+    if (propertyName == PIPELINE_STATS) {
+        for (auto& cur : pipNodeRanks_) {
+            if (cur != nullptr) {
+                cur->CarryNodeStats(propertyCarrier);
+            }
+        }
+        return DCAMERA_OK;
+    }
     return DCAMERA_OK;
 }
 
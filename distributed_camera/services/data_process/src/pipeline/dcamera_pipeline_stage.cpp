@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_pipeline_stage.h"
+
+#include <chrono>
+
+#include "dcamera_thread_role.h"
+#include "dcamera_utils_tools.h"
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+DCameraPipelineStage::DCameraPipelineStage(const std::shared_ptr<AbstractDataProcess>& node,
+    const std::string& name, size_t capacity) : node_(node), name_(name)
+{
+    slots_.resize(capacity == 0 ? DEFAULT_QUEUE_CAPACITY : capacity);
+}
+
+DCameraPipelineStage::~DCameraPipelineStage()
+{
+    Stop();
+}
+
+bool DCameraPipelineStage::IsParallelEnabled()
+{
+    int32_t enable = 0;
+    return GetSysPara(PARALLEL_ENABLE_PARA, enable) && (enable == 1);
+}
+
+int32_t DCameraPipelineStage::Start()
+{
+    CHECK_AND_RETURN_RET_LOG(node_ == nullptr, DCAMERA_BAD_VALUE, "Stage node is null.");
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (isRunning_) {
+        return DCAMERA_OK;
+    }
+    isRunning_ = true;
+    std::shared_ptr<DCameraPipelineStage> self = shared_from_this();
+    worker_ = std::thread([self]() { self->RunStage(); });
+    DHLOGI("Pipeline stage %{public}s started, capacity %{public}zu.", name_.c_str(), slots_.size());
+    return DCAMERA_OK;
+}
+
+void DCameraPipelineStage::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        isRunning_ = false;
+        for (auto& slot : slots_) {
+            slot.clear();
+        }
+        head_ = 0;
+        pendingCount_ = 0;
+    }
+    notEmptyCon_.notify_all();
+    notFullCon_.notify_all();
+    if (!worker_.joinable()) {
+        return;
+    }
+    if (worker_.get_id() == std::this_thread::get_id()) {
+        // Released from a callback of the node itself, the worker exits once that callback returns and then
+        // drops its own reference to the stage.
+        worker_.detach();
+        return;
+    }
+    worker_.join();
+}
+
+size_t DCameraPipelineStage::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    return pendingCount_;
+}
+
+int32_t DCameraPipelineStage::InitNode(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig,
+    VideoConfigParams& processedConfig)
+{
+    CHECK_AND_RETURN_RET_LOG(node_ == nullptr, DCAMERA_BAD_VALUE, "Stage node is null.");
+    return node_->InitNode(sourceConfig, targetConfig, processedConfig);
+}
+
+int32_t DCameraPipelineStage::ProcessData(std::vector<std::shared_ptr<DataBuffer>>& inputBuffers)
+{
+    if (inputBuffers.empty()) {
+        DHLOGE("Input buffers is empty");
+        return DCAMERA_BAD_VALUE;
+    }
+    std::unique_lock<std::mutex> lock(queueMutex_);
+    if (!isRunning_) {
+        DHLOGE("Pipeline stage %{public}s is not running.", name_.c_str());
+        return DCAMERA_DISABLE_PROCESS;
+    }
+    bool hasSpace = notFullCon_.wait_for(lock, std::chrono::milliseconds(BACK_PRESSURE_WAIT_MS),
+        [this] { return !isRunning_ || pendingCount_ < slots_.size(); });
+    if (!isRunning_) {
+        return DCAMERA_DISABLE_PROCESS;
+    }
+    if (!hasSpace) {
+        DHLOGW("Pipeline stage %{public}s is full, drop the frame.", name_.c_str());
+        node_->CountDroppedFrames(DCAMERA_DROP_STAGE_FULL, inputBuffers.size());
+        return DCAMERA_DEVICE_BUSY;
+    }
+    slots_[(head_ + pendingCount_) % slots_.size()] = inputBuffers;
+    pendingCount_++;
+    node_->GetNodeStats().SetQueueDepth(pendingCount_);
+    lock.unlock();
+    notEmptyCon_.notify_one();
+    return DCAMERA_OK;
+}
+
+void DCameraPipelineStage::RunStage()
+{
+    DCameraThreadRoleRegistry::GetInstance().ApplyCurrentThread(DCAMERA_THREAD_FRAME, name_);
+    std::shared_ptr<AbstractDataProcess> node = node_;
+    std::vector<std::shared_ptr<DataBuffer>> buffers;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            notEmptyCon_.wait(lock, [this] { return !isRunning_ || pendingCount_ > 0; });
+            if (!isRunning_) {
+                break;
+            }
+            buffers.swap(slots_[head_]);
+            head_ = (head_ + 1) % slots_.size();
+            pendingCount_--;
+            node->GetNodeStats().SetQueueDepth(pendingCount_);
+        }
+        notFullCon_.notify_one();
+        int32_t err = node->ProcessData(buffers);
+        buffers.clear();
+        if (err != DCAMERA_OK) {
+            DHLOGE("Pipeline stage %{public}s process data failed, ret %{public}d.", name_.c_str(), err);
+        }
+    }
+    DHLOGI("Pipeline stage %{public}s exit.", name_.c_str());
+}
+
+void DCameraPipelineStage::ReleaseProcessNode()
+{
+    DHLOGI("Pipeline stage %{public}s release start.", name_.c_str());
+    Stop();
+    if (node_ != nullptr) {
+        node_->ReleaseProcessNode();
+    }
+    DHLOGI("Pipeline stage %{public}s release end.", name_.c_str());
+}
+
+int32_t DCameraPipelineStage::GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier)
+{
+    CHECK_AND_RETURN_RET_LOG(node_ == nullptr, DCAMERA_BAD_VALUE, "Stage node is null.");
+    return node_->GetProperty(propertyName, propertyCarrier);
+}
+
+int32_t DCameraPipelineStage::UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings)
+{
+    CHECK_AND_RETURN_RET_LOG(node_ == nullptr, DCAMERA_BAD_VALUE, "Stage node is null.");
+    return node_->UpdateSettings(settings);
+}
+
+std::shared_ptr<DataBuffer> DCameraPipelineStage::AcquireInputBuffer(size_t capacity)
+{
+    if (node_ == nullptr) {
+        return DataBuffer::Acquire(capacity);
+    }
+    return node_->AcquireInputBuffer(capacity);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -14,9 +14,17 @@
  */
 
 #include "eis_data_process.h"
+
+#include <algorithm>
+#include <cmath>
+
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 #include "dcamera_frame_info.h"
+#include "dcamera_hitrace_adapter.h"
+#include "dcamera_imu_ring.h"
+#include "dcamera_utils_tools.h"
+#include "image_plane_kernels.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -28,13 +36,59 @@ EISDataProcess::~EISDataProcess()
     }
 }
 
+VideoConfigParams EISDataProcess::GetMarginConfig(const VideoConfigParams& targetConfig)
+{
+    VideoConfigParams marginConfig = targetConfig;
+    if (!IsCroppable(targetConfig.GetVideoformat())) {
+        return marginConfig;
+    }
+    int32_t width = (targetConfig.GetWidth() * (PERCENT + MARGIN_PERCENT) / PERCENT) & ~1;
+    int32_t height = (targetConfig.GetHeight() * (PERCENT + MARGIN_PERCENT) / PERCENT) & ~1;
+    marginConfig.SetWidthAndHeight(width, height);
+    return marginConfig;
+}
+
+size_t EISDataProcess::GetLookAheadFrames()
+{
+    int32_t lookAhead = DEFAULT_LOOK_AHEAD_FRAMES;
+    if (!GetSysPara(LOOK_AHEAD_PARA, lookAhead)) {
+        lookAhead = DEFAULT_LOOK_AHEAD_FRAMES;
+    }
+    return static_cast<size_t>(std::min(std::max(lookAhead, 0), MAX_LOOK_AHEAD_FRAMES));
+}
+
+bool EISDataProcess::IsCroppable(Videoformat format)
+{
+    return format == Videoformat::YUVI420 || format == Videoformat::NV12 || format == Videoformat::NV21;
+}
+
 int32_t EISDataProcess::InitNode(const VideoConfigParams& sourceConfig,
     const VideoConfigParams& targetConfig, VideoConfigParams& processedConfig)
 {
     DHLOGI("EISDataProcess::InitNode start");
- 
+    sourceConfig_ = sourceConfig;
+    targetConfig_ = targetConfig;
+    processedConfig_ = sourceConfig;
+    int32_t marginX = sourceConfig.GetWidth() - targetConfig.GetWidth();
+    int32_t marginY = sourceConfig.GetHeight() - targetConfig.GetHeight();
+    isStabilizing_ = IsCroppable(sourceConfig.GetVideoformat()) && marginX >= 0 && marginY >= 0 &&
+        (marginX > 0 || marginY > 0);
+    {
+        std::lock_guard<std::mutex> lock(eisMutex_);
+        pendingFrames_.clear();
+        lastFrameTimeNs_ = 0;
+        if (isStabilizing_) {
+            processedConfig_.SetWidthAndHeight(targetConfig.GetWidth(), targetConfig.GetHeight());
+            double halfFov = DEFAULT_HFOV_DEGREE * HALF * std::acos(-1.0) / HALF_CIRCLE_DEGREE;
+            double focalLength = sourceConfig.GetWidth() * HALF / std::tan(halfFov);
+            stabilizer_.Init(marginX, marginY, focalLength, GetLookAheadFrames());
+        }
+    }
+    processedConfig = processedConfig_;
+    DCameraImuStore::GetInstance().Clear();
     isEISProcess_.store(true);
-    DHLOGI("EISDataProcess::InitNode success");
+    DHLOGI("EISDataProcess::InitNode success, stabilizing %{public}d margin %{public}dx%{public}d",
+        isStabilizing_, marginX, marginY);
     return DCAMERA_OK;
 }
 
@@ -45,18 +99,86 @@ int32_t EISDataProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>& in
         return DCAMERA_DISABLE_PROCESS;
     }
     
-    if (inputBuffers.empty()) {
+    if (inputBuffers.empty() || inputBuffers[0] == nullptr) {
         DHLOGE("Input buffers is empty");
         return DCAMERA_BAD_VALUE;
     }
-    DHLOGI("EIS already started");
-    return EISDone(inputBuffers);
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_EIS, inputBuffers[0]->frameInfo_.index);
+    DCameraNodeStatsScope statsScope(stats_, inputBuffers.size());
+    if (!isStabilizing_) {
+        return EISDone(inputBuffers);
+    }
+
+    std::vector<std::shared_ptr<DataBuffer>> readyFrames;
+    {
+        std::lock_guard<std::mutex> lock(eisMutex_);
+        LoadImuWindow(inputBuffers[0]);
+        stabilizer_.AddFrame(gyroWindow_);
+        pendingFrames_.push_back(inputBuffers[0]);
+        EisCropOffset offset;
+        while (stabilizer_.GetReadyOffset(offset) && !pendingFrames_.empty()) {
+            std::shared_ptr<DataBuffer> frame = CropFrame(pendingFrames_.front(), offset);
+            pendingFrames_.pop_front();
+            if (frame != nullptr) {
+                readyFrames.push_back(frame);
+            }
+        }
+    }
+    int32_t ret = DCAMERA_OK;
+    for (auto& frame : readyFrames) {
+        std::vector<std::shared_ptr<DataBuffer>> outputBuffers = { frame };
+        int32_t err = EISDone(outputBuffers);
+        if (err != DCAMERA_OK) {
+            ret = err;
+        }
+    }
+    return ret;
+}
+
+std::shared_ptr<DataBuffer> EISDataProcess::CropFrame(const std::shared_ptr<DataBuffer>& buffer,
+    const EisCropOffset& offset)
+{
+    int32_t format = 0;
+    int32_t width = 0;
+    int32_t height = 0;
+    bool isFound = buffer->FindInt32(DataBufferKey::VIDEO_FORMAT, format) &&
+        buffer->FindInt32(DataBufferKey::WIDTH, width) && buffer->FindInt32(DataBufferKey::HEIGHT, height);
+    size_t srcSize = static_cast<size_t>(width) * static_cast<size_t>(height) * YUV_BYTES_PER_PIXEL / Y2UV_RATIO;
+    if (!isFound || width != sourceConfig_.GetWidth() || height != sourceConfig_.GetHeight() ||
+        format != static_cast<int32_t>(sourceConfig_.GetVideoformat()) || buffer->Size() < srcSize) {
+        DHLOGE("EIS input frame format %{public}d %{public}dx%{public}d size %{public}zu mismatch, drop it.",
+            format, width, height, buffer->Size());
+        return nullptr;
+    }
+    int32_t dstWidth = processedConfig_.GetWidth();
+    int32_t dstHeight = processedConfig_.GetHeight();
+    std::shared_ptr<DataBuffer> dstBuf = DataBuffer::Acquire(static_cast<size_t>(dstWidth) *
+        static_cast<size_t>(dstHeight) * YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
+    OnBufferAllocated(dstBuf, DCAMERA_MEMORY_EIS);
+    int32_t ret = ImagePlaneKernels::CropYUV420(buffer->Data(), width, height, dstBuf->Data(), dstWidth, dstHeight,
+        offset.x, offset.y, format != static_cast<int32_t>(Videoformat::YUVI420));
+    CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, nullptr, "EIS crop at (%{public}d,%{public}d) failed.",
+        offset.x, offset.y);
+    dstBuf->frameInfo_ = buffer->frameInfo_;
+    dstBuf->eisInfo_ = buffer->eisInfo_;
+    dstBuf->SetInt32(DataBufferKey::VIDEO_FORMAT, format);
+    dstBuf->SetInt32(DataBufferKey::ALIGNED_WIDTH, dstWidth);
+    dstBuf->SetInt32(DataBufferKey::ALIGNED_HEIGHT, dstHeight);
+    dstBuf->SetInt32(DataBufferKey::WIDTH, dstWidth);
+    dstBuf->SetInt32(DataBufferKey::HEIGHT, dstHeight);
+    return dstBuf;
 }
 
 void EISDataProcess::ReleaseProcessNode()
 {
     DHLOGI("ReleaseProcessNode start");
     isEISProcess_.store(false);
+    {
+        std::lock_guard<std::mutex> lock(eisMutex_);
+        gyroWindow_.clear();
+        pendingFrames_.clear();
+        stabilizer_.Reset();
+    }
     if (nextDataProcess_ != nullptr) {
         nextDataProcess_->ReleaseProcessNode();
         nextDataProcess_ = nullptr;
@@ -69,6 +191,20 @@ int32_t EISDataProcess::GetProperty(const std::string& propertyName, PropertyCar
     return DCAMERA_OK;
 }
 
+void EISDataProcess::LoadImuWindow(const std::shared_ptr<DataBuffer>& buffer)
+{
+    if (buffer == nullptr) {
+        return;
+    }
+    // Frame timestamps are in microseconds, the sensor stamps samples in nanoseconds on the same clock.
+    int64_t frameTimeNs = buffer->eisInfo_.frameTimeStamp * US_TO_NS;
+    int64_t startTimeNs = (lastFrameTimeNs_ > 0 && lastFrameTimeNs_ < frameTimeNs) ? lastFrameTimeNs_ : 0;
+    DCameraImuStore::GetInstance().GetGyroRing().GetWindow(startTimeNs, frameTimeNs, gyroWindow_);
+    lastFrameTimeNs_ = frameTimeNs;
+    DHLOGD("EIS frameId: %{public}d, frameTimeStamp: %{public}" PRId64 ", gyro samples: %{public}zu",
+        buffer->eisInfo_.frameId, buffer->eisInfo_.frameTimeStamp, gyroWindow_.size());
+}
+
 int32_t EISDataProcess::EISDone(std::vector<std::shared_ptr<DataBuffer>>& outputBuffers)
 {
     if (outputBuffers.empty() || outputBuffers[0] == nullptr) {
@@ -76,6 +212,7 @@ int32_t EISDataProcess::EISDone(std::vector<std::shared_ptr<DataBuffer>>& output
         return DCAMERA_BAD_VALUE;
     }
 
+    stats_.OnFramesOut(outputBuffers.size());
     if (nextDataProcess_ != nullptr) {
         DHLOGD("Send to the next node of your process for processing.");
         int32_t err = nextDataProcess_->ProcessData(outputBuffers);
@@ -85,9 +222,6 @@ int32_t EISDataProcess::EISDone(std::vector<std::shared_ptr<DataBuffer>>& output
         return err;
     }
 
-    DHLOGI("EIS deal success!, frameId: %{public}d, frameTimeStamp: %{public}" PRId64 ", initParams: %{public}s,"
-       "imuData: %{public}s", outputBuffers[0]->eisInfo_.frameId, outputBuffers[0]->eisInfo_.frameTimeStamp,
-       outputBuffers[0]->eisInfo_.initParams.c_str(), outputBuffers[0]->eisInfo_.imuData.c_str());
     DHLOGD("The current node is the last node, and output the processed video buffer.");
     auto pipelineSource = callbackPipelineSource_.lock();
     if (pipelineSource == nullptr) {
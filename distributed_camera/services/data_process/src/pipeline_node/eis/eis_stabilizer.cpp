@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "eis_stabilizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace OHOS {
+namespace DistributedHardware {
+void EISStabilizer::Init(int32_t marginX, int32_t marginY, double focalLength, size_t lookAhead)
+{
+    marginX_ = std::max(marginX, 0);
+    marginY_ = std::max(marginY, 0);
+    focalLength_ = focalLength;
+    lookAhead_ = lookAhead;
+    Reset();
+}
+
+void EISStabilizer::Reset()
+{
+    current_ = Orientation();
+    lastSampleTime_ = 0;
+    history_.clear();
+    pending_.clear();
+}
+
+void EISStabilizer::AddFrame(const std::vector<ImuSample>& gyroData)
+{
+    // Device axes are taken as aligned with the image: x to the right and y up.
+    for (const auto& sample : gyroData) {
+        int64_t gap = sample.timeStamp - lastSampleTime_;
+        if (lastSampleTime_ != 0 && gap > 0 && gap <= MAX_SAMPLE_GAP_NS) {
+            double dt = static_cast<double>(gap) / NS_PER_SECOND;
+            current_.yaw += static_cast<double>(sample.data[IMU_Y]) * dt;
+            current_.pitch += static_cast<double>(sample.data[IMU_X]) * dt;
+        }
+        if (sample.timeStamp > lastSampleTime_) {
+            lastSampleTime_ = sample.timeStamp;
+        }
+    }
+    pending_.push_back(current_);
+}
+
+size_t EISStabilizer::GetPendingCount() const
+{
+    return pending_.size();
+}
+
+EISStabilizer::Orientation EISStabilizer::GetSmoothed() const
+{
+    // Triangular weights around the frame about to be sent, frames further away count less.
+    double span = static_cast<double>(std::max(history_.size(), lookAhead_) + 1);
+    Orientation sum;
+    double weightSum = 0.0;
+    for (size_t i = 0; i < history_.size(); i++) {
+        double weight = span - static_cast<double>(history_.size() - i);
+        sum.yaw += weight * history_[i].yaw;
+        sum.pitch += weight * history_[i].pitch;
+        weightSum += weight;
+    }
+    for (size_t i = 0; i < pending_.size() && i <= lookAhead_; i++) {
+        double weight = span - static_cast<double>(i);
+        sum.yaw += weight * pending_[i].yaw;
+        sum.pitch += weight * pending_[i].pitch;
+        weightSum += weight;
+    }
+    sum.yaw /= weightSum;
+    sum.pitch /= weightSum;
+    return sum;
+}
+
+int32_t EISStabilizer::ClampOffset(double shift, int32_t margin)
+{
+    double offset = std::round(static_cast<double>(margin) / 2 + shift);
+    offset = std::min(std::max(offset, 0.0), static_cast<double>(margin));
+    // Chroma is subsampled by two, keep the window on even samples.
+    return static_cast<int32_t>(offset) & ~1;
+}
+
+bool EISStabilizer::GetReadyOffset(EisCropOffset& offset)
+{
+    if (pending_.size() <= lookAhead_) {
+        return false;
+    }
+    Orientation smoothed = GetSmoothed();
+    const Orientation& actual = pending_.front();
+    // Turning left or up moves the scene right or down, the window follows it back onto the smooth path.
+    offset.x = ClampOffset(focalLength_ * std::tan(actual.yaw - smoothed.yaw), marginX_);
+    offset.y = ClampOffset(focalLength_ * std::tan(actual.pitch - smoothed.pitch), marginY_);
+    history_.push_back(actual);
+    if (history_.size() > HISTORY_FRAMES) {
+        history_.pop_front();
+    }
+    pending_.pop_front();
+    return true;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "fps_controller_process.h"
 
+#include "dcamera_hitrace_adapter.h"
 #include "dcamera_utils_tools.h"
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
@@ -60,9 +61,7 @@ void FpsControllerProcess::ReleaseProcessNode()
     keepMoreThanDoubleCount_ = 0;
     frameRateCorrectionFactor_ = 0.0;
     frameRateOvershootMdf_ = 0;
-    for (int i = 0; i < INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE; i++) {
-        incomingFrameTimesMs_[i] = 0;
-    }
+    ClearIncomingFrameTimes();
 
     if (nextDataProcess_ != nullptr) {
         nextDataProcess_->ReleaseProcessNode();
@@ -81,8 +80,10 @@ int32_t FpsControllerProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer
         DHLOGE("Decoder node occurred error.");
         return DCAMERA_DISABLE_PROCESS;
     }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_FPS_CONTROL, inputBuffers[0]->frameInfo_.index);
+    DCameraNodeStatsScope statsScope(stats_, inputBuffers.size());
     int64_t timeStampUs = 0;
-    if (!inputBuffers[0]->FindInt64("timeUs", timeStampUs)) {
+    if (!inputBuffers[0]->FindInt64(DataBufferKey::TIME_US, timeStampUs)) {
         DHLOGE("Find decoder output timestamp failed.");
         return DCAMERA_BAD_TYPE;
     }
@@ -95,6 +96,7 @@ int32_t FpsControllerProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer
     if (IsDropFrame(curFrameRate)) {
         DHLOGD("frame control, currect frameRate %{public}f, targetRate %{public}d, drop it",
             curFrameRate, targetFrameRate_);
+        CountDroppedFrames(DCAMERA_DROP_FPS_CONTROL, inputBuffers.size());
         return DCAMERA_OK;
     }
 
@@ -117,8 +119,8 @@ void FpsControllerProcess::UpdateFPSControllerInfo(int64_t nowMs)
         DHLOGD("Frame control, income fisrt frame.");
         isFirstFrame_ = true;
     }
-    lastFrameIncomeTimeMs_ = nowMs;
     recentFrameTimeSpanMs_ = nowMs - lastFrameIncomeTimeMs_;
+    lastFrameIncomeTimeMs_ = nowMs;
     DHLOGD("Frame control, lastFrameIncomeTimeMs_ %{public}lld, receive Frame after last frame(ms): %{public}lld",
         (long long)lastFrameIncomeTimeMs_, (long long)recentFrameTimeSpanMs_);
     UpdateIncomingFrameTimes(nowMs);
@@ -174,36 +176,53 @@ void FpsControllerProcess::UpdateFrameRateCorrectionFactor(int64_t nowMs)
 
 void FpsControllerProcess::UpdateIncomingFrameTimes(int64_t nowMs)
 {
-    DHLOGD("Frame control, update incoming frame times array.");
+    DHLOGD("Frame control, update incoming frame times.");
     if (targetFrameRate_ <= 0) {
         DHLOGD("Frame control, targetFrameRate_ : %{public}d", targetFrameRate_);
         return;
     }
     if (isFirstFrame_) {
-        incomingFrameTimesMs_[0] = nowMs;
-        return;
+        ClearIncomingFrameTimes();
+    } else if (frameTimesCount_ > 0) {
+        int64_t newestMs = incomingFrameTimesMs_[(frameTimesHead_ + INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE - 1) %
+            INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE];
+        int64_t intervalNewAndLast = nowMs - newestMs;
+        if (intervalNewAndLast < 0) {
+            intervalNewAndLast = -intervalNewAndLast;
+        }
+        if (intervalNewAndLast > FRMAE_MAX_INTERVAL_TIME_WINDOW_MS) {
+            DHLOGD("frame control, nowMs: %{public}lld last frame: %{public}lld interval: %{public}lld, restart",
+                (long long)nowMs, (long long)newestMs, (long long)intervalNewAndLast);
+            ClearIncomingFrameTimes();
+        }
     }
-
-    int64_t intervalNewAndFirst = nowMs - incomingFrameTimesMs_[0];
-    if (intervalNewAndFirst < 0) {
-        intervalNewAndFirst = -intervalNewAndFirst;
+    // A full ring overwrites its oldest time, which is where the head points.
+    incomingFrameTimesMs_[frameTimesHead_] = nowMs;
+    frameTimesHead_ = (frameTimesHead_ + 1) % INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE;
+    if (frameTimesCount_ < INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE) {
+        frameTimesCount_++;
     }
-    if (intervalNewAndFirst > FRMAE_MAX_INTERVAL_TIME_WINDOW_MS) {
-        DHLOGD("frame control, nowMs: %{public}lld mIncomingFrameT[0]: %{public}lld intervalNewAndFirst: "
-            "%{public}lld", (long long)nowMs, (long long)incomingFrameTimesMs_[0], (long long)intervalNewAndFirst);
-        for (int i = 0; i < INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE; i++) {
-            incomingFrameTimesMs_[i] = 0;
-        }
-    } else {
-        DHLOGD("frame control shift, nowMs: %{public}lld mIncomingFrameT[0]: %{public}lld intervalNewAndFirst: "
-            "%{public}lld", (long long)nowMs, (long long)incomingFrameTimesMs_[0], (long long)intervalNewAndFirst);
-        const int32_t windowLeftNum =  2;
-        for (int i = (INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE - windowLeftNum); i >= 0; --i) {
-            incomingFrameTimesMs_[i + 1] = incomingFrameTimesMs_[i];
+}
+
+void FpsControllerProcess::ClearIncomingFrameTimes()
+{
+    incomingFrameTimesMs_.fill(0);
+    frameTimesHead_ = 0;
+    frameTimesCount_ = 0;
+}
+
+void FpsControllerProcess::EvictExpiredFrameTimes(int64_t nowMs)
+{
+    // Times only grow, so the ones out of the window are the oldest and each leaves once.
+    while (frameTimesCount_ > 0) {
+        size_t oldest = (frameTimesHead_ + INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE - frameTimesCount_) %
+            INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE;
+        if (incomingFrameTimesMs_[oldest] > 0 && nowMs - incomingFrameTimesMs_[oldest] <=
+            FRAME_HISTORY_TIME_WINDOWS_MS) {
+            break;
         }
+        frameTimesCount_--;
     }
-    incomingFrameTimesMs_[0] = nowMs;
-    return;
 }
 
 float FpsControllerProcess::CalculateFrameRate(int64_t nowMs)
@@ -214,27 +233,19 @@ float FpsControllerProcess::CalculateFrameRate(int64_t nowMs)
         return 0.0;
     }
 
-    int32_t num = 0;
-    int32_t validFramesNumber = 0;
     if (nowMs < 0) {
         nowMs = -nowMs;
     }
-    for (; num < INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE; num++) {
-        if (incomingFrameTimesMs_[num] <= 0 || nowMs - incomingFrameTimesMs_[num] > FRAME_HISTORY_TIME_WINDOWS_MS) {
-            break;
-        } else {
-            validFramesNumber++;
-        }
-    }
+    EvictExpiredFrameTimes(nowMs);
+    int32_t validFramesNumber = static_cast<int32_t>(frameTimesCount_);
 
     const float msPerSecond = 1000;
     const int32_t minValidCalculatedFrameRatesNum = 2;
     int32_t minIncomingFrameNum = targetFrameRate_ / MIN_INCOME_FRAME_NUM_COEFFICIENT;
     if (validFramesNumber > minIncomingFrameNum && validFramesNumber > minValidCalculatedFrameRatesNum) {
-        int64_t validTotalTimeInterval = 0;
-        if (num > 0) {
-            validTotalTimeInterval = (nowMs - incomingFrameTimesMs_[num - 1]);
-        }
+        size_t oldest = (frameTimesHead_ + INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE - frameTimesCount_) %
+            INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE;
+        int64_t validTotalTimeInterval = nowMs - incomingFrameTimesMs_[oldest];
         if (validTotalTimeInterval < 0) {
             validTotalTimeInterval = -validTotalTimeInterval;
         }
@@ -257,7 +268,7 @@ bool FpsControllerProcess::IsDropFrame(float incomingFps)
         return false;
     }
     const int32_t incomingFrmRate = static_cast<int32_t>(incomingFps);
-    if (incomingFrmRate > targetFrameRate_) {
+    if (incomingFrmRate <= targetFrameRate_) {
         DHLOGD("incoming fps not more than targetFrameRate_, not drop");
         return false;
     }
@@ -331,6 +342,7 @@ int32_t FpsControllerProcess::FpsControllerDone(std::vector<std::shared_ptr<Data
         return DCAMERA_BAD_VALUE;
     }
 
+    stats_.OnFramesOut(outputBuffers.size());
     if (nextDataProcess_ != nullptr) {
         DHLOGD("Send to the next node of the FpsController for processing.");
         int32_t err = nextDataProcess_->ProcessData(outputBuffers);
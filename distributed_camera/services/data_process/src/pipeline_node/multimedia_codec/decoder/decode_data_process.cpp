@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,13 +17,20 @@
 
 #include "distributed_camera_constants.h"
 #include "distributed_hardware_log.h"
+#include "dcamera_codec_pool.h"
+#include "dcamera_decoder_arbiter.h"
+#include "dcamera_dump_writer.h"
 #include "dcamera_hisysevent_adapter.h"
 #include "dcamera_hidumper.h"
+#include "dcamera_hitrace_adapter.h"
 #include "dcamera_radar.h"
 #include "decode_surface_listener.h"
 #include "decode_video_callback.h"
 #include "graphic_common_c.h"
-#include <sys/prctl.h>
+#include "image_plane_kernels.h"
+#include "scale_convert_process.h"
+#include "yuv_color_kernels.h"
+#include <algorithm>
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -31,12 +38,6 @@ const std::string ENUM_VIDEOFORMAT_STRINGS[] = {
     "YUVI420", "NV12", "NV21", "RGBA_8888"
 };
 
-const static int32_t ROTATION_0 = 0;
-const static int32_t ROTATION_90 = 90;
-const static int32_t ROTATION_180 = 180;
-const static int32_t ROTATION_270 = 270;
-const static int32_t ROTATION_360 = 360;
-
 DecodeDataProcess::~DecodeDataProcess()
 {
     DumpFileUtil::CloseDumpFile(&dumpDecBeforeFile_);
@@ -51,6 +52,8 @@ int32_t DecodeDataProcess::InitNode(const VideoConfigParams& sourceConfig, const
     VideoConfigParams& processedConfig)
 {
     DHLOGD("Init DCamera DecodeNode start.");
+    bounds_ = DCameraCodecCapability::GetInstance().GetBounds(sourceConfig.GetVideoCodecType(), false,
+        { MAX_VIDEO_WIDTH, MAX_VIDEO_HEIGHT, static_cast<int32_t>(MAX_FRAME_RATE) });
     if (!(IsInDecoderRange(sourceConfig) && IsInDecoderRange(targetConfig))) {
         DHLOGE("Source config or target config are invalid.");
         return DCAMERA_BAD_VALUE;
@@ -83,23 +86,75 @@ int32_t DecodeDataProcess::InitNode(const VideoConfigParams& sourceConfig, const
     }
     alignedHeight_ = GetAlignedHeight(sourceConfig_.GetHeight());
     processedConfig = processedConfig_;
-    if (targetConfig_.GetIsSystemSwitch()) {
-        int32_t rotate = targetConfig_.GetRotation();
-        DHLOGI("DecodeDataProcess::InitNode current stream is system switch, orientation: %{public}d", rotate);
-        if (rotate > 0) {
-            rotate_ = ROTATION_360 - rotate;
-        }
-    }
     isDecoderProcess_.store(true);
     return DCAMERA_OK;
 }
 
+int32_t DecodeDataProcess::UpdateConfig(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig, VideoConfigParams& processedConfig)
+{
+    if (!isDecoderProcess_.load()) {
+        DHLOGE("Decoder node occurred error or start release.");
+        return DCAMERA_DISABLE_PROCESS;
+    }
+    if (!(IsInDecoderRange(sourceConfig) && IsInDecoderRange(targetConfig)) ||
+        sourceConfig.GetVideoCodecType() != sourceConfig_.GetVideoCodecType() ||
+        targetConfig.GetVideoCodecType() != targetConfig_.GetVideoCodecType()) {
+        DHLOGE("Source config or target config are invalid for the running DecodeNode.");
+        return DCAMERA_BAD_VALUE;
+    }
+
+    std::lock_guard<std::mutex> lock(mtxOutputConfig_);
+    VideoConfigParams lastSourceConfig = sourceConfig_;
+    VideoConfigParams lastTargetConfig = targetConfig_;
+    sourceConfig_ = sourceConfig;
+    targetConfig_ = targetConfig;
+    if (sourceConfig_.GetVideoCodecType() == targetConfig_.GetVideoCodecType()) {
+        processedConfig_ = sourceConfig_;
+        processedConfig = processedConfig_;
+        return DCAMERA_OK;
+    }
+    // The decoder was configured for one pixel format, only the size may change under it.
+    Videoformat outputFormat = SelectOutputFormat();
+    if (outputFormat != processedConfig_.GetVideoformat()) {
+        DHLOGI("Decoder output format %{public}d changes to %{public}d, the DecodeNode is rebuilt.",
+            processedConfig_.GetVideoformat(), outputFormat);
+        sourceConfig_ = lastSourceConfig;
+        targetConfig_ = lastTargetConfig;
+        return DCAMERA_BAD_OPERATE;
+    }
+
+    // The codec picks up the new size from the parameter sets of the next key frame and reports it through
+    // OnOutputFormatChanged, input and output buffers are sized per frame from the configs below.
+    processedConfig_ = sourceConfig_;
+    processedConfig_.SetVideoCodecType(VideoCodecType::NO_CODEC);
+    processedConfig_.SetVideoformat(outputFormat);
+    metadataFormat_.PutIntValue("width", sourceConfig_.GetWidth());
+    metadataFormat_.PutIntValue("height", sourceConfig_.GetHeight());
+    maxInputSize_ = CalMaxInputSize(MAX_YUV420_BUFFER_SIZE, YUV_BYTES_PER_PIXEL, Y2UV_RATIO);
+    alignedHeight_ = GetAlignedHeight(sourceConfig_.GetHeight());
+    if (decodeConsumerSurface_ != nullptr) {
+        decodeConsumerSurface_->SetDefaultWidthAndHeight(static_cast<int32_t>(sourceConfig_.GetWidth()),
+            static_cast<int32_t>(sourceConfig_.GetHeight()));
+    }
+    processedConfig = processedConfig_;
+    DHLOGI("DecodeNode switched from %{public}dx%{public}d to %{public}dx%{public}d without a new decoder.",
+        lastSourceConfig.GetWidth(), lastSourceConfig.GetHeight(), sourceConfig_.GetWidth(),
+        sourceConfig_.GetHeight());
+    return DCAMERA_OK;
+}
+
 bool DecodeDataProcess::IsInDecoderRange(const VideoConfigParams& curConfig)
 {
-    bool isWidthValid = (curConfig.GetWidth() >= MIN_VIDEO_WIDTH && curConfig.GetWidth() <= MAX_VIDEO_WIDTH);
-    bool isHeightValid = (curConfig.GetHeight() >= MIN_VIDEO_HEIGHT && curConfig.GetHeight() <= MAX_VIDEO_HEIGHT);
-    bool isFrameRateValid = (curConfig.GetFrameRate() >= MIN_FRAME_RATE && curConfig.GetFrameRate() <= MAX_FRAME_RATE);
-    return isWidthValid && isHeightValid && isFrameRateValid;
+    return DCameraCodecCapability::IsInBounds(curConfig, bounds_, MIN_VIDEO_WIDTH, MIN_VIDEO_HEIGHT, MIN_FRAME_RATE);
+}
+
+int32_t DecodeDataProcess::CalMaxInputSize(const int32_t defaultSize, const int32_t bytesPerPixel,
+    const int32_t pixelDivisor)
+{
+    int64_t size = static_cast<int64_t>(sourceConfig_.GetWidth()) * sourceConfig_.GetHeight() * bytesPerPixel /
+        pixelDivisor * INPUT_SIZE_MARGIN;
+    return static_cast<int32_t>(std::max<int64_t>(size, defaultSize));
 }
 
 bool DecodeDataProcess::IsConvertible(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig)
@@ -111,39 +166,27 @@ bool DecodeDataProcess::IsConvertible(const VideoConfigParams& sourceConfig, con
 void DecodeDataProcess::InitCodecEvent()
 {
     DHLOGD("Init DecodeNode eventBus, and add handler for it.");
-    eventThread_ = std::thread([this]() { this->StartEventHandler(); });
-    std::unique_lock<std::mutex> lock(eventMutex_);
-    eventCon_.wait(lock, [this] {
-        return decEventHandler_ != nullptr;
-    });
-}
-
-void DecodeDataProcess::StartEventHandler()
-{
-    prctl(PR_SET_NAME, DECODE_DATA_EVENT.c_str());
-    auto runner = AppExecFwk::EventRunner::Create(false);
-    if (runner == nullptr) {
-        DHLOGE("Creat runner failed.");
-        return;
-    }
-    {
-        std::lock_guard<std::mutex> lock(eventMutex_);
-        decEventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
-    }
-    eventCon_.notify_one();
-    runner->Run();
+    std::lock_guard<std::mutex> lock(eventMutex_);
+    decEventQueue_ = std::make_shared<DCameraSerialQueue>(DECODE_DATA_EVENT, DCAMERA_THREAD_FRAME);
 }
 
 int32_t DecodeDataProcess::InitDecoder()
 {
     DHLOGD("Init video decoder.");
-    int32_t ret = ConfigureVideoDecoder();
-    if (ret != DCAMERA_OK) {
-        DHLOGE("Init video decoder metadata format failed.");
-        return ret;
+    int32_t ret = ConfigureVideoDecoder(false);
+    if (ret == DCAMERA_OK) {
+        ret = StartVideoDecoder();
+    }
+    if (ret != DCAMERA_OK && videoDecoder_ != nullptr && !isSoftwareDecoder_) {
+        // A hardware decoder that can not be configured or started leaves the stream to a software one.
+        DHLOGW("Hardware video decoder failed, retry in software. ret %{public}d.", ret);
+        ReleaseVideoDecoder();
+        ReleaseDecoderSurface();
+        ret = ConfigureVideoDecoder(true);
+        if (ret == DCAMERA_OK) {
+            ret = StartVideoDecoder();
+        }
     }
-
-    ret = StartVideoDecoder();
     if (ret != DCAMERA_OK) {
         DHLOGE("Start Video decoder failed.");
         auto videoFormat = sourceConfig_.GetVideoformat();
@@ -164,7 +207,7 @@ int32_t DecodeDataProcess::InitDecoder()
     return DCAMERA_OK;
 }
 
-int32_t DecodeDataProcess::ConfigureVideoDecoder()
+int32_t DecodeDataProcess::ConfigureVideoDecoder(bool isForceSoftware)
 {
     int32_t ret = InitDecoderMetadataFormat();
     if (ret != DCAMERA_OK) {
@@ -172,7 +215,7 @@ int32_t DecodeDataProcess::ConfigureVideoDecoder()
         return ret;
     }
 
-    videoDecoder_ = MediaAVCodec::VideoDecoderFactory::CreateByMime(processType_);
+    videoDecoder_ = CreateVideoDecoder(isForceSoftware);
     CHECK_AND_RETURN_RET_LOG(videoDecoder_ == nullptr, DCAMERA_INIT_ERR, "%{public}s",
         "Create video decoder failed.");
     decodeVideoCallback_ = std::make_shared<DecodeVideoCallback>(shared_from_this());
@@ -188,12 +231,55 @@ int32_t DecodeDataProcess::ConfigureVideoDecoder()
     return DCAMERA_OK;
 }
 
+std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> DecodeDataProcess::CreateVideoDecoder(bool isForceSoftware)
+{
+    arbiterKey_ = GetArbiterKey();
+    int32_t frameRate = sourceConfig_.GetFrameRate() > 0 ?
+        sourceConfig_.GetFrameRate() : static_cast<int32_t>(MAX_FRAME_RATE);
+    int64_t load = DCameraDecoderArbiter::GetLoad(sourceConfig_.GetWidth(), sourceConfig_.GetHeight(), frameRate);
+    std::weak_ptr<DecodeDataProcess> weakThis = shared_from_this();
+    DCameraDecoderGrant grant = DCameraDecoderArbiter::GetInstance().Acquire(arbiterKey_, load, [weakThis]() {
+        std::shared_ptr<DecodeDataProcess> decoder = weakThis.lock();
+        if (decoder != nullptr) {
+            decoder->OnDecoderStepDown();
+        }
+    });
+    isSoftwareDecoder_ = isForceSoftware || grant == DCameraDecoderGrant::SOFTWARE;
+    if (!isSoftwareDecoder_) {
+        std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> decoder = DCameraCodecPool::GetInstance().AcquireDecoder(
+            processType_, sourceConfig_.GetWidth(), sourceConfig_.GetHeight());
+        if (decoder != nullptr) {
+            return decoder;
+        }
+        DHLOGW("Create hardware decoder failed, fall back to software.");
+        isSoftwareDecoder_ = true;
+    }
+    DCameraDecoderArbiter::GetInstance().OnHardwareUnavailable(arbiterKey_);
+    return DCameraDecoderArbiter::CreateSoftwareDecoder(processType_);
+}
+
+std::string DecodeDataProcess::GetArbiterKey() const
+{
+    if (dropCounter_ != nullptr) {
+        return dropCounter_->GetStreamKey();
+    }
+    return "decoder_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+}
+
+void DecodeDataProcess::OnDecoderStepDown()
+{
+    DHLOGI("Decoder of %{public}s asked to step down.", arbiterKey_.c_str());
+    std::shared_ptr<DCameraPipelineSource> targetPipelineSource = callbackPipelineSource_.lock();
+    CHECK_AND_RETURN_LOG(targetPipelineSource == nullptr, "%{public}s", "callbackPipelineSource_ is nullptr.");
+    targetPipelineSource->OnDecoderStepDown();
+}
+
 int32_t DecodeDataProcess::InitDecoderMetadataFormat()
 {
     DHLOGI("Init video decoder metadata format. codecType: %{public}d", sourceConfig_.GetVideoCodecType());
     processedConfig_ = sourceConfig_;
     processedConfig_.SetVideoCodecType(VideoCodecType::NO_CODEC);
-    processedConfig_.SetVideoformat(Videoformat::YUVI420);
+    processedConfig_.SetVideoformat(SelectOutputFormat());
     switch (sourceConfig_.GetVideoCodecType()) {
         case VideoCodecType::CODEC_H264:
             processType_ = "video/avc";
@@ -206,15 +292,49 @@ int32_t DecodeDataProcess::InitDecoderMetadataFormat()
             return DCAMERA_NOT_FOUND;
     }
 
-    metadataFormat_.PutIntValue("pixel_format", static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::NV12));
+    // A Main10 stream leaves the NV12 decoder as P010, the 16 bit layout of NV12.
+    MediaAVCodec::VideoPixelFormat pixelFormat = (processedConfig_.GetVideoformat() == Videoformat::NV21) ?
+        MediaAVCodec::VideoPixelFormat::NV21 : MediaAVCodec::VideoPixelFormat::NV12;
+    metadataFormat_.PutIntValue("pixel_format", static_cast<int32_t>(pixelFormat));
     metadataFormat_.PutStringValue("codec_mime", processType_);
     metadataFormat_.PutIntValue("width", sourceConfig_.GetWidth());
     metadataFormat_.PutIntValue("height", sourceConfig_.GetHeight());
-    metadataFormat_.PutDoubleValue("frame_rate", MAX_FRAME_RATE);
+    maxInputSize_ = CalMaxInputSize(MAX_YUV420_BUFFER_SIZE, YUV_BYTES_PER_PIXEL, Y2UV_RATIO);
+    metadataFormat_.PutDoubleValue("frame_rate",
+        sourceConfig_.GetFrameRate() > 0 ? static_cast<double>(sourceConfig_.GetFrameRate()) : MAX_FRAME_RATE);
 
     return DCAMERA_OK;
 }
 
+Videoformat DecodeDataProcess::SelectOutputFormat()
+{
+    // The scale node rotates and scales the decoder layout in one pass, without the I420 round trip.
+    if (ScaleConvertProcess::IsFusedRotateSupported(sourceConfig_, targetConfig_)) {
+        return Videoformat::NV12;
+    }
+    // A semi-planar target of the decoded size takes the decoder layout as is, without the I420 round trip.
+    if (sourceConfig_.GetEis() || targetConfig_.GetIsSystemSwitch() ||
+        sourceConfig_.GetWidth() != targetConfig_.GetWidth() ||
+        sourceConfig_.GetHeight() != targetConfig_.GetHeight()) {
+        return Videoformat::YUVI420;
+    }
+    if (targetConfig_.GetVideoformat() == Videoformat::P010) {
+        // An 8 bit stream keeps the I420 output, the scale node widens it to P010.
+        bool isMain10 = sourceConfig_.GetVideoCodecType() == VideoCodecType::CODEC_H265 &&
+            sourceConfig_.GetHdrType() != VideoHdrType::NONE;
+        return isMain10 ? Videoformat::P010 : Videoformat::YUVI420;
+    }
+    if (targetConfig_.GetVideoformat() == Videoformat::NV12) {
+        return Videoformat::NV12;
+    }
+    auto iter = std::find(bounds_.pixelFormats.begin(), bounds_.pixelFormats.end(),
+        static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::NV21));
+    if (targetConfig_.GetVideoformat() == Videoformat::NV21 && iter != bounds_.pixelFormats.end()) {
+        return Videoformat::NV21;
+    }
+    return Videoformat::YUVI420;
+}
+
 int32_t DecodeDataProcess::SetDecoderOutputSurface()
 {
     DHLOGD("Set the video decoder output surface.");
@@ -303,16 +423,26 @@ void DecodeDataProcess::ReleaseVideoDecoder()
     DHLOGD("Start release videoDecoder.");
     std::lock_guard<std::mutex> inputLock(mtxDecoderLock_);
     std::lock_guard<std::mutex> outputLock(mtxDecoderState_);
+    if (!arbiterKey_.empty()) {
+        DCameraDecoderArbiter::GetInstance().Release(arbiterKey_);
+    }
     if (videoDecoder_ == nullptr) {
         DHLOGE("The video decoder does not exist before ReleaseVideoDecoder.");
         decodeVideoCallback_ = nullptr;
         return;
     }
     int32_t ret = StopVideoDecoder();
-    CHECK_AND_LOG(ret != DCAMERA_OK, "%{public}s", "StopVideoDecoder failed.");
-    ret = videoDecoder_->Release();
-    CHECK_AND_LOG(ret != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK,
-        "VideoDecoder release failed. ret %{public}d.", ret);
+    if (ret == DCAMERA_OK && !isSoftwareDecoder_) {
+        DCameraCodecPool::GetInstance().ReturnDecoder(processType_, sourceConfig_.GetWidth(),
+            sourceConfig_.GetHeight(), videoDecoder_);
+    } else {
+        if (ret != DCAMERA_OK) {
+            DHLOGE("StopVideoDecoder failed, release the decoder.");
+        }
+        ret = videoDecoder_->Release();
+        CHECK_AND_LOG(ret != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK,
+            "VideoDecoder release failed. ret %{public}d.", ret);
+    }
     videoDecoder_ = nullptr;
     decodeVideoCallback_ = nullptr;
 }
@@ -334,13 +464,12 @@ void DecodeDataProcess::ReleaseCodecEvent()
 {
     {
         std::lock_guard<std::mutex> lock(eventMutex_);
-        if ((decEventHandler_ != nullptr) && (decEventHandler_->GetEventRunner() != nullptr)) {
-            decEventHandler_->GetEventRunner()->Stop();
-            eventThread_.join();
+        if (decEventQueue_ != nullptr) {
+            decEventQueue_->Stop();
         }
-        decEventHandler_ = nullptr;
+        decEventQueue_ = nullptr;
     }
-    pipeSrcEventHandler_ = nullptr;
+    pipeSrcEventQueue_ = nullptr;
     DHLOGD("Release DecodeNode eventBusDecode and eventBusPipeline end.");
 }
 
@@ -351,11 +480,17 @@ void DecodeDataProcess::ReleaseProcessNode()
     ReleaseVideoDecoder();
     ReleaseDecoderSurface();
     ReleaseCodecEvent();
+    CloseFrameDumps();
 
     processType_ = "";
     std::queue<std::shared_ptr<DataBuffer>>().swap(inputBuffersQueue_);
     std::queue<uint32_t>().swap(availableInputIndexsQueue_);
     std::queue<std::shared_ptr<Media::AVSharedMemory>>().swap(availableInputBufferQueue_);
+    {
+        std::lock_guard<std::mutex> lock(mtxHoldCount_);
+        boundInputSlots_.clear();
+        isInputStarved_ = false;
+    }
     std::queue<EisInfo>().swap(eisInfoQueue_);
     {
         std::lock_guard<std::mutex> lock(mtxDequeLock_);
@@ -375,11 +510,13 @@ void DecodeDataProcess::ReleaseProcessNode()
 
 int32_t DecodeDataProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>& inputBuffers)
 {
-    DHLOGI("Process data in DecodeDataProcess.");
+    DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "Process data in DecodeDataProcess.");
     if (inputBuffers.empty() || inputBuffers[0] == nullptr) {
         DHLOGE("The input data buffers is empty.");
         return DCAMERA_BAD_VALUE;
     }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_DECODE, inputBuffers[0]->frameInfo_.index);
+    DCameraNodeStatsScope statsScope(stats_, inputBuffers.size());
     DumpFileUtil::OpenDumpFile(DUMP_SERVER_PARA, DUMP_DCAMERA_BEFORE_DEC_FILENAME, &dumpDecBeforeFile_);
     DumpFileUtil::OpenDumpFile(DUMP_SERVER_PARA, DUMP_DCAMERA_AFTER_DEC_FILENAME, &dumpDecAfterFile_);
     if (sourceConfig_.GetVideoCodecType() == processedConfig_.GetVideoCodecType()) {
@@ -394,9 +531,10 @@ int32_t DecodeDataProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>&
     }
     if (inputBuffersQueue_.size() > VIDEO_DECODER_QUEUE_MAX) {
         DHLOGE("video decoder input buffers queue over flow.");
+        CountDroppedFrames(DCAMERA_DROP_DECODE_QUEUE_FULL, inputBuffers.size());
         return DCAMERA_INDEX_OVERFLOW;
     }
-    if (inputBuffers[0]->Size() > MAX_YUV420_BUFFER_SIZE) {
+    if (inputBuffers[0]->Size() > static_cast<size_t>(maxInputSize_)) {
         DHLOGE("DecodeNode input buffer size %{public}zu error.", inputBuffers[0]->Size());
         return DCAMERA_MEMORY_OPT_ERROR;
     }
@@ -405,24 +543,29 @@ int32_t DecodeDataProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>&
         return DCAMERA_DISABLE_PROCESS;
     }
     inputBuffersQueue_.push(inputBuffers[0]);
+    stats_.SetQueueDepth(inputBuffersQueue_.size());
     DHLOGD("Push inputBuf sucess. BufSize %{public}zu, QueueSize %{public}zu.", inputBuffers[0]->Size(),
         inputBuffersQueue_.size());
     int32_t err = FeedDecoderInputBuffer();
     if (err != DCAMERA_OK) {
-        int32_t sleepTimeUs = 5000;
-        std::this_thread::sleep_for(std::chrono::microseconds(sleepTimeUs));
-        DHLOGD("Feed decoder input buffer failed. Try FeedDecoderInputBuffer again.");
-        auto sendFunc = [this]() mutable {
-            int32_t ret = FeedDecoderInputBuffer();
-            DHLOGD("excute FeedDecoderInputBuffer ret %{public}d.", ret);
-        };
-        CHECK_AND_RETURN_RET_LOG(pipeSrcEventHandler_ == nullptr, DCAMERA_BAD_VALUE,
-            "%{public}s", "pipeSrcEventHandler_ is nullptr.");
-        pipeSrcEventHandler_->PostTask(sendFunc);
+        DHLOGD("Feed decoder input buffer stopped, ret %{public}d. The rest is fed on the next input slot.", err);
     }
     return DCAMERA_OK;
 }
 
+void DecodeDataProcess::PostFeedDecoderInputBuffer()
+{
+    std::weak_ptr<DecodeDataProcess> weakDecoder = shared_from_this();
+    auto sendFunc = [weakDecoder]() {
+        std::shared_ptr<DecodeDataProcess> decoder = weakDecoder.lock();
+        CHECK_AND_RETURN_LOG(decoder == nullptr, "%{public}s", "Decoder node is released.");
+        int32_t ret = decoder->FeedDecoderInputBuffer();
+        DHLOGD("excute FeedDecoderInputBuffer ret %{public}d.", ret);
+    };
+    CHECK_AND_RETURN_LOG(pipeSrcEventQueue_ == nullptr, "%{public}s", "pipeSrcEventQueue_ is nullptr.");
+    pipeSrcEventQueue_->PostTask(sendFunc);
+}
+
 void DecodeDataProcess::BeforeDecodeDump(uint8_t *buffer, size_t bufSize)
 {
 #ifdef DUMP_DCAMERA_FILE
@@ -430,16 +573,30 @@ void DecodeDataProcess::BeforeDecodeDump(uint8_t *buffer, size_t bufSize)
         DHLOGE("dumpsaving : input param nullptr.");
         return;
     }
-    if (DcameraHidumper::GetInstance().GetDumpFlag() && (IsUnderDumpMaxSize(DUMP_PATH, BEFORE_DECODE) == DCAMERA_OK)) {
-        DumpBufferToFile(DUMP_PATH, BEFORE_DECODE, buffer, bufSize);
+    if (DcameraHidumper::GetInstance().GetDumpFlag()) {
+        DCameraDumpWriter::GetInstance().Write(DUMP_PATH, BEFORE_DECODE, buffer, bufSize);
     }
 #endif
     return;
 }
 
+std::string DecodeDataProcess::GetAfterDecodeDumpName() const
+{
+    return "SourceAfterDecode_width(" + std::to_string(processedConfig_.GetWidth()) + ")height("
+        + std::to_string(processedConfig_.GetHeight()) + ").yuv";
+}
+
+void DecodeDataProcess::CloseFrameDumps()
+{
+#ifdef DUMP_DCAMERA_FILE
+    DCameraDumpWriter::GetInstance().Close(DUMP_PATH, BEFORE_DECODE);
+    DCameraDumpWriter::GetInstance().Close(DUMP_PATH, GetAfterDecodeDumpName());
+#endif
+}
+
 int32_t DecodeDataProcess::FeedDecoderInputBuffer()
 {
-    DHLOGI("Feed decoder input buffer.");
+    DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "Feed decoder input buffer.");
     while ((!inputBuffersQueue_.empty()) && (isDecoderProcess_.load())) {
         int32_t ret = ProcessSingleInputBuffer();
         if (ret != DCAMERA_OK) {
@@ -456,14 +613,20 @@ int32_t DecodeDataProcess::ProcessSingleInputBuffer()
     if (buffer == nullptr) {
         DHLOGE("Input buffer is null, skipping this frame.");
         inputBuffersQueue_.pop();
+        stats_.SetQueueDepth(inputBuffersQueue_.size());
         return DCAMERA_OK;
     }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_DECODE_FEED, buffer->frameInfo_.index);
     uint32_t index;
     std::shared_ptr<Media::AVSharedMemory> sharedMemoryInput;
-    int32_t ret = GetAvailableDecoderBuffer(index, sharedMemoryInput);
+    bool isBoundSlot = GetBoundInputSlot(buffer.get(), index, sharedMemoryInput);
+    int32_t ret = isBoundSlot ? DCAMERA_OK : GetAvailableDecoderBuffer(index, sharedMemoryInput);
     CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, ret,
         "Get available decoder buffer failed. ret %{public}d.", ret);
     buffer->frameInfo_.timePonit.startDecode = GetNowTimeStampUs();
+    if (buffer->frameInfo_.timePonit.recv != 0) {
+        stats_.AddWaitTime(buffer->frameInfo_.timePonit.startDecode - buffer->frameInfo_.timePonit.recv);
+    }
     buffer->eisInfo_.frameId = buffer->frameInfo_.index;
     buffer->eisInfo_.frameTimeStamp = buffer->frameInfo_.rawTime;
     eisInfoQueue_.push(buffer->eisInfo_);
@@ -475,9 +638,14 @@ int32_t DecodeDataProcess::ProcessSingleInputBuffer()
     CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, ret,
         "Queue buffer to decoder failed. ret %{public}d.", ret);
     inputBuffersQueue_.pop();
+    stats_.SetQueueDepth(inputBuffersQueue_.size());
     DHLOGD("Push inputBuffer sucess. inputBuffersQueue size is %{public}zu.", inputBuffersQueue_.size());
 
-    IncreaseWaitDecodeCnt();
+    if (isBoundSlot) {
+        ConsumeBoundInputSlot(buffer.get());
+    } else {
+        IncreaseWaitDecodeCnt();
+    }
     return DCAMERA_OK;
 }
 
@@ -487,6 +655,7 @@ int32_t DecodeDataProcess::GetAvailableDecoderBuffer(uint32_t& index,
     std::lock_guard<std::mutex> lock(mtxHoldCount_);
     if (availableInputIndexsQueue_.empty() || availableInputBufferQueue_.empty()) {
         DHLOGD("No available decoder buffers, wait for callback.");
+        isInputStarved_ = true;
         return DCAMERA_BAD_VALUE;
     }
     index = availableInputIndexsQueue_.front();
@@ -494,6 +663,94 @@ int32_t DecodeDataProcess::GetAvailableDecoderBuffer(uint32_t& index,
     return DCAMERA_OK;
 }
 
+std::shared_ptr<DataBuffer> DecodeDataProcess::AcquireInputBuffer(size_t capacity)
+{
+    if (!isDecoderProcess_.load() || sourceConfig_.GetVideoCodecType() == processedConfig_.GetVideoCodecType()) {
+        return DataBuffer::Acquire(capacity);
+    }
+    uint32_t index = 0;
+    std::shared_ptr<Media::AVSharedMemory> sharedMemoryInput = nullptr;
+    {
+        std::lock_guard<std::mutex> lck(mtxHoldCount_);
+        // Keep a slot back so frames already waiting in inputBuffersQueue_ can still be fed.
+        if (availableInputIndexsQueue_.size() <= MIN_RESERVED_INPUT_SLOTS ||
+            availableInputBufferQueue_.size() <= MIN_RESERVED_INPUT_SLOTS) {
+            return DataBuffer::Acquire(capacity);
+        }
+        sharedMemoryInput = availableInputBufferQueue_.front();
+        if (sharedMemoryInput == nullptr || sharedMemoryInput->GetBase() == nullptr ||
+            sharedMemoryInput->GetSize() < 0 || static_cast<size_t>(sharedMemoryInput->GetSize()) < capacity) {
+            return DataBuffer::Acquire(capacity);
+        }
+        index = availableInputIndexsQueue_.front();
+        availableInputIndexsQueue_.pop();
+        stats_.SetAvailableSlots(availableInputIndexsQueue_.size());
+        availableInputBufferQueue_.pop();
+    }
+    std::weak_ptr<DecodeDataProcess> weakDecoder = shared_from_this();
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Attach(sharedMemoryInput->GetBase(), capacity,
+        [weakDecoder, sharedMemoryInput](DataBuffer *attached) {
+            std::shared_ptr<DecodeDataProcess> decoder = weakDecoder.lock();
+            if (decoder != nullptr) {
+                decoder->RecycleBoundInputSlot(attached);
+            }
+        });
+    std::lock_guard<std::mutex> lck(mtxHoldCount_);
+    if (buffer == nullptr) {
+        availableInputIndexsQueue_.push(index);
+        stats_.SetAvailableSlots(availableInputIndexsQueue_.size());
+        availableInputBufferQueue_.push(sharedMemoryInput);
+        return DataBuffer::Acquire(capacity);
+    }
+    boundInputSlots_[buffer.get()] = { index, sharedMemoryInput };
+    DHLOGD("Bind decoder input slot %{public}u to receive buffer, size %{public}zu.", index, capacity);
+    return buffer;
+}
+
+bool DecodeDataProcess::GetBoundInputSlot(const DataBuffer *buffer, uint32_t& index,
+    std::shared_ptr<Media::AVSharedMemory>& sharedMemoryInput)
+{
+    std::lock_guard<std::mutex> lck(mtxHoldCount_);
+    auto iter = boundInputSlots_.find(buffer);
+    if (iter == boundInputSlots_.end()) {
+        return false;
+    }
+    index = iter->second.index;
+    sharedMemoryInput = iter->second.memory;
+    return true;
+}
+
+void DecodeDataProcess::ConsumeBoundInputSlot(const DataBuffer *buffer)
+{
+    std::lock_guard<std::mutex> lck(mtxHoldCount_);
+    boundInputSlots_.erase(buffer);
+    waitDecoderOutputCount_++;
+    DHLOGD("Wait decoder output frames number is %{public}d.", waitDecoderOutputCount_);
+}
+
+void DecodeDataProcess::RecycleBoundInputSlot(const DataBuffer *buffer)
+{
+    bool needFeed = false;
+    {
+        std::lock_guard<std::mutex> lck(mtxHoldCount_);
+        auto iter = boundInputSlots_.find(buffer);
+        if (iter == boundInputSlots_.end()) {
+            return;
+        }
+        if (isDecoderProcess_.load()) {
+            availableInputIndexsQueue_.push(iter->second.index);
+            stats_.SetAvailableSlots(availableInputIndexsQueue_.size());
+            availableInputBufferQueue_.push(iter->second.memory);
+            needFeed = isInputStarved_;
+            isInputStarved_ = false;
+        }
+        boundInputSlots_.erase(iter);
+    }
+    if (needFeed) {
+        PostFeedDecoderInputBuffer();
+    }
+}
+
 int32_t DecodeDataProcess::QueueBufferToDecoder(std::shared_ptr<DataBuffer>& buffer, uint32_t index,
     std::shared_ptr<Media::AVSharedMemory>& sharedMemoryInput)
 {
@@ -511,9 +768,11 @@ int32_t DecodeDataProcess::QueueBufferToDecoder(std::shared_ptr<DataBuffer>& buf
     BeforeDecodeDump(buffer->Data(), buffer->Size());
     DumpFileUtil::WriteDumpFile(dumpDecBeforeFile_, static_cast<void *>(buffer->Data()), buffer->Size());
 
-    size_t inputMemoDataSize = static_cast<size_t>(sharedMemoryInput->GetSize());
-    errno_t err = memcpy_s(sharedMemoryInput->GetBase(), inputMemoDataSize, buffer->Data(), buffer->Size());
-    CHECK_AND_RETURN_RET_LOG(err != EOK, DCAMERA_MEMORY_OPT_ERROR, "memcpy_s buffer failed.");
+    if (buffer->Data() != sharedMemoryInput->GetBase()) {
+        size_t inputMemoDataSize = static_cast<size_t>(sharedMemoryInput->GetSize());
+        errno_t err = memcpy_s(sharedMemoryInput->GetBase(), inputMemoDataSize, buffer->Data(), buffer->Size());
+        CHECK_AND_RETURN_RET_LOG(err != EOK, DCAMERA_MEMORY_OPT_ERROR, "memcpy_s buffer failed.");
+    }
     DHLOGD("Decoder input buffer size %{public}zu, timeStamp %{public}" PRId64"us.", buffer->Size(), timeStamp);
     MediaAVCodec::AVCodecBufferInfo bufferInfo {timeStamp, static_cast<int32_t>(buffer->Size()), 0};
     int32_t ret = videoDecoder_->QueueInputBuffer(index, bufferInfo, MediaAVCodec::AVCODEC_BUFFER_FLAG_NONE);
@@ -538,6 +797,7 @@ void DecodeDataProcess::IncreaseWaitDecodeCnt()
 {
     std::lock_guard<std::mutex> lck(mtxHoldCount_);
     availableInputIndexsQueue_.pop();
+    stats_.SetAvailableSlots(availableInputIndexsQueue_.size());
     availableInputBufferQueue_.pop();
     waitDecoderOutputCount_++;
     DHLOGD("Wait decoder output frames number is %{public}d.", waitDecoderOutputCount_);
@@ -564,14 +824,14 @@ void DecodeDataProcess::OnSurfaceOutputBufferAvailable(const sptr<IConsumerSurfa
         DHLOGD("excute GetDecoderOutputBuffer.");
     };
     std::lock_guard<std::mutex> lock(eventMutex_);
-    if (decEventHandler_ != nullptr) {
-        decEventHandler_->PostTask(sendFunc);
+    if (decEventQueue_ != nullptr) {
+        decEventQueue_->PostTask(sendFunc);
     }
 }
 
 void DecodeDataProcess::GetDecoderOutputBuffer(const sptr<IConsumerSurface>& surface)
 {
-    DHLOGI("Get decoder output buffer.");
+    DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "Get decoder output buffer.");
     if (surface == nullptr) {
         DHLOGE("Get decode consumer surface failed.");
         return;
@@ -592,202 +852,18 @@ void DecodeDataProcess::GetDecoderOutputBuffer(const sptr<IConsumerSurface>& sur
         DHLOGE("surface buffer size or alignedWidth too long");
         return;
     }
-    int32_t alignedHeight = alignedHeight_;
-    DHLOGD("OutputBuffer alignedWidth %{public}d, alignedHeight %{public}d, timeStamp %{public}ld ns.",
-        alignedWidth, alignedHeight, timeStamp);
-    CopyDecodedImage(surfaceBuffer, alignedWidth, alignedHeight);
+    {
+        std::lock_guard<std::mutex> lock(mtxOutputConfig_);
+        int32_t alignedHeight = alignedHeight_;
+        DHLOGD("OutputBuffer alignedWidth %{public}d, alignedHeight %{public}d, timeStamp %{public}ld ns.",
+            alignedWidth, alignedHeight, timeStamp);
+        CopyDecodedImage(surfaceBuffer, alignedWidth, alignedHeight);
+    }
     surface->ReleaseBuffer(surfaceBuffer, -1);
     outputTimeStampUs_ = timeStamp;
     ReduceWaitDecodeCnt();
 }
 
-OpenSourceLibyuv::RotationMode DecodeDataProcess::ParseAngle(int angleDegrees)
-{
-    const int normalizedAngle = (angleDegrees % ROTATION_360 + ROTATION_360) % ROTATION_360;
-    switch (normalizedAngle) {
-        case ROTATION_0:   return OpenSourceLibyuv::RotationMode::kRotate0;
-        case ROTATION_90:  return OpenSourceLibyuv::RotationMode::kRotate90;
-        case ROTATION_180: return OpenSourceLibyuv::RotationMode::kRotate180;
-        case ROTATION_270: return OpenSourceLibyuv::RotationMode::kRotate270;
-        default: return OpenSourceLibyuv::RotationMode::kRotate0;
-    }
-}
-
-bool DecodeDataProcess::I420CopyBySystemSwitch(ImageDataInfo srcInfo, ImageDataInfo dstInfo, int srcWidth,
-    int srcHeight, int32_t normalizedAngle)
-{
-    int32_t cropWidth = 0;
-    int32_t cropHeight = 0;
-    int32_t pasteX = 0;
-    int32_t pasteY = 0;
-    if (normalizedAngle == ROTATION_90 || normalizedAngle == ROTATION_270) {
-        const int32_t min_dimension = std::min(srcWidth, srcHeight);
-        cropWidth = min_dimension;
-        cropHeight = min_dimension;
-        pasteX = (srcWidth - min_dimension) / Y2UV_RATIO;
-        pasteY = (srcHeight - min_dimension) / Y2UV_RATIO;
-    } else {
-        cropWidth = srcWidth;
-        cropHeight = srcHeight;
-        pasteX = 0;
-        pasteY = 0;
-    }
-    int32_t cropX = 0;
-    int32_t cropY = 0;
-    if (normalizedAngle == ROTATION_90 || normalizedAngle == ROTATION_270) {
-        cropX = (srcInfo.width - cropWidth) / Y2UV_RATIO;
-        cropY = (srcInfo.height - cropHeight) / Y2UV_RATIO;
-    } else {
-        cropX = 0;
-        cropY = 0;
-    }
-    cropX = static_cast<uint32_t>(cropX) & ~1;
-    cropY = static_cast<uint32_t>(cropY) & ~1;
-    pasteX = static_cast<uint32_t>(pasteX) & ~1;
-    pasteY = static_cast<uint32_t>(pasteY) & ~1;
-    uint8_t* srcDataY = srcInfo.dataY + cropY * srcInfo.strideY + cropX;
-    uint8_t* srcDataU = srcInfo.dataU + (cropY / Y2UV_RATIO) * srcInfo.strideU + (cropX / Y2UV_RATIO);
-    uint8_t* srcDataV = srcInfo.dataV + (cropY / Y2UV_RATIO) * srcInfo.strideV + (cropX / Y2UV_RATIO);
-
-    uint8_t* dstDataY = dstInfo.dataY + pasteY * dstInfo.strideY + pasteX;
-    uint8_t* dstDataU = dstInfo.dataU + (pasteY / Y2UV_RATIO) * dstInfo.strideU + (pasteX / Y2UV_RATIO);
-    uint8_t* dstDataV = dstInfo.dataV + (pasteY / Y2UV_RATIO) * dstInfo.strideV + (pasteX / Y2UV_RATIO);
-    auto converter = ConverterHandle::GetInstance().GetHandle();
-    return converter.I420Copy(srcDataY, srcInfo.strideY, srcDataU, srcInfo.strideU, srcDataV,
-        srcInfo.strideV, dstDataY, dstInfo.strideY, dstDataU, dstInfo.strideU, dstDataV, dstInfo.strideV,
-        cropWidth, cropHeight) == 0;
-}
-
-bool DecodeDataProcess::CheckParameters(ImageDataInfo srcInfo, ImageDataInfo dstInfo)
-{
-    if (!srcInfo.dataY || !srcInfo.dataU || !dstInfo.dataY || !dstInfo.dataU || !dstInfo.dataV) {
-        return false;
-    }
-    if (srcInfo.width <= 0 || srcInfo.height <= 0) {
-        return false;
-    }
-    if ((srcInfo.width % Y2UV_RATIO != 0) || (srcInfo.height % Y2UV_RATIO != 0)) {
-        return false;
-    }
-    return true;
-}
-
-bool DecodeDataProcess::UniversalRotateCropAndPadNv12ToI420(ImageDataInfo srcInfo, ImageDataInfo dstInfo,
-    int angleDegrees)
-{
-    if (!CheckParameters(srcInfo, dstInfo)) {
-        return false;
-    }
-    const int normalizedAngle = (angleDegrees % ROTATION_360 + ROTATION_360) % ROTATION_360;
-    OpenSourceLibyuv::RotationMode rotationMode = ParseAngle(normalizedAngle);
-    int rotatedNaturalWidth = srcInfo.width;
-    int rotatedNaturalHeight = srcInfo.height;
-    if (normalizedAngle == ROTATION_90 || normalizedAngle == ROTATION_270) {
-        rotatedNaturalWidth = srcInfo.height;
-        rotatedNaturalHeight = srcInfo.width;
-    }
-    bool needs_crop_and_pad = (rotatedNaturalWidth != srcInfo.width) ||
-        (rotatedNaturalHeight != srcInfo.height);
-    auto converter = ConverterHandle::GetInstance().GetHandle();
-    if (!needs_crop_and_pad) {
-        return converter.NV12ToI420Rotate(srcInfo.dataY, srcInfo.strideY, srcInfo.dataU, srcInfo.strideU,
-            dstInfo.dataY, dstInfo.strideY, dstInfo.dataU, dstInfo.strideU, dstInfo.dataV, dstInfo.strideV,
-            srcInfo.width, srcInfo.height, rotationMode) == 0;
-    }
-    int ret = converter.I420Rect(dstInfo.dataY,  dstInfo.strideY, dstInfo.dataU, dstInfo.strideU, dstInfo.dataV,
-        dstInfo.strideV, OFFSET_X_0, OFFSET_Y_0, srcInfo.width, srcInfo.height, BLACK_COLOR_PEXEL,
-        WHITE_COLOR_PEXEL, WHITE_COLOR_PEXEL);
-    if (ret != 0) {
-        DHLOGE("I420Rect fail ret = %{public}d", ret);
-        return false;
-    }
-    std::vector<uint8_t> rotatedBuffer(
-        rotatedNaturalWidth * rotatedNaturalHeight * YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
-    uint8_t* rotatedY = rotatedBuffer.data();
-    uint8_t* rotatedU = rotatedY + rotatedNaturalWidth * rotatedNaturalHeight;
-    uint8_t* rotatedV = rotatedU + (rotatedNaturalWidth * rotatedNaturalHeight) / RGB32_MEMORY_COEFFICIENT;
-    int rotatedStrideY = rotatedNaturalWidth;
-    int rotatedStrideU = (rotatedNaturalWidth + 1) / Y2UV_RATIO;
-    int rotatedStrideV = (rotatedNaturalWidth + 1) / Y2UV_RATIO;
-    int rotateResult = converter.NV12ToI420Rotate(
-        srcInfo.dataY, srcInfo.strideY, srcInfo.dataU, srcInfo.strideU,
-        rotatedY, rotatedStrideY, rotatedU, rotatedStrideU, rotatedV, rotatedStrideV,
-        srcInfo.width, srcInfo.height, rotationMode);
-    if (rotateResult != 0) {
-        DHLOGE("NV12ToI420RotateBySystemSwitch fail");
-        return false;
-    }
-    ImageDataInfo rotateInfo = { .width = rotatedNaturalWidth, .height = rotatedNaturalHeight, .dataY = rotatedY,
-        .strideY = rotatedStrideY, .dataU = rotatedU, .strideU = rotatedStrideU, .dataV = rotatedV,
-        .strideV = rotatedStrideV };
-    return I420CopyBySystemSwitch(rotateInfo, dstInfo, srcInfo.width, srcInfo.height, normalizedAngle);
-}
-
-bool DecodeDataProcess::FreeYUVBuffer(uint8_t*& dataY, uint8_t*& dataU, uint8_t*& dataV)
-{
-    if (dataY != nullptr) {
-        free(dataY);
-        dataY = nullptr;
-    }
-    if (dataU != nullptr) {
-        free(dataU);
-        dataU = nullptr;
-    }
-    if (dataV != nullptr) {
-        free(dataV);
-        dataV = nullptr;
-    }
-    return true;
-}
-
-bool DecodeDataProcess::ConvertToI420BySystemSwitch(uint8_t *srcDataY, uint8_t *srcDataUV, int32_t alignedWidth,
-    int32_t alignedHeight, std::shared_ptr<DataBuffer> bufferOutput)
-{
-    int dstSizeY = sourceConfig_.GetWidth() * sourceConfig_.GetHeight();
-    int dstSizeUV = (static_cast<uint32_t>(sourceConfig_.GetWidth()) >> MEMORY_RATIO_UV) *
-                    (static_cast<uint32_t>(sourceConfig_.GetHeight()) >> MEMORY_RATIO_UV);
-    uint8_t *dstDataY = static_cast<uint8_t*>(aligned_alloc(16, dstSizeY));
-    uint8_t *dstDataU = static_cast<uint8_t*>(aligned_alloc(16, dstSizeUV));
-    uint8_t *dstDataV = static_cast<uint8_t*>(aligned_alloc(16, dstSizeUV));
-
-    if (dstDataY == nullptr || dstDataU == nullptr || dstDataV == nullptr) {
-        DHLOGE("aligned_alloc buffer failed.");
-        FreeYUVBuffer(dstDataY, dstDataU, dstDataV);
-        return false;
-    }
-
-    int width = sourceConfig_.GetWidth();
-    int dstStrideY = width;
-    int dstStrideUV = width / Y2UV_RATIO;
-    ImageDataInfo srcInfo = { .width = sourceConfig_.GetWidth(), .height = sourceConfig_.GetHeight(),
-        .dataY = srcDataY, .strideY = alignedWidth, .dataU = srcDataUV, .strideU = alignedWidth };
-    ImageDataInfo dstInfo = { .dataY = dstDataY, .strideY = dstStrideY, .dataU = dstDataU, .strideU = dstStrideUV,
-        .dataV = dstDataV, .strideV = dstStrideUV };
-    bool result = UniversalRotateCropAndPadNv12ToI420(srcInfo, dstInfo, rotate_);
-    if (!result) {
-        DHLOGE("Convert NV12 to I420 failed.");
-        FreeYUVBuffer(dstDataY, dstDataU, dstDataV);
-        return false;
-    }
-    if (memcpy_s(bufferOutput->Data(), dstSizeY, dstDataY, dstSizeY) != EOK) {
-        DHLOGE("memcpy_s buffer failed.");
-        FreeYUVBuffer(dstDataY, dstDataU, dstDataV);
-        return false;
-    }
-    if (memcpy_s(bufferOutput->Data() + dstSizeY, dstSizeUV, dstDataU, dstSizeUV) != EOK) {
-        DHLOGE("memcpy_s buffer failed.");
-        FreeYUVBuffer(dstDataY, dstDataU, dstDataV);
-        return false;
-    }
-    if (memcpy_s(bufferOutput->Data() + dstSizeY + dstSizeUV, dstSizeUV, dstDataV, dstSizeUV) != EOK) {
-        DHLOGE("memcpy_s buffer failed.");
-        FreeYUVBuffer(dstDataY, dstDataU, dstDataV);
-        return false;
-    }
-    FreeYUVBuffer(dstDataY, dstDataU, dstDataV);
-    return true;
-}
-
 bool DecodeDataProcess::ConvertToI420(uint8_t *srcDataY, uint8_t *srcDataUV, int32_t alignedWidth,
     int32_t alignedHeight, std::shared_ptr<DataBuffer> bufferOutput)
 {
@@ -798,16 +874,50 @@ bool DecodeDataProcess::ConvertToI420(uint8_t *srcDataY, uint8_t *srcDataUV, int
     uint8_t *dstDataU = bufferOutput->Data() + dstSizeY;
     uint8_t *dstDataV = bufferOutput->Data() + dstSizeY + dstSizeUV;
 
+    int32_t dstStrideUV = static_cast<int32_t>(static_cast<uint32_t>(sourceConfig_.GetWidth()) >> MEMORY_RATIO_UV);
     auto converter = ConverterHandle::GetInstance().GetHandle();
-    CHECK_AND_RETURN_RET_LOG(converter.NV12ToI420 == nullptr, false, "converter is null.");
+    if (converter.NV12ToI420 == nullptr) {
+        DHLOGD("converter is null, use plane kernels: %{public}s.", ImagePlaneKernels::GetIsaName());
+        int32_t err = ImagePlaneKernels::NV12ToI420(srcDataY, alignedWidth, srcDataUV, alignedWidth, dstDataY,
+            sourceConfig_.GetWidth(), dstDataU, dstStrideUV, dstDataV, dstStrideUV, processedConfig_.GetWidth(),
+            processedConfig_.GetHeight());
+        CHECK_AND_RETURN_RET_LOG(err != DCAMERA_OK, false, "Convert NV12 to I420 failed.");
+        return true;
+    }
     int32_t ret = converter.NV12ToI420(srcDataY, alignedWidth, srcDataUV, alignedWidth, dstDataY,
-        sourceConfig_.GetWidth(), dstDataU, static_cast<uint32_t>(sourceConfig_.GetWidth()) >> MEMORY_RATIO_UV,
-        dstDataV, static_cast<uint32_t>(sourceConfig_.GetWidth()) >> MEMORY_RATIO_UV,
+        sourceConfig_.GetWidth(), dstDataU, dstStrideUV, dstDataV, dstStrideUV,
         processedConfig_.GetWidth(), processedConfig_.GetHeight());
     CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, false, "Convert NV12 to I420 failed.");
     return true;
 }
 
+void DecodeDataProcess::CopySemiPlanar(uint8_t *srcDataY, uint8_t *srcDataUV, int32_t alignedWidth,
+    std::shared_ptr<DataBuffer> bufferOutput)
+{
+    int32_t width = processedConfig_.GetWidth();
+    int32_t height = processedConfig_.GetHeight();
+    uint8_t *dstDataY = bufferOutput->Data();
+    uint8_t *dstDataUV = bufferOutput->Data() + width * height;
+    ImagePlaneKernels::CopyPlane(srcDataY, alignedWidth, dstDataY, width, width, height);
+    ImagePlaneKernels::CopyPlane(srcDataUV, alignedWidth, dstDataUV, width, width,
+        static_cast<int32_t>(static_cast<uint32_t>(height) >> MEMORY_RATIO_UV));
+}
+
+bool DecodeDataProcess::CopyP010(uint8_t *srcDataY, uint8_t *srcDataUV, int32_t alignedWidth,
+    std::shared_ptr<DataBuffer> bufferOutput)
+{
+    int32_t width = processedConfig_.GetWidth();
+    int32_t height = processedConfig_.GetHeight();
+    int32_t dstStride = width * P010_BYTES_PER_SAMPLE;
+    uint8_t *dstDataY = bufferOutput->Data();
+    uint8_t *dstDataUV = bufferOutput->Data() + dstStride * height;
+    ImagePlaneKernels::CopyPlane(srcDataY, alignedWidth, dstDataY, dstStride, dstStride, height);
+    // The decoder writes Cb first, the HDI P010 buffers take Cr first.
+    int32_t ret = YuvColorKernels::SwapP010UVOrder(srcDataUV, alignedWidth, dstDataUV, dstStride, width, height);
+    CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, false, "Copy P010 chroma failed.");
+    return true;
+}
+
 void DecodeDataProcess::CopyDecodedImage(const sptr<SurfaceBuffer>& surBuf, int32_t alignedWidth,
     int32_t alignedHeight)
 {
@@ -816,25 +926,30 @@ void DecodeDataProcess::CopyDecodedImage(const sptr<SurfaceBuffer>& surBuf, int3
         return;
     }
 
-    DHLOGD("Convert NV12 to I420, format=%{public}d, width=[%{public}d, %{public}d], height=[%{public}d, %{public}d]",
-        sourceConfig_.GetVideoformat(), sourceConfig_.GetWidth(), alignedWidth, sourceConfig_.GetHeight(),
+    DHLOGD("Copy decoded image to format=%{public}d, width=[%{public}d, %{public}d], height=[%{public}d, %{public}d]",
+        processedConfig_.GetVideoformat(), sourceConfig_.GetWidth(), alignedWidth, sourceConfig_.GetHeight(),
         alignedHeight);
     int srcSizeY = alignedWidth * alignedHeight;
     uint8_t *srcDataY = static_cast<uint8_t *>(surBuf->GetVirAddr());
     uint8_t *srcDataUV = static_cast<uint8_t *>(surBuf->GetVirAddr()) + srcSizeY;
 
-    int dstSizeY = sourceConfig_.GetWidth() * sourceConfig_.GetHeight();
-    std::shared_ptr<DataBuffer> bufferOutput =
-        std::make_shared<DataBuffer>(dstSizeY * YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
-    if (targetConfig_.GetIsSystemSwitch()) {
-        if (!ConvertToI420BySystemSwitch(srcDataY, srcDataUV, alignedWidth, alignedHeight, bufferOutput)) {
-            DHLOGE("Convert NV12 to I420 by systemSwitch failed.");
-            return;
-        }
-    } else {
-        if (!ConvertToI420(srcDataY, srcDataUV, alignedWidth, alignedHeight, bufferOutput)) {
+    int dstSizeY = sourceConfig_.GetWidth() * sourceConfig_.GetHeight() * GetBytesPerSample();
+    size_t dstSize = static_cast<size_t>(dstSizeY * YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
+    std::shared_ptr<DCameraPipelineSource> targetPipelineSource = callbackPipelineSource_.lock();
+    std::shared_ptr<DataBuffer> bufferOutput = (targetPipelineSource == nullptr) ? DataBuffer::Acquire(dstSize) :
+        targetPipelineSource->AcquireOutputBuffer(dstSize);
+    CHECK_AND_RETURN_LOG(bufferOutput == nullptr || bufferOutput->Size() != dstSize, "Acquire output buffer failed.");
+    if (targetPipelineSource == nullptr) {
+        OnBufferAllocated(bufferOutput, DCAMERA_MEMORY_DECODER);
+    }
+    if (processedConfig_.GetVideoformat() == Videoformat::P010) {
+        if (!CopyP010(srcDataY, srcDataUV, alignedWidth, bufferOutput)) {
             return;
         }
+    } else if (processedConfig_.GetVideoformat() != Videoformat::YUVI420) {
+        CopySemiPlanar(srcDataY, srcDataUV, alignedWidth, bufferOutput);
+    } else if (!ConvertToI420(srcDataY, srcDataUV, alignedWidth, alignedHeight, bufferOutput)) {
+        return;
     }
     {
         std::lock_guard<std::mutex> lock(mtxDequeLock_);
@@ -846,22 +961,26 @@ void DecodeDataProcess::CopyDecodedImage(const sptr<SurfaceBuffer>& surBuf, int3
         eisInfoQueue_.pop();
     }
     DHLOGD("get videoPts=%{public}" PRId64 " from decoder", bufferOutput->frameInfo_.rawTime);
-    bufferOutput->SetInt32("Videoformat", static_cast<int32_t>(Videoformat::YUVI420));
-    bufferOutput->SetInt32("alignedWidth", processedConfig_.GetWidth());
-    bufferOutput->SetInt32("alignedHeight", processedConfig_.GetHeight());
-    bufferOutput->SetInt32("width", processedConfig_.GetWidth());
-    bufferOutput->SetInt32("height", processedConfig_.GetHeight());
+    bufferOutput->SetInt32(DataBufferKey::VIDEO_FORMAT, static_cast<int32_t>(processedConfig_.GetVideoformat()));
+    bufferOutput->SetInt32(DataBufferKey::ALIGNED_WIDTH, processedConfig_.GetWidth());
+    bufferOutput->SetInt32(DataBufferKey::ALIGNED_HEIGHT, processedConfig_.GetHeight());
+    bufferOutput->SetInt32(DataBufferKey::WIDTH, processedConfig_.GetWidth());
+    bufferOutput->SetInt32(DataBufferKey::HEIGHT, processedConfig_.GetHeight());
 #ifdef DUMP_DCAMERA_FILE
-    std::string fileName = "SourceAfterDecode_width(" + std::to_string(processedConfig_.GetWidth())
-        + ")height(" + std::to_string(processedConfig_.GetHeight()) + ").yuv";
-    if (DcameraHidumper::GetInstance().GetDumpFlag() && (IsUnderDumpMaxSize(DUMP_PATH, fileName) == DCAMERA_OK)) {
-        DumpBufferToFile(DUMP_PATH, fileName, bufferOutput->Data(), bufferOutput->Size());
+    if (DcameraHidumper::GetInstance().GetDumpFlag()) {
+        DCameraDumpWriter::GetInstance().Write(DUMP_PATH, GetAfterDecodeDumpName(), bufferOutput->Data(),
+            bufferOutput->Size());
     }
 #endif
     DumpFileUtil::WriteDumpFile(dumpDecAfterFile_, static_cast<void *>(bufferOutput->Data()), bufferOutput->Size());
     PostOutputDataBuffers(bufferOutput);
 }
 
+int32_t DecodeDataProcess::GetBytesPerSample() const
+{
+    return (processedConfig_.GetVideoformat() == Videoformat::P010) ? P010_BYTES_PER_SAMPLE : 1;
+}
+
 bool DecodeDataProcess::IsCorrectSurfaceBuffer(const sptr<SurfaceBuffer>& surBuf, int32_t alignedWidth,
     int32_t alignedHeight)
 {
@@ -873,7 +992,7 @@ bool DecodeDataProcess::IsCorrectSurfaceBuffer(const sptr<SurfaceBuffer>& surBuf
     size_t yuvImageAlignedSize = static_cast<size_t>(alignedWidth * alignedHeight *
                                                               YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
     size_t yuvImageSize = static_cast<size_t>(sourceConfig_.GetWidth() * sourceConfig_.GetHeight() *
-                                                       YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
+        GetBytesPerSample() * YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
     size_t surfaceBufSize = static_cast<size_t>(surBuf->GetSize());
     if (yuvImageAlignedSize > surfaceBufSize || yuvImageAlignedSize < yuvImageSize) {
         DHLOGE("Buffer size error, yuvImageSize %{public}zu, yuvImageAlignedSize %{public}zu, surBufSize %{public}"
@@ -885,8 +1004,8 @@ bool DecodeDataProcess::IsCorrectSurfaceBuffer(const sptr<SurfaceBuffer>& surBuf
 
 void DecodeDataProcess::PostOutputDataBuffers(std::shared_ptr<DataBuffer>& outputBuffer)
 {
-    if (decEventHandler_ == nullptr || outputBuffer == nullptr) {
-        DHLOGE("decEventHandler_ or outputBuffer is null.");
+    if (decEventQueue_ == nullptr || outputBuffer == nullptr) {
+        DHLOGE("decEventQueue_ or outputBuffer is null.");
         return;
     }
     auto sendFunc = [this, outputBuffer]() mutable {
@@ -896,8 +1015,8 @@ void DecodeDataProcess::PostOutputDataBuffers(std::shared_ptr<DataBuffer>& outpu
         DHLOGD("excute DecodeDone ret %{public}d.", ret);
     };
     std::lock_guard<std::mutex> lock(eventMutex_);
-    if (decEventHandler_ != nullptr) {
-        decEventHandler_->PostTask(sendFunc);
+    if (decEventQueue_ != nullptr) {
+        decEventQueue_->PostTask(sendFunc);
     }
     DHLOGD("Send video decoder output asynchronous DCameraCodecEvents success.");
 }
@@ -910,6 +1029,11 @@ int32_t DecodeDataProcess::DecodeDone(std::vector<std::shared_ptr<DataBuffer>>&
         return DCAMERA_BAD_VALUE;
     }
 
+    std::shared_ptr<DCameraPipelineSource> targetPipelineSource = callbackPipelineSource_.lock();
+    if (targetPipelineSource != nullptr) {
+        targetPipelineSource->OnDecodedVideoBuffer(outputBuffers[0]);
+    }
+    stats_.OnFramesOut(outputBuffers.size());
     if (nextDataProcess_ != nullptr) {
         DHLOGD("Send to the next node of the decoder for processing.");
         int32_t err = nextDataProcess_->ProcessData(outputBuffers);
@@ -919,7 +1043,6 @@ int32_t DecodeDataProcess::DecodeDone(std::vector<std::shared_ptr<DataBuffer>>&
         return err;
     }
     DHLOGD("The current node is the last node, and Output the processed video buffer");
-    std::shared_ptr<DCameraPipelineSource> targetPipelineSource = callbackPipelineSource_.lock();
     if (targetPipelineSource == nullptr) {
         DHLOGE("callbackPipelineSource_ is nullptr.");
         return DCAMERA_BAD_VALUE;
@@ -946,14 +1069,23 @@ void DecodeDataProcess::OnError()
 void DecodeDataProcess::OnInputBufferAvailable(uint32_t index, std::shared_ptr<Media::AVSharedMemory> buffer)
 {
     DHLOGD("DecodeDataProcess::OnInputBufferAvailable");
-    std::lock_guard<std::mutex> lck(mtxHoldCount_);
-    if (availableInputIndexsQueue_.size() > VIDEO_DECODER_QUEUE_MAX) {
-        DHLOGE("Video decoder available indexs queue overflow.");
-        return;
+    bool needFeed = false;
+    {
+        std::lock_guard<std::mutex> lck(mtxHoldCount_);
+        if (availableInputIndexsQueue_.size() > VIDEO_DECODER_QUEUE_MAX) {
+            DHLOGE("Video decoder available indexs queue overflow.");
+            return;
+        }
+        DHLOGD("Video decoder available indexs queue push index [%{public}u].", index);
+        availableInputIndexsQueue_.push(index);
+        stats_.SetAvailableSlots(availableInputIndexsQueue_.size());
+        availableInputBufferQueue_.push(buffer);
+        needFeed = isInputStarved_;
+        isInputStarved_ = false;
+    }
+    if (needFeed && isDecoderProcess_.load()) {
+        PostFeedDecoderInputBuffer();
     }
-    DHLOGD("Video decoder available indexs queue push index [%{public}u].", index);
-    availableInputIndexsQueue_.push(index);
-    availableInputBufferQueue_.push(buffer);
 }
 
 void DecodeDataProcess::OnOutputFormatChanged(const Media::Format &format)
@@ -976,6 +1108,7 @@ void DecodeDataProcess::OnOutputBufferAvailable(uint32_t index, const MediaAVCod
     DHLOGD("Video decode buffer info: presentation TimeUs %{public}" PRId64", size %{public}d, offset %{public}d, "
         "flag %{public}d", info.presentationTimeUs, info.size, info.offset, flag);
     outputInfo_ = info;
+    int32_t frameIndex = DCAMERA_FRAME_TRACE_NO_INDEX;
     {
         std::lock_guard<std::mutex> lock(mtxDequeLock_);
         AlignFirstFrameTime();
@@ -985,10 +1118,12 @@ void DecodeDataProcess::OnOutputBufferAvailable(uint32_t index, const MediaAVCod
                 continue;
             }
             frameInfo.timePonit.finishDecode = finishDecodeT;
+            frameIndex = frameInfo.index;
             frameInfoDeque_.emplace(frameInfoDeque_.erase(it), frameInfo);
             break;
         }
     }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_DECODE_OUTPUT, frameIndex);
     {
         std::lock_guard<std::mutex> outputLock(mtxDecoderState_);
         if (videoDecoder_ == nullptr) {
@@ -1043,33 +1178,6 @@ int32_t DecodeDataProcess::UpdateSettings(const std::shared_ptr<Camera::CameraMe
         DHLOGE("settings is null");
         return DCAMERA_BAD_VALUE;
     }
-    if (!targetConfig_.GetIsSystemSwitch()) {
-        return DCAMERA_OK;
-    }
-    camera_metadata_item_t switchInfoItem;
-    int32_t result = OHOS::Camera::FindCameraMetadataItem(settings->get(),
-        OHOS_CONTROL_CAMERA_SWITCH_INFOS, &switchInfoItem);
-    if (result != CAM_META_SUCCESS || switchInfoItem.count == 0) {
-        DHLOGI("UpdateSettings get system switch setting fail");
-        return DCAMERA_OK;
-    }
-    int32_t cameraRotation = switchInfoItem.data.i32[0];
-    int32_t screenOrient = 0;
-    if (switchInfoItem.count > 1) {
-        screenOrient = switchInfoItem.data.i32[1];
-    }
-    
-    if (cameraRotation == ROTATION_90) {
-        if (screenOrient == ROTATION_180 || screenOrient == ROTATION_0) {
-            rotate_ = (screenOrient - cameraRotation + ROTATION_360) % ROTATION_360;
-        } else {
-            rotate_ = (screenOrient - cameraRotation + ROTATION_180) % ROTATION_360;
-        }
-    } else {
-        rotate_ = (screenOrient - cameraRotation + ROTATION_360) % ROTATION_360;
-    }
-    DHLOGI("UpdateSettings sensorRotation: %{public}d, screenOrient: %{public}d, img rotate: %{public}d",
-        cameraRotation, screenOrient, rotate_);
     return DCAMERA_OK;
 }
 } // namespace DistributedHardware
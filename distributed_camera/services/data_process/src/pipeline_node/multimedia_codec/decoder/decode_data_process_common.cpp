@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,12 +17,16 @@
 
 #include "distributed_camera_constants.h"
 #include "distributed_hardware_log.h"
+#include "dcamera_codec_pool.h"
+#include "dcamera_decoder_arbiter.h"
+#include "dcamera_dump_writer.h"
 #include "dcamera_hisysevent_adapter.h"
 #include "dcamera_hidumper.h"
+#include "dcamera_hitrace_adapter.h"
 #include "decode_surface_listener.h"
 #include "decode_video_callback.h"
 #include "graphic_common_c.h"
-#include <sys/prctl.h>
+#include <algorithm>
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -44,6 +48,8 @@ int32_t DecodeDataProcess::InitNode(const VideoConfigParams& sourceConfig, const
     VideoConfigParams& processedConfig)
 {
     DHLOGD("Init DCamera DecodeNode start.");
+    bounds_ = DCameraCodecCapability::GetInstance().GetBounds(sourceConfig.GetVideoCodecType(), false,
+        { MAX_VIDEO_WIDTH, MAX_VIDEO_HEIGHT, static_cast<int32_t>(MAX_FRAME_RATE) });
     if (!(IsInDecoderRange(sourceConfig) && IsInDecoderRange(targetConfig))) {
         DHLOGE("Source config or target config are invalid.");
         return DCAMERA_BAD_VALUE;
@@ -79,12 +85,25 @@ int32_t DecodeDataProcess::InitNode(const VideoConfigParams& sourceConfig, const
     return DCAMERA_OK;
 }
 
+int32_t DecodeDataProcess::UpdateConfig(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig, VideoConfigParams& processedConfig)
+{
+    // The copy out of the decoder surface has no size guard here, a new size always gets a new decoder.
+    DHLOGI("DecodeNode does not switch size in place, it is rebuilt.");
+    return DCAMERA_BAD_OPERATE;
+}
+
 bool DecodeDataProcess::IsInDecoderRange(const VideoConfigParams& curConfig)
 {
-    bool isWidthValid = (curConfig.GetWidth() >= MIN_VIDEO_WIDTH && curConfig.GetWidth() <= MAX_VIDEO_WIDTH);
-    bool isHeightValid = (curConfig.GetHeight() >= MIN_VIDEO_HEIGHT && curConfig.GetHeight() <= MAX_VIDEO_HEIGHT);
-    bool isFrameRateValid = (curConfig.GetFrameRate() >= MIN_FRAME_RATE && curConfig.GetFrameRate() <= MAX_FRAME_RATE);
-    return isWidthValid && isHeightValid && isFrameRateValid;
+    return DCameraCodecCapability::IsInBounds(curConfig, bounds_, MIN_VIDEO_WIDTH, MIN_VIDEO_HEIGHT, MIN_FRAME_RATE);
+}
+
+int32_t DecodeDataProcess::CalMaxInputSize(const int32_t defaultSize, const int32_t bytesPerPixel,
+    const int32_t pixelDivisor)
+{
+    int64_t size = static_cast<int64_t>(sourceConfig_.GetWidth()) * sourceConfig_.GetHeight() * bytesPerPixel /
+        pixelDivisor * INPUT_SIZE_MARGIN;
+    return static_cast<int32_t>(std::max<int64_t>(size, defaultSize));
 }
 
 bool DecodeDataProcess::IsConvertible(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig)
@@ -96,39 +115,27 @@ bool DecodeDataProcess::IsConvertible(const VideoConfigParams& sourceConfig, con
 void DecodeDataProcess::InitCodecEvent()
 {
     DHLOGD("Init DecodeNode eventBus, and add handler for it.");
-    eventThread_ = std::thread([this]() { this->StartEventHandler(); });
-    std::unique_lock<std::mutex> lock(eventMutex_);
-    eventCon_.wait(lock, [this] {
-        return decEventHandler_ != nullptr;
-    });
-}
-
-void DecodeDataProcess::StartEventHandler()
-{
-    prctl(PR_SET_NAME, DECODE_DATA_EVENT.c_str());
-    auto runner = AppExecFwk::EventRunner::Create(false);
-    if (runner == nullptr) {
-        DHLOGE("Creat runner failed.");
-        return;
-    }
-    {
-        std::lock_guard<std::mutex> lock(eventMutex_);
-        decEventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
-    }
-    eventCon_.notify_one();
-    runner->Run();
+    std::lock_guard<std::mutex> lock(eventMutex_);
+    decEventQueue_ = std::make_shared<DCameraSerialQueue>(DECODE_DATA_EVENT, DCAMERA_THREAD_FRAME);
 }
 
 int32_t DecodeDataProcess::InitDecoder()
 {
     DHLOGD("Init video decoder.");
-    int32_t ret = ConfigureVideoDecoder();
-    if (ret != DCAMERA_OK) {
-        DHLOGE("Init video decoder metadata format failed.");
-        return ret;
+    int32_t ret = ConfigureVideoDecoder(false);
+    if (ret == DCAMERA_OK) {
+        ret = StartVideoDecoder();
+    }
+    if (ret != DCAMERA_OK && videoDecoder_ != nullptr && !isSoftwareDecoder_) {
+        // A hardware decoder that can not be configured or started leaves the stream to a software one.
+        DHLOGW("Hardware video decoder failed, retry in software. ret %{public}d.", ret);
+        ReleaseVideoDecoder();
+        ReleaseDecoderSurface();
+        ret = ConfigureVideoDecoder(true);
+        if (ret == DCAMERA_OK) {
+            ret = StartVideoDecoder();
+        }
     }
-
-    ret = StartVideoDecoder();
     if (ret != DCAMERA_OK) {
         DHLOGE("Start Video decoder failed.");
         ReportDcamerOptFail(DCAMERA_OPT_FAIL, DCAMERA_DECODE_ERROR,
@@ -140,7 +147,7 @@ int32_t DecodeDataProcess::InitDecoder()
     return DCAMERA_OK;
 }
 
-int32_t DecodeDataProcess::ConfigureVideoDecoder()
+int32_t DecodeDataProcess::ConfigureVideoDecoder(bool isForceSoftware)
 {
     int32_t ret = InitDecoderMetadataFormat();
     if (ret != DCAMERA_OK) {
@@ -148,7 +155,7 @@ int32_t DecodeDataProcess::ConfigureVideoDecoder()
         return ret;
     }
 
-    videoDecoder_ = MediaAVCodec::VideoDecoderFactory::CreateByMime(processType_);
+    videoDecoder_ = CreateVideoDecoder(isForceSoftware);
     if (videoDecoder_ == nullptr) {
         DHLOGE("Create video decoder failed.");
         return DCAMERA_INIT_ERR;
@@ -175,6 +182,49 @@ int32_t DecodeDataProcess::ConfigureVideoDecoder()
     return DCAMERA_OK;
 }
 
+std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> DecodeDataProcess::CreateVideoDecoder(bool isForceSoftware)
+{
+    arbiterKey_ = GetArbiterKey();
+    int32_t frameRate = sourceConfig_.GetFrameRate() > 0 ?
+        sourceConfig_.GetFrameRate() : static_cast<int32_t>(MAX_FRAME_RATE);
+    int64_t load = DCameraDecoderArbiter::GetLoad(sourceConfig_.GetWidth(), sourceConfig_.GetHeight(), frameRate);
+    std::weak_ptr<DecodeDataProcess> weakThis = shared_from_this();
+    DCameraDecoderGrant grant = DCameraDecoderArbiter::GetInstance().Acquire(arbiterKey_, load, [weakThis]() {
+        std::shared_ptr<DecodeDataProcess> decoder = weakThis.lock();
+        if (decoder != nullptr) {
+            decoder->OnDecoderStepDown();
+        }
+    });
+    isSoftwareDecoder_ = isForceSoftware || grant == DCameraDecoderGrant::SOFTWARE;
+    if (!isSoftwareDecoder_) {
+        std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> decoder = DCameraCodecPool::GetInstance().AcquireDecoder(
+            processType_, sourceConfig_.GetWidth(), sourceConfig_.GetHeight());
+        if (decoder != nullptr) {
+            return decoder;
+        }
+        DHLOGW("Create hardware decoder failed, fall back to software.");
+        isSoftwareDecoder_ = true;
+    }
+    DCameraDecoderArbiter::GetInstance().OnHardwareUnavailable(arbiterKey_);
+    return DCameraDecoderArbiter::CreateSoftwareDecoder(processType_);
+}
+
+std::string DecodeDataProcess::GetArbiterKey() const
+{
+    if (dropCounter_ != nullptr) {
+        return dropCounter_->GetStreamKey();
+    }
+    return "decoder_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+}
+
+void DecodeDataProcess::OnDecoderStepDown()
+{
+    DHLOGI("Decoder of %{public}s asked to step down.", arbiterKey_.c_str());
+    std::shared_ptr<DCameraPipelineSource> targetPipelineSource = callbackPipelineSource_.lock();
+    CHECK_AND_RETURN_LOG(targetPipelineSource == nullptr, "%{public}s", "callbackPipelineSource_ is nullptr.");
+    targetPipelineSource->OnDecoderStepDown();
+}
+
 int32_t DecodeDataProcess::InitDecoderMetadataFormat()
 {
     DHLOGI("Init video decoder metadata format. codecType: %{public}d", sourceConfig_.GetVideoCodecType());
@@ -193,22 +243,25 @@ int32_t DecodeDataProcess::InitDecoderMetadataFormat()
     }
 
     DHLOGI("Init video decoder metadata format. videoformat: %{public}d", processedConfig_.GetVideoformat());
+    int32_t yuvInputSize = CalMaxInputSize(MAX_YUV420_BUFFER_SIZE, YUV_BYTES_PER_PIXEL, Y2UV_RATIO);
+    maxInputSize_ = CalMaxInputSize(MAX_BUFFER_SIZE, RGB32_MEMORY_COEFFICIENT, 1);
     switch (processedConfig_.GetVideoformat()) {
         case Videoformat::YUVI420:
             metadataFormat_.PutIntValue("pixel_format", static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::YUVI420));
-            metadataFormat_.PutIntValue("max_input_size", MAX_YUV420_BUFFER_SIZE);
+            metadataFormat_.PutIntValue("max_input_size", yuvInputSize);
             break;
         case Videoformat::NV12:
             metadataFormat_.PutIntValue("pixel_format", static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::NV12));
-            metadataFormat_.PutIntValue("max_input_size", MAX_YUV420_BUFFER_SIZE);
+            metadataFormat_.PutIntValue("max_input_size", yuvInputSize);
             break;
         case Videoformat::NV21:
             metadataFormat_.PutIntValue("pixel_format", static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::NV21));
-            metadataFormat_.PutIntValue("max_input_size", MAX_YUV420_BUFFER_SIZE);
+            metadataFormat_.PutIntValue("max_input_size", yuvInputSize);
             break;
         case Videoformat::RGBA_8888:
             metadataFormat_.PutIntValue("pixel_format", static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::RGBA));
-            metadataFormat_.PutIntValue("max_input_size", MAX_RGB32_BUFFER_SIZE);
+            metadataFormat_.PutIntValue("max_input_size",
+                CalMaxInputSize(MAX_RGB32_BUFFER_SIZE, RGB32_MEMORY_COEFFICIENT, 1));
             break;
         default:
             DHLOGE("The current pixel format does not support encoding.");
@@ -218,7 +271,8 @@ int32_t DecodeDataProcess::InitDecoderMetadataFormat()
     metadataFormat_.PutStringValue("codec_mime", processType_);
     metadataFormat_.PutIntValue("width", sourceConfig_.GetWidth());
     metadataFormat_.PutIntValue("height", sourceConfig_.GetHeight());
-    metadataFormat_.PutDoubleValue("frame_rate", MAX_FRAME_RATE);
+    metadataFormat_.PutDoubleValue("frame_rate",
+        sourceConfig_.GetFrameRate() > 0 ? static_cast<double>(sourceConfig_.GetFrameRate()) : MAX_FRAME_RATE);
 
     return DCAMERA_OK;
 }
@@ -321,18 +375,26 @@ void DecodeDataProcess::ReleaseVideoDecoder()
     DHLOGD("Start release videoDecoder.");
     std::lock_guard<std::mutex> inputLock(mtxDecoderLock_);
     std::lock_guard<std::mutex> outputLock(mtxDecoderState_);
+    if (!arbiterKey_.empty()) {
+        DCameraDecoderArbiter::GetInstance().Release(arbiterKey_);
+    }
     if (videoDecoder_ == nullptr) {
         DHLOGE("The video decoder does not exist before ReleaseVideoDecoder.");
         decodeVideoCallback_ = nullptr;
         return;
     }
     int32_t ret = StopVideoDecoder();
-    if (ret != DCAMERA_OK) {
-        DHLOGE("StopVideoDecoder failed.");
-    }
-    ret = videoDecoder_->Release();
-    if (ret != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK) {
-        DHLOGE("VideoDecoder release failed. ret %{public}d.", ret);
+    if (ret == DCAMERA_OK && !isSoftwareDecoder_) {
+        DCameraCodecPool::GetInstance().ReturnDecoder(processType_, sourceConfig_.GetWidth(),
+            sourceConfig_.GetHeight(), videoDecoder_);
+    } else {
+        if (ret != DCAMERA_OK) {
+            DHLOGE("StopVideoDecoder failed, release the decoder.");
+        }
+        ret = videoDecoder_->Release();
+        if (ret != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK) {
+            DHLOGE("VideoDecoder release failed. ret %{public}d.", ret);
+        }
     }
     videoDecoder_ = nullptr;
     decodeVideoCallback_ = nullptr;
@@ -357,13 +419,12 @@ void DecodeDataProcess::ReleaseCodecEvent()
 {
     {
         std::lock_guard<std::mutex> lock(eventMutex_);
-        if ((decEventHandler_ != nullptr) && (decEventHandler_->GetEventRunner() != nullptr)) {
-            decEventHandler_->GetEventRunner()->Stop();
-            eventThread_.join();
+        if (decEventQueue_ != nullptr) {
+            decEventQueue_->Stop();
         }
-        decEventHandler_ = nullptr;
+        decEventQueue_ = nullptr;
     }
-    pipeSrcEventHandler_ = nullptr;
+    pipeSrcEventQueue_ = nullptr;
     DHLOGD("Release DecodeNode eventBusDecode and eventBusPipeline end.");
 }
 
@@ -374,11 +435,16 @@ void DecodeDataProcess::ReleaseProcessNode()
     ReleaseVideoDecoder();
     ReleaseDecoderSurface();
     ReleaseCodecEvent();
+    CloseFrameDumps();
 
     processType_ = "";
     std::queue<std::shared_ptr<DataBuffer>>().swap(inputBuffersQueue_);
     std::queue<uint32_t>().swap(availableInputIndexsQueue_);
     std::queue<std::shared_ptr<Media::AVSharedMemory>>().swap(availableInputBufferQueue_);
+    {
+        std::lock_guard<std::mutex> lock(mtxHoldCount_);
+        isInputStarved_ = false;
+    }
     {
         std::lock_guard<std::mutex> lock(mtxDequeLock_);
         std::deque<DCameraFrameInfo>().swap(frameInfoDeque_);
@@ -402,6 +468,8 @@ int32_t DecodeDataProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>&
         DHLOGE("The input data buffers is empty.");
         return DCAMERA_BAD_VALUE;
     }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_DECODE, inputBuffers[0]->frameInfo_.index);
+    DCameraNodeStatsScope statsScope(stats_, inputBuffers.size());
     DumpFileUtil::OpenDumpFile(DUMP_SERVER_PARA, DUMP_DCAMERA_BEFORE_DEC_FILENAME, &dumpDecBeforeFile_);
     DumpFileUtil::OpenDumpFile(DUMP_SERVER_PARA, DUMP_DCAMERA_AFTER_DEC_FILENAME, &dumpDecAfterFile_);
     if (sourceConfig_.GetVideoCodecType() == processedConfig_.GetVideoCodecType()) {
@@ -416,9 +484,10 @@ int32_t DecodeDataProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>&
     }
     if (inputBuffersQueue_.size() > VIDEO_DECODER_QUEUE_MAX) {
         DHLOGE("video decoder input buffers queue over flow.");
+        CountDroppedFrames(DCAMERA_DROP_DECODE_QUEUE_FULL, inputBuffers.size());
         return DCAMERA_INDEX_OVERFLOW;
     }
-    if (inputBuffers[0]->Size() > MAX_BUFFER_SIZE) {
+    if (inputBuffers[0]->Size() > static_cast<size_t>(maxInputSize_)) {
         DHLOGE("DecodeNode input buffer size %{public}zu error.", inputBuffers[0]->Size());
         return DCAMERA_MEMORY_OPT_ERROR;
     }
@@ -427,24 +496,29 @@ int32_t DecodeDataProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>&
         return DCAMERA_DISABLE_PROCESS;
     }
     inputBuffersQueue_.push(inputBuffers[0]);
+    stats_.SetQueueDepth(inputBuffersQueue_.size());
     DHLOGD("Push inputBuf sucess. BufSize %{public}zu, QueueSize %{public}zu.", inputBuffers[0]->Size(),
         inputBuffersQueue_.size());
     int32_t err = FeedDecoderInputBuffer();
     if (err != DCAMERA_OK) {
-        int32_t sleepTimeUs = 5000;
-        std::this_thread::sleep_for(std::chrono::microseconds(sleepTimeUs));
-        DHLOGD("Feed decoder input buffer failed. Try FeedDecoderInputBuffer again.");
-        auto sendFunc = [this]() mutable {
-            int32_t ret = FeedDecoderInputBuffer();
-            DHLOGD("excute FeedDecoderInputBuffer ret %{public}d.", ret);
-        };
-        CHECK_AND_RETURN_RET_LOG(pipeSrcEventHandler_ == nullptr, DCAMERA_BAD_VALUE,
-            "%{public}s", "pipeSrcEventHandler_ is nullptr.");
-        pipeSrcEventHandler_->PostTask(sendFunc);
+        DHLOGD("Feed decoder input buffer stopped, ret %{public}d. The rest is fed on the next input slot.", err);
     }
     return DCAMERA_OK;
 }
 
+void DecodeDataProcess::PostFeedDecoderInputBuffer()
+{
+    std::weak_ptr<DecodeDataProcess> weakDecoder = shared_from_this();
+    auto sendFunc = [weakDecoder]() {
+        std::shared_ptr<DecodeDataProcess> decoder = weakDecoder.lock();
+        CHECK_AND_RETURN_LOG(decoder == nullptr, "%{public}s", "Decoder node is released.");
+        int32_t ret = decoder->FeedDecoderInputBuffer();
+        DHLOGD("excute FeedDecoderInputBuffer ret %{public}d.", ret);
+    };
+    CHECK_AND_RETURN_LOG(pipeSrcEventQueue_ == nullptr, "%{public}s", "pipeSrcEventQueue_ is nullptr.");
+    pipeSrcEventQueue_->PostTask(sendFunc);
+}
+
 void DecodeDataProcess::BeforeDecodeDump(uint8_t *buffer, size_t bufSize)
 {
 #ifdef DUMP_DCAMERA_FILE
@@ -452,25 +526,52 @@ void DecodeDataProcess::BeforeDecodeDump(uint8_t *buffer, size_t bufSize)
         DHLOGE("dumpsaving : input param nullptr.");
         return;
     }
-    if (DcameraHidumper::GetInstance().GetDumpFlag() && (IsUnderDumpMaxSize(DUMP_PATH, BEFORE_DECODE) == DCAMERA_OK)) {
-        DumpBufferToFile(DUMP_PATH, BEFORE_DECODE, buffer, bufSize);
+    if (DcameraHidumper::GetInstance().GetDumpFlag()) {
+        DCameraDumpWriter::GetInstance().Write(DUMP_PATH, BEFORE_DECODE, buffer, bufSize);
     }
 #endif
     return;
 }
 
+std::string DecodeDataProcess::GetAfterDecodeDumpName() const
+{
+    return "SourceAfterDecode_width(" + std::to_string(processedConfig_.GetWidth()) + ")height("
+        + std::to_string(processedConfig_.GetHeight()) + ").yuv";
+}
+
+void DecodeDataProcess::CloseFrameDumps()
+{
+#ifdef DUMP_DCAMERA_FILE
+    DCameraDumpWriter::GetInstance().Close(DUMP_PATH, BEFORE_DECODE);
+    DCameraDumpWriter::GetInstance().Close(DUMP_PATH, GetAfterDecodeDumpName());
+#endif
+}
+
 int32_t DecodeDataProcess::FeedDecoderInputBuffer()
 {
     DHLOGD("Feed decoder input buffer.");
     while ((!inputBuffersQueue_.empty()) && (isDecoderProcess_.load())) {
         std::shared_ptr<DataBuffer> buffer = inputBuffersQueue_.front();
-        if (buffer == nullptr || availableInputIndexsQueue_.empty() || availableInputBufferQueue_.empty()) {
-            DHLOGE("inputBuffersQueue size %{public}zu, availableInputIndexsQueue size %{public}zu, "
-                "availableInputBufferQueue size %{public}zu",
-                inputBuffersQueue_.size(), availableInputIndexsQueue_.size(), availableInputBufferQueue_.size());
-            return DCAMERA_BAD_VALUE;
+        if (buffer == nullptr) {
+            DHLOGE("Input buffer is null, skipping this frame.");
+            inputBuffersQueue_.pop();
+            stats_.SetQueueDepth(inputBuffersQueue_.size());
+            continue;
+        }
+        DCameraFrameTrace frameTrace(DCAMERA_FRAME_DECODE_FEED, buffer->frameInfo_.index);
+        {
+            std::lock_guard<std::mutex> lck(mtxHoldCount_);
+            if (availableInputIndexsQueue_.empty() || availableInputBufferQueue_.empty()) {
+                DHLOGD("No available decoder buffers, wait for callback. inputBuffersQueue size %{public}zu.",
+                    inputBuffersQueue_.size());
+                isInputStarved_ = true;
+                return DCAMERA_BAD_VALUE;
+            }
         }
         buffer->frameInfo_.timePonit.startDecode = GetNowTimeStampUs();
+        if (buffer->frameInfo_.timePonit.recv != 0) {
+            stats_.AddWaitTime(buffer->frameInfo_.timePonit.startDecode - buffer->frameInfo_.timePonit.recv);
+        }
         {
             std::lock_guard<std::mutex> lock(mtxDequeLock_);
             frameInfoDeque_.push_back(buffer->frameInfo_);
@@ -502,6 +603,7 @@ int32_t DecodeDataProcess::FeedDecoderInputBuffer()
         }
 
         inputBuffersQueue_.pop();
+        stats_.SetQueueDepth(inputBuffersQueue_.size());
         DHLOGD("Push inputBuffer sucess. inputBuffersQueue size is %{public}zu.", inputBuffersQueue_.size());
 
         IncreaseWaitDecodeCnt();
@@ -526,6 +628,7 @@ void DecodeDataProcess::IncreaseWaitDecodeCnt()
 {
     std::lock_guard<std::mutex> lck(mtxHoldCount_);
     availableInputIndexsQueue_.pop();
+    stats_.SetAvailableSlots(availableInputIndexsQueue_.size());
     availableInputBufferQueue_.pop();
     waitDecoderOutputCount_++;
     DHLOGD("Wait decoder output frames number is %{public}d.", waitDecoderOutputCount_);
@@ -552,8 +655,8 @@ void DecodeDataProcess::OnSurfaceOutputBufferAvailable(const sptr<IConsumerSurfa
         DHLOGD("excute GetDecoderOutputBuffer.");
     };
     std::lock_guard<std::mutex> lock(eventMutex_);
-    if (decEventHandler_ != nullptr) {
-        decEventHandler_->PostTask(sendFunc);
+    if (decEventQueue_ != nullptr) {
+        decEventQueue_->PostTask(sendFunc);
     }
 }
 
@@ -603,7 +706,8 @@ void DecodeDataProcess::CopyDecodedImage(const sptr<SurfaceBuffer>& surBuf, int3
         imageSize = static_cast<size_t>(
             sourceConfig_.GetWidth() * sourceConfig_.GetHeight() * YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
     }
-    std::shared_ptr<DataBuffer> bufferOutput = std::make_shared<DataBuffer>(imageSize);
+    std::shared_ptr<DataBuffer> bufferOutput = DataBuffer::Acquire(imageSize);
+    OnBufferAllocated(bufferOutput, DCAMERA_MEMORY_DECODER);
     uint8_t *addr = static_cast<uint8_t *>(surBuf->GetVirAddr());
     errno_t err = memcpy_s(bufferOutput->Data(), bufferOutput->Size(), addr, imageSize);
     if (err != EOK) {
@@ -615,16 +719,15 @@ void DecodeDataProcess::CopyDecodedImage(const sptr<SurfaceBuffer>& surBuf, int3
         bufferOutput->frameInfo_ = frameInfoDeque_.front();
         frameInfoDeque_.pop_front();
     }
-    bufferOutput->SetInt32("Videoformat", static_cast<int32_t>(processedConfig_.GetVideoformat()));
-    bufferOutput->SetInt32("alignedWidth", processedConfig_.GetWidth());
-    bufferOutput->SetInt32("alignedHeight", processedConfig_.GetHeight());
-    bufferOutput->SetInt32("width", processedConfig_.GetWidth());
-    bufferOutput->SetInt32("height", processedConfig_.GetHeight());
+    bufferOutput->SetInt32(DataBufferKey::VIDEO_FORMAT, static_cast<int32_t>(processedConfig_.GetVideoformat()));
+    bufferOutput->SetInt32(DataBufferKey::ALIGNED_WIDTH, processedConfig_.GetWidth());
+    bufferOutput->SetInt32(DataBufferKey::ALIGNED_HEIGHT, processedConfig_.GetHeight());
+    bufferOutput->SetInt32(DataBufferKey::WIDTH, processedConfig_.GetWidth());
+    bufferOutput->SetInt32(DataBufferKey::HEIGHT, processedConfig_.GetHeight());
 #ifdef DUMP_DCAMERA_FILE
-    std::string fileName = "SourceAfterDecode_width(" + std::to_string(processedConfig_.GetWidth())
-        + ")height(" + std::to_string(processedConfig_.GetHeight()) + ").yuv";
-    if (DcameraHidumper::GetInstance().GetDumpFlag() && (IsUnderDumpMaxSize(DUMP_PATH, fileName) == DCAMERA_OK)) {
-        DumpBufferToFile(DUMP_PATH, fileName, bufferOutput->Data(), bufferOutput->Size());
+    if (DcameraHidumper::GetInstance().GetDumpFlag()) {
+        DCameraDumpWriter::GetInstance().Write(DUMP_PATH, GetAfterDecodeDumpName(), bufferOutput->Data(),
+            bufferOutput->Size());
     }
 #endif
     DumpFileUtil::WriteDumpFile(dumpDecAfterFile_, static_cast<void *>(bufferOutput->Data()), bufferOutput->Size());
@@ -665,8 +768,8 @@ bool DecodeDataProcess::IsCorrectSurfaceBuffer(const sptr<SurfaceBuffer>& surBuf
 
 void DecodeDataProcess::PostOutputDataBuffers(std::shared_ptr<DataBuffer>& outputBuffer)
 {
-    if (decEventHandler_ == nullptr || outputBuffer == nullptr) {
-        DHLOGE("decEventHandler_ or outputBuffer is null.");
+    if (decEventQueue_ == nullptr || outputBuffer == nullptr) {
+        DHLOGE("decEventQueue_ or outputBuffer is null.");
         return;
     }
     auto sendFunc = [this, outputBuffer]() mutable {
@@ -676,8 +779,8 @@ void DecodeDataProcess::PostOutputDataBuffers(std::shared_ptr<DataBuffer>& outpu
         DHLOGD("excute DecodeDone ret %{public}d.", ret);
     };
     std::lock_guard<std::mutex> lock(eventMutex_);
-    if (decEventHandler_ != nullptr) {
-        decEventHandler_->PostTask(sendFunc);
+    if (decEventQueue_ != nullptr) {
+        decEventQueue_->PostTask(sendFunc);
     }
     DHLOGD("Send video decoder output asynchronous DCameraCodecEvents success.");
 }
@@ -690,6 +793,11 @@ int32_t DecodeDataProcess::DecodeDone(std::vector<std::shared_ptr<DataBuffer>>&
         return DCAMERA_BAD_VALUE;
     }
 
+    std::shared_ptr<DCameraPipelineSource> targetPipelineSource = callbackPipelineSource_.lock();
+    if (targetPipelineSource != nullptr) {
+        targetPipelineSource->OnDecodedVideoBuffer(outputBuffers[0]);
+    }
+    stats_.OnFramesOut(outputBuffers.size());
     if (nextDataProcess_ != nullptr) {
         DHLOGD("Send to the next node of the decoder for processing.");
         int32_t err = nextDataProcess_->ProcessData(outputBuffers);
@@ -699,7 +807,6 @@ int32_t DecodeDataProcess::DecodeDone(std::vector<std::shared_ptr<DataBuffer>>&
         return err;
     }
     DHLOGD("The current node is the last node, and Output the processed video buffer");
-    std::shared_ptr<DCameraPipelineSource> targetPipelineSource = callbackPipelineSource_.lock();
     if (targetPipelineSource == nullptr) {
         DHLOGE("callbackPipelineSource_ is nullptr.");
         return DCAMERA_BAD_VALUE;
@@ -726,14 +833,23 @@ void DecodeDataProcess::OnError()
 void DecodeDataProcess::OnInputBufferAvailable(uint32_t index, std::shared_ptr<Media::AVSharedMemory> buffer)
 {
     DHLOGD("DecodeDataProcess::OnInputBufferAvailable");
-    std::lock_guard<std::mutex> lck(mtxHoldCount_);
-    if (availableInputIndexsQueue_.size() > VIDEO_DECODER_QUEUE_MAX) {
-        DHLOGE("Video decoder available indexs queue overflow.");
-        return;
+    bool needFeed = false;
+    {
+        std::lock_guard<std::mutex> lck(mtxHoldCount_);
+        if (availableInputIndexsQueue_.size() > VIDEO_DECODER_QUEUE_MAX) {
+            DHLOGE("Video decoder available indexs queue overflow.");
+            return;
+        }
+        DHLOGD("Video decoder available indexs queue push index [%{public}u].", index);
+        availableInputIndexsQueue_.push(index);
+        stats_.SetAvailableSlots(availableInputIndexsQueue_.size());
+        availableInputBufferQueue_.push(buffer);
+        needFeed = isInputStarved_;
+        isInputStarved_ = false;
+    }
+    if (needFeed && isDecoderProcess_.load()) {
+        PostFeedDecoderInputBuffer();
     }
-    DHLOGD("Video decoder available indexs queue push index [%{public}u].", index);
-    availableInputIndexsQueue_.push(index);
-    availableInputBufferQueue_.push(buffer);
 }
 
 void DecodeDataProcess::OnOutputFormatChanged(const Media::Format &format)
@@ -756,6 +872,7 @@ void DecodeDataProcess::OnOutputBufferAvailable(uint32_t index, const MediaAVCod
     DHLOGD("Video decode buffer info: presentation TimeUs %{public}" PRId64", size %{public}d, offset %{public}d, flag "
         "%{public}" PRIu32, info.presentationTimeUs, info.size, info.offset, flag);
     outputInfo_ = info;
+    int32_t frameIndex = DCAMERA_FRAME_TRACE_NO_INDEX;
     {
         std::lock_guard<std::mutex> lock(mtxDequeLock_);
         AlignFirstFrameTime();
@@ -765,10 +882,12 @@ void DecodeDataProcess::OnOutputBufferAvailable(uint32_t index, const MediaAVCod
                 continue;
             }
             frameInfo.timePonit.finishDecode = finishDecodeT;
+            frameIndex = frameInfo.index;
             frameInfoDeque_.emplace(frameInfoDeque_.erase(it), frameInfo);
             break;
         }
     }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_DECODE_OUTPUT, frameIndex);
     {
         std::lock_guard<std::mutex> outputLock(mtxDecoderState_);
         if (videoDecoder_ == nullptr) {
@@ -821,5 +940,10 @@ int32_t DecodeDataProcess::UpdateSettings(const std::shared_ptr<Camera::CameraMe
 {
     return DCAMERA_OK;
 }
+
+std::shared_ptr<DataBuffer> DecodeDataProcess::AcquireInputBuffer(size_t capacity)
+{
+    return DataBuffer::Acquire(capacity);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
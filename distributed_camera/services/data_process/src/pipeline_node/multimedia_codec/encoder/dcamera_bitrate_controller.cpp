@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_bitrate_controller.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace DistributedHardware {
+void DCameraBitrateController::Init(int64_t minBitrate, int64_t maxBitrate, int64_t startBitrate,
+    int32_t frameRate)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    minBitrate_ = std::max<int64_t>(minBitrate, 0);
+    maxBitrate_ = std::max(maxBitrate, minBitrate_);
+    bitrate_ = std::min(std::max(startBitrate, minBitrate_), maxBitrate_);
+    frameIntervalUs_ = frameRate > 0 ? US_PER_SECOND / frameRate : 0;
+    stableWindows_ = 0;
+    // A freshly configured encoder starts with a key frame anyway.
+    isKeyFrameRequested_ = false;
+    ResetWindow(0);
+}
+
+void DCameraBitrateController::OnFrameSent(size_t frameSize, int64_t sendCostUs, bool isSuccess)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!isSuccess) {
+        failCount_++;
+        return;
+    }
+    sentBytes_ += frameSize;
+    sentFrames_++;
+    sendCostUs_ += std::max<int64_t>(sendCostUs, 0);
+}
+
+void DCameraBitrateController::OnSendBusy()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    busyCount_++;
+}
+
+void DCameraBitrateController::OnFramesDropped(uint32_t count)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    dropCount_ += count;
+}
+
+void DCameraBitrateController::SetLinkCapacity(int64_t bandwidthBps)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    linkCapacity_ = std::max<int64_t>(bandwidthBps, 0);
+}
+
+void DCameraBitrateController::SetLoadCeiling(int64_t bitrate)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    loadCeiling_ = std::max<int64_t>(bitrate, 0);
+}
+
+void DCameraBitrateController::SetBitratePercent(int32_t percent)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    bitratePercent_ = std::min(std::max(percent, 1), PERCENT_BASE);
+}
+
+void DCameraBitrateController::RequestKeyFrame()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    isKeyFrameRequested_ = true;
+}
+
+bool DCameraBitrateController::TakeKeyFrameRequest()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool isRequested = isKeyFrameRequested_;
+    isKeyFrameRequested_ = false;
+    return isRequested;
+}
+
+int64_t DCameraBitrateController::GetBitrate()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bitrate_;
+}
+
+int64_t DCameraBitrateController::GetCongestedBitrate() const
+{
+    int64_t target = static_cast<int64_t>(bitrate_ * DECREASE_FACTOR);
+    if (sendCostUs_ > 0 && sentBytes_ > 0) {
+        // While a frame is on the channel it drains at the link rate, leave headroom below it.
+        int64_t linkRate = static_cast<int64_t>(sentBytes_) * BITS_PER_BYTE * US_PER_SECOND / sendCostUs_;
+        target = std::min(target, static_cast<int64_t>(linkRate * LINK_UTILIZATION));
+    }
+    return target;
+}
+
+int64_t DCameraBitrateController::GetCeilingBitrate() const
+{
+    int64_t ceiling = maxBitrate_;
+    if (loadCeiling_ > 0) {
+        ceiling = std::min(ceiling, loadCeiling_);
+    }
+    if (bitratePercent_ < PERCENT_BASE) {
+        ceiling = std::min(ceiling, maxBitrate_ * bitratePercent_ / PERCENT_BASE);
+    }
+    if (linkCapacity_ <= 0) {
+        return ceiling;
+    }
+    return std::min(ceiling, static_cast<int64_t>(linkCapacity_ * LINK_UTILIZATION));
+}
+
+bool DCameraBitrateController::Evaluate(int64_t nowUs, BitrateDecision& decision)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (maxBitrate_ <= 0 || frameIntervalUs_ <= 0) {
+        return false;
+    }
+    if (windowStartUs_ == 0) {
+        ResetWindow(nowUs);
+        return false;
+    }
+    if (nowUs - windowStartUs_ < WINDOW_US) {
+        return false;
+    }
+    bool isLost = failCount_ > 0 || dropCount_ > 0;
+    int64_t avgCostUs = sentFrames_ == 0 ? 0 : sendCostUs_ / sentFrames_;
+    bool isStalled = busyCount_ > 0 && sentFrames_ == 0;
+    bool isCongested = isLost || isStalled || avgCostUs > frameIntervalUs_ * CONGESTED_COST_RATIO ||
+        busyCount_ * BUSY_FRAME_RATIO > sentFrames_;
+    int64_t target = bitrate_;
+    if (isCongested) {
+        target = GetCongestedBitrate();
+        stableWindows_ = 0;
+    } else if (busyCount_ == 0 && avgCostUs < frameIntervalUs_ * IDLE_COST_RATIO) {
+        stableWindows_++;
+        if (stableWindows_ >= INCREASE_HOLD_WINDOWS) {
+            target = bitrate_ + std::max<int64_t>((maxBitrate_ - minBitrate_) / INCREASE_STEPS, 1);
+            stableWindows_ = 0;
+        }
+    } else {
+        stableWindows_ = 0;
+    }
+    target = std::max(std::min(target, GetCeilingBitrate()), minBitrate_);
+    bool isChanged = target != bitrate_ || isLost;
+    bitrate_ = target;
+    decision.bitrate = target;
+    decision.needKeyFrame = isLost;
+    ResetWindow(nowUs);
+    return isChanged;
+}
+
+void DCameraBitrateController::ResetWindow(int64_t nowUs)
+{
+    windowStartUs_ = nowUs;
+    sentBytes_ = 0;
+    sentFrames_ = 0;
+    sendCostUs_ = 0;
+    failCount_ = 0;
+    busyCount_ = 0;
+    dropCount_ = 0;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
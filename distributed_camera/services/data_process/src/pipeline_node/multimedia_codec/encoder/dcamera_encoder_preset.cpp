@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_encoder_preset.h"
+
+#include <algorithm>
+
+#include "dcamera_sink_frame_info.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t THROTTLE_PERCENTS[] = { 100, 80, 60, 40 };
+}
+
+EncoderTier DCameraEncoderPreset::ClassifyTier(const VideoCapabilityBounds& bounds)
+{
+    if (bounds.profiles.empty()) {
+        return EncoderTier::LOW;
+    }
+    int64_t pixelRate = static_cast<int64_t>(bounds.maxWidth) * bounds.maxHeight * bounds.maxFrameRate;
+    if (pixelRate >= HIGH_TIER_PIXEL_RATE) {
+        return EncoderTier::HIGH;
+    }
+    // The bounds never go below 1080p30, an encoder that stops there already runs at its limit.
+    if (pixelRate <= LOW_TIER_PIXEL_RATE) {
+        return EncoderTier::LOW;
+    }
+    return EncoderTier::MID;
+}
+
+EncoderPreset DCameraEncoderPreset::GetPreset(EncoderTier tier)
+{
+    EncoderPreset preset;
+    preset.tier = tier;
+    switch (tier) {
+        case EncoderTier::LOW:
+            // A constant rate bounds the work per frame, fewer IDRs spare the expensive intra frames.
+            preset.rateControl = EncoderRateControl::CBR;
+            preset.idrIntervalMs = LOW_TIER_IDR_INTERVAL_MS;
+            preset.bitratePercent = LOW_TIER_BITRATE_PERCENT;
+            break;
+        case EncoderTier::HIGH:
+            preset.isHighProfile = true;
+            preset.idrIntervalMs = IDR_INTERVAL_MS;
+            preset.bitratePercent = HIGH_TIER_BITRATE_PERCENT;
+            break;
+        default:
+            preset.tier = EncoderTier::MID;
+            preset.idrIntervalMs = IDR_INTERVAL_MS;
+            preset.bitratePercent = MID_TIER_BITRATE_PERCENT;
+            break;
+    }
+    return preset;
+}
+
+int32_t DCameraEncoderPreset::GetThrottlePercent(int32_t level)
+{
+    return THROTTLE_PERCENTS[std::min(std::max(level, 0), MAX_THROTTLE_LEVEL)];
+}
+
+uint8_t DCameraEncoderPreset::MakePresetCode(EncoderTier tier, int32_t level)
+{
+    uint8_t clamped = static_cast<uint8_t>(std::min(std::max(level, 0), MAX_THROTTLE_LEVEL));
+    return static_cast<uint8_t>(static_cast<uint8_t>(tier) << DCameraSinkFrameInfo::ENCODER_PRESET_TIER_SHIFT) |
+        (clamped & DCameraSinkFrameInfo::ENCODER_PRESET_LEVEL_MASK);
+}
+
+void DCameraEncoderPreset::Init(int32_t frameRate)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    frameIntervalUs_ = frameRate > 0 ? US_PER_SECOND / frameRate : 0;
+    level_ = 0;
+    calmWindows_ = 0;
+    ResetWindow(0);
+}
+
+void DCameraEncoderPreset::OnFrameEncoded(int64_t encodeLatencyUs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    latencySumUs_ += std::max<int64_t>(encodeLatencyUs, 0);
+    encodedFrames_++;
+}
+
+void DCameraEncoderPreset::SetThermalLevel(int32_t thermalLevel)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    thermalLevel_ = std::max(thermalLevel, 0);
+}
+
+int32_t DCameraEncoderPreset::GetThrottleLevel()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return level_;
+}
+
+int32_t DCameraEncoderPreset::GetThermalThrottleLevel() const
+{
+    if (thermalLevel_ >= THERMAL_LEVEL_OVERHEATED) {
+        return MAX_THROTTLE_LEVEL;
+    }
+    if (thermalLevel_ == THERMAL_LEVEL_HOT) {
+        return MAX_THROTTLE_LEVEL - 1;
+    }
+    return thermalLevel_ == THERMAL_LEVEL_WARM ? 1 : 0;
+}
+
+bool DCameraEncoderPreset::Evaluate(int64_t nowUs, int32_t& level)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (frameIntervalUs_ <= 0) {
+        return false;
+    }
+    if (windowStartUs_ == 0) {
+        ResetWindow(nowUs);
+        return false;
+    }
+    if (nowUs - windowStartUs_ < WINDOW_US) {
+        return false;
+    }
+    int32_t target = level_;
+    int64_t avgLatencyUs = encodedFrames_ == 0 ? 0 : latencySumUs_ / encodedFrames_;
+    if (encodedFrames_ > 0 && avgLatencyUs > frameIntervalUs_ * LATENCY_OVERLOAD_INTERVALS) {
+        target = level_ + 1;
+        calmWindows_ = 0;
+    } else if (encodedFrames_ > 0 && avgLatencyUs < frameIntervalUs_ * LATENCY_CALM_INTERVALS) {
+        calmWindows_++;
+        if (calmWindows_ >= CALM_HOLD_WINDOWS) {
+            target = level_ - 1;
+            calmWindows_ = 0;
+        }
+    } else {
+        calmWindows_ = 0;
+    }
+    // The thermal state is a floor, a calm encoder does not lift the throttle of a hot device.
+    target = std::min(std::max(target, GetThermalThrottleLevel()), MAX_THROTTLE_LEVEL);
+    target = std::max(target, 0);
+    bool isChanged = target != level_;
+    level_ = target;
+    level = target;
+    ResetWindow(nowUs);
+    return isChanged;
+}
+
+void DCameraEncoderPreset::ResetWindow(int64_t nowUs)
+{
+    windowStartUs_ = nowUs;
+    latencySumUs_ = 0;
+    encodedFrames_ = 0;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
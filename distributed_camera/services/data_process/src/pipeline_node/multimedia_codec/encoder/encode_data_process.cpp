@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -13,14 +13,21 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
+#include "dcamera_codec_pool.h"
 #include "dcamera_hisysevent_adapter.h"
+#include "dcamera_hitrace_adapter.h"
 #include "dcamera_radar.h"
+#include "dcamera_thread_role.h"
 #include "dcamera_utils_tools.h"
 #include "distributed_hardware_log.h"
 #include "encode_data_process.h"
 #include "encode_video_callback.h"
 #include "graphic_common_c.h"
+#ifdef DCAMERA_THERMAL_ENABLE
+#include "thermal_mgr_client.h"
+#endif
 #include <ctime>
 
 #ifndef DH_LOG_TAG
@@ -42,7 +49,7 @@ const std::map<int64_t, int64_t> EncodeDataProcess::ENCODER_BITRATE_TABLE = {
     std::map<int64_t, int64_t>::value_type(WIDTH_1920_HEIGHT_1080, BITRATE_6000000),
 };
 const std::string ENUM_VIDEOFORMAT_STRINGS[] = {
-    "YUVI420", "NV12", "NV21", "RGBA_8888"
+    "YUVI420", "NV12", "NV21", "RGBA_8888", "P010"
 };
 
 EncodeDataProcess::~EncodeDataProcess()
@@ -57,6 +64,8 @@ int32_t EncodeDataProcess::InitNode(const VideoConfigParams& sourceConfig, const
     VideoConfigParams& processedConfig)
 {
     DHLOGD("Init DCamera EncodeNode start.");
+    bounds_ = DCameraCodecCapability::GetInstance().GetBounds(targetConfig.GetVideoCodecType(), true,
+        { MAX_VIDEO_WIDTH, MAX_VIDEO_HEIGHT, static_cast<int32_t>(MAX_FRAME_RATE) });
     if (!(IsInEncoderRange(sourceConfig) && IsInEncoderRange(targetConfig))) {
         DHLOGE("Source config or target config are invalid.");
         return DCAMERA_BAD_VALUE;
@@ -115,10 +124,15 @@ int32_t EncodeDataProcess::CreateSyncEncodeBufferThread()
 
 bool EncodeDataProcess::IsInEncoderRange(const VideoConfigParams& curConfig)
 {
-    bool isWidthValid = (curConfig.GetWidth() >= MIN_VIDEO_WIDTH && curConfig.GetWidth() <= MAX_VIDEO_WIDTH);
-    bool isHeightValid = (curConfig.GetHeight() >= MIN_VIDEO_HEIGHT && curConfig.GetHeight() <= MAX_VIDEO_HEIGHT);
-    bool isFrameRateValid = (curConfig.GetFrameRate() >= MIN_FRAME_RATE && curConfig.GetFrameRate() <= MAX_FRAME_RATE);
-    return isWidthValid && isHeightValid && isFrameRateValid;
+    return DCameraCodecCapability::IsInBounds(curConfig, bounds_, MIN_VIDEO_WIDTH, MIN_VIDEO_HEIGHT, MIN_FRAME_RATE);
+}
+
+int64_t EncodeDataProcess::CalMaxInputSize(const int64_t defaultSize, const int32_t bytesPerPixel,
+    const int32_t pixelDivisor)
+{
+    int64_t size = static_cast<int64_t>(sourceConfig_.GetWidth()) * sourceConfig_.GetHeight() * bytesPerPixel /
+        pixelDivisor;
+    return std::max(size, defaultSize);
 }
 
 bool EncodeDataProcess::IsConvertible(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig)
@@ -157,7 +171,8 @@ int32_t EncodeDataProcess::ConfigureVideoEncoder()
     ret = InitEncoderBitrateFormat();
     CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, ret,
         "Init video encoder bitrate format failed. ret %{public}d.", ret);
-    videoEncoder_ = MediaAVCodec::VideoEncoderFactory::CreateByMime(processType_);
+    videoEncoder_ = DCameraCodecPool::GetInstance().AcquireEncoder(processType_, sourceConfig_.GetWidth(),
+        sourceConfig_.GetHeight());
     if (videoEncoder_ == nullptr) {
         DHLOGE("Create video encoder failed.");
         return DCAMERA_INIT_ERR;
@@ -180,18 +195,42 @@ int32_t EncodeDataProcess::ConfigureVideoEncoder()
     return DCAMERA_OK;
 }
 
+void EncodeDataProcess::InitEncoderPreset()
+{
+    EncoderTier tier = DCameraEncoderPreset::ClassifyTier(bounds_);
+    int32_t forcedTier = 0;
+    if (GetSysPara(ENCODER_TIER_PARA, forcedTier) && forcedTier >= static_cast<int32_t>(EncoderTier::LOW) &&
+        forcedTier <= static_cast<int32_t>(EncoderTier::HIGH)) {
+        tier = static_cast<EncoderTier>(forcedTier);
+    }
+    preset_ = DCameraEncoderPreset::GetPreset(tier);
+    presetCode_.store(DCameraEncoderPreset::MakePresetCode(preset_.tier, 0));
+    lastThermalQueryUs_ = 0;
+    DHLOGI("Encoder tier %{public}d, rate control %{public}d, high profile %{public}d, idr interval %{public}d ms, "
+        "bitrate %{public}d%%.", static_cast<int32_t>(preset_.tier), static_cast<int32_t>(preset_.rateControl),
+        preset_.isHighProfile, preset_.idrIntervalMs, preset_.bitratePercent);
+}
+
 int32_t EncodeDataProcess::InitEncoderMetadataFormat()
 {
     processedConfig_ = sourceConfig_;
+    InitEncoderPreset();
+    bool isTenBit = (sourceConfig_.GetVideoformat() == Videoformat::P010);
+    if (isTenBit && !IsMain10Supported()) {
+        DHLOGE("The encoder of codec type %{public}d cannot encode 10 bit.", targetConfig_.GetVideoCodecType());
+        return DCAMERA_NOT_FOUND;
+    }
     switch (targetConfig_.GetVideoCodecType()) {
         case VideoCodecType::CODEC_H264:
             processType_ = "video/avc";
-            metadataFormat_.PutIntValue("codec_profile", MediaAVCodec::AVCProfile::AVC_PROFILE_BASELINE);
+            metadataFormat_.PutIntValue("codec_profile", IsHighProfileSupported() ?
+                MediaAVCodec::AVCProfile::AVC_PROFILE_HIGH : MediaAVCodec::AVCProfile::AVC_PROFILE_BASELINE);
             processedConfig_.SetVideoCodecType(VideoCodecType::CODEC_H264);
             break;
         case VideoCodecType::CODEC_H265:
             processType_ = "video/hevc";
-            metadataFormat_.PutIntValue("codec_profile", MediaAVCodec::HEVCProfile::HEVC_PROFILE_MAIN);
+            metadataFormat_.PutIntValue("codec_profile", isTenBit ? MediaAVCodec::HEVCProfile::HEVC_PROFILE_MAIN_10 :
+                MediaAVCodec::HEVCProfile::HEVC_PROFILE_MAIN);
             processedConfig_.SetVideoCodecType(VideoCodecType::CODEC_H265);
             break;
         case VideoCodecType::CODEC_MPEG4_ES:
@@ -204,22 +243,32 @@ int32_t EncodeDataProcess::InitEncoderMetadataFormat()
             DHLOGE("The current codec type does not support encoding.");
             return DCAMERA_NOT_FOUND;
     }
+    maxInputSize_ = CalMaxInputSize(NORM_YUV420_BUFFER_SIZE, YUV_BYTES_PER_PIXEL, Y2UV_RATIO);
     switch (sourceConfig_.GetVideoformat()) {
         case Videoformat::YUVI420:
             metadataFormat_.PutIntValue("pixel_format", static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::YUVI420));
-            metadataFormat_.PutLongValue("max_input_size", NORM_YUV420_BUFFER_SIZE);
+            metadataFormat_.PutLongValue("max_input_size", maxInputSize_);
             break;
         case Videoformat::NV12:
             metadataFormat_.PutIntValue("pixel_format", static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::NV12));
-            metadataFormat_.PutLongValue("max_input_size", NORM_YUV420_BUFFER_SIZE);
+            metadataFormat_.PutLongValue("max_input_size", maxInputSize_);
             break;
         case Videoformat::NV21:
             metadataFormat_.PutIntValue("pixel_format", static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::NV21));
-            metadataFormat_.PutLongValue("max_input_size", NORM_YUV420_BUFFER_SIZE);
+            metadataFormat_.PutLongValue("max_input_size", maxInputSize_);
             break;
         case Videoformat::RGBA_8888:
             metadataFormat_.PutIntValue("pixel_format", static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::RGBA));
-            metadataFormat_.PutLongValue("max_input_size", NORM_RGB32_BUFFER_SIZE);
+            maxInputSize_ = CalMaxInputSize(NORM_RGB32_BUFFER_SIZE, RGB32_BYTES_PER_PIXEL, 1);
+            metadataFormat_.PutLongValue("max_input_size", maxInputSize_);
+            break;
+        case Videoformat::P010:
+            // The codec has no P010 pixel format, the bit depth comes from the profile and the surface buffers.
+            metadataFormat_.PutIntValue("pixel_format",
+                static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::SURFACE_FORMAT));
+            maxInputSize_ = CalMaxInputSize(NORM_YUV420_BUFFER_SIZE * P010_BYTES_PER_SAMPLE,
+                YUV_BYTES_PER_PIXEL * P010_BYTES_PER_SAMPLE, Y2UV_RATIO);
+            metadataFormat_.PutLongValue("max_input_size", maxInputSize_);
             break;
         default:
             DHLOGE("The current pixel format does not support encoding.");
@@ -228,17 +277,75 @@ int32_t EncodeDataProcess::InitEncoderMetadataFormat()
     metadataFormat_.PutStringValue("codec_mime", processType_);
     metadataFormat_.PutIntValue("width", static_cast<int32_t>(sourceConfig_.GetWidth()));
     metadataFormat_.PutIntValue("height", static_cast<int32_t>(sourceConfig_.GetHeight()));
-    metadataFormat_.PutDoubleValue("frame_rate", MAX_FRAME_RATE);
+    metadataFormat_.PutDoubleValue("frame_rate", static_cast<double>(maxFrameRate_));
+    InitEncoderColorFormat();
     return DCAMERA_OK;
 }
 
+bool EncodeDataProcess::IsMain10Supported()
+{
+    if (targetConfig_.GetVideoCodecType() != VideoCodecType::CODEC_H265) {
+        return false;
+    }
+    // Without a queried profile list the configure call is the check.
+    return bounds_.profiles.empty() || std::find(bounds_.profiles.begin(), bounds_.profiles.end(),
+        static_cast<int32_t>(MediaAVCodec::HEVCProfile::HEVC_PROFILE_MAIN_10)) != bounds_.profiles.end();
+}
+
+bool EncodeDataProcess::IsHighProfileSupported()
+{
+    if (!preset_.isHighProfile || targetConfig_.GetVideoCodecType() != VideoCodecType::CODEC_H264) {
+        return false;
+    }
+    return std::find(bounds_.profiles.begin(), bounds_.profiles.end(),
+        static_cast<int32_t>(MediaAVCodec::AVCProfile::AVC_PROFILE_HIGH)) != bounds_.profiles.end();
+}
+
+void EncodeDataProcess::InitEncoderColorFormat()
+{
+    if (sourceConfig_.GetHdrType() == VideoHdrType::NONE) {
+        return;
+    }
+    int32_t transfer = (sourceConfig_.GetHdrType() == VideoHdrType::PQ) ? TRANSFER_CHARACTERISTIC_PQ :
+        TRANSFER_CHARACTERISTIC_HLG;
+    metadataFormat_.PutIntValue("color_primaries", COLOR_PRIMARY_BT2020);
+    metadataFormat_.PutIntValue("transfer_characteristics", transfer);
+    metadataFormat_.PutIntValue("matrix_coefficients", MATRIX_COEFFICIENT_BT2020_NCL);
+    metadataFormat_.PutIntValue("range_flag", 0);
+    DHLOGI("Encode BT.2020 with transfer characteristic %{public}d.", transfer);
+}
+
+bool EncodeDataProcess::IsLossResilientEnabled()
+{
+    int32_t enable = 0;
+    return GetSysPara(LOSS_RESILIENT_PARA, enable) && (enable == 1);
+}
+
+void EncodeDataProcess::InitLossResilientFormat()
+{
+    // Long IDR periods flatten the frame sizes, long term references let the codec recover without one.
+    metadataFormat_.PutIntValue("i_frame_interval", RESILIENT_IDR_FRAME_INTERVAL_MS);
+    int32_t ltrFrameCount = std::min(RESILIENT_LTR_FRAME_COUNT, bounds_.maxLtrFrameCount);
+    if (ltrFrameCount > 0) {
+        metadataFormat_.PutIntValue(LTR_FRAME_COUNT_KEY, ltrFrameCount);
+    }
+    DHLOGI("Loss resilient encoding, idr interval %{public}d ms, ltr frames %{public}d.",
+        RESILIENT_IDR_FRAME_INTERVAL_MS, ltrFrameCount);
+}
+
 int32_t EncodeDataProcess::InitEncoderBitrateFormat()
 {
     DHLOGD("Init video encoder bitrate format.");
     CHECK_AND_RETURN_RET_LOG(!(IsInEncoderRange(sourceConfig_) && IsInEncoderRange(targetConfig_)), DCAMERA_BAD_VALUE,
         "%{public}s", "Source config or target config are invalid.");
-    metadataFormat_.PutIntValue("i_frame_interval", IDR_FRAME_INTERVAL_MS);
-    metadataFormat_.PutIntValue("video_encode_bitrate_mode", MediaAVCodec::VideoEncodeBitrateMode::VBR);
+    metadataFormat_.PutIntValue("i_frame_interval", preset_.idrIntervalMs > 0 ? preset_.idrIntervalMs :
+        IDR_FRAME_INTERVAL_MS);
+    metadataFormat_.PutIntValue("video_encode_bitrate_mode", preset_.rateControl == EncoderRateControl::CBR ?
+        MediaAVCodec::VideoEncodeBitrateMode::CBR : MediaAVCodec::VideoEncodeBitrateMode::VBR);
+    presetGovernor_.Init(maxFrameRate_);
+    if (IsLossResilientEnabled()) {
+        InitLossResilientFormat();
+    }
 
     CHECK_AND_RETURN_RET_LOG(ENCODER_BITRATE_TABLE.empty(), DCAMERA_OK, "%{public}s",
         "ENCODER_BITRATE_TABLE is null, use the default bitrate of the encoder.");
@@ -256,13 +363,20 @@ int32_t EncodeDataProcess::InitEncoderBitrateFormat()
             matchedBitrate = it->second;
         }
     }
+    if (preset_.bitratePercent > 0) {
+        matchedBitrate = matchedBitrate * preset_.bitratePercent / PERCENT_BASE;
+    }
     DHLOGD("Source config: width : %{public}d, height : %{public}d, matched bitrate %{public}" PRId64,
         sourceConfig_.GetWidth(), sourceConfig_.GetHeight(), matchedBitrate);
     maxBitrate_ = matchedBitrate;
     minBitrate_ = static_cast<int64_t> (matchedBitrate / MINIMUM_BITRATE_FACTOR);
     currentBitrate_ = matchedBitrate - minBitrate_;
-    dynamicBitrateStep_ = maxBitrate_ - minBitrate_;
     metadataFormat_.PutLongValue("bitrate", currentBitrate_);
+    std::shared_ptr<DCameraPipelineSink> targetPipelineSink = callbackPipelineSink_.lock();
+    if (targetPipelineSink != nullptr) {
+        bitrateController_ = targetPipelineSink->GetBitrateController();
+        bitrateController_->Init(minBitrate_, maxBitrate_, currentBitrate_, maxFrameRate_);
+    }
     return DCAMERA_OK;
 }
 
@@ -318,10 +432,15 @@ void EncodeDataProcess::ReleaseVideoEncoder()
         return;
     }
     int32_t ret = StopVideoEncoder();
-    CHECK_AND_LOG(ret != DCAMERA_OK, "%{public}s", "StopVideoEncoder failed.");
-    ret = videoEncoder_->Release();
-    CHECK_AND_LOG(ret != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK,
-        "VideoEncoder release failed. ret %{public}d.", ret);
+    if (ret == DCAMERA_OK) {
+        DCameraCodecPool::GetInstance().ReturnEncoder(processType_, sourceConfig_.GetWidth(),
+            sourceConfig_.GetHeight(), videoEncoder_);
+    } else {
+        DHLOGE("StopVideoEncoder failed, release the encoder.");
+        ret = videoEncoder_->Release();
+        CHECK_AND_LOG(ret != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK,
+            "VideoEncoder release failed. ret %{public}d.", ret);
+    }
     encodeProducerSurface_ = nullptr;
     videoEncoder_ = nullptr;
     encodeVideoCallback_ = nullptr;
@@ -352,6 +471,7 @@ void EncodeDataProcess::ReleaseProcessNode()
     lastFeedEncoderInputBufferTimeUs_ = 0;
     inputTimeStampUs_ = 0;
     processType_ = "";
+    bitrateController_ = nullptr;
 
     if (nextDataProcess_ != nullptr) {
         nextDataProcess_->ReleaseProcessNode();
@@ -363,6 +483,8 @@ void EncodeDataProcess::ReleaseProcessNode()
 int32_t EncodeDataProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>& inputBuffers)
 {
     DHLOGD("Process data in EncodeDataProcess.");
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_ENCODE, DCAMERA_FRAME_TRACE_NO_INDEX);
+    DCameraNodeStatsScope statsScope(stats_, inputBuffers.size());
     if (inputBuffers.empty() || inputBuffers[0] == nullptr) {
         DHLOGE("The input data buffers is empty.");
         return DCAMERA_BAD_VALUE;
@@ -376,7 +498,7 @@ int32_t EncodeDataProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>&
         DHLOGE("The video encoder does not exist before encoding data.");
         return DCAMERA_INIT_ERR;
     }
-    if (inputBuffers[0]->Size() > NORM_YUV420_BUFFER_SIZE) {
+    if (inputBuffers[0]->Size() > static_cast<size_t>(maxInputSize_)) {
         DHLOGE("EncodeNode input buffer size %{public}zu error.", inputBuffers[0]->Size());
         return DCAMERA_MEMORY_OPT_ERROR;
     }
@@ -408,6 +530,11 @@ int32_t EncodeDataProcess::FeedEncoderInputBuffer(std::shared_ptr<DataBuffer>& i
         "memcpy_s encoder input producer surfacebuffer failed, surBufSize %{public}zu.", size);
 
     inputTimeStampUs_ = GetEncoderTimeStamp();
+    int64_t sensorTimeUs = 0;
+    // A frame stamped by the camera keeps its sensor time, the sink paces the send of its output by it.
+    if (inputBuffer->FindInt64(DataBufferKey::TIME_STAMP_US, sensorTimeUs) && (sensorTimeUs > 0)) {
+        inputTimeStampUs_ = sensorTimeUs * static_cast<int64_t>(US2NS);
+    }
     DHLOGD("Encoder input buffer size %{public}zu, timeStamp %{public}lld.", inputBuffer->Size(),
         (long long)inputTimeStampUs_);
     if (surfacebuffer->GetExtraData() == nullptr) {
@@ -444,6 +571,9 @@ sptr<SurfaceBuffer> EncodeDataProcess::GetEncoderInputSurfaceBuffer()
         case Videoformat::RGBA_8888:
             requestConfig.format = PixelFormat::PIXEL_FMT_RGBA_8888;
             break;
+        case Videoformat::P010:
+            requestConfig.format = OHOS::HDI::Display::Composer::V1_1::PIXEL_FMT_YCBCR_P010;
+            break;
         default:
             DHLOGE("The current pixel format does not support encoding.");
             return nullptr;
@@ -520,25 +650,28 @@ int32_t EncodeDataProcess::GetEncoderOutputBuffer(uint32_t index, MediaAVCodec::
         return DCAMERA_BAD_VALUE;
     }
     DHLOGD("Encoder output buffer size : %{public}zu", outputMemoDataSize);
-    std::shared_ptr<DataBuffer> bufferOutput = std::make_shared<DataBuffer>(outputMemoDataSize);
+    std::shared_ptr<DataBuffer> bufferOutput = DataBuffer::Acquire(outputMemoDataSize);
     CHECK_AND_RETURN_RET_LOG(bufferOutput->Data() == nullptr, DCAMERA_MEMORY_OPT_ERROR,
         "Sink point check failed: Failed to allocate output buffer.");
+    OnBufferAllocated(bufferOutput, DCAMERA_MEMORY_ENCODER);
     errno_t err = memcpy_s(bufferOutput->Data(), bufferOutput->Size(),
         buffer->GetBase(), outputMemoDataSize);
     CHECK_AND_RETURN_RET_LOG(err != EOK, DCAMERA_MEMORY_OPT_ERROR, "%{public}s", "memcpy_s buffer failed.");
     int64_t timeStamp = info.presentationTimeUs;
-    DHLOGI("get videoPts=%{public}" PRId64" from encoder", timeStamp);
+    DHLOGI_EVERY_N(DCAMERA_PRODUCER_FPS_DEFAULT, "get videoPts=%{public}" PRId64" from encoder", timeStamp);
     struct timespec time = {0, 0};
     clock_gettime(CLOCK_REALTIME, &time);
     int64_t timeNs = static_cast<int64_t>(time.tv_sec) * S2NS + static_cast<int64_t>(time.tv_nsec);
     int64_t encodeT = timeNs / static_cast<int64_t>(US2NS) - timeStamp;
     int64_t finishEncodeT = GetNowTimeStampUs();
     int64_t startEncodeT = finishEncodeT - encodeT;
-    bufferOutput->SetInt64(START_ENCODE_TIME_US, startEncodeT);
-    bufferOutput->SetInt64(FINISH_ENCODE_TIME_US, finishEncodeT);
-    bufferOutput->SetInt64(TIME_STAMP_US, timeStamp);
-    bufferOutput->SetInt32(FRAME_TYPE, flag);
-    bufferOutput->SetInt32(INDEX, index_);
+    bufferOutput->SetInt64(DataBufferKey::START_ENCODE_TIME_US, startEncodeT);
+    bufferOutput->SetInt64(DataBufferKey::FINISH_ENCODE_TIME_US, finishEncodeT);
+    bufferOutput->SetInt64(DataBufferKey::TIME_STAMP_US, timeStamp);
+    bufferOutput->SetInt32(DataBufferKey::FRAME_TYPE, flag);
+    bufferOutput->SetInt32(DataBufferKey::INDEX, index_);
+    bufferOutput->SetInt32(DataBufferKey::ENCODER_PRESET, presetCode_.load());
+    presetGovernor_.OnFrameEncoded(encodeT);
     index_++;
     std::vector<std::shared_ptr<DataBuffer>> nextInputBuffers;
     nextInputBuffers.push_back(bufferOutput);
@@ -553,6 +686,7 @@ int32_t EncodeDataProcess::EncodeDone(std::vector<std::shared_ptr<DataBuffer>>&
         return DCAMERA_BAD_VALUE;
     }
 
+    stats_.OnFramesOut(outputBuffers.size());
     if (nextDataProcess_ != nullptr) {
         DHLOGD("Send to the next node of the encoder for processing.");
         int32_t err = nextDataProcess_->ProcessData(outputBuffers);
@@ -565,11 +699,22 @@ int32_t EncodeDataProcess::EncodeDone(std::vector<std::shared_ptr<DataBuffer>>&
         DHLOGE("callbackPipelineSink_ is nullptr.");
         return DCAMERA_BAD_VALUE;
     }
+    size_t droppedNum = 0;
     {
         std::unique_lock<std::mutex> lock(encodeBuffersMutex_);
         encodeBuffers_.push_back(outputBuffers[0]);
+        stats_.SetQueueDepth(encodeBuffers_.size());
+        if (IsOverMemoryBudget()) {
+            droppedNum = DropQueuedDeltaFrames();
+        }
     }
     encodeBuffersCond_.notify_one();
+    if (droppedNum > 0) {
+        CountDroppedFrames(DCAMERA_DROP_MEMORY_BUDGET, droppedNum);
+        if (bitrateController_ != nullptr) {
+            bitrateController_->OnFramesDropped(static_cast<uint32_t>(droppedNum));
+        }
+    }
     return DCAMERA_OK;
 }
 
@@ -614,7 +759,7 @@ void EncodeDataProcess::OnOutputFormatChanged(const Media::Format &format)
 void EncodeDataProcess::OnOutputBufferAvailable(uint32_t index, MediaAVCodec::AVCodecBufferInfo info,
     MediaAVCodec::AVCodecBufferFlag flag, std::shared_ptr<Media::AVSharedMemory> buffer)
 {
-    DHLOGI("Waiting for encoder process to become available...");
+    DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "Waiting for encoder process to become available...");
     std::unique_lock<std::mutex> lock(isEncoderProcessMtx_);
     bool timeOut = !isEncoderProcessCond_.wait_for(lock, TIMEOUT_3_SEC, [this] {
         return isEncoderProcess_.load();
@@ -623,6 +768,7 @@ void EncodeDataProcess::OnOutputBufferAvailable(uint32_t index, MediaAVCodec::AV
         DHLOGE("Timed out waiting for encoder process after 3 second.");
         return;
     }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_ENCODE_OUTPUT, index_);
     DHLOGD("Video encode buffer info: presentation TimeUs %{public}" PRId64", size %{public}d, offset %{public}d, "
         "flag %{public}d", info.presentationTimeUs, info.size, info.offset, flag);
     int32_t err = GetEncoderOutputBuffer(index, info, flag, buffer);
@@ -654,55 +800,100 @@ int32_t EncodeDataProcess::GetProperty(const std::string& propertyName, Property
     }
     CHECK_AND_RETURN_RET_LOG(encodeProducerSurface_ == nullptr, DCAMERA_BAD_VALUE, "%{public}s",
         "EncodeDataProcess::GetProperty: encode dataProcess get property fail, encode surface is nullptr.");
+    // The sink commits the capture on this surface, camera frames then reach the encoder by buffer handle and
+    // FeedEncoderInputBuffer only serves frames that arrive as data buffers.
+    DHLOGI("Hand the encoder input surface to the camera, %{public}d x %{public}d.", sourceConfig_.GetWidth(),
+        sourceConfig_.GetHeight());
     encodeProducerSurface_->SetDefaultUsage(encodeProducerSurface_->GetDefaultUsage() & (~BUFFER_USAGE_VIDEO_ENCODER));
     return propertyCarrier.CarrySurfaceProperty(encodeProducerSurface_);
 }
 
-int32_t EncodeDataProcess::AdjustBitrateBasedOnNetworkConditions(bool isUp)
+int32_t EncodeDataProcess::SetEncoderBitrate(int64_t bitrate)
 {
-    DHLOGI("adjust bitrate enter,current bitrate: %{public}" PRId64, currentBitrate_);
-    int64_t newBitrate = 0;
-    if (isUp) {
-        newBitrate = std::min(currentBitrate_ + dynamicBitrateStep_, maxBitrate_);
-        DHLOGI("increasing bitrate, new bitrate: %{public}" PRId64, newBitrate);
-    } else {
-        newBitrate = std::min(static_cast<int64_t>(currentBitrate_ * MINIMUM_UNIT_OF_BITRATE), maxBitrate_);
-        dynamicBitrateStep_ = DEFAULT_VIDEO_DYNAMIC_BITRATE;
-        DHLOGI("reducing bitrate, new bitrate: %{public}" PRId64, newBitrate);
-    }
-    int64_t finalBitrate = RoundBitrates(newBitrate);
-    if (currentBitrate_ == maxBitrate_ && finalBitrate == maxBitrate_) {
-        isMaxBitrate_.store(true);
-        isMinBitrate_.store(false);
-        DHLOGI("currentBitrate_ equal to maxBitrate_, no need to adjust");
-        return DCAMERA_OK;
-    } else if (currentBitrate_ == minBitrate_ && finalBitrate == minBitrate_) {
-        isMaxBitrate_.store(false);
-        isMinBitrate_.store(true);
-        DHLOGI("currentBitrate_ equal to minBitrate_, no need to adjust");
-        return DCAMERA_OK;
-    }
-    isMaxBitrate_.store(false);
-    isMinBitrate_.store(false);
+    int64_t finalBitrate = RoundBitrates(bitrate);
+    CHECK_AND_RETURN_RET_LOG(videoEncoder_ == nullptr, DCAMERA_BAD_VALUE, "%{public}s", "videoEncoder_ is nullptr.");
     Media::Format format{};
     format.PutLongValue("bitrate", finalBitrate);
-    if (videoEncoder_ != nullptr) {
-        int32_t ret = videoEncoder_->SetParameter(format);
-        if (ret != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK) {
-            DHLOGE("Failed to reconfigure video encoder with new bitrate. Error code: %{public}d", ret);
-            return DCAMERA_BAD_OPERATE;
-        }
-        currentBitrate_ = finalBitrate;
-        DHLOGI("Successfully reconfigured video encoder with new bitrate: %{public}" PRId64, finalBitrate);
+    int32_t ret = videoEncoder_->SetParameter(format);
+    if (ret != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK) {
+        DHLOGE("Failed to reconfigure video encoder with new bitrate. Error code: %{public}d", ret);
+        return DCAMERA_BAD_OPERATE;
     }
+    DHLOGI("Reconfigured video encoder bitrate from %{public}" PRId64" to %{public}" PRId64, currentBitrate_,
+        finalBitrate);
+    currentBitrate_ = finalBitrate;
     return DCAMERA_OK;
 }
 
+int32_t EncodeDataProcess::RequestKeyFrame()
+{
+    CHECK_AND_RETURN_RET_LOG(videoEncoder_ == nullptr, DCAMERA_BAD_VALUE, "%{public}s", "videoEncoder_ is nullptr.");
+    Media::Format format{};
+    format.PutIntValue(REQUEST_I_FRAME_KEY, 1);
+    int32_t ret = videoEncoder_->SetParameter(format);
+    if (ret != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK) {
+        DHLOGE("Failed to request a key frame from video encoder. Error code: %{public}d", ret);
+        return DCAMERA_BAD_OPERATE;
+    }
+    DHLOGI("Requested a key frame after frames were lost on the channel.");
+    return DCAMERA_OK;
+}
+
+int32_t EncodeDataProcess::GetThermalLevel()
+{
+#ifdef DCAMERA_THERMAL_ENABLE
+    return static_cast<int32_t>(PowerMgr::ThermalMgrClient::GetInstance().GetThermalLevel());
+#else
+    return 0;
+#endif
+}
+
+void EncodeDataProcess::ApplyEncoderThrottle()
+{
+    int64_t nowUs = GetNowTimeStampUs();
+    if (nowUs - lastThermalQueryUs_ >= DCameraEncoderPreset::WINDOW_US) {
+        presetGovernor_.SetThermalLevel(GetThermalLevel());
+        lastThermalQueryUs_ = nowUs;
+    }
+    int32_t level = 0;
+    if (!presetGovernor_.Evaluate(nowUs, level)) {
+        return;
+    }
+    presetCode_.store(DCameraEncoderPreset::MakePresetCode(preset_.tier, level));
+    int64_t ceiling = maxBitrate_ * DCameraEncoderPreset::GetThrottlePercent(level) / PERCENT_BASE;
+    DHLOGI("Encoder throttle level %{public}d, bitrate ceiling %{public}" PRId64, level, ceiling);
+    if (bitrateController_ != nullptr) {
+        bitrateController_->SetLoadCeiling(level == 0 ? 0 : ceiling);
+    }
+}
+
+void EncodeDataProcess::ApplyBitrateDecision()
+{
+    ApplyEncoderThrottle();
+    if (bitrateController_ == nullptr) {
+        return;
+    }
+    if (bitrateController_->TakeKeyFrameRequest()) {
+        RequestKeyFrame();
+    }
+    BitrateDecision decision;
+    if (!bitrateController_->Evaluate(GetNowTimeStampUs(), decision)) {
+        return;
+    }
+    if (decision.bitrate != currentBitrate_) {
+        SetEncoderBitrate(decision.bitrate);
+    }
+    if (decision.needKeyFrame) {
+        RequestKeyFrame();
+    }
+}
+
 void EncodeDataProcess::SyncEncodeBufferThread()
 {
     DHLOGI("SyncEncodeBufferThread started ");
-    int32_t retryInterval = DCAMERA_SYNC_TIME_CONSTANTS_MS * RETRY_TIME_INTERVAL_FACTOR / maxFrameRate_;
-    const std::chrono::milliseconds BASE_FRAME_RETRY_INTERVAL(retryInterval);
+    DCameraThreadRoleRegistry::GetInstance().ApplyCurrentThread(DCAMERA_THREAD_FRAME, ENCODE_SYNC_THREAD);
+    // Upper bound of one wait for the channel, a returned send credit wakes the thread earlier.
+    int64_t writableTimeoutMs = DCAMERA_SYNC_TIME_CONSTANTS_MS * RETRY_TIME_INTERVAL_FACTOR / maxFrameRate_;
 
     while (isEncoderProcess_.load()) {
         std::shared_ptr<DataBuffer> buffer = nullptr;
@@ -714,32 +905,33 @@ void EncodeDataProcess::SyncEncodeBufferThread()
                 break;
             }
             if (encodeBuffers_.empty()) {
-                DHLOGI("empty encodeBuffers_.");
+                DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "empty encodeBuffers_.");
                 continue;
             }
             buffer = encodeBuffers_.front();
             encodeBuffers_.pop_front();
+            stats_.SetQueueDepth(encodeBuffers_.size());
         }
         if (buffer == nullptr) {
             continue;
         }
+        int64_t finishEncodeT = 0;
+        if (buffer->FindInt64(DataBufferKey::FINISH_ENCODE_TIME_US, finishEncodeT)) {
+            stats_.AddWaitTime(GetNowTimeStampUs() - finishEncodeT);
+        }
         bool isKeyFrame = IsKeyFrame(buffer);
         if (!isKeyFrame && isSkipState_.load()) {
+            CountDroppedFrames(DCAMERA_DROP_WAIT_KEY_FRAME, 1);
             continue;
         } else if (isKeyFrame && isSkipState_.load() && lastKeyFrameIndex_.load() != curKeyFrameIndex_.load()) {
             isSkipState_.store(false);
         }
-        int32_t ret = OnProcessedEncodeVideoBuffer(buffer, isKeyFrame);
+        int32_t ret = OnProcessedEncodeVideoBuffer(buffer);
+        ApplyBitrateDecision();
         if (ret == DCAMERA_OK) {
-            std::unique_lock<std::mutex> lock(encodeBuffersMutex_);
-            int32_t currentSize = static_cast<int32_t>(encodeBuffers_.size());
-            if (currentSize >= (maxFrameRate_ / SYNCQUEUE_DIVIDE_FOUR)) {
-                DHLOGI("current encodebuffer size %{public}d.", currentSize);
-                std::this_thread::sleep_for(BASE_FRAME_RETRY_INTERVAL);
-            }
             continue;
         } else if (ret == DCAMERA_TRANS_BUSY) {
-            std::this_thread::sleep_for(BASE_FRAME_RETRY_INTERVAL);
+            WaitEncodeOutputWritable(writableTimeoutMs);
         } else {
             DHLOGE("encode buffer process failed, ret:%{public}d", ret);
             break;
@@ -748,14 +940,23 @@ void EncodeDataProcess::SyncEncodeBufferThread()
     DHLOGI("SyncEncodeBufferThread exited");
 }
 
+void EncodeDataProcess::WaitEncodeOutputWritable(int64_t timeoutMs)
+{
+    std::shared_ptr<DCameraPipelineSink> targetPipelineSink = callbackPipelineSink_.lock();
+    CHECK_AND_RETURN_LOG(targetPipelineSink == nullptr, "%{public}s", "targetPipelineSink is nullptr");
+    if (!targetPipelineSink->WaitOutputWritable(timeoutMs)) {
+        DHLOGD("Sink channel is still busy after %{public}" PRId64" ms.", timeoutMs);
+    }
+}
+
 bool EncodeDataProcess::IsKeyFrame(const std::shared_ptr<DataBuffer>& inputBuffer)
 {
     int32_t frameType = MediaAVCodec::AVCODEC_BUFFER_FLAG_SYNC_FRAME;
     int32_t frameIndex = 0;
-    if (!inputBuffer->FindInt32(FRAME_TYPE, frameType)) {
+    if (!inputBuffer->FindInt32(DataBufferKey::FRAME_TYPE, frameType)) {
         DHLOGE("key frame find %{public}s failed.", FRAME_TYPE.c_str());
     }
-    if (!inputBuffer->FindInt32(INDEX, frameIndex)) {
+    if (!inputBuffer->FindInt32(DataBufferKey::INDEX, frameIndex)) {
         DHLOGE("frame index find %{public}s failed.", INDEX.c_str());
     }
     if (frameType == MediaAVCodec::AVCODEC_BUFFER_FLAG_NONE) {
@@ -766,7 +967,7 @@ bool EncodeDataProcess::IsKeyFrame(const std::shared_ptr<DataBuffer>& inputBuffe
     }
 }
 
-int32_t EncodeDataProcess::OnProcessedEncodeVideoBuffer(std::shared_ptr<DataBuffer>& encodeBuffer, bool isKeyFrame)
+int32_t EncodeDataProcess::OnProcessedEncodeVideoBuffer(std::shared_ptr<DataBuffer>& encodeBuffer)
 {
     std::shared_ptr<DCameraPipelineSink> targetPipelineSink = callbackPipelineSink_.lock();
     if (targetPipelineSink == nullptr) {
@@ -774,58 +975,49 @@ int32_t EncodeDataProcess::OnProcessedEncodeVideoBuffer(std::shared_ptr<DataBuff
         return DCAMERA_BAD_OPERATE;
     }
     int32_t ret = targetPipelineSink->OnProcessedVideoBuffer(encodeBuffer);
-    if (ret == DCAMERA_OK) {
-        SyncVideoFrameSuccess(isKeyFrame);
-    } else if (ret == DCAMERA_TRANS_BUSY) {
+    if (ret == DCAMERA_TRANS_BUSY) {
+        if (bitrateController_ != nullptr) {
+            bitrateController_->OnSendBusy();
+        }
         SyncVideoFrameFailure(encodeBuffer);
     }
     return ret;
 }
 
-void EncodeDataProcess::SyncVideoFrameSuccess(bool isKeyFrame)
-{
-    if (isKeyFrame) {
-        syncKeyFrameSuccNum_++;
-        DHLOGI("sync keyFrame num_ %{public}d.", syncKeyFrameSuccNum_);
-    }
-    if (syncKeyFrameSuccNum_ >= BITRATE_INCREASE_STANDARD) {
-        if (!isMaxBitrate_.load()) {
-            AdjustBitrateBasedOnNetworkConditions(true);
-        }
-        syncKeyFrameSuccNum_ = 0;
-    }
-}
-
 void EncodeDataProcess::SyncVideoFrameFailure(std::shared_ptr<DataBuffer>& encodeBuffer)
 {
-    syncKeyFrameSuccNum_ = 0;
-    int32_t currentSize = 0;
+    size_t droppedNum = 0;
     {
         std::unique_lock<std::mutex> lock(encodeBuffersMutex_);
         encodeBuffers_.push_front(encodeBuffer);
-        currentSize = static_cast<int32_t>(encodeBuffers_.size());
-        DHLOGI("current encodebuffer size %{public}d.", currentSize);
+        int32_t currentSize = static_cast<int32_t>(encodeBuffers_.size());
+        DHLOGI_RATELIMITED(DCAMERA_FRAME_LOG_INTERVAL_MS, "current encodebuffer size %{public}d.", currentSize);
         if (currentSize < (maxFrameRate_ / SYNCQUEUE_DIVIDE_TWO)) {
             return;
         }
+        droppedNum = DropQueuedDeltaFrames();
     }
-
-    if (!isMinBitrate_.load()) {
-        AdjustBitrateBasedOnNetworkConditions(false);
+    CountDroppedFrames(DCAMERA_DROP_SEND_CONGESTION, droppedNum);
+    if (bitrateController_ != nullptr) {
+        bitrateController_->OnFramesDropped(static_cast<uint32_t>(droppedNum));
     }
+}
 
-    {
-        std::unique_lock<std::mutex> lock(encodeBuffersMutex_);
-        std::deque<std::shared_ptr<DataBuffer>> tempQueue;
-        for (const auto& dataBuffer : encodeBuffers_) {
-            if (dataBuffer && IsKeyFrame(dataBuffer)) {
-                tempQueue.push_back(dataBuffer);
-                lastKeyFrameIndex_.store(curKeyFrameIndex_.load());
-            }
+size_t EncodeDataProcess::DropQueuedDeltaFrames()
+{
+    size_t droppedNum = encodeBuffers_.size();
+    std::deque<std::shared_ptr<DataBuffer>> tempQueue;
+    for (const auto& dataBuffer : encodeBuffers_) {
+        if (dataBuffer && IsKeyFrame(dataBuffer)) {
+            tempQueue.push_back(dataBuffer);
+            lastKeyFrameIndex_.store(curKeyFrameIndex_.load());
         }
-        encodeBuffers_ = std::move(tempQueue);
-        isSkipState_.store(true);
     }
+    droppedNum -= tempQueue.size();
+    encodeBuffers_ = std::move(tempQueue);
+    stats_.SetQueueDepth(encodeBuffers_.size());
+    isSkipState_.store(true);
+    return droppedNum;
 }
 
 int64_t EncodeDataProcess::RoundBitrates(int64_t tempBitrate)
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rotate_letterbox_process.h"
+
+#include <algorithm>
+#include <new>
+
+#include "dcamera_hitrace_adapter.h"
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+#include "image_plane_kernels.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+RotateLetterboxProcess::~RotateLetterboxProcess()
+{
+    if (isRotateProcess_.load()) {
+        ReleaseProcessNode();
+    }
+}
+
+int32_t RotateLetterboxProcess::InitNode(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig, VideoConfigParams& processedConfig)
+{
+    DHLOGI("RotateLetterboxProcess::InitNode start");
+    sourceConfig_ = sourceConfig;
+    targetConfig_ = targetConfig;
+    processedConfig_ = sourceConfig;
+    processedConfig = processedConfig_;
+
+    int32_t rotate = targetConfig_.GetRotation();
+    rotate_.store(GetImageRotation(targetConfig_));
+    {
+        std::lock_guard<std::mutex> lock(scratchMutex_);
+        if (!ReserveScratch(sourceConfig_.GetWidth(), sourceConfig_.GetHeight())) {
+            DHLOGE("Reserve rotate scratch failed, width %{public}d, height %{public}d.", sourceConfig_.GetWidth(),
+                sourceConfig_.GetHeight());
+            return DCAMERA_BAD_VALUE;
+        }
+    }
+    isRotateProcess_.store(true);
+    DHLOGI("RotateLetterboxProcess::InitNode success, orientation: %{public}d, img rotate: %{public}d", rotate,
+        rotate_.load());
+    return DCAMERA_OK;
+}
+
+int32_t RotateLetterboxProcess::UpdateConfig(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig, VideoConfigParams& processedConfig)
+{
+    // Frames carry their own size and the scratch only grows, RotateImage reserves it for the first larger frame.
+    sourceConfig_ = sourceConfig;
+    targetConfig_ = targetConfig;
+    processedConfig_ = sourceConfig;
+    processedConfig = processedConfig_;
+    rotate_.store(GetImageRotation(targetConfig_));
+    DHLOGI("RotateLetterboxProcess::UpdateConfig %{public}dx%{public}d, img rotate: %{public}d",
+        sourceConfig_.GetWidth(), sourceConfig_.GetHeight(), rotate_.load());
+    return DCAMERA_OK;
+}
+
+int32_t RotateLetterboxProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>& inputBuffers)
+{
+    if (!isRotateProcess_.load()) {
+        DHLOGE("RotateLetterbox node occurred error or start release.");
+        return DCAMERA_DISABLE_PROCESS;
+    }
+    if (inputBuffers.empty() || inputBuffers[0] == nullptr) {
+        DHLOGE("Input buffers is empty");
+        return DCAMERA_BAD_VALUE;
+    }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_ROTATE, inputBuffers[0]->frameInfo_.index);
+    DCameraNodeStatsScope statsScope(stats_, inputBuffers.size());
+
+    int32_t err = RotateImage(inputBuffers[0], NormalizeAngle(rotate_.load()));
+    if (err != DCAMERA_OK) {
+        DHLOGE("Rotate image failed, ret %{public}d.", err);
+        return err;
+    }
+    return RotateDone(inputBuffers);
+}
+
+int32_t RotateLetterboxProcess::RotateImage(const std::shared_ptr<DataBuffer>& imgBuf, int32_t angle)
+{
+    if (angle == ROTATION_0) {
+        return DCAMERA_OK;
+    }
+    int32_t format = 0;
+    int32_t width = 0;
+    int32_t height = 0;
+    bool found = imgBuf->FindInt32(DataBufferKey::VIDEO_FORMAT, format) &&
+        imgBuf->FindInt32(DataBufferKey::WIDTH, width) && imgBuf->FindInt32(DataBufferKey::HEIGHT, height);
+    if (!found || format != static_cast<int32_t>(Videoformat::YUVI420)) {
+        DHLOGD("Only I420 frames are rotated, format %{public}d.", format);
+        return DCAMERA_OK;
+    }
+    if (width <= 0 || height <= 0 || (width % Y2UV_RATIO != 0) || (height % Y2UV_RATIO != 0)) {
+        DHLOGE("Invalid image size, width %{public}d, height %{public}d.", width, height);
+        return DCAMERA_BAD_VALUE;
+    }
+    int32_t widthUV = width / Y2UV_RATIO;
+    int32_t heightUV = height / Y2UV_RATIO;
+    size_t sizeY = static_cast<size_t>(width) * static_cast<size_t>(height);
+    size_t sizeUV = static_cast<size_t>(widthUV) * static_cast<size_t>(heightUV);
+    CHECK_AND_RETURN_RET_LOG(imgBuf->Size() < sizeY + sizeUV * Y2UV_RATIO, DCAMERA_BAD_VALUE,
+        "Image buffer is too small, size %{public}zu.", imgBuf->Size());
+
+    std::lock_guard<std::mutex> lock(scratchMutex_);
+    CHECK_AND_RETURN_RET_LOG(!ReserveScratch(width, height), DCAMERA_BAD_VALUE, "Reserve rotate scratch failed.");
+    uint8_t *planeY = imgBuf->Data();
+    uint8_t *planeU = planeY + sizeY;
+    uint8_t *planeV = planeU + sizeUV;
+    if (angle == ROTATION_180) {
+        int32_t err = RotatePlane180(planeY, width, height);
+        err = (err == DCAMERA_OK) ? RotatePlane180(planeU, widthUV, heightUV) : err;
+        return (err == DCAMERA_OK) ? RotatePlane180(planeV, widthUV, heightUV) : err;
+    }
+
+    // The luma region is even aligned, so the chroma region is exactly half of it.
+    LetterboxRegion region = GetLetterboxRegion(width, height, angle);
+    LetterboxRegion regionUV = { region.srcX / Y2UV_RATIO, region.srcY / Y2UV_RATIO, region.dstX / Y2UV_RATIO,
+        region.dstY / Y2UV_RATIO, region.size / Y2UV_RATIO };
+    int32_t err = RotatePlaneLetterbox(planeY, width, height, region, angle, BLACK_COLOR_PEXEL);
+    err = (err == DCAMERA_OK) ?
+        RotatePlaneLetterbox(planeU, widthUV, heightUV, regionUV, angle, WHITE_COLOR_PEXEL) : err;
+    return (err == DCAMERA_OK) ?
+        RotatePlaneLetterbox(planeV, widthUV, heightUV, regionUV, angle, WHITE_COLOR_PEXEL) : err;
+}
+
+int32_t RotateLetterboxProcess::RotatePlane180(uint8_t *plane, int32_t width, int32_t height)
+{
+    // Mirror the rows pairwise from both ends, one row of scratch holds the top row meanwhile.
+    uint8_t *rowScratch = scratch_.data();
+    for (int32_t top = 0, bottom = height - 1; top <= bottom; top++, bottom--) {
+        uint8_t *topRow = plane + static_cast<size_t>(top) * width;
+        uint8_t *bottomRow = plane + static_cast<size_t>(bottom) * width;
+        int32_t err = ImagePlaneKernels::RotatePlane(topRow, width, rowScratch, width, width, 1, ROTATION_180);
+        CHECK_AND_RETURN_RET_LOG(err != DCAMERA_OK, err, "Mirror top row failed.");
+        if (top != bottom) {
+            err = ImagePlaneKernels::RotatePlane(bottomRow, width, topRow, width, width, 1, ROTATION_180);
+            CHECK_AND_RETURN_RET_LOG(err != DCAMERA_OK, err, "Mirror bottom row failed.");
+        }
+        ImagePlaneKernels::CopyPlane(rowScratch, width, bottomRow, width, width, 1);
+    }
+    return DCAMERA_OK;
+}
+
+int32_t RotateLetterboxProcess::RotatePlaneLetterbox(uint8_t *plane, int32_t width, int32_t height,
+    const LetterboxRegion& region, int32_t angle, uint8_t fillValue)
+{
+    const uint8_t *srcSquare = plane + static_cast<size_t>(region.srcY) * width + region.srcX;
+    int32_t err = ImagePlaneKernels::RotatePlane(srcSquare, width, scratch_.data(), region.size, region.size,
+        region.size, angle);
+    CHECK_AND_RETURN_RET_LOG(err != DCAMERA_OK, err, "Rotate square failed.");
+    size_t planeSize = static_cast<size_t>(width) * static_cast<size_t>(height);
+    CHECK_AND_RETURN_RET_LOG(memset_s(plane, planeSize, fillValue, planeSize) != EOK, DCAMERA_MEMORY_OPT_ERROR,
+        "Fill letterbox failed.");
+    uint8_t *dstSquare = plane + static_cast<size_t>(region.dstY) * width + region.dstX;
+    ImagePlaneKernels::CopyPlane(scratch_.data(), region.size, dstSquare, width, region.size, region.size);
+    return DCAMERA_OK;
+}
+
+bool RotateLetterboxProcess::ReserveScratch(int32_t width, int32_t height)
+{
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+    int32_t square = std::min(width, height);
+    size_t capacity = std::max(static_cast<size_t>(square) * static_cast<size_t>(square), static_cast<size_t>(width));
+    if (scratch_.size() >= capacity) {
+        return true;
+    }
+    DHLOGI("Reserve rotate scratch %{public}zu bytes, width %{public}d, height %{public}d.", capacity, width, height);
+    std::vector<uint8_t> scratch(capacity);
+    scratch_.swap(scratch);
+    return true;
+}
+
+int32_t RotateLetterboxProcess::GetImageRotation(const VideoConfigParams& targetConfig)
+{
+    int32_t rotate = targetConfig.GetRotation();
+    return rotate > 0 ? NormalizeAngle(ROTATION_360 - rotate) : ROTATION_0;
+}
+
+int32_t RotateLetterboxProcess::NormalizeAngle(int32_t angle)
+{
+    int32_t normalized = (angle % ROTATION_360 + ROTATION_360) % ROTATION_360;
+    switch (normalized) {
+        case ROTATION_90:
+        case ROTATION_180:
+        case ROTATION_270:
+            return normalized;
+        default:
+            return ROTATION_0;
+    }
+}
+
+RotateLetterboxProcess::LetterboxRegion RotateLetterboxProcess::GetLetterboxRegion(int32_t width, int32_t height,
+    int32_t angle)
+{
+    // The centered square of the height x width rotated image is pasted centered, offsets kept even for chroma.
+    // Its crop offset in the rotated image is (pasteY, pasteX), mapped back to the source square below.
+    int32_t size = std::min(width, height);
+    int32_t pasteX = static_cast<int32_t>(static_cast<uint32_t>((width - size) / Y2UV_RATIO) & ~1U);
+    int32_t pasteY = static_cast<int32_t>(static_cast<uint32_t>((height - size) / Y2UV_RATIO) & ~1U);
+    LetterboxRegion region;
+    region.dstX = pasteX;
+    region.dstY = pasteY;
+    region.size = size;
+    if (angle == ROTATION_90) {
+        region.srcX = pasteX;
+        region.srcY = height - pasteY - size;
+    } else {
+        region.srcX = width - pasteX - size;
+        region.srcY = pasteY;
+    }
+    return region;
+}
+
+void RotateLetterboxProcess::ReleaseProcessNode()
+{
+    DHLOGI("ReleaseProcessNode start");
+    isRotateProcess_.store(false);
+    {
+        std::lock_guard<std::mutex> lock(scratchMutex_);
+        std::vector<uint8_t>().swap(scratch_);
+    }
+    if (nextDataProcess_ != nullptr) {
+        nextDataProcess_->ReleaseProcessNode();
+        nextDataProcess_ = nullptr;
+    }
+    DHLOGI("ReleaseProcessNode end");
+}
+
+int32_t RotateLetterboxProcess::RotateDone(std::vector<std::shared_ptr<DataBuffer>>& outputBuffers)
+{
+    stats_.OnFramesOut(outputBuffers.size());
+    if (nextDataProcess_ != nullptr) {
+        DHLOGD("Send to the next node of the rotate for processing.");
+        int32_t err = nextDataProcess_->ProcessData(outputBuffers);
+        if (err != DCAMERA_OK) {
+            DHLOGE("Some node after rotate process failed.");
+        }
+        return err;
+    }
+
+    DHLOGD("The current node is the last node, and output the processed video buffer.");
+    auto pipelineSource = callbackPipelineSource_.lock();
+    if (pipelineSource == nullptr) {
+        DHLOGE("Pipeline source is nullptr");
+        return DCAMERA_BAD_VALUE;
+    }
+    pipelineSource->OnProcessedVideoBuffer(outputBuffers[0]);
+    return DCAMERA_OK;
+}
+
+int32_t RotateLetterboxProcess::GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier)
+{
+    return DCAMERA_OK;
+}
+
+int32_t RotateLetterboxProcess::UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings)
+{
+    if (settings == nullptr) {
+        DHLOGE("settings is null");
+        return DCAMERA_BAD_VALUE;
+    }
+    camera_metadata_item_t switchInfoItem;
+    int32_t result = OHOS::Camera::FindCameraMetadataItem(settings->get(),
+        OHOS_CONTROL_CAMERA_SWITCH_INFOS, &switchInfoItem);
+    if (result != CAM_META_SUCCESS || switchInfoItem.count == 0) {
+        DHLOGI("UpdateSettings get system switch setting fail");
+        return DCAMERA_OK;
+    }
+    int32_t cameraRotation = switchInfoItem.data.i32[0];
+    int32_t screenOrient = 0;
+    if (switchInfoItem.count > 1) {
+        screenOrient = switchInfoItem.data.i32[1];
+    }
+
+    int32_t rotate = 0;
+    if (cameraRotation == ROTATION_90) {
+        if (screenOrient == ROTATION_180 || screenOrient == ROTATION_0) {
+            rotate = (screenOrient - cameraRotation + ROTATION_360) % ROTATION_360;
+        } else {
+            rotate = (screenOrient - cameraRotation + ROTATION_180) % ROTATION_360;
+        }
+    } else {
+        rotate = (screenOrient - cameraRotation + ROTATION_360) % ROTATION_360;
+    }
+    rotate_.store(rotate);
+    DHLOGI("UpdateSettings sensorRotation: %{public}d, screenOrient: %{public}d, img rotate: %{public}d",
+        cameraRotation, screenOrient, rotate);
+    return DCAMERA_OK;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scale_convert_blit_backend.h"
+
+#include <dlfcn.h>
+
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+#include "scale_convert_super_res_backend.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+std::unique_ptr<IScaleConvertBackend> CreateScaleConvertBackend(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig)
+{
+    std::unique_ptr<IScaleConvertBackend> backend = std::make_unique<ScaleConvertBlitBackend>();
+    if (backend->Init(sourceConfig, targetConfig) != DCAMERA_OK) {
+        backend = nullptr;
+    }
+    if (!ScaleConvertSuperResBackend::IsUpscale(sourceConfig, targetConfig)) {
+        return backend;
+    }
+    // An upscale goes to the super resolution engine first, the blit engine takes what it leaves.
+    std::unique_ptr<ScaleConvertSuperResBackend> superRes = std::make_unique<ScaleConvertSuperResBackend>();
+    if (superRes->Init(sourceConfig, targetConfig) != DCAMERA_OK) {
+        return backend;
+    }
+    superRes->SetFallback(std::move(backend));
+    return superRes;
+}
+
+ScaleConvertBlitBackend::~ScaleConvertBlitBackend()
+{
+    Release();
+}
+
+int32_t ScaleConvertBlitBackend::Init(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig)
+{
+    std::lock_guard<std::mutex> autoLock(blitMutex_);
+    if (!LoadLibrary()) {
+        return DCAMERA_NOT_FOUND;
+    }
+    DCameraBlitImage src = { static_cast<int32_t>(sourceConfig.GetVideoformat()), sourceConfig.GetWidth(),
+        sourceConfig.GetHeight(), sourceConfig.GetWidth(), sourceConfig.GetHeight(), nullptr, 0 };
+    DCameraBlitImage dst = { static_cast<int32_t>(targetConfig.GetVideoformat()), targetConfig.GetWidth(),
+        targetConfig.GetHeight(), targetConfig.GetWidth(), targetConfig.GetHeight(), nullptr, 0 };
+    context_ = createFunc_(&src, &dst);
+    if (context_ == nullptr) {
+        DHLOGI("Blit engine refuses %{public}dx%{public}d fmt %{public}d -> %{public}dx%{public}d fmt %{public}d.",
+            src.width, src.height, src.format, dst.width, dst.height, dst.format);
+        return DCAMERA_BAD_VALUE;
+    }
+    DHLOGI("Blit engine takes %{public}dx%{public}d fmt %{public}d -> %{public}dx%{public}d fmt %{public}d.",
+        src.width, src.height, src.format, dst.width, dst.height, dst.format);
+    return DCAMERA_OK;
+}
+
+bool ScaleConvertBlitBackend::LoadLibrary()
+{
+    if (dlHandler_ != nullptr) {
+        return true;
+    }
+    dlHandler_ = dlopen(BLIT_LIB_PATH, RTLD_LAZY | RTLD_NODELETE);
+    if (dlHandler_ == nullptr) {
+        DHLOGI("No blit engine library, scale convert stays on the CPU.");
+        return false;
+    }
+    createFunc_ = reinterpret_cast<DCameraBlitCreateFunc>(dlsym(dlHandler_, BLIT_CREATE_FUNC));
+    convertFunc_ = reinterpret_cast<DCameraBlitConvertFunc>(dlsym(dlHandler_, BLIT_CONVERT_FUNC));
+    destroyFunc_ = reinterpret_cast<DCameraBlitDestroyFunc>(dlsym(dlHandler_, BLIT_DESTROY_FUNC));
+    if (createFunc_ == nullptr || convertFunc_ == nullptr || destroyFunc_ == nullptr) {
+        DHLOGE("Blit engine library lacks its entry points, failed reason: %{public}s.", dlerror());
+        dlclose(dlHandler_);
+        dlHandler_ = nullptr;
+        createFunc_ = nullptr;
+        convertFunc_ = nullptr;
+        destroyFunc_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+int32_t ScaleConvertBlitBackend::Convert(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo)
+{
+    std::lock_guard<std::mutex> autoLock(blitMutex_);
+    CHECK_AND_RETURN_RET_LOG(context_ == nullptr, DCAMERA_BAD_OPERATE, "Blit engine is not initialized.");
+    CHECK_AND_RETURN_RET_LOG(srcImgInfo.imgData == nullptr || dstImgInfo.imgData == nullptr, DCAMERA_BAD_VALUE,
+        "Blit image data is null.");
+    DCameraBlitImage src = ToBlitImage(srcImgInfo);
+    DCameraBlitImage dst = ToBlitImage(dstImgInfo);
+    int32_t ret = convertFunc_(context_, &src, &dst);
+    CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, DCAMERA_BAD_OPERATE, "Blit convert failed, ret: %{public}d.", ret);
+    return DCAMERA_OK;
+}
+
+DCameraBlitImage ScaleConvertBlitBackend::ToBlitImage(const ImageUnitInfo& imgInfo)
+{
+    return { static_cast<int32_t>(imgInfo.colorFormat), imgInfo.width, imgInfo.height, imgInfo.alignedWidth,
+        imgInfo.alignedHeight, imgInfo.imgData->Data(), imgInfo.imgData->Size() };
+}
+
+void ScaleConvertBlitBackend::Release()
+{
+    std::lock_guard<std::mutex> autoLock(blitMutex_);
+    if (context_ != nullptr && destroyFunc_ != nullptr) {
+        destroyFunc_(context_);
+    }
+    context_ = nullptr;
+    if (dlHandler_ != nullptr) {
+        dlclose(dlHandler_);
+        dlHandler_ = nullptr;
+    }
+    createFunc_ = nullptr;
+    convertFunc_ = nullptr;
+    destroyFunc_ = nullptr;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,6 +19,10 @@
 #include "distributed_camera_errno.h"
 #include "distributed_hardware_log.h"
 #include "dcamera_frame_info.h"
+#include "dcamera_hitrace_adapter.h"
+#include "image_plane_kernels.h"
+#include "rotate_letterbox_process.h"
+#include <algorithm>
 #include <cmath>
 
 namespace OHOS {
@@ -42,6 +46,10 @@ int32_t ScaleConvertProcess::InitNode(const VideoConfigParams& sourceConfig, con
     processedConfig_.SetWidthAndHeight(targetConfig.GetWidth(), targetConfig.GetHeight());
     processedConfig_.SetVideoformat(targetConfig.GetVideoformat());
     processedConfig = processedConfig_;
+    isFusedRotate_ = IsFusedRotateSupported(sourceConfig, targetConfig);
+    fusedAngle_ = RotateLetterboxProcess::GetImageRotation(targetConfig);
+    fusedWidth_ = 0;
+    fusedHeight_ = 0;
 
     if (!IsConvertible(sourceConfig, targetConfig)) {
         DHLOGI("sourceConfig: Videoformat %{public}d Width %{public}d, Height %{public}d is the same as the "
@@ -50,21 +58,26 @@ int32_t ScaleConvertProcess::InitNode(const VideoConfigParams& sourceConfig, con
             targetConfig.GetVideoformat(), targetConfig.GetWidth(), targetConfig.GetHeight());
     }
 
-    if (targetConfig.GetVideoformat() == Videoformat::P010) {
-        AVPixelFormat sourceFmt = GetAVPixelFormat(sourceConfig.GetVideoformat());
-        AVPixelFormat targetFmt = GetAVPixelFormat(targetConfig.GetVideoformat());
-        DHLOGI("VideoFormat P010 src fmt: %{public}d -> %{public}d, dst fmt: %{public}d -> %{public}d",
-            sourceConfig.GetVideoformat(), sourceFmt, targetConfig.GetVideoformat(), targetFmt);
-        swsContext_ = sws_getContext(sourceConfig_.GetWidth(), sourceConfig_.GetHeight(), sourceFmt,
-            processedConfig_.GetWidth(), processedConfig_.GetHeight(), targetFmt,
-            SWS_FAST_BILINEAR | SWS_FULL_CHR_H_INT, nullptr, nullptr, nullptr);
-        CHECK_AND_RETURN_RET_LOG(swsContext_ == nullptr, DCAMERA_MEMORY_OPT_ERROR,
-            "Failed to create sws context for P010 conversion");
+    rgbTable_ = &YuvColorKernels::GetYuvToRgbTable(sourceConfig_.GetColorSpace());
+    if (!isFusedRotate_ && IsConvertible(sourceConfig, targetConfig)) {
+        backend_ = CreateScaleConvertBackend(sourceConfig_, processedConfig_);
     }
     isScaleConvert_.store(true);
     return DCAMERA_OK;
 }
 
+int32_t ScaleConvertProcess::UpdateConfig(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig, VideoConfigParams& processedConfig)
+{
+    DHLOGI("ScaleConvertProcess : UpdateConfig.");
+    std::lock_guard<std::mutex> autoLock(scaleMutex_);
+    if (backend_ != nullptr) {
+        backend_->Release();
+        backend_ = nullptr;
+    }
+    return InitNode(sourceConfig, targetConfig, processedConfig);
+}
+
 bool ScaleConvertProcess::IsConvertible(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig)
 {
     return (sourceConfig_.GetWidth() != targetConfig.GetWidth()) ||
@@ -79,9 +92,8 @@ void ScaleConvertProcess::ReleaseProcessNode()
 
     {
         std::lock_guard<std::mutex> autoLock(scaleMutex_);
-        if (swsContext_ != nullptr) {
-            sws_freeContext(swsContext_);
-            swsContext_ = nullptr;
+        if (backend_ != nullptr) {
+            backend_->Release();
         }
     }
 
@@ -92,77 +104,55 @@ void ScaleConvertProcess::ReleaseProcessNode()
     DHLOGI("Release [%{public}zu] node : ScaleConvertNode end.", nodeRank_);
 }
 
-void ScaleConvertProcess::Crop(ImageUnitInfo& sourceConfig, ImageUnitInfo& targetConfig)
+bool ScaleConvertProcess::GetCropSize(int32_t srcWidth, int32_t srcHeight, int32_t dstWidth, int32_t dstHeight,
+    int32_t& cropWidth, int32_t& cropHeight)
 {
-    const double src_width = static_cast<double>(sourceConfig.width);
-    const double src_height = static_cast<double>(sourceConfig.height);
-    const double dst_width = static_cast<double>(targetConfig.width);
-    const double dst_height = static_cast<double>(targetConfig.height);
+    const double src_width = static_cast<double>(srcWidth);
+    const double src_height = static_cast<double>(srcHeight);
+    const double dst_width = static_cast<double>(dstWidth);
+    const double dst_height = static_cast<double>(dstHeight);
     double src_ratio = src_width / src_height;
     double dst_ratio = dst_width / dst_height;
+    cropWidth = srcWidth;
+    cropHeight = srcHeight;
     if (std::abs(src_ratio - dst_ratio) < 1e-6) {
         DHLOGI("Same aspect ratio");
-        return;
+        return false;
     }
-    int crop_width = 0;
-    int crop_height = 0;
     if (src_ratio > dst_ratio) {
         DHLOGI("The source aspect ratio is greater than the target aspect ratio");
-        crop_width = static_cast<int>(src_height * dst_width / dst_height);
-        crop_height = src_height;
+        cropWidth = static_cast<int32_t>(src_height * dst_width / dst_height);
     } else {
         DHLOGI("The source aspect ratio is less than the target aspect ratio");
-        crop_width = src_width;
-        crop_height = static_cast<int>(src_width * dst_height / dst_width);
+        cropHeight = static_cast<int32_t>(src_width * dst_height / dst_width);
+    }
+    return true;
+}
+
+void ScaleConvertProcess::Crop(ImageUnitInfo& sourceConfig, ImageUnitInfo& targetConfig)
+{
+    int32_t crop_width = 0;
+    int32_t crop_height = 0;
+    if (!GetCropSize(sourceConfig.width, sourceConfig.height, targetConfig.width, targetConfig.height, crop_width,
+        crop_height)) {
+        return;
     }
-    const size_t y_size = static_cast<size_t>(crop_width * crop_height);
-    const size_t uv_size = static_cast<size_t>((crop_width / Y2UV_RATIO) * (crop_height / Y2UV_RATIO));
     const size_t total_size = static_cast<size_t>(crop_width * crop_height * YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
-    std::shared_ptr<DataBuffer> cropBuf = std::make_shared<DataBuffer>(total_size);
-    uint8_t* dstY = cropBuf->Data();
-    uint8_t* dstU = dstY + y_size;
-    uint8_t* dstV = dstU + uv_size;
-    CropConvert(sourceConfig, targetConfig, crop_width, crop_height, dstY, dstU, dstV, cropBuf);
+    std::shared_ptr<DataBuffer> cropBuf = DataBuffer::Acquire(total_size);
+    OnBufferAllocated(cropBuf, DCAMERA_MEMORY_SCALER);
+    CropConvert(sourceConfig, targetConfig, crop_width, crop_height, cropBuf);
 }
 
 void ScaleConvertProcess::CropConvert(ImageUnitInfo& sourceConfig, ImageUnitInfo& targetConfig, int crop_width,
-    int crop_height, uint8_t* dstY, uint8_t* dstU, uint8_t* dstV, std::shared_ptr<DataBuffer> cropBuf)
+    int crop_height, std::shared_ptr<DataBuffer> cropBuf)
 {
     const int offsetX = (sourceConfig.width - crop_width) / Y2UV_RATIO;
     const int offsetY = (sourceConfig.height - crop_height) / Y2UV_RATIO;
-    uint8_t* srcY = sourceConfig.imgData->Data();
-    uint8_t* srcU = srcY + sourceConfig.width * sourceConfig.height;
-    uint8_t* srcV = srcU + (sourceConfig.width / Y2UV_RATIO)
-        * (sourceConfig.height / Y2UV_RATIO);
-    
-    for (int y = 0; y < crop_height; ++y) {
-        const uint8_t* src_row = srcY + (offsetY + y) * sourceConfig.width;
-        uint8_t* dst_row = dstY + y * crop_width;
-        errno_t err = memcpy_s(dst_row, crop_width, src_row + offsetX, crop_width);
-        if (err != EOK) {
-            DHLOGE("memcpy_s failed for Y plane at row %{public}d", y);
-            return;
-        }
-    }
-    for (int y = 0; y < crop_height / Y2UV_RATIO; ++y) {
-        const uint8_t* src_row = srcU + ((offsetY / Y2UV_RATIO) + y) * (sourceConfig.width / Y2UV_RATIO);
-        uint8_t* dst_row = dstU + y * (crop_width / Y2UV_RATIO);
-        errno_t err = memcpy_s(dst_row, crop_width / Y2UV_RATIO, src_row + (offsetX / Y2UV_RATIO),
-            crop_width / Y2UV_RATIO);
-        if (err != EOK) {
-            DHLOGE("memcpy_s failed for U plane at row %{public}d", y);
-            return;
-        }
-    }
-    for (int y = 0; y < crop_height / Y2UV_RATIO; ++y) {
-        const uint8_t* src_row = srcV + ((offsetY / Y2UV_RATIO) + y) * (sourceConfig.width / Y2UV_RATIO);
-        uint8_t* dst_row = dstV + y * (crop_width / Y2UV_RATIO);
-        errno_t err = memcpy_s(dst_row, crop_width / Y2UV_RATIO, src_row + (offsetX / Y2UV_RATIO),
-            crop_width / Y2UV_RATIO);
-        if (err != EOK) {
-            DHLOGE("memcpy_s failed for V plane at row %{public}d", y);
-            return;
-        }
+    if (ImagePlaneKernels::CropYUV420(sourceConfig.imgData->Data(), sourceConfig.width, sourceConfig.height,
+        cropBuf->Data(), crop_width, crop_height, offsetX, offsetY, false) != DCAMERA_OK) {
+        DHLOGE("Crop %{public}dx%{public}d -> %{public}dx%{public}d failed.", sourceConfig.width,
+            sourceConfig.height, crop_width, crop_height);
+        return;
     }
     sourceConfig.imgData = cropBuf;
     sourceConfig.width = crop_width;
@@ -188,49 +178,79 @@ int ScaleConvertProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>& i
         DHLOGE("The input data buffers is empty.");
         return DCAMERA_BAD_VALUE;
     }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_SCALE_CONVERT, inputBuffers[0]->frameInfo_.index);
+    DCameraNodeStatsScope statsScope(stats_, inputBuffers.size());
     inputBuffers[0]->frameInfo_.timePonit.startScale = startScaleTime;
+    if (inputBuffers[0]->frameInfo_.timePonit.finishDecode != 0) {
+        stats_.AddWaitTime(startScaleTime - inputBuffers[0]->frameInfo_.timePonit.finishDecode);
+    }
     DumpFileUtil::OpenDumpFile(DUMP_SERVER_PARA, DUMP_DCAMERA_AFTER_SCALE_FILENAME, &dumpFile_);
 
-    if (!IsConvertible(sourceConfig_, processedConfig_)) {
+    std::vector<std::shared_ptr<DataBuffer>> outputBuffers;
+    {
+        // The converted frame is handed on unlocked, only the conversion itself races a resolution switch.
+        std::lock_guard<std::mutex> autoLock(scaleMutex_);
+        int32_t ret = ConvertFrame(inputBuffers[0], outputBuffers);
+        if (ret != DCAMERA_OK) {
+            return ret;
+        }
+    }
+    return ConvertDone(outputBuffers);
+}
+
+int32_t ScaleConvertProcess::ConvertFrame(const std::shared_ptr<DataBuffer>& inputBuffer,
+    std::vector<std::shared_ptr<DataBuffer>>& outputBuffers)
+{
+    bool isRotated = isFusedRotate_ && fusedAngle_ != ROTATION_0;
+    if (!isRotated && !IsConvertible(sourceConfig_, processedConfig_)) {
         DHLOGI("The target resolution: %{public}dx%{public}d format: %{public}d is the same as the source "
             "resolution: %{public}dx%{public}d format: %{public}d",
             processedConfig_.GetWidth(), processedConfig_.GetHeight(), processedConfig_.GetVideoformat(),
             sourceConfig_.GetWidth(), sourceConfig_.GetHeight(), sourceConfig_.GetVideoformat());
-        return ConvertDone(inputBuffers);
+        outputBuffers.push_back(inputBuffer);
+        return DCAMERA_OK;
     }
 
     ImageUnitInfo srcImgInfo {Videoformat::YUVI420, 0, 0, 0, 0, 0, 0, nullptr};
-    if ((GetImageUnitInfo(srcImgInfo, inputBuffers[0]) != DCAMERA_OK) || !CheckScaleProcessInputInfo(srcImgInfo)) {
+    if ((GetImageUnitInfo(srcImgInfo, inputBuffer) != DCAMERA_OK) ||
+        !(isFusedRotate_ ? IsCorrectImageUnitInfo(srcImgInfo) : CheckScaleProcessInputInfo(srcImgInfo))) {
         DHLOGE("ScaleConvertProcess : srcImgInfo error.");
         return DCAMERA_BAD_VALUE;
     }
 
     size_t dstBuffSize = 0;
     CalculateBuffSize(dstBuffSize);
-    std::shared_ptr<DataBuffer> dstBuf = std::make_shared<DataBuffer>(dstBuffSize);
+    std::shared_ptr<DataBuffer> dstBuf = DataBuffer::Acquire(dstBuffSize);
+    OnBufferAllocated(dstBuf, DCAMERA_MEMORY_SCALER);
     ImageUnitInfo dstImgInfo = { processedConfig_.GetVideoformat(), processedConfig_.GetWidth(),
         processedConfig_.GetHeight(), processedConfig_.GetWidth(), processedConfig_.GetHeight(),
         processedConfig_.GetWidth() * processedConfig_.GetHeight(), dstBuf->Size(), dstBuf };
-    if (targetConfig_.GetIsSystemSwitch()) {
-        Crop(srcImgInfo, dstImgInfo);
-    }
-    if (ScaleConvert(srcImgInfo, dstImgInfo) != DCAMERA_OK) {
-        DHLOGE("ScaleConvertProcess : Scale convert failed.");
-        return DCAMERA_BAD_OPERATE;
+    if (isFusedRotate_) {
+        CHECK_AND_RETURN_RET_LOG(FusedRotateScale(srcImgInfo, dstImgInfo) != DCAMERA_OK, DCAMERA_BAD_OPERATE,
+            "%{public}s", "ScaleConvertProcess : Fused rotate scale failed.");
+    } else {
+        if (targetConfig_.GetIsSystemSwitch()) {
+            Crop(srcImgInfo, dstImgInfo);
+        }
+        // The CPU path also covers frames the hardware backend fails on.
+        if ((backend_ == nullptr || backend_->Convert(srcImgInfo, dstImgInfo) != DCAMERA_OK) &&
+            ScaleConvert(srcImgInfo, dstImgInfo) != DCAMERA_OK) {
+            DHLOGE("ScaleConvertProcess : Scale convert failed.");
+            return DCAMERA_BAD_OPERATE;
+        }
     }
 
-    dstBuf->frameInfo_ = inputBuffers[0]->frameInfo_;
-    dstBuf->SetInt32("Videoformat", static_cast<int32_t>(processedConfig_.GetVideoformat()));
-    dstBuf->SetInt32("alignedWidth", processedConfig_.GetWidth());
-    dstBuf->SetInt32("alignedHeight", processedConfig_.GetHeight());
-    dstBuf->SetInt32("width", processedConfig_.GetWidth());
-    dstBuf->SetInt32("height", processedConfig_.GetHeight());
-    dstBuf->eisInfo_ = inputBuffers[0]->eisInfo_;
+    dstBuf->frameInfo_ = inputBuffer->frameInfo_;
+    dstBuf->SetInt32(DataBufferKey::VIDEO_FORMAT, static_cast<int32_t>(processedConfig_.GetVideoformat()));
+    dstBuf->SetInt32(DataBufferKey::ALIGNED_WIDTH, processedConfig_.GetWidth());
+    dstBuf->SetInt32(DataBufferKey::ALIGNED_HEIGHT, processedConfig_.GetHeight());
+    dstBuf->SetInt32(DataBufferKey::WIDTH, processedConfig_.GetWidth());
+    dstBuf->SetInt32(DataBufferKey::HEIGHT, processedConfig_.GetHeight());
+    dstBuf->eisInfo_ = inputBuffer->eisInfo_;
 
     DumpFileUtil::WriteDumpFile(dumpFile_, static_cast<void *>(dstBuf->Data()), dstBuf->Size());
-    std::vector<std::shared_ptr<DataBuffer>> outputBuffers;
     outputBuffers.push_back(dstBuf);
-    return ConvertDone(outputBuffers);
+    return DCAMERA_OK;
 }
 
 void ScaleConvertProcess::CalculateBuffSize(size_t& dstBuffSize)
@@ -256,7 +276,7 @@ int32_t ScaleConvertProcess::GetImageUnitInfo(ImageUnitInfo& imgInfo, const std:
 
     bool findErr = true;
     int32_t colorFormat = 0;
-    findErr = findErr && imgBuf->FindInt32("Videoformat", colorFormat);
+    findErr = findErr && imgBuf->FindInt32(DataBufferKey::VIDEO_FORMAT, colorFormat);
     if (!findErr) {
         DHLOGE("GetImageUnitInfo failed, Videoformat is null.");
         return DCAMERA_NOT_FOUND;
@@ -268,10 +288,10 @@ int32_t ScaleConvertProcess::GetImageUnitInfo(ImageUnitInfo& imgInfo, const std:
         return DCAMERA_NOT_FOUND;
     }
     imgInfo.colorFormat = static_cast<Videoformat>(colorFormat);
-    findErr = findErr && imgBuf->FindInt32("width", imgInfo.width);
-    findErr = findErr && imgBuf->FindInt32("height", imgInfo.height);
-    findErr = findErr && imgBuf->FindInt32("alignedWidth", imgInfo.alignedWidth);
-    findErr = findErr && imgBuf->FindInt32("alignedHeight", imgInfo.alignedHeight);
+    findErr = findErr && imgBuf->FindInt32(DataBufferKey::WIDTH, imgInfo.width);
+    findErr = findErr && imgBuf->FindInt32(DataBufferKey::HEIGHT, imgInfo.height);
+    findErr = findErr && imgBuf->FindInt32(DataBufferKey::ALIGNED_WIDTH, imgInfo.alignedWidth);
+    findErr = findErr && imgBuf->FindInt32(DataBufferKey::ALIGNED_HEIGHT, imgInfo.alignedHeight);
     if (!findErr) {
         DHLOGE("GetImageUnitInfo failed, width %{public}d, height %{public}d, alignedWidth %{public}d, "
             "alignedHeight %{public}d.", imgInfo.width, imgInfo.height, imgInfo.alignedWidth, imgInfo.alignedHeight);
@@ -348,7 +368,8 @@ int32_t ScaleConvertProcess::ScaleConvert(ImageUnitInfo& srcImgInfo, ImageUnitIn
     }
 
     std::shared_ptr<DataBuffer> dstBuf =
-        std::make_shared<DataBuffer>(dstImgInfo.width * dstImgInfo.height * YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
+        DataBuffer::Acquire(dstImgInfo.width * dstImgInfo.height * YUV_BYTES_PER_PIXEL / Y2UV_RATIO);
+    OnBufferAllocated(dstBuf, DCAMERA_MEMORY_SCALER);
     int32_t ret = ConvertResolution(srcImgInfo, dstImgInfo, dstBuf);
     if (ret != DCAMERA_OK) {
         DHLOGE("Convert I420 scale failed.");
@@ -360,7 +381,7 @@ int32_t ScaleConvertProcess::ScaleConvert(ImageUnitInfo& srcImgInfo, ImageUnitIn
     } else if (processedConfig_.GetVideoformat() == Videoformat::RGBA_8888) {
         ret = ConvertFormatToRGBA(srcImgInfo, dstImgInfo, dstBuf);
     } else if (targetConfig_.GetVideoformat() == Videoformat::P010) {
-        ret = ConvertFormatToP010(srcImgInfo, dstImgInfo);
+        ret = ConvertFormatToP010(srcImgInfo, dstImgInfo, dstBuf);
     }
     if (ret != DCAMERA_OK) {
         DHLOGE("Convert I420 to format: %{public}d failed.", processedConfig_.GetVideoformat());
@@ -486,14 +507,13 @@ int32_t ScaleConvertProcess::ConvertFormatToRGBA(ImageUnitInfo& srcImgInfo, Imag
     uint8_t *srcDataV = dstBuf->Data() + srcSizeY + srcSizeUV;
 
     uint8_t *dstDataRGBA = dstImgInfo.imgData->Data();
-    auto converter = ConverterHandle::GetInstance().GetHandle();
-    CHECK_AND_RETURN_RET_LOG(converter.I420ToRGBA == nullptr, DCAMERA_BAD_VALUE, "converter is invalid.");
-    int32_t ret = converter.I420ToRGBA(
+    CHECK_AND_RETURN_RET_LOG(rgbTable_ == nullptr, DCAMERA_BAD_VALUE, "RGBA coefficient table is not picked.");
+    int32_t ret = YuvColorKernels::I420ToRGBA(
         srcDataY, srcImgInfo.width,
         srcDataU, static_cast<uint32_t>(srcImgInfo.width) >> MEMORY_RATIO_UV,
         srcDataV, static_cast<uint32_t>(srcImgInfo.width) >> MEMORY_RATIO_UV,
         dstDataRGBA, dstImgInfo.width * RGB32_MEMORY_COEFFICIENT,
-        dstImgInfo.width, dstImgInfo.height);
+        dstImgInfo.width, dstImgInfo.height, *rgbTable_);
     if (ret != DCAMERA_OK) {
         DHLOGE("Convert I420 to RGBA failed.");
         return DCAMERA_BAD_VALUE;
@@ -503,39 +523,148 @@ int32_t ScaleConvertProcess::ConvertFormatToRGBA(ImageUnitInfo& srcImgInfo, Imag
     return DCAMERA_OK;
 }
 
-int32_t ScaleConvertProcess::ConvertFormatToP010(ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo)
+int32_t ScaleConvertProcess::ConvertFormatToP010(ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo,
+    std::shared_ptr<DataBuffer>& dstBuf)
 {
     DHLOGI("Convert I420 to P010: width=[%{public}d, height=[%{public}d", srcImgInfo.width, srcImgInfo.height);
-    CHECK_AND_RETURN_RET_LOG((srcImgInfo.imgData == nullptr), DCAMERA_BAD_VALUE, "Data buffer exists null data");
+    CHECK_AND_RETURN_RET_LOG((dstBuf == nullptr), DCAMERA_BAD_VALUE, "Buffer is null.");
+    CHECK_AND_RETURN_RET_LOG((dstImgInfo.imgData == nullptr), DCAMERA_BAD_VALUE, "Image data is null.");
     int32_t srcSizeY = srcImgInfo.width * srcImgInfo.height;
     int32_t srcSizeUV = (static_cast<uint32_t>(srcImgInfo.width) >> MEMORY_RATIO_UV) *
         (static_cast<uint32_t>(srcImgInfo.height) >> MEMORY_RATIO_UV);
-    uint8_t* srcDataY = srcImgInfo.imgData->Data();
-    uint8_t* srcDataU = srcImgInfo.imgData->Data() + srcSizeY;
-    uint8_t* srcDataV = srcImgInfo.imgData->Data() + srcSizeY + srcSizeUV;
-    for (int i = 0; i < srcSizeUV; i++) {
-        uint8_t temp = srcDataU[i];
-        srcDataU[i] = srcDataV[i];
-        srcDataV[i] = temp;
+    int32_t srcStrideUV = static_cast<int32_t>(static_cast<uint32_t>(srcImgInfo.width) >> MEMORY_RATIO_UV);
+    uint8_t *srcDataY = dstBuf->Data();
+    uint8_t *srcDataU = dstBuf->Data() + srcSizeY;
+    uint8_t *srcDataV = dstBuf->Data() + srcSizeY + srcSizeUV;
+
+    int32_t dstWidth = dstImgInfo.width;
+    int32_t dstStride = dstWidth * P010_BYTES_PER_SAMPLE;
+    uint8_t *dstDataY = dstImgInfo.imgData->Data();
+    uint8_t *dstDataUV = dstDataY + dstStride * dstImgInfo.height;
+    // The swscale path this replaces swapped the chroma planes before converting, the same order is kept.
+    int32_t ret = YuvColorKernels::I420ToP010(srcDataY, srcImgInfo.width, srcDataV, srcStrideUV, srcDataU,
+        srcStrideUV, dstDataY, dstStride, dstDataUV, dstStride, dstWidth, dstImgInfo.height);
+    if (ret != DCAMERA_OK) {
+        DHLOGE("ScaleConvertProcess::ConvertFormatToP010 failed, ret = %{public}d", ret);
+        return DCAMERA_MEMORY_OPT_ERROR;
     }
-    uint8_t* srcData[3] = { srcDataY, srcDataU, srcDataV };
-    int32_t srcLinsize[3] = { srcImgInfo.width, srcImgInfo.width / 2, srcImgInfo.width / 2 };
+    return DCAMERA_OK;
+}
+
+bool ScaleConvertProcess::IsFusedRotateSupported(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig)
+{
+    Videoformat format = targetConfig.GetVideoformat();
+    return targetConfig.GetIsSystemSwitch() && !sourceConfig.GetEis() &&
+        (format == Videoformat::YUVI420 || format == Videoformat::NV12 || format == Videoformat::NV21);
+}
 
+int32_t ScaleConvertProcess::FusedRotateScale(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo)
+{
+    CHECK_AND_RETURN_RET_LOG(srcImgInfo.imgData == nullptr || dstImgInfo.imgData == nullptr ||
+        srcImgInfo.width <= 0 || srcImgInfo.height <= 0, DCAMERA_BAD_VALUE, "%{public}s",
+        "Fused rotate scale image is invalid.");
+    if (srcImgInfo.width != fusedWidth_ || srcImgInfo.height != fusedHeight_) {
+        BuildFusedAxes(srcImgInfo.width, srcImgInfo.height);
+    }
+    uint8_t *srcY = srcImgInfo.imgData->Data();
+    uint8_t *srcUV[Y2UV_RATIO] = { nullptr };
+    int32_t srcStrideUV = 0;
+    int32_t srcPixelStrideUV = 0;
+    GetChromaPlanes(srcY + srcImgInfo.chromaOffset, srcImgInfo.colorFormat, srcImgInfo.alignedWidth,
+        srcImgInfo.alignedHeight, srcUV, srcStrideUV, srcPixelStrideUV);
     int32_t dstWidth = dstImgInfo.width;
     int32_t dstHeight = dstImgInfo.height;
-    int32_t dstLinsize[3] = { dstWidth * 2, dstWidth * 2, dstWidth * 2 };
+    uint8_t *dstY = dstImgInfo.imgData->Data();
+    uint8_t *dstUV[Y2UV_RATIO] = { nullptr };
+    int32_t dstStrideUV = 0;
+    int32_t dstPixelStrideUV = 0;
+    GetChromaPlanes(dstY + static_cast<size_t>(dstWidth) * dstHeight, dstImgInfo.colorFormat, dstWidth, dstHeight,
+        dstUV, dstStrideUV, dstPixelStrideUV);
+
+    int32_t ret = ImagePlaneKernels::RemapPlane(srcY, srcImgInfo.alignedWidth, 1, dstY, dstWidth, 1,
+        fusedLumaAxes_.colMap.data(), dstWidth, fusedLumaAxes_.rowMap.data(), dstHeight,
+        fusedLumaAxes_.isTransposed, RotateLetterboxProcess::BLACK_COLOR_PEXEL);
+    for (int32_t i = 0; i < Y2UV_RATIO && ret == DCAMERA_OK; i++) {
+        ret = ImagePlaneKernels::RemapPlane(srcUV[i], srcStrideUV, srcPixelStrideUV, dstUV[i], dstStrideUV,
+            dstPixelStrideUV, fusedChromaAxes_.colMap.data(), dstWidth / Y2UV_RATIO, fusedChromaAxes_.rowMap.data(),
+            dstHeight / Y2UV_RATIO, fusedChromaAxes_.isTransposed, RotateLetterboxProcess::WHITE_COLOR_PEXEL);
+    }
+    return ret;
+}
 
-    uint8_t* dstDataY = dstImgInfo.imgData->Data();
-    uint8_t* dstDataU = dstImgInfo.imgData->Data() + dstWidth * dstHeight * 2;
-    uint8_t* dstDataV = dstImgInfo.imgData->Data() + dstWidth * dstHeight * 2 + dstWidth * dstHeight * 2;
+void ScaleConvertProcess::BuildFusedAxes(int32_t width, int32_t height)
+{
+    DHLOGI("Build fused rotate scale maps, %{public}dx%{public}d -> %{public}dx%{public}d, rotate %{public}d.",
+        width, height, processedConfig_.GetWidth(), processedConfig_.GetHeight(), fusedAngle_);
+    BuildRemapAxes(width, height, 1, fusedLumaAxes_);
+    BuildRemapAxes(width, height, Y2UV_RATIO, fusedChromaAxes_);
+    fusedWidth_ = width;
+    fusedHeight_ = height;
+}
 
-    uint8_t* dstData[3] = { dstDataY, dstDataU, dstDataV };
-    int32_t ret = sws_scale(swsContext_, srcData, srcLinsize, 0, srcImgInfo.height, dstData, dstLinsize);
-    if (ret < 0) {
-        DHLOGE("ScaleConvertProcess::ConvertFormatToP010 sws_scale failed, ret = %{public}d", ret);
-        return DCAMERA_MEMORY_OPT_ERROR;
+void ScaleConvertProcess::BuildRemapAxes(int32_t width, int32_t height, int32_t ratio, RemapAxes& axes)
+{
+    // The geometry is taken on the luma plane and halved for chroma, the way the rotate and crop passes do.
+    int32_t dstWidth = processedConfig_.GetWidth();
+    int32_t dstHeight = processedConfig_.GetHeight();
+    int32_t cropWidth = width;
+    int32_t cropHeight = height;
+    GetCropSize(width, height, dstWidth, dstHeight, cropWidth, cropHeight);
+    AxisMapping col = { (width - cropWidth) / Y2UV_RATIO / ratio, std::max(cropWidth / ratio, 1), 0, 0,
+        width / ratio, width / ratio, fusedAngle_ == ROTATION_180 };
+    AxisMapping row = { (height - cropHeight) / Y2UV_RATIO / ratio, std::max(cropHeight / ratio, 1), 0, 0,
+        height / ratio, height / ratio, fusedAngle_ == ROTATION_180 };
+    axes.isTransposed = (fusedAngle_ == ROTATION_90 || fusedAngle_ == ROTATION_270);
+    if (axes.isTransposed) {
+        // An output column walks a source row inside the pasted square, an output row walks a source column.
+        RotateLetterboxProcess::LetterboxRegion region =
+            RotateLetterboxProcess::GetLetterboxRegion(width, height, fusedAngle_);
+        col = { col.crop, col.cropSize, region.dstX / ratio, region.srcY / ratio, region.size / ratio,
+            height / ratio, fusedAngle_ == ROTATION_90 };
+        row = { row.crop, row.cropSize, region.dstY / ratio, region.srcX / ratio, region.size / ratio,
+            width / ratio, fusedAngle_ == ROTATION_270 };
+    }
+    BuildAxisMap(col, dstWidth / ratio, axes.colMap);
+    BuildAxisMap(row, dstHeight / ratio, axes.rowMap);
+}
+
+void ScaleConvertProcess::BuildAxisMap(const AxisMapping& mapping, int32_t dstSize, std::vector<int32_t>& map)
+{
+    map.assign(static_cast<size_t>(std::max(dstSize, 0)), -1);
+    for (int32_t i = 0; i < dstSize; i++) {
+        int32_t offset = mapping.crop + ScaleIndex(i, mapping.cropSize, dstSize) - mapping.paste;
+        if (offset < 0 || offset >= mapping.size) {
+            continue;
+        }
+        int32_t pos = mapping.isReversed ? mapping.start + mapping.size - 1 - offset : mapping.start + offset;
+        map[i] = std::min(pos, mapping.limit - 1);
     }
-    return DCAMERA_OK;
+}
+
+int32_t ScaleConvertProcess::ScaleIndex(int32_t index, int32_t srcSize, int32_t dstSize)
+{
+    // The sample the libyuv scaler picks without filtering, stepping in 16.16 fixed point from half a step.
+    int64_t step = (static_cast<int64_t>(srcSize) << FIXED_POINT_SHIFT) / dstSize;
+    int64_t pos = (step >> 1) + step * index;
+    return std::min(static_cast<int32_t>(pos >> FIXED_POINT_SHIFT), srcSize - 1);
+}
+
+void ScaleConvertProcess::GetChromaPlanes(uint8_t *chroma, Videoformat format, int32_t width, int32_t height,
+    uint8_t *planes[], int32_t& stride, int32_t& pixelStride)
+{
+    if (format == Videoformat::YUVI420) {
+        stride = width / Y2UV_RATIO;
+        pixelStride = 1;
+        planes[0] = chroma;
+        planes[1] = chroma + static_cast<size_t>(stride) * (height / Y2UV_RATIO);
+        return;
+    }
+    // Interleaved chroma rows are as wide in bytes as the luma rows, NV21 stores V first.
+    stride = width;
+    pixelStride = Y2UV_RATIO;
+    planes[0] = (format == Videoformat::NV21) ? chroma + 1 : chroma;
+    planes[1] = (format == Videoformat::NV21) ? chroma : chroma + 1;
 }
 
 int32_t ScaleConvertProcess::ConvertDone(std::vector<std::shared_ptr<DataBuffer>>& outputBuffers)
@@ -548,6 +677,7 @@ int32_t ScaleConvertProcess::ConvertDone(std::vector<std::shared_ptr<DataBuffer>
     }
     outputBuffers[0]->frameInfo_.timePonit.finishScale = finishScaleTime;
 
+    stats_.OnFramesOut(outputBuffers.size());
     if (nextDataProcess_ != nullptr) {
         DHLOGD("Send to the next node of the scale convert for processing.");
         int32_t err = nextDataProcess_->ProcessData(outputBuffers);
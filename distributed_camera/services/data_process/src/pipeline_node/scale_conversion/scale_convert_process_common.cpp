@@ -18,6 +18,9 @@
 #include "distributed_hardware_log.h"
 #include "scale_convert_process.h"
 #include "dcamera_frame_info.h"
+#include "dcamera_hitrace_adapter.h"
+#include "image_plane_kernels.h"
+#include "yuv_color_kernels.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -42,6 +45,7 @@ int32_t ScaleConvertProcess::InitNode(const VideoConfigParams& sourceConfig, con
     processedConfig_.SetWidthAndHeight(targetConfig.GetWidth(), targetConfig.GetHeight());
     processedConfig_.SetVideoformat(targetConfig.GetVideoformat());
     processedConfig = processedConfig_;
+    rgbTable_ = &YuvColorKernels::GetYuvToRgbTable(sourceConfig_.GetColorSpace());
 
     if (!IsConvertible(sourceConfig, targetConfig)) {
         DHLOGI("sourceConfig: Videoformat %{public}d Width %{public}d, Height %{public}d, targetConfig: "
@@ -74,10 +78,19 @@ int32_t ScaleConvertProcess::InitNode(const VideoConfigParams& sourceConfig, con
         return DCAMERA_BAD_VALUE;
     }
 
+    backend_ = CreateScaleConvertBackend(sourceConfig_, processedConfig_);
     isScaleConvert_.store(true);
     return DCAMERA_OK;
 }
 
+int32_t ScaleConvertProcess::UpdateConfig(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig, VideoConfigParams& processedConfig)
+{
+    // The sws images are allocated for one size, a new size always gets a new node.
+    DHLOGI("ScaleConvertProcess does not switch size in place, it is rebuilt.");
+    return DCAMERA_BAD_OPERATE;
+}
+
 bool ScaleConvertProcess::IsConvertible(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig)
 {
     return (sourceConfig_.GetWidth() != targetConfig.GetWidth()) ||
@@ -92,6 +105,9 @@ void ScaleConvertProcess::ReleaseProcessNode()
 
     {
         std::lock_guard<std::mutex> autoLock(scaleMutex_);
+        if (backend_ != nullptr) {
+            backend_->Release();
+        }
         if (swsContext_ != nullptr) {
             av_freep(&srcData_[0]);
             av_freep(&dstData_[0]);
@@ -120,7 +136,12 @@ int ScaleConvertProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>& i
         DHLOGE("The input data buffers is empty.");
         return DCAMERA_BAD_VALUE;
     }
+    DCameraFrameTrace frameTrace(DCAMERA_FRAME_SCALE_CONVERT, inputBuffers[0]->frameInfo_.index);
+    DCameraNodeStatsScope statsScope(stats_, inputBuffers.size());
     inputBuffers[0]->frameInfo_.timePonit.startScale = startScaleTime;
+    if (inputBuffers[0]->frameInfo_.timePonit.finishDecode != 0) {
+        stats_.AddWaitTime(startScaleTime - inputBuffers[0]->frameInfo_.timePonit.finishDecode);
+    }
     DumpFileUtil::OpenDumpFile(DUMP_SERVER_PARA, DUMP_DCAMERA_AFTER_SCALE_FILENAME, &dumpFile_);
 
     if (!IsConvertible(sourceConfig_, processedConfig_)) {
@@ -137,21 +158,24 @@ int ScaleConvertProcess::ProcessData(std::vector<std::shared_ptr<DataBuffer>>& i
         return DCAMERA_BAD_VALUE;
     }
 
-    std::shared_ptr<DataBuffer> dstBuf = std::make_shared<DataBuffer>(dstBuffSize_);
+    std::shared_ptr<DataBuffer> dstBuf = DataBuffer::Acquire(dstBuffSize_);
+    OnBufferAllocated(dstBuf, DCAMERA_MEMORY_SCALER);
     ImageUnitInfo dstImgInfo = { processedConfig_.GetVideoformat(), processedConfig_.GetWidth(),
         processedConfig_.GetHeight(), processedConfig_.GetWidth(), processedConfig_.GetHeight(),
         processedConfig_.GetWidth() * processedConfig_.GetHeight(), dstBuf->Size(), dstBuf };
-    if (ScaleConvert(srcImgInfo, dstImgInfo) != DCAMERA_OK) {
+    // The CPU path also covers frames the hardware backend fails on.
+    if ((backend_ == nullptr || backend_->Convert(srcImgInfo, dstImgInfo) != DCAMERA_OK) &&
+        ScaleConvert(srcImgInfo, dstImgInfo) != DCAMERA_OK) {
         DHLOGE("ScaleConvertProcess : Scale convert failed.");
         return DCAMERA_BAD_OPERATE;
     }
 
     dstBuf->frameInfo_ = inputBuffers[0]->frameInfo_;
-    dstBuf->SetInt32("Videoformat", static_cast<int32_t>(processedConfig_.GetVideoformat()));
-    dstBuf->SetInt32("alignedWidth", processedConfig_.GetWidth());
-    dstBuf->SetInt32("alignedHeight", processedConfig_.GetHeight());
-    dstBuf->SetInt32("width", processedConfig_.GetWidth());
-    dstBuf->SetInt32("height", processedConfig_.GetHeight());
+    dstBuf->SetInt32(DataBufferKey::VIDEO_FORMAT, static_cast<int32_t>(processedConfig_.GetVideoformat()));
+    dstBuf->SetInt32(DataBufferKey::ALIGNED_WIDTH, processedConfig_.GetWidth());
+    dstBuf->SetInt32(DataBufferKey::ALIGNED_HEIGHT, processedConfig_.GetHeight());
+    dstBuf->SetInt32(DataBufferKey::WIDTH, processedConfig_.GetWidth());
+    dstBuf->SetInt32(DataBufferKey::HEIGHT, processedConfig_.GetHeight());
 
     DumpFileUtil::WriteDumpFile(dumpFile_, static_cast<void *>(dstBuf->Data()), dstBuf->Size());
     std::vector<std::shared_ptr<DataBuffer>> outputBuffers;
@@ -173,7 +197,7 @@ int32_t ScaleConvertProcess::GetImageUnitInfo(ImageUnitInfo& imgInfo, const std:
 
     bool findErr = true;
     int32_t colorFormat = 0;
-    findErr = findErr && imgBuf->FindInt32("Videoformat", colorFormat);
+    findErr = findErr && imgBuf->FindInt32(DataBufferKey::VIDEO_FORMAT, colorFormat);
     if (!findErr) {
         DHLOGE("GetImageUnitInfo failed, Videoformat is null.");
         return DCAMERA_NOT_FOUND;
@@ -186,10 +210,10 @@ int32_t ScaleConvertProcess::GetImageUnitInfo(ImageUnitInfo& imgInfo, const std:
         return DCAMERA_NOT_FOUND;
     }
     imgInfo.colorFormat = static_cast<Videoformat>(colorFormat);
-    findErr = findErr && imgBuf->FindInt32("width", imgInfo.width);
-    findErr = findErr && imgBuf->FindInt32("height", imgInfo.height);
-    findErr = findErr && imgBuf->FindInt32("alignedWidth", imgInfo.alignedWidth);
-    findErr = findErr && imgBuf->FindInt32("alignedHeight", imgInfo.alignedHeight);
+    findErr = findErr && imgBuf->FindInt32(DataBufferKey::WIDTH, imgInfo.width);
+    findErr = findErr && imgBuf->FindInt32(DataBufferKey::HEIGHT, imgInfo.height);
+    findErr = findErr && imgBuf->FindInt32(DataBufferKey::ALIGNED_WIDTH, imgInfo.alignedWidth);
+    findErr = findErr && imgBuf->FindInt32(DataBufferKey::ALIGNED_HEIGHT, imgInfo.alignedHeight);
     if (!findErr) {
         DHLOGE("GetImageUnitInfo failed, width %{public}d, height %{public}d, alignedWidth %{public}d, "
             "alignedHeight %{public}d.", imgInfo.width, imgInfo.height, imgInfo.alignedWidth, imgInfo.alignedHeight);
@@ -268,6 +292,9 @@ int32_t ScaleConvertProcess::ScaleConvert(ImageUnitInfo& srcImgInfo, ImageUnitIn
     }
 
     std::lock_guard<std::mutex> autoLock(scaleMutex_);
+    if (ConvertDirect(srcImgInfo, dstImgInfo)) {
+        return DCAMERA_OK;
+    }
     switch (GetAVPixelFormat(srcImgInfo.colorFormat)) {
         case AV_PIX_FMT_YUV420P: {
             int32_t ret = CopyYUV420SrcData(srcImgInfo);
@@ -308,73 +335,71 @@ int32_t ScaleConvertProcess::ScaleConvert(ImageUnitInfo& srcImgInfo, ImageUnitIn
     return DCAMERA_OK;
 }
 
-int32_t ScaleConvertProcess::CopyYUV420SrcData(const ImageUnitInfo& srcImgInfo)
+bool ScaleConvertProcess::ConvertDirect(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo)
 {
-    CHECK_AND_RETURN_RET_LOG((srcImgInfo.imgData == nullptr), DCAMERA_BAD_VALUE, "Data buffer exists null data");
-    int32_t ret = memcpy_s(srcData_[0], srcImgInfo.width * srcImgInfo.height,
-        srcImgInfo.imgData->Data(), srcImgInfo.width * srcImgInfo.height);
-    if (ret != EOK) {
-        DHLOGE("ScaleConvertProcess::CopyYUV420SrcData memory copy failed, ret = %{public}d", ret);
-        return DCAMERA_MEMORY_OPT_ERROR;
-    }
-
-    ret = memcpy_s(srcData_[1], srcImgInfo.width * srcImgInfo.height / MEMORY_RATIO_YUV,
-        srcImgInfo.imgData->Data() + srcImgInfo.alignedWidth * srcImgInfo.alignedHeight,
-        srcImgInfo.width * srcImgInfo.height / MEMORY_RATIO_YUV);
-    if (ret != EOK) {
-        DHLOGE("ScaleConvertProcess::CopyYUV420SrcData memory copy failed, ret = %{public}d", ret);
-        return DCAMERA_MEMORY_OPT_ERROR;
+    // The dedicated kernels only change the format, a resize still goes through swscale.
+    if (srcImgInfo.width != dstImgInfo.width || srcImgInfo.height != dstImgInfo.height || rgbTable_ == nullptr) {
+        return false;
     }
+    int32_t width = srcImgInfo.width;
+    int32_t height = srcImgInfo.height;
+    int32_t strideUV = width / MEMORY_RATIO_NV;
+    const uint8_t *srcY = srcImgInfo.imgData->Data();
+    const uint8_t *srcU = srcY + srcImgInfo.chromaOffset;
+    const uint8_t *srcV = srcU + srcImgInfo.chromaOffset / MEMORY_RATIO_YUV;
+    uint8_t *dstY = dstImgInfo.imgData->Data();
+    bool isSrcSemiPlanar = srcImgInfo.colorFormat == Videoformat::NV12 || srcImgInfo.colorFormat == Videoformat::NV21;
+    int32_t ret = DCAMERA_NOT_FOUND;
+    if (dstImgInfo.colorFormat == Videoformat::RGBA_8888 && srcImgInfo.colorFormat == Videoformat::YUVI420) {
+        ret = YuvColorKernels::I420ToRGBA(srcY, width, srcU, strideUV, srcV, strideUV, dstY,
+            width * RGB32_MEMORY_COEFFICIENT, width, height, *rgbTable_);
+    } else if (dstImgInfo.colorFormat == Videoformat::RGBA_8888 && isSrcSemiPlanar) {
+        ret = YuvColorKernels::NV12ToRGBA(srcY, width, srcU, width, dstY, width * RGB32_MEMORY_COEFFICIENT, width,
+            height, *rgbTable_, srcImgInfo.colorFormat == Videoformat::NV21);
+    } else if (dstImgInfo.colorFormat == Videoformat::P010 && srcImgInfo.colorFormat == Videoformat::YUVI420) {
+        int32_t dstStride = width * P010_BYTES_PER_SAMPLE;
+        ret = YuvColorKernels::I420ToP010(srcY, width, srcU, strideUV, srcV, strideUV, dstY, dstStride,
+            dstY + static_cast<size_t>(dstStride) * height, dstStride, width, height);
+    } else if ((dstImgInfo.colorFormat == Videoformat::NV12 || dstImgInfo.colorFormat == Videoformat::NV21) &&
+        isSrcSemiPlanar && dstImgInfo.colorFormat != srcImgInfo.colorFormat) {
+        ImagePlaneKernels::CopyPlane(srcY, width, dstY, width, width, height);
+        ret = YuvColorKernels::SwapUVOrder(srcU, width, dstY + static_cast<size_t>(width) * height, width, width,
+            height);
+    }
+    return ret == DCAMERA_OK;
+}
 
-    ret = memcpy_s(srcData_[2], srcImgInfo.width * srcImgInfo.height / MEMORY_RATIO_YUV, // 2: v start address
-        srcImgInfo.imgData->Data() + srcImgInfo.alignedWidth * srcImgInfo.alignedHeight +
-        srcImgInfo.alignedWidth * srcImgInfo.alignedHeight / MEMORY_RATIO_YUV,
-        srcImgInfo.width * srcImgInfo.height / MEMORY_RATIO_YUV);
-    if (ret != EOK) {
-        DHLOGE("ScaleConvertProcess::CopyYUV420SrcData memory copy failed, ret = %{public}d", ret);
-        return DCAMERA_MEMORY_OPT_ERROR;
-    }
+int32_t ScaleConvertProcess::CopyYUV420SrcData(const ImageUnitInfo& srcImgInfo)
+{
+    CHECK_AND_RETURN_RET_LOG((srcImgInfo.imgData == nullptr), DCAMERA_BAD_VALUE, "Data buffer exists null data");
+    // The sws source planes are SOURCE_ALIGN aligned, copy row by row into their line size.
+    const uint8_t *srcDataY = srcImgInfo.imgData->Data();
+    const uint8_t *srcDataU = srcDataY + srcImgInfo.alignedWidth * srcImgInfo.alignedHeight;
+    const uint8_t *srcDataV = srcDataU + srcImgInfo.alignedWidth * srcImgInfo.alignedHeight / MEMORY_RATIO_YUV;
+    int32_t widthUV = srcImgInfo.width / MEMORY_RATIO_NV;
+    int32_t heightUV = srcImgInfo.height / MEMORY_RATIO_NV;
+    ImagePlaneKernels::CopyPlane(srcDataY, srcImgInfo.width, srcData_[0], srcLineSize_[0], srcImgInfo.width,
+        srcImgInfo.height);
+    ImagePlaneKernels::CopyPlane(srcDataU, widthUV, srcData_[1], srcLineSize_[1], widthUV, heightUV);
+    ImagePlaneKernels::CopyPlane(srcDataV, widthUV, srcData_[2], srcLineSize_[2], widthUV, heightUV); // 2: v plane
     return DCAMERA_OK;
 }
 
 int32_t ScaleConvertProcess::CopyNV12SrcData(const ImageUnitInfo& srcImgInfo)
 {
     CHECK_AND_RETURN_RET_LOG((srcImgInfo.imgData == nullptr), DCAMERA_BAD_VALUE, "Data buffer exists null data");
-    int32_t ret = memcpy_s(srcData_[0], srcImgInfo.width * srcImgInfo.height,
-        srcImgInfo.imgData->Data(), srcImgInfo.width * srcImgInfo.height);
-    if (ret != EOK) {
-        DHLOGE("ScaleConvertProcess::CopyNV12SrcData memory copy failed, ret = %{public}d", ret);
-        return DCAMERA_MEMORY_OPT_ERROR;
-    }
-
-    ret = memcpy_s(srcData_[1], srcImgInfo.width * srcImgInfo.height / MEMORY_RATIO_NV,
-        srcImgInfo.imgData->Data() + srcImgInfo.alignedWidth * srcImgInfo.alignedHeight,
-        srcImgInfo.width * srcImgInfo.height / MEMORY_RATIO_NV);
-    if (ret != EOK) {
-        DHLOGE("ScaleConvertProcess::CopyNV12SrcData memory copy failed, ret = %{public}d", ret);
-        return DCAMERA_MEMORY_OPT_ERROR;
-    }
+    const uint8_t *srcDataY = srcImgInfo.imgData->Data();
+    const uint8_t *srcDataUV = srcDataY + srcImgInfo.alignedWidth * srcImgInfo.alignedHeight;
+    ImagePlaneKernels::CopyPlane(srcDataY, srcImgInfo.width, srcData_[0], srcLineSize_[0], srcImgInfo.width,
+        srcImgInfo.height);
+    ImagePlaneKernels::CopyPlane(srcDataUV, srcImgInfo.width, srcData_[1], srcLineSize_[1], srcImgInfo.width,
+        srcImgInfo.height / MEMORY_RATIO_NV);
     return DCAMERA_OK;
 }
 
 int32_t ScaleConvertProcess::CopyNV21SrcData(const ImageUnitInfo& srcImgInfo)
 {
-    CHECK_AND_RETURN_RET_LOG((srcImgInfo.imgData == nullptr), DCAMERA_BAD_VALUE, "Data buffer exists null data");
-    int32_t ret = memcpy_s(srcData_[0], srcImgInfo.width * srcImgInfo.height,
-        srcImgInfo.imgData->Data(), srcImgInfo.width * srcImgInfo.height);
-    if (ret != EOK) {
-        DHLOGE("ScaleConvertProcess::CopyNV21SrcData memory copy failed, ret = %{public}d", ret);
-        return DCAMERA_MEMORY_OPT_ERROR;
-    }
-
-    ret = memcpy_s(srcData_[1], srcImgInfo.width * srcImgInfo.height / MEMORY_RATIO_NV,
-        srcImgInfo.imgData->Data() + srcImgInfo.alignedWidth * srcImgInfo.alignedHeight,
-        srcImgInfo.width * srcImgInfo.height / MEMORY_RATIO_NV);
-    if (ret != EOK) {
-        DHLOGE("ScaleConvertProcess::CopyNV21SrcData memory copy failed, ret = %{public}d", ret);
-        return DCAMERA_MEMORY_OPT_ERROR;
-    }
-    return DCAMERA_OK;
+    return CopyNV12SrcData(srcImgInfo);
 }
 
 int32_t ScaleConvertProcess::ConvertDone(std::vector<std::shared_ptr<DataBuffer>>& outputBuffers)
@@ -387,6 +412,7 @@ int32_t ScaleConvertProcess::ConvertDone(std::vector<std::shared_ptr<DataBuffer>
     }
     outputBuffers[0]->frameInfo_.timePonit.finishScale = finishScaleTime;
 
+    stats_.OnFramesOut(outputBuffers.size());
     if (nextDataProcess_ != nullptr) {
         DHLOGD("Send to the next node of the scale convert for processing.");
         int32_t err = nextDataProcess_->ProcessData(outputBuffers);
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scale_convert_super_res_backend.h"
+
+#include <cinttypes>
+#include <dlfcn.h>
+
+#include "dcamera_utils_tools.h"
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+ScaleConvertSuperResBackend::~ScaleConvertSuperResBackend()
+{
+    Release();
+}
+
+bool ScaleConvertSuperResBackend::IsUpscale(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig)
+{
+    return targetConfig.GetWidth() >= sourceConfig.GetWidth() && targetConfig.GetHeight() >= sourceConfig.GetHeight()
+        && (targetConfig.GetWidth() > sourceConfig.GetWidth() || targetConfig.GetHeight() > sourceConfig.GetHeight());
+}
+
+int64_t ScaleConvertSuperResBackend::GetBudgetUs(const VideoConfigParams& sourceConfig)
+{
+    int64_t budgetUs = 0;
+    if (GetSysPara(SUPER_RES_BUDGET_PARA, budgetUs) && budgetUs > 0) {
+        return budgetUs;
+    }
+    int32_t frameRate = sourceConfig.GetFrameRate() > 0 ? sourceConfig.GetFrameRate() : DEFAULT_FRAME_RATE;
+    return US_PER_SECOND / frameRate / BUDGET_FRAME_DIVISOR;
+}
+
+int32_t ScaleConvertSuperResBackend::Init(const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig)
+{
+    std::lock_guard<std::mutex> autoLock(superResMutex_);
+    if (!IsUpscale(sourceConfig, targetConfig)) {
+        return DCAMERA_BAD_VALUE;
+    }
+    if (!LoadLibrary()) {
+        return DCAMERA_NOT_FOUND;
+    }
+    DCameraBlitImage src = { static_cast<int32_t>(sourceConfig.GetVideoformat()), sourceConfig.GetWidth(),
+        sourceConfig.GetHeight(), sourceConfig.GetWidth(), sourceConfig.GetHeight(), nullptr, 0 };
+    DCameraBlitImage dst = { static_cast<int32_t>(targetConfig.GetVideoformat()), targetConfig.GetWidth(),
+        targetConfig.GetHeight(), targetConfig.GetWidth(), targetConfig.GetHeight(), nullptr, 0 };
+    context_ = createFunc_(&src, &dst);
+    if (context_ == nullptr) {
+        DHLOGI("Super resolution refuses %{public}dx%{public}d fmt %{public}d -> %{public}dx%{public}d.",
+            src.width, src.height, src.format, dst.width, dst.height);
+        return DCAMERA_BAD_VALUE;
+    }
+    budgetUs_ = GetBudgetUs(sourceConfig);
+    isOverBudget_ = false;
+    windowCostUs_ = 0;
+    windowFrames_ = 0;
+    DHLOGI("Super resolution takes %{public}dx%{public}d -> %{public}dx%{public}d, budget %{public}" PRId64 "us.",
+        src.width, src.height, dst.width, dst.height, budgetUs_);
+    return DCAMERA_OK;
+}
+
+bool ScaleConvertSuperResBackend::LoadLibrary()
+{
+    if (dlHandler_ != nullptr) {
+        return true;
+    }
+    dlHandler_ = dlopen(SUPER_RES_LIB_PATH, RTLD_LAZY | RTLD_NODELETE);
+    if (dlHandler_ == nullptr) {
+        DHLOGI("No super resolution library, upscaling stays on the scale convert path.");
+        return false;
+    }
+    createFunc_ = reinterpret_cast<DCameraSuperResCreateFunc>(dlsym(dlHandler_, SUPER_RES_CREATE_FUNC));
+    processFunc_ = reinterpret_cast<DCameraSuperResProcessFunc>(dlsym(dlHandler_, SUPER_RES_PROCESS_FUNC));
+    destroyFunc_ = reinterpret_cast<DCameraSuperResDestroyFunc>(dlsym(dlHandler_, SUPER_RES_DESTROY_FUNC));
+    if (createFunc_ == nullptr || processFunc_ == nullptr || destroyFunc_ == nullptr) {
+        DHLOGE("Super resolution library lacks its entry points, failed reason: %{public}s.", dlerror());
+        dlclose(dlHandler_);
+        dlHandler_ = nullptr;
+        createFunc_ = nullptr;
+        processFunc_ = nullptr;
+        destroyFunc_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void ScaleConvertSuperResBackend::SetFallback(std::unique_ptr<IScaleConvertBackend> fallback)
+{
+    std::lock_guard<std::mutex> autoLock(superResMutex_);
+    fallback_ = std::move(fallback);
+}
+
+int32_t ScaleConvertSuperResBackend::Convert(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo)
+{
+    std::lock_guard<std::mutex> autoLock(superResMutex_);
+    if (Upscale(srcImgInfo, dstImgInfo) == DCAMERA_OK) {
+        return DCAMERA_OK;
+    }
+    CHECK_AND_RETURN_RET_LOG(fallback_ == nullptr, DCAMERA_BAD_OPERATE, "No fallback backend for the frame.");
+    return fallback_->Convert(srcImgInfo, dstImgInfo);
+}
+
+int32_t ScaleConvertSuperResBackend::Upscale(const ImageUnitInfo& srcImgInfo, ImageUnitInfo& dstImgInfo)
+{
+    if (context_ == nullptr || isOverBudget_) {
+        return DCAMERA_BAD_OPERATE;
+    }
+    CHECK_AND_RETURN_RET_LOG(srcImgInfo.imgData == nullptr || dstImgInfo.imgData == nullptr, DCAMERA_BAD_VALUE,
+        "Super resolution image data is null.");
+    DCameraBlitImage src = ToImage(srcImgInfo);
+    DCameraBlitImage dst = ToImage(dstImgInfo);
+    int64_t startUs = GetNowTimeStampUs();
+    int32_t ret = processFunc_(context_, &src, &dst);
+    CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, DCAMERA_BAD_OPERATE, "Super resolution failed, ret: %{public}d.",
+        ret);
+    // The frame that breaks the budget is already upscaled and still goes out.
+    if (!OnFrameCost(GetNowTimeStampUs() - startUs)) {
+        DHLOGI("Super resolution over its %{public}" PRId64 "us budget, falls back to scale convert.", budgetUs_);
+    }
+    return DCAMERA_OK;
+}
+
+bool ScaleConvertSuperResBackend::OnFrameCost(int64_t costUs)
+{
+    windowCostUs_ += costUs > 0 ? costUs : 0;
+    windowFrames_++;
+    if (windowFrames_ < BUDGET_WINDOW_FRAMES) {
+        return true;
+    }
+    isOverBudget_ = windowCostUs_ / windowFrames_ > budgetUs_;
+    windowCostUs_ = 0;
+    windowFrames_ = 0;
+    return !isOverBudget_;
+}
+
+DCameraBlitImage ScaleConvertSuperResBackend::ToImage(const ImageUnitInfo& imgInfo)
+{
+    return { static_cast<int32_t>(imgInfo.colorFormat), imgInfo.width, imgInfo.height, imgInfo.alignedWidth,
+        imgInfo.alignedHeight, imgInfo.imgData->Data(), imgInfo.imgData->Size() };
+}
+
+void ScaleConvertSuperResBackend::Release()
+{
+    std::lock_guard<std::mutex> autoLock(superResMutex_);
+    if (context_ != nullptr && destroyFunc_ != nullptr) {
+        destroyFunc_(context_);
+    }
+    context_ = nullptr;
+    if (dlHandler_ != nullptr) {
+        dlclose(dlHandler_);
+        dlHandler_ = nullptr;
+    }
+    createFunc_ = nullptr;
+    processFunc_ = nullptr;
+    destroyFunc_ = nullptr;
+    if (fallback_ != nullptr) {
+        fallback_->Release();
+        fallback_ = nullptr;
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_codec_capability.h"
+
+#include <algorithm>
+#include <string>
+
+#include "avcodec_info.h"
+#include "avcodec_list.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraCodecCapability);
+
+VideoCapabilityBounds DCameraCodecCapability::GetBounds(const VideoCodecType codecType, const bool isEncoder,
+    const VideoCapabilityBounds& defaults)
+{
+    if (codecType != VideoCodecType::CODEC_H264 && codecType != VideoCodecType::CODEC_H265) {
+        return defaults;
+    }
+    VideoCapabilityBounds bounds;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto key = std::make_pair(codecType, isEncoder);
+        auto iter = boundsCache_.find(key);
+        if (iter != boundsCache_.end()) {
+            bounds = iter->second;
+        } else if (QueryBounds(codecType, isEncoder, bounds)) {
+            boundsCache_[key] = bounds;
+        } else {
+            DHLOGI("Query codec %{public}d capability failed, use default bounds.", codecType);
+            return defaults;
+        }
+    }
+    // The capability only raises the limits, configs that worked with the defaults keep working.
+    bounds.maxWidth = std::max(bounds.maxWidth, defaults.maxWidth);
+    bounds.maxHeight = std::max(bounds.maxHeight, defaults.maxHeight);
+    bounds.maxFrameRate = std::max(bounds.maxFrameRate, defaults.maxFrameRate);
+    return bounds;
+}
+
+bool DCameraCodecCapability::QueryBounds(const VideoCodecType codecType, const bool isEncoder,
+    VideoCapabilityBounds& bounds)
+{
+    std::shared_ptr<MediaAVCodec::AVCodecList> avCodecList = MediaAVCodec::AVCodecListFactory::CreateAVCodecList();
+    CHECK_AND_RETURN_RET_LOG(avCodecList == nullptr, false, "Create avCodecList failed");
+    std::string mime = (codecType == VideoCodecType::CODEC_H265) ?
+        std::string(MediaAVCodec::CodecMimeType::VIDEO_HEVC) : std::string(MediaAVCodec::CodecMimeType::VIDEO_AVC);
+    MediaAVCodec::CapabilityData *capData = avCodecList->GetCapability(mime, isEncoder,
+        MediaAVCodec::AVCodecCategory::AVCODEC_HARDWARE);
+    CHECK_AND_RETURN_RET_LOG(capData == nullptr, false, "No hardware capability for %{public}s", mime.c_str());
+    if (capData->width.maxVal <= 0 || capData->height.maxVal <= 0 || capData->frameRate.maxVal <= 0) {
+        DHLOGE("Invalid capability of %{public}s", mime.c_str());
+        return false;
+    }
+    bounds.maxWidth = std::min(capData->width.maxVal, MAX_WIDTH_LIMIT);
+    bounds.maxHeight = std::min(capData->height.maxVal, MAX_HEIGHT_LIMIT);
+    bounds.maxFrameRate = std::min(capData->frameRate.maxVal, MAX_FRAME_RATE_LIMIT);
+    auto ltrIter = capData->featuresMap.find(
+        static_cast<int32_t>(MediaAVCodec::AVCapabilityFeature::VIDEO_ENCODER_LONG_TERM_REFERENCE));
+    if (isEncoder && ltrIter != capData->featuresMap.end() &&
+        !ltrIter->second.GetIntValue(MAX_LTR_FRAME_COUNT_KEY, bounds.maxLtrFrameCount)) {
+        bounds.maxLtrFrameCount = 0;
+    }
+    bounds.pixelFormats = capData->pixFormat;
+    bounds.profiles = capData->profiles;
+    DHLOGI("Codec %{public}s isEncoder %{public}d bounds %{public}d x %{public}d @ %{public}d fps, ltr %{public}d.",
+        mime.c_str(), isEncoder, bounds.maxWidth, bounds.maxHeight, bounds.maxFrameRate, bounds.maxLtrFrameCount);
+    return true;
+}
+
+bool DCameraCodecCapability::IsInBounds(const VideoConfigParams& config, const VideoCapabilityBounds& bounds,
+    const int32_t minWidth, const int32_t minHeight, const int32_t minFrameRate)
+{
+    bool isWidthValid = (config.GetWidth() >= minWidth && config.GetWidth() <= bounds.maxWidth);
+    bool isHeightValid = (config.GetHeight() >= minHeight && config.GetHeight() <= bounds.maxHeight);
+    bool isFrameRateValid = (config.GetFrameRate() >= minFrameRate && config.GetFrameRate() <= bounds.maxFrameRate);
+    return isWidthValid && isHeightValid && isFrameRateValid;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
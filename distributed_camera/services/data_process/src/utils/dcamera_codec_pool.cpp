@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_codec_pool.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "avcodec_errors.h"
+#include "dcamera_thread_role.h"
+#include "dcamera_utils_tools.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraCodecPool);
+
+namespace {
+const std::string CODEC_POOL_EVICT_THREAD = "DCodecPoolEvict";
+constexpr int64_t PIXELS_SD = 640 * 480;
+constexpr int64_t PIXELS_HD = 1280 * 720;
+constexpr int64_t PIXELS_FHD = 1920 * 1080;
+
+template <typename T>
+void ReleaseCodec(const std::shared_ptr<T>& codec)
+{
+    int32_t ret = codec->Release();
+    CHECK_AND_LOG(ret != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK,
+        "Release pooled codec failed. ret %{public}d.", ret);
+}
+
+template <typename T>
+void ReleaseCodecs(const std::vector<std::shared_ptr<T>>& codecs)
+{
+    for (const auto& codec : codecs) {
+        ReleaseCodec(codec);
+    }
+}
+}
+
+DCameraCodecPool::~DCameraCodecPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isStopping_ = true;
+    }
+    evictCond_.notify_all();
+    if (evictThread_.joinable()) {
+        evictThread_.join();
+    }
+    ReleaseIdleCodecs();
+}
+
+int32_t DCameraCodecPool::GetResolutionClass(const int32_t width, const int32_t height)
+{
+    int64_t pixels = static_cast<int64_t>(width) * static_cast<int64_t>(height);
+    if (pixels <= PIXELS_SD) {
+        return 0;
+    }
+    if (pixels <= PIXELS_HD) {
+        return 1;
+    }
+    return (pixels <= PIXELS_FHD) ? 2 : 3;
+}
+
+int32_t DCameraCodecPool::GetIdleTimeoutMs()
+{
+    int32_t timeoutMs = DEFAULT_IDLE_TIMEOUT_MS;
+    if (!GetSysPara(IDLE_TIMEOUT_PARA, timeoutMs) || timeoutMs < 0) {
+        return DEFAULT_IDLE_TIMEOUT_MS;
+    }
+    return timeoutMs;
+}
+
+std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> DCameraCodecPool::AcquireDecoder(const std::string& mime,
+    const int32_t width, const int32_t height)
+{
+    std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> decoder =
+        Take(idleDecoders_, PoolKey(mime, GetResolutionClass(width, height)));
+    if (decoder != nullptr) {
+        DHLOGI("Reuse pooled decoder %{public}s for %{public}d x %{public}d.", mime.c_str(), width, height);
+        return decoder;
+    }
+    return MediaAVCodec::VideoDecoderFactory::CreateByMime(mime);
+}
+
+void DCameraCodecPool::ReturnDecoder(const std::string& mime, const int32_t width, const int32_t height,
+    std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder>& decoder)
+{
+    if (decoder == nullptr) {
+        return;
+    }
+    int32_t timeoutMs = GetIdleTimeoutMs();
+    if (timeoutMs == 0 || decoder->Reset() != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK ||
+        !Park(idleDecoders_, PoolKey(mime, GetResolutionClass(width, height)), decoder, timeoutMs)) {
+        ReleaseCodec(decoder);
+    }
+    decoder = nullptr;
+}
+
+std::shared_ptr<MediaAVCodec::AVCodecVideoEncoder> DCameraCodecPool::AcquireEncoder(const std::string& mime,
+    const int32_t width, const int32_t height)
+{
+    std::shared_ptr<MediaAVCodec::AVCodecVideoEncoder> encoder =
+        Take(idleEncoders_, PoolKey(mime, GetResolutionClass(width, height)));
+    if (encoder != nullptr) {
+        DHLOGI("Reuse pooled encoder %{public}s for %{public}d x %{public}d.", mime.c_str(), width, height);
+        return encoder;
+    }
+    return MediaAVCodec::VideoEncoderFactory::CreateByMime(mime);
+}
+
+void DCameraCodecPool::ReturnEncoder(const std::string& mime, const int32_t width, const int32_t height,
+    std::shared_ptr<MediaAVCodec::AVCodecVideoEncoder>& encoder)
+{
+    if (encoder == nullptr) {
+        return;
+    }
+    int32_t timeoutMs = GetIdleTimeoutMs();
+    if (timeoutMs == 0 || encoder->Reset() != MediaAVCodec::AVCodecServiceErrCode::AVCS_ERR_OK ||
+        !Park(idleEncoders_, PoolKey(mime, GetResolutionClass(width, height)), encoder, timeoutMs)) {
+        ReleaseCodec(encoder);
+    }
+    encoder = nullptr;
+}
+
+void DCameraCodecPool::ReleaseIdleCodecs()
+{
+    IdleMap<MediaAVCodec::AVCodecVideoDecoder> decoders;
+    IdleMap<MediaAVCodec::AVCodecVideoEncoder> encoders;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        decoders.swap(idleDecoders_);
+        encoders.swap(idleEncoders_);
+        idleCount_ = 0;
+    }
+    for (const auto& iter : decoders) {
+        for (const auto& idle : iter.second) {
+            ReleaseCodec(idle.codec);
+        }
+    }
+    for (const auto& iter : encoders) {
+        for (const auto& idle : iter.second) {
+            ReleaseCodec(idle.codec);
+        }
+    }
+}
+
+size_t DCameraCodecPool::GetIdleCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idleCount_;
+}
+
+template <typename T>
+std::shared_ptr<T> DCameraCodecPool::Take(IdleMap<T>& idleMap, const PoolKey& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = idleMap.find(key);
+    if (iter == idleMap.end() || iter->second.empty()) {
+        return nullptr;
+    }
+    std::shared_ptr<T> codec = iter->second.back().codec;
+    iter->second.pop_back();
+    if (iter->second.empty()) {
+        idleMap.erase(iter);
+    }
+    idleCount_--;
+    return codec;
+}
+
+template <typename T>
+bool DCameraCodecPool::Park(IdleMap<T>& idleMap, const PoolKey& key, const std::shared_ptr<T>& codec,
+    const int32_t timeoutMs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<IdleCodec<T>>& idleCodecs = idleMap[key];
+    if (isStopping_ || idleCount_ >= MAX_IDLE_CODECS || idleCodecs.size() >= MAX_IDLE_PER_KEY) {
+        if (idleCodecs.empty()) {
+            idleMap.erase(key);
+        }
+        return false;
+    }
+    idleCodecs.push_back({ codec, GetNowTimeStampMs() });
+    idleCount_++;
+    idleTimeoutMs_ = timeoutMs;
+    StartEvictLocked();
+    return true;
+}
+
+template <typename T>
+void DCameraCodecPool::CollectExpired(IdleMap<T>& idleMap, const int64_t nowMs,
+    std::vector<std::shared_ptr<T>>& expired)
+{
+    for (auto iter = idleMap.begin(); iter != idleMap.end();) {
+        std::vector<IdleCodec<T>>& idleCodecs = iter->second;
+        auto first = std::remove_if(idleCodecs.begin(), idleCodecs.end(), [&](const IdleCodec<T>& idle) {
+            return nowMs - idle.idleSinceMs >= idleTimeoutMs_;
+        });
+        for (auto it = first; it != idleCodecs.end(); ++it) {
+            expired.push_back(it->codec);
+        }
+        idleCount_ -= static_cast<size_t>(idleCodecs.end() - first);
+        idleCodecs.erase(first, idleCodecs.end());
+        iter = idleCodecs.empty() ? idleMap.erase(iter) : std::next(iter);
+    }
+}
+
+template <typename T>
+int64_t DCameraCodecPool::NextExpiryMs(const IdleMap<T>& idleMap, const int64_t earliestMs)
+{
+    int64_t nextMs = earliestMs;
+    for (const auto& iter : idleMap) {
+        for (const auto& idle : iter.second) {
+            nextMs = std::min(nextMs, idle.idleSinceMs + idleTimeoutMs_);
+        }
+    }
+    return nextMs;
+}
+
+void DCameraCodecPool::StartEvictLocked()
+{
+    if (isEvicting_) {
+        evictCond_.notify_all();
+        return;
+    }
+    // A finished loop cleared isEvicting_ under the lock and does not take it again, the join returns at once.
+    if (evictThread_.joinable()) {
+        evictThread_.join();
+    }
+    isEvicting_ = true;
+    evictThread_ = std::thread([this]() { EvictLoop(); });
+}
+
+void DCameraCodecPool::EvictLoop()
+{
+    DCameraThreadRoleRegistry::GetInstance().ApplyCurrentThread(DCAMERA_THREAD_BACKGROUND, CODEC_POOL_EVICT_THREAD);
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!isStopping_ && idleCount_ > 0) {
+        int64_t nowMs = GetNowTimeStampMs();
+        int64_t nextMs = NextExpiryMs(idleEncoders_, NextExpiryMs(idleDecoders_, nowMs + idleTimeoutMs_));
+        if (nextMs > nowMs) {
+            evictCond_.wait_for(lock, std::chrono::milliseconds(nextMs - nowMs));
+            continue;
+        }
+        std::vector<std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder>> expiredDecoders;
+        std::vector<std::shared_ptr<MediaAVCodec::AVCodecVideoEncoder>> expiredEncoders;
+        CollectExpired(idleDecoders_, nowMs, expiredDecoders);
+        CollectExpired(idleEncoders_, nowMs, expiredEncoders);
+        lock.unlock();
+        DHLOGI("Release %{public}zu idle decoders and %{public}zu idle encoders.", expiredDecoders.size(),
+            expiredEncoders.size());
+        ReleaseCodecs(expiredDecoders);
+        ReleaseCodecs(expiredEncoders);
+        lock.lock();
+    }
+    isEvicting_ = false;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_decoder_arbiter.h"
+
+#include <cinttypes>
+#include <vector>
+
+#include "avcodec_info.h"
+#include "avcodec_list.h"
+#include "dcamera_utils_tools.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraDecoderArbiter);
+
+namespace {
+constexpr int64_t PIXELS_PER_MEGAPIXEL = 1000000;
+}
+
+int64_t DCameraDecoderArbiter::GetLoad(int32_t width, int32_t height, int32_t frameRate)
+{
+    if (width <= 0 || height <= 0 || frameRate <= 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(width) * static_cast<int64_t>(height) * static_cast<int64_t>(frameRate);
+}
+
+std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> DCameraDecoderArbiter::CreateSoftwareDecoder(
+    const std::string& mime)
+{
+    std::shared_ptr<MediaAVCodec::AVCodecList> avCodecList = MediaAVCodec::AVCodecListFactory::CreateAVCodecList();
+    CHECK_AND_RETURN_RET_LOG(avCodecList == nullptr, nullptr, "%{public}s", "Create avCodecList failed.");
+    MediaAVCodec::CapabilityData *capData = avCodecList->GetCapability(mime, false,
+        MediaAVCodec::AVCodecCategory::AVCODEC_SOFTWARE);
+    CHECK_AND_RETURN_RET_LOG(capData == nullptr || capData->codecName.empty(), nullptr,
+        "No software decoder for %{public}s", mime.c_str());
+    DHLOGI("Create software decoder %{public}s for %{public}s.", capData->codecName.c_str(), mime.c_str());
+    return MediaAVCodec::VideoDecoderFactory::CreateByName(capData->codecName);
+}
+
+int32_t DCameraDecoderArbiter::GetMaxHardwareDecoders()
+{
+    int32_t maxDecoders = DEFAULT_MAX_HW_DECODERS;
+    if (!GetSysPara(MAX_HW_DECODERS_PARA, maxDecoders) || maxDecoders < 0) {
+        return DEFAULT_MAX_HW_DECODERS;
+    }
+    return maxDecoders;
+}
+
+int64_t DCameraDecoderArbiter::GetMaxHardwareLoad()
+{
+    int32_t maxLoadMpps = DEFAULT_MAX_HW_LOAD_MPPS;
+    if (!GetSysPara(MAX_HW_LOAD_PARA, maxLoadMpps) || maxLoadMpps <= 0) {
+        maxLoadMpps = DEFAULT_MAX_HW_LOAD_MPPS;
+    }
+    return static_cast<int64_t>(maxLoadMpps) * PIXELS_PER_MEGAPIXEL;
+}
+
+DCameraDecoderGrant DCameraDecoderArbiter::Acquire(const std::string& streamKey, int64_t load,
+    const StepDownCallback& stepDown)
+{
+    int32_t maxDecoders = GetMaxHardwareDecoders();
+    int64_t maxLoad = GetMaxHardwareLoad();
+    std::vector<StepDownCallback> stepDowns;
+    DecoderEntry entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        decoders_.erase(streamKey);
+        entry.priority = GetPriorityLocked(streamKey);
+        entry.load = load;
+        entry.stepDown = stepDown;
+        int32_t hardwareCount = 0;
+        int64_t hardwareLoad = 0;
+        for (const auto& iter : decoders_) {
+            if (iter.second.isHardware) {
+                hardwareCount++;
+                hardwareLoad += iter.second.load;
+            }
+        }
+        // A single stream above the load limit still gets the hardware when nothing else holds it.
+        entry.isHardware = (hardwareCount < maxDecoders) && (hardwareCount == 0 || hardwareLoad + load <= maxLoad);
+        if (!entry.isHardware) {
+            for (auto& iter : decoders_) {
+                DecoderEntry& holder = iter.second;
+                if (holder.isHardware && holder.priority > entry.priority && !holder.isStepDownRequested &&
+                    holder.stepDown != nullptr) {
+                    holder.isStepDownRequested = true;
+                    stepDowns.push_back(holder.stepDown);
+                }
+            }
+        }
+        DHLOGI("Decoder of %{public}s granted %{public}s, load %{public}" PRId64 ", hardware %{public}d/%{public}d "
+            "load %{public}" PRId64 "/%{public}" PRId64, streamKey.c_str(), entry.isHardware ? "hardware" : "software",
+            load, hardwareCount, maxDecoders, hardwareLoad, maxLoad);
+        decoders_[streamKey] = entry;
+    }
+    for (const auto& callback : stepDowns) {
+        callback();
+    }
+    return entry.isHardware ? DCameraDecoderGrant::HARDWARE : DCameraDecoderGrant::SOFTWARE;
+}
+
+void DCameraDecoderArbiter::OnHardwareUnavailable(const std::string& streamKey)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = decoders_.find(streamKey);
+    if (iter != decoders_.end()) {
+        iter->second.isHardware = false;
+    }
+}
+
+void DCameraDecoderArbiter::Release(const std::string& streamKey)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    decoders_.erase(streamKey);
+}
+
+void DCameraDecoderArbiter::SetStreamPriority(const std::string& streamKey, DCameraDecodePriority priority)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (priorities_.find(streamKey) == priorities_.end() && priorities_.size() >= MAX_PRIORITY_ENTRIES) {
+        priorities_.erase(priorities_.begin());
+    }
+    priorities_[streamKey] = priority;
+    auto iter = decoders_.find(streamKey);
+    if (iter != decoders_.end()) {
+        iter->second.priority = priority;
+    }
+}
+
+size_t DCameraDecoderArbiter::GetHardwareCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (const auto& iter : decoders_) {
+        count += iter.second.isHardware ? 1 : 0;
+    }
+    return count;
+}
+
+DCameraDecodePriority DCameraDecoderArbiter::GetPriorityLocked(const std::string& streamKey)
+{
+    auto iter = priorities_.find(streamKey);
+    return (iter == priorities_.end()) ? DCameraDecodePriority::FOREGROUND : iter->second;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
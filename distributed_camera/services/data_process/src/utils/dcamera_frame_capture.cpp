@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_frame_capture.h"
+
+#include <chrono>
+#include <thread>
+
+#include "dcamera_utils_tools.h"
+#include "distributed_camera_constants.h"
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr uint32_t CAPTURE_FILE_MAGIC = 0x50414344; // "DCAP"
+constexpr uint32_t CAPTURE_FRAME_MAGIC = 0x52464344; // "DCFR"
+constexpr uint32_t CAPTURE_VERSION = 1;
+constexpr size_t CAPTURE_FRAME_HEADER_SIZE = 128;
+static_assert(sizeof(DCameraCaptureFrameHeader) == CAPTURE_FRAME_HEADER_SIZE, "capture frame header layout changed");
+static_assert(sizeof(DCameraFrameProcessTimePoint) == DCAMERA_CAPTURE_TIME_POINT_NUM * sizeof(int64_t),
+    "time points do not match the capture frame header");
+
+void PackTimePoints(const DCameraFrameProcessTimePoint& timePoint, int64_t *points)
+{
+    const int64_t values[DCAMERA_CAPTURE_TIME_POINT_NUM] = { timePoint.startEncode, timePoint.finishEncode,
+        timePoint.send, timePoint.recv, timePoint.startDecode, timePoint.finishDecode, timePoint.startScale,
+        timePoint.finishScale, timePoint.startSmooth, timePoint.finishSmooth };
+    for (size_t i = 0; i < DCAMERA_CAPTURE_TIME_POINT_NUM; i++) {
+        points[i] = values[i];
+    }
+}
+
+void UnpackTimePoints(const int64_t *points, DCameraFrameProcessTimePoint& timePoint)
+{
+    int64_t *values[DCAMERA_CAPTURE_TIME_POINT_NUM] = { &timePoint.startEncode, &timePoint.finishEncode,
+        &timePoint.send, &timePoint.recv, &timePoint.startDecode, &timePoint.finishDecode, &timePoint.startScale,
+        &timePoint.finishScale, &timePoint.startSmooth, &timePoint.finishSmooth };
+    for (size_t i = 0; i < DCAMERA_CAPTURE_TIME_POINT_NUM; i++) {
+        *values[i] = points[i];
+    }
+}
+}
+
+DCameraFrameCaptureWriter::~DCameraFrameCaptureWriter()
+{
+    Close();
+}
+
+int32_t DCameraFrameCaptureWriter::Open(const std::string& path, const VideoConfigParams& sourceConfig,
+    const VideoConfigParams& targetConfig)
+{
+    std::lock_guard<std::mutex> lock(fileMutex_);
+    CHECK_AND_RETURN_RET_LOG(file_ != nullptr, DCAMERA_WRONG_STATE, "%{public}s", "capture is already open.");
+    file_ = fopen(path.c_str(), "wb");
+    CHECK_AND_RETURN_RET_LOG(file_ == nullptr, DCAMERA_BAD_OPERATE, "%{public}s", "open capture file failed.");
+    DCameraCaptureFileHeader header = {};
+    header.magic = CAPTURE_FILE_MAGIC;
+    header.version = CAPTURE_VERSION;
+    header.sourceCodec = static_cast<int32_t>(sourceConfig.GetVideoCodecType());
+    header.sourceFormat = static_cast<int32_t>(sourceConfig.GetVideoformat());
+    header.sourceFrameRate = sourceConfig.GetFrameRate();
+    header.sourceWidth = sourceConfig.GetWidth();
+    header.sourceHeight = sourceConfig.GetHeight();
+    header.targetCodec = static_cast<int32_t>(targetConfig.GetVideoCodecType());
+    header.targetFormat = static_cast<int32_t>(targetConfig.GetVideoformat());
+    header.targetFrameRate = targetConfig.GetFrameRate();
+    header.targetWidth = targetConfig.GetWidth();
+    header.targetHeight = targetConfig.GetHeight();
+    header.targetRotation = targetConfig.GetRotation();
+    header.sourceEis = sourceConfig.GetEis() ? 1 : 0;
+    header.targetSystemSwitch = targetConfig.GetIsSystemSwitch() ? 1 : 0;
+    if (fwrite(&header, sizeof(header), 1, file_) != 1) {
+        DHLOGE("Write capture file header failed.");
+        fclose(file_);
+        file_ = nullptr;
+        return DCAMERA_BAD_OPERATE;
+    }
+    DHLOGI("Capture source pipeline frames to %{public}s.", path.c_str());
+    return DCAMERA_OK;
+}
+
+int32_t DCameraFrameCaptureWriter::Write(const std::shared_ptr<DataBuffer>& buffer)
+{
+    CHECK_AND_RETURN_RET_LOG(buffer == nullptr || buffer->Data() == nullptr, DCAMERA_BAD_VALUE, "%{public}s",
+        "capture buffer is null.");
+    DCameraCaptureFrameHeader header = {};
+    header.magic = CAPTURE_FRAME_MAGIC;
+    header.size = static_cast<uint32_t>(buffer->Size());
+    header.recordTimeUs = GetNowTimeStampUs();
+    header.pts = buffer->frameInfo_.pts;
+    header.rawTime = buffer->frameInfo_.rawTime;
+    PackTimePoints(buffer->frameInfo_.timePonit, header.timePoints);
+    header.index = buffer->frameInfo_.index;
+    header.offset = buffer->frameInfo_.offset;
+    header.type = buffer->frameInfo_.type;
+
+    std::lock_guard<std::mutex> lock(fileMutex_);
+    if (file_ == nullptr) {
+        return DCAMERA_WRONG_STATE;
+    }
+    if (fwrite(&header, sizeof(header), 1, file_) != 1 || fwrite(buffer->Data(), 1, buffer->Size(), file_) !=
+        buffer->Size()) {
+        // A short write leaves a frame the reader cannot skip, so stop here and keep what is complete.
+        DHLOGE("Write capture frame failed, stop capturing.");
+        fclose(file_);
+        file_ = nullptr;
+        return DCAMERA_BAD_OPERATE;
+    }
+    return DCAMERA_OK;
+}
+
+void DCameraFrameCaptureWriter::Close()
+{
+    std::lock_guard<std::mutex> lock(fileMutex_);
+    if (file_ != nullptr) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool DCameraFrameCaptureWriter::IsOpened()
+{
+    std::lock_guard<std::mutex> lock(fileMutex_);
+    return file_ != nullptr;
+}
+
+DCameraFrameCaptureReader::~DCameraFrameCaptureReader()
+{
+    Close();
+}
+
+int32_t DCameraFrameCaptureReader::Open(const std::string& path)
+{
+    CHECK_AND_RETURN_RET_LOG(file_ != nullptr, DCAMERA_WRONG_STATE, "%{public}s", "capture is already open.");
+    file_ = fopen(path.c_str(), "rb");
+    CHECK_AND_RETURN_RET_LOG(file_ == nullptr, DCAMERA_NOT_FOUND, "%{public}s", "open capture file failed.");
+    DCameraCaptureFileHeader header = {};
+    if (fread(&header, sizeof(header), 1, file_) != 1 || header.magic != CAPTURE_FILE_MAGIC ||
+        header.version != CAPTURE_VERSION) {
+        DHLOGE("Not a capture file of version %{public}u.", CAPTURE_VERSION);
+        Close();
+        return DCAMERA_BAD_TYPE;
+    }
+    sourceConfig_ = VideoConfigParams(static_cast<VideoCodecType>(header.sourceCodec),
+        static_cast<Videoformat>(header.sourceFormat), header.sourceFrameRate, header.sourceWidth,
+        header.sourceHeight, header.sourceEis != 0);
+    targetConfig_ = VideoConfigParams(static_cast<VideoCodecType>(header.targetCodec),
+        static_cast<Videoformat>(header.targetFormat), header.targetFrameRate, header.targetWidth,
+        header.targetHeight);
+    targetConfig_.SetSystemSwitchFlagAndRotation(header.targetSystemSwitch != 0, header.targetRotation);
+    return DCAMERA_OK;
+}
+
+int32_t DCameraFrameCaptureReader::ReadFrame(std::shared_ptr<DataBuffer>& buffer, int64_t& recordTimeUs)
+{
+    CHECK_AND_RETURN_RET_LOG(file_ == nullptr, DCAMERA_WRONG_STATE, "%{public}s", "capture is not open.");
+    DCameraCaptureFrameHeader header = {};
+    if (fread(&header, sizeof(header), 1, file_) != 1) {
+        return DCAMERA_NOT_FOUND;
+    }
+    CHECK_AND_RETURN_RET_LOG(header.magic != CAPTURE_FRAME_MAGIC || header.size == 0 ||
+        header.size > DCAMERA_MAX_RECV_DATA_LEN, DCAMERA_BAD_VALUE, "Bad capture frame, size %{public}u.",
+        header.size);
+    buffer = DataBuffer::Acquire(header.size);
+    CHECK_AND_RETURN_RET_LOG(buffer == nullptr || buffer->Data() == nullptr, DCAMERA_MEMORY_OPT_ERROR, "%{public}s",
+        "acquire capture frame buffer failed.");
+    if (fread(buffer->Data(), 1, header.size, file_) != header.size) {
+        DHLOGE("Capture frame %{public}d is truncated.", header.index);
+        buffer = nullptr;
+        return DCAMERA_NOT_FOUND;
+    }
+    buffer->frameInfo_.pts = header.pts;
+    buffer->frameInfo_.rawTime = header.rawTime;
+    UnpackTimePoints(header.timePoints, buffer->frameInfo_.timePonit);
+    buffer->frameInfo_.index = header.index;
+    buffer->frameInfo_.offset = header.offset;
+    buffer->frameInfo_.type = static_cast<int8_t>(header.type);
+    recordTimeUs = header.recordTimeUs;
+    return DCAMERA_OK;
+}
+
+void DCameraFrameCaptureReader::Close()
+{
+    if (file_ != nullptr) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+const VideoConfigParams& DCameraFrameCaptureReader::GetSourceConfig() const
+{
+    return sourceConfig_;
+}
+
+const VideoConfigParams& DCameraFrameCaptureReader::GetTargetConfig() const
+{
+    return targetConfig_;
+}
+
+int32_t DCameraFrameReplayer::Replay(DCameraFrameCaptureReader& reader,
+    const std::shared_ptr<IDataProcessPipeline>& pipeline, double speed, uint32_t& fedCount)
+{
+    CHECK_AND_RETURN_RET_LOG(pipeline == nullptr || speed < 0, DCAMERA_BAD_VALUE, "%{public}s",
+        "replay pipeline or speed is invalid.");
+    fedCount = 0;
+    int64_t firstRecordUs = 0;
+    int64_t startUs = 0;
+    while (true) {
+        std::shared_ptr<DataBuffer> buffer = nullptr;
+        int64_t recordTimeUs = 0;
+        int32_t ret = reader.ReadFrame(buffer, recordTimeUs);
+        if (ret == DCAMERA_NOT_FOUND) {
+            break;
+        }
+        CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, ret, "Read capture frame failed, ret %{public}d.", ret);
+        if (fedCount == 0) {
+            firstRecordUs = recordTimeUs;
+            startUs = GetNowTimeStampUs();
+        } else if (speed > 0) {
+            int64_t dueUs = startUs + static_cast<int64_t>((recordTimeUs - firstRecordUs) / speed);
+            int64_t waitUs = dueUs - GetNowTimeStampUs();
+            if (waitUs > 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(waitUs));
+            }
+        }
+        // The frame arrives now, the stages after it measure their waits from here.
+        buffer->frameInfo_.timePonit.recv = GetNowTimeStampUs();
+        std::vector<std::shared_ptr<DataBuffer>> buffers = { buffer };
+        ret = pipeline->ProcessData(buffers);
+        CHECK_AND_RETURN_RET_LOG(ret != DCAMERA_OK, ret, "Replay frame %{public}d failed, ret %{public}d.",
+            buffer->frameInfo_.index, ret);
+        fedCount++;
+    }
+    DHLOGI("Replayed %{public}u frames.", fedCount);
+    return DCAMERA_OK;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
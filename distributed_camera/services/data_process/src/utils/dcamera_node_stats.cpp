@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_node_stats.h"
+
+#include "dcamera_utils_tools.h"
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+#include "idata_process_pipeline.h"
+#include "property_carrier.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+FWK_IMPLEMENT_SINGLE_INSTANCE(DCameraPipelineStatsRegistry);
+
+void DCameraNodeStats::GetInfo(DCameraNodeStatsInfo& info) const
+{
+    info.framesIn = framesIn_.load(std::memory_order_relaxed);
+    info.framesOut = framesOut_.load(std::memory_order_relaxed);
+    info.framesDropped = framesDropped_.load(std::memory_order_relaxed);
+    info.queueDepth = queueDepth_.load(std::memory_order_relaxed);
+    info.availableSlots = availableSlots_.load(std::memory_order_relaxed);
+    info.waitTimeUs = waitTimeUs_.load(std::memory_order_relaxed);
+    info.processTimeUs = processTimeUs_.load(std::memory_order_relaxed);
+    info.bytesAllocated = bytesAllocated_.load(std::memory_order_relaxed);
+}
+
+void DCameraNodeStats::Reset()
+{
+    framesIn_.store(0, std::memory_order_relaxed);
+    framesOut_.store(0, std::memory_order_relaxed);
+    framesDropped_.store(0, std::memory_order_relaxed);
+    queueDepth_.store(0, std::memory_order_relaxed);
+    availableSlots_.store(0, std::memory_order_relaxed);
+    waitTimeUs_.store(0, std::memory_order_relaxed);
+    processTimeUs_.store(0, std::memory_order_relaxed);
+    bytesAllocated_.store(0, std::memory_order_relaxed);
+}
+
+DCameraNodeStatsScope::DCameraNodeStatsScope(DCameraNodeStats& stats, size_t frameCount)
+    : stats_(stats), startUs_(GetNowTimeStampUs())
+{
+    stats_.OnFramesIn(frameCount);
+}
+
+DCameraNodeStatsScope::~DCameraNodeStatsScope()
+{
+    stats_.AddProcessTime(GetNowTimeStampUs() - startUs_);
+}
+
+static uint64_t AverageOf(uint64_t total, uint64_t count)
+{
+    return (count == 0) ? 0 : total / count;
+}
+
+void DumpNodeStats(const std::vector<DCameraNodeStatsInfo>& nodeStats, std::string& result)
+{
+    for (const auto& info : nodeStats) {
+        result.append("  [").append(std::to_string(info.nodeRank)).append("] ").append(info.nodeName)
+            .append(": in ").append(std::to_string(info.framesIn))
+            .append(" out ").append(std::to_string(info.framesOut))
+            .append(" dropped ").append(std::to_string(info.framesDropped))
+            .append(" queue ").append(std::to_string(info.queueDepth))
+            .append(" slots ").append(std::to_string(info.availableSlots))
+            .append(" avgWaitUs ").append(std::to_string(AverageOf(info.waitTimeUs, info.framesIn)))
+            .append(" avgProcessUs ").append(std::to_string(AverageOf(info.processTimeUs, info.framesIn)))
+            .append(" allocatedBytes ").append(std::to_string(info.bytesAllocated))
+            .append("\n");
+    }
+}
+
+void DCameraPipelineStatsRegistry::Register(const std::string& name,
+    const std::shared_ptr<IDataProcessPipeline>& pipeline)
+{
+    CHECK_AND_RETURN_LOG(pipeline == nullptr, "%{public}s", "pipeline is null.");
+    std::lock_guard<std::mutex> lock(pipelineMutex_);
+    pipelines_[pipeline.get()] = { name + "#" + std::to_string(nextId_++), pipeline };
+}
+
+void DCameraPipelineStatsRegistry::Unregister(const IDataProcessPipeline *pipeline)
+{
+    std::lock_guard<std::mutex> lock(pipelineMutex_);
+    pipelines_.erase(pipeline);
+}
+
+void DCameraPipelineStatsRegistry::Dump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(pipelineMutex_);
+    if (pipelines_.empty()) {
+        result.append("No pipeline is running.\n");
+        return;
+    }
+    for (auto& iter : pipelines_) {
+        std::shared_ptr<IDataProcessPipeline> pipeline = iter.second.pipeline.lock();
+        if (pipeline == nullptr) {
+            continue;
+        }
+        PropertyCarrier carrier;
+        result.append("pipeline ").append(iter.second.name).append("\n");
+        if (pipeline->GetProperty(PIPELINE_STATS, carrier) != DCAMERA_OK) {
+            result.append("  unavailable\n");
+            continue;
+        }
+        DumpNodeStats(carrier.nodeStats_, result);
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_tile_compositor.h"
+
+#include <cmath>
+
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+#include "image_plane_kernels.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t YUV_BYTES_PER_PIXEL_NUMERATOR = 3;
+constexpr int32_t YUV_BYTES_PER_PIXEL_DENOMINATOR = 2;
+constexpr int32_t ALIGN_EVEN = 2;
+constexpr int32_t MAX_CANVAS_FRAME_RATE = 240;
+
+bool IsEven(int32_t value)
+{
+    return (value % ALIGN_EVEN) == 0;
+}
+
+size_t GetFrameSize(int32_t width, int32_t height)
+{
+    return static_cast<size_t>(width) * static_cast<size_t>(height) * YUV_BYTES_PER_PIXEL_NUMERATOR /
+        YUV_BYTES_PER_PIXEL_DENOMINATOR;
+}
+}
+
+int32_t DCameraTileCompositor::Init(int32_t canvasWidth, int32_t canvasHeight, int32_t frameRate)
+{
+    if (canvasWidth <= 0 || canvasHeight <= 0 || !IsEven(canvasWidth) || !IsEven(canvasHeight) ||
+        frameRate <= 0 || frameRate > MAX_CANVAS_FRAME_RATE) {
+        DHLOGE("Invalid canvas %{public}d x %{public}d at %{public}d fps.", canvasWidth, canvasHeight, frameRate);
+        return DCAMERA_BAD_VALUE;
+    }
+    std::shared_ptr<DataBuffer> canvas = DataBuffer::Acquire(GetFrameSize(canvasWidth, canvasHeight));
+    CHECK_AND_RETURN_RET_LOG(canvas == nullptr, DCAMERA_MEMORY_OPT_ERROR, "%{public}s", "Acquire canvas failed.");
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    canvasWidth_ = canvasWidth;
+    canvasHeight_ = canvasHeight;
+    frameIntervalUs_ = US_PER_SECOND / frameRate;
+    nextTickUs_ = 0;
+    canvas_ = canvas;
+    FillTile({ 0, 0, canvasWidth_, canvasHeight_ });
+    for (auto& iter : tiles_) {
+        iter.second.pending = nullptr;
+        iter.second.lastFrameUs = 0;
+        iter.second.isBlank = false;
+    }
+    return DCAMERA_OK;
+}
+
+int32_t DCameraTileCompositor::SetTile(const std::string& tileId, const DCameraTilePlacement& placement)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    CHECK_AND_RETURN_RET_LOG(canvas_ == nullptr, DCAMERA_WRONG_STATE, "%{public}s", "Compositor is not inited.");
+    CHECK_AND_RETURN_RET_LOG(!IsInCanvas(placement), DCAMERA_BAD_VALUE,
+        "Tile %{public}d,%{public}d %{public}d x %{public}d is outside the canvas.", placement.x, placement.y,
+        placement.width, placement.height);
+    auto iter = tiles_.find(tileId);
+    if (iter == tiles_.end()) {
+        CHECK_AND_RETURN_RET_LOG(tiles_.size() >= MAX_TILE_COUNT, DCAMERA_BAD_OPERATE,
+            "Canvas already holds %{public}zu tiles.", tiles_.size());
+        iter = tiles_.emplace(tileId, TileState()).first;
+    } else {
+        FillTile(iter->second.placement);
+    }
+    // A moved or new tile starts stale, the next tick blanks it until its first frame arrives.
+    iter->second.placement = placement;
+    iter->second.pending = nullptr;
+    iter->second.lastFrameUs = 0;
+    iter->second.isBlank = false;
+    return DCAMERA_OK;
+}
+
+int32_t DCameraTileCompositor::RemoveTile(const std::string& tileId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = tiles_.find(tileId);
+    CHECK_AND_RETURN_RET_LOG(iter == tiles_.end(), DCAMERA_NOT_FOUND, "%{public}s", "Tile not found.");
+    if (canvas_ != nullptr) {
+        FillTile(iter->second.placement);
+    }
+    tiles_.erase(iter);
+    return DCAMERA_OK;
+}
+
+int32_t DCameraTileCompositor::SubmitFrame(const std::string& tileId, const std::shared_ptr<DataBuffer>& frame,
+    int32_t width, int32_t height)
+{
+    CHECK_AND_RETURN_RET_LOG(frame == nullptr, DCAMERA_BAD_VALUE, "%{public}s", "Tile frame is null.");
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = tiles_.find(tileId);
+    CHECK_AND_RETURN_RET_LOG(iter == tiles_.end(), DCAMERA_NOT_FOUND, "%{public}s", "Tile not found.");
+    const DCameraTilePlacement& placement = iter->second.placement;
+    if (width != placement.width || height != placement.height || frame->Size() < GetFrameSize(width, height)) {
+        DHLOGE("Tile frame %{public}d x %{public}d size %{public}zu does not fit %{public}d x %{public}d.", width,
+            height, frame->Size(), placement.width, placement.height);
+        return DCAMERA_BAD_VALUE;
+    }
+    // Only the latest frame of a tile is drawn on the next tick.
+    iter->second.pending = frame;
+    return DCAMERA_OK;
+}
+
+int32_t DCameraTileCompositor::Compose(int64_t nowUs, std::shared_ptr<DataBuffer>& canvas)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    CHECK_AND_RETURN_RET_LOG(canvas_ == nullptr, DCAMERA_WRONG_STATE, "%{public}s", "Compositor is not inited.");
+    if (nextTickUs_ != 0 && nowUs < nextTickUs_) {
+        return DCAMERA_WRONG_STATE;
+    }
+    int64_t tickUs = (nextTickUs_ == 0) ? nowUs : nextTickUs_;
+    if (nowUs - tickUs >= frameIntervalUs_) {
+        // Missed ticks are skipped, the clock stays on its grid.
+        tickUs = nowUs - (nowUs - tickUs) % frameIntervalUs_;
+    }
+    nextTickUs_ = tickUs + frameIntervalUs_;
+
+    for (auto& iter : tiles_) {
+        TileState& tile = iter.second;
+        if (tile.pending != nullptr) {
+            DrawTile(tile.placement, tile.pending->Data());
+            tile.pending = nullptr;
+            tile.lastFrameUs = nowUs;
+            tile.isBlank = false;
+        } else if (!tile.isBlank && nowUs - tile.lastFrameUs >= STALE_TILE_US) {
+            FillTile(tile.placement);
+            tile.isBlank = true;
+        }
+    }
+    canvas_->SetInt64(DataBufferKey::TIME_STAMP_US, tickUs);
+    canvas = canvas_;
+    return DCAMERA_OK;
+}
+
+int64_t DCameraTileCompositor::GetNextTickUs()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return nextTickUs_;
+}
+
+DCameraTilePlacement DCameraTileCompositor::GetGridPlacement(int32_t index, int32_t count, int32_t canvasWidth,
+    int32_t canvasHeight)
+{
+    DCameraTilePlacement placement;
+    if (count <= 0 || index < 0 || index >= count) {
+        return placement;
+    }
+    int32_t columns = static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+    int32_t rows = (count + columns - 1) / columns;
+    placement.width = (canvasWidth / columns) / ALIGN_EVEN * ALIGN_EVEN;
+    placement.height = (canvasHeight / rows) / ALIGN_EVEN * ALIGN_EVEN;
+    placement.x = (index % columns) * placement.width;
+    placement.y = (index / columns) * placement.height;
+    return placement;
+}
+
+bool DCameraTileCompositor::IsInCanvas(const DCameraTilePlacement& placement) const
+{
+    return placement.x >= 0 && placement.y >= 0 && placement.width > 0 && placement.height > 0 &&
+        IsEven(placement.x) && IsEven(placement.y) && IsEven(placement.width) && IsEven(placement.height) &&
+        placement.width <= canvasWidth_ - placement.x && placement.height <= canvasHeight_ - placement.y;
+}
+
+void DCameraTileCompositor::DrawTile(const DCameraTilePlacement& placement, const uint8_t *frame)
+{
+    uint8_t *canvasY = canvas_->Data();
+    uint8_t *canvasUV = canvasY + static_cast<size_t>(canvasWidth_) * static_cast<size_t>(canvasHeight_);
+    const uint8_t *frameUV = frame + static_cast<size_t>(placement.width) * static_cast<size_t>(placement.height);
+    ImagePlaneKernels::CopyPlane(frame, placement.width,
+        canvasY + static_cast<size_t>(placement.y) * canvasWidth_ + placement.x, canvasWidth_,
+        placement.width, placement.height);
+    ImagePlaneKernels::CopyPlane(frameUV, placement.width,
+        canvasUV + static_cast<size_t>(placement.y / ALIGN_EVEN) * canvasWidth_ + placement.x, canvasWidth_,
+        placement.width, placement.height / ALIGN_EVEN);
+}
+
+void DCameraTileCompositor::FillTile(const DCameraTilePlacement& placement)
+{
+    uint8_t *canvasY = canvas_->Data();
+    uint8_t *canvasUV = canvasY + static_cast<size_t>(canvasWidth_) * static_cast<size_t>(canvasHeight_);
+    size_t rowSize = static_cast<size_t>(placement.width);
+    for (int32_t row = 0; row < placement.height; row++) {
+        uint8_t *dst = canvasY + static_cast<size_t>(placement.y + row) * canvasWidth_ + placement.x;
+        (void)memset_s(dst, rowSize, BLACK_LUMA, rowSize);
+    }
+    for (int32_t row = 0; row < placement.height / ALIGN_EVEN; row++) {
+        uint8_t *dst = canvasUV + static_cast<size_t>(placement.y / ALIGN_EVEN + row) * canvasWidth_ + placement.x;
+        (void)memset_s(dst, rowSize, BLACK_CHROMA, rowSize);
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -44,6 +44,16 @@ void VideoConfigParams::SetSystemSwitchFlagAndRotation(bool flag, int32_t rotati
     rotation_ = rotation;
 }
 
+void VideoConfigParams::SetColorSpace(VideoColorSpace colorSpace)
+{
+    colorSpace_ = colorSpace;
+}
+
+void VideoConfigParams::SetHdrType(VideoHdrType hdrType)
+{
+    hdrType_ = hdrType;
+}
+
 VideoCodecType VideoConfigParams::GetVideoCodecType() const
 {
     return videoCodec_;
@@ -82,5 +92,15 @@ bool VideoConfigParams::GetEis() const
 {
     return eis_;
 }
+
+VideoColorSpace VideoConfigParams::GetColorSpace() const
+{
+    return colorSpace_;
+}
+
+VideoHdrType VideoConfigParams::GetHdrType() const
+{
+    return hdrType_;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -0,0 +1,462 @@
+/*
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "image_plane_kernels.h"
+
+#include <algorithm>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DCAMERA_KERNEL_NEON
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define DCAMERA_KERNEL_X86
+#endif
+
+#include "securec.h"
+
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+using SplitUVRowFunc = void (*)(const uint8_t *srcUV, uint8_t *dstU, uint8_t *dstV, int32_t width);
+using MergeUVRowFunc = void (*)(const uint8_t *srcU, const uint8_t *srcV, uint8_t *dstUV, int32_t width);
+using SwapRowFunc = void (*)(uint8_t *rowA, uint8_t *rowB, size_t size);
+using MirrorRowFunc = void (*)(const uint8_t *src, uint8_t *dst, int32_t width);
+
+struct RowKernels {
+    const char *name;
+    SplitUVRowFunc splitUV;
+    MergeUVRowFunc mergeUV;
+    SwapRowFunc swap;
+    MirrorRowFunc mirror;
+};
+
+void SplitUVRowC(const uint8_t *srcUV, uint8_t *dstU, uint8_t *dstV, int32_t width)
+{
+    for (int32_t i = 0; i < width; i++) {
+        dstU[i] = srcUV[i * 2];
+        dstV[i] = srcUV[i * 2 + 1];
+    }
+}
+
+void MergeUVRowC(const uint8_t *srcU, const uint8_t *srcV, uint8_t *dstUV, int32_t width)
+{
+    for (int32_t i = 0; i < width; i++) {
+        dstUV[i * 2] = srcU[i];
+        dstUV[i * 2 + 1] = srcV[i];
+    }
+}
+
+void SwapRowC(uint8_t *rowA, uint8_t *rowB, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        std::swap(rowA[i], rowB[i]);
+    }
+}
+
+void MirrorRowC(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    for (int32_t i = 0; i < width; i++) {
+        dst[i] = src[width - 1 - i];
+    }
+}
+
+#if defined(DCAMERA_KERNEL_NEON)
+constexpr int32_t NEON_STEP = 16;
+
+void SplitUVRowNeon(const uint8_t *srcUV, uint8_t *dstU, uint8_t *dstV, int32_t width)
+{
+    int32_t i = 0;
+    for (; i + NEON_STEP <= width; i += NEON_STEP) {
+        uint8x16x2_t uv = vld2q_u8(srcUV + i * 2);
+        vst1q_u8(dstU + i, uv.val[0]);
+        vst1q_u8(dstV + i, uv.val[1]);
+    }
+    SplitUVRowC(srcUV + i * 2, dstU + i, dstV + i, width - i);
+}
+
+void MergeUVRowNeon(const uint8_t *srcU, const uint8_t *srcV, uint8_t *dstUV, int32_t width)
+{
+    int32_t i = 0;
+    for (; i + NEON_STEP <= width; i += NEON_STEP) {
+        uint8x16x2_t uv;
+        uv.val[0] = vld1q_u8(srcU + i);
+        uv.val[1] = vld1q_u8(srcV + i);
+        vst2q_u8(dstUV + i * 2, uv);
+    }
+    MergeUVRowC(srcU + i, srcV + i, dstUV + i * 2, width - i);
+}
+
+void SwapRowNeon(uint8_t *rowA, uint8_t *rowB, size_t size)
+{
+    size_t i = 0;
+    for (; i + NEON_STEP <= size; i += NEON_STEP) {
+        uint8x16_t a = vld1q_u8(rowA + i);
+        uint8x16_t b = vld1q_u8(rowB + i);
+        vst1q_u8(rowA + i, b);
+        vst1q_u8(rowB + i, a);
+    }
+    SwapRowC(rowA + i, rowB + i, size - i);
+}
+
+void MirrorRowNeon(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    int32_t i = 0;
+    for (; i + NEON_STEP <= width; i += NEON_STEP) {
+        uint8x16_t v = vrev64q_u8(vld1q_u8(src + width - NEON_STEP - i));
+        vst1q_u8(dst + i, vcombine_u8(vget_high_u8(v), vget_low_u8(v)));
+    }
+    MirrorRowC(src, dst + i, width - i);
+}
+
+const RowKernels NEON_KERNELS = { "neon", SplitUVRowNeon, MergeUVRowNeon, SwapRowNeon, MirrorRowNeon };
+#endif
+
+#if defined(DCAMERA_KERNEL_X86)
+constexpr int32_t SSE2_STEP = 16;
+constexpr int32_t AVX2_STEP = 32;
+constexpr int32_t BYTE_BITS = 8;
+constexpr int32_t WORD_REVERSE = 0x1B;
+constexpr int32_t QWORD_SWAP = 0x4E;
+constexpr int32_t QWORD_ORDER_0213 = 0xD8;
+constexpr int32_t LANE_LOW = 0x20;
+constexpr int32_t LANE_HIGH = 0x31;
+
+__attribute__((target("sse2"))) void SplitUVRowSse2(const uint8_t *srcUV, uint8_t *dstU, uint8_t *dstV,
+    int32_t width)
+{
+    const __m128i lowMask = _mm_set1_epi16(0x00FF);
+    int32_t i = 0;
+    for (; i + SSE2_STEP <= width; i += SSE2_STEP) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcUV + i * 2));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcUV + i * 2 + SSE2_STEP));
+        __m128i u = _mm_packus_epi16(_mm_and_si128(a, lowMask), _mm_and_si128(b, lowMask));
+        __m128i v = _mm_packus_epi16(_mm_srli_epi16(a, BYTE_BITS), _mm_srli_epi16(b, BYTE_BITS));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstU + i), u);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstV + i), v);
+    }
+    SplitUVRowC(srcUV + i * 2, dstU + i, dstV + i, width - i);
+}
+
+__attribute__((target("sse2"))) void MergeUVRowSse2(const uint8_t *srcU, const uint8_t *srcV, uint8_t *dstUV,
+    int32_t width)
+{
+    int32_t i = 0;
+    for (; i + SSE2_STEP <= width; i += SSE2_STEP) {
+        __m128i u = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcU + i));
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcV + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstUV + i * 2), _mm_unpacklo_epi8(u, v));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstUV + i * 2 + SSE2_STEP), _mm_unpackhi_epi8(u, v));
+    }
+    MergeUVRowC(srcU + i, srcV + i, dstUV + i * 2, width - i);
+}
+
+__attribute__((target("sse2"))) void SwapRowSse2(uint8_t *rowA, uint8_t *rowB, size_t size)
+{
+    size_t i = 0;
+    for (; i + SSE2_STEP <= size; i += SSE2_STEP) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rowA + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rowB + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(rowA + i), b);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(rowB + i), a);
+    }
+    SwapRowC(rowA + i, rowB + i, size - i);
+}
+
+__attribute__((target("sse2"))) void MirrorRowSse2(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    int32_t i = 0;
+    for (; i + SSE2_STEP <= width; i += SSE2_STEP) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + width - SSE2_STEP - i));
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, WORD_REVERSE), WORD_REVERSE);
+        v = _mm_shuffle_epi32(v, QWORD_SWAP);
+        v = _mm_or_si128(_mm_slli_epi16(v, BYTE_BITS), _mm_srli_epi16(v, BYTE_BITS));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), v);
+    }
+    MirrorRowC(src, dst + i, width - i);
+}
+
+__attribute__((target("avx2"))) void SplitUVRowAvx2(const uint8_t *srcUV, uint8_t *dstU, uint8_t *dstV,
+    int32_t width)
+{
+    const __m256i lowMask = _mm256_set1_epi16(0x00FF);
+    int32_t i = 0;
+    for (; i + AVX2_STEP <= width; i += AVX2_STEP) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcUV + i * 2));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcUV + i * 2 + AVX2_STEP));
+        __m256i u = _mm256_packus_epi16(_mm256_and_si256(a, lowMask), _mm256_and_si256(b, lowMask));
+        __m256i v = _mm256_packus_epi16(_mm256_srli_epi16(a, BYTE_BITS), _mm256_srli_epi16(b, BYTE_BITS));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstU + i), _mm256_permute4x64_epi64(u, QWORD_ORDER_0213));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstV + i), _mm256_permute4x64_epi64(v, QWORD_ORDER_0213));
+    }
+    SplitUVRowSse2(srcUV + i * 2, dstU + i, dstV + i, width - i);
+}
+
+__attribute__((target("avx2"))) void MergeUVRowAvx2(const uint8_t *srcU, const uint8_t *srcV, uint8_t *dstUV,
+    int32_t width)
+{
+    int32_t i = 0;
+    for (; i + AVX2_STEP <= width; i += AVX2_STEP) {
+        __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcU + i));
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcV + i));
+        __m256i low = _mm256_unpacklo_epi8(u, v);
+        __m256i high = _mm256_unpackhi_epi8(u, v);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstUV + i * 2), _mm256_permute2x128_si256(low, high,
+            LANE_LOW));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstUV + i * 2 + AVX2_STEP),
+            _mm256_permute2x128_si256(low, high, LANE_HIGH));
+    }
+    MergeUVRowSse2(srcU + i, srcV + i, dstUV + i * 2, width - i);
+}
+
+__attribute__((target("avx2"))) void SwapRowAvx2(uint8_t *rowA, uint8_t *rowB, size_t size)
+{
+    size_t i = 0;
+    for (; i + AVX2_STEP <= size; i += AVX2_STEP) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rowA + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rowB + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(rowA + i), b);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(rowB + i), a);
+    }
+    SwapRowSse2(rowA + i, rowB + i, size - i);
+}
+
+const RowKernels SSE2_KERNELS = { "sse2", SplitUVRowSse2, MergeUVRowSse2, SwapRowSse2, MirrorRowSse2 };
+const RowKernels AVX2_KERNELS = { "avx2", SplitUVRowAvx2, MergeUVRowAvx2, SwapRowAvx2, MirrorRowSse2 };
+#endif
+
+const RowKernels SCALAR_KERNELS = { "c", SplitUVRowC, MergeUVRowC, SwapRowC, MirrorRowC };
+
+const RowKernels &SelectRowKernels()
+{
+#if defined(DCAMERA_KERNEL_NEON)
+    return NEON_KERNELS;
+#elif defined(DCAMERA_KERNEL_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return AVX2_KERNELS;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SSE2_KERNELS;
+    }
+    return SCALAR_KERNELS;
+#else
+    return SCALAR_KERNELS;
+#endif
+}
+
+const RowKernels &GetRowKernels()
+{
+    static const RowKernels &kernels = SelectRowKernels();
+    return kernels;
+}
+
+bool IsValidPlane(const void *plane, int32_t stride, int32_t width)
+{
+    return plane != nullptr && width > 0 && stride >= width;
+}
+}
+
+void ImagePlaneKernels::CopyPlane(const uint8_t *src, int32_t srcStride, uint8_t *dst, int32_t dstStride,
+    int32_t width, int32_t height)
+{
+    if (!IsValidPlane(src, srcStride, width) || !IsValidPlane(dst, dstStride, width) || height <= 0) {
+        return;
+    }
+    if (srcStride == width && dstStride == width) {
+        size_t planeSize = static_cast<size_t>(width) * static_cast<size_t>(height);
+        (void)memcpy_s(dst, planeSize, src, planeSize);
+        return;
+    }
+    for (int32_t y = 0; y < height; y++) {
+        (void)memcpy_s(dst + static_cast<size_t>(y) * dstStride, width, src + static_cast<size_t>(y) * srcStride,
+            width);
+    }
+}
+
+void ImagePlaneKernels::SplitUVPlane(const uint8_t *srcUV, int32_t srcStrideUV, uint8_t *dstU, int32_t dstStrideU,
+    uint8_t *dstV, int32_t dstStrideV, int32_t width, int32_t height)
+{
+    if (!IsValidPlane(srcUV, srcStrideUV, width * 2) || !IsValidPlane(dstU, dstStrideU, width) ||
+        !IsValidPlane(dstV, dstStrideV, width) || height <= 0) {
+        return;
+    }
+    SplitUVRowFunc splitUV = GetRowKernels().splitUV;
+    for (int32_t y = 0; y < height; y++) {
+        splitUV(srcUV + static_cast<size_t>(y) * srcStrideUV, dstU + static_cast<size_t>(y) * dstStrideU,
+            dstV + static_cast<size_t>(y) * dstStrideV, width);
+    }
+}
+
+void ImagePlaneKernels::MergeUVPlane(const uint8_t *srcU, int32_t srcStrideU, const uint8_t *srcV,
+    int32_t srcStrideV, uint8_t *dstUV, int32_t dstStrideUV, int32_t width, int32_t height)
+{
+    if (!IsValidPlane(srcU, srcStrideU, width) || !IsValidPlane(srcV, srcStrideV, width) ||
+        !IsValidPlane(dstUV, dstStrideUV, width * 2) || height <= 0) {
+        return;
+    }
+    MergeUVRowFunc mergeUV = GetRowKernels().mergeUV;
+    for (int32_t y = 0; y < height; y++) {
+        mergeUV(srcU + static_cast<size_t>(y) * srcStrideU, srcV + static_cast<size_t>(y) * srcStrideV,
+            dstUV + static_cast<size_t>(y) * dstStrideUV, width);
+    }
+}
+
+void ImagePlaneKernels::SwapPlanes(uint8_t *planeA, uint8_t *planeB, size_t size)
+{
+    if (planeA == nullptr || planeB == nullptr || planeA == planeB) {
+        return;
+    }
+    GetRowKernels().swap(planeA, planeB, size);
+}
+
+int32_t ImagePlaneKernels::RotatePlane(const uint8_t *src, int32_t srcStride, uint8_t *dst, int32_t dstStride,
+    int32_t width, int32_t height, int32_t degrees)
+{
+    if (!IsValidPlane(src, srcStride, width) || dst == nullptr || height <= 0 || src == dst) {
+        return DCAMERA_BAD_VALUE;
+    }
+    switch (degrees) {
+        case ROTATION_0:
+            CHECK_AND_RETURN_RET_LOG(dstStride < width, DCAMERA_BAD_VALUE, "dst stride is too small.");
+            CopyPlane(src, srcStride, dst, dstStride, width, height);
+            return DCAMERA_OK;
+        case ROTATION_180: {
+            CHECK_AND_RETURN_RET_LOG(dstStride < width, DCAMERA_BAD_VALUE, "dst stride is too small.");
+            MirrorRowFunc mirror = GetRowKernels().mirror;
+            for (int32_t y = 0; y < height; y++) {
+                mirror(src + static_cast<size_t>(y) * srcStride,
+                    dst + static_cast<size_t>(height - 1 - y) * dstStride, width);
+            }
+            return DCAMERA_OK;
+        }
+        case ROTATION_90:
+        case ROTATION_270:
+            CHECK_AND_RETURN_RET_LOG(dstStride < height, DCAMERA_BAD_VALUE, "dst stride is too small.");
+            TransposePlane(src, srcStride, dst, dstStride, width, height, degrees == ROTATION_90);
+            return DCAMERA_OK;
+        default:
+            DHLOGE("Unsupported rotation %{public}d.", degrees);
+            return DCAMERA_BAD_VALUE;
+    }
+}
+
+void ImagePlaneKernels::TransposePlane(const uint8_t *src, int32_t srcStride, uint8_t *dst, int32_t dstStride,
+    int32_t width, int32_t height, bool clockwise)
+{
+    // Square tiles keep both the source rows and the destination rows in cache.
+    for (int32_t tileY = 0; tileY < height; tileY += TRANSPOSE_TILE) {
+        int32_t rows = std::min(TRANSPOSE_TILE, height - tileY);
+        for (int32_t tileX = 0; tileX < width; tileX += TRANSPOSE_TILE) {
+            int32_t cols = std::min(TRANSPOSE_TILE, width - tileX);
+            for (int32_t y = tileY; y < tileY + rows; y++) {
+                const uint8_t *srcRow = src + static_cast<size_t>(y) * srcStride;
+                int32_t dstCol = clockwise ? (height - 1 - y) : y;
+                for (int32_t x = tileX; x < tileX + cols; x++) {
+                    int32_t dstRow = clockwise ? x : (width - 1 - x);
+                    dst[static_cast<size_t>(dstRow) * dstStride + dstCol] = srcRow[x];
+                }
+            }
+        }
+    }
+}
+
+int32_t ImagePlaneKernels::NV12ToI420(const uint8_t *srcY, int32_t srcStrideY, const uint8_t *srcUV,
+    int32_t srcStrideUV, uint8_t *dstY, int32_t dstStrideY, uint8_t *dstU, int32_t dstStrideU, uint8_t *dstV,
+    int32_t dstStrideV, int32_t width, int32_t height)
+{
+    int32_t halfWidth = (width + 1) / 2;
+    int32_t halfHeight = (height + 1) / 2;
+    if (!IsValidPlane(srcY, srcStrideY, width) || !IsValidPlane(dstY, dstStrideY, width) ||
+        !IsValidPlane(srcUV, srcStrideUV, halfWidth * 2) || !IsValidPlane(dstU, dstStrideU, halfWidth) ||
+        !IsValidPlane(dstV, dstStrideV, halfWidth) || height <= 0) {
+        return DCAMERA_BAD_VALUE;
+    }
+    CopyPlane(srcY, srcStrideY, dstY, dstStrideY, width, height);
+    SplitUVPlane(srcUV, srcStrideUV, dstU, dstStrideU, dstV, dstStrideV, halfWidth, halfHeight);
+    return DCAMERA_OK;
+}
+
+int32_t ImagePlaneKernels::CropYUV420(const uint8_t *src, int32_t srcWidth, int32_t srcHeight, uint8_t *dst,
+    int32_t dstWidth, int32_t dstHeight, int32_t offsetX, int32_t offsetY, bool isSemiPlanar)
+{
+    if (src == nullptr || dst == nullptr || dstWidth <= 0 || dstHeight <= 0 || offsetX < 0 || offsetY < 0 ||
+        offsetX > srcWidth - dstWidth || offsetY > srcHeight - dstHeight) {
+        return DCAMERA_BAD_VALUE;
+    }
+    const uint8_t *srcChroma = src + static_cast<size_t>(srcWidth) * srcHeight;
+    uint8_t *dstChroma = dst + static_cast<size_t>(dstWidth) * dstHeight;
+    CopyPlane(src + static_cast<size_t>(offsetY) * srcWidth + offsetX, srcWidth, dst, dstWidth, dstWidth, dstHeight);
+    int32_t srcRowsUV = srcHeight / 2;
+    int32_t dstRowsUV = dstHeight / 2;
+    size_t srcOffsetUV = static_cast<size_t>(offsetY / 2) * (srcWidth / 2) + offsetX / 2;
+    if (isSemiPlanar) {
+        // Interleaved chroma rows are as wide in bytes as the luma rows.
+        CopyPlane(srcChroma + srcOffsetUV * 2, srcWidth / 2 * 2, dstChroma, dstWidth / 2 * 2, dstWidth / 2 * 2,
+            dstRowsUV);
+        return DCAMERA_OK;
+    }
+    size_t srcSizeUV = static_cast<size_t>(srcWidth / 2) * srcRowsUV;
+    size_t dstSizeUV = static_cast<size_t>(dstWidth / 2) * dstRowsUV;
+    CopyPlane(srcChroma + srcOffsetUV, srcWidth / 2, dstChroma, dstWidth / 2, dstWidth / 2, dstRowsUV);
+    CopyPlane(srcChroma + srcSizeUV + srcOffsetUV, srcWidth / 2, dstChroma + dstSizeUV, dstWidth / 2, dstWidth / 2,
+        dstRowsUV);
+    return DCAMERA_OK;
+}
+
+int32_t ImagePlaneKernels::RemapPlane(const uint8_t *src, int32_t srcStride, int32_t srcPixelStride, uint8_t *dst,
+    int32_t dstStride, int32_t dstPixelStride, const int32_t *colMap, int32_t width, const int32_t *rowMap,
+    int32_t height, bool isTransposed, uint8_t fillValue)
+{
+    if (src == nullptr || srcStride <= 0 || srcPixelStride <= 0 || dst == nullptr || dstPixelStride <= 0 ||
+        colMap == nullptr || rowMap == nullptr || width <= 0 || height <= 0 ||
+        dstStride < static_cast<int64_t>(width - 1) * dstPixelStride + 1) {
+        return DCAMERA_BAD_VALUE;
+    }
+    if (!isTransposed) {
+        for (int32_t y = 0; y < height; y++) {
+            const uint8_t *srcRow = (rowMap[y] < 0) ? nullptr : src + static_cast<size_t>(rowMap[y]) * srcStride;
+            uint8_t *dstRow = dst + static_cast<size_t>(y) * dstStride;
+            for (int32_t x = 0; x < width; x++) {
+                dstRow[static_cast<size_t>(x) * dstPixelStride] = (srcRow == nullptr || colMap[x] < 0) ?
+                    fillValue : srcRow[static_cast<size_t>(colMap[x]) * srcPixelStride];
+            }
+        }
+        return DCAMERA_OK;
+    }
+    // A band of destination rows reads short runs of each source row, like the tiles of TransposePlane.
+    for (int32_t tileY = 0; tileY < height; tileY += TRANSPOSE_TILE) {
+        int32_t rows = std::min(TRANSPOSE_TILE, height - tileY);
+        for (int32_t x = 0; x < width; x++) {
+            const uint8_t *srcRow = (colMap[x] < 0) ? nullptr : src + static_cast<size_t>(colMap[x]) * srcStride;
+            uint8_t *dstCol = dst + static_cast<size_t>(x) * dstPixelStride;
+            for (int32_t y = tileY; y < tileY + rows; y++) {
+                dstCol[static_cast<size_t>(y) * dstStride] = (srcRow == nullptr || rowMap[y] < 0) ?
+                    fillValue : srcRow[static_cast<size_t>(rowMap[y]) * srcPixelStride];
+            }
+        }
+    }
+    return DCAMERA_OK;
+}
+
+const char *ImagePlaneKernels::GetIsaName()
+{
+    return GetRowKernels().name;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -33,5 +33,10 @@ int32_t PropertyCarrier::CarrySurfaceProperty(sptr<Surface>& surface)
     DHLOGD("PropertyCarrier::CarrySurfaceProperty: carry surface success.");
     return DCAMERA_OK;
 }
+
+void PropertyCarrier::CarryNodeStats(const DCameraNodeStatsInfo& info)
+{
+    nodeStats_.push_back(info);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
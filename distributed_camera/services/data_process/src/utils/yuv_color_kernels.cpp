@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "yuv_color_kernels.h"
+
+#include <cmath>
+
+#include "distributed_camera_errno.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t FIX_SHIFT = 16;
+constexpr int32_t FIX_ROUND = 1 << (FIX_SHIFT - 1);
+constexpr int32_t FIX_MAX = 255 << FIX_SHIFT;
+constexpr double FIX_ONE = 65536.0;
+constexpr int32_t CHROMA_ZERO = 128;
+constexpr int32_t LIMITED_LUMA_BLACK = 16;
+constexpr double LIMITED_LUMA_RANGE = 219.0;
+constexpr double LIMITED_CHROMA_RANGE = 224.0;
+constexpr double FULL_RANGE = 255.0;
+constexpr int32_t RGBA_BYTES = 4;
+constexpr int32_t P010_BYTES = 2;
+constexpr int32_t P010_HIGH_SHIFT = 2;
+constexpr int32_t P010_LOW_SHIFT = 6;
+constexpr int32_t BYTE_BITS = 8;
+constexpr uint8_t ALPHA_OPAQUE = 0xFF;
+constexpr size_t COLOR_SPACE_COUNT = 4;
+
+struct ColorSpaceCoefficients {
+    double kr;
+    double kb;
+    bool isFullRange;
+};
+
+// Indexed by VideoColorSpace.
+constexpr ColorSpaceCoefficients COLOR_SPACES[COLOR_SPACE_COUNT] = {
+    { 0.299, 0.114, false },
+    { 0.299, 0.114, true },
+    { 0.2126, 0.0722, false },
+    { 0.2126, 0.0722, true },
+};
+
+int32_t ToFixed(double value)
+{
+    return static_cast<int32_t>(std::lround(value * FIX_ONE));
+}
+
+YuvToRgbTable BuildYuvToRgbTable(const ColorSpaceCoefficients &coef)
+{
+    YuvToRgbTable table = {};
+    double kg = 1.0 - coef.kr - coef.kb;
+    double lumaScale = coef.isFullRange ? 1.0 : FULL_RANGE / LIMITED_LUMA_RANGE;
+    double chromaScale = coef.isFullRange ? 1.0 : FULL_RANGE / LIMITED_CHROMA_RANGE;
+    int32_t lumaBlack = coef.isFullRange ? 0 : LIMITED_LUMA_BLACK;
+    for (size_t i = 0; i < YUV_TABLE_SIZE; i++) {
+        double luma = (static_cast<int32_t>(i) - lumaBlack) * lumaScale;
+        double chroma = (static_cast<int32_t>(i) - CHROMA_ZERO) * chromaScale;
+        table.y[i] = ToFixed(luma) + FIX_ROUND;
+        table.rv[i] = ToFixed(2.0 * (1.0 - coef.kr) * chroma);
+        table.gu[i] = ToFixed(-2.0 * coef.kb * (1.0 - coef.kb) / kg * chroma);
+        table.gv[i] = ToFixed(-2.0 * coef.kr * (1.0 - coef.kr) / kg * chroma);
+        table.bu[i] = ToFixed(2.0 * (1.0 - coef.kb) * chroma);
+    }
+    return table;
+}
+
+struct P010Table {
+    uint16_t value[YUV_TABLE_SIZE];
+};
+
+P010Table BuildP010Table()
+{
+    P010Table table = {};
+    for (size_t i = 0; i < YUV_TABLE_SIZE; i++) {
+        // Replicating the top bits maps 255 onto the ten bit white.
+        uint32_t tenBits = (static_cast<uint32_t>(i) << P010_HIGH_SHIFT) | (static_cast<uint32_t>(i) >> P010_LOW_SHIFT);
+        table.value[i] = static_cast<uint16_t>(tenBits << P010_LOW_SHIFT);
+    }
+    return table;
+}
+
+const P010Table &GetP010Table()
+{
+    static const P010Table table = BuildP010Table();
+    return table;
+}
+
+inline uint8_t ClampFixed(int32_t value)
+{
+    if (value <= 0) {
+        return 0;
+    }
+    if (value >= FIX_MAX) {
+        return UINT8_MAX;
+    }
+    return static_cast<uint8_t>(value >> FIX_SHIFT);
+}
+
+inline void StorePixel(uint8_t *dst, int32_t luma, int32_t r, int32_t g, int32_t b)
+{
+    dst[0] = ClampFixed(luma + r);
+    dst[1] = ClampFixed(luma + g);
+    dst[2] = ClampFixed(luma + b); // 2: blue
+    dst[3] = ALPHA_OPAQUE; // 3: alpha
+}
+
+// uvStep is the distance in bytes between two chroma samples of a plane, 1 planar and 2 interleaved.
+void YuvRowToRGBA(const uint8_t *srcY, const uint8_t *srcU, const uint8_t *srcV, int32_t uvStep, uint8_t *dst,
+    int32_t width, const YuvToRgbTable &table)
+{
+    for (int32_t x = 0; x < width; x += 2) {
+        size_t uvIndex = static_cast<size_t>(x / 2) * uvStep;
+        uint8_t u = srcU[uvIndex];
+        uint8_t v = srcV[uvIndex];
+        int32_t r = table.rv[v];
+        int32_t g = table.gu[u] + table.gv[v];
+        int32_t b = table.bu[u];
+        StorePixel(dst + static_cast<size_t>(x) * RGBA_BYTES, table.y[srcY[x]], r, g, b);
+        if (x + 1 < width) {
+            StorePixel(dst + static_cast<size_t>(x + 1) * RGBA_BYTES, table.y[srcY[x + 1]], r, g, b);
+        }
+    }
+}
+
+inline void StoreP010(uint8_t *dst, uint16_t value)
+{
+    dst[0] = static_cast<uint8_t>(value & UINT8_MAX);
+    dst[1] = static_cast<uint8_t>(value >> BYTE_BITS);
+}
+
+bool IsValidPlane(const void *plane, int32_t stride, int32_t rowBytes)
+{
+    return plane != nullptr && rowBytes > 0 && stride >= rowBytes;
+}
+}
+
+const YuvToRgbTable &YuvColorKernels::GetYuvToRgbTable(VideoColorSpace colorSpace)
+{
+    static const YuvToRgbTable tables[COLOR_SPACE_COUNT] = {
+        BuildYuvToRgbTable(COLOR_SPACES[0]),
+        BuildYuvToRgbTable(COLOR_SPACES[1]),
+        BuildYuvToRgbTable(COLOR_SPACES[2]), // 2: bt709 limited
+        BuildYuvToRgbTable(COLOR_SPACES[3]), // 3: bt709 full
+    };
+    size_t index = static_cast<size_t>(colorSpace);
+    return index < COLOR_SPACE_COUNT ? tables[index] : tables[0];
+}
+
+int32_t YuvColorKernels::I420ToRGBA(const uint8_t *srcY, int32_t srcStrideY, const uint8_t *srcU,
+    int32_t srcStrideU, const uint8_t *srcV, int32_t srcStrideV, uint8_t *dstRGBA, int32_t dstStrideRGBA,
+    int32_t width, int32_t height, const YuvToRgbTable &table)
+{
+    int32_t halfWidth = (width + 1) / 2;
+    if (!IsValidPlane(srcY, srcStrideY, width) || !IsValidPlane(srcU, srcStrideU, halfWidth) ||
+        !IsValidPlane(srcV, srcStrideV, halfWidth) || !IsValidPlane(dstRGBA, dstStrideRGBA, width * RGBA_BYTES) ||
+        height <= 0) {
+        return DCAMERA_BAD_VALUE;
+    }
+    for (int32_t y = 0; y < height; y++) {
+        size_t uvRow = static_cast<size_t>(y / 2);
+        YuvRowToRGBA(srcY + static_cast<size_t>(y) * srcStrideY, srcU + uvRow * srcStrideU,
+            srcV + uvRow * srcStrideV, 1, dstRGBA + static_cast<size_t>(y) * dstStrideRGBA, width, table);
+    }
+    return DCAMERA_OK;
+}
+
+int32_t YuvColorKernels::NV12ToRGBA(const uint8_t *srcY, int32_t srcStrideY, const uint8_t *srcUV,
+    int32_t srcStrideUV, uint8_t *dstRGBA, int32_t dstStrideRGBA, int32_t width, int32_t height,
+    const YuvToRgbTable &table, bool isVUOrder)
+{
+    int32_t halfWidth = (width + 1) / 2;
+    if (!IsValidPlane(srcY, srcStrideY, width) || !IsValidPlane(srcUV, srcStrideUV, halfWidth * 2) ||
+        !IsValidPlane(dstRGBA, dstStrideRGBA, width * RGBA_BYTES) || height <= 0) {
+        return DCAMERA_BAD_VALUE;
+    }
+    for (int32_t y = 0; y < height; y++) {
+        const uint8_t *rowUV = srcUV + static_cast<size_t>(y / 2) * srcStrideUV;
+        const uint8_t *rowU = isVUOrder ? rowUV + 1 : rowUV;
+        const uint8_t *rowV = isVUOrder ? rowUV : rowUV + 1;
+        YuvRowToRGBA(srcY + static_cast<size_t>(y) * srcStrideY, rowU, rowV, 2, // 2: interleaved chroma
+            dstRGBA + static_cast<size_t>(y) * dstStrideRGBA, width, table);
+    }
+    return DCAMERA_OK;
+}
+
+int32_t YuvColorKernels::I420ToP010(const uint8_t *srcY, int32_t srcStrideY, const uint8_t *srcU,
+    int32_t srcStrideU, const uint8_t *srcV, int32_t srcStrideV, uint8_t *dstY, int32_t dstStrideY,
+    uint8_t *dstUV, int32_t dstStrideUV, int32_t width, int32_t height)
+{
+    int32_t halfWidth = (width + 1) / 2;
+    int32_t halfHeight = (height + 1) / 2;
+    if (!IsValidPlane(srcY, srcStrideY, width) || !IsValidPlane(srcU, srcStrideU, halfWidth) ||
+        !IsValidPlane(srcV, srcStrideV, halfWidth) || !IsValidPlane(dstY, dstStrideY, width * P010_BYTES) ||
+        !IsValidPlane(dstUV, dstStrideUV, halfWidth * 2 * P010_BYTES) || height <= 0) {
+        return DCAMERA_BAD_VALUE;
+    }
+    const P010Table &table = GetP010Table();
+    for (int32_t y = 0; y < height; y++) {
+        const uint8_t *srcRow = srcY + static_cast<size_t>(y) * srcStrideY;
+        uint8_t *dstRow = dstY + static_cast<size_t>(y) * dstStrideY;
+        for (int32_t x = 0; x < width; x++) {
+            StoreP010(dstRow + static_cast<size_t>(x) * P010_BYTES, table.value[srcRow[x]]);
+        }
+    }
+    for (int32_t y = 0; y < halfHeight; y++) {
+        const uint8_t *rowU = srcU + static_cast<size_t>(y) * srcStrideU;
+        const uint8_t *rowV = srcV + static_cast<size_t>(y) * srcStrideV;
+        uint8_t *dstRow = dstUV + static_cast<size_t>(y) * dstStrideUV;
+        for (int32_t x = 0; x < halfWidth; x++) {
+            StoreP010(dstRow + static_cast<size_t>(x) * 2 * P010_BYTES, table.value[rowU[x]]);
+            StoreP010(dstRow + static_cast<size_t>(x) * 2 * P010_BYTES + P010_BYTES, table.value[rowV[x]]);
+        }
+    }
+    return DCAMERA_OK;
+}
+
+int32_t YuvColorKernels::SwapUVOrder(const uint8_t *srcUV, int32_t srcStrideUV, uint8_t *dstUV,
+    int32_t dstStrideUV, int32_t width, int32_t height)
+{
+    int32_t halfWidth = (width + 1) / 2;
+    int32_t halfHeight = (height + 1) / 2;
+    if (!IsValidPlane(srcUV, srcStrideUV, halfWidth * 2) || !IsValidPlane(dstUV, dstStrideUV, halfWidth * 2) ||
+        height <= 0) {
+        return DCAMERA_BAD_VALUE;
+    }
+    for (int32_t y = 0; y < halfHeight; y++) {
+        const uint8_t *srcRow = srcUV + static_cast<size_t>(y) * srcStrideUV;
+        uint8_t *dstRow = dstUV + static_cast<size_t>(y) * dstStrideUV;
+        for (int32_t x = 0; x < halfWidth * 2; x += 2) {
+            // Read both before writing, the conversion may run in place.
+            uint8_t first = srcRow[x];
+            uint8_t second = srcRow[x + 1];
+            dstRow[x] = second;
+            dstRow[x + 1] = first;
+        }
+    }
+    return DCAMERA_OK;
+}
+
+int32_t YuvColorKernels::SwapP010UVOrder(const uint8_t *srcUV, int32_t srcStrideUV, uint8_t *dstUV,
+    int32_t dstStrideUV, int32_t width, int32_t height)
+{
+    int32_t halfWidth = (width + 1) / 2;
+    int32_t halfHeight = (height + 1) / 2;
+    int32_t rowBytes = halfWidth * 2 * P010_BYTES;
+    if (!IsValidPlane(srcUV, srcStrideUV, rowBytes) || !IsValidPlane(dstUV, dstStrideUV, rowBytes) || height <= 0) {
+        return DCAMERA_BAD_VALUE;
+    }
+    for (int32_t y = 0; y < halfHeight; y++) {
+        const uint8_t *srcRow = srcUV + static_cast<size_t>(y) * srcStrideUV;
+        uint8_t *dstRow = dstUV + static_cast<size_t>(y) * dstStrideUV;
+        for (int32_t x = 0; x < rowBytes; x += 2 * P010_BYTES) {
+            uint8_t firstLow = srcRow[x];
+            uint8_t firstHigh = srcRow[x + 1];
+            uint8_t secondLow = srcRow[x + P010_BYTES];
+            uint8_t secondHigh = srcRow[x + P010_BYTES + 1];
+            dstRow[x] = secondLow;
+            dstRow[x + 1] = secondHigh;
+            dstRow[x + P010_BYTES] = firstLow;
+            dstRow[x + P010_BYTES + 1] = firstHigh;
+        }
+    }
+    return DCAMERA_OK;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 
+#include "dcamera_node_stats.h"
 #include "dcamera_pipeline_source.h"
 #include "distributed_camera_constants.h"
 #include "distributed_camera_errno.h"
@@ -40,6 +41,8 @@ const int32_t TEST_WIDTH = 1920;
 const int32_t TEST_HEIGTH = 1080;
 const int32_t TEST_WIDTH2 = 640;
 const int32_t TEST_HEIGTH2 = 480;
+const int32_t TEST_WIDTH3 = 1280;
+const int32_t TEST_HEIGTH3 = 720;
 const int32_t SLEEP_TIME = 200000;
 }
 
@@ -288,5 +291,108 @@ HWTEST_F(DCameraPipelineSourceTest, dcamera_pipeline_source_test_009, TestSize.L
     rc = testSourcePipeline_->UpdateSettings(metaData);
     EXPECT_EQ(rc, DCAMERA_OK);
 }
+
+/**
+ * @tc.name: dcamera_pipeline_source_test_010
+ * @tc.desc: Verify branch pipelines attach to the decoded config of their owner.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraPipelineSourceTest, dcamera_pipeline_source_test_010, TestSize.Level1)
+{
+    std::shared_ptr<DataProcessListener> listener = std::make_shared<MockDCameraDataProcessListener>();
+    VideoConfigParams srcParams(VideoCodecType::NO_CODEC, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        TEST_WIDTH, TEST_HEIGTH);
+    VideoConfigParams decodedConfig;
+    EXPECT_NE(DCAMERA_OK, testPipelineSource_->GetDecodedConfig(decodedConfig));
+    int32_t rc = testPipelineSource_->CreateDataProcessPipeline(PipelineType::VIDEO, srcParams, srcParams, listener);
+    EXPECT_EQ(DCAMERA_OK, rc);
+    EXPECT_EQ(DCAMERA_OK, testPipelineSource_->GetDecodedConfig(decodedConfig));
+    EXPECT_EQ(TEST_WIDTH, decodedConfig.GetWidth());
+    EXPECT_EQ(TEST_HEIGTH, decodedConfig.GetHeight());
+
+    std::shared_ptr<DCameraPipelineSource> branch = std::make_shared<DCameraPipelineSource>();
+    VideoConfigParams destParams(VideoCodecType::NO_CODEC, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        TEST_WIDTH2, TEST_HEIGTH2);
+    rc = branch->CreateDataProcessPipeline(PipelineType::VIDEO, decodedConfig, destParams, listener);
+    EXPECT_EQ(DCAMERA_OK, rc);
+    testPipelineSource_->AddBranch(branch);
+    testPipelineSource_->AddBranch(testPipelineSource_);
+    size_t capacity = 16;
+    std::shared_ptr<DataBuffer> buffer = testPipelineSource_->AcquireOutputBuffer(capacity);
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(capacity, buffer->Capacity());
+    testPipelineSource_->RemoveBranch(branch);
+    branch->DestroyDataProcessPipeline();
+    testPipelineSource_->OnDecodedVideoBuffer(buffer);
+    testPipelineSource_->DestroyDataProcessPipeline();
+    EXPECT_NE(DCAMERA_OK, testPipelineSource_->GetDecodedConfig(decodedConfig));
+}
+
+/**
+ * @tc.name: dcamera_pipeline_source_test_011
+ * @tc.desc: Verify the node counters are reported through PIPELINE_STATS and the stats registry.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraPipelineSourceTest, dcamera_pipeline_source_test_011, TestSize.Level1)
+{
+    std::shared_ptr<DataProcessListener> listener = std::make_shared<MockDCameraDataProcessListener>();
+    VideoConfigParams srcParams(VideoCodecType::NO_CODEC, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        TEST_WIDTH, TEST_HEIGTH);
+    int32_t rc = testPipelineSource_->CreateDataProcessPipeline(PipelineType::VIDEO, srcParams, srcParams, listener);
+    EXPECT_EQ(DCAMERA_OK, rc);
+
+    PropertyCarrier propertyCarrier;
+    EXPECT_EQ(DCAMERA_OK, testPipelineSource_->GetProperty(PIPELINE_STATS, propertyCarrier));
+    ASSERT_FALSE(propertyCarrier.nodeStats_.empty());
+    EXPECT_EQ("Decode", propertyCarrier.nodeStats_[0].nodeName);
+    EXPECT_EQ(static_cast<size_t>(0), propertyCarrier.nodeStats_[0].nodeRank);
+
+    std::string result;
+    DCameraPipelineStatsRegistry::GetInstance().Dump(result);
+    EXPECT_NE(std::string::npos, result.find("Decode"));
+    testPipelineSource_->DestroyDataProcessPipeline();
+
+    result.clear();
+    std::vector<DCameraNodeStatsInfo> nodeStats(1);
+    nodeStats[0].nodeName = "Decode";
+    nodeStats[0].framesIn = 2;
+    nodeStats[0].processTimeUs = 10;
+    DumpNodeStats(nodeStats, result);
+    EXPECT_NE(std::string::npos, result.find("in 2 "));
+    EXPECT_NE(std::string::npos, result.find("avgProcessUs 5 "));
+}
+
+/**
+ * @tc.name: dcamera_pipeline_source_test_012
+ * @tc.desc: Verify a running pipeline switches resolution in place and refuses a config that needs other nodes.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraPipelineSourceTest, dcamera_pipeline_source_test_012, TestSize.Level1)
+{
+    std::shared_ptr<DataProcessListener> listener = std::make_shared<MockDCameraDataProcessListener>();
+    VideoConfigParams srcParams(VideoCodecType::NO_CODEC, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        TEST_WIDTH, TEST_HEIGTH);
+    VideoConfigParams destParams(VideoCodecType::NO_CODEC, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        TEST_WIDTH2, TEST_HEIGTH2);
+    EXPECT_EQ(DCAMERA_WRONG_STATE, testPipelineSource_->UpdateConfig(srcParams, destParams));
+    int32_t rc = testPipelineSource_->CreateDataProcessPipeline(PipelineType::VIDEO, srcParams, destParams, listener);
+    EXPECT_EQ(DCAMERA_OK, rc);
+
+    VideoConfigParams newSrcParams(VideoCodecType::NO_CODEC, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        TEST_WIDTH3, TEST_HEIGTH3);
+    EXPECT_EQ(DCAMERA_OK, testPipelineSource_->UpdateConfig(newSrcParams, destParams));
+    VideoConfigParams decodedConfig;
+    EXPECT_EQ(DCAMERA_OK, testPipelineSource_->GetDecodedConfig(decodedConfig));
+    EXPECT_EQ(TEST_WIDTH3, decodedConfig.GetWidth());
+    EXPECT_EQ(TEST_HEIGTH3, decodedConfig.GetHeight());
+
+    VideoConfigParams codecParams(VideoCodecType::CODEC_H264, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        TEST_WIDTH, TEST_HEIGTH);
+    EXPECT_EQ(DCAMERA_BAD_OPERATE, testPipelineSource_->UpdateConfig(codecParams, destParams));
+    testPipelineSource_->DestroyDataProcessPipeline();
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dcamera_pipeline_stage.h"
+#include "distributed_camera_errno.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const size_t TEST_CAPACITY = 2;
+const size_t TEST_FRAME_NUM = 8;
+const int32_t WAIT_TIMEOUT_MS = 2000;
+
+class MockStageNode : public AbstractDataProcess {
+public:
+    int32_t InitNode(const VideoConfigParams& sourceConfig, const VideoConfigParams& targetConfig,
+        VideoConfigParams& processedConfig) override
+    {
+        processedConfig = sourceConfig;
+        return DCAMERA_OK;
+    }
+
+    int32_t ProcessData(std::vector<std::shared_ptr<DataBuffer>>& inputBuffers) override
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        gateCon_.wait(lock, [this] { return isOpen_; });
+        threadId_ = std::this_thread::get_id();
+        inputBuffers[0]->FindInt32(DataBufferKey::INDEX, lastIndex_);
+        frameIndexes_.push_back(lastIndex_);
+        doneCon_.notify_all();
+        lock.unlock();
+        if (onProcessed_ != nullptr) {
+            onProcessed_();
+        }
+        return DCAMERA_OK;
+    }
+
+    void ReleaseProcessNode() override
+    {
+        isReleased_.store(true);
+    }
+
+    int32_t GetProperty(const std::string& propertyName, PropertyCarrier& propertyCarrier) override
+    {
+        return DCAMERA_OK;
+    }
+
+    int32_t UpdateSettings(const std::shared_ptr<Camera::CameraMetadata> settings) override
+    {
+        return DCAMERA_OK;
+    }
+
+    void SetGate(bool isOpen)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isOpen_ = isOpen;
+        gateCon_.notify_all();
+    }
+
+    bool WaitFrames(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return doneCon_.wait_for(lock, std::chrono::milliseconds(WAIT_TIMEOUT_MS),
+            [this, count] { return frameIndexes_.size() >= count; });
+    }
+
+    std::mutex mutex_;
+    std::condition_variable gateCon_;
+    std::condition_variable doneCon_;
+    bool isOpen_ = true;
+    std::vector<int32_t> frameIndexes_;
+    int32_t lastIndex_ = -1;
+    std::thread::id threadId_;
+    std::atomic<bool> isReleased_ = false;
+    std::function<void()> onProcessed_ = nullptr;
+};
+
+std::vector<std::shared_ptr<DataBuffer>> MakeFrame(int32_t index)
+{
+    std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(1);
+    buffer->SetInt32(DataBufferKey::INDEX, index);
+    return { buffer };
+}
+}
+
+class DCameraPipelineStageTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<MockStageNode> node_;
+    std::shared_ptr<DCameraPipelineStage> stage_;
+};
+
+void DCameraPipelineStageTest::SetUpTestCase(void)
+{
+}
+
+void DCameraPipelineStageTest::TearDownTestCase(void)
+{
+}
+
+void DCameraPipelineStageTest::SetUp(void)
+{
+    node_ = std::make_shared<MockStageNode>();
+    stage_ = std::make_shared<DCameraPipelineStage>(node_, "stagetest", TEST_CAPACITY);
+}
+
+void DCameraPipelineStageTest::TearDown(void)
+{
+    node_->SetGate(true);
+    stage_ = nullptr;
+    node_ = nullptr;
+}
+
+/**
+ * @tc.name: dcamera_pipeline_stage_test_001
+ * @tc.desc: Verify the stage hands frames to the node on its worker in order.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraPipelineStageTest, dcamera_pipeline_stage_test_001, TestSize.Level1)
+{
+    std::vector<std::shared_ptr<DataBuffer>> frame = MakeFrame(0);
+    EXPECT_EQ(DCAMERA_DISABLE_PROCESS, stage_->ProcessData(frame));
+    std::vector<std::shared_ptr<DataBuffer>> emptyFrame;
+    EXPECT_EQ(DCAMERA_BAD_VALUE, stage_->ProcessData(emptyFrame));
+
+    EXPECT_EQ(DCAMERA_OK, stage_->Start());
+    for (size_t i = 0; i < TEST_FRAME_NUM; i++) {
+        frame = MakeFrame(static_cast<int32_t>(i));
+        EXPECT_EQ(DCAMERA_OK, stage_->ProcessData(frame));
+        EXPECT_TRUE(node_->WaitFrames(i + 1));
+    }
+    std::lock_guard<std::mutex> lock(node_->mutex_);
+    for (size_t i = 0; i < TEST_FRAME_NUM; i++) {
+        EXPECT_EQ(static_cast<int32_t>(i), node_->frameIndexes_[i]);
+    }
+    EXPECT_NE(std::this_thread::get_id(), node_->threadId_);
+}
+
+/**
+ * @tc.name: dcamera_pipeline_stage_test_002
+ * @tc.desc: Verify a full stage signals back-pressure and keeps the queued frames.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraPipelineStageTest, dcamera_pipeline_stage_test_002, TestSize.Level1)
+{
+    EXPECT_EQ(DCAMERA_OK, stage_->Start());
+    node_->SetGate(false);
+    std::vector<std::shared_ptr<DataBuffer>> frame = MakeFrame(0);
+    EXPECT_EQ(DCAMERA_OK, stage_->ProcessData(frame));
+    // Frame 0 is blocked in the node, frames 1 and 2 fill the ring.
+    while (stage_->GetPendingCount() != 0) {
+        std::this_thread::yield();
+    }
+    for (int32_t i = 1; i <= static_cast<int32_t>(TEST_CAPACITY); i++) {
+        frame = MakeFrame(i);
+        EXPECT_EQ(DCAMERA_OK, stage_->ProcessData(frame));
+    }
+    EXPECT_EQ(TEST_CAPACITY, stage_->GetPendingCount());
+    frame = MakeFrame(static_cast<int32_t>(TEST_CAPACITY) + 1);
+    EXPECT_EQ(DCAMERA_DEVICE_BUSY, stage_->ProcessData(frame));
+
+    node_->SetGate(true);
+    EXPECT_TRUE(node_->WaitFrames(TEST_CAPACITY + 1));
+    std::lock_guard<std::mutex> lock(node_->mutex_);
+    EXPECT_EQ(static_cast<int32_t>(TEST_CAPACITY), node_->lastIndex_);
+}
+
+/**
+ * @tc.name: dcamera_pipeline_stage_test_003
+ * @tc.desc: Verify ReleaseProcessNode stops the worker and releases the node.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraPipelineStageTest, dcamera_pipeline_stage_test_003, TestSize.Level1)
+{
+    EXPECT_EQ(DCAMERA_OK, stage_->Start());
+    EXPECT_EQ(DCAMERA_OK, stage_->Start());
+    VideoConfigParams srcParams(VideoCodecType::NO_CODEC, Videoformat::NV21, 30, 640, 480);
+    VideoConfigParams procConfig;
+    EXPECT_EQ(DCAMERA_OK, stage_->InitNode(srcParams, srcParams, procConfig));
+    EXPECT_EQ(640, procConfig.GetWidth());
+    PropertyCarrier carrier;
+    EXPECT_EQ(DCAMERA_OK, stage_->GetProperty("test", carrier));
+    EXPECT_EQ(DCAMERA_OK, stage_->UpdateSettings(nullptr));
+    EXPECT_NE(nullptr, stage_->AcquireInputBuffer(1));
+
+    stage_->ReleaseProcessNode();
+    EXPECT_TRUE(node_->isReleased_.load());
+    std::vector<std::shared_ptr<DataBuffer>> frame = MakeFrame(0);
+    EXPECT_EQ(DCAMERA_DISABLE_PROCESS, stage_->ProcessData(frame));
+
+    std::shared_ptr<DCameraPipelineStage> nullStage = std::make_shared<DCameraPipelineStage>(nullptr, "nullstage");
+    EXPECT_EQ(DCAMERA_BAD_VALUE, nullStage->Start());
+    EXPECT_EQ(DCAMERA_BAD_VALUE, nullStage->UpdateSettings(nullptr));
+}
+
+/**
+ * @tc.name: dcamera_pipeline_stage_test_004
+ * @tc.desc: Verify a node callback can release the stage and drop its last reference from the worker.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraPipelineStageTest, dcamera_pipeline_stage_test_004, TestSize.Level1)
+{
+    std::shared_ptr<DCameraPipelineStage> stage = std::move(stage_);
+    std::weak_ptr<DCameraPipelineStage> weakStage = stage;
+    node_->onProcessed_ = [&stage]() {
+        stage->ReleaseProcessNode();
+        stage = nullptr;
+    };
+    EXPECT_EQ(DCAMERA_OK, stage->Start());
+    std::vector<std::shared_ptr<DataBuffer>> frame = MakeFrame(0);
+    EXPECT_EQ(DCAMERA_OK, stage->ProcessData(frame));
+    EXPECT_TRUE(node_->WaitFrames(1));
+    for (int32_t i = 0; i < WAIT_TIMEOUT_MS && !weakStage.expired(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(weakStage.expired());
+    EXPECT_TRUE(node_->isReleased_.load());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
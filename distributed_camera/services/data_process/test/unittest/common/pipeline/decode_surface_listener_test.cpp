@@ -62,10 +62,11 @@ void DecodeSurfaceListenerTest::TearDown(void)
  */
 HWTEST_F(DecodeSurfaceListenerTest, decode_surface_listener_test_001, TestSize.Level1)
 {
-    std::shared_ptr<AppExecFwk::EventHandler> pipeEventHandler = std::make_shared<AppExecFwk::EventHandler>();
+    std::shared_ptr<DCameraSerialQueue> pipeEventQueue = std::make_shared<DCameraSerialQueue>(PIPELINE_SRC_EVENT,
+        DCAMERA_THREAD_FRAME);
     std::weak_ptr<DCameraPipelineSource> callbackPipSource = std::make_shared<DCameraPipelineSource>();
     sptr<IConsumerSurface> surface = IConsumerSurface::Create();
-    std::weak_ptr<DecodeDataProcess> decodeVideoNode = std::make_shared<DecodeDataProcess>(pipeEventHandler,
+    std::weak_ptr<DecodeDataProcess> decodeVideoNode = std::make_shared<DecodeDataProcess>(pipeEventQueue,
         callbackPipSource);
     std::shared_ptr<DecodeSurfaceListener> listener = std::make_shared<DecodeSurfaceListener>(surface,
         decodeVideoNode);
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dcamera_bitrate_controller.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const int64_t TEST_MIN_BITRATE = 1000000;
+const int64_t TEST_MAX_BITRATE = 6000000;
+const int64_t TEST_START_BITRATE = 4000000;
+const int32_t TEST_FRAME_RATE = 30;
+const int64_t TEST_WINDOW_US = 1000000;
+const int64_t TEST_START_US = 1000;
+const size_t TEST_FRAME_SIZE = 10000;
+const int64_t TEST_FAST_SEND_US = 2000;
+const int64_t TEST_SLOW_SEND_US = 40000;
+const int64_t TEST_LINK_CAPACITY = 2500000;
+const int64_t TEST_LINK_CEILING = 2000000;
+const int64_t TEST_LOAD_CEILING = 3000000;
+const int32_t TEST_BITRATE_PERCENT = 40;
+const int64_t TEST_PERCENT_CEILING = 2400000;
+}
+
+class DCameraBitrateControllerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    void SendFrames(int64_t sendCostUs);
+
+    DCameraBitrateController controller_;
+};
+
+void DCameraBitrateControllerTest::SetUpTestCase(void)
+{
+}
+
+void DCameraBitrateControllerTest::TearDownTestCase(void)
+{
+}
+
+void DCameraBitrateControllerTest::SetUp(void)
+{
+    controller_.Init(TEST_MIN_BITRATE, TEST_MAX_BITRATE, TEST_START_BITRATE, TEST_FRAME_RATE);
+    BitrateDecision decision;
+    EXPECT_FALSE(controller_.Evaluate(TEST_START_US, decision));
+}
+
+void DCameraBitrateControllerTest::TearDown(void)
+{
+}
+
+void DCameraBitrateControllerTest::SendFrames(int64_t sendCostUs)
+{
+    for (int32_t i = 0; i < TEST_FRAME_RATE; i++) {
+        controller_.OnFrameSent(TEST_FRAME_SIZE, sendCostUs, true);
+    }
+}
+
+/**
+ * @tc.name: dcamera_bitrate_controller_test_001
+ * @tc.desc: Verify the bitrate backs off to the measured link rate and asks for a key frame on loss.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraBitrateControllerTest, dcamera_bitrate_controller_test_001, TestSize.Level1)
+{
+    BitrateDecision decision;
+    SendFrames(TEST_SLOW_SEND_US);
+    EXPECT_FALSE(controller_.Evaluate(TEST_START_US + TEST_WINDOW_US / 2, decision));
+    EXPECT_TRUE(controller_.Evaluate(TEST_START_US + TEST_WINDOW_US, decision));
+    EXPECT_FALSE(decision.needKeyFrame);
+    // 10000 bytes in 40 ms is a 2 Mbps link, the target keeps 20% headroom below it.
+    EXPECT_EQ(1600000, decision.bitrate);
+    EXPECT_EQ(decision.bitrate, controller_.GetBitrate());
+
+    controller_.OnFramesDropped(1);
+    EXPECT_TRUE(controller_.Evaluate(TEST_START_US + TEST_WINDOW_US * 2, decision));
+    EXPECT_TRUE(decision.needKeyFrame);
+    EXPECT_LT(decision.bitrate, 1600000);
+
+    const int32_t stalledWindows = 5;
+    for (int32_t window = 0; window < stalledWindows; window++) {
+        controller_.OnSendBusy();
+        controller_.OnFrameSent(TEST_FRAME_SIZE, TEST_FAST_SEND_US, false);
+        EXPECT_TRUE(controller_.Evaluate(TEST_START_US + TEST_WINDOW_US * (window + 3), decision));
+        EXPECT_GE(decision.bitrate, TEST_MIN_BITRATE);
+    }
+    EXPECT_EQ(TEST_MIN_BITRATE, controller_.GetBitrate());
+}
+
+/**
+ * @tc.name: dcamera_bitrate_controller_test_002
+ * @tc.desc: Verify the bitrate only probes upwards after quiet windows and stays within the range.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraBitrateControllerTest, dcamera_bitrate_controller_test_002, TestSize.Level1)
+{
+    BitrateDecision decision;
+    int64_t nowUs = TEST_START_US;
+    SendFrames(TEST_FAST_SEND_US);
+    nowUs += TEST_WINDOW_US;
+    EXPECT_FALSE(controller_.Evaluate(nowUs, decision));
+    SendFrames(TEST_FAST_SEND_US);
+    nowUs += TEST_WINDOW_US;
+    EXPECT_TRUE(controller_.Evaluate(nowUs, decision));
+    EXPECT_FALSE(decision.needKeyFrame);
+    EXPECT_GT(decision.bitrate, TEST_START_BITRATE);
+
+    for (int32_t i = 0; i < TEST_FRAME_RATE; i++) {
+        SendFrames(TEST_FAST_SEND_US);
+        nowUs += TEST_WINDOW_US;
+        controller_.Evaluate(nowUs, decision);
+    }
+    EXPECT_EQ(TEST_MAX_BITRATE, controller_.GetBitrate());
+
+    controller_.Init(TEST_MIN_BITRATE, TEST_MAX_BITRATE, TEST_START_BITRATE, 0);
+    EXPECT_FALSE(controller_.Evaluate(nowUs, decision));
+    EXPECT_FALSE(controller_.Evaluate(nowUs + TEST_WINDOW_US, decision));
+}
+
+/**
+ * @tc.name: dcamera_bitrate_controller_test_003
+ * @tc.desc: Verify a reported link capacity caps the bitrate and lifting it lets the bitrate probe again.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraBitrateControllerTest, dcamera_bitrate_controller_test_003, TestSize.Level1)
+{
+    BitrateDecision decision;
+    int64_t nowUs = TEST_START_US;
+    controller_.SetLinkCapacity(TEST_LINK_CAPACITY);
+    SendFrames(TEST_FAST_SEND_US);
+    nowUs += TEST_WINDOW_US;
+    EXPECT_TRUE(controller_.Evaluate(nowUs, decision));
+    EXPECT_FALSE(decision.needKeyFrame);
+    EXPECT_EQ(TEST_LINK_CEILING, decision.bitrate);
+
+    controller_.SetLinkCapacity(TEST_MIN_BITRATE / 2);
+    SendFrames(TEST_FAST_SEND_US);
+    nowUs += TEST_WINDOW_US;
+    EXPECT_TRUE(controller_.Evaluate(nowUs, decision));
+    EXPECT_EQ(TEST_MIN_BITRATE, decision.bitrate);
+
+    controller_.SetLinkCapacity(0);
+    for (int32_t i = 0; i < TEST_FRAME_RATE; i++) {
+        SendFrames(TEST_FAST_SEND_US);
+        nowUs += TEST_WINDOW_US;
+        controller_.Evaluate(nowUs, decision);
+    }
+    EXPECT_EQ(TEST_MAX_BITRATE, controller_.GetBitrate());
+}
+
+/**
+ * @tc.name: dcamera_bitrate_controller_test_004
+ * @tc.desc: Verify a key frame request is taken once and a new configuration drops a stale one.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraBitrateControllerTest, dcamera_bitrate_controller_test_004, TestSize.Level1)
+{
+    EXPECT_FALSE(controller_.TakeKeyFrameRequest());
+    controller_.RequestKeyFrame();
+    EXPECT_TRUE(controller_.TakeKeyFrameRequest());
+    EXPECT_FALSE(controller_.TakeKeyFrameRequest());
+
+    controller_.RequestKeyFrame();
+    controller_.Init(TEST_MIN_BITRATE, TEST_MAX_BITRATE, TEST_START_BITRATE, TEST_FRAME_RATE);
+    EXPECT_FALSE(controller_.TakeKeyFrameRequest());
+}
+
+/**
+ * @tc.name: dcamera_bitrate_controller_test_005
+ * @tc.desc: Verify a load ceiling caps a quiet link and lifting it lets the bitrate probe up again.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraBitrateControllerTest, dcamera_bitrate_controller_test_005, TestSize.Level1)
+{
+    controller_.SetLoadCeiling(TEST_LOAD_CEILING);
+    BitrateDecision decision;
+    int64_t nowUs = TEST_START_US;
+    SendFrames(TEST_FAST_SEND_US);
+    nowUs += TEST_WINDOW_US;
+    EXPECT_TRUE(controller_.Evaluate(nowUs, decision));
+    EXPECT_EQ(TEST_LOAD_CEILING, decision.bitrate);
+
+    controller_.SetLinkCapacity(TEST_LINK_CAPACITY);
+    SendFrames(TEST_FAST_SEND_US);
+    nowUs += TEST_WINDOW_US;
+    EXPECT_TRUE(controller_.Evaluate(nowUs, decision));
+    EXPECT_EQ(TEST_LINK_CEILING, decision.bitrate);
+
+    controller_.SetLinkCapacity(0);
+    controller_.SetLoadCeiling(0);
+    for (int32_t i = 0; i < TEST_FRAME_RATE; i++) {
+        SendFrames(TEST_FAST_SEND_US);
+        nowUs += TEST_WINDOW_US;
+        controller_.Evaluate(nowUs, decision);
+    }
+    EXPECT_EQ(TEST_MAX_BITRATE, controller_.GetBitrate());
+}
+
+/**
+ * @tc.name: dcamera_bitrate_controller_test_006
+ * @tc.desc: Verify the degradation percent caps the bitrate across a reconfigure until it is lifted.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraBitrateControllerTest, dcamera_bitrate_controller_test_006, TestSize.Level1)
+{
+    controller_.SetBitratePercent(TEST_BITRATE_PERCENT);
+    BitrateDecision decision;
+    int64_t nowUs = TEST_START_US;
+    SendFrames(TEST_FAST_SEND_US);
+    nowUs += TEST_WINDOW_US;
+    EXPECT_TRUE(controller_.Evaluate(nowUs, decision));
+    EXPECT_EQ(TEST_PERCENT_CEILING, decision.bitrate);
+
+    controller_.Init(TEST_MIN_BITRATE, TEST_MAX_BITRATE, TEST_START_BITRATE, TEST_FRAME_RATE);
+    EXPECT_FALSE(controller_.Evaluate(nowUs, decision));
+    SendFrames(TEST_FAST_SEND_US);
+    nowUs += TEST_WINDOW_US;
+    EXPECT_TRUE(controller_.Evaluate(nowUs, decision));
+    EXPECT_EQ(TEST_PERCENT_CEILING, decision.bitrate);
+
+    controller_.SetBitratePercent(0);
+    SendFrames(TEST_FAST_SEND_US);
+    nowUs += TEST_WINDOW_US;
+    controller_.Evaluate(nowUs, decision);
+    EXPECT_LT(controller_.GetBitrate(), TEST_PERCENT_CEILING);
+
+    controller_.SetBitratePercent(100);
+    for (int32_t i = 0; i < TEST_FRAME_RATE; i++) {
+        SendFrames(TEST_FAST_SEND_US);
+        nowUs += TEST_WINDOW_US;
+        controller_.Evaluate(nowUs, decision);
+    }
+    EXPECT_EQ(TEST_MAX_BITRATE, controller_.GetBitrate());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
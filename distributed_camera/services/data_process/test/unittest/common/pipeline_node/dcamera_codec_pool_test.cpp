@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dcamera_codec_pool.h"
+#include "distributed_hardware_log.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string TEST_MIME = "video/avc";
+const int32_t TEST_WIDTH = 1920;
+const int32_t TEST_HEIGHT = 1080;
+const int32_t TEST_WIDTH2 = 1280;
+const int32_t TEST_HEIGHT2 = 720;
+}
+
+class DCameraCodecPoolTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DCameraCodecPoolTest::SetUpTestCase(void)
+{
+}
+
+void DCameraCodecPoolTest::TearDownTestCase(void)
+{
+}
+
+void DCameraCodecPoolTest::SetUp(void)
+{
+    DCameraCodecPool::GetInstance().ReleaseIdleCodecs();
+}
+
+void DCameraCodecPoolTest::TearDown(void)
+{
+    DCameraCodecPool::GetInstance().ReleaseIdleCodecs();
+}
+
+/**
+ * @tc.name: dcamera_codec_pool_test_001
+ * @tc.desc: Verify resolutions map to their class and returning no codec leaves the pool empty.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraCodecPoolTest, dcamera_codec_pool_test_001, TestSize.Level1)
+{
+    DHLOGI("dcamera_codec_pool_test_001");
+    EXPECT_EQ(0, DCameraCodecPool::GetResolutionClass(640, 480));
+    EXPECT_EQ(1, DCameraCodecPool::GetResolutionClass(TEST_WIDTH2, TEST_HEIGHT2));
+    EXPECT_EQ(2, DCameraCodecPool::GetResolutionClass(TEST_WIDTH, TEST_HEIGHT));
+    EXPECT_EQ(3, DCameraCodecPool::GetResolutionClass(3840, 2160));
+
+    std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> decoder = nullptr;
+    DCameraCodecPool::GetInstance().ReturnDecoder(TEST_MIME, TEST_WIDTH, TEST_HEIGHT, decoder);
+    std::shared_ptr<MediaAVCodec::AVCodecVideoEncoder> encoder = nullptr;
+    DCameraCodecPool::GetInstance().ReturnEncoder(TEST_MIME, TEST_WIDTH, TEST_HEIGHT, encoder);
+    EXPECT_EQ(0u, DCameraCodecPool::GetInstance().GetIdleCount());
+}
+
+/**
+ * @tc.name: dcamera_codec_pool_test_002
+ * @tc.desc: Verify a returned decoder is lent again only for the same mime type and resolution class.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraCodecPoolTest, dcamera_codec_pool_test_002, TestSize.Level1)
+{
+    DHLOGI("dcamera_codec_pool_test_002");
+    DCameraCodecPool& pool = DCameraCodecPool::GetInstance();
+    std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> decoder = pool.AcquireDecoder(TEST_MIME, TEST_WIDTH,
+        TEST_HEIGHT);
+    ASSERT_NE(nullptr, decoder);
+    MediaAVCodec::AVCodecVideoDecoder *returned = decoder.get();
+    pool.ReturnDecoder(TEST_MIME, TEST_WIDTH, TEST_HEIGHT, decoder);
+    EXPECT_EQ(nullptr, decoder);
+    EXPECT_EQ(1u, pool.GetIdleCount());
+
+    std::shared_ptr<MediaAVCodec::AVCodecVideoDecoder> other = pool.AcquireDecoder(TEST_MIME, TEST_WIDTH2,
+        TEST_HEIGHT2);
+    EXPECT_NE(returned, other.get());
+    EXPECT_EQ(1u, pool.GetIdleCount());
+    decoder = pool.AcquireDecoder(TEST_MIME, TEST_WIDTH, TEST_HEIGHT);
+    EXPECT_EQ(returned, decoder.get());
+    EXPECT_EQ(0u, pool.GetIdleCount());
+
+    pool.ReturnDecoder(TEST_MIME, TEST_WIDTH, TEST_HEIGHT, decoder);
+    pool.ReturnDecoder(TEST_MIME, TEST_WIDTH2, TEST_HEIGHT2, other);
+    EXPECT_EQ(2u, pool.GetIdleCount());
+    pool.ReleaseIdleCodecs();
+    EXPECT_EQ(0u, pool.GetIdleCount());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
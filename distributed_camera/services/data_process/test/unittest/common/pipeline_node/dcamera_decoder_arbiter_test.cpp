@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "dcamera_decoder_arbiter.h"
+#include "distributed_hardware_log.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const int32_t TEST_WIDTH = 1920;
+const int32_t TEST_HEIGHT = 1080;
+const int32_t TEST_FRAME_RATE = 30;
+const std::string TEST_KEY_PREFIX = "source_test_";
+}
+
+class DCameraDecoderArbiterTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    void ReleaseAll();
+};
+
+void DCameraDecoderArbiterTest::SetUpTestCase(void)
+{
+}
+
+void DCameraDecoderArbiterTest::TearDownTestCase(void)
+{
+}
+
+void DCameraDecoderArbiterTest::SetUp(void)
+{
+    ReleaseAll();
+}
+
+void DCameraDecoderArbiterTest::TearDown(void)
+{
+    ReleaseAll();
+}
+
+void DCameraDecoderArbiterTest::ReleaseAll()
+{
+    for (int32_t i = 0; i <= DCameraDecoderArbiter::DEFAULT_MAX_HW_DECODERS; i++) {
+        std::string key = TEST_KEY_PREFIX + std::to_string(i);
+        DCameraDecoderArbiter::GetInstance().Release(key);
+        DCameraDecoderArbiter::GetInstance().SetStreamPriority(key, DCameraDecodePriority::FOREGROUND);
+    }
+}
+
+/**
+ * @tc.name: dcamera_decoder_arbiter_test_001
+ * @tc.desc: Verify streams get hardware up to the limit, then software, and a release frees a slot.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraDecoderArbiterTest, dcamera_decoder_arbiter_test_001, TestSize.Level1)
+{
+    DHLOGI("dcamera_decoder_arbiter_test_001");
+    DCameraDecoderArbiter& arbiter = DCameraDecoderArbiter::GetInstance();
+    EXPECT_EQ(0, DCameraDecoderArbiter::GetLoad(0, TEST_HEIGHT, TEST_FRAME_RATE));
+    int64_t load = DCameraDecoderArbiter::GetLoad(TEST_WIDTH, TEST_HEIGHT, TEST_FRAME_RATE);
+    EXPECT_EQ(static_cast<int64_t>(TEST_WIDTH) * TEST_HEIGHT * TEST_FRAME_RATE, load);
+
+    for (int32_t i = 0; i < DCameraDecoderArbiter::DEFAULT_MAX_HW_DECODERS; i++) {
+        EXPECT_EQ(DCameraDecoderGrant::HARDWARE, arbiter.Acquire(TEST_KEY_PREFIX + std::to_string(i), load, nullptr));
+    }
+    std::string lastKey = TEST_KEY_PREFIX + std::to_string(DCameraDecoderArbiter::DEFAULT_MAX_HW_DECODERS);
+    EXPECT_EQ(DCameraDecoderGrant::SOFTWARE, arbiter.Acquire(lastKey, load, nullptr));
+    EXPECT_EQ(static_cast<size_t>(DCameraDecoderArbiter::DEFAULT_MAX_HW_DECODERS), arbiter.GetHardwareCount());
+
+    arbiter.Release(TEST_KEY_PREFIX + std::to_string(0));
+    EXPECT_EQ(DCameraDecoderGrant::HARDWARE, arbiter.Acquire(lastKey, load, nullptr));
+    arbiter.OnHardwareUnavailable(lastKey);
+    EXPECT_EQ(static_cast<size_t>(DCameraDecoderArbiter::DEFAULT_MAX_HW_DECODERS - 1), arbiter.GetHardwareCount());
+}
+
+/**
+ * @tc.name: dcamera_decoder_arbiter_test_002
+ * @tc.desc: Verify a foreground stream left to software asks a background hardware holder to step down once.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraDecoderArbiterTest, dcamera_decoder_arbiter_test_002, TestSize.Level1)
+{
+    DHLOGI("dcamera_decoder_arbiter_test_002");
+    DCameraDecoderArbiter& arbiter = DCameraDecoderArbiter::GetInstance();
+    int64_t load = DCameraDecoderArbiter::GetLoad(TEST_WIDTH, TEST_HEIGHT, TEST_FRAME_RATE);
+    std::vector<int32_t> stepDowns(DCameraDecoderArbiter::DEFAULT_MAX_HW_DECODERS, 0);
+    std::string backgroundKey = TEST_KEY_PREFIX + std::to_string(1);
+    arbiter.SetStreamPriority(backgroundKey, DCameraDecodePriority::BACKGROUND);
+    for (int32_t i = 0; i < DCameraDecoderArbiter::DEFAULT_MAX_HW_DECODERS; i++) {
+        int32_t *counter = &stepDowns[i];
+        EXPECT_EQ(DCameraDecoderGrant::HARDWARE, arbiter.Acquire(TEST_KEY_PREFIX + std::to_string(i), load,
+            [counter]() { (*counter)++; }));
+    }
+
+    std::string lastKey = TEST_KEY_PREFIX + std::to_string(DCameraDecoderArbiter::DEFAULT_MAX_HW_DECODERS);
+    EXPECT_EQ(DCameraDecoderGrant::SOFTWARE, arbiter.Acquire(lastKey, load, nullptr));
+    EXPECT_EQ(DCameraDecoderGrant::SOFTWARE, arbiter.Acquire(lastKey, load, nullptr));
+    for (int32_t i = 0; i < DCameraDecoderArbiter::DEFAULT_MAX_HW_DECODERS; i++) {
+        EXPECT_EQ((i == 1) ? 1 : 0, stepDowns[i]);
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dcamera_encoder_preset.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const int32_t TEST_FRAME_RATE = 30;
+const int64_t TEST_FRAME_INTERVAL_US = 33333;
+const int64_t TEST_START_US = 1000;
+const int64_t TEST_SLOW_LATENCY_US = 200000;
+const int64_t TEST_FAST_LATENCY_US = 20000;
+const int32_t TEST_PROFILE = 1;
+const int32_t TEST_THERMAL_HOT = 3;
+const int32_t TEST_THERMAL_NORMAL = 1;
+const int32_t TEST_CALM_WINDOWS = 3;
+}
+
+class DCameraEncoderPresetTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    void EncodeFrames(int64_t latencyUs);
+    bool EvaluateNextWindow(int32_t& level);
+
+    DCameraEncoderPreset preset_;
+    int64_t nowUs_ = 0;
+};
+
+void DCameraEncoderPresetTest::SetUpTestCase(void)
+{
+}
+
+void DCameraEncoderPresetTest::TearDownTestCase(void)
+{
+}
+
+void DCameraEncoderPresetTest::SetUp(void)
+{
+    preset_.Init(TEST_FRAME_RATE);
+    nowUs_ = TEST_START_US;
+    int32_t level = 0;
+    EXPECT_FALSE(preset_.Evaluate(nowUs_, level));
+}
+
+void DCameraEncoderPresetTest::TearDown(void)
+{
+}
+
+void DCameraEncoderPresetTest::EncodeFrames(int64_t latencyUs)
+{
+    for (int32_t i = 0; i < TEST_FRAME_RATE; i++) {
+        preset_.OnFrameEncoded(latencyUs);
+    }
+}
+
+bool DCameraEncoderPresetTest::EvaluateNextWindow(int32_t& level)
+{
+    nowUs_ += DCameraEncoderPreset::WINDOW_US;
+    return preset_.Evaluate(nowUs_, level);
+}
+
+/**
+ * @tc.name: dcamera_encoder_preset_test_001
+ * @tc.desc: Verify the tier follows the pixel rate of the hardware encoder and its preset.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraEncoderPresetTest, dcamera_encoder_preset_test_001, TestSize.Level1)
+{
+    VideoCapabilityBounds bounds { 1920, 1080, 30 };
+    EXPECT_EQ(EncoderTier::LOW, DCameraEncoderPreset::ClassifyTier(bounds));
+    bounds.profiles.push_back(TEST_PROFILE);
+    EXPECT_EQ(EncoderTier::LOW, DCameraEncoderPreset::ClassifyTier(bounds));
+    bounds.maxFrameRate = TEST_FRAME_RATE * 2;
+    EXPECT_EQ(EncoderTier::MID, DCameraEncoderPreset::ClassifyTier(bounds));
+    bounds.maxWidth = 3840;
+    bounds.maxHeight = 2160;
+    EXPECT_EQ(EncoderTier::HIGH, DCameraEncoderPreset::ClassifyTier(bounds));
+
+    EncoderPreset low = DCameraEncoderPreset::GetPreset(EncoderTier::LOW);
+    EncoderPreset mid = DCameraEncoderPreset::GetPreset(EncoderTier::UNKNOWN);
+    EncoderPreset high = DCameraEncoderPreset::GetPreset(EncoderTier::HIGH);
+    EXPECT_EQ(EncoderRateControl::CBR, low.rateControl);
+    EXPECT_EQ(EncoderTier::MID, mid.tier);
+    EXPECT_EQ(EncoderRateControl::VBR, mid.rateControl);
+    EXPECT_FALSE(mid.isHighProfile);
+    EXPECT_TRUE(high.isHighProfile);
+    EXPECT_GT(low.idrIntervalMs, mid.idrIntervalMs);
+    EXPECT_LT(low.bitratePercent, mid.bitratePercent);
+    EXPECT_GT(high.bitratePercent, mid.bitratePercent);
+}
+
+/**
+ * @tc.name: dcamera_encoder_preset_test_002
+ * @tc.desc: Verify late frames raise the throttle step by step and calm windows lower it again.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraEncoderPresetTest, dcamera_encoder_preset_test_002, TestSize.Level1)
+{
+    int32_t level = 0;
+    EncodeFrames(TEST_SLOW_LATENCY_US);
+    EXPECT_FALSE(preset_.Evaluate(nowUs_ + TEST_FRAME_INTERVAL_US, level));
+    for (int32_t i = 1; i <= DCameraEncoderPreset::MAX_THROTTLE_LEVEL; i++) {
+        EncodeFrames(TEST_SLOW_LATENCY_US);
+        EXPECT_TRUE(EvaluateNextWindow(level));
+        EXPECT_EQ(i, level);
+    }
+    EncodeFrames(TEST_SLOW_LATENCY_US);
+    EXPECT_FALSE(EvaluateNextWindow(level));
+    EXPECT_EQ(DCameraEncoderPreset::MAX_THROTTLE_LEVEL, preset_.GetThrottleLevel());
+
+    for (int32_t i = 1; i < TEST_CALM_WINDOWS; i++) {
+        EncodeFrames(TEST_FAST_LATENCY_US);
+        EXPECT_FALSE(EvaluateNextWindow(level));
+    }
+    EncodeFrames(TEST_FAST_LATENCY_US);
+    EXPECT_TRUE(EvaluateNextWindow(level));
+    EXPECT_EQ(DCameraEncoderPreset::MAX_THROTTLE_LEVEL - 1, level);
+    EXPECT_FALSE(EvaluateNextWindow(level));
+}
+
+/**
+ * @tc.name: dcamera_encoder_preset_test_003
+ * @tc.desc: Verify a hot device keeps its throttle floor however calm the encoder is.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraEncoderPresetTest, dcamera_encoder_preset_test_003, TestSize.Level1)
+{
+    int32_t level = 0;
+    preset_.SetThermalLevel(TEST_THERMAL_HOT);
+    EncodeFrames(TEST_FAST_LATENCY_US);
+    EXPECT_TRUE(EvaluateNextWindow(level));
+    EXPECT_EQ(DCameraEncoderPreset::MAX_THROTTLE_LEVEL - 1, level);
+    for (int32_t i = 0; i < TEST_CALM_WINDOWS; i++) {
+        EncodeFrames(TEST_FAST_LATENCY_US);
+        EXPECT_FALSE(EvaluateNextWindow(level));
+    }
+
+    // The calm window after the last blocked step down already counts once the device cools.
+    preset_.SetThermalLevel(TEST_THERMAL_NORMAL);
+    EncodeFrames(TEST_FAST_LATENCY_US);
+    EXPECT_FALSE(EvaluateNextWindow(level));
+    EncodeFrames(TEST_FAST_LATENCY_US);
+    EXPECT_TRUE(EvaluateNextWindow(level));
+    EXPECT_EQ(1, level);
+}
+
+/**
+ * @tc.name: dcamera_encoder_preset_test_004
+ * @tc.desc: Verify the throttle percents and the preset code carried in the frame info.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DCameraEncoderPresetTest, dcamera_encoder_preset_test_004, TestSize.Level1)
+{
+    EXPECT_EQ(100, DCameraEncoderPreset::GetThrottlePercent(0));
+    EXPECT_EQ(100, DCameraEncoderPreset::GetThrottlePercent(-1));
+    EXPECT_GT(DCameraEncoderPreset::GetThrottlePercent(1), DCameraEncoderPreset::GetThrottlePercent(2));
+    EXPECT_EQ(DCameraEncoderPreset::GetThrottlePercent(DCameraEncoderPreset::MAX_THROTTLE_LEVEL),
+        DCameraEncoderPreset::GetThrottlePercent(DCameraEncoderPreset::MAX_THROTTLE_LEVEL + 1));
+
+    EXPECT_EQ(0x20, DCameraEncoderPreset::MakePresetCode(EncoderTier::MID, 0));
+    int32_t maxLevel = DCameraEncoderPreset::MAX_THROTTLE_LEVEL;
+    EXPECT_EQ(0x13, DCameraEncoderPreset::MakePresetCode(EncoderTier::LOW, maxLevel));
+    EXPECT_EQ(0x33, DCameraEncoderPreset::MakePresetCode(EncoderTier::HIGH, maxLevel + 1));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dcamera_tile_compositor.h"
+#include "distributed_camera_errno.h"
+#include "distributed_hardware_log.h"
+#include "securec.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const int32_t TEST_CANVAS_WIDTH = 64;
+const int32_t TEST_CANVAS_HEIGHT = 32;
+const int32_t TEST_FRAME_RATE = 25;
+const int64_t TEST_INTERVAL_US = 40000;
+const int64_t TEST_START_US = 1000000;
+const int32_t TEST_TILE_COUNT = 4;
+const uint8_t TEST_LUMA = 200;
+const uint8_t TEST_CHROMA = 60;
+const uint8_t BLACK_LUMA = 16;
+const std::string TEST_TILE_0 = "camera_0";
+const std::string TEST_TILE_1 = "camera_1";
+}
+
+class DCameraTileCompositorTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<DataBuffer> MakeFrame(int32_t width, int32_t height);
+    uint8_t LumaAt(const std::shared_ptr<DataBuffer>& canvas, int32_t x, int32_t y);
+    uint8_t ChromaAt(const std::shared_ptr<DataBuffer>& canvas, int32_t x, int32_t y);
+
+    std::shared_ptr<DCameraTileCompositor> compositor_;
+};
+
+void DCameraTileCompositorTest::SetUpTestCase(void)
+{
+}
+
+void DCameraTileCompositorTest::TearDownTestCase(void)
+{
+}
+
+void DCameraTileCompositorTest::SetUp(void)
+{
+    compositor_ = std::make_shared<DCameraTileCompositor>();
+}
+
+void DCameraTileCompositorTest::TearDown(void)
+{
+    compositor_ = nullptr;
+}
+
+std::shared_ptr<DataBuffer> DCameraTileCompositorTest::MakeFrame(int32_t width, int32_t height)
+{
+    size_t lumaSize = static_cast<size_t>(width * height);
+    std::shared_ptr<DataBuffer> frame = std::make_shared<DataBuffer>(lumaSize + lumaSize / 2);
+    (void)memset_s(frame->Data(), lumaSize, TEST_LUMA, lumaSize);
+    (void)memset_s(frame->Data() + lumaSize, lumaSize / 2, TEST_CHROMA, lumaSize / 2);
+    return frame;
+}
+
+uint8_t DCameraTileCompositorTest::LumaAt(const std::shared_ptr<DataBuffer>& canvas, int32_t x, int32_t y)
+{
+    return canvas->Data()[y * TEST_CANVAS_WIDTH + x];
+}
+
+uint8_t DCameraTileCompositorTest::ChromaAt(const std::shared_ptr<DataBuffer>& canvas, int32_t x, int32_t y)
+{
+    return canvas->Data()[TEST_CANVAS_WIDTH * TEST_CANVAS_HEIGHT + (y / 2) * TEST_CANVAS_WIDTH + x];
+}
+
+/**
+ * @tc.name: dcamera_tile_compositor_test_001
+ * @tc.desc: Verify invalid canvases and tiles are refused and a grid splits the canvas evenly.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraTileCompositorTest, dcamera_tile_compositor_test_001, TestSize.Level1)
+{
+    DHLOGI("dcamera_tile_compositor_test_001");
+    DCameraTilePlacement placement = DCameraTileCompositor::GetGridPlacement(0, TEST_TILE_COUNT,
+        TEST_CANVAS_WIDTH, TEST_CANVAS_HEIGHT);
+    EXPECT_EQ(DCAMERA_WRONG_STATE, compositor_->SetTile(TEST_TILE_0, placement));
+    EXPECT_EQ(DCAMERA_BAD_VALUE, compositor_->Init(TEST_CANVAS_WIDTH + 1, TEST_CANVAS_HEIGHT, TEST_FRAME_RATE));
+    EXPECT_EQ(DCAMERA_BAD_VALUE, compositor_->Init(TEST_CANVAS_WIDTH, TEST_CANVAS_HEIGHT, 0));
+    ASSERT_EQ(DCAMERA_OK, compositor_->Init(TEST_CANVAS_WIDTH, TEST_CANVAS_HEIGHT, TEST_FRAME_RATE));
+
+    EXPECT_EQ(TEST_CANVAS_WIDTH / 2, placement.width);
+    EXPECT_EQ(TEST_CANVAS_HEIGHT / 2, placement.height);
+    DCameraTilePlacement last = DCameraTileCompositor::GetGridPlacement(TEST_TILE_COUNT - 1, TEST_TILE_COUNT,
+        TEST_CANVAS_WIDTH, TEST_CANVAS_HEIGHT);
+    EXPECT_EQ(TEST_CANVAS_WIDTH / 2, last.x);
+    EXPECT_EQ(TEST_CANVAS_HEIGHT / 2, last.y);
+
+    DCameraTilePlacement outside = last;
+    outside.x += 2;
+    EXPECT_EQ(DCAMERA_BAD_VALUE, compositor_->SetTile(TEST_TILE_0, outside));
+    EXPECT_EQ(DCAMERA_OK, compositor_->SetTile(TEST_TILE_0, placement));
+    EXPECT_EQ(DCAMERA_BAD_VALUE, compositor_->SubmitFrame(TEST_TILE_0, MakeFrame(placement.width, placement.height),
+        placement.width / 2, placement.height));
+    EXPECT_EQ(DCAMERA_NOT_FOUND, compositor_->SubmitFrame(TEST_TILE_1, MakeFrame(placement.width,
+        placement.height), placement.width, placement.height));
+}
+
+/**
+ * @tc.name: dcamera_tile_compositor_test_002
+ * @tc.desc: Verify tiles are drawn at their placement on the shared clock and blanked when they go silent.
+ * @tc.type: FUNC
+ * @tc.require: issue
+ */
+HWTEST_F(DCameraTileCompositorTest, dcamera_tile_compositor_test_002, TestSize.Level1)
+{
+    DHLOGI("dcamera_tile_compositor_test_002");
+    ASSERT_EQ(DCAMERA_OK, compositor_->Init(TEST_CANVAS_WIDTH, TEST_CANVAS_HEIGHT, TEST_FRAME_RATE));
+    DCameraTilePlacement placement = DCameraTileCompositor::GetGridPlacement(TEST_TILE_COUNT - 1,
+        TEST_TILE_COUNT, TEST_CANVAS_WIDTH, TEST_CANVAS_HEIGHT);
+    ASSERT_EQ(DCAMERA_OK, compositor_->SetTile(TEST_TILE_1, placement));
+    EXPECT_EQ(DCAMERA_OK, compositor_->SubmitFrame(TEST_TILE_1, MakeFrame(placement.width, placement.height),
+        placement.width, placement.height));
+
+    std::shared_ptr<DataBuffer> canvas;
+    ASSERT_EQ(DCAMERA_OK, compositor_->Compose(TEST_START_US, canvas));
+    ASSERT_NE(nullptr, canvas);
+    EXPECT_EQ(TEST_LUMA, LumaAt(canvas, placement.x, placement.y));
+    EXPECT_EQ(TEST_CHROMA, ChromaAt(canvas, placement.x, placement.y));
+    EXPECT_EQ(BLACK_LUMA, LumaAt(canvas, 0, 0));
+    EXPECT_EQ(BLACK_LUMA, LumaAt(canvas, placement.x - 1, placement.y));
+    int64_t timeStampUs = 0;
+    EXPECT_TRUE(canvas->FindInt64(DataBufferKey::TIME_STAMP_US, timeStampUs));
+    EXPECT_EQ(TEST_START_US, timeStampUs);
+
+    EXPECT_EQ(DCAMERA_WRONG_STATE, compositor_->Compose(TEST_START_US + TEST_INTERVAL_US / 2, canvas));
+    int64_t lateUs = TEST_START_US + TEST_INTERVAL_US * 3 + TEST_INTERVAL_US / 2;
+    ASSERT_EQ(DCAMERA_OK, compositor_->Compose(lateUs, canvas));
+    EXPECT_TRUE(canvas->FindInt64(DataBufferKey::TIME_STAMP_US, timeStampUs));
+    EXPECT_EQ(TEST_START_US + TEST_INTERVAL_US * 3, timeStampUs);
+    EXPECT_EQ(TEST_LUMA, LumaAt(canvas, placement.x, placement.y));
+
+    ASSERT_EQ(DCAMERA_OK, compositor_->Compose(TEST_START_US + DCameraTileCompositor::STALE_TILE_US, canvas));
+    EXPECT_EQ(BLACK_LUMA, LumaAt(canvas, placement.x, placement.y));
+
+    EXPECT_EQ(DCAMERA_OK, compositor_->RemoveTile(TEST_TILE_1));
+    EXPECT_EQ(DCAMERA_NOT_FOUND, compositor_->RemoveTile(TEST_TILE_1));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -59,9 +59,9 @@ void DecodeDataProcessTest::SetUp(void)
 {
     DHLOGI("DecodeDataProcessTest SetUp");
     sourcePipeline_ = std::make_shared<DCameraPipelineSource>();
-    std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create(true);
-    std::shared_ptr<AppExecFwk::EventHandler> pipeEventHandler = std::make_shared<AppExecFwk::EventHandler>(runner);
-    testDecodeDataProcess_ = std::make_shared<DecodeDataProcess>(pipeEventHandler, sourcePipeline_);
+    std::shared_ptr<DCameraSerialQueue> pipeEventQueue = std::make_shared<DCameraSerialQueue>(PIPELINE_SRC_EVENT,
+        DCAMERA_THREAD_FRAME);
+    testDecodeDataProcess_ = std::make_shared<DecodeDataProcess>(pipeEventQueue, sourcePipeline_);
 }
 
 void DecodeDataProcessTest::TearDown(void)
@@ -83,7 +83,7 @@ HWTEST_F(DecodeDataProcessTest, decode_data_process_test_001, TestSize.Level1)
     DHLOGI("DecodeDataProcessTest decode_data_process_test_001");
     EXPECT_EQ(false, testDecodeDataProcess_ == nullptr);
 
-    int32_t frameRate = 50;
+    int32_t frameRate = DCameraCodecCapability::MAX_FRAME_RATE_LIMIT + 1;
     VideoConfigParams srcParams(VideoCodecType::CODEC_H264,
                                 Videoformat::NV12,
                                 frameRate,
@@ -591,10 +591,10 @@ HWTEST_F(DecodeDataProcessTest, decode_data_process_test_017, TestSize.Level1)
 {
     DHLOGI("DecodeDataProcessTest decode_data_process_test_017");
     EXPECT_EQ(false, testDecodeDataProcess_ == nullptr);
-    VideoConfigParams srcParams2(VideoCodecType::CODEC_H264,
-        Videoformat::NV12, DCAMERA_PRODUCER_FPS_DEFAULT, 4000, 4000);
-    VideoConfigParams destParams2(VideoCodecType::NO_CODEC,
-        Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT, 4000, 4000);
+    VideoConfigParams srcParams2(VideoCodecType::CODEC_H264, Videoformat::NV12, DCAMERA_PRODUCER_FPS_DEFAULT,
+        DCameraCodecCapability::MAX_WIDTH_LIMIT + 1, DCameraCodecCapability::MAX_HEIGHT_LIMIT + 1);
+    VideoConfigParams destParams2(VideoCodecType::NO_CODEC, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        DCameraCodecCapability::MAX_WIDTH_LIMIT + 1, DCameraCodecCapability::MAX_HEIGHT_LIMIT + 1);
     VideoConfigParams procConfig2;
     int32_t rc = testDecodeDataProcess_->InitNode(srcParams2, destParams2, procConfig2);
     testDecodeDataProcess_->OnError();
@@ -722,107 +722,6 @@ HWTEST_F(DecodeDataProcessTest, decode_data_process_test_022, TestSize.Level1)
     EXPECT_EQ(rc, DCAMERA_OK);
 }
 
-/**
- * @tc.name: decode_data_process_test_023
- * @tc.desc: Verify CopyDecodedImage func.
- * @tc.type: FUNC
- * @tc.require: Issue Number
- */
-HWTEST_F(DecodeDataProcessTest, decode_data_process_test_023, TestSize.Level1)
-{
-    DHLOGI("DecodeDataProcessTest decode_data_process_test_023");
-    EXPECT_EQ(false, testDecodeDataProcess_ == nullptr);
-    int dstSizeY = TEST_WIDTH * TEST_HEIGTH;
-    int dstSizeUV = TEST_WIDTH * TEST_HEIGTH / 4;
-    uint8_t* srcY = (uint8_t *)malloc(dstSizeY);
-    int srcStrideY = TEST_WIDTH;
-    uint8_t* srcUV = (uint8_t *)malloc(dstSizeUV);
-    int srcStrideUV = TEST_WIDTH / 2;
-    int srcWidth = TEST_WIDTH;
-    int srcHeight = TEST_HEIGTH;
-    uint8_t* dstY = static_cast<uint8_t*>(aligned_alloc(16, dstSizeY));
-    int dstStrideY = TEST_WIDTH;
-    uint8_t* dstU = static_cast<uint8_t*>(aligned_alloc(16, dstSizeUV));
-    int dstStrideU = TEST_WIDTH;
-    uint8_t* dstV = static_cast<uint8_t*>(aligned_alloc(16, dstSizeUV));
-    int dstStrideV = TEST_WIDTH;
-    int angleDegrees = 0;
-    ImageDataInfo srcInfo = { .width = srcWidth, .height = srcHeight,
-        .dataY = srcY, .strideY = srcStrideY, .dataU = srcUV, .strideU = srcStrideUV };
-    ImageDataInfo dstInfo = { .dataY = dstY, .strideY = dstStrideY, .dataU = dstU, .strideU = dstStrideU,
-        .dataV = dstV, .strideV = dstStrideV };
-    srcInfo.dataY = nullptr;
-    bool ret = testDecodeDataProcess_->UniversalRotateCropAndPadNv12ToI420(srcInfo, dstInfo, angleDegrees);
-    EXPECT_EQ(ret, false);
-    srcInfo.dataY = srcY;
-    srcInfo.width = 0;
-    ret = testDecodeDataProcess_->UniversalRotateCropAndPadNv12ToI420(srcInfo, dstInfo, angleDegrees);
-    EXPECT_EQ(ret, false);
-    srcInfo.width = TEST_WIDTH;
-    ret = testDecodeDataProcess_->UniversalRotateCropAndPadNv12ToI420(srcInfo, dstInfo, angleDegrees);
-    EXPECT_EQ(ret, true);
-    angleDegrees = 90;
-    ret = testDecodeDataProcess_->UniversalRotateCropAndPadNv12ToI420(srcInfo, dstInfo, angleDegrees);
-    EXPECT_EQ(ret, true);
-    free(srcY);
-    free(srcUV);
-    free(dstY);
-    free(dstU);
-    free(dstV);
-}
-
-/**
- * @tc.name: decode_data_process_test_024
- * @tc.desc: Verify I420CopyBySystemSwitch func.
- * @tc.type: FUNC
- * @tc.require: Issue Number
- */
-HWTEST_F(DecodeDataProcessTest, decode_data_process_test_024, TestSize.Level1)
-{
-    DHLOGI("DecodeDataProcessTest decode_data_process_test_024");
-    EXPECT_EQ(false, testDecodeDataProcess_ == nullptr);
-    int dstSizeY = TEST_WIDTH * TEST_HEIGTH;
-    int dstSizeUV = TEST_WIDTH * TEST_HEIGTH / 4;
-    uint8_t* rotatedY = (uint8_t *)malloc(dstSizeY);
-    int rotatedStrideY = TEST_WIDTH;
-    uint8_t* rotatedU = (uint8_t *)malloc(dstSizeUV);
-    int rotatedStrideU = TEST_WIDTH / 2;
-    uint8_t* rotatedV = (uint8_t *)malloc(dstSizeUV);
-    int rotatedStrideV = TEST_WIDTH / 2;
-
-    uint8_t* dstY = static_cast<uint8_t*>(aligned_alloc(16, dstSizeY));
-    int dstStrideY = TEST_WIDTH;
-    uint8_t* dstU = static_cast<uint8_t*>(aligned_alloc(16, dstSizeUV));
-    int dstStrideU = TEST_WIDTH / 2;
-    uint8_t* dstV = static_cast<uint8_t*>(aligned_alloc(16, dstSizeUV));
-    int dstStrideV = TEST_WIDTH / 2;
-
-    int srcWidth = TEST_WIDTH;
-    int srcHeight = TEST_HEIGTH;
-    int rotatedWidth = TEST_WIDTH;
-    int rotatedHeight = TEST_HEIGTH;
-    int normalizedAngle = 90;
-    ImageDataInfo rotateInfo = { .width = rotatedWidth, .height = rotatedHeight, .dataY = rotatedY,
-        .strideY = rotatedStrideY, .dataU = rotatedU, .strideU = rotatedStrideU, .dataV = rotatedV,
-        .strideV = rotatedStrideV };
-    ImageDataInfo dstInfo = { .width = TEST_WIDTH, .height = TEST_HEIGTH, .dataY = dstY,
-        .strideY = dstStrideY, .dataU = dstU, .strideU = dstStrideU, .dataV = dstV,
-        .strideV = dstStrideV };
-    bool ret = testDecodeDataProcess_->I420CopyBySystemSwitch(rotateInfo, dstInfo, 0, srcHeight, normalizedAngle);
-    EXPECT_EQ(ret, false);
-    ret = testDecodeDataProcess_->I420CopyBySystemSwitch(rotateInfo, dstInfo, srcWidth, srcHeight, normalizedAngle);
-    EXPECT_EQ(ret, true);
-    normalizedAngle = 0;
-    ret = testDecodeDataProcess_->I420CopyBySystemSwitch(rotateInfo, dstInfo, srcWidth, srcHeight, normalizedAngle);
-    EXPECT_EQ(ret, true);
-    free(rotatedY);
-    free(rotatedU);
-    free(rotatedV);
-    free(dstY);
-    free(dstU);
-    free(dstV);
-}
-
 /**
  * @tc.name: decode_data_process_test_025
  * @tc.desc: Verify InitNode func.
@@ -861,84 +760,6 @@ HWTEST_F(DecodeDataProcessTest, decode_data_process_test_025, TestSize.Level1)
     testDecodeDataProcess_->ReleaseProcessNode();
 }
 
-/**
- * @tc.name: decode_data_process_test_026
- * @tc.desc: Verify ParseAngle func.
- * @tc.type: FUNC
- * @tc.require: Issue Number
- */
-HWTEST_F(DecodeDataProcessTest, decode_data_process_test_026, TestSize.Level1)
-{
-    DHLOGI("DecodeDataProcessTest decode_data_process_test_026");
-    EXPECT_EQ(false, testDecodeDataProcess_ == nullptr);
-
-    OpenSourceLibyuv::RotationMode mode = testDecodeDataProcess_->ParseAngle(0);
-    EXPECT_EQ(mode, OpenSourceLibyuv::RotationMode::kRotate0);
-
-    mode = testDecodeDataProcess_->ParseAngle(90);
-    EXPECT_EQ(mode, OpenSourceLibyuv::RotationMode::kRotate90);
-    
-    mode = testDecodeDataProcess_->ParseAngle(180);
-    EXPECT_EQ(mode, OpenSourceLibyuv::RotationMode::kRotate180);
-
-    mode = testDecodeDataProcess_->ParseAngle(270);
-    EXPECT_EQ(mode, OpenSourceLibyuv::RotationMode::kRotate270);
-
-    mode = testDecodeDataProcess_->ParseAngle(360);
-    EXPECT_EQ(mode, OpenSourceLibyuv::RotationMode::kRotate0);
-
-    mode = testDecodeDataProcess_->ParseAngle(1);
-    EXPECT_EQ(mode, OpenSourceLibyuv::RotationMode::kRotate0);
-}
-
-/**
- * @tc.name: decode_data_process_test_027
- * @tc.desc: Verify CheckParameters func.
- * @tc.type: FUNC
- * @tc.require: Issue Number
- */
-HWTEST_F(DecodeDataProcessTest, decode_data_process_test_027, TestSize.Level1)
-{
-    DHLOGI("DecodeDataProcessTest decode_data_process_test_027");
-    EXPECT_EQ(false, testDecodeDataProcess_ == nullptr);
-    uint8_t* bytes = (uint8_t *)malloc(1);
-    ImageDataInfo srcInfo = {0};
-    ImageDataInfo dstInfo = {0};
-
-    srcInfo.dataY = nullptr;
-    EXPECT_FALSE(testDecodeDataProcess_->CheckParameters(srcInfo, dstInfo));
-
-    srcInfo.dataY = bytes;
-    srcInfo.dataU = nullptr;
-    EXPECT_FALSE(testDecodeDataProcess_->CheckParameters(srcInfo, dstInfo));
-
-    srcInfo.dataU = bytes;
-    srcInfo.dataV = nullptr;
-    EXPECT_FALSE(testDecodeDataProcess_->CheckParameters(srcInfo, dstInfo));
-
-    srcInfo.dataV = bytes;
-    dstInfo.dataY = nullptr;
-    EXPECT_FALSE(testDecodeDataProcess_->CheckParameters(srcInfo, dstInfo));
-
-    dstInfo.dataY = bytes;
-    dstInfo.dataU = nullptr;
-    EXPECT_FALSE(testDecodeDataProcess_->CheckParameters(srcInfo, dstInfo));
-
-    dstInfo.dataU = bytes;
-    dstInfo.dataV = nullptr;
-    EXPECT_FALSE(testDecodeDataProcess_->CheckParameters(srcInfo, dstInfo));
-
-    dstInfo.dataV = bytes;
-    srcInfo.width = -1;
-    EXPECT_FALSE(testDecodeDataProcess_->CheckParameters(srcInfo, dstInfo));
-
-    srcInfo.width = 1920;
-    srcInfo.height = -1;
-    EXPECT_FALSE(testDecodeDataProcess_->CheckParameters(srcInfo, dstInfo));
-
-    free(bytes);
-}
-
 /**
  * @tc.name: decode_data_process_test_028
  * @tc.desc: Verify decode data process func.
@@ -983,33 +804,6 @@ HWTEST_F(DecodeDataProcessTest, decode_data_process_test_028, TestSize.Level1)
     EXPECT_EQ(rc, DCAMERA_OK);
 }
 
-/**
- * @tc.name: decode_data_process_test_029
- * @tc.desc: Verify decode data process func.
- * @tc.type: FUNC
- * @tc.require: Issue Number
- */
-HWTEST_F(DecodeDataProcessTest, decode_data_process_test_029, TestSize.Level1)
-{
-    DHLOGI("DecodeDataProcessTest decode_data_process_test_029");
-    uint8_t* dataY = nullptr;
-    uint8_t* dataU = (uint8_t *)malloc(1);
-    uint8_t* dataV = (uint8_t *)malloc(1);
-    bool rc = testDecodeDataProcess_->FreeYUVBuffer(dataY, dataU, dataU);
-    EXPECT_EQ(rc, true);
-
-    dataY = (uint8_t *)malloc(1);
-    dataU = nullptr;
-    dataV = (uint8_t *)malloc(1);
-    rc = testDecodeDataProcess_->FreeYUVBuffer(dataY, dataU, dataU);
-    EXPECT_EQ(rc, true);
-    dataY = (uint8_t *)malloc(1);
-    dataU = (uint8_t *)malloc(1);;
-    dataV = nullptr;
-    rc = testDecodeDataProcess_->FreeYUVBuffer(dataY, dataU, dataV);
-    EXPECT_EQ(rc, true);
-}
-
 /**
  * @tc.name: decode_data_process_test_030
  * @tc.desc: Verify decode UpdateSettings func.
@@ -1044,6 +838,106 @@ HWTEST_F(DecodeDataProcessTest, decode_data_process_test_030, TestSize.Level1)
     rc = testDecodeDataProcess_->UpdateSettings(metaData);
     EXPECT_EQ(rc, DCAMERA_OK);
 }
+
+/**
+ * @tc.name: decode_data_process_test_031
+ * @tc.desc: Verify feeding waits for a decoder input slot instead of retrying.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DecodeDataProcessTest, decode_data_process_test_031, TestSize.Level1)
+{
+    DHLOGI("DecodeDataProcessTest decode_data_process_test_031");
+    size_t capacity = 100;
+    testDecodeDataProcess_->inputBuffersQueue_.push(std::make_shared<DataBuffer>(capacity));
+    testDecodeDataProcess_->isDecoderProcess_.store(true);
+    int32_t rc = testDecodeDataProcess_->FeedDecoderInputBuffer();
+    EXPECT_NE(rc, DCAMERA_OK);
+    EXPECT_TRUE(testDecodeDataProcess_->isInputStarved_);
+    EXPECT_EQ(testDecodeDataProcess_->inputBuffersQueue_.size(), 1);
+
+    testDecodeDataProcess_->isDecoderProcess_.store(false);
+    uint32_t index = 1;
+    std::shared_ptr<Media::AVSharedMemory> buffer = nullptr;
+    testDecodeDataProcess_->OnInputBufferAvailable(index, buffer);
+    EXPECT_FALSE(testDecodeDataProcess_->isInputStarved_);
+    EXPECT_EQ(testDecodeDataProcess_->availableInputIndexsQueue_.size(), 1);
+}
+
+/**
+ * @tc.name: decode_data_process_test_033
+ * @tc.desc: Verify the decoder writes a semi-planar target of the decoded size without converting it to I420.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DecodeDataProcessTest, decode_data_process_test_033, TestSize.Level1)
+{
+    DHLOGI("DecodeDataProcessTest decode_data_process_test_033");
+    testDecodeDataProcess_->sourceConfig_ = VideoConfigParams(VideoCodecType::CODEC_H264, Videoformat::NV21,
+        DCAMERA_PRODUCER_FPS_DEFAULT, TEST_WIDTH, TEST_HEIGTH);
+    testDecodeDataProcess_->targetConfig_ = VideoConfigParams(VideoCodecType::NO_CODEC, Videoformat::NV21,
+        DCAMERA_PRODUCER_FPS_DEFAULT, TEST_WIDTH, TEST_HEIGTH);
+    testDecodeDataProcess_->bounds_.pixelFormats.clear();
+    EXPECT_EQ(Videoformat::YUVI420, testDecodeDataProcess_->SelectOutputFormat());
+    testDecodeDataProcess_->bounds_.pixelFormats.push_back(
+        static_cast<int32_t>(MediaAVCodec::VideoPixelFormat::NV21));
+    EXPECT_EQ(Videoformat::NV21, testDecodeDataProcess_->SelectOutputFormat());
+    testDecodeDataProcess_->targetConfig_.SetVideoformat(Videoformat::NV12);
+    EXPECT_EQ(Videoformat::NV12, testDecodeDataProcess_->SelectOutputFormat());
+    testDecodeDataProcess_->targetConfig_.SetWidthAndHeight(TEST_WIDTH2, TEST_HEIGTH2);
+    EXPECT_EQ(Videoformat::YUVI420, testDecodeDataProcess_->SelectOutputFormat());
+
+    const int32_t width = 4;
+    const int32_t height = 2;
+    const int32_t alignedWidth = 8;
+    uint8_t srcY[alignedWidth * height];
+    uint8_t srcUV[alignedWidth * height / 2];
+    for (int32_t i = 0; i < alignedWidth * height; i++) {
+        srcY[i] = static_cast<uint8_t>(i);
+    }
+    for (int32_t i = 0; i < alignedWidth * height / 2; i++) {
+        srcUV[i] = static_cast<uint8_t>(i + alignedWidth * height);
+    }
+    testDecodeDataProcess_->processedConfig_.SetWidthAndHeight(width, height);
+    std::shared_ptr<DataBuffer> output = std::make_shared<DataBuffer>(width * height * 3 / 2);
+    testDecodeDataProcess_->CopySemiPlanar(srcY, srcUV, alignedWidth, output);
+    EXPECT_EQ(srcY[alignedWidth], output->Data()[width]);
+    EXPECT_EQ(srcUV[width - 1], output->Data()[width * height + width - 1]);
+}
 #endif
+
+/**
+ * @tc.name: decode_data_process_test_032
+ * @tc.desc: Verify the decoder range follows the codec bounds and the input guard scales with the resolution.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(DecodeDataProcessTest, decode_data_process_test_032, TestSize.Level1)
+{
+    DHLOGI("DecodeDataProcessTest decode_data_process_test_032");
+    const int32_t uhdWidth = 3840;
+    const int32_t uhdHeight = 2160;
+    const int32_t highFrameRate = 60;
+    VideoCapabilityBounds defaults { TEST_WIDTH, TEST_HEIGTH, DCAMERA_PRODUCER_FPS_DEFAULT };
+    VideoCapabilityBounds bounds = DCameraCodecCapability::GetInstance().GetBounds(VideoCodecType::NO_CODEC,
+        false, defaults);
+    EXPECT_EQ(TEST_WIDTH, bounds.maxWidth);
+    EXPECT_EQ(DCAMERA_PRODUCER_FPS_DEFAULT, bounds.maxFrameRate);
+
+    VideoConfigParams uhdParams(VideoCodecType::CODEC_H264, Videoformat::NV12, highFrameRate, uhdWidth, uhdHeight);
+    testDecodeDataProcess_->bounds_ = { uhdWidth, uhdHeight, highFrameRate };
+    EXPECT_TRUE(testDecodeDataProcess_->IsInDecoderRange(uhdParams));
+    uhdParams.SetFrameRate(highFrameRate + 1);
+    EXPECT_FALSE(testDecodeDataProcess_->IsInDecoderRange(uhdParams));
+
+    const int32_t defaultSize = 100;
+    const int32_t yuvBytes = 3;
+    const int32_t yuvDivisor = 2;
+    testDecodeDataProcess_->sourceConfig_ = uhdParams;
+    EXPECT_EQ(uhdWidth * uhdHeight * yuvBytes / yuvDivisor * 2,
+        testDecodeDataProcess_->CalMaxInputSize(defaultSize, yuvBytes, yuvDivisor));
+    testDecodeDataProcess_->sourceConfig_.SetWidthAndHeight(1, 1);
+    EXPECT_EQ(defaultSize, testDecodeDataProcess_->CalMaxInputSize(defaultSize, yuvBytes, yuvDivisor));
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -297,5 +297,57 @@ HWTEST_F(EISDataProcessTest, eis_data_process_test_013, TestSize.Level1)
     EXPECT_EQ(true, testEISDataProcess_ == nullptr);
 }
  
+/**
+ * @tc.name: eis_data_process_test_014
+ * @tc.desc: Verify EIS holds the look-ahead frames and crops the margin back to the target size.
+ * @tc.type: FUNC
+ */
+HWTEST_F(EISDataProcessTest, eis_data_process_test_014, TestSize.Level1)
+{
+    VideoConfigParams destParams(VideoCodecType::NO_CODEC, Videoformat::NV21, 30, 64, 36);
+    VideoConfigParams srcParams = EISDataProcess::GetMarginConfig(destParams);
+    EXPECT_EQ(70, srcParams.GetWidth());
+    EXPECT_EQ(38, srcParams.GetHeight());
+    VideoConfigParams procConfig;
+    int32_t rc = testEISDataProcess_->InitNode(srcParams, destParams, procConfig);
+    EXPECT_EQ(rc, DCAMERA_OK);
+    EXPECT_EQ(true, testEISDataProcess_->isStabilizing_);
+    EXPECT_EQ(destParams.GetWidth(), procConfig.GetWidth());
+    EXPECT_EQ(destParams.GetHeight(), procConfig.GetHeight());
+
+    auto pipelineSource = std::make_shared<DCameraPipelineSource>();
+    testEISDataProcess_->callbackPipelineSource_ = pipelineSource;
+    size_t lookAhead = EISDataProcess::GetLookAheadFrames();
+    size_t frameSize = static_cast<size_t>(srcParams.GetWidth() * srcParams.GetHeight() * 3 / 2);
+    for (size_t i = 0; i < lookAhead; i++) {
+        std::vector<std::shared_ptr<DataBuffer>> inputBuffers = { std::make_shared<DataBuffer>(frameSize) };
+        inputBuffers[0]->eisInfo_.frameTimeStamp = static_cast<int64_t>(i + 1) * 33000;
+        EXPECT_EQ(DCAMERA_OK, testEISDataProcess_->ProcessData(inputBuffers));
+    }
+    EXPECT_EQ(lookAhead, testEISDataProcess_->pendingFrames_.size());
+
+    std::shared_ptr<DataBuffer> frame = std::make_shared<DataBuffer>(frameSize);
+    for (size_t i = 0; i < frameSize; i++) {
+        frame->Data()[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    EisCropOffset offset;
+    EXPECT_EQ(nullptr, testEISDataProcess_->CropFrame(frame, offset));
+    frame->SetInt32(DataBufferKey::VIDEO_FORMAT, static_cast<int32_t>(Videoformat::NV21));
+    frame->SetInt32(DataBufferKey::WIDTH, srcParams.GetWidth());
+    frame->SetInt32(DataBufferKey::HEIGHT, srcParams.GetHeight());
+    offset.x = 2;
+    offset.y = 2;
+    std::shared_ptr<DataBuffer> cropped = testEISDataProcess_->CropFrame(frame, offset);
+    ASSERT_NE(nullptr, cropped);
+    int32_t width = 0;
+    EXPECT_TRUE(cropped->FindInt32(DataBufferKey::WIDTH, width));
+    EXPECT_EQ(destParams.GetWidth(), width);
+    EXPECT_EQ(static_cast<size_t>(destParams.GetWidth() * destParams.GetHeight() * 3 / 2), cropped->Size());
+    EXPECT_EQ(frame->Data()[offset.y * srcParams.GetWidth() + offset.x], cropped->Data()[0]);
+
+    testEISDataProcess_->ReleaseProcessNode();
+    EXPECT_TRUE(testEISDataProcess_->pendingFrames_.empty());
+}
+
 } // namespace DistributedHardware
 } // namespace OHOS
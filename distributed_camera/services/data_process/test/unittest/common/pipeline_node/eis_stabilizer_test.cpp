@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "eis_stabilizer.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const int32_t TEST_MARGIN_X = 64;
+const int32_t TEST_MARGIN_Y = 36;
+const double TEST_FOCAL_LENGTH = 1000.0;
+const int64_t TEST_FRAME_NS = 33000000;
+const int32_t TEST_SAMPLES_PER_FRAME = 10;
+
+// Gyro samples covering one frame interval at a constant rate.
+std::vector<ImuSample> MakeGyro(size_t frame, float rateX, float rateY)
+{
+    std::vector<ImuSample> samples;
+    int64_t step = TEST_FRAME_NS / TEST_SAMPLES_PER_FRAME;
+    for (int32_t i = 1; i <= TEST_SAMPLES_PER_FRAME; i++) {
+        ImuSample sample;
+        sample.timeStamp = static_cast<int64_t>(frame) * TEST_FRAME_NS + i * step;
+        sample.data[IMU_X] = rateX;
+        sample.data[IMU_Y] = rateY;
+        samples.push_back(sample);
+    }
+    return samples;
+}
+}
+
+class EISStabilizerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    EISStabilizer stabilizer_;
+};
+
+void EISStabilizerTest::SetUpTestCase(void)
+{
+}
+
+void EISStabilizerTest::TearDownTestCase(void)
+{
+}
+
+void EISStabilizerTest::SetUp(void)
+{
+}
+
+void EISStabilizerTest::TearDown(void)
+{
+    stabilizer_.Reset();
+}
+
+/**
+ * @tc.name: eis_stabilizer_test_001
+ * @tc.desc: Verify frames are held for the look-ahead window and a still camera stays centered.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(EISStabilizerTest, eis_stabilizer_test_001, TestSize.Level1)
+{
+    const size_t lookAhead = 3;
+    stabilizer_.Init(TEST_MARGIN_X, TEST_MARGIN_Y, TEST_FOCAL_LENGTH, lookAhead);
+    EisCropOffset offset;
+    for (size_t frame = 0; frame < lookAhead; frame++) {
+        stabilizer_.AddFrame(MakeGyro(frame, 0.0f, 0.0f));
+        EXPECT_FALSE(stabilizer_.GetReadyOffset(offset));
+    }
+    EXPECT_EQ(lookAhead, stabilizer_.GetPendingCount());
+    stabilizer_.AddFrame(MakeGyro(lookAhead, 0.0f, 0.0f));
+    EXPECT_TRUE(stabilizer_.GetReadyOffset(offset));
+    EXPECT_FALSE(stabilizer_.GetReadyOffset(offset));
+    EXPECT_EQ(TEST_MARGIN_X / 2, offset.x);
+    EXPECT_EQ(TEST_MARGIN_Y / 2, offset.y);
+
+    stabilizer_.Init(TEST_MARGIN_X, TEST_MARGIN_Y, TEST_FOCAL_LENGTH, 0);
+    stabilizer_.AddFrame(MakeGyro(0, 0.0f, 0.0f));
+    EXPECT_TRUE(stabilizer_.GetReadyOffset(offset));
+    EXPECT_EQ(0, stabilizer_.GetPendingCount());
+}
+
+/**
+ * @tc.name: eis_stabilizer_test_002
+ * @tc.desc: Verify a single shake is compensated against its neighbours and the offset stays in the margin.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(EISStabilizerTest, eis_stabilizer_test_002, TestSize.Level1)
+{
+    const size_t lookAhead = 2;
+    const size_t shakeFrame = 4;
+    const float shakeRate = 0.3f;
+    stabilizer_.Init(TEST_MARGIN_X, TEST_MARGIN_Y, TEST_FOCAL_LENGTH, lookAhead);
+    std::vector<EisCropOffset> offsets;
+    for (size_t frame = 0; frame < shakeFrame + lookAhead + 1; frame++) {
+        float rate = (frame == shakeFrame) ? shakeRate : ((frame == shakeFrame + 1) ? -shakeRate : 0.0f);
+        stabilizer_.AddFrame(MakeGyro(frame, -rate, rate));
+        EisCropOffset offset;
+        while (stabilizer_.GetReadyOffset(offset)) {
+            offsets.push_back(offset);
+        }
+    }
+    ASSERT_EQ(shakeFrame + 1, offsets.size());
+    EXPECT_EQ(TEST_MARGIN_X / 2, offsets[0].x);
+    // The camera turned left and down on the shake frame, the window follows the scene right and up.
+    EXPECT_GT(offsets[shakeFrame].x, TEST_MARGIN_X / 2);
+    EXPECT_LT(offsets[shakeFrame].y, TEST_MARGIN_Y / 2);
+    for (const auto& offset : offsets) {
+        EXPECT_GE(offset.x, 0);
+        EXPECT_LE(offset.x, TEST_MARGIN_X);
+        EXPECT_GE(offset.y, 0);
+        EXPECT_LE(offset.y, TEST_MARGIN_Y);
+        EXPECT_EQ(0, offset.x % 2);
+        EXPECT_EQ(0, offset.y % 2);
+    }
+
+    stabilizer_.Init(TEST_MARGIN_X, TEST_MARGIN_Y, TEST_FOCAL_LENGTH * TEST_FOCAL_LENGTH, 0);
+    stabilizer_.AddFrame(MakeGyro(0, 0.0f, 0.0f));
+    stabilizer_.AddFrame(MakeGyro(1, shakeRate, shakeRate));
+    EisCropOffset offset;
+    EXPECT_TRUE(stabilizer_.GetReadyOffset(offset));
+    EXPECT_TRUE(stabilizer_.GetReadyOffset(offset));
+    EXPECT_EQ(TEST_MARGIN_X, offset.x);
+    EXPECT_EQ(TEST_MARGIN_Y, offset.y);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
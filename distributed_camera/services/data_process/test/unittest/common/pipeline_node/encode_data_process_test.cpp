@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -71,7 +71,7 @@ HWTEST_F(EncodeDataProcessTest, encode_data_process_test_001, TestSize.Level1)
 {
     EXPECT_EQ(false, testEncodeDataProcess_ == nullptr);
 
-    int32_t frameRate = 50;
+    int32_t frameRate = DCameraCodecCapability::MAX_FRAME_RATE_LIMIT + 1;
     VideoConfigParams srcParams(VideoCodecType::CODEC_H264,
                                 Videoformat::YUVI420,
                                 frameRate,
@@ -574,17 +574,60 @@ HWTEST_F(EncodeDataProcessTest, encode_data_process_test_018, TestSize.Level1)
 HWTEST_F(EncodeDataProcessTest, encode_data_process_test_019, TestSize.Level1)
 {
     ASSERT_NE(testEncodeDataProcess_, nullptr);
-    testEncodeDataProcess_->currentBitrate_ = 3400000;
+    testEncodeDataProcess_->currentBitrate_ = 1800000;
     testEncodeDataProcess_->maxBitrate_ = 3400000;
-    testEncodeDataProcess_->AdjustBitrateBasedOnNetworkConditions(true);
-    EXPECT_EQ(testEncodeDataProcess_->currentBitrate_, testEncodeDataProcess_->maxBitrate_);
-    testEncodeDataProcess_->currentBitrate_ = 1500000;
     testEncodeDataProcess_->minBitrate_ = 1500000;
-    testEncodeDataProcess_->AdjustBitrateBasedOnNetworkConditions(false);
-    EXPECT_EQ(testEncodeDataProcess_->currentBitrate_, testEncodeDataProcess_->minBitrate_);
-    testEncodeDataProcess_->currentBitrate_ = 1800000;
-    testEncodeDataProcess_->AdjustBitrateBasedOnNetworkConditions(true);
+    EXPECT_EQ(testEncodeDataProcess_->RoundBitrates(6000000), testEncodeDataProcess_->maxBitrate_);
+    EXPECT_EQ(testEncodeDataProcess_->RoundBitrates(500000), testEncodeDataProcess_->minBitrate_);
+    EXPECT_EQ(DCAMERA_BAD_VALUE, testEncodeDataProcess_->SetEncoderBitrate(3400000));
+    EXPECT_EQ(DCAMERA_BAD_VALUE, testEncodeDataProcess_->RequestKeyFrame());
     EXPECT_EQ(testEncodeDataProcess_->currentBitrate_, 1800000);
+    EXPECT_NO_FATAL_FAILURE(testEncodeDataProcess_->ApplyBitrateDecision());
+}
+
+/**
+ * @tc.name: encode_data_process_test_020
+ * @tc.desc: Verify loss resilient encoding stretches the IDR period and only asks for supported LTR frames.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(EncodeDataProcessTest, encode_data_process_test_020, TestSize.Level1)
+{
+    ASSERT_NE(testEncodeDataProcess_, nullptr);
+    testEncodeDataProcess_->bounds_.maxLtrFrameCount = 0;
+    testEncodeDataProcess_->InitLossResilientFormat();
+    int32_t value = 0;
+    EXPECT_TRUE(testEncodeDataProcess_->metadataFormat_.GetIntValue("i_frame_interval", value));
+    EXPECT_EQ(EncodeDataProcess::RESILIENT_IDR_FRAME_INTERVAL_MS, value);
+    EXPECT_FALSE(testEncodeDataProcess_->metadataFormat_.GetIntValue(EncodeDataProcess::LTR_FRAME_COUNT_KEY, value));
+
+    testEncodeDataProcess_->bounds_.maxLtrFrameCount = 1;
+    testEncodeDataProcess_->InitLossResilientFormat();
+    EXPECT_TRUE(testEncodeDataProcess_->metadataFormat_.GetIntValue(EncodeDataProcess::LTR_FRAME_COUNT_KEY, value));
+    EXPECT_EQ(1, value);
+}
+
+/**
+ * @tc.name: encode_data_process_test_021
+ * @tc.desc: Verify the high tier only asks for AVC high profile when the hardware encoder lists it.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(EncodeDataProcessTest, encode_data_process_test_021, TestSize.Level1)
+{
+    ASSERT_NE(testEncodeDataProcess_, nullptr);
+    testEncodeDataProcess_->targetConfig_.SetVideoCodecType(VideoCodecType::CODEC_H264);
+    testEncodeDataProcess_->preset_ = DCameraEncoderPreset::GetPreset(EncoderTier::HIGH);
+    testEncodeDataProcess_->bounds_.profiles.clear();
+    EXPECT_FALSE(testEncodeDataProcess_->IsHighProfileSupported());
+    testEncodeDataProcess_->bounds_.profiles.push_back(
+        static_cast<int32_t>(MediaAVCodec::AVCProfile::AVC_PROFILE_HIGH));
+    EXPECT_TRUE(testEncodeDataProcess_->IsHighProfileSupported());
+
+    testEncodeDataProcess_->preset_ = DCameraEncoderPreset::GetPreset(EncoderTier::MID);
+    EXPECT_FALSE(testEncodeDataProcess_->IsHighProfileSupported());
+    testEncodeDataProcess_->presetGovernor_.Init(DCAMERA_PRODUCER_FPS_DEFAULT);
+    EXPECT_NO_FATAL_FAILURE(testEncodeDataProcess_->ApplyEncoderThrottle());
 }
 } // namespace DistributedHardware
 } // namespace OHOS
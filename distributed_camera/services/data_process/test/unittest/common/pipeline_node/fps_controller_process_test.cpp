@@ -40,6 +40,11 @@ const int32_t TEST_WIDTH = 1920;
 const int32_t TEST_HEIGTH = 1080;
 const int32_t TEST_WIDTH2 = 640;
 const int32_t TEST_HEIGTH2 = 480;
+const int32_t TEST_TARGET_FPS = 15;
+const int64_t TEST_FRAME_INTERVAL_MS = 33;
+const int64_t TEST_START_MS = 1000;
+const int32_t TEST_RING_FRAME_NUM = 100;
+const int32_t TEST_DROP_CHECK_NUM = 10;
 }
 
 void FpsControllerProcessTest::SetUpTestCase(void)
@@ -314,5 +319,42 @@ HWTEST_F(FpsControllerProcessTest, fps_controller_process_test_008, TestSize.Lev
     EXPECT_EQ(brc, false);
     EXPECT_EQ(rc, DCAMERA_OK);
 }
+
+/**
+ * @tc.name: fps_controller_process_test_009
+ * @tc.desc: Verify the frame time ring keeps the newest frames of the window and the rate is halved uniformly.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(FpsControllerProcessTest, fps_controller_process_test_009, TestSize.Level1)
+{
+    VideoConfigParams srcParams(VideoCodecType::CODEC_H264, Videoformat::NV12, DCAMERA_PRODUCER_FPS_DEFAULT,
+        TEST_WIDTH, TEST_HEIGTH);
+    VideoConfigParams destParams(VideoCodecType::CODEC_H264, Videoformat::NV21, TEST_TARGET_FPS, TEST_WIDTH,
+        TEST_HEIGTH);
+    VideoConfigParams procConfig;
+    ASSERT_EQ(DCAMERA_OK, testFpsControllerProcess_->InitNode(srcParams, destParams, procConfig));
+
+    int64_t nowMs = TEST_START_MS;
+    for (int32_t i = 0; i < TEST_RING_FRAME_NUM; i++) {
+        nowMs = TEST_START_MS + i * TEST_FRAME_INTERVAL_MS;
+        testFpsControllerProcess_->UpdateIncomingFrameTimes(nowMs);
+    }
+    EXPECT_EQ(static_cast<size_t>(FpsControllerProcess::INCOME_FRAME_TIME_HISTORY_WINDOWS_SIZE),
+        testFpsControllerProcess_->frameTimesCount_);
+    float fps = testFpsControllerProcess_->CalculateFrameRate(nowMs);
+    EXPECT_EQ(TEST_TARGET_FPS * 2, static_cast<int32_t>(fps));
+    int32_t dropCount = 0;
+    for (int32_t i = 0; i < TEST_DROP_CHECK_NUM; i++) {
+        if (testFpsControllerProcess_->IsDropFrame(fps)) {
+            dropCount++;
+        }
+    }
+    EXPECT_EQ(TEST_DROP_CHECK_NUM / 2, dropCount);
+
+    fps = testFpsControllerProcess_->CalculateFrameRate(nowMs + FpsControllerProcess::FRAME_HISTORY_TIME_WINDOWS_MS);
+    EXPECT_EQ(1, static_cast<int32_t>(fps));
+    EXPECT_FALSE(testFpsControllerProcess_->IsDropFrame(fps));
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "image_plane_kernels.h"
+#include "distributed_camera_errno.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+class ImagePlaneKernelsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+namespace {
+const int32_t TEST_WIDTH = 37;
+const int32_t TEST_HEIGHT = 5;
+const int32_t TEST_STRIDE = 48;
+
+std::vector<uint8_t> MakePattern(size_t size)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    return data;
+}
+}
+
+void ImagePlaneKernelsTest::SetUpTestCase(void)
+{
+}
+
+void ImagePlaneKernelsTest::TearDownTestCase(void)
+{
+}
+
+void ImagePlaneKernelsTest::SetUp(void)
+{
+}
+
+void ImagePlaneKernelsTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: image_plane_kernels_test_001
+ * @tc.desc: Verify SplitUVPlane and MergeUVPlane round trip on strided planes.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(ImagePlaneKernelsTest, image_plane_kernels_test_001, TestSize.Level1)
+{
+    EXPECT_NE(nullptr, ImagePlaneKernels::GetIsaName());
+    std::vector<uint8_t> uv = MakePattern(TEST_STRIDE * 2 * TEST_HEIGHT);
+    std::vector<uint8_t> u(TEST_STRIDE * TEST_HEIGHT, 0);
+    std::vector<uint8_t> v(TEST_STRIDE * TEST_HEIGHT, 0);
+    ImagePlaneKernels::SplitUVPlane(uv.data(), TEST_STRIDE * 2, u.data(), TEST_STRIDE, v.data(), TEST_STRIDE,
+        TEST_WIDTH, TEST_HEIGHT);
+    for (int32_t y = 0; y < TEST_HEIGHT; y++) {
+        for (int32_t x = 0; x < TEST_WIDTH; x++) {
+            EXPECT_EQ(uv[y * TEST_STRIDE * 2 + x * 2], u[y * TEST_STRIDE + x]);
+            EXPECT_EQ(uv[y * TEST_STRIDE * 2 + x * 2 + 1], v[y * TEST_STRIDE + x]);
+        }
+    }
+
+    std::vector<uint8_t> merged(TEST_STRIDE * 2 * TEST_HEIGHT, 0);
+    ImagePlaneKernels::MergeUVPlane(u.data(), TEST_STRIDE, v.data(), TEST_STRIDE, merged.data(), TEST_STRIDE * 2,
+        TEST_WIDTH, TEST_HEIGHT);
+    for (int32_t y = 0; y < TEST_HEIGHT; y++) {
+        for (int32_t x = 0; x < TEST_WIDTH * 2; x++) {
+            EXPECT_EQ(uv[y * TEST_STRIDE * 2 + x], merged[y * TEST_STRIDE * 2 + x]);
+        }
+    }
+}
+
+/**
+ * @tc.name: image_plane_kernels_test_002
+ * @tc.desc: Verify RotatePlane for every supported angle.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(ImagePlaneKernelsTest, image_plane_kernels_test_002, TestSize.Level1)
+{
+    std::vector<uint8_t> src = MakePattern(TEST_STRIDE * TEST_HEIGHT);
+    std::vector<uint8_t> dst(TEST_STRIDE * TEST_STRIDE, 0);
+    auto srcAt = [&src](int32_t x, int32_t y) { return src[y * TEST_STRIDE + x]; };
+
+    EXPECT_EQ(DCAMERA_OK, ImagePlaneKernels::RotatePlane(src.data(), TEST_STRIDE, dst.data(), TEST_STRIDE,
+        TEST_WIDTH, TEST_HEIGHT, 180));
+    for (int32_t y = 0; y < TEST_HEIGHT; y++) {
+        for (int32_t x = 0; x < TEST_WIDTH; x++) {
+            EXPECT_EQ(srcAt(TEST_WIDTH - 1 - x, TEST_HEIGHT - 1 - y), dst[y * TEST_STRIDE + x]);
+        }
+    }
+
+    EXPECT_EQ(DCAMERA_OK, ImagePlaneKernels::RotatePlane(src.data(), TEST_STRIDE, dst.data(), TEST_HEIGHT,
+        TEST_WIDTH, TEST_HEIGHT, 90));
+    for (int32_t y = 0; y < TEST_WIDTH; y++) {
+        for (int32_t x = 0; x < TEST_HEIGHT; x++) {
+            EXPECT_EQ(srcAt(y, TEST_HEIGHT - 1 - x), dst[y * TEST_HEIGHT + x]);
+        }
+    }
+
+    EXPECT_EQ(DCAMERA_OK, ImagePlaneKernels::RotatePlane(src.data(), TEST_STRIDE, dst.data(), TEST_HEIGHT,
+        TEST_WIDTH, TEST_HEIGHT, 270));
+    for (int32_t y = 0; y < TEST_WIDTH; y++) {
+        for (int32_t x = 0; x < TEST_HEIGHT; x++) {
+            EXPECT_EQ(srcAt(TEST_WIDTH - 1 - y, x), dst[y * TEST_HEIGHT + x]);
+        }
+    }
+
+    EXPECT_EQ(DCAMERA_BAD_VALUE, ImagePlaneKernels::RotatePlane(src.data(), TEST_STRIDE, dst.data(), TEST_STRIDE,
+        TEST_WIDTH, TEST_HEIGHT, 45));
+    EXPECT_EQ(DCAMERA_BAD_VALUE, ImagePlaneKernels::RotatePlane(src.data(), TEST_STRIDE, src.data(), TEST_STRIDE,
+        TEST_WIDTH, TEST_HEIGHT, 180));
+}
+
+/**
+ * @tc.name: image_plane_kernels_test_003
+ * @tc.desc: Verify NV12ToI420, CopyPlane and SwapPlanes.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(ImagePlaneKernelsTest, image_plane_kernels_test_003, TestSize.Level1)
+{
+    const int32_t width = 70;
+    const int32_t height = 6;
+    std::vector<uint8_t> nv12 = MakePattern(width * height * 3 / 2);
+    std::vector<uint8_t> i420(width * height * 3 / 2, 0);
+    uint8_t *dstU = i420.data() + width * height;
+    uint8_t *dstV = dstU + width * height / 4;
+    EXPECT_EQ(DCAMERA_OK, ImagePlaneKernels::NV12ToI420(nv12.data(), width, nv12.data() + width * height, width,
+        i420.data(), width, dstU, width / 2, dstV, width / 2, width, height));
+    for (int32_t i = 0; i < width * height; i++) {
+        EXPECT_EQ(nv12[i], i420[i]);
+    }
+    for (int32_t i = 0; i < width * height / 4; i++) {
+        EXPECT_EQ(nv12[width * height + i * 2], dstU[i]);
+        EXPECT_EQ(nv12[width * height + i * 2 + 1], dstV[i]);
+    }
+
+    std::vector<uint8_t> planeA = MakePattern(width);
+    std::vector<uint8_t> planeB(width, 1);
+    std::vector<uint8_t> copyA(planeA);
+    ImagePlaneKernels::SwapPlanes(planeA.data(), planeB.data(), width);
+    EXPECT_EQ(copyA, planeB);
+    EXPECT_EQ(std::vector<uint8_t>(width, 1), planeA);
+
+    std::vector<uint8_t> cropped(TEST_WIDTH * TEST_HEIGHT, 0);
+    std::vector<uint8_t> src = MakePattern(TEST_STRIDE * TEST_HEIGHT);
+    ImagePlaneKernels::CopyPlane(src.data() + 1, TEST_STRIDE, cropped.data(), TEST_WIDTH, TEST_WIDTH, TEST_HEIGHT);
+    for (int32_t y = 0; y < TEST_HEIGHT; y++) {
+        for (int32_t x = 0; x < TEST_WIDTH; x++) {
+            EXPECT_EQ(src[y * TEST_STRIDE + x + 1], cropped[y * TEST_WIDTH + x]);
+        }
+    }
+}
+
+/**
+ * @tc.name: image_plane_kernels_test_004
+ * @tc.desc: Verify CropYUV420 for planar and semi-planar images and out of range windows.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(ImagePlaneKernelsTest, image_plane_kernels_test_004, TestSize.Level1)
+{
+    const int32_t srcWidth = 40;
+    const int32_t srcHeight = 12;
+    const int32_t dstWidth = 32;
+    const int32_t dstHeight = 8;
+    const int32_t offsetX = 6;
+    const int32_t offsetY = 2;
+    std::vector<uint8_t> src = MakePattern(srcWidth * srcHeight * 3 / 2);
+    std::vector<uint8_t> dst(dstWidth * dstHeight * 3 / 2, 0);
+    EXPECT_EQ(DCAMERA_BAD_VALUE, ImagePlaneKernels::CropYUV420(src.data(), srcWidth, srcHeight, dst.data(),
+        dstWidth, dstHeight, srcWidth - dstWidth + 2, 0, false));
+    EXPECT_EQ(DCAMERA_BAD_VALUE, ImagePlaneKernels::CropYUV420(nullptr, srcWidth, srcHeight, dst.data(),
+        dstWidth, dstHeight, 0, 0, false));
+
+    EXPECT_EQ(DCAMERA_OK, ImagePlaneKernels::CropYUV420(src.data(), srcWidth, srcHeight, dst.data(), dstWidth,
+        dstHeight, offsetX, offsetY, false));
+    for (int32_t y = 0; y < dstHeight; y++) {
+        for (int32_t x = 0; x < dstWidth; x++) {
+            EXPECT_EQ(src[(y + offsetY) * srcWidth + x + offsetX], dst[y * dstWidth + x]);
+        }
+    }
+    const uint8_t *srcV = src.data() + srcWidth * srcHeight * 5 / 4;
+    const uint8_t *dstV = dst.data() + dstWidth * dstHeight * 5 / 4;
+    for (int32_t y = 0; y < dstHeight / 2; y++) {
+        for (int32_t x = 0; x < dstWidth / 2; x++) {
+            EXPECT_EQ(srcV[(y + offsetY / 2) * srcWidth / 2 + x + offsetX / 2], dstV[y * dstWidth / 2 + x]);
+        }
+    }
+
+    EXPECT_EQ(DCAMERA_OK, ImagePlaneKernels::CropYUV420(src.data(), srcWidth, srcHeight, dst.data(), dstWidth,
+        dstHeight, offsetX, offsetY, true));
+    const uint8_t *srcUV = src.data() + srcWidth * srcHeight;
+    const uint8_t *dstUV = dst.data() + dstWidth * dstHeight;
+    for (int32_t y = 0; y < dstHeight / 2; y++) {
+        for (int32_t x = 0; x < dstWidth; x++) {
+            EXPECT_EQ(srcUV[(y + offsetY / 2) * srcWidth + x + offsetX], dstUV[y * dstWidth + x]);
+        }
+    }
+}
+
+/**
+ * @tc.name: image_plane_kernels_test_005
+ * @tc.desc: Verify RemapPlane straight, transposed, with fill entries and into interleaved chroma.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(ImagePlaneKernelsTest, image_plane_kernels_test_005, TestSize.Level1)
+{
+    const int32_t width = 12;
+    const int32_t height = 10;
+    const uint8_t fillValue = 0x80;
+    std::vector<uint8_t> src = MakePattern(TEST_STRIDE * TEST_HEIGHT);
+    std::vector<int32_t> colMap(width);
+    std::vector<int32_t> rowMap(height);
+    for (int32_t x = 0; x < width; x++) {
+        colMap[x] = (x == 0) ? -1 : (width - 1 - x) % TEST_HEIGHT;
+    }
+    for (int32_t y = 0; y < height; y++) {
+        rowMap[y] = (y == height - 1) ? -1 : y * 3;
+    }
+    std::vector<uint8_t> dst(width * height, 0);
+    EXPECT_EQ(DCAMERA_BAD_VALUE, ImagePlaneKernels::RemapPlane(nullptr, TEST_STRIDE, 1, dst.data(), width, 1,
+        colMap.data(), width, rowMap.data(), height, true, fillValue));
+    EXPECT_EQ(DCAMERA_BAD_VALUE, ImagePlaneKernels::RemapPlane(src.data(), TEST_STRIDE, 1, dst.data(), width - 1, 1,
+        colMap.data(), width, rowMap.data(), height, true, fillValue));
+
+    EXPECT_EQ(DCAMERA_OK, ImagePlaneKernels::RemapPlane(src.data(), TEST_STRIDE, 1, dst.data(), width, 1,
+        colMap.data(), width, rowMap.data(), height, true, fillValue));
+    for (int32_t y = 0; y < height; y++) {
+        for (int32_t x = 0; x < width; x++) {
+            uint8_t expect = (colMap[x] < 0 || rowMap[y] < 0) ? fillValue :
+                src[colMap[x] * TEST_STRIDE + rowMap[y]];
+            EXPECT_EQ(expect, dst[y * width + x]);
+        }
+    }
+
+    std::vector<uint8_t> semiPlanar(width * 2 * TEST_HEIGHT, 0);
+    EXPECT_EQ(DCAMERA_OK, ImagePlaneKernels::RemapPlane(src.data(), TEST_STRIDE, 1, semiPlanar.data() + 1,
+        width * 2, 2, rowMap.data(), width - 2, colMap.data() + 1, TEST_HEIGHT, false, fillValue));
+    for (int32_t y = 0; y < TEST_HEIGHT; y++) {
+        for (int32_t x = 0; x < width - 2; x++) {
+            uint8_t expect = (rowMap[x] < 0) ? fillValue : src[colMap[y + 1] * TEST_STRIDE + rowMap[x]];
+            EXPECT_EQ(0, semiPlanar[y * width * 2 + x * 2]);
+            EXPECT_EQ(expect, semiPlanar[y * width * 2 + x * 2 + 1]);
+        }
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "rotate_letterbox_process.h"
+
+#include "data_buffer.h"
+#include "distributed_camera_errno.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+class RotateLetterboxProcessTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<RotateLetterboxProcess> testRotateProcess_;
+};
+
+namespace {
+const int32_t TEST_WIDTH = 44;
+const int32_t TEST_HEIGHT = 20;
+const int32_t TEST_FPS = 30;
+
+std::shared_ptr<DataBuffer> MakeI420Frame(int32_t width, int32_t height)
+{
+    size_t size = static_cast<size_t>(width * height * 3 / 2);
+    std::shared_ptr<DataBuffer> frame = std::make_shared<DataBuffer>(size);
+    for (size_t i = 0; i < size; i++) {
+        frame->Data()[i] = static_cast<uint8_t>(i * 13 + 5);
+    }
+    frame->SetInt32(DataBufferKey::VIDEO_FORMAT, static_cast<int32_t>(Videoformat::YUVI420));
+    frame->SetInt32(DataBufferKey::WIDTH, width);
+    frame->SetInt32(DataBufferKey::HEIGHT, height);
+    return frame;
+}
+
+// Reference letterbox: rotate the whole plane, crop the centered square and paste it centered.
+std::vector<uint8_t> ReferencePlane(const uint8_t *src, int32_t width, int32_t height, int32_t cropX,
+    int32_t cropY, int32_t pasteX, int32_t pasteY, int32_t size, bool clockwise, uint8_t fill)
+{
+    std::vector<uint8_t> rotated(width * height);
+    for (int32_t y = 0; y < width; y++) {
+        for (int32_t x = 0; x < height; x++) {
+            rotated[y * height + x] = clockwise ? src[(height - 1 - x) * width + y] : src[x * width + width - 1 - y];
+        }
+    }
+    std::vector<uint8_t> dst(width * height, fill);
+    for (int32_t y = 0; y < size; y++) {
+        for (int32_t x = 0; x < size; x++) {
+            dst[(pasteY + y) * width + pasteX + x] = rotated[(cropY + y) * height + cropX + x];
+        }
+    }
+    return dst;
+}
+
+void ExpectLetterbox(const std::vector<uint8_t>& src, const std::shared_ptr<DataBuffer>& frame, int32_t width,
+    int32_t height, bool clockwise)
+{
+    int32_t size = std::min(width, height);
+    int32_t pasteX = ((width - size) / 2) & ~1;
+    int32_t pasteY = ((height - size) / 2) & ~1;
+    std::vector<uint8_t> refY = ReferencePlane(src.data(), width, height, pasteY, pasteX, pasteX, pasteY, size,
+        clockwise, 0);
+    EXPECT_EQ(refY, std::vector<uint8_t>(frame->Data(), frame->Data() + width * height));
+    int32_t sizeUV = width * height / 4;
+    for (int32_t plane = 0; plane < 2; plane++) {
+        const uint8_t *srcUV = src.data() + width * height + plane * sizeUV;
+        std::vector<uint8_t> refUV = ReferencePlane(srcUV, width / 2, height / 2, pasteY / 2, pasteX / 2,
+            pasteX / 2, pasteY / 2, size / 2, clockwise, 128);
+        const uint8_t *dstUV = frame->Data() + width * height + plane * sizeUV;
+        EXPECT_EQ(refUV, std::vector<uint8_t>(dstUV, dstUV + sizeUV));
+    }
+}
+}
+
+void RotateLetterboxProcessTest::SetUpTestCase(void)
+{
+}
+
+void RotateLetterboxProcessTest::TearDownTestCase(void)
+{
+}
+
+void RotateLetterboxProcessTest::SetUp(void)
+{
+    std::shared_ptr<DCameraPipelineSource> sourcePipeline = std::make_shared<DCameraPipelineSource>();
+    testRotateProcess_ = std::make_shared<RotateLetterboxProcess>(sourcePipeline);
+}
+
+void RotateLetterboxProcessTest::TearDown(void)
+{
+    testRotateProcess_ = nullptr;
+}
+
+/**
+ * @tc.name: rotate_letterbox_process_test_001
+ * @tc.desc: Verify rotate letterbox process InitNode and ProcessData abnormal input.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(RotateLetterboxProcessTest, rotate_letterbox_process_test_001, TestSize.Level1)
+{
+    EXPECT_EQ(false, testRotateProcess_ == nullptr);
+
+    std::vector<std::shared_ptr<DataBuffer>> inputBuffers;
+    int32_t rc = testRotateProcess_->ProcessData(inputBuffers);
+    EXPECT_EQ(rc, DCAMERA_DISABLE_PROCESS);
+
+    VideoConfigParams srcParams(VideoCodecType::NO_CODEC, Videoformat::YUVI420, TEST_FPS, TEST_WIDTH, TEST_HEIGHT);
+    VideoConfigParams destParams(VideoCodecType::NO_CODEC, Videoformat::NV21, TEST_FPS, TEST_WIDTH, TEST_HEIGHT);
+    destParams.SetSystemSwitchFlagAndRotation(true, 90);
+    VideoConfigParams procConfig;
+    rc = testRotateProcess_->InitNode(srcParams, destParams, procConfig);
+    EXPECT_EQ(rc, DCAMERA_OK);
+    EXPECT_EQ(procConfig.GetWidth(), TEST_WIDTH);
+    EXPECT_EQ(procConfig.GetHeight(), TEST_HEIGHT);
+    EXPECT_EQ(testRotateProcess_->rotate_.load(), 270);
+    EXPECT_EQ(testRotateProcess_->scratch_.size(), static_cast<size_t>(TEST_HEIGHT * TEST_HEIGHT));
+
+    rc = testRotateProcess_->ProcessData(inputBuffers);
+    EXPECT_EQ(rc, DCAMERA_BAD_VALUE);
+
+    std::shared_ptr<DataBuffer> frame = MakeI420Frame(TEST_WIDTH, TEST_HEIGHT);
+    frame->SetInt32(DataBufferKey::WIDTH, TEST_WIDTH + 1);
+    EXPECT_EQ(testRotateProcess_->RotateImage(frame, 90), DCAMERA_BAD_VALUE);
+    frame->SetInt32(DataBufferKey::WIDTH, TEST_WIDTH * 2);
+    EXPECT_EQ(testRotateProcess_->RotateImage(frame, 90), DCAMERA_BAD_VALUE);
+
+    std::shared_ptr<DataBuffer> nv12Frame = MakeI420Frame(TEST_WIDTH, TEST_HEIGHT);
+    nv12Frame->SetInt32(DataBufferKey::VIDEO_FORMAT, static_cast<int32_t>(Videoformat::NV12));
+    std::vector<uint8_t> before(nv12Frame->Data(), nv12Frame->Data() + nv12Frame->Size());
+    EXPECT_EQ(testRotateProcess_->RotateImage(nv12Frame, 90), DCAMERA_OK);
+    EXPECT_EQ(before, std::vector<uint8_t>(nv12Frame->Data(), nv12Frame->Data() + nv12Frame->Size()));
+
+    testRotateProcess_->ReleaseProcessNode();
+    EXPECT_TRUE(testRotateProcess_->scratch_.empty());
+}
+
+/**
+ * @tc.name: rotate_letterbox_process_test_002
+ * @tc.desc: Verify 90 and 270 degrees letterbox rotation in place, landscape and portrait.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(RotateLetterboxProcessTest, rotate_letterbox_process_test_002, TestSize.Level1)
+{
+    VideoConfigParams srcParams(VideoCodecType::NO_CODEC, Videoformat::YUVI420, TEST_FPS, TEST_WIDTH, TEST_HEIGHT);
+    VideoConfigParams destParams(VideoCodecType::NO_CODEC, Videoformat::NV21, TEST_FPS, TEST_WIDTH, TEST_HEIGHT);
+    VideoConfigParams procConfig;
+    int32_t rc = testRotateProcess_->InitNode(srcParams, destParams, procConfig);
+    EXPECT_EQ(rc, DCAMERA_OK);
+
+    const int32_t sizes[][2] = { { TEST_WIDTH, TEST_HEIGHT }, { TEST_HEIGHT, TEST_WIDTH }, { 32, 26 } };
+    for (const auto& size : sizes) {
+        for (int32_t angle : { 90, 270 }) {
+            std::shared_ptr<DataBuffer> frame = MakeI420Frame(size[0], size[1]);
+            std::vector<uint8_t> src(frame->Data(), frame->Data() + frame->Size());
+            EXPECT_EQ(testRotateProcess_->RotateImage(frame, angle), DCAMERA_OK);
+            ExpectLetterbox(src, frame, size[0], size[1], angle == 90);
+        }
+    }
+}
+
+/**
+ * @tc.name: rotate_letterbox_process_test_003
+ * @tc.desc: Verify 180 degrees rotation in place and UpdateSettings.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(RotateLetterboxProcessTest, rotate_letterbox_process_test_003, TestSize.Level1)
+{
+    VideoConfigParams srcParams(VideoCodecType::NO_CODEC, Videoformat::YUVI420, TEST_FPS, TEST_WIDTH, TEST_HEIGHT);
+    VideoConfigParams destParams(VideoCodecType::NO_CODEC, Videoformat::NV21, TEST_FPS, TEST_WIDTH, TEST_HEIGHT);
+    destParams.SetSystemSwitchFlagAndRotation(true, 180);
+    VideoConfigParams procConfig;
+    int32_t rc = testRotateProcess_->InitNode(srcParams, destParams, procConfig);
+    EXPECT_EQ(rc, DCAMERA_OK);
+    EXPECT_EQ(testRotateProcess_->rotate_.load(), 180);
+
+    const int32_t height = TEST_HEIGHT + 2;
+    std::shared_ptr<DataBuffer> frame = MakeI420Frame(TEST_WIDTH, height);
+    std::vector<uint8_t> src(frame->Data(), frame->Data() + frame->Size());
+    EXPECT_EQ(testRotateProcess_->RotateImage(frame, 180), DCAMERA_OK);
+    const int32_t planes[][3] = { { 0, TEST_WIDTH, height },
+        { TEST_WIDTH * height, TEST_WIDTH / 2, height / 2 },
+        { TEST_WIDTH * height * 5 / 4, TEST_WIDTH / 2, height / 2 } };
+    for (const auto& plane : planes) {
+        for (int32_t y = 0; y < plane[2]; y++) {
+            for (int32_t x = 0; x < plane[1]; x++) {
+                EXPECT_EQ(src[plane[0] + (plane[2] - 1 - y) * plane[1] + plane[1] - 1 - x],
+                    frame->Data()[plane[0] + y * plane[1] + x]);
+            }
+        }
+    }
+
+    EXPECT_EQ(testRotateProcess_->UpdateSettings(nullptr), DCAMERA_BAD_VALUE);
+    auto metaData = std::make_shared<OHOS::Camera::CameraMetadata>(100, 200);
+    EXPECT_EQ(testRotateProcess_->UpdateSettings(metaData), DCAMERA_OK);
+    EXPECT_EQ(testRotateProcess_->rotate_.load(), 180);
+    int32_t rotate[2] = {90, 0};
+    metaData->addEntry(OHOS_CONTROL_CAMERA_SWITCH_INFOS, rotate, 2);
+    EXPECT_EQ(testRotateProcess_->UpdateSettings(metaData), DCAMERA_OK);
+    EXPECT_EQ(testRotateProcess_->rotate_.load(), 270);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,8 @@
 #include <gtest/gtest.h>
 
 #define private public
+#include "scale_convert_blit_backend.h"
+#include "scale_convert_super_res_backend.h"
 #include "scale_convert_process.h"
 #undef private
 #include "distributed_camera_constants.h"
@@ -869,6 +871,122 @@ HWTEST_F(ScaleConvertProcessTest, scale_convert_process_test_033, TestSize.Level
     testScaleConvertProcess_->ProcessData(inputBuffers);
     EXPECT_EQ(rc, DCAMERA_OK);
 }
+
+/**
+ * @tc.name: scale_convert_process_test_034
+ * @tc.desc: Verify a device without a blit engine keeps the node on the CPU path.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(ScaleConvertProcessTest, scale_convert_process_test_034, TestSize.Level1)
+{
+    DHLOGI("ScaleConvertProcessTest scale_convert_process_test_034.");
+    ScaleConvertBlitBackend backend;
+    ImageUnitInfo srcImgInfo {Videoformat::YUVI420, 0, 0, 0, 0, 0, 0, nullptr};
+    ImageUnitInfo dstImgInfo {Videoformat::YUVI420, 0, 0, 0, 0, 0, 0, nullptr};
+    EXPECT_EQ(DCAMERA_BAD_OPERATE, backend.Convert(srcImgInfo, dstImgInfo));
+    if (backend.Init(SRC_PARAMS1, DEST_PARAMS2) != DCAMERA_OK) {
+        int32_t rc = testScaleConvertProcess_->InitNode(SRC_PARAMS1, DEST_PARAMS2, PROC_CONFIG);
+        EXPECT_EQ(DCAMERA_OK, rc);
+        EXPECT_EQ(nullptr, testScaleConvertProcess_->backend_);
+    }
+    backend.Release();
+    EXPECT_EQ(nullptr, backend.context_);
+    EXPECT_EQ(nullptr, backend.dlHandler_);
+}
+
+/**
+ * @tc.name: scale_convert_process_test_035
+ * @tc.desc: Verify super resolution only takes upscales and leaves frames over its budget to the fallback.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(ScaleConvertProcessTest, scale_convert_process_test_035, TestSize.Level1)
+{
+    DHLOGI("ScaleConvertProcessTest scale_convert_process_test_035.");
+    EXPECT_TRUE(ScaleConvertSuperResBackend::IsUpscale(DEST_PARAMS2, SRC_PARAMS1));
+    EXPECT_FALSE(ScaleConvertSuperResBackend::IsUpscale(SRC_PARAMS1, DEST_PARAMS2));
+    EXPECT_FALSE(ScaleConvertSuperResBackend::IsUpscale(SRC_PARAMS1, SRC_PARAMS1));
+
+    ScaleConvertSuperResBackend backend;
+    EXPECT_EQ(DCAMERA_BAD_VALUE, backend.Init(SRC_PARAMS1, DEST_PARAMS2));
+    ImageUnitInfo srcImgInfo {Videoformat::YUVI420, 0, 0, 0, 0, 0, 0, nullptr};
+    ImageUnitInfo dstImgInfo {Videoformat::YUVI420, 0, 0, 0, 0, 0, 0, nullptr};
+    EXPECT_EQ(DCAMERA_BAD_OPERATE, backend.Convert(srcImgInfo, dstImgInfo));
+    backend.SetFallback(std::make_unique<ScaleConvertBlitBackend>());
+    EXPECT_EQ(DCAMERA_BAD_OPERATE, backend.Convert(srcImgInfo, dstImgInfo));
+
+    int64_t budgetUs = 1000;
+    backend.budgetUs_ = budgetUs;
+    for (uint32_t i = 0; i < ScaleConvertSuperResBackend::BUDGET_WINDOW_FRAMES; i++) {
+        EXPECT_TRUE(backend.OnFrameCost(budgetUs / 2));
+    }
+    for (uint32_t i = 1; i < ScaleConvertSuperResBackend::BUDGET_WINDOW_FRAMES; i++) {
+        EXPECT_TRUE(backend.OnFrameCost(budgetUs * 2));
+    }
+    EXPECT_FALSE(backend.OnFrameCost(budgetUs * 2));
+    EXPECT_TRUE(backend.isOverBudget_);
+
+    backend.Release();
+    EXPECT_EQ(nullptr, backend.fallback_);
+    EXPECT_EQ(nullptr, backend.context_);
+}
+
+/**
+ * @tc.name: scale_convert_process_test_036
+ * @tc.desc: Verify system switch frames are rotated and scaled in one pass.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(ScaleConvertProcessTest, scale_convert_process_test_036, TestSize.Level1)
+{
+    DHLOGI("ScaleConvertProcessTest scale_convert_process_test_036.");
+    const int32_t width = 16;
+    const int32_t height = 8;
+    const int32_t angle = 180;
+    const int32_t uvRatio = 2;
+    VideoConfigParams srcParams(VideoCodecType::CODEC_H264, Videoformat::NV12, DCAMERA_PRODUCER_FPS_DEFAULT,
+        width, height);
+    VideoConfigParams dstParams(VideoCodecType::CODEC_H264, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        width, height);
+    EXPECT_FALSE(ScaleConvertProcess::IsFusedRotateSupported(srcParams, dstParams));
+    dstParams.SetSystemSwitchFlagAndRotation(true, angle);
+    EXPECT_TRUE(ScaleConvertProcess::IsFusedRotateSupported(srcParams, dstParams));
+    VideoConfigParams rgbParams = DEST_PARAMS3;
+    rgbParams.SetSystemSwitchFlagAndRotation(true, angle);
+    EXPECT_FALSE(ScaleConvertProcess::IsFusedRotateSupported(srcParams, rgbParams));
+
+    int32_t rc = testScaleConvertProcess_->InitNode(srcParams, dstParams, PROC_CONFIG);
+    EXPECT_EQ(DCAMERA_OK, rc);
+    EXPECT_TRUE(testScaleConvertProcess_->isFusedRotate_);
+    EXPECT_EQ(nullptr, testScaleConvertProcess_->backend_);
+
+    size_t size = static_cast<size_t>(width * height * 3 / 2);
+    std::shared_ptr<DataBuffer> srcBuf = std::make_shared<DataBuffer>(size);
+    std::shared_ptr<DataBuffer> dstBuf = std::make_shared<DataBuffer>(size);
+    for (size_t i = 0; i < size; i++) {
+        srcBuf->Data()[i] = static_cast<uint8_t>(i);
+    }
+    ImageUnitInfo srcImgInfo {Videoformat::NV12, width, height, width, height, width * height, size, srcBuf};
+    ImageUnitInfo dstImgInfo {Videoformat::NV21, width, height, width, height, width * height, size, dstBuf};
+    EXPECT_EQ(DCAMERA_OK, testScaleConvertProcess_->FusedRotateScale(srcImgInfo, dstImgInfo));
+    const uint8_t *src = srcBuf->Data();
+    const uint8_t *dst = dstBuf->Data();
+    for (int32_t y = 0; y < height; y++) {
+        for (int32_t x = 0; x < width; x++) {
+            EXPECT_EQ(src[(height - 1 - y) * width + width - 1 - x], dst[y * width + x]);
+        }
+    }
+    const uint8_t *srcUV = src + width * height;
+    const uint8_t *dstVU = dst + width * height;
+    for (int32_t y = 0; y < height / uvRatio; y++) {
+        for (int32_t x = 0; x < width / uvRatio; x++) {
+            const uint8_t *uv = srcUV + (height / uvRatio - 1 - y) * width + (width - uvRatio - x * uvRatio);
+            EXPECT_EQ(uv[0], dstVU[y * width + x * uvRatio + 1]);
+            EXPECT_EQ(uv[1], dstVU[y * width + x * uvRatio]);
+        }
+    }
+}
 #endif
 } // namespace DistributedHardware
 } // namespace OHOS
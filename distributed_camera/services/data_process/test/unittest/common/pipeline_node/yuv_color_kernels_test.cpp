@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "yuv_color_kernels.h"
+#include "distributed_camera_errno.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+class YuvColorKernelsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+namespace {
+const int32_t TEST_WIDTH = 3;
+const int32_t TEST_HEIGHT = 2;
+const int32_t TEST_HALF_WIDTH = 2;
+const int32_t RGBA_BYTES = 4;
+const int32_t P010_BYTES = 2;
+const int32_t COLOR_TOLERANCE = 2;
+
+void ExpectPixel(const uint8_t *pixel, int32_t r, int32_t g, int32_t b)
+{
+    EXPECT_LE(std::abs(pixel[0] - r), COLOR_TOLERANCE);
+    EXPECT_LE(std::abs(pixel[1] - g), COLOR_TOLERANCE);
+    EXPECT_LE(std::abs(pixel[2] - b), COLOR_TOLERANCE);
+    EXPECT_EQ(0xFF, pixel[3]);
+}
+
+uint16_t ReadP010(const std::vector<uint8_t> &data, size_t offset)
+{
+    return static_cast<uint16_t>(data[offset] | (data[offset + 1] << 8));
+}
+}
+
+void YuvColorKernelsTest::SetUpTestCase(void)
+{
+}
+
+void YuvColorKernelsTest::TearDownTestCase(void)
+{
+}
+
+void YuvColorKernelsTest::SetUp(void)
+{
+}
+
+void YuvColorKernelsTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.name: yuv_color_kernels_test_001
+ * @tc.desc: Verify I420 and NV12/NV21 convert to the same RGBA with the limited and full range tables.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(YuvColorKernelsTest, yuv_color_kernels_test_001, TestSize.Level1)
+{
+    // Limited range white, black and BT.601 red (81, 90, 240) sharing one chroma pair on an odd width.
+    std::vector<uint8_t> y = { 235, 16, 81, 235, 16, 81 };
+    std::vector<uint8_t> u = { 128, 90 };
+    std::vector<uint8_t> v = { 128, 240 };
+    std::vector<uint8_t> i420Rgba(TEST_WIDTH * TEST_HEIGHT * RGBA_BYTES, 0);
+    const YuvToRgbTable &bt601 = YuvColorKernels::GetYuvToRgbTable(VideoColorSpace::BT601_LIMITED);
+    EXPECT_EQ(DCAMERA_OK, YuvColorKernels::I420ToRGBA(y.data(), TEST_WIDTH, u.data(), TEST_HALF_WIDTH, v.data(),
+        TEST_HALF_WIDTH, i420Rgba.data(), TEST_WIDTH * RGBA_BYTES, TEST_WIDTH, TEST_HEIGHT, bt601));
+    ExpectPixel(&i420Rgba[0], 255, 255, 255);
+    ExpectPixel(&i420Rgba[RGBA_BYTES], 0, 0, 0);
+    ExpectPixel(&i420Rgba[RGBA_BYTES * 2], 255, 0, 0);
+
+    std::vector<uint8_t> uv = { 128, 128, 90, 240 };
+    std::vector<uint8_t> vu = { 128, 128, 240, 90 };
+    std::vector<uint8_t> nv12Rgba(i420Rgba.size(), 0);
+    std::vector<uint8_t> nv21Rgba(i420Rgba.size(), 0);
+    EXPECT_EQ(DCAMERA_OK, YuvColorKernels::NV12ToRGBA(y.data(), TEST_WIDTH, uv.data(), TEST_HALF_WIDTH * 2,
+        nv12Rgba.data(), TEST_WIDTH * RGBA_BYTES, TEST_WIDTH, TEST_HEIGHT, bt601, false));
+    EXPECT_EQ(DCAMERA_OK, YuvColorKernels::NV12ToRGBA(y.data(), TEST_WIDTH, vu.data(), TEST_HALF_WIDTH * 2,
+        nv21Rgba.data(), TEST_WIDTH * RGBA_BYTES, TEST_WIDTH, TEST_HEIGHT, bt601, true));
+    EXPECT_EQ(i420Rgba, nv12Rgba);
+    EXPECT_EQ(i420Rgba, nv21Rgba);
+
+    std::vector<uint8_t> fullRgba(i420Rgba.size(), 0);
+    const YuvToRgbTable &full = YuvColorKernels::GetYuvToRgbTable(VideoColorSpace::BT709_FULL);
+    EXPECT_EQ(DCAMERA_OK, YuvColorKernels::I420ToRGBA(y.data(), TEST_WIDTH, u.data(), TEST_HALF_WIDTH, v.data(),
+        TEST_HALF_WIDTH, fullRgba.data(), TEST_WIDTH * RGBA_BYTES, TEST_WIDTH, TEST_HEIGHT, full));
+    ExpectPixel(&fullRgba[0], 235, 235, 235);
+    ExpectPixel(&fullRgba[RGBA_BYTES], 16, 16, 16);
+    EXPECT_EQ(DCAMERA_BAD_VALUE, YuvColorKernels::I420ToRGBA(y.data(), TEST_WIDTH, u.data(), TEST_HALF_WIDTH,
+        v.data(), TEST_HALF_WIDTH, fullRgba.data(), TEST_WIDTH, TEST_WIDTH, TEST_HEIGHT, full));
+}
+
+/**
+ * @tc.name: yuv_color_kernels_test_002
+ * @tc.desc: Verify I420 widens to P010 over the full ten bits and the 8 and 16 bit chroma orders swap.
+ * @tc.type: FUNC
+ * @tc.require: Issue Number
+ */
+HWTEST_F(YuvColorKernelsTest, yuv_color_kernels_test_002, TestSize.Level1)
+{
+    std::vector<uint8_t> y = { 0, 128, 255, 1, 2, 3 };
+    std::vector<uint8_t> u = { 10, 20 };
+    std::vector<uint8_t> v = { 30, 40 };
+    int32_t dstStride = TEST_HALF_WIDTH * 2 * P010_BYTES;
+    std::vector<uint8_t> dstY(dstStride * TEST_HEIGHT, 0);
+    std::vector<uint8_t> dstUV(dstStride, 0);
+    EXPECT_EQ(DCAMERA_OK, YuvColorKernels::I420ToP010(y.data(), TEST_WIDTH, u.data(), TEST_HALF_WIDTH, v.data(),
+        TEST_HALF_WIDTH, dstY.data(), dstStride, dstUV.data(), dstStride, TEST_WIDTH, TEST_HEIGHT));
+    EXPECT_EQ(0x0000, ReadP010(dstY, 0));
+    EXPECT_EQ(0x8080, ReadP010(dstY, P010_BYTES));
+    EXPECT_EQ(0xFFC0, ReadP010(dstY, P010_BYTES * 2));
+    EXPECT_EQ(static_cast<uint16_t>(((10 << 2) | (10 >> 6)) << 6), ReadP010(dstUV, 0));
+    EXPECT_EQ(static_cast<uint16_t>(((40 << 2) | (40 >> 6)) << 6), ReadP010(dstUV, P010_BYTES * 3));
+
+    std::vector<uint8_t> uv = { 1, 2, 3, 4 };
+    EXPECT_EQ(DCAMERA_OK, YuvColorKernels::SwapUVOrder(uv.data(), TEST_HALF_WIDTH * 2, uv.data(),
+        TEST_HALF_WIDTH * 2, TEST_WIDTH, TEST_HEIGHT));
+    EXPECT_EQ(std::vector<uint8_t>({ 2, 1, 4, 3 }), uv);
+    EXPECT_EQ(DCAMERA_BAD_VALUE, YuvColorKernels::SwapUVOrder(nullptr, TEST_HALF_WIDTH * 2, uv.data(),
+        TEST_HALF_WIDTH * 2, TEST_WIDTH, TEST_HEIGHT));
+
+    std::vector<uint8_t> p010UV = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    EXPECT_EQ(DCAMERA_OK, YuvColorKernels::SwapP010UVOrder(p010UV.data(), dstStride, p010UV.data(), dstStride,
+        TEST_WIDTH, TEST_HEIGHT));
+    EXPECT_EQ(std::vector<uint8_t>({ 3, 4, 1, 2, 7, 8, 5, 6 }), p010UV);
+    EXPECT_EQ(DCAMERA_BAD_VALUE, YuvColorKernels::SwapP010UVOrder(p010UV.data(), dstStride - 1, p010UV.data(),
+        dstStride, TEST_WIDTH, TEST_HEIGHT));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
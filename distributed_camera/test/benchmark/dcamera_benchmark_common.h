@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DCAMERA_BENCHMARK_COMMON_H
+#define OHOS_DCAMERA_BENCHMARK_COMMON_H
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr int32_t BENCHMARK_YUV_BYTES_PER_PIXEL = 3;
+constexpr int32_t BENCHMARK_Y2UV_RATIO = 2;
+constexpr uint32_t BENCHMARK_LUMA_STEP = 7;
+constexpr uint32_t BENCHMARK_CHROMA_STEP = 13;
+
+// Width and height of a benchmark run are its first two arguments.
+inline int32_t FrameWidth(const benchmark::State& state)
+{
+    return static_cast<int32_t>(state.range(0));
+}
+
+inline int32_t FrameHeight(const benchmark::State& state)
+{
+    return static_cast<int32_t>(state.range(1));
+}
+
+inline size_t YuvFrameSize(int32_t width, int32_t height)
+{
+    return static_cast<size_t>(width) * static_cast<size_t>(height) * BENCHMARK_YUV_BYTES_PER_PIXEL /
+        BENCHMARK_Y2UV_RATIO;
+}
+
+// Gradients instead of a flat color, so converters cannot take a shortcut on uniform rows.
+inline void FillSyntheticYuv(uint8_t *data, int32_t width, int32_t height)
+{
+    size_t lumaSize = static_cast<size_t>(width) * static_cast<size_t>(height);
+    size_t frameSize = YuvFrameSize(width, height);
+    for (size_t i = 0; i < lumaSize; i++) {
+        data[i] = static_cast<uint8_t>(i * BENCHMARK_LUMA_STEP);
+    }
+    for (size_t i = lumaSize; i < frameSize; i++) {
+        data[i] = static_cast<uint8_t>(i * BENCHMARK_CHROMA_STEP);
+    }
+}
+
+// The 720p, 1080p and 4K frames every pixel benchmark runs on.
+inline void FrameResolutions(benchmark::internal::Benchmark *bench)
+{
+    bench->Args({ 1280, 720 })->Args({ 1920, 1080 })->Args({ 3840, 2160 });
+}
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DCAMERA_BENCHMARK_COMMON_H
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <securec.h>
+#include <string>
+#include <vector>
+
+#include "data_buffer.h"
+#include "dcamera_benchmark_common.h"
+#include "dcamera_sink_frame_info.h"
+#include "dcamera_softbus_session.h"
+#include "distributed_camera_errno.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const std::string BENCHMARK_DH_ID = "camera_0";
+const std::string BENCHMARK_DEV_ID = "bb536a637105409e904d4da83790a4a7";
+const std::string BENCHMARK_SESSION_NAME = "dcamera_benchmark_session";
+constexpr int64_t BENCHMARK_TIME_US = 1700000000000000;
+constexpr int64_t BENCHMARK_FRAME_INTERVAL_US = 33333;
+constexpr int64_t BENCHMARK_ENCODE_US = 8000;
+constexpr float BENCHMARK_IMU_VALUE = 0.5f;
+
+class BenchmarkChannelListener : public ICameraChannelListener {
+public:
+    void OnSessionState(int32_t state, std::string networkId) override {}
+    void OnSessionError(int32_t eventType, int32_t eventReason, std::string detail) override {}
+    void OnDataReceived(std::vector<std::shared_ptr<DataBuffer>>& buffers) override
+    {
+        receivedCount_ += buffers.size();
+    }
+
+    size_t receivedCount_ = 0;
+};
+
+std::shared_ptr<DCameraSoftbusSession> CreateSession(const std::shared_ptr<BenchmarkChannelListener>& listener)
+{
+    return std::make_shared<DCameraSoftbusSession>(BENCHMARK_DH_ID, BENCHMARK_DEV_ID, BENCHMARK_SESSION_NAME,
+        BENCHMARK_DEV_ID, BENCHMARK_SESSION_NAME, listener, DCAMERA_SESSION_MODE_JPEG);
+}
+
+// Cuts a frame into the packets UnPackSendData hands to softbus, without sending them.
+size_t PackFrame(DCameraSoftbusSession& session, const std::shared_ptr<DataBuffer>& frame,
+    std::vector<std::shared_ptr<DataBuffer>>& packets)
+{
+    uint32_t totalLen = static_cast<uint32_t>(frame->Size());
+    DCameraSoftbusSession::SessionDataHeader headPara = { DCameraSoftbusSession::PROTOCOL_VERSION,
+        DCameraSoftbusSession::FRAG_START, session.mode_, 0, totalLen, 0, 0 };
+    if (totalLen <= DCameraSoftbusSession::BINARY_DATA_PACKET_MAX_LEN) {
+        headPara.fragFlag = DCameraSoftbusSession::FRAG_START_END;
+        headPara.dataLen = totalLen;
+    }
+    size_t count = 0;
+    uint32_t offset = 0;
+    while (totalLen > offset) {
+        if (headPara.fragFlag != DCameraSoftbusSession::FRAG_START_END) {
+            session.SetHeadParaDataLen(headPara, totalLen, offset);
+        }
+        if (count == packets.size()) {
+            packets.push_back(DataBuffer::Acquire(DCameraSoftbusSession::BINARY_DATA_PACKET_MAX_LEN +
+                DCameraSoftbusSession::BINARY_HEADER_FRAG_LEN));
+        }
+        std::shared_ptr<DataBuffer>& packet = packets[count++];
+        packet->SetRange(0, headPara.dataLen + DCameraSoftbusSession::BINARY_HEADER_FRAG_LEN);
+        session.MakeFragDataHeader(headPara, packet->Data(), DCameraSoftbusSession::BINARY_HEADER_FRAG_LEN);
+        if (memcpy_s(packet->Data() + DCameraSoftbusSession::BINARY_HEADER_FRAG_LEN,
+            packet->Size() - DCameraSoftbusSession::BINARY_HEADER_FRAG_LEN, frame->Data() + offset,
+            headPara.dataLen) != EOK) {
+            return 0;
+        }
+        headPara.subSeq++;
+        headPara.fragFlag = DCameraSoftbusSession::FRAG_MID;
+        offset += headPara.dataLen;
+    }
+    return count;
+}
+
+void BenchmarkSoftbusPack(benchmark::State& state)
+{
+    std::shared_ptr<BenchmarkChannelListener> listener = std::make_shared<BenchmarkChannelListener>();
+    std::shared_ptr<DCameraSoftbusSession> session = CreateSession(listener);
+    std::shared_ptr<DataBuffer> frame = DataBuffer::Acquire(YuvFrameSize(FrameWidth(state), FrameHeight(state)));
+    FillSyntheticYuv(frame->Data(), FrameWidth(state), FrameHeight(state));
+    std::vector<std::shared_ptr<DataBuffer>> packets;
+    size_t packetCount = 0;
+    for (auto _ : state) {
+        packetCount = PackFrame(*session, frame, packets);
+    }
+    state.counters["packets"] = static_cast<double>(packetCount);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(frame->Size()));
+}
+
+// Unpacks and reassembles the packets the way the receiving session does, up to the listener.
+void BenchmarkSoftbusReassemble(benchmark::State& state)
+{
+    std::shared_ptr<BenchmarkChannelListener> listener = std::make_shared<BenchmarkChannelListener>();
+    std::shared_ptr<DCameraSoftbusSession> session = CreateSession(listener);
+    std::shared_ptr<DataBuffer> frame = DataBuffer::Acquire(YuvFrameSize(FrameWidth(state), FrameHeight(state)));
+    FillSyntheticYuv(frame->Data(), FrameWidth(state), FrameHeight(state));
+    std::vector<std::shared_ptr<DataBuffer>> packets;
+    size_t packetCount = PackFrame(*session, frame, packets);
+    std::vector<size_t> packetSizes;
+    for (size_t i = 0; i < packetCount; i++) {
+        packetSizes.push_back(packets[i]->Size());
+    }
+    for (auto _ : state) {
+        for (size_t i = 0; i < packetCount; i++) {
+            // A single packet message is cut down in place, every round starts from the packet as sent.
+            packets[i]->SetRange(0, packetSizes[i]);
+            session->PackRecvData(packets[i]);
+        }
+    }
+    if (listener->receivedCount_ != static_cast<size_t>(state.iterations())) {
+        state.SkipWithError("reassembled frame count mismatch");
+    }
+    state.counters["packets"] = static_cast<double>(packetCount);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(frame->Size()));
+}
+
+void FillSinkFrameInfo(DCameraSinkFrameInfo& frameInfo, size_t imuCount)
+{
+    frameInfo.type_ = 0;
+    frameInfo.index_ = 1;
+    frameInfo.pts_ = BENCHMARK_TIME_US;
+    frameInfo.startEncodeT_ = BENCHMARK_TIME_US;
+    frameInfo.finishEncodeT_ = BENCHMARK_TIME_US + BENCHMARK_ENCODE_US;
+    frameInfo.sendT_ = frameInfo.finishEncodeT_;
+    frameInfo.rawTimeUs_ = BENCHMARK_TIME_US;
+    frameInfo.rawTime_ = std::to_string(BENCHMARK_TIME_US);
+    for (size_t i = 0; i < imuCount; i++) {
+        ImuSample sample;
+        sample.timeStamp = BENCHMARK_TIME_US + static_cast<int64_t>(i) * BENCHMARK_FRAME_INTERVAL_US / imuCount;
+        sample.data[0] = BENCHMARK_IMU_VALUE;
+        frameInfo.accData_.push_back(sample);
+        frameInfo.gyroData_.push_back(sample);
+    }
+}
+
+// The first argument is the number of imu samples per sensor carried with the frame.
+void BenchmarkSinkFrameInfoJson(benchmark::State& state)
+{
+    DCameraSinkFrameInfo frameInfo;
+    FillSinkFrameInfo(frameInfo, static_cast<size_t>(state.range(0)));
+    std::string jsonStr;
+    for (auto _ : state) {
+        jsonStr.clear();
+        frameInfo.Marshal(jsonStr);
+        DCameraSinkFrameInfo parsed;
+        benchmark::DoNotOptimize(parsed.Unmarshal(jsonStr));
+    }
+    state.counters["bytes"] = static_cast<double>(jsonStr.size());
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BenchmarkSinkFrameInfoBinary(benchmark::State& state)
+{
+    DCameraSinkFrameInfo frameInfo;
+    FillSinkFrameInfo(frameInfo, static_cast<size_t>(state.range(0)));
+    std::vector<uint8_t> data(frameInfo.GetBinarySize());
+    size_t length = 0;
+    for (auto _ : state) {
+        frameInfo.MarshalBinary(data.data(), data.size(), length);
+        DCameraSinkFrameInfo parsed;
+        benchmark::DoNotOptimize(DCameraSinkFrameInfo::IsBinary(data.data(), length) &&
+            parsed.UnmarshalBinary(data.data(), length) == DCAMERA_OK);
+    }
+    state.counters["bytes"] = static_cast<double>(length);
+    state.SetItemsProcessed(state.iterations());
+}
+}
+
+BENCHMARK(BenchmarkSoftbusPack)->Apply(FrameResolutions);
+BENCHMARK(BenchmarkSoftbusReassemble)->Apply(FrameResolutions);
+BENCHMARK(BenchmarkSinkFrameInfoJson)->Arg(0)->Arg(32);
+BENCHMARK(BenchmarkSinkFrameInfoBinary)->Arg(0)->Arg(32);
+} // namespace DistributedHardware
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+
+#include "data_buffer.h"
+#include "dcamera_benchmark_common.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+// Pooled allocation as every pipeline node does it, the block goes back to the pool at the end of each round.
+void BenchmarkDataBufferAcquire(benchmark::State& state)
+{
+    size_t frameSize = YuvFrameSize(FrameWidth(state), FrameHeight(state));
+    for (auto _ : state) {
+        std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(frameSize);
+        benchmark::DoNotOptimize(buffer->Data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Allocation outside the pool, the cost the pool saves.
+void BenchmarkDataBufferMakeShared(benchmark::State& state)
+{
+    size_t frameSize = YuvFrameSize(FrameWidth(state), FrameHeight(state));
+    for (auto _ : state) {
+        std::shared_ptr<DataBuffer> buffer = std::make_shared<DataBuffer>(frameSize);
+        benchmark::DoNotOptimize(buffer->Data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// The attribute round trip each node pays to hand a frame on.
+void BenchmarkDataBufferAttrs(benchmark::State& state)
+{
+    int32_t width = FrameWidth(state);
+    int32_t height = FrameHeight(state);
+    std::shared_ptr<DataBuffer> buffer = DataBuffer::Acquire(YuvFrameSize(width, height));
+    for (auto _ : state) {
+        buffer->SetInt32(DataBufferKey::VIDEO_FORMAT, 0);
+        buffer->SetInt32(DataBufferKey::WIDTH, width);
+        buffer->SetInt32(DataBufferKey::HEIGHT, height);
+        buffer->SetInt32(DataBufferKey::ALIGNED_WIDTH, width);
+        buffer->SetInt32(DataBufferKey::ALIGNED_HEIGHT, height);
+        buffer->SetInt64(DataBufferKey::TIME_US, 0);
+        int32_t alignedWidth = 0;
+        int64_t timeUs = 0;
+        benchmark::DoNotOptimize(buffer->FindInt32(DataBufferKey::ALIGNED_WIDTH, alignedWidth));
+        benchmark::DoNotOptimize(buffer->FindInt64(DataBufferKey::TIME_US, timeUs));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+}
+
+BENCHMARK(BenchmarkDataBufferAcquire)->Apply(FrameResolutions);
+BENCHMARK(BenchmarkDataBufferMakeShared)->Apply(FrameResolutions);
+BENCHMARK(BenchmarkDataBufferAttrs)->Apply(FrameResolutions);
+} // namespace DistributedHardware
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "data_buffer.h"
+#include "dcamera_benchmark_common.h"
+#include "dcamera_pipeline_source.h"
+#include "decode_data_process.h"
+#include "distributed_camera_constants.h"
+#include "distributed_camera_errno.h"
+#include "fps_controller_process.h"
+#include "image_common_type.h"
+#include "rotate_letterbox_process.h"
+#include "scale_convert_process.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t BENCHMARK_SCALE_RATIO = 2;
+constexpr int32_t BENCHMARK_TARGET_FPS = 15;
+constexpr int32_t BENCHMARK_ROTATION = 90;
+
+std::shared_ptr<DataBuffer> CreateSyntheticFrame(int32_t width, int32_t height, Videoformat format)
+{
+    std::shared_ptr<DataBuffer> frame = DataBuffer::Acquire(YuvFrameSize(width, height));
+    FillSyntheticYuv(frame->Data(), width, height);
+    frame->SetInt32(DataBufferKey::VIDEO_FORMAT, static_cast<int32_t>(format));
+    frame->SetInt32(DataBufferKey::WIDTH, width);
+    frame->SetInt32(DataBufferKey::HEIGHT, height);
+    frame->SetInt32(DataBufferKey::ALIGNED_WIDTH, width);
+    frame->SetInt32(DataBufferKey::ALIGNED_HEIGHT, height);
+    frame->SetInt64(DataBufferKey::TIME_US, 0);
+    return frame;
+}
+
+/*
+ * Decoded frame of the given size and format scaled to half its size as NV21, the way the source pipeline hands
+ * it to the preview. Which of the swscale and libyuv nodes runs follows the build, the label tells them apart.
+ */
+void BenchmarkScaleConvert(benchmark::State& state)
+{
+    int32_t width = FrameWidth(state);
+    int32_t height = FrameHeight(state);
+    Videoformat format = static_cast<Videoformat>(state.range(2));
+    std::shared_ptr<DCameraPipelineSource> pipeline = std::make_shared<DCameraPipelineSource>();
+    std::shared_ptr<ScaleConvertProcess> scaleProcess = std::make_shared<ScaleConvertProcess>(pipeline);
+    VideoConfigParams sourceConfig(VideoCodecType::CODEC_H264, format, DCAMERA_PRODUCER_FPS_DEFAULT, width, height);
+    VideoConfigParams targetConfig(VideoCodecType::CODEC_H264, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        width / BENCHMARK_SCALE_RATIO, height / BENCHMARK_SCALE_RATIO);
+    VideoConfigParams processedConfig;
+    if (scaleProcess->InitNode(sourceConfig, targetConfig, processedConfig) != DCAMERA_OK) {
+        state.SkipWithError("scale convert init failed");
+        return;
+    }
+    std::vector<std::shared_ptr<DataBuffer>> inputBuffers = { CreateSyntheticFrame(width, height, format) };
+    for (auto _ : state) {
+        if (scaleProcess->ProcessData(inputBuffers) != DCAMERA_OK) {
+            state.SkipWithError("scale convert failed");
+            break;
+        }
+    }
+#ifdef DCAMERA_SUPPORT_FFMPEG
+    state.SetLabel("swscale");
+#else
+    state.SetLabel("libyuv");
+#endif
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+        static_cast<int64_t>(inputBuffers[0]->Size()));
+    scaleProcess->ReleaseProcessNode();
+}
+
+void ScaleConvertArgs(benchmark::internal::Benchmark *bench)
+{
+    // The libyuv node only takes the I420 its decoder produces, swscale also scales the NV12 one.
+#ifdef DCAMERA_SUPPORT_FFMPEG
+    std::vector<Videoformat> formats = { Videoformat::NV12, Videoformat::YUVI420 };
+#else
+    std::vector<Videoformat> formats = { Videoformat::YUVI420 };
+#endif
+    for (Videoformat format : formats) {
+        bench->Args({ 1280, 720, static_cast<int32_t>(format) })
+            ->Args({ 1920, 1080, static_cast<int32_t>(format) })
+            ->Args({ 3840, 2160, static_cast<int32_t>(format) });
+    }
+}
+
+#ifndef DCAMERA_SUPPORT_FFMPEG
+// The NV12 decoder output repacked to I420, only the libyuv build of the decoder node has this step.
+void BenchmarkConvertToI420(benchmark::State& state)
+{
+    int32_t width = FrameWidth(state);
+    int32_t height = FrameHeight(state);
+    std::shared_ptr<DCameraPipelineSource> pipeline = std::make_shared<DCameraPipelineSource>();
+    std::shared_ptr<DecodeDataProcess> decodeProcess = std::make_shared<DecodeDataProcess>(nullptr, pipeline);
+    decodeProcess->sourceConfig_ = VideoConfigParams(VideoCodecType::CODEC_H264, Videoformat::NV12,
+        DCAMERA_PRODUCER_FPS_DEFAULT, width, height);
+    decodeProcess->processedConfig_ = VideoConfigParams(VideoCodecType::NO_CODEC, Videoformat::YUVI420,
+        DCAMERA_PRODUCER_FPS_DEFAULT, width, height);
+    std::shared_ptr<DataBuffer> srcFrame = CreateSyntheticFrame(width, height, Videoformat::NV12);
+    std::shared_ptr<DataBuffer> dstFrame = DataBuffer::Acquire(YuvFrameSize(width, height));
+    uint8_t *srcDataY = srcFrame->Data();
+    uint8_t *srcDataUV = srcFrame->Data() + static_cast<size_t>(width) * static_cast<size_t>(height);
+    for (auto _ : state) {
+        if (!decodeProcess->ConvertToI420(srcDataY, srcDataUV, width, height, dstFrame)) {
+            state.SkipWithError("convert to i420 failed");
+            break;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(srcFrame->Size()));
+}
+
+/*
+ * Rotated system switch frame from the NV12 decoder output to the half size NV21 preview. The passes run the
+ * I420 repack, the letterbox rotation and the crop and scale one after the other, the fused scale node maps
+ * every output sample straight to its source.
+ */
+void BenchmarkSystemSwitchScale(benchmark::State& state)
+{
+    int32_t width = FrameWidth(state);
+    int32_t height = FrameHeight(state);
+    bool isFused = state.range(2) != 0;
+    std::shared_ptr<DCameraPipelineSource> pipeline = std::make_shared<DCameraPipelineSource>();
+    std::shared_ptr<DecodeDataProcess> decodeProcess = std::make_shared<DecodeDataProcess>(nullptr, pipeline);
+    std::shared_ptr<AbstractDataProcess> rotateProcess = std::make_shared<RotateLetterboxProcess>(pipeline);
+    std::shared_ptr<AbstractDataProcess> scaleProcess = std::make_shared<ScaleConvertProcess>(pipeline);
+    Videoformat format = isFused ? Videoformat::NV12 : Videoformat::YUVI420;
+    VideoConfigParams sourceConfig(VideoCodecType::NO_CODEC, format, DCAMERA_PRODUCER_FPS_DEFAULT, width, height);
+    VideoConfigParams targetConfig(VideoCodecType::NO_CODEC, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        width / BENCHMARK_SCALE_RATIO, height / BENCHMARK_SCALE_RATIO);
+    targetConfig.SetSystemSwitchFlagAndRotation(true, BENCHMARK_ROTATION);
+    VideoConfigParams processedConfig;
+    int32_t ret = isFused ? DCAMERA_OK : rotateProcess->InitNode(sourceConfig, targetConfig, processedConfig);
+    if (ret != DCAMERA_OK || scaleProcess->InitNode(sourceConfig, targetConfig, processedConfig) != DCAMERA_OK ||
+        (!isFused && rotateProcess->SetNextNode(scaleProcess) != DCAMERA_OK)) {
+        state.SkipWithError("system switch init failed");
+        return;
+    }
+    decodeProcess->sourceConfig_ = VideoConfigParams(VideoCodecType::CODEC_H264, Videoformat::NV12,
+        DCAMERA_PRODUCER_FPS_DEFAULT, width, height);
+    decodeProcess->processedConfig_ = VideoConfigParams(VideoCodecType::NO_CODEC, Videoformat::YUVI420,
+        DCAMERA_PRODUCER_FPS_DEFAULT, width, height);
+    std::shared_ptr<DataBuffer> srcFrame = CreateSyntheticFrame(width, height, Videoformat::NV12);
+    std::shared_ptr<DataBuffer> i420Frame = CreateSyntheticFrame(width, height, Videoformat::YUVI420);
+    std::vector<std::shared_ptr<DataBuffer>> inputBuffers = { isFused ? srcFrame : i420Frame };
+    uint8_t *srcDataUV = srcFrame->Data() + static_cast<size_t>(width) * static_cast<size_t>(height);
+    for (auto _ : state) {
+        // The rotation works in place, the repack gives every pass a fresh frame.
+        if (!isFused && !decodeProcess->ConvertToI420(srcFrame->Data(), srcDataUV, width, height, i420Frame)) {
+            state.SkipWithError("convert to i420 failed");
+            break;
+        }
+        if ((isFused ? scaleProcess : rotateProcess)->ProcessData(inputBuffers) != DCAMERA_OK) {
+            state.SkipWithError("system switch scale failed");
+            break;
+        }
+    }
+    state.SetLabel(isFused ? "fused" : "passes");
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(srcFrame->Size()));
+    rotateProcess->ReleaseProcessNode();
+    scaleProcess->ReleaseProcessNode();
+}
+
+void SystemSwitchScaleArgs(benchmark::internal::Benchmark *bench)
+{
+    for (int32_t isFused : { 0, 1 }) {
+        bench->Args({ 1280, 720, isFused })->Args({ 1920, 1080, isFused })->Args({ 3840, 2160, isFused });
+    }
+}
+#endif
+
+// The node judges the rate by the wall clock, fed flat out it takes the drop path for most frames.
+void BenchmarkFpsController(benchmark::State& state)
+{
+    int32_t width = FrameWidth(state);
+    int32_t height = FrameHeight(state);
+    std::shared_ptr<DCameraPipelineSource> pipeline = std::make_shared<DCameraPipelineSource>();
+    std::shared_ptr<FpsControllerProcess> fpsProcess = std::make_shared<FpsControllerProcess>(pipeline);
+    VideoConfigParams sourceConfig(VideoCodecType::NO_CODEC, Videoformat::NV21, DCAMERA_PRODUCER_FPS_DEFAULT,
+        width, height);
+    VideoConfigParams targetConfig(VideoCodecType::NO_CODEC, Videoformat::NV21, BENCHMARK_TARGET_FPS,
+        width, height);
+    VideoConfigParams processedConfig;
+    if (fpsProcess->InitNode(sourceConfig, targetConfig, processedConfig) != DCAMERA_OK) {
+        state.SkipWithError("fps controller init failed");
+        return;
+    }
+    std::vector<std::shared_ptr<DataBuffer>> inputBuffers = { CreateSyntheticFrame(width, height,
+        Videoformat::NV21) };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fpsProcess->ProcessData(inputBuffers));
+    }
+    state.SetItemsProcessed(state.iterations());
+    fpsProcess->ReleaseProcessNode();
+}
+}
+
+BENCHMARK(BenchmarkScaleConvert)->Apply(ScaleConvertArgs);
+#ifndef DCAMERA_SUPPORT_FFMPEG
+BENCHMARK(BenchmarkConvertToI420)->Apply(FrameResolutions);
+BENCHMARK(BenchmarkSystemSwitchScale)->Apply(SystemSwitchScaleArgs);
+#endif
+BENCHMARK(BenchmarkFpsController)->Apply(FrameResolutions);
+} // namespace DistributedHardware
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "data_process_listener.h"
+#include "dcamera_frame_capture.h"
+#include "dcamera_node_stats.h"
+#include "dcamera_pipeline_source.h"
+#include "dcamera_utils_tools.h"
+#include "distributed_camera_errno.h"
+#include "property_carrier.h"
+
+using namespace OHOS::DistributedHardware;
+
+namespace {
+constexpr int32_t MIN_ARG_COUNT = 2;
+constexpr int32_t SPEED_ARG_INDEX = 2;
+constexpr double DEFAULT_SPEED = 1.0;
+constexpr int64_t US_PER_MS = 1000;
+// Frames still in the decoder when the last one was fed get this long to come out.
+constexpr int32_t DRAIN_WAIT_MS = 500;
+}
+
+class ReplayListener : public DataProcessListener {
+public:
+    int32_t OnProcessedVideoBuffer(const std::shared_ptr<DataBuffer>& videoResult) override
+    {
+        outputCount_++;
+        return DCAMERA_OK;
+    }
+
+    void OnError(DataProcessErrorType errorType) override
+    {
+        errorCount_++;
+    }
+
+    std::atomic<uint32_t> outputCount_ = 0;
+    std::atomic<uint32_t> errorCount_ = 0;
+};
+
+int main(int argc, char *argv[])
+{
+    if (argc < MIN_ARG_COUNT) {
+        std::cout << "usage: dcamera_pipeline_replay <capture file> [speed, 0 feeds back to back]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    double speed = (argc > SPEED_ARG_INDEX) ? std::atof(argv[SPEED_ARG_INDEX]) : DEFAULT_SPEED;
+    DCameraFrameCaptureReader reader;
+    if (reader.Open(argv[1]) != DCAMERA_OK) {
+        std::cout << "open capture " << argv[1] << " failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::shared_ptr<ReplayListener> listener = std::make_shared<ReplayListener>();
+    std::shared_ptr<DCameraPipelineSource> pipeline = std::make_shared<DCameraPipelineSource>();
+    if (pipeline->CreateDataProcessPipeline(PipelineType::VIDEO, reader.GetSourceConfig(), reader.GetTargetConfig(),
+        listener) != DCAMERA_OK) {
+        std::cout << "create source pipeline failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    uint32_t fedCount = 0;
+    int64_t startUs = GetNowTimeStampUs();
+    int32_t ret = DCameraFrameReplayer::Replay(reader, pipeline, speed, fedCount);
+    int64_t feedUs = GetNowTimeStampUs() - startUs;
+    std::this_thread::sleep_for(std::chrono::milliseconds(DRAIN_WAIT_MS));
+
+    std::string result;
+    PropertyCarrier carrier;
+    if (pipeline->GetProperty(PIPELINE_STATS, carrier) == DCAMERA_OK) {
+        DumpNodeStats(carrier.nodeStats_, result);
+    }
+    pipeline->DestroyDataProcessPipeline();
+    std::cout << "replayed " << fedCount << " frames in " << feedUs / US_PER_MS << " ms, output "
+        << listener->outputCount_ << " frames, errors " << listener->errorCount_ << std::endl;
+    std::cout << result;
+    return (ret == DCAMERA_OK) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
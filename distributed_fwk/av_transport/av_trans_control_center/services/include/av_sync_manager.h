@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -35,6 +35,7 @@ public:
     void AddStreamInfo(const AVStreamInfo &stream);
     void RemoveStreamInfo(const AVStreamInfo &stream);
     void HandleAvSyncMessage(const std::shared_ptr<AVTransMessage> &message);
+    void UpdateClockOffset(const std::string &offsetMs);
 
 private:
     void EnableSenderAVSync();
@@ -47,6 +48,8 @@ private:
 
 private:
     std::mutex listMutex_;
+    std::mutex clockMutex_;
+    AVSyncDriftEstimator driftEstimator_;
 
     std::vector<AVStreamInfo> streamInfoList_;
     AVTransSharedMemory sourceMemory_;
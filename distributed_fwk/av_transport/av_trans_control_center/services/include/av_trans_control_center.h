@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -25,6 +25,16 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+struct AVTransFirstFrameInfo {
+    std::string ownerName;
+    std::string peerDevId;
+    int64_t lastCostMs = 0;
+    int64_t minCostMs = 0;
+    int64_t maxCostMs = 0;
+    uint32_t sessionCount = 0;
+    uint32_t prewarmedCount = 0;
+};
+
 class AVTransControlCenter : public ISoftbusChannelListener {
     AV_DECLARE_SINGLE_INSTANCE_BASE(AVTransControlCenter);
 public:
@@ -45,11 +55,14 @@ public:
     int32_t SendMessage(const std::shared_ptr<AVTransMessage> &message);
     void SetParam2Engines(AVTransTag tag, const std::string &value);
     void SetParam2Engines(const AVTransSharedMemory &memory);
+    // Time to first frame of the engine sessions per owner, e.g. for hidumper.
+    void DumpFirstFrameInfos(std::vector<AVTransFirstFrameInfo> &infos);
 
 private:
     void HandleChannelEvent(const AVTransEvent &event);
     void HandleDataReceived(const std::string &content, const std::string &peerDevId);
     bool IsInvalidEngineId(int32_t engineId);
+    void RecordFirstFrame(const AVTransEvent &event);
 
 private:
     TransRole transRole_;
@@ -61,10 +74,12 @@ private:
     std::mutex devIdMutex_;
     std::mutex engineIdMutex_;
     std::mutex callbackMutex_;
+    std::mutex firstFrameMutex_;
 
     std::vector<std::string> connectedDevIds_;
     std::map<int32_t, std::string> engine2DevIdMap_;
     std::map<int32_t, sptr<IAvTransControlCenterCallback>> callbackMap_;
+    std::map<std::string, AVTransFirstFrameInfo> firstFrameInfos_;
 };
 }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,15 +15,29 @@
 
 #include "av_sync_manager.h"
 
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
 #include "cJSON.h"
 
 #include "av_trans_control_center.h"
+#include "av_trans_errno.h"
 #include "av_trans_log.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "AVSyncManager"
+namespace {
+constexpr double NS_PER_MS = 1000000.0;
+
+int64_t GetMonotonicTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}
 
 AVSyncManager::AVSyncManager()
 {
@@ -124,10 +138,36 @@ void AVSyncManager::HandleAvSyncMessage(const std::shared_ptr<AVTransMessage> &m
     }
 }
 
+void AVSyncManager::UpdateClockOffset(const std::string &offsetMs)
+{
+    char *end = nullptr;
+    double offset = std::strtod(offsetMs.c_str(), &end);
+    TRUE_RETURN(end == offsetMs.c_str(), "invalid time sync result %{public}s.", offsetMs.c_str());
+
+    std::lock_guard<std::mutex> lock(clockMutex_);
+    driftEstimator_.AddSample(GetMonotonicTime(), std::llround(offset * NS_PER_MS));
+    AVSyncClockDrift drift;
+    if (!driftEstimator_.GetDrift(drift) || IsInValidSharedMemory(sinkMemory_)) {
+        return;
+    }
+    if (WriteClockDriftToMemory(sinkMemory_, drift) != DH_AVT_SUCCESS) {
+        AVTRANS_LOGE("write clock drift to sink shared memory failed.");
+    }
+}
+
 void AVSyncManager::EnableReceiverAVSync(const std::string &groupInfo)
 {
-    size_t size = (sizeof(uint32_t) + sizeof(int64_t)) * MAX_CLOCK_UNIT_COUNT;
-    sinkMemory_ = CreateAVTransSharedMemory("sinkSharedMemory", size);
+    {
+        std::lock_guard<std::mutex> lock(clockMutex_);
+        sinkMemory_ = CreateAVTransSharedMemory("sinkSharedMemory", sizeof(AVSyncClockRegion));
+        if (InitClockUnitMemory(sinkMemory_) != DH_AVT_SUCCESS) {
+            AVTRANS_LOGE("init sink clock shared memory failed.");
+        }
+        AVSyncClockDrift drift;
+        if (driftEstimator_.GetDrift(drift)) {
+            WriteClockDriftToMemory(sinkMemory_, drift);
+        }
+    }
 
     AVTransControlCenter::GetInstance().SetParam2Engines(sinkMemory_);
     AVTransControlCenter::GetInstance().SetParam2Engines(AVTransTag::START_AV_SYNC, groupInfo);
@@ -136,7 +176,10 @@ void AVSyncManager::EnableReceiverAVSync(const std::string &groupInfo)
 void AVSyncManager::DisableReceiverAVSync(const std::string &groupInfo)
 {
     (void)groupInfo;
-    CloseAVTransSharedMemory(sinkMemory_);
+    {
+        std::lock_guard<std::mutex> lock(clockMutex_);
+        CloseAVTransSharedMemory(sinkMemory_);
+    }
     AVTransControlCenter::GetInstance().SetParam2Engines(AVTransTag::STOP_AV_SYNC, "");
     AVTransControlCenter::GetInstance().SetParam2Engines(AVTransSharedMemory{0, 0, "sinkSharedMemory"});
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,11 @@
 
 #include "av_trans_control_center.h"
 
+#include <algorithm>
+#include <cinttypes>
+
+#include "cJSON.h"
+
 #include "anonymous_string.h"
 #include "av_trans_log.h"
 #include "av_trans_errno.h"
@@ -196,6 +201,10 @@ int32_t AVTransControlCenter::NotifyAVCenter(int32_t engineId, const AVTransEven
             syncManager_->RemoveStreamInfo(AVStreamInfo{ event.content, event.peerDevId });
             break;
         }
+        case EventType::EVENT_FIRST_FRAME: {
+            RecordFirstFrame(event);
+            break;
+        }
         default:
             AVTRANS_LOGE("Unsupported event type.");
     }
@@ -243,6 +252,44 @@ void AVTransControlCenter::SetParam2Engines(const AVTransSharedMemory &memory)
     (void)memory;
 }
 
+void AVTransControlCenter::RecordFirstFrame(const AVTransEvent &event)
+{
+    cJSON *jsonObj = cJSON_Parse(event.content.c_str());
+    TRUE_RETURN(jsonObj == nullptr, "parse first frame content failed.");
+    cJSON *ownerObj = cJSON_GetObjectItem(jsonObj, KEY_ONWER_NAME.c_str());
+    cJSON *costObj = cJSON_GetObjectItem(jsonObj, KEY_FIRST_FRAME_COST.c_str());
+    cJSON *prewarmedObj = cJSON_GetObjectItem(jsonObj, KEY_PREWARMED.c_str());
+    if (!cJSON_IsString(ownerObj) || (ownerObj->valuestring == nullptr) || !cJSON_IsNumber(costObj)) {
+        AVTRANS_LOGE("first frame content is invalid.");
+        cJSON_Delete(jsonObj);
+        return;
+    }
+    std::string ownerName = ownerObj->valuestring;
+    int64_t costMs = static_cast<int64_t>(costObj->valuedouble);
+    bool isPrewarmed = cJSON_IsTrue(prewarmedObj);
+    cJSON_Delete(jsonObj);
+
+    AVTRANS_LOGI("First frame of %{public}s from peerDevId=%{public}s after %{public}" PRId64 "ms.",
+        ownerName.c_str(), GetAnonyString(event.peerDevId).c_str(), costMs);
+    std::lock_guard<std::mutex> lock(firstFrameMutex_);
+    AVTransFirstFrameInfo &info = firstFrameInfos_[ownerName];
+    info.ownerName = ownerName;
+    info.peerDevId = event.peerDevId;
+    info.lastCostMs = costMs;
+    info.minCostMs = (info.sessionCount == 0) ? costMs : std::min(info.minCostMs, costMs);
+    info.maxCostMs = std::max(info.maxCostMs, costMs);
+    info.sessionCount++;
+    info.prewarmedCount += isPrewarmed ? 1 : 0;
+}
+
+void AVTransControlCenter::DumpFirstFrameInfos(std::vector<AVTransFirstFrameInfo> &infos)
+{
+    std::lock_guard<std::mutex> lock(firstFrameMutex_);
+    for (const auto &item : firstFrameInfos_) {
+        infos.push_back(item.second);
+    }
+}
+
 void AVTransControlCenter::OnChannelEvent(const AVTransEvent &event)
 {
     AVTRANS_LOGI("OnChannelEvent enter. event type:%{public}d", event.type);
@@ -259,6 +306,9 @@ void AVTransControlCenter::OnChannelEvent(const AVTransEvent &event)
         }
         case EventType::EVENT_TIME_SYNC_RESULT: {
             SetParam2Engines(AVTransTag::TIME_SYNC_RESULT, event.content);
+            if (syncManager_ != nullptr) {
+                syncManager_->UpdateClockOffset(event.content);
+            }
             break;
         }
         default:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -488,5 +488,37 @@ HWTEST_F(AVTransControlCenterTest, is_invalid_engineId_002, TestSize.Level0)
     bool ret = center_->IsInvalidEngineId(engineId);
     EXPECT_EQ(true, ret);
 }
+
+/**
+ * @tc.name: notify_av_center_003
+ * @tc.desc: notify av center function with the first frame of engine sessions.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK9
+ */
+HWTEST_F(AVTransControlCenterTest, notify_av_center_003, TestSize.Level0)
+{
+    center_ = std::make_shared<AVTransControlCenter>();
+    int32_t engineId = BASE_ENGINE_ID;
+    AVTransEvent event;
+    event.type = EventType::EVENT_FIRST_FRAME;
+    event.content = "invalid";
+    event.peerDevId = "peerDevId";
+    EXPECT_EQ(DH_AVT_SUCCESS, center_->NotifyAVCenter(engineId, event));
+    std::vector<AVTransFirstFrameInfo> infos;
+    center_->DumpFirstFrameInfos(infos);
+    EXPECT_TRUE(infos.empty());
+
+    event.content = R"({"ownerName":"ohos.dhardware.dscreen","firstFrameCostMs":120,"prewarmed":false})";
+    EXPECT_EQ(DH_AVT_SUCCESS, center_->NotifyAVCenter(engineId, event));
+    event.content = R"({"ownerName":"ohos.dhardware.dscreen","firstFrameCostMs":40,"prewarmed":true})";
+    EXPECT_EQ(DH_AVT_SUCCESS, center_->NotifyAVCenter(engineId, event));
+    center_->DumpFirstFrameInfos(infos);
+    ASSERT_EQ(1U, infos.size());
+    EXPECT_EQ(40, infos[0].lastCostMs);
+    EXPECT_EQ(40, infos[0].minCostMs);
+    EXPECT_EQ(120, infos[0].maxCostMs);
+    EXPECT_EQ(2U, infos[0].sessionCount);
+    EXPECT_EQ(1U, infos[0].prewarmedCount);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
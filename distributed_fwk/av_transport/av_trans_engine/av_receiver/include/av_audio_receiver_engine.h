@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -56,6 +56,7 @@ public:
     bool StartDumpMediaData() override;
     bool StopDumpMediaData() override;
     bool ReStartDumpMediaData() override;
+    int32_t GetPipelineMetrics(std::string &metrics) override;
 
     // interfaces from ISoftbusChannelListener
     void OnChannelEvent(const AVTransEvent &event) override;
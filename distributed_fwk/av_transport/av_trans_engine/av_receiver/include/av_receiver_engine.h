@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -52,12 +52,17 @@ public:
     AVReceiverEngine(const AVReceiverEngine &other) = delete;
     AVReceiverEngine& operator=(const AVReceiverEngine &other) = delete;
 
+    // Builds the pipeline before the peer is known, Initialize then only binds the session to the peer.
+    int32_t Prewarm();
+    void SetPeerDevId(const std::string &peerDevId);
+
     // interfaces from IAVReceiverEngine
     int32_t Initialize() override;
     int32_t Start() override;
     int32_t Stop() override;
     int32_t Release() override;
     int32_t SetParameter(AVTransTag tag, const std::string &value) override;
+    int32_t SetEngineConfig(const AVTransEngineConfig &config) override;
     int32_t SendMessage(const std::shared_ptr<AVTransMessage> &message) override;
     int32_t CreateControlChannel(const std::vector<std::string> &dstDevIds,
         const ChannelAttribute &attribution) override;
@@ -78,6 +83,7 @@ private:
     int32_t InitControlCenter();
     int32_t PreparePipeline(const std::string &configParam);
     int32_t HandleOutputBuffer(std::shared_ptr<AVBuffer> &hisBuffer);
+    void HandleRepeatFrame(const std::string &content);
 
     void RegRespFunMap();
     void SetVideoWidth(const std::string &value);
@@ -97,7 +103,10 @@ private:
     void SetStopAvSync(const std::string &value);
     void SetSharedMemoryFd(const std::string &value);
     void SetEngineReady(const std::string &value);
+    void SetDisplayVsync(const std::string &value);
     void SetParameterInner(AVTransTag tag, const std::string &value);
+    void ApplyFilterConfig(const AVTransEngineConfig &config);
+    void NotifyFirstFrame();
 
     StateId GetCurrentState()
     {
@@ -117,6 +126,7 @@ private:
     std::string sessionName_;
     std::string peerDevId_;
     std::mutex stateMutex_;
+    std::mutex configMutex_;
     std::atomic<bool> isInitialized_ = false;
     std::atomic<StateId> currentState_ = StateId::IDLE;
 
@@ -132,6 +142,10 @@ private:
 
     using SetParaFunc = void (AVReceiverEngine::*)(const std::string &value);
     std::map<AVTransTag, SetParaFunc> funcMap_;
+
+    bool isPrewarmed_ = false;
+    int64_t initTime_ = 0;
+    std::atomic<bool> isFirstFrameNotified_ {false};
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,13 +16,17 @@
 #ifndef OHOS_AV_RECEIVER_ENGINE_PROVIDER_H
 #define OHOS_AV_RECEIVER_ENGINE_PROVIDER_H
 
+#include <atomic>
 #include <mutex>
+#include <thread>
 
 #include "i_av_engine_provider.h"
 #include "softbus_channel_adapter.h"
 
 namespace OHOS {
 namespace DistributedHardware {
+class AVReceiverEngine;
+
 class AVReceiverEngineProvider : public IAVEngineProvider, public ISoftbusChannelListener {
 public:
     AVReceiverEngineProvider(const std::string &ownerName);
@@ -36,6 +40,10 @@ public:
     void OnChannelEvent(const AVTransEvent &event) override;
     void OnStreamReceived(const StreamData *data, const StreamData *ext) override;
 
+private:
+    void StartPrewarm();
+    std::shared_ptr<AVReceiverEngine> TakeWarmEngine(const std::string &peerDevId);
+
 private:
     std::string ownerName_;
     std::string sessionName_;
@@ -43,6 +51,13 @@ private:
     std::mutex callbackMutex_;
     std::shared_ptr<IAVEngineProviderCallback> providerCallback_;
     std::vector<std::shared_ptr<IAVReceiverEngine>> receiverEngineList_;
+
+    // One engine with its pipeline built ahead, handed to the next CreateAVReceiverEngine.
+    std::mutex warmMutex_;
+    std::thread warmThread_;
+    std::atomic<bool> isWarming_ {false};
+    std::atomic<bool> isPrewarmFailed_ {false};
+    std::shared_ptr<AVReceiverEngine> warmEngine_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -623,6 +623,13 @@ bool AVAudioReceiverEngine::ReStartDumpMediaData()
     return true;
 }
 
+int32_t AVAudioReceiverEngine::GetPipelineMetrics(std::string &metrics)
+{
+    TRUE_RETURN_V_MSG_E(pipeline_ == nullptr, ERR_DH_AVT_NULL_POINTER, "pipeline is nullptr");
+    pipeline_->DumpMetrics(metrics);
+    return DH_AVT_SUCCESS;
+}
+
 int32_t AVAudioReceiverEngine::HandleOutputBuffer(std::shared_ptr<Media::AVBuffer> &hisBuffer)
 {
     StateId currentState = GetCurrentState();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,8 @@
 
 #include "av_receiver_engine.h"
 
+#include <cstdlib>
+
 #include "pipeline/factory/filter_factory.h"
 #include "plugin_video_tags.h"
 
@@ -50,12 +52,36 @@ AVReceiverEngine::~AVReceiverEngine()
     ctlCtrCallback_ = nullptr;
 }
 
+int32_t AVReceiverEngine::Prewarm()
+{
+    TRUE_RETURN_V_MSG_E(isInitialized_.load() || (pipeline_ != nullptr), DH_AVT_SUCCESS,
+        "receiver engine pipeline has been built");
+    int32_t ret = InitPipeline();
+    if (ret != DH_AVT_SUCCESS) {
+        AVTRANS_LOGE("prewarm pipeline failed, ret=%{public}d", ret);
+        pipeline_ = nullptr;
+        return ERR_DH_AVT_INIT_FAILED;
+    }
+    isPrewarmed_ = true;
+    return DH_AVT_SUCCESS;
+}
+
+void AVReceiverEngine::SetPeerDevId(const std::string &peerDevId)
+{
+    TRUE_RETURN(isInitialized_.load(), "receiver engine has been initialized");
+    peerDevId_ = peerDevId;
+}
+
 int32_t AVReceiverEngine::Initialize()
 {
-    TRUE_RETURN_V_MSG_E(isInitialized_.load(), DH_AVT_SUCCESS, "sender engine has been initialized");
+    TRUE_RETURN_V_MSG_E(isInitialized_.load(), DH_AVT_SUCCESS, "receiver engine has been initialized");
+    initTime_ = GetCurrentTime();
 
-    int32_t ret = InitPipeline();
-    TRUE_RETURN_V_MSG_E(ret != DH_AVT_SUCCESS, ERR_DH_AVT_INIT_FAILED, "init pipeline failed");
+    int32_t ret = DH_AVT_SUCCESS;
+    if (pipeline_ == nullptr) {
+        ret = InitPipeline();
+        TRUE_RETURN_V_MSG_E(ret != DH_AVT_SUCCESS, ERR_DH_AVT_INIT_FAILED, "init pipeline failed");
+    }
 
     ret = InitControlCenter();
     TRUE_RETURN_V_MSG_E(ret != DH_AVT_SUCCESS, ERR_DH_AVT_INIT_FAILED, "init av control center failed");
@@ -277,6 +303,9 @@ void AVReceiverEngine::SetParameterInner(AVTransTag tag, const std::string &valu
         case AVTransTag::ENGINE_READY:
             SetEngineReady(value);
             break;
+        case AVTransTag::VIDEO_DISPLAY_VSYNC:
+            SetDisplayVsync(value);
+            break;
         default:
             break;
     }
@@ -287,6 +316,7 @@ int32_t AVReceiverEngine::SetParameter(AVTransTag tag, const std::string &value)
     bool isFilterNull = (avInput_ == nullptr) || (avOutput_ == nullptr) || (pipeline_ == nullptr);
     TRUE_RETURN_V_MSG_E(isFilterNull, ERR_DH_AVT_SETUP_FAILED, "filter or pipeline is null, set parameter failed.");
     AVTRANS_LOGI("AVTransTag=%{public}u.", tag);
+    std::lock_guard<std::mutex> lock(configMutex_);
     switch (tag) {
         case AVTransTag::VIDEO_WIDTH:
             SetVideoWidth(value);
@@ -315,6 +345,7 @@ int32_t AVReceiverEngine::SetParameter(AVTransTag tag, const std::string &value)
         case AVTransTag::STOP_AV_SYNC:
         case AVTransTag::SHARED_MEMORY_FD:
         case AVTransTag::ENGINE_READY:
+        case AVTransTag::VIDEO_DISPLAY_VSYNC:
             SetParameterInner(tag, value);
             break;
         default:
@@ -324,6 +355,60 @@ int32_t AVReceiverEngine::SetParameter(AVTransTag tag, const std::string &value)
     return DH_AVT_SUCCESS;
 }
 
+int32_t AVReceiverEngine::SetEngineConfig(const AVTransEngineConfig &config)
+{
+    bool isFilterNull = (avInput_ == nullptr) || (avOutput_ == nullptr) || (pipeline_ == nullptr);
+    TRUE_RETURN_V_MSG_E(isFilterNull, ERR_DH_AVT_SETUP_FAILED, "filter or pipeline is null, set config failed.");
+    StateId currentState = GetCurrentState();
+    bool isStarted = (currentState == StateId::STARTED) || (currentState == StateId::PLAYING);
+    int32_t ret = CheckEngineConfig(config, isStarted);
+    TRUE_RETURN_V(ret != DH_AVT_SUCCESS, ret);
+
+    std::lock_guard<std::mutex> lock(configMutex_);
+    if (config.HasItem(EngineConfigItem::VIDEO_CODEC_TYPE)) {
+        SetVideoCodecType(config.videoCodecType);
+    }
+    if (config.HasItem(EngineConfigItem::AUDIO_CODEC_TYPE)) {
+        SetAudioCodecType(config.audioCodecType);
+    }
+    ApplyFilterConfig(config);
+    AVTRANS_LOGI("SetEngineConfig success, item mask=%{public}u, state=%{public}u.", config.itemMask,
+        static_cast<uint32_t>(currentState));
+    return DH_AVT_SUCCESS;
+}
+
+void AVReceiverEngine::ApplyFilterConfig(const AVTransEngineConfig &config)
+{
+    struct FilterConfigItem {
+        EngineConfigItem item;
+        Plugin::Tag tag;
+        int32_t value;
+        bool isToOutput;
+    };
+    const FilterConfigItem items[] = {
+        { EngineConfigItem::VIDEO_WIDTH, Plugin::Tag::VIDEO_WIDTH, config.videoWidth, false },
+        { EngineConfigItem::VIDEO_HEIGHT, Plugin::Tag::VIDEO_HEIGHT, config.videoHeight, false },
+        { EngineConfigItem::VIDEO_FRAME_RATE, Plugin::Tag::VIDEO_FRAME_RATE, config.videoFrameRate, true },
+        { EngineConfigItem::VIDEO_BIT_RATE, Plugin::Tag::MEDIA_BITRATE, config.videoBitRate, false },
+        { EngineConfigItem::AUDIO_BIT_RATE, Plugin::Tag::MEDIA_BITRATE, config.audioBitRate, false },
+        { EngineConfigItem::AUDIO_CHANNEL_MASK, Plugin::Tag::AUDIO_CHANNELS, config.audioChannels, true },
+        { EngineConfigItem::AUDIO_SAMPLE_RATE, Plugin::Tag::AUDIO_SAMPLE_RATE, config.audioSampleRate, true },
+        { EngineConfigItem::AUDIO_CHANNEL_LAYOUT, Plugin::Tag::AUDIO_CHANNEL_LAYOUT, config.audioChannelLayout, true },
+        { EngineConfigItem::AUDIO_SAMPLE_FORMAT, Plugin::Tag::AUDIO_SAMPLE_FORMAT, config.audioSampleFormat, false },
+        { EngineConfigItem::AUDIO_FRAME_SIZE, Plugin::Tag::AUDIO_SAMPLE_PER_FRAME, config.audioFrameSize, false },
+    };
+    for (const auto &item : items) {
+        if (!config.HasItem(item.item)) {
+            continue;
+        }
+        ErrorCode ret = avInput_->SetParameter(static_cast<int32_t>(item.tag), item.value);
+        if ((ret == ErrorCode::SUCCESS) && item.isToOutput) {
+            ret = avOutput_->SetParameter(static_cast<int32_t>(item.tag), item.value);
+        }
+        TRUE_LOG_MSG(ret != ErrorCode::SUCCESS, "set config item=%{public}u failed.", static_cast<uint32_t>(item.item));
+    }
+}
+
 void AVReceiverEngine::RegRespFunMap()
 {
     funcMap_[AVTransTag::VIDEO_WIDTH] = &AVReceiverEngine::SetVideoWidth;
@@ -343,6 +428,7 @@ void AVReceiverEngine::RegRespFunMap()
     funcMap_[AVTransTag::STOP_AV_SYNC] = &AVReceiverEngine::SetStopAvSync;
     funcMap_[AVTransTag::SHARED_MEMORY_FD] = &AVReceiverEngine::SetSharedMemoryFd;
     funcMap_[AVTransTag::ENGINE_READY] = &AVReceiverEngine::SetEngineReady;
+    funcMap_[AVTransTag::VIDEO_DISPLAY_VSYNC] = &AVReceiverEngine::SetDisplayVsync;
 }
 
 void AVReceiverEngine::SetVideoWidth(const std::string &value)
@@ -545,6 +631,17 @@ void AVReceiverEngine::SetSyncResult(const std::string &value)
     AVTRANS_LOGI("SetParameter USER_TIME_SYNC_RESULT success, time sync result = %{public}s", value.c_str());
 }
 
+void AVReceiverEngine::SetDisplayVsync(const std::string &value)
+{
+    if (avOutput_ == nullptr) {
+        AVTRANS_LOGE("avOutput_ is nullptr.");
+        return;
+    }
+    // The output plugin paces frame release on this vsync, value is "<vsync time ns>,<vsync period ns>".
+    avOutput_->SetParameter(static_cast<int32_t>(Plugin::Tag::SECTION_VIDEO_SPECIFIC_START), value);
+    AVTRANS_LOGD("SetParameter display vsync = %{public}s", value.c_str());
+}
+
 void AVReceiverEngine::SetStartAvSync(const std::string &value)
 {
     if (avOutput_ == nullptr) {
@@ -641,9 +738,23 @@ int32_t AVReceiverEngine::HandleOutputBuffer(std::shared_ptr<AVBuffer> &hisBuffe
 
     SetCurrentState(StateId::PLAYING);
     TRUE_RETURN_V(receiverCallback_ == nullptr, ERR_DH_AVT_OUTPUT_DATA_FAILED);
+    NotifyFirstFrame();
     return receiverCallback_->OnDataAvailable(transBuffer);
 }
 
+void AVReceiverEngine::NotifyFirstFrame()
+{
+    if ((initTime_ == 0) || isFirstFrameNotified_.exchange(true)) {
+        return;
+    }
+    int64_t costMs = (GetCurrentTime() - initTime_) / NS_ONE_MS;
+    AVTRANS_LOGI("First frame of %{public}s after %{public}" PRId64 "ms, prewarmed=%{public}d.", ownerName_.c_str(),
+        costMs, isPrewarmed_);
+    TRUE_RETURN(dhFwkKit_ == nullptr, "dh fwk kit is nullptr.");
+    dhFwkKit_->NotifyAVCenter(engineId_, { EventType::EVENT_FIRST_FRAME,
+        BuildFirstFrameContent(ownerName_, costMs, isPrewarmed_), peerDevId_ });
+}
+
 void AVReceiverEngine::OnChannelEvent(const AVTransEvent &event)
 {
     AVTRANS_LOGI("OnChannelEvent enter. event type:%{public}" PRId32, event.type);
@@ -671,6 +782,10 @@ void AVReceiverEngine::OnChannelEvent(const AVTransEvent &event)
         case EventType::EVENT_DATA_RECEIVED: {
             auto avMessage = std::make_shared<AVTransMessage>();
             TRUE_RETURN(!avMessage->UnmarshalMessage(event.content, event.peerDevId), "unmarshal message failed");
+            if (avMessage->type_ == static_cast<uint32_t>(AVTransTag::VIDEO_REPEAT_FRAME)) {
+                HandleRepeatFrame(avMessage->content_);
+                break;
+            }
             receiverCallback_->OnMessageReceived(avMessage);
             break;
         }
@@ -679,6 +794,14 @@ void AVReceiverEngine::OnChannelEvent(const AVTransEvent &event)
     }
 }
 
+void AVReceiverEngine::HandleRepeatFrame(const std::string &content)
+{
+    TRUE_RETURN(avOutput_ == nullptr, "av output filter is null");
+    // The sender skipped a static frame, the output plugin repeats its last decoded frame with this pts.
+    int64_t pts = std::strtoll(content.c_str(), nullptr, 10); // 10: decimal
+    avOutput_->SetParameter(static_cast<int32_t>(Plugin::Tag::USER_FRAME_PTS), pts);
+}
+
 void AVReceiverEngine::OnStreamReceived(const StreamData *data, const StreamData *ext)
 {
     (void)data;
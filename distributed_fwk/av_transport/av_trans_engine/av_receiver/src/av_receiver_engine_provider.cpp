@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -30,11 +30,16 @@ AVReceiverEngineProvider::AVReceiverEngineProvider(const std::string &ownerName)
         SoftbusChannelAdapter::GetInstance().CreateChannelServer(TransName2PkgName(ownerName), sessionName_);
         SoftbusChannelAdapter::GetInstance().RegisterChannelListener(sessionName_, AV_TRANS_SPECIAL_DEVICE_ID, this);
     }
+    StartPrewarm();
 }
 
 AVReceiverEngineProvider::~AVReceiverEngineProvider()
 {
     AVTRANS_LOGI("AVReceiverEngineProvider dctor.");
+    if (warmThread_.joinable()) {
+        warmThread_.join();
+    }
+    warmEngine_ = nullptr;
     {
         std::lock_guard<std::mutex> lock(listMutex_);
         for (auto &receiver : receiverEngineList_) {
@@ -57,18 +62,59 @@ AVReceiverEngineProvider::~AVReceiverEngineProvider()
 std::shared_ptr<IAVReceiverEngine> AVReceiverEngineProvider::CreateAVReceiverEngine(const std::string &peerDevId)
 {
     AVTRANS_LOGI("CreateAVReceiverEngine enter.");
-    auto receiver = std::make_shared<AVReceiverEngine>(ownerName_, peerDevId);
+    auto receiver = TakeWarmEngine(peerDevId);
     if (receiver && receiver->Initialize() == DH_AVT_SUCCESS) {
         {
             std::lock_guard<std::mutex> lock(listMutex_);
             receiverEngineList_.push_back(receiver);
         }
+        StartPrewarm();
         return receiver;
     }
+    StartPrewarm();
     AVTRANS_LOGE("create receiver failed or receiver init failed.");
     return nullptr;
 }
 
+std::shared_ptr<AVReceiverEngine> AVReceiverEngineProvider::TakeWarmEngine(const std::string &peerDevId)
+{
+    std::shared_ptr<AVReceiverEngine> receiver = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(warmMutex_);
+        receiver.swap(warmEngine_);
+    }
+    if (receiver == nullptr) {
+        return std::make_shared<AVReceiverEngine>(ownerName_, peerDevId);
+    }
+    AVTRANS_LOGI("take the prewarmed receiver engine.");
+    receiver->SetPeerDevId(peerDevId);
+    return receiver;
+}
+
+void AVReceiverEngineProvider::StartPrewarm()
+{
+    std::lock_guard<std::mutex> lock(warmMutex_);
+    if ((warmEngine_ != nullptr) || isWarming_.load() || isPrewarmFailed_.load()) {
+        return;
+    }
+    if (warmThread_.joinable()) {
+        warmThread_.join();
+    }
+    isWarming_ = true;
+    warmThread_ = std::thread([this]() {
+        auto receiver = std::make_shared<AVReceiverEngine>(ownerName_, "");
+        bool isWarm = (receiver->Prewarm() == DH_AVT_SUCCESS);
+        std::lock_guard<std::mutex> warmLock(warmMutex_);
+        if (isWarm) {
+            warmEngine_ = receiver;
+        } else {
+            // An owner without a pipeline never warms up, so it is not tried again.
+            isPrewarmFailed_ = true;
+        }
+        isWarming_ = false;
+    });
+}
+
 std::vector<std::shared_ptr<IAVReceiverEngine>> AVReceiverEngineProvider::GetAVReceiverEngineList()
 {
     std::lock_guard<std::mutex> lock(listMutex_);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -859,5 +859,57 @@ HWTEST_F(AvReceiverEngineTest, OnStreamReceived_001, testing::ext::TestSize.Leve
     StreamData *ext = nullptr;
     EXPECT_NO_FATAL_FAILURE(receiver->OnStreamReceived(data, ext));
 }
+
+HWTEST_F(AvReceiverEngineTest, SetEngineConfig_001, testing::ext::TestSize.Level1)
+{
+    std::string ownerName = "001";
+    std::string peerDevId = "pEid";
+    auto receiver = std::make_shared<AVReceiverEngine>(ownerName, peerDevId);
+    AVTransEngineConfig config;
+    config.AddItem(EngineConfigItem::VIDEO_WIDTH);
+    config.videoWidth = 1920;
+    EXPECT_EQ(ERR_DH_AVT_SETUP_FAILED, receiver->SetEngineConfig(config));
+
+    receiver->avInput_ = FilterFactory::Instance().CreateFilterWithType<AVInputFilter>(AVINPUT_NAME, "avinput");
+    receiver->avOutput_ = FilterFactory::Instance().CreateFilterWithType<AVOutputFilter>(AVOUTPUT_NAME, "avoutput");
+    receiver->pipeline_ = std::make_shared<OHOS::Media::Pipeline::PipelineCore>();
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, receiver->SetEngineConfig(AVTransEngineConfig()));
+
+    config.AddItem(EngineConfigItem::VIDEO_HEIGHT);
+    config.videoHeight = 0;
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM_VALUE, receiver->SetEngineConfig(config));
+    config.videoHeight = 1080;
+    config.AddItem(EngineConfigItem::VIDEO_CODEC_TYPE);
+    config.videoCodecType = "video/unknown";
+    EXPECT_EQ(ERR_DH_AVT_UNSUPPORTED_FORMAT, receiver->SetEngineConfig(config));
+    config.videoCodecType = MIME_VIDEO_H265;
+    config.AddItem(EngineConfigItem::VIDEO_FRAME_RATE);
+    config.videoFrameRate = 60;
+    config.AddItem(EngineConfigItem::VIDEO_BIT_RATE);
+    config.videoBitRate = 8000000;
+    EXPECT_EQ(DH_AVT_SUCCESS, receiver->SetEngineConfig(config));
+}
+
+HWTEST_F(AvReceiverEngineTest, SetEngineConfig_002, testing::ext::TestSize.Level1)
+{
+    std::string ownerName = "001";
+    std::string peerDevId = "pEid";
+    auto receiver = std::make_shared<AVReceiverEngine>(ownerName, peerDevId);
+    receiver->avInput_ = FilterFactory::Instance().CreateFilterWithType<AVInputFilter>(AVINPUT_NAME, "avinput");
+    receiver->avOutput_ = FilterFactory::Instance().CreateFilterWithType<AVOutputFilter>(AVOUTPUT_NAME, "avoutput");
+    receiver->pipeline_ = std::make_shared<OHOS::Media::Pipeline::PipelineCore>();
+    receiver->SetCurrentState(StateId::PLAYING);
+
+    AVTransEngineConfig config;
+    config.AddItem(EngineConfigItem::VIDEO_BIT_RATE);
+    config.videoBitRate = 4000000;
+    config.AddItem(EngineConfigItem::VIDEO_WIDTH);
+    config.videoWidth = 1280;
+    EXPECT_EQ(DH_AVT_SUCCESS, receiver->SetEngineConfig(config));
+
+    config.AddItem(EngineConfigItem::AUDIO_SAMPLE_RATE);
+    config.audioSampleRate = 48000;
+    EXPECT_EQ(ERR_DH_AVT_INVALID_STATE, receiver->SetEngineConfig(config));
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -51,12 +51,17 @@ public:
     AVSenderEngine(const AVSenderEngine &other) = delete;
     AVSenderEngine& operator=(const AVSenderEngine &other) = delete;
 
+    // Builds the pipeline before the peer is known, Initialize then only binds the session to the peer.
+    int32_t Prewarm();
+    void SetPeerDevId(const std::string &peerDevId);
+
     // interfaces from IAVSenderEngine
     int32_t Initialize() override;
     int32_t Start() override;
     int32_t Stop() override;
     int32_t Release() override;
     int32_t SetParameter(AVTransTag tag, const std::string &value) override;
+    int32_t SetEngineConfig(const AVTransEngineConfig &config) override;
     int32_t PushData(const std::shared_ptr<AVTransBuffer> &buffer) override;
     int32_t SendMessage(const std::shared_ptr<AVTransMessage> &message) override;
     int32_t CreateControlChannel(const std::vector<std::string> &dstDevIds,
@@ -78,6 +83,8 @@ private:
     int32_t InitControlCenter();
     int32_t PreparePipeline(const std::string &configParam);
     void NotifyStreamChange(EventType type);
+    bool IsSkippableStaticFrame(const std::shared_ptr<AVTransBuffer> &buffer);
+    void NotifyRepeatFrame(const std::shared_ptr<AVTransBuffer> &buffer);
 
     void RegRespFunMap();
     void SetVideoWidth(const std::string &value);
@@ -98,6 +105,8 @@ private:
     void SetEnginePause(const std::string &value);
     void SetEngineResume(const std::string &value);
     void SetParameterInner(AVTransTag tag, const std::string &value);
+    void ApplyFilterConfig(const AVTransEngineConfig &config);
+    void NotifyFirstFrame();
 
     StateId GetCurrentState()
     {
@@ -118,6 +127,7 @@ private:
     std::string peerDevId_;
 
     std::mutex stateMutex_;
+    std::mutex configMutex_;
     std::atomic<bool> isInitialized_ = false;
     std::atomic<StateId> currentState_ = StateId::IDLE;
 
@@ -133,6 +143,16 @@ private:
 
     using SetParaFunc = void (AVSenderEngine::*)(const std::string &value);
     std::map<AVTransTag, SetParaFunc> funcMap_;
+
+    bool isPrewarmed_ = false;
+    int64_t initTime_ = 0;
+    std::atomic<bool> isFirstFrameNotified_ {false};
+
+    // A static screen still sends a full frame this often, so a lost repeat message leaves no stale picture.
+    constexpr static int64_t STATIC_FRAME_REFRESH_TIME = 1000 * NS_ONE_MS;
+    constexpr static uint64_t REPEAT_FRAME_LOG_INTERVAL = 100;
+    int64_t lastFullFrameTime_ = 0;
+    uint64_t repeatFrameCount_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -330,6 +330,9 @@ int32_t AVAudioSenderEngine::SetParameter(AVTransTag tag, const std::string &val
         case AVTransTag::AUDIO_BIT_RATE:
             SetAudioBitRate(value);
             break;
+        case AVTransTag::AUDIO_LINK_QUALITY:
+            SetAudioLinkQuality(value);
+            break;
         case AVTransTag::VIDEO_BIT_RATE:
             SetVideoBitRate(value);
             break;
@@ -366,6 +369,7 @@ void AVAudioSenderEngine::RegRespFunMap()
     funcMap_[AVTransTag::VIDEO_PIXEL_FORMAT] = &AVAudioSenderEngine::SetVideoPixelFormat;
     funcMap_[AVTransTag::VIDEO_FRAME_RATE] = &AVAudioSenderEngine::SetVideoFrameRate;
     funcMap_[AVTransTag::AUDIO_BIT_RATE] = &AVAudioSenderEngine::SetAudioBitRate;
+    funcMap_[AVTransTag::AUDIO_LINK_QUALITY] = &AVAudioSenderEngine::SetAudioLinkQuality;
     funcMap_[AVTransTag::VIDEO_BIT_RATE] = &AVAudioSenderEngine::SetVideoBitRate;
     funcMap_[AVTransTag::VIDEO_CODEC_TYPE] = &AVAudioSenderEngine::SetVideoCodecType;
     funcMap_[AVTransTag::AUDIO_CODEC_TYPE] = &AVAudioSenderEngine::SetAudioCodecType;
@@ -455,6 +459,23 @@ void AVAudioSenderEngine::SetAudioBitRate(const std::string &value)
     }
 }
 
+void AVAudioSenderEngine::SetAudioLinkQuality(const std::string &value)
+{
+    if (encoderFilter_ == nullptr) {
+        AVTRANS_LOGE("encoderFilter_ is nullptr.");
+        return;
+    }
+    size_t pos = value.find(',');
+    int lossPercent = 0;
+    int rttMs = 0;
+    if (pos == std::string::npos || !ConvertToInt(value.substr(0, pos), lossPercent) ||
+        !ConvertToInt(value.substr(pos + 1), rttMs)) {
+        AVTRANS_LOGE("SetParameter AUDIO_LINK_QUALITY failed, value conversion failed.");
+        return;
+    }
+    encoderFilter_->OnLinkQuality(lossPercent, rttMs);
+}
+
 void AVAudioSenderEngine::SetVideoBitRate(const std::string &value)
 {
     if (meta_ == nullptr) {
@@ -694,6 +715,13 @@ bool AVAudioSenderEngine::ReStartDumpMediaData()
     return true;
 }
 
+int32_t AVAudioSenderEngine::GetPipelineMetrics(std::string &metrics)
+{
+    TRUE_RETURN_V_MSG_E(pipeline_ == nullptr, ERR_DH_AVT_NULL_POINTER, "pipeline is nullptr");
+    pipeline_->DumpMetrics(metrics);
+    return DH_AVT_SUCCESS;
+}
+
 void AVAudioSenderEngine::NotifyStreamChange(EventType type)
 {
     AVTRANS_LOGI("NotifyStreamChange enter, change type=%{public}" PRId32, type);
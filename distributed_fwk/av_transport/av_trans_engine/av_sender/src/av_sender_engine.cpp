@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -51,12 +51,36 @@ AVSenderEngine::~AVSenderEngine()
     ctlCenCallback_ = nullptr;
 }
 
+int32_t AVSenderEngine::Prewarm()
+{
+    TRUE_RETURN_V_MSG_E(isInitialized_.load() || (pipeline_ != nullptr), DH_AVT_SUCCESS,
+        "sender engine pipeline has been built");
+    int32_t ret = InitPipeline();
+    if (ret != DH_AVT_SUCCESS) {
+        AVTRANS_LOGE("prewarm pipeline failed, ret=%{public}d", ret);
+        pipeline_ = nullptr;
+        return ERR_DH_AVT_INIT_FAILED;
+    }
+    isPrewarmed_ = true;
+    return DH_AVT_SUCCESS;
+}
+
+void AVSenderEngine::SetPeerDevId(const std::string &peerDevId)
+{
+    TRUE_RETURN(isInitialized_.load(), "sender engine has been initialized");
+    peerDevId_ = peerDevId;
+}
+
 int32_t AVSenderEngine::Initialize()
 {
     TRUE_RETURN_V_MSG_E(isInitialized_.load(), DH_AVT_SUCCESS, "sender engine has been initialized");
+    initTime_ = GetCurrentTime();
 
-    int32_t ret = InitPipeline();
-    TRUE_RETURN_V_MSG_E(ret != DH_AVT_SUCCESS, ERR_DH_AVT_INIT_FAILED, "init pipeline failed");
+    int32_t ret = DH_AVT_SUCCESS;
+    if (pipeline_ == nullptr) {
+        ret = InitPipeline();
+        TRUE_RETURN_V_MSG_E(ret != DH_AVT_SUCCESS, ERR_DH_AVT_INIT_FAILED, "init pipeline failed");
+    }
 
     ret = InitControlCenter();
     TRUE_RETURN_V_MSG_E(ret != DH_AVT_SUCCESS, ERR_DH_AVT_INIT_FAILED, "init av control center failed");
@@ -183,6 +207,7 @@ int32_t AVSenderEngine::Stop()
     ErrorCode ret = pipeline_->Stop();
     TRUE_RETURN_V_MSG_E(ret != ErrorCode::SUCCESS, ERR_DH_AVT_STOP_FAILED, "stop pipeline failed");
     SetCurrentState(StateId::STOPPED);
+    lastFullFrameTime_ = 0;
     NotifyStreamChange(EventType::EVENT_REMOVE_STREAM);
     AVTRANS_LOGI("Stop sender engine success.");
     return DH_AVT_SUCCESS;
@@ -258,6 +283,7 @@ int32_t AVSenderEngine::SetParameter(AVTransTag tag, const std::string &value)
     bool isFilterNull = (avInput_ == nullptr) || (avOutput_ == nullptr) || (pipeline_ == nullptr);
     TRUE_RETURN_V_MSG_E(isFilterNull, ERR_DH_AVT_SETUP_FAILED, "filter or pipeline is null, set parameter failed.");
     AVTRANS_LOGI("AVTransTag=%{public}u.", tag);
+    std::lock_guard<std::mutex> lock(configMutex_);
     switch (tag) {
         case AVTransTag::VIDEO_WIDTH:
             SetVideoWidth(value);
@@ -297,6 +323,60 @@ int32_t AVSenderEngine::SetParameter(AVTransTag tag, const std::string &value)
     return DH_AVT_SUCCESS;
 }
 
+int32_t AVSenderEngine::SetEngineConfig(const AVTransEngineConfig &config)
+{
+    bool isFilterNull = (avInput_ == nullptr) || (avOutput_ == nullptr) || (pipeline_ == nullptr);
+    TRUE_RETURN_V_MSG_E(isFilterNull, ERR_DH_AVT_SETUP_FAILED, "filter or pipeline is null, set config failed.");
+    StateId currentState = GetCurrentState();
+    bool isStarted = (currentState == StateId::STARTED) || (currentState == StateId::PLAYING);
+    int32_t ret = CheckEngineConfig(config, isStarted);
+    TRUE_RETURN_V(ret != DH_AVT_SUCCESS, ret);
+
+    std::lock_guard<std::mutex> lock(configMutex_);
+    if (config.HasItem(EngineConfigItem::VIDEO_CODEC_TYPE)) {
+        SetVideoCodecType(config.videoCodecType);
+    }
+    if (config.HasItem(EngineConfigItem::AUDIO_CODEC_TYPE)) {
+        SetAudioCodecType(config.audioCodecType);
+    }
+    ApplyFilterConfig(config);
+    AVTRANS_LOGI("SetEngineConfig success, item mask=%{public}u, state=%{public}u.", config.itemMask,
+        static_cast<uint32_t>(currentState));
+    return DH_AVT_SUCCESS;
+}
+
+void AVSenderEngine::ApplyFilterConfig(const AVTransEngineConfig &config)
+{
+    struct FilterConfigItem {
+        EngineConfigItem item;
+        Plugin::Tag tag;
+        int32_t value;
+        bool isToOutput;
+    };
+    const FilterConfigItem items[] = {
+        { EngineConfigItem::VIDEO_WIDTH, Plugin::Tag::VIDEO_WIDTH, config.videoWidth, false },
+        { EngineConfigItem::VIDEO_HEIGHT, Plugin::Tag::VIDEO_HEIGHT, config.videoHeight, false },
+        { EngineConfigItem::VIDEO_FRAME_RATE, Plugin::Tag::VIDEO_FRAME_RATE, config.videoFrameRate, true },
+        { EngineConfigItem::VIDEO_BIT_RATE, Plugin::Tag::MEDIA_BITRATE, config.videoBitRate, false },
+        { EngineConfigItem::AUDIO_BIT_RATE, Plugin::Tag::MEDIA_BITRATE, config.audioBitRate, false },
+        { EngineConfigItem::AUDIO_CHANNEL_MASK, Plugin::Tag::AUDIO_CHANNELS, config.audioChannels, true },
+        { EngineConfigItem::AUDIO_SAMPLE_RATE, Plugin::Tag::AUDIO_SAMPLE_RATE, config.audioSampleRate, true },
+        { EngineConfigItem::AUDIO_CHANNEL_LAYOUT, Plugin::Tag::AUDIO_CHANNEL_LAYOUT, config.audioChannelLayout, true },
+        { EngineConfigItem::AUDIO_SAMPLE_FORMAT, Plugin::Tag::AUDIO_SAMPLE_FORMAT, config.audioSampleFormat, false },
+        { EngineConfigItem::AUDIO_FRAME_SIZE, Plugin::Tag::AUDIO_SAMPLE_PER_FRAME, config.audioFrameSize, false },
+    };
+    for (const auto &item : items) {
+        if (!config.HasItem(item.item)) {
+            continue;
+        }
+        ErrorCode ret = avInput_->SetParameter(static_cast<int32_t>(item.tag), item.value);
+        if ((ret == ErrorCode::SUCCESS) && item.isToOutput) {
+            ret = avOutput_->SetParameter(static_cast<int32_t>(item.tag), item.value);
+        }
+        TRUE_LOG_MSG(ret != ErrorCode::SUCCESS, "set config item=%{public}u failed.", static_cast<uint32_t>(item.item));
+    }
+}
+
 void AVSenderEngine::RegRespFunMap()
 {
     funcMap_[AVTransTag::VIDEO_WIDTH] = &AVSenderEngine::SetVideoWidth;
@@ -583,16 +663,52 @@ int32_t AVSenderEngine::PushData(const std::shared_ptr<AVTransBuffer> &buffer)
     }
     TRUE_RETURN_V_MSG_E(avInput_ == nullptr, ERR_DH_AVT_PUSH_DATA_FAILED, "av input filter is null");
 
+    if (IsSkippableStaticFrame(buffer)) {
+        NotifyRepeatFrame(buffer);
+        return DH_AVT_SUCCESS;
+    }
+
     std::shared_ptr<AVBuffer> hisBuffer = TransBuffer2HiSBuffer(buffer);
     TRUE_RETURN_V(hisBuffer == nullptr, ERR_DH_AVT_PUSH_DATA_FAILED);
 
     ErrorCode ret = avInput_->PushData(avInput_->GetName(), hisBuffer, -1);
     TRUE_RETURN_V(ret != ErrorCode::SUCCESS, ERR_DH_AVT_PUSH_DATA_FAILED);
 
+    lastFullFrameTime_ = GetCurrentTime();
+    NotifyFirstFrame();
     SetCurrentState(StateId::PLAYING);
     return DH_AVT_SUCCESS;
 }
 
+bool AVSenderEngine::IsSkippableStaticFrame(const std::shared_ptr<AVTransBuffer> &buffer)
+{
+    if ((buffer == nullptr) || (buffer->GetBufferMeta() == nullptr) || (lastFullFrameTime_ == 0)) {
+        return false;
+    }
+    // Producers without damage tracking leave the tag unset, their frames are always sent.
+    std::string damageRegion;
+    if (!buffer->GetBufferMeta()->GetMetaItem(AVTransTag::VIDEO_DAMAGE_REGION, damageRegion)) {
+        return false;
+    }
+    if (GetDamageRegionArea(damageRegion) != 0) {
+        return false;
+    }
+    return (GetCurrentTime() - lastFullFrameTime_) < STATIC_FRAME_REFRESH_TIME;
+}
+
+void AVSenderEngine::NotifyRepeatFrame(const std::shared_ptr<AVTransBuffer> &buffer)
+{
+    int64_t pts = 0;
+    buffer->GetBufferMeta()->GetMetaItem(AVTransTag::PRE_TIMESTAMP, pts);
+    auto message = std::make_shared<AVTransMessage>(static_cast<uint32_t>(AVTransTag::VIDEO_REPEAT_FRAME),
+        std::to_string(pts), peerDevId_);
+    int32_t ret = SendMessage(message);
+    TRUE_RETURN(ret != DH_AVT_SUCCESS, "send repeat frame message failed, ret: %{public}" PRId32, ret);
+    if (++repeatFrameCount_ % REPEAT_FRAME_LOG_INTERVAL == 0) {
+        AVTRANS_LOGI("static frames skipped: %{public}" PRIu64, repeatFrameCount_);
+    }
+}
+
 int32_t AVSenderEngine::PreparePipeline(const std::string &configParam)
 {
     AVTRANS_LOGI("PreparePipeline enter.");
@@ -702,6 +818,19 @@ void AVSenderEngine::NotifyStreamChange(EventType type)
     dhFwkKit_->NotifyAVCenter(engineId_, { type, sceneType, peerDevId_ });
 }
 
+void AVSenderEngine::NotifyFirstFrame()
+{
+    if ((initTime_ == 0) || isFirstFrameNotified_.exchange(true)) {
+        return;
+    }
+    int64_t costMs = (GetCurrentTime() - initTime_) / NS_ONE_MS;
+    AVTRANS_LOGI("First frame of %{public}s after %{public}" PRId64 "ms, prewarmed=%{public}d.", ownerName_.c_str(),
+        costMs, isPrewarmed_);
+    TRUE_RETURN(dhFwkKit_ == nullptr, "dh fwk kit is nullptr.");
+    dhFwkKit_->NotifyAVCenter(engineId_, { EventType::EVENT_FIRST_FRAME,
+        BuildFirstFrameContent(ownerName_, costMs, isPrewarmed_), peerDevId_ });
+}
+
 void AVSenderEngine::OnChannelEvent(const AVTransEvent &event)
 {
     AVTRANS_LOGI("OnChannelEvent enter. event type:%{public}" PRId32, event.type);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -30,11 +30,16 @@ AVSenderEngineProvider::AVSenderEngineProvider(const std::string ownerName) : ow
         SoftbusChannelAdapter::GetInstance().CreateChannelServer(TransName2PkgName(ownerName), sessionName_);
         SoftbusChannelAdapter::GetInstance().RegisterChannelListener(sessionName_, AV_TRANS_SPECIAL_DEVICE_ID, this);
     }
+    StartPrewarm();
 }
 
 AVSenderEngineProvider::~AVSenderEngineProvider()
 {
     AVTRANS_LOGI("AVSenderEngineProvider dctor.");
+    if (warmThread_.joinable()) {
+        warmThread_.join();
+    }
+    warmEngine_ = nullptr;
     std::lock_guard<std::mutex> lock(listMutex_);
     for (auto &sender : senderEngineList_) {
         if (sender == nullptr) {
@@ -55,18 +60,59 @@ AVSenderEngineProvider::~AVSenderEngineProvider()
 std::shared_ptr<IAVSenderEngine> AVSenderEngineProvider::CreateAVSenderEngine(const std::string &peerDevId)
 {
     AVTRANS_LOGI("CreateAVSenderEngine enter.");
-    auto sender = std::make_shared<AVSenderEngine>(ownerName_, peerDevId);
+    auto sender = TakeWarmEngine(peerDevId);
     if (sender && sender->Initialize() == DH_AVT_SUCCESS) {
         {
             std::lock_guard<std::mutex> lock(listMutex_);
             senderEngineList_.push_back(sender);
         }
+        StartPrewarm();
         return sender;
     }
+    StartPrewarm();
     AVTRANS_LOGE("create sender failed or sender init failed.");
     return nullptr;
 }
 
+std::shared_ptr<AVSenderEngine> AVSenderEngineProvider::TakeWarmEngine(const std::string &peerDevId)
+{
+    std::shared_ptr<AVSenderEngine> sender = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(warmMutex_);
+        sender.swap(warmEngine_);
+    }
+    if (sender == nullptr) {
+        return std::make_shared<AVSenderEngine>(ownerName_, peerDevId);
+    }
+    AVTRANS_LOGI("take the prewarmed sender engine.");
+    sender->SetPeerDevId(peerDevId);
+    return sender;
+}
+
+void AVSenderEngineProvider::StartPrewarm()
+{
+    std::lock_guard<std::mutex> lock(warmMutex_);
+    if ((warmEngine_ != nullptr) || isWarming_.load() || isPrewarmFailed_.load()) {
+        return;
+    }
+    if (warmThread_.joinable()) {
+        warmThread_.join();
+    }
+    isWarming_ = true;
+    warmThread_ = std::thread([this]() {
+        auto sender = std::make_shared<AVSenderEngine>(ownerName_, "");
+        bool isWarm = (sender->Prewarm() == DH_AVT_SUCCESS);
+        std::lock_guard<std::mutex> warmLock(warmMutex_);
+        if (isWarm) {
+            warmEngine_ = sender;
+        } else {
+            // An owner without a pipeline never warms up, so it is not tried again.
+            isPrewarmFailed_ = true;
+        }
+        isWarming_ = false;
+    });
+}
+
 std::vector<std::shared_ptr<IAVSenderEngine>> AVSenderEngineProvider::GetAVSenderEngineList()
 {
     std::lock_guard<std::mutex> lock(listMutex_);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -891,5 +891,19 @@ HWTEST_F(AvAudioSenderEngineTest, LinkAudioSinkFilter_001, testing::ext::TestSiz
 
     EXPECT_EQ(Status::OK, sender->LinkAudioSinkFilter(nullptr, Pipeline::StreamType::STREAMTYPE_ENCODED_AUDIO));
 }
+
+HWTEST_F(AvAudioSenderEngineTest, GetPipelineMetrics_001, testing::ext::TestSize.Level1)
+{
+    std::string ownerName = OWNER_NAME_D_CAMERA;
+    std::string peerDevId = "pEid";
+    auto sender = std::make_shared<AVAudioSenderEngine>(ownerName, peerDevId);
+    std::string metrics;
+    sender->pipeline_ = nullptr;
+    EXPECT_EQ(ERR_DH_AVT_NULL_POINTER, sender->GetPipelineMetrics(metrics));
+
+    sender->pipeline_ = std::make_shared<Pipeline::Pipeline>();
+    EXPECT_EQ(DH_AVT_SUCCESS, sender->GetPipelineMetrics(metrics));
+    EXPECT_TRUE(metrics.empty());
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
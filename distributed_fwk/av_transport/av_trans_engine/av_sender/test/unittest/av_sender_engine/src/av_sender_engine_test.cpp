@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -787,5 +787,92 @@ HWTEST_F(AvSenderEngineTest, OnEvent_001, testing::ext::TestSize.Level1)
     sender->senderCallback_ = std::make_shared<SenderEngineCallback>();
     EXPECT_NO_FATAL_FAILURE(sender->OnEvent(event));
 }
+
+HWTEST_F(AvSenderEngineTest, GetDamageRegionArea_001, testing::ext::TestSize.Level1)
+{
+    EXPECT_EQ(0, GetDamageRegionArea(""));
+    EXPECT_EQ(0, GetDamageRegionArea("10,10,0,20"));
+    EXPECT_EQ(200, GetDamageRegionArea("0,0,10,20"));
+    EXPECT_EQ(212, GetDamageRegionArea("0,0,10,20;5,5,3,4;"));
+    EXPECT_EQ(-1, GetDamageRegionArea("0,0,10"));
+    EXPECT_EQ(-1, GetDamageRegionArea("0,0,-10,20"));
+    EXPECT_EQ(-1, GetDamageRegionArea("0,0,10,20x"));
+}
+
+HWTEST_F(AvSenderEngineTest, IsSkippableStaticFrame_001, testing::ext::TestSize.Level1)
+{
+    std::string ownerName = OWNER_NAME_D_SCREEN;
+    std::string peerDevId = "pEid";
+    auto sender = std::make_shared<AVSenderEngine>(ownerName, peerDevId);
+    std::shared_ptr<AVTransBuffer> buffer = std::make_shared<AVTransBuffer>();
+    EXPECT_FALSE(sender->IsSkippableStaticFrame(nullptr));
+
+    sender->lastFullFrameTime_ = GetCurrentTime();
+    EXPECT_FALSE(sender->IsSkippableStaticFrame(buffer));
+
+    buffer->GetBufferMeta()->SetMetaItem(AVTransTag::VIDEO_DAMAGE_REGION, "0,0,16,16");
+    EXPECT_FALSE(sender->IsSkippableStaticFrame(buffer));
+
+    buffer->GetBufferMeta()->SetMetaItem(AVTransTag::VIDEO_DAMAGE_REGION, "");
+    EXPECT_TRUE(sender->IsSkippableStaticFrame(buffer));
+
+    sender->lastFullFrameTime_ = GetCurrentTime() - AVSenderEngine::STATIC_FRAME_REFRESH_TIME;
+    EXPECT_FALSE(sender->IsSkippableStaticFrame(buffer));
+
+    sender->lastFullFrameTime_ = 0;
+    EXPECT_FALSE(sender->IsSkippableStaticFrame(buffer));
+}
+
+HWTEST_F(AvSenderEngineTest, SetEngineConfig_001, testing::ext::TestSize.Level1)
+{
+    std::string ownerName = "001";
+    std::string peerDevId = "pEid";
+    auto sender = std::make_shared<AVSenderEngine>(ownerName, peerDevId);
+    AVTransEngineConfig config;
+    config.AddItem(EngineConfigItem::VIDEO_WIDTH);
+    config.videoWidth = 1920;
+    EXPECT_EQ(ERR_DH_AVT_SETUP_FAILED, sender->SetEngineConfig(config));
+
+    sender->avInput_ = FilterFactory::Instance().CreateFilterWithType<AVInputFilter>(AVINPUT_NAME, "avinput");
+    sender->avOutput_ = FilterFactory::Instance().CreateFilterWithType<AVOutputFilter>(AVOUTPUT_NAME, "avoutput");
+    sender->pipeline_ = std::make_shared<OHOS::Media::Pipeline::PipelineCore>();
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, sender->SetEngineConfig(AVTransEngineConfig()));
+
+    config.AddItem(EngineConfigItem::VIDEO_HEIGHT);
+    config.videoHeight = 0;
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM_VALUE, sender->SetEngineConfig(config));
+    config.videoHeight = 1080;
+    config.AddItem(EngineConfigItem::VIDEO_CODEC_TYPE);
+    config.videoCodecType = "video/unknown";
+    EXPECT_EQ(ERR_DH_AVT_UNSUPPORTED_FORMAT, sender->SetEngineConfig(config));
+    config.videoCodecType = MIME_VIDEO_H265;
+    config.AddItem(EngineConfigItem::VIDEO_FRAME_RATE);
+    config.videoFrameRate = 60;
+    config.AddItem(EngineConfigItem::VIDEO_BIT_RATE);
+    config.videoBitRate = 8000000;
+    EXPECT_EQ(DH_AVT_SUCCESS, sender->SetEngineConfig(config));
+}
+
+HWTEST_F(AvSenderEngineTest, SetEngineConfig_002, testing::ext::TestSize.Level1)
+{
+    std::string ownerName = "001";
+    std::string peerDevId = "pEid";
+    auto sender = std::make_shared<AVSenderEngine>(ownerName, peerDevId);
+    sender->avInput_ = FilterFactory::Instance().CreateFilterWithType<AVInputFilter>(AVINPUT_NAME, "avinput");
+    sender->avOutput_ = FilterFactory::Instance().CreateFilterWithType<AVOutputFilter>(AVOUTPUT_NAME, "avoutput");
+    sender->pipeline_ = std::make_shared<OHOS::Media::Pipeline::PipelineCore>();
+    sender->SetCurrentState(StateId::PLAYING);
+
+    AVTransEngineConfig config;
+    config.AddItem(EngineConfigItem::VIDEO_BIT_RATE);
+    config.videoBitRate = 4000000;
+    config.AddItem(EngineConfigItem::VIDEO_WIDTH);
+    config.videoWidth = 1280;
+    EXPECT_EQ(DH_AVT_SUCCESS, sender->SetEngineConfig(config));
+
+    config.AddItem(EngineConfigItem::AUDIO_SAMPLE_RATE);
+    config.audioSampleRate = 48000;
+    EXPECT_EQ(ERR_DH_AVT_INVALID_STATE, sender->SetEngineConfig(config));
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
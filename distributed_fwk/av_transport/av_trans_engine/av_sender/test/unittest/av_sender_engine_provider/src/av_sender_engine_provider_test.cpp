@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -106,5 +106,24 @@ HWTEST_F(AvSenderEngineProviderTest, RegisterProviderCallback_001, testing::ext:
 
     EXPECT_EQ(DH_AVT_SUCCESS, ret);
 }
+
+HWTEST_F(AvSenderEngineProviderTest, StartPrewarm_001, testing::ext::TestSize.Level1)
+{
+    std::string peerDevId = "peerDevId";
+    std::string ownerName = "ownerName";
+    auto avSendProTest_ = std::make_shared<AVSenderEngineProvider>(ownerName);
+    if (avSendProTest_->warmThread_.joinable()) {
+        avSendProTest_->warmThread_.join();
+    }
+    EXPECT_TRUE(avSendProTest_->isPrewarmFailed_.load());
+    EXPECT_EQ(nullptr, avSendProTest_->warmEngine_);
+
+    avSendProTest_->StartPrewarm();
+    EXPECT_FALSE(avSendProTest_->warmThread_.joinable());
+    auto sender = avSendProTest_->TakeWarmEngine(peerDevId);
+    ASSERT_NE(nullptr, sender);
+    EXPECT_EQ(peerDevId, sender->peerDevId_);
+    EXPECT_FALSE(sender->isPrewarmed_);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -235,6 +235,7 @@ Status AudioDecoderFilter::DoProcessInputBuffer(int recvArg, bool dropFrame)
     TRUE_RETURN_V_MSG_E(inputConsumer_ == nullptr, Status::ERROR_NULL_POINTER, "inputConsumer is null");
     Media::Status ret = inputConsumer_->AcquireBuffer(buffer);
     TRUE_RETURN_V_MSG_E(ret != Media::Status::OK, Status::ERROR_INVALID_OPERATION, "AcquireBuffer failed");
+    metrics_.OnInputBuffer((buffer != nullptr && buffer->memory_ != nullptr) ? buffer->memory_->GetSize() : 0);
     {
         std::lock_guard<std::mutex> datalock(mtxData_);
         while (inputDataBufferQueue_.size() > AUDIO_DECODER_QUEUE_MAX) {
@@ -244,8 +245,10 @@ Status AudioDecoderFilter::DoProcessInputBuffer(int recvArg, bool dropFrame)
             if (frontBuffer != nullptr) {
                 inputConsumer_->ReleaseBuffer(frontBuffer);
             }
+            metrics_.OnDrop(FilterDropReason::QUEUE_FULL);
         }
         inputDataBufferQueue_.push(buffer);
+        metrics_.OnQueueDepth(inputDataBufferQueue_.size());
     }
     decodeCond_.notify_all();
     return Status::OK;
@@ -560,27 +563,32 @@ Status AudioDecoderFilter::ProcessData(std::shared_ptr<Media::AVBuffer> audioDat
         Status::ERROR_NULL_POINTER, "audioData is invaild");
 
     auto memSize = audioData->memory_->GetSize();
-    codecMem->buffer_->memory_->SetSize(memSize);
-    errno_t err = memcpy_s(OH_AVBuffer_GetAddr(codecMem), memSize, audioData->memory_->GetAddr(), memSize);
+    auto capacity = codecMem->buffer_->memory_->GetCapacity();
+    errno_t err = memcpy_s(OH_AVBuffer_GetAddr(codecMem), capacity, audioData->memory_->GetAddr(), memSize);
     TRUE_RETURN_V_MSG_E(err != EOK, Status::ERROR_INVALID_OPERATION,
-                        "memcpy_s err: %{public}d, memSize: %{public}d", err, memSize);
+        "memcpy_s err: %{public}d, memSize: %{public}d, capacity: %{public}d", err, memSize, capacity);
+    codecMem->buffer_->memory_->SetSize(memSize);
     int64_t pts = 0;
     pts = audioData->pts_;
     {
         std::lock_guard<std::mutex> lock(ptsMutex_);
         ptsMap_[frameInIndex_] = pts;
         frameInIndex_++;
-        AVTRANS_LOGI("frameInIndex_: %{public}" PRIu64 " pts: %{public}" PRId64, frameInIndex_, pts);
+        AVTRANS_LOGD("frameInIndex_: %{public}" PRIu64 " pts: %{public}" PRId64, frameInIndex_, pts);
         if (frameInIndex_ == INDEX_FLAG) {
             audioData->meta_->GetData(Media::Tag::USER_FRAME_PTS, pts);
             ptsMap_[INDEX_FLAG] = pts;
-            AVTRANS_LOGI("the fifth special process pts: %{public}" PRId64, pts);
+            AVTRANS_LOGD("the fifth special process pts: %{public}" PRId64, pts);
             frameInIndex_ = 0;
         }
     }
     codecMem->buffer_->pts_ = pts;
     codecMem->buffer_->meta_->SetData(Media::Tag::USER_FRAME_PTS, pts);
     codecMem->buffer_->flag_ = MediaAVCodec::AVCODEC_BUFFER_FLAG_NONE;
+    if (++inputFrameCount_ % FRAME_LOG_INTERVAL == 0) {
+        AVTRANS_LOGI("before AudioDecoderFilter frames %{public}" PRIu64 ", index %{public}u, pts: %{public}" PRId64,
+            inputFrameCount_, index, pts);
+    }
     auto ret = OH_AudioCodec_PushInputBuffer(audioDecoder_, index);
     TRUE_RETURN_V_MSG_E(ret != AV_ERR_OK, Status::ERROR_INVALID_OPERATION,
         "OH_AudioCodec_PushInputBuffer err: %{public}d", ret);
@@ -650,17 +658,21 @@ void AudioDecoderFilter::OnDecOutputBufferAvailable(uint32_t index, OH_AVBuffer
     }
     outBuffer->pts_ = pts;
     meta->SetData(Media::Tag::USER_FRAME_PTS, pts);
-    AVTRANS_LOGI("after AudioDecoderFilter index %{public}" PRIu64", pts: %{public}" PRId64, frameOutIndex_, pts);
+    if (++outputFrameCount_ % FRAME_LOG_INTERVAL == 0) {
+        AVTRANS_LOGI("after AudioDecoderFilter frames %{public}" PRIu64 ", index %{public}" PRIu64 ", pts: %{public}"
+            PRId64, outputFrameCount_, frameOutIndex_, pts);
+    }
     {
         std::lock_guard<std::mutex> ptsLock(ptsMutex_);
         if (frameOutIndex_ == INDEX_FLAG && ptsMap_.find(INDEX_FLAG) != ptsMap_.end()) {
             meta->SetData(Media::Tag::USER_FRAME_PTS, ptsMap_[INDEX_FLAG]);
-            AVTRANS_LOGI("the fifth special process pts: %{public}" PRId64, ptsMap_[INDEX_FLAG]);
+            AVTRANS_LOGD("the fifth special process pts: %{public}" PRId64, ptsMap_[INDEX_FLAG]);
             frameOutIndex_ = 0;
         }
     }
     outBuffer->memory_->Write(buffer->buffer_->memory_->GetAddr(), buffer->buffer_->memory_->GetSize(), 0);
     outputProducer_->PushBuffer(outBuffer, true);
+    metrics_.OnOutputBuffer(buffer->buffer_->memory_->GetSize());
     auto ret = OH_AudioCodec_FreeOutputBuffer(audioDecoder_, index);
     TRUE_RETURN(ret != AV_ERR_OK, "OH_AudioCodec_FreeOutputBuffer err: %{public}d", ret);
 }
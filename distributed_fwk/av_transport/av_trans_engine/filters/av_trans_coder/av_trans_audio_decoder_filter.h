@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -113,6 +113,7 @@ private:
     constexpr static int32_t SAMPLE_RATE_MAX = 96000;
     constexpr static int32_t BITRATE_OPUS = 32000;
     constexpr static int32_t INDEX_FLAG = 15;
+    constexpr static uint64_t FRAME_LOG_INTERVAL = 500;
 
     std::shared_ptr<Filter> nextFilter_ {nullptr};
     std::shared_ptr<EventReceiver> eventReceiver_ {nullptr};
@@ -151,6 +152,8 @@ private:
     std::mutex ptsMutex_;
     uint64_t frameInIndex_ = 0;
     uint64_t frameOutIndex_ = 0;
+    uint64_t inputFrameCount_ = 0;
+    uint64_t outputFrameCount_ = 0;
 };
 } // namespace Pipeline
 } // namespace DistributedHardware
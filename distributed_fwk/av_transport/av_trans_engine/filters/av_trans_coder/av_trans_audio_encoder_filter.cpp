@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,9 @@
 
 #include "av_trans_audio_encoder_filter.h"
 
+#include <algorithm>
+#include <cstdlib>
+
 #include "av_trans_log.h"
 #include "av_sync_utils.h"
 #include "filter_factory.h"
@@ -234,6 +237,7 @@ Status AudioEncoderFilter::DoProcessInputBuffer(int recvArg, bool dropFrame)
     TRUE_RETURN_V_MSG_E(inputConsumer_ == nullptr, Status::ERROR_NULL_POINTER, "inputConsumer is null");
     Media::Status ret = inputConsumer_->AcquireBuffer(buffer);
     TRUE_RETURN_V_MSG_E(ret != Media::Status::OK, Status::ERROR_INVALID_OPERATION, "AcquireBuffer failed");
+    metrics_.OnInputBuffer((buffer != nullptr && buffer->memory_ != nullptr) ? buffer->memory_->GetSize() : 0);
     {
         std::lock_guard<std::mutex> datalock(mtxData_);
         while (inputDataBufferQueue_.size() > AUDIO_ENCODER_QUEUE_MAX) {
@@ -243,8 +247,10 @@ Status AudioEncoderFilter::DoProcessInputBuffer(int recvArg, bool dropFrame)
             if (frontBuffer != nullptr) {
                 inputConsumer_->ReleaseBuffer(frontBuffer);
             }
+            metrics_.OnDrop(FilterDropReason::QUEUE_FULL);
         }
         inputDataBufferQueue_.push(buffer);
+        metrics_.OnQueueDepth(inputDataBufferQueue_.size());
     }
     encodeCond_.notify_all();
     return Status::OK;
@@ -411,8 +417,8 @@ Status AudioEncoderFilter::SetEncoderFormat(const AEncInitParams &initEncParams)
     OH_AVFormat_SetIntValue(format, MediaAVCodec::MediaDescriptionKey::MD_KEY_AUDIO_SAMPLE_FORMAT.data(),
         initEncParams.sampleDepth);
     if (initEncParams.codecType == AudioCodecType::AUDIO_CODEC_OPUS) {
-        OH_AVFormat_SetLongValue(format, MediaAVCodec::MediaDescriptionKey::MD_KEY_BITRATE.data(),
-            initEncParams.bitRate);
+        std::lock_guard<std::mutex> lock(linkMutex_);
+        SetLinkFormat(format, GetLinkBitRate(initEncParams.bitRate, linkLevel_), linkLevel_, expectedLoss_);
     }
     int32_t res = OH_AudioCodec_Configure(audioEncoder_, format);
     if (res != AV_ERR_OK) {
@@ -424,6 +430,91 @@ Status AudioEncoderFilter::SetEncoderFormat(const AEncInitParams &initEncParams)
     return Status::OK;
 }
 
+void AudioEncoderFilter::SetLinkFormat(OH_AVFormat *format, int32_t bitRate, LinkLevel level, int32_t expectedLoss)
+{
+    OH_AVFormat_SetLongValue(format, MediaAVCodec::MediaDescriptionKey::MD_KEY_BITRATE.data(), bitRate);
+    OH_AVFormat_SetIntValue(format, OPUS_KEY_INBAND_FEC, level != LinkLevel::GOOD ? 1 : 0);
+    OH_AVFormat_SetIntValue(format, OPUS_KEY_PACKET_LOSS, expectedLoss);
+    OH_AVFormat_SetIntValue(format, OPUS_KEY_DTX, level == LinkLevel::BAD ? 1 : 0);
+}
+
+int32_t AudioEncoderFilter::GetLinkBitRate(int32_t bitRate, LinkLevel level)
+{
+    switch (level) {
+        case LinkLevel::LOSSY:
+            return std::min(bitRate, BITRATE_OPUS_LOSSY);
+        case LinkLevel::BAD:
+            return std::min(bitRate, BITRATE_OPUS_BAD);
+        default:
+            return bitRate;
+    }
+}
+
+AudioEncoderFilter::LinkLevel AudioEncoderFilter::EvaluateLinkLevel(int32_t lossPercent, int32_t rttMs)
+{
+    LinkLevel level = LinkLevel::GOOD;
+    if (lossPercent >= LINK_BAD_ENTER_LOSS || rttMs >= LINK_BAD_ENTER_RTT_MS) {
+        level = LinkLevel::BAD;
+    } else if (linkLevel_ == LinkLevel::BAD && (lossPercent >= LINK_BAD_LEAVE_LOSS || rttMs >= LINK_BAD_LEAVE_RTT_MS)) {
+        level = LinkLevel::BAD;
+    } else if (lossPercent >= LINK_LOSSY_ENTER_LOSS) {
+        level = LinkLevel::LOSSY;
+    } else if (linkLevel_ != LinkLevel::GOOD && lossPercent >= LINK_LOSSY_LEAVE_LOSS) {
+        level = LinkLevel::LOSSY;
+    }
+    if (level >= linkLevel_) {
+        linkRecoverReports_ = 0;
+        return level;
+    }
+    if (++linkRecoverReports_ < LINK_RECOVER_REPORTS) {
+        return linkLevel_;
+    }
+    linkRecoverReports_ = 0;
+    return level;
+}
+
+Status AudioEncoderFilter::OnLinkQuality(int32_t lossPercent, int32_t rttMs)
+{
+    TRUE_RETURN_V_MSG_E(lossPercent < 0 || lossPercent > 100 || rttMs < 0, Status::ERROR_INVALID_PARAMETER,
+        "invalid link quality, loss: %{public}d, rtt: %{public}d", lossPercent, rttMs);
+    if (initEncParams_.codecType != AudioCodecType::AUDIO_CODEC_OPUS) {
+        return Status::OK;
+    }
+    std::lock_guard<std::mutex> lock(linkMutex_);
+    LinkLevel level = EvaluateLinkLevel(lossPercent, rttMs);
+    int32_t expectedLoss = 0;
+    if (level != LinkLevel::GOOD) {
+        expectedLoss = std::clamp(lossPercent, LINK_LOSSY_ENTER_LOSS, EXPECTED_LOSS_MAX);
+    }
+    if (level == linkLevel_ && std::abs(expectedLoss - expectedLoss_) < EXPECTED_LOSS_STEP) {
+        return Status::OK;
+    }
+    int32_t bitRate = GetLinkBitRate(initEncParams_.bitRate, level);
+    if (audioEncoder_ != nullptr) {
+        OH_AVFormat *format = OH_AVFormat_Create();
+        TRUE_RETURN_V_MSG_E(format == nullptr, Status::ERROR_NULL_POINTER, "create format failed");
+        SetLinkFormat(format, bitRate, level, expectedLoss);
+        int32_t res = OH_AudioCodec_SetParameter(audioEncoder_, format);
+        OH_AVFormat_Destroy(format);
+        TRUE_RETURN_V_MSG_E(res != AV_ERR_OK, Status::ERROR_INVALID_OPERATION,
+            "set link format failed: %{public}d", res);
+    }
+    AVTRANS_LOGI("loss: %{public}d, rtt: %{public}d, link level %{public}u -> %{public}u, bit rate: %{public}d, "
+        "expected loss: %{public}d", lossPercent, rttMs, static_cast<uint32_t>(linkLevel_),
+        static_cast<uint32_t>(level), bitRate, expectedLoss);
+    linkLevel_ = level;
+    expectedLoss_ = expectedLoss;
+    uint32_t features = 0;
+    if (level != LinkLevel::GOOD) {
+        features |= FILTER_CODEC_FEATURE_FEC;
+    }
+    if (level == LinkLevel::BAD) {
+        features |= FILTER_CODEC_FEATURE_DTX;
+    }
+    metrics_.OnCodecAdapted(static_cast<uint64_t>(bitRate), features);
+    return Status::OK;
+}
+
 Status AudioEncoderFilter::CheckEncoderFormat(const AEncInitParams &initEncParams)
 {
     AVTRANS_LOGI("enter");
@@ -559,23 +650,27 @@ Status AudioEncoderFilter::ProcessData(std::shared_ptr<Media::AVBuffer> audioDat
         Status::ERROR_NULL_POINTER, "audioData is invaild");
 
     auto memSize = audioData->memory_->GetSize();
-    codecMem->buffer_->memory_->SetSize(memSize);
-    errno_t err = memcpy_s(OH_AVBuffer_GetAddr(codecMem), memSize, audioData->memory_->GetAddr(), memSize);
+    auto capacity = codecMem->buffer_->memory_->GetCapacity();
+    errno_t err = memcpy_s(OH_AVBuffer_GetAddr(codecMem), capacity, audioData->memory_->GetAddr(), memSize);
     TRUE_RETURN_V_MSG_E(err != EOK, Status::ERROR_INVALID_OPERATION,
-        "memcpy_s err: %{public}d, memSize: %{public}d", err, memSize);
+        "memcpy_s err: %{public}d, memSize: %{public}d, capacity: %{public}d", err, memSize, capacity);
+    codecMem->buffer_->memory_->SetSize(memSize);
     int64_t pts = 0;
     audioData->meta_->GetData(Media::Tag::USER_FRAME_PTS, pts);
     {
         std::lock_guard<std::mutex> lock(ptsMutex_);
         ptsMap_[frameInIndex_] = pts;
-        AVTRANS_LOGI("ProcessData frameInIndex_ %{public}" PRId64", pts: %{public}" PRId64, frameInIndex_, pts);
+        AVTRANS_LOGD("ProcessData frameInIndex_ %{public}" PRId64", pts: %{public}" PRId64, frameInIndex_, pts);
         frameInIndex_++;
         if (frameInIndex_ % FRAME_OUTINDEX_FLAG == 0) {
             frameInIndex_ = 0;
         }
     }
     codecMem->buffer_->meta_->SetData(Media::Tag::USER_FRAME_PTS, pts);
-    AVTRANS_LOGI("before AudioEncoderFilter index %{public}u, pts: %{public}" PRId64, index, pts);
+    if (++inputFrameCount_ % FRAME_LOG_INTERVAL == 0) {
+        AVTRANS_LOGI("before AudioEncoderFilter frames %{public}" PRIu64 ", index %{public}u, pts: %{public}" PRId64,
+            inputFrameCount_, index, pts);
+    }
     codecMem->buffer_->flag_ = MediaAVCodec::AVCODEC_BUFFER_FLAG_NONE;
     auto ret = OH_AudioCodec_PushInputBuffer(audioEncoder_, index);
     TRUE_RETURN_V_MSG_E(ret != AV_ERR_OK, Status::ERROR_INVALID_OPERATION,
@@ -659,8 +754,13 @@ void AudioEncoderFilter::OnEncOutputBufferAvailable(uint32_t index, OH_AVBuffer
         frameOutIndex_ = 0;
     }
     meta->SetData(Media::Tag::AUDIO_OBJECT_NUMBER, index);
+    if (++outputFrameCount_ % FRAME_LOG_INTERVAL == 0) {
+        AVTRANS_LOGI("after AudioEncoderFilter frames %{public}" PRIu64 ", pts: %{public}" PRId64, outputFrameCount_,
+            pts);
+    }
     outBuffer->memory_->Write(buffer->buffer_->memory_->GetAddr(), buffer->buffer_->memory_->GetSize(), 0);
     outputProducer_->PushBuffer(outBuffer, true);
+    metrics_.OnOutputBuffer(buffer->buffer_->memory_->GetSize());
     auto ret = OH_AudioCodec_FreeOutputBuffer(audioEncoder_, index);
     TRUE_RETURN(ret != AV_ERR_OK, "OH_AudioCodec_FreeOutputBuffer err: %{public}d", ret);
 }
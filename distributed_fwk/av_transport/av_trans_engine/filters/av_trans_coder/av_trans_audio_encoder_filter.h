@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -92,7 +92,24 @@ public:
     void OnEncInputBufferAvailable(uint32_t index, OH_AVBuffer *buffer);
     void OnEncOutputBufferAvailable(uint32_t index, OH_AVBuffer *buffer);
 
+    // Retunes an opus encoder for the packet loss and round trip time the receiver reported.
+    Status OnLinkQuality(int32_t lossPercent, int32_t rttMs);
+
 private:
+    /*
+     * GOOD encodes at the configured bit rate. LOSSY lowers it and turns on in-band FEC sized by the reported
+     * loss, BAD lowers it further and adds DTX. A worse link is taken at once, a better one only after
+     * LINK_RECOVER_REPORTS reports in a row, and each level is left at lower thresholds than it is entered.
+     */
+    enum class LinkLevel : uint8_t {
+        GOOD = 0,
+        LOSSY,
+        BAD,
+    };
+
+    LinkLevel EvaluateLinkLevel(int32_t lossPercent, int32_t rttMs);
+    void SetLinkFormat(OH_AVFormat *format, int32_t bitRate, LinkLevel level, int32_t expectedLoss);
+    static int32_t GetLinkBitRate(int32_t bitRate, LinkLevel level);
     Status PrepareInputBufferQueue();
     Status SetEncoderFormat(const AEncInitParams &initEncParams);
     Status CheckEncoderFormat(const AEncInitParams &initEncParams);
@@ -112,7 +129,23 @@ private:
     constexpr static int32_t SAMPLE_RATE_MAX = 96000;
     constexpr static int32_t BITRATE_OPUS = 32000;
     constexpr static int32_t INDEX_FLAG = 15;
+    constexpr static uint64_t FRAME_LOG_INTERVAL = 500;
     constexpr static int32_t FRAME_OUTINDEX_FLAG = 16;
+    constexpr static int32_t BITRATE_OPUS_LOSSY = 24000;
+    constexpr static int32_t BITRATE_OPUS_BAD = 16000;
+    constexpr static int32_t LINK_LOSSY_ENTER_LOSS = 3;
+    constexpr static int32_t LINK_LOSSY_LEAVE_LOSS = 1;
+    constexpr static int32_t LINK_BAD_ENTER_LOSS = 10;
+    constexpr static int32_t LINK_BAD_LEAVE_LOSS = 5;
+    constexpr static int32_t LINK_BAD_ENTER_RTT_MS = 300;
+    constexpr static int32_t LINK_BAD_LEAVE_RTT_MS = 200;
+    constexpr static int32_t LINK_RECOVER_REPORTS = 3;
+    constexpr static int32_t EXPECTED_LOSS_MAX = 50;
+    constexpr static int32_t EXPECTED_LOSS_STEP = 5;
+    // MediaDescriptionKey has no opus FEC or DTX key, an encoder that does not know these ignores them.
+    constexpr static const char* OPUS_KEY_INBAND_FEC = "opus_inband_fec";
+    constexpr static const char* OPUS_KEY_PACKET_LOSS = "opus_packet_loss_percentage";
+    constexpr static const char* OPUS_KEY_DTX = "opus_dtx";
 
     std::shared_ptr<Filter> nextFilter_ {nullptr};
     std::shared_ptr<EventReceiver> eventReceiver_ {nullptr};
@@ -150,6 +183,13 @@ private:
     std::mutex ptsMutex_;
     uint64_t frameInIndex_ = 0;
     uint64_t frameOutIndex_ = 0;
+    uint64_t inputFrameCount_ = 0;
+    uint64_t outputFrameCount_ = 0;
+
+    std::mutex linkMutex_;
+    LinkLevel linkLevel_ = LinkLevel::GOOD;
+    int32_t linkRecoverReports_ = 0;
+    int32_t expectedLoss_ = 0;
 };
 } // namespace Pipeline
 } // namespace DistributedHardware
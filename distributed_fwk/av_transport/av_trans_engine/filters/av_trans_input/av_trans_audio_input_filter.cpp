@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -239,8 +239,10 @@ Status AVTransAudioInputFilter::ProcessAndSendBuffer(const std::shared_ptr<Media
 {
     if (buffer == nullptr || buffer->memory_ == nullptr) {
         AVTRANS_LOGE("AVBuffer is null");
+        metrics_.OnDrop(FilterDropReason::INVALID_BUFFER);
         return Status::ERROR_NULL_POINTER;
     }
+    metrics_.OnInputBuffer(buffer->memory_->GetSize());
 
     TRUE_RETURN_V_MSG_E((outputBufQueProducer_ == nullptr), Status::ERROR_NULL_POINTER, "Producer is null");
     Media::AVBufferConfig config(buffer->GetConfig());
@@ -261,6 +263,7 @@ Status AVTransAudioInputFilter::ProcessAndSendBuffer(const std::shared_ptr<Media
     meta->SetData(Media::Tag::USER_FRAME_PTS, outBuffer->pts_);
     outBuffer->memory_->Write(buffer->memory_->GetAddr(), buffer->memory_->GetSize(), 0);
     outputBufQueProducer_->PushBuffer(outBuffer, true);
+    metrics_.OnOutputBuffer(buffer->memory_->GetSize());
     return Status::OK;
 }
 
@@ -22,6 +22,7 @@
 #include "av_trans_errno.h"
 #include "av_trans_log.h"
 #include "av_trans_types.h"
+#include "av_trans_utils.h"
 #include "filter_factory.h"
 
 #undef DH_LOG_TAG
@@ -33,6 +34,7 @@ namespace Pipeline {
 namespace {
 constexpr int32_t DEFAULT_BUFFER_NUM = 8;
 constexpr int32_t MAX_TIME_OUT_MS = 1;
+constexpr char EXT_OFFER_PLACEHOLDER = 0;
 const std::string INPUT_BUFFER_QUEUE_NAME = "AVTransBusInputBufferQueue";
 const std::string META_TIMESTAMP = "meta_timestamp";
 const std::string META_TIMESTAMP_STRING = "meta_timestamp_string";
@@ -376,6 +378,7 @@ void AVTransBusInputFilter::OnChannelEvent(const AVTransEvent &event)
     switch (event.type) {
         case OHOS::DistributedHardware::EventType::EVENT_CHANNEL_OPENED: {
             AVTRANS_LOGD("channel opened.");
+            OfferStreamExtVersion(event.peerDevId.empty() ? peerDevId_ : event.peerDevId);
             TRUE_RETURN(receiver_ == nullptr, "receiver_ is nullptr");
             Event channelEvent;
             channelEvent.type = EventType::EVENT_AUDIO_PROGRESS;
@@ -398,10 +401,18 @@ void AVTransBusInputFilter::OnChannelEvent(const AVTransEvent &event)
 
 void AVTransBusInputFilter::OnStreamReceived(const StreamData *data, const StreamData *ext)
 {
-    if (ext == nullptr) {
+    if (ext == nullptr || ext->buf == nullptr || ext->bufLen <= 0) {
         AVTRANS_LOGE("ext is nullptr.");
         return;
     }
+    auto extBuf = reinterpret_cast<const uint8_t *>(ext->buf);
+    size_t extLen = static_cast<size_t>(ext->bufLen);
+    if (IsStreamExtHeader(extBuf, extLen)) {
+        AVTransStreamExtHeader header;
+        TRUE_RETURN(!UnmarshalStreamExtHeader(extBuf, extLen, header), "Invalid stream ext header.");
+        StreamDataEnqueue(data, header.pts, header.ptsSpecial);
+        return;
+    }
     std::string message(reinterpret_cast<const char *>(ext->buf), ext->bufLen);
     TRUE_RETURN(message.length() > MAX_MESSAGES_LEN, "Message length is iilegal.");
     AVTRANS_LOGD("Receive message : %{public}s", message.c_str());
@@ -416,8 +427,36 @@ void AVTransBusInputFilter::OnStreamReceived(const StreamData *data, const Strea
         cJSON_Delete(resMsg);
         return;
     }
-    StreamDataEnqueue(data, resMsg);
+    cJSON *paramItem = cJSON_GetObjectItem(resMsg, AVT_DATA_PARAM.c_str());
+    if (paramItem == nullptr || !cJSON_IsString(paramItem)) {
+        AVTRANS_LOGE("paramItem is invalid.");
+        cJSON_Delete(resMsg);
+        return;
+    }
+    int64_t ptsValue = 0;
+    int64_t ptsSpecialValue = 0;
+    UnmarshalAudioMeta(std::string(paramItem->valuestring), ptsValue, ptsSpecialValue);
     cJSON_Delete(resMsg);
+    StreamDataEnqueue(data, ptsValue, ptsSpecialValue);
+}
+
+void AVTransBusInputFilter::OfferStreamExtVersion(const std::string &peerDevId)
+{
+    cJSON *offerMsg = cJSON_CreateObject();
+    TRUE_RETURN(offerMsg == nullptr, "Create offer msg failed.");
+    cJSON_AddNumberToObject(offerMsg, AVT_DATA_EXT_VERSION.c_str(), AVT_STREAM_EXT_VERSION);
+    char *str = cJSON_PrintUnformatted(offerMsg);
+    cJSON_Delete(offerMsg);
+    TRUE_RETURN(str == nullptr, "Print offer msg failed.");
+    std::string offerStr(str);
+    cJSON_free(str);
+    char placeholder = EXT_OFFER_PLACEHOLDER;
+    StreamData data = {&placeholder, sizeof(placeholder)};
+    StreamData ext = {const_cast<char *>(offerStr.c_str()), offerStr.length()};
+    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId, &data, &ext);
+    if (ret != DH_AVT_SUCCESS) {
+        AVTRANS_LOGE("Offer stream ext version failed, sender keeps the json ext.");
+    }
 }
 
 bool AVTransBusInputFilter::UnmarshalAudioMeta(const std::string& jsonStr, int64_t& pts, int64_t& ptsSpecial)
@@ -459,9 +498,9 @@ bool AVTransBusInputFilter::UnmarshalAudioMeta(const std::string& jsonStr, int64
     return true;
 }
 
-void AVTransBusInputFilter::StreamDataEnqueue(const StreamData *data, const cJSON *extMsg)
+void AVTransBusInputFilter::StreamDataEnqueue(const StreamData *data, int64_t pts, int64_t ptsSpecial)
 {
-    TRUE_RETURN((outputBufQueProducer_ == nullptr || data == nullptr || extMsg == nullptr), "Producer is null");
+    TRUE_RETURN((outputBufQueProducer_ == nullptr || data == nullptr), "Producer is null");
     Media::AVBufferConfig config;
     config.size = data->bufLen;
     config.memoryType = Media::MemoryType::VIRTUAL_MEMORY;
@@ -478,17 +517,9 @@ void AVTransBusInputFilter::StreamDataEnqueue(const StreamData *data, const cJSO
         outputBufQueProducer_->PushBuffer(outBuffer, false);
         return;
     }
-    cJSON *paramItem = cJSON_GetObjectItem(extMsg, AVT_DATA_PARAM.c_str());
-    if (paramItem == nullptr || !cJSON_IsString(paramItem)) {
-        AVTRANS_LOGE("paramItem is invalid.");
-        return;
-    }
-    int64_t ptsValue = 0;
-    int64_t ptsSpecialValue = 0;
-    UnmarshalAudioMeta(std::string(paramItem->valuestring), ptsValue, ptsSpecialValue);
-    AVTRANS_LOGI("buffer->GetPts(): %{public}" PRId64, ptsValue);
-    outBuffer->pts_ = ptsValue;
-    meta->SetData(Media::Tag::USER_FRAME_PTS, ptsSpecialValue);
+    AVTRANS_LOGD("buffer->GetPts(): %{public}" PRId64, pts);
+    outBuffer->pts_ = pts;
+    meta->SetData(Media::Tag::USER_FRAME_PTS, ptsSpecial);
     outBuffer->memory_->Write(reinterpret_cast<uint8_t *>(data->buf), data->bufLen, 0);
     outputBufQueProducer_->PushBuffer(outBuffer, true);
 }
@@ -77,7 +77,8 @@ public:
 private:
     void PrepareInputBuffer();
     Status ProcessAndSendBuffer(const std::shared_ptr<Media::AVBuffer> buffer);
-    void StreamDataEnqueue(const StreamData *data, const cJSON *extMsg);
+    void StreamDataEnqueue(const StreamData *data, int64_t pts, int64_t ptsSpecial);
+    void OfferStreamExtVersion(const std::string &peerDevId);
     std::string TransName2PkgName(const std::string &ownerName);
     bool UnmarshalAudioMeta(const std::string& jsonStr, int64_t& pts, int64_t& ptsSpecial);
 
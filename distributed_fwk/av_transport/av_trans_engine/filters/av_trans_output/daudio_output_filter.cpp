@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -232,13 +232,17 @@ Status DAudioOutputFilter::ProcessAndSendBuffer(const std::shared_ptr<Media::AVB
 {
     if (buffer == nullptr) {
         AVTRANS_LOGE("ProcessAndSendBuffer buffer is nullptr");
+        metrics_.OnDrop(FilterDropReason::INVALID_BUFFER);
         return Status::ERROR_INVALID_OPERATION;
     }
+    uint64_t size = buffer->memory_ != nullptr ? buffer->memory_->GetSize() : 0;
+    metrics_.OnInputBuffer(size);
     TRUE_RETURN_V_MSG_E(eventReceiver_ == nullptr, Status::ERROR_NULL_POINTER, "receiver_ is nullptr");
     Event event;
     event.type = EventType::EVENT_BUFFER_PROGRESS;
     event.param = buffer;
     eventReceiver_->OnEvent(event);
+    metrics_.OnOutputBuffer(size);
     return Status::OK;
 }
 
@@ -23,6 +23,7 @@
 #include "av_trans_errno.h"
 #include "av_trans_log.h"
 #include "av_trans_constants.h"
+#include "av_trans_utils.h"
 
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "DSoftbusOutputFilter"
@@ -191,6 +192,7 @@ Status DSoftbusOutputFilter::DoPrepare()
 
 Status DSoftbusOutputFilter::DoStart()
 {
+    useBinaryExt_ = false;
     std::string peerSessName = ownerName_ + "_" + RECEIVER_DATA_SESSION_NAME_SUFFIX;
     SoftbusChannelAdapter::GetInstance().RegisterChannelListener(sessionName_, peerDevId_, this);
     int32_t ret = SoftbusChannelAdapter::GetInstance().OpenSoftbusChannel(sessionName_, peerSessName, peerDevId_);
@@ -303,31 +305,48 @@ Status DSoftbusOutputFilter::ProcessAndSendBuffer(const std::shared_ptr<Media::A
     buffer->meta_->GetData(Media::Tag::AUDIO_OBJECT_NUMBER, frameNumber);
     BufferDataType dataType;
     meta_->GetData(Media::Tag::MEDIA_STREAM_TYPE, dataType);
+    std::string extStr = MarshalStreamExt(dataType, pts, ptsSpecial, frameNumber);
+    if (extStr.empty()) {
+        return Status::ERROR_NULL_POINTER;
+    }
+    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_,
+        bufferData->GetAddr(), static_cast<size_t>(bufferData->GetSize()), extStr);
+    if (ret != DH_AVT_SUCCESS) {
+        AVTRANS_LOGE("Send data to softbus failed.");
+        return Status::ERROR_INVALID_OPERATION;
+    }
+    return Status::OK;
+}
+
+std::string DSoftbusOutputFilter::MarshalStreamExt(BufferDataType dataType,
+    int64_t pts, int64_t ptsSpecial, uint32_t frameNumber)
+{
+    if (useBinaryExt_) {
+        AVTransStreamExtHeader header;
+        header.dataType = dataType;
+        header.frameNumber = frameNumber;
+        header.pts = pts;
+        header.ptsSpecial = ptsSpecial;
+        std::string extStr(AVT_STREAM_EXT_HEADER_LEN, '\0');
+        MarshalStreamExtHeader(header, reinterpret_cast<uint8_t *>(extStr.data()), extStr.size());
+        return extStr;
+    }
     auto dataParam = MarshalAudioMeta(dataType, pts, ptsSpecial, frameNumber);
     cJSON *jsonObj = cJSON_CreateObject();
     if (jsonObj == nullptr) {
-        return Status::ERROR_NULL_POINTER;
+        return "";
     }
     cJSON_AddNumberToObject(jsonObj, AVT_DATA_META_TYPE.c_str(), static_cast<int32_t>(dataType));
     cJSON_AddStringToObject(jsonObj, AVT_DATA_PARAM.c_str(), dataParam.c_str());
     auto str = cJSON_PrintUnformatted(jsonObj);
     if (str == nullptr) {
         cJSON_Delete(jsonObj);
-        return Status::ERROR_NULL_POINTER;
+        return "";
     }
     std::string jsonStr = std::string(str);
     cJSON_free(str);
-    StreamData data = {reinterpret_cast<char *>(const_cast<uint8_t*>(bufferData->GetAddr())),
-        bufferData->GetSize()};
-    StreamData ext = {const_cast<char *>(jsonStr.c_str()), jsonStr.length()};
-    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_, &data, &ext);
-    if (ret != DH_AVT_SUCCESS) {
-        AVTRANS_LOGE("Send data to softbus failed.");
-        cJSON_Delete(jsonObj);
-        return Status::ERROR_INVALID_OPERATION;
-    }
     cJSON_Delete(jsonObj);
-    return Status::OK;
+    return jsonStr;
 }
 
 void DSoftbusOutputFilter::SetParameter(const std::shared_ptr<Media::Meta>& meta)
@@ -402,6 +421,9 @@ void DSoftbusOutputFilter::OnUnlinkedResult(std::shared_ptr<Media::Meta>& meta)
 void DSoftbusOutputFilter::OnChannelEvent(const AVTransEvent &event)
 {
     AVTRANS_LOGI("OnChannelEvent enter, event type: %{public}d", event.type);
+    if (event.type == OHOS::DistributedHardware::EventType::EVENT_CHANNEL_CLOSED) {
+        useBinaryExt_ = false;
+    }
     TRUE_RETURN(eventReceiver_ == nullptr, "receiver_ is nullptr");
     Event channelEvent;
     channelEvent.type = EventType::EVENT_AUDIO_PROGRESS;
@@ -412,7 +434,19 @@ void DSoftbusOutputFilter::OnChannelEvent(const AVTransEvent &event)
 void DSoftbusOutputFilter::OnStreamReceived(const StreamData *data, const StreamData *ext)
 {
     (void)data;
-    (void)ext;
+    // The receiver offers the binary ext header right after the channel opens, older receivers stay on JSON.
+    TRUE_RETURN((ext == nullptr) || (ext->buf == nullptr) || (ext->bufLen <= 0), "ext is invalid.");
+    std::string message(ext->buf, ext->bufLen);
+    cJSON *offerMsg = cJSON_Parse(message.c_str());
+    TRUE_RETURN(offerMsg == nullptr, "The offer msg parse failed.");
+    if (IsUInt32(offerMsg, AVT_DATA_EXT_VERSION)) {
+        cJSON *versionItem = cJSON_GetObjectItem(offerMsg, AVT_DATA_EXT_VERSION.c_str());
+        uint32_t version = static_cast<uint32_t>(versionItem->valueint);
+        useBinaryExt_ = (version >= AVT_STREAM_EXT_VERSION);
+        AVTRANS_LOGI("Peer stream ext version: %{public}u, use binary ext: %{public}d.", version,
+            useBinaryExt_.load());
+    }
+    cJSON_Delete(offerMsg);
 }
 } // namespace Pipeline
 } // namespace DistributedHardware
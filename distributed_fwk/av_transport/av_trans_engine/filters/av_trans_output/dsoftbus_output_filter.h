@@ -16,6 +16,7 @@
 #ifndef OHOS_DSOFTFBUS_OUTPUT_AUDIO_FILTER_H
 #define OHOS_DSOFTFBUS_OUTPUT_AUDIO_FILTER_H
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <memory>
@@ -76,6 +77,7 @@ private:
     void PrepareInputBuffer();
     Status ProcessAndSendBuffer(const std::shared_ptr<Media::AVBuffer> buffer);
     std::string MarshalAudioMeta(BufferDataType dataType, int64_t pts, int64_t ptsSpecial, uint32_t frameNumber);
+    std::string MarshalStreamExt(BufferDataType dataType, int64_t pts, int64_t ptsSpecial, uint32_t frameNumber);
     std::shared_ptr<Media::Meta> meta_ {nullptr};
     std::shared_ptr<Filter> nextFilter_ {nullptr};
 
@@ -91,6 +93,7 @@ private:
     std::string ownerName_;
     std::string sessionName_;
     std::string peerDevId_;
+    std::atomic<bool> useBinaryExt_ {false};
 };
 } // namespace Pipeline
 } // namespace DistributedHardware
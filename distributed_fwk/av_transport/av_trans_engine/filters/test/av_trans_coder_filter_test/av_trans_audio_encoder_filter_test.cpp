@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -608,6 +608,30 @@ HWTEST_F(AvTransportAudioEncoderFilterTest, ProcessData_002, testing::ext::TestS
     EXPECT_EQ(Status::ERROR_NULL_POINTER, status);
 }
 
+HWTEST_F(AvTransportAudioEncoderFilterTest, ProcessData_003, testing::ext::TestSize.Level1)
+{
+    std::shared_ptr<Pipeline::AudioEncoderFilter> filter =
+        std::make_shared<Pipeline::AudioEncoderFilter>("builtin.recorder.audioencoderfilter",
+                                                       Pipeline::FilterType::FILTERTYPE_AENC);
+    ASSERT_TRUE(filter != nullptr);
+    filter->isEncoderRunning_.store(true);
+    OH_AVCodec audioEncoder(AVMagic::AVCODEC_MAGIC_AUDIO_ENCODER);
+    filter->audioEncoder_ = &audioEncoder;
+    auto allocator = Media::AVAllocatorFactory::CreateVirtualAllocator();
+    const int32_t codecCapacity = 4;
+    const int32_t pcmSize = 16;
+    std::shared_ptr<Media::AVBuffer> codecData = Media::AVBuffer::CreateAVBuffer(allocator, codecCapacity);
+    std::shared_ptr<Media::AVBuffer> audioData = Media::AVBuffer::CreateAVBuffer(allocator, pcmSize);
+    ASSERT_TRUE(codecData != nullptr && audioData != nullptr);
+    audioData->memory_->SetSize(pcmSize);
+    OH_AVBuffer *codecMem = new OH_AVBuffer(codecData);
+    Status status = filter->ProcessData(audioData, 0, codecMem);
+    filter->isEncoderRunning_.store(false);
+    filter->audioEncoder_ = nullptr;
+    delete codecMem;
+    EXPECT_EQ(Status::ERROR_INVALID_OPERATION, status);
+}
+
 HWTEST_F(AvTransportAudioEncoderFilterTest, OnEncError_001, testing::ext::TestSize.Level1)
 {
     std::shared_ptr<Pipeline::AudioEncoderFilter> filter =
@@ -653,5 +677,43 @@ HWTEST_F(AvTransportAudioEncoderFilterTest, OnEncInputBufferAvailable_002, testi
     filter->OnEncInputBufferAvailable(10, normalBuffer);
     delete normalBuffer;
 }
+
+HWTEST_F(AvTransportAudioEncoderFilterTest, OnLinkQuality_001, testing::ext::TestSize.Level1)
+{
+    std::shared_ptr<Pipeline::AudioEncoderFilter> filter =
+        std::make_shared<Pipeline::AudioEncoderFilter>("builtin.recorder.audioencoderfilter",
+                                                       Pipeline::FilterType::FILTERTYPE_AENC);
+    ASSERT_TRUE(filter != nullptr);
+    EXPECT_EQ(filter->OnLinkQuality(-1, 0), Status::ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(filter->OnLinkQuality(101, 0), Status::ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(filter->OnLinkQuality(0, -1), Status::ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(filter->OnLinkQuality(20, 0), Status::OK);
+    EXPECT_EQ(filter->GetMetrics().GetSnapshot().codecAdaptations, 0);
+
+    filter->initEncParams_.codecType = Pipeline::AudioCodecType::AUDIO_CODEC_OPUS;
+    filter->initEncParams_.bitRate = 32000;
+    EXPECT_EQ(filter->OnLinkQuality(5, 50), Status::OK);
+    Pipeline::FilterMetricsSnapshot snapshot = filter->GetMetrics().GetSnapshot();
+    EXPECT_EQ(snapshot.codecAdaptations, 1);
+    EXPECT_EQ(snapshot.codecBitRate, 24000);
+    EXPECT_EQ(snapshot.codecFeatures, Pipeline::FILTER_CODEC_FEATURE_FEC);
+
+    EXPECT_EQ(filter->OnLinkQuality(6, 50), Status::OK);
+    EXPECT_EQ(filter->GetMetrics().GetSnapshot().codecAdaptations, 1);
+    EXPECT_EQ(filter->OnLinkQuality(5, 400), Status::OK);
+    snapshot = filter->GetMetrics().GetSnapshot();
+    EXPECT_EQ(snapshot.codecBitRate, 16000);
+    EXPECT_EQ(snapshot.codecFeatures, Pipeline::FILTER_CODEC_FEATURE_FEC | Pipeline::FILTER_CODEC_FEATURE_DTX);
+
+    EXPECT_EQ(filter->OnLinkQuality(6, 100), Status::OK);
+    EXPECT_EQ(filter->linkLevel_, Pipeline::AudioEncoderFilter::LinkLevel::BAD);
+    for (int32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(filter->OnLinkQuality(0, 50), Status::OK);
+    }
+    snapshot = filter->GetMetrics().GetSnapshot();
+    EXPECT_EQ(snapshot.codecAdaptations, 3);
+    EXPECT_EQ(snapshot.codecBitRate, 32000);
+    EXPECT_EQ(snapshot.codecFeatures, 0);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include "av_trans_constants.h"
 #include "av_trans_audio_encoder_filter.h"
 #include "av_trans_types.h"
+#include "av_trans_utils.h"
 using namespace testing::ext;
 using namespace OHOS::DistributedHardware;
 using namespace std;
@@ -664,6 +665,30 @@ HWTEST_F(AvTransportBusInputFilterTest, UnmarshalAudioMeta_012, testing::ext::Te
     cJSON_Delete(jsonObj);
 }
 
+HWTEST_F(AvTransportBusInputFilterTest, UnmarshalStreamExtHeader_001, testing::ext::TestSize.Level1)
+{
+    AVTransStreamExtHeader header;
+    header.dataType = BufferDataType::AUDIO;
+    header.frameNumber = 7;
+    header.pts = 9876543210LL;
+    header.ptsSpecial = -1;
+    uint8_t buf[AVT_STREAM_EXT_HEADER_LEN] = {0};
+    EXPECT_FALSE(MarshalStreamExtHeader(header, buf, AVT_STREAM_EXT_HEADER_LEN - 1));
+    ASSERT_TRUE(MarshalStreamExtHeader(header, buf, AVT_STREAM_EXT_HEADER_LEN));
+
+    AVTransStreamExtHeader parsed;
+    ASSERT_TRUE(UnmarshalStreamExtHeader(buf, AVT_STREAM_EXT_HEADER_LEN, parsed));
+    EXPECT_EQ(AVT_STREAM_EXT_VERSION, parsed.version);
+    EXPECT_EQ(7U, parsed.frameNumber);
+    EXPECT_EQ(9876543210LL, parsed.pts);
+    EXPECT_EQ(-1, parsed.ptsSpecial);
+
+    std::string json = R"({"avtrans_data_meta_type":0})";
+    EXPECT_FALSE(IsStreamExtHeader(reinterpret_cast<const uint8_t *>(json.data()), json.size()));
+    buf[4] = 0;
+    EXPECT_FALSE(UnmarshalStreamExtHeader(buf, AVT_STREAM_EXT_HEADER_LEN, parsed));
+}
+
 HWTEST_F(AvTransportBusInputFilterTest, TransName2PkgName_001, testing::ext::TestSize.Level1)
 {
     std::shared_ptr<Pipeline::AVTransBusInputFilter> avBusInputTest_ =
@@ -17,6 +17,7 @@
 #include "av_trans_audio_encoder_filter.h"
 #include "av_trans_constants.h"
 #include "av_trans_types.h"
+#include "av_trans_utils.h"
 #include "cJSON.h"
 using namespace testing::ext;
 using namespace OHOS::DistributedHardware;
@@ -270,6 +271,27 @@ HWTEST_F(AvTransportAudioOutputFilterTest, MarshalAudioMeta_001, testing::ext::T
     EXPECT_EQ(json, json1);
 }
 
+HWTEST_F(AvTransportAudioOutputFilterTest, MarshalStreamExt_001, testing::ext::TestSize.Level1)
+{
+    ASSERT_TRUE(dSoftbusOutputTest_ != nullptr);
+    std::string ext = dSoftbusOutputTest_->MarshalStreamExt(BufferDataType::AUDIO, 1000, 2000, 1);
+    EXPECT_FALSE(IsStreamExtHeader(reinterpret_cast<const uint8_t *>(ext.data()), ext.size()));
+
+    std::string offer = R"({"avtrans_data_ext_version":1})";
+    StreamData offerExt = {const_cast<char *>(offer.c_str()), offer.length()};
+    dSoftbusOutputTest_->OnStreamReceived(nullptr, &offerExt);
+    ext = dSoftbusOutputTest_->MarshalStreamExt(BufferDataType::AUDIO, 1000, 2000, 1);
+    AVTransStreamExtHeader header;
+    ASSERT_TRUE(UnmarshalStreamExtHeader(reinterpret_cast<const uint8_t *>(ext.data()), ext.size(), header));
+    EXPECT_EQ(1000, header.pts);
+    EXPECT_EQ(2000, header.ptsSpecial);
+    EXPECT_EQ(1U, header.frameNumber);
+
+    AVTransEvent event = {EventType::EVENT_CHANNEL_CLOSED, "", ""};
+    dSoftbusOutputTest_->OnChannelEvent(event);
+    EXPECT_FALSE(dSoftbusOutputTest_->useBinaryExt_);
+}
+
 HWTEST_F(AvTransportAudioOutputFilterTest, ProcessAndSendBuffer_002, testing::ext::TestSize.Level1)
 {
     ASSERT_TRUE(dSoftbusOutputTest_ != nullptr);
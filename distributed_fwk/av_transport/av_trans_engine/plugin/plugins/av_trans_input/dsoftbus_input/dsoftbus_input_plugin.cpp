@@ -255,7 +255,7 @@ void DsoftbusInputPlugin::OnStreamReceived(const StreamData *data, const StreamD
         return;
     }
     std::string message(reinterpret_cast<const char *>(ext->buf), ext->bufLen);
-    AVTRANS_LOGI("Receive message : %{public}s", message.c_str());
+    AVTRANS_LOGD("Receive message : %{public}s", message.c_str());
     cJSON *resMsg = cJSON_Parse(message.c_str());
     if (resMsg == nullptr) {
         AVTRANS_LOGE("The resMsg parse failed.");
@@ -286,6 +286,17 @@ std::shared_ptr<Buffer> DsoftbusInputPlugin::CreateBuffer(uint32_t metaType,
         AVTRANS_LOGE("data is nullptr.");
         return nullptr;
     }
+    // Softbus frees the frame when this callback returns, the one copy below is the only one on this path,
+    // so the meta is checked first and a frame that would be dropped is never copied.
+    cJSON *paramItem = cJSON_GetObjectItem(resMsg, AVT_DATA_PARAM.c_str());
+    if (paramItem == NULL || !cJSON_IsString(paramItem)) {
+        return nullptr;
+    }
+    auto meta = std::make_shared<AVTransVideoBufferMeta>();
+    if (!meta->UnmarshalVideoMeta(std::string(paramItem->valuestring))) {
+        AVTRANS_LOGE("Unmarshal video buffer eta failed.");
+        return nullptr;
+    }
     auto buffer = Buffer::CreateDefaultBuffer(static_cast<BufferMetaType>(metaType), data->bufLen);
     auto bufData = buffer->GetMemory();
     if (bufData == nullptr) {
@@ -297,22 +308,13 @@ std::shared_ptr<Buffer> DsoftbusInputPlugin::CreateBuffer(uint32_t metaType,
         AVTRANS_LOGE("write buffer data failed.");
         return buffer;
     }
-    cJSON *paramItem = cJSON_GetObjectItem(resMsg, AVT_DATA_PARAM.c_str());
-    if (paramItem == NULL || !cJSON_IsString(paramItem)) {
-        return nullptr;
-    }
-    auto meta = std::make_shared<AVTransVideoBufferMeta>();
-    if (!meta->UnmarshalVideoMeta(std::string(paramItem->valuestring))) {
-        AVTRANS_LOGE("Unmarshal video buffer eta failed.");
-        return nullptr;
-    }
     buffer->pts = meta->pts_;
     buffer->GetBufferMeta()->SetMeta(Tag::USER_FRAME_NUMBER, meta->frameNum_);
     if ((meta->extFrameNum_ > 0) && (meta->extPts_ > 0)) {
         buffer->GetBufferMeta()->SetMeta(Tag::MEDIA_START_TIME, meta->extPts_);
         buffer->GetBufferMeta()->SetMeta(Tag::AUDIO_SAMPLE_PER_FRAME, meta->extFrameNum_);
     }
-    AVTRANS_LOGI("buffer pts: %{public}ld, bufferLen: %{public}zu, frameNumber: %{public}zu",
+    AVTRANS_LOGD("buffer pts: %{public}ld, bufferLen: %{public}zu, frameNumber: %{public}zu",
         buffer->pts, buffer->GetMemory()->GetSize(), meta->frameNum_);
     return buffer;
 }
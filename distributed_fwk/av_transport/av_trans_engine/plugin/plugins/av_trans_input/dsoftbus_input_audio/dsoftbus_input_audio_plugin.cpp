@@ -239,7 +239,7 @@ void DsoftbusInputAudioPlugin::OnStreamReceived(const StreamData *data, const St
         return;
     }
     std::string message(reinterpret_cast<const char *>(ext->buf), ext->bufLen);
-    AVTRANS_LOGI("Receive message : %{public}s", message.c_str());
+    AVTRANS_LOGD("Receive message : %{public}s", message.c_str());
 
     cJSON *resMsg = cJSON_Parse(message.c_str());
     if (resMsg == nullptr) {
@@ -269,6 +269,10 @@ std::shared_ptr<Buffer> DsoftbusInputAudioPlugin::CreateBuffer(uint32_t metaType
         AVTRANS_LOGE("data is nullptr.");
         return nullptr;
     }
+    cJSON *paramItem = cJSON_GetObjectItem(resMsg, AVT_DATA_PARAM.c_str());
+    if (paramItem == NULL || !cJSON_IsString(paramItem)) {
+        return nullptr;
+    }
     auto buffer = Buffer::CreateDefaultBuffer(static_cast<BufferMetaType>(metaType), data->bufLen);
     auto bufData = buffer->GetMemory();
 
@@ -277,16 +281,12 @@ std::shared_ptr<Buffer> DsoftbusInputAudioPlugin::CreateBuffer(uint32_t metaType
         AVTRANS_LOGE("write buffer data failed.");
         return buffer;
     }
-    cJSON *paramItem = cJSON_GetObjectItem(resMsg, AVT_DATA_PARAM.c_str());
-    if (paramItem == NULL || !cJSON_IsString(paramItem)) {
-        return nullptr;
-    }
     auto meta = std::make_shared<AVTransAudioBufferMeta>();
     meta->UnmarshalAudioMeta(std::string(paramItem->valuestring));
     buffer->pts = meta->pts_;
     buffer->GetBufferMeta()->SetMeta(Tag::USER_FRAME_PTS, meta->pts_);
     buffer->GetBufferMeta()->SetMeta(Tag::USER_FRAME_NUMBER, meta->frameNum_);
-    AVTRANS_LOGI("buffer pts: %{public}ld, bufferLen: %{public}zu, frameNumber: %{public}zu",
+    AVTRANS_LOGD("buffer pts: %{public}ld, bufferLen: %{public}zu, frameNumber: %{public}zu",
         buffer->pts, buffer->GetMemory()->GetSize(), meta->frameNum_);
     return buffer;
 }
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_jitter_buffer.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "av_trans_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+void DaudioJitterBuffer::Reset()
+{
+    *this = DaudioJitterBuffer();
+}
+
+void DaudioJitterBuffer::OnFrameArrived(int64_t arrivalTime, uint32_t frameNum)
+{
+    if (!hasArrival_) {
+        hasArrival_ = true;
+        lastArrivalTime_ = arrivalTime;
+        lastFrameNum_ = frameNum;
+        return;
+    }
+    // Frame numbers of zero mean the sender does not number its frames, so loss is not tracked.
+    int64_t frames = 1;
+    if ((frameNum != 0) && (frameNum > lastFrameNum_)) {
+        frames = static_cast<int64_t>(frameNum - lastFrameNum_);
+    }
+    int64_t lostNow = frames - 1;
+    lostCount_ += static_cast<uint64_t>(lostNow);
+    lossRate_ += (std::min(lostNow, static_cast<int64_t>(1)) * LOSS_RATE_SCALE - lossRate_) / EWMA_GAIN;
+
+    int64_t interval = (arrivalTime - lastArrivalTime_) / frames;
+    if (frameInterval_ == 0) {
+        frameInterval_ = interval;
+    } else {
+        int64_t deviation = std::llabs(interval - frameInterval_);
+        jitter_ += (deviation - jitter_) / EWMA_GAIN;
+        frameInterval_ += (interval - frameInterval_) / EWMA_GAIN;
+    }
+    lastArrivalTime_ = arrivalTime;
+    lastFrameNum_ = frameNum;
+    UpdateTargetDepth();
+}
+
+bool DaudioJitterBuffer::IsPlayable(size_t depth)
+{
+    if (isBuffering_ && (depth >= targetDepth_)) {
+        AVTRANS_LOGI("Jitter buffer refilled, depth: %{public}zu, jitter: %{public}" PRId64 ".", depth, jitter_);
+        isBuffering_ = false;
+    }
+    return !isBuffering_ && (depth > 0);
+}
+
+bool DaudioJitterBuffer::ShouldDropFrame(size_t depth)
+{
+    if (depth <= targetDepth_ + DROP_DEPTH_MARGIN) {
+        deepCount_ = 0;
+        return false;
+    }
+    if (++deepCount_ < DROP_CHECK_COUNT) {
+        return false;
+    }
+    deepCount_ = 0;
+    AVTRANS_LOGD("Jitter buffer drops one frame, depth: %{public}zu, target: %{public}zu.", depth, targetDepth_);
+    return true;
+}
+
+void DaudioJitterBuffer::OnQueueIdle(int64_t now, size_t depth)
+{
+    if (isBuffering_ || (depth > 0) || !hasArrival_) {
+        return;
+    }
+    // A frame later than the measured jitter allows is an underrun, refill before playing on.
+    if (now - lastArrivalTime_ > frameInterval_ + JITTER_FACTOR * jitter_) {
+        isBuffering_ = true;
+        underrunCount_++;
+        AVTRANS_LOGI("Jitter buffer underrun %{public}" PRIu64 ", target depth: %{public}zu.", underrunCount_,
+            targetDepth_);
+    }
+}
+
+size_t DaudioJitterBuffer::GetTargetDepth() const
+{
+    return targetDepth_;
+}
+
+int64_t DaudioJitterBuffer::GetFrameInterval() const
+{
+    return frameInterval_;
+}
+
+int64_t DaudioJitterBuffer::GetJitter() const
+{
+    return jitter_;
+}
+
+int64_t DaudioJitterBuffer::GetDelay(size_t depth) const
+{
+    return static_cast<int64_t>(depth) * frameInterval_;
+}
+
+uint64_t DaudioJitterBuffer::GetLostCount() const
+{
+    return lostCount_;
+}
+
+uint64_t DaudioJitterBuffer::GetUnderrunCount() const
+{
+    return underrunCount_;
+}
+
+void DaudioJitterBuffer::UpdateTargetDepth()
+{
+    if (frameInterval_ <= 0) {
+        targetDepth_ = MIN_TARGET_DEPTH;
+        return;
+    }
+    int64_t jitterFrames = (JITTER_FACTOR * jitter_ + frameInterval_ - 1) / frameInterval_;
+    size_t depth = MIN_TARGET_DEPTH + static_cast<size_t>(jitterFrames);
+    if (lossRate_ > LOSS_RATE_THRESHOLD) {
+        depth++;
+    }
+    targetDepth_ = std::clamp(depth, MIN_TARGET_DEPTH, MAX_TARGET_DEPTH);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
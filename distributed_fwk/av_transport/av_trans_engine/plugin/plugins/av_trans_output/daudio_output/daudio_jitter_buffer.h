@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AV_TRANS_ENGINE_PLUGINS_OUTPUT_AUDIO_JITTER_BUFFER_H
+#define OHOS_AV_TRANS_ENGINE_PLUGINS_OUTPUT_AUDIO_JITTER_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedHardware {
+/**
+ * @brief Play-out depth control for the received audio frames, not thread safe.
+ * The target depth follows the measured inter-arrival jitter and frame loss. After an underrun the buffer refills to
+ * the target before frames are played again, and a queue that stays deeper than needed sheds single frames.
+ */
+class DaudioJitterBuffer {
+public:
+    void Reset();
+    void OnFrameArrived(int64_t arrivalTime, uint32_t frameNum);
+    bool IsPlayable(size_t depth);
+    bool ShouldDropFrame(size_t depth);
+    void OnQueueIdle(int64_t now, size_t depth);
+
+    size_t GetTargetDepth() const;
+    int64_t GetFrameInterval() const;
+    int64_t GetJitter() const;
+    int64_t GetDelay(size_t depth) const;
+    uint64_t GetLostCount() const;
+    uint64_t GetUnderrunCount() const;
+
+private:
+    void UpdateTargetDepth();
+
+private:
+    constexpr static int64_t EWMA_GAIN = 16;
+    constexpr static int64_t JITTER_FACTOR = 4;
+    constexpr static int64_t LOSS_RATE_SCALE = 1000;
+    constexpr static int64_t LOSS_RATE_THRESHOLD = 20;
+    constexpr static size_t MIN_TARGET_DEPTH = 1;
+    constexpr static size_t MAX_TARGET_DEPTH = 25;
+    constexpr static size_t DROP_DEPTH_MARGIN = 2;
+    constexpr static uint32_t DROP_CHECK_COUNT = 50;
+
+    bool isBuffering_ = true;
+    bool hasArrival_ = false;
+    int64_t lastArrivalTime_ = 0;
+    uint32_t lastFrameNum_ = 0;
+    int64_t frameInterval_ = 0;
+    int64_t jitter_ = 0;
+    int64_t lossRate_ = 0;
+    uint64_t lostCount_ = 0;
+    uint64_t underrunCount_ = 0;
+    uint32_t deepCount_ = 0;
+    size_t targetDepth_ = MIN_TARGET_DEPTH;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_AV_TRANS_ENGINE_PLUGINS_OUTPUT_AUDIO_JITTER_BUFFER_H
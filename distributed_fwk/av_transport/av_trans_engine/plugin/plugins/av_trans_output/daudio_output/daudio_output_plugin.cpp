@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,8 @@
 
 #include "daudio_output_plugin.h"
 
+#include <chrono>
+
 #include "foundation/utils/constants.h"
 #include "plugin/common/plugin_caps_builder.h"
 #include "plugin/factory/plugin_factory.h"
@@ -22,6 +24,13 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+namespace {
+int64_t GetSteadyTimeNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}
 
 GenericPluginDef CreateDaudioOutputPluginDef()
 {
@@ -59,6 +68,8 @@ DaudioOutputPlugin::DaudioOutputPlugin(std::string name)
 DaudioOutputPlugin::~DaudioOutputPlugin()
 {
     AVTRANS_LOGI("dtor.");
+    std::unique_lock<std::mutex> lock(sharedMemMtx_);
+    UnmapAVTransSharedMemory(sharedMemory_);
 }
 
 Status DaudioOutputPlugin::Init()
@@ -168,7 +179,12 @@ Status DaudioOutputPlugin::SetParameter(Tag tag, const ValueType &value)
     paramsMap_.insert(std::make_pair(tag, value));
     if (tag == Plugin::Tag::USER_SHARED_MEMORY_FD) {
         std::unique_lock<std::mutex> lock(sharedMemMtx_);
+        UnmapAVTransSharedMemory(sharedMemory_);
         sharedMemory_ = UnmarshalSharedMemory(Media::Plugin::AnyCast<std::string>(value));
+        if ((sharedMemory_.fd > 0) && (MapAVTransSharedMemory(sharedMemory_) != DH_AVT_SUCCESS)) {
+            AVTRANS_LOGE("Map shared memory %{public}s failed.", sharedMemory_.name.c_str());
+        }
+        smIndex_ = 0;
     }
     if (tag == Plugin::Tag::USER_AV_SYNC_GROUP_INFO) {
         std::string groupInfo = Media::Plugin::AnyCast<std::string>(value);
@@ -239,14 +255,16 @@ Status DaudioOutputPlugin::PushData(const std::string &inPort, std::shared_ptr<P
         return Status::ERROR_NULL_POINTER;
     }
 
+    int64_t arrivalTime = GetSteadyTimeNs();
     auto bufferMeta = buffer->GetBufferMeta();
+    uint32_t frameNum = 0;
     if (bufferMeta->IsExist(Tag::USER_FRAME_NUMBER) && bufferMeta->IsExist(Tag::USER_FRAME_PTS)) {
         int64_t pts = Plugin::AnyCast<int64_t>(bufferMeta->GetMeta(Tag::USER_FRAME_PTS));
-        uint32_t frameNum = Plugin::AnyCast<uint32_t>(bufferMeta->GetMeta(Tag::USER_FRAME_NUMBER));
-        AVTRANS_LOGI("Push audio buffer, bufferLen: %{public}zu, frameNum: %{public}u, pts: %{public}ld",
+        frameNum = Plugin::AnyCast<uint32_t>(bufferMeta->GetMeta(Tag::USER_FRAME_NUMBER));
+        AVTRANS_LOGD("Push audio buffer, bufferLen: %{public}zu, frameNum: %{public}u, pts: %{public}ld",
             buffer->GetMemory()->GetSize(), frameNum, pts);
     } else {
-        AVTRANS_LOGI("Push audio buffer, bufferLen: %{public}zu, not contains metadata.",
+        AVTRANS_LOGD("Push audio buffer, bufferLen: %{public}zu, not contains metadata.",
             buffer->GetMemory()->GetSize());
     }
     std::lock_guard<std::mutex> lock(dataQueueMtx_);
@@ -254,6 +272,7 @@ Status DaudioOutputPlugin::PushData(const std::string &inPort, std::shared_ptr<P
         AVTRANS_LOGE("outputBuffer_ queue overflow.");
         outputBuffer_.pop();
     }
+    jitterBuffer_.OnFrameArrived(arrivalTime, frameNum);
     outputBuffer_.push(buffer);
     dataCond_.notify_all();
     return Status::OK;
@@ -270,12 +289,18 @@ void DaudioOutputPlugin::HandleData()
         {
             std::unique_lock<std::mutex> lock(dataQueueMtx_);
             dataCond_.wait_for(lock, std::chrono::milliseconds(PLUGIN_TASK_WAIT_TIME),
-                [this]() { return !outputBuffer_.empty(); });
-            if (outputBuffer_.empty()) {
+                [this]() { return jitterBuffer_.IsPlayable(outputBuffer_.size()); });
+            if (!jitterBuffer_.IsPlayable(outputBuffer_.size())) {
+                jitterBuffer_.OnQueueIdle(GetSteadyTimeNs(), outputBuffer_.size());
                 continue;
             }
+            // Shed one whole frame at a time so the player conceals the gap like a single lost packet.
+            if (jitterBuffer_.ShouldDropFrame(outputBuffer_.size())) {
+                outputBuffer_.pop();
+            }
             buffer = outputBuffer_.front();
             outputBuffer_.pop();
+            jitterDelay_.store(jitterBuffer_.GetDelay(outputBuffer_.size()));
         }
         if (buffer == nullptr) {
             AVTRANS_LOGE("Data is null");
@@ -315,14 +340,22 @@ void DaudioOutputPlugin::WriteMasterClockToMemory(const std::shared_ptr<Plugin::
     int32_t ret = WriteClockUnitToMemory(sharedMemory_, clockUnit);
     if (ret == DH_AVT_SUCCESS) {
         smIndex_ = clockUnit.index;
+        WriteClockDelayToMemory(sharedMemory_, jitterDelay_.load());
     }
 }
 
+int64_t DaudioOutputPlugin::GetJitterDelay() const
+{
+    return jitterDelay_.load();
+}
+
 void DaudioOutputPlugin::DataQueueClear(std::queue<std::shared_ptr<Buffer>> &q)
 {
     std::lock_guard<std::mutex> lock(dataQueueMtx_);
     std::queue<std::shared_ptr<Buffer>> empty;
     swap(empty, q);
+    jitterBuffer_.Reset();
+    jitterDelay_.store(0);
 }
 
 Status DaudioOutputPlugin::StartOutputQueue()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -30,6 +30,7 @@
 #include "av_trans_meta.h"
 #include "av_trans_types.h"
 #include "avtrans_output_plugin.h"
+#include "daudio_jitter_buffer.h"
 #include "foundation/osal/thread/mutex.h"
 #include "foundation/osal/thread/scoped_lock.h"
 #include "foundation/osal/thread/task.h"
@@ -61,6 +62,7 @@ public:
     Status PushData(const std::string &inPort, std::shared_ptr<Plugin::Buffer> buffer, int32_t offset) override;
     Status SetCallback(Callback *cb) override;
     Status SetDataCallback(AVDataCallback callback) override;
+    int64_t GetJitterDelay() const;
 
 private:
     Status StartOutputQueue();
@@ -86,6 +88,8 @@ private:
     std::map<Tag, ValueType> paramsMap_;
     std::mutex dataQueueMtx_;
     std::queue<std::shared_ptr<Plugin::Buffer>> outputBuffer_;
+    DaudioJitterBuffer jitterBuffer_;
+    std::atomic<int64_t> jitterDelay_ = 0;
     std::shared_ptr<OSAL::Task> sendPlayTask_;
 
     std::mutex stateMutex_;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,8 @@
 
 #include "dscreen_output_controller.h"
 
+#include <cstdlib>
+
 namespace OHOS {
 namespace DistributedHardware {
 void DScreenOutputController::PrepareSmooth()
@@ -29,6 +31,7 @@ void DScreenOutputController::PrepareSmooth()
     SetWaitClockFactor(WAIT_CLOCK_FACTOR);
     SetTrackClockFactor(TRACK_CLOCK_FACTOR);
     SetSleepThre(SLEEP_THRE);
+    isPacingInit_ = false;
 }
 
 void DScreenOutputController::PrepareSync()
@@ -40,5 +43,145 @@ void DScreenOutputController::PrepareSync()
     SetSleepThre(SLEEP_THRE);
     SetAudioBackTime(AUDIO_BACK_TIME);
 }
+
+int32_t DScreenOutputController::NotifyOutput(const std::shared_ptr<Plugin::Buffer>& data)
+{
+    {
+        // Only a reference is kept, the frame is copied when it is actually repeated.
+        std::lock_guard<std::mutex> lock(lastOutputMutex_);
+        lastOutput_ = data;
+    }
+    return OutputController::NotifyOutput(data);
+}
+
+void DScreenOutputController::RepeatLastFrame(const int64_t pts)
+{
+    std::shared_ptr<Plugin::Buffer> repeat = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(lastOutputMutex_);
+        TRUE_RETURN((lastOutput_ == nullptr || lastOutput_->GetMemory() == nullptr ||
+            lastOutput_->GetBufferMeta() == nullptr), "No frame to repeat.");
+        size_t size = lastOutput_->GetMemory()->GetSize();
+        repeat = std::make_shared<Plugin::Buffer>(Plugin::BufferMetaType::VIDEO);
+        repeat->flag = lastOutput_->flag;
+        repeat->AllocMemory(nullptr, size);
+        repeat->GetMemory()->Write(lastOutput_->GetMemory()->GetReadOnlyData(), size);
+        repeat->UpdateBufferMeta(*(lastOutput_->GetBufferMeta()->Clone()));
+    }
+    repeat->pts = pts;
+    if (++repeatFrameCount_ % REPEAT_FRAME_LOG_INTERVAL == 0) {
+        AVTRANS_LOGI("Repeated static frames: %{public}" PRIu64, repeatFrameCount_);
+    }
+    PushData(repeat);
+}
+
+void DScreenOutputController::UpdateVsync(const int64_t vsyncTime, const int64_t period)
+{
+    TRUE_RETURN((vsyncTime <= 0 || period <= 0), "Invalid vsync time %{public}" PRId64 " or period %{public}" PRId64,
+        vsyncTime, period);
+    std::lock_guard<std::mutex> lock(vsyncMutex_);
+    if (!isVsyncFromDisplay_ || vsyncPeriod_ != period) {
+        AVTRANS_LOGI("Display vsync period is %{public}" PRId64 ".", period);
+    }
+    vsyncBase_ = vsyncTime;
+    vsyncPeriod_ = period;
+    isVsyncFromDisplay_ = true;
+}
+
+VsyncPacingStats DScreenOutputController::GetPacingStats()
+{
+    VsyncPacingStats stats;
+    stats.presented = presentedFrames_.load();
+    stats.dropped = droppedFrames_.load();
+    stats.repeated = repeatedVsyncs_.load();
+    return stats;
+}
+
+int32_t DScreenOutputController::ControlOutput(const std::shared_ptr<Plugin::Buffer>& data)
+{
+    // Frames synced to the audio clock keep the pacing of the base controller.
+    if (data == nullptr || data->pts == INVALID_TIMESTAMP || !GetAllowControlState() ||
+        GetControlMode() == ControlMode::SYNC) {
+        return OutputController::ControlOutput(data);
+    }
+    int64_t now = GetCurrentTime();
+    if (!isPacingInit_) {
+        InitPacing(data->pts, now);
+    }
+    int64_t presentTime = anchorTime_ + data->pts - anchorTimeStamp_;
+    if (std::abs(presentTime - now) > PACING_RESET_THRE) {
+        AVTRANS_LOGI("Frame pts %{public}" PRId64 " is off the pacing timeline, reset it.", data->pts);
+        InitPacing(data->pts, now);
+        presentTime = anchorTime_;
+    }
+    TrackSourceClock(data, presentTime);
+    int64_t halfPeriod = GetVsyncPeriod() / FACTOR_DOUBLE;
+    int64_t vsync = GetNextVsync(now + VSYNC_RELEASE_LEAD);
+    if (presentTime < vsync - halfPeriod && GetQueueSize() > 1) {
+        // The slot of this frame has passed and a newer frame is waiting, showing it would only add latency.
+        CountPacingResult(droppedFrames_);
+        return DROP_FRAME;
+    }
+    while (presentTime > vsync + halfPeriod) {
+        // Nothing is due on this vsync, the display keeps showing the current frame.
+        CountPacingResult(repeatedVsyncs_);
+        if (!WaitUntil(vsync - VSYNC_RELEASE_LEAD)) {
+            return OUTPUT_FRAME;
+        }
+        vsync = GetNextVsync(GetCurrentTime() + VSYNC_RELEASE_LEAD);
+        halfPeriod = GetVsyncPeriod() / FACTOR_DOUBLE;
+    }
+    if (WaitUntil(vsync - VSYNC_RELEASE_LEAD)) {
+        CountPacingResult(presentedFrames_);
+    }
+    return OUTPUT_FRAME;
+}
+
+void DScreenOutputController::InitPacing(const int64_t timeStamp, const int64_t arrivalTime)
+{
+    anchorTimeStamp_ = timeStamp;
+    anchorTime_ = arrivalTime + GetBufferTime();
+    isPacingInit_ = true;
+    std::lock_guard<std::mutex> lock(vsyncMutex_);
+    if (!isVsyncFromDisplay_) {
+        vsyncBase_ = anchorTime_;
+    }
+}
+
+void DScreenOutputController::TrackSourceClock(const std::shared_ptr<Plugin::Buffer>& data,
+    const int64_t presentTime)
+{
+    auto bufferMeta = data->GetBufferMeta();
+    TRUE_RETURN((bufferMeta == nullptr || !bufferMeta->IsExist(Tag::USER_PUSH_DATA_TIME)), "No push data time.");
+    int64_t pushTime = Plugin::AnyCast<int64_t>(bufferMeta->GetMeta(Tag::USER_PUSH_DATA_TIME));
+    // A source clock running faster than ours makes frames arrive ever earlier than their slot, and the
+    // other way round, so the anchor follows the arrival time slowly instead of letting the queue drift.
+    int64_t offset = presentTime - (pushTime + GetBufferTime());
+    anchorTime_ -= offset / SOURCE_CLOCK_TRACK_DIVISOR;
+}
+
+int64_t DScreenOutputController::GetNextVsync(const int64_t time)
+{
+    std::lock_guard<std::mutex> lock(vsyncMutex_);
+    int64_t elapsed = time - vsyncBase_;
+    int64_t count = (elapsed >= 0) ? (elapsed / vsyncPeriod_) : ((elapsed - vsyncPeriod_ + 1) / vsyncPeriod_);
+    return vsyncBase_ + (count + 1) * vsyncPeriod_;
+}
+
+int64_t DScreenOutputController::GetVsyncPeriod()
+{
+    std::lock_guard<std::mutex> lock(vsyncMutex_);
+    return vsyncPeriod_;
+}
+
+void DScreenOutputController::CountPacingResult(std::atomic<uint64_t>& counter)
+{
+    counter.fetch_add(1);
+    VsyncPacingStats stats = GetPacingStats();
+    if ((stats.presented + stats.dropped + stats.repeated) % PACING_LOG_INTERVAL == 0) {
+        AVTRANS_LOGI("Vsync pacing presented: %{public}" PRIu64 ", dropped: %{public}" PRIu64
+            ", repeated: %{public}" PRIu64 ".", stats.presented, stats.dropped, stats.repeated);
+    }
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
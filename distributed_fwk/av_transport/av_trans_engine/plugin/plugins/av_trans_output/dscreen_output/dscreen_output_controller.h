@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,17 +16,41 @@
 #ifndef OHOS_DSCREEN_OUTPUT_CONTROLLER_H
 #define OHOS_DSCREEN_OUTPUT_CONTROLLER_H
 
+#include <mutex>
+
 #include "output_controller.h"
 #include "av_trans_utils.h"
 #include "av_sync_utils.h"
 
 namespace OHOS {
 namespace DistributedHardware {
+struct VsyncPacingStats {
+    uint64_t presented = 0;
+    uint64_t dropped = 0;
+    uint64_t repeated = 0;
+};
+
 class DScreenOutputController : public OutputController {
 public:
     ~DScreenOutputController() override = default;
     void PrepareSmooth() override;
     void PrepareSync() override;
+    int32_t NotifyOutput(const std::shared_ptr<Plugin::Buffer>& data) override;
+    // Queues a copy of the last output frame stamped with pts, used when the source skipped a static frame.
+    void RepeatLastFrame(const int64_t pts);
+    // Aligns the release timeline with the sink display, vsyncTime is a CLOCK_MONOTONIC vsync timestamp.
+    void UpdateVsync(const int64_t vsyncTime, const int64_t period);
+    VsyncPacingStats GetPacingStats();
+
+protected:
+    int32_t ControlOutput(const std::shared_ptr<Plugin::Buffer>& data) override;
+
+private:
+    void InitPacing(const int64_t timeStamp, const int64_t arrivalTime);
+    void TrackSourceClock(const std::shared_ptr<Plugin::Buffer>& data, const int64_t presentTime);
+    int64_t GetNextVsync(const int64_t time);
+    int64_t GetVsyncPeriod();
+    void CountPacingResult(std::atomic<uint64_t>& counter);
 
 private:
     constexpr static float ADJUST_SLEEP_FACTOR = 0.1;
@@ -41,6 +65,29 @@ private:
     constexpr static uint32_t TRACK_CLOCK_THRE = 45 * NS_ONE_MS;
     constexpr static int64_t SLEEP_THRE = 1000 * NS_ONE_MS;
     constexpr static int64_t AUDIO_BACK_TIME = 320 * NS_ONE_MS;
+    constexpr static uint64_t REPEAT_FRAME_LOG_INTERVAL = 100;
+    constexpr static int64_t DEFAULT_VSYNC_PERIOD = NS_ONE_S / 60;
+    // Frames are released this long before the vsync so the display can still latch them.
+    constexpr static int64_t VSYNC_RELEASE_LEAD = 3 * NS_ONE_MS;
+    constexpr static int64_t PACING_RESET_THRE = 1000 * NS_ONE_MS;
+    // The source clock is tracked by moving the pts anchor 1/64 of the observed offset per frame.
+    constexpr static int64_t SOURCE_CLOCK_TRACK_DIVISOR = 64;
+    constexpr static uint64_t PACING_LOG_INTERVAL = 600;
+
+    std::mutex lastOutputMutex_;
+    std::shared_ptr<Plugin::Buffer> lastOutput_ = nullptr;
+    uint64_t repeatFrameCount_ = 0;
+
+    std::mutex vsyncMutex_;
+    int64_t vsyncBase_ = 0;
+    int64_t vsyncPeriod_ = DEFAULT_VSYNC_PERIOD;
+    bool isVsyncFromDisplay_ = false;
+    bool isPacingInit_ = false;
+    int64_t anchorTimeStamp_ = 0;
+    int64_t anchorTime_ = 0;
+    std::atomic<uint64_t> presentedFrames_ {0};
+    std::atomic<uint64_t> droppedFrames_ {0};
+    std::atomic<uint64_t> repeatedVsyncs_ {0};
 };
 } // namespace DistributedHardware
 } // namespace OHOS
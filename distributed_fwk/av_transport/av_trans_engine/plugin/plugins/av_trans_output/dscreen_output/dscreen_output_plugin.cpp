@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,8 @@
 
 #include "dscreen_output_plugin.h"
 
+#include <cstdlib>
+
 #include "foundation/utils/constants.h"
 #include "plugin/factory/plugin_factory.h"
 #include "plugin/interface/generic_plugin.h"
@@ -108,9 +110,33 @@ Status DscreenOutputPlugin::GetParameter(Tag tag, ValueType &value)
 Status DscreenOutputPlugin::SetParameter(Tag tag, const ValueType &value)
 {
     TRUE_RETURN_V_MSG_E((!controller_), Status::ERROR_NULL_POINTER, "Controller is nullptr.");
+    if (tag == Tag::USER_FRAME_PTS) {
+        TRUE_RETURN_V_MSG_E(!Plugin::Any::IsSameTypeWith<int64_t>(value), Status::ERROR_INVALID_PARAMETER,
+            "Repeat frame pts is not int64.");
+        controller_->RepeatLastFrame(Plugin::AnyCast<int64_t>(value));
+        return Status::OK;
+    }
+    if (tag == Tag::SECTION_VIDEO_SPECIFIC_START) {
+        return SetDisplayVsync(value);
+    }
     return controller_->SetParameter(tag, value);
 }
 
+Status DscreenOutputPlugin::SetDisplayVsync(const ValueType &value)
+{
+    TRUE_RETURN_V_MSG_E(!Plugin::Any::IsSameTypeWith<std::string>(value), Status::ERROR_INVALID_PARAMETER,
+        "Display vsync info is not string.");
+    // The vsync info is "<vsync time ns>,<vsync period ns>".
+    std::string vsyncInfo = Plugin::AnyCast<std::string>(value);
+    char *end = nullptr;
+    int64_t vsyncTime = std::strtoll(vsyncInfo.c_str(), &end, 10); // 10: decimal
+    TRUE_RETURN_V_MSG_E((end == nullptr || *end != ','), Status::ERROR_INVALID_PARAMETER,
+        "Invalid display vsync info %{public}s.", vsyncInfo.c_str());
+    int64_t period = std::strtoll(end + 1, nullptr, 10); // 10: decimal
+    controller_->UpdateVsync(vsyncTime, period);
+    return Status::OK;
+}
+
 Status DscreenOutputPlugin::Start()
 {
     AVTRANS_LOGI("Start");
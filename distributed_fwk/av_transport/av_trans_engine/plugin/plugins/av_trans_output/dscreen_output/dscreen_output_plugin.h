@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -66,6 +66,7 @@ public:
 
 private:
     void InitOutputController();
+    Status SetDisplayVsync(const ValueType &value);
     State GetCurrentState()
     {
         std::lock_guard<std::mutex> lock(stateMutex_);
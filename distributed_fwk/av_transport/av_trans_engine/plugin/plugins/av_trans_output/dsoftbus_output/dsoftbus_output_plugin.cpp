@@ -340,14 +340,11 @@ void DsoftbusOutputPlugin::SendDataToSoftbus(std::shared_ptr<Buffer> &buffer)
         return;
     }
     std::string jsonStr = std::string(str);
-    AVTRANS_LOGI("jsonStr->bufLen %{public}zu, jsonStR: %{public}s", jsonStr.length(), jsonStr.c_str());
+    AVTRANS_LOGD("jsonStr->bufLen %{public}zu, jsonStR: %{public}s", jsonStr.length(), jsonStr.c_str());
 
     auto bufferData = buffer->GetMemory();
-    StreamData data = {reinterpret_cast<char *>(const_cast<uint8_t*>(bufferData->GetReadOnlyData())),
-        bufferData->GetSize()};
-    StreamData ext = {const_cast<char *>(jsonStr.c_str()), jsonStr.length()};
-
-    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_, &data, &ext);
+    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_,
+        bufferData->GetReadOnlyData(), bufferData->GetSize(), jsonStr);
     if (ret != DH_AVT_SUCCESS) {
         AVTRANS_LOGE("Send data to softbus failed.");
     }
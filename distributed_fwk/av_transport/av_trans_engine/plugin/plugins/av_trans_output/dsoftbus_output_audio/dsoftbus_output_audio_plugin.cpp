@@ -329,14 +329,11 @@ void DsoftbusOutputAudioPlugin::SendDataToSoftbus(std::shared_ptr<Buffer> &buffe
         return;
     }
     std::string jsonStr = std::string(str);
-    AVTRANS_LOGI("buffer data len = %{public}zu, ext data len = %{public}zu, ext data = %{public}s",
+    AVTRANS_LOGD("buffer data len = %{public}zu, ext data len = %{public}zu, ext data = %{public}s",
         bufferData->GetSize(), jsonStr.length(), jsonStr.c_str());
 
-    StreamData data = {reinterpret_cast<char *>(const_cast<uint8_t*>(bufferData->GetReadOnlyData())),
-        bufferData->GetSize()};
-    StreamData ext = {const_cast<char *>(jsonStr.c_str()), jsonStr.length()};
-
-    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_, &data, &ext);
+    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_,
+        bufferData->GetReadOnlyData(), bufferData->GetSize(), jsonStr);
     if (ret != DH_AVT_SUCCESS) {
         AVTRANS_LOGE("Send data to softbus failed.");
     }
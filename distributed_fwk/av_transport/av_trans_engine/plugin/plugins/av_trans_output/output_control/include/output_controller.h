@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -98,9 +98,15 @@ public:
     Status GetParameter(Tag tag, ValueType& value);
     Status SetParameter(Tag tag, const ValueType& value);
 
-private:
+protected:
+    virtual int32_t ControlOutput(const std::shared_ptr<Plugin::Buffer>& data);
     ControlMode GetControlMode();
     ControlStatus GetControlStatus();
+    size_t GetQueueSize();
+    // Sleeps until deadline on CLOCK_MONOTONIC, returns false when the control is no longer started.
+    bool WaitUntil(const int64_t deadline);
+
+private:
     void SetControlMode(ControlMode mode);
     void SetControlStatus(ControlStatus status);
 
@@ -110,10 +116,9 @@ private:
     void CalProcessTime(const std::shared_ptr<Plugin::Buffer>& data);
     void SetClockTime(const int64_t clockTime);
     int64_t GetClockTime();
-    void SetDevClockDiff(int32_t diff);
-    int32_t GetDevClockDiff();
+    void SetDevClockDiff(int64_t diff);
+    int64_t GetDevClockDiff();
     int32_t AcquireSyncClockTime(const std::shared_ptr<Plugin::Buffer>& data);
-    size_t GetQueueSize();
 
     void ClearQueue(std::queue<std::shared_ptr<Plugin::Buffer>>& queue);
 
@@ -122,12 +127,11 @@ private:
     bool CheckIsAllowControl();
     bool CheckIsClockInvalid(const std::shared_ptr<Plugin::Buffer>& data);
     bool WaitRereadClockFailed(const std::shared_ptr<Plugin::Buffer>& data);
+    void WaitMasterClockReady(const int64_t timeout);
     bool CheckIsProcessInDynamicBalance(const std::shared_ptr<Plugin::Buffer>& data);
     bool CheckIsProcessInDynamicBalanceOnce(const std::shared_ptr<Plugin::Buffer>& data);
 
-    void LooperHandle();
     void LooperControl();
-    int32_t ControlOutput(const std::shared_ptr<Plugin::Buffer>& data);
     int32_t PostOutputEvent(const std::shared_ptr<Plugin::Buffer>& data);
     void HandleControlResult(const std::shared_ptr<Plugin::Buffer>& data, int32_t result);
     void CalSleepTime(const int64_t timeStamp);
@@ -145,13 +149,10 @@ private:
     std::atomic<ControlStatus> status_ {ControlStatus::RELEASE};
     std::atomic<ControlMode> mode_ {ControlMode::SMOOTH};
     std::unique_ptr<std::thread> controlThread_ = nullptr;
-    std::unique_ptr<std::thread> handlerThread_ = nullptr;
     std::shared_ptr<AppExecFwk::EventHandler> handler_ = nullptr;
     std::condition_variable controlCon_;
     std::condition_variable sleepCon_;
     std::condition_variable clockCon_;
-    std::condition_variable handlerCon_;
-    std::mutex handlerMutex_;
     std::mutex queueMutex_;
     std::mutex sleepMutex_;
     std::mutex stateMutex_;
@@ -187,9 +188,10 @@ private:
     int64_t delta_ = 0;
     int64_t sleep_ = 0;
     int64_t sleepThre_ = 0;
-    AVTransSharedMemory sharedMem_ = { 0, 0, "" };
+    std::mutex sharedMemMutex_;
+    AVTransSharedMemory sharedMem_ = { 0, 0, "", nullptr };
     AVSyncClockUnit clockUnit_ = { 0, 0, 0 };
-    std::atomic<int32_t> devClockDiff_ = 0;
+    std::atomic<int64_t> devClockDiff_ = 0;
     int64_t aFront_ = 0;
     int64_t aBack_ = 0;
     int64_t vFront_ = 0;
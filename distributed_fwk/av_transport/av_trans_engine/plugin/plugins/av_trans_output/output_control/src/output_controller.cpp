@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include "output_controller.h"
 
+#include <cmath>
 #include <cstdlib>
 #include <sys/prctl.h>
 
@@ -23,6 +24,22 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+namespace {
+std::mutex g_outputRunnerMutex;
+std::weak_ptr<AppExecFwk::EventRunner> g_outputRunner;
+
+std::shared_ptr<AppExecFwk::EventRunner> AcquireOutputRunner()
+{
+    std::lock_guard<std::mutex> lock(g_outputRunnerMutex);
+    auto runner = g_outputRunner.lock();
+    if (runner == nullptr) {
+        runner = AppExecFwk::EventRunner::Create(OUTPUT_HANDLE_THREAD_NAME);
+        g_outputRunner = runner;
+    }
+    return runner;
+}
+}
+
 OutputController::~OutputController()
 {
     ReleaseControl();
@@ -59,13 +76,9 @@ OutputController::ControlStatus OutputController::StartControl()
     TRUE_RETURN_V_MSG_D((GetControlStatus() == ControlStatus::START), ControlStatus::STARTED,
         "Control status is started.");
     SetControlStatus(ControlStatus::START);
-    if (!handlerThread_) {
-        AVTRANS_LOGD("Init handler thread.");
-        handlerThread_ = std::make_unique<std::thread>(&OutputController::LooperHandle, this);
-        std::unique_lock<std::mutex> lock(handlerMutex_);
-        handlerCon_.wait(lock, [this] {
-            return handler_;
-        });
+    if (!handler_) {
+        AVTRANS_LOGD("Init output handler on the shared runner.");
+        handler_ = std::make_shared<AppExecFwk::EventHandler>(AcquireOutputRunner());
     }
     if (!controlThread_) {
         AVTRANS_LOGD("Init control thread.");
@@ -106,19 +119,22 @@ OutputController::ControlStatus OutputController::ReleaseControl()
     controlCon_.notify_one();
     sleepCon_.notify_one();
     clockCon_.notify_one();
-    if (handler_ && handler_->GetEventRunner()) {
-        handler_->GetEventRunner()->Stop();
-    }
-    if (handlerThread_) {
-        handlerThread_->join();
-        handlerThread_ = nullptr;
-    }
     if (controlThread_) {
         controlThread_->join();
         controlThread_ = nullptr;
     }
+    if (handler_) {
+        handler_->RemoveAllEvents();
+        // The runner is shared, wait for an output task of this controller that is already running.
+        handler_->PostSyncTask([] {});
+        handler_ = nullptr;
+    }
     ClearQueue(dataQueue_);
     paramsMap_.clear();
+    {
+        std::lock_guard<std::mutex> lock(sharedMemMutex_);
+        UnmapAVTransSharedMemory(sharedMem_);
+    }
     AVTRANS_LOGI("Release control success.");
     return ControlStatus::RELEASE;
 }
@@ -148,7 +164,12 @@ Status OutputController::SetParameter(Tag tag, const ValueType& value)
             }
             case Tag::USER_SHARED_MEMORY_FD: {
                 std::string jsonStr = Plugin::AnyCast<std::string>(value);
+                std::lock_guard<std::mutex> memLock(sharedMemMutex_);
+                UnmapAVTransSharedMemory(sharedMem_);
                 sharedMem_ = UnmarshalSharedMemory(jsonStr);
+                if ((sharedMem_.fd > 0) && (MapAVTransSharedMemory(sharedMem_) != DH_AVT_SUCCESS)) {
+                    AVTRANS_LOGE("Map shared memory %{public}s failed.", sharedMem_.name.c_str());
+                }
                 AVTRANS_LOGD("Set parameter USER_SHARED_MEMORY_FD: %{public}s, unmarshal sharedMem fd: %{public}d, "
                     "size: %{public}d, name: %{public}s", jsonStr.c_str(), sharedMem_.fd, sharedMem_.size,
                     sharedMem_.name.c_str());
@@ -156,9 +177,9 @@ Status OutputController::SetParameter(Tag tag, const ValueType& value)
             }
             case Tag::USER_TIME_SYNC_RESULT: {
                 std::string jsonStr = Plugin::AnyCast<std::string>(value);
-                int32_t devClockDiff = atoi(jsonStr.c_str());
+                int64_t devClockDiff = std::llround(strtod(jsonStr.c_str(), nullptr) * NS_ONE_MS);
                 SetDevClockDiff(devClockDiff);
-                AVTRANS_LOGD("Set parameter USER_TIME_SYNC_RESULT: %{public}s, devClockDiff is %{public}d.",
+                AVTRANS_LOGD("Set parameter USER_TIME_SYNC_RESULT: %{public}s, devClockDiff is %{public}" PRId64 ".",
                     jsonStr.c_str(), devClockDiff);
                 break;
             }
@@ -206,18 +227,6 @@ void OutputController::PrepareSmooth()
     SetTimeStampOnceDiffThre(0);
 }
 
-void OutputController::LooperHandle()
-{
-    prctl(PR_SET_NAME, OUTPUT_HANDLE_THREAD_NAME.c_str());
-    auto runner = AppExecFwk::EventRunner::Create(false);
-    {
-        std::lock_guard<std::mutex> lock(handlerMutex_);
-        handler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
-    }
-    handlerCon_.notify_one();
-    runner->Run();
-}
-
 void OutputController::LooperControl()
 {
     prctl(PR_SET_NAME, LOOPER_CONTROL_THREAD_NAME.c_str());
@@ -351,17 +360,17 @@ int32_t OutputController::AcquireSyncClockTime(const std::shared_ptr<Plugin::Buf
         AVTRANS_LOGE("data or getbuffermeta is nullptr");
         return ERR_DH_AVT_INVALID_PARAM;
     }
-    TRUE_RETURN_V_MSG_E(((sharedMem_.fd <= 0) || (sharedMem_.size <= 0) || sharedMem_.name.empty()),
-        ERR_DH_AVT_SHARED_MEMORY_FAILED, "Parameter USER_SHARED_MEMORY_FD info error.");
-    AVTransSharedMemory sharedMem;
-    sharedMem.fd = sharedMem_.fd;
-    sharedMem.size = sharedMem_.size;
-    sharedMem.name = sharedMem_.name;
     AVSyncClockUnit clockUnit;
     clockUnit.pts = INVALID_TIMESTAMP;
     auto bufferMeta = data->GetBufferMeta();
     clockUnit.frameNum = Plugin::AnyCast<uint32_t>(bufferMeta->GetMeta(Tag::AUDIO_SAMPLE_PER_FRAME));
-    int32_t ret = ReadClockUnitFromMemory(sharedMem, clockUnit);
+    int32_t ret = DH_AVT_SUCCESS;
+    {
+        std::lock_guard<std::mutex> lock(sharedMemMutex_);
+        TRUE_RETURN_V_MSG_E(((sharedMem_.fd <= 0) || (sharedMem_.size <= 0) || sharedMem_.name.empty()),
+            ERR_DH_AVT_SHARED_MEMORY_FAILED, "Parameter USER_SHARED_MEMORY_FD info error.");
+        ret = ReadClockUnitFromMemory(sharedMem_, clockUnit);
+    }
     if (ret == DH_AVT_SUCCESS) {
         TRUE_RETURN_V_MSG_D((clockUnit.pts == INVALID_TIMESTAMP), ERR_DH_AVT_SHARED_MEMORY_FAILED,
             "Read invalid clock.");
@@ -377,33 +386,36 @@ bool OutputController::WaitRereadClockFailed(const std::shared_ptr<Plugin::Buffe
 {
     const uint32_t halfQueueSize = QUEUE_MAX_SIZE / 2;
     while (GetQueueSize() < QUEUE_MAX_SIZE) {
+        int64_t rereadTime = GREATER_HALF_REREAD_TIME;
         if (GetQueueSize() < halfQueueSize) {
-            {
-                AVTRANS_LOGD("Dataqueue size is less than half size, wait notify.");
-                std::unique_lock<std::mutex> lock(clockMutex_);
-                int64_t rereadTime = LESS_HALF_REREAD_TIME;
-                if (statistician_) {
-                    rereadTime = statistician_->GetAverPushInterval() * FACTOR_DOUBLE;
-                }
-                clockCon_.wait_for(lock, std::chrono::nanoseconds(rereadTime),
-                    [this] { return (GetControlStatus() != ControlStatus::START); });
-            }
-        } else if (GetQueueSize() >= halfQueueSize) {
-            {
-                AVTRANS_LOGD("Dataqueue size is greater than half size, scheduled %{public}lld query.",
-                    GREATER_HALF_REREAD_TIME);
-                std::unique_lock<std::mutex> lock(clockMutex_);
-                clockCon_.wait_for(lock, std::chrono::nanoseconds(GREATER_HALF_REREAD_TIME),
-                    [this] { return (GetControlStatus() != ControlStatus::START); });
-            }
+            rereadTime = statistician_ ? (statistician_->GetAverPushInterval() * FACTOR_DOUBLE) : LESS_HALF_REREAD_TIME;
         }
+        AVTRANS_LOGD("Wait master clock ready, timeout %{public}lld.", rereadTime);
+        WaitMasterClockReady(rereadTime);
         int32_t ret = AcquireSyncClockTime(data);
         TRUE_RETURN_V_MSG_D((ret == DH_AVT_SUCCESS || GetControlMode() == ControlMode::SMOOTH), false,
             "Wait reread clock success.");
+        TRUE_RETURN_V_MSG_D((GetControlStatus() != ControlStatus::START), true, "Control is not started.");
     }
     return true;
 }
 
+void OutputController::WaitMasterClockReady(const int64_t timeout)
+{
+    if (GetControlStatus() != ControlStatus::START) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(sharedMemMutex_);
+        if (WaitClockUnitReady(sharedMem_, timeout) != ERR_DH_AVT_INVALID_PARAM) {
+            return;
+        }
+    }
+    std::unique_lock<std::mutex> lock(clockMutex_);
+    clockCon_.wait_for(lock, std::chrono::nanoseconds(timeout),
+        [this] { return (GetControlStatus() != ControlStatus::START); });
+}
+
 bool OutputController::CheckIsProcessInDynamicBalance(const std::shared_ptr<Plugin::Buffer>& data)
 {
     TRUE_RETURN_V_MSG_D((GetControlMode() == ControlMode::SYNC || GetProcessDynamicBalanceState()), true,
@@ -488,11 +500,15 @@ void OutputController::SyncClock(const std::shared_ptr<Plugin::Buffer>& data)
         AVTRANS_LOGD("Sleep less than zero, adjust sleep to zero.");
     }
     AVTRANS_LOGD("After sync clock, sleep is %{public}lld.", sleep_);
-    {
-        std::unique_lock<std::mutex> lock(sleepMutex_);
-        sleepCon_.wait_for(lock, std::chrono::nanoseconds(sleep_),
-            [this] { return (GetControlStatus() != ControlStatus::START); });
-    }
+    // GetCurrentTime reads CLOCK_MONOTONIC, so the deadline is taken from the frame enter time.
+    WaitUntil(enterTime_ + sleep_);
+}
+
+bool OutputController::WaitUntil(const int64_t deadline)
+{
+    auto timePoint = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(deadline));
+    std::unique_lock<std::mutex> lock(sleepMutex_);
+    return !sleepCon_.wait_until(lock, timePoint, [this] { return (GetControlStatus() != ControlStatus::START); });
 }
 
 void OutputController::HandleSmoothTime(const std::shared_ptr<Plugin::Buffer>& data)
@@ -763,13 +779,21 @@ int64_t OutputController::GetClockTime()
     return clockTime_.load();
 }
 
-void OutputController::SetDevClockDiff(int32_t diff)
+void OutputController::SetDevClockDiff(int64_t diff)
 {
     devClockDiff_.store(diff);
 }
 
-int32_t OutputController::GetDevClockDiff()
+int64_t OutputController::GetDevClockDiff()
 {
+    // The drift fitted over all time sync results of the device pair wins over the latest single result.
+    AVSyncClockDrift drift;
+    {
+        std::lock_guard<std::mutex> lock(sharedMemMutex_);
+        if (!IsInValidSharedMemory(sharedMem_) && (ReadClockDriftFromMemory(sharedMem_, drift) == DH_AVT_SUCCESS)) {
+            return GetClockOffsetAt(drift, GetCurrentTime());
+        }
+    }
     return devClockDiff_.load();
 }
 
@@ -671,6 +671,19 @@ HWTEST_F(DaudioInputTest, SendStreamData_001, TestSize.Level1)
     EXPECT_EQ(ret, ERR_DH_AVT_SEND_DATA_FAILED);
 }
 
+HWTEST_F(DaudioInputTest, SendStreamData_002, TestSize.Level1)
+{
+    std::string sessionName = OWNER_NAME_D_SCREEN + "_" + RECEIVER_CONTROL_SESSION_NAME_SUFFIX;
+    uint8_t bytes[] = {0, 0, 0, 0};
+    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName, "devid", nullptr, 0, "ext");
+    EXPECT_EQ(ret, ERR_DH_AVT_INVALID_PARAM);
+    ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName, "devid", bytes,
+        DSOFTBUS_INPUT_MAX_RECV_DATA_LEN + 1, "ext");
+    EXPECT_EQ(ret, ERR_DH_AVT_INVALID_PARAM);
+    ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName, "devid", bytes, sizeof(bytes), "ext");
+    EXPECT_EQ(ret, ERR_DH_AVT_SEND_DATA_FAILED);
+}
+
 HWTEST_F(DaudioInputTest, FindSessionName_001, TestSize.Level1)
 {
     std::string peerSessionName = OWNER_NAME_D_SCREEN + "_" + SENDER_CONTROL_SESSION_NAME_SUFFIX;
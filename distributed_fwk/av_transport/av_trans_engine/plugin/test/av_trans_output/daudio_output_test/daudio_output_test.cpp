@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -238,6 +238,93 @@ HWTEST_F(DaudioOutputTest, WriteMasterClockToMemory_001, testing::ext::TestSize.
     EXPECT_EQ(Status::OK, ret);
 }
 
+HWTEST_F(DaudioOutputTest, JitterBuffer_001, TestSize.Level1)
+{
+    const int64_t frameInterval = 20000000;
+    DaudioJitterBuffer jitterBuffer;
+    EXPECT_FALSE(jitterBuffer.IsPlayable(0));
+    for (uint32_t frameNum = 1; frameNum <= 10; frameNum++) {
+        jitterBuffer.OnFrameArrived(frameInterval * frameNum, frameNum);
+    }
+    EXPECT_EQ(frameInterval, jitterBuffer.GetFrameInterval());
+    EXPECT_EQ(0, jitterBuffer.GetJitter());
+    EXPECT_EQ(1, jitterBuffer.GetTargetDepth());
+    EXPECT_EQ(0, jitterBuffer.GetLostCount());
+    EXPECT_TRUE(jitterBuffer.IsPlayable(1));
+    EXPECT_EQ(2 * frameInterval, jitterBuffer.GetDelay(2));
+
+    jitterBuffer.Reset();
+    EXPECT_EQ(0, jitterBuffer.GetFrameInterval());
+    EXPECT_FALSE(jitterBuffer.IsPlayable(0));
+}
+
+HWTEST_F(DaudioOutputTest, JitterBuffer_002, TestSize.Level1)
+{
+    const int64_t frameInterval = 20000000;
+    const int64_t jitter = 15000000;
+    DaudioJitterBuffer jitterBuffer;
+    int64_t arrivalTime = 0;
+    for (uint32_t frameNum = 1; frameNum <= 200; frameNum++) {
+        arrivalTime += (frameNum % 2 == 0) ? (frameInterval - jitter) : (frameInterval + jitter);
+        jitterBuffer.OnFrameArrived(arrivalTime, frameNum);
+    }
+    EXPECT_GT(jitterBuffer.GetJitter(), 0);
+    size_t jitterDepth = jitterBuffer.GetTargetDepth();
+    EXPECT_GT(jitterDepth, 1);
+
+    uint32_t frameNum = 200;
+    for (uint32_t i = 0; i < 20; i++) {
+        frameNum += (i % 2 == 0) ? 2 : 1;
+        arrivalTime += frameInterval * ((i % 2 == 0) ? 2 : 1);
+        jitterBuffer.OnFrameArrived(arrivalTime, frameNum);
+    }
+    EXPECT_EQ(10, jitterBuffer.GetLostCount());
+}
+
+HWTEST_F(DaudioOutputTest, JitterBuffer_003, TestSize.Level1)
+{
+    const int64_t frameInterval = 20000000;
+    DaudioJitterBuffer jitterBuffer;
+    jitterBuffer.OnFrameArrived(0, 1);
+    jitterBuffer.OnFrameArrived(frameInterval, 2);
+    EXPECT_TRUE(jitterBuffer.IsPlayable(1));
+
+    jitterBuffer.OnQueueIdle(frameInterval + frameInterval / 2, 0);
+    EXPECT_EQ(0, jitterBuffer.GetUnderrunCount());
+    jitterBuffer.OnQueueIdle(frameInterval * 3, 0);
+    EXPECT_EQ(1, jitterBuffer.GetUnderrunCount());
+    EXPECT_FALSE(jitterBuffer.IsPlayable(0));
+    EXPECT_TRUE(jitterBuffer.IsPlayable(jitterBuffer.GetTargetDepth()));
+
+    size_t deepDepth = jitterBuffer.GetTargetDepth() + 3;
+    bool dropped = false;
+    for (uint32_t i = 0; i < 100 && !dropped; i++) {
+        dropped = jitterBuffer.ShouldDropFrame(deepDepth);
+    }
+    EXPECT_TRUE(dropped);
+    EXPECT_FALSE(jitterBuffer.ShouldDropFrame(jitterBuffer.GetTargetDepth()));
+}
+
+HWTEST_F(DaudioOutputTest, PushData_002, TestSize.Level1)
+{
+    auto plugin = std::make_shared<DaudioOutputPlugin>(PLUGINNAME);
+    std::string inPort = "inPort_test";
+    size_t bufferSize = 1024;
+    std::vector<uint8_t> buff(bufferSize);
+    for (uint32_t frameNum : { 1, 2, 4 }) {
+        std::shared_ptr<Plugin::Buffer> buffer = std::make_shared<Plugin::Buffer>(BufferMetaType::AUDIO);
+        buffer->WrapMemory(buff.data(), bufferSize, bufferSize);
+        buffer->GetBufferMeta()->SetMeta(Tag::USER_FRAME_NUMBER, frameNum);
+        buffer->GetBufferMeta()->SetMeta(Tag::USER_FRAME_PTS, static_cast<int64_t>(frameNum));
+        EXPECT_EQ(Status::OK, plugin->PushData(inPort, buffer, 0));
+    }
+    EXPECT_EQ(1, plugin->jitterBuffer_.GetLostCount());
+    EXPECT_EQ(0, plugin->GetJitterDelay());
+
+    plugin->DataQueueClear(plugin->outputBuffer_);
+    EXPECT_EQ(0, plugin->jitterBuffer_.GetLostCount());
+}
+
 HWTEST_F(DaudioOutputTest, SetCallback_001, testing::ext::TestSize.Level1)
 {
     auto plugin = std::make_shared<DaudioOutputPlugin>(PLUGINNAME);
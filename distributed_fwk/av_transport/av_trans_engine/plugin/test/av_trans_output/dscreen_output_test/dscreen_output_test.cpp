@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -315,6 +315,82 @@ HWTEST_F(DscreenOutputTest, NotifyOutput_001, testing::ext::TestSize.Level1)
     plugin->controller_->HandleControlResult(data, result);
 }
 
+HWTEST_F(DscreenOutputTest, RepeatLastFrame_001, testing::ext::TestSize.Level1)
+{
+    auto plugin = std::make_shared<DscreenOutputPlugin>(PLUGINNAME);
+    plugin->InitOutputController();
+    int64_t pts = 2000;
+    plugin->controller_->SetControlStatus(OutputController::ControlStatus::START);
+    plugin->controller_->RepeatLastFrame(pts);
+    EXPECT_EQ(plugin->controller_->GetQueueSize(), 0);
+
+    auto data = std::make_shared<AVBuffer>(BufferMetaType::VIDEO);
+    const size_t frameSize = 16;
+    data->AllocMemory(nullptr, frameSize);
+    std::vector<uint8_t> frame(frameSize, 1);
+    data->GetMemory()->Write(frame.data(), frameSize);
+    data->pts = 1000;
+    plugin->controller_->NotifyOutput(data);
+
+    Status ret = plugin->SetParameter(Tag::USER_FRAME_PTS, std::string("2000"));
+    EXPECT_EQ(Status::ERROR_INVALID_PARAMETER, ret);
+    ret = plugin->SetParameter(Tag::USER_FRAME_PTS, pts);
+    EXPECT_EQ(Status::OK, ret);
+    ASSERT_EQ(plugin->controller_->GetQueueSize(), 1);
+    auto repeat = plugin->controller_->dataQueue_.front();
+    EXPECT_NE(repeat, data);
+    EXPECT_EQ(repeat->pts, pts);
+    EXPECT_EQ(repeat->GetMemory()->GetSize(), frameSize);
+}
+
+HWTEST_F(DscreenOutputTest, UpdateVsync_001, testing::ext::TestSize.Level1)
+{
+    auto plugin = std::make_shared<DscreenOutputPlugin>(PLUGINNAME);
+    plugin->InitOutputController();
+    const int64_t period = 16 * NS_ONE_MS;
+    plugin->controller_->UpdateVsync(0, period);
+    EXPECT_FALSE(plugin->controller_->isVsyncFromDisplay_);
+
+    plugin->controller_->UpdateVsync(period, period);
+    EXPECT_EQ(period, plugin->controller_->GetNextVsync(0));
+    EXPECT_EQ(period, plugin->controller_->GetNextVsync(period - 1));
+    EXPECT_EQ(2 * period, plugin->controller_->GetNextVsync(period));
+
+    Status ret = plugin->SetParameter(Tag::SECTION_VIDEO_SPECIFIC_START, std::string("invalid"));
+    EXPECT_EQ(Status::ERROR_INVALID_PARAMETER, ret);
+    ret = plugin->SetParameter(Tag::SECTION_VIDEO_SPECIFIC_START, std::string("1000,8000000"));
+    EXPECT_EQ(Status::OK, ret);
+    EXPECT_EQ(8000000, plugin->controller_->GetVsyncPeriod());
+}
+
+HWTEST_F(DscreenOutputTest, VsyncPacing_001, testing::ext::TestSize.Level1)
+{
+    auto plugin = std::make_shared<DscreenOutputPlugin>(PLUGINNAME);
+    plugin->InitOutputController();
+    plugin->controller_->SetControlStatus(OutputController::ControlStatus::START);
+    std::shared_ptr<Plugin::Buffer> late = std::make_shared<AVBuffer>();
+    late->pts = 100 * NS_ONE_MS;
+    std::shared_ptr<Plugin::Buffer> next = std::make_shared<AVBuffer>();
+    next->pts = 200 * NS_ONE_MS;
+    plugin->controller_->PushData(late);
+    plugin->controller_->PushData(next);
+
+    const int64_t lateTime = 100 * NS_ONE_MS;
+    plugin->controller_->isPacingInit_ = true;
+    plugin->controller_->anchorTimeStamp_ = late->pts;
+    plugin->controller_->anchorTime_ = GetCurrentTime() - lateTime;
+    EXPECT_EQ(DROP_FRAME, plugin->controller_->ControlOutput(late));
+    EXPECT_EQ(1U, plugin->controller_->GetPacingStats().dropped);
+
+    const int64_t earlyTime = 50 * NS_ONE_MS;
+    plugin->controller_->anchorTimeStamp_ = next->pts;
+    plugin->controller_->anchorTime_ = GetCurrentTime() + earlyTime;
+    EXPECT_EQ(OUTPUT_FRAME, plugin->controller_->ControlOutput(next));
+    VsyncPacingStats stats = plugin->controller_->GetPacingStats();
+    EXPECT_EQ(1U, stats.presented);
+    EXPECT_GE(stats.repeated, 1U);
+}
+
 HWTEST_F(DscreenOutputTest, SetCallback_001, testing::ext::TestSize.Level1)
 {
     auto plugin = std::make_shared<DscreenOutputPlugin>(PLUGINNAME);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,7 @@
 #include "dsoftbus_output_plugin_test.h"
 
 #include "dsoftbus_output_plugin.h"
+#include "softbus_channel_adapter.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -209,5 +210,55 @@ HWTEST_F(DsoftbusOutputPluginTest, OpenSoftbusChannel_001, TestSize.Level1)
     StreamData *ext = nullptr;
     plugin->OnStreamReceived(data, ext);
 }
+
+HWTEST_F(DsoftbusOutputPluginTest, GetSessionPriority_001, TestSize.Level1)
+{
+    EXPECT_EQ(SessionPriority::CONTROL, SoftbusChannelAdapter::GetSessionPriority(
+        OWNER_NAME_D_SCREEN + "_" + SENDER_CONTROL_SESSION_NAME_SUFFIX));
+    EXPECT_EQ(SessionPriority::CONTROL, SoftbusChannelAdapter::GetSessionPriority(
+        AV_SYNC_RECEIVER_CONTROL_SESSION_NAME));
+    EXPECT_EQ(SessionPriority::AUDIO, SoftbusChannelAdapter::GetSessionPriority(
+        OWNER_NAME_D_SPEAKER + "_" + SENDER_DATA_SESSION_NAME_SUFFIX));
+    EXPECT_EQ(SessionPriority::VIDEO, SoftbusChannelAdapter::GetSessionPriority(
+        OWNER_NAME_D_SCREEN + "_" + SENDER_DATA_SESSION_NAME_SUFFIX));
+}
+
+HWTEST_F(DsoftbusOutputPluginTest, BindSessionKey_001, TestSize.Level1)
+{
+    SoftbusChannelAdapter &adapter = SoftbusChannelAdapter::GetInstance();
+    int32_t sessionId = 9527;
+    std::string videoKey = OWNER_NAME_D_SCREEN + "_" + SENDER_DATA_SESSION_NAME_SUFFIX + "_peerDevId";
+    std::string controlKey = OWNER_NAME_D_SCREEN + "_" + SENDER_CONTROL_SESSION_NAME_SUFFIX + "_peerDevId";
+    {
+        std::unique_lock<std::shared_mutex> lock(adapter.idMapMutex_);
+        adapter.BindSessionKey(videoKey, sessionId);
+        adapter.BindSessionKey(controlKey, sessionId);
+        adapter.BindSessionKey(controlKey, sessionId + 1);
+    }
+    std::vector<std::string> keys = adapter.GetSessionKeysById(sessionId);
+    ASSERT_EQ(2, keys.size());
+    EXPECT_EQ(controlKey, adapter.GetSessionNameById(sessionId));
+    EXPECT_EQ("peerDevId", adapter.GetPeerDevIdBySessId(sessionId));
+    EXPECT_TRUE(adapter.GetSessionKeysById(sessionId + 1).empty());
+
+    {
+        std::unique_lock<std::shared_mutex> lock(adapter.idMapMutex_);
+        adapter.UnbindSessionKey(videoKey);
+        adapter.UnbindSessionKey(controlKey);
+    }
+    EXPECT_TRUE(adapter.GetSessionKeysById(sessionId).empty());
+    EXPECT_EQ(-1, adapter.GetSessIdBySessName(OWNER_NAME_D_SCREEN + "_" + SENDER_CONTROL_SESSION_NAME_SUFFIX,
+        "peerDevId"));
+}
+
+HWTEST_F(DsoftbusOutputPluginTest, SendChannelEvent_001, TestSize.Level1)
+{
+    SoftbusChannelAdapter &adapter = SoftbusChannelAdapter::GetInstance();
+    std::string unknownKey = OWNER_NAME_D_SCREEN + "_" + SENDER_DATA_SESSION_NAME_SUFFIX + "_unknownDevId";
+    AVTransEvent event = {EventType::EVENT_CHANNEL_CLOSED, "", "unknownDevId"};
+    adapter.SendChannelEvent(unknownKey, event);
+    std::shared_lock<std::shared_mutex> lock(adapter.listenerMtx_);
+    EXPECT_EQ(adapter.listenerMap_.end(), adapter.listenerMap_.find(unknownKey));
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
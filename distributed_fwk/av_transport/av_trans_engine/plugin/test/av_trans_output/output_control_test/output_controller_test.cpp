@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,8 @@
 
 #include "output_controller_test.h"
 
+#include <vector>
+
 #include "output_controller.h"
 #include "av_trans_errno.h"
 
@@ -31,6 +33,7 @@ void OutputControllerTest::SetUp(void) {}
 void OutputControllerTest::TearDown(void) {}
 
 const int32_t TEST_QUEUE_MAX_SIZE = 100;
+const int64_t TEST_REREAD_TIME = 1000000;
 
 HWTEST_F(OutputControllerTest, SetParameter_001, TestSize.Level1)
 {
@@ -67,6 +70,25 @@ HWTEST_F(OutputControllerTest, SetParameter_003, TestSize.Level0)
     EXPECT_EQ(Status::OK, ret);
 }
 
+HWTEST_F(OutputControllerTest, GetDevClockDiff_001, TestSize.Level1)
+{
+    auto controller = std::make_shared<OutputController>();
+    std::string value = "12.345";
+    EXPECT_EQ(Status::OK, controller->SetParameter(Tag::USER_TIME_SYNC_RESULT, value));
+    EXPECT_EQ(12345000, controller->GetDevClockDiff());
+
+    std::vector<uint8_t> buffer(sizeof(AVSyncClockRegion), 0);
+    controller->sharedMem_ = AVTransSharedMemory{ 1, static_cast<int32_t>(buffer.size()), "name_test", buffer.data() };
+    ASSERT_EQ(DH_AVT_SUCCESS, InitClockUnitMemory(controller->sharedMem_));
+    EXPECT_EQ(12345000, controller->GetDevClockDiff());
+
+    int64_t now = GetCurrentTime();
+    AVSyncClockDrift drift = { now, 20000000, 0 };
+    ASSERT_EQ(DH_AVT_SUCCESS, WriteClockDriftToMemory(controller->sharedMem_, drift));
+    EXPECT_EQ(20000000, controller->GetDevClockDiff());
+    controller->sharedMem_ = AVTransSharedMemory{ 0, 0, "" };
+}
+
 HWTEST_F(OutputControllerTest, GetParameter_001, TestSize.Level0)
 {
     auto controller = std::make_shared<OutputController>();
@@ -97,6 +119,22 @@ HWTEST_F(OutputControllerTest, StartControl_001, testing::ext::TestSize.Level1)
     EXPECT_EQ(OutputController::ControlStatus::STARTED, ret);
 }
 
+HWTEST_F(OutputControllerTest, StartControl_002, testing::ext::TestSize.Level1)
+{
+    auto controller = std::make_shared<OutputController>();
+    auto controller1 = std::make_shared<OutputController>();
+    controller->StartControl();
+    controller1->StartControl();
+    ASSERT_NE(nullptr, controller->handler_);
+    ASSERT_NE(nullptr, controller1->handler_);
+    EXPECT_EQ(controller->handler_->GetEventRunner(), controller1->handler_->GetEventRunner());
+
+    controller->ReleaseControl();
+    EXPECT_EQ(nullptr, controller->handler_);
+    controller1->ReleaseControl();
+    EXPECT_EQ(nullptr, controller1->handler_);
+}
+
 HWTEST_F(OutputControllerTest, StopControl_001, testing::ext::TestSize.Level1)
 {
     auto controller = std::make_shared<OutputController>();
@@ -181,6 +219,10 @@ HWTEST_F(OutputControllerTest, WaitRereadClockFailed_001, testing::ext::TestSize
     ret = controller->WaitRereadClockFailed(data);
     EXPECT_EQ(true, ret);
 
+    controller->SetControlStatus(OutputController::ControlStatus::START);
+    controller->WaitMasterClockReady(TEST_REREAD_TIME);
+    EXPECT_EQ(OutputController::ControlStatus::START, controller->GetControlStatus());
+
     controller->enterTime_ = 2;
     controller->leaveTime_ = 1;
     int64_t timeStamp = 2;
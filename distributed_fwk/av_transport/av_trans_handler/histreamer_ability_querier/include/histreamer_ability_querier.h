@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -34,6 +34,13 @@ using OHOS::Media::Plugin::VideoPixelFormat;
 
 namespace OHOS {
 namespace DistributedHardware {
+// Plugin types of the ability queries, in the order of HISTREAM_PLUGIN_TYPE of the framework.
+enum class AbilityQueryType : int32_t {
+    AUDIO_ENCODER = 0,
+    AUDIO_DECODER = 1,
+    VIDEO_ENCODER = 2,
+    VIDEO_DECODER = 3
+};
 
 /******************* AudioEncoder Begin *****************/
 struct AudioEncoderIn {
@@ -161,6 +168,10 @@ __attribute__((visibility("default"))) int32_t QueryAudioEncoderAbilityStr(char*
 __attribute__((visibility("default"))) int32_t QueryAudioDecoderAbilityStr(char* res);
 __attribute__((visibility("default"))) int32_t QueryVideoEncoderAbilityStr(char* res);
 __attribute__((visibility("default"))) int32_t QueryVideoDecoderAbilityStr(char* res);
+// Length of the ability of the AbilityQueryType, so the caller sizes the buffer for QueryAbilityStrByType.
+__attribute__((visibility("default"))) int32_t QueryAbilityStrLen(int32_t type);
+// Copies the ability into res of len bytes and returns its length, 0 when there is none or it does not fit.
+__attribute__((visibility("default"))) int32_t QueryAbilityStrByType(int32_t type, char* res, uint32_t len);
 #ifdef __cplusplus
 }
 #endif
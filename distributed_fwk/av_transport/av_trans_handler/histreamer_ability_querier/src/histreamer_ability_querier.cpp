@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,7 +16,9 @@
 #include "histreamer_ability_querier.h"
 
 #include <algorithm>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <securec.h>
 #include "plugin_caps.h"
@@ -982,112 +984,110 @@ void FromJson(const std::string &key, const cJSON *jsonObject, std::vector<T> &o
     }
 }
 
-int32_t QueryAudioEncoderAbilityStr(char* res)
+namespace {
+std::mutex g_abilityStrMutex;
+// Plugins register once when the plugin manager loads, so the ability of a type holds for the process.
+std::map<AbilityQueryType, std::string> g_abilityStrCache;
+
+template<typename T>
+std::string ToAbilityStr(const std::string &key, std::vector<T> abilities)
 {
-    std::vector<AudioEncoder> audioEncoders = QueryAudioEncoderAbility();
     cJSON *jsonObject = cJSON_CreateObject();
     if (jsonObject == nullptr) {
-        return 0;
+        return "";
     }
-    ToJson<AudioEncoder>(AUDIO_ENCODERS, jsonObject, audioEncoders);
+    ToJson<T>(key, jsonObject, abilities);
     char *jsonStr = cJSON_PrintUnformatted(jsonObject);
+    cJSON_Delete(jsonObject);
     if (jsonStr == nullptr) {
-        cJSON_Delete(jsonObject);
-        return 0;
+        return "";
     }
-    std::string ret = std::string(jsonStr);
+    std::string abilityStr(jsonStr);
     cJSON_free(jsonStr);
-    cJSON_Delete(jsonObject);
-    AVTRANS_LOGI("QueryAudioEncoderAbilityStr ret: %{public}s", ret.c_str());
-    if (ret.length() > MAX_MESSAGES_LEN) {
-        AVTRANS_LOGE("QueryAudioEncoderAbilityStr too long");
-        return 0;
-    }
-    if (memcpy_s(res, MAX_MESSAGES_LEN, ret.c_str(), ret.length()) != EOK) {
-        return 0;
-    }
-    return ret.length();
+    return abilityStr;
 }
 
-int32_t QueryAudioDecoderAbilityStr(char* res)
+std::string QueryAbilityStr(AbilityQueryType type)
 {
-    std::vector<AudioDecoder> audioDecoders = QueryAudioDecoderAbility();
-    cJSON *jsonObject = cJSON_CreateObject();
-    if (jsonObject == nullptr) {
-        return 0;
-    }
-    ToJson<AudioDecoder>(AUDIO_DECODERS, jsonObject, audioDecoders);
-    char *jsonStr = cJSON_PrintUnformatted(jsonObject);
-    if (jsonStr == nullptr) {
-        cJSON_Delete(jsonObject);
+    std::lock_guard<std::mutex> lock(g_abilityStrMutex);
+    auto iter = g_abilityStrCache.find(type);
+    if (iter != g_abilityStrCache.end()) {
+        return iter->second;
+    }
+    std::string abilityStr;
+    switch (type) {
+        case AbilityQueryType::AUDIO_ENCODER:
+            abilityStr = ToAbilityStr<AudioEncoder>(AUDIO_ENCODERS, QueryAudioEncoderAbility());
+            break;
+        case AbilityQueryType::AUDIO_DECODER:
+            abilityStr = ToAbilityStr<AudioDecoder>(AUDIO_DECODERS, QueryAudioDecoderAbility());
+            break;
+        case AbilityQueryType::VIDEO_ENCODER:
+            abilityStr = ToAbilityStr<VideoEncoder>(VIDEO_ENCODERS, QueryVideoEncoderAbility());
+            break;
+        case AbilityQueryType::VIDEO_DECODER:
+            abilityStr = ToAbilityStr<VideoDecoder>(VIDEO_DECODERS, QueryVideoDecoderAbility());
+            break;
+        default:
+            AVTRANS_LOGE("Unknown ability query type: %{public}d", static_cast<int32_t>(type));
+            return "";
+    }
+    // A failed query is not kept, the next one tries again.
+    if (abilityStr.empty()) {
+        return abilityStr;
+    }
+    AVTRANS_LOGI("Ability of type %{public}d takes %{public}zu bytes", static_cast<int32_t>(type),
+        abilityStr.length());
+    AVTRANS_LOGD("Ability of type %{public}d: %{public}s", static_cast<int32_t>(type), abilityStr.c_str());
+    g_abilityStrCache[type] = abilityStr;
+    return abilityStr;
+}
+
+int32_t CopyAbilityStr(AbilityQueryType type, char *res, uint32_t len)
+{
+    if (res == nullptr) {
         return 0;
     }
-    std::string ret = std::string(jsonStr);
-    cJSON_free(jsonStr);
-    cJSON_Delete(jsonObject);
-    AVTRANS_LOGI("QueryAudioDecoderAbilityStr ret: %{public}s", ret.c_str());
-    if (ret.length() > MAX_MESSAGES_LEN) {
-        AVTRANS_LOGE("QueryAudioDecoderAbilityStr too long");
+    std::string abilityStr = QueryAbilityStr(type);
+    if (abilityStr.length() > len) {
+        AVTRANS_LOGE("Ability of type %{public}d too long", static_cast<int32_t>(type));
         return 0;
     }
-    if (memcpy_s(res, MAX_MESSAGES_LEN, ret.c_str(), ret.length()) != EOK) {
+    if (abilityStr.empty() || memcpy_s(res, len, abilityStr.c_str(), abilityStr.length()) != EOK) {
         return 0;
     }
-    return ret.length();
+    return static_cast<int32_t>(abilityStr.length());
+}
+}
+
+int32_t QueryAudioEncoderAbilityStr(char* res)
+{
+    return CopyAbilityStr(AbilityQueryType::AUDIO_ENCODER, res, MAX_MESSAGES_LEN);
+}
+
+int32_t QueryAudioDecoderAbilityStr(char* res)
+{
+    return CopyAbilityStr(AbilityQueryType::AUDIO_DECODER, res, MAX_MESSAGES_LEN);
 }
 
 int32_t QueryVideoEncoderAbilityStr(char* res)
 {
-    std::vector<VideoEncoder> viudeoEncoders = QueryVideoEncoderAbility();
-    cJSON *jsonObject = cJSON_CreateObject();
-    if (jsonObject == nullptr) {
-        return 0;
-    }
-    ToJson<VideoEncoder>(VIDEO_ENCODERS, jsonObject, viudeoEncoders);
-    char *jsonStr = cJSON_PrintUnformatted(jsonObject);
-    if (jsonStr == nullptr) {
-        cJSON_Delete(jsonObject);
-        return 0;
-    }
-    std::string ret = std::string(jsonStr);
-    cJSON_free(jsonStr);
-    cJSON_Delete(jsonObject);
-    AVTRANS_LOGI("QueryVideoEncoderAbilityStr ret: %{public}s", ret.c_str());
-    if (ret.length() > MAX_MESSAGES_LEN) {
-        AVTRANS_LOGE("QueryVideoEncoderAbilityStr too long");
-        return 0;
-    }
-    if (memcpy_s(res, MAX_MESSAGES_LEN, ret.c_str(), ret.length()) != EOK) {
-        return 0;
-    }
-    return ret.length();
+    return CopyAbilityStr(AbilityQueryType::VIDEO_ENCODER, res, MAX_MESSAGES_LEN);
 }
 
 int32_t QueryVideoDecoderAbilityStr(char* res)
 {
-    std::vector<VideoDecoder> videoDecoders = QueryVideoDecoderAbility();
-    cJSON *jsonObject = cJSON_CreateObject();
-    if (jsonObject == nullptr) {
-        return 0;
-    }
-    ToJson<VideoDecoder>(VIDEO_DECODERS, jsonObject, videoDecoders);
-    char *jsonStr = cJSON_PrintUnformatted(jsonObject);
-    if (jsonStr == nullptr) {
-        cJSON_Delete(jsonObject);
-        return 0;
-    }
-    std::string ret = std::string(jsonStr);
-    cJSON_free(jsonStr);
-    cJSON_Delete(jsonObject);
-    AVTRANS_LOGI("QueryVideoDecoderAbilityStr ret: %{public}s", ret.c_str());
-    if (ret.length() > MAX_MESSAGES_LEN) {
-        AVTRANS_LOGE("QueryVideoDecoderAbilityStr too long");
-        return 0;
-    }
-    if (memcpy_s(res, MAX_MESSAGES_LEN, ret.c_str(), ret.length()) != EOK) {
-        return 0;
-    }
-    return ret.length();
+    return CopyAbilityStr(AbilityQueryType::VIDEO_DECODER, res, MAX_MESSAGES_LEN);
+}
+
+int32_t QueryAbilityStrLen(int32_t type)
+{
+    return static_cast<int32_t>(QueryAbilityStr(static_cast<AbilityQueryType>(type)).length());
+}
+
+int32_t QueryAbilityStrByType(int32_t type, char* res, uint32_t len)
+{
+    return CopyAbilityStr(static_cast<AbilityQueryType>(type), res, len);
+}
 }
 }
-}
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -610,5 +610,30 @@ HWTEST_F(HistreamerAbilityQuerierTest, histreamer_ability_querier_test_023, Test
     EXPECT_TRUE(videoDecoder.outs.empty());
     cJSON_Delete(jsonObject2);
 }
+
+/**
+ * @tc.name: histreamer_ability_querier_test_024
+ * @tc.desc: Verify the sized query returns the same ability as the fixed buffer one and rejects a short buffer.
+ * @tc.type: FUNC
+ * @tc.require: issuelI7MJPJ
+ */
+HWTEST_F(HistreamerAbilityQuerierTest, histreamer_ability_querier_test_024, TestSize.Level1)
+{
+    int32_t type = static_cast<int32_t>(AbilityQueryType::AUDIO_ENCODER);
+    int32_t size = QueryAbilityStrLen(type);
+    EXPECT_TRUE(size >= 0);
+    EXPECT_EQ(0, QueryAbilityStrByType(type, nullptr, static_cast<uint32_t>(size)));
+    if (size == 0) {
+        return;
+    }
+    std::vector<char> sized(size);
+    EXPECT_EQ(size, QueryAbilityStrByType(type, sized.data(), static_cast<uint32_t>(size)));
+    EXPECT_EQ(0, QueryAbilityStrByType(type, sized.data(), static_cast<uint32_t>(size - 1)));
+
+    char* RES_MAX = new char[g_maxMessagesLen];
+    EXPECT_EQ(size, QueryAudioEncoderAbilityStr(RES_MAX));
+    EXPECT_EQ(0, memcmp(RES_MAX, sized.data(), size));
+    delete[] RES_MAX;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
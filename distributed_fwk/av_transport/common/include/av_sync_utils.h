@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2025 Huawei Device Co., Ltd.
+ * Copyright (C) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,8 @@
 #ifndef OHOS_AV_TRANSPORT_SHARED_MEMORY_H
 #define OHOS_AV_TRANSPORT_SHARED_MEMORY_H
 
+#include <atomic>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -102,6 +104,39 @@ struct AVSyncClockUnit {
     int64_t pts;
 };
 
+constexpr uint32_t AV_SYNC_CLOCK_MAGIC = 0x4B4C4344; // "DCLK"
+constexpr uint32_t AV_SYNC_CLOCK_VERSION = 3;
+
+/* Peer clock offset at refTime and its drift, the offset at t is offset + (t - refTime) * driftPpb / 1e9. */
+struct AVSyncClockDrift {
+    int64_t refTime;
+    int64_t offset;
+    int64_t driftPpb;
+};
+
+/* One ring slot, sequence is odd while the writer updates it (seqlock). */
+struct AVSyncClockSlot {
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> frameNum;
+    std::atomic<int64_t> pts;
+};
+
+/* Layout of the sink clock shared memory, one writer and any number of readers. */
+struct AVSyncClockRegion {
+    uint32_t magic;
+    uint32_t version;
+    std::atomic<uint32_t> writeIndex;
+    std::atomic<uint32_t> sequence;
+    std::atomic<int64_t> sinkDelay;
+    std::atomic<uint32_t> driftSequence;
+    std::atomic<int64_t> driftRefTime;
+    std::atomic<int64_t> driftOffset;
+    std::atomic<int64_t> driftPpb;
+    AVSyncClockSlot slots[MAX_CLOCK_UNIT_COUNT];
+};
+static_assert(std::atomic<int64_t>::is_always_lock_free, "clock slot must be lock free across processes");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "clock sequence is used as a futex word");
+
 /**
  * @brief create shared memory space for av sync.
  * @param name    name for the shared memory.
@@ -115,6 +150,26 @@ AVTransSharedMemory CreateAVTransSharedMemory(const std::string &name, size_t si
  */
 void CloseAVTransSharedMemory(AVTransSharedMemory &memory) noexcept;
 
+/**
+ * @brief map a shared memory received from its creator, size and protection are checked here only once.
+ * @param memory    shared memory with fd, size and name, addr is set on success.
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t MapAVTransSharedMemory(AVTransSharedMemory &memory);
+
+/**
+ * @brief unmap a shared memory mapped by MapAVTransSharedMemory, the fd stays owned by its creator.
+ * @param memory    shared memory.
+ */
+void UnmapAVTransSharedMemory(AVTransSharedMemory &memory) noexcept;
+
+/**
+ * @brief write the clock region header, called by the creator before the memory is shared.
+ * @param memory    shared memory of at least sizeof(AVSyncClockRegion) bytes.
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t InitClockUnitMemory(const AVTransSharedMemory &memory);
+
 /**
  * @brief write the clock unit into the shared memory space.
  * @param memory       shared memory
@@ -131,6 +186,54 @@ int32_t WriteClockUnitToMemory(const AVTransSharedMemory &memory, AVSyncClockUni
  */
 int32_t ReadClockUnitFromMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit);
 
+/**
+ * @brief wait until the writer publishes the first clock unit, the writer wakes the waiters.
+ * @param memory       shared memory
+ * @param timeoutNs    the max wait time in nanoseconds
+ * @return Returns DH_AVT_SUCCESS(0) if the clock is ready, ERR_DH_AVT_MASTER_NOT_READY on timeout.
+ */
+int32_t WaitClockUnitReady(const AVTransSharedMemory &memory, int64_t timeoutNs);
+
+/**
+ * @brief publish how long the sink holds a frame before it plays, readers align their own clock with it.
+ * @param memory     shared memory
+ * @param delayNs    the sink buffering delay in nanoseconds
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t WriteClockDelayToMemory(const AVTransSharedMemory &memory, int64_t delayNs);
+
+/**
+ * @brief read the sink buffering delay published by WriteClockDelayToMemory.
+ * @param memory     shared memory
+ * @param delayNs    the sink buffering delay in nanoseconds
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t ReadClockDelayFromMemory(const AVTransSharedMemory &memory, int64_t &delayNs);
+
+/**
+ * @brief publish the peer clock offset and drift for every output controller of the device pair.
+ * @param memory    shared memory
+ * @param drift     the estimate, refTime is CLOCK_MONOTONIC in nanoseconds
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t WriteClockDriftToMemory(const AVTransSharedMemory &memory, const AVSyncClockDrift &drift);
+
+/**
+ * @brief read the peer clock offset and drift published by WriteClockDriftToMemory.
+ * @param memory    shared memory
+ * @param drift     the estimate
+ * @return Returns DH_AVT_SUCCESS(0) if successful, ERR_DH_AVT_MASTER_NOT_READY if nothing is published yet.
+ */
+int32_t ReadClockDriftFromMemory(const AVTransSharedMemory &memory, AVSyncClockDrift &drift);
+
+/**
+ * @brief evaluate a clock drift estimate at a local time.
+ * @param drift    the estimate
+ * @param now      local CLOCK_MONOTONIC time in nanoseconds
+ * @return the peer clock offset in nanoseconds at now.
+ */
+int64_t GetClockOffsetAt(const AVSyncClockDrift &drift, int64_t now);
+
 /**
  * @brief write frame number and pts into the shared memory space.
  * @param memory       shared memory
@@ -167,6 +270,29 @@ uint64_t U8ToU64(const uint8_t *arrayPtr, size_t arraySize);
 void U32ToU8(uint8_t *arrayPtr, uint32_t value, size_t arraySize);
 void U64ToU8(uint8_t *arrayPtr, uint64_t value, size_t arraySize);
 
+/* Fits offset and drift to the recent time sync results by least squares, not thread safe. */
+class AVSyncDriftEstimator {
+public:
+    void AddSample(int64_t localTime, int64_t offset);
+    bool GetDrift(AVSyncClockDrift &drift) const;
+    void Reset();
+    size_t GetSampleCount() const;
+
+private:
+    bool Fit(AVSyncClockDrift &drift) const;
+
+private:
+    constexpr static size_t MAX_SAMPLE_COUNT = 32;
+    constexpr static size_t MIN_FIT_SAMPLE_COUNT = 4;
+    constexpr static int64_t MIN_FIT_SPAN_NS = 1000000000;
+    constexpr static int64_t OUTLIER_THRESHOLD_NS = 5000000;
+    constexpr static uint32_t MAX_OUTLIER_COUNT = 3;
+    constexpr static int64_t MAX_DRIFT_PPB = 500000;
+
+    std::deque<std::pair<int64_t, int64_t>> samples_;
+    uint32_t outlierCount_ = 0;
+};
+
 class DAudioAccessConfigManager {
 public:
     static DAudioAccessConfigManager& GetInstance();
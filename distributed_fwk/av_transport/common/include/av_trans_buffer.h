@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "av_trans_types.h"
@@ -26,6 +27,8 @@ namespace OHOS {
 namespace DistributedHardware {
 constexpr size_t INVALID_POSITION = -1;
 static constexpr size_t CAPACITY_MAX_LENGTH = 8192;
+static constexpr size_t META_FIXED_ITEM_COUNT = 4;
+static constexpr size_t META_EXTRA_ITEM_CAPACITY = 8;
 
 enum struct MetaType : uint32_t {
     AUDIO,
@@ -57,6 +60,8 @@ private:
 
 /**
  * @brief BufferMeta for buffer. Base class that describes various metadata.
+ * Numeric items of the frame number, data type and timestamp tags are kept in fixed fields and other numeric
+ * items in a small inline table, so the per-frame items are neither stringified nor allocated.
  */
 class BufferMeta {
 public:
@@ -66,9 +71,20 @@ public:
     MetaType GetMetaType() const;
     bool GetMetaItem(AVTransTag tag, std::string &value);
     void SetMetaItem(AVTransTag tag, const std::string &value);
+    bool GetMetaItem(AVTransTag tag, int64_t &value) const;
+    void SetMetaItem(AVTransTag tag, int64_t value);
+
+private:
+    static int32_t GetFixedIndex(AVTransTag tag);
+    bool GetNumericItem(AVTransTag tag, int64_t &value) const;
+    void EraseNumericItem(AVTransTag tag);
 
 private:
     MetaType type_;
+    uint32_t fixedMask_ = 0;
+    int64_t fixedItems_[META_FIXED_ITEM_COUNT] = { 0 };
+    size_t extraCount_ = 0;
+    std::pair<AVTransTag, int64_t> extraItems_[META_EXTRA_ITEM_CAPACITY];
     std::map<AVTransTag, std::string> tagMap_;
 };
 
@@ -41,6 +41,9 @@ const uint32_t DSOFTBUS_INPUT_MAX_RECV_DATA_LEN = 104857600;
 const uint32_t DEFAULT_FRAME_NUMBER = 100;
 const uint32_t AUDIO_CHANNEL_LAYOUT_MONO = 1;
 const uint32_t AUDIO_CHANNEL_LAYOUT_STEREO = 2;
+const uint32_t AVT_STREAM_EXT_MAGIC = 0x5854A5A5;
+const uint16_t AVT_STREAM_EXT_VERSION = 1;
+const uint16_t AVT_STREAM_EXT_HEADER_LEN = 32;
 
 const int64_t DEFAULT_PTS = 100;
 
@@ -61,6 +64,7 @@ const std::string VDECODER_NAME = "builtin.player.videodecoder";
 
 const std::string AVT_DATA_META_TYPE = "avtrans_data_meta_type";
 const std::string AVT_DATA_PARAM = "avtrans_data_param";
+const std::string AVT_DATA_EXT_VERSION = "avtrans_data_ext_version";
 const std::string AV_TRANS_SPECIAL_DEVICE_ID = "av.trans.special.device.id";
 
 const std::string KEY_MY_DEV_ID = "myDevId";
@@ -76,6 +80,8 @@ const std::string KEY_SHARED_MEM_SIZE = "sharedMemorySize";
 const std::string KEY_SHARED_MEM_NAME = "sharedMemoryName";
 const std::string KEY_ONWER_NAME = "ownerName";
 const std::string KEY_PEERDEVID_NAME = "peerDevId";
+const std::string KEY_FIRST_FRAME_COST = "firstFrameCostMs";
+const std::string KEY_PREWARMED = "prewarmed";
 
 const std::string SCREEN_FILE_NAME_BEFOREENCODING = "/data/data/dscreen/BeforeEncoding.h265";
 const std::string SCREEN_FILE_NAME_AFTERCODING = "/data/data/dscreen/AfterCoding.h265";
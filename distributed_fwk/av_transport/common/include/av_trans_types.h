@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -128,6 +128,8 @@ enum struct AVTransTag : uint32_t {
     AUDIO_CONTENT_TYPE,
     AUDIO_CHANNEL_LAYOUT,
     AUDIO_BIT_RATE,
+    // "<loss percent>,<rtt ms>" as measured by the receiver, adapts a running opus encoder.
+    AUDIO_LINK_QUALITY,
 
     /* -------------------- d_video tag -------------------- */
     VIDEO_WIDTH = SECTION_D_VIDEO_START + 1,
@@ -136,8 +138,61 @@ enum struct AVTransTag : uint32_t {
     VIDEO_PIXEL_FORMAT,
     VIDEO_FRAME_RATE,
     VIDEO_BIT_RATE,
+    VIDEO_DAMAGE_REGION,
+    VIDEO_REPEAT_FRAME,
+    VIDEO_DISPLAY_VSYNC,
 };
 
+enum struct EngineConfigItem : uint32_t {
+    VIDEO_WIDTH = 1U << 0,
+    VIDEO_HEIGHT = 1U << 1,
+    VIDEO_FRAME_RATE = 1U << 2,
+    VIDEO_BIT_RATE = 1U << 3,
+    VIDEO_CODEC_TYPE = 1U << 4,
+    AUDIO_BIT_RATE = 1U << 5,
+    AUDIO_CODEC_TYPE = 1U << 6,
+    AUDIO_CHANNEL_MASK = 1U << 7,
+    AUDIO_SAMPLE_RATE = 1U << 8,
+    AUDIO_CHANNEL_LAYOUT = 1U << 9,
+    AUDIO_SAMPLE_FORMAT = 1U << 10,
+    AUDIO_FRAME_SIZE = 1U << 11,
+};
+
+/*
+ * Engine configuration set in one SetEngineConfig call instead of a SetParameter call per tag. Only the items
+ * added to itemMask are applied, the others keep their current value.
+ */
+struct AVTransEngineConfig {
+    uint32_t itemMask = 0;
+    int32_t videoWidth = 0;
+    int32_t videoHeight = 0;
+    int32_t videoFrameRate = 0;
+    int32_t videoBitRate = 0;
+    std::string videoCodecType;
+    int32_t audioBitRate = 0;
+    std::string audioCodecType;
+    int32_t audioChannels = 0;
+    int32_t audioSampleRate = 0;
+    int32_t audioChannelLayout = 0;
+    int32_t audioSampleFormat = 0;
+    int32_t audioFrameSize = 0;
+
+    void AddItem(EngineConfigItem item)
+    {
+        itemMask |= static_cast<uint32_t>(item);
+    }
+
+    bool HasItem(EngineConfigItem item) const
+    {
+        return (itemMask & static_cast<uint32_t>(item)) != 0;
+    }
+};
+
+// The items a started pipeline takes without being prepared again.
+constexpr uint32_t ENGINE_CONFIG_LIVE_ITEMS = static_cast<uint32_t>(EngineConfigItem::VIDEO_WIDTH) |
+    static_cast<uint32_t>(EngineConfigItem::VIDEO_HEIGHT) | static_cast<uint32_t>(EngineConfigItem::VIDEO_FRAME_RATE) |
+    static_cast<uint32_t>(EngineConfigItem::VIDEO_BIT_RATE) | static_cast<uint32_t>(EngineConfigItem::AUDIO_BIT_RATE);
+
 enum struct EventType : uint32_t {
     EVENT_CHANNEL_OPENED = 0,
     EVENT_CHANNEL_OPEN_FAIL = 1,
@@ -152,6 +207,7 @@ enum struct EventType : uint32_t {
     EVENT_TIME_SYNC_RESULT = 10,
     EVENT_ADD_STREAM = 11,
     EVENT_REMOVE_STREAM = 12,
+    EVENT_FIRST_FRAME = 13,
 };
 
 struct AVTransEvent {
@@ -206,6 +262,18 @@ struct AVStreamInfo {
     std::string sceneType;
     std::string peerDevId;
 };
+
+/**
+ * @brief Fixed binary ext header sent with every stream frame once the peer advertised it at channel open.
+ * Laid out little-endian: magic, version, header length, data type, frame number, pts and ptsSpecial.
+ */
+struct AVTransStreamExtHeader {
+    uint16_t version = 0;
+    BufferDataType dataType = BufferDataType::AUDIO;
+    uint32_t frameNumber = 0;
+    int64_t pts = 0;
+    int64_t ptsSpecial = 0;
+};
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif // OHOS_AV_TRANSPORT_TYPES_H
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -58,8 +58,16 @@ bool IsInt64(const cJSON *jsonObj, const std::string &key);
 bool IsString(const cJSON *jsonObj, const std::string &key);
 
 bool ConvertToInt(const std::string& str, int& value);
+int32_t CheckEngineConfig(const AVTransEngineConfig &config, bool isStarted);
+// Region is "x,y,w,h" rects joined by ';', an empty region means nothing changed. Returns -1 if malformed.
+int64_t GetDamageRegionArea(const std::string &region);
+
+bool IsStreamExtHeader(const uint8_t *buf, size_t len);
+bool MarshalStreamExtHeader(const AVTransStreamExtHeader &header, uint8_t *buf, size_t len);
+bool UnmarshalStreamExtHeader(const uint8_t *buf, size_t len, AVTransStreamExtHeader &header);
 
 int64_t GetCurrentTime();
+std::string BuildFirstFrameContent(const std::string &ownerName, int64_t costMs, bool isPrewarmed);
 
 void GenerateAdtsHeader(unsigned char* adtsHeader, uint32_t packetLen, uint32_t profile, uint32_t sampleRate,
     uint32_t channels);
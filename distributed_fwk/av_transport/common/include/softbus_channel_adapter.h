@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,9 +16,13 @@
 #ifndef OHOS_SOFTBUS_CHANNEL_ADAPTER
 #define OHOS_SOFTBUS_CHANNEL_ADAPTER
 
+#include <condition_variable>
 #include <map>
 #include <mutex>
 #include <set>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "transport/socket.h"
 #include "transport/trans_type.h"
@@ -36,6 +40,14 @@ public:
     virtual void OnStreamReceived(const StreamData *data, const StreamData *ext) = 0;
 };
 
+/* Lower value sends first, a send waits shortly for in-flight sends of the classes above it. */
+enum class SessionPriority : uint8_t {
+    CONTROL = 0,
+    AUDIO = 1,
+    VIDEO = 2,
+    COUNT = 3,
+};
+
 class SoftbusChannelAdapter {
 public:
     static SoftbusChannelAdapter& GetInstance();
@@ -49,6 +61,8 @@ public:
     int32_t SendBytesData(const std::string &sessName, const std::string &peerDevId, const std::string &data);
     int32_t SendStreamData(const std::string &sessName, const std::string &peerDevId, const StreamData *data,
         const StreamData *ext);
+    int32_t SendStreamData(const std::string &sessName, const std::string &peerDevId, const uint8_t *data,
+        size_t dataLen, const std::string &ext);
 
     int32_t RegisterChannelListener(const std::string &sessName, const std::string &peerDevId,
         ISoftbusChannelListener *listener);
@@ -69,6 +83,7 @@ public:
     void OnSoftbusStreamReceived(int32_t sessionId, const StreamData *data, const StreamData *ext,
         const StreamFrameInfo *frameInfo);
     void ProcessAuthorizationResult(const std::string &requestId, bool granted);
+    static SessionPriority GetSessionPriority(const std::string &sessName);
 
 private:
     SoftbusChannelAdapter(const SoftbusChannelAdapter&) = delete;
@@ -85,6 +100,11 @@ private:
     std::string TransName2PkgName(const std::string &ownerName);
     std::string FindSessNameByPeerSessName(const std::string peerSessionName);
     void SendEventChannelOPened(const std::string &mySessName, const std::string &peerDevId);
+    void BindSessionKey(const std::string &idMapKey, int32_t sessionId);
+    void UnbindSessionKey(const std::string &idMapKey);
+    std::vector<std::string> GetSessionKeysById(int32_t sessionId);
+    void BeginPrioritySend(SessionPriority priority);
+    void EndPrioritySend(SessionPriority priority);
 
     int32_t RequestAndWaitForAuthorization(const std::string &peerDevId);
     void HandleAuthorizationTimeout(const std::string &requestId);
@@ -94,15 +114,19 @@ private:
 
 private:
     std::mutex timeSyncMtx_;
-    std::mutex idMapMutex_;
-    std::mutex listenerMtx_;
+    std::shared_mutex idMapMutex_;
+    std::shared_mutex listenerMtx_;
     std::mutex serverMapMtx_;
     std::mutex authRequestMutex_;
+    std::mutex sendGateMtx_;
+    std::condition_variable sendGateCon_;
+    uint32_t pendingSends_[static_cast<size_t>(SessionPriority::COUNT)] = { 0 };
 
     ISocketListener sessListener_;
     std::map<std::string, int32_t> serverMap_;
     std::set<std::string> timeSyncSessNames_;
     std::map<std::string, int32_t> devId2SessIdMap_;
+    std::unordered_map<int32_t, std::vector<std::string>> sessId2KeysMap_;
     std::map<std::string, ISoftbusChannelListener *> listenerMap_;
 
     std::map<std::string, std::string> pendingAuthRequests_;  // requestId -> peerDevId
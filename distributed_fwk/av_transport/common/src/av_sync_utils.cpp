@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2025 Huawei Device Co., Ltd.
+ * Copyright (C) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,7 +15,12 @@
 
 #include "av_sync_utils.h"
 
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <linux/futex.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
 #include <securec.h>
 #include <unistd.h>
 #include "ashmem.h"
@@ -28,6 +33,28 @@
 namespace OHOS {
 namespace DistributedHardware {
 constexpr uint64_t NEW_TAG = 0xD004100;
+constexpr uint32_t MAX_CLOCK_READ_RETRY = 4;
+constexpr int64_t NS_PER_SECOND = 1000000000;
+
+namespace {
+AVSyncClockRegion *GetClockRegion(const AVTransSharedMemory &memory)
+{
+    if (IsInValidSharedMemory(memory) || (static_cast<size_t>(memory.size) < sizeof(AVSyncClockRegion))) {
+        return nullptr;
+    }
+    auto region = reinterpret_cast<AVSyncClockRegion*>(memory.addr);
+    if ((region->magic != AV_SYNC_CLOCK_MAGIC) || (region->version != AV_SYNC_CLOCK_VERSION)) {
+        return nullptr;
+    }
+    return region;
+}
+
+void WakeClockUnitWaiters(AVSyncClockRegion *region)
+{
+    (void)syscall(SYS_futex, reinterpret_cast<uint32_t*>(&region->sequence), FUTEX_WAKE, INT_MAX, nullptr,
+        nullptr, 0);
+}
+}
 
 AVTransSharedMemory CreateAVTransSharedMemory(const std::string &name, size_t size)
 {
@@ -84,84 +111,188 @@ void CloseAVTransSharedMemory(AVTransSharedMemory &memory) noexcept
     }
 }
 
-int32_t WriteClockUnitToMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit)
+int32_t MapAVTransSharedMemory(AVTransSharedMemory &memory)
 {
-    AVTRANS_LOGI("write clock unit to shared memory, name=%{public}s, size=%{public}" PRId32 ", fd=%{public}" PRId32,
-        memory.name.c_str(), memory.size, memory.fd);
-    TRUE_RETURN_V_MSG_E(IsInValidSharedMemory(memory), ERR_DH_AVT_INVALID_PARAM, "invalid input shared memory");
-
-    int mSize = 12;
-    TRUE_RETURN_V_MSG_E(memory.size < mSize, ERR_DH_AVT_INVALID_PARAM,
-        "Memory.size is too small, future access may exceed the limit");
-    AVTRANS_LOGI("clock unit index=%{public}" PRId32 ", frameNum=%{public}" PRId32 ", pts=%{public}lld",
-        clockUnit.index, clockUnit.frameNum, (long long)clockUnit.pts);
-    TRUE_RETURN_V_MSG_E(IsInValidClockUnit(clockUnit), ERR_DH_AVT_INVALID_PARAM, "invalid input clock unit");
-
+    TRUE_RETURN_V_MSG_E((memory.fd <= 0) || (memory.size <= 0) || memory.name.empty(), ERR_DH_AVT_INVALID_PARAM,
+        "invalid input shared memory");
     int size = AshmemGetSize(memory.fd);
     TRUE_RETURN_V_MSG_E(size != memory.size, ERR_DH_AVT_SHARED_MEMORY_FAILED, "invalid memory size = %{public}" PRId32,
         size);
 
-    unsigned int prot = PROT_WRITE;
+    unsigned int prot = PROT_READ | PROT_WRITE;
     int result = AshmemSetProt(memory.fd, static_cast<int>(prot));
     TRUE_RETURN_V_MSG_E(result < 0, ERR_DH_AVT_SHARED_MEMORY_FAILED, "AshmemSetProt failed");
 
-    uint8_t *base = reinterpret_cast<uint8_t*>(memory.addr);
-    size_t fOffset = (sizeof(uint32_t) + sizeof(int64_t)) * clockUnit.index;
-    size_t tOffset = fOffset + sizeof(uint32_t);
-    U64ToU8(base + tOffset, clockUnit.pts, NUM_EIGHT);
-    U32ToU8(base + fOffset, clockUnit.frameNum, NUM_FOUR);
+    void *addr = ::mmap(nullptr, memory.size, static_cast<int>(prot), MAP_SHARED, memory.fd, 0);
+    TRUE_RETURN_V_MSG_E(addr == MAP_FAILED, ERR_DH_AVT_SHARED_MEMORY_FAILED,
+        "shared memory mmap failed, name=%{public}s", memory.name.c_str());
+    memory.addr = addr;
+    AVTRANS_LOGI("map shared memory success, name=%{public}s, size=%{public}" PRId32, memory.name.c_str(),
+        memory.size);
+    return DH_AVT_SUCCESS;
+}
 
-    clockUnit.index ++;
-    if (clockUnit.index == MAX_CLOCK_UNIT_COUNT) {
-        clockUnit.index = 0;
+void UnmapAVTransSharedMemory(AVTransSharedMemory &memory) noexcept
+{
+    if ((memory.addr == nullptr) || (memory.size <= 0)) {
+        memory.addr = nullptr;
+        return;
     }
-    AVTRANS_LOGI("write clock unit frameNum=%{public}" PRId32 ", pts=%{public}lld to shared memory success",
-        clockUnit.frameNum, (long long)(clockUnit.pts));
-    return DH_AVT_SUCCESS;
+    (void)::munmap(memory.addr, memory.size);
+    memory.addr = nullptr;
 }
 
-int32_t ReadClockUnitFromMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit)
+int32_t InitClockUnitMemory(const AVTransSharedMemory &memory)
 {
-    AVTRANS_LOGI("read clock unit from shared memory, name=%{public}s, size=%{public}" PRId32 ", fd=%{public}" PRId32,
-        memory.name.c_str(), memory.size, memory.fd);
     TRUE_RETURN_V_MSG_E(IsInValidSharedMemory(memory), ERR_DH_AVT_INVALID_PARAM, "invalid input shared memory");
+    TRUE_RETURN_V_MSG_E(static_cast<size_t>(memory.size) < sizeof(AVSyncClockRegion), ERR_DH_AVT_INVALID_PARAM,
+        "memory size=%{public}" PRId32 " is too small for the clock region", memory.size);
+    auto region = reinterpret_cast<AVSyncClockRegion*>(memory.addr);
+    region->writeIndex.store(0, std::memory_order_relaxed);
+    region->sequence.store(0, std::memory_order_relaxed);
+    region->sinkDelay.store(0, std::memory_order_relaxed);
+    region->driftSequence.store(0, std::memory_order_relaxed);
+    for (auto &slot : region->slots) {
+        slot.sequence.store(0, std::memory_order_relaxed);
+    }
+    region->version = AV_SYNC_CLOCK_VERSION;
+    std::atomic_thread_fence(std::memory_order_release);
+    region->magic = AV_SYNC_CLOCK_MAGIC;
+    return DH_AVT_SUCCESS;
+}
 
-    int mSize = 12;
-    TRUE_RETURN_V_MSG_E(memory.size < mSize, ERR_DH_AVT_INVALID_PARAM,
-        "Memory.size is too small, future access may exceed the limit");
-    AVTRANS_LOGI("clock unit index=%{public}" PRId32 ", frameNum=%{public}" PRId32,
-        clockUnit.index, clockUnit.frameNum);
-    TRUE_RETURN_V_MSG_E((clockUnit.frameNum <= 0), ERR_DH_AVT_INVALID_PARAM, "invalid input frame number");
+int32_t WriteClockUnitToMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit)
+{
+    AVSyncClockRegion *region = GetClockRegion(memory);
+    TRUE_RETURN_V_MSG_E(region == nullptr, ERR_DH_AVT_INVALID_PARAM, "invalid clock shared memory");
+    TRUE_RETURN_V_MSG_E(IsInValidClockUnit(clockUnit), ERR_DH_AVT_INVALID_PARAM, "invalid input clock unit");
 
-    int size = AshmemGetSize(memory.fd);
-    TRUE_RETURN_V_MSG_E(size != memory.size, ERR_DH_AVT_SHARED_MEMORY_FAILED, "invalid memory size = %{public}" PRId32,
-        size);
+    AVSyncClockSlot &slot = region->slots[clockUnit.index];
+    uint32_t sequence = slot.sequence.load(std::memory_order_relaxed) | 1;
+    slot.sequence.store(sequence, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.frameNum.store(clockUnit.frameNum, std::memory_order_relaxed);
+    slot.pts.store(clockUnit.pts, std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_release);
+    region->writeIndex.store(clockUnit.index, std::memory_order_release);
+    if (region->sequence.fetch_add(1, std::memory_order_release) == 0) {
+        WakeClockUnitWaiters(region);
+    }
 
-    unsigned int prot = PROT_WRITE;
-    int result = AshmemSetProt(memory.fd, static_cast<int>(prot));
-    TRUE_RETURN_V_MSG_E(result < 0, ERR_DH_AVT_SHARED_MEMORY_FAILED, "AshmemSetProt failed");
-    uint8_t *base = reinterpret_cast<uint8_t*>(memory.addr);
-    uint32_t firstUnit = U8ToU32(base, NUM_FOUR);
-    TRUE_RETURN_V_MSG_E(firstUnit == 0, ERR_DH_AVT_MASTER_NOT_READY, "master queue not ready, clock is null.");
-
-    uint32_t index = 0;
-    int64_t latestPts = 0;
-    size_t unitSize = sizeof(uint32_t) + sizeof(int64_t);
-    while (index < MAX_CLOCK_UNIT_COUNT) {
-        uint32_t frameNum = U8ToU32(base + (index * unitSize), NUM_FOUR);
-        int64_t pts = static_cast<int64_t>(U8ToU64(base + (index * unitSize) + sizeof(uint32_t), NUM_EIGHT));
-        if (pts > latestPts) {
-            latestPts = pts;
-            clockUnit.pts = pts;
+    clockUnit.index = (clockUnit.index + 1) % MAX_CLOCK_UNIT_COUNT;
+    AVTRANS_LOGD("write clock unit frameNum=%{public}" PRIu32 ", pts=%{public}lld to shared memory success",
+        clockUnit.frameNum, (long long)(clockUnit.pts));
+    return DH_AVT_SUCCESS;
+}
+
+int32_t ReadClockUnitFromMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit)
+{
+    AVSyncClockRegion *region = GetClockRegion(memory);
+    TRUE_RETURN_V_MSG_E(region == nullptr, ERR_DH_AVT_INVALID_PARAM, "invalid clock shared memory");
+    TRUE_RETURN_V_MSG_E((clockUnit.frameNum <= 0), ERR_DH_AVT_INVALID_PARAM, "invalid input frame number");
+    TRUE_RETURN_V_MSG_D(region->sequence.load(std::memory_order_acquire) == 0, ERR_DH_AVT_MASTER_NOT_READY,
+        "master queue not ready, clock is null.");
+
+    for (uint32_t retry = 0; retry < MAX_CLOCK_READ_RETRY; retry++) {
+        uint32_t index = region->writeIndex.load(std::memory_order_acquire);
+        TRUE_RETURN_V_MSG_E(index >= MAX_CLOCK_UNIT_COUNT, ERR_DH_AVT_SHARED_MEMORY_FAILED,
+            "invalid clock write index=%{public}" PRIu32, index);
+        AVSyncClockSlot &slot = region->slots[index];
+        uint32_t begin = slot.sequence.load(std::memory_order_acquire);
+        if ((begin & 1) != 0) {
+            continue;
+        }
+        uint32_t frameNum = slot.frameNum.load(std::memory_order_relaxed);
+        int64_t pts = slot.pts.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == begin) {
+            clockUnit.index = index;
             clockUnit.frameNum = frameNum;
+            clockUnit.pts = pts;
+            return DH_AVT_SUCCESS;
         }
-        index++;
     }
-    AVTRANS_LOGI("read clock unit from shared memory success, frameNum=%{public}" PRId32 ", pts=%{public}lld",
-        clockUnit.frameNum, (long long)clockUnit.pts);
+    AVTRANS_LOGD("clock unit is being rewritten, read it next time.");
+    return ERR_DH_AVT_MASTER_NOT_READY;
+}
+
+int32_t WaitClockUnitReady(const AVTransSharedMemory &memory, int64_t timeoutNs)
+{
+    AVSyncClockRegion *region = GetClockRegion(memory);
+    TRUE_RETURN_V_MSG_E(region == nullptr, ERR_DH_AVT_INVALID_PARAM, "invalid clock shared memory");
+    if ((region->sequence.load(std::memory_order_acquire) == 0) && (timeoutNs > 0)) {
+        struct timespec timeout = { static_cast<time_t>(timeoutNs / NS_PER_SECOND),
+            static_cast<long>(timeoutNs % NS_PER_SECOND) };
+        (void)syscall(SYS_futex, reinterpret_cast<uint32_t*>(&region->sequence), FUTEX_WAIT, 0, &timeout,
+            nullptr, 0);
+    }
+    TRUE_RETURN_V_MSG_D(region->sequence.load(std::memory_order_acquire) == 0, ERR_DH_AVT_MASTER_NOT_READY,
+        "wait master clock timeout.");
+    return DH_AVT_SUCCESS;
+}
+
+int32_t WriteClockDelayToMemory(const AVTransSharedMemory &memory, int64_t delayNs)
+{
+    AVSyncClockRegion *region = GetClockRegion(memory);
+    TRUE_RETURN_V_MSG_E(region == nullptr, ERR_DH_AVT_INVALID_PARAM, "invalid clock shared memory");
+    TRUE_RETURN_V_MSG_E(delayNs < 0, ERR_DH_AVT_INVALID_PARAM, "invalid sink delay");
+    region->sinkDelay.store(delayNs, std::memory_order_relaxed);
+    return DH_AVT_SUCCESS;
+}
+
+int32_t ReadClockDelayFromMemory(const AVTransSharedMemory &memory, int64_t &delayNs)
+{
+    AVSyncClockRegion *region = GetClockRegion(memory);
+    TRUE_RETURN_V_MSG_E(region == nullptr, ERR_DH_AVT_INVALID_PARAM, "invalid clock shared memory");
+    delayNs = region->sinkDelay.load(std::memory_order_relaxed);
     return DH_AVT_SUCCESS;
 }
 
+int32_t WriteClockDriftToMemory(const AVTransSharedMemory &memory, const AVSyncClockDrift &drift)
+{
+    AVSyncClockRegion *region = GetClockRegion(memory);
+    TRUE_RETURN_V_MSG_E(region == nullptr, ERR_DH_AVT_INVALID_PARAM, "invalid clock shared memory");
+
+    uint32_t sequence = region->driftSequence.load(std::memory_order_relaxed) | 1;
+    region->driftSequence.store(sequence, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    region->driftRefTime.store(drift.refTime, std::memory_order_relaxed);
+    region->driftOffset.store(drift.offset, std::memory_order_relaxed);
+    region->driftPpb.store(drift.driftPpb, std::memory_order_relaxed);
+    region->driftSequence.store(sequence + 1, std::memory_order_release);
+    AVTRANS_LOGD("write clock drift offset=%{public}" PRId64 ", drift=%{public}" PRId64 "ppb to shared memory",
+        drift.offset, drift.driftPpb);
+    return DH_AVT_SUCCESS;
+}
+
+int32_t ReadClockDriftFromMemory(const AVTransSharedMemory &memory, AVSyncClockDrift &drift)
+{
+    AVSyncClockRegion *region = GetClockRegion(memory);
+    TRUE_RETURN_V_MSG_D(region == nullptr, ERR_DH_AVT_INVALID_PARAM, "invalid clock shared memory");
+
+    for (uint32_t retry = 0; retry < MAX_CLOCK_READ_RETRY; retry++) {
+        uint32_t begin = region->driftSequence.load(std::memory_order_acquire);
+        TRUE_RETURN_V_MSG_D(begin == 0, ERR_DH_AVT_MASTER_NOT_READY, "clock drift is not estimated yet.");
+        if ((begin & 1) != 0) {
+            continue;
+        }
+        AVSyncClockDrift value = { region->driftRefTime.load(std::memory_order_relaxed),
+            region->driftOffset.load(std::memory_order_relaxed), region->driftPpb.load(std::memory_order_relaxed) };
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (region->driftSequence.load(std::memory_order_relaxed) == begin) {
+            drift = value;
+            return DH_AVT_SUCCESS;
+        }
+    }
+    return ERR_DH_AVT_MASTER_NOT_READY;
+}
+
+int64_t GetClockOffsetAt(const AVSyncClockDrift &drift, int64_t now)
+{
+    double elapse = static_cast<double>(now - drift.refTime);
+    return drift.offset + std::llround(elapse * static_cast<double>(drift.driftPpb) / NS_PER_SECOND);
+}
+
 int32_t WriteFrameInfoToMemory(const AVTransSharedMemory &memory, uint32_t frameNum, int64_t timestamp)
 {
     AVTRANS_LOGI("write frame info to shared memory, name=%{public}s, size=%{public}" PRId32 ", fd=%{public}" PRId32,
@@ -340,6 +471,78 @@ uint64_t U8ToU64(const uint8_t *arrayPtr, size_t arraySize)
     return result;
 }
 
+void AVSyncDriftEstimator::AddSample(int64_t localTime, int64_t offset)
+{
+    if (!samples_.empty() && (localTime <= samples_.back().first)) {
+        return;
+    }
+    AVSyncClockDrift drift;
+    if ((samples_.size() >= MIN_FIT_SAMPLE_COUNT) && Fit(drift) &&
+        (std::llabs(offset - GetClockOffsetAt(drift, localTime)) > OUTLIER_THRESHOLD_NS)) {
+        if (++outlierCount_ <= MAX_OUTLIER_COUNT) {
+            AVTRANS_LOGD("drop outlier clock offset=%{public}" PRId64, offset);
+            return;
+        }
+        // The offset stepped and stays there, the peer clock was set, so the old samples no longer apply.
+        AVTRANS_LOGI("clock offset stepped to %{public}" PRId64 ", restart drift estimation.", offset);
+        samples_.clear();
+    }
+    outlierCount_ = 0;
+    samples_.emplace_back(localTime, offset);
+    if (samples_.size() > MAX_SAMPLE_COUNT) {
+        samples_.pop_front();
+    }
+}
+
+bool AVSyncDriftEstimator::GetDrift(AVSyncClockDrift &drift) const
+{
+    return Fit(drift);
+}
+
+void AVSyncDriftEstimator::Reset()
+{
+    samples_.clear();
+    outlierCount_ = 0;
+}
+
+size_t AVSyncDriftEstimator::GetSampleCount() const
+{
+    return samples_.size();
+}
+
+bool AVSyncDriftEstimator::Fit(AVSyncClockDrift &drift) const
+{
+    if (samples_.empty()) {
+        return false;
+    }
+    int64_t refTime = samples_.back().first;
+    double count = static_cast<double>(samples_.size());
+    double meanX = 0;
+    double meanY = 0;
+    for (const auto &sample : samples_) {
+        meanX += static_cast<double>(sample.first - refTime) / NS_PER_SECOND;
+        meanY += static_cast<double>(sample.second);
+    }
+    meanX /= count;
+    meanY /= count;
+    drift = { refTime, std::llround(meanY), 0 };
+    if ((samples_.size() < MIN_FIT_SAMPLE_COUNT) || (refTime - samples_.front().first < MIN_FIT_SPAN_NS)) {
+        return true;
+    }
+    double sxx = 0;
+    double sxy = 0;
+    for (const auto &sample : samples_) {
+        double dx = static_cast<double>(sample.first - refTime) / NS_PER_SECOND - meanX;
+        sxx += dx * dx;
+        sxy += dx * (static_cast<double>(sample.second) - meanY);
+    }
+    // Offset in nanoseconds over local time in seconds, the slope is the drift in ppb.
+    double slope = std::clamp(sxy / sxx, static_cast<double>(-MAX_DRIFT_PPB), static_cast<double>(MAX_DRIFT_PPB));
+    drift.offset = std::llround(meanY - slope * meanX);
+    drift.driftPpb = std::llround(slope);
+    return true;
+}
+
 DAudioAccessConfigManager& DAudioAccessConfigManager::GetInstance()
 {
     static auto instance = new DAudioAccessConfigManager();
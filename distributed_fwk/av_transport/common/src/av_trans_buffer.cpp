@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include "av_trans_buffer.h"
 
+#include <charconv>
 #include <securec.h>
 
 #include "av_trans_log.h"
@@ -188,19 +189,118 @@ BufferMeta::BufferMeta(MetaType type) : type_(type)
 
 bool BufferMeta::GetMetaItem(AVTransTag tag, std::string& value)
 {
-    if (tagMap_.count(tag) != 0) {
-        value = tagMap_[tag];
+    auto iter = tagMap_.find(tag);
+    if (iter != tagMap_.end()) {
+        value = iter->second;
         return true;
-    } else {
-        return false;
     }
+    int64_t number = 0;
+    if (GetNumericItem(tag, number)) {
+        value = std::to_string(number);
+        return true;
+    }
+    return false;
 }
 
 void BufferMeta::SetMetaItem(AVTransTag tag, const std::string& value)
 {
+    EraseNumericItem(tag);
     tagMap_[tag] = value;
 }
 
+bool BufferMeta::GetMetaItem(AVTransTag tag, int64_t& value) const
+{
+    if (GetNumericItem(tag, value)) {
+        return true;
+    }
+    auto iter = tagMap_.find(tag);
+    if (iter == tagMap_.end()) {
+        return false;
+    }
+    const std::string &str = iter->second;
+    int64_t number = 0;
+    auto res = std::from_chars(str.data(), str.data() + str.size(), number);
+    if (res.ec != std::errc()) {
+        return false;
+    }
+    value = number;
+    return true;
+}
+
+void BufferMeta::SetMetaItem(AVTransTag tag, int64_t value)
+{
+    if (!tagMap_.empty()) {
+        tagMap_.erase(tag);
+    }
+    int32_t index = GetFixedIndex(tag);
+    if (index >= 0) {
+        fixedItems_[index] = value;
+        fixedMask_ |= (1U << static_cast<uint32_t>(index));
+        return;
+    }
+    for (size_t i = 0; i < extraCount_; i++) {
+        if (extraItems_[i].first == tag) {
+            extraItems_[i].second = value;
+            return;
+        }
+    }
+    if (extraCount_ < META_EXTRA_ITEM_CAPACITY) {
+        extraItems_[extraCount_++] = std::make_pair(tag, value);
+        return;
+    }
+    tagMap_[tag] = std::to_string(value);
+}
+
+int32_t BufferMeta::GetFixedIndex(AVTransTag tag)
+{
+    switch (tag) {
+        case AVTransTag::FRAME_NUMBER:
+            return 0;
+        case AVTransTag::BUFFER_DATA_TYPE:
+            return 1;
+        case AVTransTag::PRE_TIMESTAMP:
+            return 2;
+        case AVTransTag::CUR_TIMESTAMP:
+            return 3;
+        default:
+            return -1;
+    }
+}
+
+bool BufferMeta::GetNumericItem(AVTransTag tag, int64_t& value) const
+{
+    int32_t index = GetFixedIndex(tag);
+    if (index >= 0) {
+        if ((fixedMask_ & (1U << static_cast<uint32_t>(index))) == 0) {
+            return false;
+        }
+        value = fixedItems_[index];
+        return true;
+    }
+    for (size_t i = 0; i < extraCount_; i++) {
+        if (extraItems_[i].first == tag) {
+            value = extraItems_[i].second;
+            return true;
+        }
+    }
+    return false;
+}
+
+void BufferMeta::EraseNumericItem(AVTransTag tag)
+{
+    int32_t index = GetFixedIndex(tag);
+    if (index >= 0) {
+        fixedMask_ &= ~(1U << static_cast<uint32_t>(index));
+        return;
+    }
+    for (size_t i = 0; i < extraCount_; i++) {
+        if (extraItems_[i].first == tag) {
+            extraItems_[i] = extraItems_[--extraCount_];
+            return;
+        }
+    }
+}
+
 MetaType BufferMeta::GetMetaType() const
 {
     return type_;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -20,6 +20,7 @@
 #include <securec.h>
 
 #include "av_trans_constants.h"
+#include "av_trans_errno.h"
 #include "av_trans_log.h"
 #include "av_trans_meta.h"
 
@@ -33,6 +34,35 @@ using TransBufferMeta = OHOS::DistributedHardware::BufferMeta;
 const std::string KEY_OWNER_NAME = "ownerName";
 const std::string KEY_PEER_DEVID = "peerDevId";
 
+namespace {
+constexpr size_t EXT_OFFSET_VERSION = 4;
+constexpr size_t EXT_OFFSET_HEADER_LEN = 6;
+constexpr size_t EXT_OFFSET_DATA_TYPE = 8;
+constexpr size_t EXT_OFFSET_FRAME_NUMBER = 12;
+constexpr size_t EXT_OFFSET_PTS = 16;
+constexpr size_t EXT_OFFSET_PTS_SPECIAL = 24;
+constexpr uint32_t BITS_PER_BYTE = 8;
+
+template<typename T>
+void WriteLittleEndian(uint8_t *buf, T value)
+{
+    auto raw = static_cast<uint64_t>(value);
+    for (size_t i = 0; i < sizeof(T); i++) {
+        buf[i] = static_cast<uint8_t>(raw >> (i * BITS_PER_BYTE));
+    }
+}
+
+template<typename T>
+T ReadLittleEndian(const uint8_t *buf)
+{
+    uint64_t raw = 0;
+    for (size_t i = 0; i < sizeof(T); i++) {
+        raw |= static_cast<uint64_t>(buf[i]) << (i * BITS_PER_BYTE);
+    }
+    return static_cast<T>(raw);
+}
+}
+
 std::string TransName2PkgName(const std::string &ownerName)
 {
     const static std::pair<std::string, std::string> mapArray[] = {
@@ -151,44 +181,39 @@ void Convert2HiSBufferMeta(std::shared_ptr<AVTransBuffer> transBuffer, std::shar
     if ((transMeta->GetMetaType() == MetaType::AUDIO)) {
         auto hisAMeta = std::make_shared<AVTransAudioBufferMeta>();
 
-        std::string value;
+        int64_t value = 0;
         transMeta->GetMetaItem(AVTransTag::BUFFER_DATA_TYPE, value);
-        uint32_t dataType = static_cast<uint32_t>(std::atoi(value.c_str()));
-        hisAMeta->dataType_ = (BufferDataType)dataType;
+        hisAMeta->dataType_ = (BufferDataType)static_cast<uint32_t>(value);
 
         transMeta->GetMetaItem(AVTransTag::AUDIO_SAMPLE_FORMAT, value);
-        uint32_t format = static_cast<uint32_t>(std::atoi(value.c_str()));
-        hisAMeta->format_ = (AudioSampleFormat)format;
+        hisAMeta->format_ = (AudioSampleFormat)static_cast<uint32_t>(value);
 
         transMeta->GetMetaItem(AVTransTag::AUDIO_SAMPLE_RATE, value);
-        hisAMeta->sampleRate_ = static_cast<uint32_t>(std::atoi(value.c_str()));
+        hisAMeta->sampleRate_ = static_cast<uint32_t>(value);
 
         hisBuffer->UpdateBufferMeta(*hisAMeta);
     } else {
         auto hisVMeta = std::make_shared<AVTransVideoBufferMeta>();
 
-        std::string value;
+        int64_t value = 0;
         transMeta->GetMetaItem(AVTransTag::BUFFER_DATA_TYPE, value);
-        uint32_t dataType = static_cast<uint32_t>(std::atoi(value.c_str()));
-        hisVMeta->dataType_ = (BufferDataType)dataType;
+        hisVMeta->dataType_ = (BufferDataType)static_cast<uint32_t>(value);
 
         transMeta->GetMetaItem(AVTransTag::VIDEO_PIXEL_FORMAT, value);
-        uint32_t format = static_cast<uint32_t>(std::atoi(value.c_str()));
-        hisVMeta->format_ = (VideoPixelFormat)format;
+        hisVMeta->format_ = (VideoPixelFormat)static_cast<uint32_t>(value);
 
         transMeta->GetMetaItem(AVTransTag::VIDEO_WIDTH, value);
-        hisVMeta->width_ = static_cast<uint32_t>(std::atoi(value.c_str()));
+        hisVMeta->width_ = static_cast<uint32_t>(value);
 
         transMeta->GetMetaItem(AVTransTag::VIDEO_HEIGHT, value);
-        hisVMeta->height_ = static_cast<uint32_t>(std::atoi(value.c_str()));
-
-        TRUE_LOG_MSG(!transMeta->GetMetaItem(AVTransTag::PRE_TIMESTAMP, value), "get PRE_TIMESTAMP meta failed");
-
-        long num = 0;
-        auto res = std::from_chars(value.data(), value.data() + value.size(), num);
-        if (res.ec == std::errc()) {
-            hisVMeta->pts_ = num;
-            hisBuffer->pts = num;
+        hisVMeta->height_ = static_cast<uint32_t>(value);
+
+        int64_t pts = 0;
+        if (transMeta->GetMetaItem(AVTransTag::PRE_TIMESTAMP, pts)) {
+            hisVMeta->pts_ = pts;
+            hisBuffer->pts = pts;
+        } else {
+            AVTRANS_LOGE("get PRE_TIMESTAMP meta failed");
         }
         hisBuffer->UpdateBufferMeta(*hisVMeta);
     }
@@ -202,9 +227,9 @@ void Convert2TransBufferMeta(std::shared_ptr<AVBuffer> hisBuffer, std::shared_pt
         TRUE_RETURN(hisAMeta == nullptr, "hisAMeta is null");
 
         auto transAMeta = std::make_shared<TransBufferMeta>(MetaType::AUDIO);
-        transAMeta->SetMetaItem(AVTransTag::BUFFER_DATA_TYPE, std::to_string((uint32_t)(hisAMeta->dataType_)));
-        transAMeta->SetMetaItem(AVTransTag::AUDIO_SAMPLE_FORMAT, std::to_string((uint32_t)(hisAMeta->format_)));
-        transAMeta->SetMetaItem(AVTransTag::AUDIO_SAMPLE_RATE, std::to_string(hisAMeta->sampleRate_));
+        transAMeta->SetMetaItem(AVTransTag::BUFFER_DATA_TYPE, static_cast<int64_t>(hisAMeta->dataType_));
+        transAMeta->SetMetaItem(AVTransTag::AUDIO_SAMPLE_FORMAT, static_cast<int64_t>(hisAMeta->format_));
+        transAMeta->SetMetaItem(AVTransTag::AUDIO_SAMPLE_RATE, static_cast<int64_t>(hisAMeta->sampleRate_));
 
         transBuffer->UpdateBufferMeta(transAMeta);
     } else {
@@ -212,11 +237,11 @@ void Convert2TransBufferMeta(std::shared_ptr<AVBuffer> hisBuffer, std::shared_pt
         TRUE_RETURN(hisVMeta == nullptr, "hisAMeta is null");
 
         auto transVMeta = std::make_shared<TransBufferMeta>(MetaType::VIDEO);
-        transVMeta->SetMetaItem(AVTransTag::BUFFER_DATA_TYPE, std::to_string((uint32_t)(hisVMeta->dataType_)));
-        transVMeta->SetMetaItem(AVTransTag::VIDEO_PIXEL_FORMAT, std::to_string((uint32_t)(hisVMeta->format_)));
-        transVMeta->SetMetaItem(AVTransTag::VIDEO_WIDTH, std::to_string(hisVMeta->width_));
-        transVMeta->SetMetaItem(AVTransTag::VIDEO_HEIGHT, std::to_string(hisVMeta->height_));
-        transVMeta->SetMetaItem(AVTransTag::PRE_TIMESTAMP, std::to_string(hisVMeta->pts_));
+        transVMeta->SetMetaItem(AVTransTag::BUFFER_DATA_TYPE, static_cast<int64_t>(hisVMeta->dataType_));
+        transVMeta->SetMetaItem(AVTransTag::VIDEO_PIXEL_FORMAT, static_cast<int64_t>(hisVMeta->format_));
+        transVMeta->SetMetaItem(AVTransTag::VIDEO_WIDTH, static_cast<int64_t>(hisVMeta->width_));
+        transVMeta->SetMetaItem(AVTransTag::VIDEO_HEIGHT, static_cast<int64_t>(hisVMeta->height_));
+        transVMeta->SetMetaItem(AVTransTag::PRE_TIMESTAMP, static_cast<int64_t>(hisVMeta->pts_));
 
         transBuffer->UpdateBufferMeta(transVMeta);
     }
@@ -285,6 +310,101 @@ bool ConvertToInt(const std::string& str, int& value)
     return ec == std::errc{} && ptr == str.data() + str.size();
 }
 
+int32_t CheckEngineConfig(const AVTransEngineConfig &config, bool isStarted)
+{
+    TRUE_RETURN_V_MSG_E(config.itemMask == 0, ERR_DH_AVT_INVALID_PARAM, "engine config has no item.");
+    TRUE_RETURN_V_MSG_E(isStarted && ((config.itemMask & ~ENGINE_CONFIG_LIVE_ITEMS) != 0), ERR_DH_AVT_INVALID_STATE,
+        "engine config mask=%{public}u needs the pipeline prepared again.", config.itemMask);
+    const std::pair<EngineConfigItem, int32_t> positiveItems[] = {
+        { EngineConfigItem::VIDEO_WIDTH, config.videoWidth },
+        { EngineConfigItem::VIDEO_HEIGHT, config.videoHeight },
+        { EngineConfigItem::VIDEO_FRAME_RATE, config.videoFrameRate },
+        { EngineConfigItem::VIDEO_BIT_RATE, config.videoBitRate },
+        { EngineConfigItem::AUDIO_BIT_RATE, config.audioBitRate },
+        { EngineConfigItem::AUDIO_CHANNEL_MASK, config.audioChannels },
+        { EngineConfigItem::AUDIO_SAMPLE_RATE, config.audioSampleRate },
+        { EngineConfigItem::AUDIO_FRAME_SIZE, config.audioFrameSize },
+    };
+    for (const auto &item : positiveItems) {
+        TRUE_RETURN_V_MSG_E(config.HasItem(item.first) && item.second <= 0, ERR_DH_AVT_INVALID_PARAM_VALUE,
+            "engine config item=%{public}u value=%{public}d is invalid.", static_cast<uint32_t>(item.first),
+            item.second);
+    }
+    bool isVideoCodecValid = (config.videoCodecType == MIME_VIDEO_H264) ||
+        (config.videoCodecType == MIME_VIDEO_H265);
+    TRUE_RETURN_V_MSG_E(config.HasItem(EngineConfigItem::VIDEO_CODEC_TYPE) && !isVideoCodecValid,
+        ERR_DH_AVT_UNSUPPORTED_FORMAT, "video codec type %{public}s is unsupported.", config.videoCodecType.c_str());
+    TRUE_RETURN_V_MSG_E(config.HasItem(EngineConfigItem::AUDIO_CHANNEL_LAYOUT) && config.audioChannelLayout < 0,
+        ERR_DH_AVT_INVALID_PARAM_VALUE, "audio channel layout=%{public}d is invalid.", config.audioChannelLayout);
+    TRUE_RETURN_V_MSG_E(config.HasItem(EngineConfigItem::AUDIO_SAMPLE_FORMAT) && config.audioSampleFormat < 0,
+        ERR_DH_AVT_INVALID_PARAM_VALUE, "audio sample format=%{public}d is invalid.", config.audioSampleFormat);
+    return DH_AVT_SUCCESS;
+}
+
+int64_t GetDamageRegionArea(const std::string &region)
+{
+    constexpr size_t rectFieldNum = 4;
+    constexpr size_t widthIdx = 2;
+    constexpr size_t heightIdx = 3;
+    int64_t area = 0;
+    const char *cur = region.data();
+    const char *end = region.data() + region.size();
+    while (cur < end) {
+        int32_t fields[rectFieldNum] = { 0 };
+        for (size_t i = 0; i < rectFieldNum; i++) {
+            if (i > 0) {
+                TRUE_RETURN_V((cur >= end) || (*cur != ','), -1);
+                cur++;
+            }
+            auto [ptr, ec] = std::from_chars(cur, end, fields[i]);
+            TRUE_RETURN_V(ec != std::errc{}, -1);
+            cur = ptr;
+        }
+        TRUE_RETURN_V((fields[widthIdx] < 0) || (fields[heightIdx] < 0), -1);
+        area += static_cast<int64_t>(fields[widthIdx]) * fields[heightIdx];
+        if (cur < end) {
+            TRUE_RETURN_V(*cur != ';', -1);
+            cur++;
+        }
+    }
+    return area;
+}
+
+bool IsStreamExtHeader(const uint8_t *buf, size_t len)
+{
+    return (buf != nullptr) && (len >= AVT_STREAM_EXT_HEADER_LEN) &&
+        (ReadLittleEndian<uint32_t>(buf) == AVT_STREAM_EXT_MAGIC);
+}
+
+bool MarshalStreamExtHeader(const AVTransStreamExtHeader &header, uint8_t *buf, size_t len)
+{
+    TRUE_RETURN_V_MSG_E((buf == nullptr) || (len < AVT_STREAM_EXT_HEADER_LEN), false, "ext buffer is too small.");
+    WriteLittleEndian<uint32_t>(buf, AVT_STREAM_EXT_MAGIC);
+    WriteLittleEndian<uint16_t>(buf + EXT_OFFSET_VERSION, AVT_STREAM_EXT_VERSION);
+    WriteLittleEndian<uint16_t>(buf + EXT_OFFSET_HEADER_LEN, AVT_STREAM_EXT_HEADER_LEN);
+    WriteLittleEndian<uint32_t>(buf + EXT_OFFSET_DATA_TYPE, static_cast<uint32_t>(header.dataType));
+    WriteLittleEndian<uint32_t>(buf + EXT_OFFSET_FRAME_NUMBER, header.frameNumber);
+    WriteLittleEndian<int64_t>(buf + EXT_OFFSET_PTS, header.pts);
+    WriteLittleEndian<int64_t>(buf + EXT_OFFSET_PTS_SPECIAL, header.ptsSpecial);
+    return true;
+}
+
+bool UnmarshalStreamExtHeader(const uint8_t *buf, size_t len, AVTransStreamExtHeader &header)
+{
+    TRUE_RETURN_V_MSG_E(!IsStreamExtHeader(buf, len), false, "not a stream ext header.");
+    uint16_t version = ReadLittleEndian<uint16_t>(buf + EXT_OFFSET_VERSION);
+    uint16_t headerLen = ReadLittleEndian<uint16_t>(buf + EXT_OFFSET_HEADER_LEN);
+    // Later versions only append fields, the version 1 part stays readable.
+    TRUE_RETURN_V_MSG_E((version == 0) || (headerLen < AVT_STREAM_EXT_HEADER_LEN) || (headerLen > len), false,
+        "invalid stream ext header, version: %{public}u, len: %{public}u.", version, headerLen);
+    header.version = version;
+    header.dataType = static_cast<BufferDataType>(ReadLittleEndian<uint32_t>(buf + EXT_OFFSET_DATA_TYPE));
+    header.frameNumber = ReadLittleEndian<uint32_t>(buf + EXT_OFFSET_FRAME_NUMBER);
+    header.pts = ReadLittleEndian<int64_t>(buf + EXT_OFFSET_PTS);
+    header.ptsSpecial = ReadLittleEndian<int64_t>(buf + EXT_OFFSET_PTS_SPECIAL);
+    return true;
+}
+
 int64_t GetCurrentTime()
 {
     struct timespec time = { 0, 0 };
@@ -292,6 +412,25 @@ int64_t GetCurrentTime()
     return time.tv_sec * NS_ONE_S + time.tv_nsec;
 }
 
+std::string BuildFirstFrameContent(const std::string &ownerName, int64_t costMs, bool isPrewarmed)
+{
+    cJSON *jsonObj = cJSON_CreateObject();
+    if (jsonObj == nullptr) {
+        return "";
+    }
+    cJSON_AddStringToObject(jsonObj, KEY_ONWER_NAME.c_str(), ownerName.c_str());
+    cJSON_AddNumberToObject(jsonObj, KEY_FIRST_FRAME_COST.c_str(), static_cast<double>(costMs));
+    cJSON_AddBoolToObject(jsonObj, KEY_PREWARMED.c_str(), isPrewarmed);
+    char *str = cJSON_PrintUnformatted(jsonObj);
+    cJSON_Delete(jsonObj);
+    if (str == nullptr) {
+        return "";
+    }
+    std::string content(str);
+    cJSON_free(str);
+    return content;
+}
+
 void GenerateAdtsHeader(unsigned char* adtsHeader, uint32_t packetLen, uint32_t profile, uint32_t sampleRate,
     uint32_t channels)
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -84,6 +84,9 @@ const static std::pair<std::string, std::string> LOCAL_TO_PEER_SESSION_NAME_MAP[
 static const int32_t HEX_WIDTH = 16;
 static const int32_t SECONDS_TO_MS = 1000;
 static const int32_t DEFAULT_TIMEOUT_MS = 30000;
+static const int32_t PRIORITY_SEND_WAIT_MS = 2;
+static const int32_t TIME_SYNC_OFFSET_PRECISION = 3;
+static const double US_PER_MS = 1000.0;
 } // namespace
 
 static void OnSessionOpened(int32_t sessionId, PeerSocketInfo info)
@@ -138,6 +141,7 @@ SoftbusChannelAdapter::~SoftbusChannelAdapter()
     listenerMap_.clear();
     timeSyncSessNames_.clear();
     devId2SessIdMap_.clear();
+    sessId2KeysMap_.clear();
     serverMap_.clear();
 }
 
@@ -244,11 +248,12 @@ int32_t SoftbusChannelAdapter::RemoveChannelServer(const std::string& pkgName, c
     Shutdown(serverSocketId);
     int32_t sessionId = INVALID_SESSION_ID;
     {
-        std::lock_guard<std::mutex> lock(idMapMutex_);
+        std::unique_lock<std::shared_mutex> lock(idMapMutex_);
         for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end(); it++) {
             if ((it->first).find(sessName) != std::string::npos) {
                 sessionId = it->second;
-                devId2SessIdMap_.erase(it->first);
+                std::string idMapKey = it->first;
+                UnbindSessionKey(idMapKey);
                 break;
             }
         }
@@ -263,7 +268,7 @@ void OHOS::DistributedHardware::SoftbusChannelAdapter::SendEventChannelOPened(co
 {
     EventType type = EventType::EVENT_CHANNEL_OPENED;
     AVTransEvent event = {type, mySessName, peerDevId};
-    std::lock_guard<std::mutex> lock(listenerMtx_);
+    std::shared_lock<std::shared_mutex> lock(listenerMtx_);
     {
         for (auto it = listenerMap_.begin(); it != listenerMap_.end(); it++) {
             if (((it->first).find(mySessName) != std::string::npos) && (it->second != nullptr)) {
@@ -317,8 +322,8 @@ int32_t SoftbusChannelAdapter::OpenSoftbusChannel(const std::string &mySessName,
         return ERR_DH_AVT_SESSION_ERROR;
     }
     {
-        std::lock_guard<std::mutex> lock(idMapMutex_);
-        devId2SessIdMap_.insert(std::make_pair(mySessName + "_" + peerDevId, socketId));
+        std::unique_lock<std::shared_mutex> lock(idMapMutex_);
+        BindSessionKey(mySessName + "_" + peerDevId, socketId);
     }
     SendEventChannelOPened(mySessName, peerDevId);
     AVTRANS_LOGI("Open softbus channel finished for mySessName:%{public}s.", mySessName.c_str());
@@ -335,8 +340,8 @@ int32_t SoftbusChannelAdapter::CloseSoftbusChannel(const std::string& sessName,
     int32_t sessionId = GetSessIdBySessName(sessName, peerDevId);
     Shutdown(sessionId);
     {
-        std::lock_guard<std::mutex> lock(idMapMutex_);
-        devId2SessIdMap_.erase(sessName + "_" + peerDevId);
+        std::unique_lock<std::shared_mutex> lock(idMapMutex_);
+        UnbindSessionKey(sessName + "_" + peerDevId);
     }
 
     AVTRANS_LOGI("Close softbus channel success, sessionId:%{public}" PRId32, sessionId);
@@ -358,7 +363,9 @@ int32_t SoftbusChannelAdapter::SendBytesData(const std::string& sessName, const
             sessName.c_str(), GetAnonyString(peerDevId).c_str());
         return ERR_DH_AVT_SEND_DATA_FAILED;
     }
+    BeginPrioritySend(SessionPriority::CONTROL);
     int32_t ret = SendBytes(existSessId, data.c_str(), strlen(data.c_str()));
+    EndPrioritySend(SessionPriority::CONTROL);
     if (ret != DH_AVT_SUCCESS) {
         AVTRANS_LOGE("Send bytes data failed ret:%{public}" PRId32, ret);
         return ERR_DH_AVT_SEND_DATA_FAILED;
@@ -381,7 +388,10 @@ int32_t SoftbusChannelAdapter::SendStreamData(const std::string& sessName, const
             sessName.c_str(), GetAnonyString(peerDevId).c_str());
         return ERR_DH_AVT_SEND_DATA_FAILED;
     }
+    SessionPriority priority = GetSessionPriority(sessName);
+    BeginPrioritySend(priority);
     int32_t ret = SendStream(existSessId, data, ext, &frameInfo);
+    EndPrioritySend(priority);
     if (ret != DH_AVT_SUCCESS) {
         AVTRANS_LOGE("Send stream data failed ret:%{public}" PRId32, ret);
         return ERR_DH_AVT_SEND_DATA_FAILED;
@@ -389,6 +399,20 @@ int32_t SoftbusChannelAdapter::SendStreamData(const std::string& sessName, const
     return DH_AVT_SUCCESS;
 }
 
+int32_t SoftbusChannelAdapter::SendStreamData(const std::string& sessName, const std::string &peerDevId,
+    const uint8_t *data, size_t dataLen, const std::string &ext)
+{
+    TRUE_RETURN_V_MSG_E(data == nullptr, ERR_DH_AVT_INVALID_PARAM, "input data is nullptr.");
+    TRUE_RETURN_V_MSG_E(dataLen > DSOFTBUS_INPUT_MAX_RECV_DATA_LEN, ERR_DH_AVT_INVALID_PARAM,
+        "input data is over size.");
+    TRUE_RETURN_V_MSG_E(ext.length() > DSOFTBUS_INPUT_MAX_RECV_EXT_LEN, ERR_DH_AVT_INVALID_PARAM,
+        "input ext is over size.");
+    // Softbus only reads the frames while sending, so the caller's buffer memory goes out without a copy.
+    StreamData streamData = {reinterpret_cast<char *>(const_cast<uint8_t *>(data)), static_cast<int>(dataLen)};
+    StreamData streamExt = {const_cast<char *>(ext.data()), static_cast<int>(ext.length())};
+    return SendStreamData(sessName, peerDevId, &streamData, &streamExt);
+}
+
 int32_t SoftbusChannelAdapter::RegisterChannelListener(const std::string& sessName, const std::string &peerDevId,
     ISoftbusChannelListener *listener)
 {
@@ -398,7 +422,7 @@ int32_t SoftbusChannelAdapter::RegisterChannelListener(const std::string& sessNa
     TRUE_RETURN_V_MSG_E(peerDevId.empty(), ERR_DH_AVT_INVALID_PARAM, "input peerDevId is empty.");
     TRUE_RETURN_V_MSG_E(listener == nullptr, ERR_DH_AVT_INVALID_PARAM, "input callback is nullptr.");
 
-    std::lock_guard<std::mutex> lock(listenerMtx_);
+    std::unique_lock<std::shared_mutex> lock(listenerMtx_);
     listenerMap_[sessName + "_" + peerDevId] = listener;
 
     return DH_AVT_SUCCESS;
@@ -411,7 +435,7 @@ int32_t SoftbusChannelAdapter::UnRegisterChannelListener(const std::string& sess
     TRUE_RETURN_V_MSG_E(sessName.empty(), ERR_DH_AVT_INVALID_PARAM, "input sessName is empty.");
     TRUE_RETURN_V_MSG_E(peerDevId.empty(), ERR_DH_AVT_INVALID_PARAM, "input peerDevId is empty.");
 
-    std::lock_guard<std::mutex> lock(listenerMtx_);
+    std::unique_lock<std::shared_mutex> lock(listenerMtx_);
     listenerMap_.erase(sessName + "_" + peerDevId);
 
     return DH_AVT_SUCCESS;
@@ -457,23 +481,21 @@ int32_t SoftbusChannelAdapter::StopDeviceTimeSync(const std::string &pkgName, co
 
 int32_t SoftbusChannelAdapter::GetSessIdBySessName(const std::string& sessName, const std::string &peerDevId)
 {
-    std::lock_guard<std::mutex> lock(idMapMutex_);
-    std::string idMapKey = sessName + "_" + peerDevId;
-    if (devId2SessIdMap_.find(idMapKey) == devId2SessIdMap_.end()) {
+    std::shared_lock<std::shared_mutex> lock(idMapMutex_);
+    auto iter = devId2SessIdMap_.find(sessName + "_" + peerDevId);
+    if (iter == devId2SessIdMap_.end()) {
         AVTRANS_LOGI("Can not find sessionId for sessName:%{public}s, peerDevId:%{public}s.",
             sessName.c_str(), GetAnonyString(peerDevId).c_str());
         return -1;
     }
-    return devId2SessIdMap_[idMapKey];
+    return iter->second;
 }
 
 std::string SoftbusChannelAdapter::GetSessionNameById(int32_t sessionId)
 {
-    std::lock_guard<std::mutex> lock(idMapMutex_);
-    for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end(); it++) {
-        if (it->second == sessionId) {
-            return it->first;
-        }
+    std::vector<std::string> idMapKeys = GetSessionKeysById(sessionId);
+    if (!idMapKeys.empty()) {
+        return idMapKeys.front();
     }
 
     AVTRANS_LOGE("No available channel or invalid sessionId:%{public}" PRId32, sessionId);
@@ -494,24 +516,33 @@ int32_t SoftbusChannelAdapter::OnSoftbusChannelOpened(std::string peerSessionNam
     DAudioAccessConfigManager::GetInstance().SetCurrentNetworkId(peerDevId);
     RequestAndWaitForAuthorization(peerDevId);
 
-    std::lock_guard<std::mutex> lock(idMapMutex_);
     EventType type = (result == 0) ? EventType::EVENT_CHANNEL_OPENED : EventType::EVENT_CHANNEL_OPEN_FAIL;
     AVTransEvent event = {type, mySessionName, peerDevId};
+    std::vector<std::string> listenerKeys;
     {
-        std::lock_guard<std::mutex> subLock(listenerMtx_);
+        std::shared_lock<std::shared_mutex> lock(listenerMtx_);
         for (auto it = listenerMap_.begin(); it != listenerMap_.end(); it++) {
             if (((it->first).find(mySessionName) != std::string::npos) && (it->second != nullptr)) {
-                std::thread(&SoftbusChannelAdapter::SendChannelEvent, this, it->first, event).detach();
-                devId2SessIdMap_.erase(it->first);
-                devId2SessIdMap_.insert(std::make_pair(it->first, sessionId));
+                listenerKeys.push_back(it->first);
             }
         }
     }
-    std::string idMapKey = mySessionName + "_" + peerDevId;
-    if (devId2SessIdMap_.find(idMapKey) == devId2SessIdMap_.end()) {
-        AVTRANS_LOGI("Can not find sessionId for mySessionName:%{public}s, peerDevId:%{public}s. try to insert it.",
-            mySessionName.c_str(), GetAnonyString(peerDevId).c_str());
-            devId2SessIdMap_.insert(std::make_pair(idMapKey, sessionId));
+    {
+        std::unique_lock<std::shared_mutex> lock(idMapMutex_);
+        for (const auto &listenerKey : listenerKeys) {
+            UnbindSessionKey(listenerKey);
+            BindSessionKey(listenerKey, sessionId);
+        }
+        std::string idMapKey = mySessionName + "_" + peerDevId;
+        if (devId2SessIdMap_.find(idMapKey) == devId2SessIdMap_.end()) {
+            AVTRANS_LOGI("Can not find sessionId for mySessionName:%{public}s, peerDevId:%{public}s. try to insert "
+                "it.", mySessionName.c_str(), GetAnonyString(peerDevId).c_str());
+            BindSessionKey(idMapKey, sessionId);
+        }
+    }
+    // The keys are bound before the events go out, so a listener reacting to the open already finds its session.
+    for (const auto &listenerKey : listenerKeys) {
+        std::thread(&SoftbusChannelAdapter::SendChannelEvent, this, listenerKey, event).detach();
     }
     return DH_AVT_SUCCESS;
 }
@@ -524,16 +555,17 @@ void SoftbusChannelAdapter::OnSoftbusChannelClosed(int32_t sessionId, ShutdownRe
     std::string peerDevId = GetPeerDevIdBySessId(sessionId);
     AVTransEvent event = {EventType::EVENT_CHANNEL_CLOSED, "", peerDevId};
 
-    std::lock_guard<std::mutex> lock(idMapMutex_);
-    for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end();) {
-        if (it->second == sessionId) {
-            event.content = GetOwnerFromSessName(it->first);
-            std::thread(&SoftbusChannelAdapter::SendChannelEvent, this, it->first, event).detach();
-            it = devId2SessIdMap_.erase(it);
-        } else {
-            it++;
-        }
+    std::unique_lock<std::shared_mutex> lock(idMapMutex_);
+    auto keysIter = sessId2KeysMap_.find(sessionId);
+    if (keysIter == sessId2KeysMap_.end()) {
+        return;
+    }
+    for (const auto &idMapKey : keysIter->second) {
+        event.content = GetOwnerFromSessName(idMapKey);
+        std::thread(&SoftbusChannelAdapter::SendChannelEvent, this, idMapKey, event).detach();
+        devId2SessIdMap_.erase(idMapKey);
     }
+    sessId2KeysMap_.erase(keysIter);
 }
 
 void SoftbusChannelAdapter::OnSoftbusBytesReceived(int32_t sessionId, const void *data, uint32_t dataLen)
@@ -549,11 +581,8 @@ void SoftbusChannelAdapter::OnSoftbusBytesReceived(int32_t sessionId, const void
     std::string dataStr = std::string(reinterpret_cast<const char *>(data), dataLen);
     AVTransEvent event = {EventType::EVENT_DATA_RECEIVED, dataStr, peerDevId};
 
-    std::lock_guard<std::mutex> lock(idMapMutex_);
-    for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end(); it++) {
-        if (it->second == sessionId) {
-            std::thread(&SoftbusChannelAdapter::SendChannelEvent, this, it->first, event).detach();
-        }
+    for (const auto &idMapKey : GetSessionKeysById(sessionId)) {
+        std::thread(&SoftbusChannelAdapter::SendChannelEvent, this, idMapKey, event).detach();
     }
 }
 
@@ -564,15 +593,23 @@ void SoftbusChannelAdapter::OnSoftbusStreamReceived(int32_t sessionId, const Str
     TRUE_RETURN(data == nullptr, "input data is nullptr.");
     TRUE_RETURN(ext == nullptr, "input ext data is nullptr.");
 
-    std::lock_guard<std::mutex> lock(idMapMutex_);
-    for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end(); it++) {
-        if (it->second == sessionId) {
-            std::lock_guard<std::mutex> subLock(listenerMtx_);
-            ISoftbusChannelListener *listener = listenerMap_[it->first];
-            TRUE_RETURN(listener == nullptr, "Can not find channel listener.");
-            listener->OnStreamReceived(data, ext);
+    // Frames are handed over without the adapter locks, so control events are not held behind them.
+    std::vector<ISoftbusChannelListener *> listeners;
+    {
+        // Both maps are only read here, so frames of different sessions are looked up concurrently.
+        std::shared_lock<std::shared_mutex> lock(idMapMutex_);
+        std::shared_lock<std::shared_mutex> subLock(listenerMtx_);
+        auto keysIter = sessId2KeysMap_.find(sessionId);
+        TRUE_RETURN(keysIter == sessId2KeysMap_.end(), "Can not find session keys.");
+        for (const auto &idMapKey : keysIter->second) {
+            auto iter = listenerMap_.find(idMapKey);
+            TRUE_RETURN((iter == listenerMap_.end()) || (iter->second == nullptr), "Can not find channel listener.");
+            listeners.push_back(iter->second);
         }
     }
+    for (auto listener : listeners) {
+        listener->OnStreamReceived(data, ext);
+    }
 }
 
 void SoftbusChannelAdapter::OnSoftbusTimeSyncResult(const TimeSyncResultInfo *info, int32_t result)
@@ -592,28 +629,34 @@ void SoftbusChannelAdapter::OnSoftbusTimeSyncResult(const TimeSyncResultInfo *in
 
     std::string targetDevId(info->target.targetNetworkId);
     std::string masterDevId(info->target.masterNetworkId);
-    std::lock_guard<std::mutex> lock(timeSyncMtx_);
-    for (auto sessName : timeSyncSessNames_) {
-        std::lock_guard<std::mutex> subLock(listenerMtx_);
-        ISoftbusChannelListener *listener = listenerMap_[sessName];
-        if (listener != nullptr) {
-            listener->OnChannelEvent({EventType::EVENT_TIME_SYNC_RESULT, std::to_string(millisecond), targetDevId});
+    // Milliseconds with the microsecond fraction, integer parsers of the result still read whole milliseconds.
+    std::ostringstream offsetStr;
+    offsetStr << std::fixed << std::setprecision(TIME_SYNC_OFFSET_PRECISION) <<
+        (millisecond + microsecond / US_PER_MS);
+    std::vector<ISoftbusChannelListener *> listeners;
+    {
+        std::lock_guard<std::mutex> lock(timeSyncMtx_);
+        std::shared_lock<std::shared_mutex> subLock(listenerMtx_);
+        for (const auto &sessName : timeSyncSessNames_) {
+            auto iter = listenerMap_.find(sessName);
+            if ((iter != listenerMap_.end()) && (iter->second != nullptr)) {
+                listeners.push_back(iter->second);
+            }
         }
     }
+    for (auto listener : listeners) {
+        listener->OnChannelEvent({EventType::EVENT_TIME_SYNC_RESULT, offsetStr.str(), targetDevId});
+    }
 }
 
 std::string SoftbusChannelAdapter::GetPeerDevIdBySessId(int32_t sessionId)
 {
-    std::lock_guard<std::mutex> lock(idMapMutex_);
-    for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end(); it++) {
-        if (it->second != sessionId) {
-            continue;
-        }
-        std::string::size_type position = (it->first).find_last_of("_");
+    for (const auto &idMapKey : GetSessionKeysById(sessionId)) {
+        std::string::size_type position = idMapKey.find_last_of("_");
         if (position == std::string::npos) {
             continue;
         }
-        std::string peerDevId = (it->first).substr(position + 1);
+        std::string peerDevId = idMapKey.substr(position + 1);
         if (peerDevId != AV_TRANS_SPECIAL_DEVICE_ID) {
             return peerDevId;
         }
@@ -633,6 +676,75 @@ std::string SoftbusChannelAdapter::GetOwnerFromSessName(const std::string &sessN
     return EMPTY_STRING;
 }
 
+SessionPriority SoftbusChannelAdapter::GetSessionPriority(const std::string &sessName)
+{
+    if ((sessName.find(SENDER_CONTROL_SESSION_NAME_SUFFIX) != std::string::npos) ||
+        (sessName.find(RECEIVER_CONTROL_SESSION_NAME_SUFFIX) != std::string::npos) ||
+        (sessName == AV_SYNC_SENDER_CONTROL_SESSION_NAME) || (sessName == AV_SYNC_RECEIVER_CONTROL_SESSION_NAME)) {
+        return SessionPriority::CONTROL;
+    }
+    if (sessName.compare(0, OWNER_NAME_D_SCREEN.size(), OWNER_NAME_D_SCREEN) == 0) {
+        return SessionPriority::VIDEO;
+    }
+    return SessionPriority::AUDIO;
+}
+
+void SoftbusChannelAdapter::BindSessionKey(const std::string &idMapKey, int32_t sessionId)
+{
+    if (!devId2SessIdMap_.insert(std::make_pair(idMapKey, sessionId)).second) {
+        return;
+    }
+    // Kept sorted, lookups by id see the keys in the same order as devId2SessIdMap_.
+    std::vector<std::string> &idMapKeys = sessId2KeysMap_[sessionId];
+    idMapKeys.insert(std::lower_bound(idMapKeys.begin(), idMapKeys.end(), idMapKey), idMapKey);
+}
+
+void SoftbusChannelAdapter::UnbindSessionKey(const std::string &idMapKey)
+{
+    auto iter = devId2SessIdMap_.find(idMapKey);
+    if (iter == devId2SessIdMap_.end()) {
+        return;
+    }
+    auto keysIter = sessId2KeysMap_.find(iter->second);
+    if (keysIter != sessId2KeysMap_.end()) {
+        std::vector<std::string> &idMapKeys = keysIter->second;
+        idMapKeys.erase(std::remove(idMapKeys.begin(), idMapKeys.end(), idMapKey), idMapKeys.end());
+        if (idMapKeys.empty()) {
+            sessId2KeysMap_.erase(keysIter);
+        }
+    }
+    devId2SessIdMap_.erase(iter);
+}
+
+std::vector<std::string> SoftbusChannelAdapter::GetSessionKeysById(int32_t sessionId)
+{
+    std::shared_lock<std::shared_mutex> lock(idMapMutex_);
+    auto iter = sessId2KeysMap_.find(sessionId);
+    if (iter == sessId2KeysMap_.end()) {
+        return {};
+    }
+    return iter->second;
+}
+
+void SoftbusChannelAdapter::BeginPrioritySend(SessionPriority priority)
+{
+    size_t level = static_cast<size_t>(priority);
+    std::unique_lock<std::mutex> lock(sendGateMtx_);
+    sendGateCon_.wait_for(lock, std::chrono::milliseconds(PRIORITY_SEND_WAIT_MS), [this, level] {
+        return std::all_of(pendingSends_, pendingSends_ + level, [](uint32_t count) { return count == 0; });
+    });
+    pendingSends_[level]++;
+}
+
+void SoftbusChannelAdapter::EndPrioritySend(SessionPriority priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(sendGateMtx_);
+        pendingSends_[static_cast<size_t>(priority)]--;
+    }
+    sendGateCon_.notify_all();
+}
+
 void SoftbusChannelAdapter::SendChannelEvent(const std::string sessName, const AVTransEvent event)
 {
     AVTRANS_LOGI("SendChannelEvent event.type_%{public}" PRId32, event.type);
@@ -640,9 +752,10 @@ void SoftbusChannelAdapter::SendChannelEvent(const std::string sessName, const A
 
     ISoftbusChannelListener *listener = nullptr;
     {
-        std::lock_guard<std::mutex> lock(listenerMtx_);
-        listener = listenerMap_[sessName];
-        TRUE_RETURN(listener == nullptr, "input listener is nullptr.");
+        std::shared_lock<std::shared_mutex> lock(listenerMtx_);
+        auto iter = listenerMap_.find(sessName);
+        TRUE_RETURN((iter == listenerMap_.end()) || (iter->second == nullptr), "input listener is nullptr.");
+        listener = iter->second;
     }
     listener->OnChannelEvent(event);
 }
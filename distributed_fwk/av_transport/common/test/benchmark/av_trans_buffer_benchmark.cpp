@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <charconv>
+#include <memory>
+#include <string>
+
+#include "av_trans_buffer.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int64_t BENCHMARK_PTS = 1700000000123456;
+constexpr int64_t BENCHMARK_WIDTH = 1920;
+constexpr int64_t BENCHMARK_HEIGHT = 1080;
+
+// The items a video frame carries from the engine to the plugins.
+void SetVideoFrameItems(BufferMeta &meta, int64_t frameNumber)
+{
+    meta.SetMetaItem(AVTransTag::FRAME_NUMBER, frameNumber);
+    meta.SetMetaItem(AVTransTag::BUFFER_DATA_TYPE, static_cast<int64_t>(MetaType::VIDEO));
+    meta.SetMetaItem(AVTransTag::PRE_TIMESTAMP, BENCHMARK_PTS + frameNumber);
+    meta.SetMetaItem(AVTransTag::VIDEO_WIDTH, BENCHMARK_WIDTH);
+    meta.SetMetaItem(AVTransTag::VIDEO_HEIGHT, BENCHMARK_HEIGHT);
+}
+
+void BenchmarkBufferMetaNumeric(benchmark::State& state)
+{
+    BufferMeta meta(MetaType::VIDEO);
+    int64_t frameNumber = 0;
+    for (auto _ : state) {
+        SetVideoFrameItems(meta, frameNumber++);
+        int64_t pts = 0;
+        int64_t width = 0;
+        meta.GetMetaItem(AVTransTag::PRE_TIMESTAMP, pts);
+        meta.GetMetaItem(AVTransTag::VIDEO_WIDTH, width);
+        benchmark::DoNotOptimize(pts);
+        benchmark::DoNotOptimize(width);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// The string round trip the numeric items replace, kept for comparison.
+void BenchmarkBufferMetaString(benchmark::State& state)
+{
+    BufferMeta meta(MetaType::VIDEO);
+    int64_t frameNumber = 0;
+    for (auto _ : state) {
+        meta.SetMetaItem(AVTransTag::FRAME_NUMBER, std::to_string(frameNumber));
+        meta.SetMetaItem(AVTransTag::BUFFER_DATA_TYPE, std::to_string(static_cast<uint32_t>(MetaType::VIDEO)));
+        meta.SetMetaItem(AVTransTag::PRE_TIMESTAMP, std::to_string(BENCHMARK_PTS + frameNumber));
+        meta.SetMetaItem(AVTransTag::VIDEO_WIDTH, std::to_string(BENCHMARK_WIDTH));
+        meta.SetMetaItem(AVTransTag::VIDEO_HEIGHT, std::to_string(BENCHMARK_HEIGHT));
+        frameNumber++;
+        std::string value;
+        int64_t pts = 0;
+        meta.GetMetaItem(AVTransTag::PRE_TIMESTAMP, value);
+        std::from_chars(value.data(), value.data() + value.size(), pts);
+        meta.GetMetaItem(AVTransTag::VIDEO_WIDTH, value);
+        benchmark::DoNotOptimize(pts);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// A fresh meta per frame, as the buffer conversion between the engine and histreamer does it.
+void BenchmarkBufferMetaPerFrame(benchmark::State& state)
+{
+    int64_t frameNumber = 0;
+    for (auto _ : state) {
+        auto meta = std::make_shared<BufferMeta>(MetaType::VIDEO);
+        SetVideoFrameItems(*meta, frameNumber++);
+        benchmark::DoNotOptimize(meta.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(BenchmarkBufferMetaNumeric);
+BENCHMARK(BenchmarkBufferMetaString);
+BENCHMARK(BenchmarkBufferMetaPerFrame);
+} // namespace DistributedHardware
+} // namespace OHOS
+
+BENCHMARK_MAIN();
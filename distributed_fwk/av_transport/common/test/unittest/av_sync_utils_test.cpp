@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <vector>
 
 #include "av_sync_utils.h"
 
@@ -174,6 +175,201 @@ HWTEST_F(AvSyncUtilsTest, WriteClockUnitToMemory_001, TestSize.Level1)
     EXPECT_EQ(false, ret == 0);
 }
 
+HWTEST_F(AvSyncUtilsTest, ReadClockUnitFromMemory_001, TestSize.Level1)
+{
+    std::vector<uint8_t> buffer(sizeof(AVSyncClockRegion), 0);
+    AVTransSharedMemory memory = {
+        .fd = 1,
+        .size = static_cast<int32_t>(buffer.size()),
+        .name = "name_test",
+        .addr = buffer.data(),
+    };
+    AVSyncClockUnit unit = {
+        .index = 0,
+        .frameNum = 1,
+        .pts = 1,
+    };
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, ReadClockUnitFromMemory(memory, unit));
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, WriteClockUnitToMemory(memory, unit));
+
+    EXPECT_EQ(DH_AVT_SUCCESS, InitClockUnitMemory(memory));
+    EXPECT_EQ(ERR_DH_AVT_MASTER_NOT_READY, ReadClockUnitFromMemory(memory, unit));
+}
+
+HWTEST_F(AvSyncUtilsTest, ReadClockUnitFromMemory_002, TestSize.Level1)
+{
+    std::vector<uint8_t> buffer(sizeof(AVSyncClockRegion), 0);
+    AVTransSharedMemory memory = {
+        .fd = 1,
+        .size = static_cast<int32_t>(buffer.size()),
+        .name = "name_test",
+        .addr = buffer.data(),
+    };
+    ASSERT_EQ(DH_AVT_SUCCESS, InitClockUnitMemory(memory));
+
+    AVSyncClockUnit writeUnit = {
+        .index = 0,
+        .frameNum = 1,
+        .pts = 1,
+    };
+    uint32_t writeCount = MAX_CLOCK_UNIT_COUNT + 3;
+    for (uint32_t i = 1; i <= writeCount; i++) {
+        writeUnit.frameNum = i;
+        writeUnit.pts = static_cast<int64_t>(i) * 10;
+        ASSERT_EQ(DH_AVT_SUCCESS, WriteClockUnitToMemory(memory, writeUnit));
+    }
+    EXPECT_EQ(writeCount % MAX_CLOCK_UNIT_COUNT, writeUnit.index);
+
+    AVSyncClockUnit readUnit = {
+        .index = 0,
+        .frameNum = 1,
+        .pts = 0,
+    };
+    EXPECT_EQ(DH_AVT_SUCCESS, ReadClockUnitFromMemory(memory, readUnit));
+    EXPECT_EQ(writeCount, readUnit.frameNum);
+    EXPECT_EQ(static_cast<int64_t>(writeCount) * 10, readUnit.pts);
+}
+
+HWTEST_F(AvSyncUtilsTest, WaitClockUnitReady_001, TestSize.Level1)
+{
+    std::vector<uint8_t> buffer(sizeof(AVSyncClockRegion), 0);
+    AVTransSharedMemory memory = {
+        .fd = 1,
+        .size = static_cast<int32_t>(buffer.size()),
+        .name = "name_test",
+        .addr = buffer.data(),
+    };
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, WaitClockUnitReady(memory, 0));
+
+    ASSERT_EQ(DH_AVT_SUCCESS, InitClockUnitMemory(memory));
+    EXPECT_EQ(ERR_DH_AVT_MASTER_NOT_READY, WaitClockUnitReady(memory, 1000));
+
+    AVSyncClockUnit unit = {
+        .index = 0,
+        .frameNum = 1,
+        .pts = 1,
+    };
+    ASSERT_EQ(DH_AVT_SUCCESS, WriteClockUnitToMemory(memory, unit));
+    EXPECT_EQ(DH_AVT_SUCCESS, WaitClockUnitReady(memory, 1000));
+}
+
+HWTEST_F(AvSyncUtilsTest, WriteClockDelayToMemory_001, TestSize.Level1)
+{
+    std::vector<uint8_t> buffer(sizeof(AVSyncClockRegion), 0);
+    AVTransSharedMemory memory = {
+        .fd = 1,
+        .size = static_cast<int32_t>(buffer.size()),
+        .name = "name_test",
+        .addr = buffer.data(),
+    };
+    int64_t delayNs = -1;
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, WriteClockDelayToMemory(memory, 0));
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, ReadClockDelayFromMemory(memory, delayNs));
+
+    ASSERT_EQ(DH_AVT_SUCCESS, InitClockUnitMemory(memory));
+    EXPECT_EQ(DH_AVT_SUCCESS, ReadClockDelayFromMemory(memory, delayNs));
+    EXPECT_EQ(0, delayNs);
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, WriteClockDelayToMemory(memory, -1));
+    EXPECT_EQ(DH_AVT_SUCCESS, WriteClockDelayToMemory(memory, 40000000));
+    EXPECT_EQ(DH_AVT_SUCCESS, ReadClockDelayFromMemory(memory, delayNs));
+    EXPECT_EQ(40000000, delayNs);
+}
+
+HWTEST_F(AvSyncUtilsTest, WriteClockDriftToMemory_001, TestSize.Level1)
+{
+    std::vector<uint8_t> buffer(sizeof(AVSyncClockRegion), 0);
+    AVTransSharedMemory memory = {
+        .fd = 1,
+        .size = static_cast<int32_t>(buffer.size()),
+        .name = "name_test",
+        .addr = buffer.data(),
+    };
+    AVSyncClockDrift drift = { 1000, 2000, 30 };
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, WriteClockDriftToMemory(memory, drift));
+
+    ASSERT_EQ(DH_AVT_SUCCESS, InitClockUnitMemory(memory));
+    AVSyncClockDrift readDrift = { 0, 0, 0 };
+    EXPECT_EQ(ERR_DH_AVT_MASTER_NOT_READY, ReadClockDriftFromMemory(memory, readDrift));
+    EXPECT_EQ(DH_AVT_SUCCESS, WriteClockDriftToMemory(memory, drift));
+    EXPECT_EQ(DH_AVT_SUCCESS, ReadClockDriftFromMemory(memory, readDrift));
+    EXPECT_EQ(drift.refTime, readDrift.refTime);
+    EXPECT_EQ(drift.offset, readDrift.offset);
+    EXPECT_EQ(drift.driftPpb, readDrift.driftPpb);
+    EXPECT_EQ(2000 + 30, GetClockOffsetAt(readDrift, 1000 + 1000000000));
+}
+
+HWTEST_F(AvSyncUtilsTest, AVSyncDriftEstimator_001, TestSize.Level1)
+{
+    const int64_t period = 1000000000;
+    const int64_t baseOffset = 3000000;
+    const int64_t driftPpb = 20000;
+    AVSyncDriftEstimator estimator;
+    AVSyncClockDrift drift = { 0, 0, 0 };
+    EXPECT_FALSE(estimator.GetDrift(drift));
+
+    estimator.AddSample(period, baseOffset);
+    ASSERT_TRUE(estimator.GetDrift(drift));
+    EXPECT_EQ(baseOffset, drift.offset);
+    EXPECT_EQ(0, drift.driftPpb);
+
+    for (int64_t i = 2; i <= 40; i++) {
+        estimator.AddSample(i * period, baseOffset + (i - 1) * driftPpb);
+    }
+    EXPECT_EQ(32, estimator.GetSampleCount());
+    ASSERT_TRUE(estimator.GetDrift(drift));
+    EXPECT_EQ(40 * period, drift.refTime);
+    EXPECT_EQ(driftPpb, drift.driftPpb);
+    EXPECT_EQ(baseOffset + 39 * driftPpb, drift.offset);
+    EXPECT_EQ(baseOffset + 49 * driftPpb, GetClockOffsetAt(drift, 50 * period));
+
+    estimator.Reset();
+    EXPECT_EQ(0, estimator.GetSampleCount());
+}
+
+HWTEST_F(AvSyncUtilsTest, AVSyncDriftEstimator_002, TestSize.Level1)
+{
+    const int64_t period = 1000000000;
+    const int64_t offset = 1000000;
+    const int64_t stepOffset = 50000000;
+    AVSyncDriftEstimator estimator;
+    for (int64_t i = 1; i <= 8; i++) {
+        estimator.AddSample(i * period, offset);
+    }
+    estimator.AddSample(8 * period, offset);
+    EXPECT_EQ(8, estimator.GetSampleCount());
+
+    estimator.AddSample(9 * period, stepOffset);
+    AVSyncClockDrift drift = { 0, 0, 0 };
+    ASSERT_TRUE(estimator.GetDrift(drift));
+    EXPECT_EQ(offset, drift.offset);
+    EXPECT_EQ(8, estimator.GetSampleCount());
+
+    for (int64_t i = 10; i <= 12; i++) {
+        estimator.AddSample(i * period, stepOffset);
+    }
+    EXPECT_EQ(1, estimator.GetSampleCount());
+    ASSERT_TRUE(estimator.GetDrift(drift));
+    EXPECT_EQ(stepOffset, drift.offset);
+}
+
+HWTEST_F(AvSyncUtilsTest, MapAVTransSharedMemory_001, TestSize.Level1)
+{
+    AVTransSharedMemory memory = {
+        .fd = -1,
+        .size = 100,
+        .name = "name_test",
+    };
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, MapAVTransSharedMemory(memory));
+
+    memory.fd = 1;
+    memory.size = 10;
+    EXPECT_EQ(ERR_DH_AVT_SHARED_MEMORY_FAILED, MapAVTransSharedMemory(memory));
+    EXPECT_EQ(nullptr, memory.addr);
+
+    UnmapAVTransSharedMemory(memory);
+    EXPECT_EQ(nullptr, memory.addr);
+}
+
 HWTEST_F(AvSyncUtilsTest, SetAccessConfig_001, TestSize.Level1)
 {
     DAudioAccessConfigManager::GetInstance().ClearAccessConfig();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -26,6 +26,7 @@
 #include "osal/task/mutex.h"
 #include "osal/task/task.h"
 
+#include "filter_metrics.h"
 #include "pipeline_event.h"
 #include "pipeline_status.h"
 
@@ -215,6 +216,11 @@ public:
     }
 
     virtual bool IsDesignatedState(FilterState state);
+
+    FilterMetrics& GetMetrics();
+
+    // Appends the metrics of this filter and of every filter linked after it.
+    void DumpMetrics(std::string& result);
 protected:
     virtual Status PrepareDone() final;
 
@@ -228,6 +234,8 @@ protected:
 
     virtual Status ReleaseDone() final;
 
+    void RecordProcessResult(Status ret, bool dropFrame, int64_t costUs);
+
     std::string name_;
 
     std::shared_ptr<Media::Meta> meta_;
@@ -262,6 +270,8 @@ protected:
     std::string groupId_;
 
     bool isAsyncMode_;
+
+    FilterMetrics metrics_;
 };
 
 enum FilterPlaybackCommand {
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AV_PIPELINE_FILTER_METRICS_H
+#define OHOS_AV_PIPELINE_FILTER_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace Pipeline {
+enum class FilterDropReason : uint8_t {
+    FLUSH = 0,
+    QUEUE_FULL,
+    INVALID_BUFFER,
+    PROCESS_FAILED,
+    COUNT,
+};
+
+// Codec features a filter can switch on at runtime, reported as a bit mask.
+enum FilterCodecFeature : uint32_t {
+    FILTER_CODEC_FEATURE_FEC = 1U << 0,
+    FILTER_CODEC_FEATURE_DTX = 1U << 1,
+};
+
+constexpr size_t FILTER_DROP_REASON_COUNT = static_cast<size_t>(FilterDropReason::COUNT);
+// Bucket 0 holds costs below 1us, bucket n holds [2^(n-1), 2^n) us and the last one everything above.
+constexpr size_t FILTER_PROCESS_TIME_BUCKETS = 16;
+
+struct FilterMetricsSnapshot {
+    uint64_t inBuffers = 0;
+    uint64_t outBuffers = 0;
+    uint64_t inBytes = 0;
+    uint64_t outBytes = 0;
+    uint64_t processCount = 0;
+    uint64_t processTimeSumUs = 0;
+    uint64_t processTimeMaxUs = 0;
+    uint64_t queueHighWater = 0;
+    uint64_t codecAdaptations = 0;
+    uint64_t codecBitRate = 0;
+    uint32_t codecFeatures = 0;
+    std::array<uint64_t, FILTER_PROCESS_TIME_BUCKETS> processTimeHistogram {};
+    std::array<uint64_t, FILTER_DROP_REASON_COUNT> drops {};
+};
+
+/**
+ * Counters of one filter. Every update is a relaxed atomic, so the data path never takes a lock;
+ * a snapshot is therefore only consistent per counter, which is enough for dump and trace.
+ */
+class FilterMetrics {
+public:
+    void OnInputBuffer(uint64_t bytes);
+    void OnOutputBuffer(uint64_t bytes);
+    // Returns true once every FILTER_METRICS_TRACE_INTERVAL calls, when the caller should emit trace counters.
+    bool OnProcessDone(int64_t costUs);
+    void OnDrop(FilterDropReason reason);
+    void OnQueueDepth(uint64_t depth);
+    // Called when the filter retunes its codec, with the bit rate and FilterCodecFeature mask now in use.
+    void OnCodecAdapted(uint64_t bitRate, uint32_t features);
+    void Reset();
+    FilterMetricsSnapshot GetSnapshot() const;
+    void Dump(const std::string &name, std::string &result) const;
+    void TraceCounters(const std::string &name) const;
+
+    static size_t GetProcessTimeBucket(int64_t costUs);
+    static const char *GetDropReasonName(FilterDropReason reason);
+
+private:
+    static void UpdateMax(std::atomic<uint64_t> &target, uint64_t value);
+
+    std::atomic<uint64_t> inBuffers_ {0};
+    std::atomic<uint64_t> outBuffers_ {0};
+    std::atomic<uint64_t> inBytes_ {0};
+    std::atomic<uint64_t> outBytes_ {0};
+    std::atomic<uint64_t> processCount_ {0};
+    std::atomic<uint64_t> processTimeSumUs_ {0};
+    std::atomic<uint64_t> processTimeMaxUs_ {0};
+    std::atomic<uint64_t> queueDepth_ {0};
+    std::atomic<uint64_t> queueHighWater_ {0};
+    std::atomic<uint64_t> codecAdaptations_ {0};
+    std::atomic<uint64_t> codecBitRate_ {0};
+    std::atomic<uint32_t> codecFeatures_ {0};
+    std::array<std::atomic<uint64_t>, FILTER_PROCESS_TIME_BUCKETS> processTimeHistogram_ {};
+    std::array<std::atomic<uint64_t>, FILTER_DROP_REASON_COUNT> drops_ {};
+};
+} // namespace Pipeline
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_AV_PIPELINE_FILTER_METRICS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,7 @@
 #include "filter.h"
 
 #include <algorithm>
+#include <chrono>
 
 #include "osal/utils/util.h"
 
@@ -27,6 +28,14 @@
 namespace OHOS {
 namespace DistributedHardware {
 namespace Pipeline {
+namespace {
+int64_t GetSteadyTimeUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}
+
 Filter::Filter(std::string name, FilterType type, bool isAsyncMode)
     : name_(std::move(name)), filterType_(type), curState_(FilterState::ERROR), isAsyncMode_(isAsyncMode)
 {
@@ -401,13 +410,19 @@ Status Filter::ProcessInputBuffer(int sendArg, int64_t delayUs)
     AVTRANS_LOGD("Filter::ProcessInputBuffer  %{public}s", name_.c_str());
     if (filterTask_) {
         jobIdx_++;
+        metrics_.OnQueueDepth(static_cast<uint64_t>(std::max<int64_t>(jobIdx_ - processIdx_, 0)));
         filterTask_->SubmitJob([this, sendArg]() {
             processIdx_++;
-            DoProcessInputBuffer(sendArg, processIdx_ <= jobIdxBase_);  // drop frame after flush
+            bool dropFrame = processIdx_ <= jobIdxBase_;  // drop frame after flush
+            int64_t startUs = GetSteadyTimeUs();
+            Status ret = DoProcessInputBuffer(sendArg, dropFrame);
+            RecordProcessResult(ret, dropFrame, GetSteadyTimeUs() - startUs);
             }, delayUs, false);
     } else {
         Media::Task::SleepInTask(delayUs / 1000); // 1000 convert to ms
-        DoProcessInputBuffer(sendArg, false);
+        int64_t startUs = GetSteadyTimeUs();
+        Status ret = DoProcessInputBuffer(sendArg, false);
+        RecordProcessResult(ret, false, GetSteadyTimeUs() - startUs);
     }
     return Status::OK;
 }
@@ -418,18 +433,53 @@ Status Filter::ProcessOutputBuffer(int sendArg, int64_t delayUs, bool byIdx, uin
     if (filterTask_) {
         jobIdx_++;
         int64_t processIdx = jobIdx_;
+        metrics_.OnQueueDepth(static_cast<uint64_t>(std::max<int64_t>(jobIdx_ - processIdx_, 0)));
         filterTask_->SubmitJob([this, sendArg, processIdx, byIdx, idx, renderTime]() {
             processIdx_++;
             // drop frame after flush
-            DoProcessOutputBuffer(sendArg, processIdx <= jobIdxBase_, byIdx, idx, renderTime);
+            bool dropFrame = processIdx <= jobIdxBase_;
+            int64_t startUs = GetSteadyTimeUs();
+            Status ret = DoProcessOutputBuffer(sendArg, dropFrame, byIdx, idx, renderTime);
+            RecordProcessResult(ret, dropFrame, GetSteadyTimeUs() - startUs);
             }, delayUs, false);
     } else {
         Media::Task::SleepInTask(delayUs / 1000); // 1000 convert to ms
-        DoProcessOutputBuffer(sendArg, false, false, idx, renderTime);
+        int64_t startUs = GetSteadyTimeUs();
+        Status ret = DoProcessOutputBuffer(sendArg, false, false, idx, renderTime);
+        RecordProcessResult(ret, false, GetSteadyTimeUs() - startUs);
     }
     return Status::OK;
 }
 
+void Filter::RecordProcessResult(Status ret, bool dropFrame, int64_t costUs)
+{
+    if (dropFrame) {
+        metrics_.OnDrop(FilterDropReason::FLUSH);
+    } else if (ret != Status::OK) {
+        metrics_.OnDrop(FilterDropReason::PROCESS_FAILED);
+    }
+    if (metrics_.OnProcessDone(costUs)) {
+        metrics_.TraceCounters(name_);
+    }
+}
+
+FilterMetrics& Filter::GetMetrics()
+{
+    return metrics_;
+}
+
+void Filter::DumpMetrics(std::string& result)
+{
+    metrics_.Dump(name_, result);
+    for (auto iter : nextFiltersMap_) {
+        for (auto filter : iter.second) {
+            if (filter != nullptr) {
+                filter->DumpMetrics(result);
+            }
+        }
+    }
+}
+
 Status Filter::DoInitAfterLink()
 {
     AVTRANS_LOGI("Filter::DoInitAfterLink");
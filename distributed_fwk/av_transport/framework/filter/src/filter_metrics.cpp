@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "filter_metrics.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+#include "hitrace_meter.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace Pipeline {
+namespace {
+constexpr uint64_t FILTER_METRICS_TRACE_INTERVAL = 100;
+constexpr size_t DUMP_LINE_LEN = 256;
+}
+
+void FilterMetrics::OnInputBuffer(uint64_t bytes)
+{
+    inBuffers_.fetch_add(1, std::memory_order_relaxed);
+    inBytes_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void FilterMetrics::OnOutputBuffer(uint64_t bytes)
+{
+    outBuffers_.fetch_add(1, std::memory_order_relaxed);
+    outBytes_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+bool FilterMetrics::OnProcessDone(int64_t costUs)
+{
+    uint64_t cost = costUs > 0 ? static_cast<uint64_t>(costUs) : 0;
+    processTimeHistogram_[GetProcessTimeBucket(costUs)].fetch_add(1, std::memory_order_relaxed);
+    processTimeSumUs_.fetch_add(cost, std::memory_order_relaxed);
+    UpdateMax(processTimeMaxUs_, cost);
+    return (processCount_.fetch_add(1, std::memory_order_relaxed) + 1) % FILTER_METRICS_TRACE_INTERVAL == 0;
+}
+
+void FilterMetrics::OnDrop(FilterDropReason reason)
+{
+    if (reason >= FilterDropReason::COUNT) {
+        return;
+    }
+    drops_[static_cast<size_t>(reason)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void FilterMetrics::OnQueueDepth(uint64_t depth)
+{
+    queueDepth_.store(depth, std::memory_order_relaxed);
+    UpdateMax(queueHighWater_, depth);
+}
+
+void FilterMetrics::OnCodecAdapted(uint64_t bitRate, uint32_t features)
+{
+    codecBitRate_.store(bitRate, std::memory_order_relaxed);
+    codecFeatures_.store(features, std::memory_order_relaxed);
+    codecAdaptations_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FilterMetrics::Reset()
+{
+    inBuffers_.store(0, std::memory_order_relaxed);
+    outBuffers_.store(0, std::memory_order_relaxed);
+    inBytes_.store(0, std::memory_order_relaxed);
+    outBytes_.store(0, std::memory_order_relaxed);
+    processCount_.store(0, std::memory_order_relaxed);
+    processTimeSumUs_.store(0, std::memory_order_relaxed);
+    processTimeMaxUs_.store(0, std::memory_order_relaxed);
+    queueDepth_.store(0, std::memory_order_relaxed);
+    queueHighWater_.store(0, std::memory_order_relaxed);
+    codecAdaptations_.store(0, std::memory_order_relaxed);
+    codecBitRate_.store(0, std::memory_order_relaxed);
+    codecFeatures_.store(0, std::memory_order_relaxed);
+    for (auto &bucket : processTimeHistogram_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    for (auto &drop : drops_) {
+        drop.store(0, std::memory_order_relaxed);
+    }
+}
+
+FilterMetricsSnapshot FilterMetrics::GetSnapshot() const
+{
+    FilterMetricsSnapshot snapshot;
+    snapshot.inBuffers = inBuffers_.load(std::memory_order_relaxed);
+    snapshot.outBuffers = outBuffers_.load(std::memory_order_relaxed);
+    snapshot.inBytes = inBytes_.load(std::memory_order_relaxed);
+    snapshot.outBytes = outBytes_.load(std::memory_order_relaxed);
+    snapshot.processCount = processCount_.load(std::memory_order_relaxed);
+    snapshot.processTimeSumUs = processTimeSumUs_.load(std::memory_order_relaxed);
+    snapshot.processTimeMaxUs = processTimeMaxUs_.load(std::memory_order_relaxed);
+    snapshot.queueHighWater = queueHighWater_.load(std::memory_order_relaxed);
+    snapshot.codecAdaptations = codecAdaptations_.load(std::memory_order_relaxed);
+    snapshot.codecBitRate = codecBitRate_.load(std::memory_order_relaxed);
+    snapshot.codecFeatures = codecFeatures_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < FILTER_PROCESS_TIME_BUCKETS; i++) {
+        snapshot.processTimeHistogram[i] = processTimeHistogram_[i].load(std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < FILTER_DROP_REASON_COUNT; i++) {
+        snapshot.drops[i] = drops_[i].load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+void FilterMetrics::Dump(const std::string &name, std::string &result) const
+{
+    FilterMetricsSnapshot snapshot = GetSnapshot();
+    uint64_t avgUs = snapshot.processCount == 0 ? 0 : snapshot.processTimeSumUs / snapshot.processCount;
+    char line[DUMP_LINE_LEN] = {0};
+    int len = snprintf(line, sizeof(line), "[%s] in: %" PRIu64 "/%" PRIu64 "B, out: %" PRIu64 "/%" PRIu64
+        "B, process: %" PRIu64 " avg %" PRIu64 "us max %" PRIu64 "us, queue high water: %" PRIu64 "\n",
+        name.c_str(), snapshot.inBuffers, snapshot.inBytes, snapshot.outBuffers, snapshot.outBytes,
+        snapshot.processCount, avgUs, snapshot.processTimeMaxUs, snapshot.queueHighWater);
+    if (len > 0) {
+        result.append(line);
+    }
+    result.append("  process time(us):");
+    for (size_t i = 0; i < FILTER_PROCESS_TIME_BUCKETS; i++) {
+        if (snapshot.processTimeHistogram[i] == 0) {
+            continue;
+        }
+        std::string upper = (i + 1 == FILTER_PROCESS_TIME_BUCKETS) ? "inf" : std::to_string(1ULL << i);
+        result.append(" <" + upper + ":" + std::to_string(snapshot.processTimeHistogram[i]));
+    }
+    result.append("\n  drops:");
+    for (size_t i = 0; i < FILTER_DROP_REASON_COUNT; i++) {
+        result.append(std::string(" ") + GetDropReasonName(static_cast<FilterDropReason>(i)) + ":" +
+            std::to_string(snapshot.drops[i]));
+    }
+    result.append("\n");
+    if (snapshot.codecAdaptations == 0) {
+        return;
+    }
+    bool fec = (snapshot.codecFeatures & FILTER_CODEC_FEATURE_FEC) != 0;
+    bool dtx = (snapshot.codecFeatures & FILTER_CODEC_FEATURE_DTX) != 0;
+    result.append("  codec: bit rate " + std::to_string(snapshot.codecBitRate) + ", fec " + (fec ? "on" : "off") +
+        ", dtx " + (dtx ? "on" : "off") + ", adaptations " + std::to_string(snapshot.codecAdaptations) + "\n");
+}
+
+void FilterMetrics::TraceCounters(const std::string &name) const
+{
+    CountTrace(HITRACE_TAG_DISTRIBUTED_HARDWARE_FWK, name + "_inBuffers",
+        static_cast<int64_t>(inBuffers_.load(std::memory_order_relaxed)));
+    CountTrace(HITRACE_TAG_DISTRIBUTED_HARDWARE_FWK, name + "_outBuffers",
+        static_cast<int64_t>(outBuffers_.load(std::memory_order_relaxed)));
+    CountTrace(HITRACE_TAG_DISTRIBUTED_HARDWARE_FWK, name + "_queueDepth",
+        static_cast<int64_t>(queueDepth_.load(std::memory_order_relaxed)));
+    uint64_t drops = 0;
+    for (const auto &drop : drops_) {
+        drops += drop.load(std::memory_order_relaxed);
+    }
+    CountTrace(HITRACE_TAG_DISTRIBUTED_HARDWARE_FWK, name + "_drops", static_cast<int64_t>(drops));
+    if (codecAdaptations_.load(std::memory_order_relaxed) != 0) {
+        CountTrace(HITRACE_TAG_DISTRIBUTED_HARDWARE_FWK, name + "_codecBitRate",
+            static_cast<int64_t>(codecBitRate_.load(std::memory_order_relaxed)));
+    }
+}
+
+size_t FilterMetrics::GetProcessTimeBucket(int64_t costUs)
+{
+    size_t bucket = 0;
+    uint64_t cost = costUs > 0 ? static_cast<uint64_t>(costUs) : 0;
+    while (cost != 0 && bucket + 1 < FILTER_PROCESS_TIME_BUCKETS) {
+        cost >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+const char *FilterMetrics::GetDropReasonName(FilterDropReason reason)
+{
+    switch (reason) {
+        case FilterDropReason::FLUSH:
+            return "flush";
+        case FilterDropReason::QUEUE_FULL:
+            return "queue_full";
+        case FilterDropReason::INVALID_BUFFER:
+            return "invalid_buffer";
+        case FilterDropReason::PROCESS_FAILED:
+            return "process_failed";
+        default:
+            return "unknown";
+    }
+}
+
+void FilterMetrics::UpdateMax(std::atomic<uint64_t> &target, uint64_t value)
+{
+    uint64_t cur = target.load(std::memory_order_relaxed);
+    while (value > cur) {
+        if (target.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+} // namespace Pipeline
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -337,5 +337,78 @@ HWTEST_F(FilterTest, WaitAllState_001, testing::ext::TestSize.Level1)
     Status result4 = filter.WaitAllState(FilterState::RUNNING);
     EXPECT_EQ(result4, Status::OK);
 }
+
+HWTEST_F(FilterTest, FilterMetrics_001, testing::ext::TestSize.Level1)
+{
+    EXPECT_EQ(FilterMetrics::GetProcessTimeBucket(-1), 0);
+    EXPECT_EQ(FilterMetrics::GetProcessTimeBucket(0), 0);
+    EXPECT_EQ(FilterMetrics::GetProcessTimeBucket(1), 1);
+    EXPECT_EQ(FilterMetrics::GetProcessTimeBucket(3), 2);
+    EXPECT_EQ(FilterMetrics::GetProcessTimeBucket(1000000000), FILTER_PROCESS_TIME_BUCKETS - 1);
+
+    FilterMetrics metrics;
+    metrics.OnInputBuffer(100);
+    metrics.OnInputBuffer(50);
+    metrics.OnOutputBuffer(80);
+    metrics.OnQueueDepth(3);
+    metrics.OnQueueDepth(1);
+    metrics.OnDrop(FilterDropReason::QUEUE_FULL);
+    metrics.OnDrop(FilterDropReason::COUNT);
+    EXPECT_FALSE(metrics.OnProcessDone(10));
+    EXPECT_FALSE(metrics.OnProcessDone(30));
+    FilterMetricsSnapshot snapshot = metrics.GetSnapshot();
+    EXPECT_EQ(snapshot.inBuffers, 2);
+    EXPECT_EQ(snapshot.inBytes, 150);
+    EXPECT_EQ(snapshot.outBuffers, 1);
+    EXPECT_EQ(snapshot.outBytes, 80);
+    EXPECT_EQ(snapshot.queueHighWater, 3);
+    EXPECT_EQ(snapshot.processCount, 2);
+    EXPECT_EQ(snapshot.processTimeSumUs, 40);
+    EXPECT_EQ(snapshot.processTimeMaxUs, 30);
+    EXPECT_EQ(snapshot.processTimeHistogram[FilterMetrics::GetProcessTimeBucket(10)], 1);
+    EXPECT_EQ(snapshot.drops[static_cast<size_t>(FilterDropReason::QUEUE_FULL)], 1);
+
+    metrics.Reset();
+    snapshot = metrics.GetSnapshot();
+    EXPECT_EQ(snapshot.inBuffers, 0);
+    EXPECT_EQ(snapshot.queueHighWater, 0);
+    EXPECT_EQ(snapshot.drops[static_cast<size_t>(FilterDropReason::QUEUE_FULL)], 0);
+}
+
+HWTEST_F(FilterTest, FilterMetrics_002, testing::ext::TestSize.Level1)
+{
+    FilterMetrics metrics;
+    std::string result;
+    metrics.Dump("testFilter", result);
+    EXPECT_EQ(result.find("codec:"), std::string::npos);
+
+    metrics.OnCodecAdapted(24000, FILTER_CODEC_FEATURE_FEC);
+    metrics.OnCodecAdapted(16000, FILTER_CODEC_FEATURE_FEC | FILTER_CODEC_FEATURE_DTX);
+    FilterMetricsSnapshot snapshot = metrics.GetSnapshot();
+    EXPECT_EQ(snapshot.codecAdaptations, 2);
+    EXPECT_EQ(snapshot.codecBitRate, 16000);
+    EXPECT_EQ(snapshot.codecFeatures, FILTER_CODEC_FEATURE_FEC | FILTER_CODEC_FEATURE_DTX);
+    result.clear();
+    metrics.Dump("testFilter", result);
+    EXPECT_NE(result.find("codec: bit rate 16000, fec on, dtx on, adaptations 2"), std::string::npos);
+
+    metrics.Reset();
+    EXPECT_EQ(metrics.GetSnapshot().codecAdaptations, 0);
+}
+
+HWTEST_F(FilterTest, DumpMetrics_001, testing::ext::TestSize.Level1)
+{
+    Filter filter("testFilter", FilterType::FILTERTYPE_VENC, false);
+    auto nextFilter = std::make_shared<Filter>("nextFilter", FilterType::FILTERTYPE_ASINK, false);
+    filter.nextFiltersMap_[StreamType::STREAMTYPE_ENCODED_AUDIO].push_back(nullptr);
+    filter.nextFiltersMap_[StreamType::STREAMTYPE_ENCODED_AUDIO].push_back(nextFilter);
+    EXPECT_EQ(filter.ProcessInputBuffer(0, 0), Status::OK);
+    EXPECT_EQ(filter.GetMetrics().GetSnapshot().processCount, 1);
+
+    std::string result;
+    filter.DumpMetrics(result);
+    EXPECT_NE(result.find("[testFilter]"), std::string::npos);
+    EXPECT_NE(result.find("[nextFilter]"), std::string::npos);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -70,6 +70,8 @@ public:
 
     void OnEvent(const Event& event) override;
 
+    void DumpMetrics(std::string& result);
+
     static int32_t GetNextPipelineId();
 private:
     std::string groupId_;
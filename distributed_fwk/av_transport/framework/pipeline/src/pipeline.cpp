@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -372,6 +372,16 @@ Status Pipeline::UnLinkFilters(const std::shared_ptr<Filter> &preFilter,
 void Pipeline::OnEvent(const Event& event)
 {
 }
+
+void Pipeline::DumpMetrics(std::string& result)
+{
+    Media::AutoLock lock(mutex_);
+    for (auto it = filters_.begin(); it != filters_.end(); ++it) {
+        if (*it != nullptr) {
+            (*it)->DumpMetrics(result);
+        }
+    }
+}
 } // namespace Pipeline
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -75,6 +75,19 @@ public:
      */
     virtual int32_t SetParameter(AVTransTag tag, const std::string &value) = 0;
 
+    /**
+     * @brief Set the items of a typed configuration to the receiver engine in one call.
+     * All items are checked before any of them reaches the pipeline filters. A started engine takes only the items
+     * of ENGINE_CONFIG_LIVE_ITEMS, e.g. a bitrate or resolution change, without preparing the pipeline again.
+     * @param config  engine configuration.
+     * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+     */
+    virtual int32_t SetEngineConfig(const AVTransEngineConfig &config)
+    {
+        (void)config;
+        return ERR_DH_AVT_UNIMPLEMENTED;
+    }
+
     /**
      * @brief Send message to the receiver engine or the source device.
      * @param message  message content.
@@ -112,6 +125,17 @@ public:
      * @return Returns BOOL(0)
      */
     virtual bool ReStartDumpMediaData() = 0;
+
+    /**
+     * @brief Get the per-filter metrics of the engine pipeline in readable text, e.g. for hidumper.
+     * @param metrics  output metrics text.
+     * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+     */
+    virtual int32_t GetPipelineMetrics(std::string &metrics)
+    {
+        (void)metrics;
+        return ERR_DH_AVT_UNIMPLEMENTED;
+    }
 };
 } // DistributedHardware
 } // OHOS
@@ -25,10 +25,18 @@ namespace DistributedHardware {
     constexpr uint32_t MAX_DB_RECORD_SIZE = 10000;
     constexpr uint32_t MAX_ONLINE_DEVICE_SIZE = 10000;
     constexpr uint32_t MAX_DH_DESCRIPTOR_ARRAY_SIZE = 4096;
+    constexpr uint32_t MAX_NETWORK_ID_ARRAY_SIZE = 256;
+    /* Upper bound of a local sys spec reply, sent as raw data so the IPC layer may move it through ashmem */
+    constexpr uint32_t MAX_SYS_SPEC_SIZE = 4 * 1024 * 1024;
     constexpr uint32_t EVENT_VERSION_INFO_DB_RECOVER = 101;
     constexpr uint32_t EVENT_CAPABILITY_INFO_DB_RECOVER = 201;
+    constexpr uint32_t EVENT_CAPABILITY_INFO_EVICT = 202;
     constexpr uint32_t EVENT_DATA_SYNC_MANUAL = 301;
     constexpr uint32_t EVENT_META_INFO_DB_RECOVER = 401;
+    /* Capability record encodings, negotiated through the version info of every device */
+    constexpr uint32_t CAP_CODEC_JSON = 0;
+    constexpr uint32_t CAP_CODEC_BINARY_V1 = 1;
+    constexpr uint32_t CAP_CODEC_LOCAL_VERSION = CAP_CODEC_BINARY_V1;
 
     const std::string RESOURCE_SEPARATOR = "###";
     const std::string DH_FWK_PKG_NAME = "ohos.dhardware";
@@ -44,6 +52,7 @@ namespace DistributedHardware {
     constexpr const char *DEV_UDID_HASH = "udid_hash";
     constexpr const char *DH_VER = "dh_ver";
     constexpr const char *COMP_VER = "comp_ver";
+    constexpr const char *CAP_CODEC_VER = "cap_codec_ver";
     constexpr const char *NAME = "name";
     constexpr const char *TYPE = "type";
     constexpr const char *HANDLER = "handler";
@@ -52,6 +61,7 @@ namespace DistributedHardware {
     constexpr const char *SOURCE_FEATURE_FILTER = "source_feature_filter";
     constexpr const char *SINK_SUPPORTED_FEATURE = "sink_supported_feature";
     constexpr const char *LOW_LATENCY_ENABLE = "low_latency_enable";
+    constexpr const char *LOW_LATENCY_SESSION = "low_latency_session";
     constexpr const char *DO_RECOVER = "DoRecover";
     constexpr const char *SEND_ONLINE = "SendOnLine";
     constexpr const char *COMPONENTSLOAD_PROFILE_PATH =
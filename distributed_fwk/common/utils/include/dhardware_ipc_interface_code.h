@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -51,6 +51,8 @@ enum class DHMsgInterfaceCode : uint32_t {
     REGISTER_HARDWARE_ACCESS_LISTENER = 480024,
     UNREGISTER_HARDWARE_ACCESS_LISTENER = 480025,
     SET_AUTHORIZATION_RESULT = 480026,
+    GET_DISTRIBUTED_HARDWARE_BATCH = 480027,
+    GET_DISTRIBUTED_HARDWARE_BY_TYPE = 480028,
 };
 } // namespace DistributedHardware
 } // namespace OHOS
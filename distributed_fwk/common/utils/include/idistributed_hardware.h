@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -55,6 +55,10 @@ public:
     virtual int32_t StopDistributedHardware(DHType dhType, const std::string &networkId) = 0;
     virtual int32_t GetDistributedHardware(const std::string &networkId, EnableStep enableStep,
         const sptr<IGetDhDescriptorsCallback> callback) = 0;
+    virtual int32_t GetDistributedHardwareBatch(const std::vector<std::string> &networkIds, EnableStep enableStep,
+        const sptr<IGetDhDescriptorsCallback> callback) = 0;
+    virtual int32_t GetDistributedHardwareByType(const std::string &networkId, DHType dhType, const std::string &dhId,
+        EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback) = 0;
     virtual int32_t RegisterDHStatusListener(sptr<IHDSinkStatusListener> listener) = 0;
     virtual int32_t UnregisterDHStatusListener(sptr<IHDSinkStatusListener> listener) = 0;
     virtual int32_t RegisterDHStatusListener(const std::string &networkId, sptr<IHDSourceStatusListener> listener) = 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -166,6 +166,28 @@ public:
     API_EXPORT int32_t GetDistributedHardware(const std::string &networkId, EnableStep enableStep,
         const sptr<IGetDhDescriptorsCallback> callback);
 
+    /**
+     * @brief Get distributed hardware of several devices in one call.
+     *
+     * @param networkIds distributed hardware networkId list.
+     * @param callback called once per device with its descriptor list.
+     * @return Returns 0 if success.
+     */
+    API_EXPORT int32_t GetDistributedHardwareBatch(const std::vector<std::string> &networkIds, EnableStep enableStep,
+        const sptr<IGetDhDescriptorsCallback> callback);
+
+    /**
+     * @brief Get distributed hardware of one type only, which does not wait for the other types to sync.
+     *
+     * @param networkId distributed hardware networkId.
+     * @param dhType distributed hardware type.
+     * @param dhId distributed hardware id of the type, empty for all of them.
+     * @param callback called with the descriptor list.
+     * @return Returns 0 if success.
+     */
+    API_EXPORT int32_t GetDistributedHardwareByType(const std::string &networkId, DHType dhType,
+        const std::string &dhId, EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback);
+
     /**
      * @brief Register distributed hardware status listener.
      *
@@ -361,6 +361,51 @@ int32_t DistributedHardwareFwkKit::GetDistributedHardware(const std::string &net
     return proxy->GetDistributedHardware(networkId, enableStep, callback);
 }
 
+int32_t DistributedHardwareFwkKit::GetDistributedHardwareBatch(const std::vector<std::string> &networkIds,
+    EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback)
+{
+    if (networkIds.empty() || networkIds.size() > MAX_NETWORK_ID_ARRAY_SIZE) {
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    DHLOGI("Get distributed hardware batch, size: %{public}zu.", networkIds.size());
+    if (DHFWKSAManager::GetInstance().GetDHFWKProxy() == nullptr) {
+        DHLOGE("DHFWK not online or get proxy failed, try to load DFWK service.");
+        if (LoadDistributedHardwareSA() != DH_FWK_SUCCESS) {
+            DHLOGE("Load distributed hardware SA failed, can not load distributed HDF.");
+            return ERR_DH_FWK_POINTER_IS_NULL;
+        }
+    }
+    auto proxy = DHFWKSAManager::GetInstance().GetDHFWKProxy();
+    if (proxy == nullptr) {
+        DHLOGE("DHFWK proxy is null, can not load distributed HDF.");
+        return ERR_DH_FWK_POINTER_IS_NULL;
+    }
+    return proxy->GetDistributedHardwareBatch(networkIds, enableStep, callback);
+}
+
+int32_t DistributedHardwareFwkKit::GetDistributedHardwareByType(const std::string &networkId, DHType dhType,
+    const std::string &dhId, EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback)
+{
+    if (!IsIdLengthValid(networkId) || (!dhId.empty() && !IsIdLengthValid(dhId))) {
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    DHLOGI("Get distributed hardware networkId %{public}s, dhType %{public}#X.", GetAnonyString(networkId).c_str(),
+        dhType);
+    if (DHFWKSAManager::GetInstance().GetDHFWKProxy() == nullptr) {
+        DHLOGE("DHFWK not online or get proxy failed, try to load DFWK service.");
+        if (LoadDistributedHardwareSA() != DH_FWK_SUCCESS) {
+            DHLOGE("Load distributed hardware SA failed, can not load distributed HDF.");
+            return ERR_DH_FWK_POINTER_IS_NULL;
+        }
+    }
+    auto proxy = DHFWKSAManager::GetInstance().GetDHFWKProxy();
+    if (proxy == nullptr) {
+        DHLOGE("DHFWK proxy is null, can not load distributed HDF.");
+        return ERR_DH_FWK_POINTER_IS_NULL;
+    }
+    return proxy->GetDistributedHardwareByType(networkId, dhType, dhId, enableStep, callback);
+}
+
 int32_t DistributedHardwareFwkKit::RegisterDHStatusListener(sptr<IHDSinkStatusListener> listener)
 {
     DHLOGI("Register distributed hardware status sink listener.");
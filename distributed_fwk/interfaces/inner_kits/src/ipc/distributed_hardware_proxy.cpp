@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -212,7 +212,17 @@ std::string DistributedHardwareProxy::QueryLocalSysSpec(QueryLocalSysSpecType sp
         return "";
     }
 
-    std::string specStr = reply.ReadString();
+    uint32_t specSize = reply.ReadUint32();
+    if (specSize == 0 || specSize > MAX_SYS_SPEC_SIZE) {
+        DHLOGE("Local sys spec size is invalid, size: %{public}" PRIu32, specSize);
+        return "";
+    }
+    const char *specData = reinterpret_cast<const char *>(reply.ReadRawData(specSize));
+    if (specData == nullptr) {
+        DHLOGE("Read local sys spec failed");
+        return "";
+    }
+    std::string specStr(specData, specSize);
     DHLOGI("Query local sys spec %{public}" PRIu32 ", get: %{public}s", (uint32_t)spec, specStr.c_str());
     return specStr;
 }
@@ -575,6 +585,92 @@ int32_t DistributedHardwareProxy::GetDistributedHardware(const std::string &netw
     return reply.ReadInt32();
 }
 
+int32_t DistributedHardwareProxy::GetDistributedHardwareBatch(const std::vector<std::string> &networkIds,
+    EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback)
+{
+    DHLOGI("DistributedHardwareProxy GetDistributedHardwareBatch, size: %{public}zu.", networkIds.size());
+    if (networkIds.empty() || callback == nullptr) {
+        DHLOGE("networkIds is empty or callback is null");
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        DHLOGE("remote service is null!");
+        return ERR_DH_AVT_SERVICE_REMOTE_IS_NULL;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        DHLOGE("WriteInterfaceToken fail!");
+        return ERR_DH_AVT_SERVICE_WRITE_TOKEN_FAIL;
+    }
+    int32_t ret = WriteNetworkIds(data, networkIds);
+    if (ret != NO_ERROR) {
+        return ret;
+    }
+    if (!data.WriteUint32(static_cast<uint32_t>(enableStep))) {
+        DHLOGE("Write enableStep failed!");
+        return ERR_DH_AVT_SERVICE_WRITE_INFO_FAIL;
+    }
+    if (!data.WriteRemoteObject(callback->AsObject())) {
+        DHLOGE("Write callback failed!");
+        return ERR_DH_FWK_SERVICE_WRITE_INFO_FAIL;
+    }
+    ret = remote->SendRequest(static_cast<uint32_t>(DHMsgInterfaceCode::GET_DISTRIBUTED_HARDWARE_BATCH),
+        data, reply, option);
+    if (ret != NO_ERROR) {
+        DHLOGE("Send Request failed, ret: %{public}d!", ret);
+        return ERR_DH_AVT_SERVICE_IPC_SEND_REQUEST_FAIL;
+    }
+    return reply.ReadInt32();
+}
+
+int32_t DistributedHardwareProxy::GetDistributedHardwareByType(const std::string &networkId, DHType dhType,
+    const std::string &dhId, EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback)
+{
+    DHLOGI("DistributedHardwareProxy GetDistributedHardwareByType, dhType: %{public}#X.", dhType);
+    if (!IsIdLengthValid(networkId) || (!dhId.empty() && !IsIdLengthValid(dhId))) {
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    if (callback == nullptr) {
+        DHLOGE("get distributed hardware callback is null");
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        DHLOGE("remote service is null!");
+        return ERR_DH_AVT_SERVICE_REMOTE_IS_NULL;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        DHLOGE("WriteInterfaceToken fail!");
+        return ERR_DH_AVT_SERVICE_WRITE_TOKEN_FAIL;
+    }
+    if (!data.WriteString(networkId) || !data.WriteUint32(static_cast<uint32_t>(dhType)) ||
+        !data.WriteString(dhId)) {
+        DHLOGE("Write networkId, dhType or dhId failed!");
+        return ERR_DH_AVT_SERVICE_WRITE_INFO_FAIL;
+    }
+    if (!data.WriteUint32(static_cast<uint32_t>(enableStep))) {
+        DHLOGE("Write enableStep failed!");
+        return ERR_DH_AVT_SERVICE_WRITE_INFO_FAIL;
+    }
+    if (!data.WriteRemoteObject(callback->AsObject())) {
+        DHLOGE("Write callback failed!");
+        return ERR_DH_FWK_SERVICE_WRITE_INFO_FAIL;
+    }
+    int32_t ret = remote->SendRequest(static_cast<uint32_t>(DHMsgInterfaceCode::GET_DISTRIBUTED_HARDWARE_BY_TYPE),
+        data, reply, option);
+    if (ret != NO_ERROR) {
+        DHLOGE("Send Request failed, ret: %{public}d!", ret);
+        return ERR_DH_AVT_SERVICE_IPC_SEND_REQUEST_FAIL;
+    }
+    return reply.ReadInt32();
+}
+
 int32_t DistributedHardwareProxy::RegisterDHStatusListener(sptr<IHDSinkStatusListener> listener)
 {
     DHLOGI("DistributedHardwareProxy RegisterDHStatusListener.");
@@ -954,6 +1050,24 @@ int32_t DistributedHardwareProxy::WriteDescriptors(MessageParcel &data, const st
     return NO_ERROR;
 }
 
+int32_t DistributedHardwareProxy::WriteNetworkIds(MessageParcel &data, const std::vector<std::string> &networkIds)
+{
+    if (networkIds.size() > MAX_NETWORK_ID_ARRAY_SIZE) {
+        DHLOGE("The array networkIds are too large, size: %{public}zu!", networkIds.size());
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    for (const auto &networkId : networkIds) {
+        if (!IsIdLengthValid(networkId)) {
+            return ERR_DH_FWK_PARA_INVALID;
+        }
+    }
+    if (!data.WriteStringVector(networkIds)) {
+        DHLOGE("Write networkIds failed!");
+        return ERR_DH_AVT_SERVICE_WRITE_INFO_FAIL;
+    }
+    return NO_ERROR;
+}
+
 int32_t DistributedHardwareProxy::LoadSinkDMSDPService(const std::string &udid)
 {
     DHLOGI("LoadSinkDMSDPService Start");
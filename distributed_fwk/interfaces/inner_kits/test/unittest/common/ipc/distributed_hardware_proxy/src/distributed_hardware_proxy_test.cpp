@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include "distributed_hardware_proxy_test.h"
 
+#include "constants.h"
 #include "dhardware_ipc_interface_code.h"
 #include "av_trans_errno.h"
 
@@ -37,7 +38,9 @@ void DistributedHardwareProxyTest::TearDown() {}
 int32_t DistributedHardwareProxyTest::TestDistributedHardwareStub2::OnRemoteRequest(uint32_t code, MessageParcel &data,
     MessageParcel &reply, MessageOption &option)
 {
-    if (code == static_cast<uint32_t>(DHMsgInterfaceCode::GET_DISTRIBUTED_HARDWARE)) {
+    if (code == static_cast<uint32_t>(DHMsgInterfaceCode::GET_DISTRIBUTED_HARDWARE) ||
+        code == static_cast<uint32_t>(DHMsgInterfaceCode::GET_DISTRIBUTED_HARDWARE_BATCH) ||
+        code == static_cast<uint32_t>(DHMsgInterfaceCode::GET_DISTRIBUTED_HARDWARE_BY_TYPE)) {
         return DH_FWK_SUCCESS;
     }
     return OHOS::DistributedHardware::DistributedHardwareStub::OnRemoteRequest(code, data, reply, option);
@@ -150,6 +153,27 @@ int32_t DistributedHardwareProxyTest::TestDistributedHardwareStub::GetDistribute
     return DH_FWK_SUCCESS;
 }
 
+int32_t DistributedHardwareProxyTest::TestDistributedHardwareStub::GetDistributedHardwareBatch(
+    const std::vector<std::string> &networkIds, EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback)
+{
+    (void)networkIds;
+    (void)enableStep;
+    (void)callback;
+    return DH_FWK_SUCCESS;
+}
+
+int32_t DistributedHardwareProxyTest::TestDistributedHardwareStub::GetDistributedHardwareByType(
+    const std::string &networkId, DHType dhType, const std::string &dhId, EnableStep enableStep,
+    const sptr<IGetDhDescriptorsCallback> callback)
+{
+    (void)networkId;
+    (void)dhType;
+    (void)dhId;
+    (void)enableStep;
+    (void)callback;
+    return DH_FWK_SUCCESS;
+}
+
 int32_t DistributedHardwareProxyTest::TestDistributedHardwareStub::RegisterDHStatusListener(
     sptr<IHDSinkStatusListener> listener)
 {
@@ -626,6 +650,67 @@ HWTEST_F(DistributedHardwareProxyTest, GetDistributedHardware_002, TestSize.Leve
     EXPECT_EQ(DH_FWK_SUCCESS, ret);
 }
 
+HWTEST_F(DistributedHardwareProxyTest, GetDistributedHardwareBatch_001, TestSize.Level1)
+{
+    sptr<IRemoteObject> dhStubPtr(new TestDistributedHardwareStub());
+    ASSERT_TRUE(dhStubPtr != nullptr);
+    DistributedHardwareProxy dhProxy(dhStubPtr);
+    sptr<IGetDhDescriptorsCallback> callback(new TestGetDistributedHardwareCallback());
+    ASSERT_TRUE(callback != nullptr);
+    EnableStep enableStep = EnableStep::ENABLE_SOURCE;
+    auto ret = dhProxy.GetDistributedHardwareBatch({}, enableStep, callback);
+    EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, ret);
+    ret = dhProxy.GetDistributedHardwareBatch({ "123456", std::string() }, enableStep, callback);
+    EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, ret);
+    std::vector<std::string> networkIds(MAX_NETWORK_ID_ARRAY_SIZE + 1, "123456");
+    ret = dhProxy.GetDistributedHardwareBatch(networkIds, enableStep, callback);
+    EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, ret);
+    ret = dhProxy.GetDistributedHardwareBatch({ "123456", "654321" }, enableStep, callback);
+    EXPECT_EQ(ERR_DH_AVT_SERVICE_IPC_SEND_REQUEST_FAIL, ret);
+}
+
+HWTEST_F(DistributedHardwareProxyTest, GetDistributedHardwareBatch_002, TestSize.Level1)
+{
+    sptr<IRemoteObject> dhStubPtr(new TestDistributedHardwareStub2());
+    ASSERT_TRUE(dhStubPtr != nullptr);
+    sptr<IGetDhDescriptorsCallback> callback(new TestGetDistributedHardwareCallback());
+    ASSERT_TRUE(callback != nullptr);
+    DistributedHardwareProxy dhProxy(dhStubPtr);
+    auto ret = dhProxy.GetDistributedHardwareBatch({ "123456", "654321" }, EnableStep::ENABLE_SOURCE, callback);
+    EXPECT_EQ(DH_FWK_SUCCESS, ret);
+}
+
+HWTEST_F(DistributedHardwareProxyTest, GetDistributedHardwareByType_001, TestSize.Level1)
+{
+    sptr<IRemoteObject> dhStubPtr(new TestDistributedHardwareStub());
+    ASSERT_TRUE(dhStubPtr != nullptr);
+    DistributedHardwareProxy dhProxy(dhStubPtr);
+    sptr<IGetDhDescriptorsCallback> callback(new TestGetDistributedHardwareCallback());
+    ASSERT_TRUE(callback != nullptr);
+    EnableStep enableStep = EnableStep::ENABLE_SOURCE;
+    auto ret = dhProxy.GetDistributedHardwareByType("", DHType::CAMERA, "", enableStep, callback);
+    EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, ret);
+    ret = dhProxy.GetDistributedHardwareByType("123456", DHType::CAMERA, std::string(300, 'a'), enableStep,
+        callback);
+    EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, ret);
+    ret = dhProxy.GetDistributedHardwareByType("123456", DHType::CAMERA, "", enableStep, nullptr);
+    EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, ret);
+    ret = dhProxy.GetDistributedHardwareByType("123456", DHType::CAMERA, "camera_1", enableStep, callback);
+    EXPECT_EQ(ERR_DH_AVT_SERVICE_IPC_SEND_REQUEST_FAIL, ret);
+}
+
+HWTEST_F(DistributedHardwareProxyTest, GetDistributedHardwareByType_002, TestSize.Level1)
+{
+    sptr<IRemoteObject> dhStubPtr(new TestDistributedHardwareStub2());
+    ASSERT_TRUE(dhStubPtr != nullptr);
+    sptr<IGetDhDescriptorsCallback> callback(new TestGetDistributedHardwareCallback());
+    ASSERT_TRUE(callback != nullptr);
+    DistributedHardwareProxy dhProxy(dhStubPtr);
+    auto ret = dhProxy.GetDistributedHardwareByType("123456", DHType::CAMERA, "", EnableStep::ENABLE_SOURCE,
+        callback);
+    EXPECT_EQ(DH_FWK_SUCCESS, ret);
+}
+
 HWTEST_F(DistributedHardwareProxyTest, RegisterDHStatusListener_Source_001, TestSize.Level1)
 {
     std::string networkId = "123456";
@@ -17,10 +17,13 @@
 #define OHOS_DH_NATIVE_DISTRIBUTED_HARDWARE_JS_H
 
 #include <string>
+#include <vector>
 
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
 
+#include "device_type.h"
+
 constexpr int32_t ALL = 0;
 constexpr int32_t CAMERA = 1;
 constexpr int32_t SCREEN = 8;
@@ -29,6 +32,23 @@ constexpr int32_t MODEM_SPEAKER = 512;
 constexpr int32_t MIC = 1024;
 constexpr int32_t SPEAKER = 2048;
 
+enum class DHOperation : int32_t {
+    PAUSE = 0,
+    RESUME = 1,
+    STOP = 2,
+};
+
+// Carries one call from the JS thread to the worker running the IPC and back to settle the promise or callback.
+struct DHAsyncContext {
+    napi_async_work work = nullptr;
+    napi_deferred deferred = nullptr;
+    napi_ref callbackRef = nullptr;
+    DHOperation operation = DHOperation::PAUSE;
+    std::vector<OHOS::DistributedHardware::DHType> dhTypes;
+    std::string networkId;
+    int32_t ret = 0;
+};
+
 class DistributedHardwareManager {
 public:
     explicit DistributedHardwareManager(napi_env env, napi_value thisVar);
@@ -39,10 +59,14 @@ public:
     static napi_value PauseDistributedHardware(napi_env env, napi_callback_info info);
     static napi_value ResumeDistributedHardware(napi_env env, napi_callback_info info);
     static napi_value StopDistributedHardware(napi_env env, napi_callback_info info);
+    static napi_value PauseDistributedHardwareBatch(napi_env env, napi_callback_info info);
+    static napi_value ResumeDistributedHardwareBatch(napi_env env, napi_callback_info info);
     static void JsObjectToString(const napi_env &env, const napi_value &object, const std::string &fieldStr, char *dest,
                                  const int32_t destLen);
     static void JsObjectToInt(const napi_env &env, const napi_value &object, const std::string &fieldStr,
                               int32_t &fieldRef);
+    static bool JsObjectToIntArray(const napi_env &env, const napi_value &object, const std::string &fieldStr,
+                                   std::vector<int32_t> &fieldRef);
     static napi_value CreateBusinessErr(napi_env env, int32_t errCode);
 
 private:
@@ -50,5 +74,12 @@ private:
     static bool HasAccessDHPermission();
     static bool Verify(napi_env env, int32_t type);
     static bool IsSupportType(int32_t type);
+    static OHOS::DistributedHardware::DHType ToDHType(int32_t type);
+    static bool ParseTypes(napi_env env, napi_value description, bool isBatch,
+        std::vector<OHOS::DistributedHardware::DHType> &dhTypes);
+    static napi_value QueueOperation(napi_env env, napi_callback_info info, DHOperation operation, bool isBatch);
+    static void ExecuteOperation(napi_env env, void *data);
+    static void CompleteOperation(napi_env env, napi_status status, void *data);
+    static napi_value CreateOperationErr(napi_env env, int32_t ret);
 };
 #endif // OHOS_DH_NATIVE_DISTRIBUTED_HARDWARE_JS_H
@@ -15,6 +15,9 @@
 
 #include "native_distributedhardwarefwk_js.h"
 
+#include <algorithm>
+#include <memory>
+
 #include "ipc_skeleton.h"
 #include "js_native_api.h"
 
@@ -23,6 +26,7 @@
 #include "tokenid_kit.h"
 
 #include "device_type.h"
+#include "distributed_hardware_errno.h"
 #include "distributed_hardware_log.h"
 #include "distributed_hardware_fwk_kit.h"
 
@@ -66,6 +70,8 @@ namespace {
 
 const int32_t DH_NAPI_ARGS_ONE = 1;
 const int32_t DH_NAPI_ARGS_TWO = 2;
+const size_t NETWORK_ID_BUF_LEN = 96;
+const uint32_t MAX_BATCH_TYPE_NUM = 16;
 
 enum DHBussinessErrorCode {
     // Permission verify failed.
@@ -209,163 +215,240 @@ napi_value DistributedHardwareManager::CreateBusinessErr(napi_env env, int32_t e
     return error;
 }
 
-napi_value DistributedHardwareManager::PauseDistributedHardware(napi_env env, napi_callback_info info)
+DHType DistributedHardwareManager::ToDHType(int32_t type)
 {
-    DHLOGI("PauseDistributedHardware in");
-    napi_value result = nullptr;
-    size_t argc = 2;
-    napi_value argv[2] = {nullptr};
-    napi_value thisVar = nullptr;
-    DH_CALL(napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr));
-    DH_ASSERT(env, ((argc >= DH_NAPI_ARGS_ONE) && (argc <= DH_NAPI_ARGS_TWO)),
-                             "requires 1 or 2 parameter", ERR_INVALID_PARAMS);
-
-    napi_valuetype valueType = napi_undefined;
-    napi_typeof(env, argv[0], &valueType);
-    if (!CheckArgsType(env, valueType == napi_object, "description", "object")) {
-        return nullptr;
-    }
-    int32_t type = -1;
-    char networkId[96];
-    JsObjectToInt(env, argv[0], "type", type);
-    if (!Verify(env, type)) {
-        return nullptr;
-    }
-    DHType dhType = DHType::UNKNOWN;
     DHSubtype dhSubtype = static_cast<DHSubtype>(type);
     if (dhSubtype == DHSubtype::AUDIO_MIC || dhSubtype == DHSubtype::AUDIO_SPEAKER) {
-        dhType = DHType::AUDIO;
+        return DHType::AUDIO;
     } else if (dhSubtype == DHSubtype::CAMERA) {
-        dhType = DHType::CAMERA;
+        return DHType::CAMERA;
     }
-    JsObjectToString(env, argv[0], "srcNetworkId", networkId, sizeof(networkId));
-    std::shared_ptr<DistributedHardwareFwkKit> dhFwkKit = std::make_shared<DistributedHardwareFwkKit>();
-    if (argc == DH_NAPI_ARGS_ONE) {    // promise
-        napi_deferred deferred;
-        napi_value promise = 0;
-        napi_create_promise(env, &deferred, &promise);
-        int32_t ret = dhFwkKit->PauseDistributedHardware(dhType, std::string(networkId));
-        if (ret != 0) {
-            DHLOGE("PauseDistributedHardware for DHType: %{public}u filed", (uint32_t)dhType);
+    return DHType::UNKNOWN;
+}
+
+bool DistributedHardwareManager::JsObjectToIntArray(const napi_env &env, const napi_value &object,
+    const std::string &fieldStr, std::vector<int32_t> &fieldRef)
+{
+    bool hasProperty = false;
+    DH_CALL_BASE(napi_has_named_property(env, object, fieldStr.c_str(), &hasProperty), false);
+    if (!hasProperty) {
+        DHLOGE("devicemanager napi js to int array no property: %{public}s", fieldStr.c_str());
+        return false;
+    }
+    napi_value field = nullptr;
+    bool isArray = false;
+    uint32_t length = 0;
+    DH_CALL_BASE(napi_get_named_property(env, object, fieldStr.c_str(), &field), false);
+    DH_CALL_BASE(napi_is_array(env, field, &isArray), false);
+    if (!isArray) {
+        return false;
+    }
+    DH_CALL_BASE(napi_get_array_length(env, field, &length), false);
+    if (length > MAX_BATCH_TYPE_NUM) {
+        DHLOGE("too many types in one call: %{public}u", length);
+        return false;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        napi_value element = nullptr;
+        napi_valuetype valueType = napi_undefined;
+        int32_t value = -1;
+        DH_CALL_BASE(napi_get_element(env, field, i, &element), false);
+        DH_CALL_BASE(napi_typeof(env, element, &valueType), false);
+        if (valueType != napi_number) {
+            return false;
         }
-        return promise;
-    } else if (argc == DH_NAPI_ARGS_TWO) {    // callback
-        if (!IsFunctionType(env, argv[1])) {
-            return nullptr;
+        DH_CALL_BASE(napi_get_value_int32(env, element, &value), false);
+        fieldRef.push_back(value);
+    }
+    return true;
+}
+
+bool DistributedHardwareManager::ParseTypes(napi_env env, napi_value description, bool isBatch,
+    std::vector<DHType> &dhTypes)
+{
+    std::vector<int32_t> types;
+    if (!isBatch) {
+        int32_t type = -1;
+        JsObjectToInt(env, description, "type", type);
+        types.push_back(type);
+    } else if (!JsObjectToIntArray(env, description, "types", types) || types.empty()) {
+        DHLOGE("param types is invalid.");
+        CreateBusinessErr(env, ERR_INVALID_PARAMS);
+        return false;
+    }
+    for (int32_t type : types) {
+        if (!Verify(env, type)) {
+            return false;
         }
-        int32_t ret = dhFwkKit->PauseDistributedHardware(dhType, std::string(networkId));
-        if (ret != 0) {
-            DHLOGE("PauseDistributedHardware for DHType: %{public}u filed", (uint32_t)dhType);
+        DHType dhType = ToDHType(type);
+        if (std::find(dhTypes.begin(), dhTypes.end(), dhType) == dhTypes.end()) {
+            dhTypes.push_back(dhType);
         }
     }
-    napi_get_undefined(env, &result);
-    return result;
+    return true;
 }
 
-napi_value DistributedHardwareManager::ResumeDistributedHardware(napi_env env, napi_callback_info info)
+napi_value DistributedHardwareManager::QueueOperation(napi_env env, napi_callback_info info, DHOperation operation,
+    bool isBatch)
 {
-    DHLOGI("ResumeDistributedHardware in");
-    napi_value result = nullptr;
-    size_t argc = 2;
-    napi_value argv[2] = {nullptr};
+    size_t argc = DH_NAPI_ARGS_TWO;
+    napi_value argv[DH_NAPI_ARGS_TWO] = {nullptr};
     napi_value thisVar = nullptr;
     DH_CALL(napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr));
-    DH_ASSERT(env, ((argc >= DH_NAPI_ARGS_ONE) && (argc <= DH_NAPI_ARGS_TWO)),
-                        "requires  or 2 parameter", ERR_INVALID_PARAMS);
+    DH_ASSERT(env, (argc >= DH_NAPI_ARGS_ONE) && (argc <= DH_NAPI_ARGS_TWO), "requires 1 or 2 parameter",
+        ERR_INVALID_PARAMS);
 
     napi_valuetype valueType = napi_undefined;
     napi_typeof(env, argv[0], &valueType);
     if (!CheckArgsType(env, valueType == napi_object, "description", "object")) {
         return nullptr;
     }
-    int32_t type = -1;
-    char networkId[96];
-    JsObjectToInt(env, argv[0], "type", type);
-    if (!Verify(env, type)) {
+    if (argc == DH_NAPI_ARGS_TWO && !IsFunctionType(env, argv[1])) {
         return nullptr;
     }
-    DHType dhType = DHType::UNKNOWN;
-    DHSubtype dhSubtype = static_cast<DHSubtype>(type);
-    if (dhSubtype == DHSubtype::AUDIO_MIC || dhSubtype == DHSubtype::AUDIO_SPEAKER) {
-        dhType = DHType::AUDIO;
-    } else if (dhSubtype == DHSubtype::CAMERA) {
-        dhType = DHType::CAMERA;
+    std::unique_ptr<DHAsyncContext> context = std::make_unique<DHAsyncContext>();
+    context->operation = operation;
+    if (!ParseTypes(env, argv[0], isBatch, context->dhTypes)) {
+        return nullptr;
     }
+    char networkId[NETWORK_ID_BUF_LEN] = {0};
     JsObjectToString(env, argv[0], "srcNetworkId", networkId, sizeof(networkId));
-    std::shared_ptr<DistributedHardwareFwkKit> dhFwkKit = std::make_shared<DistributedHardwareFwkKit>();
+    context->networkId = std::string(networkId);
+
+    napi_value result = nullptr;
     if (argc == DH_NAPI_ARGS_ONE) {    // promise
-        napi_deferred deferred;
-        napi_value promise = 0;
-        napi_create_promise(env, &deferred, &promise);
-        int32_t ret = dhFwkKit->ResumeDistributedHardware(dhType, std::string(networkId));
-        if (ret != 0) {
-            DHLOGE("ResumeDistributedHardware for DHType: %{public}u filed", (uint32_t)dhType);
-        }
-        return promise;
-    } else if (argc == DH_NAPI_ARGS_TWO) {    // callback
-        if (!IsFunctionType(env, argv[1])) {
-            return nullptr;
-        }
-        int32_t ret = dhFwkKit->ResumeDistributedHardware(dhType, std::string(networkId));
-        if (ret != 0) {
-            DHLOGE("ResumeDistributedHardware for DHType: %{public}u filed", (uint32_t)dhType);
-        }
+        DH_CALL(napi_create_promise(env, &context->deferred, &result));
+    } else {    // callback
+        DH_CALL(napi_create_reference(env, argv[1], 1, &context->callbackRef));
+        napi_get_undefined(env, &result);
+    }
+    napi_value resourceName = nullptr;
+    napi_create_string_utf8(env, "DistributedHardwareOperation", NAPI_AUTO_LENGTH, &resourceName);
+    if (napi_create_async_work(env, nullptr, resourceName, ExecuteOperation, CompleteOperation, context.get(),
+        &context->work) != napi_ok || napi_queue_async_work(env, context->work) != napi_ok) {
+        DHLOGE("Queue operation %{public}d failed.", static_cast<int32_t>(operation));
+        context->ret = ERR_DH_FWK_POINTER_IS_NULL;
+        CompleteOperation(env, napi_generic_failure, context.release());
+        return result;
     }
-    napi_get_undefined(env, &result);
+    context.release();
     return result;
 }
 
-napi_value DistributedHardwareManager::StopDistributedHardware(napi_env env, napi_callback_info info)
+void DistributedHardwareManager::ExecuteOperation(napi_env env, void *data)
 {
-    DHLOGI("StopDistributedHardware in");
-    napi_value result = nullptr;
-    size_t argc = 2;
-    napi_value argv[2] = {nullptr};
-    napi_value thisVar = nullptr;
-    DH_CALL(napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr));
-    DH_ASSERT(env, (argc >= DH_NAPI_ARGS_ONE) && (argc <= DH_NAPI_ARGS_TWO),
-                         "requires 1 or  parameter", ERR_INVALID_PARAMS);
-
-    napi_valuetype valueType = napi_undefined;
-    napi_typeof(env, argv[0], &valueType);
-    if (!CheckArgsType(env, valueType == napi_object, "description", "object")) {
-        return nullptr;
+    (void)env;
+    DHAsyncContext *context = static_cast<DHAsyncContext *>(data);
+    std::shared_ptr<DistributedHardwareFwkKit> dhFwkKit = std::make_shared<DistributedHardwareFwkKit>();
+    for (DHType dhType : context->dhTypes) {
+        int32_t ret = DH_FWK_SUCCESS;
+        switch (context->operation) {
+            case DHOperation::PAUSE:
+                ret = dhFwkKit->PauseDistributedHardware(dhType, context->networkId);
+                break;
+            case DHOperation::RESUME:
+                ret = dhFwkKit->ResumeDistributedHardware(dhType, context->networkId);
+                break;
+            case DHOperation::STOP:
+                ret = dhFwkKit->StopDistributedHardware(dhType, context->networkId);
+                break;
+            default:
+                break;
+        }
+        // A batch goes on with the other types, the first failure is reported.
+        if (ret != DH_FWK_SUCCESS) {
+            DHLOGE("Operation %{public}d for DHType: %{public}u failed, ret: %{public}d",
+                static_cast<int32_t>(context->operation), (uint32_t)dhType, ret);
+            context->ret = (context->ret == DH_FWK_SUCCESS) ? ret : context->ret;
+        }
     }
-    int32_t type = -1;
-    char networkId[96];
-    JsObjectToInt(env, argv[0], "type", type);
-    if (!Verify(env, type)) {
-        return nullptr;
+}
+
+void DistributedHardwareManager::CompleteOperation(napi_env env, napi_status status, void *data)
+{
+    std::unique_ptr<DHAsyncContext> context(static_cast<DHAsyncContext *>(data));
+    if (status != napi_ok && context->ret == DH_FWK_SUCCESS) {
+        context->ret = ERR_DH_FWK_POINTER_IS_NULL;
     }
-    DHType dhType = DHType::UNKNOWN;
-    DHSubtype dhSubtype = static_cast<DHSubtype>(type);
-    if (dhSubtype == DHSubtype::AUDIO_MIC || dhSubtype == DHSubtype::AUDIO_SPEAKER) {
-        dhType = DHType::AUDIO;
-    } else if (dhSubtype == DHSubtype::CAMERA) {
-        dhType = DHType::CAMERA;
+    napi_value undefined = nullptr;
+    napi_get_undefined(env, &undefined);
+    napi_value error = nullptr;
+    if (context->ret != DH_FWK_SUCCESS) {
+        error = CreateOperationErr(env, context->ret);
     }
-    JsObjectToString(env, argv[0], "srcNetworkId", networkId, sizeof(networkId));
-    std::shared_ptr<DistributedHardwareFwkKit> dhFwkKit = std::make_shared<DistributedHardwareFwkKit>();
-    if (argc == DH_NAPI_ARGS_ONE) {    // promise
-        napi_deferred deferred;
-        napi_value promise = 0;
-        napi_create_promise(env, &deferred, &promise);
-        int32_t ret = dhFwkKit->StopDistributedHardware(dhType, std::string(networkId));
-        if (ret != 0) {
-            DHLOGE("StopDistributedHardware for DHType: %{public}u filed", (uint32_t)dhType);
-        }
-        return promise;
-    } else if (argc == DH_NAPI_ARGS_TWO) {    // callback
-        if (!IsFunctionType(env, argv[1])) {
-            return nullptr;
+    if (context->deferred != nullptr) {
+        if (error == nullptr) {
+            napi_resolve_deferred(env, context->deferred, undefined);
+        } else {
+            napi_reject_deferred(env, context->deferred, error);
         }
-        int32_t ret = dhFwkKit->StopDistributedHardware(dhType, std::string(networkId));
-        if (ret != 0) {
-            DHLOGE("StopDistributedHardware for DHType: %{public}u filed", (uint32_t)dhType);
+    } else if (context->callbackRef != nullptr) {
+        napi_value callback = nullptr;
+        napi_value callResult = nullptr;
+        napi_value argv[DH_NAPI_ARGS_TWO] = {nullptr, undefined};
+        if (error == nullptr) {
+            napi_get_null(env, &argv[0]);
+        } else {
+            argv[0] = error;
         }
+        napi_get_reference_value(env, context->callbackRef, &callback);
+        napi_call_function(env, undefined, callback, DH_NAPI_ARGS_TWO, argv, &callResult);
+        napi_delete_reference(env, context->callbackRef);
     }
-    napi_get_undefined(env, &result);
-    return result;
+    if (context->work != nullptr) {
+        napi_delete_async_work(env, context->work);
+    }
+}
+
+napi_value DistributedHardwareManager::CreateOperationErr(napi_env env, int32_t ret)
+{
+    int32_t errCode = ret;
+    std::string errMsg = "Operation failed, ret: " + std::to_string(ret);
+    if (ret == ERR_DH_FWK_POINTER_IS_NULL) {
+        errCode = ERR_CODE_DH_NOT_START;
+        errMsg = ERR_MESSAGE_DH_NOT_START;
+    } else if (ret == ERR_DH_FWK_PARA_INVALID) {
+        errCode = ERR_INVALID_PARAMS;
+        errMsg = ERR_MESSAGE_INVALID_PARAMS;
+    }
+    napi_value code = nullptr;
+    napi_value message = nullptr;
+    napi_value error = nullptr;
+    napi_create_int32(env, errCode, &code);
+    napi_create_string_utf8(env, errMsg.c_str(), NAPI_AUTO_LENGTH, &message);
+    napi_create_error(env, nullptr, message, &error);
+    napi_set_named_property(env, error, "code", code);
+    return error;
+}
+
+napi_value DistributedHardwareManager::PauseDistributedHardware(napi_env env, napi_callback_info info)
+{
+    DHLOGI("PauseDistributedHardware in");
+    return QueueOperation(env, info, DHOperation::PAUSE, false);
+}
+
+napi_value DistributedHardwareManager::ResumeDistributedHardware(napi_env env, napi_callback_info info)
+{
+    DHLOGI("ResumeDistributedHardware in");
+    return QueueOperation(env, info, DHOperation::RESUME, false);
+}
+
+napi_value DistributedHardwareManager::StopDistributedHardware(napi_env env, napi_callback_info info)
+{
+    DHLOGI("StopDistributedHardware in");
+    return QueueOperation(env, info, DHOperation::STOP, false);
+}
+
+napi_value DistributedHardwareManager::PauseDistributedHardwareBatch(napi_env env, napi_callback_info info)
+{
+    DHLOGI("PauseDistributedHardwareBatch in");
+    return QueueOperation(env, info, DHOperation::PAUSE, true);
+}
+
+napi_value DistributedHardwareManager::ResumeDistributedHardwareBatch(napi_env env, napi_callback_info info)
+{
+    DHLOGI("ResumeDistributedHardwareBatch in");
+    return QueueOperation(env, info, DHOperation::RESUME, true);
 }
 
 napi_value DistributedHardwareManager::Init(napi_env env, napi_value exports)
@@ -374,6 +457,8 @@ napi_value DistributedHardwareManager::Init(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION("pauseDistributedHardware", PauseDistributedHardware),
         DECLARE_NAPI_FUNCTION("resumeDistributedHardware", ResumeDistributedHardware),
         DECLARE_NAPI_FUNCTION("stopDistributedHardware", StopDistributedHardware),
+        DECLARE_NAPI_FUNCTION("pauseDistributedHardwareBatch", PauseDistributedHardwareBatch),
+        DECLARE_NAPI_FUNCTION("resumeDistributedHardwareBatch", ResumeDistributedHardwareBatch),
     };
 
     DHLOGI("DistributedHardwareManager::Init is called!");
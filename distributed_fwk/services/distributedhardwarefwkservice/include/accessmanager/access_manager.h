@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,6 +17,7 @@
 #define OHOS_DISTRIBUTED_HARDWARE_ACCESS_MANAGER_H
 
 #include <cstdint>
+#include <map>
 #include <string>
 #include <memory>
 #include <mutex>
@@ -24,9 +25,16 @@
 
 #include "device_manager_callback.h"
 #include "dm_device_info.h"
+#include "event_handler.h"
 
 namespace OHOS {
 namespace DistributedHardware {
+struct DeviceFlapDump {
+    std::string networkId;
+    bool offlinePending = false;
+    uint32_t suppressedCount = 0;
+};
+
 class AccessManager : public std::enable_shared_from_this<AccessManager>,
     public DmInitCallback,
     public DeviceStateCallback {
@@ -49,13 +57,34 @@ public:
     /* Send device online event which is already online */
     void CheckTrustedDeviceOnline();
     int32_t Dump(const std::vector<std::string> &argsStr, std::string &result);
+    void DumpDeviceFlaps(std::vector<DeviceFlapDump> &flapInfos, uint64_t &totalSuppressed);
 
 private:
+    struct PendingOffline {
+        std::string uuid;
+        std::string udid;
+        uint16_t deviceType = 0;
+    };
+
     int32_t RegisterDevStateCallback();
     int32_t UnRegisterDevStateCallback();
     int32_t InitDeviceManager();
     int32_t UnInitDeviceManager();
+    /*
+     * An offline event waits for the grace window of persist.distributed_hardware.dhfwk.offline_grace_ms. If the
+     * device comes back online with the same uuid in the meantime, neither event reaches the hardware manager, so a
+     * bouncing link does not disable and enable its hardware again. Both are called with accessMutex_ held.
+     */
+    bool DeferOffline(const std::string &networkId, const PendingOffline &offline);
+    bool TakeDeferredOffline(const std::string &networkId, PendingOffline &offline);
+    void OnOfflineGraceExpired(const std::string &networkId);
+
     std::mutex accessMutex_;
+    std::map<std::string, PendingOffline> pendingOfflines_;
+    // Suppressed offline and online pairs per online device, the total also keeps those gone offline since.
+    std::map<std::string, uint32_t> suppressedCounts_;
+    uint64_t totalSuppressed_ = 0;
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
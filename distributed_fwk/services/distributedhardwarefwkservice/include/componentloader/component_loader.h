@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -55,13 +55,14 @@ struct CompConfig {
     std::vector<std::string> sinkSupportedFeatures;
 };
 
+/* The libraries are dlopen-ed on first use, a null handler means not loaded yet */
 struct CompHandler {
-    DHType type;
-    void *sourceHandler;
-    int32_t sourceSaId;
-    void *sinkHandler;
-    int32_t sinkSaId;
-    void *hardwareHandler;
+    DHType type {DHType::UNKNOWN};
+    void *sourceHandler {nullptr};
+    int32_t sourceSaId {0};
+    void *sinkHandler {nullptr};
+    int32_t sinkSaId {0};
+    void *hardwareHandler {nullptr};
     CompConfig compConfig;
 };
 }
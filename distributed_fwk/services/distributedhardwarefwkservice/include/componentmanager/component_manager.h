@@ -17,6 +17,7 @@
 #define OHOS_DISTRIBUTED_HARDWARE_COMPONENT_MANAGER_H
 
 #include <atomic>
+#include <condition_variable>
 #include <map>
 #include <set>
 #include <unordered_map>
@@ -67,8 +68,16 @@ public:
     void Recover(DHType dhType);
     std::map<DHType, IDistributedHardwareSink*> GetDHSinkInstance();
     void TriggerFullCapsSync(const std::string &networkId);
+    void TriggerPartialCapsSync(const std::string &networkId, DHType dhType, const std::string &dhId);
+    void PreOpenCapsSyncSession(const std::string &networkId);
     void SaveNeedRefreshTask(const TaskParam &taskParam);
+    void DumpRecoverInfos(std::vector<RecoverDump> &recoverInfos);
     IDistributedHardwareSource* GetDHSourceInstance(DHType dhType);
+    /**
+     * @brief wake up the enable flows which are waiting for remote capability, meta capability
+     *        or version info to arrive, so they retry GetEnableParam at once instead of polling.
+     */
+    void NotifyCapabilityAvailable();
     /**
      * @brief find the task param and return it.
      *        If the task param exist, get and remove from the cached task params,
@@ -104,9 +113,18 @@ public:
         std::shared_ptr<IDistributedModemExt> dhModemExt, IDistributedHardwareSource *&sourcePtr);
     int32_t DisableMetaSource(const std::string &networkId, const DHDescriptor &dhDescriptor,
         std::shared_ptr<IDistributedModemExt> dhModemExt, IDistributedHardwareSource *&sourcePtr);
+    /**
+     * @brief sync the dh of the remote device by softbus and answer the callback.
+     *        A callback only interested in one dh type, or in one dhId of it, only waits for those;
+     *        the full sync of the device then happens at idle time.
+     */
     void SyncRemoteDeviceInfoBySoftbus(const std::string &realNetworkId, EnableStep enableStep,
-        const sptr<IGetDhDescriptorsCallback> callback);
-    void OnGetDescriptors(const std::string &realNetworkId, const std::vector<DHDescriptor> &descriptors);
+        const sptr<IGetDhDescriptorsCallback> callback, DHType dhType = DHType::UNKNOWN,
+        const std::string &dhId = "");
+    void OnGetDescriptors(const std::string &realNetworkId, const std::vector<DHDescriptor> &descriptors,
+        bool isPartial = false);
+    static std::vector<DHDescriptor> FilterDescriptors(const std::vector<DHDescriptor> &descriptors,
+        DHType dhType, const std::string &dhId);
     void SetAVSyncScene(const DHTopic topic);
     void UpdateSinkBusinessState(const std::string &networkId, const std::string &dhId, BusinessSinkState state);
     int32_t InitAVSyncSharedMemory();
@@ -124,6 +142,8 @@ public:
     bool IsSourceEnabled();
     bool IsSinkActiveEnabled();
     bool IsRequestSyncData(const std::string &networkId);
+    /* Whether the saved caps of the remote device only hold what a partial sync asked for. */
+    bool HasRemotePartialCapsOnly(const std::string &networkId);
     class ComponentManagerEventHandler : public AppExecFwk::EventHandler {
     public:
         ComponentManagerEventHandler(const std::shared_ptr<AppExecFwk::EventRunner> runner);
@@ -237,6 +257,13 @@ private:
         }
     };
 
+    struct SyncDeviceInfoRequest {
+        sptr<IGetDhDescriptorsCallback> callback;
+        // DHType::UNKNOWN asks for every dh, a dhId narrows the type down to one dh
+        DHType dhType = DHType::UNKNOWN;
+        std::string dhId;
+    };
+
     DHType GetDHType(const std::string &uuid, const std::string &dhId) const;
     int32_t InitCompSource(DHType dhType);
     int32_t UninitCompSource(DHType dhType);
@@ -298,10 +325,13 @@ private:
         std::shared_ptr<IDistributedModemExt> dhModemExt, IDistributedHardwareSource *&sourcePtr);
     void ResetSinkEnableStatus(DHType dhType);
     void ResetSourceEnableStatus(DHType dhType);
-    void RecoverAutoEnableSink(DHType dhType);
-    void RecoverAutoEnableSource(DHType dhType);
-    void RecoverActiveEnableSink(DHType dhType);
-    void RecoverActiveEnableSource(DHType dhType);
+    void RecoverAutoEnableSink(DHType dhType, std::vector<TaskParam> &recoverParams);
+    void RecoverAutoEnableSource(DHType dhType, std::vector<TaskParam> &recoverParams);
+    void RecoverActiveEnableSink(DHType dhType, std::vector<TaskParam> &recoverParams);
+    void RecoverActiveEnableSource(DHType dhType, std::vector<TaskParam> &recoverParams);
+    size_t RunRecoverTasks(const std::vector<TaskParam> &recoverParams);
+    void AcquireRecoverSlot();
+    void ReleaseRecoverSlot();
     void HandleSyncDataTimeout(const std::string &realNetworkId);
 private:
     std::map<DHType, IDistributedHardwareSource*> compSource_;
@@ -334,7 +364,7 @@ private:
     std::mutex dhSinkStatusMtx_;
     std::map<DHType, DHSourceStatus> dhSourceStatus_;
     std::mutex dhSourceStatusMtx_;
-    std::map<std::string, std::pair<EnableStep, std::vector<sptr<IGetDhDescriptorsCallback>>>> syncDeviceInfoMap_;
+    std::map<std::string, std::pair<EnableStep, std::vector<SyncDeviceInfoRequest>>> syncDeviceInfoMap_;
     std::mutex syncDeviceInfoMapMutex_;
 
     WorkModeParam workModeParam_;
@@ -347,6 +377,19 @@ private:
     std::mutex dhTopicMtx_;
     std::map<std::pair<DHType, std::string>, sptr<IAuthorizationResultCallback>> accessListenerMap_;
     std::mutex accessListenerMutex_;
+
+    // bumped by NotifyCapabilityAvailable, RetryGetEnableParam waits for it to change.
+    uint64_t capAvailableSeq_ = 0;
+    std::mutex capAvailableMtx_;
+    std::condition_variable capAvailableCv_;
+
+    // the last recovery of every type, for hidump
+    std::map<DHType, RecoverDump> recoverInfos_;
+    std::mutex recoverInfosMtx_;
+    // recovery enables running now, summed over all types recovering at the same time
+    size_t runningRecoverTasks_ = 0;
+    std::mutex recoverSlotMtx_;
+    std::condition_variable recoverSlotCv_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
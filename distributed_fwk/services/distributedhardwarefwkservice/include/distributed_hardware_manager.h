@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,6 +19,7 @@
 #include "idistributed_hardware_manager.h"
 
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include "device_type.h"
 #include "dhfwk_single_instance.h"
@@ -31,6 +32,8 @@ public:
     int32_t LocalInit();
     int32_t Initialize() override;
     int32_t Release() override;
+    // Unloads the component handlers and keeps the DB handles, the next Initialize loads them again.
+    int32_t ReleaseComponents();
     int32_t SendOnLineEvent(const std::string &networkId, const std::string &uuid, const std::string &udid,
         uint16_t deviceType) override;
     int32_t SendOffLineEvent(const std::string &networkId, const std::string &uuid, const std::string &udid,
@@ -40,11 +43,19 @@ public:
 
     int32_t Dump(const std::vector<std::string> &argsStr, std::string &result) override;
     bool GetDHardwareInitState();
+    bool WaitForDHardwareInit(int32_t timeoutMs);
+private:
+    void LoadComponents();
+    void UnloadComponents();
+
 private:
     std::atomic<bool> isLocalInit_{false};
+    std::atomic<bool> isComponentLoaded_{false};
     std::atomic<bool> isAllInit_{false};
     std::mutex dhInitMgrMutex_;
     std::mutex localInitMgrMutex_;
+    std::condition_variable initStateCv_;
+    std::mutex initStateMutex_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -44,12 +44,17 @@ public:
 
     int Dump(const std::vector<std::string> &argsStr, std::string &result);
     void UnInit();
+    // Keeps the framework warm once the last device leaves and releases it in stages when nothing comes back.
+    void ScheduleIdleUnInit();
+    void CancelIdleUnInit();
     bool GetUnInitFlag();
     void SetSAProcessState(bool saState);
     bool GetSAProcessState();
     void CheckExitSAOrNot();
     bool GetDHardwareInitState();
+    bool WaitForDHardwareInit(int32_t timeoutMs);
     void ActiveSyncDataByNetworkId(const std::string &networkId);
+    void PreOpenCapsSyncSession(const std::string &networkId);
     void DelaySaStatusTask();
     int32_t DestroySaStatusHandler();
     void SetSaToCritical();
@@ -57,6 +62,8 @@ private:
     bool Init();
     void ExitDHFWK();
     int32_t CreateSaStatusHandler();
+    void OnIdleComponentRelease();
+    void OnIdleStoreRelease();
 
 private:
     std::atomic<bool> isInit_ = false;
@@ -68,6 +75,9 @@ private:
     std::shared_ptr<AppExecFwk::EventHandler> saStatusHandler_;
     std::mutex saStatusMutex_;
     std::mutex setSaStatusOperateMutex_;
+
+    std::shared_ptr<AppExecFwk::EventHandler> idleHandler_;
+    std::mutex idleMutex_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
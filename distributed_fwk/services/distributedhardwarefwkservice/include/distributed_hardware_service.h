@@ -20,6 +20,8 @@
 #include "ipc_object_stub.h"
 #include "system_ability.h"
 #include "system_ability_load_callback_stub.h"
+#include <chrono>
+#include <map>
 #include <thread>
 
 #include "distributed_hardware_fwk_kit.h"
@@ -56,6 +58,10 @@ public:
     int32_t StopDistributedHardware(DHType dhType, const std::string &networkId) override;
     int32_t GetDistributedHardware(const std::string &networkId, EnableStep enableStep,
         const sptr<IGetDhDescriptorsCallback> callback) override;
+    int32_t GetDistributedHardwareBatch(const std::vector<std::string> &networkIds, EnableStep enableStep,
+        const sptr<IGetDhDescriptorsCallback> callback) override;
+    int32_t GetDistributedHardwareByType(const std::string &networkId, DHType dhType, const std::string &dhId,
+        EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback) override;
     int32_t RegisterDHStatusListener(sptr<IHDSinkStatusListener> listener) override;
     int32_t UnregisterDHStatusListener(sptr<IHDSinkStatusListener> listener) override;
     int32_t RegisterDHStatusListener(const std::string &networkId, sptr<IHDSourceStatusListener> listener) override;
@@ -93,16 +99,20 @@ protected:
 
 private:
     bool Init();
+    std::string QueryLocalSysSpecFromCapability(const QueryLocalSysSpecType spec);
     std::string QueryDhSysSpec(const std::string &targetKey, std::string &attrs);
     void InitLocalDevInfo();
     bool DoBusinessInit();
     bool IsDepSAStart();
     int32_t GetDeviceDhInfo(const std::string &realNetworkId, const std::string &udidHash, const std::string &deviceId,
-        EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback);
+        EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback, DHType dhType = DHType::UNKNOWN,
+        const std::string &dhId = "");
     void StartGetDeviceDhInfo(const std::string &networkId, EnableStep enableStep,
-        const sptr<IGetDhDescriptorsCallback> callback);
+        const sptr<IGetDhDescriptorsCallback> callback, DHType dhType = DHType::UNKNOWN,
+        const std::string &dhId = "");
     void StartCleanupTimer();
     void CleanupExpiredRequests();
+    int32_t GetPendingRequestWaitTime();
 
 private:
     bool registerToService_ = false;
@@ -113,12 +123,23 @@ private:
         std::string networkId;
         EnableStep enableStep;
         sptr<IGetDhDescriptorsCallback> callback;
+        // DHType::UNKNOWN asks for every dh, a dhId narrows the type down to one dh
+        DHType dhType = DHType::UNKNOWN;
+        std::string dhId;
     };
+    int32_t GetDistributedHardwareInternal(const PendingGetDHRequest &request);
     std::vector<PendingGetDHRequest> pendingGetDHRequests_;
     std::mutex pendingRequestsMutex_;
     std::atomic<bool> cleanupRunning_{false};
     std::thread cleanupThread_;
-    uint32_t dhfwkInitTimes_ = 0;
+    std::chrono::steady_clock::time_point pendingDeadline_;
+
+    struct LocalSysSpecCache {
+        uint64_t capabilityVersion = 0;
+        std::string spec;
+    };
+    std::map<QueryLocalSysSpecType, LocalSysSpecCache> localSysSpecCache_;
+    std::mutex localSysSpecMutex_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
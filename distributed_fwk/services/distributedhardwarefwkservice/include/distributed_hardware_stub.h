@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -42,6 +42,8 @@ private:
     int32_t ResumeDistributedHardwareInner(MessageParcel &data, MessageParcel &reply);
     int32_t StopDistributedHardwareInner(MessageParcel &data, MessageParcel &reply);
     int32_t GetDistributedHardwareInner(MessageParcel &data, MessageParcel &reply);
+    int32_t GetDistributedHardwareBatchInner(MessageParcel &data, MessageParcel &reply);
+    int32_t GetDistributedHardwareByTypeInner(MessageParcel &data, MessageParcel &reply);
     int32_t RegisterDHStatusSinkListenerInner(MessageParcel &data, MessageParcel &reply);
     int32_t UnregisterDHStatusSinkListenerInner(MessageParcel &data, MessageParcel &reply);
     int32_t RegisterDHStatusSourceListenerInner(MessageParcel &data, MessageParcel &reply);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -20,10 +20,14 @@
 #include <condition_variable>
 #include <map>
 #include <mutex>
+#include <set>
+#include <vector>
 
+#include "event_handler.h"
 #include "idistributed_hardware.h"
 #include "idistributed_hardware_source.h"
 #include "dhfwk_single_instance.h"
+#include "impl_utils.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -55,6 +59,7 @@ public:
     int32_t UnLoadDistributedHDF();
     void ResetRefCount();
     bool IsNeedErase();
+    int32_t GetRefCount();
 private:
     DHType dhType_ = DHType::UNKNOWN;
     int32_t hdfLoadRef_ = 0;
@@ -74,6 +79,12 @@ public:
     int32_t RigidGetSourcePtr(DHType dhType, IDistributedHardwareSource *&sourcePtr);
     int32_t RigidReleaseSourcePtr(DHType dhType);
     bool IsAnyHdfInuse();
+    /**
+     * Load the hdf of a type before any enable asks for it and hand the reference straight back, so the
+     * driver stays up for the unload grace period. Does nothing when the grace period is disabled.
+     */
+    int32_t PreloadDistributedHDF(DHType dhType);
+    void DumpHdfLoadInfos(std::vector<HdfLoadDump> &hdfLoadInfos);
 
 private:
     struct SourceHandlerData {
@@ -82,6 +93,13 @@ private:
         IDistributedHardwareSource *sourcePtr;
     };
 
+private:
+    int32_t UnLoadHdfOperator(DHType dhType, std::map<DHType, std::shared_ptr<HdfOperator>>::iterator itHdfOperate);
+    bool DeferUnLoad(DHType dhType);
+    bool CancelDeferredUnLoad(DHType dhType);
+    void OnUnLoadGraceExpired(DHType dhType);
+    void RecordLoad(DHType dhType, bool isReuse, int64_t costMs);
+
 private:
     std::mutex hdfOperateMapMutex_;
     std::map<DHType, std::shared_ptr<HdfOperator>> hdfOperateMap_;
@@ -90,6 +108,11 @@ private:
     std::mutex sourceHandlerDataMapMutex_;
     std::map<DHType, SourceHandlerData> sourceHandlerDataMap_;
     int32_t hdfInuseRefCount_ = 0;
+    // Types whose last reference is gone and whose unload waits for the grace period, guarded by
+    // hdfOperateMapMutex_. They still count in hdfInuseRefCount_ until they are really unloaded.
+    std::set<DHType> pendingUnLoads_;
+    std::map<DHType, HdfLoadDump> hdfLoadDumps_;
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
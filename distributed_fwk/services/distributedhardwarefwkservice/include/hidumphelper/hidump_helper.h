@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -21,6 +21,7 @@
 
 #include "enabled_comps_dump.h"
 #include "device_type.h"
+#include "dh_perf_stats.h"
 #include "impl_utils.h"
 #include "dhfwk_single_instance.h"
 
@@ -33,6 +34,12 @@ enum class HidumpFlag {
     GET_ENABLED_COMP_LIST,
     GET_TASK_LIST,
     GET_CAPABILITY_LIST,
+    GET_RECOVER_INFO,
+    GET_HDF_LOAD_INFO,
+    GET_FIRST_FRAME_INFO,
+    GET_LOW_LATENCY_INFO,
+    GET_PERF_INFO,
+    GET_DEVICE_FLAP_INFO,
 };
 
 class HidumpHelper {
@@ -49,6 +56,13 @@ private:
     int32_t ShowAllEnabledComps(std::string &result);
     int32_t ShowAllTaskInfos(std::string &result);
     int32_t ShowAllCapabilityInfos(std::string &result);
+    int32_t ShowAllRecoverInfos(std::string &result);
+    int32_t ShowAllHdfLoadInfos(std::string &result);
+    int32_t ShowAllFirstFrameInfos(std::string &result);
+    int32_t ShowAllLowLatencyInfos(std::string &result);
+    int32_t ShowAllPerfInfos(std::string &result);
+    int32_t ShowAllDeviceFlapInfos(std::string &result);
+    void ShowPerfCostStat(const std::string &key, const PerfCostStat &stat, std::string &result);
     int32_t ShowHelp(std::string &result);
     int32_t ShowIllealInfomation(std::string &result);
     void ShowLoadCompSource(const std::set<DHType> &loadedCompSource, const DHVersion &dhVersion, std::string &result);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,7 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_LOCAL_HARDWARE_MANAGER_H
 #define OHOS_DISTRIBUTED_HARDWARE_LOCAL_HARDWARE_MANAGER_H
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -37,8 +38,22 @@ public:
     ~LocalHardwareManager();
     void Init();
     void UnInit();
+    /*
+     * Changes whenever local capabilities are added or removed. Data derived from
+     * local capabilities can be cached together with the version it was built from.
+     */
+    uint64_t GetLocalCapabilityVersion();
+    void NotifyLocalCapabilityChanged();
+    /*
+     * Apply a hot plug change to the cached local items. UpdateLocalDHItem returns false
+     * when the item is already known with the same attrs and subtype, so nothing to store.
+     */
+    bool UpdateLocalDHItem(const DHType dhType, const DHItem &dhItem);
+    void RemoveLocalDHItem(const DHType dhType, const std::string &dhId);
 
 private:
+    void InitLocalHardware(const DHType dhType);
+    void PublishLocalHardware(const DHType dhType);
     void QueryLocalHardware(const DHType dhType, IHardwareHandler *hardwareHandler);
     void AddLocalCapabilityInfo(const std::vector<DHItem> &dhItems, const DHType dhType,
                                 std::vector<std::shared_ptr<CapabilityInfo>> &capabilityInfos);
@@ -52,6 +67,9 @@ private:
     std::map<DHType, std::shared_ptr<PluginListener>> pluginListenerMap_;
     std::unordered_map<DHType, std::vector<DHItem>> localDHItemsMap_;
     std::mutex localHardwareMgrMutex_;
+    /* Guards the maps above, Init queries every dhType on its own thread */
+    std::mutex localDHItemsMutex_;
+    std::atomic<uint64_t> localCapabilityVersion_ {0};
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,8 +16,11 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_LOW_LATENCY_H
 #define OHOS_DISTRIBUTED_HARDWARE_LOW_LATENCY_H
 
+#include <map>
 #include <mutex>
-#include <unordered_set>
+#include <string>
+#include <tuple>
+#include <vector>
 
 #include "device_type.h"
 #include "dh_timer.h"
@@ -25,19 +28,40 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+struct LowLatencyPeerInfo {
+    std::string networkId;
+    uint32_t refCount = 0;
+    uint32_t enterCount = 0;
+    // Start of the current stretch in low latency mode, 0 while the peer has no user.
+    int64_t enterTime = 0;
+    int64_t totalDurationMs = 0;
+};
+
 class LowLatency {
 FWK_DECLARE_SINGLE_INSTANCE_BASE(LowLatency);
 public:
     void EnableLowLatency(DHType dhType);
     void DisableLowLatency(DHType dhType);
+    /*
+     * Every (peer, dhType, session) holds one reference, the mode is left as soon as the last one is released.
+     * An empty networkId or sessionName stands for the callers that do not tell them.
+     */
+    void EnableLowLatency(const std::string &networkId, DHType dhType, const std::string &sessionName);
+    void DisableLowLatency(const std::string &networkId, DHType dhType, const std::string &sessionName);
     void CloseLowLatency();
+    void DumpLowLatencyInfos(std::vector<LowLatencyPeerInfo> &peerInfos);
 
 private:
     LowLatency();
     ~LowLatency();
 
+    void OnPeerEnter(const std::string &networkId);
+    void OnPeerLeave(const std::string &networkId);
+
 private:
-    std::unordered_set<DHType> lowLatencySwitchSet_;
+    using LowLatencyKey = std::tuple<std::string, DHType, std::string>;
+    std::map<LowLatencyKey, uint32_t> lowLatencySwitchMap_;
+    std::map<std::string, LowLatencyPeerInfo> peerInfoMap_;
     std::mutex lowLatencyMutex_;
     std::shared_ptr<DHTimer> lowLatencyTimer_ = nullptr;
 };
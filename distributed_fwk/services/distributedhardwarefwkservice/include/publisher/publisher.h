@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -31,6 +31,7 @@ public:
     void RegisterListener(const DHTopic topic, const sptr<IPublisherListener> listener);
     void UnregisterListener(const DHTopic topic, const sptr<IPublisherListener> listener);
     void PublishMessage(const DHTopic topic, const std::string &message);
+    void OnListenerDied(const DHTopic topic, const wptr<IRemoteObject> &remote);
     bool IsTopicExist(const DHTopic topic);
 private:
     Publisher();
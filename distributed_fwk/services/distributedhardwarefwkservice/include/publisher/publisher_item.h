@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,10 +15,12 @@
 
 #ifndef OHOS_PUBLISHER_ITEM_H
 #define OHOS_PUBLISHER_ITEM_H
+#include <memory>
 #include <mutex>
 #include <string>
 #include <set>
 
+#include "iremote_object.h"
 #include "refbase.h"
 
 #include "ipublisher_listener.h"
@@ -33,6 +35,16 @@ public:
         return originalListener->AsObject().GetRefPtr() < currentListener->AsObject().GetRefPtr();
     }
 };
+using PublisherListenerSet = std::set<sptr<IPublisherListener>, ListenerCompare>;
+
+class PublisherListenerDeathRecipient : public IRemoteObject::DeathRecipient {
+public:
+    explicit PublisherListenerDeathRecipient(DHTopic topic) : topic_(topic) {}
+    void OnRemoteDied(const wptr<IRemoteObject> &remote) override;
+private:
+    DHTopic topic_;
+};
+
 class PublisherItem {
 FWK_REMOVE_NO_USE_CONSTRUCTOR(PublisherItem);
 public:
@@ -41,11 +53,17 @@ public:
     virtual ~PublisherItem();
     void AddListener(const sptr<IPublisherListener> listener);
     void RemoveListener(const sptr<IPublisherListener> listener);
+    void RemoveDeadListener(const wptr<IRemoteObject> &remote);
     void PublishMessage(const std::string &message);
+private:
+    void EraseListener(const IRemoteObject *object);
+
 private:
     DHTopic topic_;
     std::mutex mutex_;
-    std::set<sptr<IPublisherListener>, ListenerCompare> listeners_;
+    // Replaced as a whole on every change, so PublishMessage delivers from a snapshot without holding mutex_.
+    std::shared_ptr<const PublisherListenerSet> listeners_;
+    sptr<IRemoteObject::DeathRecipient> deathRecipient_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
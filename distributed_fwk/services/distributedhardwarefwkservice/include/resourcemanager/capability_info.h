@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -78,8 +78,14 @@ public:
     virtual std::string GetAnonymousKey() const;
     virtual int32_t FromJsonString(const std::string &jsonStr);
     virtual std::string ToJsonString();
+    virtual int32_t FromBinaryString(const std::string &binStr);
+    virtual std::string ToBinaryString();
     bool Compare(const CapabilityInfo& capInfo);
 
+protected:
+    void AppendBinaryFields(std::string &out) const;
+    bool ReadBinaryFields(const std::string &binStr, size_t &pos);
+
 private:
     std::string dhId_;
     std::string deviceId_;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,6 +19,7 @@
 #include <condition_variable>
 #include <map>
 #include <set>
+#include <shared_mutex>
 
 #include "kvstore_observer.h"
 
@@ -47,6 +48,10 @@ public:
     int32_t SyncDeviceInfoFromDB(const std::string &deviceId);
     /* update the database record to memory in abnormal scene */
     int32_t SyncRemoteCapabilityInfos();
+    /* Load the records of a device on its online event, they stay in the database until its first one */
+    int32_t LoadDeviceCapabilities(const std::string &deviceId);
+    /* Drop the records of devices not seen within the capability TTL from memory and the database */
+    int32_t EvictExpiredCapabilities();
     /* Add Distributed hardware information, Save in memory and database */
     int32_t AddCapability(const std::vector<std::shared_ptr<CapabilityInfo>> &resInfos);
     /* Save CapabilityInfo in memory */
@@ -93,11 +98,24 @@ private:
     void HandleCapabilityUpdateChange(const std::vector<DistributedKv::Entry> &updateRecords);
     void HandleCapabilityDeleteChange(const std::vector<DistributedKv::Entry> &deleteRecords);
     std::vector<DistributedKv::Entry> GetEntriesByKeys(const std::vector<std::string> &keys);
+    /* Keep globalCapInfoMap_ and dhTypeIndex_ in step, the caller holds capInfoMgrMutex_ exclusively */
+    void PutCapabilityInMem(const std::string &key, const std::shared_ptr<CapabilityInfo> &capInfo);
+    void EraseCapabilityInMem(const std::string &key);
+    void EraseDeviceCapabilityInMem(const std::string &deviceId);
+    /* Copy the cached records whose key starts with keyPrefix, return the number of records found */
+    size_t GetDataByKeyPrefixInMem(const std::string &keyPrefix, CapabilityInfoMap &capabilityMap) const;
+    /* Stamp the device as seen now, the caller holds capInfoMgrMutex_ exclusively */
+    void RecordLastSeen(const std::string &deviceId);
+    void ScheduleEviction(int64_t delayMs);
 
 private:
-    mutable std::mutex capInfoMgrMutex_;
+    mutable std::shared_mutex capInfoMgrMutex_;
     std::shared_ptr<DBAdapter> dbAdapterPtr_;
+    /* deviceId -> last online or offline time in ms, kept in a local store that is never synced */
+    std::shared_ptr<DBAdapter> lastSeenDbPtr_;
+    /* Ordered by "deviceId###dhId", so the records of one device are a contiguous range */
     CapabilityInfoMap globalCapInfoMap_;
+    std::map<DHType, std::set<std::string>> dhTypeIndex_;
 
     std::shared_ptr<CapabilityInfoManager::CapabilityInfoManagerEventHandler> eventHandler_;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -21,6 +21,8 @@
 #include <string>
 
 #include "capability_info.h"
+#include "constants.h"
+#include "distributed_hardware_errno.h"
 #include "distributed_hardware_log.h"
 
 #undef DH_LOG_TAG
@@ -38,15 +40,41 @@ enum class CapabilityInfoFilter : uint32_t {
     FILTER_DH_ATTRS = 5
 };
 
+/*
+ * Binary capability records start with CAP_BINARY_MAGIC, which never starts a JSON document,
+ * so readers accept both encodings without knowing which one the writer negotiated.
+ */
+constexpr char CAP_BINARY_MAGIC = '\0';
+
+bool IsCapBinaryEncoded(const std::string &value);
+void AppendCapBinaryHeader(std::string &out);
+void AppendCapBinaryUint32(std::string &out, uint32_t value);
+void AppendCapBinaryString(std::string &out, const std::string &value);
+bool ReadCapBinaryHeader(const std::string &in, size_t &pos);
+bool ReadCapBinaryUint32(const std::string &in, size_t &pos, uint32_t &value);
+bool ReadCapBinaryString(const std::string &in, size_t &pos, std::string &value);
+
 template<typename T>
 int32_t GetCapabilityByValue(const std::string &value, std::shared_ptr<T> &capPtr)
 {
     if (capPtr == nullptr) {
         capPtr = std::make_shared<T>();
     }
+    if (IsCapBinaryEncoded(value)) {
+        return capPtr->FromBinaryString(value);
+    }
     return capPtr->FromJsonString(value);
 }
 
+template<typename T>
+std::string EncodeCapability(const std::shared_ptr<T> &capPtr, uint32_t codecVersion)
+{
+    if (codecVersion >= CAP_CODEC_BINARY_V1) {
+        return capPtr->ToBinaryString();
+    }
+    return capPtr->ToJsonString();
+}
+
 std::string GetCapabilityKey(const std::string &deviceId, const std::string &dhId);
 bool IsCapKeyMatchDeviceId(const std::string &key, const std::string &deviceId);
 
@@ -72,6 +100,19 @@ bool IsCapInfoJsonEqual(const std::string &firstData, const std::string &lastDat
     cJSON_Delete(lastJson);
     return firstCapInfo.Compare(lastCapInfo);
 }
+
+template<typename T>
+bool IsCapInfoEqual(const std::string &firstData, const std::string &lastData)
+{
+    std::shared_ptr<T> firstCapInfo = nullptr;
+    std::shared_ptr<T> lastCapInfo = nullptr;
+    if (GetCapabilityByValue<T>(firstData, firstCapInfo) != DH_FWK_SUCCESS ||
+        GetCapabilityByValue<T>(lastData, lastCapInfo) != DH_FWK_SUCCESS) {
+        DHLOGE("capability data parse failed");
+        return false;
+    }
+    return firstCapInfo->Compare(*lastCapInfo);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -53,6 +53,10 @@ public:
     int32_t RemoveDeviceData(const std::string &deviceId);
     int32_t RemoveDataByKey(const std::string &key);
     std::vector<DistributedKv::Entry> GetEntriesByKeys(const std::vector<std::string> &keys);
+    /* Read the stored values of keys in one pass, missing keys are left out and never trigger a sync */
+    void GetValuesByKeys(const std::vector<std::string> &keys, std::unordered_map<std::string, std::string> &values);
+    /* Read the entries whose key starts with keyPrefix, all of them for an empty prefix, never triggers a sync */
+    int32_t GetEntriesByKeyPrefix(const std::string &keyPrefix, std::vector<DistributedKv::Entry> &entries);
     bool SyncDataByNetworkId(const std::string &networkId);
     bool ClearDataByPrefix(const std::string &prefix);
 
@@ -68,6 +72,8 @@ private:
     bool DBDiedOpt(int32_t &times);
     void SyncByNotFound(const std::string &key);
     std::string GetNetworkIdByKey(const std::string &key);
+    /* Coalesce sync requests to one peer, the caller holds dbAdapterMutex_ */
+    bool IsSyncCoalesced(const std::string &networkId);
 
 private:
     DistributedKv::AppId appId_;
@@ -78,6 +84,8 @@ private:
     std::mutex dbAdapterMutex_;
     bool isAutoSync_ {false};
     DistributedKv::DataType dataType_ {DistributedKv::DataType::TYPE_DYNAMICAL};
+    /* networkId -> time of the last PUSH_PULL sync issued to it */
+    std::unordered_map<std::string, int64_t> lastSyncTimes_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -54,6 +54,8 @@ public:
 
     virtual int32_t FromJsonString(const std::string &jsonStr);
     virtual std::string ToJsonString();
+    int32_t FromBinaryString(const std::string &binStr) override;
+    std::string ToBinaryString() override;
     bool Compare(const MetaCapabilityInfo& metaCapInfo);
     virtual std::string GetKey() const;
     virtual std::string GetAnonymousKey() const;
@@ -41,6 +41,7 @@ public:
     int32_t Init();
     int32_t UnInit();
     int32_t AddMetaCapInfos(const std::vector<std::shared_ptr<MetaCapabilityInfo>> &meatCapInfos);
+    int32_t RemoveMetaCapInfosByKeys(const std::vector<std::string> &keys);
     int32_t SyncMetaInfoFromDB(const std::string &udidHash);
     int32_t SyncRemoteMetaInfos();
     int32_t GetDataByKeyPrefix(const std::string &keyPrefix, MetaCapInfoMap &metaCapMap);
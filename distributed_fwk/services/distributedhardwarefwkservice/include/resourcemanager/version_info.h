@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -26,6 +26,8 @@ struct VersionInfo {
     std::string deviceId;
     std::string dhVersion;
     std::unordered_map<DHType, CompVersion> compVersions;
+    /* Highest capability record encoding the device can read, absent on legacy devices */
+    uint32_t capCodecVersion = 0;
 
     int32_t FromJsonString(const std::string &jsonStr);
     std::string ToJsonString() const;
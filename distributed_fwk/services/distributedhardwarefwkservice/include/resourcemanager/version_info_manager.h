@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,12 +16,14 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_VERSION_INFO_MANAGER_H
 #define OHOS_DISTRIBUTED_HARDWARE_VERSION_INFO_MANAGER_H
 
+#include <atomic>
 #include <condition_variable>
 #include <map>
 #include <set>
 
 #include "kvstore_observer.h"
 
+#include "constants.h"
 #include "db_adapter.h"
 #include "event_handler.h"
 #include "impl_utils.h"
@@ -50,6 +52,11 @@ public:
     int32_t RemoveVersionInfoByDeviceId(const std::string &deviceId);
     int32_t SyncVersionInfoFromDB(const std::string &deviceId);
     int32_t SyncRemoteVersionInfos();
+    /*
+     * Capability record encoding every device in the version store can read. Legacy devices
+     * do not report one, which keeps the records in JSON until they are upgraded or removed.
+     */
+    uint32_t GetAgreedCapCodecVersion();
 
     void OnChange(const DistributedKv::ChangeNotification &changeNotification) override;
     class VersionInfoManagerEventHandler : public AppExecFwk::EventHandler {
@@ -73,6 +80,8 @@ private:
     mutable std::mutex verInfoMgrMutex_;
     std::shared_ptr<DBAdapter> dbAdapterPtr_;
     std::shared_ptr<VersionInfoManager::VersionInfoManagerEventHandler> eventHandler_;
+    std::atomic<bool> capCodecDirty_ {true};
+    std::atomic<uint32_t> agreedCapCodecVersion_ {CAP_CODEC_JSON};
 };
 } // namespace DistributedHardware
 } // namespace OHOS
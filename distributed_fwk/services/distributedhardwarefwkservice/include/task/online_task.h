@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,9 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_ONLINE_TASK_H
 #define OHOS_DISTRIBUTED_HARDWARE_ONLINE_TASK_H
 
+#include <utility>
+#include <vector>
+
 #include "task.h"
 
 namespace OHOS {
@@ -31,6 +34,7 @@ public:
 private:
     void DoSyncInfo();
     void CreateEnableTask();
+    void PreloadDistributedHDF(const std::vector<std::pair<std::string, DHType>> &devDhInfos);
     void CreateMetaEnableTask();
     void CreateEnableSinkTask();
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -35,6 +35,8 @@ public:
     void AddTask(std::shared_ptr<Task> task);
     void RemoveTask(std::string taskId);
     int32_t WaitForALLTaskFinish();
+    int32_t WaitForAllDisableTaskFinish(int32_t timeoutMs);
+    int32_t WaitForOtherTaskFinish(const std::string &taskId, int32_t timeoutMs);
     void SaveEnabledDevice(const std::string &enabledDeviceKey, const TaskParam &taskParam);
     void RemoveEnabledDevice(const std::string &enabledDeviceKey);
     const std::unordered_map<std::string, TaskParam> GetEnabledDevice();
@@ -44,6 +46,7 @@ public:
 
 private:
     void RemoveTaskInner(std::string taskId);
+    int32_t GetDisableTaskCountInner();
 
 private:
     std::condition_variable conVar_;
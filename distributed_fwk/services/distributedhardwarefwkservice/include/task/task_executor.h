@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,9 +16,10 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_TASK_EXECUTOR_H
 #define OHOS_DISTRIBUTED_HARDWARE_TASK_EXECUTOR_H
 
-#include <condition_variable>
+#include <deque>
+#include <map>
 #include <mutex>
-#include <queue>
+#include <string>
 
 #include "ffrt.h"
 
@@ -27,22 +28,34 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+/*
+ * Runs the tasks of one (networkId, dhType) lane in push order and different lanes side by side, on at most
+ * MAX_TASK_WORKERS ffrt workers. A worker takes one task of a lane per turn, so a busy device does not hold
+ * back the others. Tasks waiting on other tasks, like OffLineTask, leave their lane before they wait.
+ */
 class TaskExecutor {
 FWK_DECLARE_SINGLE_INSTANCE_BASE(TaskExecutor);
 public:
     explicit TaskExecutor();
     ~TaskExecutor();
     void PushTask(const std::shared_ptr<Task> task);
+    size_t GetPendingTaskCount();
+    size_t GetPeakPendingTaskCount();
 
 private:
-    std::shared_ptr<Task> PopTask();
-    void TriggerTask();
+    static std::string GetLaneKey(const std::shared_ptr<Task> &task);
+    void StartWorkers();
+    void RunTasks();
 
 private:
-    std::queue<std::shared_ptr<Task>> taskQueue_;
+    // the lanes having tasks queued or running, <networkId#dhType, tasks not started yet>
+    std::map<std::string, std::deque<std::shared_ptr<Task>>> taskLanes_;
+    // the lanes waiting for a worker, a lane is never in here while its task runs
+    std::deque<std::string> readyLanes_;
+    size_t pendingTaskCount_ = 0;
+    size_t peakPendingTaskCount_ = 0;
+    size_t runningWorkers_ = 0;
     ffrt::mutex taskQueueMtx_;
-    ffrt::condition_variable condVar_;
-    bool taskThreadFlag_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -17,6 +17,10 @@
 #define OHOS_DISTRIBUTED_HARDWARE_COMM_TOOL_H
 
 #include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 #include <memory>
@@ -40,12 +44,47 @@ public:
      *        msg means the device need the dh capatilities, the remote side should use
      *        localNetworkId to send dh capatilities msg back.
      *
+     *        The request carries the digest and the generation of the remote meta capabilities saved
+     *        locally, a remote side holding the same ones only sends the digest back, one still holding
+     *        that generation sends the entries added, changed or removed since then.
+     *
      * @param remoteNetworkId the target device network id
+     * @param withDigest whether to offer the digest of the saved remote meta capabilities
      */
-    void TriggerReqFullDHCaps(const std::string &remoteNetworkId);
-    void GetAndSendLocalFullCaps(const std::string &reqNetworkId, bool isSyncMeta);
+    void TriggerReqFullDHCaps(const std::string &remoteNetworkId, bool withDigest = true);
+    /**
+     * @brief trigger request remote dh send back the capatilities of one dh type, or of one dhId of it.
+     *        The answer is merged into the saved remote meta capabilities, which stay partial until the
+     *        full capatilities are synced at idle time.
+     *
+     * @param remoteNetworkId the target device network id
+     * @param dhType the dh type asked for
+     * @param dhId the dh id asked for, empty for every dh of the type
+     */
+    void TriggerReqPartialDHCaps(const std::string &remoteNetworkId, DHType dhType, const std::string &dhId);
+    /* Binds the session to a trusted remote device ahead of the first capabilities exchange. */
+    void PreOpenSocket(const std::string &remoteNetworkId);
+    void GetAndSendLocalFullCaps(const std::string &reqNetworkId, bool isSyncMeta,
+        const std::string &reqDigest = "", uint64_t reqGeneration = 0);
+    void GetAndSendLocalPartialCaps(const std::string &reqNetworkId, DHType dhType, const std::string &dhId);
     FullCapsRsp ParseAndSaveRemoteDHCaps(const std::string &remoteCaps, bool isSyncMeta,
         const std::string &realNetworkId);
+    /* Gets the saved remote meta capabilities if they still match the digest the remote side sent back. */
+    bool GetUnchangedRemoteDHCaps(const std::string &remoteDigest, const std::string &realNetworkId,
+        FullCapsRsp &capsRsp);
+    /* Applies a delta response onto the saved remote meta capabilities, false if a full sync is needed. */
+    bool ApplyRemoteDHCapsDelta(const CommMsg &commMsg, FullCapsRsp &capsRsp);
+    static std::string GetMetaCapsDigest(const std::vector<std::shared_ptr<MetaCapabilityInfo>> &metaCaps);
+    uint64_t UpdateLocalCapsGeneration(const std::vector<std::shared_ptr<MetaCapabilityInfo>> &metaCaps,
+        const std::string &digest);
+    bool GetLocalCapsDelta(uint64_t baseGeneration, const std::string &baseDigest,
+        const std::vector<std::shared_ptr<MetaCapabilityInfo>> &metaCaps,
+        std::vector<std::shared_ptr<MetaCapabilityInfo>> &changedCaps, std::vector<std::string> &removedKeys);
+    void SetRemoteCapsGeneration(const std::string &remoteNetworkId, uint64_t generation);
+    /* Marks the saved caps of the remote device partial and defers its full sync to idle time. */
+    void OnRemotePartialCapsSaved(const std::string &remoteNetworkId);
+    void OnRemoteFullCapsSaved(const std::string &remoteNetworkId);
+    bool HasRemotePartialCapsOnly(const std::string &remoteNetworkId);
     std::string GetLocalFullMetaCapsInfo(bool isSyncMeta);
     std::string GetLocalFullCapsInfo(bool isSyncMeta);
 
@@ -57,7 +96,9 @@ public:
         void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event) override;
     private:
         void ProcessFullCapsRsp(const FullCapsRsp &capsRsp, const std::shared_ptr<DHCommTool> dhCommToolPtr,
-            bool isSyncMeta, const std::string &realNetworkId);
+            bool isSyncMeta, const std::string &realNetworkId, bool isPartial = false);
+        void ProcessSavedCapsRsp(const std::shared_ptr<CommMsg> &commMsg,
+            const std::shared_ptr<DHCommTool> dhCommToolPtr);
         std::weak_ptr<DHCommTool> dhCommToolWPtr_;
     };
     std::shared_ptr<DHCommTool::DHCommToolEventHandler> GetEventHandler();
@@ -65,15 +106,36 @@ public:
 
 private:
     bool CheckCallerAclRight(const std::string &localNetworkId, const std::string &remoteNetworkId);
+    void SendCapsReq(const std::string &remoteNetworkId, CommMsg &commMsg);
+    bool IsSyncResponseExpected(const std::string &remoteNetworkId);
     bool GetOsAccountInfo();
     std::string SplitString(const std::string &capInfoPrefix);
     bool IsSaveRemoteDHCaps(const FullCapsRsp &capsRsp, bool isSyncMeta, const std::string &realNetworkId);
+    std::string GetRemoteMetaCapsDigest(const std::string &remoteNetworkId);
+    uint64_t GetRemoteCapsGeneration(const std::string &remoteNetworkId);
+    std::string GetMetaCapsInfo(const std::vector<std::shared_ptr<MetaCapabilityInfo>> &metaCaps, bool isSyncMeta);
 private:
+    /* The local meta capabilities as sent at one generation, <key, json> */
+    struct CapsSnapshot {
+        uint64_t generation;
+        std::string digest;
+        std::map<std::string, std::string> entries;
+    };
+
     std::shared_ptr<DHTransport> dhTransportPtr_;
     std::shared_ptr<DHCommTool::DHCommToolEventHandler> eventHandler_;
     std::string accountId_;
     int32_t userId_ = -1;
     uint64_t tokenId_ = 0;
+    std::mutex capsGenMtx_;
+    uint64_t localCapsGeneration_ = 0;
+    // the latest generations sent, oldest first, requesters holding older ones get the full caps
+    std::deque<CapsSnapshot> localCapsSnapshots_;
+    // generation of the saved caps of each remote device, <remote networkId, generation>
+    std::map<std::string, uint64_t> remoteCapsGenerations_;
+    std::mutex partialCapsMtx_;
+    // remote devices whose saved caps only hold what a partial request asked for
+    std::set<std::string> partialCapsNetworkIds_;
 };
 } // DistributedHardware
 } // OHOS
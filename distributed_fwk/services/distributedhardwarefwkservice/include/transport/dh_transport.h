@@ -18,30 +18,48 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "socket.h"
 #include "softbus_bus_center.h"
 
 #include "dh_transport_obj.h"
+#include "dh_zlib_codec.h"
+#include "event_handler.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 class DHCommTool;
 class DHTransport {
 public:
+    // Called once the socket to the remote device is bound, or with the error of the last bind attempt.
+    using SocketReadyCallback = std::function<void(const std::string &remoteNetworkId, int32_t result)>;
+
     explicit DHTransport(std::shared_ptr<DHCommTool> dhCommToolPtr);
     int32_t Init();
     int32_t UnInit();
     virtual ~DHTransport() = default;
     // open softbus channel with remote device by networkid.
     int32_t StartSocket(const std::string &remoteNetworkId);
+    /*
+     * Binds the client socket on a bind worker and returns at once, retrying up to MAX_BIND_ATTEMPTS times with
+     * a doubling backoff. The messages sent meanwhile are queued and go out once the socket is bound.
+     */
+    int32_t StartSocketAsync(const std::string &remoteNetworkId, SocketReadyCallback callback = nullptr);
     // stop softbus channel with remote device by networkid.
     int32_t StopSocket(const std::string &remoteNetworkId);
+    /*
+     * Queues the payload for the remote device. The messages queued within SEND_COALESCE_WINDOW_MS go out as
+     * one compressed frame, and the ones queued while StartSocket binds wait for the socket.
+     */
     int32_t Send(const std::string &remoteNetworkId, const std::string &payload);
+    int32_t FlushSendQueue(const std::string &remoteNetworkId);
     int32_t OnSocketOpened(int32_t socketId, const PeerSocketInfo &info);
     void OnSocketClosed(int32_t socketId, ShutdownReason reason);
     void OnBytesReceived(int32_t socketId, const void *data, uint32_t dataLen);
@@ -49,13 +67,37 @@ public:
 private:
     int32_t CreateServerSocket();
     int32_t CreateClientSocket(const std::string &remoteDevId);
+    int32_t BindClientSocket(const std::string &remoteNetworkId);
+    void AddClientSocket(const std::string &remoteNetworkId, int32_t socketId);
+    bool PostBindTask(const std::string &remoteNetworkId, int32_t attempt, int64_t delayMs);
+    void RunBindAttempt(const std::string &remoteNetworkId, int32_t attempt);
+    bool IsDeviceSocketBinding(const std::string &remoteNetworkId);
     bool IsDeviceSessionOpened(const std::string &remoteDevId, int32_t &socketId);
     std::string GetRemoteNetworkIdBySocketId(int32_t socketId);
     void ClearDeviceSocketOpened(const std::string &remoteDevId);
-    void HandleReceiveMessage(const std::string &payload, const std::string &remoteNeworkId);
+    void HandleReceiveMessage(const std::string &rawPayload, const std::string &remoteNeworkId);
+    std::shared_ptr<DHZlibCodec> GetSocketCodec(int32_t socketId);
+    void RemoveSocketCodec(int32_t socketId);
+    void UpdatePeerDictId(const std::string &remoteNetworkId, uint32_t dictId);
+    bool IsPeerDictMatched(const std::string &remoteNetworkId);
+    void RemovePeerFeatures(const std::string &remoteNetworkId);
     bool CheckCalleeAclRight(const std::shared_ptr<CommMsg> commMsg);
+    bool PostFlushTask(const std::string &remoteNetworkId, int64_t delayMs);
+    bool SetDeviceSocketBinding(const std::string &remoteNetworkId, SocketReadyCallback callback = nullptr);
+    void OnDeviceSocketBound(const std::string &remoteNetworkId, bool isBound);
+    int32_t SendFrame(const std::string &remoteNetworkId, int32_t socketId, const std::string &payload);
+    void UpdatePeerBatchSupported(const std::string &remoteNetworkId, bool isSupported);
+    bool IsPeerBatchSupported(const std::string &remoteNetworkId);
+    static void PackBatches(const std::vector<std::string> &payloads, std::vector<std::string> &frames);
+    static bool UnpackBatch(const std::string &frame, std::vector<std::string> &payloads);
 
 private:
+    /* Messages to one remote device waiting for the coalescing window to end or for the socket to be bound. */
+    struct PeerSendQueue {
+        std::vector<std::string> payloads;
+        bool isFlushPosted = false;
+    };
+
     std::mutex rmtSocketIdMtx_;
     // record the socket id for the connection with remote devices, <remote networkId, socketId>
     std::map<std::string, int32_t> remoteDevSocketIds_;
@@ -63,6 +105,21 @@ private:
     std::string localSocketName_;
     std::atomic<bool> isSocketSvrCreateFlag_;
     std::weak_ptr<DHCommTool> dhCommToolWPtr_;
+    std::mutex codecMtx_;
+    // zlib states reused by all messages of a socket, <socketId, codec>
+    std::map<int32_t, std::shared_ptr<DHZlibCodec>> socketCodecs_;
+    // preset dictionary id advertised by each peer, <remote networkId, dictId>
+    std::map<std::string, uint32_t> peerDictIds_;
+    // peers advertising they split coalesced frames, the others get one frame per message
+    std::set<std::string> batchPeers_;
+    std::mutex sendQueueMtx_;
+    std::map<std::string, PeerSendQueue> sendQueues_;
+    // peers whose client socket StartSocket is binding
+    std::set<std::string> bindingNetworkIds_;
+    // waiting for the bind of each peer, <remote networkId, callbacks>
+    std::map<std::string, std::vector<SocketReadyCallback>> bindCallbacks_;
+    // Bind blocks on the softbus handshake, the workers keep it off the callers and bind peers side by side.
+    std::vector<std::shared_ptr<AppExecFwk::EventHandler>> bindHandlers_;
 };
 } // DistributedHardware
 } // OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -33,6 +33,15 @@ const char* const COMM_MSG_USERID_KEY = "userId";
 const char* const COMM_MSG_TOKENID_KEY = "tokenId";
 const char* const COMM_MSG_ACCOUNTID_KEY = "accountId";
 const char* const COMM_MSG_SYNC_META_KEY = "sync_meta";
+const char* const COMM_MSG_CAPS_DIGEST_KEY = "caps_digest";
+const char* const COMM_MSG_COMPRESS_DICT_KEY = "compress_dict";
+const char* const COMM_MSG_CAPS_GEN_KEY = "caps_gen";
+const char* const COMM_MSG_CAPS_BASE_GEN_KEY = "caps_base_gen";
+const char* const COMM_MSG_CAPS_REMOVED_KEY = "caps_removed";
+const char* const COMM_MSG_REQ_DH_TYPE_KEY = "req_dh_type";
+const char* const COMM_MSG_REQ_DH_ID_KEY = "req_dh_id";
+const char* const COMM_MSG_CAPS_PARTIAL_KEY = "caps_partial";
+const char* const COMM_MSG_BATCH_KEY = "batch";
 
 struct FullCapsRsp {
     // the networkd id of rsp from which device
@@ -58,10 +67,36 @@ struct CommMsg {
     std::string accountId;
     bool isSyncMeta;
     std::string realNetworkId;
-    CommMsg() : code(-1), userId(-1), tokenId(0), msg(""), accountId(""), isSyncMeta(false), realNetworkId("") {}
+    /* Digest of the meta capabilities, a response with a digest and an empty msg means they are unchanged. */
+    std::string capsDigest;
+    /* Preset dictionary id the sender inflates with, 0 from old peers. ToJson always sends the local one. */
+    uint32_t compressDictId;
+    /* Generation of the meta capabilities the digest describes, 0 when unknown. */
+    uint64_t capsGeneration;
+    /*
+     * Set in a response carrying a delta: msg only holds the capabilities added or changed since this
+     * generation, removedCapKeys the keys dropped since then.
+     */
+    uint64_t capsBaseGeneration;
+    std::vector<std::string> removedCapKeys;
+    /*
+     * Set in a request for the capabilities of one type only, or of one dhId when reqDHId is not empty.
+     * Old peers ignore them and send back the full capabilities.
+     */
+    uint32_t reqDHType;
+    std::string reqDHId;
+    /* Set in a response answering such a request, msg only holds the capabilities asked for. */
+    bool isPartialCaps;
+    /* Whether the sender splits coalesced frames, false from old peers. ToJson always sends true. */
+    bool isBatchSupported;
+    CommMsg() : code(-1), userId(-1), tokenId(0), msg(""), accountId(""), isSyncMeta(false), realNetworkId(""),
+        compressDictId(0), capsGeneration(0), capsBaseGeneration(0), reqDHType(0), reqDHId(""),
+        isPartialCaps(false), isBatchSupported(false) {}
     CommMsg(int32_t code, int32_t userId, uint64_t tokenId, std::string msg, std::string accountId,
         bool isSyncMeta, std::string realNetworkId) : code(code), userId(userId), tokenId(tokenId), msg(msg),
-        accountId(accountId), isSyncMeta(isSyncMeta), realNetworkId(realNetworkId) {}
+        accountId(accountId), isSyncMeta(isSyncMeta), realNetworkId(realNetworkId), compressDictId(0),
+        capsGeneration(0), capsBaseGeneration(0), reqDHType(0), reqDHId(""), isPartialCaps(false),
+        isBatchSupported(false) {}
 };
 
 void ToJson(cJSON *jsonObject, const CommMsg &commMsg);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,9 +19,11 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <shared_mutex>
 #include <map>
+#include <vector>
 
 #include "device_type.h"
 #include "event_handler.h"
@@ -61,12 +63,53 @@ struct DeviceIdEntry {
     }
 };
 
+/*
+ * The online device entries with a hash index per id. Find* returns the first entry in set order
+ * holding the id, the one a scan of the set would find, or nullptr.
+ */
+class DeviceIdEntrySet {
+public:
+    using ConstIterator = std::set<DeviceIdEntry>::const_iterator;
+    bool insert(const DeviceIdEntry &entry);
+    void erase(const DeviceIdEntry &entry);
+    void clear();
+    bool empty() const;
+    size_t size() const;
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+    const DeviceIdEntry *FindByNetworkId(const std::string &networkId) const;
+    const DeviceIdEntry *FindByUuid(const std::string &uuid) const;
+    const DeviceIdEntry *FindByUdid(const std::string &udid) const;
+    const DeviceIdEntry *FindByDeviceId(const std::string &deviceId) const;
+    const DeviceIdEntry *FindByUdidHash(const std::string &udidHash) const;
+
+private:
+    // <id, entries holding it>, the entries live in entries_ whose nodes never move
+    using Index = std::unordered_map<std::string, std::vector<const DeviceIdEntry *>>;
+    static void AddToIndex(Index &index, const std::string &key, const DeviceIdEntry *entry);
+    static void RemoveFromIndex(Index &index, const std::string &key, const DeviceIdEntry *entry);
+    static const DeviceIdEntry *FindInIndex(const Index &index, const std::string &key);
+
+    std::set<DeviceIdEntry> entries_;
+    Index networkIdIndex_;
+    Index uuidIndex_;
+    Index udidIndex_;
+    Index deviceIdIndex_;
+    Index udidHashIndex_;
+};
+
 class DHContext {
 FWK_DECLARE_SINGLE_INSTANCE_BASE(DHContext);
 public:
     DHContext();
     ~DHContext();
     const DeviceInfo& GetDeviceInfo();
+    /*
+     * The local device identity as an immutable snapshot, swapped atomically and only when the identity
+     * changes. Readers in loops keep the pointer instead of copying the strings under devMutex_.
+     */
+    std::shared_ptr<const DeviceInfo> GetDeviceInfoSnapshot();
 
     /* Save online device UUID and networkId when devices online */
     void AddOnlineDevice(const std::string &udid, const std::string &uuid, const std::string &networkId);
@@ -124,11 +167,14 @@ private:
         sptr<IRemoteObject> AsObject() override;
     };
     void RegisDHFWKIsomerismListener();
+    void PublishDeviceInfoLocked();
 private:
     DeviceInfo devInfo_ { "", "", "", "", "", "", 0 };
     std::mutex devMutex_;
+    // only accessed through std::atomic_load and std::atomic_store
+    std::shared_ptr<const DeviceInfo> devInfoSnapshot_ = nullptr;
 
-    std::set<DeviceIdEntry> devIdEntrySet_;
+    DeviceIdEntrySet devIdEntrySet_;
     std::shared_mutex onlineDevMutex_;
 
     std::set<std::string> realTimeOnLineNetworkIdSet_;
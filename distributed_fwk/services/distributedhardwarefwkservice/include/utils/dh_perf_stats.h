@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DISTRIBUTED_HARDWARE_DH_PERF_STATS_H
+#define OHOS_DISTRIBUTED_HARDWARE_DH_PERF_STATS_H
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+enum class PerfCategory : uint32_t {
+    TASK_RUN = 0,
+    COMPONENT_ENABLE,
+    COMPONENT_DISABLE,
+    COMPONENT_RECOVER,
+    DB_PUT,
+    DB_SYNC,
+    PUBLISHER_DELIVERY,
+    SOCKET_BIND,
+    SOCKET_BIND_FAIL,
+    MAX,
+};
+
+// Upper bounds of the cost histogram buckets, the last bucket takes everything above.
+constexpr std::array<int64_t, 5> PERF_BUCKET_BOUNDS_US = { 1000, 10000, 100000, 1000000, 10000000 };
+constexpr size_t PERF_BUCKET_COUNT = PERF_BUCKET_BOUNDS_US.size() + 1;
+
+struct PerfCostStat {
+    uint64_t count = 0;
+    int64_t totalUs = 0;
+    int64_t maxUs = 0;
+    std::array<uint64_t, PERF_BUCKET_COUNT> buckets {};
+};
+
+struct PerfTrafficStat {
+    uint64_t msgCount = 0;
+    uint64_t rawBytes = 0;
+    uint64_t sentBytes = 0;
+};
+
+/*
+ * Cost and traffic counters of the framework, kept for the hidumper so slow device online handling can be looked
+ * into on the field. Every category keeps at most MAX_PERF_KEYS keys, the ones after are dropped.
+ */
+class DHPerfStats {
+FWK_DECLARE_SINGLE_INSTANCE(DHPerfStats);
+
+public:
+    static int64_t GetNowUs();
+    void RecordCost(PerfCategory category, const std::string &key, int64_t costUs);
+    void RecordTraffic(const std::string &networkId, uint64_t rawBytes, uint64_t sentBytes);
+    void DumpCostStats(PerfCategory category, std::map<std::string, PerfCostStat> &costStats);
+    void DumpTrafficStats(std::map<std::string, PerfTrafficStat> &trafficStats);
+    void Reset();
+
+private:
+    static constexpr size_t MAX_PERF_KEYS = 256;
+
+    std::mutex statsMutex_;
+    std::array<std::map<std::string, PerfCostStat>, static_cast<size_t>(PerfCategory::MAX)> costStats_;
+    std::map<std::string, PerfTrafficStat> trafficStats_;
+};
+
+// Records the time between its construction and its destruction, whichever way the scope is left.
+class PerfCostScope {
+public:
+    PerfCostScope(PerfCategory category, const std::string &key);
+    ~PerfCostScope();
+
+private:
+    PerfCategory category_;
+    std::string key_;
+    int64_t startUs_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DISTRIBUTED_HARDWARE_DH_PERF_STATS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,13 +16,10 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_DH_TIMER_H
 #define OHOS_DISTRIBUTED_HARDWARE_DH_TIMER_H
 
-#include <condition_variable>
 #include <cstdint>
 #include <memory>
 #include <mutex>
-#include <thread>
-
-#include "event_handler.h"
+#include <string>
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -36,17 +33,23 @@ public:
 private:
     virtual void ExecuteInner() = 0;
     virtual void HandleStopTimer() = 0;
-    void InitTimer();
     void ReleaseTimer();
     void Execute();
-    void StartEventRunner();
+    void PostTimerTask(void (DHTimer::*func)());
 
 private:
-    std::thread eventHandlerThread_;
-    std::mutex timerMutex_;
-    std::condition_variable timerCond_;
-    std::shared_ptr<OHOS::AppExecFwk::EventHandler> eventHandler_;
+    /*
+     * Shared with the tasks posted to the timer service. Releasing bumps the generation under the lock, so a task
+     * armed before never runs and one already running is waited out.
+     */
+    struct TimerState {
+        std::recursive_mutex mutex;
+        DHTimer *timer = nullptr;
+        uint64_t generation = 0;
+    };
+    std::shared_ptr<TimerState> state_;
     std::string timerId_;
+    std::string taskName_;
     int32_t delayTimeMs_;
 };
 } // namespace DistributedHardware
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DISTRIBUTED_HARDWARE_DH_TIMER_SERVICE_H
+#define OHOS_DISTRIBUTED_HARDWARE_DH_TIMER_SERVICE_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "event_handler.h"
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * One timer thread for the whole process. Timers post named delayed tasks here instead of keeping an event runner
+ * each, the thread starts with the first task and stays for the process.
+ */
+class DHTimerService {
+FWK_DECLARE_SINGLE_INSTANCE(DHTimerService);
+
+public:
+    bool PostTask(const std::string &name, const std::function<void()> &task, int64_t delayTimeMs);
+    void RemoveTask(const std::string &name);
+
+private:
+    std::shared_ptr<AppExecFwk::EventHandler> GetEventHandler();
+
+    std::mutex handlerMutex_;
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DISTRIBUTED_HARDWARE_DH_TIMER_SERVICE_H
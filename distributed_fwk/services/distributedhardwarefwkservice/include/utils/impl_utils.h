@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -34,6 +34,17 @@ enum class TaskType : int32_t {
     EXIT_DFWK = 7
 };
 
+const std::unordered_map<TaskType, std::string> TaskTypeStrMap = {
+    { TaskType::UNKNOWN, "UNKNOWN" },
+    { TaskType::ENABLE, "ENABLE" },
+    { TaskType::DISABLE, "DISABLE" },
+    { TaskType::ON_LINE, "ON_LINE" },
+    { TaskType::OFF_LINE, "OFF_LINE" },
+    { TaskType::META_ENABLE, "META_ENABLE" },
+    { TaskType::META_DISABLE, "META_DISABLE" },
+    { TaskType::EXIT_DFWK, "EXIT_DFWK" },
+};
+
 enum class TaskStep : int32_t {
     DO_ENABLE = 1,
     DO_DISABLE = 2,
@@ -104,6 +115,28 @@ struct TaskDump {
     TaskState taskState;
     std::vector<TaskStep> taskSteps;
 };
+
+struct RecoverDump {
+    DHType dhType { DHType::UNKNOWN };
+    // the enable tasks issued by the last recovery of this type and how many of them failed
+    size_t taskCount { 0 };
+    size_t failedCount { 0 };
+    int64_t costMs { 0 };
+    int64_t finishTime { 0 };
+};
+
+struct HdfLoadDump {
+    DHType dhType { DHType::UNKNOWN };
+    int32_t refCount { 0 };
+    // loads that really started the driver, and loads served by a driver that was still up
+    uint32_t loadCount { 0 };
+    uint32_t reuseCount { 0 };
+    uint32_t preloadCount { 0 };
+    uint32_t unloadCount { 0 };
+    int64_t lastLoadCostMs { 0 };
+    int64_t maxLoadCostMs { 0 };
+    bool unloadPending { false };
+};
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -29,6 +29,7 @@
 #include "distributed_hardware_errno.h"
 #include "distributed_hardware_log.h"
 #include "distributed_hardware_manager_factory.h"
+#include "parameters.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -40,6 +41,15 @@ namespace {
     constexpr int32_t NEW_HO_DEVICE_TYPE = 11;
     constexpr int32_t DH_RETRY_INIT_DM_COUNT = 6;
     constexpr int32_t DH_RETRY_INIT_DM_INTERVAL_US = 1000 * 500;
+    const std::string OFFLINE_GRACE_PARAM = "persist.distributed_hardware.dhfwk.offline_grace_ms";
+    constexpr int32_t DEFAULT_OFFLINE_GRACE_MS = 3 * 1000;
+    constexpr int32_t MAX_OFFLINE_GRACE_MS = 60 * 1000;
+    const std::string OFFLINE_TASK_PREFIX = "DeferredOffline_";
+
+    int32_t GetOfflineGraceMs()
+    {
+        return OHOS::system::GetIntParameter(OFFLINE_GRACE_PARAM, DEFAULT_OFFLINE_GRACE_MS, 0, MAX_OFFLINE_GRACE_MS);
+    }
 }
 
 AccessManager::~AccessManager()
@@ -144,6 +154,18 @@ void AccessManager::OnDeviceOnline(const DmDeviceInfo &deviceInfo)
         GetAnonyString(networkId).c_str(), GetAnonyString(uuid).c_str(), GetAnonyString(udid).c_str(),
         deviceInfo.deviceTypeId, osType);
 
+    PendingOffline offline;
+    if (TakeDeferredOffline(networkId, offline)) {
+        if (offline.uuid == uuid) {
+            suppressedCounts_[networkId]++;
+            totalSuppressed_++;
+            DHLOGI("Device back within the offline grace window, skip both events, networkId: %{public}s",
+                GetAnonyString(networkId).c_str());
+            return;
+        }
+        DistributedHardwareManagerFactory::GetInstance().SendOffLineEvent(networkId, offline.uuid, offline.udid,
+            offline.deviceType);
+    }
     auto ret = DistributedHardwareManagerFactory::GetInstance().SendOnLineEvent(networkId, uuid, udid,
         deviceInfo.deviceTypeId, osType);
     DHLOGI("Online event result: %{public}d, networkId: %{public}s", ret, GetAnonyString(networkId).c_str());
@@ -173,6 +195,10 @@ void AccessManager::OnDeviceOffline(const DmDeviceInfo &deviceInfo)
         "deviceTypeId: %{public}d", GetAnonyString(deviceName).c_str(), GetAnonyString(networkId).c_str(),
         GetAnonyString(uuid).c_str(), GetAnonyString(udid).c_str(), deviceInfo.deviceTypeId);
 
+    if (DeferOffline(networkId, { uuid, udid, deviceInfo.deviceTypeId })) {
+        return;
+    }
+    suppressedCounts_.erase(networkId);
     auto ret = DistributedHardwareManagerFactory::GetInstance().SendOffLineEvent(networkId, uuid, udid,
         deviceInfo.deviceTypeId);
     DHLOGI("Offline event result: %{public}d, networkId: %{public}s", ret, GetAnonyString(networkId).c_str());
@@ -190,6 +216,8 @@ void AccessManager::OnDeviceReady(const DmDeviceInfo &deviceInfo)
     }
     DHLOGI("Ready device deviceName: %{public}s, networkId: %{public}s", GetAnonyString(deviceName).c_str(),
         GetAnonyString(networkId).c_str());
+    // A ready device is trusted, so its first capabilities exchange can ride a session bound now.
+    DistributedHardwareManagerFactory::GetInstance().PreOpenCapsSyncSession(networkId);
 
     if (!DeviceParamMgr::GetInstance().GetDeviceSyncDataMode()) {
         DHLOGI("local device is not e2e device, no need sync data.");
@@ -236,5 +264,81 @@ int32_t AccessManager::Dump(const std::vector<std::string> &argsStr, std::string
 {
     return DistributedHardwareManagerFactory::GetInstance().Dump(argsStr, result);
 }
+
+void AccessManager::DumpDeviceFlaps(std::vector<DeviceFlapDump> &flapInfos, uint64_t &totalSuppressed)
+{
+    std::lock_guard<std::mutex> lock(accessMutex_);
+    totalSuppressed = totalSuppressed_;
+    std::map<std::string, DeviceFlapDump> dumps;
+    for (const auto &item : suppressedCounts_) {
+        dumps[item.first].suppressedCount = item.second;
+    }
+    for (const auto &item : pendingOfflines_) {
+        dumps[item.first].offlinePending = true;
+    }
+    for (auto &item : dumps) {
+        item.second.networkId = item.first;
+        flapInfos.push_back(item.second);
+    }
+}
+
+bool AccessManager::DeferOffline(const std::string &networkId, const PendingOffline &offline)
+{
+    int32_t graceMs = GetOfflineGraceMs();
+    if (graceMs <= 0) {
+        return false;
+    }
+    if (eventHandler_ == nullptr) {
+        std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create(true);
+        eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
+    std::weak_ptr<AccessManager> weakSelf = weak_from_this();
+    auto offlineTask = [weakSelf, networkId]() {
+        auto self = weakSelf.lock();
+        if (self != nullptr) {
+            self->OnOfflineGraceExpired(networkId);
+        }
+    };
+    std::string taskName = OFFLINE_TASK_PREFIX + networkId;
+    eventHandler_->RemoveTask(taskName);
+    if (!eventHandler_->PostTask(offlineTask, taskName, graceMs)) {
+        DHLOGE("Post deferred offline task failed, offline now, networkId: %{public}s",
+            GetAnonyString(networkId).c_str());
+        return false;
+    }
+    pendingOfflines_[networkId] = offline;
+    DHLOGI("Defer the offline event for %{public}d ms, networkId: %{public}s", graceMs,
+        GetAnonyString(networkId).c_str());
+    return true;
+}
+
+bool AccessManager::TakeDeferredOffline(const std::string &networkId, PendingOffline &offline)
+{
+    auto iter = pendingOfflines_.find(networkId);
+    if (iter == pendingOfflines_.end()) {
+        return false;
+    }
+    offline = iter->second;
+    pendingOfflines_.erase(iter);
+    if (eventHandler_ != nullptr) {
+        eventHandler_->RemoveTask(OFFLINE_TASK_PREFIX + networkId);
+    }
+    return true;
+}
+
+void AccessManager::OnOfflineGraceExpired(const std::string &networkId)
+{
+    std::lock_guard<std::mutex> lock(accessMutex_);
+    PendingOffline offline;
+    if (!TakeDeferredOffline(networkId, offline)) {
+        DHLOGI("The deferred offline has been cancelled, networkId: %{public}s", GetAnonyString(networkId).c_str());
+        return;
+    }
+    suppressedCounts_.erase(networkId);
+    auto ret = DistributedHardwareManagerFactory::GetInstance().SendOffLineEvent(networkId, offline.uuid,
+        offline.udid, offline.deviceType);
+    DHLOGI("Deferred offline event result: %{public}d, networkId: %{public}s", ret,
+        GetAnonyString(networkId).c_str());
+}
 } // namespace DistributedHardware
 } // namespace OHOS
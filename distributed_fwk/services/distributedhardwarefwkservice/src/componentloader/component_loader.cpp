@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -302,6 +302,7 @@ void ComponentLoader::StoreLocalDHVersionInDB()
     versionInfo.dhVersion = VersionManager::GetInstance().GetLocalDeviceVersion();
     versionInfo.deviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
     versionInfo.compVersions = localDHVersion_.compVersions;
+    versionInfo.capCodecVersion = CAP_CODEC_LOCAL_VERSION;
     VersionInfoManager::GetInstance()->AddVersion(versionInfo);
 }
 
@@ -511,6 +512,7 @@ int32_t ComponentLoader::UnInit()
 
 int32_t ComponentLoader::ReleaseHardwareHandler(const DHType dhType)
 {
+    std::lock_guard<std::mutex> lock(compHandlerMapMutex_);
     if (!IsDHTypeExist(dhType)) {
         return ERR_DH_FWK_TYPE_NOT_EXIST;
     }
@@ -529,6 +531,7 @@ int32_t ComponentLoader::ReleaseHardwareHandler(const DHType dhType)
 
 int32_t ComponentLoader::ReleaseSource(const DHType dhType)
 {
+    std::lock_guard<std::mutex> lock(compHandlerMapMutex_);
     if (!IsDHTypeExist(dhType)) {
         return ERR_DH_FWK_TYPE_NOT_EXIST;
     }
@@ -547,6 +550,7 @@ int32_t ComponentLoader::ReleaseSource(const DHType dhType)
 
 int32_t ComponentLoader::ReleaseSink(const DHType dhType)
 {
+    std::lock_guard<std::mutex> lock(compHandlerMapMutex_);
     if (!IsDHTypeExist(dhType)) {
         return ERR_DH_FWK_TYPE_NOT_EXIST;
     }
@@ -624,6 +628,7 @@ DHType ComponentLoader::GetDHTypeBySrcSaId(const int32_t saId)
 
 std::map<std::string, bool> ComponentLoader::GetCompResourceDesc()
 {
+    std::lock_guard<std::mutex> lock(compHandlerMapMutex_);
     return resDescMap_;
 }
 
@@ -680,6 +685,7 @@ int32_t ComponentLoader::GetHardwareHandler(const DHType dhType)
 
 bool ComponentLoader::IsDHTypeSupport(DHType dhType)
 {
+    std::lock_guard<std::mutex> lock(compHandlerMapMutex_);
     return IsDHTypeExist(dhType);
 }
 } // namespace DistributedHardware
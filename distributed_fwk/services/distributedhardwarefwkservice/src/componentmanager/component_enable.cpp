@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -44,6 +44,11 @@ int32_t ComponentEnable::Enable(const std::string &networkId, const std::string
         DHLOGE("handler is null, networkId = %{public}s.", GetAnonyString(networkId).c_str());
         return ERR_DH_FWK_PARA_INVALID;
     }
+    {
+        // the same instance is reused by the retry loop, drop the result of the previous attempt
+        std::lock_guard<std::mutex> lock(mutex_);
+        status_ = std::numeric_limits<int32_t>::max();
+    }
 
     auto ret = handler->RegisterDistributedHardware(networkId, dhId, param, shared_from_this());
     if (ret != DH_FWK_SUCCESS) {
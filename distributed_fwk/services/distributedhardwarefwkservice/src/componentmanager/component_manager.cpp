@@ -15,6 +15,7 @@
 
 #include "component_manager.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <chrono>
 #include <future>
@@ -37,6 +38,7 @@
 #include "device_manager.h"
 #include "dh_context.h"
 #include "dh_data_sync_trigger_listener.h"
+#include "dh_perf_stats.h"
 #include "dh_state_listener.h"
 #include "dh_utils_hitrace.h"
 #include "dh_utils_hisysevent.h"
@@ -65,13 +67,21 @@ FWK_IMPLEMENT_SINGLE_INSTANCE(ComponentManager);
 namespace {
     constexpr int32_t ENABLE_RETRY_MAX_TIMES = 3;
     constexpr int32_t DISABLE_RETRY_MAX_TIMES = 3;
-    constexpr int32_t ENABLE_PARAM_RETRY_TIME = 500 * 1000;
+    constexpr int32_t ENABLE_PARAM_WAIT_TIMEOUT_MS = 1500;
+    constexpr size_t MAX_RECOVER_CONCURRENCY = 4;
+    constexpr int64_t US_PER_MS = 1000;
     constexpr int32_t INVALID_SA_ID = -1;
     constexpr int32_t UNINIT_COMPONENT_TIMEOUT_SECONDS = 2;
     constexpr int32_t SYNC_DATA_TIMEOUT_MS = 1000 * 9;
     constexpr const char *MIC = "mic";
     constexpr const char *CAMERA = "camera";
     const std::string SYNC_TIMEOUT_TASK_NAME = "sync_timeout";
+
+std::string GetDHTypeName(DHType dhType)
+{
+    auto iter = DHTypeStrMap.find(dhType);
+    return iter != DHTypeStrMap.end() ? iter->second : "UNKNOWN";
+}
 }
 
 ComponentManager::ComponentManager() : compSource_({}), compSink_({}), compSrcSaId_({}),
@@ -258,8 +268,9 @@ int32_t ComponentManager::Enable(const std::string &networkId, const std::string
     if (!IsIdLengthValid(networkId) || !IsIdLengthValid(uuid) || !IsIdLengthValid(dhId)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
-    std::unique_lock<std::shared_mutex> lock(compSourceMutex_);
-    if (compSource_.find(dhType) == compSource_.end()) {
+    PerfCostScope costScope(PerfCategory::COMPONENT_ENABLE, GetDHTypeName(dhType));
+    auto sourceHandler = GetDHSourceInstance(dhType);
+    if (sourceHandler == nullptr) {
         DHLOGE("can not find handler for dhId = %{public}s.", GetAnonyString(dhId).c_str());
         return ERR_DH_FWK_PARA_INVALID;
     }
@@ -281,15 +292,14 @@ int32_t ComponentManager::Enable(const std::string &networkId, const std::string
     }
 
     auto compEnable = std::make_shared<ComponentEnable>();
-    auto result = compEnable->Enable(networkId, dhId, param, (compSource_.find(dhType))->second, customParams);
+    auto result = compEnable->Enable(networkId, dhId, param, sourceHandler, customParams);
     if (result != DH_FWK_SUCCESS) {
         for (int32_t retryCount = 0; retryCount < ENABLE_RETRY_MAX_TIMES; retryCount++) {
             if (!DHContext::GetInstance().IsDeviceOnline(uuid)) {
                 DHLOGE("device is already offline, no need try enable, uuid= %{public}s", GetAnonyString(uuid).c_str());
                 return result;
             }
-            if (compEnable->Enable(networkId, dhId, param, (compSource_.find(dhType))->second, customParams)
-                    == DH_FWK_SUCCESS) {
+            if (compEnable->Enable(networkId, dhId, param, sourceHandler, customParams) == DH_FWK_SUCCESS) {
                 DHLOGE("enable success, retryCount = %{public}d", retryCount);
                 EnabledCompsDump::GetInstance().DumpEnabledComp(networkId, dhType, dhId);
                 return DH_FWK_SUCCESS;
@@ -327,20 +337,34 @@ int32_t ComponentManager::RetryGetEnableParam(const std::string &networkId, cons
     if (!IsIdLengthValid(networkId) || !IsIdLengthValid(uuid) || !IsIdLengthValid(dhId)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
-    for (int32_t retryCount = 0; retryCount < ENABLE_RETRY_MAX_TIMES; retryCount++) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ENABLE_PARAM_WAIT_TIMEOUT_MS);
+    std::unique_lock<std::mutex> lock(capAvailableMtx_);
+    for (int32_t retryCount = 0;; retryCount++) {
         if (!DHContext::GetInstance().IsDeviceOnline(uuid)) {
             DHLOGE("device is already offline, no need try GetEnableParam, uuid = %{public}s",
                 GetAnonyString(uuid).c_str());
             return ERR_DH_FWK_COMPONENT_ENABLE_FAILED;
         }
+        uint64_t seq = capAvailableSeq_;
+        lock.unlock();
         if (GetEnableParam(networkId, uuid, dhId, dhType, param) == DH_FWK_SUCCESS) {
-            DHLOGE("GetEnableParam success, retryCount = %{public}d", retryCount);
-            break;
+            DHLOGI("GetEnableParam success, retryCount = %{public}d", retryCount);
+            return DH_FWK_SUCCESS;
+        }
+        lock.lock();
+        if (!capAvailableCv_.wait_until(lock, deadline, [this, seq]() { return capAvailableSeq_ != seq; })) {
+            DHLOGE("wait capability timeout, uuid = %{public}s, dhId = %{public}s", GetAnonyString(uuid).c_str(),
+                GetAnonyString(dhId).c_str());
+            return ERR_DH_FWK_COMPONENT_GET_ENABLE_PARAM_FAILED;
         }
-        DHLOGE("GetEnableParam failed, retryCount = %{public}d", retryCount);
-        usleep(ENABLE_PARAM_RETRY_TIME);
     }
-    return DH_FWK_SUCCESS;
+}
+
+void ComponentManager::NotifyCapabilityAvailable()
+{
+    std::lock_guard<std::mutex> lock(capAvailableMtx_);
+    capAvailableSeq_++;
+    capAvailableCv_.notify_all();
 }
 
 int32_t ComponentManager::Disable(const std::string &networkId, const std::string &uuid, const std::string &dhId,
@@ -350,6 +374,7 @@ int32_t ComponentManager::Disable(const std::string &networkId, const std::strin
     if (!IsIdLengthValid(networkId) || !IsIdLengthValid(uuid) || !IsIdLengthValid(dhId)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
+    PerfCostScope costScope(PerfCategory::COMPONENT_DISABLE, GetDHTypeName(dhType));
     auto sourceHandler = GetDHSourceInstance(dhType);
     auto compDisable = std::make_shared<ComponentDisable>();
     auto result = compDisable->Disable(networkId, dhId, sourceHandler);
@@ -639,16 +664,91 @@ void ComponentManager::DoRecover(DHType dhType)
     if (ret != DH_FWK_SUCCESS) {
         DHLOGE("DoRecover setname failed.");
     }
+    int64_t startTime = GetCurrentTime();
     // reset enable status
     DHLOGI("Reset enable status for DHType %{public}" PRIu32, (uint32_t)dhType);
     ResetSinkEnableStatus(dhType);
     ResetSourceEnableStatus(dhType);
     // recover distributed hardware virtual driver
     DHLOGI("Recover distributed hardware virtual driver for DHType %{public}" PRIu32, (uint32_t)dhType);
-    RecoverAutoEnableSink(dhType);
-    RecoverAutoEnableSource(dhType);
-    RecoverActiveEnableSink(dhType);
-    RecoverActiveEnableSource(dhType);
+    std::vector<TaskParam> recoverParams;
+    RecoverAutoEnableSink(dhType, recoverParams);
+    RecoverAutoEnableSource(dhType, recoverParams);
+    RecoverActiveEnableSink(dhType, recoverParams);
+    RecoverActiveEnableSource(dhType, recoverParams);
+    size_t failedCount = RunRecoverTasks(recoverParams);
+
+    RecoverDump recoverInfo;
+    recoverInfo.dhType = dhType;
+    recoverInfo.taskCount = recoverParams.size();
+    recoverInfo.failedCount = failedCount;
+    recoverInfo.finishTime = GetCurrentTime();
+    recoverInfo.costMs = recoverInfo.finishTime - startTime;
+    DHPerfStats::GetInstance().RecordCost(PerfCategory::COMPONENT_RECOVER, GetDHTypeName(dhType),
+        recoverInfo.costMs * US_PER_MS);
+    DHLOGI("Recover end, dhType = %{public}#X, tasks = %{public}zu, failed = %{public}zu, cost = %{public}"
+        PRId64 "ms.", dhType, recoverInfo.taskCount, failedCount, recoverInfo.costMs);
+    std::lock_guard<std::mutex> lock(recoverInfosMtx_);
+    recoverInfos_[dhType] = recoverInfo;
+}
+
+size_t ComponentManager::RunRecoverTasks(const std::vector<TaskParam> &recoverParams)
+{
+    std::vector<std::shared_ptr<Task>> tasks;
+    for (const auto &taskParam : recoverParams) {
+        auto task = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, nullptr);
+        if (task != nullptr) {
+            tasks.push_back(task);
+        }
+    }
+    // The enables of different dhIds do not depend on each other, so they share the recovering type's
+    // workers instead of waiting in the device lane one after another.
+    std::atomic<size_t> nextTask { 0 };
+    std::atomic<size_t> failedCount { recoverParams.size() - tasks.size() };
+    auto worker = [this, &tasks, &nextTask, &failedCount]() {
+        for (size_t i = nextTask++; i < tasks.size(); i = nextTask++) {
+            AcquireRecoverSlot();
+            tasks[i]->DoTask();
+            ReleaseRecoverSlot();
+            if (tasks[i]->GetTaskState() != TaskState::SUCCESS) {
+                failedCount++;
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    size_t workerCount = std::min(tasks.size(), MAX_RECOVER_CONCURRENCY);
+    for (size_t i = 1; i < workerCount; i++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &item : workers) {
+        item.join();
+    }
+    return failedCount.load();
+}
+
+void ComponentManager::AcquireRecoverSlot()
+{
+    std::unique_lock<std::mutex> lock(recoverSlotMtx_);
+    recoverSlotCv_.wait(lock, [this]() { return runningRecoverTasks_ < MAX_RECOVER_CONCURRENCY; });
+    runningRecoverTasks_++;
+}
+
+void ComponentManager::ReleaseRecoverSlot()
+{
+    {
+        std::lock_guard<std::mutex> lock(recoverSlotMtx_);
+        runningRecoverTasks_--;
+    }
+    recoverSlotCv_.notify_one();
+}
+
+void ComponentManager::DumpRecoverInfos(std::vector<RecoverDump> &recoverInfos)
+{
+    std::lock_guard<std::mutex> lock(recoverInfosMtx_);
+    for (const auto &item : recoverInfos_) {
+        recoverInfos.push_back(item.second);
+    }
 }
 
 std::map<DHType, IDistributedHardwareSink*> ComponentManager::GetDHSinkInstance()
@@ -968,12 +1068,13 @@ void ComponentManager::UpdateBusinessState(const std::string &networkId, const s
 
 IDistributedHardwareSource* ComponentManager::GetDHSourceInstance(DHType dhType)
 {
-    std::unique_lock<std::shared_mutex> lock(compSourceMutex_);
-    if (compSource_.find(dhType) == compSource_.end()) {
+    std::shared_lock<std::shared_mutex> lock(compSourceMutex_);
+    auto iter = compSource_.find(dhType);
+    if (iter == compSource_.end()) {
         DHLOGE("can not find handler for dhType = %{public}d.", dhType);
         return nullptr;
     }
-    return compSource_[dhType];
+    return iter->second;
 }
 
 BusinessState ComponentManager::QueryBusinessState(const std::string &uuid, const std::string &dhId)
@@ -1002,6 +1103,30 @@ void ComponentManager::TriggerFullCapsSync(const std::string &networkId)
     dhCommToolPtr_->TriggerReqFullDHCaps(networkId);
 }
 
+void ComponentManager::TriggerPartialCapsSync(const std::string &networkId, DHType dhType, const std::string &dhId)
+{
+    if (!IsIdLengthValid(networkId)) {
+        return;
+    }
+    if (dhCommToolPtr_ == nullptr) {
+        DHLOGE("DH communication tool ptr is null");
+        return;
+    }
+    dhCommToolPtr_->TriggerReqPartialDHCaps(networkId, dhType, dhId);
+}
+
+void ComponentManager::PreOpenCapsSyncSession(const std::string &networkId)
+{
+    if (!IsIdLengthValid(networkId)) {
+        return;
+    }
+    if (dhCommToolPtr_ == nullptr) {
+        DHLOGE("DH communication tool ptr is null");
+        return;
+    }
+    dhCommToolPtr_->PreOpenSocket(networkId);
+}
+
 void ComponentManager::SaveNeedRefreshTask(const TaskParam &taskParam)
 {
     std::lock_guard<std::mutex> lock(needRefreshTaskParamsMtx_);
@@ -1884,7 +2009,7 @@ void ComponentManager::ResetSourceEnableStatus(DHType dhType)
     DHLOGI("ResetSourceEnableStatus end, dhType = %{public}#X.", dhType);
 }
 
-void ComponentManager::RecoverAutoEnableSink(DHType dhType)
+void ComponentManager::RecoverAutoEnableSink(DHType dhType, std::vector<TaskParam> &recoverParams)
 {
     DHLOGI("RecoverAutoEnableSink begin, dhType = %{public}#X.", dhType);
     DeviceInfo localDeviceInfo = GetLocalDeviceInfo();
@@ -1908,13 +2033,12 @@ void ComponentManager::RecoverAutoEnableSink(DHType dhType)
             .dhId = localInfo.first,
             .dhType = localInfo.second
         };
-        auto task = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, nullptr);
-        TaskExecutor::GetInstance().PushTask(task);
+        recoverParams.push_back(taskParam);
     }
     DHLOGI("RecoverAutoEnableSink end, dhType = %{public}#X.", dhType);
 }
 
-void ComponentManager::RecoverAutoEnableSource(DHType dhType)
+void ComponentManager::RecoverAutoEnableSource(DHType dhType, std::vector<TaskParam> &recoverParams)
 {
     DHLOGI("RecoverAutoEnableSource begin, dhType = %{public}#X.", dhType);
     MetaCapInfoMap metaInfoMap;
@@ -1939,13 +2063,12 @@ void ComponentManager::RecoverAutoEnableSource(DHType dhType)
             .dhId = metaInfo.second->GetDHId(),
             .dhType = metaInfo.second->GetDHType()
         };
-        auto task = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, nullptr);
-        TaskExecutor::GetInstance().PushTask(task);
+        recoverParams.push_back(taskParam);
     }
     DHLOGI("RecoverAutoEnableSource end, dhType = %{public}#X.", dhType);
 }
 
-void ComponentManager::RecoverActiveEnableSink(DHType dhType)
+void ComponentManager::RecoverActiveEnableSink(DHType dhType, std::vector<TaskParam> &recoverParams)
 {
     DHLOGI("RecoverActiveEnableSink begin, dhType = %{public}#X.", dhType);
     std::lock_guard<std::mutex> lock(dhSinkStatusMtx_);
@@ -1972,9 +2095,8 @@ void ComponentManager::RecoverActiveEnableSink(DHType dhType)
                     .callingUid = statusCtrlKey.uid,
                     .callingPid = statusCtrlKey.pid
                 };
-                auto task = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, nullptr);
-                TaskExecutor::GetInstance().PushTask(task);
-                DHLOGI("Create enable task for recover active-enable-sink, dhId = %{public}s, dhType = %{public}#X.",
+                recoverParams.push_back(taskParam);
+                DHLOGI("Collect recover active-enable-sink, dhId = %{public}s, dhType = %{public}#X.",
                     GetAnonyString(enableInfoKey).c_str(), dhType);
             }
         }
@@ -1982,7 +2104,7 @@ void ComponentManager::RecoverActiveEnableSink(DHType dhType)
     DHLOGI("RecoverActiveEnableSink end, dhType = %{public}#X.", dhType);
 }
 
-void ComponentManager::RecoverActiveEnableSource(DHType dhType)
+void ComponentManager::RecoverActiveEnableSource(DHType dhType, std::vector<TaskParam> &recoverParams)
 {
     DHLOGI("RecoverActiveEnableSource begin, dhType = %{public}#X.", dhType);
     std::lock_guard<std::mutex> lock(dhSourceStatusMtx_);
@@ -2010,9 +2132,8 @@ void ComponentManager::RecoverActiveEnableSource(DHType dhType)
                     .callingUid = statusCtrlKey.uid,
                     .callingPid = statusCtrlKey.pid
                 };
-                auto task = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, nullptr);
-                TaskExecutor::GetInstance().PushTask(task);
-                DHLOGI("Create enable task for recover active-enable-sink, "
+                recoverParams.push_back(taskParam);
+                DHLOGI("Collect recover active-enable-source, "
                     "networkId = %{public}s, dhId = %{public}s, dhType = %{public}#X.",
                     GetAnonyString(enableInfoKey.networkId).c_str(),
                     GetAnonyString(enableInfoKey.dhId).c_str(), dhType);
@@ -2344,31 +2465,40 @@ int32_t ComponentManager::EnableMetaSourceInternal(const std::string &networkId,
 }
 
 void ComponentManager::SyncRemoteDeviceInfoBySoftbus(const std::string &realNetworkId, EnableStep enableStep,
-    const sptr<IGetDhDescriptorsCallback> callback)
+    const sptr<IGetDhDescriptorsCallback> callback, DHType dhType, const std::string &dhId)
 {
     if (callback == nullptr) {
         DHLOGE("Param callback is null.");
         return;
     }
+    SyncDeviceInfoRequest request = { callback, dhType, dhId };
     std::lock_guard<std::mutex> lock(syncDeviceInfoMapMutex_);
     auto iter = syncDeviceInfoMap_.find(realNetworkId);
     if (iter != syncDeviceInfoMap_.end()) {
-        iter->second.second.push_back(callback);
+        iter->second.second.push_back(request);
         DHLOGI("Add callback for existing request, networkId: %{public}s, total callbacks: %{public}zu",
             GetAnonyString(realNetworkId).c_str(), iter->second.second.size());
         return;
     }
-    DHLOGI("Add new request, networkId: %{public}s", GetAnonyString(realNetworkId).c_str());
-    syncDeviceInfoMap_[realNetworkId] = {enableStep, {callback}};
+    DHLOGI("Add new request, networkId: %{public}s, dhType: %{public}#X", GetAnonyString(realNetworkId).c_str(),
+        dhType);
+    syncDeviceInfoMap_[realNetworkId] = {enableStep, {request}};
     if (GetEventHandler() == nullptr) {
         DHLOGE("Can not get eventHandler");
         callback->OnError(realNetworkId, ERR_DH_FWK_POINTER_IS_NULL);
         syncDeviceInfoMap_.erase(realNetworkId);
         return;
     }
-    std::shared_ptr<std::string> networkIdPtr = std::make_shared<std::string>(realNetworkId);
-    AppExecFwk::InnerEvent::Pointer msgEvent = AppExecFwk::InnerEvent::Get(EVENT_DATA_SYNC_MANUAL, networkIdPtr);
-    GetEventHandler()->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    if (dhType == DHType::UNKNOWN) {
+        std::shared_ptr<std::string> networkIdPtr = std::make_shared<std::string>(realNetworkId);
+        AppExecFwk::InnerEvent::Pointer msgEvent = AppExecFwk::InnerEvent::Get(EVENT_DATA_SYNC_MANUAL, networkIdPtr);
+        GetEventHandler()->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    } else {
+        auto partialSyncTask = [this, realNetworkId, dhType, dhId]() {
+            TriggerPartialCapsSync(realNetworkId, dhType, dhId);
+        };
+        GetEventHandler()->PostTask(partialSyncTask, "", 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    }
 
     auto syncTimeoutTask = [this, realNetworkId]() {
         HandleSyncDataTimeout(realNetworkId);
@@ -2378,21 +2508,45 @@ void ComponentManager::SyncRemoteDeviceInfoBySoftbus(const std::string &realNetw
     GetEventHandler()->PostTask(syncTimeoutTask, timeoutTaskId, SYNC_DATA_TIMEOUT_MS);
 }
 
-void ComponentManager::OnGetDescriptors(const std::string &realNetworkId, const std::vector<DHDescriptor> &descriptors)
+void ComponentManager::OnGetDescriptors(const std::string &realNetworkId, const std::vector<DHDescriptor> &descriptors,
+    bool isPartial)
 {
-    DHLOGI("OnGetDescriptors enter, networkId = %{public}s, descriptors.size = %{public}zu",
-        GetAnonyString(realNetworkId).c_str(), descriptors.size());
-    if (descriptors.size() == 0) {
+    DHLOGI("OnGetDescriptors enter, networkId = %{public}s, descriptors.size = %{public}zu, isPartial = %{public}d",
+        GetAnonyString(realNetworkId).c_str(), descriptors.size(), isPartial);
+    if (descriptors.size() == 0 && !isPartial) {
         DHLOGE("Get dh descriptor failed");
         return;
     }
     std::lock_guard<std::mutex> lock(syncDeviceInfoMapMutex_);
     auto iter = syncDeviceInfoMap_.find(realNetworkId);
     if (iter != syncDeviceInfoMap_.end()) {
-        for (auto& callback : iter->second.second) {
-            if (callback != nullptr) {
-                callback->OnSuccess(realNetworkId, descriptors, iter->second.first);
-                DHLOGI("Notify get dh descriptor success.");
+        std::vector<SyncDeviceInfoRequest> waitingRequests;
+        for (auto &request : iter->second.second) {
+            if (request.callback == nullptr) {
+                continue;
+            }
+            std::vector<DHDescriptor> reqDescriptors = FilterDescriptors(descriptors, request.dhType, request.dhId);
+            // A partial answer only holds the dh the first request asked for, the rest wait for the full sync.
+            if (isPartial && (request.dhType == DHType::UNKNOWN || reqDescriptors.empty())) {
+                waitingRequests.push_back(request);
+                continue;
+            }
+            request.callback->OnSuccess(realNetworkId, reqDescriptors, iter->second.first);
+            DHLOGI("Notify get dh descriptor success.");
+        }
+        if (!waitingRequests.empty()) {
+            DHLOGI("%{public}zu requests wait for the full sync, networkId= %{public}s", waitingRequests.size(),
+                GetAnonyString(realNetworkId).c_str());
+            iter->second.second.swap(waitingRequests);
+            if (GetEventHandler() != nullptr) {
+                std::shared_ptr<std::string> networkIdPtr = std::make_shared<std::string>(realNetworkId);
+                AppExecFwk::InnerEvent::Pointer msgEvent =
+                    AppExecFwk::InnerEvent::Get(EVENT_DATA_SYNC_MANUAL, networkIdPtr);
+                GetEventHandler()->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+                return;
+            }
+            for (auto &request : iter->second.second) {
+                request.callback->OnError(realNetworkId, ERR_DH_FWK_POINTER_IS_NULL);
             }
         }
         DHLOGI("Clear all request, networkId= %{public}s", GetAnonyString(realNetworkId).c_str());
@@ -2411,10 +2565,10 @@ void ComponentManager::HandleSyncDataTimeout(const std::string &realNetworkId)
     std::lock_guard<std::mutex> lock(syncDeviceInfoMapMutex_);
     auto iter = syncDeviceInfoMap_.find(realNetworkId);
     if (iter != syncDeviceInfoMap_.end()) {
-        for (auto& callback : iter->second.second) {
-            if (callback != nullptr) {
+        for (auto &request : iter->second.second) {
+            if (request.callback != nullptr) {
                 DHLOGI("Sync data timeout, notify callback: %{public}s", GetAnonyString(realNetworkId).c_str());
-                callback->OnError(realNetworkId, ERR_DH_FWK_GETDISTRIBUTEDHARDWARE_TIMEOUT);
+                request.callback->OnError(realNetworkId, ERR_DH_FWK_GETDISTRIBUTEDHARDWARE_TIMEOUT);
             }
         }
         syncDeviceInfoMap_.erase(iter);
@@ -2434,6 +2588,29 @@ bool ComponentManager::IsRequestSyncData(const std::string &networkId)
     return false;
 }
 
+bool ComponentManager::HasRemotePartialCapsOnly(const std::string &networkId)
+{
+    if (dhCommToolPtr_ == nullptr) {
+        return false;
+    }
+    return dhCommToolPtr_->HasRemotePartialCapsOnly(networkId);
+}
+
+std::vector<DHDescriptor> ComponentManager::FilterDescriptors(const std::vector<DHDescriptor> &descriptors,
+    DHType dhType, const std::string &dhId)
+{
+    if (dhType == DHType::UNKNOWN) {
+        return descriptors;
+    }
+    std::vector<DHDescriptor> filtered;
+    for (const auto &descriptor : descriptors) {
+        if (descriptor.dhType == dhType && (dhId.empty() || descriptor.id == dhId)) {
+            filtered.push_back(descriptor);
+        }
+    }
+    return filtered;
+}
+
 int32_t ComponentManager::AddAccessListener(const DHType dhType, int32_t &timeOut, const std::string &pkgName,
     const sptr<IAuthorizationResultCallback> &callback)
 {
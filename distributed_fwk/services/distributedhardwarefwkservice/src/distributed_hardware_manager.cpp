@@ -51,6 +51,7 @@ int32_t DistributedHardwareManager::LocalInit()
     DHLOGI("DHFWK Local Init begin");
     std::lock_guard<std::mutex> lock(localInitMgrMutex_);
     if (isLocalInit_.load()) {
+        LoadComponents();
         DHLOGI("Local init already finish");
         return DH_FWK_SUCCESS;
     }
@@ -58,9 +59,7 @@ int32_t DistributedHardwareManager::LocalInit()
     CapabilityInfoManager::GetInstance()->Init();
     MetaInfoManager::GetInstance()->Init();
     LocalCapabilityInfoManager::GetInstance()->Init();
-    ComponentLoader::GetInstance().Init();
-    VersionManager::GetInstance().Init();
-    LocalHardwareManager::GetInstance().Init();
+    LoadComponents();
     EventHandlerFactory::GetInstance().Init();
     DeviceParamMgr::GetInstance().QueryDeviceDataSyncMode();
     DHLOGI("DHFWK Local Init end");
@@ -79,17 +78,51 @@ int32_t DistributedHardwareManager::Initialize()
     LocalInit();
     ComponentManager::GetInstance().Init();
     DHLOGI("DHFWK Normal Init end");
-    isAllInit_.store(true);
+    {
+        std::lock_guard<std::mutex> stateLock(initStateMutex_);
+        isAllInit_.store(true);
+    }
+    initStateCv_.notify_all();
     return DH_FWK_SUCCESS;
 }
 
-int32_t DistributedHardwareManager::Release()
+void DistributedHardwareManager::LoadComponents()
 {
-    DHLOGI("start");
+    if (isComponentLoaded_.load()) {
+        return;
+    }
+    ComponentLoader::GetInstance().Init();
+    VersionManager::GetInstance().Init();
+    LocalHardwareManager::GetInstance().Init();
+    isComponentLoaded_.store(true);
+}
+
+void DistributedHardwareManager::UnloadComponents()
+{
+    if (!isComponentLoaded_.load()) {
+        return;
+    }
     LocalHardwareManager::GetInstance().UnInit();
     ComponentManager::GetInstance().UnInit();
     VersionManager::GetInstance().UnInit();
     ComponentLoader::GetInstance().UnInit();
+    isComponentLoaded_.store(false);
+}
+
+int32_t DistributedHardwareManager::ReleaseComponents()
+{
+    DHLOGI("start");
+    std::lock_guard<std::mutex> initLock(dhInitMgrMutex_);
+    std::lock_guard<std::mutex> localLock(localInitMgrMutex_);
+    UnloadComponents();
+    isAllInit_.store(false);
+    return DH_FWK_SUCCESS;
+}
+
+int32_t DistributedHardwareManager::Release()
+{
+    DHLOGI("start");
+    UnloadComponents();
     VersionInfoManager::GetInstance()->UnInit();
     CapabilityInfoManager::GetInstance()->UnInit();
     MetaInfoManager::GetInstance()->UnInit();
@@ -181,5 +214,12 @@ bool DistributedHardwareManager::GetDHardwareInitState()
     DHLOGI("DHMgr init state: %{public}d", isAllInit_.load());
     return isAllInit_.load();
 }
+
+bool DistributedHardwareManager::WaitForDHardwareInit(int32_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(initStateMutex_);
+    return initStateCv_.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+        [this]() { return isAllInit_.load(); });
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -44,6 +44,7 @@
 #include "hdf_operate.h"
 #include "local_capability_info_manager.h"
 #include "meta_info_manager.h"
+#include "parameters.h"
 #include "task_board.h"
 #include "task_executor.h"
 #include "task_factory.h"
@@ -55,6 +56,22 @@ namespace {
     constexpr int32_t NEW_HO_DEVICE_TYPE = 11;
     const std::string SA_STATUS_TASK_ID = "sa_status_task";
     constexpr int32_t DELAY_TIME_MS = 480000;
+    const std::string IDLE_UNINIT_PARAM = "persist.distributed_hardware.dhfwk.idle_uninit_ms";
+    constexpr int32_t DEFAULT_IDLE_UNINIT_MS = 30 * 1000;
+    constexpr int32_t MAX_IDLE_UNINIT_MS = 10 * 60 * 1000;
+    const std::string IDLE_COMPONENT_RELEASE_TASK = "idle_component_release_task";
+    const std::string IDLE_STORE_RELEASE_TASK = "idle_store_release_task";
+
+    int32_t GetIdleUnInitMs()
+    {
+        return OHOS::system::GetIntParameter(IDLE_UNINIT_PARAM, DEFAULT_IDLE_UNINIT_MS, 0, MAX_IDLE_UNINIT_MS);
+    }
+
+    bool IsAnyDeviceActive()
+    {
+        return DHContext::GetInstance().GetRealTimeOnlineDeviceCount() != 0 ||
+            DHContext::GetInstance().GetIsomerismConnectCount() != 0;
+    }
 }
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "DistributedHardwareManagerFactory"
@@ -120,6 +137,74 @@ void DistributedHardwareManagerFactory::UnInit()
     CheckExitSAOrNot();
 }
 
+void DistributedHardwareManagerFactory::ScheduleIdleUnInit()
+{
+    int32_t idleMs = GetIdleUnInitMs();
+    if (idleMs <= 0) {
+        UnInit();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(idleMutex_);
+        if (idleHandler_ == nullptr) {
+            std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create(true);
+            idleHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+        }
+        idleHandler_->RemoveTask(IDLE_COMPONENT_RELEASE_TASK);
+        idleHandler_->RemoveTask(IDLE_STORE_RELEASE_TASK);
+        auto releaseTask = [this]() { this->OnIdleComponentRelease(); };
+        if (idleHandler_->PostTask(releaseTask, IDLE_COMPONENT_RELEASE_TASK, idleMs)) {
+            // the framework stays usable during the idle window, so a device coming back is not refused
+            flagUnInit_.store(false);
+            DHLOGI("No device online, release the resource after %{public}d ms idle", idleMs);
+            return;
+        }
+    }
+    DHLOGE("Post idle release task failed, release the resource now");
+    UnInit();
+}
+
+void DistributedHardwareManagerFactory::CancelIdleUnInit()
+{
+    std::lock_guard<std::mutex> lock(idleMutex_);
+    if (idleHandler_ == nullptr) {
+        return;
+    }
+    idleHandler_->RemoveTask(IDLE_COMPONENT_RELEASE_TASK);
+    idleHandler_->RemoveTask(IDLE_STORE_RELEASE_TASK);
+}
+
+void DistributedHardwareManagerFactory::OnIdleComponentRelease()
+{
+    std::lock_guard<std::mutex> lock(idleMutex_);
+    if (IsAnyDeviceActive()) {
+        DHLOGI("Device online again, keep the resource");
+        return;
+    }
+    DHLOGI("Idle timeout, release the component handlers");
+    DistributedHardwareManager::GetInstance().ReleaseComponents();
+    isInit_.store(false);
+    auto releaseTask = [this]() { this->OnIdleStoreRelease(); };
+    if (idleHandler_ != nullptr && idleHandler_->PostTask(releaseTask, IDLE_STORE_RELEASE_TASK, GetIdleUnInitMs())) {
+        return;
+    }
+    DHLOGE("Post idle store release task failed, release the resource now");
+    flagUnInit_.store(true);
+    UnInit();
+}
+
+void DistributedHardwareManagerFactory::OnIdleStoreRelease()
+{
+    std::lock_guard<std::mutex> lock(idleMutex_);
+    if (IsAnyDeviceActive()) {
+        DHLOGI("Device online again, keep the resource");
+        return;
+    }
+    DHLOGI("Idle timeout, release all the resource");
+    flagUnInit_.store(true);
+    UnInit();
+}
+
 void DistributedHardwareManagerFactory::ExitDHFWK()
 {
     DHLOGI("No device online or deviceList is over size, exit sa process");
@@ -182,6 +267,7 @@ int32_t DistributedHardwareManagerFactory::SendOnLineEvent(const std::string &ne
         DHLOGE("SendOnLineEvent setname failed.");
     }
 
+    CancelIdleUnInit();
     if (flagUnInit_.load()) {
         DHLOGE("is in uniniting, can not process online event.");
         return ERR_DH_FWK_HARDWARE_MANAGER_INIT_FAILED;
@@ -297,12 +383,25 @@ bool DistributedHardwareManagerFactory::GetDHardwareInitState()
     return DistributedHardwareManager::GetInstance().GetDHardwareInitState();
 }
 
+bool DistributedHardwareManagerFactory::WaitForDHardwareInit(int32_t timeoutMs)
+{
+    return DistributedHardwareManager::GetInstance().WaitForDHardwareInit(timeoutMs);
+}
+
 void DistributedHardwareManagerFactory::ActiveSyncDataByNetworkId(const std::string &networkId)
 {
     DHLOGI("active sync data, networkId: %{public}s", GetAnonyString(networkId).c_str());
     MetaInfoManager::GetInstance()->SyncDataByNetworkId(networkId);
 }
 
+void DistributedHardwareManagerFactory::PreOpenCapsSyncSession(const std::string &networkId)
+{
+    if (!IsInit()) {
+        return;
+    }
+    ComponentManager::GetInstance().PreOpenCapsSyncSession(networkId);
+}
+
 int32_t DistributedHardwareManagerFactory::CreateSaStatusHandler()
 {
     DHLOGI("call!");
@@ -45,6 +45,7 @@
 #include "distributed_hardware_manager_factory.h"
 #include "hdf_operate.h"
 #include "local_capability_info_manager.h"
+#include "local_hardware_manager.h"
 #include "meta_info_manager.h"
 #include "publisher.h"
 #include "task_executor.h"
@@ -64,8 +65,7 @@ namespace {
     const std::string LOCAL_NETWORKID_ALIAS = "local";
     constexpr int32_t DMSDP_ADAPTER_SA_ID = 4812;
     constexpr int32_t DHMS_SERVICE_SA_ID = 4801;
-    constexpr uint32_t RETRY_CHECK_DHFWK_INIT_MAX_TIMES = 25;
-    constexpr int32_t WAIT_INIT_TIME_MS = 200;
+    constexpr int32_t PENDING_REQUEST_TIMEOUT_MS = 5000;
 }
 
 DistributedHardwareService::DistributedHardwareService(int32_t saId, bool runOnCreate)
@@ -216,6 +216,23 @@ int32_t DistributedHardwareService::PublishMessage(const DHTopic topic, const st
 }
 
 std::string DistributedHardwareService::QueryLocalSysSpec(const QueryLocalSysSpecType spec)
+{
+    // Read the version first, a change while the spec is rebuilt leaves the entry stale for the next query.
+    uint64_t capabilityVersion = LocalHardwareManager::GetInstance().GetLocalCapabilityVersion();
+    {
+        std::lock_guard<std::mutex> lock(localSysSpecMutex_);
+        auto iter = localSysSpecCache_.find(spec);
+        if (iter != localSysSpecCache_.end() && iter->second.capabilityVersion == capabilityVersion) {
+            return iter->second.spec;
+        }
+    }
+    std::string sysSpec = QueryLocalSysSpecFromCapability(spec);
+    std::lock_guard<std::mutex> lock(localSysSpecMutex_);
+    localSysSpecCache_[spec] = { capabilityVersion, sysSpec };
+    return sysSpec;
+}
+
+std::string DistributedHardwareService::QueryLocalSysSpecFromCapability(const QueryLocalSysSpecType spec)
 {
     DeviceInfo localDevInfo = DHContext::GetInstance().GetDeviceInfo();
     std::vector<std::shared_ptr<CapabilityInfo>> resInfos;
@@ -412,13 +429,18 @@ int32_t DistributedHardwareService::StopDistributedHardware(DHType dhType, const
 }
 
 int32_t DistributedHardwareService::GetDeviceDhInfo(const std::string &realNetworkId, const std::string &udidHash,
-    const std::string &deviceId, EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback)
+    const std::string &deviceId, EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback,
+    DHType dhType, const std::string &dhId)
 {
     if (!IsIdLengthValid(realNetworkId) || !IsIdLengthValid(udidHash) || !IsIdLengthValid(deviceId)) {
         DHLOGE("Param is Invalid");
         return ERR_DH_FWK_PARA_INVALID;
     }
     DHLOGI("Get device hardware info start.");
+    if (dhType == DHType::UNKNOWN && ComponentManager::GetInstance().HasRemotePartialCapsOnly(realNetworkId)) {
+        DHLOGI("Saved caps are partial, networkId: %{public}s.", GetAnonyString(realNetworkId).c_str());
+        return ERR_DH_FWK_HARDWARE_MANAGER_GET_DHINFO_FAIL;
+    }
     std::vector<DHDescriptor> descriptors;
     std::vector<std::shared_ptr<MetaCapabilityInfo>> metaCapInfos;
     MetaInfoManager::GetInstance()->GetMetaCapInfosByUdidHash(udidHash, metaCapInfos);
@@ -429,6 +451,9 @@ int32_t DistributedHardwareService::GetDeviceDhInfo(const std::string &realNetwo
             descriptor.dhType = metaCapInfo->GetDHType();
             descriptors.push_back(descriptor);
         }
+        descriptors = ComponentManager::FilterDescriptors(descriptors, dhType, dhId);
+    }
+    if (!descriptors.empty()) {
         DHLOGI("Get MetacapInfo Success, networkId: %{public}s.", GetAnonyString(realNetworkId).c_str());
         callback->OnSuccess(realNetworkId, descriptors, enableStep);
         return DH_FWK_SUCCESS;
@@ -443,6 +468,9 @@ int32_t DistributedHardwareService::GetDeviceDhInfo(const std::string &realNetwo
             descriptor.dhType = capsInfo->GetDHType();
             descriptors.push_back(descriptor);
         }
+        descriptors = ComponentManager::FilterDescriptors(descriptors, dhType, dhId);
+    }
+    if (!descriptors.empty()) {
         DHLOGI("Get CapabilitieInfo Success, deviceId: %{public}s.", GetAnonyString(deviceId).c_str());
         callback->OnSuccess(realNetworkId, descriptors, enableStep);
         return DH_FWK_SUCCESS;
@@ -451,7 +479,7 @@ int32_t DistributedHardwareService::GetDeviceDhInfo(const std::string &realNetwo
 }
 
 void DistributedHardwareService::StartGetDeviceDhInfo(const std::string &networkId, EnableStep enableStep,
-    const sptr<IGetDhDescriptorsCallback> callback)
+    const sptr<IGetDhDescriptorsCallback> callback, DHType dhType, const std::string &dhId)
 {
     DHLOGI("StartGetDeviceDhInfo start");
     std::string deviceId;
@@ -469,10 +497,11 @@ void DistributedHardwareService::StartGetDeviceDhInfo(const std::string &network
         udid = DHContext::GetInstance().GetUDIDByNetworkId(networkId);
         udidHash = Sha256(udid);
     }
-    auto ret = GetDeviceDhInfo(realNetworkId, udidHash, deviceId, enableStep, callback);
+    auto ret = GetDeviceDhInfo(realNetworkId, udidHash, deviceId, enableStep, callback, dhType, dhId);
     if (ret != DH_FWK_SUCCESS) {
         DHLOGI("Need active sync deviceInfo by softbus.");
-        ComponentManager::GetInstance().SyncRemoteDeviceInfoBySoftbus(realNetworkId, enableStep, callback);
+        ComponentManager::GetInstance().SyncRemoteDeviceInfoBySoftbus(realNetworkId, enableStep, callback, dhType,
+            dhId);
     }
     DHLOGI("StartGetDeviceDhInfo end");
 }
@@ -484,6 +513,27 @@ int32_t DistributedHardwareService::GetDistributedHardware(const std::string &ne
         DHLOGE("networkId size is invalid or callback ptr is null");
         return ERR_DH_FWK_PARA_INVALID;
     }
+    return GetDistributedHardwareInternal({ networkId, enableStep, callback });
+}
+
+int32_t DistributedHardwareService::GetDistributedHardwareByType(const std::string &networkId, DHType dhType,
+    const std::string &dhId, EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback)
+{
+    if (!IsIdLengthValid(networkId) || (!dhId.empty() && !IsIdLengthValid(dhId)) || callback == nullptr) {
+        DHLOGE("networkId or dhId size is invalid or callback ptr is null");
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    if (DHTypeStrMap.find(dhType) == DHTypeStrMap.end()) {
+        DHLOGE("dhType: %{public}#X is invalid", dhType);
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    return GetDistributedHardwareInternal({ networkId, enableStep, callback, dhType, dhId });
+}
+
+int32_t DistributedHardwareService::GetDistributedHardwareInternal(const PendingGetDHRequest &request)
+{
+    const std::string &networkId = request.networkId;
+    EnableStep enableStep = request.enableStep;
     if (enableStep == EnableStep::ENABLE_SOURCE) {
         bool isOnline = DHContext::GetInstance().IsRealTimeOnlineDevice(networkId);
         if (!isOnline) {
@@ -493,7 +543,6 @@ int32_t DistributedHardwareService::GetDistributedHardware(const std::string &ne
         bool isInit = DistributedHardwareManagerFactory::GetInstance().GetDHardwareInitState();
         if (!isInit) {
             std::lock_guard<std::mutex> lock(pendingRequestsMutex_);
-            PendingGetDHRequest request = { networkId, enableStep, callback };
             if (pendingGetDHRequests_.empty()) {
                 DHLOGI("dhfwk not initialized, request queued for networkId: %{public}s",
                     GetAnonyString(networkId).c_str());
@@ -511,7 +560,6 @@ int32_t DistributedHardwareService::GetDistributedHardware(const std::string &ne
         bool isInit = DistributedHardwareManagerFactory::GetInstance().GetDHardwareInitState();
         if (!isInit) {
             std::lock_guard<std::mutex> lock(pendingRequestsMutex_);
-            PendingGetDHRequest request = { networkId, enableStep, callback };
             if (pendingGetDHRequests_.empty()) {
                 DHLOGI("dhfwk not initialized, request queued for networkId: %{public}s",
                     GetAnonyString(networkId).c_str());
@@ -524,55 +572,88 @@ int32_t DistributedHardwareService::GetDistributedHardware(const std::string &ne
             return DH_FWK_SUCCESS;
         }
     }
-    StartGetDeviceDhInfo(networkId, enableStep, callback);
+    StartGetDeviceDhInfo(networkId, enableStep, request.callback, request.dhType, request.dhId);
     return DH_FWK_SUCCESS;
 }
 
+int32_t DistributedHardwareService::GetDistributedHardwareBatch(const std::vector<std::string> &networkIds,
+    EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback)
+{
+    if (networkIds.empty() || networkIds.size() > MAX_NETWORK_ID_ARRAY_SIZE || callback == nullptr) {
+        DHLOGE("networkIds size is invalid or callback ptr is null");
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    for (const auto &networkId : networkIds) {
+        if (!IsIdLengthValid(networkId)) {
+            return ERR_DH_FWK_PARA_INVALID;
+        }
+    }
+    // Every device is still answered through the callback one by one; keep going past a failed id so that
+    // one offline device does not hide the others, and report the first failure to the caller.
+    int32_t result = DH_FWK_SUCCESS;
+    for (const auto &networkId : networkIds) {
+        int32_t ret = GetDistributedHardware(networkId, enableStep, callback);
+        if (ret != DH_FWK_SUCCESS && result == DH_FWK_SUCCESS) {
+            result = ret;
+        }
+    }
+    return result;
+}
+
 void DistributedHardwareService::StartCleanupTimer()
 {
     DHLOGI("StartCleanupTimer start");
-    cleanupRunning_.store(true);
+    pendingDeadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(PENDING_REQUEST_TIMEOUT_MS);
+    if (cleanupRunning_.exchange(true)) {
+        return;
+    }
     cleanupThread_ = std::thread([this]() {
+        // Sleep until dhfwk init completes or the pending requests expire, whichever comes first.
         while (cleanupRunning_.load()) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_INIT_TIME_MS));
-            if (!cleanupRunning_.load()) {
-                break;
-            }
+            DistributedHardwareManagerFactory::GetInstance().WaitForDHardwareInit(GetPendingRequestWaitTime());
             CleanupExpiredRequests();
         }
     });
     cleanupThread_.detach();
 }
 
-void DistributedHardwareService::CleanupExpiredRequests()
+int32_t DistributedHardwareService::GetPendingRequestWaitTime()
 {
     std::lock_guard<std::mutex> lock(pendingRequestsMutex_);
-    if (pendingGetDHRequests_.empty()) {
-        // 没有待处理请求，停止清理线程
+    auto remain = std::chrono::duration_cast<std::chrono::milliseconds>(
+        pendingDeadline_ - std::chrono::steady_clock::now()).count();
+    return remain > 0 ? static_cast<int32_t>(remain) : 0;
+}
+
+void DistributedHardwareService::CleanupExpiredRequests()
+{
+    std::vector<PendingGetDHRequest> requests;
+    bool isInit = DistributedHardwareManagerFactory::GetInstance().GetDHardwareInitState();
+    {
+        std::lock_guard<std::mutex> lock(pendingRequestsMutex_);
+        if (!pendingGetDHRequests_.empty() && !isInit && std::chrono::steady_clock::now() < pendingDeadline_) {
+            return;
+        }
+        requests.swap(pendingGetDHRequests_);
         cleanupRunning_.store(false);
+    }
+    if (requests.empty()) {
         return;
     }
-    bool isInit = DistributedHardwareManagerFactory::GetInstance().GetDHardwareInitState();
     if (isInit) {
-        // 同步数据
-        DHLOGI("dhfwk init finished");
-        for (auto iter = pendingGetDHRequests_.begin(); iter != pendingGetDHRequests_.end(); ++iter) {
-            StartGetDeviceDhInfo(iter->networkId, iter->enableStep, iter->callback);
+        DHLOGI("dhfwk init finished, handle %{public}zu pending requests", requests.size());
+        for (const auto &request : requests) {
+            StartGetDeviceDhInfo(request.networkId, request.enableStep, request.callback, request.dhType,
+                request.dhId);
         }
-        cleanupRunning_.store(false);
         return;
     }
-    if (dhfwkInitTimes_ > RETRY_CHECK_DHFWK_INIT_MAX_TIMES) {
-        DHLOGI("dhfwk init timeout");
-        for (auto iter = pendingGetDHRequests_.begin(); iter != pendingGetDHRequests_.end(); ++iter) {
-            if (iter->callback != nullptr) {
-                iter->callback->OnError(iter->networkId, ERR_DH_FWK_GETDISTRIBUTEDHARDWARE_TIMEOUT);
-            }
+    DHLOGI("dhfwk init timeout");
+    for (const auto &request : requests) {
+        if (request.callback != nullptr) {
+            request.callback->OnError(request.networkId, ERR_DH_FWK_GETDISTRIBUTEDHARDWARE_TIMEOUT);
         }
-        cleanupRunning_.store(false);
-        return;
     }
-    dhfwkInitTimes_++;
 }
 
 int32_t DistributedHardwareService::RegisterDHStatusListener(sptr<IHDSinkStatusListener> listener)
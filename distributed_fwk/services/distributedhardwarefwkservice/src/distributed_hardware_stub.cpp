@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -181,7 +181,15 @@ int32_t DistributedHardwareStub::QueryLocalSysSpecInner(MessageParcel &data, Mes
     DHLOGI("Query Local Sys Spec: %{public}" PRIu32, (uint32_t)spec);
     std::string res = QueryLocalSysSpec(spec);
     DHLOGI("Get Local spec: %{public}s", res.c_str());
-    reply.WriteString(res);
+    if (res.empty() || res.size() > MAX_SYS_SPEC_SIZE) {
+        DHLOGE("Local spec size is invalid, size: %{public}zu", res.size());
+        reply.WriteUint32(0);
+        return DH_FWK_SUCCESS;
+    }
+    if (!reply.WriteUint32(static_cast<uint32_t>(res.size())) || !reply.WriteRawData(res.data(), res.size())) {
+        DHLOGE("Write local spec failed");
+        return ERR_DH_FWK_SERVICE_WRITE_INFO_FAIL;
+    }
     return DH_FWK_SUCCESS;
 }
 
@@ -396,6 +404,56 @@ int32_t DistributedHardwareStub::GetDistributedHardwareInner(MessageParcel &data
     return DH_FWK_SUCCESS;
 }
 
+int32_t DistributedHardwareStub::GetDistributedHardwareBatchInner(MessageParcel &data, MessageParcel &reply)
+{
+    if (!HasAccessDHPermission()) {
+        DHLOGE("The caller has no ACCESS_DISTRIBUTED_HARDWARE permission.");
+        return ERR_DH_FWK_ACCESS_PERMISSION_CHECK_FAIL;
+    }
+    std::vector<std::string> networkIds;
+    if (!data.ReadStringVector(&networkIds) || networkIds.size() > MAX_NETWORK_ID_ARRAY_SIZE) {
+        DHLOGE("Read networkIds failed or too large, size: %{public}zu!", networkIds.size());
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    EnableStep enableStep = static_cast<EnableStep>(data.ReadUint32());
+    sptr<IGetDhDescriptorsCallback> callback =
+        iface_cast<IGetDhDescriptorsCallback>(data.ReadRemoteObject());
+    if (callback == nullptr) {
+        DHLOGE("Input get distributed hardware callback is null!");
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    int32_t ret = GetDistributedHardwareBatch(networkIds, enableStep, callback);
+    if (!reply.WriteInt32(ret)) {
+        DHLOGE("Write ret code failed!");
+        return ERR_DH_FWK_SERVICE_WRITE_INFO_FAIL;
+    }
+    return DH_FWK_SUCCESS;
+}
+
+int32_t DistributedHardwareStub::GetDistributedHardwareByTypeInner(MessageParcel &data, MessageParcel &reply)
+{
+    if (!HasAccessDHPermission()) {
+        DHLOGE("The caller has no ACCESS_DISTRIBUTED_HARDWARE permission.");
+        return ERR_DH_FWK_ACCESS_PERMISSION_CHECK_FAIL;
+    }
+    std::string networkId = data.ReadString();
+    DHType dhType = static_cast<DHType>(data.ReadUint32());
+    std::string dhId = data.ReadString();
+    EnableStep enableStep = static_cast<EnableStep>(data.ReadUint32());
+    sptr<IGetDhDescriptorsCallback> callback =
+        iface_cast<IGetDhDescriptorsCallback>(data.ReadRemoteObject());
+    if (callback == nullptr) {
+        DHLOGE("Input get distributed hardware callback is null!");
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    int32_t ret = GetDistributedHardwareByType(networkId, dhType, dhId, enableStep, callback);
+    if (!reply.WriteInt32(ret)) {
+        DHLOGE("Write ret code failed!");
+        return ERR_DH_FWK_SERVICE_WRITE_INFO_FAIL;
+    }
+    return DH_FWK_SUCCESS;
+}
+
 int32_t DistributedHardwareStub::RegisterDHStatusSinkListenerInner(MessageParcel &data, MessageParcel &reply)
 {
     if (!HasAccessDHPermission()) {
@@ -743,6 +801,12 @@ int32_t DistributedHardwareStub::OnRemoteRequestEx(uint32_t code, MessageParcel
         case static_cast<uint32_t>(DHMsgInterfaceCode::GET_DISTRIBUTED_HARDWARE): {
             return GetDistributedHardwareInner(data, reply);
         }
+        case static_cast<uint32_t>(DHMsgInterfaceCode::GET_DISTRIBUTED_HARDWARE_BATCH): {
+            return GetDistributedHardwareBatchInner(data, reply);
+        }
+        case static_cast<uint32_t>(DHMsgInterfaceCode::GET_DISTRIBUTED_HARDWARE_BY_TYPE): {
+            return GetDistributedHardwareByTypeInner(data, reply);
+        }
         case static_cast<uint32_t>(DHMsgInterfaceCode::REG_DH_SINK_STATUS_LISTNER): {
             return RegisterDHStatusSinkListenerInner(data, reply);
         }
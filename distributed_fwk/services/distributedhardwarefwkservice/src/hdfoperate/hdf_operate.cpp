@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,11 +15,14 @@
 
 #include "hdf_operate.h"
 
+#include <algorithm>
 #include <dlfcn.h>
 
 #include "component_loader.h"
+#include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
 #include "distributed_hardware_log.h"
+#include "parameters.h"
 #include "task_board.h"
 #include "task_executor.h"
 #include "task_factory.h"
@@ -30,6 +33,23 @@
 namespace OHOS {
 namespace DistributedHardware {
 using GetSourceHardwareClass = IDistributedHardwareSource *(*)();
+namespace {
+    const std::string HDF_UNLOAD_GRACE_PARAM = "persist.distributed_hardware.dhfwk.hdf_unload_grace_ms";
+    constexpr int32_t DEFAULT_HDF_UNLOAD_GRACE_MS = 10 * 1000;
+    constexpr int32_t MAX_HDF_UNLOAD_GRACE_MS = 5 * 60 * 1000;
+    const std::string HDF_UNLOAD_TASK_PREFIX = "UnLoadHdf_";
+
+    int32_t GetUnLoadGraceMs()
+    {
+        return OHOS::system::GetIntParameter(HDF_UNLOAD_GRACE_PARAM, DEFAULT_HDF_UNLOAD_GRACE_MS, 0,
+            MAX_HDF_UNLOAD_GRACE_MS);
+    }
+
+    std::string GetUnLoadTaskName(DHType dhType)
+    {
+        return HDF_UNLOAD_TASK_PREFIX + std::to_string(static_cast<uint32_t>(dhType));
+    }
+}
 
 int32_t HdfOperator::LoadDistributedHDF()
 {
@@ -86,6 +106,12 @@ bool HdfOperator::IsNeedErase()
     return hdfLoadRef_ <= 0;
 }
 
+int32_t HdfOperator::GetRefCount()
+{
+    std::unique_lock<std::mutex> loadRefLocker(hdfLoadRefMutex_);
+    return hdfLoadRef_;
+}
+
 FWK_IMPLEMENT_SINGLE_INSTANCE(HdfOperateManager);
 
 int32_t HdfOperateManager::LoadDistributedHDF(DHType dhType)
@@ -114,9 +140,21 @@ int32_t HdfOperateManager::LoadDistributedHDF(DHType dhType)
         DHLOGE("Get hdf operator is nullptr, dhType = %{public}#X.", dhType);
         return ERR_DH_FWK_POINTER_IS_NULL;
     }
+    if (CancelDeferredUnLoad(dhType)) {
+        if (hdfOperate->GetRefCount() > 0) {
+            DHLOGI("Take over the hdf waiting for unload, dhType = %{public}#X!", dhType);
+            RecordLoad(dhType, true, 0);
+            return DH_FWK_SUCCESS;
+        }
+        // The hdf host died during the grace period, the reference kept for it is gone as well.
+        hdfInuseRefCount_--;
+    }
+    bool isReuse = hdfOperate->GetRefCount() > 0;
+    int64_t startTime = GetCurrentTime();
     auto ret = hdfOperate->LoadDistributedHDF();
     if (ret == DH_FWK_SUCCESS) {
         hdfInuseRefCount_++;
+        RecordLoad(dhType, isReuse, GetCurrentTime() - startTime);
     }
     return ret;
 }
@@ -135,8 +173,32 @@ int32_t HdfOperateManager::UnLoadDistributedHDF(DHType dhType)
         DHLOGE("Get hdf operator is nullptr, dhType = %{public}#X.", dhType);
         return ERR_DH_FWK_POINTER_IS_NULL;
     }
+    if (pendingUnLoads_.count(dhType) != 0) {
+        DHLOGI("The hdf unload is already pending, dhType = %{public}#X!", dhType);
+        return DH_FWK_SUCCESS;
+    }
+    if (hdfOperate->GetRefCount() == 1 && DeferUnLoad(dhType)) {
+        return DH_FWK_SUCCESS;
+    }
+    return UnLoadHdfOperator(dhType, itHdfOperate);
+}
+
+int32_t HdfOperateManager::UnLoadHdfOperator(DHType dhType,
+    std::map<DHType, std::shared_ptr<HdfOperator>>::iterator itHdfOperate)
+{
+    auto hdfOperate = itHdfOperate->second;
+    if (hdfOperate == nullptr) {
+        DHLOGE("Get hdf operator is nullptr, dhType = %{public}#X.", dhType);
+        return ERR_DH_FWK_POINTER_IS_NULL;
+    }
+    bool isLastRef = hdfOperate->GetRefCount() == 1;
     auto ret = hdfOperate->UnLoadDistributedHDF();
     if (ret == DH_FWK_SUCCESS) {
+        if (isLastRef) {
+            HdfLoadDump &dump = hdfLoadDumps_[dhType];
+            dump.dhType = dhType;
+            dump.unloadCount++;
+        }
         if (hdfOperate->IsNeedErase()) {
             hdfOperateMap_.erase(itHdfOperate);
         }
@@ -303,6 +365,111 @@ bool HdfOperateManager::IsAnyHdfInuse()
     return hdfInuseRefCount_ > 0;
 }
 
+int32_t HdfOperateManager::PreloadDistributedHDF(DHType dhType)
+{
+    if (dhType != DHType::AUDIO && dhType != DHType::CAMERA) {
+        return ERR_DH_FWK_NO_HDF_SUPPORT;
+    }
+    if (GetUnLoadGraceMs() <= 0) {
+        DHLOGI("Hdf unload grace period is disabled, skip preload, dhType = %{public}#X!", dhType);
+        return DH_FWK_SUCCESS;
+    }
+    {
+        std::unique_lock<std::mutex> hdfOperateMapLocker(hdfOperateMapMutex_);
+        auto itHdfOperate = hdfOperateMap_.find(dhType);
+        if (itHdfOperate != hdfOperateMap_.end() && itHdfOperate->second != nullptr &&
+            itHdfOperate->second->GetRefCount() > 0) {
+            DHLOGI("The hdf is already loaded, skip preload, dhType = %{public}#X!", dhType);
+            return DH_FWK_SUCCESS;
+        }
+    }
+    DHLOGI("Preload hdf, dhType = %{public}#X!", dhType);
+    auto ret = LoadDistributedHDF(dhType);
+    if (ret != DH_FWK_SUCCESS) {
+        DHLOGE("Preload hdf failed, dhType = %{public}#X, ret = %{public}d.", dhType, ret);
+        return ret;
+    }
+    {
+        std::unique_lock<std::mutex> hdfOperateMapLocker(hdfOperateMapMutex_);
+        hdfLoadDumps_[dhType].preloadCount++;
+    }
+    return UnLoadDistributedHDF(dhType);
+}
+
+void HdfOperateManager::DumpHdfLoadInfos(std::vector<HdfLoadDump> &hdfLoadInfos)
+{
+    std::unique_lock<std::mutex> hdfOperateMapLocker(hdfOperateMapMutex_);
+    for (const auto &item : hdfLoadDumps_) {
+        HdfLoadDump dump = item.second;
+        auto itHdfOperate = hdfOperateMap_.find(item.first);
+        if (itHdfOperate != hdfOperateMap_.end() && itHdfOperate->second != nullptr) {
+            dump.refCount = itHdfOperate->second->GetRefCount();
+        }
+        dump.unloadPending = pendingUnLoads_.count(item.first) != 0;
+        hdfLoadInfos.push_back(dump);
+    }
+}
+
+bool HdfOperateManager::DeferUnLoad(DHType dhType)
+{
+    int32_t graceMs = GetUnLoadGraceMs();
+    if (graceMs <= 0) {
+        return false;
+    }
+    if (eventHandler_ == nullptr) {
+        std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create(true);
+        eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
+    auto unloadTask = [dhType]() { HdfOperateManager::GetInstance().OnUnLoadGraceExpired(dhType); };
+    if (!eventHandler_->PostTask(unloadTask, GetUnLoadTaskName(dhType), graceMs)) {
+        DHLOGE("Post deferred unload task failed, unload now, dhType = %{public}#X.", dhType);
+        return false;
+    }
+    pendingUnLoads_.insert(dhType);
+    DHLOGI("Defer hdf unload for %{public}d ms, dhType = %{public}#X!", graceMs, dhType);
+    return true;
+}
+
+bool HdfOperateManager::CancelDeferredUnLoad(DHType dhType)
+{
+    if (pendingUnLoads_.erase(dhType) == 0) {
+        return false;
+    }
+    if (eventHandler_ != nullptr) {
+        eventHandler_->RemoveTask(GetUnLoadTaskName(dhType));
+    }
+    return true;
+}
+
+void HdfOperateManager::OnUnLoadGraceExpired(DHType dhType)
+{
+    std::unique_lock<std::mutex> hdfOperateMapLocker(hdfOperateMapMutex_);
+    if (pendingUnLoads_.erase(dhType) == 0) {
+        DHLOGI("The deferred hdf unload has been cancelled, dhType = %{public}#X!", dhType);
+        return;
+    }
+    auto itHdfOperate = hdfOperateMap_.find(dhType);
+    if (itHdfOperate == hdfOperateMap_.end()) {
+        DHLOGI("The hdf operate has been removed, dhType = %{public}#X!", dhType);
+        return;
+    }
+    DHLOGI("Hdf unload grace period expired, dhType = %{public}#X!", dhType);
+    UnLoadHdfOperator(dhType, itHdfOperate);
+}
+
+void HdfOperateManager::RecordLoad(DHType dhType, bool isReuse, int64_t costMs)
+{
+    HdfLoadDump &dump = hdfLoadDumps_[dhType];
+    dump.dhType = dhType;
+    if (isReuse) {
+        dump.reuseCount++;
+        return;
+    }
+    dump.loadCount++;
+    dump.lastLoadCostMs = costMs;
+    dump.maxLoadCostMs = std::max(dump.maxLoadCostMs, costMs);
+}
+
 void HdfLoadRefRecipient::OnRemoteDied(const wptr<IRemoteObject> &remote)
 {
     DHLOGI("On remote died, dhType = %{public}#X!", dhType_);
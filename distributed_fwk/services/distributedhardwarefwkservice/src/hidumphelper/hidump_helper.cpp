@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,14 +17,19 @@
 
 #include <unordered_map>
 
+#include "access_manager.h"
 #include "anonymous_string.h"
+#include "av_trans_control_center.h"
 #include "capability_info_manager.h"
 #include "component_loader.h"
 #include "component_manager.h"
 #include "distributed_hardware_errno.h"
 #include "distributed_hardware_log.h"
 #include "enabled_comps_dump.h"
+#include "hdf_operate.h"
+#include "low_latency.h"
 #include "task_board.h"
+#include "task_executor.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -35,6 +40,13 @@ const std::string LOADED_COMP_LIST = "-l";
 const std::string ENABLED_COMP_LIST = "-e";
 const std::string TASK_LIST = "-t";
 const std::string CAPABILITY_LIST = "-c";
+const std::string RECOVER_INFO = "-r";
+const std::string HDF_LOAD_INFO = "-d";
+const std::string FIRST_FRAME_INFO = "-f";
+const std::string LOW_LATENCY_INFO = "-n";
+const std::string PERF_INFO = "-p";
+const std::string DEVICE_FLAP_INFO = "-o";
+constexpr uint64_t PERCENT = 100;
 
 const std::unordered_map<std::string, HidumpFlag> MAP_ARGS = {
     { ARGS_HELP, HidumpFlag::GET_HELP },
@@ -42,16 +54,28 @@ const std::unordered_map<std::string, HidumpFlag> MAP_ARGS = {
     { ENABLED_COMP_LIST, HidumpFlag::GET_ENABLED_COMP_LIST },
     { TASK_LIST, HidumpFlag::GET_TASK_LIST },
     { CAPABILITY_LIST, HidumpFlag::GET_CAPABILITY_LIST },
+    { RECOVER_INFO, HidumpFlag::GET_RECOVER_INFO },
+    { HDF_LOAD_INFO, HidumpFlag::GET_HDF_LOAD_INFO },
+    { FIRST_FRAME_INFO, HidumpFlag::GET_FIRST_FRAME_INFO },
+    { LOW_LATENCY_INFO, HidumpFlag::GET_LOW_LATENCY_INFO },
+    { PERF_INFO, HidumpFlag::GET_PERF_INFO },
+    { DEVICE_FLAP_INFO, HidumpFlag::GET_DEVICE_FLAP_INFO },
 };
 
-std::unordered_map<TaskType, std::string> g_mapTaskType = {
-    { TaskType::UNKNOWN, "UNKNOWN" },
-    { TaskType::ENABLE, "ENABLE" },
-    { TaskType::DISABLE, "DISABLE" },
-    { TaskType::ON_LINE, "ON_LINE" },
-    { TaskType::OFF_LINE, "OFF_LINE" },
-    { TaskType::META_ENABLE, "META_ENABLE" },
-    { TaskType::META_DISABLE, "META_DISABLE" },
+const std::vector<std::pair<PerfCategory, std::string>> PERF_CATEGORY_NAMES = {
+    { PerfCategory::TASK_RUN, "TaskRun" },
+    { PerfCategory::COMPONENT_ENABLE, "ComponentEnable" },
+    { PerfCategory::COMPONENT_DISABLE, "ComponentDisable" },
+    { PerfCategory::COMPONENT_RECOVER, "ComponentRecover" },
+    { PerfCategory::DB_PUT, "DBPut" },
+    { PerfCategory::DB_SYNC, "DBSync" },
+    { PerfCategory::PUBLISHER_DELIVERY, "PublisherDelivery" },
+    { PerfCategory::SOCKET_BIND, "SocketBind" },
+    { PerfCategory::SOCKET_BIND_FAIL, "SocketBindFail" },
+};
+
+const std::array<std::string, PERF_BUCKET_COUNT> PERF_BUCKET_NAMES = {
+    "<=1ms", "<=10ms", "<=100ms", "<=1s", "<=10s", ">10s"
 };
 
 std::unordered_map<TaskStep, std::string> g_mapTaskStep = {
@@ -121,6 +145,30 @@ int32_t HidumpHelper::ProcessDump(const HidumpFlag &flag, std::string &result)
             errCode = ShowAllCapabilityInfos(result);
             break;
         }
+        case HidumpFlag::GET_RECOVER_INFO : {
+            errCode = ShowAllRecoverInfos(result);
+            break;
+        }
+        case HidumpFlag::GET_HDF_LOAD_INFO : {
+            errCode = ShowAllHdfLoadInfos(result);
+            break;
+        }
+        case HidumpFlag::GET_FIRST_FRAME_INFO : {
+            errCode = ShowAllFirstFrameInfos(result);
+            break;
+        }
+        case HidumpFlag::GET_LOW_LATENCY_INFO : {
+            errCode = ShowAllLowLatencyInfos(result);
+            break;
+        }
+        case HidumpFlag::GET_PERF_INFO : {
+            errCode = ShowAllPerfInfos(result);
+            break;
+        }
+        case HidumpFlag::GET_DEVICE_FLAP_INFO : {
+            errCode = ShowAllDeviceFlapInfos(result);
+            break;
+        }
         default: {
             errCode = ShowIllealInfomation(result);
             break;
@@ -246,11 +294,16 @@ int32_t HidumpHelper::ShowAllTaskInfos(std::string &result)
         if (it != DHTypeStrMap.end()) {
             dhTypeStr = it->second;
         }
+        std::string taskTypeStr = "UNKNOWN";
+        auto typeIter = TaskTypeStrMap.find(taskInfo.taskType);
+        if (typeIter != TaskTypeStrMap.end()) {
+            taskTypeStr = typeIter->second;
+        }
         result.append("\n{");
         result.append("\n    TaskId     : ");
         result.append(taskInfo.id);
         result.append("\n    TaskType   : ");
-        result.append(g_mapTaskType[taskInfo.taskType]);
+        result.append(taskTypeStr);
         result.append("\n    DHType     : ");
         result.append(dhTypeStr);
         result.append("\n    DHId       : ");
@@ -312,6 +365,226 @@ int32_t HidumpHelper::ShowAllCapabilityInfos(std::string &result)
     return DH_FWK_SUCCESS;
 }
 
+int32_t HidumpHelper::ShowAllRecoverInfos(std::string &result)
+{
+    DHLOGI("Dump all recover infos.");
+    std::vector<RecoverDump> recoverInfos;
+    ComponentManager::GetInstance().DumpRecoverInfos(recoverInfos);
+
+    result.append("Last recovery of crashed components:");
+    if (recoverInfos.empty()) {
+        return DH_FWK_SUCCESS;
+    }
+
+    for (const auto &info : recoverInfos) {
+        std::string dhTypeStr = "UNKNOWN";
+        auto it = DHTypeStrMap.find(info.dhType);
+        if (it != DHTypeStrMap.end()) {
+            dhTypeStr = it->second;
+        }
+        result.append("\n{");
+        result.append("\n    DHType         : ");
+        result.append(dhTypeStr);
+        result.append("\n    EnableTasks    : ");
+        result.append(std::to_string(info.taskCount));
+        result.append("\n    FailedTasks    : ");
+        result.append(std::to_string(info.failedCount));
+        result.append("\n    CostMs         : ");
+        result.append(std::to_string(info.costMs));
+        result.append("\n    FinishTime     : ");
+        result.append(std::to_string(info.finishTime));
+        result.append("\n},");
+    }
+    result.replace(result.size() - 1, 1, "\n");
+    return DH_FWK_SUCCESS;
+}
+
+int32_t HidumpHelper::ShowAllHdfLoadInfos(std::string &result)
+{
+    DHLOGI("Dump all hdf load infos.");
+    std::vector<HdfLoadDump> hdfLoadInfos;
+    HdfOperateManager::GetInstance().DumpHdfLoadInfos(hdfLoadInfos);
+
+    result.append("Distributed hdf load info:");
+    if (hdfLoadInfos.empty()) {
+        return DH_FWK_SUCCESS;
+    }
+
+    for (const auto &info : hdfLoadInfos) {
+        std::string dhTypeStr = "UNKNOWN";
+        auto it = DHTypeStrMap.find(info.dhType);
+        if (it != DHTypeStrMap.end()) {
+            dhTypeStr = it->second;
+        }
+        result.append("\n{");
+        result.append("\n    DHType         : ");
+        result.append(dhTypeStr);
+        result.append("\n    RefCount       : ");
+        result.append(std::to_string(info.refCount));
+        result.append("\n    UnloadPending  : ");
+        result.append(info.unloadPending ? "true" : "false");
+        result.append("\n    LoadCount      : ");
+        result.append(std::to_string(info.loadCount));
+        result.append("\n    ReuseCount     : ");
+        result.append(std::to_string(info.reuseCount));
+        result.append("\n    PreloadCount   : ");
+        result.append(std::to_string(info.preloadCount));
+        result.append("\n    UnloadCount    : ");
+        result.append(std::to_string(info.unloadCount));
+        result.append("\n    LastLoadCostMs : ");
+        result.append(std::to_string(info.lastLoadCostMs));
+        result.append("\n    MaxLoadCostMs  : ");
+        result.append(std::to_string(info.maxLoadCostMs));
+        result.append("\n},");
+    }
+    result.replace(result.size() - 1, 1, "\n");
+    return DH_FWK_SUCCESS;
+}
+
+int32_t HidumpHelper::ShowAllFirstFrameInfos(std::string &result)
+{
+    DHLOGI("Dump all first frame infos.");
+    std::vector<AVTransFirstFrameInfo> firstFrameInfos;
+    AVTransControlCenter::GetInstance().DumpFirstFrameInfos(firstFrameInfos);
+
+    result.append("AV transport first frame info:");
+    if (firstFrameInfos.empty()) {
+        return DH_FWK_SUCCESS;
+    }
+
+    for (const auto &info : firstFrameInfos) {
+        result.append("\n{");
+        result.append("\n    OwnerName      : ");
+        result.append(info.ownerName);
+        result.append("\n    PeerDevId      : ");
+        result.append(GetAnonyString(info.peerDevId));
+        result.append("\n    SessionCount   : ");
+        result.append(std::to_string(info.sessionCount));
+        result.append("\n    PrewarmedCount : ");
+        result.append(std::to_string(info.prewarmedCount));
+        result.append("\n    LastCostMs     : ");
+        result.append(std::to_string(info.lastCostMs));
+        result.append("\n    MinCostMs      : ");
+        result.append(std::to_string(info.minCostMs));
+        result.append("\n    MaxCostMs      : ");
+        result.append(std::to_string(info.maxCostMs));
+        result.append("\n},");
+    }
+    result.replace(result.size() - 1, 1, "\n");
+    return DH_FWK_SUCCESS;
+}
+
+int32_t HidumpHelper::ShowAllLowLatencyInfos(std::string &result)
+{
+    DHLOGI("Dump all low latency infos.");
+    std::vector<LowLatencyPeerInfo> peerInfos;
+    LowLatency::GetInstance().DumpLowLatencyInfos(peerInfos);
+
+    result.append("Low latency info:");
+    if (peerInfos.empty()) {
+        return DH_FWK_SUCCESS;
+    }
+
+    for (const auto &info : peerInfos) {
+        result.append("\n{");
+        result.append("\n    NetworkId       : ");
+        result.append(GetAnonyString(info.networkId));
+        result.append("\n    RefCount        : ");
+        result.append(std::to_string(info.refCount));
+        result.append("\n    EnterCount      : ");
+        result.append(std::to_string(info.enterCount));
+        result.append("\n    TotalDurationMs : ");
+        result.append(std::to_string(info.totalDurationMs));
+        result.append("\n},");
+    }
+    result.replace(result.size() - 1, 1, "\n");
+    return DH_FWK_SUCCESS;
+}
+
+int32_t HidumpHelper::ShowAllPerfInfos(std::string &result)
+{
+    DHLOGI("Dump all perf infos.");
+    result.append("Performance info:");
+    result.append("\nTaskQueue: pending ");
+    result.append(std::to_string(TaskExecutor::GetInstance().GetPendingTaskCount()));
+    result.append(", peak ");
+    result.append(std::to_string(TaskExecutor::GetInstance().GetPeakPendingTaskCount()));
+    for (const auto &category : PERF_CATEGORY_NAMES) {
+        std::map<std::string, PerfCostStat> costStats;
+        DHPerfStats::GetInstance().DumpCostStats(category.first, costStats);
+        result.append("\n[" + category.second + "]");
+        for (const auto &item : costStats) {
+            ShowPerfCostStat(item.first, item.second, result);
+        }
+    }
+    std::map<std::string, PerfTrafficStat> trafficStats;
+    DHPerfStats::GetInstance().DumpTrafficStats(trafficStats);
+    result.append("\n[DHTransport]");
+    for (const auto &item : trafficStats) {
+        result.append("\n{");
+        result.append("\n    NetworkId     : ");
+        result.append(GetAnonyString(item.first));
+        result.append("\n    MsgCount      : ");
+        result.append(std::to_string(item.second.msgCount));
+        result.append("\n    RawBytes      : ");
+        result.append(std::to_string(item.second.rawBytes));
+        result.append("\n    SentBytes     : ");
+        result.append(std::to_string(item.second.sentBytes));
+        result.append("\n    CompressRatio : ");
+        uint64_t ratio = item.second.rawBytes > 0 ? item.second.sentBytes * PERCENT / item.second.rawBytes : 0;
+        result.append(std::to_string(ratio) + "%");
+        result.append("\n}");
+    }
+    result.append("\n");
+    return DH_FWK_SUCCESS;
+}
+
+int32_t HidumpHelper::ShowAllDeviceFlapInfos(std::string &result)
+{
+    DHLOGI("Dump all device flap infos.");
+    std::vector<DeviceFlapDump> flapInfos;
+    uint64_t totalSuppressed = 0;
+    AccessManager::GetInstance()->DumpDeviceFlaps(flapInfos, totalSuppressed);
+
+    result.append("Suppressed offline and online flaps: ");
+    result.append(std::to_string(totalSuppressed));
+    if (flapInfos.empty()) {
+        return DH_FWK_SUCCESS;
+    }
+
+    for (const auto &info : flapInfos) {
+        result.append("\n{");
+        result.append("\n    NetworkId       : ");
+        result.append(GetAnonyString(info.networkId));
+        result.append("\n    OfflinePending  : ");
+        result.append(info.offlinePending ? "true" : "false");
+        result.append("\n    SuppressedFlaps : ");
+        result.append(std::to_string(info.suppressedCount));
+        result.append("\n},");
+    }
+    result.replace(result.size() - 1, 1, "\n");
+    return DH_FWK_SUCCESS;
+}
+
+void HidumpHelper::ShowPerfCostStat(const std::string &key, const PerfCostStat &stat, std::string &result)
+{
+    result.append("\n{");
+    result.append("\n    Key       : ");
+    result.append(key);
+    result.append("\n    Count     : ");
+    result.append(std::to_string(stat.count));
+    result.append("\n    AvgUs     : ");
+    result.append(std::to_string(stat.count > 0 ? stat.totalUs / static_cast<int64_t>(stat.count) : 0));
+    result.append("\n    MaxUs     : ");
+    result.append(std::to_string(stat.maxUs));
+    result.append("\n    Histogram : [ ");
+    for (size_t i = 0; i < PERF_BUCKET_COUNT; i++) {
+        result.append(PERF_BUCKET_NAMES[i] + ":" + std::to_string(stat.buckets[i]) + " ");
+    }
+    result.append("]");
+    result.append("\n}");
+}
+
 int32_t HidumpHelper::ShowHelp(std::string &result)
 {
     DHLOGI("Show dump help.");
@@ -325,7 +598,19 @@ int32_t HidumpHelper::ShowHelp(std::string &result)
     result.append(" -t    ");
     result.append(": Show all tasks\n");
     result.append(" -c    ");
-    result.append(": Show all Capability info of online components\n\n");
+    result.append(": Show all Capability info of online components\n");
+    result.append(" -r    ");
+    result.append(": Show the last recovery of crashed components\n");
+    result.append(" -d    ");
+    result.append(": Show the load info of distributed hdf\n");
+    result.append(" -f    ");
+    result.append(": Show the time to first frame of av transport engines\n");
+    result.append(" -n    ");
+    result.append(": Show the time spent in low latency mode per peer\n");
+    result.append(" -p    ");
+    result.append(": Show the performance of tasks, components, db, transport and publisher\n");
+    result.append(" -o    ");
+    result.append(": Show the offline and online flaps suppressed per peer\n\n");
 
     return DH_FWK_SUCCESS;
 }
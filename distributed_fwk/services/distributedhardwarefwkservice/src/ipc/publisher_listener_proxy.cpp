@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -46,7 +46,8 @@ void PublisherListenerProxy::OnMessage(const DHTopic topic, const std::string& m
 
     MessageParcel data;
     MessageParcel reply;
-    MessageOption option;
+    // one way, a slow or dead subscriber must not hold up the publisher
+    MessageOption option = { MessageOption::TF_ASYNC };
     if (!data.WriteInterfaceToken(GetDescriptor())) {
         DHLOGE("PublisherListenerProxy write token failed");
         return;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,8 @@
 
 #include "local_hardware_manager.h"
 
+#include <algorithm>
+#include <thread>
 #include <unistd.h>
 
 #include "anonymous_string.h"
@@ -52,55 +54,125 @@ void LocalHardwareManager::Init()
     std::vector<DHType> allCompTypes;
     ComponentLoader::GetInstance().GetAllCompTypes(allCompTypes);
     int64_t allQueryStartTime = GetCurrentTime();
+    // A slow HAL query only delays its own dhType, every type publishes as soon as it is queried.
+    std::vector<std::thread> queryThreads;
     for (auto dhType : allCompTypes) {
-        int64_t singleQueryStartTime = GetCurrentTime();
-        IHardwareHandler *hardwareHandler = nullptr;
-        int32_t status = ComponentLoader::GetInstance().GetHardwareHandler(dhType, hardwareHandler);
-        if (status != DH_FWK_SUCCESS || hardwareHandler == nullptr) {
-            DHLOGE("GetHardwareHandler %{public}#X failed", dhType);
-            continue;
-        }
-        if (hardwareHandler->Initialize() != DH_FWK_SUCCESS) {
-            DHLOGE("Initialize %{public}#X failed", dhType);
-            continue;
-        }
+        queryThreads.emplace_back([this, dhType]() { InitLocalHardware(dhType); });
+    }
+    for (auto &queryThread : queryThreads) {
+        queryThread.join();
+    }
+    int64_t allQueryEndTime = GetCurrentTime();
+    DHLOGI("query all local hardware cost time: %{public}" PRIu64 " ms", allQueryEndTime - allQueryStartTime);
+}
 
-        DHQueryTraceStart(dhType);
-        QueryLocalHardware(dhType, hardwareHandler);
-        DHTraceEnd();
-        if (!hardwareHandler->IsSupportPlugin()) {
-            DHLOGI("hardwareHandler is not support hot swap plugin, release!");
-            ComponentLoader::GetInstance().ReleaseHardwareHandler(dhType);
-            hardwareHandler = nullptr;
-        } else {
+void LocalHardwareManager::InitLocalHardware(const DHType dhType)
+{
+    int64_t singleQueryStartTime = GetCurrentTime();
+    IHardwareHandler *hardwareHandler = nullptr;
+    int32_t status = ComponentLoader::GetInstance().GetHardwareHandler(dhType, hardwareHandler);
+    if (status != DH_FWK_SUCCESS || hardwareHandler == nullptr) {
+        DHLOGE("GetHardwareHandler %{public}#X failed", dhType);
+        return;
+    }
+    if (hardwareHandler->Initialize() != DH_FWK_SUCCESS) {
+        DHLOGE("Initialize %{public}#X failed", dhType);
+        return;
+    }
+
+    DHQueryTraceStart(dhType);
+    QueryLocalHardware(dhType, hardwareHandler);
+    DHTraceEnd();
+    PublishLocalHardware(dhType);
+    if (!hardwareHandler->IsSupportPlugin()) {
+        DHLOGI("hardwareHandler is not support hot swap plugin, release!");
+        ComponentLoader::GetInstance().ReleaseHardwareHandler(dhType);
+        hardwareHandler = nullptr;
+    } else {
+        std::shared_ptr<PluginListener> listener = std::make_shared<PluginListenerImpl>(dhType);
+        {
+            std::lock_guard<std::mutex> itemsLock(localDHItemsMutex_);
             compToolFuncsMap_[dhType] = hardwareHandler;
-            std::shared_ptr<PluginListener> listener = std::make_shared<PluginListenerImpl>(dhType);
             pluginListenerMap_[dhType] = listener;
-            hardwareHandler->RegisterPluginListener(listener);
         }
-        int64_t singleQueryEndTime = GetCurrentTime();
-        DHLOGI("query %{public}#X hardware cost time: %{public}" PRIu64 " ms",
-            dhType, singleQueryEndTime - singleQueryStartTime);
+        hardwareHandler->RegisterPluginListener(listener);
+    }
+    int64_t singleQueryEndTime = GetCurrentTime();
+    DHLOGI("query %{public}#X hardware cost time: %{public}" PRIu64 " ms",
+        dhType, singleQueryEndTime - singleQueryStartTime);
+}
+
+void LocalHardwareManager::PublishLocalHardware(const DHType dhType)
+{
+    std::vector<DHItem> dhItems;
+    {
+        std::lock_guard<std::mutex> itemsLock(localDHItemsMutex_);
+        auto iter = localDHItemsMap_.find(dhType);
+        if (iter == localDHItemsMap_.end() || iter->second.empty()) {
+            DHLOGI("no local hardware to publish, dhType: %{public}#X", dhType);
+            return;
+        }
+        dhItems = iter->second;
     }
-    int64_t allQueryEndTime = GetCurrentTime();
-    DHLOGI("query all local hardware cost time: %{public}" PRIu64 " ms", allQueryEndTime - allQueryStartTime);
     std::vector<std::shared_ptr<CapabilityInfo>> capabilityInfos;
     std::vector<std::shared_ptr<MetaCapabilityInfo>> metaCapInfos;
-    for (const auto &localDHItems : localDHItemsMap_) {
-        AddLocalCapabilityInfo(localDHItems.second, localDHItems.first, capabilityInfos);
-        AddLocalMetaCapInfo(localDHItems.second, localDHItems.first, metaCapInfos);
-    }
+    AddLocalCapabilityInfo(dhItems, dhType, capabilityInfos);
+    AddLocalMetaCapInfo(dhItems, dhType, metaCapInfos);
     CapabilityInfoManager::GetInstance()->AddCapability(capabilityInfos);
     MetaInfoManager::GetInstance()->AddMetaCapInfos(metaCapInfos);
+    NotifyLocalCapabilityChanged();
 }
 
 void LocalHardwareManager::UnInit()
 {
     DHLOGI("start");
     std::lock_guard<std::mutex> lock(localHardwareMgrMutex_);
-    compToolFuncsMap_.clear();
-    pluginListenerMap_.clear();
-    localDHItemsMap_.clear();
+    {
+        std::lock_guard<std::mutex> itemsLock(localDHItemsMutex_);
+        compToolFuncsMap_.clear();
+        pluginListenerMap_.clear();
+        localDHItemsMap_.clear();
+    }
+    NotifyLocalCapabilityChanged();
+}
+
+uint64_t LocalHardwareManager::GetLocalCapabilityVersion()
+{
+    return localCapabilityVersion_.load();
+}
+
+void LocalHardwareManager::NotifyLocalCapabilityChanged()
+{
+    localCapabilityVersion_.fetch_add(1);
+}
+
+bool LocalHardwareManager::UpdateLocalDHItem(const DHType dhType, const DHItem &dhItem)
+{
+    std::lock_guard<std::mutex> itemsLock(localDHItemsMutex_);
+    auto &dhItems = localDHItemsMap_[dhType];
+    auto iter = std::find_if(dhItems.begin(), dhItems.end(),
+        [&dhItem](const DHItem &item) { return item.dhId == dhItem.dhId; });
+    if (iter == dhItems.end()) {
+        dhItems.push_back(dhItem);
+        return true;
+    }
+    if (iter->attrs == dhItem.attrs && iter->subtype == dhItem.subtype) {
+        return false;
+    }
+    *iter = dhItem;
+    return true;
+}
+
+void LocalHardwareManager::RemoveLocalDHItem(const DHType dhType, const std::string &dhId)
+{
+    std::lock_guard<std::mutex> itemsLock(localDHItemsMutex_);
+    auto mapIter = localDHItemsMap_.find(dhType);
+    if (mapIter == localDHItemsMap_.end()) {
+        return;
+    }
+    auto &dhItems = mapIter->second;
+    dhItems.erase(std::remove_if(dhItems.begin(), dhItems.end(),
+        [&dhId](const DHItem &item) { return item.dhId == dhId; }), dhItems.end());
 }
 
 void LocalHardwareManager::QueryLocalHardware(const DHType dhType, IHardwareHandler *hardwareHandler)
@@ -124,6 +196,7 @@ void LocalHardwareManager::QueryLocalHardware(const DHType dhType, IHardwareHand
              * So check and remove the non-exist local capabilityInfo.
              */
             CheckNonExistCapabilityInfo(dhItems, dhType);
+            std::lock_guard<std::mutex> itemsLock(localDHItemsMutex_);
             localDHItemsMap_[dhType] = dhItems;
             break;
         }
@@ -135,9 +208,10 @@ void LocalHardwareManager::AddLocalCapabilityInfo(const std::vector<DHItem> &dhI
     std::vector<std::shared_ptr<CapabilityInfo>> &capabilityInfos)
 {
     DHLOGI("start!");
-    std::string deviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
-    std::string devName = DHContext::GetInstance().GetDeviceInfo().deviceName;
-    uint16_t devType = DHContext::GetInstance().GetDeviceInfo().deviceType;
+    auto localDevInfo = DHContext::GetInstance().GetDeviceInfoSnapshot();
+    const std::string &deviceId = localDevInfo->deviceId;
+    const std::string &devName = localDevInfo->deviceName;
+    uint16_t devType = localDevInfo->deviceType;
     for (auto dhItem : dhItems) {
         std::shared_ptr<CapabilityInfo> dhCapabilityInfo = std::make_shared<CapabilityInfo>(
             dhItem.dhId, deviceId, devName, devType, dhType, dhItem.attrs, dhItem.subtype);
@@ -149,11 +223,12 @@ void LocalHardwareManager::AddLocalMetaCapInfo(const std::vector<DHItem> &dhItem
     std::vector<std::shared_ptr<MetaCapabilityInfo>> &metaCapInfos)
 {
     DHLOGI("start!");
-    std::string deviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
-    std::string udidHash = DHContext::GetInstance().GetDeviceInfo().udidHash;
-    std::string devName = DHContext::GetInstance().GetDeviceInfo().deviceName;
-    uint16_t devType = DHContext::GetInstance().GetDeviceInfo().deviceType;
-    std::string strUUID = DHContext::GetInstance().GetDeviceInfo().uuid;
+    auto localDevInfo = DHContext::GetInstance().GetDeviceInfoSnapshot();
+    const std::string &deviceId = localDevInfo->deviceId;
+    const std::string &udidHash = localDevInfo->udidHash;
+    const std::string &devName = localDevInfo->deviceName;
+    uint16_t devType = localDevInfo->deviceType;
+    const std::string &strUUID = localDevInfo->uuid;
     CompVersion compversion;
     VersionManager::GetInstance().GetCompVersion(strUUID, dhType, compversion);
     for (auto dhItem : dhItems) {
@@ -202,7 +277,7 @@ void LocalHardwareManager::CheckNonExistCapabilityInfo(const std::vector<DHItem>
 
 void LocalHardwareManager::GetLocalCapabilityMapByPrefix(const DHType dhType, CapabilityInfoMap &capabilityInfoMap)
 {
-    std::string localDeviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
+    std::string localDeviceId = DHContext::GetInstance().GetDeviceInfoSnapshot()->deviceId;
     if (!IsIdLengthValid(localDeviceId)) {
         return;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -22,6 +22,7 @@
 #include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
 #include "distributed_hardware_log.h"
+#include "local_hardware_manager.h"
 #include "publisher.h"
 
 namespace OHOS {
@@ -35,6 +36,12 @@ void PluginListenerImpl::PluginHardware(const std::string &dhId, const std::stri
         return;
     }
     DHLOGI("plugin start, dhId: %{public}s", GetAnonyString(dhId).c_str());
+    DHItem dhItem = { dhId, attrs, subtype };
+    if (!LocalHardwareManager::GetInstance().UpdateLocalDHItem(dhType_, dhItem)) {
+        DHLOGI("hardware not changed, skip store, dhId: %{public}s", GetAnonyString(dhId).c_str());
+        Publisher::GetInstance().PublishMessage(DHTopic::TOPIC_PHY_DEV_PLUGIN, dhId);
+        return;
+    }
     std::vector<std::shared_ptr<CapabilityInfo>> capabilityInfos;
     std::string deviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
     std::string devName = DHContext::GetInstance().GetDeviceInfo().deviceName;
@@ -44,6 +51,7 @@ void PluginListenerImpl::PluginHardware(const std::string &dhId, const std::stri
     capabilityInfos.push_back(dhCapabilityInfo);
 
     CapabilityInfoManager::GetInstance()->AddCapability(capabilityInfos);
+    LocalHardwareManager::GetInstance().NotifyLocalCapabilityChanged();
     Publisher::GetInstance().PublishMessage(DHTopic::TOPIC_PHY_DEV_PLUGIN, dhId);
     DHLOGI("plugin end, dhId: %{public}s", GetAnonyString(dhId).c_str());
 }
@@ -63,6 +71,8 @@ void PluginListenerImpl::UnPluginHardware(const std::string &dhId)
         return;
     }
     CapabilityInfoManager::GetInstance()->RemoveCapabilityInfoByKey(capability->GetKey());
+    LocalHardwareManager::GetInstance().RemoveLocalDHItem(dhType_, dhId);
+    LocalHardwareManager::GetInstance().NotifyLocalCapabilityChanged();
     DHLOGI("unplugin end, dhId: %{public}s", GetAnonyString(dhId).c_str());
 }
 } // namespace DistributedHardware
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -20,7 +20,9 @@
 #include "res_sched_client.h"
 #include "res_type.h"
 
+#include "anonymous_string.h"
 #include "constants.h"
+#include "dh_utils_tool.h"
 #include "distributed_hardware_log.h"
 #include "low_latency_timer.h"
 
@@ -50,50 +52,123 @@ LowLatency::~LowLatency()
 
 void LowLatency::EnableLowLatency(DHType dhType)
 {
-    DHLOGI("Start EnableLowLatency dhType: %{public}#X", dhType);
+    EnableLowLatency("", dhType, "");
+}
+
+void LowLatency::DisableLowLatency(DHType dhType)
+{
+    DisableLowLatency("", dhType, "");
+}
+
+void LowLatency::EnableLowLatency(const std::string &networkId, DHType dhType, const std::string &sessionName)
+{
+    DHLOGI("Start EnableLowLatency networkId: %{public}s, dhType: %{public}#X, session: %{public}s",
+        GetAnonyString(networkId).c_str(), dhType, sessionName.c_str());
     if (dhType <= DHType::UNKNOWN || dhType >= DHType::MAX_DH) {
         DHLOGE("DHType is invalid, dhType: %{public}" PRIu32, (uint32_t)dhType);
         return;
     }
     std::lock_guard<std::mutex> lock(lowLatencyMutex_);
-    DHLOGI("lowLatencySwitchSet size: %{public}zu", lowLatencySwitchSet_.size());
-    if (lowLatencySwitchSet_.empty() && lowLatencyTimer_ != nullptr) {
+    DHLOGI("lowLatencySwitchMap size: %{public}zu", lowLatencySwitchMap_.size());
+    LowLatencyKey key = std::make_tuple(networkId, dhType, sessionName);
+    auto iter = lowLatencySwitchMap_.find(key);
+    if (iter == lowLatencySwitchMap_.end() && (lowLatencySwitchMap_.size() >= MAX_SWITCH_SIZE ||
+        (peerInfoMap_.find(networkId) == peerInfoMap_.end() && peerInfoMap_.size() >= MAX_SWITCH_SIZE))) {
+        DHLOGE("lowLatencySwitchMap_ is oversize");
+        return;
+    }
+    if (lowLatencySwitchMap_.empty() && lowLatencyTimer_ != nullptr) {
         DHLOGD("Open LowLatency dhType: %{public}#X", dhType);
         lowLatencyTimer_->StartTimer();
     }
-    if (lowLatencySwitchSet_.size() >= MAX_SWITCH_SIZE) {
-        DHLOGE("lowLatencySwitchSet_ is oversize");
-        return;
-    }
-    lowLatencySwitchSet_.insert(dhType);
-    DHLOGI("End EnableLowLatency dhType: %{public}#X", dhType);
+    uint32_t &refCount = lowLatencySwitchMap_[key];
+    refCount++;
+    OnPeerEnter(networkId);
+    DHLOGI("End EnableLowLatency dhType: %{public}#X, refCount: %{public}" PRIu32, dhType, refCount);
 }
 
-void LowLatency::DisableLowLatency(DHType dhType)
+void LowLatency::DisableLowLatency(const std::string &networkId, DHType dhType, const std::string &sessionName)
 {
-    DHLOGI("Start DisableLowLatency dhType: %{public}#X", dhType);
+    DHLOGI("Start DisableLowLatency networkId: %{public}s, dhType: %{public}#X, session: %{public}s",
+        GetAnonyString(networkId).c_str(), dhType, sessionName.c_str());
     if (dhType <= DHType::UNKNOWN || dhType >= DHType::MAX_DH) {
         DHLOGE("DHType is invalid, dhType: %{public}" PRIu32, (uint32_t)dhType);
         return;
     }
     std::lock_guard<std::mutex> lock(lowLatencyMutex_);
-    lowLatencySwitchSet_.erase(dhType);
-    if (lowLatencySwitchSet_.empty() && lowLatencyTimer_ != nullptr) {
+    auto iter = lowLatencySwitchMap_.find(std::make_tuple(networkId, dhType, sessionName));
+    if (iter == lowLatencySwitchMap_.end()) {
+        DHLOGW("No low latency user to release, dhType: %{public}#X", dhType);
+        return;
+    }
+    if (--iter->second == 0) {
+        lowLatencySwitchMap_.erase(iter);
+    }
+    OnPeerLeave(networkId);
+    if (lowLatencySwitchMap_.empty() && lowLatencyTimer_ != nullptr) {
         DHLOGD("Close LowLatency dhType: %{public}#X", dhType);
         lowLatencyTimer_->StopTimer();
     }
     DHLOGI("End DisableLowLatency dhType: %{public}#X", dhType);
 }
 
+void LowLatency::OnPeerEnter(const std::string &networkId)
+{
+    LowLatencyPeerInfo &peerInfo = peerInfoMap_[networkId];
+    peerInfo.networkId = networkId;
+    if (peerInfo.refCount++ == 0) {
+        peerInfo.enterTime = GetCurrentTime();
+        peerInfo.enterCount++;
+    }
+}
+
+void LowLatency::OnPeerLeave(const std::string &networkId)
+{
+    auto iter = peerInfoMap_.find(networkId);
+    if (iter == peerInfoMap_.end() || iter->second.refCount == 0) {
+        return;
+    }
+    LowLatencyPeerInfo &peerInfo = iter->second;
+    if (--peerInfo.refCount > 0) {
+        return;
+    }
+    int64_t durationMs = GetCurrentTime() - peerInfo.enterTime;
+    peerInfo.totalDurationMs += durationMs > 0 ? durationMs : 0;
+    peerInfo.enterTime = 0;
+    DHLOGI("Peer %{public}s leaves low latency after %{public}" PRId64 "ms, total %{public}" PRId64 "ms",
+        GetAnonyString(networkId).c_str(), durationMs, peerInfo.totalDurationMs);
+}
+
 void LowLatency::CloseLowLatency()
 {
     DHLOGI("Shutdown LowLatency");
     std::lock_guard<std::mutex> lock(lowLatencyMutex_);
-    lowLatencySwitchSet_.clear();
+    lowLatencySwitchMap_.clear();
+    int64_t now = GetCurrentTime();
+    for (auto &item : peerInfoMap_) {
+        if (item.second.refCount > 0 && now > item.second.enterTime) {
+            item.second.totalDurationMs += now - item.second.enterTime;
+        }
+        item.second.refCount = 0;
+        item.second.enterTime = 0;
+    }
     // to restore normal latency mode: value = 1
     OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(
         OHOS::ResourceSchedule::ResType::RES_TYPE_NETWORK_LATENCY_REQUEST, MODE_DISABLE,
         {{LOW_LATENCY_KEY, DH_FWK_PKG_NAME}});
 }
+
+void LowLatency::DumpLowLatencyInfos(std::vector<LowLatencyPeerInfo> &peerInfos)
+{
+    std::lock_guard<std::mutex> lock(lowLatencyMutex_);
+    int64_t now = GetCurrentTime();
+    for (const auto &item : peerInfoMap_) {
+        LowLatencyPeerInfo peerInfo = item.second;
+        if (peerInfo.refCount > 0 && now > peerInfo.enterTime) {
+            peerInfo.totalDurationMs += now - peerInfo.enterTime;
+        }
+        peerInfos.push_back(peerInfo);
+    }
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -66,11 +66,21 @@ void LowLatencyListener::OnMessage(const DHTopic topic, const std::string& messa
         cJSON_Delete(jsonObj);
         return;
     }
+    std::string networkId;
+    std::string sessionName;
+    cJSON *networkIdJson = cJSON_GetObjectItem(jsonObj, DEV_ID);
+    if (IsString(networkIdJson) && IsIdLengthValid(networkIdJson->valuestring)) {
+        networkId = networkIdJson->valuestring;
+    }
+    cJSON *sessionJson = cJSON_GetObjectItem(jsonObj, LOW_LATENCY_SESSION);
+    if (IsString(sessionJson) && IsIdLengthValid(sessionJson->valuestring)) {
+        sessionName = sessionJson->valuestring;
+    }
     DHType dhType = (DHType)dhTypeJson->valueint;
     if (cJSON_IsTrue(enableJson)) {
-        LowLatency::GetInstance().EnableLowLatency(dhType);
+        LowLatency::GetInstance().EnableLowLatency(networkId, dhType, sessionName);
     } else {
-        LowLatency::GetInstance().DisableLowLatency(dhType);
+        LowLatency::GetInstance().DisableLowLatency(networkId, dhType, sessionName);
     }
     cJSON_Delete(jsonObj);
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -78,6 +78,18 @@ void Publisher::PublishMessage(const DHTopic topic, const std::string &message)
     publisherItems_[topic]->PublishMessage(message);
 }
 
+void Publisher::OnListenerDied(const DHTopic topic, const wptr<IRemoteObject> &remote)
+{
+    if (!IsTopicExist(topic)) {
+        return;
+    }
+    if (publisherItems_[topic] == nullptr) {
+        DHLOGE("The topic: %{public}u, point is null.", static_cast<uint32_t>(topic));
+        return;
+    }
+    publisherItems_[topic]->RemoveDeadListener(remote);
+}
+
 bool Publisher::IsTopicExist(const DHTopic topic)
 {
     if (publisherItems_.find(topic) == publisherItems_.end()) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,16 +16,27 @@
 #include "publisher_item.h"
 
 #include "constants.h"
+#include "dh_perf_stats.h"
 #include "dh_utils_tool.h"
 #include "distributed_hardware_log.h"
+#include "publisher.h"
 
 namespace OHOS {
 namespace DistributedHardware {
-PublisherItem::PublisherItem() : topic_(DHTopic::TOPIC_MIN)
+void PublisherListenerDeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &remote)
 {
+    DHLOGI("Publisher listener died, topic: %{public}d", topic_);
+    Publisher::GetInstance().OnListenerDied(topic_, remote);
 }
 
-PublisherItem::PublisherItem(DHTopic topic) : topic_(topic)
+PublisherItem::PublisherItem() : topic_(DHTopic::TOPIC_MIN),
+    listeners_(std::make_shared<const PublisherListenerSet>())
+{
+}
+
+PublisherItem::PublisherItem(DHTopic topic) : topic_(topic),
+    listeners_(std::make_shared<const PublisherListenerSet>()),
+    deathRecipient_(sptr<IRemoteObject::DeathRecipient>(new (std::nothrow) PublisherListenerDeathRecipient(topic)))
 {
     DHLOGE("Ctor PublisherItem, topic: %{public}d", topic);
 }
@@ -34,7 +45,7 @@ PublisherItem::~PublisherItem()
 {
     DHLOGE("Dtor PublisherItem, topic: %{public}d", topic_);
     std::lock_guard<std::mutex> lock(mutex_);
-    listeners_.clear();
+    listeners_ = std::make_shared<const PublisherListenerSet>();
 }
 
 void PublisherItem::AddListener(const sptr<IPublisherListener> listener)
@@ -45,7 +56,15 @@ void PublisherItem::AddListener(const sptr<IPublisherListener> listener)
     }
 
     std::lock_guard<std::mutex> lock(mutex_);
-    listeners_.insert(listener);
+    auto listeners = std::make_shared<PublisherListenerSet>(*listeners_);
+    if (!listeners->insert(listener).second) {
+        return;
+    }
+    sptr<IRemoteObject> remote = listener->AsObject();
+    if (remote != nullptr && remote->IsProxyObject() && deathRecipient_ != nullptr) {
+        remote->AddDeathRecipient(deathRecipient_);
+    }
+    listeners_ = listeners;
 }
 
 void PublisherItem::RemoveListener(const sptr<IPublisherListener> listener)
@@ -56,11 +75,30 @@ void PublisherItem::RemoveListener(const sptr<IPublisherListener> listener)
     }
 
     std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto &lis : listeners_) {
-        if (lis->AsObject().GetRefPtr() == listener->AsObject().GetRefPtr()) {
-            listeners_.erase(lis);
-            break;
+    EraseListener(listener->AsObject().GetRefPtr());
+}
+
+void PublisherItem::RemoveDeadListener(const wptr<IRemoteObject> &remote)
+{
+    DHLOGI("Remove dead publisher listener, topic: %{public}d", topic_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    EraseListener(remote.GetRefPtr());
+}
+
+void PublisherItem::EraseListener(const IRemoteObject *object)
+{
+    for (const auto &lis : *listeners_) {
+        sptr<IRemoteObject> remote = lis->AsObject();
+        if (remote.GetRefPtr() != object) {
+            continue;
         }
+        if (remote != nullptr && remote->IsProxyObject() && deathRecipient_ != nullptr) {
+            remote->RemoveDeathRecipient(deathRecipient_);
+        }
+        auto listeners = std::make_shared<PublisherListenerSet>(*listeners_);
+        listeners->erase(lis);
+        listeners_ = listeners;
+        return;
     }
 }
 
@@ -69,8 +107,13 @@ void PublisherItem::PublishMessage(const std::string &message)
     if (!IsMessageLengthValid(message)) {
         return;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto &listener : listeners_) {
+    std::shared_ptr<const PublisherListenerSet> listeners;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        listeners = listeners_;
+    }
+    PerfCostScope costScope(PerfCategory::PUBLISHER_DELIVERY, std::to_string(static_cast<uint32_t>(topic_)));
+    for (const auto &listener : *listeners) {
         DHLOGI("Publish Message topic: %{public}d", topic_);
         listener->OnMessage(topic_, message);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -20,6 +20,7 @@
 #include "cJSON.h"
 
 #include "anonymous_string.h"
+#include "capability_utils.h"
 #include "constants.h"
 #include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
@@ -153,6 +154,56 @@ std::string CapabilityInfo::ToJsonString()
     return jsonString;
 }
 
+int32_t CapabilityInfo::FromBinaryString(const std::string &binStr)
+{
+    if (!IsMessageLengthValid(binStr)) {
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    size_t pos = 0;
+    if (!ReadCapBinaryHeader(binStr, pos) || !ReadBinaryFields(binStr, pos)) {
+        DHLOGE("binStr parse failed");
+        return ERR_DH_FWK_RESOURCE_RES_DB_DATA_INVALID;
+    }
+    return DH_FWK_SUCCESS;
+}
+
+std::string CapabilityInfo::ToBinaryString()
+{
+    std::string binStr;
+    AppendCapBinaryHeader(binStr);
+    AppendBinaryFields(binStr);
+    return binStr;
+}
+
+void CapabilityInfo::AppendBinaryFields(std::string &out) const
+{
+    AppendCapBinaryString(out, dhId_);
+    AppendCapBinaryString(out, deviceId_);
+    AppendCapBinaryString(out, deviceName_);
+    AppendCapBinaryUint32(out, deviceType_);
+    AppendCapBinaryUint32(out, static_cast<uint32_t>(dhType_));
+    AppendCapBinaryString(out, dhAttrs_);
+    AppendCapBinaryString(out, dhSubtype_);
+}
+
+bool CapabilityInfo::ReadBinaryFields(const std::string &binStr, size_t &pos)
+{
+    uint32_t deviceType = 0;
+    uint32_t dhType = 0;
+    if (!ReadCapBinaryString(binStr, pos, dhId_) || !ReadCapBinaryString(binStr, pos, deviceId_) ||
+        !ReadCapBinaryString(binStr, pos, deviceName_) || !ReadCapBinaryUint32(binStr, pos, deviceType) ||
+        !ReadCapBinaryUint32(binStr, pos, dhType) || !ReadCapBinaryString(binStr, pos, dhAttrs_) ||
+        !ReadCapBinaryString(binStr, pos, dhSubtype_)) {
+        return false;
+    }
+    if (deviceType > UINT16_MAX) {
+        return false;
+    }
+    deviceType_ = static_cast<uint16_t>(deviceType);
+    dhType_ = static_cast<DHType>(dhType);
+    return true;
+}
+
 bool CapabilityInfo::Compare(const CapabilityInfo& capInfo)
 {
     if (strcmp(this->deviceId_.c_str(), capInfo.deviceId_.c_str()) != 0) {
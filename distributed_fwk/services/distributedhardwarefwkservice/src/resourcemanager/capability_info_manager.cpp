@@ -15,8 +15,11 @@
 
 #include "capability_info_manager.h"
 
+#include <cstdlib>
+
 #include "anonymous_string.h"
 #include "capability_utils.h"
+#include "component_manager.h"
 #include "constants.h"
 #include "dh_context.h"
 #include "dh_utils_tool.h"
@@ -24,9 +27,11 @@
 #include "distributed_hardware_log.h"
 #include "distributed_hardware_manager.h"
 #include "distributed_hardware_manager_factory.h"
+#include "parameters.h"
 #include "task_executor.h"
 #include "task_factory.h"
 #include "task_board.h"
+#include "version_info_manager.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -35,6 +40,23 @@ namespace DistributedHardware {
 
 constexpr const char *GLOBAL_CAPABILITY_INFO_KEY = "global_capability_info";
 
+namespace {
+    constexpr const char *CAPABILITY_LAST_SEEN_KEY = "capability_last_seen";
+    const std::string CAPABILITY_TTL_PARAM = "persist.distributed_hardware.dhfwk.capability_ttl_days";
+    constexpr int32_t DEFAULT_CAPABILITY_TTL_DAYS = 30;
+    constexpr int32_t MAX_CAPABILITY_TTL_DAYS = 365;
+    constexpr int64_t MS_ONE_DAY = 24 * 60 * 60 * 1000;
+    /* Kept off the startup path, then once a day */
+    constexpr int64_t FIRST_EVICTION_DELAY_MS = 60 * 1000;
+    constexpr int64_t EVICTION_INTERVAL_MS = MS_ONE_DAY;
+
+    int64_t GetCapabilityTtlMs()
+    {
+        return static_cast<int64_t>(OHOS::system::GetIntParameter(CAPABILITY_TTL_PARAM, DEFAULT_CAPABILITY_TTL_DAYS,
+            0, MAX_CAPABILITY_TTL_DAYS)) * MS_ONE_DAY;
+    }
+}
+
 CapabilityInfoManager::CapabilityInfoManager() : dbAdapterPtr_(nullptr)
 {
     DHLOGI("CapabilityInfoManager construction!");
@@ -77,6 +99,10 @@ void CapabilityInfoManager::CapabilityInfoManagerEventHandler::ProcessEvent(
         case EVENT_CAPABILITY_INFO_DB_RECOVER:
             selfPtr->SyncRemoteCapabilityInfos();
             break;
+        case EVENT_CAPABILITY_INFO_EVICT:
+            selfPtr->EvictExpiredCapabilities();
+            selfPtr->ScheduleEviction(EVICTION_INTERVAL_MS);
+            break;
         default:
             DHLOGE("event is undefined, id is %{public}d", eventId);
             break;
@@ -91,7 +117,7 @@ std::shared_ptr<CapabilityInfoManager::CapabilityInfoManagerEventHandler> Capabi
 int32_t CapabilityInfoManager::Init()
 {
     DHLOGI("CapabilityInfoManager instance init!");
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     dbAdapterPtr_ = std::make_shared<DBAdapter>(APP_ID, GLOBAL_CAPABILITY_INFO_KEY, shared_from_this());
     if (dbAdapterPtr_ == nullptr) {
         DHLOGE("dbAdapterPtr_ is null");
@@ -101,9 +127,16 @@ int32_t CapabilityInfoManager::Init()
         DHLOGE("Init dbAdapterPtr_ failed");
         return ERR_DH_FWK_RESOURCE_INIT_DB_FAILED;
     }
+    // Without the last seen store the records are still served, only never evicted.
+    lastSeenDbPtr_ = std::make_shared<DBAdapter>(APP_ID, CAPABILITY_LAST_SEEN_KEY, shared_from_this());
+    if (lastSeenDbPtr_->InitLocal() != DH_FWK_SUCCESS) {
+        DHLOGW("Init lastSeenDbPtr_ failed, capability eviction is off");
+        lastSeenDbPtr_.reset();
+    }
     std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create(true);
     eventHandler_ = std::make_shared<CapabilityInfoManager::CapabilityInfoManagerEventHandler>(
         runner, shared_from_this());
+    ScheduleEviction(FIRST_EVICTION_DELAY_MS);
     DHLOGI("CapabilityInfoManager instance init success");
     return DH_FWK_SUCCESS;
 }
@@ -111,13 +144,20 @@ int32_t CapabilityInfoManager::Init()
 int32_t CapabilityInfoManager::UnInit()
 {
     DHLOGI("CapabilityInfoManager UnInit");
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     if (dbAdapterPtr_ == nullptr) {
         DHLOGE("dbAdapterPtr_ is null");
         return ERR_DH_FWK_RESOURCE_UNINIT_DB_FAILED;
     }
+    if (eventHandler_ != nullptr) {
+        eventHandler_->RemoveEvent(EVENT_CAPABILITY_INFO_EVICT);
+    }
     dbAdapterPtr_->UnInit();
     dbAdapterPtr_.reset();
+    if (lastSeenDbPtr_ != nullptr) {
+        lastSeenDbPtr_->UnInit();
+        lastSeenDbPtr_.reset();
+    }
     return DH_FWK_SUCCESS;
 }
 
@@ -127,7 +167,7 @@ int32_t CapabilityInfoManager::SyncDeviceInfoFromDB(const std::string &deviceId)
         return ERR_DH_FWK_PARA_INVALID;
     }
     DHLOGI("Sync DeviceInfo from DB, deviceId: %{public}s", GetAnonyString(deviceId).c_str());
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     if (dbAdapterPtr_ == nullptr) {
         DHLOGE("dbAdapterPtr_ is null");
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
@@ -147,7 +187,7 @@ int32_t CapabilityInfoManager::SyncDeviceInfoFromDB(const std::string &deviceId)
             DHLOGE("Get capability ptr by value failed");
             continue;
         }
-        globalCapInfoMap_[capabilityInfo->GetKey()] = capabilityInfo;
+        PutCapabilityInMem(capabilityInfo->GetKey(), capabilityInfo);
     }
     return DH_FWK_SUCCESS;
 }
@@ -155,13 +195,14 @@ int32_t CapabilityInfoManager::SyncDeviceInfoFromDB(const std::string &deviceId)
 int32_t CapabilityInfoManager::SyncRemoteCapabilityInfos()
 {
     DHLOGI("Sync full remote device info from DB");
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     if (dbAdapterPtr_ == nullptr) {
         DHLOGE("dbAdapterPtr_ is null");
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
     }
     std::vector<std::string> deviceIdVec;
     DHContext::GetInstance().GetOnlineDeviceDeviceId(deviceIdVec);
+    const std::string localDeviceId = DHContext::GetInstance().GetDeviceInfoSnapshot()->deviceId;
     for (const auto &deviceId : deviceIdVec) {
         std::vector<std::string> dataVector;
         if (dbAdapterPtr_->GetDataByKeyPrefix(deviceId, dataVector) != DH_FWK_SUCCESS) {
@@ -179,14 +220,96 @@ int32_t CapabilityInfoManager::SyncRemoteCapabilityInfos()
                 continue;
             }
             const std::string deviceId = capabilityInfo->GetDeviceId();
-            const std::string localDeviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
             if (deviceId.compare(localDeviceId) == 0) {
                 DHLOGE("local device info not need sync from db");
                 continue;
             }
-            globalCapInfoMap_[capabilityInfo->GetKey()] = capabilityInfo;
+            PutCapabilityInMem(capabilityInfo->GetKey(), capabilityInfo);
+        }
+    }
+    return DH_FWK_SUCCESS;
+}
+
+int32_t CapabilityInfoManager::LoadDeviceCapabilities(const std::string &deviceId)
+{
+    if (!IsIdLengthValid(deviceId)) {
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    {
+        std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
+        RecordLastSeen(deviceId);
+        CapabilityInfoMap capabilityMap;
+        if (GetDataByKeyPrefixInMem(deviceId + RESOURCE_SEPARATOR, capabilityMap) > 0) {
+            DHLOGI("Capabilities are loaded, deviceId: %{public}s", GetAnonyString(deviceId).c_str());
+            return DH_FWK_SUCCESS;
+        }
+    }
+    return SyncDeviceInfoFromDB(deviceId);
+}
+
+int32_t CapabilityInfoManager::EvictExpiredCapabilities()
+{
+    int64_t ttlMs = GetCapabilityTtlMs();
+    if (ttlMs == 0) {
+        DHLOGI("Capability eviction is disabled");
+        return DH_FWK_SUCCESS;
+    }
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
+    if (dbAdapterPtr_ == nullptr || lastSeenDbPtr_ == nullptr) {
+        DHLOGE("dbAdapterPtr_ or lastSeenDbPtr_ is null");
+        return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
+    }
+    std::vector<DistributedKv::Entry> capEntries;
+    std::vector<DistributedKv::Entry> lastSeenEntries;
+    if (dbAdapterPtr_->GetEntriesByKeyPrefix("", capEntries) != DH_FWK_SUCCESS ||
+        lastSeenDbPtr_->GetEntriesByKeyPrefix("", lastSeenEntries) != DH_FWK_SUCCESS) {
+        DHLOGE("Query capability or last seen entries failed");
+        return ERR_DH_FWK_RESOURCE_DB_ADAPTER_OPERATION_FAIL;
+    }
+    std::set<std::string> deviceIds;
+    for (const auto &entry : capEntries) {
+        std::string key = entry.key.ToString();
+        size_t pos = key.find(RESOURCE_SEPARATOR);
+        if (pos != std::string::npos && pos > 0) {
+            deviceIds.insert(key.substr(0, pos));
+        }
+    }
+    std::map<std::string, int64_t> lastSeenTimes;
+    for (const auto &entry : lastSeenEntries) {
+        lastSeenTimes[entry.key.ToString()] = std::strtoll(entry.value.ToString().c_str(), nullptr, 10); // 10: decimal
+    }
+    std::vector<std::string> onlineIds;
+    DHContext::GetInstance().GetOnlineDeviceDeviceId(onlineIds);
+    std::set<std::string> activeIds(onlineIds.begin(), onlineIds.end());
+    activeIds.insert(DHContext::GetInstance().GetDeviceInfoSnapshot()->deviceId);
+    int64_t now = GetCurrentTime();
+    size_t evictedCount = 0;
+    for (const auto &deviceId : deviceIds) {
+        auto iter = lastSeenTimes.find(deviceId);
+        // Records from before the tracking, or stamped by a clock that went back, start their TTL now.
+        if (activeIds.count(deviceId) > 0 || iter == lastSeenTimes.end() || iter->second <= 0 ||
+            iter->second > now) {
+            RecordLastSeen(deviceId);
+            continue;
+        }
+        if (now - iter->second < ttlMs) {
+            continue;
+        }
+        DHLOGI("Evict capabilities of deviceId: %{public}s", GetAnonyString(deviceId).c_str());
+        EraseDeviceCapabilityInMem(deviceId);
+        if (dbAdapterPtr_->RemoveDeviceData(deviceId) != DH_FWK_SUCCESS) {
+            DHLOGE("Remove capability Device Data failed, deviceId: %{public}s", GetAnonyString(deviceId).c_str());
+            continue;
+        }
+        lastSeenDbPtr_->RemoveDataByKey(deviceId);
+        evictedCount++;
+    }
+    for (const auto &item : lastSeenTimes) {
+        if (deviceIds.count(item.first) == 0 && now - item.second >= ttlMs) {
+            lastSeenDbPtr_->RemoveDataByKey(item.first);
         }
     }
+    DHLOGI("Evicted %{public}zu of %{public}zu remote devices", evictedCount, deviceIds.size());
     return DH_FWK_SUCCESS;
 }
 
@@ -196,29 +319,38 @@ int32_t CapabilityInfoManager::AddCapability(const std::vector<std::shared_ptr<C
         DHLOGE("ResInfo is empty or too large, resInfos size: %{public}zu", resInfos.size());
         return ERR_DH_FWK_RESOURCE_RES_DB_DATA_INVALID;
     }
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    uint32_t codecVersion = VersionInfoManager::GetInstance()->GetAgreedCapCodecVersion();
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     if (dbAdapterPtr_ == nullptr) {
         DHLOGE("dbAdapterPtr_ is null");
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
     }
     std::vector<std::string> keys;
+    for (const auto &resInfo : resInfos) {
+        if (resInfo != nullptr) {
+            keys.push_back(resInfo->GetKey());
+        }
+    }
+    std::unordered_map<std::string, std::string> storedValues;
+    dbAdapterPtr_->GetValuesByKeys(keys, storedValues);
+    keys.clear();
     std::vector<std::string> values;
     std::string key;
-    std::string data;
     for (auto &resInfo : resInfos) {
         if (resInfo == nullptr) {
             continue;
         }
         key = resInfo->GetKey();
-        globalCapInfoMap_[key] = resInfo;
-        if (dbAdapterPtr_->GetDataByKey(key, data) == DH_FWK_SUCCESS &&
-            IsCapInfoJsonEqual<CapabilityInfo>(data, resInfo->ToJsonString())) {
+        PutCapabilityInMem(key, resInfo);
+        std::string value = EncodeCapability(resInfo, codecVersion);
+        auto storedIter = storedValues.find(key);
+        if (storedIter != storedValues.end() && IsCapInfoEqual<CapabilityInfo>(storedIter->second, value)) {
             DHLOGD("this record is exist, Key: %{public}s", resInfo->GetAnonymousKey().c_str());
             continue;
         }
         DHLOGI("AddCapability, Key: %{public}s", resInfo->GetAnonymousKey().c_str());
         keys.push_back(key);
-        values.push_back(resInfo->ToJsonString());
+        values.push_back(value);
     }
     if (keys.empty() || values.empty()) {
         DHLOGD("Records are empty, No need add data to db!");
@@ -237,14 +369,14 @@ int32_t CapabilityInfoManager::AddCapabilityInMem(const std::vector<std::shared_
         DHLOGE("ResInfo is empty or too large!");
         return ERR_DH_FWK_RESOURCE_RES_DB_DATA_INVALID;
     }
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     for (auto &resInfo : resInfos) {
         if (resInfo == nullptr) {
             continue;
         }
         const std::string key = resInfo->GetKey();
         DHLOGI("AddCapabilityInMem, Key: %{public}s", resInfo->GetAnonymousKey().c_str());
-        globalCapInfoMap_[key] = resInfo;
+        PutCapabilityInMem(key, resInfo);
     }
     return DH_FWK_SUCCESS;
 }
@@ -255,20 +387,13 @@ int32_t CapabilityInfoManager::RemoveCapabilityInfoInDB(const std::string &devic
         return ERR_DH_FWK_PARA_INVALID;
     }
     DHLOGI("Remove capability device info, deviceId: %{public}s", GetAnonyString(deviceId).c_str());
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     if (dbAdapterPtr_ == nullptr) {
         DHLOGE("dbAdapterPtr_ is null");
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
     }
     // 1. Clear the cache in the memory.
-    for (auto iter = globalCapInfoMap_.begin(); iter != globalCapInfoMap_.end();) {
-        if (!IsCapKeyMatchDeviceId(iter->first, deviceId)) {
-            iter++;
-            continue;
-        }
-        DHLOGI("Clear globalCapInfoMap_ iter: %{public}s", GetAnonyString(iter->first).c_str());
-        globalCapInfoMap_.erase(iter++);
-    }
+    EraseDeviceCapabilityInMem(deviceId);
     // 2. Delete the corresponding record from the database(use UUID).
     if (dbAdapterPtr_->RemoveDeviceData(deviceId) != DH_FWK_SUCCESS) {
         DHLOGE("Remove capability Device Data failed, deviceId: %{public}s", GetAnonyString(deviceId).c_str());
@@ -283,13 +408,13 @@ int32_t CapabilityInfoManager::RemoveCapabilityInfoByKey(const std::string &key)
         return ERR_DH_FWK_PARA_INVALID;
     }
     DHLOGI("Remove capability device info, key: %{public}s", GetAnonyString(key).c_str());
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     if (dbAdapterPtr_ == nullptr) {
         DHLOGE("dbAdapterPtr_ is null");
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
     }
     // 1. Clear the cache in the memory.
-    globalCapInfoMap_.erase(key);
+    EraseCapabilityInMem(key);
 
     // 2. Delete the corresponding record from the database.(use key)
     if (dbAdapterPtr_->RemoveDataByKey(key) != DH_FWK_SUCCESS) {
@@ -305,14 +430,10 @@ int32_t CapabilityInfoManager::RemoveCapabilityInfoInMem(const std::string &devi
         return ERR_DH_FWK_PARA_INVALID;
     }
     DHLOGI("remove capability device info in memory, deviceId: %{public}s", GetAnonyString(deviceId).c_str());
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
-    for (auto iter = globalCapInfoMap_.begin(); iter != globalCapInfoMap_.end();) {
-        if (!IsCapKeyMatchDeviceId(iter->first, deviceId)) {
-            iter++;
-            continue;
-        }
-        globalCapInfoMap_.erase(iter++);
-    }
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
+    // Only the offline path drops a device from memory, its TTL runs from here.
+    RecordLastSeen(deviceId);
+    EraseDeviceCapabilityInMem(deviceId);
     return DH_FWK_SUCCESS;
 }
 
@@ -365,7 +486,7 @@ void CapabilityInfoManager::OnChange(const DistributedKv::DataOrigin &origin, Ke
 
 void CapabilityInfoManager::HandleCapabilityAddChange(const std::vector<DistributedKv::Entry> &insertRecords)
 {
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     for (const auto &item : insertRecords) {
         const std::string value = item.value.ToString();
         std::shared_ptr<CapabilityInfo> capPtr;
@@ -387,7 +508,7 @@ void CapabilityInfoManager::HandleCapabilityAddChange(const std::vector<Distribu
 
         const auto keyString = capPtr->GetKey();
         DHLOGI("Add capability key: %{public}s", capPtr->GetAnonymousKey().c_str());
-        globalCapInfoMap_[keyString] = capPtr;
+        PutCapabilityInMem(keyString, capPtr);
         TaskParam taskParam = {
             .networkId = networkId,
             .uuid = uuid,
@@ -397,6 +518,7 @@ void CapabilityInfoManager::HandleCapabilityAddChange(const std::vector<Distribu
         auto task = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, nullptr);
         TaskExecutor::GetInstance().PushTask(task);
     }
+    ComponentManager::GetInstance().NotifyCapabilityAvailable();
     DHLOGI("HandleCapabilityAddChange success");
 }
 
@@ -406,7 +528,7 @@ void CapabilityInfoManager::HandleCapabilityUpdateChange(const std::vector<Distr
         DHLOGE("no need Update, is in uniniting.");
         return;
     }
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     for (const auto &item : updateRecords) {
         const std::string value = item.value.ToString();
         std::shared_ptr<CapabilityInfo> capPtr;
@@ -432,7 +554,7 @@ void CapabilityInfoManager::HandleCapabilityUpdateChange(const std::vector<Distr
         }
         const auto keyString = capPtr->GetKey();
         DHLOGI("Update capability key: %{public}s", capPtr->GetAnonymousKey().c_str());
-        globalCapInfoMap_[keyString] = capPtr;
+        PutCapabilityInMem(keyString, capPtr);
         TaskParam taskParam = {
             .networkId = networkId,
             .uuid = uuid,
@@ -442,6 +564,7 @@ void CapabilityInfoManager::HandleCapabilityUpdateChange(const std::vector<Distr
         auto task = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, nullptr);
         TaskExecutor::GetInstance().PushTask(task);
     }
+    ComponentManager::GetInstance().NotifyCapabilityAvailable();
     DHLOGI("HandleCapabilityUpdateChange success");
 }
 
@@ -451,7 +574,7 @@ void CapabilityInfoManager::HandleCapabilityDeleteChange(const std::vector<Distr
         DHLOGE("no need Update, is in uniniting.");
         return;
     }
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     for (const auto &item : deleteRecords) {
         const std::string value = item.value.ToString();
         std::shared_ptr<CapabilityInfo> capPtr;
@@ -479,7 +602,7 @@ void CapabilityInfoManager::HandleCapabilityDeleteChange(const std::vector<Distr
         auto task = TaskFactory::GetInstance().CreateTask(TaskType::DISABLE, taskParam, nullptr);
         TaskExecutor::GetInstance().PushTask(task);
         DHLOGI("Delete capability key: %{public}s", capPtr->GetAnonymousKey().c_str());
-        globalCapInfoMap_.erase(keyString);
+        EraseCapabilityInMem(keyString);
     }
 }
 
@@ -489,10 +612,12 @@ void CapabilityInfoManager::GetCapabilitiesByDeviceId(const std::string &deviceI
     if (!IsIdLengthValid(deviceId)) {
         return;
     }
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
-    for (auto &capabilityInfo : globalCapInfoMap_) {
-        if (IsCapKeyMatchDeviceId(capabilityInfo.first, deviceId)) {
-            resInfos.emplace_back(capabilityInfo.second);
+    std::shared_lock<std::shared_mutex> lock(capInfoMgrMutex_);
+    const std::string devicePrefix = deviceId + RESOURCE_SEPARATOR;
+    for (auto iter = globalCapInfoMap_.lower_bound(devicePrefix); iter != globalCapInfoMap_.end() &&
+        iter->first.compare(0, devicePrefix.size(), devicePrefix) == 0; ++iter) {
+        if (IsCapKeyMatchDeviceId(iter->first, deviceId)) {
+            resInfos.emplace_back(iter->second);
         }
     }
 }
@@ -502,7 +627,7 @@ bool CapabilityInfoManager::HasCapability(const std::string &deviceId, const std
     if (!IsIdLengthValid(deviceId) || !IsIdLengthValid(dhId)) {
         return false;
     }
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::shared_lock<std::shared_mutex> lock(capInfoMgrMutex_);
     std::string kvKey = GetCapabilityKey(deviceId, dhId);
     if (globalCapInfoMap_.find(kvKey) == globalCapInfoMap_.end()) {
         return false;
@@ -516,13 +641,14 @@ int32_t CapabilityInfoManager::GetCapability(const std::string &deviceId, const
     if (!IsIdLengthValid(deviceId) || !IsIdLengthValid(dhId)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::shared_lock<std::shared_mutex> lock(capInfoMgrMutex_);
     std::string key = GetCapabilityKey(deviceId, dhId);
-    if (globalCapInfoMap_.find(key) == globalCapInfoMap_.end()) {
+    auto iter = globalCapInfoMap_.find(key);
+    if (iter == globalCapInfoMap_.end()) {
         DHLOGE("Can not find capability In globalCapInfoMap_: %{public}s", GetAnonyString(deviceId).c_str());
         return ERR_DH_FWK_RESOURCE_CAPABILITY_MAP_NOT_FOUND;
     }
-    capPtr = globalCapInfoMap_[key];
+    capPtr = iter->second;
     return DH_FWK_SUCCESS;
 }
 
@@ -531,7 +657,7 @@ int32_t CapabilityInfoManager::GetDataByKey(const std::string &key, std::shared_
     if (!IsIdLengthValid(key)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     if (dbAdapterPtr_ == nullptr) {
         DHLOGI("dbAdapterPtr_ is null");
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
@@ -546,12 +672,17 @@ int32_t CapabilityInfoManager::GetDataByKey(const std::string &key, std::shared_
 
 int32_t CapabilityInfoManager::GetDataByDHType(const DHType dhType, CapabilityInfoMap &capabilityMap)
 {
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
-    for (const auto &capInfo : globalCapInfoMap_) {
-        if (capInfo.second->GetDHType() != dhType) {
+    std::shared_lock<std::shared_mutex> lock(capInfoMgrMutex_);
+    auto typeIter = dhTypeIndex_.find(dhType);
+    if (typeIter == dhTypeIndex_.end()) {
+        return DH_FWK_SUCCESS;
+    }
+    for (const auto &key : typeIter->second) {
+        auto iter = globalCapInfoMap_.find(key);
+        if (iter == globalCapInfoMap_.end() || iter->second == nullptr || iter->second->GetDHType() != dhType) {
             continue;
         }
-        capabilityMap[capInfo.first] = capInfo.second;
+        capabilityMap[key] = iter->second;
     }
     return DH_FWK_SUCCESS;
 }
@@ -561,7 +692,14 @@ int32_t CapabilityInfoManager::GetDataByKeyPrefix(const std::string &keyPrefix,
     if (!IsIdLengthValid(keyPrefix)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    {
+        std::shared_lock<std::shared_mutex> readLock(capInfoMgrMutex_);
+        if (GetDataByKeyPrefixInMem(keyPrefix, capabilityMap) > 0) {
+            return DH_FWK_SUCCESS;
+        }
+    }
+    // Records of a device that is not online are only kept in the database.
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     if (dbAdapterPtr_ == nullptr) {
         DHLOGE("dbAdapterPtr is null");
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
@@ -588,8 +726,8 @@ int32_t CapabilityInfoManager::GetDataByKeyPrefix(const std::string &keyPrefix,
 
 void CapabilityInfoManager::DumpCapabilityInfos(std::vector<CapabilityInfo> &capInfos)
 {
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
-    for (auto info : globalCapInfoMap_) {
+    std::shared_lock<std::shared_mutex> lock(capInfoMgrMutex_);
+    for (const auto &info : globalCapInfoMap_) {
         CapabilityInfo capInfo = *(info.second);
         capInfos.emplace_back(capInfo);
     }
@@ -601,7 +739,7 @@ std::vector<DistributedKv::Entry> CapabilityInfoManager::GetEntriesByKeys(const
         return {};
     }
     DHLOGI("call");
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::lock_guard<std::shared_mutex> lock(capInfoMgrMutex_);
     if (dbAdapterPtr_ == nullptr) {
         DHLOGE("dbAdapterPtr_ is null");
         return {};
@@ -614,17 +752,97 @@ std::string CapabilityInfoManager::GetDhSubtype(const std::string &deviceId, con
     if (!IsIdLengthValid(deviceId) || !IsIdLengthValid(dhId)) {
         return "";
     }
-    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    std::shared_lock<std::shared_mutex> lock(capInfoMgrMutex_);
     std::string key = GetCapabilityKey(deviceId, dhId);
-    if (globalCapInfoMap_.find(key) == globalCapInfoMap_.end()) {
+    auto iter = globalCapInfoMap_.find(key);
+    if (iter == globalCapInfoMap_.end()) {
         DHLOGE("Can not find capability In globalCapInfoMap_: %{public}s", GetAnonyString(deviceId).c_str());
         return "";
     }
-    if (globalCapInfoMap_[key] == nullptr) {
+    if (iter->second == nullptr) {
         DHLOGE("Pointer is null");
         return "";
     }
-    return globalCapInfoMap_[key]->GetDHSubtype();
+    return iter->second->GetDHSubtype();
+}
+
+void CapabilityInfoManager::PutCapabilityInMem(const std::string &key, const std::shared_ptr<CapabilityInfo> &capInfo)
+{
+    if (capInfo == nullptr) {
+        return;
+    }
+    EraseCapabilityInMem(key);
+    globalCapInfoMap_[key] = capInfo;
+    dhTypeIndex_[capInfo->GetDHType()].insert(key);
+}
+
+void CapabilityInfoManager::EraseCapabilityInMem(const std::string &key)
+{
+    auto iter = globalCapInfoMap_.find(key);
+    if (iter == globalCapInfoMap_.end()) {
+        return;
+    }
+    if (iter->second != nullptr) {
+        auto typeIter = dhTypeIndex_.find(iter->second->GetDHType());
+        if (typeIter != dhTypeIndex_.end()) {
+            typeIter->second.erase(key);
+            if (typeIter->second.empty()) {
+                dhTypeIndex_.erase(typeIter);
+            }
+        }
+    }
+    globalCapInfoMap_.erase(iter);
+}
+
+void CapabilityInfoManager::EraseDeviceCapabilityInMem(const std::string &deviceId)
+{
+    const std::string devicePrefix = deviceId + RESOURCE_SEPARATOR;
+    std::vector<std::string> keys;
+    for (auto iter = globalCapInfoMap_.lower_bound(devicePrefix); iter != globalCapInfoMap_.end() &&
+        iter->first.compare(0, devicePrefix.size(), devicePrefix) == 0; ++iter) {
+        if (IsCapKeyMatchDeviceId(iter->first, deviceId)) {
+            keys.push_back(iter->first);
+        }
+    }
+    for (const auto &key : keys) {
+        DHLOGI("Clear globalCapInfoMap_ iter: %{public}s", GetAnonyString(key).c_str());
+        EraseCapabilityInMem(key);
+    }
+}
+
+size_t CapabilityInfoManager::GetDataByKeyPrefixInMem(const std::string &keyPrefix,
+    CapabilityInfoMap &capabilityMap) const
+{
+    size_t count = 0;
+    for (auto iter = globalCapInfoMap_.lower_bound(keyPrefix); iter != globalCapInfoMap_.end() &&
+        iter->first.compare(0, keyPrefix.size(), keyPrefix) == 0; ++iter) {
+        if (iter->second == nullptr) {
+            continue;
+        }
+        capabilityMap[iter->first] = iter->second;
+        count++;
+    }
+    return count;
+}
+
+void CapabilityInfoManager::RecordLastSeen(const std::string &deviceId)
+{
+    if (lastSeenDbPtr_ == nullptr) {
+        return;
+    }
+    if (lastSeenDbPtr_->PutData(deviceId, std::to_string(GetCurrentTime())) != DH_FWK_SUCCESS) {
+        DHLOGE("Record last seen failed, deviceId: %{public}s", GetAnonyString(deviceId).c_str());
+    }
+}
+
+void CapabilityInfoManager::ScheduleEviction(int64_t delayMs)
+{
+    if (eventHandler_ == nullptr) {
+        return;
+    }
+    eventHandler_->RemoveEvent(EVENT_CAPABILITY_INFO_EVICT);
+    AppExecFwk::InnerEvent::Pointer msgEvent = AppExecFwk::InnerEvent::Get(EVENT_CAPABILITY_INFO_EVICT);
+    eventHandler_->SendEvent(msgEvent, delayMs, AppExecFwk::EventQueue::Priority::LOW);
 }
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -25,6 +25,13 @@ namespace DistributedHardware {
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "CapabilityUtils"
 
+namespace {
+constexpr size_t CAP_BINARY_HEADER_LEN = 2;
+constexpr size_t CAP_BINARY_UINT32_LEN = 4;
+constexpr uint32_t BITS_PER_BYTE = 8;
+constexpr uint32_t BYTE_MASK = 0xFF;
+}
+
 std::string GetCapabilityKey(const std::string &deviceId, const std::string &dhId)
 {
     return deviceId + RESOURCE_SEPARATOR + dhId;
@@ -42,5 +49,69 @@ bool IsCapKeyMatchDeviceId(const std::string &key, const std::string &deviceId)
     std::string keyDevId = key.substr(0, separatorPos);
     return keyDevId.compare(deviceId) == 0;
 }
+
+bool IsCapBinaryEncoded(const std::string &value)
+{
+    return !value.empty() && value[0] == CAP_BINARY_MAGIC;
+}
+
+void AppendCapBinaryHeader(std::string &out)
+{
+    out.push_back(CAP_BINARY_MAGIC);
+    out.push_back(static_cast<char>(CAP_CODEC_BINARY_V1));
+}
+
+void AppendCapBinaryUint32(std::string &out, uint32_t value)
+{
+    // Little endian regardless of host, the record is synced to other devices.
+    for (size_t i = 0; i < CAP_BINARY_UINT32_LEN; i++) {
+        out.push_back(static_cast<char>((value >> (i * BITS_PER_BYTE)) & BYTE_MASK));
+    }
+}
+
+void AppendCapBinaryString(std::string &out, const std::string &value)
+{
+    AppendCapBinaryUint32(out, static_cast<uint32_t>(value.size()));
+    out.append(value);
+}
+
+bool ReadCapBinaryHeader(const std::string &in, size_t &pos)
+{
+    if (in.size() < CAP_BINARY_HEADER_LEN || in[0] != CAP_BINARY_MAGIC) {
+        DHLOGE("capability binary header is invalid");
+        return false;
+    }
+    uint32_t version = static_cast<uint8_t>(in[1]);
+    if (version > CAP_CODEC_LOCAL_VERSION) {
+        DHLOGE("capability binary version %{public}u is not supported", version);
+        return false;
+    }
+    pos = CAP_BINARY_HEADER_LEN;
+    return true;
+}
+
+bool ReadCapBinaryUint32(const std::string &in, size_t &pos, uint32_t &value)
+{
+    if (pos > in.size() || in.size() - pos < CAP_BINARY_UINT32_LEN) {
+        return false;
+    }
+    value = 0;
+    for (size_t i = 0; i < CAP_BINARY_UINT32_LEN; i++) {
+        value |= static_cast<uint32_t>(static_cast<uint8_t>(in[pos + i])) << (i * BITS_PER_BYTE);
+    }
+    pos += CAP_BINARY_UINT32_LEN;
+    return true;
+}
+
+bool ReadCapBinaryString(const std::string &in, size_t &pos, std::string &value)
+{
+    uint32_t len = 0;
+    if (!ReadCapBinaryUint32(in, pos, len) || in.size() - pos < len) {
+        return false;
+    }
+    value.assign(in, pos, len);
+    pos += len;
+    return true;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
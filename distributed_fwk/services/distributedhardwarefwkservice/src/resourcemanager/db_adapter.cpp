@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -23,6 +23,7 @@
 #include "capability_utils.h"
 #include "constants.h"
 #include "dh_context.h"
+#include "dh_perf_stats.h"
 #include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
 #include "distributed_hardware_log.h"
@@ -40,6 +41,7 @@ namespace {
     constexpr int32_t INIT_RETRY_SLEEP_INTERVAL = 200 * 1000; // 200ms
     constexpr int32_t DIED_CHECK_MAX_TIMES = 300;
     constexpr int32_t DIED_CHECK_INTERVAL = 100 * 1000; // 100ms
+    constexpr int64_t SYNC_COALESCE_INTERVAL_MS = 1000;
     const std::string DATABASE_DIR = "/data/service/el1/public/database/";
     constexpr const char *GLOBAL_META_INFO_KEY = "global_meta_info";
     constexpr const char *GLOBAL_VERSION_INFO_KEY = "global_version_info";
@@ -204,7 +206,7 @@ std::string DBAdapter::GetNetworkIdByKey(const std::string &key)
         return "";
     }
 
-    if (deviceId == DHContext::GetInstance().GetDeviceInfo().deviceId) {
+    if (deviceId == DHContext::GetInstance().GetDeviceInfoSnapshot()->deviceId) {
         DHLOGW("Query local db info, no need sync");
         return "";
     }
@@ -232,10 +234,14 @@ void DBAdapter::SyncByNotFound(const std::string &key)
         DHLOGW("The networkId emtpy.");
         return;
     }
+    if (IsSyncCoalesced(networkId)) {
+        return;
+    }
     DHLOGI("Try sync data by key: %{public}s, storeId: %{public}s", GetAnonyString(key).c_str(),
         storeId_.storeId.c_str());
     std::vector<std::string> networkIdVec;
     networkIdVec.push_back(networkId);
+    PerfCostScope costScope(PerfCategory::DB_SYNC, storeId_.storeId);
     kvStoragePtr_->Sync(networkIdVec, DistributedKv::SyncMode::PUSH_PULL);
     return;
 }
@@ -326,6 +332,7 @@ int32_t DBAdapter::PutData(const std::string &key, const std::string &value)
     }
     DistributedKv::Key kvKey(key);
     DistributedKv::Value kvValue(value);
+    PerfCostScope costScope(PerfCategory::DB_PUT, storeId_.storeId);
     DistributedKv::Status status = kvStoragePtr_->Put(kvKey, kvValue);
     if (status == DistributedKv::Status::IPC_ERROR) {
         DHLOGE("Put kv to db failed, ret: %{public}d", status);
@@ -355,6 +362,7 @@ int32_t DBAdapter::PutDataBatch(const std::vector<std::string> &keys, const std:
         entry.value = values[i];
         entries.push_back(entry);
     }
+    PerfCostScope costScope(PerfCategory::DB_PUT, storeId_.storeId);
     DistributedKv::Status status = kvStoragePtr_->PutBatch(entries);
     if (status != DistributedKv::Status::SUCCESS) {
         DHLOGE("Put kv batch to db failed, ret: %{public}d", status);
@@ -554,6 +562,46 @@ std::vector<DistributedKv::Entry> DBAdapter::GetEntriesByKeys(const std::vector<
     return entries;
 }
 
+void DBAdapter::GetValuesByKeys(const std::vector<std::string> &keys,
+    std::unordered_map<std::string, std::string> &values)
+{
+    if (!IsArrayLengthValid(keys)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(dbAdapterMutex_);
+    if (kvStoragePtr_ == nullptr) {
+        DHLOGE("kvStoragePtr_ is nullptr!");
+        return;
+    }
+    for (const auto &key : keys) {
+        DistributedKv::Key kvKey(key);
+        DistributedKv::Value kvValue;
+        if (kvStoragePtr_->Get(kvKey, kvValue) == DistributedKv::Status::SUCCESS) {
+            values[key] = kvValue.ToString();
+        }
+    }
+}
+
+int32_t DBAdapter::GetEntriesByKeyPrefix(const std::string &keyPrefix, std::vector<DistributedKv::Entry> &entries)
+{
+    std::lock_guard<std::mutex> lock(dbAdapterMutex_);
+    if (kvStoragePtr_ == nullptr) {
+        DHLOGE("kvStoragePtr_ is nullptr!");
+        return ERR_DH_FWK_RESOURCE_KV_STORAGE_POINTER_NULL;
+    }
+    DistributedKv::Key kvKeyPrefix(keyPrefix);
+    if (kvStoragePtr_->GetEntries(kvKeyPrefix, entries) != DistributedKv::Status::SUCCESS) {
+        DHLOGE("Query entries by keyPrefix failed, prefix: %{public}s", GetAnonyString(keyPrefix).c_str());
+        return ERR_DH_FWK_RESOURCE_KV_STORAGE_OPERATION_FAIL;
+    }
+    if (entries.size() > MAX_DB_RECORD_SIZE) {
+        DHLOGE("Entries size: %{public}zu is too large.", entries.size());
+        entries.clear();
+        return ERR_DH_FWK_RESOURCE_RES_DB_DATA_INVALID;
+    }
+    return DH_FWK_SUCCESS;
+}
+
 bool DBAdapter::SyncDataByNetworkId(const std::string &networkId)
 {
     DHLOGI("Try initiative sync data by networId: %{public}s", GetAnonyString(networkId).c_str());
@@ -562,16 +610,40 @@ bool DBAdapter::SyncDataByNetworkId(const std::string &networkId)
         DHLOGE("kvStoragePtr_ is nullptr!");
         return false;
     }
+    if (IsSyncCoalesced(networkId)) {
+        return true;
+    }
     std::vector<std::string> networkIdVec;
     networkIdVec.push_back(networkId);
+    PerfCostScope costScope(PerfCategory::DB_SYNC, storeId_.storeId);
     DistributedKv::Status status = kvStoragePtr_->Sync(networkIdVec, DistributedKv::SyncMode::PUSH_PULL);
     if (status != DistributedKv::Status::SUCCESS) {
         DHLOGE("initiative sync data failed");
+        lastSyncTimes_.erase(networkId);
         return false;
     }
     return true;
 }
 
+bool DBAdapter::IsSyncCoalesced(const std::string &networkId)
+{
+    int64_t now = GetCurrentTime();
+    for (auto iter = lastSyncTimes_.begin(); iter != lastSyncTimes_.end();) {
+        if (now - iter->second >= SYNC_COALESCE_INTERVAL_MS) {
+            iter = lastSyncTimes_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    if (lastSyncTimes_.find(networkId) != lastSyncTimes_.end()) {
+        DHLOGI("A sync to networkId: %{public}s is in flight, coalesce this one",
+            GetAnonyString(networkId).c_str());
+        return true;
+    }
+    lastSyncTimes_[networkId] = now;
+    return false;
+}
+
 bool DBAdapter::ClearDataByPrefix(const std::string &prefix)
 {
     DHLOGI("Clear data by prefix: %{public}s.", GetAnonyString(prefix).c_str());
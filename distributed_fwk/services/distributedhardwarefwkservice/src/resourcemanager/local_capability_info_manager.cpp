@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -254,10 +254,6 @@ int32_t LocalCapabilityInfoManager::GetDataByKeyPrefix(const std::string &keyPre
             DHLOGE("Get capability ptr by value failed");
             continue;
         }
-        if (capabilityInfo->FromJsonString(data) != DH_FWK_SUCCESS) {
-            DHLOGE("Wrong data: %{public}s", GetAnonyString(data).c_str());
-            continue;
-        }
         capabilityMap[capabilityInfo->GetKey()] = capabilityInfo;
     }
     return DH_FWK_SUCCESS;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -20,6 +20,7 @@
 #include "cJSON.h"
 
 #include "anonymous_string.h"
+#include "capability_utils.h"
 #include "constants.h"
 #include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
@@ -31,6 +32,33 @@ namespace DistributedHardware {
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "MetaCapabilityInfo"
 
+namespace {
+void AppendBinaryStringList(std::string &out, const std::vector<std::string> &values)
+{
+    AppendCapBinaryUint32(out, static_cast<uint32_t>(values.size()));
+    for (const auto &value : values) {
+        AppendCapBinaryString(out, value);
+    }
+}
+
+bool ReadBinaryStringList(const std::string &in, size_t &pos, std::vector<std::string> &values)
+{
+    uint32_t size = 0;
+    if (!ReadCapBinaryUint32(in, pos, size) || size > MAX_DB_RECORD_SIZE) {
+        return false;
+    }
+    values.clear();
+    for (uint32_t i = 0; i < size; i++) {
+        std::string value;
+        if (!ReadCapBinaryString(in, pos, value)) {
+            return false;
+        }
+        values.push_back(value);
+    }
+    return true;
+}
+}
+
 std::string MetaCapabilityInfo::GetUdidHash() const
 {
     return udidHash_;
@@ -101,6 +129,48 @@ std::string MetaCapabilityInfo::ToJsonString()
     return jsonString;
 }
 
+int32_t MetaCapabilityInfo::FromBinaryString(const std::string &binStr)
+{
+    if (!IsMessageLengthValid(binStr)) {
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    size_t pos = 0;
+    uint32_t compDhType = 0;
+    uint32_t haveFeature = 0;
+    if (!ReadCapBinaryHeader(binStr, pos) || !ReadBinaryFields(binStr, pos) ||
+        !ReadCapBinaryString(binStr, pos, udidHash_) || !ReadCapBinaryString(binStr, pos, compVersion_.name) ||
+        !ReadCapBinaryUint32(binStr, pos, compDhType) ||
+        !ReadCapBinaryString(binStr, pos, compVersion_.handlerVersion) ||
+        !ReadCapBinaryString(binStr, pos, compVersion_.sourceVersion) ||
+        !ReadCapBinaryString(binStr, pos, compVersion_.sinkVersion) ||
+        !ReadCapBinaryUint32(binStr, pos, haveFeature) ||
+        !ReadBinaryStringList(binStr, pos, compVersion_.sourceFeatureFilters) ||
+        !ReadBinaryStringList(binStr, pos, compVersion_.sinkSupportedFeatures)) {
+        DHLOGE("binStr parse failed");
+        return ERR_DH_FWK_RESOURCE_RES_DB_DATA_INVALID;
+    }
+    compVersion_.dhType = static_cast<DHType>(compDhType);
+    compVersion_.haveFeature = haveFeature != 0;
+    return DH_FWK_SUCCESS;
+}
+
+std::string MetaCapabilityInfo::ToBinaryString()
+{
+    std::string binStr;
+    AppendCapBinaryHeader(binStr);
+    AppendBinaryFields(binStr);
+    AppendCapBinaryString(binStr, udidHash_);
+    AppendCapBinaryString(binStr, compVersion_.name);
+    AppendCapBinaryUint32(binStr, static_cast<uint32_t>(compVersion_.dhType));
+    AppendCapBinaryString(binStr, compVersion_.handlerVersion);
+    AppendCapBinaryString(binStr, compVersion_.sourceVersion);
+    AppendCapBinaryString(binStr, compVersion_.sinkVersion);
+    AppendCapBinaryUint32(binStr, compVersion_.haveFeature ? 1 : 0);
+    AppendBinaryStringList(binStr, compVersion_.sourceFeatureFilters);
+    AppendBinaryStringList(binStr, compVersion_.sinkSupportedFeatures);
+    return binStr;
+}
+
 bool MetaCapabilityInfo::Compare(const MetaCapabilityInfo& metaCapInfo)
 {
     if (strcmp(this->GetDeviceId().c_str(), metaCapInfo.GetDeviceId().c_str()) != 0) {
@@ -17,6 +17,7 @@
 
 #include "anonymous_string.h"
 #include "capability_utils.h"
+#include "component_manager.h"
 #include "constants.h"
 #include "dh_context.h"
 #include "dh_utils_tool.h"
@@ -26,6 +27,7 @@
 #include "task_executor.h"
 #include "task_factory.h"
 #include "task_board.h"
+#include "version_info_manager.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -123,28 +125,38 @@ int32_t MetaInfoManager::AddMetaCapInfos(const std::vector<std::shared_ptr<MetaC
         DHLOGE("MetaCapInfos is empty or too large, metaCapInfos size: %{public}zu", metaCapInfos.size());
         return ERR_DH_FWK_RESOURCE_RES_DB_DATA_INVALID;
     }
+    uint32_t codecVersion = VersionInfoManager::GetInstance()->GetAgreedCapCodecVersion();
     std::lock_guard<std::mutex> lock(metaInfoMgrMutex_);
     if (dbAdapterPtr_ == nullptr) {
         DHLOGE("dbAdapterPtr_ is null");
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
     }
     std::vector<std::string> keys;
+    for (const auto &metaCapInfo : metaCapInfos) {
+        if (metaCapInfo != nullptr) {
+            keys.push_back(metaCapInfo->GetKey());
+        }
+    }
+    std::unordered_map<std::string, std::string> storedValues;
+    dbAdapterPtr_->GetValuesByKeys(keys, storedValues);
+    keys.clear();
     std::vector<std::string> values;
     std::string key;
-    std::string data;
     for (auto &metaCapInfo : metaCapInfos) {
         if (metaCapInfo == nullptr) {
             continue;
         }
         key = metaCapInfo->GetKey();
         globalMetaInfoMap_[key] = metaCapInfo;
-        if (dbAdapterPtr_->GetDataByKey(key, data) == DH_FWK_SUCCESS && data == metaCapInfo->ToJsonString()) {
+        std::string value = EncodeCapability(metaCapInfo, codecVersion);
+        auto storedIter = storedValues.find(key);
+        if (storedIter != storedValues.end() && storedIter->second == value) {
             DHLOGI("this record is exist, Key: %{public}s", metaCapInfo->GetAnonymousKey().c_str());
             continue;
         }
         DHLOGI("AddMetaCapability, Key: %{public}s", metaCapInfo->GetAnonymousKey().c_str());
         keys.push_back(key);
-        values.push_back(metaCapInfo->ToJsonString());
+        values.push_back(value);
     }
     if (keys.empty() || values.empty()) {
         DHLOGD("Records are empty, No need add data to db!");
@@ -157,6 +169,31 @@ int32_t MetaInfoManager::AddMetaCapInfos(const std::vector<std::shared_ptr<MetaC
     return DH_FWK_SUCCESS;
 }
 
+int32_t MetaInfoManager::RemoveMetaCapInfosByKeys(const std::vector<std::string> &keys)
+{
+    if (keys.empty() || keys.size() > MAX_DB_RECORD_SIZE) {
+        DHLOGE("Keys is empty or too large, keys size: %{public}zu", keys.size());
+        return ERR_DH_FWK_RESOURCE_RES_DB_DATA_INVALID;
+    }
+    std::lock_guard<std::mutex> lock(metaInfoMgrMutex_);
+    if (dbAdapterPtr_ == nullptr) {
+        DHLOGE("dbAdapterPtr_ is null");
+        return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
+    }
+    int32_t result = DH_FWK_SUCCESS;
+    for (auto const &key : keys) {
+        if (globalMetaInfoMap_.erase(key) == 0) {
+            continue;
+        }
+        DHLOGI("RemoveMetaCapability, Key: %{public}s", GetAnonyString(key).c_str());
+        if (dbAdapterPtr_->RemoveDataByKey(key) != DH_FWK_SUCCESS) {
+            DHLOGE("Fail to remove data from kv, Key: %{public}s", GetAnonyString(key).c_str());
+            result = ERR_DH_FWK_RESOURCE_DB_ADAPTER_OPERATION_FAIL;
+        }
+    }
+    return result;
+}
+
 int32_t MetaInfoManager::SyncMetaInfoFromDB(const std::string &udidHash)
 {
     if (!IsHashSizeValid(udidHash)) {
@@ -199,6 +236,7 @@ int32_t MetaInfoManager::SyncRemoteMetaInfos()
     }
     std::vector<std::string> udidHashVec;
     DHContext::GetInstance().GetOnlineDeviceUdidHash(udidHashVec);
+    const std::string localUdidHash = DHContext::GetInstance().GetDeviceInfoSnapshot()->udidHash;
     for (const auto &udidHash : udidHashVec) {
         std::vector<std::string> dataVector;
         if (dbAdapterPtr_->GetDataByKeyPrefix(udidHash, dataVector) != DH_FWK_SUCCESS) {
@@ -216,7 +254,6 @@ int32_t MetaInfoManager::SyncRemoteMetaInfos()
                 continue;
             }
             const std::string udidHash = metaCapInfo->GetUdidHash();
-            const std::string localUdidHash = DHContext::GetInstance().GetDeviceInfo().udidHash;
             if (udidHash.compare(localUdidHash) == 0) {
                 DHLOGE("device MetaInfo not need sync from db");
                 continue;
@@ -293,10 +330,7 @@ int32_t MetaInfoManager::GetMetaCapByValue(const std::string &value, std::shared
     if (!IsMessageLengthValid(value)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
-    if (metaCapPtr == nullptr) {
-        metaCapPtr = std::make_shared<MetaCapabilityInfo>();
-    }
-    return metaCapPtr->FromJsonString(value);
+    return GetCapabilityByValue<MetaCapabilityInfo>(value, metaCapPtr);
 }
 
 int32_t MetaInfoManager::GetMetaDataByDHType(const DHType dhType, MetaCapInfoMap &metaInfoMap)
@@ -437,6 +471,7 @@ void MetaInfoManager::HandleMetaCapabilityAddChange(const std::vector<Distribute
         auto task = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, nullptr);
         TaskExecutor::GetInstance().PushTask(task);
     }
+    ComponentManager::GetInstance().NotifyCapabilityAvailable();
 }
 
 void MetaInfoManager::HandleMetaCapabilityUpdateChange(const std::vector<DistributedKv::Entry> &updateRecords)
@@ -477,6 +512,7 @@ void MetaInfoManager::HandleMetaCapabilityUpdateChange(const std::vector<Distrib
         auto task = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, nullptr);
         TaskExecutor::GetInstance().PushTask(task);
     }
+    ComponentManager::GetInstance().NotifyCapabilityAvailable();
 }
 
 void MetaInfoManager::HandleMetaCapabilityDeleteChange(const std::vector<DistributedKv::Entry> &deleteRecords)
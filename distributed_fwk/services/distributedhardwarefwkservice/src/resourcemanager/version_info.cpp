@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -106,6 +106,7 @@ void ToJson(cJSON *jsonObject, const VersionInfo &versionInfo)
     }
     cJSON_AddStringToObject(jsonObject, DEV_ID, versionInfo.deviceId.c_str());
     cJSON_AddStringToObject(jsonObject, DH_VER, versionInfo.dhVersion.c_str());
+    cJSON_AddNumberToObject(jsonObject, CAP_CODEC_VER, versionInfo.capCodecVersion);
 
     cJSON *compVers = cJSON_CreateArray();
     if (compVers == NULL) {
@@ -199,6 +200,11 @@ void FromJson(const cJSON *jsonObject, VersionInfo &versionInfo)
         versionInfo.dhVersion = dhVerJson->valuestring;
     }
 
+    cJSON *capCodecVerJson = cJSON_GetObjectItem(jsonObject, CAP_CODEC_VER);
+    if (IsUInt32(capCodecVerJson)) {
+        versionInfo.capCodecVersion = static_cast<uint32_t>(capCodecVerJson->valueint);
+    }
+
     const cJSON *compVer = cJSON_GetObjectItem(jsonObject, COMP_VER);
     if (IsArray(compVer)) {
         cJSON *compVerObj = nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,7 +15,10 @@
 
 #include "version_info_manager.h"
 
+#include <algorithm>
+
 #include "anonymous_string.h"
+#include "component_manager.h"
 #include "constants.h"
 #include "dh_context.h"
 #include "dh_utils_tool.h"
@@ -109,6 +112,7 @@ int32_t VersionInfoManager::UnInit()
     }
     dbAdapterPtr_->UnInit();
     dbAdapterPtr_.reset();
+    capCodecDirty_.store(true);
     return DH_FWK_SUCCESS;
 }
 
@@ -134,6 +138,7 @@ int32_t VersionInfoManager::AddVersion(const VersionInfo &versionInfo)
         DHLOGE("Fail to storage to kv");
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_OPERATION_FAIL;
     }
+    capCodecDirty_.store(true);
     return DH_FWK_SUCCESS;
 }
 
@@ -185,6 +190,7 @@ int32_t VersionInfoManager::RemoveVersionInfoByDeviceId(const std::string &devic
         DHLOGE("Remove version info failed, key: %{public}s", GetAnonyString(deviceId).c_str());
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_OPERATION_FAIL;
     }
+    capCodecDirty_.store(true);
 
     std::string uuid = DHContext::GetInstance().GetUUIDByDeviceId(deviceId);
     if (uuid.empty()) {
@@ -234,6 +240,7 @@ int32_t VersionInfoManager::SyncRemoteVersionInfos()
     }
     std::vector<std::string> deviceIdVec;
     DHContext::GetInstance().GetOnlineDeviceDeviceId(deviceIdVec);
+    const std::string localDeviceId = DHContext::GetInstance().GetDeviceInfoSnapshot()->deviceId;
     for (const auto &deviceId : deviceIdVec) {
         std::vector<std::string> dataVector;
         if (dbAdapterPtr_->GetDataByKeyPrefix(deviceId, dataVector) != DH_FWK_SUCCESS) {
@@ -250,7 +257,6 @@ int32_t VersionInfoManager::SyncRemoteVersionInfos()
                 continue;
             }
             const std::string deviceId = versionInfo.deviceId;
-            const std::string localDeviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
             if (deviceId.compare(localDeviceId) == 0) {
                 DHLOGE("Local device info not need sync from db");
                 continue;
@@ -261,9 +267,35 @@ int32_t VersionInfoManager::SyncRemoteVersionInfos()
     return DH_FWK_SUCCESS;
 }
 
+uint32_t VersionInfoManager::GetAgreedCapCodecVersion()
+{
+    if (!capCodecDirty_.exchange(false)) {
+        return agreedCapCodecVersion_.load();
+    }
+    std::lock_guard<std::mutex> lock(verInfoMgrMutex_);
+    uint32_t agreed = CAP_CODEC_JSON;
+    std::vector<std::string> dataVector;
+    if (dbAdapterPtr_ != nullptr && dbAdapterPtr_->GetDataByKeyPrefix("", dataVector) == DH_FWK_SUCCESS) {
+        agreed = CAP_CODEC_LOCAL_VERSION;
+        for (const auto &data : dataVector) {
+            VersionInfo versionInfo;
+            if (versionInfo.FromJsonString(data) != DH_FWK_SUCCESS) {
+                agreed = CAP_CODEC_JSON;
+                break;
+            }
+            agreed = std::min(agreed, versionInfo.capCodecVersion);
+        }
+    }
+    if (agreed != agreedCapCodecVersion_.exchange(agreed)) {
+        DHLOGI("agreed capability codec version: %{public}u", agreed);
+    }
+    return agreed;
+}
+
 void VersionInfoManager::OnChange(const DistributedKv::ChangeNotification &changeNotification)
 {
     DHLOGI("DB data OnChange");
+    capCodecDirty_.store(true);
     if (!changeNotification.GetInsertEntries().empty() &&
         changeNotification.GetInsertEntries().size() <= MAX_DB_RECORD_SIZE) {
         DHLOGI("Handle version data add change");
@@ -292,6 +324,7 @@ void VersionInfoManager::HandleVersionAddChange(const std::vector<DistributedKv:
         }
         UpdateVersionCache(versionInfo);
     }
+    ComponentManager::GetInstance().NotifyCapabilityAvailable();
 }
 
 void VersionInfoManager::HandleVersionUpdateChange(const std::vector<DistributedKv::Entry> &updateRecords)
@@ -305,6 +338,7 @@ void VersionInfoManager::HandleVersionUpdateChange(const std::vector<Distributed
         }
         UpdateVersionCache(versionInfo);
     }
+    ComponentManager::GetInstance().NotifyCapabilityAvailable();
 }
 
 void VersionInfoManager::HandleVersionDeleteChange(const std::vector<DistributedKv::Entry> &deleteRecords)
@@ -17,8 +17,6 @@
 
 #include <pthread.h>
 
-#include "ffrt.h"
-
 #include "anonymous_string.h"
 #include "capability_utils.h"
 #include "component_manager.h"
@@ -55,7 +53,7 @@ DisableTask::~DisableTask()
 
 void DisableTask::DoTask()
 {
-    ffrt::submit([this]() { this->DoTaskInner(); });
+    DoTaskInner();
 }
 
 void DisableTask::DoTaskInner()
@@ -17,8 +17,6 @@
 
 #include <pthread.h>
 
-#include "ffrt.h"
-
 #include "anonymous_string.h"
 #include "capability_utils.h"
 #include "component_manager.h"
@@ -53,7 +51,8 @@ EnableTask::~EnableTask()
 
 void EnableTask::DoTask()
 {
-    ffrt::submit([this]() { this->DoTaskInner(); });
+    // Runs on the lane of its device and type in TaskExecutor, the next task there waits for it.
+    DoTaskInner();
 }
 
 void EnableTask::DoTaskInner()
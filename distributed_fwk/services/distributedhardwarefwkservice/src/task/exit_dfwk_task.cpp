@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,7 +16,6 @@
 #include "exit_dfwk_task.h"
 
 #include <pthread.h>
-#include <thread>
 
 #include "ffrt.h"
 
@@ -33,7 +32,7 @@ namespace DistributedHardware {
 #define DH_LOG_TAG "ExitDfwkTask"
 
 namespace {
-constexpr int32_t WAIT_TIME_SEC = 5;
+constexpr int32_t WAIT_TASK_FINISH_TIMEOUT_MS = 5000;
 }
 
 ExitDfwkTask::ExitDfwkTask(const std::string &networkId, const std::string &uuid, const std::string &udid,
@@ -56,7 +55,8 @@ void ExitDfwkTask::DoTask()
 void ExitDfwkTask::DoTaskInner()
 {
     DHLOGI("do exit dfwk task bebin!");
-    std::this_thread::sleep_for(std::chrono::seconds(WAIT_TIME_SEC));
+    TaskBoard::GetInstance().WaitForOtherTaskFinish(GetId(), WAIT_TASK_FINISH_TIMEOUT_MS);
+    TaskBoard::GetInstance().RemoveTask(GetId());
     DistributedHardwareManagerFactory::GetInstance().CheckExitSAOrNot();
     DHLOGI("do exit dfwk task end!");
 }
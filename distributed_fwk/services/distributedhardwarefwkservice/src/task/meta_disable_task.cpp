@@ -17,8 +17,6 @@
 
 #include <pthread.h>
 
-#include "ffrt.h"
-
 #include "anonymous_string.h"
 #include "component_manager.h"
 #include "component_loader.h"
@@ -54,7 +52,7 @@ MetaDisableTask::~MetaDisableTask()
 
 void MetaDisableTask::DoTask()
 {
-    ffrt::submit([this]() { this->DoTaskInner(); });
+    DoTaskInner();
 }
 
 void MetaDisableTask::DoTaskInner()
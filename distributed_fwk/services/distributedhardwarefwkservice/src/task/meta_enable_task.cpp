@@ -17,8 +17,6 @@
 
 #include <pthread.h>
 
-#include "ffrt.h"
-
 #include "anonymous_string.h"
 #include "component_manager.h"
 #include "component_loader.h"
@@ -52,7 +50,7 @@ MetaEnableTask::~MetaEnableTask()
 
 void MetaEnableTask::DoTask()
 {
-    ffrt::submit([this]() { this->DoTaskInner(); });
+    DoTaskInner();
 }
 
 void MetaEnableTask::DoTaskInner()
@@ -38,8 +38,7 @@ namespace DistributedHardware {
 namespace {
     constexpr uint16_t PHONE_TYPE = 14;
     constexpr const char *OFFLINE_TASK_INNER = "OffLineTask";
-    constexpr int32_t USLEEP_TIME = 1000 * 100;
-    constexpr int32_t RETRY_MAX_TIMES = 30;
+    constexpr int32_t DISABLE_TASK_TIMEOUT_MS = 3000;
 }
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "OffLineTask"
@@ -105,16 +104,11 @@ void OffLineTask::DoTaskInner()
     this->SetTaskState(TaskState::SUCCESS);
     DHLOGI("Finish OffLine task, remove it, id: %{public}s", GetId().c_str());
     TaskBoard::GetInstance().RemoveTask(this->GetId());
-    int32_t retryCount = 0;
     if (DHContext::GetInstance().GetRealTimeOnlineDeviceCount() == 0 &&
         DHContext::GetInstance().GetIsomerismConnectCount() == 0) {
-        while (!TaskBoard::GetInstance().IsAllDisableTaskFinish() && retryCount < RETRY_MAX_TIMES) {
-            retryCount++;
-            usleep(USLEEP_TIME);
-            DHLOGI("judge disable task is finished, retryCount = %{public}d", retryCount);
-        }
-        DHLOGI("all devices are offline and all disable tasks are finished, start to free the resource");
-        DistributedHardwareManagerFactory::GetInstance().UnInit();
+        TaskBoard::GetInstance().WaitForAllDisableTaskFinish(DISABLE_TASK_TIMEOUT_MS);
+        DHLOGI("all devices are offline and all disable tasks are finished, schedule to free the resource");
+        DistributedHardwareManagerFactory::GetInstance().ScheduleIdleUnInit();
     }
 }
 
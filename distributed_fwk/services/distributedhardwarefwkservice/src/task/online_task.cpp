@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,12 +15,16 @@
 
 #include "online_task.h"
 
+#include <set>
+
 #include "anonymous_string.h"
 #include "capability_info_manager.h"
 #include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
 #include "distributed_hardware_log.h"
 #include "dh_context.h"
+#include "ffrt.h"
+#include "hdf_operate.h"
 #include "local_capability_info_manager.h"
 #include "meta_info_manager.h"
 #include "task_board.h"
@@ -96,7 +100,13 @@ void OnLineTask::DoSyncInfo()
         GetAnonyString(deviceId).c_str(), GetAnonyString(GetUUID()).c_str(), GetAnonyString(GetUDID()).c_str(),
         GetAnonyString(udidHash).c_str());
 
-    auto ret = LocalCapabilityInfoManager::GetInstance()->SyncDeviceInfoFromDB(deviceId);
+    auto ret = CapabilityInfoManager::GetInstance()->LoadDeviceCapabilities(deviceId);
+    if (ret != DH_FWK_SUCCESS) {
+        DHLOGW("LoadDeviceCapabilities failed, deviceId = %{public}s, errCode = %{public}d",
+            GetAnonyString(deviceId).c_str(), ret);
+    }
+
+    ret = LocalCapabilityInfoManager::GetInstance()->SyncDeviceInfoFromDB(deviceId);
     if (ret != DH_FWK_SUCCESS) {
         DHLOGE("SyncLocalCapabilityInfoFromDB failed, deviceId = %{public}s, errCode = %{public}d",
             GetAnonyString(deviceId).c_str(), ret);
@@ -151,6 +161,7 @@ void OnLineTask::CreateEnableTask()
         return;
     }
 
+    PreloadDistributedHDF(devDhInfos);
     for (const auto &info : devDhInfos) {
         TaskParam taskParam = {
             .networkId = GetNetworkId(),
@@ -164,6 +175,20 @@ void OnLineTask::CreateEnableTask()
     }
 }
 
+void OnLineTask::PreloadDistributedHDF(const std::vector<std::pair<std::string, DHType>> &devDhInfos)
+{
+    std::set<DHType> hdfTypes;
+    for (const auto &info : devDhInfos) {
+        if (info.second == DHType::AUDIO || info.second == DHType::CAMERA) {
+            hdfTypes.insert(info.second);
+        }
+    }
+    // Start the hdf host while the enable tasks are still queued, the enable then finds it already loaded.
+    for (const auto dhType : hdfTypes) {
+        ffrt::submit([dhType]() { HdfOperateManager::GetInstance().PreloadDistributedHDF(dhType); });
+    }
+}
+
 void OnLineTask::CreateEnableSinkTask()
 {
     DeviceInfo localDeviceInfo = GetLocalDeviceInfo();
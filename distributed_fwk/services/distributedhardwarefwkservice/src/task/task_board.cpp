@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -43,6 +43,33 @@ int32_t TaskBoard::WaitForALLTaskFinish()
     return DH_FWK_SUCCESS;
 }
 
+int32_t TaskBoard::WaitForAllDisableTaskFinish(int32_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(tasksMtx_);
+    auto status = conVar_.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+        [this]() { return GetDisableTaskCountInner() == 0; });
+    if (!status) {
+        DHLOGE("wait for all disable task finish timeout, count: %{public}d", GetDisableTaskCountInner());
+        return ERR_DH_FWK_TASK_TIMEOUT;
+    }
+    DHLOGI("all disable task finished");
+    return DH_FWK_SUCCESS;
+}
+
+int32_t TaskBoard::WaitForOtherTaskFinish(const std::string &taskId, int32_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(tasksMtx_);
+    auto status = conVar_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this, &taskId]() {
+        return tasks_.empty() || (tasks_.size() == 1 && tasks_.find(taskId) != tasks_.end());
+    });
+    if (!status) {
+        DHLOGE("wait for other task finish timeout, task size: %{public}zu", tasks_.size());
+        return ERR_DH_FWK_TASK_TIMEOUT;
+    }
+    DHLOGI("other task finished");
+    return DH_FWK_SUCCESS;
+}
+
 bool TaskBoard::IsAllTaskFinish()
 {
     std::lock_guard<std::mutex> lock(tasksMtx_);
@@ -68,6 +95,16 @@ void TaskBoard::AddTask(std::shared_ptr<Task> task)
 bool TaskBoard::IsAllDisableTaskFinish()
 {
     std::lock_guard<std::mutex> lock(tasksMtx_);
+    int32_t disableCount = GetDisableTaskCountInner();
+    DHLOGI("DisableTask count: %{public}d", disableCount);
+    if (disableCount == 0) {
+        return true;
+    }
+    return false;
+}
+
+int32_t TaskBoard::GetDisableTaskCountInner()
+{
     int32_t disableCount = 0;
     for (auto iter = tasks_.begin(); iter != tasks_.end(); iter++) {
         if (iter->second != nullptr) {
@@ -77,11 +114,7 @@ bool TaskBoard::IsAllDisableTaskFinish()
             }
         }
     }
-    DHLOGI("DisableTask count: %{public}d", disableCount);
-    if (disableCount == 0) {
-        return true;
-    }
-    return false;
+    return disableCount;
 }
 
 void TaskBoard::RemoveTask(std::string taskId)
@@ -89,9 +122,8 @@ void TaskBoard::RemoveTask(std::string taskId)
     std::lock_guard<std::mutex> lock(tasksMtx_);
     DHLOGI("Remove task, id: %{public}s", taskId.c_str());
     RemoveTaskInner(taskId);
-    if (tasks_.empty()) {
-        conVar_.notify_one();
-    }
+    // Waiters watch different predicates (all tasks, disable tasks, all but one), so wake them all.
+    conVar_.notify_all();
 }
 
 void TaskBoard::RemoveTaskInner(std::string taskId)
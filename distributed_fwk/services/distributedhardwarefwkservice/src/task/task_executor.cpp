@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,30 +15,27 @@
 
 #include "task_executor.h"
 
-#include <pthread.h>
-#include <thread>
+#include <algorithm>
 
-#include "dh_context.h"
-#include "distributed_hardware_errno.h"
+#include "dh_perf_stats.h"
 #include "distributed_hardware_log.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 namespace {
     const uint32_t MAX_TASK_QUEUE_LENGTH = 256;
-    constexpr const char *TRIGGER_TASK = "TriggerTask";
+    constexpr size_t MAX_TASK_WORKERS = 4;
+    constexpr const char *LANE_SEPARATOR = "#";
 }
 FWK_IMPLEMENT_SINGLE_INSTANCE(TaskExecutor);
-TaskExecutor::TaskExecutor() : taskThreadFlag_(true)
+TaskExecutor::TaskExecutor()
 {
     DHLOGI("Ctor TaskExecutor");
-    ffrt::submit([this]() { this->TriggerTask(); });
 }
 
 TaskExecutor::~TaskExecutor()
 {
     DHLOGI("Dtor TaskExecutor");
-    taskThreadFlag_ = false;
 }
 
 void TaskExecutor::PushTask(const std::shared_ptr<Task> task)
@@ -51,54 +48,90 @@ void TaskExecutor::PushTask(const std::shared_ptr<Task> task)
     {
         DHLOGI("Push task: %{public}s", task->GetId().c_str());
         std::unique_lock<ffrt::mutex> lock(taskQueueMtx_);
-        if (taskQueue_.size() > MAX_TASK_QUEUE_LENGTH) {
+        if (pendingTaskCount_ > MAX_TASK_QUEUE_LENGTH) {
             DHLOGE("Task queue is full");
             return;
         }
-        taskQueue_.push(task);
+        std::string laneKey = GetLaneKey(task);
+        auto iter = taskLanes_.find(laneKey);
+        if (iter == taskLanes_.end()) {
+            taskLanes_[laneKey].push_back(task);
+            readyLanes_.push_back(laneKey);
+        } else {
+            // The lane is queued or running already, it picks the task up after the earlier ones.
+            iter->second.push_back(task);
+        }
+        pendingTaskCount_++;
+        peakPendingTaskCount_ = std::max(peakPendingTaskCount_, pendingTaskCount_);
     }
 
-    condVar_.notify_one();
+    StartWorkers();
 }
 
-std::shared_ptr<Task> TaskExecutor::PopTask()
+size_t TaskExecutor::GetPendingTaskCount()
 {
-    std::shared_ptr<Task> task = nullptr;
-
     std::unique_lock<ffrt::mutex> lock(taskQueueMtx_);
-    condVar_.wait(lock, [this] { return !(this->taskQueue_.empty()); });
+    return pendingTaskCount_;
+}
 
-    if (!taskQueue_.empty()) {
-        task = taskQueue_.front();
-        taskQueue_.pop();
-    }
+size_t TaskExecutor::GetPeakPendingTaskCount()
+{
+    std::unique_lock<ffrt::mutex> lock(taskQueueMtx_);
+    return peakPendingTaskCount_;
+}
 
-    return task;
+std::string TaskExecutor::GetLaneKey(const std::shared_ptr<Task> &task)
+{
+    return task->GetNetworkId() + LANE_SEPARATOR + std::to_string(static_cast<uint32_t>(task->GetDhType()));
 }
 
-void TaskExecutor::TriggerTask()
+void TaskExecutor::StartWorkers()
 {
-    int32_t ret = pthread_setname_np(pthread_self(), TRIGGER_TASK);
-    if (ret != DH_FWK_SUCCESS) {
-        DHLOGE("TriggerTask setname failed.");
+    std::unique_lock<ffrt::mutex> lock(taskQueueMtx_);
+    while (runningWorkers_ < MAX_TASK_WORKERS && runningWorkers_ < readyLanes_.size()) {
+        runningWorkers_++;
+        ffrt::submit([this]() { this->RunTasks(); });
     }
-    while (taskThreadFlag_) {
-        std::shared_ptr<Task> task = PopTask();
-        if (task == nullptr) {
-            DHLOGE("Pop a null task, error");
-            continue;
+}
+
+void TaskExecutor::RunTasks()
+{
+    while (true) {
+        std::string laneKey;
+        std::shared_ptr<Task> task = nullptr;
+        {
+            std::unique_lock<ffrt::mutex> lock(taskQueueMtx_);
+            if (readyLanes_.empty()) {
+                runningWorkers_--;
+                return;
+            }
+            laneKey = readyLanes_.front();
+            readyLanes_.pop_front();
+            auto &laneTasks = taskLanes_[laneKey];
+            task = laneTasks.front();
+            laneTasks.pop_front();
+            pendingTaskCount_--;
         }
 
-        auto taskFunc = [task]() {
+        DHLOGI("Run task: %{public}s", task->GetId().c_str());
+        {
+            auto typeIter = TaskTypeStrMap.find(task->GetTaskType());
+            PerfCostScope costScope(PerfCategory::TASK_RUN,
+                typeIter != TaskTypeStrMap.end() ? typeIter->second : "UNKNOWN");
             task->DoTask();
-        };
+        }
 
-        DHLOGI("Post task to EventBus: %{public}s", task->GetId().c_str());
-        if (DHContext::GetInstance().GetEventHandler() == nullptr) {
-            DHLOGE("eventHandler is nullptr");
+        std::unique_lock<ffrt::mutex> lock(taskQueueMtx_);
+        auto iter = taskLanes_.find(laneKey);
+        if (iter == taskLanes_.end()) {
             continue;
         }
-        DHContext::GetInstance().GetEventHandler()->PostTask(taskFunc, task->GetId());
+        if (iter->second.empty()) {
+            taskLanes_.erase(iter);
+        } else {
+            // Back to the end of the line, the lanes of other devices get a turn first.
+            readyLanes_.push_back(laneKey);
+        }
     }
 }
 } // namespace DistributedHardware
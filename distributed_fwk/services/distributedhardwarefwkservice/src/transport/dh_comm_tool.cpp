@@ -15,6 +15,11 @@
 
 #include "dh_comm_tool.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <iterator>
+#include <set>
+
 #include "cJSON.h"
 #include "device_manager.h"
 #include "ipc_skeleton.h"
@@ -43,6 +48,11 @@ namespace DistributedHardware {
 constexpr int32_t DH_COMM_REQ_FULL_CAPS = 1;
 // send back full dh attributes to the requester
 constexpr int32_t DH_COMM_RSP_FULL_CAPS = 2;
+// generations of the local caps kept to answer requesters with a delta
+constexpr size_t MAX_CAPS_SNAPSHOTS = 8;
+// a full sync after a partial one waits for the first use of the device to settle
+constexpr int64_t DEFERRED_FULL_CAPS_SYNC_MS = 5000;
+const std::string DEFERRED_FULL_CAPS_TASK_NAME = "_deferred_full_caps";
 
 DHCommTool::DHCommTool() : dhTransportPtr_(nullptr)
 {
@@ -124,9 +134,34 @@ bool DHCommTool::GetOsAccountInfo()
     return true;
 }
 
-void DHCommTool::TriggerReqFullDHCaps(const std::string &remoteNetworkId)
+void DHCommTool::TriggerReqFullDHCaps(const std::string &remoteNetworkId, bool withDigest)
 {
     DHLOGI("TriggerReqFullDHCaps, remote networkId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
+    CommMsg commMsg;
+    if (withDigest) {
+        commMsg.capsDigest = GetRemoteMetaCapsDigest(remoteNetworkId);
+        commMsg.capsGeneration = commMsg.capsDigest.empty() ? 0 : GetRemoteCapsGeneration(remoteNetworkId);
+    }
+    SendCapsReq(remoteNetworkId, commMsg);
+}
+
+void DHCommTool::TriggerReqPartialDHCaps(const std::string &remoteNetworkId, DHType dhType,
+    const std::string &dhId)
+{
+    DHLOGI("TriggerReqPartialDHCaps, remote networkId: %{public}s, dhType: %{public}#X, dhId: %{public}s",
+        GetAnonyString(remoteNetworkId).c_str(), dhType, GetAnonyString(dhId).c_str());
+    if (dhType == DHType::UNKNOWN) {
+        TriggerReqFullDHCaps(remoteNetworkId);
+        return;
+    }
+    CommMsg commMsg;
+    commMsg.reqDHType = static_cast<uint32_t>(dhType);
+    commMsg.reqDHId = dhId;
+    SendCapsReq(remoteNetworkId, commMsg);
+}
+
+void DHCommTool::SendCapsReq(const std::string &remoteNetworkId, CommMsg &commMsg)
+{
     if (remoteNetworkId.empty() || dhTransportPtr_ == nullptr) {
         DHLOGE("remoteNetworkId or transport is null");
         return;
@@ -140,11 +175,22 @@ void DHCommTool::TriggerReqFullDHCaps(const std::string &remoteNetworkId)
         DHLOGE("ACL check failed.");
         return;
     }
-    if (dhTransportPtr_->StartSocket(remoteNetworkId) != DH_FWK_SUCCESS) {
+    // The request waits in the send queue of the peer while the socket binds.
+    auto onSocketReady = [](const std::string &networkId, int32_t result) {
+        if (result != DH_FWK_SUCCESS) {
+            DHLOGE("Start socket error, networkId: %{public}s", GetAnonyString(networkId).c_str());
+        }
+    };
+    if (dhTransportPtr_->StartSocketAsync(remoteNetworkId, onSocketReady) != DH_FWK_SUCCESS) {
         DHLOGE("Start socket error");
         return;
     }
-    CommMsg commMsg(DH_COMM_REQ_FULL_CAPS, userId_, tokenId_, localNetworkId, accountId_, true, "");
+    commMsg.code = DH_COMM_REQ_FULL_CAPS;
+    commMsg.userId = userId_;
+    commMsg.tokenId = tokenId_;
+    commMsg.msg = localNetworkId;
+    commMsg.accountId = accountId_;
+    commMsg.isSyncMeta = true;
     std::string payload = GetCommMsgString(commMsg);
 
     int32_t ret = dhTransportPtr_->Send(remoteNetworkId, payload);
@@ -155,6 +201,27 @@ void DHCommTool::TriggerReqFullDHCaps(const std::string &remoteNetworkId)
     DHLOGI("Trigger req remote full attrs success.");
 }
 
+void DHCommTool::PreOpenSocket(const std::string &remoteNetworkId)
+{
+    if (remoteNetworkId.empty() || dhTransportPtr_ == nullptr) {
+        DHLOGE("remoteNetworkId or transport is null");
+        return;
+    }
+    std::string localNetworkId = GetLocalNetworkId();
+    if (localNetworkId.empty()) {
+        DHLOGE("Get local network id error");
+        return;
+    }
+    if (!CheckCallerAclRight(localNetworkId, remoteNetworkId)) {
+        DHLOGE("ACL check failed, no session pre-opened.");
+        return;
+    }
+    DHLOGI("Pre-open session, remote networkId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
+    dhTransportPtr_->StartSocketAsync(remoteNetworkId, [](const std::string &networkId, int32_t result) {
+        DHLOGI("Pre-open session result: %{public}d, networkId: %{public}s", result, GetAnonyString(networkId).c_str());
+    });
+}
+
 std::string DHCommTool::GetLocalFullCapsInfo(bool isSyncMeta)
 {
     DHLOGI("get local cap info start");
@@ -187,9 +254,15 @@ std::string DHCommTool::GetLocalFullMetaCapsInfo(bool isSyncMeta)
     std::string localUdidHash = DHContext::GetInstance().GetDeviceInfo().udidHash;
     std::vector<std::shared_ptr<MetaCapabilityInfo>> lcoalFullMetaCapInfos;
     MetaInfoManager::GetInstance()->GetMetaCapInfosByUdidHash(localUdidHash, lcoalFullMetaCapInfos);
+    return GetMetaCapsInfo(lcoalFullMetaCapInfos, isSyncMeta);
+}
+
+std::string DHCommTool::GetMetaCapsInfo(const std::vector<std::shared_ptr<MetaCapabilityInfo>> &metaCaps,
+    bool isSyncMeta)
+{
     FullCapsRsp capsRsp;
     capsRsp.networkId = GetLocalNetworkId();
-    capsRsp.metaCaps = lcoalFullMetaCapInfos;
+    capsRsp.metaCaps = metaCaps;
     cJSON *root = cJSON_CreateObject();
     if (root == nullptr) {
         DHLOGE("Create cJSON object failed.");
@@ -207,34 +280,87 @@ std::string DHCommTool::GetLocalFullMetaCapsInfo(bool isSyncMeta)
     return fullMetaCaps;
 }
 
-void DHCommTool::GetAndSendLocalFullCaps(const std::string &reqNetworkId, bool isSyncMeta)
+void DHCommTool::GetAndSendLocalFullCaps(const std::string &reqNetworkId, bool isSyncMeta,
+    const std::string &reqDigest, uint64_t reqGeneration)
 {
     DHLOGI("GetAndSendLocalFullCaps, reqNetworkId: %{public}s", GetAnonyString(reqNetworkId).c_str());
     if (dhTransportPtr_ == nullptr) {
         DHLOGE("transport is null");
         return;
     }
-    std::string localFullInfo;
+    CommMsg commMsg;
+    commMsg.code = DH_COMM_RSP_FULL_CAPS;
+    commMsg.isSyncMeta = true;
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> localMetaCapInfos;
     if (isSyncMeta) {
-        localFullInfo = GetLocalFullMetaCapsInfo(isSyncMeta);
+        MetaInfoManager::GetInstance()->GetMetaCapInfosByUdidHash(DHContext::GetInstance().GetDeviceInfo().udidHash,
+            localMetaCapInfos);
+        commMsg.capsDigest = GetMetaCapsDigest(localMetaCapInfos);
+        commMsg.capsGeneration = UpdateLocalCapsGeneration(localMetaCapInfos, commMsg.capsDigest);
+    }
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> changedCaps;
+    if (!reqDigest.empty() && reqDigest == commMsg.capsDigest) {
+        DHLOGI("Requester holds the current caps, send back the digest only");
+    } else if (isSyncMeta && GetLocalCapsDelta(reqGeneration, reqDigest, localMetaCapInfos, changedCaps,
+        commMsg.removedCapKeys)) {
+        DHLOGI("Requester holds generation %{public}" PRIu64 ", send back %{public}zu changed and %{public}zu "
+            "removed caps", reqGeneration, changedCaps.size(), commMsg.removedCapKeys.size());
+        commMsg.capsBaseGeneration = reqGeneration;
+        commMsg.msg = GetMetaCapsInfo(changedCaps, isSyncMeta);
+        if (commMsg.msg.empty()) {
+            DHLOGE("Get local caps delta failed.");
+            return;
+        }
     } else {
-        localFullInfo = GetLocalFullCapsInfo(isSyncMeta);
+        commMsg.msg = isSyncMeta ? GetMetaCapsInfo(localMetaCapInfos, isSyncMeta) : GetLocalFullCapsInfo(isSyncMeta);
+        if (commMsg.msg.empty()) {
+            DHLOGE("Get lcoal full device info failed.");
+            return;
+        }
     }
-    if (localFullInfo.empty()) {
-        DHLOGE("Get lcoal full device info failed.");
+    std::string payload = GetCommMsgString(commMsg);
+    int32_t ret = dhTransportPtr_->Send(reqNetworkId, payload);
+    if (ret != DH_FWK_SUCCESS) {
+        DHLOGE("Send back Caps failed, ret: %{public}d", ret);
+        return;
+    }
+    DHLOGI("Send back Caps success");
+}
+
+void DHCommTool::GetAndSendLocalPartialCaps(const std::string &reqNetworkId, DHType dhType,
+    const std::string &dhId)
+{
+    DHLOGI("GetAndSendLocalPartialCaps, reqNetworkId: %{public}s, dhType: %{public}#X, dhId: %{public}s",
+        GetAnonyString(reqNetworkId).c_str(), dhType, GetAnonyString(dhId).c_str());
+    if (dhTransportPtr_ == nullptr) {
+        DHLOGE("transport is null");
         return;
     }
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> localMetaCapInfos;
+    MetaInfoManager::GetInstance()->GetMetaCapInfosByUdidHash(DHContext::GetInstance().GetDeviceInfo().udidHash,
+        localMetaCapInfos);
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> reqMetaCapInfos;
+    std::copy_if(localMetaCapInfos.begin(), localMetaCapInfos.end(), std::back_inserter(reqMetaCapInfos),
+        [dhType, &dhId](const std::shared_ptr<MetaCapabilityInfo> &metaCap) {
+            return metaCap != nullptr && metaCap->GetDHType() == dhType && (dhId.empty() || metaCap->GetDHId() == dhId);
+        });
+    // No digest nor generation, they only describe the full caps.
     CommMsg commMsg;
     commMsg.code = DH_COMM_RSP_FULL_CAPS;
-    commMsg.msg = localFullInfo;
     commMsg.isSyncMeta = true;
+    commMsg.isPartialCaps = true;
+    commMsg.msg = GetMetaCapsInfo(reqMetaCapInfos, true);
+    if (commMsg.msg.empty()) {
+        DHLOGE("Get local partial caps failed.");
+        return;
+    }
     std::string payload = GetCommMsgString(commMsg);
     int32_t ret = dhTransportPtr_->Send(reqNetworkId, payload);
     if (ret != DH_FWK_SUCCESS) {
-        DHLOGE("Send back Caps failed, ret: %{public}d", ret);
+        DHLOGE("Send back partial Caps failed, ret: %{public}d", ret);
         return;
     }
-    DHLOGI("Send back Caps success");
+    DHLOGI("Send back %{public}zu partial Caps success", reqMetaCapInfos.size());
 }
 
 FullCapsRsp DHCommTool::ParseAndSaveRemoteDHCaps(const std::string &remoteCaps, bool isSyncMeta,
@@ -251,7 +377,7 @@ FullCapsRsp DHCommTool::ParseAndSaveRemoteDHCaps(const std::string &remoteCaps,
     FromJson(root, capsRsp, isSyncMeta);
     cJSON_Delete(root);
     FullCapsRsp invalidCaps;
-    if (!ComponentManager::GetInstance().IsRequestSyncData(realNetworkId)) {
+    if (!IsSyncResponseExpected(realNetworkId)) {
         DHLOGE("Ignore response, networkId: %{public}s no request sync", GetAnonyString(realNetworkId).c_str());
         return invalidCaps;
     }
@@ -263,6 +389,212 @@ FullCapsRsp DHCommTool::ParseAndSaveRemoteDHCaps(const std::string &remoteCaps,
     return capsRsp;
 }
 
+bool DHCommTool::GetUnchangedRemoteDHCaps(const std::string &remoteDigest, const std::string &realNetworkId,
+    FullCapsRsp &capsRsp)
+{
+    std::string remoteUuid = DHContext::GetInstance().GetUUIDByNetworkId(realNetworkId);
+    std::string remoteUdidHash = DHContext::GetInstance().GetUdidHashIdByUUID(remoteUuid);
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> metaCaps;
+    MetaInfoManager::GetInstance()->GetMetaCapInfosByUdidHash(remoteUdidHash, metaCaps);
+    if (metaCaps.empty() || GetMetaCapsDigest(metaCaps) != remoteDigest) {
+        DHLOGE("Saved caps of networkId: %{public}s no longer match", GetAnonyString(realNetworkId).c_str());
+        return false;
+    }
+    capsRsp.networkId = realNetworkId;
+    capsRsp.metaCaps = metaCaps;
+    DHLOGI("Remote caps unchanged, reuse saved caps, networkId: %{public}s", GetAnonyString(realNetworkId).c_str());
+    return true;
+}
+
+bool DHCommTool::ApplyRemoteDHCapsDelta(const CommMsg &commMsg, FullCapsRsp &capsRsp)
+{
+    const std::string &realNetworkId = commMsg.realNetworkId;
+    if (!commMsg.isSyncMeta || commMsg.capsDigest.empty() ||
+        GetRemoteCapsGeneration(realNetworkId) != commMsg.capsBaseGeneration) {
+        DHLOGE("Caps delta does not apply to the saved caps, networkId: %{public}s",
+            GetAnonyString(realNetworkId).c_str());
+        return false;
+    }
+    cJSON *root = cJSON_Parse(commMsg.msg.c_str());
+    if (root == NULL) {
+        DHLOGE("Parse remote caps delta failed");
+        return false;
+    }
+    FullCapsRsp deltaRsp;
+    FromJson(root, deltaRsp, true);
+    cJSON_Delete(root);
+    std::string remoteUuid = DHContext::GetInstance().GetUUIDByNetworkId(realNetworkId);
+    std::string remoteUdidHash = DHContext::GetInstance().GetUdidHashIdByUUID(remoteUuid);
+    if (remoteUdidHash.empty()) {
+        DHLOGE("remoteUdidHash is empty");
+        return false;
+    }
+    for (auto const &key : commMsg.removedCapKeys) {
+        if (SplitString(key) != remoteUdidHash) {
+            DHLOGE("the removed key: %{public}s is not trustworthy", GetAnonyString(key).c_str());
+            return false;
+        }
+    }
+    if (!deltaRsp.metaCaps.empty() && !IsSaveRemoteDHCaps(deltaRsp, true, realNetworkId)) {
+        DHLOGE("save remote device caps delta failed");
+        return false;
+    }
+    if (!commMsg.removedCapKeys.empty()) {
+        MetaInfoManager::GetInstance()->RemoveMetaCapInfosByKeys(commMsg.removedCapKeys);
+    }
+    DHLOGI("Applied caps delta, changed: %{public}zu, removed: %{public}zu, networkId: %{public}s",
+        deltaRsp.metaCaps.size(), commMsg.removedCapKeys.size(), GetAnonyString(realNetworkId).c_str());
+    // The result has to be the responder's current caps, otherwise the caller falls back to a full sync.
+    return GetUnchangedRemoteDHCaps(commMsg.capsDigest, realNetworkId, capsRsp);
+}
+
+uint64_t DHCommTool::UpdateLocalCapsGeneration(const std::vector<std::shared_ptr<MetaCapabilityInfo>> &metaCaps,
+    const std::string &digest)
+{
+    std::lock_guard<std::mutex> lock(capsGenMtx_);
+    if (!localCapsSnapshots_.empty() && localCapsSnapshots_.back().digest == digest) {
+        return localCapsSnapshots_.back().generation;
+    }
+    CapsSnapshot snapshot;
+    snapshot.generation = ++localCapsGeneration_;
+    snapshot.digest = digest;
+    for (auto const &metaCap : metaCaps) {
+        if (metaCap != nullptr) {
+            snapshot.entries[metaCap->GetKey()] = metaCap->ToJsonString();
+        }
+    }
+    localCapsSnapshots_.push_back(std::move(snapshot));
+    if (localCapsSnapshots_.size() > MAX_CAPS_SNAPSHOTS) {
+        localCapsSnapshots_.pop_front();
+    }
+    return localCapsGeneration_;
+}
+
+bool DHCommTool::GetLocalCapsDelta(uint64_t baseGeneration, const std::string &baseDigest,
+    const std::vector<std::shared_ptr<MetaCapabilityInfo>> &metaCaps,
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> &changedCaps, std::vector<std::string> &removedKeys)
+{
+    if (baseGeneration == 0 || baseDigest.empty()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(capsGenMtx_);
+    auto base = std::find_if(localCapsSnapshots_.begin(), localCapsSnapshots_.end(),
+        [baseGeneration](const CapsSnapshot &snapshot) { return snapshot.generation == baseGeneration; });
+    // Generations restart with the service, the digest tells whether the requester holds this one.
+    if (base == localCapsSnapshots_.end() || base->digest != baseDigest) {
+        return false;
+    }
+    std::set<std::string> currentKeys;
+    for (auto const &metaCap : metaCaps) {
+        if (metaCap == nullptr) {
+            continue;
+        }
+        std::string key = metaCap->GetKey();
+        currentKeys.insert(key);
+        auto entry = base->entries.find(key);
+        if (entry == base->entries.end() || entry->second != metaCap->ToJsonString()) {
+            changedCaps.push_back(metaCap);
+        }
+    }
+    for (auto const &entry : base->entries) {
+        if (currentKeys.find(entry.first) == currentKeys.end()) {
+            removedKeys.push_back(entry.first);
+        }
+    }
+    return true;
+}
+
+void DHCommTool::SetRemoteCapsGeneration(const std::string &remoteNetworkId, uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(capsGenMtx_);
+    if (generation == 0) {
+        remoteCapsGenerations_.erase(remoteNetworkId);
+        return;
+    }
+    remoteCapsGenerations_[remoteNetworkId] = generation;
+}
+
+void DHCommTool::OnRemotePartialCapsSaved(const std::string &remoteNetworkId)
+{
+    {
+        std::lock_guard<std::mutex> lock(partialCapsMtx_);
+        partialCapsNetworkIds_.insert(remoteNetworkId);
+    }
+    if (eventHandler_ == nullptr) {
+        DHLOGE("eventHandler is null, full caps sync waits for the next request");
+        return;
+    }
+    std::weak_ptr<DHCommTool> weakTool = shared_from_this();
+    auto fullSyncTask = [weakTool, remoteNetworkId]() {
+        std::shared_ptr<DHCommTool> dhCommTool = weakTool.lock();
+        if (dhCommTool != nullptr && dhCommTool->HasRemotePartialCapsOnly(remoteNetworkId)) {
+            dhCommTool->TriggerReqFullDHCaps(remoteNetworkId);
+        }
+    };
+    std::string taskName = remoteNetworkId + DEFERRED_FULL_CAPS_TASK_NAME;
+    eventHandler_->RemoveTask(taskName);
+    eventHandler_->PostTask(fullSyncTask, taskName, DEFERRED_FULL_CAPS_SYNC_MS,
+        AppExecFwk::EventQueue::Priority::IDLE);
+    DHLOGI("Defer full caps sync, networkId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
+}
+
+void DHCommTool::OnRemoteFullCapsSaved(const std::string &remoteNetworkId)
+{
+    {
+        std::lock_guard<std::mutex> lock(partialCapsMtx_);
+        if (partialCapsNetworkIds_.erase(remoteNetworkId) == 0) {
+            return;
+        }
+    }
+    if (eventHandler_ != nullptr) {
+        eventHandler_->RemoveTask(remoteNetworkId + DEFERRED_FULL_CAPS_TASK_NAME);
+    }
+}
+
+bool DHCommTool::HasRemotePartialCapsOnly(const std::string &remoteNetworkId)
+{
+    std::lock_guard<std::mutex> lock(partialCapsMtx_);
+    return partialCapsNetworkIds_.find(remoteNetworkId) != partialCapsNetworkIds_.end();
+}
+
+bool DHCommTool::IsSyncResponseExpected(const std::string &remoteNetworkId)
+{
+    // The deferred full sync has no caller waiting on it.
+    return ComponentManager::GetInstance().IsRequestSyncData(remoteNetworkId) ||
+        HasRemotePartialCapsOnly(remoteNetworkId);
+}
+
+uint64_t DHCommTool::GetRemoteCapsGeneration(const std::string &remoteNetworkId)
+{
+    std::lock_guard<std::mutex> lock(capsGenMtx_);
+    auto iter = remoteCapsGenerations_.find(remoteNetworkId);
+    return iter == remoteCapsGenerations_.end() ? 0 : iter->second;
+}
+
+std::string DHCommTool::GetMetaCapsDigest(const std::vector<std::shared_ptr<MetaCapabilityInfo>> &metaCaps)
+{
+    // Both sides walk their meta info map in key order, so the same records give the same digest.
+    std::string capsJson;
+    for (auto const &metaCap : metaCaps) {
+        if (metaCap != nullptr) {
+            capsJson += metaCap->ToJsonString();
+        }
+    }
+    return capsJson.empty() ? "" : Sha256(capsJson);
+}
+
+std::string DHCommTool::GetRemoteMetaCapsDigest(const std::string &remoteNetworkId)
+{
+    std::string remoteUuid = DHContext::GetInstance().GetUUIDByNetworkId(remoteNetworkId);
+    std::string remoteUdidHash = DHContext::GetInstance().GetUdidHashIdByUUID(remoteUuid);
+    if (remoteUdidHash.empty()) {
+        return "";
+    }
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> metaCaps;
+    MetaInfoManager::GetInstance()->GetMetaCapInfosByUdidHash(remoteUdidHash, metaCaps);
+    return GetMetaCapsDigest(metaCaps);
+}
+
 bool DHCommTool::IsSaveRemoteDHCaps(const FullCapsRsp &capsRsp, bool isSyncMeta, const std::string &realNetworkId)
 {
     if (isSyncMeta) {
@@ -347,12 +679,33 @@ void DHCommTool::DHCommToolEventHandler::ProcessEvent(
     }
     switch (eventId) {
         case DH_COMM_REQ_FULL_CAPS: {
-            dhCommToolPtr->GetAndSendLocalFullCaps(commMsg->msg, commMsg->isSyncMeta);
+            if (commMsg->reqDHType != 0 && commMsg->isSyncMeta) {
+                dhCommToolPtr->GetAndSendLocalPartialCaps(commMsg->msg, static_cast<DHType>(commMsg->reqDHType),
+                    commMsg->reqDHId);
+                break;
+            }
+            dhCommToolPtr->GetAndSendLocalFullCaps(commMsg->msg, commMsg->isSyncMeta, commMsg->capsDigest,
+                commMsg->capsGeneration);
             break;
         }
         case DH_COMM_RSP_FULL_CAPS: {
+            if (commMsg->capsBaseGeneration != 0 || (commMsg->msg.empty() && !commMsg->capsDigest.empty())) {
+                ProcessSavedCapsRsp(commMsg, dhCommToolPtr);
+                break;
+            }
             FullCapsRsp capsRsp =
                 dhCommToolPtr->ParseAndSaveRemoteDHCaps(commMsg->msg, commMsg->isSyncMeta, commMsg->realNetworkId);
+            if (commMsg->isPartialCaps) {
+                if (!capsRsp.networkId.empty()) {
+                    dhCommToolPtr->OnRemotePartialCapsSaved(commMsg->realNetworkId);
+                }
+                ProcessFullCapsRsp(capsRsp, dhCommToolPtr, commMsg->isSyncMeta, commMsg->realNetworkId, true);
+                break;
+            }
+            if (!capsRsp.networkId.empty()) {
+                dhCommToolPtr->SetRemoteCapsGeneration(commMsg->realNetworkId, commMsg->capsGeneration);
+                dhCommToolPtr->OnRemoteFullCapsSaved(commMsg->realNetworkId);
+            }
             ProcessFullCapsRsp(capsRsp, dhCommToolPtr, commMsg->isSyncMeta, commMsg->realNetworkId);
             break;
         }
@@ -362,8 +715,31 @@ void DHCommTool::DHCommToolEventHandler::ProcessEvent(
     }
 }
 
+void DHCommTool::DHCommToolEventHandler::ProcessSavedCapsRsp(const std::shared_ptr<CommMsg> &commMsg,
+    const std::shared_ptr<DHCommTool> dhCommToolPtr)
+{
+    if (!dhCommToolPtr->IsSyncResponseExpected(commMsg->realNetworkId)) {
+        DHLOGE("Ignore response, networkId: %{public}s no request sync",
+            GetAnonyString(commMsg->realNetworkId).c_str());
+        return;
+    }
+    FullCapsRsp savedCapsRsp;
+    bool isSaved = (commMsg->capsBaseGeneration != 0) ?
+        dhCommToolPtr->ApplyRemoteDHCapsDelta(*commMsg, savedCapsRsp) :
+        dhCommToolPtr->GetUnchangedRemoteDHCaps(commMsg->capsDigest, commMsg->realNetworkId, savedCapsRsp);
+    if (!isSaved) {
+        // The saved caps changed after the request went out, ask for the full caps instead.
+        dhCommToolPtr->TriggerReqFullDHCaps(commMsg->realNetworkId, false);
+        return;
+    }
+    dhCommToolPtr->SetRemoteCapsGeneration(commMsg->realNetworkId, commMsg->capsGeneration);
+    dhCommToolPtr->OnRemoteFullCapsSaved(commMsg->realNetworkId);
+    ProcessFullCapsRsp(savedCapsRsp, dhCommToolPtr, commMsg->isSyncMeta, commMsg->realNetworkId);
+}
+
 void DHCommTool::DHCommToolEventHandler::ProcessFullCapsRsp(const FullCapsRsp &capsRsp,
-    const std::shared_ptr<DHCommTool> dhCommToolPtr, bool isSyncMeta, const std::string &realNetworkId)
+    const std::shared_ptr<DHCommTool> dhCommToolPtr, bool isSyncMeta, const std::string &realNetworkId,
+    bool isPartial)
 {
     if (realNetworkId.empty()) {
         DHLOGE("Receive remote caps info invalid!");
@@ -405,7 +781,7 @@ void DHCommTool::DHCommToolEventHandler::ProcessFullCapsRsp(const FullCapsRsp &c
             descriptors.push_back(descriptor);
         }
     }
-    ComponentManager::GetInstance().OnGetDescriptors(realNetworkId, descriptors);
+    ComponentManager::GetInstance().OnGetDescriptors(realNetworkId, descriptors, isPartial);
 }
 
 std::shared_ptr<DHCommTool::DHCommToolEventHandler> DHCommTool::GetEventHandler()
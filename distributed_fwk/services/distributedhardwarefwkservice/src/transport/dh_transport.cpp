@@ -16,7 +16,6 @@
 #include "dh_transport.h"
 
 #include <cinttypes>
-#include <securec.h>
 
 #include "cJSON.h"
 #include "device_manager.h"
@@ -29,6 +28,7 @@
 #include "constants.h"
 #include "dh_comm_tool.h"
 #include "dh_context.h"
+#include "dh_perf_stats.h"
 #include "dh_transport_obj.h"
 #include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
@@ -41,10 +41,26 @@ namespace DistributedHardware {
 namespace {
 // Dsoftbus sendBytes max message length: 4MB
 constexpr uint32_t MAX_SEND_MSG_LENGTH = 4 * 1024 * 1024;
+// Inflated message limit, the one of IsMessageLengthValid
+constexpr uint32_t MAX_RAW_MSG_LENGTH = 40 * 1024 * 1024;
 constexpr uint32_t INTERCEPT_STRING_LENGTH = 20;
 constexpr uint32_t MAX_ROUND_SIZE = 1000;
 constexpr int32_t DH_COMM_RSP_FULL_CAPS = 2;
 const std::string DH_FWK_SESSION_NAME = "ohos.dhardware.session_";
+// the messages queued to a peer within this window go out in one frame
+constexpr int64_t SEND_COALESCE_WINDOW_MS = 20;
+constexpr size_t MAX_QUEUED_SEND_MSGS = 64;
+const std::string SEND_FLUSH_TASK_NAME = "_send_flush";
+// a coalesced frame is the magic, then the big endian length and the bytes of each message
+const std::string BATCH_FRAME_MAGIC = "DHBATCH1";
+constexpr size_t BATCH_LEN_BYTES = 4;
+constexpr uint32_t BITS_PER_BYTE = 8;
+constexpr uint32_t BYTE_MASK = 0xFF;
+// a failed bind is retried after BIND_RETRY_BASE_MS, then twice as long after each further failure
+constexpr int32_t MAX_BIND_ATTEMPTS = 3;
+constexpr int64_t BIND_RETRY_BASE_MS = 200;
+constexpr size_t BIND_WORKER_COUNT = 3;
+const std::string BIND_TASK_NAME = "_socket_bind";
 static QosTV g_qosInfo[] = {
     { .qos = QOS_TYPE_MIN_BW, .value = 256 * 1024},
     { .qos = QOS_TYPE_MAX_LATENCY, .value = 8000 },
@@ -73,6 +89,8 @@ int32_t DHTransport::OnSocketOpened(int32_t socketId, const PeerSocketInfo &info
 void DHTransport::OnSocketClosed(int32_t socketId, ShutdownReason reason)
 {
     DHLOGI("OnSocketClosed, socket: %{public}d, reason: %{public}d", socketId, (int32_t)reason);
+    RemoveSocketCodec(socketId);
+    RemovePeerFeatures(GetRemoteNetworkIdBySocketId(socketId));
     std::lock_guard<std::mutex> lock(rmtSocketIdMtx_);
     for (auto iter = remoteDevSocketIds_.begin(); iter != remoteDevSocketIds_.end(); ++iter) {
         if (iter->second == socketId) {
@@ -95,25 +113,129 @@ void DHTransport::OnBytesReceived(int32_t socketId, const void *data, uint32_t d
         return;
     }
 
-    uint8_t *buf = reinterpret_cast<uint8_t *>(calloc(dataLen + 1, sizeof(uint8_t)));
-    if (buf == nullptr) {
-        DHLOGE("OnBytesReceived: malloc memory failed");
+    DHLOGI("Receive message size: %{public}" PRIu32, dataLen);
+    // Inflate straight from the softbus buffer, the message is never copied in its compressed form.
+    std::string rawPayload;
+    if (!GetSocketCodec(socketId)->Decompress(data, dataLen, MAX_RAW_MSG_LENGTH, rawPayload)) {
+        DHLOGE("OnBytesReceived: decompress message failed");
         return;
     }
-
-    if (memcpy_s(buf, dataLen + 1, reinterpret_cast<const uint8_t *>(data), dataLen) != EOK) {
-        DHLOGE("OnBytesReceived: memcpy memory failed");
-        free(buf);
-        buf = nullptr;
+    if (rawPayload.compare(0, BATCH_FRAME_MAGIC.size(), BATCH_FRAME_MAGIC) != 0) {
+        HandleReceiveMessage(rawPayload, remoteNeworkId);
         return;
     }
+    std::vector<std::string> payloads;
+    if (!UnpackBatch(rawPayload, payloads)) {
+        DHLOGE("OnBytesReceived: split coalesced frame failed");
+        return;
+    }
+    DHLOGI("Receive %{public}zu coalesced messages", payloads.size());
+    for (const auto &payload : payloads) {
+        HandleReceiveMessage(payload, remoteNeworkId);
+    }
+}
 
-    std::string message(buf, buf + dataLen);
-    DHLOGI("Receive message size: %{public}" PRIu32, dataLen);
-    HandleReceiveMessage(message, remoteNeworkId);
-    free(buf);
-    buf = nullptr;
-    return;
+void DHTransport::PackBatches(const std::vector<std::string> &payloads, std::vector<std::string> &frames)
+{
+    size_t begin = 0;
+    while (begin < payloads.size()) {
+        size_t end = begin + 1;
+        size_t frameSize = BATCH_FRAME_MAGIC.size() + BATCH_LEN_BYTES + payloads[begin].size();
+        while (end < payloads.size() && frameSize + BATCH_LEN_BYTES + payloads[end].size() <= MAX_SEND_MSG_LENGTH) {
+            frameSize += BATCH_LEN_BYTES + payloads[end].size();
+            end++;
+        }
+        if (end - begin == 1) {
+            frames.push_back(payloads[begin]);
+            begin = end;
+            continue;
+        }
+        std::string frame;
+        frame.reserve(frameSize);
+        frame.append(BATCH_FRAME_MAGIC);
+        for (size_t i = begin; i < end; i++) {
+            uint32_t len = static_cast<uint32_t>(payloads[i].size());
+            for (size_t byte = BATCH_LEN_BYTES; byte > 0; byte--) {
+                frame.push_back(static_cast<char>((len >> ((byte - 1) * BITS_PER_BYTE)) & BYTE_MASK));
+            }
+            frame.append(payloads[i]);
+        }
+        frames.push_back(std::move(frame));
+        begin = end;
+    }
+}
+
+bool DHTransport::UnpackBatch(const std::string &frame, std::vector<std::string> &payloads)
+{
+    size_t pos = BATCH_FRAME_MAGIC.size();
+    while (pos < frame.size()) {
+        if (frame.size() - pos < BATCH_LEN_BYTES) {
+            return false;
+        }
+        uint32_t len = 0;
+        for (size_t byte = 0; byte < BATCH_LEN_BYTES; byte++) {
+            len = (len << BITS_PER_BYTE) | static_cast<uint8_t>(frame[pos + byte]);
+        }
+        pos += BATCH_LEN_BYTES;
+        if (len > frame.size() - pos) {
+            return false;
+        }
+        payloads.emplace_back(frame, pos, len);
+        pos += len;
+    }
+    return true;
+}
+
+std::shared_ptr<DHZlibCodec> DHTransport::GetSocketCodec(int32_t socketId)
+{
+    std::lock_guard<std::mutex> lock(codecMtx_);
+    auto &codec = socketCodecs_[socketId];
+    if (codec == nullptr) {
+        codec = std::make_shared<DHZlibCodec>();
+    }
+    return codec;
+}
+
+void DHTransport::RemoveSocketCodec(int32_t socketId)
+{
+    std::lock_guard<std::mutex> lock(codecMtx_);
+    socketCodecs_.erase(socketId);
+}
+
+void DHTransport::UpdatePeerDictId(const std::string &remoteNetworkId, uint32_t dictId)
+{
+    std::lock_guard<std::mutex> lock(codecMtx_);
+    peerDictIds_[remoteNetworkId] = dictId;
+}
+
+bool DHTransport::IsPeerDictMatched(const std::string &remoteNetworkId)
+{
+    std::lock_guard<std::mutex> lock(codecMtx_);
+    auto iter = peerDictIds_.find(remoteNetworkId);
+    return iter != peerDictIds_.end() && iter->second == DHZlibCodec::GetPresetDictId();
+}
+
+void DHTransport::UpdatePeerBatchSupported(const std::string &remoteNetworkId, bool isSupported)
+{
+    std::lock_guard<std::mutex> lock(codecMtx_);
+    if (isSupported) {
+        batchPeers_.insert(remoteNetworkId);
+    } else {
+        batchPeers_.erase(remoteNetworkId);
+    }
+}
+
+bool DHTransport::IsPeerBatchSupported(const std::string &remoteNetworkId)
+{
+    std::lock_guard<std::mutex> lock(codecMtx_);
+    return batchPeers_.find(remoteNetworkId) != batchPeers_.end();
+}
+
+void DHTransport::RemovePeerFeatures(const std::string &remoteNetworkId)
+{
+    std::lock_guard<std::mutex> lock(codecMtx_);
+    peerDictIds_.erase(remoteNetworkId);
+    batchPeers_.erase(remoteNetworkId);
 }
 
 bool DHTransport::CheckCalleeAclRight(const std::shared_ptr<CommMsg> commMsg)
@@ -165,13 +287,11 @@ bool DHTransport::CheckCalleeAclRight(const std::shared_ptr<CommMsg> commMsg)
     return DeviceManager::GetInstance().CheckSinkAccessControl(dmSrcCaller, dmDstCallee);
 }
 
-void DHTransport::HandleReceiveMessage(const std::string &payload, const std::string &remoteNeworkId)
+void DHTransport::HandleReceiveMessage(const std::string &rawPayload, const std::string &remoteNeworkId)
 {
-    if (!IsMessageLengthValid(payload)) {
+    if (!IsMessageLengthValid(rawPayload)) {
         return;
     }
-    std::string rawPayload = Decompress(payload);
-
     cJSON *root = cJSON_Parse(rawPayload.c_str());
     if (root == NULL) {
         DHLOGE("the msg is not json format");
@@ -180,6 +300,8 @@ void DHTransport::HandleReceiveMessage(const std::string &payload, const std::st
     std::shared_ptr<CommMsg> commMsg = std::make_shared<CommMsg>();
     FromJson(root, *commMsg);
     cJSON_Delete(root);
+    UpdatePeerDictId(remoteNeworkId, commMsg->compressDictId);
+    UpdatePeerBatchSupported(remoteNeworkId, commMsg->isBatchSupported);
     if (commMsg->code != DH_COMM_RSP_FULL_CAPS) {
         if (!CheckCalleeAclRight(commMsg)) {
             DHLOGE("Callee ACL check failed.");
@@ -346,6 +468,12 @@ int32_t DHTransport::CreateClientSocket(const std::string &remoteNetworkId)
 int32_t DHTransport::Init()
 {
     DHLOGI("Init DHTransport");
+    if (bindHandlers_.empty()) {
+        for (size_t i = 0; i < BIND_WORKER_COUNT; i++) {
+            std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create(true);
+            bindHandlers_.push_back(std::make_shared<AppExecFwk::EventHandler>(runner));
+        }
+    }
     if (isSocketSvrCreateFlag_.load()) {
         DHLOGI("SocketServer already create success.");
         return DH_FWK_SUCCESS;
@@ -378,6 +506,12 @@ int32_t DHTransport::UnInit()
         }
         remoteDevSocketIds_.clear();
     }
+    {
+        std::lock_guard<std::mutex> lock(sendQueueMtx_);
+        sendQueues_.clear();
+        bindingNetworkIds_.clear();
+        bindCallbacks_.clear();
+    }
 
     if (!isSocketSvrCreateFlag_.load()) {
         DHLOGI("DSoftBus Server Socket already remove success.");
@@ -438,22 +572,122 @@ int32_t DHTransport::StartSocket(const std::string &remoteNetworkId)
         return DH_FWK_SUCCESS;
     }
 
+    if (!SetDeviceSocketBinding(remoteNetworkId)) {
+        DHLOGI("Softbus session is binding, deviceId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
+        return DH_FWK_SUCCESS;
+    }
+    int32_t socket = BindClientSocket(remoteNetworkId);
+    if (socket < DH_FWK_SUCCESS) {
+        OnDeviceSocketBound(remoteNetworkId, false);
+        return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
+    }
+    AddClientSocket(remoteNetworkId, socket);
+    OnDeviceSocketBound(remoteNetworkId, true);
+    return DH_FWK_SUCCESS;
+}
+
+int32_t DHTransport::StartSocketAsync(const std::string &remoteNetworkId, SocketReadyCallback callback)
+{
+    if (!IsIdLengthValid(remoteNetworkId)) {
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    int32_t socketId = -1;
+    if (IsDeviceSessionOpened(remoteNetworkId, socketId)) {
+        if (callback != nullptr) {
+            callback(remoteNetworkId, DH_FWK_SUCCESS);
+        }
+        return DH_FWK_SUCCESS;
+    }
+    if (!SetDeviceSocketBinding(remoteNetworkId, callback)) {
+        DHLOGI("Softbus session is binding, deviceId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
+        return DH_FWK_SUCCESS;
+    }
+    if (PostBindTask(remoteNetworkId, 1, 0)) {
+        return DH_FWK_SUCCESS;
+    }
+    DHLOGE("Post bind task failed, bind once now, deviceId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
+    RunBindAttempt(remoteNetworkId, MAX_BIND_ATTEMPTS);
+    return IsDeviceSessionOpened(remoteNetworkId, socketId) ? DH_FWK_SUCCESS :
+        ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
+}
+
+bool DHTransport::PostBindTask(const std::string &remoteNetworkId, int32_t attempt, int64_t delayMs)
+{
+    std::shared_ptr<DHCommTool> dhCommToolSPtr = dhCommToolWPtr_.lock();
+    if (dhCommToolSPtr == nullptr || bindHandlers_.empty()) {
+        return false;
+    }
+    std::weak_ptr<DHCommTool> weakTool = dhCommToolSPtr;
+    auto bindTask = [weakTool, remoteNetworkId, attempt]() {
+        std::shared_ptr<DHCommTool> dhCommTool = weakTool.lock();
+        if (dhCommTool != nullptr && dhCommTool->GetDHTransportPtr() != nullptr) {
+            dhCommTool->GetDHTransportPtr()->RunBindAttempt(remoteNetworkId, attempt);
+        }
+    };
+    // The retries of a peer stay on its worker.
+    auto &bindHandler = bindHandlers_[std::hash<std::string>()(remoteNetworkId) % bindHandlers_.size()];
+    return bindHandler->PostTask(bindTask, remoteNetworkId + BIND_TASK_NAME, delayMs,
+        AppExecFwk::EventQueue::Priority::HIGH);
+}
+
+void DHTransport::RunBindAttempt(const std::string &remoteNetworkId, int32_t attempt)
+{
+    // StopSocket or UnInit gave the bind up meanwhile.
+    if (!IsDeviceSocketBinding(remoteNetworkId)) {
+        return;
+    }
+    int32_t socket = BindClientSocket(remoteNetworkId);
+    if (socket >= DH_FWK_SUCCESS) {
+        if (!IsDeviceSocketBinding(remoteNetworkId)) {
+            Shutdown(socket);
+            return;
+        }
+        AddClientSocket(remoteNetworkId, socket);
+        OnDeviceSocketBound(remoteNetworkId, true);
+        return;
+    }
+    if (attempt < MAX_BIND_ATTEMPTS) {
+        int64_t delayMs = BIND_RETRY_BASE_MS << (attempt - 1);
+        DHLOGW("Bind attempt %{public}d failed, retry in %{public}" PRId64 " ms, deviceId: %{public}s", attempt,
+            delayMs, GetAnonyString(remoteNetworkId).c_str());
+        if (PostBindTask(remoteNetworkId, attempt + 1, delayMs)) {
+            return;
+        }
+    }
+    DHLOGE("Bind failed after %{public}d attempts, deviceId: %{public}s", attempt,
+        GetAnonyString(remoteNetworkId).c_str());
+    OnDeviceSocketBound(remoteNetworkId, false);
+}
+
+int32_t DHTransport::BindClientSocket(const std::string &remoteNetworkId)
+{
+    std::string perfKey = GetAnonyString(remoteNetworkId);
+    int64_t startUs = DHPerfStats::GetNowUs();
     int32_t socket = CreateClientSocket(remoteNetworkId);
     if (socket < DH_FWK_SUCCESS) {
         DHLOGE("StartSocket failed, ret: %{public}d", socket);
+        DHPerfStats::GetInstance().RecordCost(PerfCategory::SOCKET_BIND_FAIL, perfKey,
+            DHPerfStats::GetNowUs() - startUs);
         return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
     }
 
     int32_t ret = Bind(socket, g_qosInfo, g_qosTvParamIndex, &iSocketListener);
+    int64_t costUs = DHPerfStats::GetNowUs() - startUs;
     if (ret < DH_FWK_SUCCESS) {
         DHLOGE("OpenSession fail, remoteNetworkId: %{public}s, socket: %{public}d, ret: %{public}d",
             GetAnonyString(remoteNetworkId).c_str(), socket, ret);
         Shutdown(socket);
+        DHPerfStats::GetInstance().RecordCost(PerfCategory::SOCKET_BIND_FAIL, perfKey, costUs);
         return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
     }
+    DHPerfStats::GetInstance().RecordCost(PerfCategory::SOCKET_BIND, perfKey, costUs);
+    DHLOGI("Bind Socket success, remoteNetworkId:%{public}s, socketId: %{public}d, cost: %{public}" PRId64 " us",
+        GetAnonyString(remoteNetworkId).c_str(), socket, costUs);
+    return socket;
+}
 
-    DHLOGI("Bind Socket success, remoteNetworkId:%{public}s, socketId: %{public}d",
-        GetAnonyString(remoteNetworkId).c_str(), socket);
+void DHTransport::AddClientSocket(const std::string &remoteNetworkId, int32_t socketId)
+{
     std::string peerSocketName = DH_FWK_SESSION_NAME + remoteNetworkId.substr(0, INTERCEPT_STRING_LENGTH);
     PeerSocketInfo peerSocketInfo = {
         .name = const_cast<char*>(peerSocketName.c_str()),
@@ -461,8 +695,53 @@ int32_t DHTransport::StartSocket(const std::string &remoteNetworkId)
         .pkgName = const_cast<char*>(DH_FWK_PKG_NAME.c_str()),
         .dataType = DATA_TYPE_BYTES
     };
-    OnSocketOpened(socket, peerSocketInfo);
-    return DH_FWK_SUCCESS;
+    OnSocketOpened(socketId, peerSocketInfo);
+}
+
+bool DHTransport::SetDeviceSocketBinding(const std::string &remoteNetworkId, SocketReadyCallback callback)
+{
+    std::lock_guard<std::mutex> lock(sendQueueMtx_);
+    if (callback != nullptr) {
+        bindCallbacks_[remoteNetworkId].push_back(std::move(callback));
+    }
+    return bindingNetworkIds_.insert(remoteNetworkId).second;
+}
+
+bool DHTransport::IsDeviceSocketBinding(const std::string &remoteNetworkId)
+{
+    std::lock_guard<std::mutex> lock(sendQueueMtx_);
+    return bindingNetworkIds_.find(remoteNetworkId) != bindingNetworkIds_.end();
+}
+
+void DHTransport::OnDeviceSocketBound(const std::string &remoteNetworkId, bool isBound)
+{
+    std::vector<SocketReadyCallback> callbacks;
+    bool isFlushNeeded = false;
+    {
+        std::lock_guard<std::mutex> lock(sendQueueMtx_);
+        bindingNetworkIds_.erase(remoteNetworkId);
+        auto cbIter = bindCallbacks_.find(remoteNetworkId);
+        if (cbIter != bindCallbacks_.end()) {
+            callbacks.swap(cbIter->second);
+            bindCallbacks_.erase(cbIter);
+        }
+        auto iter = sendQueues_.find(remoteNetworkId);
+        if (iter != sendQueues_.end() && !isBound) {
+            DHLOGE("Bind failed, drop %{public}zu queued messages, target networkId: %{public}s",
+                iter->second.payloads.size(), GetAnonyString(remoteNetworkId).c_str());
+            sendQueues_.erase(iter);
+        } else if (iter != sendQueues_.end()) {
+            iter->second.isFlushPosted = true;
+            isFlushNeeded = true;
+        }
+    }
+    if (isFlushNeeded && !PostFlushTask(remoteNetworkId, 0)) {
+        FlushSendQueue(remoteNetworkId);
+    }
+    int32_t result = isBound ? DH_FWK_SUCCESS : ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
+    for (const auto &callback : callbacks) {
+        callback(remoteNetworkId, result);
+    }
 }
 
 int32_t DHTransport::StopSocket(const std::string &remoteNetworkId)
@@ -473,12 +752,18 @@ int32_t DHTransport::StopSocket(const std::string &remoteNetworkId)
     int32_t socketId = -1;
     if (!IsDeviceSessionOpened(remoteNetworkId, socketId)) {
         DHLOGI("remote dev may be not opened, remoteNetworkId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
+        if (IsDeviceSocketBinding(remoteNetworkId)) {
+            OnDeviceSocketBound(remoteNetworkId, false);
+        }
         return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
     }
 
     DHLOGI("StopSocket remoteNetworkId: %{public}s, socketId: %{public}d",
         GetAnonyString(remoteNetworkId).c_str(), socketId);
+    FlushSendQueue(remoteNetworkId);
     Shutdown(socketId);
+    RemoveSocketCodec(socketId);
+    RemovePeerFeatures(remoteNetworkId);
     ClearDeviceSocketOpened(remoteNetworkId);
     return DH_FWK_SUCCESS;
 }
@@ -489,11 +774,97 @@ int32_t DHTransport::Send(const std::string &remoteNetworkId, const std::string
         return ERR_DH_FWK_PARA_INVALID;
     }
     int32_t socketId = -1;
+    bool isOpened = IsDeviceSessionOpened(remoteNetworkId, socketId);
+    {
+        std::lock_guard<std::mutex> lock(sendQueueMtx_);
+        bool isBinding = bindingNetworkIds_.find(remoteNetworkId) != bindingNetworkIds_.end();
+        if (!isOpened && !isBinding) {
+            DHLOGI("The session is not open, target networkId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
+            return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
+        }
+        PeerSendQueue &queue = sendQueues_[remoteNetworkId];
+        if (queue.payloads.size() >= MAX_QUEUED_SEND_MSGS) {
+            DHLOGE("Send queue is full, target networkId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
+            return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
+        }
+        queue.payloads.push_back(payload);
+        // The bound socket flushes what was queued while binding.
+        if (queue.isFlushPosted || isBinding) {
+            return DH_FWK_SUCCESS;
+        }
+        queue.isFlushPosted = true;
+    }
+    if (!PostFlushTask(remoteNetworkId, SEND_COALESCE_WINDOW_MS)) {
+        return FlushSendQueue(remoteNetworkId);
+    }
+    return DH_FWK_SUCCESS;
+}
+
+bool DHTransport::PostFlushTask(const std::string &remoteNetworkId, int64_t delayMs)
+{
+    std::shared_ptr<DHCommTool> dhCommToolSPtr = dhCommToolWPtr_.lock();
+    if (dhCommToolSPtr == nullptr || dhCommToolSPtr->GetEventHandler() == nullptr) {
+        return false;
+    }
+    std::weak_ptr<DHCommTool> weakTool = dhCommToolSPtr;
+    auto flushTask = [weakTool, remoteNetworkId]() {
+        std::shared_ptr<DHCommTool> dhCommTool = weakTool.lock();
+        if (dhCommTool != nullptr && dhCommTool->GetDHTransportPtr() != nullptr) {
+            dhCommTool->GetDHTransportPtr()->FlushSendQueue(remoteNetworkId);
+        }
+    };
+    return dhCommToolSPtr->GetEventHandler()->PostTask(flushTask, remoteNetworkId + SEND_FLUSH_TASK_NAME, delayMs,
+        AppExecFwk::EventQueue::Priority::HIGH);
+}
+
+int32_t DHTransport::FlushSendQueue(const std::string &remoteNetworkId)
+{
+    std::vector<std::string> payloads;
+    {
+        std::lock_guard<std::mutex> lock(sendQueueMtx_);
+        auto iter = sendQueues_.find(remoteNetworkId);
+        if (iter == sendQueues_.end() || bindingNetworkIds_.find(remoteNetworkId) != bindingNetworkIds_.end()) {
+            return DH_FWK_SUCCESS;
+        }
+        payloads.swap(iter->second.payloads);
+        sendQueues_.erase(iter);
+    }
+    if (payloads.empty()) {
+        return DH_FWK_SUCCESS;
+    }
+    int32_t socketId = -1;
     if (!IsDeviceSessionOpened(remoteNetworkId, socketId)) {
-        DHLOGI("The session is not open, target networkId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
+        DHLOGE("The session is closed, drop %{public}zu messages, target networkId: %{public}s", payloads.size(),
+            GetAnonyString(remoteNetworkId).c_str());
+        return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
+    }
+    size_t msgCount = payloads.size();
+    std::vector<std::string> frames;
+    if (msgCount > 1 && IsPeerBatchSupported(remoteNetworkId)) {
+        PackBatches(payloads, frames);
+    } else {
+        frames.swap(payloads);
+    }
+    DHLOGI("Flush %{public}zu messages in %{public}zu frames, target networkId: %{public}s",
+        msgCount, frames.size(), GetAnonyString(remoteNetworkId).c_str());
+    int32_t ret = DH_FWK_SUCCESS;
+    for (const auto &frame : frames) {
+        if (SendFrame(remoteNetworkId, socketId, frame) != DH_FWK_SUCCESS) {
+            ret = ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
+        }
+    }
+    return ret;
+}
+
+int32_t DHTransport::SendFrame(const std::string &remoteNetworkId, int32_t socketId, const std::string &payload)
+{
+    // Plain zlib until the peer advertised our preset dictionary, an old peer could not inflate it.
+    bool usePresetDict = IsPeerDictMatched(remoteNetworkId);
+    std::string compressedPayLoad;
+    if (!GetSocketCodec(socketId)->Compress(payload.data(), payload.size(), compressedPayLoad, usePresetDict)) {
+        DHLOGE("Send: compress payload failed");
         return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
     }
-    std::string compressedPayLoad = Compress(payload);
     uint32_t compressedPayLoadSize = compressedPayLoad.size();
     DHLOGI("Send payload size: %{public}" PRIu32 ", after compressed size: %{public}" PRIu32
         ", target networkId: %{public}s, socketId: %{public}d", static_cast<uint32_t>(payload.size()),
@@ -503,30 +874,13 @@ int32_t DHTransport::Send(const std::string &remoteNetworkId, const std::string
         DHLOGE("Send error: msg size: %{public}" PRIu32 " too long", compressedPayLoadSize);
         return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
     }
-    uint8_t *buf = reinterpret_cast<uint8_t *>(calloc((compressedPayLoadSize + 1), sizeof(uint8_t)));
-    if (buf == nullptr) {
-        DHLOGE("Send: malloc memory failed");
-        return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
-    }
-
-    if (memcpy_s(buf, compressedPayLoadSize + 1, reinterpret_cast<const uint8_t *>(compressedPayLoad.c_str()),
-                 compressedPayLoadSize) != EOK) {
-        DHLOGE("Send: memcpy memory failed");
-        free(buf);
-        buf = nullptr;
-        return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
-    }
-
-    int32_t ret = SendBytes(socketId, buf, compressedPayLoadSize);
+    int32_t ret = SendBytes(socketId, compressedPayLoad.data(), compressedPayLoadSize);
     if (ret != DH_FWK_SUCCESS) {
         DHLOGE("dsoftbus send error, ret: %{public}d", ret);
-        free(buf);
-        buf = nullptr;
         return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
     }
+    DHPerfStats::GetInstance().RecordTraffic(remoteNetworkId, payload.size(), compressedPayLoadSize);
     DHLOGI("Send payload success");
-    free(buf);
-    buf = nullptr;
     return DH_FWK_SUCCESS;
 }
 } // DistributedHardware
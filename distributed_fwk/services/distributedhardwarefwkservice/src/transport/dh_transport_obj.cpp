@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,7 @@
 #include "dh_transport_obj.h"
 
 #include "dh_utils_tool.h"
+#include "dh_zlib_codec.h"
 #include "distributed_hardware_log.h"
 
 namespace OHOS {
@@ -104,6 +105,33 @@ void ToJson(cJSON *jsonObject, const CommMsg &commMsg)
     cJSON_AddStringToObject(jsonObject, COMM_MSG_MSG_KEY, msg);
     cJSON_AddStringToObject(jsonObject, COMM_MSG_ACCOUNTID_KEY, commMsg.accountId.c_str());
     cJSON_AddBoolToObject(jsonObject, COMM_MSG_SYNC_META_KEY, commMsg.isSyncMeta);
+    if (!commMsg.capsDigest.empty()) {
+        cJSON_AddStringToObject(jsonObject, COMM_MSG_CAPS_DIGEST_KEY, commMsg.capsDigest.c_str());
+    }
+    cJSON_AddNumberToObject(jsonObject, COMM_MSG_COMPRESS_DICT_KEY, DHZlibCodec::GetPresetDictId());
+    if (commMsg.capsGeneration != 0) {
+        cJSON_AddNumberToObject(jsonObject, COMM_MSG_CAPS_GEN_KEY, static_cast<double>(commMsg.capsGeneration));
+    }
+    if (commMsg.capsBaseGeneration != 0) {
+        cJSON_AddNumberToObject(jsonObject, COMM_MSG_CAPS_BASE_GEN_KEY,
+            static_cast<double>(commMsg.capsBaseGeneration));
+        cJSON *removedArr = cJSON_CreateArray();
+        if (removedArr == nullptr) {
+            return;
+        }
+        for (auto const &key : commMsg.removedCapKeys) {
+            cJSON_AddItemToArray(removedArr, cJSON_CreateString(key.c_str()));
+        }
+        cJSON_AddItemToObject(jsonObject, COMM_MSG_CAPS_REMOVED_KEY, removedArr);
+    }
+    if (commMsg.reqDHType != 0) {
+        cJSON_AddNumberToObject(jsonObject, COMM_MSG_REQ_DH_TYPE_KEY, commMsg.reqDHType);
+        cJSON_AddStringToObject(jsonObject, COMM_MSG_REQ_DH_ID_KEY, commMsg.reqDHId.c_str());
+    }
+    if (commMsg.isPartialCaps) {
+        cJSON_AddBoolToObject(jsonObject, COMM_MSG_CAPS_PARTIAL_KEY, commMsg.isPartialCaps);
+    }
+    cJSON_AddBoolToObject(jsonObject, COMM_MSG_BATCH_KEY, true);
 }
 
 void FromJson(const cJSON *jsonObject, CommMsg &commMsg)
@@ -136,6 +164,47 @@ void FromJson(const cJSON *jsonObject, CommMsg &commMsg)
     if (commMsgeSyncJson != NULL && cJSON_IsBool(commMsgeSyncJson)) {
         commMsg.isSyncMeta = commMsgeSyncJson->valueint;
     }
+    cJSON *commMsgeDigestJson = cJSON_GetObjectItem(jsonObject, COMM_MSG_CAPS_DIGEST_KEY);
+    if (commMsgeDigestJson != NULL && cJSON_IsString(commMsgeDigestJson)) {
+        commMsg.capsDigest = commMsgeDigestJson->valuestring;
+    }
+    cJSON *commMsgeDictJson = cJSON_GetObjectItem(jsonObject, COMM_MSG_COMPRESS_DICT_KEY);
+    if (IsUInt32(commMsgeDictJson)) {
+        commMsg.compressDictId = static_cast<uint32_t>(commMsgeDictJson->valuedouble);
+    }
+    cJSON *commMsgeGenJson = cJSON_GetObjectItem(jsonObject, COMM_MSG_CAPS_GEN_KEY);
+    if (commMsgeGenJson != NULL && cJSON_IsNumber(commMsgeGenJson) && commMsgeGenJson->valuedouble > 0) {
+        commMsg.capsGeneration = static_cast<uint64_t>(commMsgeGenJson->valuedouble);
+    }
+    cJSON *commMsgeBaseGenJson = cJSON_GetObjectItem(jsonObject, COMM_MSG_CAPS_BASE_GEN_KEY);
+    if (commMsgeBaseGenJson != NULL && cJSON_IsNumber(commMsgeBaseGenJson) && commMsgeBaseGenJson->valuedouble > 0) {
+        commMsg.capsBaseGeneration = static_cast<uint64_t>(commMsgeBaseGenJson->valuedouble);
+    }
+    cJSON *commMsgeRemovedJson = cJSON_GetObjectItem(jsonObject, COMM_MSG_CAPS_REMOVED_KEY);
+    if (IsArray(commMsgeRemovedJson)) {
+        cJSON *keyJson = nullptr;
+        cJSON_ArrayForEach(keyJson, commMsgeRemovedJson) {
+            if (IsString(keyJson)) {
+                commMsg.removedCapKeys.push_back(keyJson->valuestring);
+            }
+        }
+    }
+    cJSON *commMsgeReqTypeJson = cJSON_GetObjectItem(jsonObject, COMM_MSG_REQ_DH_TYPE_KEY);
+    if (IsUInt32(commMsgeReqTypeJson)) {
+        commMsg.reqDHType = static_cast<uint32_t>(commMsgeReqTypeJson->valuedouble);
+    }
+    cJSON *commMsgeReqIdJson = cJSON_GetObjectItem(jsonObject, COMM_MSG_REQ_DH_ID_KEY);
+    if (IsString(commMsgeReqIdJson)) {
+        commMsg.reqDHId = commMsgeReqIdJson->valuestring;
+    }
+    cJSON *commMsgePartialJson = cJSON_GetObjectItem(jsonObject, COMM_MSG_CAPS_PARTIAL_KEY);
+    if (commMsgePartialJson != NULL && cJSON_IsBool(commMsgePartialJson)) {
+        commMsg.isPartialCaps = cJSON_IsTrue(commMsgePartialJson);
+    }
+    cJSON *commMsgeBatchJson = cJSON_GetObjectItem(jsonObject, COMM_MSG_BATCH_KEY);
+    if (commMsgeBatchJson != NULL && cJSON_IsBool(commMsgeBatchJson)) {
+        commMsg.isBatchSupported = cJSON_IsTrue(commMsgeBatchJson);
+    }
 }
 
 std::string GetCommMsgString(const CommMsg &commMsg)
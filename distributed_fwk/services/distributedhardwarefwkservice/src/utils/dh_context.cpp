@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -36,6 +36,120 @@ namespace {
     constexpr int32_t OLD_HO_DEVICE_TYPE = -1;
     constexpr int32_t NEW_HO_DEVICE_TYPE = 11;
 }
+bool DeviceIdEntrySet::insert(const DeviceIdEntry &entry)
+{
+    auto result = entries_.insert(entry);
+    if (!result.second) {
+        return false;
+    }
+    const DeviceIdEntry *saved = &(*result.first);
+    AddToIndex(networkIdIndex_, saved->networkId, saved);
+    AddToIndex(uuidIndex_, saved->uuid, saved);
+    AddToIndex(udidIndex_, saved->udid, saved);
+    AddToIndex(deviceIdIndex_, saved->deviceId, saved);
+    AddToIndex(udidHashIndex_, saved->udidHash, saved);
+    return true;
+}
+
+void DeviceIdEntrySet::erase(const DeviceIdEntry &entry)
+{
+    auto iter = entries_.find(entry);
+    if (iter == entries_.end()) {
+        return;
+    }
+    const DeviceIdEntry *saved = &(*iter);
+    RemoveFromIndex(networkIdIndex_, saved->networkId, saved);
+    RemoveFromIndex(uuidIndex_, saved->uuid, saved);
+    RemoveFromIndex(udidIndex_, saved->udid, saved);
+    RemoveFromIndex(deviceIdIndex_, saved->deviceId, saved);
+    RemoveFromIndex(udidHashIndex_, saved->udidHash, saved);
+    entries_.erase(iter);
+}
+
+void DeviceIdEntrySet::clear()
+{
+    networkIdIndex_.clear();
+    uuidIndex_.clear();
+    udidIndex_.clear();
+    deviceIdIndex_.clear();
+    udidHashIndex_.clear();
+    entries_.clear();
+}
+
+bool DeviceIdEntrySet::empty() const
+{
+    return entries_.empty();
+}
+
+size_t DeviceIdEntrySet::size() const
+{
+    return entries_.size();
+}
+
+DeviceIdEntrySet::ConstIterator DeviceIdEntrySet::begin() const
+{
+    return entries_.begin();
+}
+
+DeviceIdEntrySet::ConstIterator DeviceIdEntrySet::end() const
+{
+    return entries_.end();
+}
+
+const DeviceIdEntry *DeviceIdEntrySet::FindByNetworkId(const std::string &networkId) const
+{
+    return FindInIndex(networkIdIndex_, networkId);
+}
+
+const DeviceIdEntry *DeviceIdEntrySet::FindByUuid(const std::string &uuid) const
+{
+    return FindInIndex(uuidIndex_, uuid);
+}
+
+const DeviceIdEntry *DeviceIdEntrySet::FindByUdid(const std::string &udid) const
+{
+    return FindInIndex(udidIndex_, udid);
+}
+
+const DeviceIdEntry *DeviceIdEntrySet::FindByDeviceId(const std::string &deviceId) const
+{
+    return FindInIndex(deviceIdIndex_, deviceId);
+}
+
+const DeviceIdEntry *DeviceIdEntrySet::FindByUdidHash(const std::string &udidHash) const
+{
+    return FindInIndex(udidHashIndex_, udidHash);
+}
+
+void DeviceIdEntrySet::AddToIndex(Index &index, const std::string &key, const DeviceIdEntry *entry)
+{
+    index[key].push_back(entry);
+}
+
+void DeviceIdEntrySet::RemoveFromIndex(Index &index, const std::string &key, const DeviceIdEntry *entry)
+{
+    auto iter = index.find(key);
+    if (iter == index.end()) {
+        return;
+    }
+    auto &entries = iter->second;
+    entries.erase(std::remove(entries.begin(), entries.end(), entry), entries.end());
+    if (entries.empty()) {
+        index.erase(iter);
+    }
+}
+
+const DeviceIdEntry *DeviceIdEntrySet::FindInIndex(const Index &index, const std::string &key)
+{
+    auto iter = index.find(key);
+    if (iter == index.end() || iter->second.empty()) {
+        return nullptr;
+    }
+    // Ids are unique but while an old entry of a device waits for its offline, take the first as a scan would.
+    return *std::min_element(iter->second.begin(), iter->second.end(),
+        [](const DeviceIdEntry *lhs, const DeviceIdEntry *rhs) { return *lhs < *rhs; });
+}
+
 FWK_IMPLEMENT_SINGLE_INSTANCE(DHContext);
 DHContext::DHContext()
 {
@@ -78,9 +192,36 @@ const DeviceInfo& DHContext::GetDeviceInfo()
         return devInfo_;
     }
     devInfo_ = GetLocalDeviceInfo();
+    PublishDeviceInfoLocked();
     return devInfo_;
 }
 
+std::shared_ptr<const DeviceInfo> DHContext::GetDeviceInfoSnapshot()
+{
+    std::shared_ptr<const DeviceInfo> snapshot = std::atomic_load(&devInfoSnapshot_);
+    if (snapshot != nullptr && !snapshot->uuid.empty()) {
+        return snapshot;
+    }
+    std::lock_guard<std::mutex> lock(devMutex_);
+    if (devInfo_.uuid.empty()) {
+        devInfo_ = GetLocalDeviceInfo();
+    }
+    PublishDeviceInfoLocked();
+    return std::atomic_load(&devInfoSnapshot_);
+}
+
+void DHContext::PublishDeviceInfoLocked()
+{
+    std::shared_ptr<const DeviceInfo> snapshot = std::atomic_load(&devInfoSnapshot_);
+    if (snapshot != nullptr && snapshot->networkId == devInfo_.networkId && snapshot->uuid == devInfo_.uuid &&
+        snapshot->deviceId == devInfo_.deviceId && snapshot->udid == devInfo_.udid &&
+        snapshot->udidHash == devInfo_.udidHash && snapshot->deviceName == devInfo_.deviceName &&
+        snapshot->deviceType == devInfo_.deviceType) {
+        return;
+    }
+    std::atomic_store(&devInfoSnapshot_, std::make_shared<const DeviceInfo>(devInfo_));
+}
+
 void DHContext::AddOnlineDevice(const std::string &udid, const std::string &uuid, const std::string &networkId)
 {
     if (!IsIdLengthValid(udid) || !IsIdLengthValid(uuid) || !IsIdLengthValid(networkId)) {
@@ -109,11 +250,9 @@ void DHContext::RemoveOnlineDeviceIdEntryByNetworkId(const std::string &networkI
         return;
     }
     std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->networkId == networkId) {
-            devIdEntrySet_.erase(iter);
-            break;
-        }
+    const DeviceIdEntry *entry = devIdEntrySet_.FindByNetworkId(networkId);
+    if (entry != nullptr) {
+        devIdEntrySet_.erase(*entry);
     }
 }
 
@@ -123,14 +262,7 @@ bool DHContext::IsDeviceOnline(const std::string &uuid)
         return false;
     }
     std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
-    bool flag = false;
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->uuid == uuid) {
-            flag = true;
-            break;
-        }
-    }
-    return flag;
+    return devIdEntrySet_.FindByUuid(uuid) != nullptr;
 }
 
 size_t DHContext::GetOnlineCount()
@@ -144,15 +276,9 @@ std::string DHContext::GetNetworkIdByUUID(const std::string &uuid)
     if (!IsIdLengthValid(uuid)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string networkId = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->uuid == uuid) {
-            networkId = iter->networkId;
-            break;
-        }
-    }
-    return networkId;
+    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
+    const DeviceIdEntry *entry = devIdEntrySet_.FindByUuid(uuid);
+    return entry == nullptr ? "" : entry->networkId;
 }
 
 std::string DHContext::GetNetworkIdByUDID(const std::string &udid)
@@ -160,15 +286,9 @@ std::string DHContext::GetNetworkIdByUDID(const std::string &udid)
     if (!IsIdLengthValid(udid)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string networkId = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->udid == udid) {
-            networkId = iter->networkId;
-            break;
-        }
-    }
-    return networkId;
+    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
+    const DeviceIdEntry *entry = devIdEntrySet_.FindByUdid(udid);
+    return entry == nullptr ? "" : entry->networkId;
 }
 
 std::string DHContext::GetUdidHashIdByUUID(const std::string &uuid)
@@ -176,15 +296,9 @@ std::string DHContext::GetUdidHashIdByUUID(const std::string &uuid)
     if (!IsIdLengthValid(uuid)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string udidHash = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->uuid == uuid) {
-            udidHash = iter->udidHash;
-            break;
-        }
-    }
-    return udidHash;
+    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
+    const DeviceIdEntry *entry = devIdEntrySet_.FindByUuid(uuid);
+    return entry == nullptr ? "" : entry->udidHash;
 }
 
 std::string DHContext::GetUUIDByNetworkId(const std::string &networkId)
@@ -192,15 +306,9 @@ std::string DHContext::GetUUIDByNetworkId(const std::string &networkId)
     if (!IsIdLengthValid(networkId)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string uuid = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->networkId == networkId) {
-            uuid = iter->uuid;
-            break;
-        }
-    }
-    return uuid;
+    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
+    const DeviceIdEntry *entry = devIdEntrySet_.FindByNetworkId(networkId);
+    return entry == nullptr ? "" : entry->uuid;
 }
 
 std::string DHContext::GetUDIDByNetworkId(const std::string &networkId)
@@ -208,15 +316,9 @@ std::string DHContext::GetUDIDByNetworkId(const std::string &networkId)
     if (!IsIdLengthValid(networkId)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string udid = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->networkId == networkId) {
-            udid = iter->udid;
-            break;
-        }
-    }
-    return udid;
+    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
+    const DeviceIdEntry *entry = devIdEntrySet_.FindByNetworkId(networkId);
+    return entry == nullptr ? "" : entry->udid;
 }
 
 std::string DHContext::GetUUIDByDeviceId(const std::string &deviceId)
@@ -224,15 +326,14 @@ std::string DHContext::GetUUIDByDeviceId(const std::string &deviceId)
     if (!IsIdLengthValid(deviceId)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string uuid = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->deviceId == deviceId || iter->udidHash == deviceId) {
-            uuid = iter->uuid;
-            break;
-        }
+    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
+    // The id may be a uuid hash or an udid hash, the first matching entry in set order wins.
+    const DeviceIdEntry *entry = devIdEntrySet_.FindByDeviceId(deviceId);
+    const DeviceIdEntry *udidHashEntry = devIdEntrySet_.FindByUdidHash(deviceId);
+    if (entry == nullptr || (udidHashEntry != nullptr && *udidHashEntry < *entry)) {
+        entry = udidHashEntry;
     }
-    return uuid;
+    return entry == nullptr ? "" : entry->uuid;
 }
 
 std::string DHContext::GetNetworkIdByDeviceId(const std::string &deviceId)
@@ -240,20 +341,14 @@ std::string DHContext::GetNetworkIdByDeviceId(const std::string &deviceId)
     if (!IsIdLengthValid(deviceId)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string networkId = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->deviceId == deviceId) {
-            networkId = iter->networkId;
-            break;
-        }
-    }
-    return networkId;
+    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
+    const DeviceIdEntry *entry = devIdEntrySet_.FindByDeviceId(deviceId);
+    return entry == nullptr ? "" : entry->networkId;
 }
 
 void DHContext::GetOnlineDeviceUdidHash(std::vector<std::string> &udidHashVec)
 {
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
+    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
     for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
         udidHashVec.push_back(iter->udidHash);
     }
@@ -261,7 +356,7 @@ void DHContext::GetOnlineDeviceUdidHash(std::vector<std::string> &udidHashVec)
 
 void DHContext::GetOnlineDeviceDeviceId(std::vector<std::string> &deviceIdVec)
 {
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
+    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
     for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
         deviceIdVec.push_back(iter->deviceId);
     }
@@ -437,7 +532,7 @@ uint16_t DHContext::GetDeviceTypeByNetworkId(const std::string &networkId)
         DHLOGE("NetworkId not exist.");
         return static_cast<uint16_t>(DmDeviceType::DEVICE_TYPE_UNKNOWN);
     }
-    return onlineDevTypeMap_[networkId];
+    return iter->second;
 }
 
 std::string DHContext::GetDeviceIdByNetworkId(const std::string &networkId)
@@ -445,15 +540,9 @@ std::string DHContext::GetDeviceIdByNetworkId(const std::string &networkId)
     if (!IsIdLengthValid(networkId)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string deviceId = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->networkId == networkId) {
-            deviceId = iter->deviceId;
-            break;
-        }
-    }
-    return deviceId;
+    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
+    const DeviceIdEntry *entry = devIdEntrySet_.FindByNetworkId(networkId);
+    return entry == nullptr ? "" : entry->deviceId;
 }
 
 void DHContext::AddOnlineDeviceOSType(const std::string &networkId, int32_t osType)
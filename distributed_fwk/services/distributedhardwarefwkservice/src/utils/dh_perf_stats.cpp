@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dh_perf_stats.h"
+
+#include <chrono>
+
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DHPerfStats"
+
+FWK_IMPLEMENT_SINGLE_INSTANCE(DHPerfStats);
+
+int64_t DHPerfStats::GetNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void DHPerfStats::RecordCost(PerfCategory category, const std::string &key, int64_t costUs)
+{
+    if (category >= PerfCategory::MAX) {
+        DHLOGE("Perf category is invalid: %{public}u", static_cast<uint32_t>(category));
+        return;
+    }
+    costUs = costUs > 0 ? costUs : 0;
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    auto &categoryStats = costStats_[static_cast<size_t>(category)];
+    auto iter = categoryStats.find(key);
+    if (iter == categoryStats.end()) {
+        if (categoryStats.size() >= MAX_PERF_KEYS) {
+            return;
+        }
+        iter = categoryStats.emplace(key, PerfCostStat {}).first;
+    }
+    PerfCostStat &stat = iter->second;
+    stat.count++;
+    stat.totalUs += costUs;
+    stat.maxUs = costUs > stat.maxUs ? costUs : stat.maxUs;
+    size_t bucket = 0;
+    while (bucket < PERF_BUCKET_BOUNDS_US.size() && costUs > PERF_BUCKET_BOUNDS_US[bucket]) {
+        bucket++;
+    }
+    stat.buckets[bucket]++;
+}
+
+void DHPerfStats::RecordTraffic(const std::string &networkId, uint64_t rawBytes, uint64_t sentBytes)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    auto iter = trafficStats_.find(networkId);
+    if (iter == trafficStats_.end()) {
+        if (trafficStats_.size() >= MAX_PERF_KEYS) {
+            return;
+        }
+        iter = trafficStats_.emplace(networkId, PerfTrafficStat {}).first;
+    }
+    iter->second.msgCount++;
+    iter->second.rawBytes += rawBytes;
+    iter->second.sentBytes += sentBytes;
+}
+
+void DHPerfStats::DumpCostStats(PerfCategory category, std::map<std::string, PerfCostStat> &costStats)
+{
+    if (category >= PerfCategory::MAX) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    costStats = costStats_[static_cast<size_t>(category)];
+}
+
+void DHPerfStats::DumpTrafficStats(std::map<std::string, PerfTrafficStat> &trafficStats)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    trafficStats = trafficStats_;
+}
+
+void DHPerfStats::Reset()
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    for (auto &categoryStats : costStats_) {
+        categoryStats.clear();
+    }
+    trafficStats_.clear();
+}
+
+PerfCostScope::PerfCostScope(PerfCategory category, const std::string &key) : category_(category), key_(key),
+    startUs_(DHPerfStats::GetNowUs())
+{
+}
+
+PerfCostScope::~PerfCostScope()
+{
+    DHPerfStats::GetInstance().RecordCost(category_, key_, DHPerfStats::GetNowUs() - startUs_);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,93 +15,69 @@
 
 #include "dh_timer.h"
 
-#include <pthread.h>
+#include <atomic>
 
-#include "anonymous_string.h"
-#include "constants.h"
-#include "distributed_hardware_errno.h"
+#include "dh_timer_service.h"
 #include "distributed_hardware_log.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 namespace {
-    constexpr const char *EVENT_RUN = "EventRun";
+    std::atomic<uint32_t> g_timerSeq {0};
 }
 
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "DHTimer"
 
-DHTimer::DHTimer(std::string timerId, int32_t delayTimeMs) : timerId_(timerId), delayTimeMs_(delayTimeMs)
+DHTimer::DHTimer(std::string timerId, int32_t delayTimeMs) : state_(std::make_shared<TimerState>()),
+    timerId_(timerId), taskName_(timerId + "_" + std::to_string(g_timerSeq++)), delayTimeMs_(delayTimeMs)
 {
     DHLOGI("DHTimer ctor!");
+    state_->timer = this;
 }
 
 DHTimer::~DHTimer()
 {
     DHLOGI("DHTimer dtor!");
     ReleaseTimer();
-}
-
-void DHTimer::InitTimer()
-{
-    DHLOGI("start");
-    std::unique_lock<std::mutex> lock(timerMutex_);
-    if (eventHandler_ == nullptr) {
-        eventHandlerThread_ = std::thread([this]() { this->StartEventRunner(); });
-        timerCond_.wait(lock, [this] { return eventHandler_ != nullptr; });
-    }
-    DHLOGI("end");
+    std::lock_guard<std::recursive_mutex> lock(state_->mutex);
+    state_->timer = nullptr;
 }
 
 void DHTimer::ReleaseTimer()
 {
     DHLOGI("start");
-    std::lock_guard<std::mutex> lock(timerMutex_);
-    if (eventHandler_ != nullptr) {
-        eventHandler_->RemoveTask(timerId_);
-        if (eventHandler_->GetEventRunner() != nullptr) {
-            eventHandler_->GetEventRunner()->Stop();
-        }
-    }
-    if (eventHandlerThread_.joinable()) {
-        eventHandlerThread_.join();
-    }
-    eventHandler_ = nullptr;
+    DHTimerService::GetInstance().RemoveTask(taskName_);
+    std::lock_guard<std::recursive_mutex> lock(state_->mutex);
+    state_->generation++;
     DHLOGI("end");
 }
 
-void DHTimer::StartEventRunner()
+void DHTimer::PostTimerTask(void (DHTimer::*func)())
 {
-    DHLOGI("start");
-    int32_t ret = pthread_setname_np(pthread_self(), EVENT_RUN);
-    if (ret != DH_FWK_SUCCESS) {
-        DHLOGE("StartEventRunner setname failed.");
-    }
-    auto busRunner = AppExecFwk::EventRunner::Create(false);
-    if (busRunner == nullptr) {
-        DHLOGE("busRunner is nullptr!");
-        return;
-    }
-    {
-        std::lock_guard<std::mutex> lock(timerMutex_);
-        eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(busRunner);
+    std::lock_guard<std::recursive_mutex> lock(state_->mutex);
+    std::weak_ptr<TimerState> weakState = state_;
+    uint64_t generation = state_->generation;
+    auto task = [weakState, generation, func]() {
+        std::shared_ptr<TimerState> state = weakState.lock();
+        if (state == nullptr) {
+            return;
+        }
+        std::lock_guard<std::recursive_mutex> lock(state->mutex);
+        if (state->timer == nullptr || state->generation != generation) {
+            return;
+        }
+        (state->timer->*func)();
+    };
+    if (!DHTimerService::GetInstance().PostTask(taskName_, task, delayTimeMs_)) {
+        DHLOGE("post timer task failed, timerId: %{public}s", timerId_.c_str());
     }
-    timerCond_.notify_all();
-    busRunner->Run();
-    DHLOGI("end");
 }
 
 void DHTimer::StartTimer()
 {
     DHLOGI("start");
-    InitTimer();
-    std::lock_guard<std::mutex> lock(timerMutex_);
-    if (eventHandler_ == nullptr) {
-        DHLOGE("eventHandler is nullptr");
-        return;
-    }
-    auto executeFunc = [this] { Execute(); };
-    eventHandler_->PostTask(executeFunc, timerId_, delayTimeMs_);
+    PostTimerTask(&DHTimer::Execute);
 }
 
 void DHTimer::StopTimer()
@@ -115,13 +91,7 @@ void DHTimer::StopTimer()
 void DHTimer::Execute()
 {
     DHLOGI("start");
-    std::lock_guard<std::mutex> lock(timerMutex_);
-    if (eventHandler_ == nullptr) {
-        DHLOGE("eventHandler is nullptr!");
-        return;
-    }
-    auto executeInnerFunc = [this] { ExecuteInner(); };
-    eventHandler_->PostTask(executeInnerFunc, timerId_, delayTimeMs_);
+    PostTimerTask(&DHTimer::ExecuteInner);
 }
 } // namespace DistributedHardware
 } // namespace OHOS
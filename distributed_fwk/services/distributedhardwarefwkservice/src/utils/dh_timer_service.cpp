@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dh_timer_service.h"
+
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+    const std::string DH_TIMER_THREAD = "dh_timer";
+}
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DHTimerService"
+
+FWK_IMPLEMENT_SINGLE_INSTANCE(DHTimerService);
+bool DHTimerService::PostTask(const std::string &name, const std::function<void()> &task, int64_t delayTimeMs)
+{
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler = GetEventHandler();
+    if (eventHandler == nullptr) {
+        DHLOGE("eventHandler is nullptr, task: %{public}s", name.c_str());
+        return false;
+    }
+    return eventHandler->PostTask(task, name, delayTimeMs);
+}
+
+void DHTimerService::RemoveTask(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(handlerMutex_);
+    if (eventHandler_ != nullptr) {
+        eventHandler_->RemoveTask(name);
+    }
+}
+
+std::shared_ptr<AppExecFwk::EventHandler> DHTimerService::GetEventHandler()
+{
+    std::lock_guard<std::mutex> lock(handlerMutex_);
+    if (eventHandler_ == nullptr) {
+        auto runner = AppExecFwk::EventRunner::Create(DH_TIMER_THREAD);
+        if (runner == nullptr) {
+            DHLOGE("create timer runner failed");
+            return nullptr;
+        }
+        eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
+    return eventHandler_;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -99,6 +99,18 @@ public:
         return 0;
     }
     
+    int32_t GetDistributedHardwareBatch(const std::vector<std::string> &networkIds, EnableStep enableStep,
+        const sptr<IGetDhDescriptorsCallback> callback) override
+    {
+        return 0;
+    }
+
+    int32_t GetDistributedHardwareByType(const std::string &networkId, DHType dhType, const std::string &dhId,
+        EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback) override
+    {
+        return 0;
+    }
+    
     int32_t RegisterDHStatusListener(sptr<IHDSinkStatusListener> listener) override
     {
         return 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -297,6 +297,57 @@ HWTEST_F(AccessManagerTest, OnDeviceOffline_003, TestSize.Level1)
     DHContext::GetInstance().RemoveOnlineDeviceIdEntryByNetworkId(TEST_NETWORKID);
 }
 
+/**
+ * @tc.name: OnDeviceOffline_004
+ * @tc.desc: Verify the offline event waits for the grace window and is sent once it expires
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(AccessManagerTest, OnDeviceOffline_004, TestSize.Level1)
+{
+    DmDeviceInfo deviceInfo = {
+        .deviceId = "123456789",
+        .deviceName = "deviceName_test",
+        .deviceTypeId = 1,
+        .networkId = "111111"
+    };
+    auto accessManager = AccessManager::GetInstance();
+    DHContext::GetInstance().AddOnlineDevice(TEST_UDID, TEST_UUID, TEST_NETWORKID);
+    accessManager->OnDeviceOffline(deviceInfo);
+    ASSERT_EQ(1, accessManager->pendingOfflines_.count(TEST_NETWORKID));
+    EXPECT_EQ(TEST_UUID, accessManager->pendingOfflines_[TEST_NETWORKID].uuid);
+
+    std::vector<DeviceFlapDump> flapInfos;
+    uint64_t totalSuppressed = 0;
+    accessManager->DumpDeviceFlaps(flapInfos, totalSuppressed);
+    ASSERT_EQ(1, flapInfos.size());
+    EXPECT_TRUE(flapInfos[0].offlinePending);
+
+    accessManager->OnOfflineGraceExpired(TEST_NETWORKID);
+    EXPECT_EQ(0, accessManager->pendingOfflines_.count(TEST_NETWORKID));
+    ASSERT_NO_FATAL_FAILURE(accessManager->OnOfflineGraceExpired(TEST_NETWORKID));
+    DHContext::GetInstance().RemoveOnlineDeviceIdEntryByNetworkId(TEST_NETWORKID);
+}
+
+/**
+ * @tc.name: TakeDeferredOffline_001
+ * @tc.desc: Verify taking a deferred offline cancels it
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(AccessManagerTest, TakeDeferredOffline_001, TestSize.Level1)
+{
+    auto accessManager = AccessManager::GetInstance();
+    AccessManager::PendingOffline offline;
+    EXPECT_FALSE(accessManager->TakeDeferredOffline(TEST_NETWORKID, offline));
+
+    accessManager->pendingOfflines_[TEST_NETWORKID] = { TEST_UUID, TEST_UDID, TEST_DEV_TYPE_PAD };
+    EXPECT_TRUE(accessManager->TakeDeferredOffline(TEST_NETWORKID, offline));
+    EXPECT_EQ(TEST_UDID, offline.udid);
+    EXPECT_EQ(TEST_DEV_TYPE_PAD, offline.deviceType);
+    EXPECT_TRUE(accessManager->pendingOfflines_.empty());
+}
+
 /**
  * @tc.name: CheckExitSAOrNot_001
  * @tc.desc: Verify the CheckExitSAOrNot function
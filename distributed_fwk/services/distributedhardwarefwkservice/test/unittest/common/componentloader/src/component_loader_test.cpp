@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -585,6 +585,25 @@ HWTEST_F(ComponentLoaderTest, IsDHTypeSupport_001, TestSize.Level1)
     EXPECT_EQ(ret, false);
 }
 
+HWTEST_F(ComponentLoaderTest, GetAllHandler_001, TestSize.Level1)
+{
+    ComponentLoader::GetInstance().compHandlerMap_.clear();
+    CompConfig config = {
+        .name = "name",
+        .type = DHType::AUDIO,
+        .compSourceSaId = 4801,
+        .compSinkSaId = 4802
+    };
+    std::map<DHType, CompConfig> dhtypeMap = { { DHType::AUDIO, config } };
+    ComponentLoader::GetInstance().GetAllHandler(dhtypeMap);
+    EXPECT_TRUE(ComponentLoader::GetInstance().IsDHTypeSupport(DHType::AUDIO));
+    EXPECT_FALSE(ComponentLoader::GetInstance().IsDHTypeHandlerLoaded(DHType::AUDIO));
+    EXPECT_FALSE(ComponentLoader::GetInstance().IsDHTypeSourceLoaded(DHType::AUDIO));
+    EXPECT_FALSE(ComponentLoader::GetInstance().IsDHTypeSinkLoaded(DHType::AUDIO));
+    EXPECT_EQ(ERR_DH_FWK_LOADER_SOURCE_UNLOAD, ComponentLoader::GetInstance().ReleaseSource(DHType::AUDIO));
+    ComponentLoader::GetInstance().compHandlerMap_.clear();
+}
+
 HWTEST_F(ComponentLoaderTest, ParseSourceFeatureFiltersFromJson_001, TestSize.Level1)
 {
     CompConfig config;
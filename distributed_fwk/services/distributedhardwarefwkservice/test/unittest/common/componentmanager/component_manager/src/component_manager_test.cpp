@@ -976,6 +976,37 @@ HWTEST_F(ComponentManagerTest, DoRecover_002, TestSize.Level1)
     EXPECT_EQ(true, ComponentManager::GetInstance().compSource_.empty());
 }
 
+/**
+ * @tc.name: DoRecover_003
+ * @tc.desc: Verify the DoRecover function records the recovery for hidump
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(ComponentManagerTest, DoRecover_003, TestSize.Level1)
+{
+    ComponentManager::GetInstance().recoverInfos_.clear();
+    ComponentManager::GetInstance().DoRecover(DHType::AUDIO);
+    std::vector<RecoverDump> recoverInfos;
+    ComponentManager::GetInstance().DumpRecoverInfos(recoverInfos);
+    ASSERT_EQ(recoverInfos.size(), 1);
+    EXPECT_EQ(recoverInfos[0].dhType, DHType::AUDIO);
+    EXPECT_EQ(recoverInfos[0].taskCount, 0);
+    EXPECT_GE(recoverInfos[0].costMs, 0);
+}
+
+/**
+ * @tc.name: RunRecoverTasks_001
+ * @tc.desc: Verify the RunRecoverTasks function
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(ComponentManagerTest, RunRecoverTasks_001, TestSize.Level1)
+{
+    std::vector<TaskParam> recoverParams;
+    EXPECT_EQ(ComponentManager::GetInstance().RunRecoverTasks(recoverParams), 0);
+    EXPECT_EQ(ComponentManager::GetInstance().runningRecoverTasks_, 0);
+}
+
 /**
  * @tc.name: RetryGetEnableParam_001
  * @tc.desc: Verify the RetryGetEnableParam function
@@ -991,6 +1022,35 @@ HWTEST_F(ComponentManagerTest, RetryGetEnableParam_001, TestSize.Level1)
     EXPECT_EQ(ret, ERR_DH_FWK_COMPONENT_ENABLE_FAILED);
 }
 
+/**
+ * @tc.name: RetryGetEnableParam_002
+ * @tc.desc: Verify the RetryGetEnableParam function fails once the wait deadline passes
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(ComponentManagerTest, RetryGetEnableParam_002, TestSize.Level1)
+{
+    DHType dhType = DHType::CAMERA;
+    EnableParam param;
+    DHContext::GetInstance().AddOnlineDevice(UDID_TEST, UUID_TEST, NETWORK_TEST);
+    auto ret = ComponentManager::GetInstance().RetryGetEnableParam(NETWORK_TEST, UUID_TEST, DH_ID_1, dhType, param);
+    EXPECT_EQ(ret, ERR_DH_FWK_COMPONENT_GET_ENABLE_PARAM_FAILED);
+    DHContext::GetInstance().devIdEntrySet_.clear();
+}
+
+/**
+ * @tc.name: NotifyCapabilityAvailable_001
+ * @tc.desc: Verify the NotifyCapabilityAvailable function
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(ComponentManagerTest, NotifyCapabilityAvailable_001, TestSize.Level1)
+{
+    uint64_t seq = ComponentManager::GetInstance().capAvailableSeq_;
+    ComponentManager::GetInstance().NotifyCapabilityAvailable();
+    EXPECT_EQ(seq + 1, ComponentManager::GetInstance().capAvailableSeq_);
+}
+
 /**
  * @tc.name: IsIdenticalAccount_001
  * @tc.desc: Verify the IsIdenticalAccount function
@@ -1602,11 +1662,45 @@ HWTEST_F(ComponentManagerTest, OnGetDescriptors_002, TestSize.Level0)
     descriptor.id = "camera_1";
     descriptor.dhType = DHType::CAMERA;
     descriptors.push_back(descriptor);
-    ComponentManager::GetInstance().syncDeviceInfoMap_[realNetworkId] = {enableStep, {nullptr}};
+    ComponentManager::GetInstance().syncDeviceInfoMap_[realNetworkId] = {enableStep, {{nullptr}}};
     ComponentManager::GetInstance().OnGetDescriptors("realNetworkId_test", descriptors);
     EXPECT_FALSE(ComponentManager::GetInstance().syncDeviceInfoMap_.empty());
 }
 
+HWTEST_F(ComponentManagerTest, OnGetDescriptors_003, TestSize.Level0)
+{
+    ComponentManager::GetInstance().syncDeviceInfoMap_.clear();
+    std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create(true);
+    ComponentManager::GetInstance().eventHandler_ =
+        std::make_shared<ComponentManager::ComponentManagerEventHandler>(runner);
+    std::string realNetworkId = "realNetworkId_1";
+    sptr<IGetDhDescriptorsCallback> callback(new TestGetDistributedHardwareCallback());
+    ComponentManager::GetInstance().syncDeviceInfoMap_[realNetworkId] = {EnableStep::ENABLE_SOURCE,
+        {{callback, DHType::CAMERA, ""}, {callback, DHType::AUDIO, ""}, {callback}}};
+    std::vector<DHDescriptor> descriptors = {{"camera_1", DHType::CAMERA, ""}};
+    ComponentManager::GetInstance().OnGetDescriptors(realNetworkId, descriptors, true);
+    auto iter = ComponentManager::GetInstance().syncDeviceInfoMap_.find(realNetworkId);
+    ASSERT_TRUE(iter != ComponentManager::GetInstance().syncDeviceInfoMap_.end());
+    EXPECT_EQ(2u, iter->second.second.size());
+
+    descriptors.push_back({"mic_1", DHType::AUDIO, ""});
+    ComponentManager::GetInstance().OnGetDescriptors(realNetworkId, descriptors);
+    EXPECT_TRUE(ComponentManager::GetInstance().syncDeviceInfoMap_.empty());
+    ComponentManager::GetInstance().eventHandler_ = nullptr;
+}
+
+HWTEST_F(ComponentManagerTest, FilterDescriptors_001, TestSize.Level0)
+{
+    std::vector<DHDescriptor> descriptors = {{"camera_1", DHType::CAMERA, ""}, {"camera_2", DHType::CAMERA, ""},
+        {"mic_1", DHType::AUDIO, ""}};
+    EXPECT_EQ(3u, ComponentManager::FilterDescriptors(descriptors, DHType::UNKNOWN, "").size());
+    EXPECT_EQ(2u, ComponentManager::FilterDescriptors(descriptors, DHType::CAMERA, "").size());
+    auto filtered = ComponentManager::FilterDescriptors(descriptors, DHType::CAMERA, "camera_2");
+    ASSERT_EQ(1u, filtered.size());
+    EXPECT_EQ("camera_2", filtered[0].id);
+    EXPECT_TRUE(ComponentManager::FilterDescriptors(descriptors, DHType::SCREEN, "").empty());
+}
+
 HWTEST_F(ComponentManagerTest, OnStateChanged_Sink_001, testing::ext::TestSize.Level1)
 {
     DHSinkStateListener sinkStateListenenr;
@@ -1697,7 +1791,7 @@ HWTEST_F(ComponentManagerTest, HandleSyncDataTimeout_002, testing::ext::TestSize
 {
     EnableStep enableStep = EnableStep::ENABLE_SOURCE;
     std::string realNetworkId = "networkid_123";
-    ComponentManager::GetInstance().syncDeviceInfoMap_[realNetworkId] = {enableStep, {nullptr}};
+    ComponentManager::GetInstance().syncDeviceInfoMap_[realNetworkId] = {enableStep, {{nullptr}}};
     auto ret = ComponentManager::GetInstance().IsRequestSyncData(realNetworkId);
     ComponentManager::GetInstance().HandleSyncDataTimeout(realNetworkId);
     EXPECT_EQ(ret, true);
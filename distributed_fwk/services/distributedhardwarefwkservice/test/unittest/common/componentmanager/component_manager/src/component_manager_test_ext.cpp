@@ -932,7 +932,8 @@ HWTEST_F(ComponentManagerTestExt, RecoverAutoEnableSink_001, testing::ext::TestS
     std::string key = udidHash + "###" + dhId;
     MetaInfoManager::GetInstance()->globalMetaInfoMap_[key] = dhMetaCapInfo;
     EXPECT_CALL(*utilTool_, GetLocalDeviceInfo()).WillRepeatedly(Return(VALUABLE_DEVICE_INFO));
-    EXPECT_NO_FATAL_FAILURE(ComponentManager::GetInstance().RecoverAutoEnableSink(dhType));
+    std::vector<TaskParam> recoverParams;
+    EXPECT_NO_FATAL_FAILURE(ComponentManager::GetInstance().RecoverAutoEnableSink(dhType, recoverParams));
     MetaInfoManager::GetInstance()->globalMetaInfoMap_.clear();
 }
 
@@ -948,7 +949,9 @@ HWTEST_F(ComponentManagerTestExt, RecoverAutoEnableSink_002, testing::ext::TestS
     std::string key = udidHash + "###" + dhId;
     MetaInfoManager::GetInstance()->globalMetaInfoMap_[key] = dhMetaCapInfo;
     EXPECT_CALL(*utilTool_, GetLocalDeviceInfo()).WillRepeatedly(Return(VALUABLE_DEVICE_INFO));
-    EXPECT_NO_FATAL_FAILURE(ComponentManager::GetInstance().RecoverAutoEnableSink(dhType));
+    std::vector<TaskParam> recoverParams;
+    EXPECT_NO_FATAL_FAILURE(ComponentManager::GetInstance().RecoverAutoEnableSink(dhType, recoverParams));
+    EXPECT_TRUE(recoverParams.empty());
     MetaInfoManager::GetInstance()->globalMetaInfoMap_.clear();
 }
 
@@ -961,7 +964,9 @@ HWTEST_F(ComponentManagerTestExt, RecoverAutoEnableSink_003, testing::ext::TestS
     std::string key = udidHash + "###" + dhId;
     MetaInfoManager::GetInstance()->globalMetaInfoMap_[key] = dhMetaCapInfo;
     EXPECT_CALL(*utilTool_, GetLocalDeviceInfo()).WillRepeatedly(Return(VALUABLE_DEVICE_INFO));
-    EXPECT_NO_FATAL_FAILURE(ComponentManager::GetInstance().RecoverAutoEnableSink(dhType));
+    std::vector<TaskParam> recoverParams;
+    EXPECT_NO_FATAL_FAILURE(ComponentManager::GetInstance().RecoverAutoEnableSink(dhType, recoverParams));
+    EXPECT_TRUE(recoverParams.empty());
 }
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "gtest/gtest.h"
 
+#include "dh_context.h"
 #include "distributed_hardware_errno.h"
 #include "distributed_hardware_manager_factory.h"
 #include "event_handler_factory.h"
@@ -72,5 +73,28 @@ HWTEST_F(DhManagerFactoryTest, Init_001, TestSize.Level1)
     auto ret = DistributedHardwareManagerFactory::GetInstance().Init();
     EXPECT_EQ(true, ret);
 }
+
+HWTEST_F(DhManagerFactoryTest, ScheduleIdleUnInit_001, TestSize.Level1)
+{
+    auto &factory = DistributedHardwareManagerFactory::GetInstance();
+    factory.flagUnInit_.store(true);
+    factory.ScheduleIdleUnInit();
+    EXPECT_NE(nullptr, factory.idleHandler_);
+    EXPECT_FALSE(factory.GetUnInitFlag());
+    factory.CancelIdleUnInit();
+}
+
+HWTEST_F(DhManagerFactoryTest, OnIdleComponentRelease_001, TestSize.Level1)
+{
+    auto &factory = DistributedHardwareManagerFactory::GetInstance();
+    std::string networkId = "networkId_test";
+    DHContext::GetInstance().AddRealTimeOnlineDeviceNetworkId(networkId);
+    factory.isInit_.store(true);
+    factory.OnIdleComponentRelease();
+    EXPECT_TRUE(factory.IsInit());
+    factory.OnIdleStoreRelease();
+    EXPECT_FALSE(factory.GetUnInitFlag());
+    DHContext::GetInstance().DeleteRealTimeOnlineDeviceNetworkId(networkId);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -31,6 +31,7 @@
 #include "distributed_hardware_service.h"
 #include "distributed_hardware_manager.h"
 #include "local_capability_info_manager.h"
+#include "local_hardware_manager.h"
 #include "task_board.h"
 #include "mock_publisher_listener.h"
 
@@ -266,6 +267,25 @@ HWTEST_F(DistributedHardwareServiceTest, QueryLocalSysSpec_001, TestSize.Level1)
     EXPECT_EQ(ret.empty(), true);
 }
 
+/**
+ * @tc.name: QueryLocalSysSpec_002
+ * @tc.desc: Verify the QueryLocalSysSpec cache is dropped when local capabilities change
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(DistributedHardwareServiceTest, QueryLocalSysSpec_002, TestSize.Level1)
+{
+    DistributedHardwareService service(ASID, true);
+    QueryLocalSysSpecType spec = QueryLocalSysSpecType::HISTREAMER_VIDEO_ENCODER;
+    service.localSysSpecCache_[spec] = { LocalHardwareManager::GetInstance().GetLocalCapabilityVersion(), "cached" };
+    EXPECT_EQ("cached", service.QueryLocalSysSpec(spec));
+
+    LocalHardwareManager::GetInstance().NotifyLocalCapabilityChanged();
+    EXPECT_NE("cached", service.QueryLocalSysSpec(spec));
+    EXPECT_EQ(LocalHardwareManager::GetInstance().GetLocalCapabilityVersion(),
+        service.localSysSpecCache_[spec].capabilityVersion);
+}
+
 /**
  * @tc.name: PauseDistributedHardware_001
  * @tc.desc: Verify the PauseDistributedHardware function
@@ -366,6 +386,29 @@ HWTEST_F(DistributedHardwareServiceTest, GetDistributedHardware_002, TestSize.Le
     service.pendingGetDHRequests_.clear();
 }
 
+HWTEST_F(DistributedHardwareServiceTest, GetDistributedHardwareByType_001, TestSize.Level1)
+{
+    DistributedHardwareService service(ASID, true);
+    std::string networkId = "networkId_1";
+    EnableStep enableSinkStep = EnableStep::ENABLE_SINK;
+    sptr<IGetDhDescriptorsCallback> callback(new TestGetDistributedHardwareCallback());
+    auto ret = service.GetDistributedHardwareByType(networkId, DHType::CAMERA, "", enableSinkStep, nullptr);
+    EXPECT_EQ(ret, ERR_DH_FWK_PARA_INVALID);
+    ret = service.GetDistributedHardwareByType(networkId, DHType::UNKNOWN, "", enableSinkStep, callback);
+    EXPECT_EQ(ret, ERR_DH_FWK_PARA_INVALID);
+    ret = service.GetDistributedHardwareByType(networkId, DHType::CAMERA, std::string(300, 'a'), enableSinkStep,
+        callback);
+    EXPECT_EQ(ret, ERR_DH_FWK_PARA_INVALID);
+
+    DistributedHardwareManager::GetInstance().isAllInit_.store(false);
+    ret = service.GetDistributedHardwareByType(networkId, DHType::CAMERA, "camera_1", enableSinkStep, callback);
+    EXPECT_EQ(ret, DH_FWK_SUCCESS);
+    ASSERT_EQ(1u, service.pendingGetDHRequests_.size());
+    EXPECT_EQ(DHType::CAMERA, service.pendingGetDHRequests_[0].dhType);
+    EXPECT_EQ("camera_1", service.pendingGetDHRequests_[0].dhId);
+    service.pendingGetDHRequests_.clear();
+}
+
 /**
  * @tc.name: RegisterDHStatusListener_001
  * @tc.desc: Verify the RegisterDHStatusListener function
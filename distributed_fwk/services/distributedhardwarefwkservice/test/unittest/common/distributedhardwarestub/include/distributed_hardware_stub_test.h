@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -134,6 +134,26 @@ int32_t GetDistributedHardware(const std::string &networkId, EnableStep enableSt
     return DH_FWK_SUCCESS;
 }
 
+int32_t GetDistributedHardwareBatch(const std::vector<std::string> &networkIds, EnableStep enableStep,
+    const sptr<IGetDhDescriptorsCallback> callback)
+{
+    (void)networkIds;
+    (void)enableStep;
+    (void)callback;
+    return DH_FWK_SUCCESS;
+}
+
+int32_t GetDistributedHardwareByType(const std::string &networkId, DHType dhType, const std::string &dhId,
+    EnableStep enableStep, const sptr<IGetDhDescriptorsCallback> callback)
+{
+    (void)networkId;
+    (void)dhType;
+    (void)dhId;
+    (void)enableStep;
+    (void)callback;
+    return DH_FWK_SUCCESS;
+}
+
 int32_t RegisterDHStatusListener(sptr<IHDSinkStatusListener> listener)
 {
     (void)listener;
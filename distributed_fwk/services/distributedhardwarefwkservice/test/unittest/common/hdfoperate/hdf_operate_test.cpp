@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -245,6 +245,87 @@ HWTEST_F(HdfOperateTest, RigidReleaseSourcePtr_001, TestSize.Level1)
     EXPECT_EQ(ERR_DH_FWK_LOADER_DLCLOSE_FAIL, ret);
 }
 
+/**
+ * @tc.name: LoadDistributedHDF_004
+ * @tc.desc: Verify a load during the unload grace period takes over the loaded hdf
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(HdfOperateTest, LoadDistributedHDF_004, TestSize.Level1)
+{
+    auto &manager = HdfOperateManager::GetInstance();
+    auto hdfOperate = std::make_shared<HdfOperator>(DHType::AUDIO, nullptr);
+    hdfOperate->hdfLoadRef_ = 1;
+    manager.hdfOperateMap_[DHType::AUDIO] = hdfOperate;
+    manager.pendingUnLoads_.insert(DHType::AUDIO);
+    manager.hdfLoadDumps_.clear();
+    int32_t ret = manager.LoadDistributedHDF(DHType::AUDIO);
+    EXPECT_EQ(DH_FWK_SUCCESS, ret);
+    EXPECT_EQ(1, hdfOperate->GetRefCount());
+    EXPECT_TRUE(manager.pendingUnLoads_.empty());
+    EXPECT_EQ(1, manager.hdfLoadDumps_[DHType::AUDIO].reuseCount);
+    EXPECT_EQ(0, manager.hdfLoadDumps_[DHType::AUDIO].loadCount);
+    manager.hdfOperateMap_.clear();
+    manager.hdfLoadDumps_.clear();
+}
+
+/**
+ * @tc.name: OnUnLoadGraceExpired_001
+ * @tc.desc: Verify OnUnLoadGraceExpired func
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(HdfOperateTest, OnUnLoadGraceExpired_001, TestSize.Level1)
+{
+    auto &manager = HdfOperateManager::GetInstance();
+    manager.hdfOperateMap_.clear();
+    manager.OnUnLoadGraceExpired(DHType::CAMERA);
+    manager.pendingUnLoads_.insert(DHType::CAMERA);
+    manager.OnUnLoadGraceExpired(DHType::CAMERA);
+    EXPECT_TRUE(manager.pendingUnLoads_.empty());
+    EXPECT_FALSE(manager.CancelDeferredUnLoad(DHType::CAMERA));
+}
+
+/**
+ * @tc.name: PreloadDistributedHDF_001
+ * @tc.desc: Verify PreloadDistributedHDF func
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(HdfOperateTest, PreloadDistributedHDF_001, TestSize.Level1)
+{
+    EXPECT_EQ(ERR_DH_FWK_NO_HDF_SUPPORT, HdfOperateManager::GetInstance().PreloadDistributedHDF(DHType::UNKNOWN));
+    EXPECT_EQ(ERR_DH_FWK_NO_HDF_SUPPORT, HdfOperateManager::GetInstance().PreloadDistributedHDF(DHType::SCREEN));
+}
+
+/**
+ * @tc.name: DumpHdfLoadInfos_001
+ * @tc.desc: Verify DumpHdfLoadInfos func
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(HdfOperateTest, DumpHdfLoadInfos_001, TestSize.Level1)
+{
+    auto &manager = HdfOperateManager::GetInstance();
+    auto hdfOperate = std::make_shared<HdfOperator>(DHType::CAMERA, nullptr);
+    hdfOperate->hdfLoadRef_ = 2;
+    manager.hdfOperateMap_[DHType::CAMERA] = hdfOperate;
+    manager.RecordLoad(DHType::CAMERA, false, 30);
+    manager.RecordLoad(DHType::CAMERA, false, 10);
+    manager.RecordLoad(DHType::CAMERA, true, 0);
+    std::vector<HdfLoadDump> hdfLoadInfos;
+    manager.DumpHdfLoadInfos(hdfLoadInfos);
+    ASSERT_EQ(1, hdfLoadInfos.size());
+    EXPECT_EQ(2, hdfLoadInfos[0].refCount);
+    EXPECT_EQ(2, hdfLoadInfos[0].loadCount);
+    EXPECT_EQ(1, hdfLoadInfos[0].reuseCount);
+    EXPECT_EQ(10, hdfLoadInfos[0].lastLoadCostMs);
+    EXPECT_EQ(30, hdfLoadInfos[0].maxLoadCostMs);
+    EXPECT_FALSE(hdfLoadInfos[0].unloadPending);
+    manager.hdfOperateMap_.clear();
+    manager.hdfLoadDumps_.clear();
+}
+
 HWTEST_F(HdfOperateTest, AddDeathRecipient_001, TestSize.Level1)
 {
     sptr<IRemoteObject> remote = nullptr;
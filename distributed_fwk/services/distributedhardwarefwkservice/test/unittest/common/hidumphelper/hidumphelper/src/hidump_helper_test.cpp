@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -228,6 +228,105 @@ HWTEST_F(HidumpHelperTest, ShowAllCapabilityInfos_002, TestSize.Level1)
     EXPECT_EQ(DH_FWK_SUCCESS, ret);
 }
 
+/**
+ * @tc.name: ShowAllRecoverInfos_001
+ * @tc.desc: Verify the ShowAllRecoverInfos function
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK0
+ */
+HWTEST_F(HidumpHelperTest, ShowAllRecoverInfos_001, TestSize.Level1)
+{
+    RecoverDump recoverInfo;
+    recoverInfo.dhType = DHType::CAMERA;
+    recoverInfo.taskCount = 2;
+    recoverInfo.costMs = 10;
+    ComponentManager::GetInstance().recoverInfos_[DHType::CAMERA] = recoverInfo;
+    std::string result;
+    int32_t ret = HidumpHelper::GetInstance().ShowAllRecoverInfos(result);
+    EXPECT_EQ(DH_FWK_SUCCESS, ret);
+    EXPECT_NE(result.find("EnableTasks    : 2"), std::string::npos);
+    ComponentManager::GetInstance().recoverInfos_.clear();
+}
+
+/**
+ * @tc.name: ShowAllHdfLoadInfos_001
+ * @tc.desc: Verify the ShowAllHdfLoadInfos function
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK0
+ */
+HWTEST_F(HidumpHelperTest, ShowAllHdfLoadInfos_001, TestSize.Level1)
+{
+    std::string result;
+    int32_t ret = HidumpHelper::GetInstance().ShowAllHdfLoadInfos(result);
+    EXPECT_EQ(DH_FWK_SUCCESS, ret);
+    EXPECT_NE(result.find("Distributed hdf load info:"), std::string::npos);
+}
+
+/**
+ * @tc.name: ShowAllFirstFrameInfos_001
+ * @tc.desc: Verify the ShowAllFirstFrameInfos function
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK0
+ */
+HWTEST_F(HidumpHelperTest, ShowAllFirstFrameInfos_001, TestSize.Level1)
+{
+    std::string result;
+    std::vector<std::string> args = { "-f" };
+    int32_t ret = HidumpHelper::GetInstance().Dump(args, result);
+    EXPECT_EQ(DH_FWK_SUCCESS, ret);
+    EXPECT_NE(result.find("AV transport first frame info:"), std::string::npos);
+}
+
+/**
+ * @tc.name: ShowAllLowLatencyInfos_001
+ * @tc.desc: Verify the ShowAllLowLatencyInfos function
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK0
+ */
+HWTEST_F(HidumpHelperTest, ShowAllLowLatencyInfos_001, TestSize.Level1)
+{
+    std::string result;
+    std::vector<std::string> args = { "-n" };
+    int32_t ret = HidumpHelper::GetInstance().Dump(args, result);
+    EXPECT_EQ(DH_FWK_SUCCESS, ret);
+    EXPECT_NE(result.find("Low latency info:"), std::string::npos);
+}
+
+/**
+ * @tc.name: ShowAllPerfInfos_001
+ * @tc.desc: Verify the ShowAllPerfInfos function
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK0
+ */
+HWTEST_F(HidumpHelperTest, ShowAllPerfInfos_001, TestSize.Level1)
+{
+    DHPerfStats::GetInstance().RecordCost(PerfCategory::DB_PUT, "test_store", 1);
+    DHPerfStats::GetInstance().RecordTraffic("test_network_id", 100, 50);
+    std::string result;
+    std::vector<std::string> args = { "-p" };
+    int32_t ret = HidumpHelper::GetInstance().Dump(args, result);
+    EXPECT_EQ(DH_FWK_SUCCESS, ret);
+    EXPECT_NE(result.find("TaskQueue: pending"), std::string::npos);
+    EXPECT_NE(result.find("test_store"), std::string::npos);
+    EXPECT_NE(result.find("CompressRatio : 50%"), std::string::npos);
+    DHPerfStats::GetInstance().Reset();
+}
+
+/**
+ * @tc.name: ShowAllDeviceFlapInfos_001
+ * @tc.desc: Verify the ShowAllDeviceFlapInfos function
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK0
+ */
+HWTEST_F(HidumpHelperTest, ShowAllDeviceFlapInfos_001, TestSize.Level1)
+{
+    std::string result;
+    std::vector<std::string> args = { "-o" };
+    int32_t ret = HidumpHelper::GetInstance().Dump(args, result);
+    EXPECT_EQ(DH_FWK_SUCCESS, ret);
+    EXPECT_NE(result.find("Suppressed offline and online flaps:"), std::string::npos);
+}
+
 /**
  * @tc.name: ShowHelp_001
  * @tc.desc: Verify the ShowHelp function
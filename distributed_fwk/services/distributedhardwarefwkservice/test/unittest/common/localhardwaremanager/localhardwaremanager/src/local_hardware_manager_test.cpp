@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -115,5 +115,35 @@ HWTEST_F(LocalHardwareManagerTest, QueryLocalHardware_002, TestSize.Level1)
     LocalHardwareManager::GetInstance().QueryLocalHardware(dhType, hardwareHandler);
     EXPECT_EQ(true, LocalHardwareManager::GetInstance().pluginListenerMap_.empty());
 }
+
+HWTEST_F(LocalHardwareManagerTest, UpdateLocalDHItem_001, TestSize.Level1)
+{
+    LocalHardwareManager::GetInstance().localDHItemsMap_.clear();
+    DHItem dhItem = { "input_1", "attrs_1", "subtype_1" };
+    EXPECT_TRUE(LocalHardwareManager::GetInstance().UpdateLocalDHItem(DHType::INPUT, dhItem));
+    EXPECT_FALSE(LocalHardwareManager::GetInstance().UpdateLocalDHItem(DHType::INPUT, dhItem));
+
+    dhItem.attrs = "attrs_2";
+    EXPECT_TRUE(LocalHardwareManager::GetInstance().UpdateLocalDHItem(DHType::INPUT, dhItem));
+    EXPECT_EQ(1U, LocalHardwareManager::GetInstance().localDHItemsMap_[DHType::INPUT].size());
+
+    LocalHardwareManager::GetInstance().RemoveLocalDHItem(DHType::INPUT, "input_1");
+    EXPECT_TRUE(LocalHardwareManager::GetInstance().localDHItemsMap_[DHType::INPUT].empty());
+    LocalHardwareManager::GetInstance().RemoveLocalDHItem(DHType::AUDIO, "audio_1");
+    LocalHardwareManager::GetInstance().localDHItemsMap_.clear();
+}
+
+HWTEST_F(LocalHardwareManagerTest, PublishLocalHardware_001, TestSize.Level1)
+{
+    LocalHardwareManager::GetInstance().localDHItemsMap_.clear();
+    uint64_t version = LocalHardwareManager::GetInstance().GetLocalCapabilityVersion();
+    LocalHardwareManager::GetInstance().PublishLocalHardware(DHType::CAMERA);
+    EXPECT_EQ(version, LocalHardwareManager::GetInstance().GetLocalCapabilityVersion());
+
+    LocalHardwareManager::GetInstance().localDHItemsMap_[DHType::CAMERA] = { { "camera_1", "attrs", "subtype" } };
+    LocalHardwareManager::GetInstance().PublishLocalHardware(DHType::CAMERA);
+    EXPECT_NE(version, LocalHardwareManager::GetInstance().GetLocalCapabilityVersion());
+    LocalHardwareManager::GetInstance().localDHItemsMap_.clear();
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -26,6 +26,9 @@ namespace {
     const std::string LOW_LATENCY_TIMER_ID = "low_latency_timer_id";
     constexpr int32_t LOW_LATENCY_DELAY_MS = 50 * 1000;
     constexpr uint32_t MAX_SWITCH_SIZE = 256;
+    const std::string TEST_NETWORK_ID = "test_network_id";
+    const std::string TEST_SESSION_NAME = "test_session_name";
+    const std::string TEST_SESSION_NAME_OTHER = "test_session_name_other";
 }
 
 void LowLatencyTest::SetUpTestCase()
@@ -54,11 +57,11 @@ HWTEST_F(LowLatencyTest, EnableLowLatency_001, TestSize.Level1)
 {
     DHType dhType = DHType::UNKNOWN;
     LowLatency::GetInstance().EnableLowLatency(dhType);
-    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 
     dhType = DHType::MAX_DH;
     LowLatency::GetInstance().EnableLowLatency(dhType);
-    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 }
 
 /**
@@ -72,11 +75,11 @@ HWTEST_F(LowLatencyTest, EnableLowLatency_002, TestSize.Level1)
     DHType dhType = DHType::CAMERA;
     LowLatency::GetInstance().lowLatencyTimer_ = nullptr;
     LowLatency::GetInstance().EnableLowLatency(dhType);
-    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 
     dhType = DHType::AUDIO;
     LowLatency::GetInstance().EnableLowLatency(dhType);
-    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 }
 
 /**
@@ -88,14 +91,14 @@ HWTEST_F(LowLatencyTest, EnableLowLatency_002, TestSize.Level1)
 HWTEST_F(LowLatencyTest, EnableLowLatency_003, TestSize.Level1)
 {
     DHType dhType = DHType::CAMERA;
-    LowLatency::GetInstance().lowLatencySwitchSet_.clear();
+    LowLatency::GetInstance().lowLatencySwitchMap_.clear();
     LowLatency::GetInstance().lowLatencyTimer_ = std::make_shared<LowLatencyTimer>(LOW_LATENCY_TIMER_ID,
         LOW_LATENCY_DELAY_MS);
     LowLatency::GetInstance().EnableLowLatency(dhType);
-    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 
     LowLatency::GetInstance().EnableLowLatency(dhType);
-    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 }
 
 /**
@@ -107,12 +110,12 @@ HWTEST_F(LowLatencyTest, EnableLowLatency_003, TestSize.Level1)
 HWTEST_F(LowLatencyTest, EnableLowLatency_004, TestSize.Level1)
 {
     for (uint32_t i = 0; i <= MAX_SWITCH_SIZE; ++i) {
-        LowLatency::GetInstance().lowLatencySwitchSet_.insert(static_cast<DHType>(i));
+        LowLatency::GetInstance().lowLatencySwitchMap_[std::make_tuple("", static_cast<DHType>(i), "")] = 1;
     }
     DHType dhType = DHType::CAMERA;
     LowLatency::GetInstance().EnableLowLatency(dhType);
-    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
-    LowLatency::GetInstance().lowLatencySwitchSet_.clear();
+    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
+    LowLatency::GetInstance().lowLatencySwitchMap_.clear();
 }
 
 /**
@@ -125,11 +128,11 @@ HWTEST_F(LowLatencyTest, DisableLowLatency_001, TestSize.Level1)
 {
     DHType dhType = DHType::UNKNOWN;
     LowLatency::GetInstance().DisableLowLatency(dhType);
-    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 
     dhType = DHType::MAX_DH;
     LowLatency::GetInstance().DisableLowLatency(dhType);
-    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 }
 
 /**
@@ -140,18 +143,18 @@ HWTEST_F(LowLatencyTest, DisableLowLatency_001, TestSize.Level1)
  */
 HWTEST_F(LowLatencyTest, DisableLowLatency_002, TestSize.Level1)
 {
-    LowLatency::GetInstance().lowLatencySwitchSet_.clear();
+    LowLatency::GetInstance().lowLatencySwitchMap_.clear();
     DHType dhType = DHType::CAMERA;
     LowLatency::GetInstance().lowLatencyTimer_ = nullptr;
     LowLatency::GetInstance().DisableLowLatency(dhType);
-    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 
     LowLatency::GetInstance().lowLatencyTimer_ = nullptr;
     DHType dhType1 = DHType::AUDIO;
-    LowLatency::GetInstance().lowLatencySwitchSet_.insert(dhType);
-    LowLatency::GetInstance().lowLatencySwitchSet_.insert(dhType1);
+    LowLatency::GetInstance().lowLatencySwitchMap_[std::make_tuple("", dhType, "")] = 1;
+    LowLatency::GetInstance().lowLatencySwitchMap_[std::make_tuple("", dhType1, "")] = 1;
     LowLatency::GetInstance().DisableLowLatency(dhType);
-    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 }
 
 HWTEST_F(LowLatencyTest, DisableLowLatency_003, TestSize.Level1)
@@ -160,13 +163,95 @@ HWTEST_F(LowLatencyTest, DisableLowLatency_003, TestSize.Level1)
     LowLatency::GetInstance().lowLatencyTimer_ = std::make_shared<LowLatencyTimer>(LOW_LATENCY_TIMER_ID,
         LOW_LATENCY_DELAY_MS);
     LowLatency::GetInstance().DisableLowLatency(dhType);
-    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 
     DHType dhType1 = DHType::CAMERA;
-    LowLatency::GetInstance().lowLatencySwitchSet_.insert(dhType);
-    LowLatency::GetInstance().lowLatencySwitchSet_.insert(dhType1);
+    LowLatency::GetInstance().lowLatencySwitchMap_[std::make_tuple("", dhType, "")] = 1;
+    LowLatency::GetInstance().lowLatencySwitchMap_[std::make_tuple("", dhType1, "")] = 1;
     LowLatency::GetInstance().DisableLowLatency(dhType);
-    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchSet_.empty());
+    EXPECT_EQ(false, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
+}
+
+/**
+ * @tc.name: EnableLowLatency_005
+ * @tc.desc: Verify every (peer, dhType, session) holds its own reference
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(LowLatencyTest, EnableLowLatency_005, TestSize.Level1)
+{
+    LowLatency::GetInstance().lowLatencySwitchMap_.clear();
+    LowLatency::GetInstance().peerInfoMap_.clear();
+    LowLatency::GetInstance().lowLatencyTimer_ = nullptr;
+    DHType dhType = DHType::CAMERA;
+    LowLatency::GetInstance().EnableLowLatency(TEST_NETWORK_ID, dhType, TEST_SESSION_NAME);
+    LowLatency::GetInstance().EnableLowLatency(TEST_NETWORK_ID, dhType, TEST_SESSION_NAME);
+    LowLatency::GetInstance().EnableLowLatency(TEST_NETWORK_ID, dhType, TEST_SESSION_NAME_OTHER);
+    EXPECT_EQ(2, LowLatency::GetInstance().lowLatencySwitchMap_.size());
+    EXPECT_EQ(3, LowLatency::GetInstance().peerInfoMap_[TEST_NETWORK_ID].refCount);
+    EXPECT_EQ(1, LowLatency::GetInstance().peerInfoMap_[TEST_NETWORK_ID].enterCount);
+
+    LowLatency::GetInstance().DisableLowLatency(TEST_NETWORK_ID, dhType, TEST_SESSION_NAME);
+    EXPECT_EQ(2, LowLatency::GetInstance().lowLatencySwitchMap_.size());
+    LowLatency::GetInstance().DisableLowLatency(TEST_NETWORK_ID, dhType, TEST_SESSION_NAME);
+    EXPECT_EQ(1, LowLatency::GetInstance().lowLatencySwitchMap_.size());
+    LowLatency::GetInstance().DisableLowLatency(TEST_NETWORK_ID, dhType, TEST_SESSION_NAME_OTHER);
+    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
+    EXPECT_EQ(0, LowLatency::GetInstance().peerInfoMap_[TEST_NETWORK_ID].refCount);
+    EXPECT_EQ(0, LowLatency::GetInstance().peerInfoMap_[TEST_NETWORK_ID].enterTime);
+}
+
+/**
+ * @tc.name: DisableLowLatency_004
+ * @tc.desc: Verify a release without its enable leaves the other users alone
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(LowLatencyTest, DisableLowLatency_004, TestSize.Level1)
+{
+    LowLatency::GetInstance().lowLatencySwitchMap_.clear();
+    LowLatency::GetInstance().peerInfoMap_.clear();
+    LowLatency::GetInstance().lowLatencyTimer_ = nullptr;
+    LowLatency::GetInstance().EnableLowLatency(TEST_NETWORK_ID, DHType::CAMERA, TEST_SESSION_NAME);
+    LowLatency::GetInstance().DisableLowLatency(TEST_NETWORK_ID, DHType::CAMERA, TEST_SESSION_NAME_OTHER);
+    LowLatency::GetInstance().DisableLowLatency("", DHType::CAMERA, "");
+    EXPECT_EQ(1, LowLatency::GetInstance().lowLatencySwitchMap_.size());
+    EXPECT_EQ(1, LowLatency::GetInstance().peerInfoMap_[TEST_NETWORK_ID].refCount);
+
+    LowLatency::GetInstance().CloseLowLatency();
+    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
+    EXPECT_EQ(0, LowLatency::GetInstance().peerInfoMap_[TEST_NETWORK_ID].refCount);
+}
+
+/**
+ * @tc.name: DumpLowLatencyInfos_001
+ * @tc.desc: Verify the time in low latency mode is kept per peer
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(LowLatencyTest, DumpLowLatencyInfos_001, TestSize.Level1)
+{
+    LowLatency::GetInstance().lowLatencySwitchMap_.clear();
+    LowLatency::GetInstance().peerInfoMap_.clear();
+    LowLatency::GetInstance().lowLatencyTimer_ = nullptr;
+    LowLatency::GetInstance().EnableLowLatency(TEST_NETWORK_ID, DHType::CAMERA, TEST_SESSION_NAME);
+    LowLatency::GetInstance().EnableLowLatency("", DHType::AUDIO, "");
+    LowLatency::GetInstance().peerInfoMap_[TEST_NETWORK_ID].enterTime -= LOW_LATENCY_DELAY_MS;
+    LowLatency::GetInstance().DisableLowLatency(TEST_NETWORK_ID, DHType::CAMERA, TEST_SESSION_NAME);
+
+    std::vector<LowLatencyPeerInfo> peerInfos;
+    LowLatency::GetInstance().DumpLowLatencyInfos(peerInfos);
+    EXPECT_EQ(2, peerInfos.size());
+    for (const auto &info : peerInfos) {
+        if (info.networkId == TEST_NETWORK_ID) {
+            EXPECT_EQ(0, info.refCount);
+            EXPECT_GE(info.totalDurationMs, LOW_LATENCY_DELAY_MS);
+        } else {
+            EXPECT_EQ(1, info.refCount);
+        }
+    }
+    LowLatency::GetInstance().DisableLowLatency(DHType::AUDIO);
+    EXPECT_EQ(true, LowLatency::GetInstance().lowLatencySwitchMap_.empty());
 }
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -44,6 +44,24 @@ void OnMessage(const DHTopic topic, const std::string& message)
     (void)message;
 }
 };
+
+class SelfRemovingPublisherListener : public MockIPublisherListener {
+public:
+    explicit SelfRemovingPublisherListener(PublisherItem &item) : item_(item) {}
+
+    void OnMessage(const DHTopic topic, const std::string& message)
+    {
+        (void)topic;
+        (void)message;
+        messageCount_++;
+        item_.RemoveListener(this);
+    }
+
+    int32_t messageCount_ = 0;
+
+private:
+    PublisherItem &item_;
+};
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -44,7 +44,7 @@ HWTEST_F(PublisherItemTest, AddListener_001, TestSize.Level1)
     PublisherItem item(DHTopic::TOPIC_MIN);
     sptr<IPublisherListener> listener = nullptr;
     item.AddListener(listener);
-    EXPECT_EQ(true, item.listeners_.empty());
+    EXPECT_EQ(true, item.listeners_->empty());
 }
 
 /**
@@ -59,7 +59,7 @@ HWTEST_F(PublisherItemTest, AddListener_002, TestSize.Level1)
     sptr<IPublisherListener> listener(new (std::nothrow) MockIPublisherListener());
     ASSERT_TRUE(listener != nullptr);
     item.AddListener(listener);
-    EXPECT_EQ(false, item.listeners_.empty());
+    EXPECT_EQ(false, item.listeners_->empty());
 }
 
 /**
@@ -73,13 +73,13 @@ HWTEST_F(PublisherItemTest, RemoveListener_001, TestSize.Level1)
     PublisherItem item(DHTopic::TOPIC_MIN);
     sptr<IPublisherListener> listener = nullptr;
     item.RemoveListener(listener);
-    EXPECT_EQ(true, item.listeners_.empty());
+    EXPECT_EQ(true, item.listeners_->empty());
 
     sptr<IPublisherListener> listener1(new (std::nothrow) MockIPublisherListener());
     ASSERT_TRUE(listener1 != nullptr);
     item.AddListener(listener1);
     item.RemoveListener(listener1);
-    EXPECT_EQ(true, item.listeners_.empty());
+    EXPECT_EQ(true, item.listeners_->empty());
 }
 
 /**
@@ -93,11 +93,11 @@ HWTEST_F(PublisherItemTest, PublishMessage_001, TestSize.Level1)
     PublisherItem item(DHTopic::TOPIC_MIN);
     std::string message = "";
     item.PublishMessage(message);
-    EXPECT_EQ(true, item.listeners_.empty());
+    EXPECT_EQ(true, item.listeners_->empty());
 
     std::string msg(MESSAGE_LEN, 'a');
     item.PublishMessage(msg);
-    EXPECT_EQ(true, item.listeners_.empty());
+    EXPECT_EQ(true, item.listeners_->empty());
 }
 
 /**
@@ -114,7 +114,43 @@ HWTEST_F(PublisherItemTest, PublishMessage_002, TestSize.Level1)
     ASSERT_TRUE(listener != nullptr);
     item.AddListener(listener);
     item.PublishMessage(message);
-    EXPECT_EQ(false, item.listeners_.empty());
+    EXPECT_EQ(false, item.listeners_->empty());
+}
+
+/**
+ * @tc.name: PublishMessage_003
+ * @tc.desc: Verify a listener can unsubscribe from inside OnMessage.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSCV
+ */
+HWTEST_F(PublisherItemTest, PublishMessage_003, TestSize.Level1)
+{
+    PublisherItem item(DHTopic::TOPIC_MIN);
+    sptr<SelfRemovingPublisherListener> listener(new (std::nothrow) SelfRemovingPublisherListener(item));
+    ASSERT_TRUE(listener != nullptr);
+    item.AddListener(listener);
+    item.PublishMessage("message");
+    EXPECT_EQ(1, listener->messageCount_);
+    EXPECT_EQ(true, item.listeners_->empty());
+}
+
+/**
+ * @tc.name: RemoveDeadListener_001
+ * @tc.desc: Verify the RemoveDeadListener function.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSCV
+ */
+HWTEST_F(PublisherItemTest, RemoveDeadListener_001, TestSize.Level1)
+{
+    PublisherItem item(DHTopic::TOPIC_MIN);
+    sptr<IPublisherListener> listener(new (std::nothrow) MockIPublisherListener());
+    ASSERT_TRUE(listener != nullptr);
+    item.AddListener(listener);
+    auto snapshot = item.listeners_;
+    wptr<IRemoteObject> remote = listener->AsObject();
+    item.RemoveDeadListener(remote);
+    EXPECT_EQ(true, item.listeners_->empty());
+    EXPECT_EQ(false, snapshot->empty());
 }
 
 HWTEST_F(PublisherItemTest, RegisterListener_001, TestSize.Level1)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -256,5 +256,35 @@ HWTEST_F(CapabilityInfoTest, IsCapKeyMatchDeviceId_001, TestSize.Level1)
     ret = IsCapKeyMatchDeviceId(key, deviceId);
     EXPECT_EQ(false, ret);
 }
+
+HWTEST_F(CapabilityInfoTest, ToBinaryString_001, TestSize.Level1)
+{
+    std::shared_ptr<CapabilityInfo> capability = std::make_shared<CapabilityInfo>("dhid_123", "devid_123",
+        "devname", 1, DHType::CAMERA, "{\"attrs\":\"value\"}", "subtype");
+    std::string binStr = capability->ToBinaryString();
+    EXPECT_TRUE(IsCapBinaryEncoded(binStr));
+    EXPECT_FALSE(IsCapBinaryEncoded(capability->ToJsonString()));
+
+    std::shared_ptr<CapabilityInfo> decoded = nullptr;
+    EXPECT_EQ(DH_FWK_SUCCESS, GetCapabilityByValue<CapabilityInfo>(binStr, decoded));
+    EXPECT_TRUE(capability->Compare(*decoded));
+    EXPECT_TRUE(IsCapInfoEqual<CapabilityInfo>(binStr, capability->ToJsonString()));
+    EXPECT_EQ(binStr, EncodeCapability(capability, CAP_CODEC_BINARY_V1));
+    EXPECT_EQ(capability->ToJsonString(), EncodeCapability(capability, CAP_CODEC_JSON));
+}
+
+HWTEST_F(CapabilityInfoTest, FromBinaryString_001, TestSize.Level1)
+{
+    CapabilityInfo capability("dhid_123", "devid_123", "devname", 1, DHType::CAMERA, "attrs", "subtype");
+    std::string binStr = capability.ToBinaryString();
+    CapabilityInfo decoded;
+    EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, decoded.FromBinaryString(""));
+    EXPECT_NE(DH_FWK_SUCCESS, decoded.FromBinaryString(binStr.substr(0, binStr.size() - 1)));
+
+    std::string newerVersion = binStr;
+    newerVersion[1] = static_cast<char>(CAP_CODEC_LOCAL_VERSION + 1);
+    EXPECT_NE(DH_FWK_SUCCESS, decoded.FromBinaryString(newerVersion));
+    EXPECT_EQ(DH_FWK_SUCCESS, decoded.FromBinaryString(binStr));
+}
 }
 }
\ No newline at end of file
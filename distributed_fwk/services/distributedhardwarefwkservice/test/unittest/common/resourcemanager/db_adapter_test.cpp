@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -156,6 +156,33 @@ HWTEST_F(DBAdapterTest, SyncDataByNetworkId_001, TestSize.Level1)
     EXPECT_EQ(false, ret);
 }
 
+HWTEST_F(DBAdapterTest, IsSyncCoalesced_001, TestSize.Level1)
+{
+    ASSERT_TRUE(MetaInfoManager::GetInstance()->dbAdapterPtr_ != nullptr);
+    auto dbAdapter = MetaInfoManager::GetInstance()->dbAdapterPtr_;
+    dbAdapter->lastSyncTimes_.clear();
+    EXPECT_FALSE(dbAdapter->IsSyncCoalesced(NETWORKID_TEST));
+    EXPECT_TRUE(dbAdapter->IsSyncCoalesced(NETWORKID_TEST));
+    EXPECT_FALSE(dbAdapter->IsSyncCoalesced(UUID_TEST));
+    dbAdapter->lastSyncTimes_[NETWORKID_TEST] = 0;
+    EXPECT_FALSE(dbAdapter->IsSyncCoalesced(NETWORKID_TEST));
+    dbAdapter->lastSyncTimes_.clear();
+}
+
+HWTEST_F(DBAdapterTest, GetValuesByKeys_001, TestSize.Level1)
+{
+    ASSERT_TRUE(MetaInfoManager::GetInstance()->dbAdapterPtr_ != nullptr);
+    std::vector<std::string> keys;
+    std::unordered_map<std::string, std::string> values;
+    MetaInfoManager::GetInstance()->dbAdapterPtr_->GetValuesByKeys(keys, values);
+    EXPECT_TRUE(values.empty());
+
+    keys.push_back(DEV_ID_TEST + RESOURCE_SEPARATOR + DH_ID_TEST);
+    MetaInfoManager::GetInstance()->dbAdapterPtr_->kvStoragePtr_ = nullptr;
+    MetaInfoManager::GetInstance()->dbAdapterPtr_->GetValuesByKeys(keys, values);
+    EXPECT_TRUE(values.empty());
+}
+
 HWTEST_F(DBAdapterTest, ClearDataByPrefix_001, TestSize.Level1)
 {
     ASSERT_TRUE(MetaInfoManager::GetInstance()->dbAdapterPtr_ != nullptr);
@@ -164,5 +191,15 @@ HWTEST_F(DBAdapterTest, ClearDataByPrefix_001, TestSize.Level1)
     auto ret = MetaInfoManager::GetInstance()->dbAdapterPtr_->ClearDataByPrefix(prefix);
     EXPECT_EQ(false, ret);
 }
+
+HWTEST_F(DBAdapterTest, GetEntriesByKeyPrefix_001, TestSize.Level1)
+{
+    ASSERT_TRUE(MetaInfoManager::GetInstance()->dbAdapterPtr_ != nullptr);
+    std::vector<DistributedKv::Entry> entries;
+    MetaInfoManager::GetInstance()->dbAdapterPtr_->kvStoragePtr_ = nullptr;
+    auto ret = MetaInfoManager::GetInstance()->dbAdapterPtr_->GetEntriesByKeyPrefix("", entries);
+    EXPECT_EQ(ERR_DH_FWK_RESOURCE_KV_STORAGE_POINTER_NULL, ret);
+    EXPECT_TRUE(entries.empty());
+}
 }
 }
\ No newline at end of file
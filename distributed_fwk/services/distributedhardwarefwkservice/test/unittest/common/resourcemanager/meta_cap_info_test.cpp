@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,6 +17,7 @@
 
 #include "cJSON.h"
 
+#include "capability_utils.h"
 #include "constants.h"
 #include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
@@ -362,5 +363,24 @@ HWTEST_F(MetaCapInfoTest, Compare_010, TestSize.Level1)
     auto ret = metaCapInfoPtr->Compare(metaCapInfo);
     EXPECT_EQ(true, ret);
 }
+
+HWTEST_F(MetaCapInfoTest, ToBinaryString_001, TestSize.Level1)
+{
+    CompVersion compVersion = { .name = "camera", .dhType = DHType::CAMERA, .handlerVersion = "1.0",
+        .sourceVersion = "1.0", .sinkVersion = "2.0", .haveFeature = true, .sourceFeatureFilters = { "filter" },
+        .sinkSupportedFeatures = { "feature_1", "feature_2" } };
+    std::shared_ptr<MetaCapabilityInfo> metaCapInfo = std::make_shared<MetaCapabilityInfo>("dhid_123",
+        "devid_123", "devname", 1, DHType::CAMERA, "attrs", "subtype", "udidhash_123", compVersion);
+    std::string binStr = metaCapInfo->ToBinaryString();
+    EXPECT_TRUE(IsCapBinaryEncoded(binStr));
+
+    std::shared_ptr<MetaCapabilityInfo> decoded = nullptr;
+    EXPECT_EQ(DH_FWK_SUCCESS, GetCapabilityByValue<MetaCapabilityInfo>(binStr, decoded));
+    EXPECT_TRUE(metaCapInfo->Compare(*decoded));
+    EXPECT_EQ(metaCapInfo->GetKey(), decoded->GetKey());
+    EXPECT_TRUE(decoded->GetCompVersion().haveFeature);
+    EXPECT_EQ(2U, decoded->GetCompVersion().sinkSupportedFeatures.size());
+    EXPECT_EQ(binStr, decoded->ToBinaryString());
+}
 }
 }
\ No newline at end of file
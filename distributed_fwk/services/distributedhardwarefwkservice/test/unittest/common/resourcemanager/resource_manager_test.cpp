@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -966,5 +966,100 @@ HWTEST_F(ResourceManagerTest, GetDhSubtype_002, TestSize.Level1)
     ret = CapabilityInfoManager::GetInstance()->GetDhSubtype(deviceId1, dhid);
     EXPECT_EQ("", ret);
 }
+
+HWTEST_F(ResourceManagerTest, GetDataByDHType_002, TestSize.Level1)
+{
+    CapabilityInfoManager::GetInstance()->globalCapInfoMap_.clear();
+    CapabilityInfoManager::GetInstance()->dhTypeIndex_.clear();
+    std::vector<std::shared_ptr<CapabilityInfo>> resInfos { CAP_INFO_0, CAP_INFO_1, CAP_INFO_5, CAP_INFO_6 };
+    EXPECT_EQ(DH_FWK_SUCCESS, CapabilityInfoManager::GetInstance()->AddCapabilityInMem(resInfos));
+
+    CapabilityInfoMap capabilityMap;
+    CapabilityInfoManager::GetInstance()->GetDataByDHType(DHType::CAMERA, capabilityMap);
+    EXPECT_EQ(2, capabilityMap.size());
+    EXPECT_TRUE(capabilityMap.find(CAP_INFO_0->GetKey()) != capabilityMap.end());
+    EXPECT_TRUE(capabilityMap.find(CAP_INFO_5->GetKey()) != capabilityMap.end());
+
+    EXPECT_EQ(DH_FWK_SUCCESS, CapabilityInfoManager::GetInstance()->RemoveCapabilityInfoInMem(DEV_ID_0));
+    capabilityMap.clear();
+    CapabilityInfoManager::GetInstance()->GetDataByDHType(DHType::CAMERA, capabilityMap);
+    EXPECT_EQ(1, capabilityMap.size());
+    EXPECT_TRUE(capabilityMap.find(CAP_INFO_5->GetKey()) != capabilityMap.end());
+
+    std::vector<std::shared_ptr<CapabilityInfo>> capInfos;
+    CapabilityInfoManager::GetInstance()->GetCapabilitiesByDeviceId(DEV_ID_0, capInfos);
+    EXPECT_TRUE(capInfos.empty());
+    CapabilityInfoManager::GetInstance()->GetCapabilitiesByDeviceId(DEV_ID_1, capInfos);
+    EXPECT_EQ(2, capInfos.size());
+
+    capabilityMap.clear();
+    EXPECT_EQ(DH_FWK_SUCCESS, CapabilityInfoManager::GetInstance()->GetDataByKeyPrefix(DEV_ID_1, capabilityMap));
+    EXPECT_EQ(2, capabilityMap.size());
+    CapabilityInfoManager::GetInstance()->globalCapInfoMap_.clear();
+    CapabilityInfoManager::GetInstance()->dhTypeIndex_.clear();
+}
+
+/**
+ * @tc.name: LoadDeviceCapabilities_001
+ * @tc.desc: Verify a device is loaded from the database on its first online event only and stamped as seen.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJE
+ */
+HWTEST_F(ResourceManagerTest, LoadDeviceCapabilities_001, TestSize.Level1)
+{
+    EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, CapabilityInfoManager::GetInstance()->LoadDeviceCapabilities(""));
+    ASSERT_EQ(DH_FWK_SUCCESS, CapabilityInfoManager::GetInstance()->Init());
+    vector<shared_ptr<CapabilityInfo>> resInfos { CAP_INFO_0, CAP_INFO_1, CAP_INFO_2, CAP_INFO_3, CAP_INFO_4 };
+    EXPECT_EQ(DH_FWK_SUCCESS, CapabilityInfoManager::GetInstance()->AddCapability(resInfos));
+    CapabilityInfoManager::GetInstance()->globalCapInfoMap_.clear();
+    CapabilityInfoManager::GetInstance()->dhTypeIndex_.clear();
+    EXPECT_EQ(DH_FWK_SUCCESS, CapabilityInfoManager::GetInstance()->LoadDeviceCapabilities(DEV_ID_0));
+    EXPECT_EQ(TEST_SIZE_5, CapabilityInfoManager::GetInstance()->globalCapInfoMap_.size());
+    CapabilityInfoManager::GetInstance()->EraseCapabilityInMem(CAP_INFO_0->GetKey());
+    EXPECT_EQ(DH_FWK_SUCCESS, CapabilityInfoManager::GetInstance()->LoadDeviceCapabilities(DEV_ID_0));
+    EXPECT_EQ(TEST_SIZE_5 - 1, CapabilityInfoManager::GetInstance()->globalCapInfoMap_.size());
+
+    auto lastSeenDb = CapabilityInfoManager::GetInstance()->lastSeenDbPtr_;
+    if (lastSeenDb != nullptr) {
+        std::string lastSeen;
+        EXPECT_EQ(DH_FWK_SUCCESS, lastSeenDb->GetDataByKey(DEV_ID_0, lastSeen));
+        EXPECT_FALSE(lastSeen.empty());
+    }
+    CapabilityInfoManager::GetInstance()->globalCapInfoMap_.clear();
+    CapabilityInfoManager::GetInstance()->dhTypeIndex_.clear();
+    CapabilityInfoManager::GetInstance()->UnInit();
+}
+
+/**
+ * @tc.name: EvictExpiredCapabilities_001
+ * @tc.desc: Verify devices past the TTL are evicted and devices without a stamp start their TTL.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJE
+ */
+HWTEST_F(ResourceManagerTest, EvictExpiredCapabilities_001, TestSize.Level1)
+{
+    CapabilityInfoManager::GetInstance()->dbAdapterPtr_ = nullptr;
+    EXPECT_EQ(ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL,
+        CapabilityInfoManager::GetInstance()->EvictExpiredCapabilities());
+    ASSERT_EQ(DH_FWK_SUCCESS, CapabilityInfoManager::GetInstance()->Init());
+    auto lastSeenDb = CapabilityInfoManager::GetInstance()->lastSeenDbPtr_;
+    if (lastSeenDb == nullptr) {
+        CapabilityInfoManager::GetInstance()->UnInit();
+        return;
+    }
+    vector<shared_ptr<CapabilityInfo>> resInfos { CAP_INFO_0, CAP_INFO_1, CAP_INFO_5, CAP_INFO_6 };
+    EXPECT_EQ(DH_FWK_SUCCESS, CapabilityInfoManager::GetInstance()->AddCapability(resInfos));
+    lastSeenDb->RemoveDataByKey(DEV_ID_0);
+    EXPECT_EQ(DH_FWK_SUCCESS, lastSeenDb->PutData(DEV_ID_1, "1"));
+    EXPECT_EQ(DH_FWK_SUCCESS, CapabilityInfoManager::GetInstance()->EvictExpiredCapabilities());
+
+    EXPECT_TRUE(CapabilityInfoManager::GetInstance()->HasCapability(DEV_ID_0, DH_ID_0));
+    EXPECT_FALSE(CapabilityInfoManager::GetInstance()->HasCapability(DEV_ID_1, DH_ID_0));
+    std::string lastSeen;
+    EXPECT_EQ(DH_FWK_SUCCESS, lastSeenDb->GetDataByKey(DEV_ID_0, lastSeen));
+    CapabilityInfoManager::GetInstance()->globalCapInfoMap_.clear();
+    CapabilityInfoManager::GetInstance()->dhTypeIndex_.clear();
+    CapabilityInfoManager::GetInstance()->UnInit();
+}
 } // namespace DistributedHardware
 } // namespace OHOS
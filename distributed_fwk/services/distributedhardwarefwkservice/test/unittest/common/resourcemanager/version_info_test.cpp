@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -259,5 +259,19 @@ HWTEST_F(VersionInfoTest, FromJsoncompVerContinue_005, TestSize.Level1)
     EXPECT_EQ(true, compVer.haveFeature);
     cJSON_Delete(jsonObj);
 }
+
+HWTEST_F(VersionInfoTest, CapCodecVersion_001, TestSize.Level1)
+{
+    VersionInfo legacyInfo;
+    EXPECT_EQ(DH_FWK_SUCCESS, legacyInfo.FromJsonString("{\"dev_id\":\"devid_123\",\"dh_ver\":\"1.0\"}"));
+    EXPECT_EQ(CAP_CODEC_JSON, legacyInfo.capCodecVersion);
+
+    VersionInfo localInfo;
+    localInfo.deviceId = "devid_123";
+    localInfo.capCodecVersion = CAP_CODEC_LOCAL_VERSION;
+    VersionInfo decoded;
+    EXPECT_EQ(DH_FWK_SUCCESS, decoded.FromJsonString(localInfo.ToJsonString()));
+    EXPECT_EQ(CAP_CODEC_LOCAL_VERSION, decoded.capCodecVersion);
+}
 }
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -20,6 +20,7 @@
 
 #include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
+#include "exit_dfwk_task.h"
 #include "task_factory.h"
 #include "mock_disable_task.h"
 #include "mock_enable_task.h"
@@ -158,7 +159,7 @@ HWTEST_F(TaskTest, task_test_005, TestSize.Level1)
 {
     std::shared_ptr<Task> task = nullptr;
     TaskExecutor::GetInstance().PushTask(task);
-    ASSERT_EQ(true, TaskExecutor::GetInstance().taskQueue_.empty());
+    ASSERT_EQ(0u, TaskExecutor::GetInstance().GetPendingTaskCount());
 }
 
 /**
@@ -376,15 +377,23 @@ HWTEST_F(TaskTest, task_test_020, TestSize.Level1)
 
 /**
  * @tc.name: task_test_021
- * @tc.desc: Verify the TriggerTask function
+ * @tc.desc: Verify the GetLaneKey function
  * @tc.type: FUNC
  * @tc.require: AR000GHSJE
  */
 HWTEST_F(TaskTest, task_test_021, TestSize.Level1)
 {
-    TaskExecutor::GetInstance().taskThreadFlag_ = false;
-    TaskExecutor::GetInstance().TriggerTask();
-    ASSERT_EQ(true, TaskExecutor::GetInstance().taskQueue_.empty());
+    auto cameraTask = std::make_shared<MockDisableTask>("networkId_1", "uuid_1", "udid_1", "camera_1",
+        DHType::CAMERA);
+    auto otherCameraTask = std::make_shared<MockDisableTask>("networkId_1", "uuid_1", "udid_1", "camera_2",
+        DHType::CAMERA);
+    auto audioTask = std::make_shared<MockDisableTask>("networkId_1", "uuid_1", "udid_1", "audio_1",
+        DHType::AUDIO);
+    auto remoteCameraTask = std::make_shared<MockDisableTask>("networkId_2", "uuid_2", "udid_2", "camera_1",
+        DHType::CAMERA);
+    EXPECT_EQ(TaskExecutor::GetLaneKey(cameraTask), TaskExecutor::GetLaneKey(otherCameraTask));
+    EXPECT_NE(TaskExecutor::GetLaneKey(cameraTask), TaskExecutor::GetLaneKey(audioTask));
+    EXPECT_NE(TaskExecutor::GetLaneKey(cameraTask), TaskExecutor::GetLaneKey(remoteCameraTask));
 }
 
 HWTEST_F(TaskTest, task_test_022, TestSize.Level1)
@@ -459,5 +468,42 @@ HWTEST_F(TaskTest, CreateTask_003, TestSize.Level1)
     auto task = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, fatherTask);
     ASSERT_NE(nullptr, task);
 }
+
+HWTEST_F(TaskTest, WaitForAllDisableTaskFinish_001, TestSize.Level1)
+{
+    TaskBoard::GetInstance().tasks_.clear();
+    EXPECT_EQ(DH_FWK_SUCCESS, TaskBoard::GetInstance().WaitForAllDisableTaskFinish(0));
+
+    std::shared_ptr<Task> disableTask =
+        std::make_shared<DisableTask>("networkId_3", "uuid_3", "udid_3", "camera_3", DHType::CAMERA);
+    TaskBoard::GetInstance().tasks_.emplace(disableTask->GetId(), disableTask);
+    EXPECT_EQ(ERR_DH_FWK_TASK_TIMEOUT, TaskBoard::GetInstance().WaitForAllDisableTaskFinish(0));
+
+    std::thread removeThread([disableTask]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        TaskBoard::GetInstance().RemoveTask(disableTask->GetId());
+    });
+    EXPECT_EQ(DH_FWK_SUCCESS, TaskBoard::GetInstance().WaitForAllDisableTaskFinish(1000));
+    removeThread.join();
+}
+
+HWTEST_F(TaskTest, WaitForOtherTaskFinish_001, TestSize.Level1)
+{
+    TaskBoard::GetInstance().tasks_.clear();
+    std::shared_ptr<Task> exitTask = std::make_shared<ExitDfwkTask>("", "", "", "", DHType::UNKNOWN);
+    std::shared_ptr<Task> onlineTask =
+        std::make_shared<OnLineTask>("networkId_4", "uuid_4", "udid_4", "camera_4", DHType::CAMERA);
+    TaskBoard::GetInstance().tasks_.emplace(exitTask->GetId(), exitTask);
+    TaskBoard::GetInstance().tasks_.emplace(onlineTask->GetId(), onlineTask);
+    EXPECT_EQ(ERR_DH_FWK_TASK_TIMEOUT, TaskBoard::GetInstance().WaitForOtherTaskFinish(exitTask->GetId(), 0));
+
+    std::thread removeThread([onlineTask]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        TaskBoard::GetInstance().RemoveTask(onlineTask->GetId());
+    });
+    EXPECT_EQ(DH_FWK_SUCCESS, TaskBoard::GetInstance().WaitForOtherTaskFinish(exitTask->GetId(), 1000));
+    removeThread.join();
+    TaskBoard::GetInstance().tasks_.clear();
+}
 } // namespace DistributedHardware
 } // namespace OHOS
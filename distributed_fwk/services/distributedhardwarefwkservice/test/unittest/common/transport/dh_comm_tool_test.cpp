@@ -367,5 +367,105 @@ HWTEST_F(DhCommToolTest, SplitString_001, TestSize.Level1)
     ret = dhCommToolTest_->SplitString(capInfoPrefix);
     EXPECT_EQ("123", ret);
 }
+
+HWTEST_F(DhCommToolTest, GetMetaCapsDigest_001, TestSize.Level1)
+{
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> metaCaps;
+    EXPECT_EQ("", DHCommTool::GetMetaCapsDigest(metaCaps));
+    metaCaps.push_back(nullptr);
+    EXPECT_EQ("", DHCommTool::GetMetaCapsDigest(metaCaps));
+
+    metaCaps.push_back(std::make_shared<MetaCapabilityInfo>("camera_1", "dev_1", "dev_name", TEST_DEV_TYPE,
+        DHType::CAMERA, "{\"abilities\": 1}", "camera", "udid_hash", CompVersion{ .sinkVersion = "1.0" }));
+    std::string digest = DHCommTool::GetMetaCapsDigest(metaCaps);
+    EXPECT_FALSE(digest.empty());
+    EXPECT_EQ(digest, DHCommTool::GetMetaCapsDigest(metaCaps));
+
+    metaCaps.back()->SetDHAttrs("{\"abilities\": 2}");
+    EXPECT_NE(digest, DHCommTool::GetMetaCapsDigest(metaCaps));
+}
+
+HWTEST_F(DhCommToolTest, GetUnchangedRemoteDHCaps_001, TestSize.Level1)
+{
+    ASSERT_TRUE(dhCommToolTest_ != nullptr);
+    FullCapsRsp capsRsp;
+    std::string remoteDigest = "digest";
+    std::string realNetworkId = "123456789";
+    EXPECT_FALSE(dhCommToolTest_->GetUnchangedRemoteDHCaps(remoteDigest, realNetworkId, capsRsp));
+    EXPECT_TRUE(capsRsp.metaCaps.empty());
+    EXPECT_EQ("", dhCommToolTest_->GetRemoteMetaCapsDigest(realNetworkId));
+}
+
+HWTEST_F(DhCommToolTest, GetLocalCapsDelta_001, TestSize.Level1)
+{
+    ASSERT_TRUE(dhCommToolTest_ != nullptr);
+    auto camera = std::make_shared<MetaCapabilityInfo>("camera_1", "dev_1", "dev_name", TEST_DEV_TYPE,
+        DHType::CAMERA, "{\"abilities\": 1}", "camera", "udid_hash", CompVersion{ .sinkVersion = "1.0" });
+    auto mic = std::make_shared<MetaCapabilityInfo>("mic_1", "dev_1", "dev_name", TEST_DEV_TYPE,
+        DHType::AUDIO, "{\"abilities\": 1}", "mic", "udid_hash", CompVersion{ .sinkVersion = "1.0" });
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> baseCaps = { camera, mic };
+    std::string baseDigest = DHCommTool::GetMetaCapsDigest(baseCaps);
+    uint64_t baseGen = dhCommToolTest_->UpdateLocalCapsGeneration(baseCaps, baseDigest);
+    EXPECT_EQ(baseGen, dhCommToolTest_->UpdateLocalCapsGeneration(baseCaps, baseDigest));
+
+    auto newCamera = std::make_shared<MetaCapabilityInfo>("camera_1", "dev_1", "dev_name", TEST_DEV_TYPE,
+        DHType::CAMERA, "{\"abilities\": 2}", "camera", "udid_hash", CompVersion{ .sinkVersion = "1.0" });
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> curCaps = { newCamera };
+    EXPECT_EQ(baseGen + 1, dhCommToolTest_->UpdateLocalCapsGeneration(curCaps, DHCommTool::GetMetaCapsDigest(curCaps)));
+
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> changedCaps;
+    std::vector<std::string> removedKeys;
+    EXPECT_FALSE(dhCommToolTest_->GetLocalCapsDelta(baseGen, "digest", curCaps, changedCaps, removedKeys));
+    EXPECT_FALSE(dhCommToolTest_->GetLocalCapsDelta(0, baseDigest, curCaps, changedCaps, removedKeys));
+    ASSERT_TRUE(dhCommToolTest_->GetLocalCapsDelta(baseGen, baseDigest, curCaps, changedCaps, removedKeys));
+    ASSERT_EQ(1u, changedCaps.size());
+    EXPECT_EQ(newCamera, changedCaps[0]);
+    ASSERT_EQ(1u, removedKeys.size());
+    EXPECT_EQ(mic->GetKey(), removedKeys[0]);
+}
+
+HWTEST_F(DhCommToolTest, TriggerReqPartialDHCaps_001, TestSize.Level1)
+{
+    ASSERT_TRUE(dhCommToolTest_ != nullptr);
+    std::string remoteNetworkId = "123456789";
+    g_mocklocalNetworkId = "";
+    ASSERT_NO_FATAL_FAILURE(dhCommToolTest_->TriggerReqPartialDHCaps(remoteNetworkId, DHType::CAMERA, ""));
+    ASSERT_NO_FATAL_FAILURE(dhCommToolTest_->TriggerReqPartialDHCaps(remoteNetworkId, DHType::UNKNOWN, ""));
+    dhCommToolTest_->dhTransportPtr_ = nullptr;
+    ASSERT_NO_FATAL_FAILURE(dhCommToolTest_->TriggerReqPartialDHCaps(remoteNetworkId, DHType::CAMERA, "camera_1"));
+    ASSERT_NO_FATAL_FAILURE(dhCommToolTest_->GetAndSendLocalPartialCaps(remoteNetworkId, DHType::CAMERA, ""));
+}
+
+HWTEST_F(DhCommToolTest, OnRemotePartialCapsSaved_001, TestSize.Level1)
+{
+    ASSERT_TRUE(dhCommToolTest_ != nullptr);
+    std::string remoteNetworkId = "networkId_test";
+    EXPECT_FALSE(dhCommToolTest_->HasRemotePartialCapsOnly(remoteNetworkId));
+    EXPECT_FALSE(dhCommToolTest_->IsSyncResponseExpected(remoteNetworkId));
+    dhCommToolTest_->OnRemotePartialCapsSaved(remoteNetworkId);
+    EXPECT_TRUE(dhCommToolTest_->HasRemotePartialCapsOnly(remoteNetworkId));
+    EXPECT_TRUE(dhCommToolTest_->IsSyncResponseExpected(remoteNetworkId));
+    dhCommToolTest_->OnRemoteFullCapsSaved(remoteNetworkId);
+    EXPECT_FALSE(dhCommToolTest_->HasRemotePartialCapsOnly(remoteNetworkId));
+    EXPECT_FALSE(dhCommToolTest_->IsSyncResponseExpected(remoteNetworkId));
+}
+
+HWTEST_F(DhCommToolTest, ProcessEvent_003, TestSize.Level1)
+{
+    std::shared_ptr<CommMsg> commMsg = std::make_shared<CommMsg>();
+    commMsg->reqDHType = static_cast<uint32_t>(DHType::CAMERA);
+    commMsg->isSyncMeta = true;
+    std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create(true);
+    DHCommTool::DHCommToolEventHandler eventHandler(runner, dhCommToolTest_);
+    AppExecFwk::InnerEvent::Pointer event1 = AppExecFwk::InnerEvent::Get(DH_COMM_REQ_FULL_CAPS, commMsg);
+    ASSERT_NO_FATAL_FAILURE(eventHandler.ProcessEvent(event1));
+
+    std::shared_ptr<CommMsg> rspMsg = std::make_shared<CommMsg>();
+    rspMsg->isPartialCaps = true;
+    rspMsg->realNetworkId = "networkId_test";
+    AppExecFwk::InnerEvent::Pointer event2 = AppExecFwk::InnerEvent::Get(DH_COMM_RSP_FULL_CAPS, rspMsg);
+    ASSERT_NO_FATAL_FAILURE(eventHandler.ProcessEvent(event2));
+    EXPECT_FALSE(dhCommToolTest_->HasRemotePartialCapsOnly(rspMsg->realNetworkId));
+}
 }
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,6 +19,7 @@
 
 #include "dh_transport_obj.h"
 #include "dh_utils_tool.h"
+#include "dh_zlib_codec.h"
 #include "distributed_hardware_log.h"
 
 
@@ -130,5 +131,54 @@ HWTEST_F(DhTransportObjTest, FromJson_FullCapsRsp_002, TestSize.Level1)
     ASSERT_NO_FATAL_FAILURE(FromJson(jsonObject, capsRsp, isSyncMeta));
     cJSON_Delete(jsonObject);
 }
+
+HWTEST_F(DhTransportObjTest, FromJson_CommMsg_001, TestSize.Level1)
+{
+    CommMsg sent;
+    cJSON *jsonObject = cJSON_CreateObject();
+    ASSERT_TRUE(jsonObject != nullptr);
+    ToJson(jsonObject, sent);
+    CommMsg received;
+    FromJson(jsonObject, received);
+    cJSON_Delete(jsonObject);
+    EXPECT_EQ(DHZlibCodec::GetPresetDictId(), received.compressDictId);
+
+    CommMsg legacy;
+    cJSON *legacyJson = cJSON_CreateObject();
+    ASSERT_TRUE(legacyJson != nullptr);
+    cJSON_AddNumberToObject(legacyJson, COMM_MSG_CODE_KEY, 1);
+    FromJson(legacyJson, legacy);
+    cJSON_Delete(legacyJson);
+    EXPECT_EQ(0u, legacy.compressDictId);
+}
+
+HWTEST_F(DhTransportObjTest, FromJson_CommMsg_002, TestSize.Level1)
+{
+    CommMsg sent;
+    sent.reqDHType = static_cast<uint32_t>(DHType::CAMERA);
+    sent.reqDHId = "camera_1";
+    sent.isPartialCaps = true;
+    cJSON *jsonObject = cJSON_CreateObject();
+    ASSERT_TRUE(jsonObject != nullptr);
+    ToJson(jsonObject, sent);
+    CommMsg received;
+    FromJson(jsonObject, received);
+    cJSON_Delete(jsonObject);
+    EXPECT_EQ(static_cast<uint32_t>(DHType::CAMERA), received.reqDHType);
+    EXPECT_EQ("camera_1", received.reqDHId);
+    EXPECT_TRUE(received.isPartialCaps);
+
+    CommMsg full;
+    cJSON *fullJson = cJSON_CreateObject();
+    ASSERT_TRUE(fullJson != nullptr);
+    ToJson(fullJson, full);
+    EXPECT_EQ(nullptr, cJSON_GetObjectItem(fullJson, COMM_MSG_REQ_DH_TYPE_KEY));
+    EXPECT_EQ(nullptr, cJSON_GetObjectItem(fullJson, COMM_MSG_CAPS_PARTIAL_KEY));
+    CommMsg fullReceived;
+    FromJson(fullJson, fullReceived);
+    cJSON_Delete(fullJson);
+    EXPECT_EQ(0u, fullReceived.reqDHType);
+    EXPECT_FALSE(fullReceived.isPartialCaps);
+}
 }
 }
\ No newline at end of file
@@ -19,8 +19,10 @@
 #include "device_manager.h"
 #include "device_manager_impl.h"
 
+#include "anonymous_string.h"
 #include "dh_transport.h"
 #include "dh_comm_tool.h"
+#include "dh_perf_stats.h"
 #include "dh_transport_obj.h"
 #include "dh_utils_tool.h"
 #include "capability_info_manager.h"
@@ -238,6 +240,115 @@ HWTEST_F(DhTransportTest, Send_002, TestSize.Level1)
     EXPECT_EQ(ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED, ret);
 }
 
+HWTEST_F(DhTransportTest, Send_003, TestSize.Level1)
+{
+    ASSERT_TRUE(dhTransportTest_ != nullptr);
+    dhTransportTest_->remoteDevSocketIds_.clear();
+    dhTransportTest_->SetDeviceSocketBinding(g_networkid);
+    EXPECT_EQ(DH_FWK_SUCCESS, dhTransportTest_->Send(g_networkid, "payload_1"));
+    EXPECT_EQ(DH_FWK_SUCCESS, dhTransportTest_->Send(g_networkid, "payload_2"));
+    EXPECT_EQ(2, dhTransportTest_->sendQueues_[g_networkid].payloads.size());
+    EXPECT_EQ(DH_FWK_SUCCESS, dhTransportTest_->FlushSendQueue(g_networkid));
+    EXPECT_EQ(2, dhTransportTest_->sendQueues_[g_networkid].payloads.size());
+
+    dhTransportTest_->OnDeviceSocketBound(g_networkid, false);
+    EXPECT_TRUE(dhTransportTest_->sendQueues_.empty());
+    EXPECT_TRUE(dhTransportTest_->bindingNetworkIds_.empty());
+    EXPECT_EQ(ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED, dhTransportTest_->Send(g_networkid, "payload_3"));
+}
+
+HWTEST_F(DhTransportTest, StartSocketAsync_001, TestSize.Level1)
+{
+    ASSERT_TRUE(dhTransportTest_ != nullptr);
+    std::vector<int32_t> results;
+    auto callback = [&results](const std::string &networkId, int32_t result) { results.push_back(result); };
+    EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, dhTransportTest_->StartSocketAsync("", callback));
+    EXPECT_TRUE(results.empty());
+
+    dhTransportTest_->remoteDevSocketIds_[g_networkid] = g_socketid;
+    EXPECT_EQ(DH_FWK_SUCCESS, dhTransportTest_->StartSocketAsync(g_networkid, callback));
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(DH_FWK_SUCCESS, results[0]);
+
+    dhTransportTest_->remoteDevSocketIds_.clear();
+    DHPerfStats::GetInstance().Reset();
+    EXPECT_EQ(ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED, dhTransportTest_->StartSocketAsync(g_networkid, callback));
+    ASSERT_EQ(2, results.size());
+    EXPECT_EQ(ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED, results[1]);
+    EXPECT_TRUE(dhTransportTest_->bindingNetworkIds_.empty());
+    EXPECT_TRUE(dhTransportTest_->bindCallbacks_.empty());
+    std::map<std::string, PerfCostStat> costStats;
+    DHPerfStats::GetInstance().DumpCostStats(PerfCategory::SOCKET_BIND_FAIL, costStats);
+    EXPECT_EQ(1, costStats[GetAnonyString(g_networkid)].count);
+}
+
+HWTEST_F(DhTransportTest, StartSocketAsync_002, TestSize.Level1)
+{
+    ASSERT_TRUE(dhTransportTest_ != nullptr);
+    std::vector<int32_t> results;
+    auto callback = [&results](const std::string &networkId, int32_t result) { results.push_back(result); };
+    dhTransportTest_->remoteDevSocketIds_.clear();
+    EXPECT_TRUE(dhTransportTest_->SetDeviceSocketBinding(g_networkid));
+    EXPECT_EQ(DH_FWK_SUCCESS, dhTransportTest_->StartSocketAsync(g_networkid, callback));
+    EXPECT_EQ(DH_FWK_SUCCESS, dhTransportTest_->StartSocket(g_networkid));
+    EXPECT_TRUE(results.empty());
+    EXPECT_EQ(1, dhTransportTest_->bindCallbacks_[g_networkid].size());
+
+    dhTransportTest_->OnDeviceSocketBound(g_networkid, true);
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(DH_FWK_SUCCESS, results[0]);
+    EXPECT_FALSE(dhTransportTest_->IsDeviceSocketBinding(g_networkid));
+    EXPECT_TRUE(dhTransportTest_->bindCallbacks_.empty());
+
+    EXPECT_TRUE(dhTransportTest_->SetDeviceSocketBinding(g_networkid, callback));
+    EXPECT_EQ(ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED, dhTransportTest_->StopSocket(g_networkid));
+    ASSERT_EQ(2, results.size());
+    EXPECT_EQ(ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED, results[1]);
+    EXPECT_FALSE(dhTransportTest_->IsDeviceSocketBinding(g_networkid));
+}
+
+HWTEST_F(DhTransportTest, PackBatches_001, TestSize.Level1)
+{
+    std::vector<std::string> payloads = { "{\"code\":1}", "", "{\"code\":2}" };
+    std::vector<std::string> frames;
+    DHTransport::PackBatches(payloads, frames);
+    ASSERT_EQ(1, frames.size());
+    std::vector<std::string> unpacked;
+    EXPECT_TRUE(DHTransport::UnpackBatch(frames[0], unpacked));
+    EXPECT_EQ(payloads, unpacked);
+
+    frames.clear();
+    DHTransport::PackBatches({ payloads[0] }, frames);
+    ASSERT_EQ(1, frames.size());
+    EXPECT_EQ(payloads[0], frames[0]);
+
+    frames.clear();
+    DHTransport::PackBatches(payloads, frames);
+    ASSERT_EQ(1, frames.size());
+    std::string truncated = frames[0].substr(0, frames[0].size() - 1);
+    unpacked.clear();
+    EXPECT_FALSE(DHTransport::UnpackBatch(truncated, unpacked));
+}
+
+HWTEST_F(DhTransportTest, IsPeerBatchSupported_001, TestSize.Level1)
+{
+    ASSERT_TRUE(dhTransportTest_ != nullptr);
+    CommMsg commMsg;
+    std::string payload = GetCommMsgString(commMsg);
+    cJSON *root = cJSON_Parse(payload.c_str());
+    ASSERT_TRUE(root != nullptr);
+    CommMsg parsedMsg;
+    FromJson(root, parsedMsg);
+    cJSON_Delete(root);
+    EXPECT_TRUE(parsedMsg.isBatchSupported);
+
+    EXPECT_FALSE(dhTransportTest_->IsPeerBatchSupported(g_networkid));
+    dhTransportTest_->UpdatePeerBatchSupported(g_networkid, parsedMsg.isBatchSupported);
+    EXPECT_TRUE(dhTransportTest_->IsPeerBatchSupported(g_networkid));
+    dhTransportTest_->RemovePeerFeatures(g_networkid);
+    EXPECT_FALSE(dhTransportTest_->IsPeerBatchSupported(g_networkid));
+}
+
 HWTEST_F(DhTransportTest, GetRemoteNetworkIdBySocketId_001, TestSize.Level1)
 {
     ASSERT_TRUE(dhTransportTest_ != nullptr);
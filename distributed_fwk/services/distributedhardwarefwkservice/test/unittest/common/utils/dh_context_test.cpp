@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -484,5 +484,53 @@ HWTEST_F(DhContextTest, IsRealTimeOnlineDevice_001, TestSize.Level1)
     ret = DHContext::GetInstance().IsRealTimeOnlineDevice(networkId);
     EXPECT_EQ(false, ret);
 }
+
+HWTEST_F(DhContextTest, RemoveOnlineDeviceIdEntryByNetworkId_002, TestSize.Level1)
+{
+    DHContext::GetInstance().devIdEntrySet_.clear();
+    std::string newNetworkId = "000000";
+    DHContext::GetInstance().AddOnlineDevice(TEST_UDID, TEST_UUID, TEST_NETWORKID);
+    DHContext::GetInstance().AddOnlineDevice(TEST_UDID, TEST_UUID, newNetworkId);
+    EXPECT_EQ(newNetworkId, DHContext::GetInstance().GetNetworkIdByUUID(TEST_UUID));
+    EXPECT_EQ(newNetworkId, DHContext::GetInstance().GetNetworkIdByUDID(TEST_UDID));
+
+    DHContext::GetInstance().RemoveOnlineDeviceIdEntryByNetworkId(newNetworkId);
+    EXPECT_EQ(TEST_NETWORKID, DHContext::GetInstance().GetNetworkIdByUUID(TEST_UUID));
+    EXPECT_EQ(TEST_NETWORKID, DHContext::GetInstance().GetNetworkIdByDeviceId(Sha256(TEST_UUID)));
+    EXPECT_EQ("", DHContext::GetInstance().GetUUIDByNetworkId(newNetworkId));
+
+    DHContext::GetInstance().RemoveOnlineDeviceIdEntryByNetworkId(TEST_NETWORKID);
+    EXPECT_FALSE(DHContext::GetInstance().IsDeviceOnline(TEST_UUID));
+    EXPECT_EQ("", DHContext::GetInstance().GetUUIDByDeviceId(Sha256(TEST_UDID)));
+}
+
+HWTEST_F(DhContextTest, GetDeviceInfoSnapshot_001, TestSize.Level1)
+{
+    auto snapshot = DHContext::GetInstance().GetDeviceInfoSnapshot();
+    ASSERT_NE(nullptr, snapshot);
+    const DeviceInfo &devInfo = DHContext::GetInstance().GetDeviceInfo();
+    EXPECT_EQ(devInfo.uuid, snapshot->uuid);
+    EXPECT_EQ(devInfo.deviceId, snapshot->deviceId);
+    EXPECT_EQ(devInfo.udidHash, snapshot->udidHash);
+    if (!snapshot->uuid.empty()) {
+        EXPECT_EQ(snapshot, DHContext::GetInstance().GetDeviceInfoSnapshot());
+    }
+
+    std::string deviceId = snapshot->deviceId;
+    {
+        std::lock_guard<std::mutex> lock(DHContext::GetInstance().devMutex_);
+        DHContext::GetInstance().devInfo_.deviceId = "deviceId_snapshot";
+        DHContext::GetInstance().PublishDeviceInfoLocked();
+    }
+    auto updated = DHContext::GetInstance().GetDeviceInfoSnapshot();
+    ASSERT_NE(nullptr, updated);
+    EXPECT_EQ("deviceId_snapshot", updated->deviceId);
+    EXPECT_EQ(deviceId, snapshot->deviceId);
+    {
+        std::lock_guard<std::mutex> lock(DHContext::GetInstance().devMutex_);
+        DHContext::GetInstance().devInfo_.deviceId = deviceId;
+        DHContext::GetInstance().PublishDeviceInfoLocked();
+    }
+}
 }
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <map>
+#include <string>
+
+#include "dh_perf_stats.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int64_t TEST_FAST_COST_US = 500;
+constexpr int64_t TEST_SLOW_COST_US = 20000000;
+const std::string TEST_KEY = "test_key";
+const std::string TEST_NETWORK_ID = "test_network_id";
+}
+
+class DhPerfStatsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DhPerfStatsTest::SetUp()
+{
+    DHPerfStats::GetInstance().Reset();
+}
+
+void DhPerfStatsTest::TearDown()
+{
+    DHPerfStats::GetInstance().Reset();
+}
+
+void DhPerfStatsTest::SetUpTestCase() {}
+
+void DhPerfStatsTest::TearDownTestCase() {}
+
+HWTEST_F(DhPerfStatsTest, RecordCost_001, TestSize.Level1)
+{
+    DHPerfStats::GetInstance().RecordCost(PerfCategory::DB_PUT, TEST_KEY, TEST_FAST_COST_US);
+    DHPerfStats::GetInstance().RecordCost(PerfCategory::DB_PUT, TEST_KEY, TEST_SLOW_COST_US);
+    DHPerfStats::GetInstance().RecordCost(PerfCategory::DB_PUT, TEST_KEY, -1);
+    DHPerfStats::GetInstance().RecordCost(PerfCategory::MAX, TEST_KEY, TEST_FAST_COST_US);
+
+    std::map<std::string, PerfCostStat> costStats;
+    DHPerfStats::GetInstance().DumpCostStats(PerfCategory::DB_PUT, costStats);
+    ASSERT_EQ(1, costStats.size());
+    const PerfCostStat &stat = costStats[TEST_KEY];
+    EXPECT_EQ(3, stat.count);
+    EXPECT_EQ(TEST_FAST_COST_US + TEST_SLOW_COST_US, stat.totalUs);
+    EXPECT_EQ(TEST_SLOW_COST_US, stat.maxUs);
+    EXPECT_EQ(2, stat.buckets[0]);
+    EXPECT_EQ(1, stat.buckets[PERF_BUCKET_COUNT - 1]);
+
+    costStats.clear();
+    DHPerfStats::GetInstance().DumpCostStats(PerfCategory::DB_SYNC, costStats);
+    EXPECT_TRUE(costStats.empty());
+}
+
+HWTEST_F(DhPerfStatsTest, RecordCost_002, TestSize.Level1)
+{
+    {
+        PerfCostScope costScope(PerfCategory::TASK_RUN, TEST_KEY);
+    }
+    for (size_t i = 0; i <= DHPerfStats::MAX_PERF_KEYS; i++) {
+        DHPerfStats::GetInstance().RecordCost(PerfCategory::PUBLISHER_DELIVERY, std::to_string(i), 0);
+    }
+    std::map<std::string, PerfCostStat> costStats;
+    DHPerfStats::GetInstance().DumpCostStats(PerfCategory::TASK_RUN, costStats);
+    EXPECT_EQ(1, costStats[TEST_KEY].count);
+    costStats.clear();
+    DHPerfStats::GetInstance().DumpCostStats(PerfCategory::PUBLISHER_DELIVERY, costStats);
+    EXPECT_EQ(DHPerfStats::MAX_PERF_KEYS, costStats.size());
+}
+
+HWTEST_F(DhPerfStatsTest, RecordTraffic_001, TestSize.Level1)
+{
+    DHPerfStats::GetInstance().RecordTraffic(TEST_NETWORK_ID, 1000, 400);
+    DHPerfStats::GetInstance().RecordTraffic(TEST_NETWORK_ID, 1000, 200);
+    std::map<std::string, PerfTrafficStat> trafficStats;
+    DHPerfStats::GetInstance().DumpTrafficStats(trafficStats);
+    EXPECT_EQ(2, trafficStats[TEST_NETWORK_ID].msgCount);
+    EXPECT_EQ(2000, trafficStats[TEST_NETWORK_ID].rawBytes);
+    EXPECT_EQ(600, trafficStats[TEST_NETWORK_ID].sentBytes);
+
+    DHPerfStats::GetInstance().Reset();
+    trafficStats.clear();
+    DHPerfStats::GetInstance().DumpTrafficStats(trafficStats);
+    EXPECT_TRUE(trafficStats.empty());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
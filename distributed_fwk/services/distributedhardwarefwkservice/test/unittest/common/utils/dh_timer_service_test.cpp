@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "dh_timer.h"
+#include "dh_timer_service.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t TEST_DELAY_MS = 10;
+constexpr int32_t TEST_WAIT_MS = 200;
+}
+
+class TestTimer : public DHTimer {
+public:
+    TestTimer(std::string timerId, int32_t delayTimeMs) : DHTimer(timerId, delayTimeMs) {}
+    ~TestTimer() override = default;
+
+    std::atomic<int32_t> executeCount_ {0};
+    std::atomic<int32_t> stopCount_ {0};
+    std::thread::id executeThread_;
+
+private:
+    void ExecuteInner() override
+    {
+        executeThread_ = std::this_thread::get_id();
+        executeCount_++;
+    }
+
+    void HandleStopTimer() override
+    {
+        stopCount_++;
+    }
+};
+
+class DhTimerServiceTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void DhTimerServiceTest::SetUp() {}
+
+void DhTimerServiceTest::TearDown() {}
+
+void DhTimerServiceTest::SetUpTestCase() {}
+
+void DhTimerServiceTest::TearDownTestCase() {}
+
+HWTEST_F(DhTimerServiceTest, PostTask_001, TestSize.Level1)
+{
+    std::atomic<int32_t> runCount {0};
+    EXPECT_TRUE(DHTimerService::GetInstance().PostTask("test_task", [&runCount]() { runCount++; }, 0));
+    EXPECT_TRUE(DHTimerService::GetInstance().PostTask("test_remove_task", [&runCount]() { runCount++; },
+        TEST_WAIT_MS));
+    DHTimerService::GetInstance().RemoveTask("test_remove_task");
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_WAIT_MS * 2));
+    EXPECT_EQ(1, runCount.load());
+}
+
+HWTEST_F(DhTimerServiceTest, StartTimer_001, TestSize.Level1)
+{
+    TestTimer timer1("test_timer", TEST_DELAY_MS);
+    TestTimer timer2("test_timer", TEST_DELAY_MS);
+    timer1.StartTimer();
+    timer2.StartTimer();
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_WAIT_MS));
+    EXPECT_EQ(1, timer1.executeCount_.load());
+    EXPECT_EQ(1, timer2.executeCount_.load());
+    EXPECT_EQ(timer1.executeThread_, timer2.executeThread_);
+    EXPECT_NE(std::this_thread::get_id(), timer1.executeThread_);
+}
+
+HWTEST_F(DhTimerServiceTest, StopTimer_001, TestSize.Level1)
+{
+    TestTimer timer("test_timer", TEST_WAIT_MS);
+    timer.StartTimer();
+    timer.StopTimer();
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_WAIT_MS * 3));
+    EXPECT_EQ(0, timer.executeCount_.load());
+    EXPECT_EQ(1, timer.stopCount_.load());
+}
+
+HWTEST_F(DhTimerServiceTest, StopTimer_002, TestSize.Level1)
+{
+    auto timer = std::make_shared<TestTimer>("test_timer", TEST_WAIT_MS);
+    timer->StartTimer();
+    timer = nullptr;
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_WAIT_MS * 3));
+    EXPECT_EQ(nullptr, timer);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Copyright (C) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,7 +17,9 @@
 #include "ohos.distributedHardware.hardwareManager.impl.hpp"
 #include "taihe/runtime.hpp"
 #include "stdexcept"
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include "ipc_skeleton.h"
 #include "device_type.h"
@@ -51,97 +53,130 @@ bool HasAccessDHPermission()
     return (result == OHOS::Security::AccessToken::PERMISSION_GRANTED);
 }
 
-void PauseDistributedHardwareSync(::ohos::distributedHardware::hardwareManager::HardwareDescriptor const& description)
+enum class DHOperation : int32_t {
+    PAUSE = 0,
+    RESUME = 1,
+    STOP = 2,
+};
+
+bool VerifyCaller()
 {
-    DHLOGI("PauseDistributedHardware in");
     if (!IsSystemApp()) {
         taihe::set_business_error(ERR_NOT_SYSTEM_APP, "The caller is not a system application.");
-        return;
+        return false;
     }
     if (!HasAccessDHPermission()) {
         taihe::set_business_error(ERR_NO_PERMISSION, "Permission verify failed.");
+        return false;
     }
-    int32_t hardwareType = description.type;
-    DHType dhType = DHType::UNKNOWN;
+    return true;
+}
+
+DHType ToDHType(int32_t hardwareType)
+{
     DHSubtype dhSubtype = static_cast<DHSubtype>(hardwareType);
     if (dhSubtype == DHSubtype::AUDIO_MIC || dhSubtype == DHSubtype::AUDIO_SPEAKER) {
-        dhType = DHType::AUDIO;
+        return DHType::AUDIO;
     } else if (dhSubtype == DHSubtype::CAMERA) {
-        dhType = DHType::CAMERA;
+        return DHType::CAMERA;
     }
+    return DHType::UNKNOWN;
+}
+
+template<typename Descriptor>
+std::string GetSrcNetworkId(Descriptor const& description)
+{
     std::string srcNetworkId;
     if (description.srcNetworkId.has_value()) {
         srcNetworkId = description.srcNetworkId.value();
     }
+    return srcNetworkId;
+}
 
+void RunOperation(DHOperation operation, const std::vector<DHType> &dhTypes, const std::string &srcNetworkId)
+{
     std::shared_ptr<DistributedHardwareFwkKit> dhFwkKit = std::make_shared<DistributedHardwareFwkKit>();
-    int32_t ret = dhFwkKit->PauseDistributedHardware(dhType, std::string(srcNetworkId));
-    if (ret != 0) {
-        DHLOGE("PauseDistributedHardware for DHType: %{public}u filed", (uint32_t)dhType);
+    for (DHType dhType : dhTypes) {
+        int32_t ret = 0;
+        switch (operation) {
+            case DHOperation::PAUSE:
+                ret = dhFwkKit->PauseDistributedHardware(dhType, srcNetworkId);
+                break;
+            case DHOperation::RESUME:
+                ret = dhFwkKit->ResumeDistributedHardware(dhType, srcNetworkId);
+                break;
+            case DHOperation::STOP:
+                ret = dhFwkKit->StopDistributedHardware(dhType, srcNetworkId);
+                break;
+            default:
+                break;
+        }
+        if (ret != 0) {
+            DHLOGE("Operation %{public}d for DHType: %{public}u failed, ret: %{public}d",
+                static_cast<int32_t>(operation), (uint32_t)dhType, ret);
+        }
     }
-    return;
 }
 
-void ResumeDistributedHardwareSync(::ohos::distributedHardware::hardwareManager::HardwareDescriptor const& description)
+template<typename Descriptor>
+std::vector<DHType> GetDHTypes(Descriptor const& description)
 {
-    DHLOGI("ResumeDistributedHardware in");
-    if (!IsSystemApp()) {
-        taihe::set_business_error(ERR_NOT_SYSTEM_APP, "The caller is not a system application.");
-        return;
-    }
-    if (!HasAccessDHPermission()) {
-        taihe::set_business_error(ERR_NO_PERMISSION, "Permission verify failed.");
+    std::vector<DHType> dhTypes;
+    for (auto const& type : description.types) {
+        int32_t hardwareType = type;
+        DHType dhType = ToDHType(hardwareType);
+        if (std::find(dhTypes.begin(), dhTypes.end(), dhType) == dhTypes.end()) {
+            dhTypes.push_back(dhType);
+        }
     }
-    int32_t hardwareType = description.type;
-    DHType dhType = DHType::UNKNOWN;
-    DHSubtype dhSubtype = static_cast<DHSubtype>(hardwareType);
-    if (dhSubtype == DHSubtype::AUDIO_MIC || dhSubtype == DHSubtype::AUDIO_SPEAKER) {
-        dhType = DHType::AUDIO;
-    } else if (dhSubtype == DHSubtype::CAMERA) {
-        dhType = DHType::CAMERA;
-    }
-    std::string srcNetworkId;
-    if (description.srcNetworkId.has_value()) {
-        srcNetworkId = description.srcNetworkId.value();
+    return dhTypes;
+}
+
+void PauseDistributedHardwareSync(::ohos::distributedHardware::hardwareManager::HardwareDescriptor const& description)
+{
+    DHLOGI("PauseDistributedHardware in");
+    if (!VerifyCaller()) {
+        return;
     }
+    RunOperation(DHOperation::PAUSE, { ToDHType(description.type) }, GetSrcNetworkId(description));
+}
 
-    std::shared_ptr<DistributedHardwareFwkKit> dhFwkKit = std::make_shared<DistributedHardwareFwkKit>();
-    int32_t ret = dhFwkKit->ResumeDistributedHardware(dhType, std::string(srcNetworkId));
-    if (ret != 0) {
-        DHLOGE("ResumeDistributedHardware for DHType: %{public}u filed", (uint32_t)dhType);
+void ResumeDistributedHardwareSync(::ohos::distributedHardware::hardwareManager::HardwareDescriptor const& description)
+{
+    DHLOGI("ResumeDistributedHardware in");
+    if (!VerifyCaller()) {
+        return;
     }
-    return;
+    RunOperation(DHOperation::RESUME, { ToDHType(description.type) }, GetSrcNetworkId(description));
 }
 
 void StopDistributedHardwareSync(::ohos::distributedHardware::hardwareManager::HardwareDescriptor const& description)
 {
     DHLOGI("StopDistributedHardware in");
-    if (!IsSystemApp()) {
-        taihe::set_business_error(ERR_NOT_SYSTEM_APP, "The caller is not a system application.");
+    if (!VerifyCaller()) {
         return;
     }
-    if (!HasAccessDHPermission()) {
-        taihe::set_business_error(ERR_NO_PERMISSION, "Permission verify failed.");
-    }
-    int32_t hardwareType = description.type;
-    DHType dhType = DHType::UNKNOWN;
-    DHSubtype dhSubtype = static_cast<DHSubtype>(hardwareType);
-    if (dhSubtype == DHSubtype::AUDIO_MIC || dhSubtype == DHSubtype::AUDIO_SPEAKER) {
-        dhType = DHType::AUDIO;
-    } else if (dhSubtype == DHSubtype::CAMERA) {
-        dhType = DHType::CAMERA;
-    }
-    std::string srcNetworkId;
-    if (description.srcNetworkId.has_value()) {
-        srcNetworkId = description.srcNetworkId.value();
+    RunOperation(DHOperation::STOP, { ToDHType(description.type) }, GetSrcNetworkId(description));
+}
+
+void PauseDistributedHardwareBatchSync(
+    ::ohos::distributedHardware::hardwareManager::HardwareBatchDescriptor const& description)
+{
+    DHLOGI("PauseDistributedHardwareBatch in");
+    if (!VerifyCaller()) {
+        return;
     }
+    RunOperation(DHOperation::PAUSE, GetDHTypes(description), GetSrcNetworkId(description));
+}
 
-    std::shared_ptr<DistributedHardwareFwkKit> dhFwkKit = std::make_shared<DistributedHardwareFwkKit>();
-    int32_t ret = dhFwkKit->StopDistributedHardware(dhType, std::string(srcNetworkId));
-    if (ret != 0) {
-        DHLOGE("StopDistributedHardware for DHType: %{public}u filed", (uint32_t)dhType);
+void ResumeDistributedHardwareBatchSync(
+    ::ohos::distributedHardware::hardwareManager::HardwareBatchDescriptor const& description)
+{
+    DHLOGI("ResumeDistributedHardwareBatch in");
+    if (!VerifyCaller()) {
+        return;
     }
-    return;
+    RunOperation(DHOperation::RESUME, GetDHTypes(description), GetSrcNetworkId(description));
 }
 }  // namespace
 
@@ -150,4 +185,6 @@ void StopDistributedHardwareSync(::ohos::distributedHardware::hardwareManager::H
 TH_EXPORT_CPP_API_PauseDistributedHardwareSync(PauseDistributedHardwareSync);
 TH_EXPORT_CPP_API_ResumeDistributedHardwareSync(ResumeDistributedHardwareSync);
 TH_EXPORT_CPP_API_StopDistributedHardwareSync(StopDistributedHardwareSync);
+TH_EXPORT_CPP_API_PauseDistributedHardwareBatchSync(PauseDistributedHardwareBatchSync);
+TH_EXPORT_CPP_API_ResumeDistributedHardwareBatchSync(ResumeDistributedHardwareBatchSync);
 // NOLINTEND
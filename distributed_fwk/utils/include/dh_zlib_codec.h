@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DISTRIBUTED_HARDWARE_DH_ZLIB_CODEC_H
+#define OHOS_DISTRIBUTED_HARDWARE_DH_ZLIB_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+struct z_stream_s;
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * zlib codec keeping one deflate and one inflate state for its whole life, a socket compresses and inflates
+ * messages without setting up zlib each time. Compress writes straight into the output string sized by
+ * deflateBound, Decompress reads straight from the caller's buffer. The wire format is the one of
+ * Compress/Decompress in dh_utils_tool. With the preset dictionary of capability JSON keys the zlib header
+ * carries the dictionary id, so only a peer that advertised the same id may be sent such a stream, and
+ * Decompress loads the dictionary by itself when a stream asks for it.
+ */
+class DHZlibCodec {
+public:
+    DHZlibCodec();
+    ~DHZlibCodec();
+
+    bool Compress(const char *data, size_t len, std::string &out, bool usePresetDict = false);
+    bool Decompress(const void *data, size_t len, size_t maxOutLen, std::string &out);
+    static uint32_t GetPresetDictId();
+
+private:
+    DHZlibCodec(const DHZlibCodec&) = delete;
+    DHZlibCodec& operator= (const DHZlibCodec&) = delete;
+
+    std::mutex deflateMtx_;
+    std::mutex inflateMtx_;
+    std::unique_ptr<z_stream_s> deflateStrm_;
+    std::unique_ptr<z_stream_s> inflateStrm_;
+    bool isDeflateReady_ = false;
+    bool isInflateReady_ = false;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DISTRIBUTED_HARDWARE_DH_ZLIB_CODEC_H
@@ -1,6 +1,6 @@
 
 /*
- * Copyright (c) 2023-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,6 +19,8 @@
 
 #include <string>
 #include <atomic>
+#include <map>
+#include <mutex>
 
 #include "dhfwk_single_instance.h"
 namespace OHOS {
@@ -33,10 +35,15 @@ enum class HISTREAM_PLUGIN_TYPE : uint8_t {
 class HiStreamerQueryTool {
 FWK_DECLARE_SINGLE_INSTANCE(HiStreamerQueryTool);
 public:
+    // The plugin info of a type is queried once and kept for the process.
     std::string QueryHiStreamerPluginInfo(HISTREAM_PLUGIN_TYPE type);
 private:
     std::atomic<bool> isInit = false;
+    std::mutex queryMutex_;
+    std::map<HISTREAM_PLUGIN_TYPE, std::string> pluginInfoCache_;
     void Init();
+    std::string QueryBySize(HISTREAM_PLUGIN_TYPE type);
+    std::string QueryByMaxBuffer(HISTREAM_PLUGIN_TYPE type);
 };
 }
 }
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dh_zlib_codec.h"
+
+#include <algorithm>
+#include <climits>
+#include <zlib.h>
+
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DHZlibCodec"
+namespace {
+    constexpr size_t MIN_INFLATE_SIZE = 1024;
+    constexpr size_t INFLATE_RATIO = 4;
+    constexpr size_t GROW_TIMES = 2;
+    // Levels up to 3 run the greedy matcher of zlib, the preset dictionary wins back the ratio on short JSON.
+    constexpr int32_t COMPRESS_LEVEL = 3;
+    // Most frequent strings last, zlib reaches them with the shortest distances.
+    constexpr const char PRESET_DICT[] =
+        "\"source_feature_filter\":[],\"sink_supported_feature\":[],\"udid_hash\":\"\",\"dev_name\":\"\","
+        "\"handler\":\"\",\"source_ver\":\"1.0\",\"comp_ver\":{\"name\":\"\",\"type\":,\"dh_ver\":\"1.0\","
+        "\"accountId\":\"\",\"sync_meta\":false,\"caps_digest\":\"\",\"userId\":,\"tokenId\":,\"code\":,"
+        "\"networkId\":\"\",\"caps\":[{\"msg\":\"{\"camera\"\"mic\"\"speaker\"\"screen\"\"input\"\"audio\","
+        "\"dev_type\":,\"sink_ver\":\"1.0\",\"dh_subtype\":\"\",\"dh_attrs\":\"{\"dh_type\":,"
+        "\"dev_id\":\"\",\"dh_id\":\"\"},{";
+
+    const Bytef *GetPresetDict()
+    {
+        return reinterpret_cast<const Bytef *>(PRESET_DICT);
+    }
+
+    constexpr uInt PRESET_DICT_LEN = sizeof(PRESET_DICT) - 1;
+}
+
+DHZlibCodec::DHZlibCodec() : deflateStrm_(std::make_unique<z_stream>()), inflateStrm_(std::make_unique<z_stream>())
+{
+}
+
+DHZlibCodec::~DHZlibCodec()
+{
+    if (isDeflateReady_) {
+        deflateEnd(deflateStrm_.get());
+    }
+    if (isInflateReady_) {
+        inflateEnd(inflateStrm_.get());
+    }
+}
+
+uint32_t DHZlibCodec::GetPresetDictId()
+{
+    static const uint32_t dictId = static_cast<uint32_t>(adler32(adler32(0L, Z_NULL, 0), GetPresetDict(),
+        PRESET_DICT_LEN));
+    return dictId;
+}
+
+bool DHZlibCodec::Compress(const char *data, size_t len, std::string &out, bool usePresetDict)
+{
+    out.clear();
+    if (data == nullptr || len == 0 || len > UINT_MAX) {
+        DHLOGE("Compress param check failed");
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(deflateMtx_);
+    z_stream *strm = deflateStrm_.get();
+    if (!isDeflateReady_) {
+        if (deflateInit(strm, COMPRESS_LEVEL) != Z_OK) {
+            DHLOGE("deflateInit failed");
+            return false;
+        }
+        isDeflateReady_ = true;
+    }
+    if (usePresetDict && deflateSetDictionary(strm, GetPresetDict(), PRESET_DICT_LEN) != Z_OK) {
+        DHLOGE("deflateSetDictionary failed");
+        deflateReset(strm);
+        return false;
+    }
+    out.resize(deflateBound(strm, static_cast<uLong>(len)));
+    strm->next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+    strm->avail_in = static_cast<uInt>(len);
+    strm->next_out = reinterpret_cast<Bytef *>(out.data());
+    strm->avail_out = static_cast<uInt>(out.size());
+    int32_t ret = deflate(strm, Z_FINISH);
+    size_t outLen = strm->total_out;
+    deflateReset(strm);
+    if (ret != Z_STREAM_END) {
+        DHLOGE("deflate failed, ret: %{public}d", ret);
+        out.clear();
+        return false;
+    }
+    out.resize(outLen);
+    return true;
+}
+
+bool DHZlibCodec::Decompress(const void *data, size_t len, size_t maxOutLen, std::string &out)
+{
+    out.clear();
+    if (data == nullptr || len == 0 || len > UINT_MAX || maxOutLen == 0) {
+        DHLOGE("Decompress param check failed");
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(inflateMtx_);
+    z_stream *strm = inflateStrm_.get();
+    if (!isInflateReady_) {
+        if (inflateInit(strm) != Z_OK) {
+            DHLOGE("inflateInit failed");
+            return false;
+        }
+        isInflateReady_ = true;
+    }
+    strm->next_in = reinterpret_cast<Bytef *>(const_cast<void *>(data));
+    strm->avail_in = static_cast<uInt>(len);
+    out.resize(std::min(maxOutLen, std::max(MIN_INFLATE_SIZE, len * INFLATE_RATIO)));
+    int32_t ret = Z_OK;
+    while (true) {
+        size_t produced = strm->total_out;
+        strm->next_out = reinterpret_cast<Bytef *>(out.data() + produced);
+        strm->avail_out = static_cast<uInt>(std::min<size_t>(out.size() - produced, UINT_MAX));
+        ret = inflate(strm, Z_NO_FLUSH);
+        if (ret == Z_NEED_DICT) {
+            if (strm->adler != GetPresetDictId() ||
+                inflateSetDictionary(strm, GetPresetDict(), PRESET_DICT_LEN) != Z_OK) {
+                DHLOGE("stream needs an unknown dictionary");
+                break;
+            }
+            continue;
+        }
+        if (ret == Z_STREAM_END || (ret != Z_OK && ret != Z_BUF_ERROR)) {
+            break;
+        }
+        if (strm->avail_out != 0) {
+            // Input is used up before the stream end, the message is truncated.
+            ret = Z_DATA_ERROR;
+            break;
+        }
+        if (out.size() >= maxOutLen) {
+            ret = Z_MEM_ERROR;
+            break;
+        }
+        out.resize(std::min(maxOutLen, out.size() * GROW_TIMES));
+    }
+    size_t outLen = strm->total_out;
+    inflateReset(strm);
+    if (ret != Z_STREAM_END) {
+        DHLOGE("inflate failed, ret: %{public}d", ret);
+        out.clear();
+        return false;
+    }
+    out.resize(outLen);
+    return true;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -27,16 +27,22 @@ using QueryAudioEncoderFunc = int32_t (*)(char*);
 using QueryAudioDecoderFunc = int32_t (*)(char*);
 using QueryVideoEncoderFunc = int32_t (*)(char*);
 using QueryVideoDecoderFunc = int32_t (*)(char*);
+using QueryAbilityStrLenFunc = int32_t (*)(int32_t);
+using QueryAbilityStrByTypeFunc = int32_t (*)(int32_t, char*, uint32_t);
 
 QueryAudioEncoderFunc queryAudioEncoderFunc = nullptr;
 QueryAudioDecoderFunc queryAudioDecoderFunc = nullptr;
 QueryVideoEncoderFunc queryVideoEncoderFunc = nullptr;
 QueryVideoDecoderFunc queryVideoDecoderFunc = nullptr;
+QueryAbilityStrLenFunc queryAbilityStrLenFunc = nullptr;
+QueryAbilityStrByTypeFunc queryAbilityStrByTypeFunc = nullptr;
 
 constexpr const char *QUERY_AUDIO_ENCODER_FUNC_NAME = "QueryAudioEncoderAbilityStr";
 constexpr const char *QUERY_AUDIO_DECODER_FUNC_NAME = "QueryAudioDecoderAbilityStr";
 constexpr const char *QUERY_VIDEO_ENCODER_FUNC_NAME = "QueryVideoEncoderAbilityStr";
 constexpr const char *QUERY_VIDEO_DECODER_FUNC_NAME = "QueryVideoDecoderAbilityStr";
+constexpr const char *QUERY_ABILITY_STR_LEN_FUNC_NAME = "QueryAbilityStrLen";
+constexpr const char *QUERY_ABILITY_STR_BY_TYPE_FUNC_NAME = "QueryAbilityStrByType";
 constexpr const char *LOAD_SO = "libhistreamer_ability_querier.z.so";
 
 constexpr uint32_t MAX_MESSAGES_LEN = 1 * 1024 * 1024;
@@ -85,12 +91,21 @@ void HiStreamerQueryTool::Init()
         return;
     }
 
+    // An older querier only fills the fixed size buffer.
+    queryAbilityStrLenFunc = (QueryAbilityStrLenFunc)dlsym(pHandler, QUERY_ABILITY_STR_LEN_FUNC_NAME);
+    queryAbilityStrByTypeFunc = (QueryAbilityStrByTypeFunc)dlsym(pHandler, QUERY_ABILITY_STR_BY_TYPE_FUNC_NAME);
+
     DHLOGI("Init Query HiStreamer Tool Success");
     isInit = true;
 }
 
 std::string HiStreamerQueryTool::QueryHiStreamerPluginInfo(HISTREAM_PLUGIN_TYPE type)
 {
+    std::lock_guard<std::mutex> lock(queryMutex_);
+    auto iter = pluginInfoCache_.find(type);
+    if (iter != pluginInfoCache_.end()) {
+        return iter->second;
+    }
     Init();
     if (!isInit || queryAudioEncoderFunc == nullptr || queryAudioDecoderFunc == nullptr ||
         queryVideoEncoderFunc == nullptr || queryVideoDecoderFunc == nullptr) {
@@ -98,6 +113,33 @@ std::string HiStreamerQueryTool::QueryHiStreamerPluginInfo(HISTREAM_PLUGIN_TYPE
         return "";
     }
 
+    std::string result = (queryAbilityStrLenFunc != nullptr && queryAbilityStrByTypeFunc != nullptr) ?
+        QueryBySize(type) : QueryByMaxBuffer(type);
+    if (!result.empty()) {
+        pluginInfoCache_[type] = result;
+    }
+    return result;
+}
+
+std::string HiStreamerQueryTool::QueryBySize(HISTREAM_PLUGIN_TYPE type)
+{
+    int32_t size = queryAbilityStrLenFunc(static_cast<int32_t>(type));
+    if (size <= 0 || static_cast<uint32_t>(size) > MAX_MESSAGES_LEN) {
+        DHLOGE("Query plugin info size invalid, type: %{public}d, size: %{public}d", static_cast<int32_t>(type),
+            size);
+        return "";
+    }
+    std::string result(size, '\0');
+    int32_t len = queryAbilityStrByTypeFunc(static_cast<int32_t>(type), result.data(), static_cast<uint32_t>(size));
+    if (len != size) {
+        DHLOGE("Query plugin info failed, type: %{public}d", static_cast<int32_t>(type));
+        return "";
+    }
+    return result;
+}
+
+std::string HiStreamerQueryTool::QueryByMaxBuffer(HISTREAM_PLUGIN_TYPE type)
+{
     int32_t len = 0;
     char* res = reinterpret_cast<char *>(malloc(MAX_MESSAGES_LEN));
     if (res == nullptr) {
@@ -25,6 +25,7 @@
 #include "anonymous_string.h"
 #include "dh_utils_tool.h"
 #include "dh_utils_hitrace.h"
+#include "dh_zlib_codec.h"
 #include "distributed_hardware_errno.h"
 
 using namespace testing::ext;
@@ -297,5 +298,62 @@ HWTEST_F(UtilsToolTest, GetDeviceSystemType_004, TestSize.Level1)
     cJSON_Delete(jsonObj);
     EXPECT_EQ(OS_TYPE, ret);
 }
+
+HWTEST_F(UtilsToolTest, DHZlibCodec_001, TestSize.Level1)
+{
+    DHZlibCodec codec;
+    std::string payload = std::string(100 * 1024, 'c') + "full caps";
+    std::string compressed;
+    std::string raw;
+    for (int32_t i = 0; i < 2; i++) {
+        ASSERT_TRUE(codec.Compress(payload.data(), payload.size(), compressed));
+        EXPECT_EQ(payload, Decompress(compressed));
+        ASSERT_TRUE(codec.Decompress(compressed.data(), compressed.size(), JSON_SIZE, raw));
+        EXPECT_EQ(payload, raw);
+    }
+    std::string legacy = Compress(payload);
+    ASSERT_TRUE(codec.Decompress(legacy.data(), legacy.size(), JSON_SIZE, raw));
+    EXPECT_EQ(payload, raw);
+}
+
+HWTEST_F(UtilsToolTest, DHZlibCodec_002, TestSize.Level1)
+{
+    DHZlibCodec codec;
+    std::string out;
+    EXPECT_FALSE(codec.Compress(nullptr, 1, out));
+    EXPECT_FALSE(codec.Decompress(nullptr, 1, JSON_SIZE, out));
+
+    std::string payload(64 * 1024, 'd');
+    std::string compressed;
+    ASSERT_TRUE(codec.Compress(payload.data(), payload.size(), compressed));
+    EXPECT_FALSE(codec.Decompress(compressed.data(), compressed.size(), payload.size() - 1, out));
+    EXPECT_FALSE(codec.Decompress(compressed.data(), compressed.size() / 2, JSON_SIZE, out));
+    EXPECT_TRUE(out.empty());
+    EXPECT_TRUE(codec.Decompress(compressed.data(), compressed.size(), payload.size(), out));
+    EXPECT_EQ(payload, out);
+}
+
+HWTEST_F(UtilsToolTest, DHZlibCodec_003, TestSize.Level1)
+{
+    std::string payload = "{\"networkId\":\"123456\",\"caps\":[{\"dh_id\":\"Camera_0\",\"dev_id\":\"dev_0\","
+        "\"dev_name\":\"phone\",\"dev_type\":14,\"dh_type\":8,\"dh_attrs\":\"{}\",\"dh_subtype\":\"camera\"}]}";
+    DHZlibCodec sender;
+    DHZlibCodec receiver;
+    std::string plain;
+    std::string withDict;
+    ASSERT_TRUE(sender.Compress(payload.data(), payload.size(), plain));
+    ASSERT_TRUE(sender.Compress(payload.data(), payload.size(), withDict, true));
+    EXPECT_LT(withDict.size(), plain.size());
+    EXPECT_NE(0u, DHZlibCodec::GetPresetDictId());
+
+    std::string out;
+    EXPECT_TRUE(receiver.Decompress(withDict.data(), withDict.size(), JSON_SIZE, out));
+    EXPECT_EQ(payload, out);
+    EXPECT_TRUE(receiver.Decompress(plain.data(), plain.size(), JSON_SIZE, out));
+    EXPECT_EQ(payload, out);
+    // Peers without the dictionary still read the plain stream.
+    EXPECT_TRUE(Decompress(withDict).empty());
+    EXPECT_EQ(payload, Decompress(plain));
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -38,6 +38,7 @@ namespace OHOS {
 namespace DistributedHardware {
 using HDI::Camera::V1_3::IStreamOperator;
 using HDI::Camera::V1_0::ICameraDeviceCallback;
+using OHOS::HDI::DistributedCamera::V1_2::DCameraSettingsResult;
 class DCameraDevice : public HDI::Camera::V1_3::ICameraDevice {
 public:
     DCameraDevice(const DHBase &dhBase, const std::string& sinkAbilityInfo, const std::string& sourceCodecInfo);
@@ -76,13 +77,19 @@ public:
     CamRetCode GetDCameraAbility(std::shared_ptr<CameraAbility> &ability);
     DCamRetCode AcquireBuffer(int streamId, DCameraBuffer &buffer);
     DCamRetCode ShutterBuffer(int streamId, const DCameraBuffer &buffer);
+    DCamRetCode AcquireBuffers(const std::vector<int32_t> &streamIds, std::vector<DCameraStreamBuffer> &buffers);
+    DCamRetCode ShutterBuffers(const std::vector<DCameraStreamBuffer> &buffers);
+    DCamRetCode OpenBufferRing(int32_t streamId, int &ringFd, int &eventFd);
+    DCamRetCode GetRingBuffer(int32_t streamId, int32_t index, DCameraBuffer &buffer);
     DCamRetCode OnSettingsResult(const std::shared_ptr<DCameraSettings> &result);
+    DCamRetCode OnSettingsResults(const std::vector<DCameraSettingsResult> &results);
     DCamRetCode Notify(const std::shared_ptr<DCameraHDFEvent> &event);
     void SetProviderCallback(const OHOS::sptr<IDCameraProviderCallback> &callback);
     OHOS::sptr<IDCameraProviderCallback> GetProviderCallback();
     std::string GetDCameraId();
     bool IsOpened();
     void SetDcameraAbility(const std::string& sinkAbilityInfo);
+    bool HasFullAbility();
 
 private:
     void Init(const std::string &sinkAbilityInfo);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,7 @@
 #ifndef DISTRIBUTED_CAMERA_METADATA_PROCESSOR_H
 #define DISTRIBUTED_CAMERA_METADATA_PROCESSOR_H
 
+#include <array>
 #include <set>
 #include <map>
 #include <mutex>
@@ -48,6 +49,8 @@ public:
     DCamRetCode DisableMetadataResult(const std::vector<MetaType> &results);
     DCamRetCode ResetEnableResults();
     DCamRetCode SaveResultMetadata(std::string resultStr);
+    // Takes a result serialized by EncodeToString, without the base64 armor of the string overload.
+    DCamRetCode SaveResultMetadata(const std::vector<uint8_t> &result);
     void UpdateResultMetadata(const uint64_t &resultTimestamp);
     void SetResultCallback(std::function<void(uint64_t, std::shared_ptr<OHOS::Camera::CameraMetadata>)> &resultCbk);
     void PrintDCameraMetadata(const common_metadata_header_t *metadata);
@@ -64,18 +67,23 @@ private:
     DCResolution ParseSingleResolution(cJSON* resolutionItem);
     DCFps ParseSingleFps(cJSON* fpsItem);
     
-    DCamRetCode InitDCameraDefaultAbilityKeys(const std::string &sinkAbilityInfo);
-    DCamRetCode InitDCameraOutputAbilityKeys(const std::string &sinkAbilityInfo);
+    DCamRetCode SaveDecodedResult(const std::shared_ptr<OHOS::Camera::CameraMetadata> &result);
+    DCamRetCode InitDCameraDefaultAbilityKeys(cJSON* rootValue);
+    DCamRetCode InitDCameraOutputAbilityKeys(cJSON* rootValue);
     DCamRetCode AddAbilityEntry(uint32_t tag, const void *data, size_t size);
     DCamRetCode UpdateAbilityEntry(uint32_t tag, const void *data, size_t size);
     void ConvertToCameraMetadata(common_metadata_header_t *&input,
         std::shared_ptr<OHOS::Camera::CameraMetadata> &output);
     void ResizeMetadataHeader(common_metadata_header_t *&header, uint32_t itemCapacity, uint32_t dataCapacity);
-    void UpdateAllResult(const uint64_t &resultTimestamp);
+    std::shared_ptr<OHOS::Camera::CameraMetadata> UpdateAllResult(const uint64_t &resultTimestamp);
     void UpdateOnChanged(const uint64_t &resultTimestamp);
+    void CollectChangedResults();
+    bool IsResultItemChanged(const camera_metadata_item_t &item, const camera_metadata_item_t &anoItem);
+    size_t GetResultBuffer(uint32_t itemCapacity, uint32_t dataCapacity);
+    bool PatchResultTimestamp(const std::shared_ptr<OHOS::Camera::CameraMetadata> &result, uint64_t timestamp);
     uint32_t GetDataSize(uint32_t type);
     void* GetMetadataItemData(const camera_metadata_item_t &item);
-    std::map<int, std::vector<DCResolution>> GetDCameraSupportedFormats(const std::string &abilityInfo);
+    std::map<int, std::vector<DCResolution>> GetDCameraSupportedFormats(cJSON* rootValue);
     void ParsePhotoFormats(cJSON* rootValue, std::map<int, std::vector<DCResolution>>& supportedFormats);
     void ParsePreviewFormats(cJSON* rootValue, std::map<int, std::vector<DCResolution>>& supportedFormats);
     void ParseVideoFormats(cJSON* rootValue, std::map<int, std::vector<DCResolution>>& supportedFormats);
@@ -98,8 +106,8 @@ private:
     cJSON* GetFormatObj(const std::string rootNode, cJSON* rootValue, std::string& formatStr);
     cJSON* GetNodeItemArray(const std::string& rootNode, const std::string& itemKey,
         const std::string& formatStr, cJSON* rootValue);
-    bool GetInfoFromJson(const std::string& sinkAbilityInfo);
-    void InitOutputAbilityWithoutMode(const std::string &sinkAbilityInfo);
+    bool GetInfoFromJson(cJSON* rootValue);
+    void InitOutputAbilityWithoutMode(cJSON* rootValue);
     void UpdateAbilityTag(std::vector<int32_t> &streamConfigs, std::vector<int32_t> &extendStreamConfigs);
 
 private:
@@ -113,6 +121,7 @@ private:
     constexpr static int32_t EXTEND_EOF = -1;
     constexpr static uint32_t ADD_MODE = 3;
     constexpr static uint32_t DEFAULT_EXTEND_SIZE = 1000;
+    constexpr static size_t RESULT_BUFFER_NUM = 2;
     std::function<void(uint64_t, std::shared_ptr<OHOS::Camera::CameraMetadata>)> resultCallback_;
     std::shared_ptr<CameraAbility> dCameraAbility_;
     std::string protocolVersion_;
@@ -137,6 +146,18 @@ private:
 
     // The latest result metadata that replied to the camera service.
     std::shared_ptr<OHOS::Camera::CameraMetadata> latestConsumerMetadataResult_;
+
+    // Tags of the latest producer result that differ from the previous one.
+    std::set<MetaType> changedResultSet_;
+
+    // Bumped for every decoded producer result, 0 never names a valid one.
+    uint64_t producerGeneration_ = 0;
+
+    // The metadata handed to the result callback, reused while the callback keeps no reference to it. A buffer
+    // whose generation matches producerGeneration_ already holds the full producer result.
+    std::array<std::shared_ptr<OHOS::Camera::CameraMetadata>, RESULT_BUFFER_NUM> resultBuffers_;
+    std::array<uint64_t, RESULT_BUFFER_NUM> resultGenerations_ {};
+    size_t nextResultBuffer_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,8 @@
 #ifndef DISTRIBUTED_CAMERA_HOST_H
 #define DISTRIBUTED_CAMERA_HOST_H
 
+#include <shared_mutex>
+
 #include "dcamera_base.h"
 #include "dcamera_device.h"
 
@@ -95,6 +97,12 @@ public:
 
 private:
     bool IsCameraIdInvalid(const std::string &cameraId);
+    bool HasFullAbility(const std::string &cameraId);
+    bool GetCachedCameraAbility(const std::string &cameraId, std::vector<uint8_t> &cameraAbility);
+    void CacheCameraAbility(const std::string &cameraId, uint64_t generation,
+        const std::vector<uint8_t> &cameraAbility);
+    void InvalidateCameraAbility(const std::string &cameraId);
+    void DumpStreamConfigurations(const std::shared_ptr<CameraAbility> &ability);
     std::string GetCameraIdByDHBase(const DHBase &dhBase);
     size_t GetCamDevNum();
 
@@ -148,6 +156,11 @@ private:
     OHOS::sptr<HDI::Camera::V1_2::ICameraHostCallback> dCameraHostCallback_V1_2_;
     std::map<std::string, OHOS::sptr<DCameraDevice>> dCameraDeviceMap_;
     std::mutex deviceMapLock_;
+    // Serialized abilities of cameras holding their full ability, dropped whenever a camera is added, refreshed
+    // or removed. The generation tells a lookup that raced such an update not to store its stale result.
+    std::map<std::string, std::vector<uint8_t>> abilityCache_;
+    uint64_t abilityCacheGeneration_ = 0;
+    std::shared_mutex abilityCacheLock_;
     std::map<std::string, sptr<IDCameraHdfCallback>> mapCameraHdfCallback_;
     std::mutex hdfCallbackMapMtx_;
     std::optional<DCamRetCode> HandleExistingDCamera(const std::string& dCameraId,
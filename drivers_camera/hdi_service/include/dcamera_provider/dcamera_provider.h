@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,16 +17,21 @@
 #define DISTRIBUTED_CAMERA_PROVIDER_H
 
 #include "v1_1/id_camera_provider.h"
+#include "v1_2/id_camera_provider.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 using namespace OHOS::HDI::DistributedCamera::V1_1;
+using OHOS::HDI::DistributedCamera::V1_2::DCameraSettingsResult;
+using OHOS::HDI::DistributedCamera::V1_2::DCameraStreamBuffer;
 class DCameraHost;
 class DCameraDevice;
-class DCameraProvider : public IDCameraProvider {
+class DCameraProvider : public OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider {
 const uint32_t ABILITYINFO_MAX_LENGTH = 50 * 1024 * 1024;
+const uint32_t STREAM_BUFFERS_MAX_SIZE = 16;
 const uint32_t HDF_EVENT_CONTENT_MAX_LENGTH = 50 * 1024 * 1024;
 const uint32_t SETTING_VALUE_MAX_LENGTH = 50 * 1024 * 1024;
+const uint32_t SETTINGS_RESULTS_MAX_SIZE = 64;
 public:
     DCameraProvider() = default;
     ~DCameraProvider() override = default;
@@ -42,8 +47,15 @@ public:
     int32_t DisableDCameraDevice(const DHBase& dhBase) override;
     int32_t AcquireBuffer(const DHBase& dhBase, int32_t streamId, DCameraBuffer& buffer) override;
     int32_t ShutterBuffer(const DHBase& dhBase, int32_t streamId, const DCameraBuffer& buffer) override;
+    int32_t AcquireBuffers(const DHBase& dhBase, const std::vector<int32_t>& streamIds,
+        std::vector<DCameraStreamBuffer>& buffers) override;
+    int32_t ShutterBuffers(const DHBase& dhBase, const std::vector<DCameraStreamBuffer>& buffers) override;
+    int32_t OpenBufferRing(const DHBase& dhBase, int32_t streamId, int& ringFd, int& eventFd) override;
+    int32_t GetRingBuffer(const DHBase& dhBase, int32_t streamId, int32_t index, DCameraBuffer& buffer) override;
     int32_t OnSettingsResult(const DHBase& dhBase, const DCameraSettings& result) override;
+    int32_t OnSettingsResults(const DHBase& dhBase, const std::vector<DCameraSettingsResult>& results) override;
     int32_t Notify(const DHBase& dhBase, const DCameraHDFEvent& event) override;
+    int32_t NotifyAsync(const DHBase& dhBase, const DCameraHDFEvent& event) override;
     int32_t RegisterCameraHdfListener(const std::string &serviceName,
         const sptr<IDCameraHdfCallback> &callbackObj) override;
     int32_t UnRegisterCameraHdfListener(const std::string &serviceName) override;
@@ -16,8 +16,9 @@
 #ifndef DISTRIBUTED_CAMERA_BUFFER_MANAGER_H
 #define DISTRIBUTED_CAMERA_BUFFER_MANAGER_H
 
-#include <list>
+#include <array>
 #include <mutex>
+#include <vector>
 
 #include "constants.h"
 #include "dimage_buffer.h"
@@ -32,9 +33,13 @@ namespace OHOS {
 namespace DistributedHardware {
 using namespace OHOS::HDI::DistributedCamera::V1_1;
 using namespace OHOS::HDI::Display::Composer::V1_0;
+/*
+ * Buffers live in a fixed array of BUFFER_QUEUE_SIZE slots and the slot id doubles as the buffer index handed
+ * to the source through DCameraBuffer::index_, so add, acquire and remove never search.
+ */
 class DBufferManager {
 public:
-    DBufferManager() = default;
+    DBufferManager();
     virtual ~DBufferManager() = default;
     DBufferManager(const DBufferManager &other) = delete;
     DBufferManager(DBufferManager &&other) = delete;
@@ -45,6 +50,9 @@ public:
     std::shared_ptr<DImageBuffer> AcquireBuffer();
     RetCode AddBuffer(std::shared_ptr<DImageBuffer>& buffer);
     RetCode RemoveBuffer(std::shared_ptr<DImageBuffer>& buffer);
+    std::shared_ptr<DImageBuffer> GetBusyBuffer(int32_t index);
+    uint32_t GetIdleCount();
+    uint32_t GetFreeCount();
     void NotifyStop(bool state);
     static RetCode SurfaceBufferToDImageBuffer(const OHOS::sptr<OHOS::SurfaceBuffer> &surfaceBuffer,
         const std::shared_ptr<DImageBuffer> &buffer);
@@ -54,10 +62,26 @@ public:
     static uint32_t PixelFormatToDCameraFormat(const OHOS::HDI::Display::Composer::V1_1::PixelFormat format);
 
 private:
+    enum class SlotState : uint8_t {
+        FREE,
+        IDLE,
+        BUSY,
+    };
+    struct BufferSlot {
+        std::shared_ptr<DImageBuffer> buffer = nullptr;
+        SlotState state = SlotState::FREE;
+    };
+
+    bool IsBusySlot(int32_t index) const;
+
     std::mutex lock_;
     std::atomic_bool streamStop_ = false;
-    std::list<std::shared_ptr<DImageBuffer>> idleList_ = {};
-    std::list<std::shared_ptr<DImageBuffer>> busyList_ = {};
+    std::array<BufferSlot, BUFFER_QUEUE_SIZE> slots_;
+    std::vector<int32_t> freeSlots_;
+    // Idle slot ids, acquired in the order they were added.
+    std::array<int32_t, BUFFER_QUEUE_SIZE> idleSlots_ = {};
+    uint32_t idleHead_ = 0;
+    uint32_t idleCount_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
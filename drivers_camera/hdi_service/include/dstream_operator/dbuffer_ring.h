@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DISTRIBUTED_CAMERA_BUFFER_RING_H
+#define DISTRIBUTED_CAMERA_BUFFER_RING_H
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "v1_1/dcamera_types.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+using namespace OHOS::HDI::DistributedCamera::V1_1;
+
+/*
+ * Shared memory layout of a buffer ring, the source service maps the same block and must agree on it, so bump
+ * DBUFFER_RING_VERSION on any change. Both queues count with free running indexes, the capacity is a power of
+ * two so the slot stays right across the wrap around.
+ */
+constexpr uint32_t DBUFFER_RING_MAGIC = 0x44435242;
+constexpr uint32_t DBUFFER_RING_VERSION = 2;
+constexpr uint32_t DBUFFER_RING_CAPACITY = 16;
+constexpr uint32_t DBUFFER_RING_CACHE_LINE = 64;
+
+struct DBufferRingEntry {
+    int32_t index;
+    int32_t size;
+    uint32_t seqNum;
+    uint32_t reserved;
+    // Sink capture time of a filled buffer in local wall clock microseconds, 0 when unknown.
+    int64_t captureTimeUs;
+};
+
+struct DBufferRingQueue {
+    alignas(DBUFFER_RING_CACHE_LINE) std::atomic<uint32_t> head;
+    alignas(DBUFFER_RING_CACHE_LINE) std::atomic<uint32_t> tail;
+    DBufferRingEntry entries[DBUFFER_RING_CAPACITY];
+};
+
+struct DBufferRingLayout {
+    uint32_t magic;
+    uint32_t version;
+    // Filled by the ring thread, taken by the source and, once refill is off, reclaimed by the ring.
+    DBufferRingQueue freeQueue;
+    // Filled by the source, drained by the ring thread only.
+    DBufferRingQueue filledQueue;
+};
+
+/*
+ * Hands the buffers of one stream to the source through a shared memory ring instead of an AcquireBuffer and
+ * ShutterBuffer call per frame. The ring thread keeps the free queue topped up while refill is on and returns
+ * every buffer the source queues as filled, the source writes the event fd to wake it.
+ */
+class DBufferRing {
+public:
+    using AcquireFunc = std::function<DCamRetCode(DCameraBuffer &buffer, uint32_t &seqNum)>;
+    using ReturnFunc = std::function<DCamRetCode(const DCameraBuffer &buffer, int64_t captureTimeUs)>;
+
+    DBufferRing(int32_t streamId, const AcquireFunc &acquireFunc, const ReturnFunc &returnFunc);
+    ~DBufferRing();
+    DBufferRing(const DBufferRing &other) = delete;
+    DBufferRing& operator=(const DBufferRing &other) = delete;
+
+    DCamRetCode Init();
+    void Release();
+    void EnableRefill();
+    void DisableRefill();
+    int32_t GetRingFd() const;
+    int32_t GetEventFd() const;
+
+private:
+    void RingLoop();
+    void DrainFilled();
+    void Refill();
+    void ReclaimFree();
+    bool PopFree(DBufferRingEntry &entry);
+    bool PopFilled(DBufferRingEntry &entry);
+    void ReturnEntry(const DBufferRingEntry &entry);
+    void WaitEvent(int32_t timeoutMs);
+    void SetRingThreadPriority();
+
+    constexpr static int32_t RING_REFILL_RETRY_MS = 5;
+    // The ring thread hands frames over ahead of the IPC threads busy with control calls when set to a real time
+    // policy, SCHED_FIFO (1) or SCHED_RR (2).
+    constexpr static const char *RT_POLICY_PARA = "sys.dcamera.hdi.ring.rt.policy";
+    constexpr static const char *RT_PRIORITY_PARA = "sys.dcamera.hdi.ring.rt.priority";
+    constexpr static int32_t RING_IDLE_WAIT_MS = 100;
+
+    int32_t streamId_;
+    AcquireFunc acquireFunc_;
+    ReturnFunc returnFunc_;
+    int32_t ringFd_ = -1;
+    int32_t eventFd_ = -1;
+    DBufferRingLayout *layout_ = nullptr;
+    std::thread ringThread_;
+    std::atomic<bool> isRunning_ { false };
+    // Held while buffers move into the free queue, so a reclaim never races a refill.
+    std::mutex refillMutex_;
+    bool isRefillEnabled_ = false;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // DISTRIBUTED_CAMERA_BUFFER_RING_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,10 @@
 #ifndef DISTRIBUTED_CAMERA_STREAM_H
 #define DISTRIBUTED_CAMERA_STREAM_H
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "surface.h"
 #include "dimage_buffer.h"
 #include "dbuffer_manager.h"
@@ -31,7 +35,7 @@ using namespace OHOS::HDI::DistributedCamera::V1_1;
 class DCameraStream {
 public:
     DCameraStream() = default;
-    ~DCameraStream() = default;
+    ~DCameraStream();
     DCameraStream(const DCameraStream &other) = delete;
     DCameraStream(DCameraStream &&other) = delete;
     DCameraStream &operator=(const DCameraStream &other) = delete;
@@ -44,7 +48,11 @@ public:
     DCamRetCode ReleaseDCameraBufferQueue();
     DCamRetCode GetDCameraStreamAttribute(StreamAttribute &attribute);
     DCamRetCode GetDCameraBuffer(DCameraBuffer &buffer);
-    DCamRetCode ReturnDCameraBuffer(const DCameraBuffer &buffer);
+    // captureAgeUs dates the flushed buffer back to the sink capture, see GetCaptureAgeUs.
+    DCamRetCode ReturnDCameraBuffer(const DCameraBuffer &buffer, int64_t captureAgeUs = 0);
+    DCamRetCode GetBusyDCameraBuffer(int32_t index, DCameraBuffer &buffer);
+    bool GetBufferSeqNum(int32_t index, uint32_t &seqNum);
+    bool HasIdleBuffer();
     DCamRetCode FinishCommitStream();
     bool HasBufferQueue();
     void DoCapture();
@@ -54,21 +62,32 @@ private:
     DCamRetCode InitDCameraBufferManager();
     DCamRetCode GetNextRequest();
     DCamRetCode CheckRequestParam();
-    void SetSurfaceBuffer(OHOS::sptr<OHOS::SurfaceBuffer>& surfaceBuffer, const DCameraBuffer &buffer);
+    void SetSurfaceBuffer(OHOS::sptr<OHOS::SurfaceBuffer>& surfaceBuffer, const DCameraBuffer &buffer,
+        int64_t captureAgeUs = 0);
     DCamRetCode CancelDCameraBuffer();
-    DCamRetCode FlushDCameraBuffer(const DCameraBuffer &buffer);
+    DCamRetCode FlushDCameraBuffer(const DCameraBuffer &buffer, int64_t captureAgeUs = 0);
     uint64_t GetVideoTimeStamp();
     DCamRetCode SurfaceBufferToDImageBuffer(OHOS::sptr<OHOS::SurfaceBuffer> &surfaceBuffer,
         OHOS::sptr<OHOS::SyncFence> &syncFence);
+    DCamRetCode RequestSurfaceBuffer(OHOS::sptr<OHOS::SurfaceBuffer> &surfaceBuffer,
+        OHOS::sptr<OHOS::SyncFence> &syncFence, int32_t timeoutMs);
+    void StartPrefetch();
+    void StopPrefetch();
+    void TriggerPrefetch();
+    void PrefetchLoop();
+    void FillPrefetchBuffers();
+    bool NeedPrefetch();
+    static bool IsFencePending(const OHOS::sptr<OHOS::SyncFence> &syncFence);
 
 private:
-    int32_t index_ = -1;
     int dcStreamId_;
     shared_ptr<StreamInfo> dcStreamInfo_ = nullptr;
     StreamAttribute dcStreamAttribute_;
     shared_ptr<DBufferManager> dcStreamBufferMgr_ = nullptr;
     OHOS::sptr<OHOS::Surface> dcStreamProducer_ = nullptr;
-    map<shared_ptr<DImageBuffer>, tuple<OHOS::sptr<OHOS::SurfaceBuffer>, int>> bufferConfigMap_;
+    // Surface buffer behind each buffer manager slot, indexed by the DImageBuffer index.
+    vector<OHOS::sptr<OHOS::SurfaceBuffer>> surfaceBuffers_ =
+        vector<OHOS::sptr<OHOS::SurfaceBuffer>>(BUFFER_QUEUE_SIZE);
     condition_variable cv_;
     int captureBufferCount_ = 0;
     bool isBufferMgrInited_ = false;
@@ -77,6 +96,15 @@ private:
     mutex requestMutex_;
     mutex bufferQueueMutex_;
     mutex lockSync_;
+
+    // Idle buffers the prefetch thread keeps requested ahead of GetDCameraBuffer, 0 requests on demand.
+    constexpr static const char *BUFFER_PREFETCH_PARA = "sys.dcamera.hdi.buffer.prefetch";
+    uint32_t prefetchCount_ = 0;
+    thread prefetchThread_;
+    mutex prefetchMutex_;
+    condition_variable prefetchCv_;
+    bool isPrefetchRunning_ = false;
+    bool isPrefetchPending_ = false;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -43,6 +43,7 @@ public:
     int32_t GetCaptureId() const;
     bool GetValidFlag() const;
     OHOS::sptr<OHOS::SyncFence> GetSyncFence() const;
+    OHOS::sptr<OHOS::SyncFence> GetReleaseFence() const;
     int32_t GetEncodeType() const;
     BufferHandle* GetBufferHandle() const;
 
@@ -60,6 +61,7 @@ public:
     void SetCaptureId(const int32_t id);
     void SetValidFlag(const bool flag);
     void SetSyncFence(const sptr<OHOS::SyncFence> &syncFence);
+    void SetReleaseFence(const sptr<OHOS::SyncFence> &releaseFence);
     void SetEncodeType(const int32_t type);
     void SetBufferHandle(const BufferHandle* bufHandle);
 
@@ -80,7 +82,10 @@ private:
     uint64_t timeStamp_ = 0;
     int32_t captureId_ = -1;
     bool valid_ = true;
+    // Acquire fence of the surface buffer, only kept while the previous consumer may still be using it.
     OHOS::sptr<OHOS::SyncFence> syncFence_ = nullptr;
+    // Signals when the frame content is complete, flushed along with the buffer so the consumer need not wait.
+    OHOS::sptr<OHOS::SyncFence> releaseFence_ = nullptr;
     int32_t encodeType_ = 0;
     BufferHandle* bufHandle_ = nullptr;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,14 +16,32 @@
 #ifndef DISTRIBUTED_CAMERA_OFFLINE_STREAM_OPERATOR_H
 #define DISTRIBUTED_CAMERA_OFFLINE_STREAM_OPERATOR_H
 
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "dcamera.h"
+#include "dcamera_stream.h"
+
 #include "v1_0/ioffline_stream_operator.h"
+#include "v1_0/istream_operator_callback.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 using namespace OHOS::HDI::Camera::V1_0;
+// A snapshot stream detached from its session while the remote frame is still on the way.
+struct DOfflineStream {
+    int32_t captureId = -1;
+    std::shared_ptr<DCameraStream> stream;
+    DCStreamInfo streamInfo;
+    bool enableShutter = false;
+    bool captureStarted = false;
+    int32_t bufferNum = 0;
+};
+
 class DOfflineStreamOperator : public IOfflineStreamOperator {
 public:
-    DOfflineStreamOperator() = default;
+    DOfflineStreamOperator(const DHBase &dhBase, const OHOS::sptr<IStreamOperatorCallback> &callback);
     ~DOfflineStreamOperator() override = default;
     DOfflineStreamOperator(const DOfflineStreamOperator &other) = delete;
     DOfflineStreamOperator(DOfflineStreamOperator &&other) = delete;
@@ -34,6 +52,21 @@ public:
     int32_t CancelCapture(int32_t captureId) override;
     int32_t ReleaseStreams(const std::vector<int32_t>& streamIds) override;
     int32_t Release() override;
+
+    void AddStream(int32_t streamId, const DOfflineStream &offlineStream);
+    std::shared_ptr<DCameraStream> FindStream(int32_t streamId);
+    bool IsEmpty();
+    void GetStreamInfos(std::vector<DCStreamInfo> &streamInfos);
+    // captureAgeUs dates the frame back to the sink capture, see GetCaptureAgeUs.
+    DCamRetCode ShutterBuffer(int32_t streamId, const DCameraBuffer &buffer, int64_t captureAgeUs);
+
+private:
+    void ReleaseOfflineStreams(const std::map<int32_t, DOfflineStream> &offlineStreams);
+
+    DHBase dhBase_;
+    OHOS::sptr<IStreamOperatorCallback> callback_;
+    std::mutex offlineStreamLock_;
+    std::map<int32_t, DOfflineStream> offlineStreams_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
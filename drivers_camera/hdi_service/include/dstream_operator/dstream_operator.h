@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,14 +16,17 @@
 #ifndef DISTRIBUTED_CAMERA_STREAM_OPERATOR_H
 #define DISTRIBUTED_CAMERA_STREAM_OPERATOR_H
 
+#include <atomic>
 #include <map>
 #include <set>
 #include <vector>
 
 #include "constants.h"
+#include "dbuffer_ring.h"
 #include "dcamera.h"
 #include "dcamera_stream.h"
 #include "dmetadata_processor.h"
+#include "doffline_stream_operator.h"
 
 #include "cJSON.h"
 #include "v1_0/istream_operator.h"
@@ -35,11 +38,13 @@
 #include "v1_3/istream_operator_callback.h"
 #include "v1_0/types.h"
 #include "v1_1/types.h"
+#include "v1_2/dcamera_types.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 using namespace std;
 using namespace OHOS::HDI::Camera::V1_0;
+using OHOS::HDI::DistributedCamera::V1_2::DCameraStreamBuffer;
 using HDI::Camera::V1_1::OperationMode_V1_1;
 using HDI::Camera::V1_1::StreamInfo_V1_1;
 class DCameraProvider;
@@ -70,6 +75,21 @@ struct ResolutionCandidate {
         isMixed = !(isAboveTarget || isBelowTarget);
     }
 };
+/*
+ * Everything the buffer return path needs for one stream of a running capture. It is resolved once at
+ * capture time so that returning a frame needs neither the capture, stream or shutter maps nor their locks.
+ */
+struct DStreamHotState {
+    int32_t captureId = -1;
+    int32_t streamId = -1;
+    std::shared_ptr<DCameraStream> stream;
+    bool enableShutter = false;
+    bool isSnapshot = false;
+    std::atomic<bool> captureStarted { false };
+    std::atomic<int32_t> bufferNum { 0 };
+};
+using DStreamHotStateList = std::vector<std::shared_ptr<DStreamHotState>>;
+
 class DStreamOperator : public HDI::Camera::V1_3::IStreamOperator {
 public:
     explicit DStreamOperator(std::shared_ptr<DMetadataProcessor> &dMetadataProcessor);
@@ -111,7 +131,12 @@ public:
     DCamRetCode ParsePreviewFormats(cJSON* rootValue);
     DCamRetCode ParseVideoFormats(cJSON* rootValue);
     DCamRetCode AcquireBuffer(int streamId, DCameraBuffer &buffer);
-    DCamRetCode ShutterBuffer(int streamId, const DCameraBuffer &buffer);
+    // captureTimeUs is the sink capture time in local wall clock microseconds, 0 stamps the buffer on arrival.
+    DCamRetCode ShutterBuffer(int streamId, const DCameraBuffer &buffer, int64_t captureTimeUs = 0);
+    DCamRetCode AcquireBuffers(const std::vector<int32_t> &streamIds, std::vector<DCameraStreamBuffer> &buffers);
+    DCamRetCode ShutterBuffers(const std::vector<DCameraStreamBuffer> &buffers);
+    DCamRetCode OpenBufferRing(int32_t streamId, int &ringFd, int &eventFd);
+    DCamRetCode GetRingBuffer(int32_t streamId, int32_t index, DCameraBuffer &buffer);
     DCamRetCode SetCallBack(OHOS::sptr<HDI::Camera::V1_0::IStreamOperatorCallback> const &callback);
     DCamRetCode SetCallBack_V1_2(OHOS::sptr<HDI::Camera::V1_2::IStreamOperatorCallback> const &callback);
     DCamRetCode SetCallBack_V1_3(OHOS::sptr<HDI::Camera::V1_3::IStreamOperatorCallback> const &callback);
@@ -130,7 +155,7 @@ private:
         std::shared_ptr<DCCaptureInfo> &captureInfo);
     void ChooseSuitableResolution(std::vector<std::shared_ptr<DCStreamInfo>> &streamInfo,
         std::shared_ptr<DCCaptureInfo> &captureInfo);
-    bool CompareCandidates(const ResolutionCandidate& src1, const ResolutionCandidate& src2);
+    static bool CompareCandidates(const ResolutionCandidate& src1, const ResolutionCandidate& src2);
     void ResolutionAlignment(std::vector<std::shared_ptr<DCStreamInfo>> &streamInfo,
         std::shared_ptr<DCCaptureInfo> &captureInfo);
     void ChooseSuitableDataSpace(std::vector<std::shared_ptr<DCStreamInfo>> &streamInfo,
@@ -142,7 +167,12 @@ private:
     DCEncodeType ConvertDCEncodeType(std::string &srcEncodeType);
     std::shared_ptr<DCCaptureInfo> BuildSuitableCaptureInfo(const CaptureInfo& srcCaptureInfo,
         std::vector<std::shared_ptr<DCStreamInfo>> &srcStreamInfo);
-    void SnapShotStreamOnCaptureEnded(int32_t captureId, int streamId);
+    std::shared_ptr<DCCaptureInfo> GetNegotiatedCaptureInfo(std::vector<std::shared_ptr<DCStreamInfo>> &streamInfo,
+        bool isForceSwitch);
+    static std::string GetNegotiationKey(const std::vector<std::shared_ptr<DCStreamInfo>> &streamInfo,
+        bool isForceSwitch);
+    void ClearNegotiationCache();
+    void SnapShotStreamOnCaptureEnded(const DStreamHotState &hotState);
     bool HasContinuousCaptureInfo(int captureId);
     int32_t ExtractStreamInfo(std::vector<DCStreamInfo>& dCameraStreams);
     void ExtractCaptureInfo(std::vector<DCCaptureInfo> &captureInfos);
@@ -162,32 +192,40 @@ private:
     std::shared_ptr<CaptureInfo> FindCaptureInfoById(int32_t captureId);
     void InsertCaptureInfo(int captureId, std::shared_ptr<CaptureInfo>& captureInfo);
     void EraseCaptureInfo(int32_t captureId);
-    int32_t FindCaptureIdByStreamId(int32_t streamId);
+    DCamRetCode ReturnStreamBuffer(DStreamHotState &hotState, const DCameraBuffer &buffer, int64_t captureAgeUs);
 
     std::shared_ptr<DCStreamInfo> FindDCStreamById(int32_t streamId);
     void InsertDCStream(int32_t streamId, std::shared_ptr<DCStreamInfo>& dcStreamInfo);
     void EraseDCStream(int32_t streamId);
     void ExtractNotCaptureStream(bool isStreaming, std::vector<std::shared_ptr<DCStreamInfo>>& appendStreamInfo);
 
-    bool FindEnableShutter(int32_t streamId);
-    void InsertEnableShutter(int32_t streamId, bool enableShutterCallback);
-    void EraseEnableShutter(int32_t streamId);
-
-    int32_t FindStreamCaptureBufferNum(const pair<int, int>& streamPair);
-    void AddStreamCaptureBufferNum(const pair<int, int>& streamPair);
-    void EraseStreamCaptureBufferNum(const pair<int, int>& streamPair);
+    std::shared_ptr<DStreamHotState> FindHotState(int32_t streamId);
+    void InsertHotStates(int32_t captureId, const CaptureInfo &info,
+        const std::vector<std::shared_ptr<DCameraStream>> &streams);
+    std::shared_ptr<DStreamHotState> EraseHotState(int32_t captureId, int32_t streamId);
 
     bool IsStreamInfosInvalid(const std::vector<StreamInfo> &infos);
     bool IsCaptureInfoInvalid(const CaptureInfo &info);
 
     int32_t DoCapture(int32_t captureId, const CaptureInfo &info, bool isStreaming);
-    void InsertNotifyCaptureMap(int32_t captureId);
-    void EraseNotifyCaptureMap(int32_t captureId);
     bool CheckInputInfo();
     DCamRetCode ParseFormats(cJSON* rootValue);
 
+    std::shared_ptr<DBufferRing> FindBufferRing(int32_t streamId);
+    void EnableBufferRings(const std::vector<int> &streamIds);
+    void ReleaseBufferRing(int32_t streamId);
+
+    OHOS::sptr<DOfflineStreamOperator> FindOfflineOperator(int32_t streamId);
+    std::shared_ptr<DCameraStream> FindOfflineStream(int32_t streamId);
+    bool HasOfflineOperator();
+    DCamRetCode ShutterOfflineBuffer(int32_t streamId, const DCameraBuffer &buffer, int64_t captureAgeUs);
+    void DetachOfflineStream(const std::shared_ptr<DStreamHotState> &hotState,
+        const OHOS::sptr<DOfflineStreamOperator> &offlineOperator);
+
 private:
     constexpr static uint32_t JSON_ARRAY_MAX_SIZE = 1000;
+    constexpr static const char *BUFFER_RING_PARA = "sys.dcamera.hdi.buffer.ring";
+    constexpr static size_t NEGOTIATION_CACHE_MAX_SIZE = 16;
     std::shared_ptr<DMetadataProcessor> dMetadataProcessor_;
     OHOS::sptr<HDI::Camera::V1_0::IStreamOperatorCallback> dcStreamOperatorCallback_;
     OHOS::sptr<HDI::Camera::V1_2::IStreamOperatorCallback> dcStreamOperatorCallback__V1_2;
@@ -209,8 +247,13 @@ private:
     std::map<int, std::shared_ptr<DCStreamInfo>> dcStreamInfoMap_;
     std::map<int, std::shared_ptr<CaptureInfo>> halCaptureInfoMap_;
     std::vector<std::shared_ptr<DCCaptureInfo>> cachedDCaptureInfoList_;
-    std::map<int, bool> enableShutterCbkMap_;
-    std::map<pair<int, int>, int> acceptedBufferNum_;
+    // Format, resolution, dataspace and encode type negotiated per stream set, without capture settings.
+    // Dropped whenever the streams or the sink ability change, the generation guards against racing such a change.
+    std::map<std::string, DCCaptureInfo> negotiationCache_;
+    uint64_t negotiationGeneration_ = 0;
+    std::mutex negotiationCacheLock_;
+    // Copy-on-write under streamAttrLock_, readers take an atomic snapshot.
+    std::shared_ptr<const DStreamHotStateList> hotStates_ = std::make_shared<const DStreamHotStateList>();
 
     std::mutex streamAttrLock_;
     std::mutex halStreamLock_;
@@ -218,7 +261,11 @@ private:
     std::mutex isCapturingLock_;
     OperationMode_V1_1 currentOperMode_ = OperationMode_V1_1::NORMAL;
     std::shared_ptr<OHOS::Camera::CameraMetadata> latestStreamSetting_;
-    std::map<int, bool> notifyCaptureStartedMap_;
+    std::mutex bufferRingLock_;
+    std::map<int, std::shared_ptr<DBufferRing>> bufferRingMap_;
+    // Snapshot streams finishing their remote capture after being detached by ChangeToOfflineStream.
+    std::mutex offlineOperatorLock_;
+    std::vector<OHOS::sptr<DOfflineStreamOperator>> offlineOperators_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -48,6 +48,9 @@ const uint32_t MAX_SUPPORT_DEFAULT_FPS = 30;
 const int64_t MAX_FRAME_DURATION = 1000000000LL / 10;
 
 const uint32_t BUFFER_QUEUE_SIZE = 8;
+const uint32_t DEFAULT_BUFFER_PREFETCH_COUNT = 4;
+const int32_t BUFFER_PREFETCH_TIMEOUT_MS = 50;
+const uint32_t SYS_PARA_VALUE_LEN = 30;
 
 const uint32_t DEGREE_180 = 180;
 const uint32_t DEGREE_240 = 240;
@@ -68,6 +71,10 @@ const std::string META_DATA_KEY = "MetaData";
 const std::string CAMERA_SUPPORT_MODE = "Mode";
 constexpr int32_t LOG_MAX_LEN = 4096;
 constexpr uint64_t SEC_TO_NSEC_TIMES = 1000000000;
+constexpr int64_t USEC_TO_NSEC_TIMES = 1000;
+constexpr int64_t MSEC_TO_USEC_TIMES = 1000;
+// A frame older than this on arrival means the clock offset to the sink is not synced yet.
+constexpr int64_t MAX_CAPTURE_AGE_US = 1000000;
 const uint32_t OHOS_CONTROL_REQUEST_CAMERA_SWITCH = 268435515;
 const uint32_t OHOS_CONTROL_CAMERA_SWITCH_INFOS = 268435516;
 
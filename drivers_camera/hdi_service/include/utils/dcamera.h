@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -35,6 +35,12 @@ CamRetCode MapToExternalRetCode(DCamRetCode retCode);
 
 uint64_t GetCurrentLocalTimeStamp();
 
+// Microseconds from the sink capture, given in local wall clock microseconds, until now, 0 when unknown.
+int64_t GetCaptureAgeUs(int64_t captureTimeUs);
+
+// The capture time in the unit of GetCurrentLocalTimeStamp.
+uint64_t GetCaptureLocalTimeStamp(int64_t captureAgeUs);
+
 void SplitString(const std::string &str, std::vector<std::string> &tokens, const std::string &delimiters);
 
 std::string Base64Encode(const unsigned char *toEncode, unsigned int len);
@@ -44,6 +50,8 @@ std::string Base64Decode(const std::string& basicString);
 bool IsBase64(unsigned char c);
 
 bool IsDhBaseInfoInvalid(const DHBase& dhBase);
+
+bool GetSysPara(const char *key, int32_t &value);
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif // DISTRIBUTED_CAMERA_H
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DISTRIBUTED_CAMERA_ABILITY_CACHE_H
+#define DISTRIBUTED_CAMERA_ABILITY_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "cJSON.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Parsed sink ability documents, shared by the metadata processor and the stream operator so an ability string
+ * is parsed once however often the device is enabled. The returned trees are shared and must not be modified.
+ */
+class DCameraAbilityCache {
+public:
+    static DCameraAbilityCache &GetInstance();
+
+    std::shared_ptr<cJSON> Parse(const std::string &abilityInfo);
+    // Hands in a tree the caller already parsed, abilityInfo must be its serialized form.
+    void Insert(const std::string &abilityInfo, const std::shared_ptr<cJSON> &root);
+    void Clear();
+
+private:
+    DCameraAbilityCache() = default;
+    ~DCameraAbilityCache() = default;
+    DCameraAbilityCache(const DCameraAbilityCache &) = delete;
+    DCameraAbilityCache &operator=(const DCameraAbilityCache &) = delete;
+
+    struct AbilityEntry {
+        size_t hash;
+        std::string abilityInfo;
+        std::shared_ptr<cJSON> root;
+    };
+
+    constexpr static size_t MAX_CACHED_ABILITIES = 8;
+
+    std::mutex cacheMutex_;
+    // Most recently used first.
+    std::list<AbilityEntry> entries_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // DISTRIBUTED_CAMERA_ABILITY_CACHE_H
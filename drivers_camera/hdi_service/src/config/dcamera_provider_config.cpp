@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -13,19 +13,26 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <hdf_base.h>
 #include <hdf_device_desc.h>
 #include <hdf_log.h>
 #include <hdf_sbuf_ipc.h>
 
+#include "dcamera.h"
 #include "dcamera_provider.h"
-#include "v1_1/dcamera_provider_stub.h"
+#include "ipc_skeleton.h"
+#include "v1_2/dcamera_provider_stub.h"
 
 #include <shared_mutex>
-using namespace OHOS::HDI::DistributedCamera::V1_1;
+using namespace OHOS::HDI::DistributedCamera::V1_2;
 
 namespace {
     std::shared_mutex mutex_;
+    // One IPC pool serves the provider and the camera host, so buffer calls from the source service wait behind
+    // device calls such as UpdateSettings once every thread is busy.
+    constexpr const char *IPC_THREAD_NUM_PARA = "sys.dcamera.thread.ipc.hdi";
+    constexpr int32_t MAX_IPC_THREAD_NUM = 32;
 }
 
 struct HdfDCameraProviderHost {
@@ -62,6 +69,17 @@ static int32_t DCameraProviderDriverDispatch(struct HdfDeviceIoClient *client, i
     return hdfDCameraProviderHost->stub->SendRequest(cmdId, *dataParcel, *replyParcel, option);
 }
 
+static void HdfDCameraProviderSetIpcThreadNum()
+{
+    int32_t threadNum = 0;
+    if (!OHOS::DistributedHardware::GetSysPara(IPC_THREAD_NUM_PARA, threadNum) || threadNum <= 0) {
+        return;
+    }
+    threadNum = std::min(threadNum, MAX_IPC_THREAD_NUM);
+    bool ret = OHOS::IPCSkeleton::SetMaxWorkThreadNum(threadNum);
+    HDF_LOGI("HdfDCameraProviderDriverInit ipc threads %{public}d, ret %{public}d", threadNum, ret);
+}
+
 static int HdfDCameraProviderDriverInit(struct HdfDeviceObject *deviceObject)
 {
     HDF_LOGI("HdfDCameraProviderDriverInit enter");
@@ -69,6 +87,7 @@ static int HdfDCameraProviderDriverInit(struct HdfDeviceObject *deviceObject)
         HDF_LOGE("HdfDCameraProviderDriverInit:: HdfDeviceObject is NULL !");
         return HDF_FAILURE;
     }
+    HdfDCameraProviderSetIpcThreadNum();
 
     if (!HdfDeviceSetClass(deviceObject, DEVICE_CLASS_CAMERA)) {
         HDF_LOGE("HdfDCameraProviderDriverInit set camera class failed");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,8 @@
 
 #include "dcamera_device.h"
 
+#include <algorithm>
+
 #include "anonymous_string.h"
 #include "constants.h"
 #include "dcamera.h"
@@ -530,6 +532,63 @@ DCamRetCode DCameraDevice::ShutterBuffer(int streamId, const DCameraBuffer &buff
     return ret;
 }
 
+DCamRetCode DCameraDevice::AcquireBuffers(const std::vector<int32_t> &streamIds,
+    std::vector<DCameraStreamBuffer> &buffers)
+{
+    if (dCameraStreamOperator_ == nullptr) {
+        DHLOGE("Stream operator not init.");
+        return DEVICE_NOT_INIT;
+    }
+
+    DCamRetCode ret = dCameraStreamOperator_->AcquireBuffers(streamIds, buffers);
+    if (ret != SUCCESS) {
+        DHLOGE("Acquire buffers failed, ret=%{public}d.", ret);
+    }
+    return ret;
+}
+
+DCamRetCode DCameraDevice::ShutterBuffers(const std::vector<DCameraStreamBuffer> &buffers)
+{
+    if (dCameraStreamOperator_ == nullptr) {
+        DHLOGE("Stream operator not init.");
+        return DEVICE_NOT_INIT;
+    }
+
+    DCamRetCode ret = dCameraStreamOperator_->ShutterBuffers(buffers);
+    if (ret != SUCCESS) {
+        DHLOGE("Shutter buffers failed, ret=%{public}d.", ret);
+    }
+    return ret;
+}
+
+DCamRetCode DCameraDevice::OpenBufferRing(int32_t streamId, int &ringFd, int &eventFd)
+{
+    if (dCameraStreamOperator_ == nullptr) {
+        DHLOGE("Stream operator not init.");
+        return DEVICE_NOT_INIT;
+    }
+
+    DCamRetCode ret = dCameraStreamOperator_->OpenBufferRing(streamId, ringFd, eventFd);
+    if (ret != SUCCESS) {
+        DHLOGE("Open buffer ring failed, ret=%{public}d.", ret);
+    }
+    return ret;
+}
+
+DCamRetCode DCameraDevice::GetRingBuffer(int32_t streamId, int32_t index, DCameraBuffer &buffer)
+{
+    if (dCameraStreamOperator_ == nullptr) {
+        DHLOGE("Stream operator not init.");
+        return DEVICE_NOT_INIT;
+    }
+
+    DCamRetCode ret = dCameraStreamOperator_->GetRingBuffer(streamId, index, buffer);
+    if (ret != SUCCESS) {
+        DHLOGE("Get ring buffer failed, ret=%{public}d.", ret);
+    }
+    return ret;
+}
+
 DCamRetCode DCameraDevice::OnSettingsResult(const std::shared_ptr<DCameraSettings> &result)
 {
     if (result == nullptr) {
@@ -558,6 +617,43 @@ DCamRetCode DCameraDevice::OnSettingsResult(const std::shared_ptr<DCameraSetting
     return ret;
 }
 
+DCamRetCode DCameraDevice::OnSettingsResults(const std::vector<DCameraSettingsResult> &results)
+{
+    if (dMetadataProcessor_ == nullptr) {
+        DHLOGE("Metadata processor not init.");
+        return DCamRetCode::DEVICE_NOT_INIT;
+    }
+
+    std::vector<const DCameraSettingsResult *> ordered;
+    ordered.reserve(results.size());
+    for (const auto &result : results) {
+        ordered.push_back(&result);
+    }
+    // Serial arithmetic, so the order holds when the sequence number wraps within a call.
+    std::stable_sort(ordered.begin(), ordered.end(), [](const auto *lhs, const auto *rhs) {
+        return static_cast<int32_t>(lhs->sequence_ - rhs->sequence_) < 0;
+    });
+    DCamRetCode ret = DCamRetCode::SUCCESS;
+    for (size_t i = 0; i < ordered.size(); i++) {
+        const DCameraSettingsResult &result = *ordered[i];
+        if (i > 0 && result.sequence_ == ordered[i - 1]->sequence_) {
+            DHLOGW("Drop repeated camera settings result, sequence = %{public}u.", result.sequence_);
+            continue;
+        }
+        if (result.type_ != DCSettingsType::METADATA_RESULT) {
+            DHLOGE("Invalid camera setting type = %{public}d.", result.type_);
+            ret = DCamRetCode::INVALID_ARGUMENT;
+            continue;
+        }
+        DCamRetCode saveRet = dMetadataProcessor_->SaveResultMetadata(result.value_);
+        if (saveRet != DCamRetCode::SUCCESS) {
+            DHLOGE("Save result metadata %{public}u failed, ret = %{public}d", result.sequence_, saveRet);
+            ret = saveRet;
+        }
+    }
+    return ret;
+}
+
 DCamRetCode DCameraDevice::Notify(const std::shared_ptr<DCameraHDFEvent> &event)
 {
     CHECK_AND_RETURN_RET_LOG(event == nullptr, DCamRetCode::INVALID_ARGUMENT, "event is nullptr");
@@ -664,6 +760,11 @@ bool DCameraDevice::IsOpened()
     return isOpened_;
 }
 
+bool DCameraDevice::HasFullAbility()
+{
+    return dCameraAbilityInfo_.find(FULL_DATA_KEY) != dCameraAbilityInfo_.npos;
+}
+
 void DCameraDevice::SetDcameraAbility(const std::string& sinkAbilityInfo)
 {
     DHLOGI("DCameraDevice SetDcameraAbility enter.");
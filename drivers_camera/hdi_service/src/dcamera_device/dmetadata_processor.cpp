@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,8 +15,11 @@
 
 #include "dmetadata_processor.h"
 
+#include <cstring>
+
 #include "dbuffer_manager.h"
 #include "dcamera.h"
+#include "dcamera_ability_cache.h"
 #include "distributed_hardware_log.h"
 #include "cJSON.h"
 #include "metadata_utils.h"
@@ -25,12 +28,11 @@ namespace OHOS {
 namespace DistributedHardware {
 DCamRetCode DMetadataProcessor::InitDCameraAbility(const std::string &sinkAbilityInfo)
 {
-    cJSON *rootValue = cJSON_Parse(sinkAbilityInfo.c_str());
-    CHECK_NULL_RETURN_LOG(rootValue, FAILED, "The sinkAbilityInfo is null.");
-    CHECK_OBJECT_FREE_RETURN(rootValue, FAILED, "The sinkAbilityInfo is not object.");
+    std::shared_ptr<cJSON> root = DCameraAbilityCache::GetInstance().Parse(sinkAbilityInfo);
+    CHECK_NULL_RETURN_LOG(root, FAILED, "The sinkAbilityInfo is invalid.");
+    cJSON *rootValue = root.get();
     cJSON *metaObj = cJSON_GetObjectItemCaseSensitive(rootValue, "MetaData");
     if (metaObj == nullptr || !cJSON_IsString(metaObj) || (metaObj->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         return FAILED;
     }
     std::string metadataStr = std::string(metaObj->valuestring);
@@ -49,31 +51,34 @@ DCamRetCode DMetadataProcessor::InitDCameraAbility(const std::string &sinkAbilit
         DHLOGE("Metadata is null in ability set or failed to decode metadata ability from string.");
         dCameraAbility_ = std::make_shared<CameraAbility>(DEFAULT_ENTRY_CAPACITY, DEFAULT_DATA_CAPACITY);
     }
+    // The output keys rewrite the decoded stream configurations, the holes they leave are closed once below.
+    OHOS::Camera::SetCameraMetadataSlack(dCameraAbility_->get(), true);
 
     if (OHOS::Camera::GetCameraMetadataItemCount(dCameraAbility_->get()) <= 0) {
-        DCamRetCode ret = InitDCameraDefaultAbilityKeys(sinkAbilityInfo);
+        DCamRetCode ret = InitDCameraDefaultAbilityKeys(rootValue);
         if (ret != SUCCESS) {
             DHLOGE("Init distributed camera defalult abilily keys failed.");
             dCameraAbility_ = nullptr;
-            cJSON_Delete(rootValue);
             return ret;
         }
     }
-    DCamRetCode ret = InitDCameraOutputAbilityKeys(sinkAbilityInfo);
+    DCamRetCode ret = InitDCameraOutputAbilityKeys(rootValue);
     if (ret != SUCCESS) {
         DHLOGE("Init distributed camera output abilily keys failed.");
         dCameraAbility_ = nullptr;
-        cJSON_Delete(rootValue);
         return ret;
     }
+    if (OHOS::Camera::CompactCameraMetadata(dCameraAbility_->get()) != CAM_META_SUCCESS) {
+        DHLOGW("Compact distributed camera ability failed.");
+    }
+    OHOS::Camera::SetCameraMetadataSlack(dCameraAbility_->get(), false);
 
     camera_metadata_item_entry_t* itemEntry = OHOS::Camera::GetMetadataItems(dCameraAbility_->get());
-    CHECK_AND_FREE_RETURN_RET_LOG(itemEntry == nullptr, FAILED, rootValue, "get itemEntry failed.");
+    CHECK_AND_RETURN_RET_LOG(itemEntry == nullptr, FAILED, "get itemEntry failed.");
     uint32_t count = dCameraAbility_->get()->item_count;
     for (uint32_t i = 0; i < count; i++, itemEntry++) {
         allResultSet_.insert((MetaType)(itemEntry->item));
     }
-    cJSON_Delete(rootValue);
     return SUCCESS;
 }
 
@@ -156,31 +161,26 @@ void DMetadataProcessor::SetFpsRanges()
     AddAbilityEntry(OHOS_CONTROL_AE_AVAILABLE_TARGET_FPS_RANGES, fpsRanges.data(), fpsRanges.size());
 }
 
-bool DMetadataProcessor::GetInfoFromJson(const std::string& sinkAbilityInfo)
+bool DMetadataProcessor::GetInfoFromJson(cJSON* rootValue)
 {
-    cJSON *rootValue = cJSON_Parse(sinkAbilityInfo.c_str());
     CHECK_NULL_RETURN_LOG(rootValue, false, "The sinkAbilityInfo is null.");
-    CHECK_OBJECT_FREE_RETURN(rootValue, false, "The sinkAbilityInfo is not object.");
     cJSON *verObj = cJSON_GetObjectItemCaseSensitive(rootValue, "ProtocolVer");
     if (verObj == nullptr || !cJSON_IsString(verObj) || (verObj->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         return false;
     }
     protocolVersion_ = std::string(verObj->valuestring);
 
     cJSON *positionObj = cJSON_GetObjectItemCaseSensitive(rootValue, "Position");
     if (positionObj == nullptr || !cJSON_IsString(positionObj) || (positionObj->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         return false;
     }
     dCameraPosition_ = std::string(positionObj->valuestring);
-    cJSON_Delete(rootValue);
     return true;
 }
 
-DCamRetCode DMetadataProcessor::InitDCameraDefaultAbilityKeys(const std::string &sinkAbilityInfo)
+DCamRetCode DMetadataProcessor::InitDCameraDefaultAbilityKeys(cJSON* rootValue)
 {
-    if (!GetInfoFromJson(sinkAbilityInfo)) {
+    if (!GetInfoFromJson(rootValue)) {
         return FAILED;
     }
     if (dCameraPosition_ == "BACK") {
@@ -243,10 +243,10 @@ DCamRetCode DMetadataProcessor::InitDCameraDefaultAbilityKeys(const std::string
     return SUCCESS;
 }
 
-void DMetadataProcessor::InitOutputAbilityWithoutMode(const std::string &sinkAbilityInfo)
+void DMetadataProcessor::InitOutputAbilityWithoutMode(cJSON* rootValue)
 {
     DHLOGI("InitOutputAbilityWithoutMode enter.");
-    std::map<int, std::vector<DCResolution>> supportedFormats = GetDCameraSupportedFormats(sinkAbilityInfo);
+    std::map<int, std::vector<DCResolution>> supportedFormats = GetDCameraSupportedFormats(rootValue);
 
     std::vector<int32_t> streamConfigs;
     std::vector<int32_t> extendStreamConfigs;
@@ -269,20 +269,17 @@ void DMetadataProcessor::InitOutputAbilityWithoutMode(const std::string &sinkAbi
     UpdateAbilityTag(streamConfigs, extendStreamConfigs);
 }
 
-DCamRetCode DMetadataProcessor::InitDCameraOutputAbilityKeys(const std::string &sinkAbilityInfo)
+DCamRetCode DMetadataProcessor::InitDCameraOutputAbilityKeys(cJSON* rootValue)
 {
-    cJSON *rootValue = cJSON_Parse(sinkAbilityInfo.c_str());
     CHECK_NULL_RETURN_LOG(rootValue, FAILED, "The sinkAbilityInfo is null.");
-    CHECK_OBJECT_FREE_RETURN(rootValue, FAILED, "The sinkAbilityInfo is not object.");
 
     cJSON *modeArray = cJSON_GetObjectItemCaseSensitive(rootValue, CAMERA_SUPPORT_MODE.c_str());
     if (modeArray == nullptr || !cJSON_IsArray(modeArray)) {
-        InitOutputAbilityWithoutMode(sinkAbilityInfo);
-        cJSON_Delete(rootValue);
+        InitOutputAbilityWithoutMode(rootValue);
         return SUCCESS;
     }
-    CHECK_AND_FREE_RETURN_RET_LOG(cJSON_GetArraySize(modeArray) == 0 || static_cast<uint32_t>(
-        cJSON_GetArraySize(modeArray)) > JSON_ARRAY_MAX_SIZE, FAILED, rootValue, "modeArray create error.");
+    CHECK_AND_RETURN_RET_LOG(cJSON_GetArraySize(modeArray) == 0 || static_cast<uint32_t>(
+        cJSON_GetArraySize(modeArray)) > JSON_ARRAY_MAX_SIZE, FAILED, "modeArray create error.");
 
     std::vector<std::string> keys;
     int32_t arraySize = cJSON_GetArraySize(modeArray);
@@ -294,16 +291,14 @@ DCamRetCode DMetadataProcessor::InitDCameraOutputAbilityKeys(const std::string &
     }
     std::vector<int32_t> streamConfigs;
     std::vector<int32_t> extendStreamConfigs;
-    CHECK_AND_FREE_RETURN_RET_LOG(dCameraAbility_ == nullptr, FAILED, rootValue, "dCameraAbility_ null.");
+    CHECK_AND_RETURN_RET_LOG(dCameraAbility_ == nullptr, FAILED, "dCameraAbility_ null.");
     for (std::string key : keys) {
         cJSON *value = cJSON_GetObjectItem(rootValue, key.c_str());
-        CHECK_AND_FREE_RETURN_RET_LOG(value == nullptr || !cJSON_IsObject(value), FAILED, rootValue, "mode get error.");
+        CHECK_AND_RETURN_RET_LOG(value == nullptr || !cJSON_IsObject(value), FAILED, "mode get error.");
 
-        char *jsonValue = cJSON_Print(value);
-        CHECK_AND_FREE_RETURN_RET_LOG(jsonValue == nullptr, FAILED, rootValue, "cJson print value error.");
-        std::string format(jsonValue);
-        DHLOGI("the current mode :%{public}s. value :%{public}s", key.c_str(), format.c_str());
-        std::map<int, std::vector<DCResolution>> supportedFormats = GetDCameraSupportedFormats(format);
+        // The mode object is read in place, it used to be printed and parsed again for every mode.
+        DHLOGI("the current mode :%{public}s.", key.c_str());
+        std::map<int, std::vector<DCResolution>> supportedFormats = GetDCameraSupportedFormats(value);
 
         camera_metadata_item_t item;
         int32_t ret = OHOS::Camera::FindCameraMetadataItem(dCameraAbility_->get(),
@@ -316,14 +311,11 @@ DCamRetCode DMetadataProcessor::InitDCameraOutputAbilityKeys(const std::string &
         InitExtendConfigTag(supportedFormats, extendStreamConfigs);
         extendStreamConfigs.push_back(EXTEND_EOF); // mode eof
 
-        cJSON_free(jsonValue);
         sinkPhotoProfiles_.clear();
         sinkPreviewProfiles_.clear();
         sinkVideoProfiles_.clear();
     }
     UpdateAbilityTag(streamConfigs, extendStreamConfigs);
-
-    cJSON_Delete(rootValue);
     return SUCCESS;
 }
 
@@ -551,13 +543,19 @@ void DMetadataProcessor::UpdateResultMetadata(const uint64_t &resultTimestamp)
         return;
     }
 
-    std::lock_guard<std::mutex> autoLock(producerMutex_);
-    if (latestProducerMetadataResult_ == nullptr) {
-        DHLOGD("DMetadataProcessor::UpdateResultMetadata latest producer metadata result is null");
-        return;
+    std::shared_ptr<OHOS::Camera::CameraMetadata> result = nullptr;
+    {
+        std::lock_guard<std::mutex> autoLock(producerMutex_);
+        if (latestProducerMetadataResult_ == nullptr) {
+            DHLOGD("DMetadataProcessor::UpdateResultMetadata latest producer metadata result is null");
+            return;
+        }
+        result = UpdateAllResult(resultTimestamp);
+    }
+    // The local reference keeps the buffer out of reuse until the callback returns, so no lock is needed here.
+    if (result != nullptr && resultCallback_ != nullptr) {
+        resultCallback_(resultTimestamp, result);
     }
-
-    UpdateAllResult(resultTimestamp);
 }
 
 void DMetadataProcessor::SetResultCallback(
@@ -566,65 +564,81 @@ void DMetadataProcessor::SetResultCallback(
     resultCallback_ = resultCbk;
 }
 
-void DMetadataProcessor::UpdateAllResult(const uint64_t &resultTimestamp)
+std::shared_ptr<OHOS::Camera::CameraMetadata> DMetadataProcessor::UpdateAllResult(const uint64_t &resultTimestamp)
 {
-    uint32_t itemCap = OHOS::Camera::GetCameraMetadataItemCapacity(latestProducerMetadataResult_->get());
-    uint32_t dataSize = OHOS::Camera::GetCameraMetadataDataSize(latestProducerMetadataResult_->get());
-    DHLOGD("DMetadataProcessor::UpdateAllResult itemCapacity: %{public}u, dataSize: %{public}u", itemCap, dataSize);
-    std::shared_ptr<OHOS::Camera::CameraMetadata> result =
-        std::make_shared<OHOS::Camera::CameraMetadata>(itemCap, dataSize);
-    int32_t ret = OHOS::Camera::CopyCameraMetadataItems(result->get(), latestProducerMetadataResult_->get());
-    if (ret != CAM_META_SUCCESS) {
-        DHLOGE("DMetadataProcessor::UpdateAllResult copy metadata item failed, ret: %{public}d", ret);
-        return;
+    // Leave room for the sensor timestamp in case the producer result does not carry one.
+    uint32_t itemCap = OHOS::Camera::GetCameraMetadataItemCapacity(latestProducerMetadataResult_->get()) + 1;
+    uint32_t dataSize = OHOS::Camera::GetCameraMetadataDataSize(latestProducerMetadataResult_->get()) +
+        sizeof(int64_t);
+    size_t index = GetResultBuffer(itemCap, dataSize);
+    std::shared_ptr<OHOS::Camera::CameraMetadata> result = resultBuffers_[index];
+    if (resultGenerations_[index] != producerGeneration_) {
+        DHLOGD("DMetadataProcessor::UpdateAllResult itemCapacity: %{public}u, dataSize: %{public}u", itemCap,
+            dataSize);
+        common_metadata_header_t *header = result->get();
+        OHOS::Camera::FillCameraMetadata(header, header->size, header->item_capacity, header->data_capacity);
+        resultGenerations_[index] = 0;
+        int32_t ret = OHOS::Camera::CopyCameraMetadataItems(header, latestProducerMetadataResult_->get());
+        if (ret != CAM_META_SUCCESS) {
+            DHLOGE("DMetadataProcessor::UpdateAllResult copy metadata item failed, ret: %{public}d", ret);
+            return nullptr;
+        }
+        resultGenerations_[index] = producerGeneration_;
     }
-    resultCallback_(resultTimestamp, result);
+    if (!PatchResultTimestamp(result, resultTimestamp)) {
+        resultGenerations_[index] = 0;
+        return nullptr;
+    }
+    return result;
+}
+
+bool DMetadataProcessor::PatchResultTimestamp(const std::shared_ptr<OHOS::Camera::CameraMetadata> &result,
+    uint64_t timestamp)
+{
+    int64_t sensorTimestamp = static_cast<int64_t>(timestamp);
+    camera_metadata_item_t item;
+    bool ret = false;
+    if (OHOS::Camera::FindCameraMetadataItem(result->get(), OHOS_SENSOR_INFO_TIMESTAMP, &item) == CAM_META_SUCCESS) {
+        ret = result->updateEntry(OHOS_SENSOR_INFO_TIMESTAMP, &sensorTimestamp, 1);
+    } else {
+        ret = result->addEntry(OHOS_SENSOR_INFO_TIMESTAMP, &sensorTimestamp, 1);
+    }
+    if (!ret) {
+        DHLOGE("DMetadataProcessor::PatchResultTimestamp update sensor timestamp failed.");
+    }
+    return ret;
 }
 
 void DMetadataProcessor::UpdateOnChanged(const uint64_t &resultTimestamp)
 {
-    bool needReturn = false;
     if (latestProducerMetadataResult_ == nullptr || latestConsumerMetadataResult_ == nullptr) {
         DHLOGD("DMetadataProcessor::UpdateResultMetadata latest producer metadata result is null");
         return;
     }
+    DHLOGD("DMetadataProcessor::UpdateOnChanged changedResultSet size: %{public}zu", changedResultSet_.size());
+    if (changedResultSet_.empty()) {
+        return;
+    }
     uint32_t itemCap = OHOS::Camera::GetCameraMetadataItemCapacity(latestProducerMetadataResult_->get());
     uint32_t dataSize = OHOS::Camera::GetCameraMetadataDataSize(latestProducerMetadataResult_->get());
     DHLOGD("DMetadataProcessor::UpdateOnChanged itemCapacity: %{public}u, dataSize: %{public}u", itemCap, dataSize);
-    std::shared_ptr<OHOS::Camera::CameraMetadata> result =
-        std::make_shared<OHOS::Camera::CameraMetadata>(itemCap, dataSize);
-    DHLOGD("DMetadataProcessor::UpdateOnChanged enabledResultSet size: %{public}zu", enabledResultSet_.size());
-    for (auto tag : enabledResultSet_) {
-        DHLOGD("DMetadataProcessor::UpdateOnChanged cameta device metadata tag: %{public}d", tag);
-        camera_metadata_item_t item;
-        camera_metadata_item_t anoItem;
-        int ret1 = OHOS::Camera::FindCameraMetadataItem(latestProducerMetadataResult_->get(), tag, &item);
-        int ret2 = OHOS::Camera::FindCameraMetadataItem(latestConsumerMetadataResult_->get(), tag, &anoItem);
-        DHLOGD("DMetadataProcessor::UpdateOnChanged find metadata item ret: %{public}d, %{public}d", ret1, ret2);
-        if (ret1 != CAM_META_SUCCESS) {
+    size_t index = GetResultBuffer(itemCap, dataSize);
+    std::shared_ptr<OHOS::Camera::CameraMetadata> result = resultBuffers_[index];
+    common_metadata_header_t *header = result->get();
+    OHOS::Camera::FillCameraMetadata(header, header->size, header->item_capacity, header->data_capacity);
+    resultGenerations_[index] = 0;
+    bool needReturn = false;
+    for (auto tag : changedResultSet_) {
+        if (enabledResultSet_.find(tag) == enabledResultSet_.end()) {
             continue;
         }
-
-        if (ret2 == CAM_META_SUCCESS) {
-            if ((item.count != anoItem.count) || (item.data_type != anoItem.data_type)) {
-                needReturn = true;
-                result->addEntry(tag, GetMetadataItemData(item), item.count);
-                continue;
-            }
-            uint32_t size = GetDataSize(item.data_type);
-            DHLOGD("DMetadataProcessor::UpdateOnChanged data size: %{public}u", size);
-            for (uint32_t i = 0; i < (size * static_cast<uint32_t>(item.count)); i++) {
-                if (*(item.data.u8 + i) != *(anoItem.data.u8 + i)) {
-                    needReturn = true;
-                    result->addEntry(tag, GetMetadataItemData(item), item.count);
-                    break;
-                }
-            }
-        } else {
-            needReturn = true;
-            result->addEntry(tag, GetMetadataItemData(item), item.count);
+        camera_metadata_item_t item;
+        int ret = OHOS::Camera::FindCameraMetadataItem(latestProducerMetadataResult_->get(), tag, &item);
+        if (ret != CAM_META_SUCCESS) {
             continue;
         }
+        needReturn = true;
+        result->addEntry(tag, GetMetadataItemData(item), item.count);
     }
 
     if (needReturn) {
@@ -632,6 +646,61 @@ void DMetadataProcessor::UpdateOnChanged(const uint64_t &resultTimestamp)
     }
 }
 
+void DMetadataProcessor::CollectChangedResults()
+{
+    changedResultSet_.clear();
+    common_metadata_header_t *producer = latestProducerMetadataResult_->get();
+    uint32_t count = OHOS::Camera::GetCameraMetadataItemCount(producer);
+    for (uint32_t index = 0; index < count; index++) {
+        camera_metadata_item_t item;
+        if (OHOS::Camera::GetCameraMetadataItem(producer, index, &item) != CAM_META_SUCCESS) {
+            continue;
+        }
+        camera_metadata_item_t anoItem;
+        int ret = OHOS::Camera::FindCameraMetadataItem(latestConsumerMetadataResult_->get(), item.item, &anoItem);
+        if (ret != CAM_META_SUCCESS || IsResultItemChanged(item, anoItem)) {
+            changedResultSet_.insert(static_cast<MetaType>(item.item));
+        }
+    }
+}
+
+bool DMetadataProcessor::IsResultItemChanged(const camera_metadata_item_t &item, const camera_metadata_item_t &anoItem)
+{
+    if ((item.count != anoItem.count) || (item.data_type != anoItem.data_type)) {
+        return true;
+    }
+    size_t size = static_cast<size_t>(GetDataSize(item.data_type)) * item.count;
+    return size != 0 && memcmp(item.data.u8, anoItem.data.u8, size) != 0;
+}
+
+size_t DMetadataProcessor::GetResultBuffer(uint32_t itemCapacity, uint32_t dataCapacity)
+{
+    // Prefer an idle buffer that already holds the current producer result, then any idle one large enough.
+    size_t candidate = RESULT_BUFFER_NUM;
+    for (size_t i = 0; i < RESULT_BUFFER_NUM; i++) {
+        common_metadata_header_t *header = resultBuffers_[i] == nullptr ? nullptr : resultBuffers_[i]->get();
+        if (header == nullptr || resultBuffers_[i].use_count() > 1 || header->item_capacity < itemCapacity ||
+            header->data_capacity < dataCapacity) {
+            continue;
+        }
+        if (resultGenerations_[i] != 0 && resultGenerations_[i] == producerGeneration_) {
+            return i;
+        }
+        if (candidate == RESULT_BUFFER_NUM) {
+            candidate = i;
+        }
+    }
+    if (candidate != RESULT_BUFFER_NUM) {
+        return candidate;
+    }
+    // Both buffers are held by the callback or too small, replace them in turn.
+    size_t index = nextResultBuffer_;
+    nextResultBuffer_ = (nextResultBuffer_ + 1) % RESULT_BUFFER_NUM;
+    resultBuffers_[index] = std::make_shared<OHOS::Camera::CameraMetadata>(itemCapacity, dataCapacity);
+    resultGenerations_[index] = 0;
+    return index;
+}
+
 DCamRetCode DMetadataProcessor::SaveResultMetadata(std::string resultStr)
 {
     if (resultStr.empty()) {
@@ -640,13 +709,29 @@ DCamRetCode DMetadataProcessor::SaveResultMetadata(std::string resultStr)
     }
 
     std::string metadataStr = Base64Decode(resultStr);
+    return SaveDecodedResult(OHOS::Camera::MetadataUtils::DecodeFromString(metadataStr));
+}
+
+DCamRetCode DMetadataProcessor::SaveResultMetadata(const std::vector<uint8_t> &result)
+{
+    if (result.empty() || result.size() > UINT32_MAX) {
+        DHLOGE("Input result is empty or too large, size: %{public}zu.", result.size());
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    return SaveDecodedResult(OHOS::Camera::MetadataUtils::DecodeFromBuffer(
+        reinterpret_cast<const char *>(result.data()), static_cast<uint32_t>(result.size())));
+}
+
+DCamRetCode DMetadataProcessor::SaveDecodedResult(const std::shared_ptr<OHOS::Camera::CameraMetadata> &result)
+{
     std::lock_guard<std::mutex> autoLock(producerMutex_);
     latestConsumerMetadataResult_ = latestProducerMetadataResult_;
-    latestProducerMetadataResult_ = OHOS::Camera::MetadataUtils::DecodeFromString(metadataStr);
+    latestProducerMetadataResult_ = result;
     if (latestProducerMetadataResult_ == nullptr) {
         DHLOGE("Failed to decode metadata setting from string.");
         return DCamRetCode::INVALID_ARGUMENT;
     }
+    producerGeneration_++;
 
     if (!OHOS::Camera::GetCameraMetadataItemCount(latestProducerMetadataResult_->get())) {
         DHLOGE("Input result metadata item is empty.");
@@ -660,7 +745,10 @@ DCamRetCode DMetadataProcessor::SaveResultMetadata(std::string resultStr)
 
     uint64_t resultTimestamp = GetCurrentLocalTimeStamp();
     if (latestConsumerMetadataResult_ == nullptr) {
-        UpdateAllResult(resultTimestamp);
+        std::shared_ptr<OHOS::Camera::CameraMetadata> result = UpdateAllResult(resultTimestamp);
+        if (result != nullptr) {
+            resultCallback_(resultTimestamp, result);
+        }
         return SUCCESS;
     }
 
@@ -673,6 +761,7 @@ DCamRetCode DMetadataProcessor::SaveResultMetadata(std::string resultStr)
     for (uint32_t i = 0; i < count; i++, itemEntry++) {
         enabledResultSet_.insert((MetaType)(itemEntry->item));
     }
+    CollectChangedResults();
     UpdateOnChanged(resultTimestamp);
     return SUCCESS;
 }
@@ -945,17 +1034,13 @@ void DMetadataProcessor::StoreSinkAndSrcFps(int format, const std::string rootNo
         sinkVideoFps_[format] = fpsVec;
     }
 }
-std::map<int, std::vector<DCResolution>> DMetadataProcessor::GetDCameraSupportedFormats(
-    const std::string &abilityInfo)
+std::map<int, std::vector<DCResolution>> DMetadataProcessor::GetDCameraSupportedFormats(cJSON* rootValue)
 {
     std::map<int, std::vector<DCResolution>> supportedFormats;
-    cJSON *rootValue = cJSON_Parse(abilityInfo.c_str());
     CHECK_NULL_RETURN_LOG(rootValue, supportedFormats, "The sinkAbilityInfo is null.");
-    CHECK_OBJECT_FREE_RETURN(rootValue, supportedFormats, "The sinkAbilityInfo is not object.");
     ParsePhotoFormats(rootValue, supportedFormats);
     ParsePreviewFormats(rootValue, supportedFormats);
     ParseVideoFormats(rootValue, supportedFormats);
-    cJSON_Delete(rootValue);
     return supportedFormats;
 }
 
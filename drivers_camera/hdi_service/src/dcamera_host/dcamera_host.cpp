@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -104,11 +104,19 @@ int32_t DCameraHost::GetCameraAbilityFromDev(const std::string &cameraId, std::s
 
 int32_t DCameraHost::GetCameraAbility(const std::string &cameraId, std::vector<uint8_t> &cameraAbility)
 {
+    if (GetCachedCameraAbility(cameraId, cameraAbility)) {
+        return CamRetCode::NO_ERROR;
+    }
     if (IsCameraIdInvalid(cameraId)) {
         DHLOGE("DCameraHost::GetCameraAbility, input cameraId is invalid.");
         return CamRetCode::INVALID_ARGUMENT;
     }
     DHLOGI("DCameraHost::GetCameraAbility for cameraId: %{public}s", GetAnonyString(cameraId).c_str());
+    uint64_t generation = 0;
+    {
+        std::shared_lock<std::shared_mutex> cacheLock(abilityCacheLock_);
+        generation = abilityCacheGeneration_;
+    }
     std::shared_ptr<CameraAbility> ability;
     int32_t ret = GetCameraAbilityFromDev(cameraId, ability);
     if (ret != CamRetCode::NO_ERROR) {
@@ -120,37 +128,77 @@ int32_t DCameraHost::GetCameraAbility(const std::string &cameraId, std::vector<u
         DHLOGE("DCameraHost::GetCameraAbility, ConvertMetadataToVec failed.");
         return CamRetCode::INVALID_ARGUMENT;
     }
-    do {
-        camera_metadata_item_t item;
-        constexpr uint32_t WIDTH_OFFSET = 1;
-        constexpr uint32_t HEIGHT_OFFSET = 2;
-        constexpr uint32_t UNIT_LENGTH = 3;
-        ret = OHOS::Camera::FindCameraMetadataItem(ability->get(),
-            OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS, &item);
-        DHLOGI("FindCameraMetadataItem item=%{public}u, count=%{public}u, dataType=%{public}u", item.item,
-            item.count, item.data_type);
-        if (ret != CAM_META_SUCCESS) {
-            DHLOGE("Failed to find stream configuration in camera ability with return code %{public}d", ret);
-            break;
-        }
-        if (item.count % UNIT_LENGTH != 0) {
-            DHLOGE("Invalid stream configuration count: %{public}u", item.count);
-            break;
-        }
-        for (uint32_t index = 0; index < item.count; index += UNIT_LENGTH) {
-            if (item.data.i32 == nullptr) {
-                DHLOGE("Invalid stream configuration data");
-                continue;
-            }
-            int32_t format = item.data.i32[index];
-            int32_t width = item.data.i32[index + WIDTH_OFFSET];
-            int32_t height = item.data.i32[index + HEIGHT_OFFSET];
-            DHLOGD("format: %{public}d, width: %{public}d, height: %{public}d", format, width, height);
-        }
-    } while (0);
+    DumpStreamConfigurations(ability);
+    // An ability without the full data is asked again, the full data may arrive later.
+    if (HasFullAbility(cameraId)) {
+        CacheCameraAbility(cameraId, generation, cameraAbility);
+    }
     return CamRetCode::NO_ERROR;
 }
 
+bool DCameraHost::GetCachedCameraAbility(const std::string &cameraId, std::vector<uint8_t> &cameraAbility)
+{
+    std::shared_lock<std::shared_mutex> cacheLock(abilityCacheLock_);
+    auto iter = abilityCache_.find(cameraId);
+    if (iter == abilityCache_.end()) {
+        return false;
+    }
+    cameraAbility = iter->second;
+    return true;
+}
+
+void DCameraHost::CacheCameraAbility(const std::string &cameraId, uint64_t generation,
+    const std::vector<uint8_t> &cameraAbility)
+{
+    std::unique_lock<std::shared_mutex> cacheLock(abilityCacheLock_);
+    if (generation != abilityCacheGeneration_) {
+        DHLOGI("Camera ability changed while serializing, not cached, cameraId: %{public}s",
+            GetAnonyString(cameraId).c_str());
+        return;
+    }
+    abilityCache_[cameraId] = cameraAbility;
+}
+
+void DCameraHost::InvalidateCameraAbility(const std::string &cameraId)
+{
+    std::unique_lock<std::shared_mutex> cacheLock(abilityCacheLock_);
+    abilityCache_.erase(cameraId);
+    abilityCacheGeneration_++;
+}
+
+bool DCameraHost::HasFullAbility(const std::string &cameraId)
+{
+    std::lock_guard<std::mutex> autoLock(deviceMapLock_);
+    auto iter = dCameraDeviceMap_.find(cameraId);
+    return iter != dCameraDeviceMap_.end() && iter->second != nullptr && iter->second->HasFullAbility();
+}
+
+void DCameraHost::DumpStreamConfigurations(const std::shared_ptr<CameraAbility> &ability)
+{
+    camera_metadata_item_t item;
+    constexpr uint32_t WIDTH_OFFSET = 1;
+    constexpr uint32_t HEIGHT_OFFSET = 2;
+    constexpr uint32_t UNIT_LENGTH = 3;
+    int32_t ret = OHOS::Camera::FindCameraMetadataItem(ability->get(),
+        OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS, &item);
+    if (ret != CAM_META_SUCCESS) {
+        DHLOGE("Failed to find stream configuration in camera ability with return code %{public}d", ret);
+        return;
+    }
+    DHLOGI("FindCameraMetadataItem item=%{public}u, count=%{public}u, dataType=%{public}u", item.item,
+        item.count, item.data_type);
+    if (item.count % UNIT_LENGTH != 0 || item.data.i32 == nullptr) {
+        DHLOGE("Invalid stream configuration count: %{public}u", item.count);
+        return;
+    }
+    for (uint32_t index = 0; index < item.count; index += UNIT_LENGTH) {
+        int32_t format = item.data.i32[index];
+        int32_t width = item.data.i32[index + WIDTH_OFFSET];
+        int32_t height = item.data.i32[index + HEIGHT_OFFSET];
+        DHLOGD("format: %{public}d, width: %{public}d, height: %{public}d", format, width, height);
+    }
+}
+
 template<typename Callback, typename Device>
 int32_t DCameraHost::OpenCameraImpl(const std::string &cameraId, const Callback &callbackObj, Device &device)
 {
@@ -337,6 +385,7 @@ std::optional<DCamRetCode> DCameraHost::HandleExistingDCamera(const std::string&
         return DCamRetCode::INVALID_ARGUMENT;
     }
     iter->second->SetDcameraAbility(sinkAbilityInfo);
+    InvalidateCameraAbility(dCameraId);
     DHLOGI("AddDCameraDevice refresh data success");
     return DCamRetCode::SUCCESS;
 }
@@ -355,6 +404,7 @@ DCamRetCode DCameraHost::HandleNewDCamera(const DHBase &dhBase, const std::strin
         std::lock_guard<std::mutex> autoLock(deviceMapLock_);
         dCameraDeviceMap_[dCameraId] = dcameraDevice;
     }
+    InvalidateCameraAbility(dCameraId);
     if (callback == nullptr) {
         DHLOGE("DCameraHost::SetProviderCallback failed, callback is null");
         return DCamRetCode::INVALID_ARGUMENT;
@@ -416,6 +466,7 @@ DCamRetCode DCameraHost::RemoveDCameraDevice(const DHBase &dhBase)
         std::lock_guard<std::mutex> autoLock(deviceMapLock_);
         dCameraDeviceMap_.erase(dCameraId);
     }
+    InvalidateCameraAbility(dCameraId);
     sptr<HDI::Camera::V1_0::ICameraHostCallback> callback_v1_0 = nullptr;
     sptr<HDI::Camera::V1_2::ICameraHostCallback> callback_v1_2 = nullptr;
     {
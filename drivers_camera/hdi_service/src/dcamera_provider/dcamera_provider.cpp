@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,7 @@
 #include "dcamera_provider.h"
 #include "anonymous_string.h"
 #include "constants.h"
+#include "dcamera_ability_cache.h"
 #include "dcamera_device.h"
 #include "dcamera_host.h"
 #include "distributed_hardware_log.h"
@@ -26,9 +27,32 @@ namespace DistributedHardware {
 OHOS::sptr<DCameraProvider> DCameraProvider::instance_ = nullptr;
 DCameraProvider::AutoRelease DCameraProvider::autoRelease_;
 
-extern "C" IDCameraProvider *HdiImplGetInstance(void)
+extern "C" OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider *HdiImplGetInstance(void)
 {
-    return static_cast<IDCameraProvider *>(DCameraProvider::GetInstance().GetRefPtr());
+    return static_cast<OHOS::HDI::DistributedCamera::V1_2::IDCameraProvider *>(
+        DCameraProvider::GetInstance().GetRefPtr());
+}
+
+namespace {
+// Detaches one part of the enable document and keeps it parsed for the device that is about to consume it.
+bool TakeAbilityPart(cJSON *rootValue, const char *key, std::string &info)
+{
+    cJSON *partValue = cJSON_DetachItemFromObjectCaseSensitive(rootValue, key);
+    if (partValue == nullptr || !cJSON_IsObject(partValue)) {
+        cJSON_Delete(partValue);
+        DHLOGE("Get %{public}s error.", key);
+        return false;
+    }
+    std::shared_ptr<cJSON> part(partValue, [](cJSON *item) { cJSON_Delete(item); });
+    char *jsonStr = cJSON_PrintUnformatted(partValue);
+    if (jsonStr == nullptr) {
+        return false;
+    }
+    info = std::string(jsonStr);
+    cJSON_free(jsonStr);
+    DCameraAbilityCache::GetInstance().Insert(info, part);
+    return true;
+}
 }
 
 OHOS::sptr<DCameraProvider> DCameraProvider::GetInstance()
@@ -50,38 +74,10 @@ bool DCameraProvider::GetAbilityInfo(const std::string& abilityInfo, std::string
     CHECK_NULL_RETURN_LOG(rootValue, false, "The abilityInfo is null.");
     CHECK_OBJECT_FREE_RETURN(rootValue, false, "The abilityInfo is not object.");
 
-    cJSON *sinkRootValue = cJSON_GetObjectItemCaseSensitive(rootValue, "SinkAbility");
-    if (sinkRootValue == nullptr || !cJSON_IsObject(sinkRootValue)) {
-        cJSON_Delete(rootValue);
-        DHLOGE("Get sink ability error.");
-        return false;
-    }
-
-    cJSON *srcRootValue = cJSON_GetObjectItemCaseSensitive(rootValue, "SourceCodec");
-    if (srcRootValue == nullptr || !cJSON_IsObject(srcRootValue)) {
-        cJSON_Delete(rootValue);
-        DHLOGE("Get source ability error.");
-        return false;
-    }
-
-    char *jsonSink = cJSON_Print(sinkRootValue);
-    if (jsonSink == nullptr) {
-        cJSON_Delete(rootValue);
-        return false;
-    }
-    sinkAbilityInfo = std::string(jsonSink);
-
-    char *jsonSource = cJSON_Print(srcRootValue);
-    if (jsonSource == nullptr) {
-        cJSON_Delete(rootValue);
-        cJSON_free(jsonSink);
-        return false;
-    }
-    sourceCodecInfo = std::string(jsonSource);
+    bool ret = TakeAbilityPart(rootValue, "SinkAbility", sinkAbilityInfo) &&
+        TakeAbilityPart(rootValue, "SourceCodec", sourceCodecInfo);
     cJSON_Delete(rootValue);
-    cJSON_free(jsonSink);
-    cJSON_free(jsonSource);
-    return true;
+    return ret;
 }
 
 int32_t DCameraProvider::EnableDCameraDevice(const DHBase& dhBase, const std::string& abilityInfo,
@@ -198,6 +194,95 @@ int32_t DCameraProvider::ShutterBuffer(const DHBase& dhBase, int32_t streamId, c
     return device->ShutterBuffer(streamId, buffer);
 }
 
+int32_t DCameraProvider::AcquireBuffers(const DHBase& dhBase, const std::vector<int32_t>& streamIds,
+    std::vector<DCameraStreamBuffer>& buffers)
+{
+    if (IsDhBaseInfoInvalid(dhBase)) {
+        DHLOGE("DCameraProvider::AcquireBuffers, devId or dhId is invalid.");
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    if (streamIds.empty() || streamIds.size() > STREAM_BUFFERS_MAX_SIZE) {
+        DHLOGE("DCameraProvider::AcquireBuffers, input streamIds size %{public}zu is invalid.", streamIds.size());
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    for (int32_t streamId : streamIds) {
+        if (streamId < 0) {
+            DHLOGE("DCameraProvider::AcquireBuffers, input streamId is invalid.");
+            return DCamRetCode::INVALID_ARGUMENT;
+        }
+    }
+
+    DHLOGD("DCameraProvider::AcquireBuffers for {devId: %{public}s, dhId: %{public}s}, stream size: %{public}zu.",
+        GetAnonyString(dhBase.deviceId_).c_str(), GetAnonyString(dhBase.dhId_).c_str(), streamIds.size());
+    OHOS::sptr<DCameraDevice> device = GetDCameraDevice(dhBase);
+    if (device == nullptr) {
+        DHLOGE("DCameraProvider::AcquireBuffers failed, dcamera device not found.");
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    return device->AcquireBuffers(streamIds, buffers);
+}
+
+int32_t DCameraProvider::ShutterBuffers(const DHBase& dhBase, const std::vector<DCameraStreamBuffer>& buffers)
+{
+    if (IsDhBaseInfoInvalid(dhBase)) {
+        DHLOGE("DCameraProvider::ShutterBuffers, devId or dhId is invalid.");
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    if (buffers.empty() || buffers.size() > STREAM_BUFFERS_MAX_SIZE) {
+        DHLOGE("DCameraProvider::ShutterBuffers, input buffers size %{public}zu is invalid.", buffers.size());
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    for (const auto& streamBuffer : buffers) {
+        if (streamBuffer.streamId_ < 0 || streamBuffer.buffer_.index_ < 0) {
+            DHLOGE("DCameraProvider::ShutterBuffers, input dcamera buffer is invalid.");
+            return DCamRetCode::INVALID_ARGUMENT;
+        }
+    }
+
+    DHLOGD("DCameraProvider::ShutterBuffers for {devId: %{public}s, dhId: %{public}s}, buffer size: %{public}zu.",
+        GetAnonyString(dhBase.deviceId_).c_str(), GetAnonyString(dhBase.dhId_).c_str(), buffers.size());
+    OHOS::sptr<DCameraDevice> device = GetDCameraDevice(dhBase);
+    if (device == nullptr) {
+        DHLOGE("DCameraProvider::ShutterBuffers failed, dcamera device not found.");
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    return device->ShutterBuffers(buffers);
+}
+
+int32_t DCameraProvider::OpenBufferRing(const DHBase& dhBase, int32_t streamId, int& ringFd, int& eventFd)
+{
+    if (IsDhBaseInfoInvalid(dhBase) || streamId < 0) {
+        DHLOGE("DCameraProvider::OpenBufferRing, input param is invalid.");
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+
+    DHLOGI("DCameraProvider::OpenBufferRing for {devId: %{public}s, dhId: %{public}s}, streamId: %{public}d.",
+        GetAnonyString(dhBase.deviceId_).c_str(), GetAnonyString(dhBase.dhId_).c_str(), streamId);
+    OHOS::sptr<DCameraDevice> device = GetDCameraDevice(dhBase);
+    if (device == nullptr) {
+        DHLOGE("DCameraProvider::OpenBufferRing failed, dcamera device not found.");
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    return device->OpenBufferRing(streamId, ringFd, eventFd);
+}
+
+int32_t DCameraProvider::GetRingBuffer(const DHBase& dhBase, int32_t streamId, int32_t index, DCameraBuffer& buffer)
+{
+    if (IsDhBaseInfoInvalid(dhBase) || streamId < 0 || index < 0) {
+        DHLOGE("DCameraProvider::GetRingBuffer, input param is invalid.");
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+
+    DHLOGD("DCameraProvider::GetRingBuffer for {devId: %{public}s, dhId: %{public}s}, streamId: %{public}d.",
+        GetAnonyString(dhBase.deviceId_).c_str(), GetAnonyString(dhBase.dhId_).c_str(), streamId);
+    OHOS::sptr<DCameraDevice> device = GetDCameraDevice(dhBase);
+    if (device == nullptr) {
+        DHLOGE("DCameraProvider::GetRingBuffer failed, dcamera device not found.");
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    return device->GetRingBuffer(streamId, index, buffer);
+}
+
 int32_t DCameraProvider::OnSettingsResult(const DHBase& dhBase, const DCameraSettings& result)
 {
     if (IsDhBaseInfoInvalid(dhBase)) {
@@ -223,6 +308,33 @@ int32_t DCameraProvider::OnSettingsResult(const DHBase& dhBase, const DCameraSet
     return device->OnSettingsResult(dCameraResult);
 }
 
+int32_t DCameraProvider::OnSettingsResults(const DHBase& dhBase, const std::vector<DCameraSettingsResult>& results)
+{
+    if (IsDhBaseInfoInvalid(dhBase)) {
+        DHLOGE("DCameraProvider::OnSettingsResults, devId or dhId is invalid.");
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    if (results.empty() || results.size() > SETTINGS_RESULTS_MAX_SIZE) {
+        DHLOGE("DCameraProvider::OnSettingsResults, input results size %{public}zu is invalid.", results.size());
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    for (const auto &result : results) {
+        if (result.value_.empty() || result.value_.size() > SETTING_VALUE_MAX_LENGTH) {
+            DHLOGE("DCameraProvider::OnSettingsResults, result %{public}u has an invalid value.", result.sequence_);
+            return DCamRetCode::INVALID_ARGUMENT;
+        }
+    }
+    DHLOGD("DCameraProvider::OnSettingsResults for {devId: %{public}s, dhId: %{public}s}, size: %{public}zu.",
+        GetAnonyString(dhBase.deviceId_).c_str(), GetAnonyString(dhBase.dhId_).c_str(), results.size());
+
+    OHOS::sptr<DCameraDevice> device = GetDCameraDevice(dhBase);
+    if (device == nullptr) {
+        DHLOGE("DCameraProvider::OnSettingsResults failed, dcamera device not found.");
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    return device->OnSettingsResults(results);
+}
+
 int32_t DCameraProvider::Notify(const DHBase& dhBase, const DCameraHDFEvent& event)
 {
     if (IsDhBaseInfoInvalid(dhBase)) {
@@ -257,6 +369,16 @@ int32_t DCameraProvider::Notify(const DHBase& dhBase, const DCameraHDFEvent& eve
     return device->Notify(dCameraEvent);
 }
 
+int32_t DCameraProvider::NotifyAsync(const DHBase& dhBase, const DCameraHDFEvent& event)
+{
+    int32_t ret = Notify(dhBase, event);
+    if (ret != DCamRetCode::SUCCESS) {
+        DHLOGE("DCameraProvider::NotifyAsync failed, ret: %{public}d, type: %{public}d, result: %{public}d.",
+            ret, event.type_, event.result_);
+    }
+    return ret;
+}
+
 int32_t DCameraProvider::RegisterCameraHdfListener(const std::string &serviceName,
     const sptr<IDCameraHdfCallback> &callbackObj)
 {
@@ -19,45 +19,90 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+DBufferManager::DBufferManager()
+{
+    freeSlots_.reserve(BUFFER_QUEUE_SIZE);
+    // Hand out the lowest slot first.
+    for (int32_t index = static_cast<int32_t>(BUFFER_QUEUE_SIZE) - 1; index >= 0; index--) {
+        freeSlots_.push_back(index);
+    }
+}
+
 std::shared_ptr<DImageBuffer> DBufferManager::AcquireBuffer()
 {
     std::unique_lock<std::mutex> l(lock_);
 
-    if (!idleList_.empty()) {
-        auto it = idleList_.begin();
-        busyList_.splice(busyList_.begin(), idleList_, it);
-        DHLOGD("Acquire buffer success, index = %{public}d", (*it)->GetIndex());
-        return *it;
+    if (idleCount_ == 0) {
+        return nullptr;
     }
-    return nullptr;
+    int32_t index = idleSlots_[idleHead_];
+    idleHead_ = (idleHead_ + 1) % BUFFER_QUEUE_SIZE;
+    idleCount_--;
+    BufferSlot &slot = slots_[index];
+    slot.state = SlotState::BUSY;
+    DHLOGD("Acquire buffer success, index = %{public}d", index);
+    return slot.buffer;
 }
 
 RetCode DBufferManager::AddBuffer(std::shared_ptr<DImageBuffer>& buffer)
 {
+    CHECK_AND_RETURN_RET_LOG(buffer == nullptr, RC_ERROR, "buffer is nullptr");
     std::unique_lock<std::mutex> l(lock_);
-    if (idleList_.size() + busyList_.size() >= BUFFER_QUEUE_SIZE) {
+    if (freeSlots_.empty()) {
         DHLOGI("Buffer list is full, cannot add buffer.");
         return RC_ERROR;
     }
-    idleList_.emplace_back(buffer);
+    int32_t index = freeSlots_.back();
+    freeSlots_.pop_back();
+    slots_[index].buffer = buffer;
+    slots_[index].state = SlotState::IDLE;
+    buffer->SetIndex(index);
+    idleSlots_[(idleHead_ + idleCount_) % BUFFER_QUEUE_SIZE] = index;
+    idleCount_++;
 
     return RC_OK;
 }
 
 RetCode DBufferManager::RemoveBuffer(std::shared_ptr<DImageBuffer>& buffer)
 {
+    CHECK_AND_RETURN_RET_LOG(buffer == nullptr, RC_ERROR, "buffer is nullptr");
     std::unique_lock<std::mutex> l(lock_);
 
-    auto it = std::find(busyList_.begin(), busyList_.end(), buffer);
-    if (it == busyList_.end()) {
-        DHLOGE("Busy list is empty, cannot remove buffer.");
+    int32_t index = buffer->GetIndex();
+    if (!IsBusySlot(index) || slots_[index].buffer != buffer) {
+        DHLOGE("Buffer is not busy, cannot remove buffer, index = %{public}d.", index);
         return RC_ERROR;
     }
-    busyList_.erase(it);
+    slots_[index].buffer = nullptr;
+    slots_[index].state = SlotState::FREE;
+    freeSlots_.push_back(index);
 
     return RC_OK;
 }
 
+std::shared_ptr<DImageBuffer> DBufferManager::GetBusyBuffer(int32_t index)
+{
+    std::unique_lock<std::mutex> l(lock_);
+    return IsBusySlot(index) ? slots_[index].buffer : nullptr;
+}
+
+uint32_t DBufferManager::GetIdleCount()
+{
+    std::unique_lock<std::mutex> l(lock_);
+    return idleCount_;
+}
+
+uint32_t DBufferManager::GetFreeCount()
+{
+    std::unique_lock<std::mutex> l(lock_);
+    return static_cast<uint32_t>(freeSlots_.size());
+}
+
+bool DBufferManager::IsBusySlot(int32_t index) const
+{
+    return index >= 0 && index < static_cast<int32_t>(BUFFER_QUEUE_SIZE) && slots_[index].state == SlotState::BUSY;
+}
+
 void DBufferManager::NotifyStop(bool state)
 {
     streamStop_ = state;
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbuffer_ring.h"
+
+#include <algorithm>
+#include <new>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "ashmem.h"
+#include "dcamera.h"
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+DBufferRing::DBufferRing(int32_t streamId, const AcquireFunc &acquireFunc, const ReturnFunc &returnFunc)
+    : streamId_(streamId), acquireFunc_(acquireFunc), returnFunc_(returnFunc)
+{
+}
+
+DBufferRing::~DBufferRing()
+{
+    Release();
+}
+
+DCamRetCode DBufferRing::Init()
+{
+    std::string name = "dcamera_ring_" + std::to_string(streamId_);
+    ringFd_ = AshmemCreate(name.c_str(), sizeof(DBufferRingLayout));
+    if (ringFd_ < 0) {
+        DHLOGE("Create buffer ring memory failed, streamId: %{public}d", streamId_);
+        return DCamRetCode::FAILED;
+    }
+    eventFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    void *addr = mmap(nullptr, sizeof(DBufferRingLayout), PROT_READ | PROT_WRITE, MAP_SHARED, ringFd_, 0);
+    if (eventFd_ < 0 || addr == MAP_FAILED) {
+        DHLOGE("Map buffer ring failed, streamId: %{public}d", streamId_);
+        if (addr != MAP_FAILED) {
+            munmap(addr, sizeof(DBufferRingLayout));
+        }
+        Release();
+        return DCamRetCode::FAILED;
+    }
+    layout_ = new (addr) DBufferRingLayout();
+    layout_->magic = DBUFFER_RING_MAGIC;
+    layout_->version = DBUFFER_RING_VERSION;
+    layout_->freeQueue.head.store(0);
+    layout_->freeQueue.tail.store(0);
+    layout_->filledQueue.head.store(0);
+    layout_->filledQueue.tail.store(0);
+
+    isRunning_.store(true);
+    ringThread_ = std::thread([this]() { this->RingLoop(); });
+    DHLOGI("Open buffer ring success, streamId: %{public}d", streamId_);
+    return DCamRetCode::SUCCESS;
+}
+
+void DBufferRing::Release()
+{
+    isRunning_.store(false);
+    if (ringThread_.joinable()) {
+        uint64_t value = 1;
+        (void)write(eventFd_, &value, sizeof(value));
+        ringThread_.join();
+    }
+    if (layout_ != nullptr) {
+        DisableRefill();
+        DrainFilled();
+        munmap(layout_, sizeof(DBufferRingLayout));
+        layout_ = nullptr;
+    }
+    if (eventFd_ >= 0) {
+        close(eventFd_);
+        eventFd_ = -1;
+    }
+    if (ringFd_ >= 0) {
+        close(ringFd_);
+        ringFd_ = -1;
+    }
+}
+
+void DBufferRing::EnableRefill()
+{
+    {
+        std::lock_guard<std::mutex> lock(refillMutex_);
+        isRefillEnabled_ = true;
+    }
+    uint64_t value = 1;
+    (void)write(eventFd_, &value, sizeof(value));
+}
+
+void DBufferRing::DisableRefill()
+{
+    std::lock_guard<std::mutex> lock(refillMutex_);
+    isRefillEnabled_ = false;
+    ReclaimFree();
+}
+
+int32_t DBufferRing::GetRingFd() const
+{
+    return ringFd_;
+}
+
+int32_t DBufferRing::GetEventFd() const
+{
+    return eventFd_;
+}
+
+void DBufferRing::RingLoop()
+{
+    DHLOGI("Buffer ring loop start, streamId: %{public}d", streamId_);
+    SetRingThreadPriority();
+    while (isRunning_.load()) {
+        DrainFilled();
+        Refill();
+        uint32_t queued = layout_->freeQueue.tail.load() - layout_->freeQueue.head.load();
+        bool isRefilling = false;
+        {
+            std::lock_guard<std::mutex> lock(refillMutex_);
+            isRefilling = isRefillEnabled_;
+        }
+        // Retry soon while the stream has no idle buffer for the source, otherwise sleep until woken.
+        WaitEvent((isRefilling && queued < DBUFFER_RING_CAPACITY) ? RING_REFILL_RETRY_MS : RING_IDLE_WAIT_MS);
+    }
+    DHLOGI("Buffer ring loop end, streamId: %{public}d", streamId_);
+}
+
+void DBufferRing::DrainFilled()
+{
+    DBufferRingEntry entry;
+    while (PopFilled(entry)) {
+        ReturnEntry(entry);
+    }
+}
+
+void DBufferRing::Refill()
+{
+    std::lock_guard<std::mutex> lock(refillMutex_);
+    DBufferRingQueue &queue = layout_->freeQueue;
+    while (isRefillEnabled_) {
+        uint32_t tail = queue.tail.load(std::memory_order_relaxed);
+        if (tail - queue.head.load(std::memory_order_acquire) >= DBUFFER_RING_CAPACITY) {
+            return;
+        }
+        DCameraBuffer buffer;
+        uint32_t seqNum = 0;
+        if (acquireFunc_ == nullptr || acquireFunc_(buffer, seqNum) != DCamRetCode::SUCCESS) {
+            return;
+        }
+        DBufferRingEntry &entry = queue.entries[tail % DBUFFER_RING_CAPACITY];
+        entry.index = buffer.index_;
+        entry.size = buffer.size_;
+        entry.seqNum = seqNum;
+        entry.captureTimeUs = 0;
+        queue.tail.store(tail + 1, std::memory_order_release);
+    }
+}
+
+void DBufferRing::ReclaimFree()
+{
+    if (layout_ == nullptr) {
+        return;
+    }
+    DBufferRingEntry entry;
+    while (PopFree(entry)) {
+        entry.size = 0;
+        ReturnEntry(entry);
+    }
+}
+
+bool DBufferRing::PopFree(DBufferRingEntry &entry)
+{
+    // The source takes from this queue as well, the slot is read before the head is claimed.
+    DBufferRingQueue &queue = layout_->freeQueue;
+    uint32_t head = queue.head.load(std::memory_order_acquire);
+    while (head != queue.tail.load(std::memory_order_acquire)) {
+        entry = queue.entries[head % DBUFFER_RING_CAPACITY];
+        if (queue.head.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DBufferRing::PopFilled(DBufferRingEntry &entry)
+{
+    DBufferRingQueue &queue = layout_->filledQueue;
+    uint32_t head = queue.head.load(std::memory_order_relaxed);
+    uint32_t tail = queue.tail.load(std::memory_order_acquire);
+    if (head == tail) {
+        return false;
+    }
+    // The source is not trusted to keep the queue sane, a bogus tail drops everything it claims to hold.
+    if (tail - head > DBUFFER_RING_CAPACITY) {
+        DHLOGE("Buffer ring filled queue corrupted, streamId: %{public}d", streamId_);
+        queue.head.store(tail, std::memory_order_release);
+        return false;
+    }
+    entry = queue.entries[head % DBUFFER_RING_CAPACITY];
+    queue.head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+void DBufferRing::ReturnEntry(const DBufferRingEntry &entry)
+{
+    if (returnFunc_ == nullptr) {
+        return;
+    }
+    DCameraBuffer buffer;
+    buffer.index_ = entry.index;
+    buffer.size_ = entry.size;
+    buffer.bufferHandle_ = nullptr;
+    DCamRetCode ret = returnFunc_(buffer, entry.captureTimeUs);
+    if (ret != DCamRetCode::SUCCESS) {
+        DHLOGE("Return ring buffer failed, streamId: %{public}d index: %{public}d ret: %{public}d", streamId_,
+            entry.index, ret);
+    }
+}
+
+void DBufferRing::WaitEvent(int32_t timeoutMs)
+{
+    struct pollfd fds = { eventFd_, POLLIN, 0 };
+    if (poll(&fds, 1, timeoutMs) > 0) {
+        uint64_t value = 0;
+        (void)read(eventFd_, &value, sizeof(value));
+    }
+}
+
+void DBufferRing::SetRingThreadPriority()
+{
+    int32_t policy = SCHED_OTHER;
+    if (!GetSysPara(RT_POLICY_PARA, policy) || (policy != SCHED_FIFO && policy != SCHED_RR)) {
+        return;
+    }
+    int32_t priority = sched_get_priority_min(policy);
+    GetSysPara(RT_PRIORITY_PARA, priority);
+    struct sched_param param = {};
+    param.sched_priority = std::min(std::max(priority, sched_get_priority_min(policy)),
+        sched_get_priority_max(policy));
+    int32_t ret = pthread_setschedparam(pthread_self(), policy, &param);
+    if (ret != 0) {
+        DHLOGE("Set ring thread policy %{public}d priority %{public}d failed, ret %{public}d, streamId: %{public}d",
+            policy, param.sched_priority, ret, streamId_);
+        return;
+    }
+    DHLOGI("Ring thread runs with policy %{public}d priority %{public}d, streamId: %{public}d", policy,
+        param.sched_priority, streamId_);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
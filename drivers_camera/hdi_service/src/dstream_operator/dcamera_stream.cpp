@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,8 @@
 
 #include "dcamera_stream.h"
 
+#include <algorithm>
+
 #include "constants.h"
 #include "dcamera.h"
 #include "distributed_hardware_log.h"
@@ -22,6 +24,11 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+DCameraStream::~DCameraStream()
+{
+    StopPrefetch();
+}
+
 DCamRetCode DCameraStream::InitDCameraStream(const StreamInfo &info)
 {
     if ((info.streamId_ < 0) || (info.width_ < 0) || (info.height_ < 0) ||
@@ -83,6 +90,8 @@ DCamRetCode DCameraStream::InitDCameraBufferManager()
     DCamRetCode ret = DCamRetCode::SUCCESS;
     if (!isBufferMgrInited_) {
         ret = FinishCommitStream();
+    } else {
+        StartPrefetch();
     }
     return ret;
 }
@@ -115,6 +124,7 @@ DCamRetCode DCameraStream::SetDCameraBufferQueue(const OHOS::sptr<BufferProducer
 
 DCamRetCode DCameraStream::ReleaseDCameraBufferQueue()
 {
+    StopPrefetch();
     DCamRetCode ret = CancelDCameraBuffer();
     if (ret != DCamRetCode::SUCCESS) {
         DHLOGE("Release distributed camera buffer queue failed.");
@@ -154,9 +164,18 @@ DCamRetCode DCameraStream::FinishCommitStream()
     dcStreamProducer_->SetQueueSize(BUFFER_QUEUE_SIZE);
     isBufferMgrInited_ = true;
 
-    for (uint32_t i = 0; i < BUFFER_QUEUE_SIZE; i++) {
+    int32_t prefetchCount = static_cast<int32_t>(DEFAULT_BUFFER_PREFETCH_COUNT);
+    if (!GetSysPara(BUFFER_PREFETCH_PARA, prefetchCount) || prefetchCount < 0) {
+        prefetchCount = static_cast<int32_t>(DEFAULT_BUFFER_PREFETCH_COUNT);
+    }
+    prefetchCount_ = std::min(static_cast<uint32_t>(prefetchCount), BUFFER_QUEUE_SIZE);
+    DHLOGI("Stream [%{public}d] prefetch buffer count %{public}u.", dcStreamId_, prefetchCount_);
+
+    uint32_t requestCount = (prefetchCount_ == 0) ? BUFFER_QUEUE_SIZE : prefetchCount_;
+    for (uint32_t i = 0; i < requestCount; i++) {
         GetNextRequest();
     }
+    StartPrefetch();
     return DCamRetCode::SUCCESS;
 }
 
@@ -186,6 +205,16 @@ DCamRetCode DCameraStream::GetNextRequest()
 
     OHOS::sptr<OHOS::SurfaceBuffer> surfaceBuffer = nullptr;
     OHOS::sptr<OHOS::SyncFence> syncFence = nullptr;
+    DCamRetCode ret = RequestSurfaceBuffer(surfaceBuffer, syncFence, 0);
+    if (ret != DCamRetCode::SUCCESS) {
+        return ret;
+    }
+    return SurfaceBufferToDImageBuffer(surfaceBuffer, syncFence);
+}
+
+DCamRetCode DCameraStream::RequestSurfaceBuffer(OHOS::sptr<OHOS::SurfaceBuffer> &surfaceBuffer,
+    OHOS::sptr<OHOS::SyncFence> &syncFence, int32_t timeoutMs)
+{
     int32_t usage = BUFFER_USAGE_CPU_READ | BUFFER_USAGE_CPU_WRITE | BUFFER_USAGE_MEM_DMA;
     CHECK_AND_RETURN_RET_LOG(dcStreamInfo_ == nullptr, DCamRetCode::INVALID_ARGUMENT, "dcStreamInfo_ is nullptr");
     OHOS::BufferRequestConfig config = {
@@ -194,7 +223,7 @@ DCamRetCode DCameraStream::GetNextRequest()
         .strideAlignment = 8,
         .format = dcStreamInfo_->format_,
         .usage = usage,
-        .timeout = 0
+        .timeout = timeoutMs
     };
 
     if (dcStreamInfo_->intent_ == StreamIntent::STILL_CAPTURE) {
@@ -216,7 +245,7 @@ DCamRetCode DCameraStream::GetNextRequest()
             dcStreamInfo_->streamId_, surfaceError);
         return DCamRetCode::EXCEED_MAX_NUMBER;
     }
-    return SurfaceBufferToDImageBuffer(surfaceBuffer, syncFence);
+    return DCamRetCode::SUCCESS;
 }
 
 DCamRetCode DCameraStream::SurfaceBufferToDImageBuffer(OHOS::sptr<OHOS::SurfaceBuffer> &surfaceBuffer,
@@ -238,8 +267,10 @@ DCamRetCode DCameraStream::SurfaceBufferToDImageBuffer(OHOS::sptr<OHOS::SurfaceB
         dcStreamProducer_->CancelBuffer(surfaceBuffer);
         return DCamRetCode::EXCEED_MAX_NUMBER;
     }
-    imageBuffer->SetIndex(++index_);
-    imageBuffer->SetSyncFence(syncFence);
+    // A signaled fence is dropped here so taking the buffer later costs no wait.
+    if (IsFencePending(syncFence)) {
+        imageBuffer->SetSyncFence(syncFence);
+    }
     if (dcStreamBufferMgr_ == nullptr) {
         DHLOGE("dcStreamBufferMgr_ is nullptr.");
         dcStreamProducer_->CancelBuffer(surfaceBuffer);
@@ -253,12 +284,7 @@ DCamRetCode DCameraStream::SurfaceBufferToDImageBuffer(OHOS::sptr<OHOS::SurfaceB
     }
     DHLOGD("Add new image buffer success: index = %{public}d, fenceFd = %{public}d", imageBuffer->GetIndex(),
         syncFence->Get());
-    auto itr = bufferConfigMap_.find(imageBuffer);
-    if (itr == bufferConfigMap_.end()) {
-        int32_t usage = BUFFER_USAGE_CPU_READ | BUFFER_USAGE_CPU_WRITE | BUFFER_USAGE_MEM_DMA;
-        auto bufferCfg = std::make_tuple(surfaceBuffer, usage);
-        bufferConfigMap_.insert(std::make_pair(imageBuffer, bufferCfg));
-    }
+    surfaceBuffers_[imageBuffer->GetIndex()] = surfaceBuffer;
     return DCamRetCode::SUCCESS;
 }
 
@@ -269,33 +295,44 @@ DCamRetCode DCameraStream::GetDCameraBuffer(DCameraBuffer &buffer)
         DHLOGE("Buffer has already canceled.");
         return DCamRetCode::FAILED;
     }
+    OHOS::sptr<OHOS::SyncFence> syncFence = nullptr;
     {
         std::lock_guard<std::mutex> lockBuffer(bufferQueueMutex_);
-        DCamRetCode retCode = GetNextRequest();
-        if (retCode != DCamRetCode::SUCCESS && retCode != DCamRetCode::EXCEED_MAX_NUMBER) {
-            DHLOGE("Get next request failed.");
-            return retCode;
+        std::shared_ptr<DImageBuffer> imageBuffer = nullptr;
+        if (prefetchCount_ > 0 && dcStreamBufferMgr_ != nullptr) {
+            imageBuffer = dcStreamBufferMgr_->AcquireBuffer();
         }
-
-        if (dcStreamBufferMgr_ == nullptr) {
-            DHLOGE("dcStreamBufferMgr_ is nullptr");
-            return DCamRetCode::FAILED;
+        if (imageBuffer == nullptr) {
+            // Nothing prefetched, request on the frame path.
+            DCamRetCode retCode = GetNextRequest();
+            if (retCode != DCamRetCode::SUCCESS && retCode != DCamRetCode::EXCEED_MAX_NUMBER) {
+                DHLOGE("Get next request failed.");
+                return retCode;
+            }
+            if (dcStreamBufferMgr_ == nullptr) {
+                DHLOGE("dcStreamBufferMgr_ is nullptr");
+                return DCamRetCode::FAILED;
+            }
+            imageBuffer = dcStreamBufferMgr_->AcquireBuffer();
         }
-        std::shared_ptr<DImageBuffer> imageBuffer = dcStreamBufferMgr_->AcquireBuffer();
+        TriggerPrefetch();
         if (imageBuffer == nullptr) {
             DHLOGE("Cannot get idle buffer.");
             return DCamRetCode::EXCEED_MAX_NUMBER;
         }
-        auto syncFence = imageBuffer->GetSyncFence();
-        if (syncFence != nullptr) {
-            syncFence->Wait(BUFFER_SYNC_FENCE_TIMEOUT);
-        }
+        syncFence = imageBuffer->GetSyncFence();
+        imageBuffer->SetSyncFence(nullptr);
         RetCode ret = DBufferManager::DImageBufferToDCameraBuffer(imageBuffer, buffer);
         if (ret != RC_OK) {
             DHLOGE("Convert image buffer to distributed camera buffer failed.");
             return DCamRetCode::FAILED;
         }
     }
+    // Only buffers requested on the frame path can still carry a pending fence, the wait leaves the queue lock
+    // free for the prefetch thread and for flushes of other buffers.
+    if (syncFence != nullptr && syncFence->Wait(BUFFER_SYNC_FENCE_TIMEOUT) != 0) {
+        DHLOGW("Wait acquire fence timeout, index = %{public}d", buffer.index_);
+    }
 
     {
         std::lock_guard<std::mutex> lockSync(lockSync_);
@@ -305,35 +342,31 @@ DCamRetCode DCameraStream::GetDCameraBuffer(DCameraBuffer &buffer)
     return DCamRetCode::SUCCESS;
 }
 
-DCamRetCode DCameraStream::FlushDCameraBuffer(const DCameraBuffer &buffer)
+DCamRetCode DCameraStream::FlushDCameraBuffer(const DCameraBuffer &buffer, int64_t captureAgeUs)
 {
     std::lock_guard<std::mutex> lockBuffer(bufferQueueMutex_);
-    shared_ptr<DImageBuffer> imageBuffer = nullptr;
-    for (auto iter = bufferConfigMap_.begin(); iter != bufferConfigMap_.end(); ++iter) {
-        if (buffer.index_ == iter->first->GetIndex()) {
-            imageBuffer = iter->first;
-            break;
-        }
-    }
-    if (imageBuffer == nullptr) {
+    if (buffer.index_ < 0 || buffer.index_ >= static_cast<int32_t>(surfaceBuffers_.size()) ||
+        surfaceBuffers_[buffer.index_] == nullptr) {
         DHLOGE("Cannot found image buffer, buffer index = %{public}d.", buffer.index_);
         return DCamRetCode::INVALID_ARGUMENT;
     }
 
+    OHOS::sptr<OHOS::SyncFence> releaseFence = nullptr;
     if (dcStreamBufferMgr_ != nullptr) {
+        shared_ptr<DImageBuffer> imageBuffer = dcStreamBufferMgr_->GetBusyBuffer(buffer.index_);
+        if (imageBuffer == nullptr) {
+            DHLOGE("Buffer has not been acquired, buffer index = %{public}d.", buffer.index_);
+            return DCamRetCode::INVALID_ARGUMENT;
+        }
+        releaseFence = imageBuffer->GetReleaseFence();
         RetCode ret = dcStreamBufferMgr_->RemoveBuffer(imageBuffer);
         if (ret != RC_OK) {
             DHLOGE("Buffer manager remove buffer failed: %{public}d", ret);
         }
     }
 
-    auto bufCfg = bufferConfigMap_.find(imageBuffer);
-    if (bufCfg == bufferConfigMap_.end()) {
-        DHLOGE("Cannot get bufferConfig.");
-        return DCamRetCode::INVALID_ARGUMENT;
-    }
-    auto surfaceBuffer = std::get<0>(bufCfg->second);
-    int64_t timeStamp = static_cast<int64_t>(GetVideoTimeStamp());
+    auto surfaceBuffer = surfaceBuffers_[buffer.index_];
+    int64_t timeStamp = static_cast<int64_t>(GetVideoTimeStamp()) - captureAgeUs * USEC_TO_NSEC_TIMES;
     if (dcStreamInfo_ == nullptr) {
         DHLOGE("dcStreamInfo_ or dcStreamProducer_ is nullptr.");
         return DCamRetCode::INVALID_ARGUMENT;
@@ -343,20 +376,24 @@ DCamRetCode DCameraStream::FlushDCameraBuffer(const DCameraBuffer &buffer)
         .timestamp = timeStamp
     };
     if (dcStreamProducer_ != nullptr) {
-        SetSurfaceBuffer(surfaceBuffer, buffer);
-        OHOS::sptr<OHOS::SyncFence> autoFence(new(std::nothrow) OHOS::SyncFence(-1));
-        int ret = dcStreamProducer_->FlushBuffer(surfaceBuffer, autoFence, flushConf);
+        SetSurfaceBuffer(surfaceBuffer, buffer, captureAgeUs);
+        // Without a release fence the content was written by the CPU and is complete already.
+        if (releaseFence == nullptr) {
+            releaseFence = new(std::nothrow) OHOS::SyncFence(-1);
+        }
+        int ret = dcStreamProducer_->FlushBuffer(surfaceBuffer, releaseFence, flushConf);
         if (ret != 0) {
             DHLOGI("FlushBuffer error: %{public}d", ret);
         }
     }
-    bufferConfigMap_.erase(bufCfg);
+    surfaceBuffers_[buffer.index_] = nullptr;
+    TriggerPrefetch();
     return DCamRetCode::SUCCESS;
 }
 
-DCamRetCode DCameraStream::ReturnDCameraBuffer(const DCameraBuffer &buffer)
+DCamRetCode DCameraStream::ReturnDCameraBuffer(const DCameraBuffer &buffer, int64_t captureAgeUs)
 {
-    DCamRetCode ret = FlushDCameraBuffer(buffer);
+    DCamRetCode ret = FlushDCameraBuffer(buffer, captureAgeUs);
     if (ret != DCamRetCode::SUCCESS) {
         DHLOGE("Flush Buffer failed, ret: %{public}d", ret);
         return ret;
@@ -370,7 +407,45 @@ DCamRetCode DCameraStream::ReturnDCameraBuffer(const DCameraBuffer &buffer)
     return DCamRetCode::SUCCESS;
 }
 
-void DCameraStream::SetSurfaceBuffer(OHOS::sptr<OHOS::SurfaceBuffer>& surfaceBuffer, const DCameraBuffer &buffer)
+DCamRetCode DCameraStream::GetBusyDCameraBuffer(int32_t index, DCameraBuffer &buffer)
+{
+    std::lock_guard<std::mutex> lockBuffer(bufferQueueMutex_);
+    if (dcStreamBufferMgr_ == nullptr) {
+        DHLOGE("dcStreamBufferMgr_ is nullptr");
+        return DCamRetCode::FAILED;
+    }
+    std::shared_ptr<DImageBuffer> imageBuffer = dcStreamBufferMgr_->GetBusyBuffer(index);
+    if (imageBuffer == nullptr) {
+        DHLOGE("Buffer has not been acquired, buffer index = %{public}d.", index);
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    RetCode ret = DBufferManager::DImageBufferToDCameraBuffer(imageBuffer, buffer);
+    if (ret != RC_OK) {
+        DHLOGE("Convert image buffer to distributed camera buffer failed.");
+        return DCamRetCode::FAILED;
+    }
+    return DCamRetCode::SUCCESS;
+}
+
+bool DCameraStream::GetBufferSeqNum(int32_t index, uint32_t &seqNum)
+{
+    std::lock_guard<std::mutex> lockBuffer(bufferQueueMutex_);
+    if (index < 0 || index >= static_cast<int32_t>(surfaceBuffers_.size()) || surfaceBuffers_[index] == nullptr) {
+        return false;
+    }
+    seqNum = surfaceBuffers_[index]->GetSeqNum();
+    return true;
+}
+
+bool DCameraStream::HasIdleBuffer()
+{
+    std::lock_guard<std::mutex> lockBuffer(bufferQueueMutex_);
+    // Without prefetch only a request to the surface can tell.
+    return prefetchCount_ == 0 || (dcStreamBufferMgr_ != nullptr && dcStreamBufferMgr_->GetIdleCount() > 0);
+}
+
+void DCameraStream::SetSurfaceBuffer(OHOS::sptr<OHOS::SurfaceBuffer>& surfaceBuffer, const DCameraBuffer &buffer,
+    int64_t captureAgeUs)
 {
     if (dcStreamInfo_ == nullptr || surfaceBuffer == nullptr) {
         DHLOGE("dcStreamInfo_ or surfaceBuffer is nullptr.");
@@ -379,13 +454,13 @@ void DCameraStream::SetSurfaceBuffer(OHOS::sptr<OHOS::SurfaceBuffer>& surfaceBuf
 
     if (dcStreamInfo_->intent_ == StreamIntent::VIDEO) {
         int32_t size = (dcStreamInfo_->width_) * (dcStreamInfo_->height_) * YUV_WIDTH_RATIO / YUV_HEIGHT_RATIO;
-        int64_t timeStamp = static_cast<int64_t>(GetVideoTimeStamp());
+        int64_t timeStamp = static_cast<int64_t>(GetVideoTimeStamp()) - captureAgeUs * USEC_TO_NSEC_TIMES;
         surfaceBuffer->GetExtraData()->ExtraSet("dataSize", size);
         surfaceBuffer->GetExtraData()->ExtraSet("isKeyFrame", (int32_t)0);
         surfaceBuffer->GetExtraData()->ExtraSet("timeStamp", timeStamp);
     } else if (dcStreamInfo_->intent_ == StreamIntent::STILL_CAPTURE) {
         int32_t size = buffer.size_;
-        int64_t timeStamp = static_cast<int64_t>(GetCurrentLocalTimeStamp());
+        int64_t timeStamp = static_cast<int64_t>(GetCaptureLocalTimeStamp(captureAgeUs));
         surfaceBuffer->GetExtraData()->ExtraSet("dataSize", size);
         surfaceBuffer->GetExtraData()->ExtraSet("isKeyFrame", (int32_t)0);
         surfaceBuffer->GetExtraData()->ExtraSet("timeStamp", timeStamp);
@@ -461,22 +536,21 @@ DCamRetCode DCameraStream::CancelDCameraBuffer()
         std::lock_guard<std::mutex> lockBuffer(bufferQueueMutex_);
         while (true) {
             std::shared_ptr<DImageBuffer> imageBuffer = dcStreamBufferMgr_->AcquireBuffer();
-            if (imageBuffer != nullptr) {
-                auto bufCfg = bufferConfigMap_.find(imageBuffer);
-                if (bufCfg == bufferConfigMap_.end()) {
-                    DHLOGE("Buffer not in map.");
-                    return DCamRetCode::INVALID_ARGUMENT;
-                }
-                auto surfaceBuffer = std::get<0>(bufCfg->second);
-                if (dcStreamProducer_ != nullptr) {
-                    dcStreamProducer_->CancelBuffer(surfaceBuffer);
-                }
-                bufferConfigMap_.erase(bufCfg);
-            } else {
+            if (imageBuffer == nullptr) {
                 break;
             }
+            int32_t index = imageBuffer->GetIndex();
+            if (index < 0 || index >= static_cast<int32_t>(surfaceBuffers_.size()) ||
+                surfaceBuffers_[index] == nullptr) {
+                DHLOGE("Buffer not in slot, index = %{public}d.", index);
+                return DCamRetCode::INVALID_ARGUMENT;
+            }
+            if (dcStreamProducer_ != nullptr) {
+                dcStreamProducer_->CancelBuffer(surfaceBuffers_[index]);
+            }
+            surfaceBuffers_[index] = nullptr;
+            (void)dcStreamBufferMgr_->RemoveBuffer(imageBuffer);
         }
-        index_ = -1;
     }
     captureBufferCount_ = 0;
     isCancelBuffer_ = true;
@@ -484,6 +558,98 @@ DCamRetCode DCameraStream::CancelDCameraBuffer()
     return DCamRetCode::SUCCESS;
 }
 
+void DCameraStream::StartPrefetch()
+{
+    std::lock_guard<std::mutex> lockPrefetch(prefetchMutex_);
+    if (prefetchCount_ == 0 || isPrefetchRunning_) {
+        return;
+    }
+    isPrefetchRunning_ = true;
+    isPrefetchPending_ = true;
+    prefetchThread_ = std::thread([this]() { PrefetchLoop(); });
+}
+
+void DCameraStream::StopPrefetch()
+{
+    {
+        std::lock_guard<std::mutex> lockPrefetch(prefetchMutex_);
+        isPrefetchRunning_ = false;
+    }
+    prefetchCv_.notify_all();
+    if (prefetchThread_.joinable()) {
+        prefetchThread_.join();
+    }
+}
+
+void DCameraStream::TriggerPrefetch()
+{
+    {
+        std::lock_guard<std::mutex> lockPrefetch(prefetchMutex_);
+        if (!isPrefetchRunning_) {
+            return;
+        }
+        isPrefetchPending_ = true;
+    }
+    prefetchCv_.notify_one();
+}
+
+void DCameraStream::PrefetchLoop()
+{
+    DHLOGI("Prefetch thread start, streamId %{public}d", dcStreamId_);
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lockPrefetch(prefetchMutex_);
+            prefetchCv_.wait(lockPrefetch, [this] { return !isPrefetchRunning_ || isPrefetchPending_; });
+            if (!isPrefetchRunning_) {
+                break;
+            }
+            isPrefetchPending_ = false;
+        }
+        FillPrefetchBuffers();
+    }
+    DHLOGI("Prefetch thread exit, streamId %{public}d", dcStreamId_);
+}
+
+void DCameraStream::FillPrefetchBuffers()
+{
+    // The producer is only replaced while this thread is stopped, so the request itself runs unlocked and may
+    // wait for the consumer to release a buffer without holding up GetDCameraBuffer.
+    while (NeedPrefetch()) {
+        OHOS::sptr<OHOS::SurfaceBuffer> surfaceBuffer = nullptr;
+        OHOS::sptr<OHOS::SyncFence> syncFence = nullptr;
+        if (RequestSurfaceBuffer(surfaceBuffer, syncFence, BUFFER_PREFETCH_TIMEOUT_MS) != DCamRetCode::SUCCESS) {
+            return;
+        }
+        if (IsFencePending(syncFence) && syncFence->Wait(BUFFER_SYNC_FENCE_TIMEOUT) != 0) {
+            DHLOGW("Wait prefetch acquire fence timeout, streamId %{public}d", dcStreamId_);
+        }
+        std::lock_guard<std::mutex> lockBuffer(bufferQueueMutex_);
+        if (SurfaceBufferToDImageBuffer(surfaceBuffer, syncFence) != DCamRetCode::SUCCESS) {
+            return;
+        }
+    }
+}
+
+bool DCameraStream::NeedPrefetch()
+{
+    {
+        std::lock_guard<std::mutex> lockPrefetch(prefetchMutex_);
+        if (!isPrefetchRunning_) {
+            return false;
+        }
+    }
+    std::lock_guard<std::mutex> lockBuffer(bufferQueueMutex_);
+    if (CheckRequestParam() != DCamRetCode::SUCCESS || dcStreamBufferMgr_ == nullptr) {
+        return false;
+    }
+    return dcStreamBufferMgr_->GetIdleCount() < prefetchCount_ && dcStreamBufferMgr_->GetFreeCount() > 0;
+}
+
+bool DCameraStream::IsFencePending(const OHOS::sptr<OHOS::SyncFence> &syncFence)
+{
+    return syncFence != nullptr && syncFence->IsValid() && syncFence->Wait(0) != 0;
+}
+
 bool DCameraStream::HasBufferQueue()
 {
     if (dcStreamProducer_ == nullptr || !isBufferMgrInited_) {
@@ -93,6 +93,11 @@ OHOS::sptr<OHOS::SyncFence> DImageBuffer::GetSyncFence() const
     return syncFence_;
 }
 
+OHOS::sptr<OHOS::SyncFence> DImageBuffer::GetReleaseFence() const
+{
+    return releaseFence_;
+}
+
 int32_t DImageBuffer::GetEncodeType() const
 {
     return encodeType_;
@@ -201,6 +206,13 @@ void DImageBuffer::SetSyncFence(const OHOS::sptr<OHOS::SyncFence> &syncFence)
     return;
 }
 
+void DImageBuffer::SetReleaseFence(const OHOS::sptr<OHOS::SyncFence> &releaseFence)
+{
+    std::lock_guard<std::mutex> l(l_);
+    releaseFence_ = releaseFence;
+    return;
+}
+
 void DImageBuffer::SetEncodeType(const int32_t type)
 {
     std::lock_guard<std::mutex> l(l_);
@@ -228,6 +240,7 @@ void DImageBuffer::Free()
     phyAddr_ = 0;
     fd_ = -1;
     syncFence_ = nullptr;
+    releaseFence_ = nullptr;
 
     return;
 }
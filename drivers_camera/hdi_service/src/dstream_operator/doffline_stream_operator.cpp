@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,25 +14,195 @@
  */
 
 #include "doffline_stream_operator.h"
+
+#include "constants.h"
+#include "dcamera_provider.h"
 #include "distributed_hardware_log.h"
 
 namespace OHOS {
 namespace DistributedHardware {
+DOfflineStreamOperator::DOfflineStreamOperator(const DHBase &dhBase,
+    const OHOS::sptr<IStreamOperatorCallback> &callback) : dhBase_(dhBase), callback_(callback)
+{
+}
+
 int32_t DOfflineStreamOperator::CancelCapture(int32_t captureId)
 {
-    (void)captureId;
-    return CamRetCode::METHOD_NOT_SUPPORTED;
+    std::map<int32_t, DOfflineStream> canceledStreams;
+    {
+        std::lock_guard<std::mutex> autoLock(offlineStreamLock_);
+        for (auto iter = offlineStreams_.begin(); iter != offlineStreams_.end();) {
+            if (iter->second.captureId == captureId) {
+                canceledStreams.insert(*iter);
+                iter = offlineStreams_.erase(iter);
+            } else {
+                iter++;
+            }
+        }
+    }
+    if (canceledStreams.empty()) {
+        DHLOGE("DOfflineStreamOperator::CancelCapture, captureId %{public}d is not exist.", captureId);
+        return CamRetCode::INVALID_ARGUMENT;
+    }
+    DHLOGI("DOfflineStreamOperator::CancelCapture, captureId=%{public}d.", captureId);
+
+    std::vector<int> streamIds;
+    for (const auto &iter : canceledStreams) {
+        streamIds.push_back(iter.first);
+    }
+    OHOS::sptr<DCameraProvider> provider = DCameraProvider::GetInstance();
+    if (provider != nullptr && provider->StopCapture(dhBase_, streamIds) != SUCCESS) {
+        DHLOGE("Stop offline capture %{public}d failed.", captureId);
+    }
+    std::vector<CaptureEndedInfo> info;
+    for (const auto &iter : canceledStreams) {
+        if (iter.second.stream != nullptr) {
+            iter.second.stream->CancelCaptureWait();
+        }
+        CaptureEndedInfo tmp;
+        tmp.frameCount_ = iter.second.bufferNum;
+        tmp.streamId_ = iter.first;
+        info.push_back(tmp);
+    }
+    if (callback_ != nullptr) {
+        callback_->OnCaptureEnded(captureId, info);
+    }
+    ReleaseOfflineStreams(canceledStreams);
+    return CamRetCode::NO_ERROR;
 }
 
 int32_t DOfflineStreamOperator::ReleaseStreams(const std::vector<int32_t>& streamIds)
 {
-    (void)streamIds;
-    return CamRetCode::METHOD_NOT_SUPPORTED;
+    if (streamIds.empty() || streamIds.size() > CONTAINER_CAPACITY_MAX_SIZE) {
+        DHLOGE("DOfflineStreamOperator::ReleaseStreams, input streamIds is invalid.");
+        return CamRetCode::INVALID_ARGUMENT;
+    }
+    std::map<int32_t, DOfflineStream> releasedStreams;
+    bool isAllFound = true;
+    {
+        std::lock_guard<std::mutex> autoLock(offlineStreamLock_);
+        for (int32_t id : streamIds) {
+            auto iter = offlineStreams_.find(id);
+            if (iter == offlineStreams_.end()) {
+                DHLOGE("Offline stream %{public}d is not exist.", id);
+                isAllFound = false;
+                continue;
+            }
+            releasedStreams.insert(*iter);
+            offlineStreams_.erase(iter);
+        }
+    }
+    ReleaseOfflineStreams(releasedStreams);
+    return isAllFound ? CamRetCode::NO_ERROR : CamRetCode::INVALID_ARGUMENT;
 }
 
 int32_t DOfflineStreamOperator::Release()
 {
-    return CamRetCode::METHOD_NOT_SUPPORTED;
+    std::map<int32_t, DOfflineStream> releasedStreams;
+    {
+        std::lock_guard<std::mutex> autoLock(offlineStreamLock_);
+        releasedStreams.swap(offlineStreams_);
+    }
+    DHLOGI("DOfflineStreamOperator::Release, release %{public}zu offline streams.", releasedStreams.size());
+    ReleaseOfflineStreams(releasedStreams);
+    return CamRetCode::NO_ERROR;
+}
+
+void DOfflineStreamOperator::AddStream(int32_t streamId, const DOfflineStream &offlineStream)
+{
+    std::lock_guard<std::mutex> autoLock(offlineStreamLock_);
+    offlineStreams_[streamId] = offlineStream;
+}
+
+std::shared_ptr<DCameraStream> DOfflineStreamOperator::FindStream(int32_t streamId)
+{
+    std::lock_guard<std::mutex> autoLock(offlineStreamLock_);
+    auto iter = offlineStreams_.find(streamId);
+    return iter == offlineStreams_.end() ? nullptr : iter->second.stream;
+}
+
+bool DOfflineStreamOperator::IsEmpty()
+{
+    std::lock_guard<std::mutex> autoLock(offlineStreamLock_);
+    return offlineStreams_.empty();
+}
+
+void DOfflineStreamOperator::GetStreamInfos(std::vector<DCStreamInfo> &streamInfos)
+{
+    std::lock_guard<std::mutex> autoLock(offlineStreamLock_);
+    for (const auto &iter : offlineStreams_) {
+        streamInfos.push_back(iter.second.streamInfo);
+    }
+}
+
+DCamRetCode DOfflineStreamOperator::ShutterBuffer(int32_t streamId, const DCameraBuffer &buffer,
+    int64_t captureAgeUs)
+{
+    DOfflineStream offlineStream;
+    {
+        std::lock_guard<std::mutex> autoLock(offlineStreamLock_);
+        auto iter = offlineStreams_.find(streamId);
+        if (iter == offlineStreams_.end() || iter->second.stream == nullptr) {
+            DHLOGE("Offline ShutterBuffer failed, invalid streamId = %{public}d", streamId);
+            return DCamRetCode::INVALID_ARGUMENT;
+        }
+        offlineStream = iter->second;
+    }
+    DCamRetCode ret = offlineStream.stream->ReturnDCameraBuffer(buffer, captureAgeUs);
+    if (ret != DCamRetCode::SUCCESS) {
+        DHLOGE("Return offline buffer failed, streamId = %{public}d", streamId);
+        return ret;
+    }
+    // A buffer handed back unfilled keeps the snapshot waiting for its frame.
+    if (buffer.size_ == 0) {
+        return DCamRetCode::SUCCESS;
+    }
+    {
+        std::lock_guard<std::mutex> autoLock(offlineStreamLock_);
+        if (offlineStreams_.erase(streamId) == 0) {
+            return DCamRetCode::SUCCESS;
+        }
+    }
+
+    std::vector<int32_t> streamIds = { streamId };
+    if (callback_ != nullptr) {
+        if (!offlineStream.captureStarted) {
+            callback_->OnCaptureStarted(offlineStream.captureId, streamIds);
+        }
+        if (!offlineStream.enableShutter) {
+            callback_->OnFrameShutter(offlineStream.captureId, streamIds, GetCaptureLocalTimeStamp(captureAgeUs));
+        }
+        CaptureEndedInfo info;
+        info.frameCount_ = offlineStream.bufferNum + 1;
+        info.streamId_ = streamId;
+        callback_->OnCaptureEnded(offlineStream.captureId, { info });
+    }
+    DHLOGI("Offline snapshot delivered, captureId = %{public}d streamId = %{public}d.",
+        offlineStream.captureId, streamId);
+    ReleaseOfflineStreams({ { streamId, offlineStream } });
+    return DCamRetCode::SUCCESS;
+}
+
+void DOfflineStreamOperator::ReleaseOfflineStreams(const std::map<int32_t, DOfflineStream> &offlineStreams)
+{
+    if (offlineStreams.empty()) {
+        return;
+    }
+    std::vector<int> streamIds;
+    for (const auto &iter : offlineStreams) {
+        if (iter.second.stream != nullptr && iter.second.stream->ReleaseDCameraBufferQueue() != SUCCESS) {
+            DHLOGE("Release offline buffer queue for stream %{public}d failed.", iter.first);
+        }
+        streamIds.push_back(iter.first);
+    }
+    OHOS::sptr<DCameraProvider> provider = DCameraProvider::GetInstance();
+    if (provider == nullptr) {
+        DHLOGE("DCameraProvider not init.");
+        return;
+    }
+    if (provider->ReleaseStreams(dhBase_, streamIds) != SUCCESS) {
+        DHLOGE("Release offline distributed camera streams failed.");
+    }
 }
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,9 +14,13 @@
  */
 
 #include "dstream_operator.h"
+
+#include <algorithm>
+
 #include "dbuffer_manager.h"
 #include "dcamera_provider.h"
 #include "dcamera.h"
+#include "dcamera_ability_cache.h"
 #include "distributed_hardware_log.h"
 #include "metadata_utils.h"
 #include "constants.h"
@@ -76,7 +80,7 @@ int32_t DStreamOperator::CreateStreams(const std::vector<StreamInfo> &streamInfo
         DHLOGI("DStreamOperator::CreateStreams, streamInfo: id=%{public}d, width=%{public}d, "
             "height=%{public}d, format=%{public}d, dataspace=%{public}d, encodeType=%{public}d",
             info.streamId_, info.width_, info.height_, info.format_, info.dataspace_, info.encodeType_);
-        if (FindHalStreamById(info.streamId_) != nullptr) {
+        if (FindHalStreamById(info.streamId_) != nullptr || FindOfflineStream(info.streamId_) != nullptr) {
             return CamRetCode::INVALID_ARGUMENT;
         }
         if (!info.tunneledMode_) {
@@ -128,6 +132,7 @@ int32_t DStreamOperator::ReleaseStreams(const std::vector<int32_t> &streamIds)
     }
 
     for (int id : streamIds) {
+        ReleaseBufferRing(id);
         auto stream = FindHalStreamById(id);
         if (stream != nullptr) {
             DCamRetCode ret = stream->ReleaseDCameraBufferQueue();
@@ -185,6 +190,18 @@ int32_t DStreamOperator::ExtractStreamInfo(std::vector<DCStreamInfo>& dCameraStr
         dstStreamInfo.mode_ = currentOperMode_;
         dCameraStreams.push_back(dstStreamInfo);
     }
+    // Reconfiguring must not drop the sink streams of snapshots still delivering offline.
+    std::vector<DCStreamInfo> offlineStreamInfos;
+    {
+        std::lock_guard<std::mutex> offlineLock(offlineOperatorLock_);
+        for (const auto &offlineOperator : offlineOperators_) {
+            offlineOperator->GetStreamInfos(offlineStreamInfos);
+        }
+    }
+    for (auto &offlineStreamInfo : offlineStreamInfos) {
+        offlineStreamInfo.mode_ = currentOperMode_;
+        dCameraStreams.push_back(offlineStreamInfo);
+    }
     return CamRetCode::NO_ERROR;
 }
 
@@ -417,8 +434,8 @@ int32_t DStreamOperator::Capture(int32_t captureId, const CaptureInfo &info, boo
 
 int32_t DStreamOperator::DoCapture(int32_t captureId, const CaptureInfo &info, bool isStreaming)
 {
+    std::vector<std::shared_ptr<DCameraStream>> streams;
     for (const auto &id : info.streamIds_) {
-        InsertNotifyCaptureMap(id);
         auto stream = FindHalStreamById(id);
         if (stream == nullptr) {
             DHLOGE("Invalid stream id %{public}d", id);
@@ -429,7 +446,7 @@ int32_t DStreamOperator::DoCapture(int32_t captureId, const CaptureInfo &info, b
             return CamRetCode::INVALID_ARGUMENT;
         }
         stream->DoCapture();
-        InsertEnableShutter(id, info.enableShutterCallback_);
+        streams.push_back(stream);
         DHLOGI("DStreamOperator::DoCapture info: "
             "captureId=%{public}d, streamId=%{public}d, isStreaming=%{public}d", captureId, id, isStreaming);
     }
@@ -457,8 +474,10 @@ int32_t DStreamOperator::DoCapture(int32_t captureId, const CaptureInfo &info, b
     captureInfo->captureSetting_.assign(info.captureSetting_.begin(), info.captureSetting_.end());
     captureInfo->enableShutterCallback_ = info.enableShutterCallback_;
     InsertCaptureInfo(captureId, captureInfo);
+    InsertHotStates(captureId, info, streams);
 
     SetCapturing(true);
+    EnableBufferRings(info.streamIds_);
     DHLOGI("DStreamOperator::DoCapture, start distributed camera capture success.");
 
     return CamRetCode::NO_ERROR;
@@ -493,16 +512,20 @@ int32_t DStreamOperator::CancelCapture(int32_t captureId)
 
     std::vector<CaptureEndedInfo> info;
     for (auto id : streamIds) {
+        // Buffers still parked in the ring count as acquired, hand them back before waiting for the rest.
+        auto ring = FindBufferRing(id);
+        if (ring != nullptr) {
+            ring->DisableRefill();
+        }
         auto stream = FindHalStreamById(id);
         if (stream != nullptr) {
             stream->CancelCaptureWait();
         }
+        auto hotState = EraseHotState(captureId, id);
         CaptureEndedInfo tmp;
-        tmp.frameCount_ = FindStreamCaptureBufferNum(std::make_pair(captureId, id));
+        tmp.frameCount_ = hotState == nullptr ? 0 : hotState->bufferNum.load(std::memory_order_relaxed);
         tmp.streamId_ = id;
         info.push_back(tmp);
-        EraseStreamCaptureBufferNum(std::make_pair(captureId, id));
-        EraseNotifyCaptureMap(id);
     }
     if (dcStreamOperatorCallback__V1_3) {
         dcStreamOperatorCallback__V1_3->OnCaptureEnded(captureId, info);
@@ -548,10 +571,123 @@ bool DStreamOperator::HasContinuousCaptureInfo(int captureId)
 int32_t DStreamOperator::ChangeToOfflineStream(const std::vector<int32_t> &streamIds,
     const sptr<IStreamOperatorCallback> &callbackObj, sptr<IOfflineStreamOperator> &offlineOperator)
 {
-    (void)streamIds;
-    (void)callbackObj;
     offlineOperator = nullptr;
-    return CamRetCode::METHOD_NOT_SUPPORTED;
+    if (streamIds.empty() || streamIds.size() > CONTAINER_CAPACITY_MAX_SIZE || callbackObj == nullptr) {
+        DHLOGE("DStreamOperator::ChangeToOfflineStream, input param is invalid.");
+        return CamRetCode::INVALID_ARGUMENT;
+    }
+    // Only snapshots whose remote frame is still on the way can finish without the session.
+    std::vector<std::shared_ptr<DStreamHotState>> hotStates;
+    for (int32_t id : streamIds) {
+        auto hotState = FindHotState(id);
+        if (hotState == nullptr || !hotState->isSnapshot || hotState->stream == nullptr) {
+            DHLOGE("Stream %{public}d is not a running snapshot, can not change to offline.", id);
+            return CamRetCode::METHOD_NOT_SUPPORTED;
+        }
+        hotStates.push_back(hotState);
+    }
+    OHOS::sptr<DOfflineStreamOperator> dOfflineOperator(new (std::nothrow) DOfflineStreamOperator(dhBase_,
+        callbackObj));
+    if (dOfflineOperator == nullptr) {
+        DHLOGE("Create offline stream operator failed.");
+        return CamRetCode::DEVICE_ERROR;
+    }
+    {
+        std::lock_guard<std::mutex> autoLock(offlineOperatorLock_);
+        offlineOperators_.erase(std::remove_if(offlineOperators_.begin(), offlineOperators_.end(),
+            [](const auto &item) { return item->IsEmpty(); }), offlineOperators_.end());
+        offlineOperators_.push_back(dOfflineOperator);
+    }
+    std::set<int32_t> captureIds;
+    for (const auto &hotState : hotStates) {
+        DetachOfflineStream(hotState, dOfflineOperator);
+        captureIds.insert(hotState->captureId);
+    }
+    // A capture left without online streams is over for this session.
+    auto remainStates = std::atomic_load(&hotStates_);
+    for (int32_t captureId : captureIds) {
+        if (std::none_of(remainStates->begin(), remainStates->end(),
+            [captureId](const auto &item) { return item->captureId == captureId; })) {
+            EraseCaptureInfo(captureId);
+        }
+    }
+    if (!HasContinuousCaptureInfo(*captureIds.begin())) {
+        SetCapturing(false);
+        cachedDCaptureInfoList_.clear();
+    }
+    offlineOperator = dOfflineOperator;
+    DHLOGI("DStreamOperator::ChangeToOfflineStream success, stream size=%{public}zu.", streamIds.size());
+    return CamRetCode::NO_ERROR;
+}
+
+void DStreamOperator::DetachOfflineStream(const std::shared_ptr<DStreamHotState> &hotState,
+    const OHOS::sptr<DOfflineStreamOperator> &offlineOperator)
+{
+    DOfflineStream offlineStream;
+    offlineStream.captureId = hotState->captureId;
+    offlineStream.stream = hotState->stream;
+    offlineStream.enableShutter = hotState->enableShutter;
+    offlineStream.captureStarted = hotState->captureStarted.load();
+    offlineStream.bufferNum = hotState->bufferNum.load(std::memory_order_relaxed);
+    auto dcStreamInfo = FindDCStreamById(hotState->streamId);
+    if (dcStreamInfo != nullptr) {
+        offlineStream.streamInfo = *dcStreamInfo;
+    }
+    // Added before the hot state goes away, so a frame arriving meanwhile always finds its stream.
+    offlineOperator->AddStream(hotState->streamId, offlineStream);
+    EraseHotState(hotState->captureId, hotState->streamId);
+    EraseHalStream(hotState->streamId);
+    EraseDCStream(hotState->streamId);
+    DHLOGI("Stream %{public}d of capture %{public}d changed to offline.", hotState->streamId, hotState->captureId);
+}
+
+OHOS::sptr<DOfflineStreamOperator> DStreamOperator::FindOfflineOperator(int32_t streamId)
+{
+    std::lock_guard<std::mutex> autoLock(offlineOperatorLock_);
+    for (const auto &offlineOperator : offlineOperators_) {
+        if (offlineOperator->FindStream(streamId) != nullptr) {
+            return offlineOperator;
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<DCameraStream> DStreamOperator::FindOfflineStream(int32_t streamId)
+{
+    std::lock_guard<std::mutex> autoLock(offlineOperatorLock_);
+    for (const auto &offlineOperator : offlineOperators_) {
+        auto stream = offlineOperator->FindStream(streamId);
+        if (stream != nullptr) {
+            return stream;
+        }
+    }
+    return nullptr;
+}
+
+bool DStreamOperator::HasOfflineOperator()
+{
+    std::lock_guard<std::mutex> autoLock(offlineOperatorLock_);
+    return std::any_of(offlineOperators_.begin(), offlineOperators_.end(),
+        [](const auto &item) { return !item->IsEmpty(); });
+}
+
+DCamRetCode DStreamOperator::ShutterOfflineBuffer(int32_t streamId, const DCameraBuffer &buffer,
+    int64_t captureAgeUs)
+{
+    auto offlineOperator = FindOfflineOperator(streamId);
+    if (offlineOperator == nullptr) {
+        DHLOGE("ShutterBuffer failed, invalid streamId = %{public}d", streamId);
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    DCamRetCode ret = offlineOperator->ShutterBuffer(streamId, buffer, captureAgeUs);
+    if (offlineOperator->FindStream(streamId) == nullptr) {
+        // The snapshot is delivered, its ring has nothing left to refill.
+        auto ring = FindBufferRing(streamId);
+        if (ring != nullptr) {
+            ring->DisableRefill();
+        }
+    }
+    return ret;
 }
 
 
@@ -653,40 +789,26 @@ DCamRetCode DStreamOperator::SetOutputVal(const DHBase &dhBase, const std::strin
 DCamRetCode DStreamOperator::InitOutputConfigurations(const DHBase &dhBase, const std::string &sinkAbilityInfo,
     const std::string &sourceCodecInfo)
 {
-    cJSON *rootValue = cJSON_Parse(sinkAbilityInfo.c_str());
-    CHECK_NULL_RETURN_LOG(rootValue, DCamRetCode::INVALID_ARGUMENT, "The sinkAbilityInfo is null.");
-    CHECK_OBJECT_FREE_RETURN(rootValue, DCamRetCode::INVALID_ARGUMENT, "The sinkAbilityInfo is not object.");
-
-    cJSON *srcRootValue = cJSON_Parse(sourceCodecInfo.c_str());
-    CHECK_NULL_FREE_RETURN(srcRootValue, DCamRetCode::INVALID_ARGUMENT, rootValue);
-    if (!cJSON_IsObject(srcRootValue)) {
-        cJSON_Delete(srcRootValue);
-        cJSON_Delete(rootValue);
-        DHLOGE("Input source ablity info is not json object.");
-        return DCamRetCode::INVALID_ARGUMENT;
-    }
-    dcSupportedCodecType_ = ParseEncoderTypes(rootValue);
-    sourceEncodeTypes_ = ParseEncoderTypes(srcRootValue);
+    ClearNegotiationCache();
+    // The sink ability is shared with the metadata processor, which parsed it when the device was enabled.
+    std::shared_ptr<cJSON> root = DCameraAbilityCache::GetInstance().Parse(sinkAbilityInfo);
+    CHECK_NULL_RETURN_LOG(root, DCamRetCode::INVALID_ARGUMENT, "The sinkAbilityInfo is invalid.");
+    std::shared_ptr<cJSON> srcRoot = DCameraAbilityCache::GetInstance().Parse(sourceCodecInfo);
+    CHECK_NULL_RETURN_LOG(srcRoot, DCamRetCode::INVALID_ARGUMENT, "Input source ablity info is not json object.");
+    dcSupportedCodecType_ = ParseEncoderTypes(root.get());
+    sourceEncodeTypes_ = ParseEncoderTypes(srcRoot.get());
     if (dcSupportedCodecType_.empty() || sourceEncodeTypes_.empty()) {
         DHLOGE("Get CodeType failed.");
-        cJSON_Delete(rootValue);
-        cJSON_Delete(srcRootValue);
         return DCamRetCode::INVALID_ARGUMENT;
     }
 
-    if (ParseFormats(rootValue) != SUCCESS) {
-        cJSON_Delete(rootValue);
-        cJSON_Delete(srcRootValue);
+    if (ParseFormats(root.get()) != SUCCESS) {
         return DCamRetCode::INVALID_ARGUMENT;
     }
 
     if (!CheckInputInfo()) {
-        cJSON_Delete(rootValue);
-        cJSON_Delete(srcRootValue);
         return DEVICE_NOT_INIT;
     }
-    cJSON_Delete(rootValue);
-    cJSON_Delete(srcRootValue);
     return SUCCESS;
 }
 
@@ -836,13 +958,17 @@ DCamRetCode DStreamOperator::ParseVideoFormats(cJSON* rootValue)
 
 DCamRetCode DStreamOperator::AcquireBuffer(int streamId, DCameraBuffer &buffer)
 {
-    if (!IsCapturing()) {
-        DHLOGE("Not in capturing state, can not acquire buffer.");
-        return DCamRetCode::CAMERA_OFFLINE;
+    bool isCapturing = IsCapturing();
+    auto stream = isCapturing ? FindHalStreamById(streamId) : nullptr;
+    if (stream == nullptr) {
+        // Offline snapshots keep acquiring after the session stopped capturing.
+        stream = FindOfflineStream(streamId);
     }
-
-    auto stream = FindHalStreamById(streamId);
     if (stream == nullptr) {
+        if (!isCapturing) {
+            DHLOGE("Not in capturing state, can not acquire buffer.");
+            return DCamRetCode::CAMERA_OFFLINE;
+        }
         DHLOGE("streamId %{public}d is invalid, can not acquire buffer.", streamId);
         return DCamRetCode::INVALID_ARGUMENT;
     }
@@ -856,52 +982,232 @@ DCamRetCode DStreamOperator::AcquireBuffer(int streamId, DCameraBuffer &buffer)
     return ret;
 }
 
-DCamRetCode DStreamOperator::ShutterBuffer(int streamId, const DCameraBuffer &buffer)
+DCamRetCode DStreamOperator::ShutterBuffer(int streamId, const DCameraBuffer &buffer, int64_t captureTimeUs)
 {
     DHLOGD("DStreamOperator::ShutterBuffer begin shutter buffer for streamId = %{public}d", streamId);
 
-    int32_t captureId = FindCaptureIdByStreamId(streamId);
-    if (captureId == -1) {
-        DHLOGE("ShutterBuffer failed, invalid streamId = %{public}d", streamId);
-        return DCamRetCode::INVALID_ARGUMENT;
+    int64_t captureAgeUs = GetCaptureAgeUs(captureTimeUs);
+    auto hotState = FindHotState(streamId);
+    if (hotState == nullptr) {
+        return ShutterOfflineBuffer(streamId, buffer, captureAgeUs);
+    }
+
+    DCamRetCode ret = ReturnStreamBuffer(*hotState, buffer, captureAgeUs);
+    if (ret != DCamRetCode::SUCCESS) {
+        return ret;
+    }
+
+    uint64_t resultTimestamp = GetCaptureLocalTimeStamp(captureAgeUs);
+    if (dMetadataProcessor_ != nullptr) {
+        dMetadataProcessor_->UpdateResultMetadata(resultTimestamp);
     }
 
-    auto iter = notifyCaptureStartedMap_.find(streamId);
-    if (iter != notifyCaptureStartedMap_.end()) {
-        if (!iter->second && dcStreamOperatorCallback__V1_3 != nullptr) {
-            vector<int> tmpStreamIds;
-            tmpStreamIds.push_back(streamId);
-            dcStreamOperatorCallback__V1_3->OnCaptureStarted(captureId, tmpStreamIds);
-            iter->second = true;
+    if (!hotState->enableShutter) {
+        if (dcStreamOperatorCallback__V1_3 == nullptr) {
+            DHLOGE("DStreamOperator::ShutterBuffer failed, need shutter frame, but stream operator callback is null.");
+            return DCamRetCode::FAILED;
         }
+        std::vector<int32_t> streamIds;
+        streamIds.push_back(streamId);
+        dcStreamOperatorCallback__V1_3->OnFrameShutter(hotState->captureId, streamIds, resultTimestamp);
     }
+    return DCamRetCode::SUCCESS;
+}
 
-    auto stream = FindHalStreamById(streamId);
-    if (stream != nullptr) {
-        DCamRetCode ret = stream->ReturnDCameraBuffer(buffer);
+DCamRetCode DStreamOperator::AcquireBuffers(const std::vector<int32_t> &streamIds,
+    std::vector<DCameraStreamBuffer> &buffers)
+{
+    if (!IsCapturing() && !HasOfflineOperator()) {
+        DHLOGE("Not in capturing state, can not acquire buffers.");
+        return DCamRetCode::CAMERA_OFFLINE;
+    }
+
+    // Skip streams without an idle buffer, the buffers already acquired cannot be dropped on the way back.
+    DCamRetCode firstError = DCamRetCode::SUCCESS;
+    for (int32_t streamId : streamIds) {
+        DCameraStreamBuffer streamBuffer;
+        streamBuffer.streamId_ = streamId;
+        streamBuffer.captureTimeUs_ = 0;
+        DCamRetCode ret = AcquireBuffer(streamId, streamBuffer.buffer_);
         if (ret != DCamRetCode::SUCCESS) {
-            DHLOGE("Flush distributed camera buffer failed.");
-            return ret;
+            firstError = (firstError == DCamRetCode::SUCCESS) ? ret : firstError;
+            continue;
         }
-        AddStreamCaptureBufferNum(std::make_pair(captureId, streamId));
+        buffers.push_back(streamBuffer);
+    }
+    return buffers.empty() ? firstError : DCamRetCode::SUCCESS;
+}
+
+DCamRetCode DStreamOperator::ShutterBuffers(const std::vector<DCameraStreamBuffer> &buffers)
+{
+    DHLOGD("DStreamOperator::ShutterBuffers begin shutter %{public}zu buffers", buffers.size());
 
-        SnapShotStreamOnCaptureEnded(captureId, streamId);
+    DCamRetCode firstError = DCamRetCode::SUCCESS;
+    // Streams of the same capture are reported by a single frame shutter callback.
+    std::map<int32_t, std::vector<int32_t>> shutterStreams;
+    bool isReturned = false;
+    // Buffers shuttered together belong to one frame, the first known capture time dates all of them.
+    int64_t captureAgeUs = 0;
+    for (const auto &streamBuffer : buffers) {
+        captureAgeUs = GetCaptureAgeUs(streamBuffer.captureTimeUs_);
+        if (captureAgeUs != 0) {
+            break;
+        }
+    }
+    for (const auto &streamBuffer : buffers) {
+        auto hotState = FindHotState(streamBuffer.streamId_);
+        if (hotState == nullptr) {
+            DCamRetCode ret = ShutterOfflineBuffer(streamBuffer.streamId_, streamBuffer.buffer_, captureAgeUs);
+            firstError = (ret != DCamRetCode::SUCCESS && firstError == DCamRetCode::SUCCESS) ? ret : firstError;
+            continue;
+        }
+        DCamRetCode ret = ReturnStreamBuffer(*hotState, streamBuffer.buffer_, captureAgeUs);
+        if (ret != DCamRetCode::SUCCESS) {
+            firstError = (firstError == DCamRetCode::SUCCESS) ? ret : firstError;
+            continue;
+        }
+        isReturned = true;
+        if (!hotState->enableShutter) {
+            shutterStreams[hotState->captureId].push_back(streamBuffer.streamId_);
+        }
+    }
+    if (!isReturned) {
+        return firstError;
     }
 
-    uint64_t resultTimestamp = GetCurrentLocalTimeStamp();
+    uint64_t resultTimestamp = GetCaptureLocalTimeStamp(captureAgeUs);
     if (dMetadataProcessor_ != nullptr) {
         dMetadataProcessor_->UpdateResultMetadata(resultTimestamp);
     }
-
-    bool enableShutter = FindEnableShutter(streamId);
-    if (!enableShutter) {
+    if (!shutterStreams.empty()) {
         if (dcStreamOperatorCallback__V1_3 == nullptr) {
-            DHLOGE("DStreamOperator::ShutterBuffer failed, need shutter frame, but stream operator callback is null.");
+            DHLOGE("DStreamOperator::ShutterBuffers failed, need shutter frame, but stream operator callback is null.");
             return DCamRetCode::FAILED;
         }
-        std::vector<int32_t> streamIds;
-        streamIds.push_back(streamId);
-        dcStreamOperatorCallback__V1_3->OnFrameShutter(captureId, streamIds, resultTimestamp);
+        for (const auto &iter : shutterStreams) {
+            dcStreamOperatorCallback__V1_3->OnFrameShutter(iter.first, iter.second, resultTimestamp);
+        }
+    }
+    return firstError;
+}
+
+DCamRetCode DStreamOperator::OpenBufferRing(int32_t streamId, int &ringFd, int &eventFd)
+{
+    int32_t isRingEnabled = 1;
+    if (GetSysPara(BUFFER_RING_PARA, isRingEnabled) && isRingEnabled == 0) {
+        DHLOGI("Buffer ring is disabled, streamId = %{public}d", streamId);
+        return DCamRetCode::METHOD_NOT_SUPPORTED;
+    }
+    auto stream = FindHalStreamById(streamId);
+    if (stream == nullptr) {
+        DHLOGE("streamId %{public}d is invalid, can not open buffer ring.", streamId);
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    std::shared_ptr<DBufferRing> ring = nullptr;
+    {
+        std::lock_guard<std::mutex> autoLock(bufferRingLock_);
+        auto iter = bufferRingMap_.find(streamId);
+        if (iter != bufferRingMap_.end()) {
+            ring = iter->second;
+        } else {
+            // Rings are released with their streams before the operator goes away.
+            DBufferRing::AcquireFunc acquireFunc = [this, streamId](DCameraBuffer &buffer, uint32_t &seqNum) {
+                auto halStream = FindHalStreamById(streamId);
+                if (halStream == nullptr) {
+                    halStream = FindOfflineStream(streamId);
+                }
+                if (halStream == nullptr || !halStream->HasIdleBuffer()) {
+                    return DCamRetCode::EXCEED_MAX_NUMBER;
+                }
+                DCamRetCode ret = AcquireBuffer(streamId, buffer);
+                if (ret == DCamRetCode::SUCCESS && !halStream->GetBufferSeqNum(buffer.index_, seqNum)) {
+                    seqNum = 0;
+                }
+                return ret;
+            };
+            DBufferRing::ReturnFunc returnFunc = [this, streamId](const DCameraBuffer &buffer, int64_t captureTimeUs) {
+                return ShutterBuffer(streamId, buffer, captureTimeUs);
+            };
+            ring = std::make_shared<DBufferRing>(streamId, acquireFunc, returnFunc);
+            DCamRetCode ret = ring->Init();
+            if (ret != DCamRetCode::SUCCESS) {
+                return ret;
+            }
+            bufferRingMap_[streamId] = ring;
+        }
+    }
+    if (IsCapturing() && FindHotState(streamId) != nullptr) {
+        ring->EnableRefill();
+    }
+    // The ring keeps both fds, the stub duplicates them into the reply.
+    ringFd = ring->GetRingFd();
+    eventFd = ring->GetEventFd();
+    return DCamRetCode::SUCCESS;
+}
+
+DCamRetCode DStreamOperator::GetRingBuffer(int32_t streamId, int32_t index, DCameraBuffer &buffer)
+{
+    auto stream = FindHalStreamById(streamId);
+    if (stream == nullptr) {
+        DHLOGE("streamId %{public}d is invalid, can not get ring buffer.", streamId);
+        return DCamRetCode::INVALID_ARGUMENT;
+    }
+    return stream->GetBusyDCameraBuffer(index, buffer);
+}
+
+std::shared_ptr<DBufferRing> DStreamOperator::FindBufferRing(int32_t streamId)
+{
+    std::lock_guard<std::mutex> autoLock(bufferRingLock_);
+    auto iter = bufferRingMap_.find(streamId);
+    if (iter != bufferRingMap_.end()) {
+        return iter->second;
+    }
+    return nullptr;
+}
+
+void DStreamOperator::EnableBufferRings(const std::vector<int> &streamIds)
+{
+    for (int streamId : streamIds) {
+        auto ring = FindBufferRing(streamId);
+        if (ring != nullptr) {
+            ring->EnableRefill();
+        }
+    }
+}
+
+void DStreamOperator::ReleaseBufferRing(int32_t streamId)
+{
+    std::shared_ptr<DBufferRing> ring = nullptr;
+    {
+        std::lock_guard<std::mutex> autoLock(bufferRingLock_);
+        auto iter = bufferRingMap_.find(streamId);
+        if (iter == bufferRingMap_.end()) {
+            return;
+        }
+        ring = iter->second;
+        bufferRingMap_.erase(iter);
+    }
+    ring->Release();
+}
+
+DCamRetCode DStreamOperator::ReturnStreamBuffer(DStreamHotState &hotState, const DCameraBuffer &buffer,
+    int64_t captureAgeUs)
+{
+    if (dcStreamOperatorCallback__V1_3 != nullptr && !hotState.captureStarted.exchange(true)) {
+        vector<int> tmpStreamIds;
+        tmpStreamIds.push_back(hotState.streamId);
+        dcStreamOperatorCallback__V1_3->OnCaptureStarted(hotState.captureId, tmpStreamIds);
+    }
+
+    if (hotState.stream != nullptr) {
+        DCamRetCode ret = hotState.stream->ReturnDCameraBuffer(buffer, captureAgeUs);
+        if (ret != DCamRetCode::SUCCESS) {
+            DHLOGE("Flush distributed camera buffer failed.");
+            return ret;
+        }
+        hotState.bufferNum.fetch_add(1, std::memory_order_relaxed);
+
+        SnapShotStreamOnCaptureEnded(hotState);
     }
     return DCamRetCode::SUCCESS;
 }
@@ -935,21 +1241,19 @@ DCamRetCode DStreamOperator::SetDeviceCallback(
     return SUCCESS;
 }
 
-void DStreamOperator::SnapShotStreamOnCaptureEnded(int32_t captureId, int streamId)
+void DStreamOperator::SnapShotStreamOnCaptureEnded(const DStreamHotState &hotState)
 {
-    auto dcStreamInfo = FindDCStreamById(streamId);
-    if (dcStreamInfo == nullptr) {
-        return;
-    }
-    if (dcStreamInfo->type_ != DCStreamType::SNAPSHOT_FRAME) {
+    if (!hotState.isSnapshot) {
         return;
     }
     if (dcStreamOperatorCallback__V1_3 == nullptr) {
         return;
     }
+    int32_t captureId = hotState.captureId;
+    int32_t streamId = hotState.streamId;
     std::vector<CaptureEndedInfo> info;
     CaptureEndedInfo tmp;
-    tmp.frameCount_ = FindStreamCaptureBufferNum(std::make_pair(captureId, streamId));
+    tmp.frameCount_ = hotState.bufferNum.load(std::memory_order_relaxed);
     tmp.streamId_ = streamId;
     info.push_back(tmp);
     dcStreamOperatorCallback__V1_3->OnCaptureEnded(captureId, info);
@@ -968,9 +1272,26 @@ void DStreamOperator::Release()
 {
     DHLOGI("DStreamOperator::Release, begin release stream operator.");
 
+    // Offline snapshots cannot outlive the session, the sink channel goes away with it.
+    std::vector<OHOS::sptr<DOfflineStreamOperator>> offlineOperators;
+    {
+        std::lock_guard<std::mutex> autoLock(offlineOperatorLock_);
+        offlineOperators.swap(offlineOperators_);
+    }
+    for (auto &offlineOperator : offlineOperators) {
+        offlineOperator->Release();
+    }
     std::vector<int> streamIds = GetStreamIds();
     SetCapturing(false);
     ReleaseStreams(streamIds);
+    std::map<int, std::shared_ptr<DBufferRing>> bufferRings;
+    {
+        std::lock_guard<std::mutex> autoLock(bufferRingLock_);
+        bufferRings.swap(bufferRingMap_);
+    }
+    for (auto &iter : bufferRings) {
+        iter.second->Release();
+    }
     if (latestStreamSetting_) {
         latestStreamSetting_ = nullptr;
     }
@@ -978,13 +1299,12 @@ void DStreamOperator::Release()
         std::lock_guard<std::mutex> lockStream(halStreamLock_);
         halStreamMap_.clear();
     }
+    ClearNegotiationCache();
     std::lock_guard<std::mutex> lock(streamAttrLock_);
     dcStreamInfoMap_.clear();
     halCaptureInfoMap_.clear();
-    enableShutterCbkMap_.clear();
-    acceptedBufferNum_.clear();
+    std::atomic_store(&hotStates_, std::make_shared<const DStreamHotStateList>());
     cachedDCaptureInfoList_.clear();
-    notifyCaptureStartedMap_.clear();
     dcStreamOperatorCallback_ = nullptr;
     dcStreamOperatorCallback__V1_2 = nullptr;
     dcStreamOperatorCallback__V1_3 = nullptr;
@@ -1138,36 +1458,30 @@ DCamRetCode DStreamOperator::GetInputCaptureInfo(const CaptureInfo& srcCaptureIn
 
 bool DStreamOperator::CompareCandidates(const ResolutionCandidate& src1, const ResolutionCandidate& src2)
 {
-    DHLOGI("Start CompareCandidates");
+    // Same aspect ratio first, then the closest aspect ratio.
     if (src1.isSameRatio != src2.isSameRatio) {
-        DHLOGI("Priority for the same aspect ratio");
         return src1.isSameRatio;
     }
     if (src1.isSameRatio) {
+        // Both >= target with the smallest area, then both <= target with the largest area, then the larger one.
         if (src1.isAboveTarget && src2.isAboveTarget) {
-            DHLOGI("First Priority: Both width and height are >= target, with the smallest area.");
             return src1.area < src2.area;
         }
         if (src1.isBelowTarget && src2.isBelowTarget) {
-            DHLOGI("Second priority: Both width and height are <= target, with the largest area.");
             return src1.area > src2.area;
         }
-        DHLOGI("Prioritize those with the same aspect ratio, and choose the larger one.");
         return src1.isAboveTarget ? true : false;
     }
     if (src1.diffRatio != src2.diffRatio) {
-        DHLOGI("Aspect ratios vary; sorted by proximity to the target aspect ratio.");
         return src1.diffRatio < src2.diffRatio;
     }
     if (src1.isAboveTarget && src2.isAboveTarget) {
-        DHLOGI("Third Priority: Aspect ratios differ but are both >= target, with the smallest area.");
         return src1.area < src2.area;
     }
     if (src1.isBelowTarget && src2.isBelowTarget) {
-        DHLOGI("Priority Four: Aspect ratios differ but are all <= target, with the largest area.");
         return src1.area > src2.area;
     }
-    DHLOGI("Priority Five: Different aspect ratios, some larger and some smaller, based on the closest area.");
+    // Some larger and some smaller, based on the closest area.
     return std::abs(src1.area - src1.targetWidth * src1.targetHeight) <
            std::abs(src2.area - src2.targetWidth * src2.targetHeight);
 }
@@ -1175,17 +1489,13 @@ bool DStreamOperator::CompareCandidates(const ResolutionCandidate& src1, const R
 void DStreamOperator::ResolutionAlignment(std::vector<std::shared_ptr<DCStreamInfo>> &streamInfo,
     std::shared_ptr<DCCaptureInfo> &captureInfo)
 {
-    DHLOGI("Start ResolutionAlignment");
     if (captureInfo == nullptr) {
         DHLOGE("DStreamOperator::ChooseSuitableResolution, captureInfo is null.");
         return;
     }
-    std::vector<DCResolution> supportedResolutionList;
-    if ((streamInfo.at(0))->type_ == DCStreamType::CONTINUOUS_FRAME) {
-        supportedResolutionList = dcSupportedPreviewResolutionMap_[captureInfo->format_];
-    } else {
-        supportedResolutionList = dcSupportedPhotoResolutionMap_[captureInfo->format_];
-    }
+    const std::vector<DCResolution> &supportedResolutionList =
+        ((streamInfo.at(0))->type_ == DCStreamType::CONTINUOUS_FRAME) ?
+        dcSupportedPreviewResolutionMap_[captureInfo->format_] : dcSupportedPhotoResolutionMap_[captureInfo->format_];
 
     for (auto stream : streamInfo) {
         captureInfo->streamIds_.push_back(stream->streamId_);
@@ -1193,13 +1503,11 @@ void DStreamOperator::ResolutionAlignment(std::vector<std::shared_ptr<DCStreamIn
 
     std::lock_guard<std::mutex> autoLock(streamAttrLock_);
     std::vector<ResolutionCandidate> candidates;
+    candidates.reserve(supportedResolutionList.size());
     for (auto& profile : supportedResolutionList) {
         candidates.emplace_back(profile.width_, profile.height_, streamInfo.at(0)->width_, streamInfo.at(0)->height_);
     }
-    std::sort(candidates.begin(), candidates.end(),
-        [this](const ResolutionCandidate& src1, const ResolutionCandidate& src2) {
-        return this->CompareCandidates(src1, src2);
-    });
+    std::sort(candidates.begin(), candidates.end(), CompareCandidates);
     if (candidates.size() > 0) {
         DHLOGI("ResolutionAlignment resolusion change: %{public}d x %{public}d -> %{public}d x %{public}d",
             captureInfo->width_, captureInfo->height_, candidates[0].srcWidth, candidates[0].srcHeight);
@@ -1211,23 +1519,16 @@ void DStreamOperator::ResolutionAlignment(std::vector<std::shared_ptr<DCStreamIn
 std::shared_ptr<DCCaptureInfo> DStreamOperator::BuildSuitableCaptureInfo(const CaptureInfo& srcCaptureInfo,
     std::vector<std::shared_ptr<DCStreamInfo>> &srcStreamInfo)
 {
-    std::shared_ptr<DCCaptureInfo> captureInfo = std::make_shared<DCCaptureInfo>();
-
-    ChooseSuitableFormat(srcStreamInfo, captureInfo);
     OHOS::sptr<DCameraProvider> dProvider = DCameraProvider::GetInstance();
     if (dProvider == nullptr) {
         DHLOGE("DCameraProvider not init.");
+        std::shared_ptr<DCCaptureInfo> captureInfo = std::make_shared<DCCaptureInfo>();
+        ChooseSuitableFormat(srcStreamInfo, captureInfo);
         return captureInfo;
     }
     bool isForceSwitch = dProvider->IsForceSwitch();
     DHLOGI("BuildSuitableCaptureInfo ForceSwitch: %{public}d", isForceSwitch);
-    if (isForceSwitch) {
-        ResolutionAlignment(srcStreamInfo, captureInfo);
-    } else {
-        ChooseSuitableResolution(srcStreamInfo, captureInfo);
-    }
-    ChooseSuitableDataSpace(srcStreamInfo, captureInfo);
-    ChooseSuitableEncodeType(srcStreamInfo, captureInfo);
+    std::shared_ptr<DCCaptureInfo> captureInfo = GetNegotiatedCaptureInfo(srcStreamInfo, isForceSwitch);
 
     DCameraSettings dcSetting;
     dcSetting.type_ = DCSettingsType::UPDATE_METADATA;
@@ -1252,6 +1553,65 @@ std::shared_ptr<DCCaptureInfo> DStreamOperator::BuildSuitableCaptureInfo(const C
     return captureInfo;
 }
 
+std::shared_ptr<DCCaptureInfo> DStreamOperator::GetNegotiatedCaptureInfo(
+    std::vector<std::shared_ptr<DCStreamInfo>> &streamInfo, bool isForceSwitch)
+{
+    std::string key = GetNegotiationKey(streamInfo, isForceSwitch);
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> autoLock(negotiationCacheLock_);
+        auto iter = negotiationCache_.find(key);
+        if (iter != negotiationCache_.end()) {
+            return std::make_shared<DCCaptureInfo>(iter->second);
+        }
+        generation = negotiationGeneration_;
+    }
+
+    std::shared_ptr<DCCaptureInfo> captureInfo = std::make_shared<DCCaptureInfo>();
+    ChooseSuitableFormat(streamInfo, captureInfo);
+    if (isForceSwitch) {
+        ResolutionAlignment(streamInfo, captureInfo);
+    } else {
+        ChooseSuitableResolution(streamInfo, captureInfo);
+    }
+    ChooseSuitableDataSpace(streamInfo, captureInfo);
+    ChooseSuitableEncodeType(streamInfo, captureInfo);
+    DHLOGI("Negotiated capture info: format=%{public}d, width=%{public}d, height=%{public}d, encodeType=%{public}d",
+        captureInfo->format_, captureInfo->width_, captureInfo->height_, captureInfo->encodeType_);
+
+    std::lock_guard<std::mutex> autoLock(negotiationCacheLock_);
+    if (generation == negotiationGeneration_) {
+        if (negotiationCache_.size() >= NEGOTIATION_CACHE_MAX_SIZE) {
+            negotiationCache_.clear();
+        }
+        negotiationCache_.emplace(key, *captureInfo);
+    }
+    return captureInfo;
+}
+
+std::string DStreamOperator::GetNegotiationKey(const std::vector<std::shared_ptr<DCStreamInfo>> &streamInfo,
+    bool isForceSwitch)
+{
+    std::string key = isForceSwitch ? "F" : "N";
+    for (const auto &stream : streamInfo) {
+        if (stream == nullptr) {
+            continue;
+        }
+        key += ";" + std::to_string(stream->streamId_) + ":" + std::to_string(static_cast<int32_t>(stream->type_)) +
+            ":" + std::to_string(stream->format_) + ":" + std::to_string(stream->width_) + "x" +
+            std::to_string(stream->height_) + ":" + std::to_string(static_cast<int32_t>(stream->encodeType_)) + ":" +
+            std::to_string(stream->dataspace_);
+    }
+    return key;
+}
+
+void DStreamOperator::ClearNegotiationCache()
+{
+    std::lock_guard<std::mutex> autoLock(negotiationCacheLock_);
+    negotiationCache_.clear();
+    negotiationGeneration_++;
+}
+
 void DStreamOperator::ChooseSuitableFormat(std::vector<std::shared_ptr<DCStreamInfo>> &streamInfo,
     std::shared_ptr<DCCaptureInfo> &captureInfo)
 {
@@ -1297,12 +1657,9 @@ void DStreamOperator::ChooseSuitableResolution(std::vector<std::shared_ptr<DCStr
         return;
     }
 
-    std::vector<DCResolution> supportedResolutionList;
-    if ((streamInfo.at(0))->type_ == DCStreamType::CONTINUOUS_FRAME) {
-        supportedResolutionList = dcSupportedVideoResolutionMap_[captureInfo->format_];
-    } else {
-        supportedResolutionList = dcSupportedPhotoResolutionMap_[captureInfo->format_];
-    }
+    const std::vector<DCResolution> &supportedResolutionList =
+        ((streamInfo.at(0))->type_ == DCStreamType::CONTINUOUS_FRAME) ?
+        dcSupportedVideoResolutionMap_[captureInfo->format_] : dcSupportedPhotoResolutionMap_[captureInfo->format_];
 
     for (auto stream : streamInfo) {
         captureInfo->streamIds_.push_back(stream->streamId_);
@@ -1318,7 +1675,7 @@ void DStreamOperator::ChooseSuitableResolution(std::vector<std::shared_ptr<DCStr
         if (iter.second->type_ != (streamInfo.at(0))->type_) {
             continue;
         }
-        for (auto resolution : supportedResolutionList) {
+        for (const auto &resolution : supportedResolutionList) {
             if ((resolution.width_ == iter.second->width_) &&
                 (resolution.height_ == iter.second->height_) &&
                 (tempResolution < resolution)) {
@@ -1459,25 +1816,6 @@ void DStreamOperator::InsertCaptureInfo(int32_t captureId, std::shared_ptr<Captu
     halCaptureInfoMap_.emplace(captureId, captureInfo);
 }
 
-int32_t DStreamOperator::FindCaptureIdByStreamId(int32_t streamId)
-{
-    std::lock_guard<std::mutex> autoLock(streamAttrLock_);
-    int32_t captureId = -1;
-    for (auto iter = halCaptureInfoMap_.begin(); iter != halCaptureInfoMap_.end(); iter++) {
-        std::shared_ptr<CaptureInfo> captureInfo = iter->second;
-        if (captureInfo == nullptr) {
-            DHLOGE("DStreamOperator::FindCaptureIdByStreamId, halCaptureInfoMap_ iter.second is null.");
-            continue;
-        }
-        std::vector<int> streamIds = captureInfo->streamIds_;
-        if (std::find(streamIds.begin(), streamIds.end(), streamId) != streamIds.end()) {
-            captureId = iter->first;
-            break;
-        }
-    }
-    return captureId;
-}
-
 void DStreamOperator::EraseCaptureInfo(int32_t captureId)
 {
     std::lock_guard<std::mutex> autoLock(streamAttrLock_);
@@ -1496,12 +1834,14 @@ std::shared_ptr<DCStreamInfo> DStreamOperator::FindDCStreamById(int32_t streamId
 
 void DStreamOperator::InsertDCStream(int32_t streamId, std::shared_ptr<DCStreamInfo>& dcStreamInfo)
 {
+    ClearNegotiationCache();
     std::lock_guard<std::mutex> autoLock(streamAttrLock_);
     dcStreamInfoMap_.emplace(streamId, dcStreamInfo);
 }
 
 void DStreamOperator::EraseDCStream(int32_t streamId)
 {
+    ClearNegotiationCache();
     std::lock_guard<std::mutex> autoLock(streamAttrLock_);
     dcStreamInfoMap_.erase(streamId);
 }
@@ -1522,60 +1862,57 @@ void DStreamOperator::ExtractNotCaptureStream(bool isStreaming,
     }
 }
 
-bool DStreamOperator::FindEnableShutter(int32_t streamId)
+std::shared_ptr<DStreamHotState> DStreamOperator::FindHotState(int32_t streamId)
 {
-    std::lock_guard<std::mutex> autoLock(streamAttrLock_);
-    auto iter = enableShutterCbkMap_.find(streamId);
-    if (iter == enableShutterCbkMap_.end()) {
-        return false;
+    // A capture holds a handful of streams, scanning the snapshot is cheaper than any keyed lookup.
+    auto hotStates = std::atomic_load(&hotStates_);
+    for (const auto &hotState : *hotStates) {
+        if (hotState->streamId == streamId) {
+            return hotState;
+        }
     }
-    return iter->second;
-}
-
-void DStreamOperator::InsertEnableShutter(int32_t streamId, bool enableShutterCallback)
-{
-    std::lock_guard<std::mutex> autoLock(streamAttrLock_);
-    enableShutterCbkMap_.emplace(streamId, enableShutterCallback);
+    return nullptr;
 }
 
-void DStreamOperator::EraseEnableShutter(int32_t streamId)
+void DStreamOperator::InsertHotStates(int32_t captureId, const CaptureInfo &info,
+    const std::vector<std::shared_ptr<DCameraStream>> &streams)
 {
     std::lock_guard<std::mutex> autoLock(streamAttrLock_);
-    enableShutterCbkMap_.erase(streamId);
-}
-
-int32_t DStreamOperator::FindStreamCaptureBufferNum(const pair<int, int>& streamPair)
-{
-    std::lock_guard<std::mutex> autoLock(streamAttrLock_);
-    auto iter = acceptedBufferNum_.find(streamPair);
-    if (iter == acceptedBufferNum_.end()) {
-        return 0;
+    auto hotStates = std::make_shared<DStreamHotStateList>(*std::atomic_load(&hotStates_));
+    for (size_t i = 0; i < streams.size() && i < info.streamIds_.size(); i++) {
+        auto hotState = std::make_shared<DStreamHotState>();
+        hotState->captureId = captureId;
+        hotState->streamId = info.streamIds_[i];
+        hotState->stream = streams[i];
+        hotState->enableShutter = info.enableShutterCallback_;
+        auto dcStreamInfo = dcStreamInfoMap_.find(hotState->streamId);
+        hotState->isSnapshot = dcStreamInfo != dcStreamInfoMap_.end() && dcStreamInfo->second != nullptr &&
+            dcStreamInfo->second->type_ == DCStreamType::SNAPSHOT_FRAME;
+        auto iter = std::find_if(hotStates->begin(), hotStates->end(),
+            [&hotState](const auto &item) { return item->streamId == hotState->streamId; });
+        if (iter != hotStates->end()) {
+            *iter = hotState;
+        } else {
+            hotStates->push_back(hotState);
+        }
     }
-    return iter->second;
+    std::atomic_store(&hotStates_, std::shared_ptr<const DStreamHotStateList>(hotStates));
 }
 
-void DStreamOperator::AddStreamCaptureBufferNum(const pair<int, int>& streamPair)
+std::shared_ptr<DStreamHotState> DStreamOperator::EraseHotState(int32_t captureId, int32_t streamId)
 {
     std::lock_guard<std::mutex> autoLock(streamAttrLock_);
-    acceptedBufferNum_[streamPair]++;
-}
-
-void DStreamOperator::EraseStreamCaptureBufferNum(const pair<int, int>& streamPair)
-{
-    std::lock_guard<std::mutex> autoLock(streamAttrLock_);
-    acceptedBufferNum_.erase(streamPair);
-}
-
-void DStreamOperator::InsertNotifyCaptureMap(int32_t streamId)
-{
-    std::lock_guard<std::mutex> autoLock(streamAttrLock_);
-    notifyCaptureStartedMap_.emplace(streamId, false);
-}
-
-void DStreamOperator::EraseNotifyCaptureMap(int32_t streamId)
-{
-    std::lock_guard<std::mutex> autoLock(streamAttrLock_);
-    notifyCaptureStartedMap_.erase(streamId);
+    auto hotStates = std::make_shared<DStreamHotStateList>(*std::atomic_load(&hotStates_));
+    auto iter = std::find_if(hotStates->begin(), hotStates->end(), [captureId, streamId](const auto &item) {
+        return item->captureId == captureId && item->streamId == streamId;
+    });
+    if (iter == hotStates->end()) {
+        return nullptr;
+    }
+    auto hotState = *iter;
+    hotStates->erase(iter);
+    std::atomic_store(&hotStates_, std::shared_ptr<const DStreamHotStateList>(hotStates));
+    return hotState;
 }
 } // namespace DistributedHardware
 } // namespace OHOS
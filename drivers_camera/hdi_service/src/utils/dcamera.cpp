@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,25 +14,30 @@
  */
 
 #include "dcamera.h"
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include "constants.h"
 #include "distributed_hardware_log.h"
+#include "parameter.h"
 
 namespace OHOS {
 namespace DistributedHardware {
-const uint32_t OFFSET2 = 2;
-const uint32_t OFFSET4 = 4;
 const uint32_t OFFSET6 = 6;
-const uint8_t PARAM_FC = 0xfc;
-const uint8_t PARAM_03 = 0x03;
-const uint8_t PARAM_F0 = 0xf0;
-const uint8_t PARAM_0F = 0x0f;
-const uint8_t PARAM_C0 = 0xc0;
+const uint32_t OFFSET8 = 8;
+const uint32_t OFFSET12 = 12;
+const uint32_t OFFSET16 = 16;
+const uint32_t OFFSET18 = 18;
 const uint8_t PARAM_3F = 0x3f;
+const uint8_t PARAM_FF = 0xff;
 const int INDEX_FIRST = 0;
 const int INDEX_SECOND = 1;
 const int INDEX_THIRD = 2;
 const int INDEX_FORTH = 3;
+const uint32_t BASE64_GROUP_BYTES = 3;
+const uint32_t BASE64_GROUP_CHARS = 4;
+const uint8_t BASE64_INVALID = 0xff;
 CamRetCode MapToExternalRetCode(DCamRetCode retCode)
 {
     switch (retCode) {
@@ -64,6 +69,22 @@ uint64_t GetCurrentLocalTimeStamp()
     return static_cast<uint64_t>(tmp.count());
 }
 
+int64_t GetCaptureAgeUs(int64_t captureTimeUs)
+{
+    if (captureTimeUs <= 0) {
+        return 0;
+    }
+    int64_t nowUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    int64_t ageUs = nowUs - captureTimeUs;
+    return (ageUs < 0 || ageUs > MAX_CAPTURE_AGE_US) ? 0 : ageUs;
+}
+
+uint64_t GetCaptureLocalTimeStamp(int64_t captureAgeUs)
+{
+    return GetCurrentLocalTimeStamp() - static_cast<uint64_t>(captureAgeUs / MSEC_TO_USEC_TIMES);
+}
+
 void SplitString(const std::string &str, std::vector<std::string> &tokens, const std::string &delimiters)
 {
     std::string::size_type lastPos = 0;
@@ -85,48 +106,46 @@ std::string Base64Encode(const unsigned char *toEncode, unsigned int len)
         DHLOGE("toEncode is null or len is zero.");
         return ret;
     }
-    int32_t length = static_cast<int32_t>(len);
-    uint32_t i = 0;
-    unsigned char charArray3[3];
-    unsigned char charArray4[4];
-
-    while (length--) {
-        charArray3[i++] = *(toEncode++);
-        if (i == sizeof(charArray3)) {
-            charArray4[INDEX_FIRST] = (charArray3[INDEX_FIRST] & PARAM_FC) >> OFFSET2;
-            charArray4[INDEX_SECOND] = ((charArray3[INDEX_FIRST] & PARAM_03) << OFFSET4) +
-                ((charArray3[INDEX_SECOND] & PARAM_F0) >> OFFSET4);
-            charArray4[INDEX_THIRD] = ((charArray3[INDEX_SECOND] & PARAM_0F) << OFFSET2) +
-                ((charArray3[INDEX_THIRD] & PARAM_C0) >> OFFSET6);
-            charArray4[INDEX_FORTH] = charArray3[INDEX_THIRD] & PARAM_3F;
-            for (i = 0; i < sizeof(charArray4); i++) {
-                ret += BASE_64_CHARS[charArray4[i]];
-            }
-            i = 0;
-        }
+    size_t groups = len / BASE64_GROUP_BYTES;
+    uint32_t remain = len % BASE64_GROUP_BYTES;
+    ret.resize((groups + (remain > 0 ? 1 : 0)) * BASE64_GROUP_CHARS);
+    char *out = &ret[0];
+    const char *alphabet = BASE_64_CHARS.c_str();
+    for (size_t i = 0; i < groups; i++, toEncode += BASE64_GROUP_BYTES, out += BASE64_GROUP_CHARS) {
+        uint32_t group = (static_cast<uint32_t>(toEncode[INDEX_FIRST]) << OFFSET16) |
+            (static_cast<uint32_t>(toEncode[INDEX_SECOND]) << OFFSET8) | toEncode[INDEX_THIRD];
+        out[INDEX_FIRST] = alphabet[(group >> OFFSET18) & PARAM_3F];
+        out[INDEX_SECOND] = alphabet[(group >> OFFSET12) & PARAM_3F];
+        out[INDEX_THIRD] = alphabet[(group >> OFFSET6) & PARAM_3F];
+        out[INDEX_FORTH] = alphabet[group & PARAM_3F];
     }
-
-    if (i > 0) {
-        uint32_t j = 0;
-        for (j = i; j < sizeof(charArray3); j++) {
-            charArray3[j] = '\0';
-        }
-        charArray4[INDEX_FIRST] = (charArray3[INDEX_FIRST] & PARAM_FC) >> OFFSET2;
-        charArray4[INDEX_SECOND] = ((charArray3[INDEX_FIRST] & PARAM_03) << OFFSET4) +
-            ((charArray3[INDEX_SECOND] & PARAM_F0) >> OFFSET4);
-        charArray4[INDEX_THIRD] = ((charArray3[INDEX_SECOND] & PARAM_0F) << OFFSET2) +
-            ((charArray3[INDEX_THIRD] & PARAM_C0) >> OFFSET6);
-        charArray4[INDEX_FORTH] = charArray3[INDEX_THIRD] & PARAM_3F;
-        for (j = 0; j < i + 1; j++) {
-            ret += BASE_64_CHARS[charArray4[j]];
-        }
-        while (i++ < sizeof(charArray3)) {
-            ret += '=';
+    if (remain > 0) {
+        uint32_t group = static_cast<uint32_t>(toEncode[INDEX_FIRST]) << OFFSET16;
+        if (remain > 1) {
+            group |= static_cast<uint32_t>(toEncode[INDEX_SECOND]) << OFFSET8;
         }
+        out[INDEX_FIRST] = alphabet[(group >> OFFSET18) & PARAM_3F];
+        out[INDEX_SECOND] = alphabet[(group >> OFFSET12) & PARAM_3F];
+        out[INDEX_THIRD] = remain > 1 ? alphabet[(group >> OFFSET6) & PARAM_3F] : '=';
+        out[INDEX_FORTH] = '=';
     }
     return ret;
 }
 
+// Maps every byte to its 6 bit value, BASE64_INVALID for bytes outside the alphabet including the '=' padding.
+static const std::array<uint8_t, UINT8_MAX + 1> &GetBase64DecodeTable()
+{
+    static const std::array<uint8_t, UINT8_MAX + 1> table = []() {
+        std::array<uint8_t, UINT8_MAX + 1> values;
+        values.fill(BASE64_INVALID);
+        for (size_t i = 0; i < BASE_64_CHARS.size(); i++) {
+            values[static_cast<uint8_t>(BASE_64_CHARS[i])] = static_cast<uint8_t>(i);
+        }
+        return values;
+    }();
+    return table;
+}
+
 std::string Base64Decode(const std::string& basicString)
 {
     std::string ret = "";
@@ -134,46 +153,33 @@ std::string Base64Decode(const std::string& basicString)
         DHLOGE("basicString is empty.");
         return ret;
     }
-    uint32_t i = 0;
-    int index = 0;
-    int len = static_cast<int>(basicString.size());
-    unsigned char charArray3[3];
-    unsigned char charArray4[4];
-
-    while (len-- && (basicString[index] != '=') && IsBase64(basicString[index])) {
-        charArray4[i++] = basicString[index];
-        index++;
-        if (i == sizeof(charArray4)) {
-            for (i = 0; i < sizeof(charArray4); i++) {
-                charArray4[i] = BASE_64_CHARS.find(charArray4[i]);
-            }
-            charArray3[INDEX_FIRST] = (charArray4[INDEX_FIRST] << OFFSET2) +
-                ((charArray4[INDEX_SECOND] & 0x30) >> OFFSET4);
-            charArray3[INDEX_SECOND] = ((charArray4[INDEX_SECOND] & 0xf) << OFFSET4) +
-                ((charArray4[INDEX_THIRD] & 0x3c) >> OFFSET2);
-            charArray3[INDEX_THIRD] = ((charArray4[INDEX_THIRD] & 0x3) << OFFSET6) + charArray4[INDEX_FORTH];
-            for (i = 0; i < sizeof(charArray3); i++) {
-                ret += charArray3[i];
-            }
-            i = 0;
-        }
+    const std::array<uint8_t, UINT8_MAX + 1> &table = GetBase64DecodeTable();
+    const unsigned char *in = reinterpret_cast<const unsigned char *>(basicString.data());
+    // Decoding stops at the padding or at the first byte outside the alphabet.
+    size_t len = 0;
+    while (len < basicString.size() && table[in[len]] != BASE64_INVALID) {
+        len++;
     }
-
-    if (i) {
-        uint32_t j = 0;
-        for (j = i; j < sizeof(charArray4); j++) {
-            charArray4[j] = 0;
-        }
-        for (j = 0; j < sizeof(charArray4); j++) {
-            charArray4[j] = BASE_64_CHARS.find(charArray4[j]);
-        }
-        charArray3[INDEX_FIRST] = (charArray4[INDEX_FIRST] << OFFSET2) +
-            ((charArray4[INDEX_SECOND] & 0x30) >> OFFSET4);
-        charArray3[INDEX_SECOND] = ((charArray4[INDEX_SECOND] & 0xf) << OFFSET4) +
-            ((charArray4[INDEX_THIRD] & 0x3c) >> OFFSET2);
-        charArray3[INDEX_THIRD] = ((charArray4[INDEX_THIRD] & 0x3) << OFFSET6) + charArray4[INDEX_FORTH];
-        for (j = 0; j < i - 1; j++) {
-            ret += charArray3[j];
+    size_t groups = len / BASE64_GROUP_CHARS;
+    uint32_t remain = len % BASE64_GROUP_CHARS;
+    // A partial group of n characters carries n - 1 bytes.
+    ret.resize(groups * BASE64_GROUP_BYTES + (remain > 0 ? remain - 1 : 0));
+    char *out = &ret[0];
+    for (size_t i = 0; i < groups; i++, in += BASE64_GROUP_CHARS, out += BASE64_GROUP_BYTES) {
+        uint32_t group = (static_cast<uint32_t>(table[in[INDEX_FIRST]]) << OFFSET18) |
+            (static_cast<uint32_t>(table[in[INDEX_SECOND]]) << OFFSET12) |
+            (static_cast<uint32_t>(table[in[INDEX_THIRD]]) << OFFSET6) | table[in[INDEX_FORTH]];
+        out[INDEX_FIRST] = static_cast<char>((group >> OFFSET16) & PARAM_FF);
+        out[INDEX_SECOND] = static_cast<char>((group >> OFFSET8) & PARAM_FF);
+        out[INDEX_THIRD] = static_cast<char>(group & PARAM_FF);
+    }
+    if (remain > 1) {
+        uint32_t group = (static_cast<uint32_t>(table[in[INDEX_FIRST]]) << OFFSET18) |
+            (static_cast<uint32_t>(table[in[INDEX_SECOND]]) << OFFSET12);
+        out[INDEX_FIRST] = static_cast<char>((group >> OFFSET16) & PARAM_FF);
+        if (remain > BASE64_GROUP_BYTES - 1) {
+            group |= static_cast<uint32_t>(table[in[INDEX_THIRD]]) << OFFSET6;
+            out[INDEX_SECOND] = static_cast<char>((group >> OFFSET8) & PARAM_FF);
         }
     }
     return ret;
@@ -189,5 +195,21 @@ bool IsDhBaseInfoInvalid(const DHBase& dhBase)
     return dhBase.deviceId_.empty() || (dhBase.deviceId_.length() > DEVID_MAX_LENGTH) ||
         dhBase.dhId_.empty() || (dhBase.dhId_.length() > DHID_MAX_LENGTH);
 }
+
+bool GetSysPara(const char *key, int32_t &value)
+{
+    CHECK_AND_RETURN_RET_LOG(key == nullptr, false, "key is nullptr");
+    char paraValue[SYS_PARA_VALUE_LEN] = {0};
+    int32_t res = GetParameter(key, "-1", paraValue, sizeof(paraValue));
+    CHECK_AND_RETURN_RET_LOG(res <= 0, false, "GetParameter fail, key:%{public}s res:%{public}d", key, res);
+    char *end = nullptr;
+    long result = strtol(paraValue, &end, 10); // 10 for decimal
+    if (end == paraValue || *end != '\0' || result < INT32_MIN || result > INT32_MAX) {
+        DHLOGE("Invalid system parameter, key:%{public}s value:%{public}s", key, paraValue);
+        return false;
+    }
+    value = static_cast<int32_t>(result);
+    return true;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
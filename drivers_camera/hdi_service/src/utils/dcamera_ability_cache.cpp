@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dcamera_ability_cache.h"
+
+#include <functional>
+
+#include "distributed_hardware_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+DCameraAbilityCache &DCameraAbilityCache::GetInstance()
+{
+    static DCameraAbilityCache instance;
+    return instance;
+}
+
+std::shared_ptr<cJSON> DCameraAbilityCache::Parse(const std::string &abilityInfo)
+{
+    size_t hash = std::hash<std::string>()(abilityInfo);
+    {
+        std::lock_guard<std::mutex> autoLock(cacheMutex_);
+        for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+            // The hash only narrows the search, a collision must not hand out another device's ability.
+            if (iter->hash == hash && iter->abilityInfo == abilityInfo) {
+                entries_.splice(entries_.begin(), entries_, iter);
+                return entries_.front().root;
+            }
+        }
+    }
+
+    cJSON *rootValue = cJSON_Parse(abilityInfo.c_str());
+    if (rootValue == nullptr || !cJSON_IsObject(rootValue)) {
+        DHLOGE("The ability info is not a json object.");
+        cJSON_Delete(rootValue);
+        return nullptr;
+    }
+    std::shared_ptr<cJSON> root(rootValue, [](cJSON *item) { cJSON_Delete(item); });
+    DHLOGI("Parse ability info, hash: %{public}zu, length: %{public}zu", hash, abilityInfo.length());
+    Insert(abilityInfo, root);
+    return root;
+}
+
+void DCameraAbilityCache::Insert(const std::string &abilityInfo, const std::shared_ptr<cJSON> &root)
+{
+    if (root == nullptr || !cJSON_IsObject(root.get())) {
+        return;
+    }
+    size_t hash = std::hash<std::string>()(abilityInfo);
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    entries_.remove_if([hash, &abilityInfo](const AbilityEntry &entry) {
+        return entry.hash == hash && entry.abilityInfo == abilityInfo;
+    });
+    entries_.push_front({ hash, abilityInfo, root });
+    if (entries_.size() > MAX_CACHED_ABILITIES) {
+        entries_.pop_back();
+    }
+}
+
+void DCameraAbilityCache::Clear()
+{
+    std::lock_guard<std::mutex> autoLock(cacheMutex_);
+    entries_.clear();
+}
+} // namespace DistributedHardware
+} // namespace OHOS
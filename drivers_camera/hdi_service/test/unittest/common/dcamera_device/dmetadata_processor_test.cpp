@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -13,11 +13,22 @@
  * limitations under the License.
  */
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <atomic>
 #include <memory>
+#include <sys/mman.h>
 #include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+#include "ashmem.h"
+#include "dcamera_ability_cache.h"
 #include "metadata_utils.h"
+#include "securec.h"
+
+#define private public
 #include "dmetadata_processor.h"
+#undef private
 
 using namespace testing::ext;
 
@@ -49,6 +60,52 @@ constexpr const char* VALID_ABILITY_JSON = R"({
 })";
 
 constexpr const char* INVALID_ABILITY_JSON = R"({ "ProtocolVer": "1.0", "Position": "BACK" )";
+constexpr uint32_t INDEXED_TEST_ITEM_COUNT = 20;
+constexpr uint32_t INDEXED_TEST_DATA_CAPACITY = 400;
+
+// Collects device control tags with a known type, enough for a buffer that is looked up through the item index.
+static std::vector<uint32_t> GetIndexedTestTags()
+{
+    std::vector<uint32_t> tags;
+    uint32_t dataType = 0;
+    for (uint32_t tag = OHOS_DEVICE_CONTROL_START; tags.size() < INDEXED_TEST_ITEM_COUNT + 1; tag++) {
+        if (OHOS::Camera::GetCameraMetadataItemType(tag, &dataType) == CAM_META_SUCCESS) {
+            tags.push_back(tag);
+        }
+    }
+    return tags;
+}
+
+// Adds the first count tags, last tag first, so positions differ from the tag order.
+static void AddIndexedTestItems(common_metadata_header_t *header, const std::vector<uint32_t> &tags, uint32_t count)
+{
+    int64_t value = 0;
+    for (uint32_t i = count; i > 0; i--) {
+        ASSERT_EQ(OHOS::Camera::AddCameraMetadataItem(header, tags[i - 1], &value, 1), CAM_META_SUCCESS);
+    }
+}
+
+// Checks every tag is found at the position a linear scan of the entries finds it.
+static void ExpectIndexedItems(common_metadata_header_t *header, const std::vector<uint32_t> &tags)
+{
+    camera_metadata_item_entry_t *entries = reinterpret_cast<camera_metadata_item_entry_t *>(
+        reinterpret_cast<uint8_t *>(header) + header->items_start);
+    for (uint32_t tag : tags) {
+        uint32_t position = 0;
+        while (position < header->item_count && entries[position].item != tag) {
+            position++;
+        }
+        camera_metadata_item_t item;
+        int ret = OHOS::Camera::FindCameraMetadataItem(header, tag, &item);
+        if (position == header->item_count) {
+            EXPECT_EQ(ret, CAM_META_ITEM_NOT_FOUND);
+            continue;
+        }
+        ASSERT_EQ(ret, CAM_META_SUCCESS);
+        EXPECT_EQ(item.index, position);
+        EXPECT_EQ(item.item, tag);
+    }
+}
 
 void DMetadataProcessorTest::SetUpTestCase(void)
 {
@@ -528,5 +585,521 @@ HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_014, TestSize.L
     SUCCEED();
 }
 
+/**
+ * @tc.name: dcamera_metadata_processor_test_015
+ * @tc.desc: Verify ON_CHANGED results only carry the changed tags and the result buffer is reused
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_015, TestSize.Level1)
+{
+    ASSERT_NE(processor_, nullptr);
+    processor_->SetMetadataResultMode(ResultCallbackMode::ON_CHANGED);
+
+    std::vector<uint32_t> itemCounts;
+    std::vector<const common_metadata_header_t *> headers;
+    std::function<void(uint64_t, std::shared_ptr<OHOS::Camera::CameraMetadata>)> cb =
+        [&](uint64_t timestamp, std::shared_ptr<OHOS::Camera::CameraMetadata> result) {
+        itemCounts.push_back(OHOS::Camera::GetCameraMetadataItemCount(result->get()));
+        headers.push_back(result->get());
+    };
+    processor_->SetResultCallback(cb);
+
+    std::shared_ptr<CameraAbility> ability = std::make_shared<CameraAbility>(10, 10);
+    uint8_t aeMode = OHOS_CAMERA_AE_MODE_ON;
+    uint8_t awbMode = OHOS_CAMERA_AWB_MODE_AUTO;
+    ability->addEntry(OHOS_CONTROL_AE_MODE, &aeMode, 1);
+    ability->addEntry(OHOS_CONTROL_AWB_MODE, &awbMode, 1);
+    std::string metadataStr = OHOS::Camera::MetadataUtils::EncodeToString(ability);
+    processor_->SaveResultMetadata(Base64Encode(reinterpret_cast<const unsigned char*>(metadataStr.c_str()),
+        metadataStr.length()));
+
+    aeMode = OHOS_CAMERA_AE_MODE_OFF;
+    ability->updateEntry(OHOS_CONTROL_AE_MODE, &aeMode, 1);
+    metadataStr = OHOS::Camera::MetadataUtils::EncodeToString(ability);
+    processor_->SaveResultMetadata(Base64Encode(reinterpret_cast<const unsigned char*>(metadataStr.c_str()),
+        metadataStr.length()));
+
+    ASSERT_EQ(itemCounts.size(), 2);
+    EXPECT_EQ(itemCounts[0], 2);
+    EXPECT_EQ(itemCounts[1], 1);
+    EXPECT_EQ(processor_->changedResultSet_.size(), 1);
+    EXPECT_EQ(processor_->changedResultSet_.count(OHOS_CONTROL_AE_MODE), 1);
+    EXPECT_EQ(headers[0], headers[1]);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_016
+ * @tc.desc: Verify an ability string is parsed once and shared by later enables
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_016, TestSize.Level1)
+{
+    ASSERT_NE(processor_, nullptr);
+    DCameraAbilityCache &cache = DCameraAbilityCache::GetInstance();
+    cache.Clear();
+    EXPECT_EQ(cache.Parse(INVALID_ABILITY_JSON), nullptr);
+    EXPECT_EQ(cache.Parse("[1,2,3]"), nullptr);
+
+    std::shared_ptr<cJSON> root = cache.Parse(VALID_ABILITY_JSON);
+    ASSERT_NE(root, nullptr);
+    EXPECT_EQ(processor_->InitDCameraAbility(VALID_ABILITY_JSON), SUCCESS);
+    EXPECT_EQ(cache.Parse(VALID_ABILITY_JSON), root);
+
+    std::shared_ptr<DMetadataProcessor> other = std::make_shared<DMetadataProcessor>();
+    EXPECT_EQ(other->InitDCameraAbility(VALID_ABILITY_JSON), SUCCESS);
+    EXPECT_EQ(other->dCameraPosition_, processor_->dCameraPosition_);
+    EXPECT_EQ(other->allResultSet_, processor_->allResultSet_);
+    cache.Clear();
+    EXPECT_NE(cache.Parse(VALID_ABILITY_JSON), nullptr);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_017
+ * @tc.desc: Verify PER_FRAME results reuse one buffer and only recopy a changed producer result
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_017, TestSize.Level1)
+{
+    ASSERT_NE(processor_, nullptr);
+    processor_->SetMetadataResultMode(ResultCallbackMode::PER_FRAME);
+    OHOS::Camera::CameraMetadata *lastResult = nullptr;
+    int64_t lastTimestamp = 0;
+    uint8_t lastAeMode = 0;
+    std::function<void(uint64_t, std::shared_ptr<OHOS::Camera::CameraMetadata>)> cb =
+        [&](uint64_t timestamp, std::shared_ptr<OHOS::Camera::CameraMetadata> result) {
+        lastResult = result.get();
+        camera_metadata_item_t item;
+        if (OHOS::Camera::FindCameraMetadataItem(result->get(), OHOS_SENSOR_INFO_TIMESTAMP, &item) == 0) {
+            lastTimestamp = item.data.i64[0];
+        }
+        if (OHOS::Camera::FindCameraMetadataItem(result->get(), OHOS_CONTROL_AE_MODE, &item) == 0) {
+            lastAeMode = item.data.u8[0];
+        }
+    };
+    processor_->SetResultCallback(cb);
+
+    std::shared_ptr<CameraAbility> ability = std::make_shared<CameraAbility>(10, 10);
+    uint8_t aeMode = OHOS_CAMERA_AE_MODE_ON;
+    ability->addEntry(OHOS_CONTROL_AE_MODE, &aeMode, 1);
+    std::string metadataStr = OHOS::Camera::MetadataUtils::EncodeToString(ability);
+    processor_->SaveResultMetadata(Base64Encode(reinterpret_cast<const unsigned char*>(metadataStr.c_str()),
+        metadataStr.length()));
+
+    processor_->UpdateResultMetadata(100);
+    OHOS::Camera::CameraMetadata *firstResult = lastResult;
+    EXPECT_EQ(lastTimestamp, 100);
+    EXPECT_EQ(lastAeMode, OHOS_CAMERA_AE_MODE_ON);
+    processor_->UpdateResultMetadata(200);
+    EXPECT_EQ(lastResult, firstResult);
+    EXPECT_EQ(lastTimestamp, 200);
+
+    aeMode = OHOS_CAMERA_AE_MODE_OFF;
+    ability->updateEntry(OHOS_CONTROL_AE_MODE, &aeMode, 1);
+    metadataStr = OHOS::Camera::MetadataUtils::EncodeToString(ability);
+    processor_->SaveResultMetadata(Base64Encode(reinterpret_cast<const unsigned char*>(metadataStr.c_str()),
+        metadataStr.length()));
+    processor_->UpdateResultMetadata(300);
+    EXPECT_EQ(lastResult, firstResult);
+    EXPECT_EQ(lastTimestamp, 300);
+    EXPECT_EQ(lastAeMode, OHOS_CAMERA_AE_MODE_OFF);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_018
+ * @tc.desc: Verify a result still held by the callback is never overwritten
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_018, TestSize.Level1)
+{
+    ASSERT_NE(processor_, nullptr);
+    processor_->SetMetadataResultMode(ResultCallbackMode::PER_FRAME);
+    std::vector<std::shared_ptr<OHOS::Camera::CameraMetadata>> heldResults;
+    std::function<void(uint64_t, std::shared_ptr<OHOS::Camera::CameraMetadata>)> cb =
+        [&](uint64_t timestamp, std::shared_ptr<OHOS::Camera::CameraMetadata> result) {
+        heldResults.push_back(result);
+    };
+    processor_->SetResultCallback(cb);
+
+    std::shared_ptr<CameraAbility> ability = std::make_shared<CameraAbility>(10, 10);
+    uint8_t aeMode = OHOS_CAMERA_AE_MODE_ON;
+    ability->addEntry(OHOS_CONTROL_AE_MODE, &aeMode, 1);
+    std::string metadataStr = OHOS::Camera::MetadataUtils::EncodeToString(ability);
+    processor_->SaveResultMetadata(Base64Encode(reinterpret_cast<const unsigned char*>(metadataStr.c_str()),
+        metadataStr.length()));
+
+    processor_->UpdateResultMetadata(100);
+    processor_->UpdateResultMetadata(200);
+    processor_->UpdateResultMetadata(300);
+    ASSERT_EQ(heldResults.size(), 3);
+    EXPECT_NE(heldResults[0], heldResults[1]);
+    EXPECT_NE(heldResults[1], heldResults[2]);
+    EXPECT_NE(heldResults[0], heldResults[2]);
+    camera_metadata_item_t item;
+    int32_t ret = OHOS::Camera::FindCameraMetadataItem(heldResults[0]->get(), OHOS_SENSOR_INFO_TIMESTAMP, &item);
+    ASSERT_EQ(ret, CAM_META_SUCCESS);
+    EXPECT_EQ(item.data.i64[0], 100);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_019
+ * @tc.desc: Verify an ability with a large payload survives the vector round trip and a truncated vector is refused
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_019, TestSize.Level1)
+{
+    constexpr size_t configCount = 6000;
+    std::shared_ptr<CameraAbility> ability = std::make_shared<CameraAbility>(10, configCount * sizeof(int32_t) * 2);
+    std::vector<int32_t> configs(configCount);
+    for (size_t i = 0; i < configCount; i++) {
+        configs[i] = static_cast<int32_t>(i);
+    }
+    ability->addEntry(OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS, configs.data(), configs.size());
+    uint8_t aeMode = OHOS_CAMERA_AE_MODE_ON;
+    ability->addEntry(OHOS_CONTROL_AE_MODE, &aeMode, 1);
+    camera_rational_t aeStep = { 1, 3 };
+    ability->addEntry(OHOS_CONTROL_AE_COMPENSATION_STEP, &aeStep, 1);
+
+    std::vector<uint8_t> vec;
+    ASSERT_TRUE(OHOS::Camera::MetadataUtils::ConvertMetadataToVec(ability, vec));
+    EXPECT_EQ(vec.size(), vec.capacity());
+    std::shared_ptr<CameraAbility> decoded = nullptr;
+    OHOS::Camera::MetadataUtils::ConvertVecToMetadata(vec, decoded);
+    ASSERT_NE(decoded, nullptr);
+    camera_metadata_item_t item;
+    ASSERT_EQ(OHOS::Camera::FindCameraMetadataItem(decoded->get(), OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS,
+        &item), CAM_META_SUCCESS);
+    ASSERT_EQ(item.count, configCount);
+    EXPECT_EQ(item.data.i32[configCount - 1], static_cast<int32_t>(configCount - 1));
+    ASSERT_EQ(OHOS::Camera::FindCameraMetadataItem(decoded->get(), OHOS_CONTROL_AE_COMPENSATION_STEP, &item),
+        CAM_META_SUCCESS);
+    EXPECT_EQ(item.data.r[0].denominator, 3);
+    std::vector<uint8_t> reencoded;
+    ASSERT_TRUE(OHOS::Camera::MetadataUtils::ConvertMetadataToVec(decoded, reencoded));
+    EXPECT_EQ(reencoded, vec);
+
+    vec.resize(vec.size() - 1);
+    std::shared_ptr<CameraAbility> truncated = nullptr;
+    OHOS::Camera::MetadataUtils::ConvertVecToMetadata(vec, truncated);
+    EXPECT_EQ(truncated, nullptr);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_020
+ * @tc.desc: Verify settings decoded from a parcel keep every item, including rationals
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_020, TestSize.Level1)
+{
+    std::shared_ptr<CameraAbility> settings = std::make_shared<CameraAbility>(10, 100);
+    uint8_t aeMode = OHOS_CAMERA_AE_MODE_ON;
+    settings->addEntry(OHOS_CONTROL_AE_MODE, &aeMode, 1);
+    int32_t fpsRange[] = { 15, 30 };
+    settings->addEntry(OHOS_CONTROL_FPS_RANGES, fpsRange, sizeof(fpsRange) / sizeof(fpsRange[0]));
+    camera_rational_t aeStep = { 1, 3 };
+    settings->addEntry(OHOS_CONTROL_AE_COMPENSATION_STEP, &aeStep, 1);
+
+    MessageParcel parcel;
+    ASSERT_TRUE(OHOS::Camera::MetadataUtils::EncodeCameraMetadata(settings, parcel));
+    std::shared_ptr<CameraAbility> decoded = nullptr;
+    OHOS::Camera::MetadataUtils::DecodeCameraMetadata(parcel, decoded);
+    ASSERT_NE(decoded, nullptr);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemCount(decoded->get()), 3);
+    camera_metadata_item_t item;
+    ASSERT_EQ(OHOS::Camera::FindCameraMetadataItem(decoded->get(), OHOS_CONTROL_FPS_RANGES, &item), CAM_META_SUCCESS);
+    ASSERT_EQ(item.count, 2);
+    EXPECT_EQ(item.data.i32[1], 30);
+    ASSERT_EQ(OHOS::Camera::FindCameraMetadataItem(decoded->get(), OHOS_CONTROL_AE_COMPENSATION_STEP, &item),
+        CAM_META_SUCCESS);
+    EXPECT_EQ(item.data.r[0].numerator, 1);
+    EXPECT_EQ(item.data.r[0].denominator, 3);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_021
+ * @tc.desc: Verify items updated with slack keep their values through delete and compaction
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_021, TestSize.Level1)
+{
+    std::shared_ptr<CameraAbility> ability = std::make_shared<CameraAbility>(10, 400);
+    common_metadata_header_t *header = ability->get();
+    OHOS::Camera::SetCameraMetadataSlack(header, true);
+    std::vector<int32_t> fpsRanges = { 15, 30, 30, 30 };
+    ability->addEntry(OHOS_CONTROL_FPS_RANGES, fpsRanges.data(), fpsRanges.size());
+    std::vector<int32_t> configs(16, 1);
+    ability->addEntry(OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS, configs.data(), configs.size());
+    uint8_t aeMode = OHOS_CAMERA_AE_MODE_ON;
+    ability->addEntry(OHOS_CONTROL_AE_MODE, &aeMode, 1);
+
+    fpsRanges = { 15, 60 };
+    ASSERT_TRUE(ability->updateEntry(OHOS_CONTROL_FPS_RANGES, fpsRanges.data(), fpsRanges.size()));
+    fpsRanges = { 15, 30, 30, 30, 60, 60 };
+    ASSERT_TRUE(ability->updateEntry(OHOS_CONTROL_FPS_RANGES, fpsRanges.data(), fpsRanges.size()));
+    ASSERT_EQ(OHOS::Camera::DeleteCameraMetadataItem(header, OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS),
+        CAM_META_SUCCESS);
+    uint32_t slackDataCount = header->data_count;
+    ASSERT_EQ(OHOS::Camera::CompactCameraMetadata(header), CAM_META_SUCCESS);
+    EXPECT_LT(header->data_count, slackDataCount);
+    EXPECT_EQ(header->data_count, fpsRanges.size() * sizeof(int32_t));
+
+    camera_metadata_item_t item;
+    ASSERT_EQ(OHOS::Camera::FindCameraMetadataItem(header, OHOS_CONTROL_FPS_RANGES, &item), CAM_META_SUCCESS);
+    ASSERT_EQ(item.count, fpsRanges.size());
+    EXPECT_EQ(item.data.i32[5], 60);
+    ASSERT_EQ(OHOS::Camera::FindCameraMetadataItem(header, OHOS_CONTROL_AE_MODE, &item), CAM_META_SUCCESS);
+    EXPECT_EQ(item.data.u8[0], aeMode);
+    EXPECT_EQ(OHOS::Camera::FindCameraMetadataItem(header, OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS, &item),
+        CAM_META_ITEM_NOT_FOUND);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_022
+ * @tc.desc: Verify built-in tags of every section group resolve and undefined sections are rejected
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_022, TestSize.Level1)
+{
+    uint32_t dataType = 0;
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemType(OHOS_ABILITY_CAMERA_POSITION, &dataType), CAM_META_SUCCESS);
+    EXPECT_EQ(dataType, META_TYPE_BYTE);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemType(OHOS_CONTROL_FPS_RANGES, &dataType), CAM_META_SUCCESS);
+    EXPECT_EQ(dataType, META_TYPE_INT32);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemType(OHOS_SENSOR_INFO_MAX_FRAME_DURATION, &dataType),
+        CAM_META_SUCCESS);
+    EXPECT_EQ(dataType, META_TYPE_INT64);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemType(OHOS_CONTROL_SET_CUSTOM_OPTICAL_IMAGE_STABILIZATION_BIAS,
+        &dataType), CAM_META_SUCCESS);
+    EXPECT_EQ(dataType, META_TYPE_FLOAT);
+    EXPECT_STREQ(OHOS::Camera::GetCameraMetadataItemName(OHOS_ABILITY_CAMERA_POSITION), "cameraPosition");
+
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemType(OHOS_CAMERA_LENS << 16, &dataType), CAM_META_FAILURE);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemType(OHOS_STREAM_DEPTH << 16, &dataType), CAM_META_FAILURE);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemType(OHOS_ABILITY_SECTION_END << 16, &dataType),
+        CAM_META_FAILURE);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemName((OHOS_DEVICE_CONTROL + 0xFFF) << 16), nullptr);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_023
+ * @tc.desc: Verify large metadata crosses a parcel through ashmem and small metadata stays inline
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_023, TestSize.Level1)
+{
+    const uint32_t configCount = OHOS::Camera::ASHMEM_METADATA_THRESHOLD / sizeof(int32_t);
+    std::shared_ptr<CameraAbility> ability = std::make_shared<CameraAbility>(10, configCount * sizeof(int32_t));
+    std::vector<int32_t> configs(configCount);
+    for (uint32_t i = 0; i < configCount; i++) {
+        configs[i] = static_cast<int32_t>(i);
+    }
+    ability->addEntry(OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS, configs.data(), configs.size());
+
+    MessageParcel parcel;
+    ASSERT_TRUE(OHOS::Camera::MetadataUtils::EncodeCameraMetadataToAshmem(ability, parcel));
+    EXPECT_LT(parcel.GetDataSize(), OHOS::Camera::ASHMEM_METADATA_THRESHOLD);
+    std::shared_ptr<CameraAbility> decoded = nullptr;
+    OHOS::Camera::MetadataUtils::DecodeCameraMetadataFromAshmem(parcel, decoded);
+    ASSERT_NE(decoded, nullptr);
+    camera_metadata_item_t item;
+    ASSERT_EQ(OHOS::Camera::FindCameraMetadataItem(decoded->get(), OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS,
+        &item), CAM_META_SUCCESS);
+    ASSERT_EQ(item.count, configCount);
+    EXPECT_EQ(item.data.i32[configCount - 1], static_cast<int32_t>(configCount - 1));
+
+    std::shared_ptr<CameraAbility> settings = std::make_shared<CameraAbility>(10, 100);
+    uint8_t aeMode = OHOS_CAMERA_AE_MODE_ON;
+    settings->addEntry(OHOS_CONTROL_AE_MODE, &aeMode, 1);
+    MessageParcel inlineParcel;
+    ASSERT_TRUE(OHOS::Camera::MetadataUtils::EncodeCameraMetadataToAshmem(settings, inlineParcel));
+    OHOS::Camera::MetadataUtils::DecodeCameraMetadataFromAshmem(inlineParcel, decoded);
+    ASSERT_NE(decoded, nullptr);
+    ASSERT_EQ(OHOS::Camera::FindCameraMetadataItem(decoded->get(), OHOS_CONTROL_AE_MODE, &item), CAM_META_SUCCESS);
+    EXPECT_EQ(item.data.u8[0], aeMode);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_024
+ * @tc.desc: Verify indexed finds follow added, deleted, rewritten and copied items
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_024, TestSize.Level1)
+{
+    std::vector<uint32_t> tags = GetIndexedTestTags();
+    common_metadata_header_t *header = OHOS::Camera::AllocateCameraMetadataBuffer(INDEXED_TEST_ITEM_COUNT + 1,
+        INDEXED_TEST_DATA_CAPACITY);
+    ASSERT_NE(header, nullptr);
+    AddIndexedTestItems(header, tags, INDEXED_TEST_ITEM_COUNT);
+    ExpectIndexedItems(header, tags);
+    int64_t value = 0;
+    ASSERT_EQ(OHOS::Camera::AddCameraMetadataItem(header, tags[INDEXED_TEST_ITEM_COUNT], &value, 1),
+        CAM_META_SUCCESS);
+    ExpectIndexedItems(header, tags);
+
+    ASSERT_EQ(OHOS::Camera::DeleteCameraMetadataItem(header, tags[INDEXED_TEST_ITEM_COUNT - 1]), CAM_META_SUCCESS);
+    ExpectIndexedItems(header, tags);
+    camera_metadata_item_entry_t *entries = reinterpret_cast<camera_metadata_item_entry_t *>(
+        reinterpret_cast<uint8_t *>(header) + header->items_start);
+    std::swap(entries[0], entries[1]);
+    ExpectIndexedItems(header, tags);
+
+    common_metadata_header_t *copy = OHOS::Camera::AllocateCameraMetadataBuffer(INDEXED_TEST_ITEM_COUNT + 1,
+        INDEXED_TEST_DATA_CAPACITY);
+    ASSERT_NE(copy, nullptr);
+    std::vector<uint32_t> reversed(tags.rbegin(), tags.rend());
+    AddIndexedTestItems(copy, reversed, INDEXED_TEST_ITEM_COUNT);
+    ExpectIndexedItems(copy, tags);
+    ASSERT_EQ(OHOS::Camera::CopyCameraMetadataItems(copy, header), CAM_META_SUCCESS);
+    ExpectIndexedItems(copy, tags);
+    OHOS::Camera::FreeCameraMetadataBuffer(copy);
+    OHOS::Camera::FreeCameraMetadataBuffer(header);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_025
+ * @tc.desc: Verify indexed finds forget a filled or freed buffer and keep working past the index table size
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_025, TestSize.Level1)
+{
+    std::vector<uint32_t> tags = GetIndexedTestTags();
+    std::vector<uint32_t> reversed(tags.rbegin(), tags.rend());
+    common_metadata_header_t *header = OHOS::Camera::AllocateCameraMetadataBuffer(INDEXED_TEST_ITEM_COUNT,
+        INDEXED_TEST_DATA_CAPACITY);
+    ASSERT_NE(header, nullptr);
+    AddIndexedTestItems(header, tags, INDEXED_TEST_ITEM_COUNT);
+    ExpectIndexedItems(header, tags);
+    uint32_t size = header->size;
+    ASSERT_EQ(OHOS::Camera::FillCameraMetadata(header, size, INDEXED_TEST_ITEM_COUNT, INDEXED_TEST_DATA_CAPACITY),
+        header);
+    ExpectIndexedItems(header, tags);
+    AddIndexedTestItems(header, reversed, INDEXED_TEST_ITEM_COUNT);
+    ExpectIndexedItems(header, tags);
+    OHOS::Camera::FreeCameraMetadataBuffer(header);
+
+    header = OHOS::Camera::AllocateCameraMetadataBuffer(INDEXED_TEST_ITEM_COUNT, INDEXED_TEST_DATA_CAPACITY);
+    ASSERT_NE(header, nullptr);
+    AddIndexedTestItems(header, tags, INDEXED_TEST_ITEM_COUNT);
+    ExpectIndexedItems(header, tags);
+
+    constexpr uint32_t bufferCount = 200;
+    std::vector<common_metadata_header_t *> buffers;
+    for (uint32_t i = 0; i < bufferCount; i++) {
+        common_metadata_header_t *buffer = OHOS::Camera::AllocateCameraMetadataBuffer(INDEXED_TEST_ITEM_COUNT,
+            INDEXED_TEST_DATA_CAPACITY);
+        ASSERT_NE(buffer, nullptr);
+        buffers.push_back(buffer);
+        AddIndexedTestItems(buffer, (i % 2 == 0) ? tags : reversed, INDEXED_TEST_ITEM_COUNT);
+        ExpectIndexedItems(buffer, tags);
+        ExpectIndexedItems(header, tags);
+    }
+    for (common_metadata_header_t *buffer : buffers) {
+        ExpectIndexedItems(buffer, tags);
+        OHOS::Camera::FreeCameraMetadataBuffer(buffer);
+    }
+    OHOS::Camera::FreeCameraMetadataBuffer(header);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_026
+ * @tc.desc: Verify metadata in an ashmem region that is still writable is refused
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_026, TestSize.Level1)
+{
+    const uint32_t configCount = OHOS::Camera::ASHMEM_METADATA_THRESHOLD / sizeof(int32_t);
+    std::shared_ptr<CameraAbility> ability = std::make_shared<CameraAbility>(10, configCount * sizeof(int32_t));
+    std::vector<int32_t> configs(configCount, 1);
+    ability->addEntry(OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS, configs.data(), configs.size());
+    MessageParcel sealedParcel;
+    ASSERT_TRUE(OHOS::Camera::MetadataUtils::EncodeCameraMetadataToAshmem(ability, sealedParcel));
+    ASSERT_TRUE(sealedParcel.ReadBool());
+    uint64_t generation = sealedParcel.ReadUint64();
+    uint32_t length = sealedParcel.ReadUint32();
+    int sealedFd = sealedParcel.ReadFileDescriptor();
+    ASSERT_GE(sealedFd, 0);
+    int size = AshmemGetSize(sealedFd);
+    ASSERT_GT(size, 0);
+    void *sealed = mmap(nullptr, size, PROT_READ, MAP_SHARED, sealedFd, 0);
+    close(sealedFd);
+    ASSERT_NE(sealed, MAP_FAILED);
+
+    // The same region content, left writable by its sender.
+    int fd = AshmemCreate("camera_metadata_test", size);
+    ASSERT_GE(fd, 0);
+    void *region = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ASSERT_NE(region, MAP_FAILED);
+    EXPECT_EQ(memcpy_s(region, size, sealed, size), EOK);
+    munmap(region, size);
+    munmap(sealed, size);
+    MessageParcel writableParcel;
+    ASSERT_TRUE(writableParcel.WriteBool(true) && writableParcel.WriteUint64(generation) &&
+        writableParcel.WriteUint32(length) && writableParcel.WriteFileDescriptor(fd));
+    std::shared_ptr<CameraAbility> decoded = nullptr;
+    OHOS::Camera::MetadataUtils::DecodeCameraMetadataFromAshmem(writableParcel, decoded);
+    EXPECT_EQ(decoded, nullptr);
+
+    ASSERT_GE(AshmemSetProt(fd, PROT_READ), 0);
+    MessageParcel resealedParcel;
+    ASSERT_TRUE(resealedParcel.WriteBool(true) && resealedParcel.WriteUint64(generation) &&
+        resealedParcel.WriteUint32(length) && resealedParcel.WriteFileDescriptor(fd));
+    close(fd);
+    OHOS::Camera::MetadataUtils::DecodeCameraMetadataFromAshmem(resealedParcel, decoded);
+    EXPECT_NE(decoded, nullptr);
+}
+
+/**
+ * @tc.name: dcamera_metadata_processor_test_027
+ * @tc.desc: Verify vendor tags resolve through the cached table and are fetched again after a reset
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DMetadataProcessorTest, dcamera_metadata_processor_test_027, TestSize.Level1)
+{
+    uint32_t dataType = 0;
+    std::vector<vendorTag_t> tags;
+    if (OHOS::Camera::GetAllVendorTags(tags) != CAM_META_SUCCESS || tags.empty()) {
+        // Without a vendor tag implementation every vendor lookup fails, before and after a reset.
+        EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemType(OHOS_VENDOR_SECTION_START, &dataType), CAM_META_FAILURE);
+        OHOS::Camera::ResetVendorTagTable();
+        EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemType(OHOS_VENDOR_SECTION_START, &dataType), CAM_META_FAILURE);
+        return;
+    }
+    uint32_t unknownTag = OHOS_VENDOR_SECTION_START;
+    for (const auto &tag : tags) {
+        unknownTag = std::max(unknownTag, tag.tagId + 1);
+    }
+    const vendorTag_t &tag = tags[0];
+    ASSERT_EQ(OHOS::Camera::GetCameraMetadataItemType(tag.tagId, &dataType), CAM_META_SUCCESS);
+    EXPECT_EQ(dataType, tag.tagType);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemType(unknownTag, &dataType), CAM_META_FAILURE);
+    const char *name = OHOS::Camera::GetCameraMetadataItemName(tag.tagId);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemName(tag.tagId), name);
+
+    OHOS::Camera::ResetVendorTagTable();
+    ASSERT_EQ(OHOS::Camera::GetCameraMetadataItemType(tag.tagId, &dataType), CAM_META_SUCCESS);
+    EXPECT_EQ(dataType, tag.tagType);
+    const char *fetchedName = OHOS::Camera::GetCameraMetadataItemName(tag.tagId);
+    if (name == nullptr) {
+        EXPECT_EQ(fetchedName, nullptr);
+        return;
+    }
+    // The table fetched again holds its own copy, the name handed out before stays valid.
+    ASSERT_NE(fetchedName, nullptr);
+    EXPECT_NE(fetchedName, name);
+    EXPECT_STREQ(fetchedName, name);
+}
+
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -619,5 +619,44 @@ HWTEST_F(DCameraHostTest, RemoveClearRegisterRecipient_004, TestSize.Level1)
     result = DCameraHost::GetInstance()->RemoveClearRegisterRecipient(remote, dhBase2);
     EXPECT_EQ(result, DCamRetCode::SUCCESS);
 }
+
+/**
+ * @tc.name: GetCameraAbility_003
+ * @tc.desc: Verify the serialized camera ability is served from the cache until it is invalidated.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DCameraHostTest, GetCameraAbility_003, TestSize.Level1)
+{
+    auto host = DCameraHost::GetInstance();
+    const std::string cameraId = "cached_camera_id";
+    const std::vector<uint8_t> blob = { 1, 2, 3 };
+    uint64_t generation = host->abilityCacheGeneration_;
+    host->CacheCameraAbility(cameraId, generation, blob);
+
+    std::vector<uint8_t> cameraAbility;
+    EXPECT_EQ(host->GetCameraAbility(cameraId, cameraAbility), CamRetCode::NO_ERROR);
+    EXPECT_EQ(cameraAbility, blob);
+
+    host->InvalidateCameraAbility(cameraId);
+    EXPECT_FALSE(host->GetCachedCameraAbility(cameraId, cameraAbility));
+    EXPECT_EQ(host->GetCameraAbility(cameraId, cameraAbility), CamRetCode::INVALID_ARGUMENT);
+}
+
+/**
+ * @tc.name: GetCameraAbility_004
+ * @tc.desc: Verify an ability serialized before an invalidation is not cached.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DCameraHostTest, GetCameraAbility_004, TestSize.Level1)
+{
+    auto host = DCameraHost::GetInstance();
+    const std::string cameraId = "stale_camera_id";
+    uint64_t generation = host->abilityCacheGeneration_;
+    host->InvalidateCameraAbility(cameraId);
+    host->CacheCameraAbility(cameraId, generation, { 1, 2, 3 });
+
+    std::vector<uint8_t> cameraAbility;
+    EXPECT_FALSE(host->GetCachedCameraAbility(cameraId, cameraAbility));
+}
 }
 }
\ No newline at end of file
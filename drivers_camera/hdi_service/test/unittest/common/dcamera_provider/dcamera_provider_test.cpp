@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 
+#include "dcamera_ability_cache.h"
 #include "dcamera_host.h"
 #include "dcamera_provider.h"
 #include "dcamera_test_utils.h"
@@ -77,6 +78,33 @@ HWTEST_F(DcameraProviderTest, GetAbilityInfo_001, TestSize.Level1)
     EXPECT_EQ(ret, false);
 }
 
+/**
+ * @tc.name: GetAbilityInfo_002
+ * @tc.desc: Verify GetAbilityInfo splits the document compactly and keeps both parts parsed
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DcameraProviderTest, GetAbilityInfo_002, TestSize.Level1)
+{
+    DCameraAbilityCache &cache = DCameraAbilityCache::GetInstance();
+    cache.Clear();
+    std::string abilityInfo = "{\n  \"SinkAbility\": {\"ProtocolVer\": \"1.0\", \"Position\": \"BACK\"},\n"
+        "  \"SourceCodec\": {\"CodecType\": [\"OMX_hisi_video_encoder_avc\"]}\n}";
+    std::string sinkAbilityInfo;
+    std::string sourceCodecInfo;
+    ASSERT_TRUE(DCameraProvider::GetInstance()->GetAbilityInfo(abilityInfo, sinkAbilityInfo, sourceCodecInfo));
+    EXPECT_EQ(sinkAbilityInfo, "{\"ProtocolVer\":\"1.0\",\"Position\":\"BACK\"}");
+    EXPECT_EQ(sourceCodecInfo, "{\"CodecType\":[\"OMX_hisi_video_encoder_avc\"]}");
+
+    std::shared_ptr<cJSON> sinkRoot = cache.Parse(sinkAbilityInfo);
+    ASSERT_NE(sinkRoot, nullptr);
+    cJSON *position = cJSON_GetObjectItemCaseSensitive(sinkRoot.get(), "Position");
+    ASSERT_TRUE(cJSON_IsString(position));
+    EXPECT_STREQ(position->valuestring, "BACK");
+    EXPECT_NE(cache.Parse(sourceCodecInfo), nullptr);
+    cache.Clear();
+}
+
 /**
  * @tc.name: EnableDCameraDevice_001
  * @tc.desc: Verify EnableDCameraDevice
@@ -282,6 +310,135 @@ HWTEST_F(DcameraProviderTest, ShutterBuffer_003, TestSize.Level1)
     EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
 }
 
+/**
+ * @tc.name: AcquireBuffers_001
+ * @tc.desc: Verify AcquireBuffers rejects invalid input and an unknown device
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DcameraProviderTest, AcquireBuffers_001, TestSize.Level1)
+{
+    DHBase dhBase;
+    std::vector<int32_t> streamIds = { 1, 2 };
+    std::vector<DCameraStreamBuffer> buffers;
+    auto ret = DCameraProvider::GetInstance()->AcquireBuffers(dhBase, streamIds, buffers);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    dhBase.deviceId_ = "deviceId";
+    dhBase.dhId_ = "dhId";
+    std::vector<int32_t> emptyIds;
+    ret = DCameraProvider::GetInstance()->AcquireBuffers(dhBase, emptyIds, buffers);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    std::vector<int32_t> invalidIds = { 1, -1 };
+    ret = DCameraProvider::GetInstance()->AcquireBuffers(dhBase, invalidIds, buffers);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    DCameraHost::GetInstance()->dCameraDeviceMap_.clear();
+    ret = DCameraProvider::GetInstance()->AcquireBuffers(dhBase, streamIds, buffers);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+    EXPECT_TRUE(buffers.empty());
+}
+
+/**
+ * @tc.name: ShutterBuffers_001
+ * @tc.desc: Verify ShutterBuffers rejects invalid input and an unknown device
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DcameraProviderTest, ShutterBuffers_001, TestSize.Level1)
+{
+    DHBase dhBase;
+    std::vector<DCameraStreamBuffer> buffers(1);
+    buffers[0].streamId_ = 1;
+    buffers[0].buffer_.index_ = 1;
+    auto ret = DCameraProvider::GetInstance()->ShutterBuffers(dhBase, buffers);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    dhBase.deviceId_ = "deviceId";
+    dhBase.dhId_ = "dhId";
+    std::vector<DCameraStreamBuffer> emptyBuffers;
+    ret = DCameraProvider::GetInstance()->ShutterBuffers(dhBase, emptyBuffers);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    buffers[0].buffer_.index_ = -1;
+    ret = DCameraProvider::GetInstance()->ShutterBuffers(dhBase, buffers);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    buffers[0].buffer_.index_ = 1;
+    DCameraHost::GetInstance()->dCameraDeviceMap_.clear();
+    ret = DCameraProvider::GetInstance()->ShutterBuffers(dhBase, buffers);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+}
+
+/**
+ * @tc.name: OnSettingsResults_001
+ * @tc.desc: Verify OnSettingsResults rejects invalid input and an unknown device
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DcameraProviderTest, OnSettingsResults_001, TestSize.Level1)
+{
+    DHBase dhBase;
+    std::vector<DCameraSettingsResult> results(1);
+    results[0].sequence_ = 1;
+    results[0].type_ = DCSettingsType::METADATA_RESULT;
+    results[0].value_ = { 1, 2, 3 };
+    auto ret = DCameraProvider::GetInstance()->OnSettingsResults(dhBase, results);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    dhBase.deviceId_ = "deviceId";
+    dhBase.dhId_ = "dhId";
+    std::vector<DCameraSettingsResult> emptyResults;
+    ret = DCameraProvider::GetInstance()->OnSettingsResults(dhBase, emptyResults);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    std::vector<DCameraSettingsResult> tooManyResults(SETTINGS_RESULTS_MAX_SIZE + 1, results[0]);
+    ret = DCameraProvider::GetInstance()->OnSettingsResults(dhBase, tooManyResults);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    results.push_back(results[0]);
+    results[1].value_.clear();
+    ret = DCameraProvider::GetInstance()->OnSettingsResults(dhBase, results);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    results.pop_back();
+    DCameraHost::GetInstance()->dCameraDeviceMap_.clear();
+    ret = DCameraProvider::GetInstance()->OnSettingsResults(dhBase, results);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+}
+
+/**
+ * @tc.name: OpenBufferRing_001
+ * @tc.desc: Verify OpenBufferRing and GetRingBuffer reject invalid input and an unknown device
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DcameraProviderTest, OpenBufferRing_001, TestSize.Level1)
+{
+    DHBase dhBase;
+    int ringFd = -1;
+    int eventFd = -1;
+    auto ret = DCameraProvider::GetInstance()->OpenBufferRing(dhBase, 1, ringFd, eventFd);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    dhBase.deviceId_ = "deviceId";
+    dhBase.dhId_ = "dhId";
+    ret = DCameraProvider::GetInstance()->OpenBufferRing(dhBase, -1, ringFd, eventFd);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    DCameraHost::GetInstance()->dCameraDeviceMap_.clear();
+    ret = DCameraProvider::GetInstance()->OpenBufferRing(dhBase, 1, ringFd, eventFd);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+    EXPECT_EQ(-1, ringFd);
+
+    DCameraBuffer buffer;
+    ret = DCameraProvider::GetInstance()->GetRingBuffer(dhBase, 1, -1, buffer);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+    ret = DCameraProvider::GetInstance()->GetRingBuffer(dhBase, 1, 0, buffer);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+}
+
 /**
  * @tc.name: OnSettingsResult_001
  * @tc.desc: Verify OnSettingsResult
@@ -394,6 +551,27 @@ HWTEST_F(DcameraProviderTest, Notify_004, TestSize.Level1)
     EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
 }
 
+/**
+ * @tc.name: NotifyAsync_001
+ * @tc.desc: Verify NotifyAsync checks its input the same as Notify
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DcameraProviderTest, NotifyAsync_001, TestSize.Level1)
+{
+    DHBase dhBase;
+    DCameraHDFEvent event;
+    auto ret = DCameraProvider::GetInstance()->NotifyAsync(dhBase, event);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+
+    dhBase.deviceId_ = "deviceId";
+    dhBase.dhId_ = "dhId";
+    event.content_ = "content";
+    DCameraHost::GetInstance()->dCameraDeviceMap_.clear();
+    ret = DCameraProvider::GetInstance()->NotifyAsync(dhBase, event);
+    EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
+}
+
 /**
  * @tc.name: RegisterCameraHdfListener_001
  * @tc.desc: Verify RegisterCameraHdfListener
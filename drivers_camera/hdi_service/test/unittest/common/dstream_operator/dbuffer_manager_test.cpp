@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <vector>
 
 #include "dbuffer_manager_test.h"
 
@@ -49,15 +50,14 @@ HWTEST_F(DBufferManagerTest, AddBuffer_001, TestSize.Level1)
 {
     std::shared_ptr<DBufferManager> dbMgr = std::make_shared<DBufferManager>();
     ASSERT_NE(nullptr, dbMgr);
+    std::shared_ptr<DImageBuffer> nullBuffer = nullptr;
+    EXPECT_EQ(dbMgr->AddBuffer(nullBuffer), RC_ERROR);
+    for (uint32_t i = 0; i < BUFFER_QUEUE_SIZE; i++) {
+        std::shared_ptr<DImageBuffer> buffer = std::make_shared<DImageBuffer>();
+        EXPECT_EQ(dbMgr->AddBuffer(buffer), RC_OK);
+        EXPECT_EQ(buffer->GetIndex(), static_cast<int32_t>(i));
+    }
     std::shared_ptr<DImageBuffer> buffer = std::make_shared<DImageBuffer>();
-    dbMgr->idleList_.emplace_back(buffer);
-    dbMgr->busyList_.emplace_back(buffer);
-    dbMgr->idleList_.emplace_back(buffer);
-    dbMgr->busyList_.emplace_back(buffer);
-    dbMgr->idleList_.emplace_back(buffer);
-    dbMgr->busyList_.emplace_back(buffer);
-    dbMgr->idleList_.emplace_back(buffer);
-    dbMgr->busyList_.emplace_back(buffer);
     auto ret = dbMgr->AddBuffer(buffer);
     EXPECT_EQ(ret, RC_ERROR);
 }
@@ -75,9 +75,48 @@ HWTEST_F(DBufferManagerTest, RemoveBuffer_001, TestSize.Level1)
     auto ret = dbMgr->RemoveBuffer(buffer);
     EXPECT_EQ(ret, RC_ERROR);
 
-    dbMgr->busyList_.emplace_back(buffer);
+    ASSERT_EQ(dbMgr->AddBuffer(buffer), RC_OK);
+    ret = dbMgr->RemoveBuffer(buffer);
+    EXPECT_EQ(ret, RC_ERROR);
+    EXPECT_EQ(dbMgr->AcquireBuffer(), buffer);
+    EXPECT_EQ(dbMgr->GetBusyBuffer(buffer->GetIndex()), buffer);
     ret = dbMgr->RemoveBuffer(buffer);
     EXPECT_EQ(ret, RC_OK);
+    EXPECT_EQ(dbMgr->GetBusyBuffer(buffer->GetIndex()), nullptr);
+    EXPECT_EQ(dbMgr->AcquireBuffer(), nullptr);
+}
+
+/**
+ * @tc.name: AcquireBuffer_001
+ * @tc.desc: Verify AcquireBuffer hands out idle buffers in order and reuses freed slots
+ * @tc.type: FUNC
+ */
+HWTEST_F(DBufferManagerTest, AcquireBuffer_001, TestSize.Level1)
+{
+    std::shared_ptr<DBufferManager> dbMgr = std::make_shared<DBufferManager>();
+    ASSERT_NE(nullptr, dbMgr);
+    std::vector<std::shared_ptr<DImageBuffer>> buffers;
+    for (uint32_t i = 0; i < BUFFER_QUEUE_SIZE; i++) {
+        buffers.push_back(std::make_shared<DImageBuffer>());
+        ASSERT_EQ(dbMgr->AddBuffer(buffers.back()), RC_OK);
+    }
+    EXPECT_EQ(dbMgr->GetIdleCount(), BUFFER_QUEUE_SIZE);
+    EXPECT_EQ(dbMgr->GetFreeCount(), 0U);
+    for (uint32_t i = 0; i < BUFFER_QUEUE_SIZE; i++) {
+        EXPECT_EQ(dbMgr->AcquireBuffer(), buffers[i]);
+    }
+    EXPECT_EQ(dbMgr->AcquireBuffer(), nullptr);
+    EXPECT_EQ(dbMgr->GetIdleCount(), 0U);
+    EXPECT_EQ(dbMgr->GetBusyBuffer(-1), nullptr);
+    EXPECT_EQ(dbMgr->GetBusyBuffer(static_cast<int32_t>(BUFFER_QUEUE_SIZE)), nullptr);
+
+    int32_t index = buffers[1]->GetIndex();
+    ASSERT_EQ(dbMgr->RemoveBuffer(buffers[1]), RC_OK);
+    EXPECT_EQ(dbMgr->GetFreeCount(), 1U);
+    std::shared_ptr<DImageBuffer> buffer = std::make_shared<DImageBuffer>();
+    ASSERT_EQ(dbMgr->AddBuffer(buffer), RC_OK);
+    EXPECT_EQ(buffer->GetIndex(), index);
+    EXPECT_EQ(dbMgr->AcquireBuffer(), buffer);
 }
 
 /**
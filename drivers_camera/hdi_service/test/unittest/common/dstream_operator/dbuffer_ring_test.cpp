@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "dbuffer_ring.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+const int32_t TEST_BUFFER_NUM = 3;
+const int32_t TEST_BUFFER_SIZE = 1024;
+const int32_t TEST_FILLED_SIZE = 512;
+const uint32_t TEST_SEQ_BASE = 100;
+const int64_t TEST_CAPTURE_TIME_US = 123456;
+const int32_t TEST_WAIT_MS = 2000;
+const int32_t TEST_POLL_MS = 5;
+}
+
+class DBufferRingTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp(void);
+    void TearDown(void);
+
+    template <typename Pred>
+    bool WaitFor(Pred pred)
+    {
+        for (int32_t waited = 0; waited < TEST_WAIT_MS; waited += TEST_POLL_MS) {
+            if (pred()) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(TEST_POLL_MS));
+        }
+        return pred();
+    }
+
+    size_t GetReturnedCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return returned_.size();
+    }
+
+    std::shared_ptr<DBufferRing> ring_ = nullptr;
+    int32_t acquired_ = 0;
+    std::mutex mutex_;
+    std::vector<DCameraBuffer> returned_;
+    std::vector<int64_t> returnedTimes_;
+};
+
+void DBufferRingTest::SetUpTestCase(void)
+{
+}
+
+void DBufferRingTest::TearDownTestCase(void)
+{
+}
+
+void DBufferRingTest::SetUp(void)
+{
+    acquired_ = 0;
+    returned_.clear();
+    returnedTimes_.clear();
+    DBufferRing::AcquireFunc acquireFunc = [this](DCameraBuffer &buffer, uint32_t &seqNum) {
+        if (acquired_ >= TEST_BUFFER_NUM) {
+            return DCamRetCode::EXCEED_MAX_NUMBER;
+        }
+        buffer.index_ = acquired_;
+        buffer.size_ = TEST_BUFFER_SIZE;
+        seqNum = TEST_SEQ_BASE + static_cast<uint32_t>(acquired_);
+        acquired_++;
+        return DCamRetCode::SUCCESS;
+    };
+    DBufferRing::ReturnFunc returnFunc = [this](const DCameraBuffer &buffer, int64_t captureTimeUs) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        returned_.push_back(buffer);
+        returnedTimes_.push_back(captureTimeUs);
+        return DCamRetCode::SUCCESS;
+    };
+    ring_ = std::make_shared<DBufferRing>(1, acquireFunc, returnFunc);
+}
+
+void DBufferRingTest::TearDown(void)
+{
+    ring_ = nullptr;
+}
+
+/**
+ * @tc.name: BufferRing_001
+ * @tc.desc: Verify the ring only fills the free queue while refill is on and returns filled buffers.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DBufferRingTest, BufferRing_001, TestSize.Level1)
+{
+    ASSERT_EQ(DCamRetCode::SUCCESS, ring_->Init());
+    EXPECT_GE(ring_->GetRingFd(), 0);
+    EXPECT_GE(ring_->GetEventFd(), 0);
+    DBufferRingLayout *layout = ring_->layout_;
+    ASSERT_NE(nullptr, layout);
+    EXPECT_EQ(DBUFFER_RING_MAGIC, layout->magic);
+    EXPECT_EQ(DBUFFER_RING_VERSION, layout->version);
+    EXPECT_EQ(0U, layout->freeQueue.tail.load());
+
+    ring_->EnableRefill();
+    EXPECT_TRUE(WaitFor([layout]() {
+        return layout->freeQueue.tail.load() == static_cast<uint32_t>(TEST_BUFFER_NUM);
+    }));
+    DBufferRingEntry entry;
+    ASSERT_TRUE(ring_->PopFree(entry));
+    EXPECT_EQ(0, entry.index);
+    EXPECT_EQ(TEST_BUFFER_SIZE, entry.size);
+    EXPECT_EQ(TEST_SEQ_BASE, entry.seqNum);
+
+    // Hand the buffer back the way the source does.
+    entry.size = TEST_FILLED_SIZE;
+    entry.captureTimeUs = TEST_CAPTURE_TIME_US;
+    uint32_t tail = layout->filledQueue.tail.load();
+    layout->filledQueue.entries[tail % DBUFFER_RING_CAPACITY] = entry;
+    layout->filledQueue.tail.store(tail + 1);
+    uint64_t value = 1;
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(value)), write(ring_->GetEventFd(), &value, sizeof(value)));
+    EXPECT_TRUE(WaitFor([this]() { return GetReturnedCount() == 1; }));
+    EXPECT_EQ(0, returned_[0].index_);
+    EXPECT_EQ(TEST_FILLED_SIZE, returned_[0].size_);
+    EXPECT_EQ(TEST_CAPTURE_TIME_US, returnedTimes_[0]);
+
+    ring_->DisableRefill();
+    ASSERT_EQ(static_cast<size_t>(TEST_BUFFER_NUM), GetReturnedCount());
+    EXPECT_EQ(1, returned_[1].index_);
+    EXPECT_EQ(0, returned_[1].size_);
+    EXPECT_EQ(0, returnedTimes_[1]);
+    EXPECT_FALSE(ring_->PopFree(entry));
+    ring_->Release();
+    EXPECT_EQ(nullptr, ring_->layout_);
+    EXPECT_LT(ring_->GetRingFd(), 0);
+}
+
+/**
+ * @tc.name: BufferRing_002
+ * @tc.desc: Verify a filled queue with a bogus tail is dropped instead of being walked.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DBufferRingTest, BufferRing_002, TestSize.Level1)
+{
+    ASSERT_EQ(DCamRetCode::SUCCESS, ring_->Init());
+    DBufferRingLayout *layout = ring_->layout_;
+    ASSERT_NE(nullptr, layout);
+    layout->filledQueue.tail.store(DBUFFER_RING_CAPACITY + 1);
+    DBufferRingEntry entry;
+    EXPECT_FALSE(ring_->PopFilled(entry));
+    EXPECT_EQ(layout->filledQueue.tail.load(), layout->filledQueue.head.load());
+    ring_->Release();
+    EXPECT_EQ(0U, GetReturnedCount());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -229,7 +229,7 @@ HWTEST_F(DCameraStreamTest, FlushDCameraBuffer_001, TestSize.Level1)
     std::shared_ptr<DCameraStream> dcStream = std::make_shared<DCameraStream>();
     ASSERT_NE(nullptr, dcStream);
     DCameraBuffer buffer;
-    dcStream->bufferConfigMap_.clear();
+    dcStream->surfaceBuffers_.assign(BUFFER_QUEUE_SIZE, nullptr);
     auto ret = dcStream->FlushDCameraBuffer(buffer);
     EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
 }
@@ -244,7 +244,7 @@ HWTEST_F(DCameraStreamTest, ReturnDCameraBuffer_001, TestSize.Level1)
     std::shared_ptr<DCameraStream> dcStream = std::make_shared<DCameraStream>();
     ASSERT_NE(nullptr, dcStream);
     DCameraBuffer buffer;
-    dcStream->bufferConfigMap_.clear();
+    dcStream->surfaceBuffers_.assign(BUFFER_QUEUE_SIZE, nullptr);
     auto ret = dcStream->ReturnDCameraBuffer(buffer);
     EXPECT_EQ(ret, DCamRetCode::INVALID_ARGUMENT);
 }
@@ -328,6 +328,58 @@ HWTEST_F(DCameraStreamTest, CancelDCameraBuffer_001, TestSize.Level1)
     EXPECT_EQ(ret, DCamRetCode::SUCCESS);
 }
 
+/**
+ * @tc.name: PrefetchBuffer_001
+ * @tc.desc: Verify the prefetch thread only runs with a prefetch count and stops on release
+ * @tc.type: FUNC
+ */
+HWTEST_F(DCameraStreamTest, PrefetchBuffer_001, TestSize.Level1)
+{
+    std::shared_ptr<DCameraStream> dcStream = std::make_shared<DCameraStream>();
+    ASSERT_NE(nullptr, dcStream);
+    dcStream->prefetchCount_ = 0;
+    dcStream->StartPrefetch();
+    EXPECT_FALSE(dcStream->isPrefetchRunning_);
+    EXPECT_FALSE(dcStream->prefetchThread_.joinable());
+    dcStream->TriggerPrefetch();
+    EXPECT_FALSE(dcStream->isPrefetchPending_);
+
+    dcStream->prefetchCount_ = DEFAULT_BUFFER_PREFETCH_COUNT;
+    dcStream->StartPrefetch();
+    EXPECT_TRUE(dcStream->isPrefetchRunning_);
+    EXPECT_TRUE(dcStream->prefetchThread_.joinable());
+    EXPECT_FALSE(dcStream->NeedPrefetch());
+    dcStream->TriggerPrefetch();
+
+    dcStream->dcStreamInfo_ = std::make_shared<StreamInfo>();
+    auto ret = dcStream->ReleaseDCameraBufferQueue();
+    EXPECT_EQ(ret, DCamRetCode::SUCCESS);
+    EXPECT_FALSE(dcStream->isPrefetchRunning_);
+    EXPECT_FALSE(dcStream->prefetchThread_.joinable());
+    EXPECT_FALSE(dcStream->NeedPrefetch());
+}
+
+/**
+ * @tc.name: FencePending_001
+ * @tc.desc: Verify only a valid unsignaled fence is kept and the release fence goes with the image buffer
+ * @tc.type: FUNC
+ */
+HWTEST_F(DCameraStreamTest, FencePending_001, TestSize.Level1)
+{
+    OHOS::sptr<OHOS::SyncFence> syncFence = nullptr;
+    EXPECT_FALSE(DCameraStream::IsFencePending(syncFence));
+    syncFence = new(std::nothrow) OHOS::SyncFence(-1);
+    ASSERT_NE(nullptr, syncFence);
+    EXPECT_FALSE(DCameraStream::IsFencePending(syncFence));
+
+    std::shared_ptr<DImageBuffer> imageBuffer = std::make_shared<DImageBuffer>();
+    EXPECT_EQ(nullptr, imageBuffer->GetReleaseFence());
+    imageBuffer->SetReleaseFence(syncFence);
+    EXPECT_EQ(syncFence, imageBuffer->GetReleaseFence());
+    imageBuffer->Free();
+    EXPECT_EQ(nullptr, imageBuffer->GetReleaseFence());
+}
+
 /**
  * @tc.name: HasBufferQueue_001
  * @tc.desc: Verify HasBufferQueue
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -1161,7 +1161,7 @@ HWTEST_F(DStreamOperatorTest, dstream_operator_test_042, TestSize.Level1)
     sptr<IStreamOperatorCallback> callbackObj = nullptr;
     sptr<IOfflineStreamOperator> offlineOperator = nullptr;
     int32_t res = dstreamOperator_->ChangeToOfflineStream(streamIds, callbackObj, offlineOperator);
-    EXPECT_EQ(res, CamRetCode::METHOD_NOT_SUPPORTED);
+    EXPECT_EQ(res, CamRetCode::INVALID_ARGUMENT);
 }
 
 /**
@@ -1417,139 +1417,158 @@ HWTEST_F(DStreamOperatorTest, dstream_operator_test_058, TestSize.Level1)
 
 /**
  * @tc.name: dstream_operator_test_059
- * @tc.desc: Verify FindStreamCaptureBufferNum
+ * @tc.desc: Verify FindHotState
  * @tc.type: FUNC
  * @tc.require: AR
  */
 HWTEST_F(DStreamOperatorTest, dstream_operator_test_059, TestSize.Level1)
 {
     EXPECT_EQ(false, dstreamOperator_ == nullptr);
-    std::pair<int, int> streamPair = {1, 2};
-    dstreamOperator_->acceptedBufferNum_[streamPair] = 5;
-    int32_t result = dstreamOperator_->FindStreamCaptureBufferNum(streamPair);
-    EXPECT_EQ(result, 5);
+    EXPECT_EQ(dstreamOperator_->FindHotState(1), nullptr);
 }
 
 /**
  * @tc.name: dstream_operator_test_060
- * @tc.desc: Verify FindStreamCaptureBufferNum
+ * @tc.desc: Verify InsertHotStates
  * @tc.type: FUNC
  * @tc.require: AR
  */
 HWTEST_F(DStreamOperatorTest, dstream_operator_test_060, TestSize.Level1)
 {
     EXPECT_EQ(false, dstreamOperator_ == nullptr);
-    std::pair<int, int> streamPair = {3, 4};
-    int32_t result = dstreamOperator_->FindStreamCaptureBufferNum(streamPair);
-    EXPECT_EQ(result, 0);
+    CaptureInfo info;
+    info.streamIds_ = {1, 2};
+    info.enableShutterCallback_ = true;
+    std::vector<std::shared_ptr<DCameraStream>> streams = {nullptr, nullptr};
+    dstreamOperator_->InsertHotStates(5, info, streams);
+    auto hotState = dstreamOperator_->FindHotState(2);
+    ASSERT_NE(hotState, nullptr);
+    EXPECT_EQ(hotState->captureId, 5);
+    EXPECT_EQ(hotState->streamId, 2);
+    EXPECT_EQ(hotState->enableShutter, true);
+    EXPECT_EQ(hotState->isSnapshot, false);
+    EXPECT_EQ(hotState->bufferNum.load(), 0);
 }
 
 /**
  * @tc.name: dstream_operator_test_061
- * @tc.desc: Verify AddStreamCaptureBufferNum
+ * @tc.desc: Verify InsertHotStates
  * @tc.type: FUNC
  * @tc.require: AR
  */
 HWTEST_F(DStreamOperatorTest, dstream_operator_test_061, TestSize.Level1)
 {
     EXPECT_EQ(false, dstreamOperator_ == nullptr);
-    std::pair<int, int> streamPair = {1, 2};
-    dstreamOperator_->acceptedBufferNum_[streamPair] = 5;
-    dstreamOperator_->AddStreamCaptureBufferNum(streamPair);
-    EXPECT_EQ(dstreamOperator_->acceptedBufferNum_[streamPair], 6);
+    CaptureInfo info;
+    info.streamIds_ = {1};
+    std::vector<std::shared_ptr<DCameraStream>> streams = {nullptr};
+    dstreamOperator_->InsertHotStates(5, info, streams);
+    dstreamOperator_->InsertHotStates(6, info, streams);
+    auto hotState = dstreamOperator_->FindHotState(1);
+    ASSERT_NE(hotState, nullptr);
+    EXPECT_EQ(hotState->captureId, 6);
+    EXPECT_EQ(dstreamOperator_->hotStates_->size(), 1);
 }
 
 /**
  * @tc.name: dstream_operator_test_062
- * @tc.desc: Verify AddStreamCaptureBufferNum
+ * @tc.desc: Verify EraseHotState
  * @tc.type: FUNC
  * @tc.require: AR
  */
 HWTEST_F(DStreamOperatorTest, dstream_operator_test_062, TestSize.Level1)
 {
     EXPECT_EQ(false, dstreamOperator_ == nullptr);
-    std::pair<int, int> streamPair = {3, 4};
-    dstreamOperator_->AddStreamCaptureBufferNum(streamPair);
-    EXPECT_EQ(dstreamOperator_->acceptedBufferNum_[streamPair], 1);
+    CaptureInfo info;
+    info.streamIds_ = {1};
+    std::vector<std::shared_ptr<DCameraStream>> streams = {nullptr};
+    dstreamOperator_->InsertHotStates(5, info, streams);
+    auto hotState = dstreamOperator_->EraseHotState(5, 1);
+    EXPECT_NE(hotState, nullptr);
+    EXPECT_EQ(dstreamOperator_->FindHotState(1), nullptr);
 }
 
 /**
  * @tc.name: dstream_operator_test_063
- * @tc.desc: Verify AddStreamCaptureBufferNum
+ * @tc.desc: Verify EraseHotState
  * @tc.type: FUNC
  * @tc.require: AR
  */
 HWTEST_F(DStreamOperatorTest, dstream_operator_test_063, TestSize.Level1)
 {
     EXPECT_EQ(false, dstreamOperator_ == nullptr);
-    std::pair<int, int> streamPair = {1, 2};
-    dstreamOperator_->acceptedBufferNum_[streamPair] = 5;
-    dstreamOperator_->EraseStreamCaptureBufferNum(streamPair);
-    EXPECT_EQ(dstreamOperator_->acceptedBufferNum_.find(streamPair) == dstreamOperator_->acceptedBufferNum_.end(),
-                true);
+    CaptureInfo info;
+    info.streamIds_ = {1};
+    std::vector<std::shared_ptr<DCameraStream>> streams = {nullptr};
+    dstreamOperator_->InsertHotStates(5, info, streams);
+    EXPECT_EQ(dstreamOperator_->EraseHotState(6, 1), nullptr);
+    EXPECT_NE(dstreamOperator_->FindHotState(1), nullptr);
 }
 
 /**
  * @tc.name: dstream_operator_test_064
- * @tc.desc: Verify InsertNotifyCaptureMap
+ * @tc.desc: Verify ReturnStreamBuffer
  * @tc.type: FUNC
  * @tc.require: AR
  */
 HWTEST_F(DStreamOperatorTest, dstream_operator_test_064, TestSize.Level1)
 {
     EXPECT_EQ(false, dstreamOperator_ == nullptr);
-    int32_t streamId = 1;
-    dstreamOperator_->InsertNotifyCaptureMap(streamId);
-    EXPECT_EQ(
-        dstreamOperator_->notifyCaptureStartedMap_.find(streamId) != dstreamOperator_->notifyCaptureStartedMap_.end(),
-                true);
-    EXPECT_EQ(dstreamOperator_->notifyCaptureStartedMap_[streamId], false);
+    DStreamHotState hotState;
+    hotState.captureId = 5;
+    hotState.streamId = 1;
+    DCameraBuffer buffer;
+    EXPECT_EQ(dstreamOperator_->ReturnStreamBuffer(hotState, buffer, 0), DCamRetCode::SUCCESS);
+    EXPECT_EQ(hotState.captureStarted.load(), false);
+    EXPECT_EQ(hotState.bufferNum.load(), 0);
 }
 
 /**
  * @tc.name: dstream_operator_test_065
- * @tc.desc: Verify InsertNotifyCaptureMap
+ * @tc.desc: Verify SnapShotStreamOnCaptureEnded
  * @tc.type: FUNC
  * @tc.require: AR
  */
 HWTEST_F(DStreamOperatorTest, dstream_operator_test_065, TestSize.Level1)
 {
     EXPECT_EQ(false, dstreamOperator_ == nullptr);
-    int32_t streamId = 1;
-    dstreamOperator_->notifyCaptureStartedMap_[streamId] = true;
-    dstreamOperator_->InsertNotifyCaptureMap(streamId);
-    EXPECT_EQ(dstreamOperator_->notifyCaptureStartedMap_[streamId], true);
+    DStreamHotState hotState;
+    hotState.captureId = 5;
+    hotState.streamId = 1;
+    hotState.isSnapshot = true;
+    hotState.bufferNum = 3;
+    dstreamOperator_->SnapShotStreamOnCaptureEnded(hotState);
+    EXPECT_EQ(hotState.bufferNum.load(), 3);
 }
 
 /**
  * @tc.name: dstream_operator_test_066
- * @tc.desc: Verify EraseNotifyCaptureMap
+ * @tc.desc: Verify Release clears the hot states
  * @tc.type: FUNC
  * @tc.require: AR
  */
 HWTEST_F(DStreamOperatorTest, dstream_operator_test_066, TestSize.Level1)
 {
     EXPECT_EQ(false, dstreamOperator_ == nullptr);
-    int32_t streamId = 1;
-    dstreamOperator_->notifyCaptureStartedMap_[streamId] = true;
-    dstreamOperator_->EraseNotifyCaptureMap(streamId);
-    EXPECT_EQ(
-        dstreamOperator_->notifyCaptureStartedMap_.find(streamId) == dstreamOperator_->notifyCaptureStartedMap_.end(),
-        true);
+    CaptureInfo info;
+    info.streamIds_ = {1};
+    std::vector<std::shared_ptr<DCameraStream>> streams = {nullptr};
+    dstreamOperator_->InsertHotStates(5, info, streams);
+    dstreamOperator_->Release();
+    EXPECT_EQ(dstreamOperator_->FindHotState(1), nullptr);
 }
 
 /**
  * @tc.name: dstream_operator_test_067
- * @tc.desc: Verify EraseNotifyCaptureMap
+ * @tc.desc: Verify ShutterBuffer
  * @tc.type: FUNC
  * @tc.require: AR
  */
 HWTEST_F(DStreamOperatorTest, dstream_operator_test_067, TestSize.Level1)
 {
     EXPECT_EQ(false, dstreamOperator_ == nullptr);
-    int32_t streamId = 1;
-    dstreamOperator_->EraseNotifyCaptureMap(streamId);
-    EXPECT_EQ(dstreamOperator_->notifyCaptureStartedMap_.size(), 0);
+    DCameraBuffer buffer;
+    EXPECT_EQ(dstreamOperator_->ShutterBuffer(100, buffer), DCamRetCode::INVALID_ARGUMENT);
 }
 
 /**
@@ -1582,6 +1601,163 @@ HWTEST_F(DStreamOperatorTest, dstream_operator_test_069, TestSize.Level1)
     int32_t captureId = 2;
     auto result = dstreamOperator_->FindCaptureInfoById(captureId);
     EXPECT_EQ(result, nullptr);
+
+/**
+ * @tc.name: dstream_operator_test_070
+ * @tc.desc: Verify AcquireBuffers and ShutterBuffers
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DStreamOperatorTest, dstream_operator_test_070, TestSize.Level1)
+{
+    EXPECT_EQ(false, dstreamOperator_ == nullptr);
+    std::vector<int32_t> streamIds = { TEST_STREAMID, TEST_STREAMID + 1 };
+    std::vector<DCameraStreamBuffer> buffers;
+    dstreamOperator_->SetCapturing(false);
+    DCamRetCode rc = dstreamOperator_->AcquireBuffers(streamIds, buffers);
+    EXPECT_EQ(DCamRetCode::CAMERA_OFFLINE, rc);
+    EXPECT_TRUE(buffers.empty());
+
+    dstreamOperator_->SetCapturing(true);
+    rc = dstreamOperator_->AcquireBuffers(streamIds, buffers);
+    EXPECT_EQ(DCamRetCode::INVALID_ARGUMENT, rc);
+    EXPECT_TRUE(buffers.empty());
+    dstreamOperator_->SetCapturing(false);
+
+    buffers.resize(streamIds.size());
+    for (size_t i = 0; i < streamIds.size(); i++) {
+        buffers[i].streamId_ = streamIds[i];
+    }
+    rc = dstreamOperator_->ShutterBuffers(buffers);
+    EXPECT_EQ(DCamRetCode::INVALID_ARGUMENT, rc);
+}
+
+/**
+ * @tc.name: dstream_operator_test_071
+ * @tc.desc: Verify OpenBufferRing and GetRingBuffer reject unknown streams
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DStreamOperatorTest, dstream_operator_test_071, TestSize.Level1)
+{
+    EXPECT_EQ(false, dstreamOperator_ == nullptr);
+    int ringFd = -1;
+    int eventFd = -1;
+    int32_t unknownStreamId = TEST_STREAMID + 100;
+    DCamRetCode rc = dstreamOperator_->OpenBufferRing(unknownStreamId, ringFd, eventFd);
+    EXPECT_NE(DCamRetCode::SUCCESS, rc);
+    EXPECT_EQ(-1, ringFd);
+    EXPECT_EQ(nullptr, dstreamOperator_->FindBufferRing(unknownStreamId));
+
+    DCameraBuffer buffer;
+    rc = dstreamOperator_->GetRingBuffer(unknownStreamId, 0, buffer);
+    EXPECT_EQ(DCamRetCode::INVALID_ARGUMENT, rc);
+    dstreamOperator_->ReleaseBufferRing(unknownStreamId);
+}
+
+/**
+ * @tc.name: dstream_operator_test_072
+ * @tc.desc: Verify the negotiated capture info is memoized until the streams change
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DStreamOperatorTest, dstream_operator_test_072, TestSize.Level1)
+{
+    EXPECT_EQ(false, dstreamOperator_ == nullptr);
+    constexpr int testFormat = PIXEL_FMT_YCRCB_420_SP;
+    constexpr int testStreamId = TEST_STREAMID + 200;
+    std::shared_ptr<DCStreamInfo> stream = std::make_shared<DCStreamInfo>();
+    stream->streamId_ = testStreamId;
+    stream->type_ = DCStreamType::CONTINUOUS_FRAME;
+    stream->format_ = testFormat;
+    stream->width_ = TEST_WIDTH;
+    stream->height_ = TEST_HEIGHT;
+    dstreamOperator_->InsertDCStream(testStreamId, stream);
+    dstreamOperator_->dcSupportedVideoResolutionMap_[testFormat] = { { TEST_WIDTH, TEST_HEIGHT } };
+
+    std::vector<std::shared_ptr<DCStreamInfo>> streamInfo = { stream };
+    auto captureInfo = dstreamOperator_->GetNegotiatedCaptureInfo(streamInfo, false);
+    ASSERT_NE(nullptr, captureInfo);
+    EXPECT_EQ(TEST_WIDTH, captureInfo->width_);
+    EXPECT_EQ(1U, dstreamOperator_->negotiationCache_.size());
+
+    dstreamOperator_->dcSupportedVideoResolutionMap_[testFormat] = { { TEST_HEIGHT, TEST_HEIGHT } };
+    captureInfo = dstreamOperator_->GetNegotiatedCaptureInfo(streamInfo, false);
+    EXPECT_EQ(TEST_WIDTH, captureInfo->width_);
+    EXPECT_EQ(1U, captureInfo->streamIds_.size());
+
+    dstreamOperator_->EraseDCStream(testStreamId);
+    EXPECT_TRUE(dstreamOperator_->negotiationCache_.empty());
+    captureInfo = dstreamOperator_->GetNegotiatedCaptureInfo(streamInfo, false);
+    EXPECT_EQ(TEST_HEIGHT, captureInfo->width_);
+    dstreamOperator_->ClearNegotiationCache();
+    dstreamOperator_->dcSupportedVideoResolutionMap_.erase(testFormat);
+}
+
+/**
+ * @tc.name: dstream_operator_test_073
+ * @tc.desc: Verify ChangeToOfflineStream detaches a running snapshot into the offline operator
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DStreamOperatorTest, dstream_operator_test_073, TestSize.Level1)
+{
+    EXPECT_EQ(false, dstreamOperator_ == nullptr);
+    constexpr int32_t snapshotStreamId = TEST_STREAMID + 300;
+    constexpr int32_t captureId = 7;
+    std::shared_ptr<DCStreamInfo> dcStreamInfo = std::make_shared<DCStreamInfo>();
+    dcStreamInfo->streamId_ = snapshotStreamId;
+    dcStreamInfo->type_ = DCStreamType::SNAPSHOT_FRAME;
+    dstreamOperator_->InsertDCStream(snapshotStreamId, dcStreamInfo);
+    CaptureInfo info;
+    info.streamIds_ = { snapshotStreamId };
+    std::vector<std::shared_ptr<DCameraStream>> streams = { std::make_shared<DCameraStream>() };
+    dstreamOperator_->InsertHotStates(captureId, info, streams);
+
+    OHOS::sptr<IStreamOperatorCallback> callback(new (std::nothrow) MockDStreamOperatorCallback());
+    sptr<IOfflineStreamOperator> offlineOperator = nullptr;
+    int32_t rc = dstreamOperator_->ChangeToOfflineStream(info.streamIds_, callback, offlineOperator);
+    EXPECT_EQ(CamRetCode::NO_ERROR, rc);
+    ASSERT_NE(nullptr, offlineOperator);
+    EXPECT_EQ(nullptr, dstreamOperator_->FindHotState(snapshotStreamId));
+    EXPECT_EQ(nullptr, dstreamOperator_->FindDCStreamById(snapshotStreamId));
+    EXPECT_NE(nullptr, dstreamOperator_->FindOfflineStream(snapshotStreamId));
+    EXPECT_TRUE(dstreamOperator_->HasOfflineOperator());
+
+    EXPECT_EQ(CamRetCode::INVALID_ARGUMENT, offlineOperator->CancelCapture(captureId + 1));
+    EXPECT_EQ(CamRetCode::NO_ERROR, offlineOperator->ReleaseStreams(info.streamIds_));
+    EXPECT_EQ(nullptr, dstreamOperator_->FindOfflineStream(snapshotStreamId));
+    EXPECT_FALSE(dstreamOperator_->HasOfflineOperator());
+    EXPECT_EQ(CamRetCode::NO_ERROR, offlineOperator->Release());
+}
+
+/**
+ * @tc.name: dstream_operator_test_074
+ * @tc.desc: Verify ChangeToOfflineStream keeps continuous streams online
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DStreamOperatorTest, dstream_operator_test_074, TestSize.Level1)
+{
+    EXPECT_EQ(false, dstreamOperator_ == nullptr);
+    constexpr int32_t previewStreamId = TEST_STREAMID + 301;
+    std::shared_ptr<DCStreamInfo> dcStreamInfo = std::make_shared<DCStreamInfo>();
+    dcStreamInfo->streamId_ = previewStreamId;
+    dcStreamInfo->type_ = DCStreamType::CONTINUOUS_FRAME;
+    dstreamOperator_->InsertDCStream(previewStreamId, dcStreamInfo);
+    CaptureInfo info;
+    info.streamIds_ = { previewStreamId };
+    std::vector<std::shared_ptr<DCameraStream>> streams = { std::make_shared<DCameraStream>() };
+    dstreamOperator_->InsertHotStates(8, info, streams);
+
+    OHOS::sptr<IStreamOperatorCallback> callback(new (std::nothrow) MockDStreamOperatorCallback());
+    sptr<IOfflineStreamOperator> offlineOperator = nullptr;
+    int32_t rc = dstreamOperator_->ChangeToOfflineStream(info.streamIds_, callback, offlineOperator);
+    EXPECT_EQ(CamRetCode::METHOD_NOT_SUPPORTED, rc);
+    EXPECT_EQ(nullptr, offlineOperator);
+    EXPECT_NE(nullptr, dstreamOperator_->FindHotState(previewStreamId));
+    EXPECT_EQ(nullptr, dstreamOperator_->FindOfflineStream(previewStreamId));
+}
 }
 }
 }
\ No newline at end of file
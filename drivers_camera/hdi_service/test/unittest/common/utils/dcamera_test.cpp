@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <chrono>
 
 #include "dcamera.h"
 #include "constants.h"
@@ -217,5 +218,29 @@ HWTEST_F(DCameraTest, GetCurrentLocalTimeStamp_001, TestSize.Level1)
     uint64_t ret = GetCurrentLocalTimeStamp();
     EXPECT_TRUE(ret);
 }
+
+/**
+ * @tc.name: GetCaptureAgeUs_001
+ * @tc.desc: Verify GetCaptureAgeUs ignores unknown and implausible capture times
+ * @tc.type: FUNC
+ * @tc.require: AR
+ */
+HWTEST_F(DCameraTest, GetCaptureAgeUs_001, TestSize.Level1)
+{
+    const int64_t ageUs = 20000;
+    int64_t nowUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    EXPECT_EQ(GetCaptureAgeUs(0), 0);
+    EXPECT_EQ(GetCaptureAgeUs(nowUs + MAX_CAPTURE_AGE_US), 0);
+    EXPECT_EQ(GetCaptureAgeUs(nowUs - MAX_CAPTURE_AGE_US * 2), 0);
+    int64_t ret = GetCaptureAgeUs(nowUs - ageUs);
+    EXPECT_GE(ret, ageUs);
+    EXPECT_LT(ret, MAX_CAPTURE_AGE_US);
+
+    uint64_t before = GetCurrentLocalTimeStamp();
+    uint64_t captureTime = GetCaptureLocalTimeStamp(ageUs);
+    EXPECT_LE(captureTime + static_cast<uint64_t>(ageUs / MSEC_TO_USEC_TIMES), GetCurrentLocalTimeStamp());
+    EXPECT_GE(captureTime + static_cast<uint64_t>(ageUs / MSEC_TO_USEC_TIMES), before);
+}
 }
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 - 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021 - 2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -55,6 +55,8 @@ private:
     static size_t CalculateCameraMetadataMemoryRequired(uint32_t itemCount, uint32_t dataCount);
     static int UpdateCameraMetadataItemSize(camera_metadata_item_entry_t *item, uint32_t dataCount,
         common_metadata_header_t *dst, const void *data);
+    static int UpdateCameraMetadataItemWithSlack(camera_metadata_item_entry_t *item, int32_t dataSize,
+        common_metadata_header_t *dst, const void *data, size_t dataPayloadSize);
     static int AddCameraMetadataItemVerify(common_metadata_header_t *dst,
         uint32_t item, const void *data, size_t dataCount, uint32_t *dataType);
     static int moveMetadataMemery(common_metadata_header_t *dst,
@@ -101,6 +103,12 @@ public:
     // Free camera metadata buffer
     static void FreeCameraMetadataBuffer(common_metadata_header_t *dst);
 
+    // Leave freed payload space of dst as holes instead of moving the data behind it, see camera_metadata_operator.h
+    static void SetCameraMetadataSlack(common_metadata_header_t *dst, bool enable);
+
+    // Close the holes in the data region of dst
+    static int CompactCameraMetadata(common_metadata_header_t *dst);
+
     static std::string MetadataItemDump(const common_metadata_header_t *metadataHeader, uint32_t item);
 
     static std::string FormatCameraMetadataToString(const common_metadata_header_t *metadataHeader);
@@ -122,6 +130,8 @@ public:
     static int MetadataExpandItemMem(common_metadata_header_t *dst, camera_metadata_item_entry_t *item,
         size_t oldItemSize);
     static int32_t GetAllVendorTags(std::vector<vendorTag_t>& tagVec);
+    // Drop the cached vendor tags, the next vendor lookup fetches them again
+    static void ResetVendorTagTable();
 };
 } // namespace Camera
 #endif /* CAMERA_METADATA_INFO_H */
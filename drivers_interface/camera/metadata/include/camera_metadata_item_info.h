@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -30,7 +30,7 @@ const static size_t OHOS_CAMERA_METADATA_TYPE_SIZE[META_NUM_TYPES] = {
     [META_TYPE_RATIONAL] = sizeof(camera_rational_t)
 };
 
-static uint32_t g_ohosCameraSectionBounds[OHOS_SECTION_COUNT][2] = {
+const static uint32_t g_ohosCameraSectionBounds[OHOS_SECTION_COUNT][2] = {
     [OHOS_SECTION_CAMERA_PROPERTIES] = {OHOS_CAMERA_PROPERTIES_START,  OHOS_CAMERA_PROPERTIES_END },
     [OHOS_SECTION_CAMERA_SENSOR] = {OHOS_CAMERA_SENSOR_START,      OHOS_CAMERA_SENSOR_END     },
     [OHOS_SECTION_CAMERA_SENSOR_INFO] = {OHOS_CAMERA_SENSOR_INFO_START, OHOS_CAMERA_SENSOR_INFO_END},
@@ -56,7 +56,7 @@ static uint32_t g_ohosCameraSectionBounds[OHOS_SECTION_COUNT][2] = {
         {OHOS_OPTICAL_IMAGE_STABILIZATION_START, OHOS_OPTICAL_IMAGE_STABILIZATION_END},
 };
 
-static item_info_t g_ohosCameraProperties[OHOS_CAMERA_PROPERTIES_END - OHOS_CAMERA_PROPERTIES_START] = {
+const static item_info_t g_ohosCameraProperties[OHOS_CAMERA_PROPERTIES_END - OHOS_CAMERA_PROPERTIES_START] = {
     [OHOS_ABILITY_CAMERA_POSITION - OHOS_CAMERA_PROPERTIES_START] = {"cameraPosition",       META_TYPE_BYTE,  1 },
     [OHOS_ABILITY_AUTOMOTIVE_CAMERA_POSITION -
         OHOS_CAMERA_PROPERTIES_START] = {"automotiveCameraPositon", META_TYPE_BYTE, 1},
@@ -180,7 +180,7 @@ static item_info_t g_ohosCameraProperties[OHOS_CAMERA_PROPERTIES_END - OHOS_CAME
     [OHOS_CONTROL_STAGE_BOOST - OHOS_CAMERA_PROPERTIES_START] = {"controlStageBoost", META_TYPE_BYTE, 1}
 };
 
-static item_info_t g_ohosCameraSensor[OHOS_CAMERA_SENSOR_END - OHOS_CAMERA_SENSOR_START] = {
+const static item_info_t g_ohosCameraSensor[OHOS_CAMERA_SENSOR_END - OHOS_CAMERA_SENSOR_START] = {
     [OHOS_SENSOR_EXPOSURE_TIME - OHOS_CAMERA_SENSOR_START] = {"exposureTime",        META_TYPE_INT64, 1},
     [OHOS_SENSOR_COLOR_CORRECTION_GAINS - OHOS_CAMERA_SENSOR_START] = {"colorCorrectuonGain", META_TYPE_FLOAT, 1},
     [OHOS_SENSOR_ORIENTATION - OHOS_CAMERA_SENSOR_START] = {"sensorOrientation",         META_TYPE_INT32, 1},
@@ -195,7 +195,7 @@ static item_info_t g_ohosCameraSensor[OHOS_CAMERA_SENSOR_END - OHOS_CAMERA_SENSO
         OHOS_CAMERA_SENSOR_START] = {"foldStateAndNaturalDirectionSensorOrientationMap", META_TYPE_INT32, -1},
 };
 
-static item_info_t g_ohosCameraSensorInfo[OHOS_CAMERA_SENSOR_INFO_END - OHOS_CAMERA_SENSOR_INFO_START] = {
+const static item_info_t g_ohosCameraSensorInfo[OHOS_CAMERA_SENSOR_INFO_END - OHOS_CAMERA_SENSOR_INFO_START] = {
     [OHOS_SENSOR_INFO_ACTIVE_ARRAY_SIZE -
         OHOS_CAMERA_SENSOR_INFO_START] = {"activeArraySize",       META_TYPE_INT32, -1},
     [OHOS_SENSOR_INFO_SENSITIVITY_RANGE -
@@ -208,7 +208,7 @@ static item_info_t g_ohosCameraSensorInfo[OHOS_CAMERA_SENSOR_INFO_END - OHOS_CAM
     [OHOS_SENSOR_INFO_TIMESTAMP - OHOS_CAMERA_SENSOR_INFO_START] = {"sensorOutputTimeStamp", META_TYPE_INT64, 1 },
 };
 
-static item_info_t g_ohosCameraStatistics[OHOS_CAMERA_STATISTICS_END - OHOS_CAMERA_STATISTICS_START] = {
+const static item_info_t g_ohosCameraStatistics[OHOS_CAMERA_STATISTICS_END - OHOS_CAMERA_STATISTICS_START] = {
     [OHOS_STATISTICS_FACE_DETECT_MODE - OHOS_CAMERA_STATISTICS_START] = {"faceDetectMode",   META_TYPE_BYTE,  1 },
     [OHOS_STATISTICS_FACE_DETECT_SWITCH - OHOS_CAMERA_STATISTICS_START] = {"faceDetectSwitch", META_TYPE_BYTE,  1 },
     [OHOS_STATISTICS_FACE_DETECT_MAX_NUM - OHOS_CAMERA_STATISTICS_START] = {"faceDetectMaxNum", META_TYPE_BYTE,  1 },
@@ -240,7 +240,7 @@ static item_info_t g_ohosCameraStatistics[OHOS_CAMERA_STATISTICS_END - OHOS_CAME
         OHOS_CAMERA_STATISTICS_START] = {"baseFaceInfo", META_TYPE_INT32,  -1},
 };
 
-static item_info_t g_ohosCameraControl[OHOS_DEVICE_CONTROL_END - OHOS_DEVICE_CONTROL_START] = {
+const static item_info_t g_ohosCameraControl[OHOS_DEVICE_CONTROL_END - OHOS_DEVICE_CONTROL_START] = {
     [OHOS_CONTROL_AE_ANTIBANDING_MODE -
         OHOS_DEVICE_CONTROL_START] = {"aeAntibandingMode",           META_TYPE_BYTE,     1 },
     [OHOS_CONTROL_AE_EXPOSURE_COMPENSATION -
@@ -344,7 +344,7 @@ static item_info_t g_ohosCameraControl[OHOS_DEVICE_CONTROL_END - OHOS_DEVICE_CON
         OHOS_DEVICE_CONTROL_START] = {"imagingMode", META_TYPE_BYTE, 1},
 };
 
-static item_info_t g_ohosDeviceExposure[OHOS_DEVICE_EXPOSURE_END - OHOS_DEVICE_EXPOSURE_START] = {
+const static item_info_t g_ohosDeviceExposure[OHOS_DEVICE_EXPOSURE_END - OHOS_DEVICE_EXPOSURE_START] = {
     [OHOS_ABILITY_DEVICE_AVAILABLE_EXPOSUREMODES -
         OHOS_DEVICE_EXPOSURE_START] = {"exposureAvailableModes",  META_TYPE_BYTE,          -1},
     [OHOS_CONTROL_EXPOSUREMODE - OHOS_DEVICE_EXPOSURE_START] = {"exposureMode",            META_TYPE_BYTE, 1 },
@@ -357,7 +357,7 @@ static item_info_t g_ohosDeviceExposure[OHOS_DEVICE_EXPOSURE_END - OHOS_DEVICE_E
     [OHOS_ABILITY_AE_LOCK - OHOS_DEVICE_EXPOSURE_START] = {"abilityAELock", META_TYPE_BYTE, -1},
 };
 
-static item_info_t g_ohosDeviceFocus[OHOS_DEVICE_FOCUS_END - OHOS_DEVICE_FOCUS_START] = {
+const static item_info_t g_ohosDeviceFocus[OHOS_DEVICE_FOCUS_END - OHOS_DEVICE_FOCUS_START] = {
     [OHOS_ABILITY_DEVICE_AVAILABLE_FOCUSMODES -
         OHOS_DEVICE_FOCUS_START] = {"focusAvailablesModes", META_TYPE_BYTE,  -1},
     [OHOS_CONTROL_FOCUSMODE - OHOS_DEVICE_FOCUS_START] = {"focusMode",            META_TYPE_BYTE,  1 },
@@ -390,12 +390,12 @@ static item_info_t g_ohosDeviceFocus[OHOS_DEVICE_FOCUS_END - OHOS_DEVICE_FOCUS_S
     [OHOS_STATUS_FOV_INFOS - OHOS_DEVICE_FOCUS_START] = {"fovInfos", META_TYPE_FLOAT, -1},
 };
 
-static item_info_t g_ohosDeviceWhite[OHOS_DEVICE_WHITE_BLANCE_END - OHOS_DEVICE_WHITE_BLANCE_START] = {
+const static item_info_t g_ohosDeviceWhite[OHOS_DEVICE_WHITE_BLANCE_END - OHOS_DEVICE_WHITE_BLANCE_START] = {
     [OHOS_ABILITY_AWB_MODES - OHOS_DEVICE_WHITE_BLANCE_START] = {"whiteAvailablesModes", META_TYPE_BYTE,  -1},
     [OHOS_ABILITY_AWB_LOCK - OHOS_DEVICE_WHITE_BLANCE_START] = {"abilityAWBLock",            META_TYPE_BYTE,  1 },
 };
 
-static item_info_t g_ohosDeviceFlash[OHOS_DEVICE_FLASH_END - OHOS_DEVICE_FLASH_START] = {
+const static item_info_t g_ohosDeviceFlash[OHOS_DEVICE_FLASH_END - OHOS_DEVICE_FLASH_START] = {
     [OHOS_ABILITY_DEVICE_AVAILABLE_FLASHMODES - OHOS_DEVICE_FLASH_START] = {"flashAvailablesModes", META_TYPE_BYTE, -1},
     [OHOS_CONTROL_FLASHMODE - OHOS_DEVICE_FLASH_START] = {"flashMode",            META_TYPE_BYTE, 1 },
     [OHOS_ABILITY_FLASH_MODES - OHOS_DEVICE_FLASH_START] = {"flashSupportiveModes", META_TYPE_BYTE, -1},
@@ -404,7 +404,7 @@ static item_info_t g_ohosDeviceFlash[OHOS_DEVICE_FLASH_END - OHOS_DEVICE_FLASH_S
     [OHOS_ABILITY_SCENE_FLASH_MODES - OHOS_DEVICE_FLASH_START] = {"sceneFlashSupportiveModes", META_TYPE_INT32, -1},
 };
 
-static item_info_t g_ohosDeviceZoom[OHOS_DEVICE_ZOOM_END - OHOS_DEVICE_ZOOM_START] = {
+const static item_info_t g_ohosDeviceZoom[OHOS_DEVICE_ZOOM_END - OHOS_DEVICE_ZOOM_START] = {
     [OHOS_ABILITY_ZOOM_RATIO_RANGE - OHOS_DEVICE_ZOOM_START] = {"zoomRange",      META_TYPE_FLOAT, -1},
     [OHOS_CONTROL_ZOOM_RATIO - OHOS_DEVICE_ZOOM_START] = {"zoomRatio",      META_TYPE_FLOAT, 1 },
     [OHOS_CONTROL_ZOOM_CROP_REGION - OHOS_DEVICE_ZOOM_START] = {"zoomCropRegion", META_TYPE_INT32, -1},
@@ -430,7 +430,7 @@ static item_info_t g_ohosDeviceZoom[OHOS_DEVICE_ZOOM_END - OHOS_DEVICE_ZOOM_STAR
 
 };
 
-static item_info_t g_ohosStreamAbility[OHOS_STREAM_ABILITY_END - OHOS_STREAM_ABILITY_START] = {
+const static item_info_t g_ohosStreamAbility[OHOS_STREAM_ABILITY_END - OHOS_STREAM_ABILITY_START] = {
     [OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS -
         OHOS_STREAM_ABILITY_START] = {"streamAvailableConfigurations", META_TYPE_INT32, -1},
     [OHOS_STREAM_AVAILABLE_FORMATS -
@@ -465,7 +465,7 @@ static item_info_t g_ohosStreamAbility[OHOS_STREAM_ABILITY_END - OHOS_STREAM_ABI
         OHOS_STREAM_ABILITY_START] = {"delayAlloc", META_TYPE_BYTE, 1},
 };
 
-static item_info_t g_ohosStreamControl[OHOS_STREAM_CONTROL_END - OHOS_STREAM_CONTROL_START] = {
+const static item_info_t g_ohosStreamControl[OHOS_STREAM_CONTROL_END - OHOS_STREAM_CONTROL_START] = {
     [OHOS_CONTROL_AUTO_VIDEO_FRAME_RATE -
         OHOS_STREAM_CONTROL_START] = {"streamAutoFpsControl", META_TYPE_BYTE, 1},
     [OHOS_CONTROL_PRERECORD_MODE -
@@ -476,7 +476,7 @@ static item_info_t g_ohosStreamControl[OHOS_STREAM_CONTROL_END - OHOS_STREAM_CON
         OHOS_STREAM_CONTROL_START] = {"streamSupplementaryInfo", META_TYPE_INT32, 1},
 };
 
-static item_info_t g_ohosStreamJpeg[OHOS_STREAM_JPEG_END - OHOS_STREAM_JPEG_START] = {
+const static item_info_t g_ohosStreamJpeg[OHOS_STREAM_JPEG_END - OHOS_STREAM_JPEG_START] = {
     [OHOS_JPEG_GPS_COORDINATES - OHOS_STREAM_JPEG_START] = {"gpsCoordinates",          META_TYPE_DOUBLE, -1},
     [OHOS_JPEG_GPS_PROCESSING_METHOD - OHOS_STREAM_JPEG_START] = {"gpsProcessingMethod",     META_TYPE_BYTE,   1 },
     [OHOS_JPEG_GPS_TIMESTAMP - OHOS_STREAM_JPEG_START] = {"gpsTimestamp",            META_TYPE_INT64,  1 },
@@ -489,7 +489,7 @@ static item_info_t g_ohosStreamJpeg[OHOS_STREAM_JPEG_END - OHOS_STREAM_JPEG_STAR
     [OHOS_JPEG_SIZE - OHOS_STREAM_JPEG_START] = {"size",                    META_TYPE_INT32,  1 },
 };
 
-static item_info_t g_ohosStreamVideo[OHOS_STREAM_VIDEO_END - OHOS_STREAM_VIDEO_START] = {
+const static item_info_t g_ohosStreamVideo[OHOS_STREAM_VIDEO_END - OHOS_STREAM_VIDEO_START] = {
     [OHOS_ABILITY_VIDEO_STABILIZATION_MODES -
         OHOS_STREAM_VIDEO_START] = {"videoAvailableStabilizationModes", META_TYPE_BYTE, -1},
     [OHOS_CONTROL_VIDEO_STABILIZATION_MODE -
@@ -502,7 +502,8 @@ static item_info_t g_ohosStreamVideo[OHOS_STREAM_VIDEO_END - OHOS_STREAM_VIDEO_S
         OHOS_STREAM_VIDEO_START] = {"cinemaVideoKeyFrameType",           META_TYPE_BYTE, 1 },
 };
 
-static item_info_t g_ohosStreamPhotoStitching[OHOS_STREAM_PHOTO_STITCHING_END - OHOS_STREAM_PHOTO_STITCHING_START] = {
+const static item_info_t g_ohosStreamPhotoStitching[OHOS_STREAM_PHOTO_STITCHING_END -
+    OHOS_STREAM_PHOTO_STITCHING_START] = {
     [OHOS_CONTROL_PHOTO_STITCHING_TYPE -
         OHOS_STREAM_PHOTO_STITCHING_START] = {"photoStitchingType", META_TYPE_BYTE, 1},
     [OHOS_CONTROL_PHOTO_STITCHING_DIRECTION -
@@ -519,7 +520,7 @@ static item_info_t g_ohosStreamPhotoStitching[OHOS_STREAM_PHOTO_STITCHING_END -
          OHOS_STREAM_PHOTO_STITCHING_START] = {"photoStitchingMovingClockwise", META_TYPE_BYTE, 1 },
 };
 
-static item_info_t g_ohosPostProcess[OHOS_CAMERA_EFFECT_END - OHOS_CAMERA_EFFECT_START] {
+const static item_info_t g_ohosPostProcess[OHOS_CAMERA_EFFECT_END - OHOS_CAMERA_EFFECT_START] {
     [OHOS_ABILITY_SCENE_FILTER_TYPES -
         OHOS_CAMERA_EFFECT_START] = {"sceneAvailableFilterTypes", META_TYPE_BYTE, -1},
     [OHOS_CONTROL_FILTER_TYPE -
@@ -760,7 +761,7 @@ static item_info_t g_ohosPostProcess[OHOS_CAMERA_EFFECT_END - OHOS_CAMERA_EFFECT
 
 };
 
-static item_info_t g_ohosCameraSecure[OHOS_CAMERA_SECURE_END - OHOS_CAMERA_SECURE_START] = {
+const static item_info_t g_ohosCameraSecure[OHOS_CAMERA_SECURE_END - OHOS_CAMERA_SECURE_START] = {
     [OHOS_CONTROL_SECURE_FACE_MODE -
         OHOS_CAMERA_SECURE_START] = {"secureFaceMode", META_TYPE_INT32, 1},
     [OHOS_CONTROL_SECURE_FACE_INFO -
@@ -775,7 +776,7 @@ static item_info_t g_ohosCameraSecure[OHOS_CAMERA_SECURE_END - OHOS_CAMERA_SECUR
         OHOS_CAMERA_SECURE_START] = {"irLockaeSwitch", META_TYPE_BYTE, 1},
 };
 
-static item_info_t g_ohosCameraXmage[OHOS_XMAGE_COLOR_MODES_END - OHOS_XMAGE_COLOR_MODES_START] = {
+const static item_info_t g_ohosCameraXmage[OHOS_XMAGE_COLOR_MODES_END - OHOS_XMAGE_COLOR_MODES_START] = {
     [OHOS_ABILITY_SUPPORTED_COLOR_MODES -
         OHOS_XMAGE_COLOR_MODES_START] = {"cameraXmageSupportMode",  META_TYPE_INT32,  1},
     [OHOS_ABILITY_SCENE_SUPPORTED_COLOR_MODES -
@@ -794,7 +795,7 @@ static item_info_t g_ohosCameraXmage[OHOS_XMAGE_COLOR_MODES_END - OHOS_XMAGE_COL
         OHOS_XMAGE_COLOR_MODES_START] = {"colorStyleSupportPhotoType", META_TYPE_BYTE,  1},
 };
 
-static item_info_t g_ohosCameraLightStatus[OHOS_LIGHT_STATUS_END - OHOS_LIGHT_STATUS_START] = {
+const static item_info_t g_ohosCameraLightStatus[OHOS_LIGHT_STATUS_END - OHOS_LIGHT_STATUS_START] = {
     [OHOS_ABILITY_LIGHT_STATUS -
         OHOS_LIGHT_STATUS_START] = {"cameraLightStatusSupported",  META_TYPE_BYTE,  1},
     [OHOS_CONTROL_LIGHT_STATUS -
@@ -803,7 +804,8 @@ static item_info_t g_ohosCameraLightStatus[OHOS_LIGHT_STATUS_END - OHOS_LIGHT_ST
         OHOS_LIGHT_STATUS_START] = {"cameraLightStatus",  META_TYPE_BYTE,  1},
 };
 
-static item_info_t g_ohosCameraComposition[OHOS_COMPOSITION_SUGGESTION_END - OHOS_COMPOSITION_SUGGESTION_START] = {
+const static item_info_t g_ohosCameraComposition[OHOS_COMPOSITION_SUGGESTION_END -
+    OHOS_COMPOSITION_SUGGESTION_START] = {
     [OHOS_ABILITY_COMPOSITION_SUGGESTION -
         OHOS_COMPOSITION_SUGGESTION_START] = {"compositionSuggestionSupported", META_TYPE_BYTE, 1},
     [OHOS_CONTROL_COMPOSITION_SUGGESTION -
@@ -828,7 +830,7 @@ static item_info_t g_ohosCameraComposition[OHOS_COMPOSITION_SUGGESTION_END - OHO
         OHOS_COMPOSITION_SUGGESTION_START] = {"compositionSuggestPictureSizes", META_TYPE_UINT32, -1},
 };
 
-static item_info_t g_ohosCameraDataDelivery[OHOS_DATA_DELIVERY_END - OHOS_DATA_DELIVERY_START] = {
+const static item_info_t g_ohosCameraDataDelivery[OHOS_DATA_DELIVERY_END - OHOS_DATA_DELIVERY_START] = {
     [OHOS_ABILITY_AUTO_MOTION_BOOST_DELIVERY -
         OHOS_DATA_DELIVERY_START] = {"autoMotionBoostDelivery", META_TYPE_BYTE, -1},
     [OHOS_CONTROL_AUTO_MOTION_BOOST_DELIVERY_SWITCH -
@@ -839,7 +841,7 @@ static item_info_t g_ohosCameraDataDelivery[OHOS_DATA_DELIVERY_END - OHOS_DATA_D
         OHOS_DATA_DELIVERY_START] = {"controlAutoBokehDataDelivery", META_TYPE_BYTE, 1},
 };
 
-static item_info_t g_ohosCameraOpticalImageStabilization[OHOS_OPTICAL_IMAGE_STABILIZATION_END -
+const static item_info_t g_ohosCameraOpticalImageStabilization[OHOS_OPTICAL_IMAGE_STABILIZATION_END -
                                                          OHOS_OPTICAL_IMAGE_STABILIZATION_START] = {
     [OHOS_ABILITY_OPTICAL_IMAGE_STABILIZATION_MODES -
         OHOS_OPTICAL_IMAGE_STABILIZATION_START] = {"opticalImageStabilizationSupportedModes", META_TYPE_INT32, -1},
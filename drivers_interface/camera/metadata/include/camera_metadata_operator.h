@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -195,6 +195,15 @@ int DeleteCameraMetadataItemByIndex(common_metadata_header_t *dst, uint32_t inde
 // Free camera metadata buffer
 void FreeCameraMetadataBuffer(common_metadata_header_t *dst);
 
+// Growth slack for buffers whose variable-length items are updated repeatedly. Once enabled, a payload that shrinks
+// or moves, and the payload of a deleted item, are left as holes in the data region instead of moving the data
+// behind them, and a relocated payload gets room to grow in place. The holes are closed when the data region runs
+// out, or explicitly by CompactCameraMetadata.
+void SetCameraMetadataSlack(common_metadata_header_t *dst, bool enable);
+
+// Close the holes in the data region of dst
+int CompactCameraMetadata(common_metadata_header_t *dst);
+
 std::string MetadataItemDump(const common_metadata_header_t *metadataHeader, uint32_t item);
 
 std::string FormatCameraMetadataToString(const common_metadata_header_t *metadataHeader);
@@ -216,5 +225,6 @@ int32_t GetMetadataSection(uint32_t itemSection, uint32_t *section);
 int MetadataExpandItemMem(common_metadata_header_t *dst, camera_metadata_item_entry_t *item,
     size_t oldItemSize);
 int32_t GetAllVendorTags(std::vector<vendorTag_t>& tagVec);
+void ResetVendorTagTable();
 } // Camera
 #endif // CAMERA_METADATA_OPERATOR_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -25,16 +25,25 @@
 #include "message_parcel.h"
 
 namespace OHOS::Camera {
+static constexpr uint32_t ASHMEM_METADATA_THRESHOLD = (64 * 1024);
+
 class MetadataUtils {
 public:
     static bool EncodeCameraMetadata(const std::shared_ptr<CameraMetadata> &metadata,
                                      MessageParcel &data);
     static void DecodeCameraMetadata(MessageParcel &data, std::shared_ptr<CameraMetadata> &metadata);
+    // Metadata of ASHMEM_METADATA_THRESHOLD bytes or more is written to a sealed ashmem region that sends only its
+    // fd, generation and length, smaller metadata is inlined as by EncodeCameraMetadata. Both ends have to use
+    // this pair. The receiver copies the region once into its own buffer, and never writes the shared one.
+    static bool EncodeCameraMetadataToAshmem(const std::shared_ptr<CameraMetadata> &metadata, MessageParcel &data);
+    static void DecodeCameraMetadataFromAshmem(MessageParcel &data, std::shared_ptr<CameraMetadata> &metadata);
 
     static void ReadCameraMetadata(MessageParcel &data, common_metadata_header_t *meta, uint32_t tagCount);
     static bool WriteCameraMetadata(const common_metadata_header_t* meta, MessageParcel &data);
     static std::string EncodeToString(std::shared_ptr<CameraMetadata> metadata);
     static std::shared_ptr<CameraMetadata> DecodeFromString(std::string setting);
+    // Same as DecodeFromString, for an encoded buffer that is not held in a string.
+    static std::shared_ptr<CameraMetadata> DecodeFromBuffer(const char *setting, uint32_t totalLen);
     static bool ConvertMetadataToVec(const std::shared_ptr<CameraMetadata> &metadata,
         std::vector<uint8_t>& cameraAbility);
     static void ConvertVecToMetadata(const std::vector<uint8_t>& cameraAbility,
@@ -45,14 +54,17 @@ public:
     template <class T> static void ReadData(T &data, int32_t &index, const std::vector<uint8_t>& cameraAbility);
 private:
     static bool WriteMetadata(const camera_metadata_item_t &item, MessageParcel &data);
-    static bool ReadMetadata(camera_metadata_item_t &item, MessageParcel &data);
-    static void ItemDataToBuffer(const camera_metadata_item_t &item, void **buffer);
+    // Points at the payload of item in data, or in rationalBuffer for rationals, nullptr when there is none.
+    static const void *ReadMetadataPayload(camera_metadata_item_t &item, MessageParcel &data,
+        std::vector<int32_t> &rationalBuffer);
     static void WriteMetadataDataToVec(const camera_metadata_item_t &entry, std::vector<uint8_t>& cameraAbility);
-    static void ReadMetadataDataFromVec(int32_t &index, camera_metadata_item_t &entry,
+    static bool ReadMetadataDataFromVec(int32_t &index, camera_metadata_item_t &entry, size_t &payloadOffset,
         const std::vector<uint8_t>& cameraAbility);
+    static uint64_t GetEncodedLength(const common_metadata_header_t *meta);
+    static bool EncodeToBuffer(common_metadata_header_t *meta, char *encodeData, uint32_t encodeDataLen);
     static int copyEncodeToStringMem(common_metadata_header_t *meta, char *encodeData, int32_t encodeDataLen);
-    static int copyDecodeFromStringMem(common_metadata_header_t *meta, char *decodeData,
-        char *decodeMetadataData, uint32_t totalLen);
+    static int copyDecodeFromStringMem(common_metadata_header_t *meta, const char *decodeData,
+        const char *decodeMetadataData, uint32_t totalLen);
 };
 
 template <class T>
@@ -60,9 +72,7 @@ void MetadataUtils::WriteData(T data, std::vector<uint8_t>& cameraAbility)
 {
     T dataTemp = data;
     uint8_t *dataPtr = reinterpret_cast<uint8_t *>(&dataTemp);
-    for (size_t j = 0; j < sizeof(T); j++) {
-        cameraAbility.push_back(*(dataPtr + j));
-    }
+    cameraAbility.insert(cameraAbility.end(), dataPtr, dataPtr + sizeof(T));
 }
 
 template <class T>
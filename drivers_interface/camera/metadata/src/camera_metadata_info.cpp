@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,15 +16,24 @@
 #include "camera_metadata_info.h"
 #include <securec.h>
 #include "metadata_log.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <dlfcn.h>
 #include <memory>
 #include <vector>
 #include <map>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include "camera_metadata_item_info.h"
 #include "camera_vendor_tag.h"
 #include "metadata_utils.h"
 #include "metadata/v1_0/icamera_vendor_tag.h"
+#ifdef CAMERA_VENDOR_TAG
+#include "iproxy_broker.h"
+#endif
 
 namespace OHOS::Camera {
 static std::mutex g_mtx;
@@ -37,6 +46,52 @@ static sptr<OHOS::HDI::Camera::Metadata::V1_0::ICameraVendorTag> g_cameraVendorT
 #endif
 const int METADATA_HEADER_DATA_SIZE = 4;
 const uint32_t itemLen = sizeof(camera_metadata_item_entry_t);
+// Buffers with fewer items are scanned, a hash lookup does not pay off below this.
+const uint32_t INDEXED_ITEM_COUNT_MIN = 16;
+const size_t INDEXED_METADATA_MAX = 128;
+
+// Tag to position side index of a metadata buffer. It lives outside the buffer so the packed layout is unchanged;
+// positions are checked against the entries before use and the index is rebuilt when they no longer match.
+// Buffers are passed around as bare headers, also over parcel, ashmem and caller memory, so the index is keyed by
+// the header address rather than kept in the allocation.
+struct MetadataItemIndex {
+    const camera_metadata_item_entry_t *items = nullptr;
+    uint32_t itemCount = 0;
+    uint64_t buildSeq = 0;
+    std::unordered_map<uint32_t, uint32_t> positions;
+};
+// Finds on a current index share the lock, only building and dropping an index takes it exclusively.
+static std::shared_mutex g_itemIndexMtx;
+static std::unordered_map<const common_metadata_header_t *, MetadataItemIndex> g_itemIndexes;
+static uint64_t g_itemIndexSeq = 0;
+// Buffers whose freed payload space is left as holes, see CameraMetadata::SetCameraMetadataSlack.
+static std::mutex g_slackMtx;
+static std::unordered_set<const common_metadata_header_t *> g_slackMetadata;
+// Share of a relocated payload reserved behind it, so the next growth of the item stays in place.
+const uint32_t SLACK_GROWTH_DIVISOR = 2;
+
+static bool IsSlackEnabled(const common_metadata_header_t *metadata)
+{
+    std::lock_guard<std::mutex> lock(g_slackMtx);
+    return g_slackMetadata.find(metadata) != g_slackMetadata.end();
+}
+
+static void ForgetSlack(const common_metadata_header_t *metadata)
+{
+    std::lock_guard<std::mutex> lock(g_slackMtx);
+    g_slackMetadata.erase(metadata);
+}
+
+struct VendorTagInfo {
+    uint32_t type = 0;
+    bool hasName = false;
+    std::string name;
+};
+using VendorTagTable = std::unordered_map<uint32_t, VendorTagInfo>;
+// Vendor tags fetched once and published read-only, lookups take no lock. Published tables are never freed, so a
+// name handed out stays valid after the table is fetched again.
+static std::atomic<const VendorTagTable *> g_vendorTagTable = nullptr;
+static std::vector<std::unique_ptr<const VendorTagTable>> g_vendorTagTables;
 const std::vector<uint32_t> g_metadataTags = {
     OHOS_ABILITY_CAMERA_POSITION,
     OHOS_ABILITY_CAMERA_TYPE,
@@ -469,7 +524,12 @@ const std::vector<uint32_t> g_metadataTags = {
     OHOS_CONTROL_SET_CUSTOM_OPTICAL_IMAGE_STABILIZATION_BIAS,
 };
 
-std::map<uint32_t, uint32_t> g_metadataSectionMap = {
+struct MetadataSectionEntry {
+    uint32_t itemSection;
+    uint32_t section;
+};
+
+constexpr MetadataSectionEntry METADATA_SECTIONS[] = {
     {OHOS_CAMERA_PROPERTIES, OHOS_SECTION_CAMERA_PROPERTIES},
     {OHOS_CAMERA_SENSOR, OHOS_SECTION_CAMERA_SENSOR},
     {OHOS_CAMERA_SENSOR_INFO, OHOS_SECTION_CAMERA_SENSOR_INFO},
@@ -494,6 +554,40 @@ std::map<uint32_t, uint32_t> g_metadataSectionMap = {
     {OHOS_OPTICAL_IMAGE_STABILIZATION, OHOS_SECTION_OPTICAL_IMAGE_STABILIZATION},
 };
 
+// Item sections come in groups of 0x1000 tags, each group only uses its first few section tags.
+constexpr uint32_t SECTION_GROUP_SHIFT = 12;
+constexpr uint32_t SECTION_GROUP_COUNT = OHOS_ABILITY_SECTION_END >> SECTION_GROUP_SHIFT;
+constexpr uint32_t SECTION_GROUP_MASK = (1 << SECTION_GROUP_SHIFT) - 1;
+constexpr uint32_t SECTION_GROUP_SIZE = 16;
+using MetadataSectionTable = std::array<std::array<uint32_t, SECTION_GROUP_SIZE>, SECTION_GROUP_COUNT>;
+
+constexpr bool IsMetadataSectionInGroup()
+{
+    for (const auto &entry : METADATA_SECTIONS) {
+        if ((entry.itemSection & SECTION_GROUP_MASK) >= SECTION_GROUP_SIZE) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(IsMetadataSectionInGroup(), "an item section does not fit the section table");
+
+constexpr MetadataSectionTable MakeMetadataSectionTable()
+{
+    MetadataSectionTable table {};
+    for (auto &group : table) {
+        for (auto &section : group) {
+            section = OHOS_SECTION_COUNT;
+        }
+    }
+    for (const auto &entry : METADATA_SECTIONS) {
+        table[entry.itemSection >> SECTION_GROUP_SHIFT][entry.itemSection & SECTION_GROUP_MASK] = entry.section;
+    }
+    return table;
+}
+
+constexpr MetadataSectionTable g_metadataSectionTable = MakeMetadataSectionTable();
+
 std::map<uint32_t, uint32_t> g_itemDataTypeMap {
     { OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS, META_TYPE_INT32 },
     { OHOS_ABILITY_STREAM_AVAILABLE_EXTEND_CONFIGURATIONS, META_TYPE_INT32 },
@@ -583,6 +677,9 @@ bool CameraMetadata::resize_add_metadata(uint32_t item, const void *data, size_t
         newMetadata = nullptr;
         return false;
     }
+    if (IsSlackEnabled(metadata_)) {
+        SetCameraMetadataSlack(newMetadata, true);
+    }
     replace_metadata(newMetadata);
 
     return true;
@@ -716,6 +813,104 @@ camera_metadata_item_entry_t *CameraMetadata::GetMetadataItems(const common_meta
         metadataHeader->items_start));
 }
 
+static void InvalidateItemIndex(const common_metadata_header_t *metadata)
+{
+    std::unique_lock<std::shared_mutex> lock(g_itemIndexMtx);
+    g_itemIndexes.erase(metadata);
+}
+
+static void AppendItemIndex(const common_metadata_header_t *metadata, uint32_t item, uint32_t position)
+{
+    std::unique_lock<std::shared_mutex> lock(g_itemIndexMtx);
+    auto iter = g_itemIndexes.find(metadata);
+    if (iter == g_itemIndexes.end()) {
+        return;
+    }
+    if (iter->second.itemCount != position) {
+        g_itemIndexes.erase(iter);
+        return;
+    }
+    iter->second.positions.emplace(item, position);
+    iter->second.itemCount = position + 1;
+}
+
+static void BuildItemIndex(MetadataItemIndex &index, const camera_metadata_item_entry_t *items, uint32_t itemCount)
+{
+    index.items = items;
+    index.itemCount = itemCount;
+    index.buildSeq = ++g_itemIndexSeq;
+    index.positions.clear();
+    index.positions.reserve(itemCount);
+    for (uint32_t position = 0; position < itemCount; position++) {
+        // Keep the first entry of a tag, as the linear scan would find it.
+        index.positions.emplace(items[position].item, position);
+    }
+}
+
+// Sets the position of the item, or itemCount if the buffer does not hold it. Fails if the index is not current.
+static bool FindInItemIndex(const MetadataItemIndex &index, const common_metadata_header_t *src,
+    const camera_metadata_item_entry_t *items, uint32_t item, uint32_t &position)
+{
+    if (index.items != items || index.itemCount != src->item_count) {
+        return false;
+    }
+    auto iter = index.positions.find(item);
+    if (iter == index.positions.end()) {
+        position = src->item_count;
+        return true;
+    }
+    // Another tag at the position means the entries were rewritten behind the index.
+    if (items[iter->second].item != item) {
+        return false;
+    }
+    position = iter->second;
+    return true;
+}
+
+// Drops the index built longest ago, so a full table keeps the indexes of the buffers in use.
+static void EvictOldestItemIndexLocked()
+{
+    auto oldest = g_itemIndexes.begin();
+    for (auto iter = g_itemIndexes.begin(); iter != g_itemIndexes.end(); ++iter) {
+        if (iter->second.buildSeq < oldest->second.buildSeq) {
+            oldest = iter;
+        }
+    }
+    if (oldest != g_itemIndexes.end()) {
+        g_itemIndexes.erase(oldest);
+    }
+}
+
+// Returns the position of the item, or itemCount if the buffer does not hold it.
+static uint32_t LookupItemIndex(const common_metadata_header_t *src, const camera_metadata_item_entry_t *items,
+    uint32_t item)
+{
+    uint32_t position = src->item_count;
+    {
+        std::shared_lock<std::shared_mutex> lock(g_itemIndexMtx);
+        auto iter = g_itemIndexes.find(src);
+        if (iter != g_itemIndexes.end() && FindInItemIndex(iter->second, src, items, item, position)) {
+            return position;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(g_itemIndexMtx);
+    auto iter = g_itemIndexes.find(src);
+    if (iter == g_itemIndexes.end()) {
+        if (g_itemIndexes.size() >= INDEXED_METADATA_MAX) {
+            EvictOldestItemIndexLocked();
+        }
+        iter = g_itemIndexes.emplace(src, MetadataItemIndex()).first;
+    }
+    // Another find may have rebuilt the index between the two locks.
+    MetadataItemIndex &index = iter->second;
+    if (FindInItemIndex(index, src, items, item, position)) {
+        return position;
+    }
+    BuildItemIndex(index, items, src->item_count);
+    auto found = index.positions.find(item);
+    return found == index.positions.end() ? src->item_count : found->second;
+}
+
 common_metadata_header_t *CameraMetadata::FillCameraMetadata(common_metadata_header_t *buffer, size_t memoryRequired,
     uint32_t itemCapacity, uint32_t dataCapacity)
 {
@@ -725,6 +920,9 @@ common_metadata_header_t *CameraMetadata::FillCameraMetadata(common_metadata_hea
         return nullptr;
     }
 
+    // The memory may have held another buffer, forget whatever was indexed at this address.
+    InvalidateItemIndex(buffer);
+    ForgetSlack(buffer);
     common_metadata_header_t *metadataHeader = static_cast<common_metadata_header_t *>(buffer);
     metadataHeader->version = CURRENT_CAMERA_METADATA_VERSION;
     metadataHeader->size = memoryRequired;
@@ -792,6 +990,36 @@ common_metadata_header_t *CameraMetadata::AllocateCameraMetadataBuffer(uint32_t
     return metadataHeader;
 }
 
+#ifdef CAMERA_VENDOR_TAG
+// Drops the service and its tag table when the vendor service dies, the next vendor lookup fetches both again.
+class VendorTagServiceRecipient : public IRemoteObject::DeathRecipient {
+public:
+    void OnRemoteDied(const wptr<IRemoteObject> &remote) override
+    {
+        (void)remote;
+        METADATA_INFO_LOG("Vendor tag service died");
+        CameraMetadata::ResetVendorTagTable();
+    }
+};
+
+// Caller holds g_vendorTagImplMtx. A passthrough service has no remote object and never restarts.
+static void WatchVendorTagService()
+{
+    if (g_cameraVendorTagService == nullptr) {
+        return;
+    }
+    sptr<IRemoteObject> remote =
+        OHOS::HDI::hdi_objcast<OHOS::HDI::Camera::Metadata::V1_0::ICameraVendorTag>(g_cameraVendorTagService);
+    if (remote == nullptr) {
+        return;
+    }
+    static sptr<IRemoteObject::DeathRecipient> recipient = new VendorTagServiceRecipient();
+    if (!remote->AddDeathRecipient(recipient)) {
+        METADATA_WARNING_LOG("Vendor tag service AddDeathRecipient failed");
+    }
+}
+#endif
+
 // Load vendor tag impl
 int32_t LoadVendorTagImpl()
 {
@@ -823,6 +1051,7 @@ int32_t LoadVendorTagImpl()
 #else
         if (g_cameraVendorTagService == nullptr) {
             g_cameraVendorTagService = OHOS::HDI::Camera::Metadata::V1_0::ICameraVendorTag::Get(true);
+            WatchVendorTagService();
         }
         if (g_cameraVendorTagService == nullptr) {
             METADATA_ERR_LOG("Get ICameraVendorTag failed %{public}s", __func__);
@@ -832,9 +1061,57 @@ int32_t LoadVendorTagImpl()
     return CAM_META_SUCCESS;
 }
 
+static const VendorTagTable *GetVendorTagTable()
+{
+    const VendorTagTable *table = g_vendorTagTable.load(std::memory_order_acquire);
+    if (table != nullptr) {
+        return table;
+    }
+    std::vector<vendorTag_t> tagVec;
+    if (CameraMetadata::GetAllVendorTags(tagVec) != CAM_META_SUCCESS) {
+        return nullptr;
+    }
+    auto newTable = std::make_unique<VendorTagTable>();
+    newTable->reserve(tagVec.size());
+    for (const auto &tag : tagVec) {
+        VendorTagInfo &info = (*newTable)[tag.tagId];
+        info.type = tag.tagType;
+        info.hasName = tag.tagName != nullptr;
+        info.name = info.hasName ? tag.tagName : "";
+    }
+    std::lock_guard<std::mutex> lock(g_vendorTagImplMtx);
+    table = g_vendorTagTable.load(std::memory_order_acquire);
+    if (table == nullptr) {
+        table = newTable.get();
+        g_vendorTagTables.push_back(std::move(newTable));
+        g_vendorTagTable.store(table, std::memory_order_release);
+        METADATA_INFO_LOG("Vendor tag table published, tag count: %{public}zu", table->size());
+    }
+    return table;
+}
+
+void CameraMetadata::ResetVendorTagTable()
+{
+    std::lock_guard<std::mutex> lock(g_vendorTagImplMtx);
+#ifdef CAMERA_VENDOR_TAG
+    g_cameraVendorTagService = nullptr;
+#endif
+    g_vendorTagTable.store(nullptr, std::memory_order_release);
+}
+
+static const VendorTagInfo *FindVendorTag(uint32_t item)
+{
+    const VendorTagTable *table = GetVendorTagTable();
+    if (table == nullptr) {
+        METADATA_ERR_LOG("LoadVendorTagImpl failed");
+        return nullptr;
+    }
+    auto iter = table->find(item);
+    return iter == table->end() ? nullptr : &iter->second;
+}
+
 int32_t CameraMetadata::GetMetadataSection(uint32_t itemSection, uint32_t *section)
 {
-    METADATA_DEBUG_LOG("GetMetadataSection start");
     if (itemSection < OHOS_CAMERA_PROPERTIES ||
         itemSection >= OHOS_ABILITY_SECTION_END) {
         METADATA_ERR_LOG("GetMetadataSection itemSection is not valid");
@@ -846,22 +1123,18 @@ int32_t CameraMetadata::GetMetadataSection(uint32_t itemSection, uint32_t *secti
         return CAM_META_FAILURE;
     }
 
-    int32_t ret = CAM_META_SUCCESS;
-    auto iter = g_metadataSectionMap.find(itemSection);
-    if (iter != g_metadataSectionMap.end()) {
-        *section = iter->second;
-    } else {
+    uint32_t index = itemSection & SECTION_GROUP_MASK;
+    if (index >= SECTION_GROUP_SIZE ||
+        g_metadataSectionTable[itemSection >> SECTION_GROUP_SHIFT][index] == OHOS_SECTION_COUNT) {
         METADATA_ERR_LOG("GetMetadataSection item section is not defined");
-        ret = CAM_META_FAILURE;
+        return CAM_META_FAILURE;
     }
-
-    METADATA_DEBUG_LOG("GetMetadataSection end");
-    return ret;
+    *section = g_metadataSectionTable[itemSection >> SECTION_GROUP_SHIFT][index];
+    return CAM_META_SUCCESS;
 }
 
 int32_t CameraMetadata::GetCameraMetadataItemType(uint32_t item, uint32_t *dataType)
 {
-    METADATA_DEBUG_LOG("GetCameraMetadataItemType start");
     if (dataType == nullptr) {
         METADATA_ERR_LOG("GetCameraMetadataItemType dataType is null");
         return CAM_META_INVALID_PARAM;
@@ -869,23 +1142,12 @@ int32_t CameraMetadata::GetCameraMetadataItemType(uint32_t item, uint32_t *dataT
     uint32_t section;
     uint32_t itemTag = item >> BITWISE_SHIFT_16;
     if (itemTag >= OHOS_VENDOR_SECTION) {
-        int32_t ret = LoadVendorTagImpl();
-        if (ret != CAM_META_SUCCESS) {
-            METADATA_ERR_LOG("LoadVendorTagImpl failed");
-            return CAM_META_FAILURE;
-        }
-        std::lock_guard<std::mutex> lock(g_vendorTagImplMtx);
-#ifndef CAMERA_VENDOR_TAG
-        *dataType = g_vendorTagImpl->GetVendorTagType(item);
-#else
-        int8_t hdiDataType = -1;
-        ret = g_cameraVendorTagService->GetVendorTagType(item, hdiDataType);
-        *dataType = static_cast<uint32_t>(hdiDataType);
-        if (ret != CAM_META_SUCCESS) {
+        const VendorTagInfo *info = FindVendorTag(item);
+        if (info == nullptr) {
             METADATA_ERR_LOG("GetVendorTagType failed");
             return CAM_META_FAILURE;
         }
-#endif
+        *dataType = info->type;
         return CAM_META_SUCCESS;
     }
     int32_t ret = GetMetadataSection(itemTag, &section);
@@ -906,31 +1168,16 @@ int32_t CameraMetadata::GetCameraMetadataItemType(uint32_t item, uint32_t *dataT
     }
 
     *dataType = g_ohosItemInfo[section][itemIndex].item_type;
-
-    METADATA_DEBUG_LOG("GetCameraMetadataItemType end");
     return CAM_META_SUCCESS;
 }
 
 const char *CameraMetadata::GetCameraMetadataItemName(uint32_t item)
 {
-    METADATA_DEBUG_LOG("GetCameraMetadataItemName start");
-    METADATA_DEBUG_LOG("GetCameraMetadataItemName item: %{public}u", item);
     uint32_t section;
     uint32_t itemTag = item >> BITWISE_SHIFT_16;
     if (itemTag >= OHOS_VENDOR_SECTION) {
-        int32_t ret = LoadVendorTagImpl();
-        if (ret != CAM_META_SUCCESS) {
-            METADATA_ERR_LOG("LoadVendorTagImpl failed");
-            return nullptr;
-        }
-        std::lock_guard<std::mutex> lock(g_vendorTagImplMtx);
-#ifndef CAMERA_VENDOR_TAG
-        const char* tagName = g_vendorTagImpl->GetVendorTagName(item);
-#else
-        void* tagName = nullptr;
-        g_cameraVendorTagService->GetVendorTagName(item, tagName);
-#endif
-        return reinterpret_cast<const char*>(tagName);
+        const VendorTagInfo *info = FindVendorTag(item);
+        return (info == nullptr || !info->hasName) ? nullptr : info->name.c_str();
     }
     int32_t ret = GetMetadataSection(itemTag, &section);
     if (ret != CAM_META_SUCCESS) {
@@ -944,33 +1191,31 @@ const char *CameraMetadata::GetCameraMetadataItemName(uint32_t item)
     }
 
     uint32_t itemIndex = item & 0xFFFF;
-    METADATA_DEBUG_LOG("GetCameraMetadataItemName end");
     return g_ohosItemInfo[section][itemIndex].item_name;
 }
 
 int32_t CameraMetadata::CalculateCameraMetadataItemDataSize(uint32_t type, size_t dataCount)
 {
-    METADATA_DEBUG_LOG("CalculateCameraMetadataItemDataSize start");
     if (type < META_TYPE_BYTE || type >= META_NUM_TYPES) {
         METADATA_ERR_LOG("CalculateCameraMetadataItemDataSize invalid type");
         return CAM_META_FAILURE;
     }
 
     size_t dataBytes = dataCount * OHOS_CAMERA_METADATA_TYPE_SIZE[type];
-
-    METADATA_DEBUG_LOG("CalculateCameraMetadataItemDataSize end");
     return (dataBytes <= METADATA_HEADER_DATA_SIZE) ? 0 : AlignTo(dataBytes, DATA_ALIGNMENT);
 }
 
 int CameraMetadata::AddCameraMetadataItemVerify(common_metadata_header_t *dst,
     uint32_t item, const void *data, size_t dataCount, uint32_t *dataType)
 {
+#ifdef DEBUG_BUILD
     const char *name = GetCameraMetadataItemName(item);
     if (name == nullptr) {
         name = "<unknown>";
     }
     METADATA_DEBUG_LOG("AddCameraMetadataItemVerify item id: %{public}u, name: %{public}s, "
         "dataCount: %{public}zu", item, name, dataCount);
+#endif
 
     if (dst == nullptr) {
         METADATA_ERR_LOG("AddCameraMetadataItemVerify common_metadata_header_t is null");
@@ -1018,6 +1263,9 @@ int CameraMetadata::AddCameraMetadataItem(common_metadata_header_t *dst, uint32_
     }
 
     int32_t dataBytes = CalculateCameraMetadataItemDataSize(dataType, dataCount);
+    if ((uint32_t)dataBytes + dst->data_count > dst->data_capacity && IsSlackEnabled(dst)) {
+        (void)CompactCameraMetadata(dst);
+    }
     if ((uint32_t)dataBytes >= (UINT32_MAX - dst->data_count) ||
         (uint32_t)dataBytes + dst->data_count > dst->data_capacity) {
         METADATA_ERR_LOG("AddCameraMetadataItem data_capacity limit reached");
@@ -1074,6 +1322,7 @@ int CameraMetadata::AddCameraMetadataItem(common_metadata_header_t *dst, uint32_
         dst->data_count += (uint32_t)dataBytes;
     }
     dst->item_count++;
+    AppendItemIndex(dst, item, dst->item_count - 1);
 
     METADATA_DEBUG_LOG("AddCameraMetadataItem end");
     return CAM_META_SUCCESS;
@@ -1149,9 +1398,14 @@ int CameraMetadata::FindCameraMetadataItemIndex(const common_metadata_header_t *
         return CAM_META_INVALID_PARAM;
     }
     uint32_t index;
-    for (index = 0; index < src->item_count; index++, searchItem++) {
-        if (searchItem->item == item) {
-            break;
+    if (src->item_count >= INDEXED_ITEM_COUNT_MIN) {
+        index = LookupItemIndex(src, searchItem, item);
+        searchItem += index;
+    } else {
+        for (index = 0; index < src->item_count; index++, searchItem++) {
+            if (searchItem->item == item) {
+                break;
+            }
         }
     }
 
@@ -1176,11 +1430,13 @@ int CameraMetadata::FindCameraMetadataItem(const common_metadata_header_t *src,
     camera_metadata_item_t *metadataItem)
 {
     uint32_t index = 0;
+#ifdef DEBUG_BUILD
     const char *name = GetCameraMetadataItemName(item);
     if (name == nullptr) {
         name = "<unknown>";
     }
     METADATA_DEBUG_LOG("FindCameraMetadataItem item id: %{public}u, name: %{public}s", item, name);
+#endif
     int ret = FindCameraMetadataItemIndex(src, item, &index);
     if (ret != CAM_META_SUCCESS) {
         return ret;
@@ -1297,6 +1553,17 @@ int CameraMetadata::UpdateCameraMetadataItemSize(camera_metadata_item_entry_t *i
         METADATA_ERR_LOG("UpdateCameraMetadataItemSize item is null or dst is null");
         return CAM_META_FAILURE;
     }
+    if (dataSize != oldItemSize && IsSlackEnabled(dst)) {
+        ret = UpdateCameraMetadataItemWithSlack(item, dataSize, dst, data, dataPayloadSize);
+        if (ret != CAM_META_DATA_CAP_EXCEED) {
+            return ret;
+        }
+        // Out of room even past the holes, close them and move the tail as the dense policy does.
+        ret = CompactCameraMetadata(dst);
+        if (ret != CAM_META_SUCCESS) {
+            return ret;
+        }
+    }
     if (dataSize != oldItemSize) {
         if (dst->data_count > UINT32_MAX - (uint32_t)dataSize &&
             dst->data_count + (uint32_t)dataSize < (uint32_t)oldItemSize) {
@@ -1339,6 +1606,61 @@ int CameraMetadata::UpdateCameraMetadataItemSize(camera_metadata_item_entry_t *i
     return ret;
 }
 
+// End of the data slot of item: the next payload behind it, or the end of the used data region.
+static uint32_t GetItemSlotEnd(const common_metadata_header_t *dst, const camera_metadata_item_entry_t *item)
+{
+    uint32_t slotEnd = dst->data_count;
+    const camera_metadata_item_entry_t *metadataItems = CameraMetadata::GetMetadataItems(dst);
+    for (uint32_t i = 0; i < dst->item_count; i++, ++metadataItems) {
+        if (metadataItems != item &&
+            CameraMetadata::CalculateCameraMetadataItemDataSize(metadataItems->data_type, metadataItems->count) > 0 &&
+            metadataItems->data.offset >= item->data.offset && metadataItems->data.offset < slotEnd) {
+            slotEnd = metadataItems->data.offset;
+        }
+    }
+    return slotEnd;
+}
+
+int CameraMetadata::UpdateCameraMetadataItemWithSlack(camera_metadata_item_entry_t *item, int32_t dataSize,
+    common_metadata_header_t *dst, const void *data, size_t dataPayloadSize)
+{
+    int32_t oldItemSize = CalculateCameraMetadataItemDataSize(item->data_type, item->count);
+    if (dataSize == 0) {
+        // The payload moves into the entry, its old slot becomes a hole.
+        return memcpy_s(item->data.value, ENTRY_DATA_SIZE, data, dataPayloadSize) == EOK ?
+            CAM_META_SUCCESS : CAM_META_FAILURE;
+    }
+    uint32_t newSize = static_cast<uint32_t>(dataSize);
+    uint32_t growth = AlignTo(newSize / SLACK_GROWTH_DIVISOR, DATA_ALIGNMENT);
+    if (oldItemSize > 0 && item->data.offset <= dst->data_count) {
+        uint32_t slotEnd = GetItemSlotEnd(dst, item);
+        if (newSize <= slotEnd - item->data.offset) {
+            return copyMetadataMemory(dst, item, dataPayloadSize, data);
+        }
+        // The last payload grows into the free space behind the used region.
+        if (slotEnd == dst->data_count && newSize <= dst->data_capacity - item->data.offset) {
+            int32_t ret = copyMetadataMemory(dst, item, dataPayloadSize, data);
+            if (ret == CAM_META_SUCCESS) {
+                uint32_t room = dst->data_capacity - item->data.offset;
+                dst->data_count = item->data.offset + std::min(newSize + growth, room);
+            }
+            return ret;
+        }
+    }
+    if (dst->data_count > dst->data_capacity || newSize > dst->data_capacity - dst->data_count) {
+        return CAM_META_DATA_CAP_EXCEED;
+    }
+    uint32_t oldOffset = item->data.offset;
+    item->data.offset = dst->data_count;
+    int32_t ret = copyMetadataMemory(dst, item, dataPayloadSize, data);
+    if (ret != CAM_META_SUCCESS) {
+        item->data.offset = oldOffset;
+        return ret;
+    }
+    dst->data_count += std::min(newSize + growth, dst->data_capacity - dst->data_count);
+    return CAM_META_SUCCESS;
+}
+
 int CameraMetadata::UpdateCameraMetadataItemByIndex(common_metadata_header_t *dst, uint32_t index,
     const void *data, uint32_t dataCount, camera_metadata_item_t *updatedItem)
 {
@@ -1383,12 +1705,14 @@ int CameraMetadata::UpdateCameraMetadataItem(common_metadata_header_t *dst, uint
     uint32_t dataCount, camera_metadata_item_t *updatedItem)
 {
     METADATA_DEBUG_LOG("UpdateCameraMetadataItem item id: %{public}u, dataCount: %{public}u", item, dataCount);
+#ifdef DEBUG_BUILD
     const char *name = GetCameraMetadataItemName(item);
     if (name == nullptr) {
         name = "<unknown>";
     }
     METADATA_DEBUG_LOG("UpdateCameraMetadataItem item id: %{public}u, name: %{public}s, "
         "dataCount: %{public}u", item, name, dataCount);
+#endif
     if (!dataCount || data == nullptr) {
         METADATA_ERR_LOG("UpdateCameraMetadataItem data is not valid. item: %{public}u, "
             "dataCount: %{public}u", item, dataCount);
@@ -1449,9 +1773,12 @@ int CameraMetadata::DeleteCameraMetadataItemByIndex(common_metadata_header_t *ds
         METADATA_ERR_LOG("DeleteCameraMetadataItemByIndex pItem is null");
         return CAM_META_INVALID_PARAM;
     }
+    // Every entry behind the deleted one moves down, the index is rebuilt on the next lookup.
+    InvalidateItemIndex(dst);
     camera_metadata_item_entry_t *itemToDelete = pItem + index;
     int32_t dataBytes = CalculateCameraMetadataItemDataSize(itemToDelete->data_type, itemToDelete->count);
-    if (dataBytes > 0) {
+    // With slack the payload stays behind as a hole, only the entry table is closed up.
+    if (dataBytes > 0 && !IsSlackEnabled(dst)) {
         ret = moveMetadataMemery(dst, itemToDelete, dataBytes);
         if (ret != CAM_META_SUCCESS) {
             return ret;
@@ -1466,7 +1793,7 @@ int CameraMetadata::DeleteCameraMetadataItemByIndex(common_metadata_header_t *ds
             if (CalculateCameraMetadataItemDataSize(
                 metadataItems->data_type, metadataItems->count) > 0 &&
                 metadataItems->data.offset > itemToDelete->data.offset &&
-                metadataItems->data.offset > (uint32_t)dataBytes) {
+                metadataItems->data.offset >= (uint32_t)dataBytes) {
                 metadataItems->data.offset -= (uint32_t)dataBytes;
             }
         }
@@ -1500,9 +1827,67 @@ int CameraMetadata::DeleteCameraMetadataItem(common_metadata_header_t *dst, uint
     return DeleteCameraMetadataItemByIndex(dst, index);
 }
 
+void CameraMetadata::SetCameraMetadataSlack(common_metadata_header_t *dst, bool enable)
+{
+    if (dst == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(g_slackMtx);
+    if (enable) {
+        g_slackMetadata.insert(dst);
+    } else {
+        g_slackMetadata.erase(dst);
+    }
+}
+
+int CameraMetadata::CompactCameraMetadata(common_metadata_header_t *dst)
+{
+    METADATA_DEBUG_LOG("CompactCameraMetadata start");
+    uint8_t *dstMetadataData = GetMetadataData(dst);
+    camera_metadata_item_entry_t *metadataItems = GetMetadataItems(dst);
+    if (dstMetadataData == nullptr || metadataItems == nullptr) {
+        METADATA_ERR_LOG("CompactCameraMetadata dst is not valid");
+        return CAM_META_INVALID_PARAM;
+    }
+    std::vector<camera_metadata_item_entry_t *> payloadItems;
+    payloadItems.reserve(dst->item_count);
+    for (uint32_t i = 0; i < dst->item_count; i++) {
+        if (CalculateCameraMetadataItemDataSize(metadataItems[i].data_type, metadataItems[i].count) > 0) {
+            payloadItems.push_back(metadataItems + i);
+        }
+    }
+    std::sort(payloadItems.begin(), payloadItems.end(),
+        [](const camera_metadata_item_entry_t *lhs, const camera_metadata_item_entry_t *rhs) {
+            return lhs->data.offset < rhs->data.offset;
+        });
+    // Payloads only move down in offset order, no live payload is overwritten before it is moved.
+    uint32_t dataCount = 0;
+    for (auto *item : payloadItems) {
+        uint32_t size = static_cast<uint32_t>(CalculateCameraMetadataItemDataSize(item->data_type, item->count));
+        if (item->data.offset < dataCount || item->data.offset > dst->data_count ||
+            size > dst->data_count - item->data.offset) {
+            METADATA_ERR_LOG("CompactCameraMetadata payload out of place, offset:%{public}u", item->data.offset);
+            return CAM_META_FAILURE;
+        }
+        if (item->data.offset != dataCount &&
+            memmove_s(dstMetadataData + dataCount, dst->data_capacity - dataCount,
+                dstMetadataData + item->data.offset, size) != EOK) {
+            METADATA_ERR_LOG("CompactCameraMetadata memory move failed");
+            return CAM_META_FAILURE;
+        }
+        item->data.offset = dataCount;
+        dataCount += size;
+    }
+    dst->data_count = dataCount;
+    METADATA_DEBUG_LOG("CompactCameraMetadata end");
+    return CAM_META_SUCCESS;
+}
+
 void CameraMetadata::FreeCameraMetadataBuffer(common_metadata_header_t *dst)
 {
     if (dst != nullptr) {
+        InvalidateItemIndex(dst);
+        ForgetSlack(dst);
         free(dst);
     }
 }
@@ -1570,6 +1955,7 @@ int32_t CameraMetadata::CopyCameraMetadataItems(common_metadata_header_t *newMet
 
     newMetadata->item_count = oldMetadata->item_count;
     newMetadata->data_count = oldMetadata->data_count;
+    InvalidateItemIndex(newMetadata);
 
     return CAM_META_SUCCESS;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -105,6 +105,16 @@ int DeleteCameraMetadataItemByIndex(common_metadata_header_t *dst, uint32_t inde
     return CameraMetadata::DeleteCameraMetadataItemByIndex(dst, index);
 }
 
+void SetCameraMetadataSlack(common_metadata_header_t *dst, bool enable)
+{
+    CameraMetadata::SetCameraMetadataSlack(dst, enable);
+}
+
+int CompactCameraMetadata(common_metadata_header_t *dst)
+{
+    return CameraMetadata::CompactCameraMetadata(dst);
+}
+
 int DeleteCameraMetadataItem(common_metadata_header_t *dst, uint32_t item)
 {
     return CameraMetadata::DeleteCameraMetadataItem(dst, item);
@@ -149,4 +159,9 @@ int32_t GetAllVendorTags(std::vector<vendorTag_t>& tagVec)
 {
     return CameraMetadata::GetAllVendorTags(tagVec);
 }
+
+void ResetVendorTagTable()
+{
+    CameraMetadata::ResetVendorTagTable();
+}
 } // Camera
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,7 +14,12 @@
  */
 
 #include "metadata_utils.h"
+#include <algorithm>
+#include <atomic>
 #include <securec.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "ashmem.h"
 #include "metadata_log.h"
 #include "camera_metadata_item_info.h"
 
@@ -29,38 +34,39 @@ if (cond) { \
 #endif
 
 namespace OHOS::Camera {
+namespace {
+constexpr size_t VEC_ITEM_HEADER_SIZE = sizeof(uint32_t) * 4;
+constexpr uint64_t MAX_ASHMEM_METADATA_SIZE = sizeof(common_metadata_header_t) +
+    static_cast<uint64_t>(sizeof(camera_metadata_item_entry_t)) * MAX_ITEM_CAPACITY + MAX_DATA_CAPACITY;
+
+// Leads the ashmem region, the generation and length must match the ones sent along with the fd.
+struct MetadataAshmemHeader {
+    uint64_t generation;
+    uint32_t length;
+    uint32_t reserved;
+};
+
+std::atomic<uint64_t> g_ashmemGeneration { 0 };
+}
+
+// The vector carries payloads in host byte order, as laid out in the item, so each one is a single copy.
+static_assert(sizeof(camera_rational_t) == sizeof(int32_t) * 2, "camera_rational_t must be two packed int32_t");
+
+static size_t GetItemPayloadSize(uint32_t dataType, uint32_t count)
+{
+    if (dataType >= META_NUM_TYPES) {
+        return 0;
+    }
+    return OHOS_CAMERA_METADATA_TYPE_SIZE[dataType] * count;
+}
+
 void MetadataUtils::WriteMetadataDataToVec(const camera_metadata_item_t &entry, std::vector<uint8_t>& cameraAbility)
 {
-    if (entry.data_type == META_TYPE_BYTE) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<int8_t>(*(entry.data.u8 + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_INT32) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<int32_t>(*(entry.data.i32 + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_UINT32) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<uint32_t>(*(entry.data.ui32 + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_FLOAT) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<float>(*(entry.data.f + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_INT64) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<int64_t>(*(entry.data.i64 + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_DOUBLE) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<double>(*(entry.data.d + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_RATIONAL) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<int32_t>((*(entry.data.r + i)).numerator, cameraAbility);
-            WriteData<int32_t>((*(entry.data.r + i)).denominator, cameraAbility);
-        }
+    size_t payloadSize = GetItemPayloadSize(entry.data_type, entry.count);
+    if (payloadSize == 0 || entry.data.u8 == nullptr) {
+        return;
     }
+    cameraAbility.insert(cameraAbility.end(), entry.data.u8, entry.data.u8 + payloadSize);
 }
 
 bool MetadataUtils::ConvertMetadataToVec(const std::shared_ptr<CameraMetadata> &metadata,
@@ -92,25 +98,32 @@ bool MetadataUtils::ConvertMetadataToVec(const std::shared_ptr<CameraMetadata> &
         return false;
     }
 
-    WriteData<uint32_t>(tagCount, cameraAbility);
-    WriteData<uint32_t>(itemCapacity, cameraAbility);
-    WriteData<uint32_t>(dataCapacity, cameraAbility);
+    std::vector<camera_metadata_item_t> items(tagCount);
+    size_t totalSize = MIN_VEC_SIZE;
     for (uint32_t i = 0; i < tagCount; i++) {
-        camera_metadata_item_t item;
+        camera_metadata_item_t &item = items[i];
         int ret = GetCameraMetadataItem(meta, i, &item);
         if (ret != CAM_META_SUCCESS) {
             METADATA_ERR_LOG("ConvertMetadataToVec get meta item failed!");
             return false;
         }
-        WriteData<uint32_t>(item.index, cameraAbility);
-        WriteData<uint32_t>(item.item, cameraAbility);
-        WriteData<uint32_t>(item.data_type, cameraAbility);
-        WriteData<uint32_t>(item.count, cameraAbility);
         if (item.count > MAX_SUPPORTED_ITEMS) {
             METADATA_ERR_LOG("ConvertMetadataToVec item.count out of range:%{public}d item:%{public}d",
                 item.count, item.item);
             return false;
         }
+        totalSize += VEC_ITEM_HEADER_SIZE + GetItemPayloadSize(item.data_type, item.count);
+    }
+
+    cameraAbility.reserve(totalSize);
+    WriteData<uint32_t>(tagCount, cameraAbility);
+    WriteData<uint32_t>(itemCapacity, cameraAbility);
+    WriteData<uint32_t>(dataCapacity, cameraAbility);
+    for (const auto &item : items) {
+        WriteData<uint32_t>(item.index, cameraAbility);
+        WriteData<uint32_t>(item.item, cameraAbility);
+        WriteData<uint32_t>(item.data_type, cameraAbility);
+        WriteData<uint32_t>(item.count, cameraAbility);
         WriteMetadataDataToVec(item, cameraAbility);
     }
     return true;
@@ -155,110 +168,18 @@ bool MetadataUtils::EncodeCameraMetadata(const std::shared_ptr<CameraMetadata> &
     return WriteCameraMetadata(meta, data);
 }
 
-static void ReadMetadataDataFromVecUInt8(int32_t &index, camera_metadata_item_t &entry,
+bool MetadataUtils::ReadMetadataDataFromVec(int32_t &index, camera_metadata_item_t &entry, size_t &payloadOffset,
     const std::vector<uint8_t>& cameraAbility)
 {
-    entry.data.u8 = new(std::nothrow) uint8_t[entry.count];
-    if (entry.data.u8 != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<uint8_t>(entry.data.u8[i], index, cameraAbility);
-        }
-    }
-}
-
-static void ReadMetadataDataFromVecInt32(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
-{
-    entry.data.i32 = new(std::nothrow) int32_t[entry.count];
-    if (entry.data.i32 != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<int32_t>(entry.data.i32[i], index, cameraAbility);
-        }
-    }
-}
-
-static void ReadMetadataDataFromVecUInt32(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
-{
-    entry.data.ui32 = new(std::nothrow) uint32_t[entry.count];
-    if (entry.data.ui32 != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<uint32_t>(entry.data.ui32[i], index, cameraAbility);
-        }
-    }
-}
-
-static void ReadMetadataDataFromVecFloat(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
-{
-    entry.data.f = new(std::nothrow) float[entry.count];
-    if (entry.data.f != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<float>(entry.data.f[i], index, cameraAbility);
-        }
-    }
-}
-
-static void ReadMetadataDataFromVecInt64(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
-{
-    entry.data.i64 = new(std::nothrow) int64_t[entry.count];
-    if (entry.data.i64 != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<int64_t>(entry.data.i64[i], index, cameraAbility);
-        }
-    }
-}
-
-static void ReadMetadataDataFromVecDouble(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
-{
-    entry.data.d = new(std::nothrow) double[entry.count];
-    if (entry.data.d != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<double>(entry.data.d[i], index, cameraAbility);
-        }
-    }
-}
-
-static void ReadMetadataDataFromVecRational(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
-{
-    entry.data.r = new(std::nothrow) camera_rational_t[entry.count];
-    if (entry.data.r != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<int32_t>(entry.data.r[i].numerator, index, cameraAbility);
-            MetadataUtils::ReadData<int32_t>(entry.data.r[i].denominator, index, cameraAbility);
-        }
-    }
-}
-
-void MetadataUtils::ReadMetadataDataFromVec(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
-{
-    switch (entry.data_type) {
-        case META_TYPE_BYTE:
-            ReadMetadataDataFromVecUInt8(index, entry, cameraAbility);
-            break;
-        case META_TYPE_INT32:
-            ReadMetadataDataFromVecInt32(index, entry, cameraAbility);
-            break;
-        case META_TYPE_UINT32:
-            ReadMetadataDataFromVecUInt32(index, entry, cameraAbility);
-            break;
-        case META_TYPE_FLOAT:
-            ReadMetadataDataFromVecFloat(index, entry, cameraAbility);
-            break;
-        case META_TYPE_INT64:
-            ReadMetadataDataFromVecInt64(index, entry, cameraAbility);
-            break;
-        case META_TYPE_DOUBLE:
-            ReadMetadataDataFromVecDouble(index, entry, cameraAbility);
-            break;
-        case META_TYPE_RATIONAL:
-            ReadMetadataDataFromVecRational(index, entry, cameraAbility);
-            break;
+    size_t payloadSize = GetItemPayloadSize(entry.data_type, entry.count);
+    if (static_cast<size_t>(index) + payloadSize > cameraAbility.size()) {
+        METADATA_ERR_LOG("ConvertVecToMetadata payload out of range item:%{public}d size:%{public}zu",
+            entry.item, payloadSize);
+        return false;
     }
+    payloadOffset = static_cast<size_t>(index);
+    index += static_cast<int32_t>(payloadSize);
+    return true;
 }
 
 void MetadataUtils::ConvertVecToMetadata(const std::vector<uint8_t>& cameraAbility,
@@ -269,8 +190,8 @@ void MetadataUtils::ConvertVecToMetadata(const std::vector<uint8_t>& cameraAbili
     uint32_t itemCapacity = 0;
     uint32_t dataCapacity = 0;
 
-    if (cameraAbility.size() < MIN_VEC_SIZE) {
-        METADATA_ERR_LOG("ConvertVecToMetadata cameraAbility size:%{public}d", static_cast<int>(cameraAbility.size()));
+    if (cameraAbility.size() < MIN_VEC_SIZE || cameraAbility.size() > INT32_MAX) {
+        METADATA_ERR_LOG("ConvertVecToMetadata cameraAbility size:%{public}zu", cameraAbility.size());
         return;
     }
     ReadData<uint32_t>(tagCount, index, cameraAbility);
@@ -289,8 +210,14 @@ void MetadataUtils::ConvertVecToMetadata(const std::vector<uint8_t>& cameraAbili
         return;
     }
 
-    std::vector<camera_metadata_item_t> items;
+    // Payloads are added straight from the vector, so only their offsets are kept.
+    std::vector<std::pair<camera_metadata_item_t, size_t>> items;
+    items.reserve(tagCount);
     for (uint32_t i = 0; i < tagCount; i++) {
+        if (static_cast<size_t>(index) + VEC_ITEM_HEADER_SIZE > cameraAbility.size()) {
+            METADATA_ERR_LOG("ConvertVecToMetadata item header out of range:%{public}u", i);
+            return;
+        }
         camera_metadata_item_t item;
         ReadData<uint32_t>(item.index, index, cameraAbility);
         ReadData<uint32_t>(item.item, index, cameraAbility);
@@ -301,17 +228,17 @@ void MetadataUtils::ConvertVecToMetadata(const std::vector<uint8_t>& cameraAbili
                 item.count, item.item);
             return;
         }
-        ReadMetadataDataFromVec(index, item, cameraAbility);
-        items.push_back(item);
+        size_t payloadOffset = 0;
+        if (!ReadMetadataDataFromVec(index, item, payloadOffset, cameraAbility)) {
+            return;
+        }
+        items.emplace_back(item, payloadOffset);
     }
 
     metadata = std::make_shared<CameraMetadata>(itemCapacity, dataCapacity);
     common_metadata_header_t *meta = metadata->get();
-    for (auto &item_ : items) {
-        void *buffer = nullptr;
-        MetadataUtils::ItemDataToBuffer(item_, &buffer);
-        (void)AddCameraMetadataItem(meta, item_.item, buffer, item_.count);
-        FreeMetadataBuffer(item_);
+    for (const auto &[item, payloadOffset] : items) {
+        (void)AddCameraMetadataItem(meta, item.item, cameraAbility.data() + payloadOffset, item.count);
     }
 }
 
@@ -321,7 +248,8 @@ void MetadataUtils::ReadCameraMetadata(MessageParcel &data, common_metadata_head
         return;
     }
 
-    std::vector<camera_metadata_item_t> items;
+    // Payloads are copied from the parcel straight into the item table and data region of meta.
+    std::vector<int32_t> rationalBuffer;
     for (uint32_t i = 0; i < tagCount; i++) {
         camera_metadata_item_t item;
         item.index = data.ReadUint32();
@@ -332,29 +260,24 @@ void MetadataUtils::ReadCameraMetadata(MessageParcel &data, common_metadata_head
             item.count = MAX_SUPPORTED_ITEMS;
             METADATA_ERR_LOG("MetadataUtils::ReadCameraMetadata item.count is more than supported value");
         }
-        MetadataUtils::ReadMetadata(item, data);
+        const void *payload = ReadMetadataPayload(item, data, rationalBuffer);
         uint32_t dataType;
         int32_t ret = GetCameraMetadataItemType(item.item, &dataType);
         if (ret != CAM_META_SUCCESS) {
             METADATA_ERR_LOG("MetadataUtils::ReadCameraMetadata get item type failed!");
-            FreeMetadataBuffer(item);
             continue;
         }
         if (dataType != item.data_type) {
             METADATA_ERR_LOG("MetadataUtils::ReadCameraMetadata item data type mismatch! item: %{public}u,"
                              " data type: %{public}u, expected data type: %{public}u",
                              item.item, item.data_type, dataType);
-            FreeMetadataBuffer(item);
             continue;
         }
-        items.push_back(item);
-    }
-
-    for (auto &item_ : items) {
-        void *buffer = nullptr;
-        MetadataUtils::ItemDataToBuffer(item_, &buffer);
-        (void)AddCameraMetadataItem(meta, item_.item, buffer, item_.count);
-        FreeMetadataBuffer(item_);
+        if (payload == nullptr || item.count == 0) {
+            METADATA_ERR_LOG("MetadataUtils::ReadCameraMetadata item payload is empty! item: %{public}u", item.item);
+            continue;
+        }
+        (void)AddCameraMetadataItem(meta, item.item, payload, item.count);
     }
 }
 
@@ -387,6 +310,91 @@ void MetadataUtils::DecodeCameraMetadata(MessageParcel &data, std::shared_ptr<Ca
     ReadCameraMetadata(data, metadata->get(), tagCount);
 }
 
+bool MetadataUtils::EncodeCameraMetadataToAshmem(const std::shared_ptr<CameraMetadata> &metadata,
+    MessageParcel &data)
+{
+    if (metadata == nullptr || metadata->get() == nullptr) {
+        METADATA_ERR_LOG("MetadataUtils::EncodeCameraMetadataToAshmem metadata is invalid");
+        return false;
+    }
+    common_metadata_header_t *meta = metadata->get();
+    uint64_t length = GetEncodedLength(meta);
+    if (length < ASHMEM_METADATA_THRESHOLD || length > MAX_ASHMEM_METADATA_SIZE) {
+        return data.WriteBool(false) && EncodeCameraMetadata(metadata, data);
+    }
+    MetadataAshmemHeader header = { g_ashmemGeneration.fetch_add(1) + 1, static_cast<uint32_t>(length), 0 };
+    size_t mapSize = sizeof(MetadataAshmemHeader) + header.length;
+    int fd = AshmemCreate("camera_metadata", mapSize);
+    if (fd < 0) {
+        METADATA_ERR_LOG("MetadataUtils::EncodeCameraMetadataToAshmem create ashmem failed");
+        return data.WriteBool(false) && EncodeCameraMetadata(metadata, data);
+    }
+    void *addr = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        METADATA_ERR_LOG("MetadataUtils::EncodeCameraMetadataToAshmem map ashmem failed");
+        close(fd);
+        return data.WriteBool(false) && EncodeCameraMetadata(metadata, data);
+    }
+    char *region = static_cast<char *>(addr);
+    bool isEncoded = memcpy_s(region, mapSize, &header, sizeof(header)) == EOK &&
+        EncodeToBuffer(meta, region + sizeof(header), header.length);
+    munmap(addr, mapSize);
+    // Sealed read only before it leaves, so no receiver sees the snapshot change under it.
+    if (!isEncoded || AshmemSetProt(fd, PROT_READ) < 0) {
+        METADATA_ERR_LOG("MetadataUtils::EncodeCameraMetadataToAshmem write ashmem failed");
+        close(fd);
+        return false;
+    }
+    bool bRet = data.WriteBool(true) && data.WriteUint64(header.generation) && data.WriteUint32(header.length) &&
+        data.WriteFileDescriptor(fd);
+    close(fd);
+    return bRet;
+}
+
+void MetadataUtils::DecodeCameraMetadataFromAshmem(MessageParcel &data, std::shared_ptr<CameraMetadata> &metadata)
+{
+    if (!data.ReadBool()) {
+        DecodeCameraMetadata(data, metadata);
+        return;
+    }
+    metadata = nullptr;
+    uint64_t generation = data.ReadUint64();
+    uint32_t length = data.ReadUint32();
+    int fd = data.ReadFileDescriptor();
+    if (fd < 0 || length < sizeof(common_metadata_header_t) || length > MAX_ASHMEM_METADATA_SIZE) {
+        METADATA_ERR_LOG("MetadataUtils::DecodeCameraMetadataFromAshmem invalid ashmem, length: %{public}u", length);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return;
+    }
+    // The sender seals the region before it leaves, one still writable could change while it is decoded.
+    int prot = AshmemGetProt(fd);
+    if (prot < 0 || (static_cast<uint32_t>(prot) & PROT_WRITE) != 0) {
+        METADATA_ERR_LOG("MetadataUtils::DecodeCameraMetadataFromAshmem ashmem not sealed, prot: %{public}d", prot);
+        close(fd);
+        return;
+    }
+    size_t mapSize = sizeof(MetadataAshmemHeader) + length;
+    int ashmemSize = AshmemGetSize(fd);
+    void *addr = (ashmemSize < 0 || static_cast<size_t>(ashmemSize) < mapSize) ? MAP_FAILED :
+        mmap(nullptr, mapSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        METADATA_ERR_LOG("MetadataUtils::DecodeCameraMetadataFromAshmem map ashmem failed, size: %{public}d",
+            ashmemSize);
+        return;
+    }
+    const char *region = static_cast<const char *>(addr);
+    const MetadataAshmemHeader *header = reinterpret_cast<const MetadataAshmemHeader *>(region);
+    if (header->generation == generation && header->length == length) {
+        metadata = DecodeFromBuffer(region + sizeof(MetadataAshmemHeader), length);
+    } else {
+        METADATA_ERR_LOG("MetadataUtils::DecodeCameraMetadataFromAshmem generation mismatch");
+    }
+    munmap(addr, mapSize);
+}
+
 bool MetadataUtils::WriteMetadata(const camera_metadata_item_t &item, MessageParcel &data)
 {
     bool bRet = false;
@@ -417,27 +425,39 @@ bool MetadataUtils::WriteMetadata(const camera_metadata_item_t &item, MessagePar
 
 std::string MetadataUtils::EncodeToString(std::shared_ptr<CameraMetadata> metadata)
 {
-    int32_t ret;
-    const uint32_t headerLength = sizeof(common_metadata_header_t);
-    const uint32_t itemLen = sizeof(camera_metadata_item_entry_t);
-    const uint32_t itemFixedLen = offsetof(camera_metadata_item_entry_t, data);
-
     if (metadata == nullptr || metadata->get() == nullptr) {
         METADATA_ERR_LOG("MetadataUtils::EncodeToString Metadata is invalid");
         return {};
     }
 
     common_metadata_header_t *meta = metadata->get();
-    METADATA_CHECK_ERROR_RETURN_RET_LOG(
-        (static_cast<uint64_t>(headerLength) + (itemLen * meta->item_count) + meta->data_count) >
-        static_cast<uint64_t>(UINT32_MAX), {}, "encodeDataLen is overflow");
-    uint32_t encodeDataLen = headerLength + (itemLen * meta->item_count) + meta->data_count;
+    uint64_t encodeDataLen = GetEncodedLength(meta);
+    METADATA_CHECK_ERROR_RETURN_RET_LOG(encodeDataLen > static_cast<uint64_t>(UINT32_MAX), {},
+        "encodeDataLen is overflow");
     std::string s(encodeDataLen, '\0');
-    char *encodeData = &s[0];
+    if (!EncodeToBuffer(meta, &s[0], static_cast<uint32_t>(encodeDataLen))) {
+        return {};
+    }
+    return s;
+}
+
+uint64_t MetadataUtils::GetEncodedLength(const common_metadata_header_t *meta)
+{
+    return static_cast<uint64_t>(sizeof(common_metadata_header_t)) +
+        static_cast<uint64_t>(sizeof(camera_metadata_item_entry_t)) * meta->item_count + meta->data_count;
+}
+
+bool MetadataUtils::EncodeToBuffer(common_metadata_header_t *meta, char *encodeData, uint32_t encodeDataLen)
+{
+    int32_t ret;
+    const uint32_t headerLength = sizeof(common_metadata_header_t);
+    const uint32_t itemLen = sizeof(camera_metadata_item_entry_t);
+    const uint32_t itemFixedLen = offsetof(camera_metadata_item_entry_t, data);
+    char *encodeStart = encodeData;
     ret = memcpy_s(encodeData, encodeDataLen, meta, headerLength);
     if (ret != EOK) {
         METADATA_ERR_LOG("MetadataUtils::EncodeToString Failed to copy memory for metadata header");
-        return {};
+        return false;
     }
     encodeData += headerLength;
     encodeDataLen -= headerLength;
@@ -445,20 +465,20 @@ std::string MetadataUtils::EncodeToString(std::shared_ptr<CameraMetadata> metada
     for (uint32_t index = 0; index < meta->item_count; index++, item++) {
         ret = memcpy_s(encodeData, encodeDataLen, item, itemFixedLen);
         METADATA_CHECK_ERROR_RETURN_RET_LOG(
-            ret != EOK, {}, "MetadataUtils::EncodeToString Failed to copy memory for item fixed fields");
+            ret != EOK, false, "MetadataUtils::EncodeToString Failed to copy memory for item fixed fields");
         encodeData += itemFixedLen;
         METADATA_CHECK_ERROR_RETURN_RET_LOG(
-            encodeDataLen < itemFixedLen, {}, "encodeDataLen <= itemFixedLen");
+            encodeDataLen < itemFixedLen, false, "encodeDataLen <= itemFixedLen");
         encodeDataLen -= itemFixedLen;
         METADATA_CHECK_ERROR_RETURN_RET_LOG(
-            itemLen < itemFixedLen, {}, "itemLen <= itemFixedLen");
+            itemLen < itemFixedLen, false, "itemLen <= itemFixedLen");
         uint32_t dataLen = itemLen - itemFixedLen;
         METADATA_CHECK_ERROR_RETURN_RET_LOG(
-            item == nullptr, {}, "MetadataUtils::EncodeToString Failed, item is nullptr");
+            item == nullptr, false, "MetadataUtils::EncodeToString Failed, item is nullptr");
         ret = memcpy_s(encodeData, encodeDataLen,  &(item->data), dataLen);
         if (ret != EOK) {
             METADATA_ERR_LOG("MetadataUtils::EncodeToString Failed to copy memory for item data field");
-            return {};
+            return false;
         }
         encodeData += dataLen;
         encodeDataLen -= dataLen;
@@ -467,14 +487,13 @@ std::string MetadataUtils::EncodeToString(std::shared_ptr<CameraMetadata> metada
     if (meta->data_count != 0) {
         ret = copyEncodeToStringMem(meta, encodeData, encodeDataLen);
         if (ret != CAM_META_SUCCESS) {
-            return {};
+            return false;
         }
         encodeData += meta->data_count;
     }
     METADATA_DEBUG_LOG("MetadataUtils::EncodeToString Calculated length: %{public}zu, encoded length: %{public}zu",
-                       s.capacity(), (encodeData - &s[0]));
-
-    return s;
+        GetEncodedLength(meta), static_cast<size_t>(encodeData - encodeStart));
+    return true;
 }
 
 int MetadataUtils::copyEncodeToStringMem(common_metadata_header_t *meta, char *encodeData, int32_t encodeDataLen)
@@ -494,9 +513,13 @@ int MetadataUtils::copyEncodeToStringMem(common_metadata_header_t *meta, char *e
 }
 
 std::shared_ptr<CameraMetadata> MetadataUtils::DecodeFromString(std::string setting)
+{
+    return DecodeFromBuffer(&setting[0], setting.capacity());
+}
+
+std::shared_ptr<CameraMetadata> MetadataUtils::DecodeFromBuffer(const char *setting, uint32_t totalLen)
 {
     int32_t ret;
-    uint32_t totalLen = setting.capacity();
     const uint32_t headerLength = sizeof(common_metadata_header_t);
     const uint32_t itemLen = sizeof(camera_metadata_item_entry_t);
     const uint32_t itemFixedLen = offsetof(camera_metadata_item_entry_t, data);
@@ -504,7 +527,7 @@ std::shared_ptr<CameraMetadata> MetadataUtils::DecodeFromString(std::string sett
     IF_COND_PRINT_MSG_AND_RETURN(totalLen < headerLength,
         "MetadataUtils::DecodeFromString Length is less than metadata header length")
 
-    char *decodeData = &setting[0];
+    const char *decodeData = setting;
     common_metadata_header_t header;
     ret = memcpy_s(&header, headerLength, decodeData, headerLength);
 
@@ -531,7 +554,7 @@ std::shared_ptr<CameraMetadata> MetadataUtils::DecodeFromString(std::string sett
     decodeData += headerLength;
     camera_metadata_item_entry_t *item = GetMetadataItems(meta);
     for (uint32_t index = 0; index < meta->item_count; index++, item++) {
-        METADATA_CHECK_ERROR_RETURN_RET_LOG(totalLen < ((decodeData - &setting[0]) + itemLen), {},
+        METADATA_CHECK_ERROR_RETURN_RET_LOG(totalLen < ((decodeData - setting) + itemLen), {},
             "MetadataUtils::DecodeFromString Failed at item index: %{public}u", index);
         ret = memcpy_s(item, itemFixedLen, decodeData, itemFixedLen);
 
@@ -554,19 +577,18 @@ std::shared_ptr<CameraMetadata> MetadataUtils::DecodeFromString(std::string sett
         decodeData += dataLen;
     }
 
-    char *decodeMetadataData = &setting[0];
-    ret = copyDecodeFromStringMem(meta, decodeData, decodeMetadataData, totalLen);
+    ret = copyDecodeFromStringMem(meta, decodeData, setting, totalLen);
     if (ret != CAM_META_SUCCESS) {
         return {};
     }
 
-    METADATA_DEBUG_LOG("MetadataUtils::DecodeFromString String length: %{public}zu, Decoded length: %{public}zu",
-                       setting.capacity(), (decodeData - &setting[0]));
+    METADATA_DEBUG_LOG("MetadataUtils::DecodeFromString String length: %{public}u, Decoded length: %{public}zu",
+        totalLen, static_cast<size_t>(decodeData - setting));
     return metadata;
 }
 
-int MetadataUtils::copyDecodeFromStringMem(common_metadata_header_t *meta, char *decodeData,
-    char *decodeMetadataData, uint32_t totalLen)
+int MetadataUtils::copyDecodeFromStringMem(common_metadata_header_t *meta, const char *decodeData,
+    const char *decodeMetadataData, uint32_t totalLen)
 {
     if (meta->data_count != 0) {
         IF_COND_PRINT_MSG_AND_RETURN(
@@ -588,138 +610,23 @@ int MetadataUtils::copyDecodeFromStringMem(common_metadata_header_t *meta, char
     return CAM_META_SUCCESS;
 }
 
-static void ReadMetadataUInt8(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.u8 = new(std::nothrow) uint8_t[entry.count];
-    if (entry.data.u8 != nullptr) {
-        size_t dataSize = entry.count * sizeof(uint8_t);
-        const uint8_t* ptr = data.ReadUnpadBuffer(dataSize);
-        memcpy_s(entry.data.u8, dataSize, ptr, dataSize);
-    }
-}
-
-static void ReadMetadataInt32(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.i32 = new(std::nothrow) int32_t[entry.count];
-    if (entry.data.i32 != nullptr) {
-        size_t dataSize = entry.count * sizeof(int32_t);
-        const uint8_t* ptr = data.ReadUnpadBuffer(dataSize);
-        memcpy_s(entry.data.i32, dataSize, ptr, dataSize);
-    }
-}
-
-static void ReadMetadataUInt32(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.ui32 = new(std::nothrow) uint32_t[entry.count];
-    if (entry.data.ui32 != nullptr) {
-        size_t dataSize = entry.count * sizeof(uint32_t);
-        const uint8_t* ptr = data.ReadUnpadBuffer(dataSize);
-        memcpy_s(entry.data.ui32, dataSize, ptr, dataSize);
-    }
-}
-
-static void ReadMetadataFloat(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.f = new(std::nothrow) float[entry.count];
-    if (entry.data.f != nullptr) {
-        size_t dataSize = entry.count * sizeof(float);
-        const uint8_t* ptr = data.ReadUnpadBuffer(dataSize);
-        memcpy_s(entry.data.f, dataSize, ptr, dataSize);
-    }
-}
-
-static void ReadMetadataInt64(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.i64 = new(std::nothrow) int64_t[entry.count];
-    if (entry.data.i64 != nullptr) {
-        size_t dataSize = entry.count * sizeof(int64_t);
-        const uint8_t* ptr = data.ReadUnpadBuffer(dataSize);
-        memcpy_s(entry.data.i64, dataSize, ptr, dataSize);
-    }
-}
-
-static void ReadMetadataDouble(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.d = new(std::nothrow) double[entry.count];
-    if (entry.data.d != nullptr) {
-        size_t dataSize = entry.count * sizeof(double);
-        const uint8_t* ptr = data.ReadUnpadBuffer(dataSize);
-        memcpy_s(entry.data.d, dataSize, ptr, dataSize);
-    }
-}
-
-static void ReadMetadataRational(camera_metadata_item_t &entry, MessageParcel &data)
+const void *MetadataUtils::ReadMetadataPayload(camera_metadata_item_t &item, MessageParcel &data,
+    std::vector<int32_t> &rationalBuffer)
 {
-    std::vector<int32_t> buffers;
-    data.ReadInt32Vector(&buffers);
-    if (buffers.size() < 1) {
-        METADATA_ERR_LOG("MetadataUtils::ReadMetadataRational the buffers size < 1");
-        entry.data.r = nullptr;
-        return;
-    }
-    entry.data.r = new(std::nothrow) camera_rational_t[entry.count];
-    if (entry.data.r != nullptr) {
-        for (size_t i = 0, j = 0;
-            i < entry.count && j < static_cast<size_t>(buffers.size() - 1);
-            i++, j += 2) { // 2:Take two elements from the buffer vector container
-            entry.data.r[i].numerator = buffers.at(j);
-            entry.data.r[i].denominator = buffers.at(j + 1);
+    if (item.data_type == META_TYPE_RATIONAL) {
+        // Rationals travel as an int32 vector, the buffer is reused across the items of a parcel.
+        if (!data.ReadInt32Vector(&rationalBuffer)) {
+            return nullptr;
         }
+        constexpr size_t rationalFields = 2;
+        item.count = std::min(item.count, static_cast<uint32_t>(rationalBuffer.size() / rationalFields));
+        return rationalBuffer.data();
     }
-}
-bool MetadataUtils::ReadMetadata(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    if (entry.count > MAX_SUPPORTED_ITEMS) {
-        entry.count = MAX_SUPPORTED_ITEMS;
-        METADATA_ERR_LOG("MetadataUtils::ReadMetadata item.count is more than supported value");
-    }
-    switch (entry.data_type) {
-        case META_TYPE_BYTE:
-            ReadMetadataUInt8(entry, data);
-            break;
-        case META_TYPE_INT32:
-            ReadMetadataInt32(entry, data);
-            break;
-        case META_TYPE_UINT32:
-            ReadMetadataUInt32(entry, data);
-            break;
-        case META_TYPE_FLOAT:
-            ReadMetadataFloat(entry, data);
-            break;
-        case META_TYPE_INT64:
-            ReadMetadataInt64(entry, data);
-            break;
-        case META_TYPE_DOUBLE:
-            ReadMetadataDouble(entry, data);
-            break;
-        case META_TYPE_RATIONAL:
-            ReadMetadataRational(entry, data);
-            break;
-    }
-    return true;
-}
-
-void MetadataUtils::ItemDataToBuffer(const camera_metadata_item_t &item, void **buffer)
-{
-    if (buffer == nullptr) {
-        METADATA_ERR_LOG("MetadataUtils::ItemDataToBuffer buffer is null");
-        return;
-    }
-    if (item.data_type == META_TYPE_BYTE) {
-        *buffer = reinterpret_cast<void *>(item.data.u8);
-    } else if (item.data_type == META_TYPE_INT32) {
-        *buffer = reinterpret_cast<void *>(item.data.i32);
-    } else if (item.data_type == META_TYPE_FLOAT) {
-        *buffer = reinterpret_cast<void *>(item.data.f);
-    } else if (item.data_type == META_TYPE_UINT32) {
-        *buffer = reinterpret_cast<void *>(item.data.ui32);
-    } else if (item.data_type == META_TYPE_INT64) {
-        *buffer = reinterpret_cast<void *>(item.data.i64);
-    } else if (item.data_type == META_TYPE_DOUBLE) {
-        *buffer = reinterpret_cast<void *>(item.data.d);
-    } else if (item.data_type == META_TYPE_RATIONAL) {
-        *buffer = reinterpret_cast<void *>(item.data.r);
+    size_t payloadSize = GetItemPayloadSize(item.data_type, item.count);
+    if (payloadSize == 0) {
+        return nullptr;
     }
+    return data.ReadUnpadBuffer(payloadSize);
 }
 
 void MetadataUtils::FreeMetadataBuffer(camera_metadata_item_t &entry)